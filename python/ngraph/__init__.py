@@ -89,3 +89,6 @@ from ngraph.ops import tanh
 from ngraph.ops import topk
 
 from ngraph.runtime import runtime
+
+from ngraph.utils.graph_builder import function_from_bytes
+from ngraph.utils.graph_builder import function_from_ops
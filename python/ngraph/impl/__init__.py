@@ -42,5 +42,8 @@ from _pyngraph import AxisSet
 from _pyngraph import AxisVector
 from _pyngraph import Coordinate
 
+from _pyngraph import deserialize
+from _pyngraph import deserialize_bytes
 from _pyngraph import serialize
+from _pyngraph import serialize_structure
 from _pyngraph import util
@@ -15,12 +15,12 @@
 # ******************************************************************************
 """Provide a layer of abstraction for the ngraph++ runtime environment."""
 import logging
-from typing import List, Union
+from typing import Any, Dict, List, Optional, Union
 
 import numpy as np
 
-from ngraph.impl import Function, Node, Shape, serialize, util
-from ngraph.impl.runtime import Backend, Executable, Tensor
+from ngraph.impl import Function, Node, Shape, serialize, serialize_structure, util
+from ngraph.impl.runtime import Backend, CallFuture, Executable, Tensor
 from ngraph.utils.types import get_dtype, NumericData
 from ngraph.exceptions import UserInputError
 
@@ -35,12 +35,28 @@ def runtime(backend_name='CPU'):  # type: (str) -> 'Runtime'
     return Runtime(backend_name)
 
 
+def to_asyncio_future(call_future, loop=None):  # type: (CallFuture, Any) -> Any
+    """Wrap the CallFuture returned by Executable.begin_call in an asyncio future.
+
+    The wait happens on the loop's default executor, without holding the GIL.
+    """
+    import asyncio
+    if loop is None:
+        loop = asyncio.get_event_loop()
+    return loop.run_in_executor(None, call_future.result)
+
+
 class Runtime:
-    """Represents the ngraph++ runtime environment."""
+    """Represents the ngraph++ runtime environment.
+
+    Compiled functions are cached by their structure, which includes the parameter shapes and
+    types, so building the same computation again does not compile it again.
+    """
 
     def __init__(self, backend_name):  # type: (str) -> None
         self.backend_name = backend_name
         self.backend = Backend.create(backend_name)
+        self._executables = {}  # type: Dict[str, Executable]
 
     def __repr__(self):  # type: () -> str
         return "<Runtime: Backend='{}'>".format(self.backend_name)
@@ -50,25 +66,52 @@ class Runtime:
         """Return a callable Computation object."""
         if isinstance(node_or_function, Node):
             ng_function = Function(node_or_function, inputs, node_or_function.name)
-            return Computation(self, ng_function)
         elif isinstance(node_or_function, Function):
-            return Computation(self, node_or_function)
+            ng_function = node_or_function
         else:
             raise TypeError('Runtime.computation must be called with an nGraph Function object '
                             'or an nGraph node object an optionally Parameter node objects. '
                             'Called with: %s', node_or_function)
+        return Computation(self, ng_function, self._compile(ng_function))
+
+    def clear_cache(self):  # type: () -> None
+        """Drop the compiled functions cached by this runtime."""
+        self._executables.clear()
+
+    def _compile(self, ng_function):  # type: (Function) -> Executable
+        try:
+            key = serialize_structure(ng_function)  # type: Optional[str]
+        except RuntimeError:
+            # Functions with ops the serializer does not know are not cached
+            key = None
+
+        handle = self._executables.get(key) if key is not None else None
+        if handle is None:
+            handle = self.backend.compile(ng_function)
+            if key is not None:
+                self._executables[key] = handle
+        return handle
 
 
 class Computation(object):
-    """ngraph callable computation object."""
+    """ngraph callable computation object.
+
+    When the backend supports tensors wrapping existing memory, input arrays of the expected
+    dtype and shape are passed to the backend without copying, and results are returned as
+    arrays the backend wrote directly. The result arrays are reused: the next call overwrites
+    them, so copy any result that must outlive it.
+    """
 
-    def __init__(self, runtime, ng_function):
-        # type: (Runtime, Function) -> None
+    def __init__(self, runtime, ng_function, handle=None):
+        # type: (Runtime, Function, Optional[Executable]) -> None
         self.runtime = runtime
         self.function = ng_function
         self.parameters = ng_function.get_parameters()
         self.results = ng_function.get_results()
-        self.handle = self.runtime.backend.compile(self.function)
+        if handle is None:
+            handle = self.runtime.backend.compile(self.function)
+        self.handle = handle
+        self.zero_copy = self.runtime.backend.supports_memory_attach()
 
         self.tensor_views = []  # type: List[Tensor]
         for parameter in self.parameters:
@@ -76,11 +119,18 @@ class Computation(object):
             element_type = parameter.get_element_type()
             self.tensor_views.append(runtime.backend.create_tensor(element_type, shape))
 
+        self.result_arrays = []  # type: List[np.ndarray]
         self.result_views = []  # type: List[Tensor]
         for result in self.results:
             shape = result.get_shape()
             element_type = result.get_element_type()
-            self.result_views.append(runtime.backend.create_tensor(element_type, shape))
+            result_array = np.ndarray(shape, dtype=get_dtype(element_type))
+            self.result_arrays.append(result_array)
+            if self.zero_copy:
+                self.result_views.append(
+                    runtime.backend.create_tensor(element_type, shape, result_array))
+            else:
+                self.result_views.append(runtime.backend.create_tensor(element_type, shape))
 
     def __repr__(self):  # type: () -> str
         params_string = ', '.join([param.name for param in self.parameters])
@@ -88,20 +138,42 @@ class Computation(object):
 
     def __call__(self, *input_values):  # type: (*NumericData) -> List[NumericData]
         """Run computation on input values and return result."""
+        input_views = []  # type: List[Tensor]
         for tensor_view, value in zip(self.tensor_views, input_values):
             if not isinstance(value, np.ndarray):
                 value = np.array(value)
-            Computation._write_ndarray_to_tensor_view(value, tensor_view)
+            if self.zero_copy and Computation._can_wrap_ndarray(value, tensor_view):
+                input_views.append(self.runtime.backend.create_tensor(
+                    tensor_view.element_type, tensor_view.shape, value))
+            else:
+                Computation._write_ndarray_to_tensor_view(value, tensor_view)
+                input_views.append(tensor_view)
 
-        self.handle.call(self.result_views, self.tensor_views)
+        self.handle.call(self.result_views, input_views)
+
+        if not self.zero_copy:
+            for result_view, result in zip(self.result_views, self.result_arrays):
+                Computation._read_tensor_view_to_ndarray(result_view, result)
+
+        return list(self.result_arrays)
+
+    @property
+    def input_tensors(self):  # type: () -> List[Tensor]
+        """Backend tensors allocated once for the parameters, to be written before run()."""
+        return self.tensor_views
 
-        results = []
-        for result_view in self.result_views:
-            result = np.ndarray(result_view.shape, dtype=get_dtype(result_view.element_type))
-            Computation._read_tensor_view_to_ndarray(result_view, result)
-            results.append(result)
+    @property
+    def output_tensors(self):  # type: () -> List[Tensor]
+        """Backend tensors the results are written to by run()."""
+        return self.result_views
 
-        return results
+    def run(self):  # type: () -> None
+        """Run computation on the values in input_tensors, without any conversion.
+
+        The results are in output_tensors, and in the arrays the last __call__ returned when
+        the backend writes those in place.
+        """
+        self.handle.call(self.result_views, self.tensor_views)
 
     def serialize(self, indent=0):  # type: (int) -> str
         """Serialize function (compute graph) to a JSON string.
@@ -115,6 +187,12 @@ class Computation(object):
     def _get_buffer_size(element_type, element_count):  # type: (Tensor, int) -> int
         return int((element_type.bitwidth / 8.0) * element_count)
 
+    @staticmethod
+    def _can_wrap_ndarray(value, tensor_view):  # type: (np.ndarray, Tensor) -> bool
+        return (value.dtype == get_dtype(tensor_view.element_type) and
+                list(value.shape) == list(tensor_view.shape) and
+                value.flags['C_CONTIGUOUS'])
+
     @staticmethod
     def _write_ndarray_to_tensor_view(value, tensor_view):
         # type: (np.ndarray, Tensor) -> None
@@ -0,0 +1,46 @@
+# ******************************************************************************
+# Copyright 2018-2019 Intel Corporation
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+# ******************************************************************************
+"""Build whole functions in one call into the C++ library, rather than one call per node."""
+
+import json
+from typing import Any, Dict, List
+
+from ngraph.impl import Function, deserialize, deserialize_bytes
+
+
+def function_from_ops(ops, parameters, results, name='Function'):
+    # type: (List[Dict[str, Any]], List[str], List[str], str) -> Function
+    """Build a Function from a list of op descriptions.
+
+    Each op is a dict in the node format of ngraph.impl.serialize, for example
+    ``{'name': 'Add_2', 'op': 'Add', 'inputs': ['A', 'B']}``. Ops must come after the ops they
+    read.
+
+    :param ops: The op descriptions, in topological order.
+    :param parameters: The names of the Parameter ops, in argument order.
+    :param results: The names of the ops computing the results.
+    :param name: The name of the Function.
+    :return: The Function.
+    """
+    return deserialize(json.dumps([{'name': name,
+                                    'parameters': parameters,
+                                    'result': results,
+                                    'ops': ops}]))
+
+
+def function_from_bytes(data):  # type: (bytes) -> Function
+    """Build a Function from a serialized model: json, a CPIO archive or the binary format."""
+    return deserialize_bytes(data)
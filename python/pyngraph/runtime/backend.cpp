@@ -18,6 +18,7 @@
 #include <pybind11/stl.h>
 
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/shape.hpp"
 #include "ngraph/runtime/tensor.hpp"
 #include "pyngraph/runtime/backend.hpp"
 
@@ -30,6 +31,37 @@ static std::shared_ptr<ngraph::runtime::Executable> compile(ngraph::runtime::Bac
     return self->compile(func, enable_performance_data);
 }
 
+// Wraps the memory of a C-contiguous buffer, such as a numpy array, without copying it
+static std::shared_ptr<ngraph::runtime::Tensor>
+    create_tensor_from_buffer(ngraph::runtime::Backend* self,
+                              const ngraph::element::Type& element_type,
+                              const ngraph::Shape& shape,
+                              py::buffer buffer)
+{
+    if (!self->is_supported_property(ngraph::runtime::Backend::Property::memory_attach))
+    {
+        throw std::runtime_error("Backend does not support tensors wrapping existing memory");
+    }
+
+    py::buffer_info info = buffer.request();
+    py::ssize_t stride = info.itemsize;
+    for (py::ssize_t i = info.ndim - 1; i >= 0; --i)
+    {
+        if (info.shape[i] > 1 && info.strides[i] != stride)
+        {
+            throw std::invalid_argument("Buffer is not C-contiguous");
+        }
+        stride *= info.shape[i];
+    }
+    if (static_cast<size_t>(info.size * info.itemsize) !=
+        ngraph::shape_size(shape) * element_type.size())
+    {
+        throw std::invalid_argument("Buffer size does not match the tensor size");
+    }
+
+    return self->create_tensor(element_type, shape, info.ptr);
+}
+
 static std::shared_ptr<ngraph::runtime::Backend> create(const std::string& type)
 {
     bool must_support_dynamic = false;
@@ -46,6 +78,12 @@ void regclass_pyngraph_runtime_Backend(py::module m)
     backend.def("create_tensor",
                 (std::shared_ptr<ngraph::runtime::Tensor>(ngraph::runtime::Backend::*)(
                     const ngraph::element::Type&, const ngraph::Shape&)) &
-                    ngraph::runtime::Backend::create_tensor);
-    backend.def("compile", &compile);
+                    ngraph::runtime::Backend::create_tensor,
+                py::call_guard<py::gil_scoped_release>());
+    // The tensor keeps the buffer alive
+    backend.def("create_tensor", &create_tensor_from_buffer, py::keep_alive<0, 4>());
+    backend.def("compile", &compile, py::call_guard<py::gil_scoped_release>());
+    backend.def("supports_memory_attach", [](const ngraph::runtime::Backend& self) {
+        return self.is_supported_property(ngraph::runtime::Backend::Property::memory_attach);
+    });
 }
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <chrono>
+#include <future>
+
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 
@@ -23,8 +26,64 @@
 
 namespace py = pybind11;
 
+using TensorVector = std::vector<std::shared_ptr<ngraph::runtime::Tensor>>;
+
+namespace
+{
+    // Returned by Executable.begin_call. Keeps the executable and the tensors alive until the
+    // call has finished.
+    class CallFuture
+    {
+    public:
+        CallFuture(std::shared_ptr<ngraph::runtime::Executable> executable,
+                   const TensorVector& outputs,
+                   const TensorVector& inputs)
+            : m_executable(executable)
+            , m_outputs(outputs)
+            , m_inputs(inputs)
+            , m_future(executable->begin_call(outputs, inputs).share())
+        {
+        }
+
+        bool done() const
+        {
+            return m_future.wait_for(std::chrono::seconds(0)) == std::future_status::ready;
+        }
+
+        // Waits at most timeout seconds, or without limit if timeout is negative
+        bool wait(double timeout) const
+        {
+            if (timeout < 0)
+            {
+                m_future.wait();
+                return true;
+            }
+            return m_future.wait_for(std::chrono::duration<double>(timeout)) ==
+                   std::future_status::ready;
+        }
+
+        bool result() const { return m_future.get(); }
+    private:
+        std::shared_ptr<ngraph::runtime::Executable> m_executable;
+        TensorVector m_outputs;
+        TensorVector m_inputs;
+        // Declared last, so that it is destroyed first
+        std::shared_future<bool> m_future;
+    };
+}
+
 void regclass_pyngraph_runtime_Executable(py::module m)
 {
+    py::class_<CallFuture, std::shared_ptr<CallFuture>> call_future(m, "CallFuture");
+    call_future.doc() = "ngraph.impl.runtime.CallFuture is the pending result of "
+                        "Executable.begin_call";
+    call_future.def("done", &CallFuture::done);
+    call_future.def("wait",
+                    &CallFuture::wait,
+                    py::arg("timeout") = -1.0,
+                    py::call_guard<py::gil_scoped_release>());
+    call_future.def("result", &CallFuture::result, py::call_guard<py::gil_scoped_release>());
+
     py::class_<ngraph::runtime::Executable, std::shared_ptr<ngraph::runtime::Executable>>
         executable(m, "Executable");
     executable.doc() = "ngraph.impl.runtime.Executable wraps ngraph::runtime::Executable";
@@ -32,7 +91,15 @@ void regclass_pyngraph_runtime_Executable(py::module m)
                    (bool (ngraph::runtime::Executable::*)(
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&,
                        const std::vector<std::shared_ptr<ngraph::runtime::Tensor>>&)) &
-                       ngraph::runtime::Executable::call);
+                       ngraph::runtime::Executable::call,
+                   py::call_guard<py::gil_scoped_release>());
+    executable.def("begin_call",
+                   [](std::shared_ptr<ngraph::runtime::Executable> self,
+                      const TensorVector& outputs,
+                      const TensorVector& inputs) {
+                       py::gil_scoped_release release;
+                       return std::make_shared<CallFuture>(self, outputs, inputs);
+                   });
     executable.def(
         "get_performance_data",
         (std::vector<ngraph::runtime::PerformanceCounter>(ngraph::runtime::Executable::*)()) &
@@ -30,8 +30,9 @@ void regclass_pyngraph_runtime_Tensor(py::module m)
     tensor.doc() = "ngraph.impl.runtime.Tensor wraps ngraph::runtime::Tensor";
     tensor.def("write",
                (void (ngraph::runtime::Tensor::*)(const void*, size_t, size_t)) &
-                   ngraph::runtime::Tensor::write);
-    tensor.def("read", &ngraph::runtime::Tensor::read);
+                   ngraph::runtime::Tensor::write,
+               py::call_guard<py::gil_scoped_release>());
+    tensor.def("read", &ngraph::runtime::Tensor::read, py::call_guard<py::gil_scoped_release>());
 
     tensor.def_property_readonly("shape", &ngraph::runtime::Tensor::get_shape);
     tensor.def_property_readonly("element_count", &ngraph::runtime::Tensor::get_element_count);
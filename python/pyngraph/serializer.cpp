@@ -16,6 +16,7 @@
 
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
+#include <sstream>
 #include <string>
 
 #include "ngraph/serializer.hpp"
@@ -33,4 +34,15 @@ void regclass_pyngraph_Serializer(py::module m)
           (std::string(*)(std::shared_ptr<ngraph::Function>, size_t)) & ngraph::serialize,
           py::arg(),
           py::arg("indent") = 0);
+    m.def("serialize_structure", &ngraph::serialize_structure);
+
+    // The whole Function is built in C++, in one call
+    m.def("deserialize",
+          (std::shared_ptr<ngraph::Function>(*)(const std::string&)) & ngraph::deserialize,
+          py::call_guard<py::gil_scoped_release>());
+    m.def("deserialize_bytes", [](py::bytes data) {
+        std::istringstream in(std::string(data), std::ios_base::binary | std::ios_base::in);
+        py::gil_scoped_release release;
+        return ngraph::deserialize(in);
+    });
 }
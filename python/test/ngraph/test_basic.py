@@ -51,6 +51,99 @@ def test_simple_computation_on_ndarrays(dtype):
     assert np.allclose(result, np.array([[630, 704], [782, 864]], dtype=dtype))
 
 
+@pytest.mark.skip_on_gpu
+def test_computation_zero_copy():
+    runtime = get_runtime()
+
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a * parameter_b, parameter_a, parameter_b)
+
+    value_a = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    value_b = np.array([[5, 6], [7, 8]], dtype=np.float32)
+    first = computation(value_a, value_b)[0]
+    assert np.allclose(first, np.array([[5, 12], [21, 32]], dtype=np.float32))
+
+    # Non-contiguous and mistyped inputs are copied
+    value_a = np.array([[1, 3], [2, 4]], dtype=np.float64).T
+    second = computation(value_a, value_b)[0]
+    assert np.allclose(second, np.array([[5, 12], [21, 32]], dtype=np.float32))
+
+    if runtime.backend.supports_memory_attach():
+        # The result array is reused by the next call
+        assert second is first
+
+
+@pytest.mark.skip_on_gpu
+def test_executable_begin_call():
+    runtime = get_runtime()
+    backend = runtime.backend
+
+    shape = [2, 2]
+    parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+    parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+    computation = runtime.computation(parameter_a + parameter_b, parameter_a, parameter_b)
+
+    element_type = computation.parameters[0].get_element_type()
+    inputs = [backend.create_tensor(element_type, shape) for _ in range(2)]
+    output = backend.create_tensor(element_type, shape)
+    value = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    for tensor in inputs:
+        tensor.write(ng.impl.util.numpy_to_c(value), 0, value.nbytes)
+
+    future = computation.handle.begin_call([output], inputs)
+    assert future.wait()
+    assert future.done()
+    assert future.result()
+
+    result = np.zeros(shape, dtype=np.float32)
+    output.read(ng.impl.util.numpy_to_c(result), 0, result.nbytes)
+    assert np.allclose(result, value * 2)
+
+
+def test_computation_cache():
+    runtime = get_runtime()
+
+    def build(shape):
+        parameter_a = ng.parameter(shape, dtype=np.float32, name='A')
+        parameter_b = ng.parameter(shape, dtype=np.float32, name='B')
+        return runtime.computation(parameter_a + parameter_b, parameter_a, parameter_b)
+
+    first = build([2, 2])
+    second = build([2, 2])
+    other_shape = build([3])
+    assert first.handle is second.handle
+    assert first.handle is not other_shape.handle
+
+    value = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    for tensor in second.input_tensors:
+        tensor.write(ng.impl.util.numpy_to_c(value), 0, value.nbytes)
+    second.run()
+    result = np.zeros([2, 2], dtype=np.float32)
+    second.output_tensors[0].read(ng.impl.util.numpy_to_c(result), 0, result.nbytes)
+    assert np.allclose(result, value * 2)
+
+
+@pytest.mark.skip_on_gpu
+def test_function_from_ops():
+    ops = [{'name': 'A', 'op': 'Parameter', 'element_type': 'float', 'shape': [2, 2]},
+           {'name': 'B', 'op': 'Parameter', 'element_type': 'float', 'shape': [2, 2]},
+           {'name': 'Sum', 'op': 'Add', 'inputs': ['A', 'B']},
+           {'name': 'Product', 'op': 'Multiply', 'inputs': ['Sum', 'B']}]
+    function = ng.function_from_ops(ops, ['A', 'B'], ['Product'])
+
+    runtime = get_runtime()
+    computation = runtime.computation(function)
+    value_a = np.array([[1, 2], [3, 4]], dtype=np.float32)
+    value_b = np.array([[5, 6], [7, 8]], dtype=np.float32)
+    result = computation(value_a, value_b)[0]
+    assert np.allclose(result, (value_a + value_b) * value_b)
+
+    copy = ng.function_from_bytes(ng.impl.serialize(function).encode())
+    assert [list(p.get_shape()) for p in copy.get_parameters()] == [[2, 2], [2, 2]]
+
+
 def test_serialization():
     dtype = np.float32
     backend_name = test.BACKEND_NAME
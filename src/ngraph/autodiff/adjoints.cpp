@@ -115,10 +115,7 @@ autodiff::Adjoints::Adjoints(const NodeVector& ys, const NodeVector& cs)
     // before a node is visited.
     for (size_t i = 0; i < ys.size(); i++)
     {
-        Node* n = ys.at(i).get();
-        NodeVector t{cs.at(i)};
-        std::pair<Node*, NodeVector> pair = std::make_pair(n, t);
-        m_adjoint_map.insert(std::make_pair(ys.at(i).get(), NodeVector{cs.at(i)}));
+        add_delta(ys.at(i), cs.at(i));
     }
 
     nodes_to_check.assign(ys.cbegin(), ys.cend());
@@ -140,33 +137,65 @@ autodiff::Adjoints::Adjoints(const NodeVector& ys, const NodeVector& cs)
     }
 }
 
+std::shared_ptr<Node> autodiff::Adjoints::sum_deltas(NodeVector& deltas)
+{
+    // Pairwise sums keep the tree log(n) deep, so the Adds are independent of each other
+    while (deltas.size() > 1)
+    {
+        NodeVector sums;
+        for (size_t i = 0; i + 1 < deltas.size(); i += 2)
+        {
+            sums.push_back(std::make_shared<op::Add>(deltas.at(i), deltas.at(i + 1)));
+        }
+        if (deltas.size() % 2 == 1)
+        {
+            sums.push_back(deltas.back());
+        }
+        deltas = sums;
+    }
+    return deltas.at(0);
+}
+
 const NodeVector& autodiff::Adjoints::get(const std::shared_ptr<Node>& x)
 {
     auto adjoint_it = m_adjoint_map.find(x.get());
-    if (m_adjoint_map.end() == adjoint_it)
+    if (m_adjoint_map.end() != adjoint_it)
+    {
+        return adjoint_it->second;
+    }
+
+    NodeVector adjoints;
+    auto deltas_it = m_deltas.find(x.get());
+    NodeVector zeros;
+    for (size_t i = 0; i < x->get_output_size(); i++)
     {
-        adjoint_it = m_adjoint_map.insert({x.get(), make_zeros(x)}).first;
+        if (deltas_it != m_deltas.end() && !deltas_it->second.at(i).empty())
+        {
+            adjoints.push_back(sum_deltas(deltas_it->second.at(i)));
+            continue;
+        }
+        if (zeros.empty())
+        {
+            zeros = make_zeros(x);
+        }
+        adjoints.push_back(zeros.at(i));
+        m_zeros.insert(zeros.at(i).get());
     }
-    return adjoint_it->second;
+    return m_adjoint_map.insert({x.get(), adjoints}).first->second;
 }
 
 void autodiff::Adjoints::add_delta(const std::shared_ptr<Node>& x,
                                    const std::shared_ptr<Node>& delta,
                                    size_t output_index)
 {
-    auto adjoint_it = m_adjoint_map.find(x.get());
-    if (m_adjoint_map.end() == adjoint_it)
-    {
-        auto zeros = make_zeros(x);
-        zeros.at(output_index) = delta;
-        m_adjoint_map.insert({x.get(), zeros});
-    }
-    else
+    if (m_zeros.count(delta.get()) != 0)
     {
-        auto& deltas = adjoint_it->second;
-        deltas.at(output_index) = std::make_shared<op::Add>(deltas.at(output_index), delta);
-        adjoint_it->second = deltas;
+        return;
     }
+    auto& deltas = m_deltas[x.get()];
+    deltas.resize(x->get_output_size());
+    deltas.at(output_index).push_back(delta);
+    m_adjoint_map.erase(x.get());
 }
 
 //This doesn't need an index since slice can only sit on top of GOE
@@ -184,24 +213,28 @@ void autodiff::Adjoints::add_delta_to_slice(const std::shared_ptr<Node>& x,
             "Autodiff internal error: Mismatch on backprop and op in add_delta_to_slice.");
     }
 
-    auto adjoint_it = m_adjoint_map.find(x.get());
-    if (m_adjoint_map.end() == adjoint_it)
+    auto& deltas = m_deltas[x.get()];
+    deltas.resize(x->get_output_size());
+    auto& output_deltas = deltas.at(0);
+    std::shared_ptr<Node> adjoint;
+    if (output_deltas.empty())
     {
         auto zero = make_broadcast_zero(x);
-        NodeVector zeros{
-            std::make_shared<op::ReplaceSlice>(zero, delta, lower_bounds, upper_bounds, strides)};
-        m_adjoint_map.insert({x.get(), zeros});
+        adjoint =
+            std::make_shared<op::ReplaceSlice>(zero, delta, lower_bounds, upper_bounds, strides);
     }
     else
     {
-        auto& deltas = adjoint_it->second;
-        deltas.at(0) = std::make_shared<op::ReplaceSlice>(
-            deltas.at(0),
-            std::make_shared<op::Slice>(deltas.at(0), lower_bounds, upper_bounds, strides) + delta,
+        auto sum = sum_deltas(output_deltas);
+        adjoint = std::make_shared<op::ReplaceSlice>(
+            sum,
+            std::make_shared<op::Slice>(sum, lower_bounds, upper_bounds, strides) + delta,
             lower_bounds,
             upper_bounds,
             strides);
     }
+    output_deltas = NodeVector{adjoint};
+    m_adjoint_map.erase(x.get());
 }
 
 std::shared_ptr<Node> autodiff::Adjoints::backprop_node(const std::shared_ptr<Node>& x)
@@ -19,6 +19,8 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 #include "ngraph/coordinate.hpp"
 #include "ngraph/strides.hpp"
@@ -49,11 +51,17 @@ namespace ngraph
 
             /// \brief (dy/dx)(c)
             ///
+            /// The contributions added to each output of x are summed as a balanced tree of
+            /// Adds. Outputs without contributions are zero.
+            ///
             /// \param x The node whose adjoint is desired.
             const NodeVector& get(const std::shared_ptr<Node>& x);
 
             /// \brief Add a backprop contribution to x's adjoint
             ///
+            /// The first contribution becomes the adjoint, instead of being added to zero.
+            /// Zero adjoints returned by `get` are not added at all.
+            ///
             /// \param x The adjoint node
             /// \param delta A backprop contribution
             void add_delta(const std::shared_ptr<Node>& x,
@@ -76,7 +84,14 @@ namespace ngraph
             std::shared_ptr<Node> backprop_node(const std::shared_ptr<Node>& x);
 
         protected:
+            std::shared_ptr<Node> sum_deltas(NodeVector& deltas);
+
+            // Contributions to each output of a node's adjoint, summed when it is read
+            std::map<Node*, std::vector<NodeVector>> m_deltas;
+            // The summed adjoints, until another contribution is added
             std::map<Node*, NodeVector> m_adjoint_map;
+            // Zeros made for outputs without contributions
+            std::unordered_set<Node*> m_zeros;
         };
     }
 }
@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <ostream>
+#include <utility>
 #include <vector>
 
 namespace ngraph
@@ -41,6 +42,16 @@ namespace ngraph
         {
         }
 
+        AxisVector(std::vector<size_t>&& axes) noexcept
+            : std::vector<size_t>(std::move(axes))
+        {
+        }
+
+        AxisVector(AxisVector&& axes) noexcept
+            : std::vector<size_t>(std::move(axes))
+        {
+        }
+
         explicit AxisVector(size_t n)
             : std::vector<size_t>(n)
         {
@@ -58,9 +69,9 @@ namespace ngraph
             static_cast<std::vector<size_t>*>(this)->operator=(v);
             return *this;
         }
-        AxisVector& operator=(AxisVector&& v)
+        AxisVector& operator=(AxisVector&& v) noexcept
         {
-            static_cast<std::vector<size_t>*>(this)->operator=(v);
+            static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
             return *this;
         }
     };
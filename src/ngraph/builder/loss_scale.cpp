@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/builder/loss_scale.hpp"
+#include "ngraph/builder/make_constant.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/greater_eq.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/util/broadcasting.hpp"
+
+using namespace std;
+
+namespace ngraph
+{
+    namespace builder
+    {
+        shared_ptr<Node> scale_loss(const shared_ptr<Node>& loss,
+                                    const shared_ptr<Node>& loss_scale)
+        {
+            return loss * op::make_broadcast_node(loss_scale, loss->get_shape());
+        }
+
+        NodeVector update_loss_scale(const shared_ptr<Node>& loss_scale,
+                                     const shared_ptr<Node>& finite_steps,
+                                     const shared_ptr<Node>& finite,
+                                     double growth_factor,
+                                     double backoff_factor,
+                                     size_t growth_interval)
+        {
+            const element::Type& element_type = loss_scale->get_element_type();
+            auto zero = make_constant(element_type, Shape{}, 0);
+            auto one = make_constant(element_type, Shape{}, 1);
+            auto interval = make_constant(element_type, Shape{}, growth_interval);
+            auto growth = make_constant(element_type, Shape{}, growth_factor);
+            auto backoff = make_constant(element_type, Shape{}, backoff_factor);
+
+            auto steps = finite_steps + one;
+            auto grow = make_shared<op::GreaterEq>(steps, interval);
+            auto finite_scale = make_shared<op::Select>(grow, loss_scale * growth, loss_scale);
+            auto new_steps = make_shared<op::Select>(grow, zero, steps);
+            return {make_shared<op::Select>(finite, finite_scale, loss_scale * backoff),
+                    make_shared<op::Select>(finite, new_steps, zero)};
+        }
+    }
+}
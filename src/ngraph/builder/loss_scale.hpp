@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace builder
+    {
+        /// \brief Multiplies the loss by the loss scale of dynamic loss scaling, so that small
+        ///        gradients stay representable in a low precision element type.
+        ///
+        /// \param loss The loss to differentiate
+        /// \param loss_scale Scalar of the loss element type
+        std::shared_ptr<Node> scale_loss(const std::shared_ptr<Node>& loss,
+                                         const std::shared_ptr<Node>& loss_scale);
+
+        /// \brief Next loss scale and count of finite steps of dynamic loss scaling.
+        ///
+        /// When `finite` is false the scale is multiplied by `backoff_factor` and the count is
+        /// reset. Otherwise the count is incremented, and after `growth_interval` finite steps
+        /// in a row the scale is multiplied by `growth_factor` and the count is reset.
+        ///
+        /// The scale and the count are scalars of the same element type. They are normally
+        /// persistent parameters that the training function also returns updated, so a step
+        /// never reads them on the host. `finite` is typically an AllFinite over the gradients,
+        /// which also drives a loss-scaled SgdMomentumUpdate or AdamUpdate.
+        ///
+        /// \return The new loss scale and the new count of finite steps
+        NodeVector update_loss_scale(const std::shared_ptr<Node>& loss_scale,
+                                     const std::shared_ptr<Node>& finite_steps,
+                                     const std::shared_ptr<Node>& finite,
+                                     double growth_factor = 2.0,
+                                     double backoff_factor = 0.5,
+                                     size_t growth_interval = 2000);
+    }
+}
@@ -14,8 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 #include <string>
+#include <thread>
 
 #include <clang/Basic/DiagnosticOptions.h>
 #include <clang/Basic/TargetInfo.h>
@@ -34,6 +37,10 @@
 #include <clang/Lex/Preprocessor.h>
 #include <clang/Lex/PreprocessorOptions.h>
 #include <llvm/ADT/Statistic.h>
+#include <llvm/ADT/StringExtras.h>
+#include <llvm/Bitcode/BitcodeReader.h>
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/Config/llvm-config.h>
 #include <llvm/ExecutionEngine/MCJIT.h> // forces JIT to link in
 #include <llvm/IR/Module.h>
 #include <llvm/LinkAllPasses.h>
@@ -41,7 +48,11 @@
 #include <llvm/Option/ArgList.h>
 #include <llvm/Option/OptTable.h>
 #include <llvm/Support/ErrorHandling.h>
+#include <llvm/Support/FileSystem.h>
 #include <llvm/Support/ManagedStatic.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/SHA1.h>
 #include <llvm/Support/Signals.h>
 #include <llvm/Support/TargetSelect.h>
 #include <llvm/Support/Timer.h>
@@ -51,6 +62,7 @@
 #include "ngraph/codegen/compiler.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/metrics.hpp"
 #include "ngraph/util.hpp"
 
 #if defined(__clang__)
@@ -77,7 +89,9 @@ class CompilerInfo
 {
 public:
     std::string pch_file;
-    shared_ptr<codegen::CompilerCore> compiler;
+    // False when the precompiled header lives in the codegen cache and outlives the process
+    bool remove_pch_file = true;
+    vector<shared_ptr<codegen::CompilerCore>> compilers;
 };
 
 static unordered_map<std::string, CompilerInfo> s_compiler_info;
@@ -90,7 +104,10 @@ public:
     {
         for (const auto& p : s_compiler_info)
         {
-            file_util::remove_file(p.second.pch_file);
+            if (p.second.remove_pch_file && !p.second.pch_file.empty())
+            {
+                file_util::remove_file(p.second.pch_file);
+            }
         }
     }
 } s_static_init;
@@ -111,12 +128,22 @@ std::unique_ptr<llvm::Module> codegen::Module::take_module()
 
 codegen::Compiler::Compiler()
     : m_compiler_core{}
+    , m_job_count(max(1u, thread::hardware_concurrency()))
 {
+    if (const char* cache_dir = std::getenv("NGRAPH_CODEGEN_CACHE_DIR"))
+    {
+        set_cache_directory(cache_dir);
+    }
+    if (const char* jobs = std::getenv("NGRAPH_CODEGEN_JOBS"))
+    {
+        set_job_count(std::atoi(jobs));
+    }
 }
 
 codegen::Compiler::~Compiler()
 {
     m_compiler_action = nullptr;
+    m_compiler_actions.clear();
     m_compiler_core = nullptr;
 }
 
@@ -130,23 +157,265 @@ void codegen::Compiler::add_header_search_path(const std::string& path)
     m_header_search_paths.push_back(path);
 }
 
-std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
+void codegen::Compiler::set_cache_directory(const std::string& path)
+{
+    m_cache_directory = path;
+    if (!m_cache_directory.empty() && !file_util::exists(m_cache_directory))
+    {
+        if (llvm::sys::fs::create_directories(m_cache_directory))
+        {
+            NGRAPH_WARN << "Unable to create codegen cache directory " << m_cache_directory
+                        << ", caching disabled";
+            m_cache_directory.clear();
+        }
+    }
+}
+
+// Digest of the headers built into the library, which change from one nGraph build to the next
+static const std::string& get_builtin_headers_digest()
+{
+    static const std::string digest = []() {
+        llvm::SHA1 hasher;
+        for (const auto& header_info : builtin_headers)
+        {
+            hasher.update(header_info.first);
+            hasher.update(llvm::StringRef("\0", 1));
+#ifdef _WIN32
+            for (const std::string& line : header_info.second)
+            {
+                hasher.update(line);
+            }
+#else
+            hasher.update(header_info.second);
+#endif
+            hasher.update(llvm::StringRef("\0", 1));
+        }
+        return llvm::toHex(hasher.final(), true);
+    }();
+    return digest;
+}
+
+std::string codegen::Compiler::get_cache_key(CompilerCore& core, const std::string& source) const
+{
+    // Everything that changes the generated code goes into the key. The compiler arguments
+    // themselves are fixed in CompilerCore::initialize, so the format version below must be
+    // bumped whenever they change.
+    llvm::SHA1 hasher;
+    auto add = [&hasher](const std::string& s) {
+        hasher.update(s);
+        hasher.update(llvm::StringRef("\0", 1));
+    };
+    add("ngraph-codegen-cache-v2");
+    add(LLVM_VERSION_STRING);
+    add(get_builtin_headers_digest());
+    add(sys::getHostCPUName().str());
+    add(core.is_debuginfo_enabled() ? "debuginfo" : "");
+    for (const std::string& path : m_header_search_paths)
+    {
+        add(path);
+    }
+    add(m_precompiled_header_source);
+    add(source);
+    return llvm::toHex(hasher.final(), true);
+}
+
+std::unique_ptr<codegen::Module>
+    codegen::Compiler::load_cached_module(const std::string& cache_path)
+{
+    std::unique_ptr<codegen::Module> result;
+    auto buffer = MemoryBuffer::getFile(cache_path + ".bc");
+    if (buffer)
+    {
+        if (!m_cache_context)
+        {
+            m_cache_context.reset(new LLVMContext());
+        }
+        auto module = parseBitcodeFile((*buffer)->getMemBufferRef(), *m_cache_context);
+        if (module)
+        {
+            result.reset(new codegen::Module(move(*module)));
+            result->set_cache_path(cache_path);
+        }
+        else
+        {
+            NGRAPH_WARN << "Ignoring unreadable codegen cache entry " << cache_path << ".bc: "
+                        << toString(module.takeError());
+        }
+    }
+    Metrics::count_cache_lookup("codegen", result != nullptr);
+    return result;
+}
+
+void codegen::Compiler::store_cached_module(const llvm::Module& module,
+                                            const std::string& cache_path)
+{
+    // Write to a private file and rename so concurrent processes never see a partial entry
+    std::string tmp_path = cache_path + ".bc." + std::to_string(llvm::sys::Process::getProcessId());
+    {
+        std::error_code ec;
+        raw_fd_ostream out(tmp_path, ec, llvm::sys::fs::F_None);
+        if (ec)
+        {
+            NGRAPH_WARN << "Unable to write codegen cache entry " << tmp_path << ": "
+                        << ec.message();
+            return;
+        }
+        WriteBitcodeToFile(module, out);
+    }
+    if (llvm::sys::fs::rename(tmp_path, cache_path + ".bc"))
+    {
+        file_util::remove_file(tmp_path);
+    }
+}
+
+std::vector<std::shared_ptr<codegen::CompilerCore>>&
+    codegen::Compiler::get_compiler_cores(size_t count)
 {
-    // lock_guard<mutex> lock(m_mutex);
     CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
-    if (!compiler_info.compiler)
+    while (compiler_info.compilers.size() < count)
     {
-        compiler_info.compiler = make_shared<CompilerCore>();
+        auto compiler = make_shared<CompilerCore>();
         for (const std::string& path : m_header_search_paths)
         {
-            compiler_info.compiler->add_header_search_path(path);
+            compiler->add_header_search_path(path);
+        }
+        compiler->set_precompiled_header_source(m_precompiled_header_source);
+        compiler_info.compilers.push_back(compiler);
+    }
+
+    if (!m_precompiled_header_source.empty() && compiler_info.pch_file.empty())
+    {
+        prepare_precompiled_header(*compiler_info.compilers[0], compiler_info.pch_file);
+        compiler_info.remove_pch_file = m_cache_directory.empty();
+    }
+    for (auto& compiler : compiler_info.compilers)
+    {
+        compiler->set_precompiled_header_file(compiler_info.pch_file);
+    }
+    return compiler_info.compilers;
+}
+
+void codegen::Compiler::prepare_precompiled_header(CompilerCore& core, std::string& pch_file)
+{
+    if (m_cache_directory.empty())
+    {
+        std::string pch_path = file_util::tmp_filename();
+        if (core.generate_pch(m_precompiled_header_source, pch_path))
+        {
+            pch_file = pch_path;
         }
-        compiler_info.compiler->set_precompiled_header_source(m_precompiled_header_source);
+        return;
+    }
+
+    // The key of an empty source covers the header source and the compiler configuration
+    std::string cache_path =
+        file_util::path_join(m_cache_directory, get_cache_key(core, "") + ".pch");
+    if (!file_util::exists(cache_path))
+    {
+        std::string tmp_path =
+            cache_path + "." + std::to_string(llvm::sys::Process::getProcessId());
+        if (!core.generate_pch(m_precompiled_header_source, tmp_path))
+        {
+            return;
+        }
+        if (llvm::sys::fs::rename(tmp_path, cache_path))
+        {
+            file_util::remove_file(tmp_path);
+            NGRAPH_WARN << "Unable to write precompiled header " << cache_path;
+            return;
+        }
+    }
+    pch_file = cache_path;
+}
+
+std::unique_ptr<codegen::Module> codegen::Compiler::compile(const std::string& source)
+{
+    CompilerCore& compiler = *get_compiler_cores(1)[0];
+
+    std::string cache_path;
+    if (!m_cache_directory.empty())
+    {
+        cache_path = file_util::path_join(m_cache_directory, get_cache_key(compiler, source));
+        if (auto cached = load_cached_module(cache_path))
+        {
+            return cached;
+        }
+    }
+
+    auto rc = compiler.compile(m_compiler_action, source);
+    if (rc && !cache_path.empty())
+    {
+        auto module = rc->take_module();
+        store_cached_module(*module, cache_path);
+        rc.reset(new codegen::Module(move(module)));
+        rc->set_cache_path(cache_path);
     }
-    auto rc = compiler_info.compiler->compile(m_compiler_action, source);
     return rc;
 }
 
+std::vector<std::unique_ptr<codegen::Module>>
+    codegen::Compiler::compile(const std::vector<std::string>& sources)
+{
+    std::vector<std::unique_ptr<codegen::Module>> modules(sources.size());
+    std::vector<std::string> cache_paths(sources.size());
+    size_t thread_count = min(m_job_count, sources.size());
+    auto& compilers = get_compiler_cores(max<size_t>(thread_count, 1));
+
+    // Cache lookups share m_cache_context so they stay on this thread
+    vector<size_t> pending;
+    for (size_t i = 0; i < sources.size(); i++)
+    {
+        if (!m_cache_directory.empty())
+        {
+            cache_paths[i] =
+                file_util::path_join(m_cache_directory, get_cache_key(*compilers[0], sources[i]));
+            modules[i] = load_cached_module(cache_paths[i]);
+        }
+        if (!modules[i])
+        {
+            pending.push_back(i);
+        }
+    }
+
+    // Each thread compiles with its own CompilerCore, and each module gets its own action
+    size_t first_action = m_compiler_actions.size();
+    m_compiler_actions.resize(first_action + pending.size());
+    thread_count = min(thread_count, pending.size());
+    atomic<size_t> next{0};
+    auto work = [&](CompilerCore* compiler) {
+        for (size_t index = next++; index < pending.size(); index = next++)
+        {
+            modules[pending[index]] = compiler->compile(m_compiler_actions[first_action + index],
+                                                        sources[pending[index]]);
+        }
+    };
+    vector<thread> threads;
+    for (size_t t = 1; t < thread_count; ++t)
+    {
+        threads.emplace_back(work, compilers[t].get());
+    }
+    if (thread_count > 0)
+    {
+        work(compilers[0].get());
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    for (size_t i : pending)
+    {
+        if (modules[i] && !cache_paths[i].empty())
+        {
+            auto module = modules[i]->take_module();
+            store_cached_module(*module, cache_paths[i]);
+            modules[i].reset(new codegen::Module(move(module)));
+            modules[i]->set_cache_path(cache_paths[i]);
+        }
+    }
+    return modules;
+}
+
 static std::string GetExecutablePath(const char* Argv0)
 {
     // This just needs to be some symbol in the binary; C++ doesn't
@@ -322,15 +591,10 @@ std::unique_ptr<codegen::Module>
 
     preprocessor_options.RetainRemappedFileBuffers = true;
 
-    CompilerInfo& compiler_info = s_compiler_info[m_precompiled_header_source];
-    if (!m_precompiled_header_source.empty() && compiler_info.pch_file.empty())
-    {
-        compiler_info.pch_file = generate_pch(m_precompiled_header_source);
-    }
-    if (!compiler_info.pch_file.empty())
+    if (!m_precompiled_header_file.empty())
     {
         // Preprocessor options
-        preprocessor_options.ImplicitPCHInclude = compiler_info.pch_file;
+        preprocessor_options.ImplicitPCHInclude = m_precompiled_header_file;
         preprocessor_options.DisablePCHValidation = 0;
     }
 
@@ -377,10 +641,9 @@ std::unique_ptr<codegen::Module>
     return result;
 }
 
-std::string codegen::CompilerCore::generate_pch(const std::string& source)
+bool codegen::CompilerCore::generate_pch(const std::string& source, const std::string& pch_path)
 {
     PreprocessorOptions& preprocessor_options = m_compiler->getInvocation().getPreprocessorOpts();
-    std::string pch_path = file_util::tmp_filename();
     m_compiler->getFrontendOpts().OutputFile = pch_path;
 
     // Map code filename to a memoryBuffer
@@ -390,14 +653,10 @@ std::string codegen::CompilerCore::generate_pch(const std::string& source)
 
     // Create and execute action
     clang::GeneratePCHAction* compilerAction = new clang::GeneratePCHAction();
-    if (m_compiler->ExecuteAction(*compilerAction) == false)
+    bool rc = m_compiler->ExecuteAction(*compilerAction);
+    if (!rc)
     {
         file_util::remove_file(pch_path);
-        pch_path = "";
-    }
-    else
-    {
-        s_compiler_info[source].pch_file = pch_path;
     }
 
     buffer.release();
@@ -405,7 +664,7 @@ std::string codegen::CompilerCore::generate_pch(const std::string& source)
 
     delete compilerAction;
 
-    return pch_path;
+    return rc;
 }
 
 void codegen::CompilerCore::configure_search_path()
@@ -38,6 +38,7 @@ namespace clang
 
 namespace llvm
 {
+    class LLVMContext;
     class Module;
 }
 
@@ -48,8 +49,13 @@ public:
     ~Module();
     std::unique_ptr<llvm::Module> take_module();
 
+    /// \brief Path prefix of this module's entries in the on-disk compilation cache.
+    ///        Empty when the module is not cached.
+    const std::string& get_cache_path() const { return m_cache_path; }
+    void set_cache_path(const std::string& path) { m_cache_path = path; }
 private:
     std::unique_ptr<llvm::Module> m_module;
+    std::string m_cache_path;
 };
 
 class ngraph::codegen::Compiler
@@ -59,13 +65,40 @@ public:
     ~Compiler();
     void set_precompiled_header_source(const std::string& source);
     void add_header_search_path(const std::string& path);
+
+    /// \brief Enable the on-disk compilation cache. Compiled modules are stored as bitcode
+    ///        in `path`, keyed by a hash of the source and the compiler configuration.
+    ///        Defaults to the value of NGRAPH_CODEGEN_CACHE_DIR; an empty path disables it.
+    void set_cache_directory(const std::string& path);
+    const std::string& get_cache_directory() const { return m_cache_directory; }
+    /// \brief Number of sources compiled at once by the multi-source compile. Defaults to
+    ///        the value of NGRAPH_CODEGEN_JOBS, or the number of hardware threads.
+    void set_job_count(size_t jobs) { m_job_count = jobs < 1 ? 1 : jobs; }
+    size_t get_job_count() const { return m_job_count; }
     std::unique_ptr<ngraph::codegen::Module> compile(const std::string& source);
+    /// \brief Compile several translation units that share the precompiled header, up to
+    ///        get_job_count() of them in parallel. Each module in the result is null if its
+    ///        source failed to compile. The modules stay valid for the life of the Compiler.
+    std::vector<std::unique_ptr<ngraph::codegen::Module>>
+        compile(const std::vector<std::string>& sources);
     std::unique_ptr<clang::CodeGenAction>& get_compiler_action() { return m_compiler_action; }
 private:
     std::unique_ptr<clang::CodeGenAction> m_compiler_action;
+    // One action per module of the multi-source compile; each owns its module's LLVMContext
+    std::vector<std::unique_ptr<clang::CodeGenAction>> m_compiler_actions;
     std::shared_ptr<CompilerCore> m_compiler_core;
     std::string m_precompiled_header_source;
     std::vector<std::string> m_header_search_paths;
+    std::string m_cache_directory;
+    // Owns modules read back from the cache; must outlive any ExecutionEngine using them
+    std::unique_ptr<llvm::LLVMContext> m_cache_context;
+    size_t m_job_count;
+
+    std::vector<std::shared_ptr<CompilerCore>>& get_compiler_cores(size_t count);
+    void prepare_precompiled_header(CompilerCore& core, std::string& pch_file);
+    std::string get_cache_key(CompilerCore& core, const std::string& source) const;
+    std::unique_ptr<ngraph::codegen::Module> load_cached_module(const std::string& cache_path);
+    void store_cached_module(const llvm::Module& module, const std::string& cache_path);
 };
 
 class ngraph::codegen::CompilerCore
@@ -78,11 +111,14 @@ public:
     bool is_debuginfo_enabled() { return m_debuginfo_enabled; }
     void set_precompiled_header_source(const std::string& source);
     const std::string& get_precompiled_header_source() const;
+    /// \brief The precompiled header included by compile(). Empty to compile without one.
+    void set_precompiled_header_file(const std::string& path) { m_precompiled_header_file = path; }
     void add_header_search_path(const std::string& path, bool check_path = false);
 
     std::unique_ptr<ngraph::codegen::Module>
         compile(std::unique_ptr<clang::CodeGenAction>& compiler_action, const std::string& source);
-    std::string generate_pch(const std::string& source);
+    /// \brief Precompile `source` into `pch_path`. Returns false if it does not compile.
+    bool generate_pch(const std::string& source, const std::string& pch_path);
     void initialize();
 
 private:
@@ -93,6 +129,7 @@ private:
     std::string m_source_name;
     std::vector<std::string> m_extra_search_path_list;
     std::string m_precompiled_header_source;
+    std::string m_precompiled_header_file;
 #ifdef _WIN32
     std::vector<std::string> m_header_strings;
 #endif
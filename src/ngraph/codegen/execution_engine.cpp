@@ -14,12 +14,78 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <unordered_map>
+
 #include <llvm/ExecutionEngine/ExecutionEngine.h>
+#include <llvm/ExecutionEngine/ObjectCache.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/MemoryBuffer.h>
+#include <llvm/Support/Process.h>
+#include <llvm/Support/raw_ostream.h>
 
 #include "ngraph/codegen/execution_engine.hpp"
+#include "ngraph/file_util.hpp"
 
 using namespace ngraph;
 
+namespace
+{
+    // Object cache backed by the codegen cache entries of the engine's modules. On a hit MCJIT
+    // loads the object file directly and skips code generation.
+    class FileObjectCache : public llvm::ObjectCache
+    {
+    public:
+        void add_module(const llvm::Module* module, const std::string& cache_path)
+        {
+            m_object_paths[module] = cache_path + ".o";
+        }
+
+        void notifyObjectCompiled(const llvm::Module* module,
+                                  llvm::MemoryBufferRef object) override
+        {
+            auto it = m_object_paths.find(module);
+            if (it == m_object_paths.end())
+            {
+                return;
+            }
+            const std::string& object_path = it->second;
+            std::string tmp_path =
+                object_path + "." + std::to_string(llvm::sys::Process::getProcessId());
+            {
+                std::error_code ec;
+                llvm::raw_fd_ostream out(tmp_path, ec, llvm::sys::fs::F_None);
+                if (ec)
+                {
+                    return;
+                }
+                out << object.getBuffer();
+            }
+            if (llvm::sys::fs::rename(tmp_path, object_path))
+            {
+                file_util::remove_file(tmp_path);
+            }
+        }
+
+        std::unique_ptr<llvm::MemoryBuffer> getObject(const llvm::Module* module) override
+        {
+            auto it = m_object_paths.find(module);
+            if (it == m_object_paths.end())
+            {
+                return nullptr;
+            }
+            auto buffer = llvm::MemoryBuffer::getFile(it->second);
+            if (!buffer)
+            {
+                return nullptr;
+            }
+            return std::move(*buffer);
+        }
+
+    private:
+        std::unordered_map<const llvm::Module*, std::string> m_object_paths;
+    };
+}
+
 codegen::ExecutionEngine::ExecutionEngine()
     : m_execution_engine{nullptr}
 {
@@ -37,9 +103,12 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
 {
     if (module)
     {
+        const std::string cache_path = module->get_cache_path();
+        std::unique_ptr<llvm::Module> llvm_module = module->take_module();
+        const llvm::Module* module_key = llvm_module.get();
         if (!m_execution_engine)
         {
-            m_execution_engine.reset(llvm::EngineBuilder(module->take_module())
+            m_execution_engine.reset(llvm::EngineBuilder(std::move(llvm_module))
                                          .setEngineKind(llvm::EngineKind::JIT)
                                          .setOptLevel(llvm::CodeGenOpt::Aggressive)
                                          .setMCPU(llvm::sys::getHostCPUName())
@@ -51,6 +120,17 @@ bool codegen::ExecutionEngine::add_module(std::unique_ptr<ngraph::codegen::Modul
             {
                 return false;
             }
+            m_object_cache.reset(new FileObjectCache());
+            m_execution_engine->setObjectCache(m_object_cache.get());
+        }
+        else
+        {
+            // Further modules are code generated separately and linked when finalized
+            m_execution_engine->addModule(std::move(llvm_module));
+        }
+        if (!cache_path.empty())
+        {
+            static_cast<FileObjectCache*>(m_object_cache.get())->add_module(module_key, cache_path);
         }
     }
     else
@@ -33,6 +33,7 @@ namespace llvm
 {
     class Module;
     class ExecutionEngine;
+    class ObjectCache;
 }
 
 class ngraph::codegen::ExecutionEngine
@@ -51,6 +52,8 @@ public:
     }
 
 private:
+    // Declared first so it outlives the engine that references it
+    std::unique_ptr<llvm::ObjectCache> m_object_cache;
     std::unique_ptr<llvm::ExecutionEngine> m_execution_engine;
     std::string m_jit_error;
 
@@ -0,0 +1,167 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+
+#include "ngraph/compression.hpp"
+#include "ngraph/except.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static const uint8_t s_version = 1;
+static const size_t s_header_size = 10;
+static const size_t s_max_literal = 128;
+static const size_t s_min_repeat = 3;
+static const size_t s_max_repeat = 130;
+
+vector<char> compression::compress(const void* data, size_t size, size_t element_size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+    if (element_size == 0 || element_size > 255 || size % element_size != 0)
+    {
+        element_size = 1;
+    }
+    size_t count = size / element_size;
+    // byte i of the shuffled data is byte i / count of element i % count
+    auto shuffled = [&](size_t i) { return bytes[(i % count) * element_size + i / count]; };
+
+    vector<char> out;
+    out.reserve(s_header_size + size / 64);
+    out.push_back(static_cast<char>(s_version));
+    out.push_back(static_cast<char>(element_size));
+    for (size_t i = 0; i < 8; i++)
+    {
+        out.push_back(static_cast<char>((static_cast<uint64_t>(size) >> (8 * i)) & 0xFF));
+    }
+
+    size_t literal_start = 0;
+    auto flush_literal = [&](size_t end) {
+        while (literal_start < end)
+        {
+            size_t n = min(s_max_literal, end - literal_start);
+            out.push_back(static_cast<char>(n - 1));
+            for (size_t i = literal_start; i < literal_start + n; i++)
+            {
+                out.push_back(static_cast<char>(shuffled(i)));
+            }
+            literal_start += n;
+        }
+    };
+    size_t i = 0;
+    while (i < size)
+    {
+        uint8_t value = shuffled(i);
+        size_t run = 1;
+        while (i + run < size && run < s_max_repeat && shuffled(i + run) == value)
+        {
+            run++;
+        }
+        if (run >= s_min_repeat)
+        {
+            flush_literal(i);
+            out.push_back(static_cast<char>(run - s_min_repeat + s_max_literal));
+            out.push_back(static_cast<char>(value));
+            i += run;
+            literal_start = i;
+        }
+        else
+        {
+            i += run;
+        }
+    }
+    flush_literal(size);
+    return out;
+}
+
+size_t compression::get_uncompressed_size(const void* compressed, size_t compressed_size)
+{
+    const uint8_t* in = static_cast<const uint8_t*>(compressed);
+    if (compressed_size < s_header_size || in[0] != s_version || in[1] == 0)
+    {
+        throw ngraph_error("Not a compressed buffer");
+    }
+    uint64_t size = 0;
+    for (size_t i = 0; i < 8; i++)
+    {
+        size |= static_cast<uint64_t>(in[2 + i]) << (8 * i);
+    }
+    return static_cast<size_t>(size);
+}
+
+void compression::decompress(const void* compressed,
+                             size_t compressed_size,
+                             void* out,
+                             size_t size)
+{
+    if (get_uncompressed_size(compressed, compressed_size) != size)
+    {
+        throw ngraph_error("Compressed buffer does not hold the expected number of bytes");
+    }
+    const uint8_t* in = static_cast<const uint8_t*>(compressed);
+    uint8_t* bytes = static_cast<uint8_t*>(out);
+    size_t element_size = in[1];
+    if (size % element_size != 0)
+    {
+        throw ngraph_error("Compressed buffer is corrupt");
+    }
+    size_t count = size / element_size;
+
+    // The shuffled byte i goes straight to its place in the output
+    size_t element = 0;
+    size_t byte = 0;
+    auto put = [&](uint8_t value) {
+        bytes[element * element_size + byte] = value;
+        if (++element == count)
+        {
+            element = 0;
+            byte++;
+        }
+    };
+
+    size_t written = 0;
+    const uint8_t* p = in + s_header_size;
+    const uint8_t* end = in + compressed_size;
+    while (p < end)
+    {
+        size_t control = *p++;
+        size_t n = control < s_max_literal ? control + 1 : control - s_max_literal + s_min_repeat;
+        if (written + n > size || p + (control < s_max_literal ? n : 1) > end)
+        {
+            throw ngraph_error("Compressed buffer is corrupt");
+        }
+        if (control < s_max_literal)
+        {
+            for (size_t i = 0; i < n; i++)
+            {
+                put(*p++);
+            }
+        }
+        else
+        {
+            uint8_t value = *p++;
+            for (size_t i = 0; i < n; i++)
+            {
+                put(value);
+            }
+        }
+        written += n;
+    }
+    if (written != size)
+    {
+        throw ngraph_error("Compressed buffer is truncated");
+    }
+}
@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Lossless compression for tensor data. With the byte shuffle filter the bytes of a buffer of
+// element_size byte elements are regrouped so byte i of every element comes before byte i + 1,
+// which turns the mostly equal exponent bytes of floats into long runs. The (filtered) bytes
+// are then run length encoded, so sparse and low-entropy tensors shrink well.
+//
+// A compressed buffer is a header of u8 format version, u8 element_size (1 means unfiltered)
+// and u64 uncompressed size, all little endian, followed by packets. A packet starts with a
+// control byte c: for c < 128 the c + 1 bytes that follow are copied as is, otherwise the byte
+// that follows is repeated c - 125 times.
+
+namespace ngraph
+{
+    namespace compression
+    {
+        /// \brief Compresses size bytes of data
+        /// \param element_size Size of the data elements, the bytes are shuffled if above 1
+        std::vector<char> compress(const void* data, size_t size, size_t element_size);
+
+        /// \brief The size of the data in a compressed buffer, throws ngraph_error if the
+        ///        buffer is not a compressed buffer
+        size_t get_uncompressed_size(const void* compressed, size_t compressed_size);
+
+        /// \brief Decompresses straight into out, which holds size bytes. Throws ngraph_error
+        ///        unless the buffer decompresses to exactly size bytes.
+        void decompress(const void* compressed, size_t compressed_size, void* out, size_t size);
+    }
+}
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <algorithm>
+#include <utility>
 #include <vector>
 
 #include "ngraph/axis_set.hpp"
@@ -49,6 +50,16 @@ namespace ngraph
         {
         }
 
+        Coordinate(std::vector<size_t>&& axes) noexcept
+            : std::vector<size_t>(std::move(axes))
+        {
+        }
+
+        Coordinate(Coordinate&& axes) noexcept
+            : std::vector<size_t>(std::move(axes))
+        {
+        }
+
         Coordinate(size_t n, size_t initial_value = 0)
             : std::vector<size_t>(n, initial_value)
         {
@@ -66,9 +77,9 @@ namespace ngraph
             return *this;
         }
 
-        Coordinate& operator=(Coordinate&& v)
+        Coordinate& operator=(Coordinate&& v) noexcept
         {
-            static_cast<std::vector<size_t>*>(this)->operator=(v);
+            static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
             return *this;
         }
     };
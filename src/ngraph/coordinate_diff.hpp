@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <ostream>
+#include <utility>
 #include <vector>
 
 namespace ngraph
@@ -41,6 +42,16 @@ namespace ngraph
         {
         }
 
+        CoordinateDiff(std::vector<std::ptrdiff_t>&& diffs) noexcept
+            : std::vector<std::ptrdiff_t>(std::move(diffs))
+        {
+        }
+
+        CoordinateDiff(CoordinateDiff&& diffs) noexcept
+            : std::vector<std::ptrdiff_t>(std::move(diffs))
+        {
+        }
+
         explicit CoordinateDiff(size_t n, std::ptrdiff_t initial_value = 0)
             : std::vector<std::ptrdiff_t>(n, initial_value)
         {
@@ -58,9 +69,9 @@ namespace ngraph
             static_cast<std::vector<std::ptrdiff_t>*>(this)->operator=(v);
             return *this;
         }
-        CoordinateDiff& operator=(CoordinateDiff&& v)
+        CoordinateDiff& operator=(CoordinateDiff&& v) noexcept
         {
-            static_cast<std::vector<std::ptrdiff_t>*>(this)->operator=(v);
+            static_cast<std::vector<std::ptrdiff_t>*>(this)->operator=(std::move(v));
             return *this;
         }
     };
@@ -24,6 +24,7 @@
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/shape.hpp"
+#include "ngraph/shape_util.hpp"
 #include "ngraph/strides.hpp"
 #include "ngraph/util.hpp"
 
@@ -45,6 +46,7 @@ CoordinateTransform::CoordinateTransform(const Shape& source_shape,
     , m_target_padding_below(target_padding_below)
     , m_target_padding_above(target_padding_above)
     , m_target_dilation_strides(target_dilation_strides)
+    , m_source_buffer_strides(row_major_strides(source_shape))
     , m_end_iterator(Shape(), true)
 {
     m_n_axes = source_shape.size();
@@ -289,10 +291,31 @@ size_t CoordinateTransform::index_source(const Coordinate& c) const
     return index;
 }
 
-// Compute the index of a target-space coordinate in thebuffer.
+// Compute the index of a target-space coordinate in the buffer. This is
+// index_source(to_source_coordinate(c)) without the intermediate coordinate.
 size_t CoordinateTransform::index(const Coordinate& c) const
 {
-    return index_source(to_source_coordinate(c));
+    if (c.size() != m_n_axes)
+    {
+        throw std::domain_error(
+            "Target coordinate rank does not match the coordinate transform rank");
+    }
+
+    size_t index = 0;
+
+    for (size_t target_axis = 0; target_axis < m_n_axes; target_axis++)
+    {
+        size_t source_axis = m_source_axis_order[target_axis];
+
+        size_t target_pos = c[target_axis];
+        size_t pos_destrided = target_pos * m_source_strides[source_axis];
+        size_t pos_deshifted = pos_destrided + m_source_start_corner[source_axis];
+        size_t pos_depadded = pos_deshifted - m_target_padding_below[target_axis];
+        size_t pos_dedilated = pos_depadded / m_target_dilation_strides[target_axis];
+        index += pos_dedilated * m_source_buffer_strides[source_axis];
+    }
+
+    return index;
 }
 
 // Convert a target-space coordinate to a source-space coordinate.
@@ -377,6 +400,33 @@ const Shape& CoordinateTransform::get_target_shape() const
     return m_target_shape;
 }
 
+StridedIndexRange CoordinateTransform::source_indices() const
+{
+    for (size_t axis = 0; axis < m_n_axes; axis++)
+    {
+        if (m_target_padding_below[axis] != 0 || m_target_padding_above[axis] != 0 ||
+            m_target_dilation_strides[axis] != 1)
+        {
+            throw std::domain_error(
+                "Source indices are only available for transforms without padding or dilation");
+        }
+    }
+
+    Strides source_buffer_strides = row_major_strides(m_source_shape);
+    Strides strides(m_n_axes);
+    for (size_t target_axis = 0; target_axis < m_n_axes; target_axis++)
+    {
+        size_t source_axis = m_source_axis_order[target_axis];
+        strides[target_axis] = m_source_strides[source_axis] * source_buffer_strides[source_axis];
+    }
+    size_t start = 0;
+    if (shape_size(m_target_shape) != 0)
+    {
+        start = index_source(m_source_start_corner);
+    }
+    return StridedIndexRange(m_target_shape, strides, start);
+}
+
 // The "is_end" parameter is true if we want the "end()" iterator.
 CoordinateTransform::Iterator::Iterator(const Shape& target_shape, bool is_end)
     : m_target_shape(target_shape)
@@ -487,3 +537,85 @@ bool CoordinateTransform::Iterator::operator==(const Iterator& it)
 
     return true;
 }
+
+StridedIndexRange::StridedIndexRange(const Shape& shape, const Strides& strides, size_t start)
+    : m_start(start)
+    , m_count(shape_size(shape))
+{
+    if (shape.size() != strides.size())
+    {
+        throw std::domain_error("Strides do not have the same number of axes as the shape");
+    }
+    for (size_t axis = 0; axis < shape.size(); axis++)
+    {
+        if (shape[axis] == 1)
+        {
+            continue;
+        }
+        if (!m_lengths.empty() && m_strides.back() == strides[axis] * shape[axis])
+        {
+            // the previous axis steps over exactly one run of this one, so merge them
+            m_lengths.back() *= shape[axis];
+            m_strides.back() = strides[axis];
+        }
+        else
+        {
+            m_lengths.push_back(shape[axis]);
+            m_strides.push_back(strides[axis]);
+        }
+    }
+    if (m_lengths.empty())
+    {
+        m_lengths.push_back(1);
+        m_strides.push_back(0);
+    }
+}
+
+StridedIndexRange StridedIndexRange::projection(const Shape& shape, const AxisSet& projected_axes)
+{
+    Strides projected_strides = row_major_strides(reduce(shape, projected_axes));
+    Strides strides(shape.size(), 0);
+    size_t projected_axis = 0;
+    for (size_t axis = 0; axis < shape.size(); axis++)
+    {
+        if (projected_axes.count(axis) == 0)
+        {
+            strides[axis] = projected_strides[projected_axis++];
+        }
+    }
+    return StridedIndexRange(shape, strides);
+}
+
+StridedIndexRange::Iterator::Iterator(const StridedIndexRange* range, bool is_end)
+    : m_range(range)
+    , m_index(range->m_start)
+    , m_remaining(is_end ? 0 : range->m_count)
+    , m_inner_length(range->m_lengths.back())
+    , m_inner_stride(range->m_strides.back())
+{
+    if (!is_end)
+    {
+        m_counter.resize(range->m_lengths.size(), 0);
+    }
+}
+
+void StridedIndexRange::Iterator::carry()
+{
+    const std::vector<size_t>& lengths = m_range->m_lengths;
+    const std::vector<size_t>& strides = m_range->m_strides;
+    for (size_t axis = lengths.size(); axis-- > 0;)
+    {
+        if (m_counter[axis] < lengths[axis])
+        {
+            m_index += strides[axis];
+            return;
+        }
+        // rewind this axis and carry into the next outer one
+        m_counter[axis] = 0;
+        m_index -= (lengths[axis] - 1) * strides[axis];
+        if (axis > 0)
+        {
+            m_counter[axis - 1]++;
+        }
+    }
+}
@@ -16,6 +16,9 @@
 
 #pragma once
 
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
 #include "ngraph/axis_vector.hpp"
 #include "ngraph/coordinate.hpp"
 #include "ngraph/coordinate_diff.hpp"
@@ -24,6 +27,8 @@
 
 namespace ngraph
 {
+    class StridedIndexRange;
+
     class CoordinateTransform
     {
     public:
@@ -65,6 +70,9 @@ namespace ngraph
         bool has_source_coordinate(const Coordinate& c) const;
         Coordinate to_source_coordinate(const Coordinate& c) const;
         const Shape& get_target_shape() const;
+        /// \brief The buffer indices of the target coordinates, in iteration order. Only valid
+        ///        for transforms without padding or dilation.
+        StridedIndexRange source_indices() const;
 
         const Shape& get_source_shape() const { return m_source_shape; }
         const Coordinate& get_source_start_corner() const { return m_source_start_corner; }
@@ -109,9 +117,70 @@ namespace ngraph
         CoordinateDiff m_target_padding_below;
         CoordinateDiff m_target_padding_above;
         Strides m_target_dilation_strides;
+        // Row-major strides of the source buffer
+        Strides m_source_buffer_strides;
 
         Shape m_target_shape;
         size_t m_n_axes;
         Iterator m_end_iterator;
     };
+
+    /// \brief The buffer indices visited by walking the coordinates of a shape in row-major
+    ///        order, where each axis advances the index by its own stride.
+    ///
+    /// Unlike iterating a CoordinateTransform and calling index() per coordinate, no
+    /// coordinates are formed: each step adds a stride to the running index, and nothing is
+    /// allocated after begin(). Axes of length one are dropped and adjacent axes that are
+    /// contiguous with each other are merged, so a dense walk becomes a single axis.
+    class StridedIndexRange
+    {
+    public:
+        StridedIndexRange(const Shape& shape, const Strides& strides, size_t start = 0);
+
+        /// \brief Walk `shape`, yielding the index of each coordinate in the row-major tensor
+        ///        obtained by removing `projected_axes`, e.g. the output index of a reduction
+        ///        or the input index of a broadcast.
+        static StridedIndexRange projection(const Shape& shape, const AxisSet& projected_axes);
+
+        class Iterator
+        {
+        public:
+            size_t operator*() const { return m_index; }
+            Iterator& operator++()
+            {
+                --m_remaining;
+                if (++m_counter.back() < m_inner_length)
+                {
+                    m_index += m_inner_stride;
+                }
+                else
+                {
+                    carry();
+                }
+                return *this;
+            }
+            bool operator!=(const Iterator& it) const { return m_remaining != it.m_remaining; }
+            bool operator==(const Iterator& it) const { return m_remaining == it.m_remaining; }
+        private:
+            friend class StridedIndexRange;
+            Iterator(const StridedIndexRange* range, bool is_end);
+            void carry();
+
+            const StridedIndexRange* m_range;
+            size_t m_index;
+            size_t m_remaining;
+            size_t m_inner_length;
+            size_t m_inner_stride;
+            std::vector<size_t> m_counter;
+        };
+
+        Iterator begin() const { return Iterator(this, false); }
+        Iterator end() const { return Iterator(this, true); }
+        size_t size() const { return m_count; }
+    private:
+        size_t m_start;
+        size_t m_count;
+        std::vector<size_t> m_lengths;
+        std::vector<size_t> m_strides;
+    };
 }
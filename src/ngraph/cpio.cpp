@@ -14,6 +14,10 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+#include <iomanip>
+#include <sstream>
+
 #include "ngraph/cpio.hpp"
 #include "ngraph/log.hpp"
 
@@ -115,10 +119,10 @@ cpio::Header cpio::Header::read(istream& stream)
     return rc;
 }
 
-void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
+void cpio::Header::write(ostream& stream, const string& name, uint32_t size, size_t name_padding)
 {
     // namesize includes the null string terminator so + 1
-    uint16_t namesize = static_cast<uint16_t>(name.size()) + 1;
+    uint16_t namesize = static_cast<uint16_t>(name.size() + 1 + name_padding);
     write_u16(stream, 0x71C7);   // magic
     write_u16(stream, 0);        // dev
     write_u16(stream, 0);        // ino
@@ -130,11 +134,23 @@ void cpio::Header::write(ostream& stream, const string& name, uint32_t size)
     write_u32(stream, 0);        // mtime
     write_u16(stream, namesize); // namesize
     write_u32(stream, size);     // filesize
-    stream.write(name.c_str(), namesize + (namesize % 2));
+    stream.write(name.c_str(), name.size());
+    string terminator(namesize - name.size() + (namesize % 2), '\0');
+    stream.write(terminator.data(), terminator.size());
+}
+
+size_t cpio::Header::size(const string& name, size_t name_padding)
+{
+    // 13 16-bit fields followed by the name field padded to an even length
+    size_t namesize = name.size() + 1 + name_padding;
+    return 26 + namesize + (namesize % 2);
 }
 
 cpio::Writer::Writer()
     : m_stream(nullptr)
+    , m_position(0)
+    , m_alignment(0)
+    , m_next_index_entry(0)
 {
 }
 
@@ -152,6 +168,8 @@ cpio::Writer::Writer(const string& filename)
 
 cpio::Writer::~Writer()
 {
+    // The trailer is not part of the index
+    m_index.clear();
     write("TRAILER!!!", nullptr, 0);
     if (m_my_stream.is_open())
     {
@@ -174,13 +192,28 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
 {
     if (m_stream)
     {
-        Header::write(*m_stream, record_name, size_in_bytes);
+        size_t name_padding = get_name_padding(record_name, m_position);
+        if (!m_index.empty())
+        {
+            if (m_next_index_entry == m_index.size())
+            {
+                throw runtime_error("cpio record '" + record_name + "' is not in the index");
+            }
+            const FileInfo& expected = m_index[m_next_index_entry++];
+            if (expected.get_name() != record_name || expected.get_size() != size_in_bytes ||
+                expected.get_offset() != m_position + Header::size(record_name, name_padding))
+            {
+                throw runtime_error("cpio record '" + record_name + "' does not match the index");
+            }
+        }
+        Header::write(*m_stream, record_name, size_in_bytes, name_padding);
         m_stream->write(static_cast<const char*>(data), size_in_bytes);
         if (size_in_bytes % 2)
         {
             char ch = 0;
             m_stream->write(&ch, 1);
         }
+        m_position += Header::size(record_name, name_padding) + size_in_bytes + size_in_bytes % 2;
     }
     else
     {
@@ -188,6 +221,67 @@ void cpio::Writer::write(const string& record_name, const void* data, uint32_t s
     }
 }
 
+void cpio::Writer::set_alignment(size_t alignment)
+{
+    if (alignment % 2 != 0)
+    {
+        throw runtime_error("cpio alignment must be even");
+    }
+    m_alignment = alignment;
+}
+
+size_t cpio::Writer::get_name_padding(const string& file_name, size_t position) const
+{
+    size_t padding = 0;
+    if (m_alignment > 0)
+    {
+        size_t offset = position + Header::size(file_name);
+        padding = (m_alignment - offset % m_alignment) % m_alignment;
+    }
+    return padding;
+}
+
+void cpio::Writer::write_index(const vector<pair<string, uint32_t>>& records)
+{
+    if (m_position != 0)
+    {
+        throw runtime_error("cpio index must be the first record");
+    }
+
+    // Each line is "<offset> <size> <name>\n" with fixed width hex numbers, so the size of the
+    // index is known before the offsets are
+    const size_t number_width = 16;
+    size_t index_size = 0;
+    for (auto& record : records)
+    {
+        index_size += 2 * number_width + record.first.size() + 3;
+    }
+    string index_name = INDEX_NAME;
+    size_t position = Header::size(index_name) + index_size + index_size % 2;
+
+    vector<FileInfo> expected;
+    stringstream index;
+    index << hex << setfill('0');
+    for (auto& record : records)
+    {
+        size_t name_padding = get_name_padding(record.first, position);
+        size_t offset = position + Header::size(record.first, name_padding);
+        index << setw(number_width) << offset << " " << setw(number_width) << record.second << " "
+              << record.first << "\n";
+        expected.emplace_back(record.first, record.second, offset);
+        position = offset + record.second + record.second % 2;
+    }
+
+    // The index itself is never aligned
+    size_t alignment = m_alignment;
+    m_alignment = 0;
+    string index_data = index.str();
+    write(index_name, index_data.data(), static_cast<uint32_t>(index_data.size()));
+    m_alignment = alignment;
+    m_index = expected;
+    m_next_index_entry = 0;
+}
+
 cpio::Reader::Reader()
     : m_stream(nullptr)
 {
@@ -239,8 +333,8 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
 
             auto buffer = new char[header.namesize];
             m_stream->read(buffer, header.namesize);
-            // namesize includes the null string terminator so -1
-            string file_name = string(buffer, header.namesize - 1);
+            // The name ends at the first null, any following nulls are alignment padding
+            string file_name = string(buffer, strnlen(buffer, header.namesize));
             delete[] buffer;
             // skip any pad characters
             if (header.namesize % 2)
@@ -254,6 +348,26 @@ const vector<cpio::FileInfo>& cpio::Reader::get_file_info()
             }
 
             size_t offset = m_stream->tellg();
+            if (m_file_info.empty() && file_name == INDEX_NAME)
+            {
+                // The index lists every other record, no need to walk the archive
+                string index(header.filesize, '\0');
+                m_stream->read(&index[0], header.filesize);
+                stringstream ss(index);
+                string line;
+                while (getline(ss, line))
+                {
+                    stringstream fields(line);
+                    size_t record_offset;
+                    size_t record_size;
+                    fields >> hex >> record_offset >> record_size;
+                    fields.get();
+                    string record_name;
+                    getline(fields, record_name);
+                    m_file_info.emplace_back(record_name, record_size, record_offset);
+                }
+                break;
+            }
             m_file_info.emplace_back(file_name, header.filesize, offset);
 
             m_stream->seekg((header.filesize % 2) + header.filesize, ios_base::cur);
@@ -35,6 +35,9 @@ namespace ngraph
 
         bool is_cpio(const std::string&);
         bool is_cpio(std::istream&);
+
+        /// \brief Name of the index record written by Writer::write_index
+        constexpr const char* INDEX_NAME = "ngraph.index";
     }
 }
 
@@ -54,7 +57,14 @@ public:
     uint32_t filesize;
 
     static Header read(std::istream&);
-    static void write(std::ostream&, const std::string& name, uint32_t size);
+    /// \brief Writes a header and its name field. name_padding extra NUL characters are
+    ///        appended to the name, which readers ignore, to move the payload that follows.
+    static void write(std::ostream&,
+                      const std::string& name,
+                      uint32_t size,
+                      size_t name_padding = 0);
+    /// \brief Size of the header and name field written for name.
+    static size_t size(const std::string& name, size_t name_padding = 0);
 
 private:
 };
@@ -90,9 +100,24 @@ public:
     void open(const std::string& filename);
     void write(const std::string& file_name, const void* data, uint32_t size_in_bytes);
 
+    /// \brief Align the payload of every following record to alignment bytes, measured from
+    ///        the start of the archive. The archive stays readable by any cpio tool.
+    void set_alignment(size_t alignment);
+
+    /// \brief Write an index of the records that will follow, in the order given, so readers
+    ///        can locate them without scanning the archive. Must be the first record. Each
+    ///        following write is checked against the index.
+    void write_index(const std::vector<std::pair<std::string, uint32_t>>& records);
+
 private:
+    size_t get_name_padding(const std::string& file_name, size_t position) const;
+
     std::ostream* m_stream;
     std::ofstream m_my_stream;
+    size_t m_position;
+    size_t m_alignment;
+    std::vector<FileInfo> m_index;
+    size_t m_next_index_entry;
 };
 
 class ngraph::cpio::Reader
@@ -39,6 +39,7 @@ void descriptor::Input::replace_output(Output& new_output)
     new_output.add_input(this);
     m_output = &new_output;
     m_src_node = std::shared_ptr<Node>(new_output.get_node());
+    Node::notify_graph_modified();
 
     static const auto nerc = std::getenv("NGRAPH_ENABLE_REPLACE_CHECK");
 
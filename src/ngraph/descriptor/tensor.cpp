@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/node.hpp"
@@ -21,12 +23,19 @@
 using namespace ngraph;
 using namespace std;
 
+static size_t next_type_version()
+{
+    static atomic<size_t> s_next_type_version{1};
+    return s_next_type_version.fetch_add(1, memory_order_relaxed);
+}
+
 descriptor::Tensor::Tensor(const element::Type& element_type,
                            const PartialShape& pshape,
                            const std::string& name)
     : m_element_type(element_type)
     , m_shape(pshape.is_static() ? pshape.to_shape() : Shape{})
     , m_partial_shape(pshape)
+    , m_type_version(next_type_version())
     , m_name(name)
 {
 }
@@ -44,6 +53,7 @@ void descriptor::Tensor::set_tensor_type(const element::Type& element_type,
     }
     m_partial_shape = pshape;
     m_element_type = element_type;
+    m_type_version = next_type_version();
 }
 
 const Shape& descriptor::Tensor::get_shape() const
@@ -52,6 +52,9 @@ namespace ngraph
             const element::Type& get_element_type() const { return m_element_type; }
             const Shape& get_shape() const;
             const PartialShape& get_partial_shape() const { return m_partial_shape; }
+            /// \brief Unique across all descriptors and changed by set_tensor_type, so that a
+            ///        check of the element type and shape can be cached until it changes
+            size_t get_type_version() const { return m_type_version; }
             const std::shared_ptr<layout::TensorLayout>& get_tensor_layout() const
             {
                 return m_tensor_layout;
@@ -73,6 +76,7 @@ namespace ngraph
             //    should refactor so that get_shape returns by value.
             Shape m_shape;
             PartialShape m_partial_shape;
+            size_t m_type_version;
 
             std::string m_name;
             std::shared_ptr<layout::TensorLayout> m_tensor_layout;
@@ -14,16 +14,97 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstdlib>
+#include <vector>
+
 #include "ngraph/distributed.hpp"
 #include "ngraph/distributed/mlsl.hpp"
 #include "ngraph/distributed/null.hpp"
 #include "ngraph/distributed/open_mpi.hpp"
+#include "ngraph/distributed/profiling.hpp"
+#include "ngraph/except.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
 
 using namespace ngraph;
 
 static std::unique_ptr<DistributedInterface> s_distributed_interface;
 
+namespace
+{
+    class CompletedDistributedRequest : public DistributedRequest
+    {
+    public:
+        void wait() override {}
+    };
+}
+
+std::shared_ptr<DistributedRequest> DistributedInterface::iall_reduce(void* in,
+                                                                      void* out,
+                                                                      element::Type_t element_type,
+                                                                      size_t count)
+{
+    all_reduce(in, out, element_type, count);
+    return std::make_shared<CompletedDistributedRequest>();
+}
+
+void DistributedInterface::barrier()
+{
+    float value = 0;
+    all_reduce(&value, &value, element::Type_t::f32, 1);
+}
+
+std::shared_ptr<DistributedRequest> DistributedInterface::irecv(
+    void* out, element::Type_t element_type, size_t count, int src_rank, int tag)
+{
+    recv(out, element_type, count, src_rank, tag);
+    return std::make_shared<CompletedDistributedRequest>();
+}
+
+template <typename T>
+static void compressed_all_reduce(DistributedInterface* distributed_interface,
+                                  const float* in,
+                                  float* out,
+                                  element::Type_t compressed_type,
+                                  size_t count,
+                                  float* error_feedback,
+                                  float loss_scale)
+{
+    std::vector<T> buffer(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        float value = in[i] + error_feedback[i];
+        buffer[i] = T(value * loss_scale);
+        error_feedback[i] = value - static_cast<float>(buffer[i]) / loss_scale;
+    }
+    distributed_interface->all_reduce(buffer.data(), buffer.data(), compressed_type, count);
+    for (size_t i = 0; i < count; i++)
+    {
+        out[i] = static_cast<float>(buffer[i]) / loss_scale;
+    }
+}
+
+void DistributedInterface::compressed_all_reduce(const float* in,
+                                                 float* out,
+                                                 element::Type_t compressed_type,
+                                                 size_t count,
+                                                 float* error_feedback)
+{
+    switch (compressed_type)
+    {
+    case element::Type_t::f16:
+        ::compressed_all_reduce<float16>(
+            this, in, out, compressed_type, count, error_feedback, m_loss_scale);
+        break;
+    case element::Type_t::bf16:
+        ::compressed_all_reduce<bfloat16>(
+            this, in, out, compressed_type, count, error_feedback, m_loss_scale);
+        break;
+    default: throw ngraph_error("AllReduce compression supports only f16 and bf16 types");
+    }
+}
+
 void ngraph::set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface)
 {
     NGRAPH_DEBUG << "Setting distributed interfsce to: " << distributed_interface->get_name();
@@ -44,6 +125,12 @@ DistributedInterface* ngraph::get_distributed_interface()
         set_distributed_interface(std::unique_ptr<DistributedInterface>(
             new ngraph::distributed::NullDistributedInterface()));
 #endif
+        if (std::getenv("NGRAPH_DISTRIBUTED_PROFILE") != nullptr)
+        {
+            set_distributed_interface(std::unique_ptr<DistributedInterface>(
+                new ngraph::distributed::ProfilingDistributedInterface(
+                    std::move(s_distributed_interface))));
+        }
     }
     return s_distributed_interface.get();
 }
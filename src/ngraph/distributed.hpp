@@ -24,6 +24,15 @@
 
 namespace ngraph
 {
+    /// \brief A collective operation started by DistributedInterface that may still be running
+    class DistributedRequest
+    {
+    public:
+        virtual ~DistributedRequest() {}
+        /// \brief Block until the operation has completed and its output can be read
+        virtual void wait() = 0;
+    };
+
     class DistributedInterface
     {
     public:
@@ -34,7 +43,58 @@ namespace ngraph
 
         virtual void
             all_reduce(void* in, void* out, element::Type_t element_type, size_t count) = 0;
+        /// \brief Start all_reduce and return without waiting for it. \p in and \p out must
+        ///        not be touched until the returned request has been waited on. \p in may be
+        ///        the same buffer as \p out. The default implementation runs all_reduce.
+        virtual std::shared_ptr<DistributedRequest>
+            iall_reduce(void* in, void* out, element::Type_t element_type, size_t count);
+        /// \brief All-reduce the f32 buffer \p in into \p out with the collective run in
+        ///        \p compressed_type (f16 or bf16), halving the traffic. Values are multiplied
+        ///        by get_loss_scale() before the cast and divided by it after. The rounding
+        ///        error of the cast is stored in \p error_feedback, \p count elements owned by
+        ///        the caller and zeroed before the first call, and added back on the next call.
+        void compressed_all_reduce(const float* in,
+                                   float* out,
+                                   element::Type_t compressed_type,
+                                   size_t count,
+                                   float* error_feedback);
+        /// \brief Loss-scaling hook for compressed_all_reduce. Frameworks that scale the loss
+        ///        dynamically update this between iterations to keep f16 gradients in range.
+        void set_loss_scale(float loss_scale) { m_loss_scale = loss_scale; }
+        float get_loss_scale() const { return m_loss_scale; }
         virtual void broadcast(void* in, element::Type_t element_type, size_t count) = 0;
+        /// \brief Sum \p in over all processes and scatter the sum: each process gets the
+        ///        \p count elements of its rank in \p out. \p in holds get_size() * \p count
+        ///        elements.
+        virtual void
+            reduce_scatter(void* in, void* out, element::Type_t element_type, size_t count) = 0;
+        /// \brief Gather the \p count elements of \p in of every process into \p out, in
+        ///        rank order. \p out holds get_size() * \p count elements.
+        virtual void
+            all_gather(void* in, void* out, element::Type_t element_type, size_t count) = 0;
+        /// \brief Send \p count elements of \p in to process \p dest_rank. Returns once \p in
+        ///        can be reused, which may be before the message has been received.
+        ///        Messages are matched to recv by source and \p tag.
+        virtual void send(const void* in,
+                          element::Type_t element_type,
+                          size_t count,
+                          int dest_rank,
+                          int tag) = 0;
+        /// \brief Receive \p count elements sent with \p tag by process \p src_rank into
+        ///        \p out, blocking until they have arrived.
+        virtual void
+            recv(void* out, element::Type_t element_type, size_t count, int src_rank, int tag) = 0;
+        /// \brief Start recv and return without waiting for the message. \p out must not be
+        ///        read until the returned request has been waited on. The default
+        ///        implementation runs recv.
+        virtual std::shared_ptr<DistributedRequest>
+            irecv(void* out, element::Type_t element_type, size_t count, int src_rank, int tag);
+        /// \brief Block until every process has called barrier. The default implementation
+        ///        all-reduces one element.
+        virtual void barrier();
+
+    protected:
+        float m_loss_scale = 1.0f;
     };
 
     void set_distributed_interface(std::unique_ptr<DistributedInterface> distributed_interface);
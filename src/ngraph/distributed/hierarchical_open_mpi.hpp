@@ -0,0 +1,203 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/distributed/open_mpi.hpp"
+
+#ifdef NGRAPH_DISTRIBUTED_OMPI_ENABLE
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+#include <mpi.h>
+
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
+namespace ngraph
+{
+    namespace distributed
+    {
+        /// \brief OpenMPI interface whose all_reduce is split into a reduction inside each
+        ///        node through a shared memory segment, an all-reduce between one leader per
+        ///        node, and a copy of the result back out of the segment. Use it with
+        ///        set_distributed_interface when several ranks share a host.
+        ///
+        /// The node and leader communicators are built from the rank topology when the
+        /// interface is constructed. The other collectives run on MPI_COMM_WORLD.
+        class HierarchicalOpenMPIDistributedInterface : public OpenMPIDistributedInterface
+        {
+        public:
+            HierarchicalOpenMPIDistributedInterface(
+                const std::string& name = "HierarchicalOpenMPI")
+                : OpenMPIDistributedInterface(name)
+            {
+                MPI_Comm_split_type(
+                    MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &m_node_comm);
+                MPI_Comm_rank(m_node_comm, &m_node_rank);
+                MPI_Comm_size(m_node_comm, &m_node_size);
+                MPI_Comm_split(MPI_COMM_WORLD,
+                               m_node_rank == 0 ? 0 : MPI_UNDEFINED,
+                               get_rank(),
+                               &m_leader_comm);
+            }
+
+            ~HierarchicalOpenMPIDistributedInterface() override
+            {
+                int is_mpi_finalized = 0;
+                MPI_Finalized(&is_mpi_finalized);
+                if (!is_mpi_finalized)
+                {
+                    free_segment();
+                    if (m_leader_comm != MPI_COMM_NULL)
+                    {
+                        MPI_Comm_free(&m_leader_comm);
+                    }
+                    MPI_Comm_free(&m_node_comm);
+                }
+            }
+
+            int get_node_rank() const { return m_node_rank; }
+            int get_node_size() const { return m_node_size; }
+
+            void
+                all_reduce(void* in, void* out, element::Type_t element_type, size_t count) override
+            {
+                if (count == 0)
+                {
+                    return;
+                }
+                // throws for types that can not be reduced
+                auto data_type = get_data_type(element_type);
+                size_t size = count * element::Type(element_type).size();
+                reserve_segment(size);
+
+                // 1. every rank publishes its input in its own slot of the segment
+                char* own_slot = m_segment + m_node_rank * m_slot_size;
+                memcpy(own_slot, in, size);
+                node_barrier();
+
+                // 2. each rank sums its share of the elements over all slots into slot 0
+                size_t chunk = (count + m_node_size - 1) / m_node_size;
+                size_t begin = std::min(count, m_node_rank * chunk);
+                size_t end = std::min(count, begin + chunk);
+                switch (element_type)
+                {
+                case element::Type_t::f32: sum_slots<float, float>(begin, end); break;
+                case element::Type_t::f64: sum_slots<double, double>(begin, end); break;
+                case element::Type_t::f16: sum_slots<float16, float>(begin, end); break;
+                case element::Type_t::bf16: sum_slots<bfloat16, float>(begin, end); break;
+                default: break;
+                }
+                node_barrier();
+
+                // 3. the node leaders reduce the node sums between nodes
+                if (m_leader_comm != MPI_COMM_NULL)
+                {
+                    MPI_Allreduce(MPI_IN_PLACE,
+                                  m_segment,
+                                  count,
+                                  data_type,
+                                  get_sum_op(element_type),
+                                  m_leader_comm);
+                }
+                node_barrier();
+
+                // 4. every rank reads the result, the barrier keeps slot 0 intact until then
+                memcpy(out, m_segment, size);
+                node_barrier();
+            }
+
+            std::shared_ptr<DistributedRequest> iall_reduce(void* in,
+                                                            void* out,
+                                                            element::Type_t element_type,
+                                                            size_t count) override
+            {
+                // the node barriers make the hierarchical all-reduce blocking
+                return DistributedInterface::iall_reduce(in, out, element_type, count);
+            }
+
+        protected:
+            // 16-bit types are accumulated in ACC_T
+            template <typename T, typename ACC_T>
+            void sum_slots(size_t begin, size_t end)
+            {
+                T* sum = reinterpret_cast<T*>(m_segment);
+                for (int slot = 1; slot < m_node_size; slot++)
+                {
+                    const T* values = reinterpret_cast<const T*>(m_segment + slot * m_slot_size);
+                    for (size_t i = begin; i < end; i++)
+                    {
+                        sum[i] = static_cast<T>(static_cast<ACC_T>(sum[i]) +
+                                                static_cast<ACC_T>(values[i]));
+                    }
+                }
+            }
+
+            // make the stores of every rank in the node visible to the others
+            void node_barrier()
+            {
+                MPI_Win_sync(m_window);
+                MPI_Barrier(m_node_comm);
+                MPI_Win_sync(m_window);
+            }
+
+            // Grows the segment to hold a slot of `size` bytes per rank in the node. All ranks
+            // of the node call this with the same size, as the allocation is collective.
+            void reserve_segment(size_t size)
+            {
+                if (size <= m_slot_size && m_window != MPI_WIN_NULL)
+                {
+                    return;
+                }
+                free_segment();
+                m_slot_size = std::max(size, m_slot_size);
+                char* base = nullptr;
+                MPI_Win_allocate_shared(m_slot_size * (m_node_rank == 0 ? m_node_size : 0),
+                                        1,
+                                        MPI_INFO_NULL,
+                                        m_node_comm,
+                                        &base,
+                                        &m_window);
+                // the segment is allocated contiguously by rank 0, everyone addresses it there
+                MPI_Aint segment_size;
+                int disp_unit;
+                MPI_Win_shared_query(m_window, 0, &segment_size, &disp_unit, &m_segment);
+                MPI_Win_lock_all(MPI_MODE_NOCHECK, m_window);
+            }
+
+            void free_segment()
+            {
+                if (m_window != MPI_WIN_NULL)
+                {
+                    MPI_Win_unlock_all(m_window);
+                    MPI_Win_free(&m_window);
+                    m_segment = nullptr;
+                }
+            }
+
+            MPI_Comm m_node_comm = MPI_COMM_NULL;
+            MPI_Comm m_leader_comm = MPI_COMM_NULL;
+            int m_node_rank = 0;
+            int m_node_size = 1;
+            MPI_Win m_window = MPI_WIN_NULL;
+            char* m_segment = nullptr;
+            size_t m_slot_size = 0;
+        };
+    }
+}
+#endif
@@ -17,6 +17,7 @@
 #pragma once
 
 #ifdef NGRAPH_DISTRIBUTED_MLSL_ENABLE
+#include <memory>
 #include <string>
 
 #include <mlsl.hpp>
@@ -62,6 +63,14 @@ namespace ngraph
 
             void
                 all_reduce(void* in, void* out, element::Type_t element_type, size_t count) override
+            {
+                iall_reduce(in, out, element_type, count)->wait();
+            }
+
+            std::shared_ptr<DistributedRequest> iall_reduce(void* in,
+                                                            void* out,
+                                                            element::Type_t element_type,
+                                                            size_t count) override
             {
                 auto data_type = MLSL::DT_FLOAT;
 
@@ -82,8 +91,7 @@ namespace ngraph
                 MLSL::Distribution* distribution = env.CreateDistribution(env.GetProcessCount(), 1);
                 MLSL::CommReq* req =
                     distribution->AllReduce(in, out, count, data_type, MLSL::RT_SUM, MLSL::GT_DATA);
-                env.Wait(req);
-                env.DeleteDistribution(distribution);
+                return std::make_shared<MLSLRequest>(distribution, req);
             }
 
             void broadcast(void* in, element::Type_t element_type, size_t count) override
@@ -94,10 +102,14 @@ namespace ngraph
                 {
                     data_type = MLSL::DT_DOUBLE;
                 }
+                else if (element_type == element::Type_t::u8)
+                {
+                    // raw bytes, as when constants are sent by deserialize_distributed
+                    data_type = MLSL::DT_BYTE;
+                }
                 else if (element_type != element::Type_t::f32)
                 {
-                    throw std::runtime_error(
-                        "BroadcastDistributed op supports only f32 and f64 types");
+                    throw std::runtime_error("Broadcast supports only f32, f64 and u8 types");
                 }
 
                 MLSL::Environment& env = MLSL::Environment::GetEnv();
@@ -107,7 +119,99 @@ namespace ngraph
                 env.DeleteDistribution(distribution);
             }
 
+            void reduce_scatter(void* in,
+                                void* out,
+                                element::Type_t element_type,
+                                size_t count) override
+            {
+                auto data_type = get_data_type(element_type, "ReduceScatter");
+                MLSL::Environment& env = MLSL::Environment::GetEnv();
+                MLSL::Distribution* distribution = env.CreateDistribution(env.GetProcessCount(), 1);
+                MLSL::CommReq* req = distribution->ReduceScatter(
+                    in, out, count, data_type, MLSL::RT_SUM, MLSL::GT_DATA);
+                env.Wait(req);
+                env.DeleteDistribution(distribution);
+            }
+
+            void
+                all_gather(void* in, void* out, element::Type_t element_type, size_t count) override
+            {
+                auto data_type = MLSL::DT_BYTE;
+                if (element_type == element::Type_t::i32 || element_type == element::Type_t::i64)
+                {
+                    // nothing is computed on gathered data, integers travel as bytes
+                    count *= element::Type(element_type).size();
+                }
+                else
+                {
+                    data_type = get_data_type(element_type, "AllGather");
+                }
+                MLSL::Environment& env = MLSL::Environment::GetEnv();
+                MLSL::Distribution* distribution = env.CreateDistribution(env.GetProcessCount(), 1);
+                MLSL::CommReq* req = distribution->AllGather(in, count, out, data_type, MLSL::GT_DATA);
+                env.Wait(req);
+                env.DeleteDistribution(distribution);
+            }
+
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_rank,
+                      int tag) override
+            {
+                throw std::runtime_error("MLSL has no point-to-point communication for Send op");
+            }
+
+            void recv(void* out,
+                      element::Type_t element_type,
+                      size_t count,
+                      int src_rank,
+                      int tag) override
+            {
+                throw std::runtime_error("MLSL has no point-to-point communication for Recv op");
+            }
+
         protected:
+            static MLSL::DataType get_data_type(element::Type_t element_type,
+                                                const std::string& op)
+            {
+                if (element_type == element::Type_t::f32)
+                {
+                    return MLSL::DT_FLOAT;
+                }
+                else if (element_type == element::Type_t::f64)
+                {
+                    return MLSL::DT_DOUBLE;
+                }
+                throw std::runtime_error(op + " op supports only f32 and f64 types");
+            }
+
+            class MLSLRequest : public DistributedRequest
+            {
+            public:
+                MLSLRequest(MLSL::Distribution* distribution, MLSL::CommReq* req)
+                    : m_distribution(distribution)
+                    , m_req(req)
+                {
+                }
+
+                ~MLSLRequest() override { wait(); }
+                void wait() override
+                {
+                    if (m_distribution != nullptr)
+                    {
+                        MLSL::Environment& env = MLSL::Environment::GetEnv();
+                        env.Wait(m_req);
+                        env.DeleteDistribution(m_distribution);
+                        m_distribution = nullptr;
+                    }
+                }
+
+            private:
+                MLSL::Distribution* m_distribution;
+                MLSL::CommReq* m_req;
+            };
+
             std::string m_name{"MLSL"};
             bool m_initialized_mlsl = false;
         };
@@ -36,11 +36,54 @@ namespace ngraph
                 throw ngraph_error("Distributed Library not supported/mentioned");
             }
 
+            std::shared_ptr<DistributedRequest> iall_reduce(void* in,
+                                                            void* out,
+                                                            element::Type_t element_type,
+                                                            size_t count) override
+            {
+                throw ngraph_error("Distributed Library not supported/mentioned");
+            }
+
             void broadcast(void* in, element::Type_t element_type, size_t count) override
             {
                 throw ngraph_error("Distributed Library not supported/mentioned");
             }
 
+            void reduce_scatter(void* in,
+                                void* out,
+                                element::Type_t element_type,
+                                size_t count) override
+            {
+                throw ngraph_error("Distributed Library not supported/mentioned");
+            }
+
+            void
+                all_gather(void* in, void* out, element::Type_t element_type, size_t count) override
+            {
+                throw ngraph_error("Distributed Library not supported/mentioned");
+            }
+
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_rank,
+                      int tag) override
+            {
+                throw ngraph_error("Distributed Library not supported/mentioned");
+            }
+
+            void recv(void* out,
+                      element::Type_t element_type,
+                      size_t count,
+                      int src_rank,
+                      int tag) override
+            {
+                throw ngraph_error("Distributed Library not supported/mentioned");
+            }
+
+            // there are no other processes to wait for
+            void barrier() override {}
+
         protected:
             std::string m_name{"NULL"};
         };
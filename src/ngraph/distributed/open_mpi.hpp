@@ -21,10 +21,17 @@
 #include "ngraph/distributed.hpp"
 
 #ifdef NGRAPH_DISTRIBUTED_OMPI_ENABLE
+#include <list>
+#include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <mpi.h>
 
+#include "ngraph/type/bfloat16.hpp"
+#include "ngraph/type/float16.hpp"
+
 namespace ngraph
 {
     namespace distributed
@@ -48,6 +55,13 @@ namespace ngraph
             {
                 int is_mpi_finalized = 0;
                 MPI_Finalized(&is_mpi_finalized);
+                if (!is_mpi_finalized)
+                {
+                    for (auto& pending : m_pending_sends)
+                    {
+                        MPI_Wait(&pending.first, MPI_STATUS_IGNORE);
+                    }
+                }
                 if (!is_mpi_finalized && m_initialized_mpi)
                 {
                     MPI_Finalize();
@@ -72,44 +86,200 @@ namespace ngraph
 
             void
                 all_reduce(void* in, void* out, element::Type_t element_type, size_t count) override
+            {
+                MPI_Allreduce(in == out ? MPI_IN_PLACE : in,
+                              out,
+                              count,
+                              get_data_type(element_type),
+                              get_sum_op(element_type),
+                              MPI_COMM_WORLD);
+            }
+
+            std::shared_ptr<DistributedRequest> iall_reduce(void* in,
+                                                            void* out,
+                                                            element::Type_t element_type,
+                                                            size_t count) override
+            {
+                auto request = std::make_shared<OpenMPIRequest>();
+                MPI_Iallreduce(in == out ? MPI_IN_PLACE : in,
+                               out,
+                               count,
+                               get_data_type(element_type),
+                               get_sum_op(element_type),
+                               MPI_COMM_WORLD,
+                               &request->m_request);
+                return request;
+            }
+
+            void broadcast(void* in, element::Type_t element_type, size_t count) override
             {
                 auto data_type = MPI_FLOAT;
 
-                if (element_type == element::Type_t::f32)
+                if (element_type == element::Type_t::f64)
                 {
-                    data_type = MPI_FLOAT;
+                    data_type = MPI_DOUBLE;
                 }
-                else if (element_type == element::Type_t::f64)
+                else if (element_type == element::Type_t::u8)
                 {
-                    data_type = MPI_DOUBLE;
+                    // raw bytes, as when constants are sent by deserialize_distributed
+                    data_type = MPI_BYTE;
                 }
-                else
+                else if (element_type != element::Type_t::f32)
                 {
-                    throw std::runtime_error("AllReduce op supports only f32 and f64 types");
+                    throw std::runtime_error("Broadcast supports only f32, f64 and u8 types");
                 }
+                MPI_Bcast(in, count, data_type, 0, MPI_COMM_WORLD);
+            }
 
-                MPI_Allreduce(in, out, count, data_type, MPI_SUM, MPI_COMM_WORLD);
+            void reduce_scatter(void* in,
+                                void* out,
+                                element::Type_t element_type,
+                                size_t count) override
+            {
+                MPI_Reduce_scatter_block(in,
+                                         out,
+                                         count,
+                                         get_data_type(element_type, "ReduceScatter"),
+                                         get_sum_op(element_type),
+                                         MPI_COMM_WORLD);
             }
 
-            void broadcast(void* in, element::Type_t element_type, size_t count) override
+            void
+                all_gather(void* in, void* out, element::Type_t element_type, size_t count) override
             {
-                auto data_type = MPI_FLOAT;
+                auto data_type = get_data_type(element_type, "AllGather");
+                MPI_Allgather(in, count, data_type, out, count, data_type, MPI_COMM_WORLD);
+            }
 
-                if (element_type == element::Type_t::f64)
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_rank,
+                      int tag) override
+            {
+                // Sends are buffered, so that a sender is never blocked by a receiver that is
+                // still waiting for another message. That keeps pipelines free of deadlocks.
+                size_t size = count * element::Type(element_type).size();
+                std::vector<char> buffer(static_cast<const char*>(in),
+                                         static_cast<const char*>(in) + size);
+                m_pending_sends.emplace_back(MPI_REQUEST_NULL, std::move(buffer));
+                auto& pending = m_pending_sends.back();
+                MPI_Isend(pending.second.data(),
+                          size,
+                          MPI_BYTE,
+                          dest_rank,
+                          tag,
+                          MPI_COMM_WORLD,
+                          &pending.first);
+
+                // release the buffers of the sends that have completed
+                m_pending_sends.remove_if([](std::pair<MPI_Request, std::vector<char>>& p) {
+                    int done = 0;
+                    MPI_Test(&p.first, &done, MPI_STATUS_IGNORE);
+                    return done != 0;
+                });
+            }
+
+            void recv(void* out,
+                      element::Type_t element_type,
+                      size_t count,
+                      int src_rank,
+                      int tag) override
+            {
+                size_t size = count * element::Type(element_type).size();
+                MPI_Recv(out, size, MPI_BYTE, src_rank, tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            }
+
+            void barrier() override { MPI_Barrier(MPI_COMM_WORLD); }
+
+            std::shared_ptr<DistributedRequest> irecv(void* out,
+                                                      element::Type_t element_type,
+                                                      size_t count,
+                                                      int src_rank,
+                                                      int tag) override
+            {
+                auto request = std::make_shared<OpenMPIRequest>();
+                size_t size = count * element::Type(element_type).size();
+                MPI_Irecv(
+                    out, size, MPI_BYTE, src_rank, tag, MPI_COMM_WORLD, &request->m_request);
+                return request;
+            }
+
+        protected:
+            class OpenMPIRequest : public DistributedRequest
+            {
+            public:
+                ~OpenMPIRequest() override { wait(); }
+                // MPI_Wait sets the request to MPI_REQUEST_NULL, so later waits return at once
+                void wait() override { MPI_Wait(&m_request, MPI_STATUS_IGNORE); }
+                MPI_Request m_request = MPI_REQUEST_NULL;
+            };
+
+            static MPI_Datatype get_data_type(element::Type_t element_type,
+                                              const std::string& op = "AllReduce")
+            {
+                if (element_type == element::Type_t::f32)
                 {
-                    data_type = MPI_DOUBLE;
+                    return MPI_FLOAT;
                 }
-                else if (element_type != element::Type_t::f32)
+                else if (element_type == element::Type_t::f64)
                 {
-                    throw std::runtime_error(
-                        "BroadcastDistributed op supports only f32 and f64 types");
+                    return MPI_DOUBLE;
                 }
-                MPI_Bcast(in, count, data_type, 0, MPI_COMM_WORLD);
+                else if (element_type == element::Type_t::f16 ||
+                         element_type == element::Type_t::bf16)
+                {
+                    return MPI_UINT16_T;
+                }
+                else if (element_type == element::Type_t::i32)
+                {
+                    return MPI_INT32_T;
+                }
+                else if (element_type == element::Type_t::i64)
+                {
+                    return MPI_INT64_T;
+                }
+                throw std::runtime_error(op + " op supports only f32, f64, f16, bf16, i32 and i64 "
+                                              "types");
+            }
+
+            // MPI has no 16-bit floating point types, those are summed by a user op in f32
+            static MPI_Op get_sum_op(element::Type_t element_type)
+            {
+                if (element_type == element::Type_t::f16)
+                {
+                    static MPI_Op f16_sum = create_sum_op<float16>();
+                    return f16_sum;
+                }
+                else if (element_type == element::Type_t::bf16)
+                {
+                    static MPI_Op bf16_sum = create_sum_op<bfloat16>();
+                    return bf16_sum;
+                }
+                return MPI_SUM;
+            }
+
+            template <typename T>
+            static MPI_Op create_sum_op()
+            {
+                MPI_Op op;
+                MPI_Op_create(
+                    [](void* in, void* inout, int* len, MPI_Datatype*) {
+                        auto a = static_cast<const T*>(in);
+                        auto b = static_cast<T*>(inout);
+                        for (int i = 0; i < *len; i++)
+                        {
+                            b[i] = T(static_cast<float>(a[i]) + static_cast<float>(b[i]));
+                        }
+                    },
+                    1,
+                    &op);
+                return op;
             }
 
-        protected:
             std::string m_name;
             bool m_initialized_mpi = false;
+            std::list<std::pair<MPI_Request, std::vector<char>>> m_pending_sends;
         };
     }
 }
@@ -0,0 +1,280 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <sstream>
+
+#include "ngraph/distributed/profiling.hpp"
+#include "ngraph/util.hpp"
+#ifdef NGRAPH_JSON_ENABLE
+#include "ngraph/event_tracing.hpp"
+#endif
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Records the time from the start of a non-blocking operation to the end of its first
+    // wait, and the time blocked in that wait
+    class ProfiledRequest : public DistributedRequest
+    {
+    public:
+        ProfiledRequest(distributed::ProfilingDistributedInterface* interface,
+                        const string& name,
+                        double bus_factor,
+                        uint64_t bytes,
+                        const stopwatch& timer,
+                        const shared_ptr<DistributedRequest>& request)
+            : m_interface(interface)
+            , m_name(name)
+            , m_bus_factor(bus_factor)
+            , m_bytes(bytes)
+            , m_timer(timer)
+            , m_request(request)
+        {
+        }
+        ~ProfiledRequest() override { wait(); }
+        void wait() override
+        {
+            if (!m_request)
+            {
+                return;
+            }
+            stopwatch wait_timer;
+            wait_timer.start();
+            m_request->wait();
+            wait_timer.stop();
+            m_timer.stop();
+            m_request = nullptr;
+            m_interface->record(m_name,
+                                m_bus_factor,
+                                m_bytes,
+                                m_timer.get_microseconds(),
+                                wait_timer.get_microseconds());
+        }
+
+    private:
+        distributed::ProfilingDistributedInterface* m_interface;
+        string m_name;
+        double m_bus_factor;
+        uint64_t m_bytes;
+        stopwatch m_timer;
+        shared_ptr<DistributedRequest> m_request;
+    };
+}
+
+static uint64_t get_bytes(element::Type_t element_type, size_t count)
+{
+    return count * element::Type(element_type).size();
+}
+
+distributed::ProfilingDistributedInterface::ProfilingDistributedInterface(
+    unique_ptr<DistributedInterface> interface, bool measure_wait)
+    : m_interface(move(interface))
+    , m_measure_wait(measure_wait)
+{
+    m_loss_scale = m_interface->get_loss_scale();
+}
+
+template <typename F>
+void distributed::ProfilingDistributedInterface::profile(
+    const string& name, double bus_factor, uint64_t bytes, bool collective, F&& call)
+{
+#ifdef NGRAPH_JSON_ENABLE
+    unique_ptr<Event> wait_event;
+    unique_ptr<Event> event;
+#endif
+    stopwatch wait_timer;
+    if (collective && m_measure_wait)
+    {
+#ifdef NGRAPH_JSON_ENABLE
+        if (Event::is_tracing_enabled())
+        {
+            wait_event.reset(new Event(name + " wait", "Communication", ""));
+        }
+#endif
+        wait_timer.start();
+        m_interface->barrier();
+        wait_timer.stop();
+#ifdef NGRAPH_JSON_ENABLE
+        if (wait_event)
+        {
+            wait_event->Stop();
+            Event::write_trace(*wait_event);
+        }
+#endif
+    }
+
+#ifdef NGRAPH_JSON_ENABLE
+    if (Event::is_tracing_enabled())
+    {
+        event.reset(new Event(name, "Communication", ""));
+    }
+#endif
+    stopwatch timer;
+    timer.start();
+    call();
+    timer.stop();
+    size_t wait_microseconds = wait_timer.get_microseconds();
+    size_t microseconds = timer.get_microseconds() + wait_microseconds;
+    record(name, bus_factor, bytes, microseconds, wait_microseconds);
+#ifdef NGRAPH_JSON_ENABLE
+    if (event)
+    {
+        event->Stop();
+        ostringstream args;
+        args << "bytes=" << bytes << " wait_us=" << wait_microseconds << " bus_gbps="
+             << bus_factor * bytes / (max<size_t>(timer.get_microseconds(), 1) * 1e3);
+        event->set_args(args.str());
+        Event::write_trace(*event);
+    }
+#endif
+}
+
+void distributed::ProfilingDistributedInterface::record(const string& name,
+                                                        double bus_factor,
+                                                        uint64_t bytes,
+                                                        size_t microseconds,
+                                                        size_t wait_microseconds)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_counters.find(name);
+    if (it == m_counters.end())
+    {
+        it = m_counters.emplace(name, CollectiveCounter(name, bus_factor)).first;
+    }
+    auto& counter = it->second;
+    counter.m_call_count++;
+    counter.m_total_bytes += bytes;
+    counter.m_total_microseconds += microseconds;
+    counter.m_total_wait_microseconds += wait_microseconds;
+}
+
+vector<distributed::CollectiveCounter>
+    distributed::ProfilingDistributedInterface::get_counters() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    vector<CollectiveCounter> counters;
+    for (auto& counter : m_counters)
+    {
+        counters.push_back(counter.second);
+    }
+    return counters;
+}
+
+void distributed::ProfilingDistributedInterface::reset_counters()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_counters.clear();
+}
+
+// Share of the data every link carries, as in the NCCL tests
+static double all_reduce_bus_factor(int size)
+{
+    return size > 1 ? 2.0 * (size - 1) / size : 1.0;
+}
+
+static double all_gather_bus_factor(int size)
+{
+    return size > 1 ? static_cast<double>(size - 1) / size : 1.0;
+}
+
+void distributed::ProfilingDistributedInterface::all_reduce(void* in,
+                                                            void* out,
+                                                            element::Type_t element_type,
+                                                            size_t count)
+{
+    profile("AllReduce",
+            all_reduce_bus_factor(get_size()),
+            get_bytes(element_type, count),
+            true,
+            [&]() { m_interface->all_reduce(in, out, element_type, count); });
+}
+
+shared_ptr<DistributedRequest> distributed::ProfilingDistributedInterface::iall_reduce(
+    void* in, void* out, element::Type_t element_type, size_t count)
+{
+    stopwatch timer;
+    timer.start();
+    auto request = m_interface->iall_reduce(in, out, element_type, count);
+    return make_shared<ProfiledRequest>(this,
+                                        "AllReduce",
+                                        all_reduce_bus_factor(get_size()),
+                                        get_bytes(element_type, count),
+                                        timer,
+                                        request);
+}
+
+void distributed::ProfilingDistributedInterface::broadcast(void* in,
+                                                           element::Type_t element_type,
+                                                           size_t count)
+{
+    profile("Broadcast", 1.0, get_bytes(element_type, count), true, [&]() {
+        m_interface->broadcast(in, element_type, count);
+    });
+}
+
+void distributed::ProfilingDistributedInterface::reduce_scatter(void* in,
+                                                                void* out,
+                                                                element::Type_t element_type,
+                                                                size_t count)
+{
+    // the bytes of the whole input, of which each process keeps count elements
+    profile("ReduceScatter",
+            all_gather_bus_factor(get_size()),
+            get_bytes(element_type, count) * max(get_size(), 1),
+            true,
+            [&]() { m_interface->reduce_scatter(in, out, element_type, count); });
+}
+
+void distributed::ProfilingDistributedInterface::all_gather(void* in,
+                                                            void* out,
+                                                            element::Type_t element_type,
+                                                            size_t count)
+{
+    // the bytes of the whole output
+    profile("AllGather",
+            all_gather_bus_factor(get_size()),
+            get_bytes(element_type, count) * max(get_size(), 1),
+            true,
+            [&]() { m_interface->all_gather(in, out, element_type, count); });
+}
+
+void distributed::ProfilingDistributedInterface::send(
+    const void* in, element::Type_t element_type, size_t count, int dest_rank, int tag)
+{
+    profile("Send", 1.0, get_bytes(element_type, count), false, [&]() {
+        m_interface->send(in, element_type, count, dest_rank, tag);
+    });
+}
+
+void distributed::ProfilingDistributedInterface::recv(
+    void* out, element::Type_t element_type, size_t count, int src_rank, int tag)
+{
+    profile("Recv", 1.0, get_bytes(element_type, count), false, [&]() {
+        m_interface->recv(out, element_type, count, src_rank, tag);
+    });
+}
+
+shared_ptr<DistributedRequest> distributed::ProfilingDistributedInterface::irecv(
+    void* out, element::Type_t element_type, size_t count, int src_rank, int tag)
+{
+    stopwatch timer;
+    timer.start();
+    auto request = m_interface->irecv(out, element_type, count, src_rank, tag);
+    return make_shared<ProfiledRequest>(
+        this, "Recv", 1.0, get_bytes(element_type, count), timer, request);
+}
@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ngraph/distributed.hpp"
+
+namespace ngraph
+{
+    namespace distributed
+    {
+        /// \brief Bytes and time of all the calls of one collective or point-to-point
+        ///        operation, see \sa ProfilingDistributedInterface
+        class CollectiveCounter
+        {
+        public:
+            CollectiveCounter(const std::string& name, double bus_factor)
+                : m_name(name)
+                , m_bus_factor(bus_factor)
+            {
+            }
+            const std::string& get_name() const { return m_name; }
+            size_t call_count() const { return m_call_count; }
+            uint64_t total_bytes() const { return m_total_bytes; }
+            /// Wall time of the calls, including the time waiting for the peers
+            size_t total_microseconds() const { return m_total_microseconds; }
+            /// Time blocked before the peers arrived at a blocking collective, or blocked in
+            /// DistributedRequest::wait for a non-blocking one. A large share on one process
+            /// points to a slow peer, in a non-blocking one to communication that is not
+            /// overlapped with compute.
+            size_t total_wait_microseconds() const { return m_total_wait_microseconds; }
+            /// Bus bandwidth over the time spent transferring, in GB/s: the bytes per second
+            /// scaled by the share of the data every link carries, 2 (n - 1) / n for an
+            /// all-reduce over n processes, so that it compares with the link bandwidth.
+            double bus_gbytes_per_second() const
+            {
+                size_t transfer_microseconds = m_total_microseconds - m_total_wait_microseconds;
+                return transfer_microseconds == 0
+                           ? 0
+                           : m_total_bytes * m_bus_factor / (transfer_microseconds * 1e3);
+            }
+
+            std::string m_name;
+            double m_bus_factor;
+            size_t m_call_count = 0;
+            uint64_t m_total_bytes = 0;
+            size_t m_total_microseconds = 0;
+            size_t m_total_wait_microseconds = 0;
+        };
+
+        /// \brief Forwards to another interface and records the bytes, wall time, wait time
+        ///        and bus bandwidth of every call, per operation. With event tracing enabled
+        ///        (see \sa Event) every call also adds a "Communication" event, and a separate
+        ///        "<op> wait" event for the time waiting for the peers, to the Chrome trace.
+        ///
+        /// To tell waiting from transferring, a blocking collective is preceded by a barrier
+        /// when measure_wait is set. That synchronizes the processes more than the collective
+        /// alone does. Point-to-point calls are never preceded by one.
+        ///
+        /// get_distributed_interface wraps the default interface in one when
+        /// NGRAPH_DISTRIBUTED_PROFILE is set.
+        class ProfilingDistributedInterface : public DistributedInterface
+        {
+        public:
+            ProfilingDistributedInterface(std::unique_ptr<DistributedInterface> interface,
+                                          bool measure_wait = true);
+
+            const std::string& get_name() const override { return m_interface->get_name(); }
+            int get_size() override { return m_interface->get_size(); }
+            int get_rank() override { return m_interface->get_rank(); }
+            void
+                all_reduce(void* in, void* out, element::Type_t element_type, size_t count) override;
+            std::shared_ptr<DistributedRequest> iall_reduce(void* in,
+                                                            void* out,
+                                                            element::Type_t element_type,
+                                                            size_t count) override;
+            void broadcast(void* in, element::Type_t element_type, size_t count) override;
+            void reduce_scatter(void* in,
+                                void* out,
+                                element::Type_t element_type,
+                                size_t count) override;
+            void
+                all_gather(void* in, void* out, element::Type_t element_type, size_t count) override;
+            void send(const void* in,
+                      element::Type_t element_type,
+                      size_t count,
+                      int dest_rank,
+                      int tag) override;
+            void recv(
+                void* out, element::Type_t element_type, size_t count, int src_rank, int tag) override;
+            std::shared_ptr<DistributedRequest> irecv(
+                void* out, element::Type_t element_type, size_t count, int src_rank, int tag) override;
+            void barrier() override { m_interface->barrier(); }
+
+            DistributedInterface* get_interface() const { return m_interface.get(); }
+            /// \brief The counters of the operations called so far, by name
+            std::vector<CollectiveCounter> get_counters() const;
+            void reset_counters();
+
+            // Adds a finished call to the counter of `name`, called by the requests of the
+            // non-blocking operations as well
+            void record(const std::string& name,
+                        double bus_factor,
+                        uint64_t bytes,
+                        size_t microseconds,
+                        size_t wait_microseconds);
+
+        private:
+            template <typename F>
+            void profile(const std::string& name,
+                         double bus_factor,
+                         uint64_t bytes,
+                         bool collective,
+                         F&& call);
+
+            std::unique_ptr<DistributedInterface> m_interface;
+            bool m_measure_wait;
+            mutable std::mutex m_mutex;
+            std::map<std::string, CollectiveCounter> m_counters;
+        };
+    }
+}
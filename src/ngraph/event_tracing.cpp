@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
 #include <iostream>
 #include <sstream>
 #include <string>
@@ -28,55 +31,374 @@ static bool read_tracing_env_var()
     return (std::getenv("NGRAPH_ENABLE_TRACING") != nullptr);
 }
 
-mutex ngraph::Event::s_file_mutex;
-ofstream ngraph::Event::s_event_log;
 bool ngraph::Event::s_tracing_enabled = read_tracing_env_var();
 
-void ngraph::Event::write_trace(const ngraph::Event& event)
+namespace
 {
-    if (is_tracing_enabled())
+    // Everything needed to serialize an Event later on the writer thread
+    struct TraceRecord
+    {
+        string name;
+        string category;
+        string args;
+        string tid;
+        int pid;
+        int64_t start_us;
+        int64_t stop_us;
+        TraceRecord* next;
+    };
+
+    // Events queued by one thread, newest first
+    struct ThreadBuffer
+    {
+        atomic<TraceRecord*> head{nullptr};
+        atomic<size_t> pending{0};
+    };
+
+    string format_record(const TraceRecord& record)
+    {
+        nlohmann::json json_start = {{"name", record.name},
+                                     {"cat", record.category},
+                                     {"ph", "B"},
+                                     {"pid", record.pid},
+                                     {"tid", record.tid},
+                                     {"ts", record.start_us},
+                                     {"args", record.args}};
+        nlohmann::json json_end = {{"name", record.name},
+                                   {"cat", record.category},
+                                   {"ph", "E"},
+                                   {"pid", record.pid},
+                                   {"tid", record.tid},
+                                   {"ts", record.stop_us},
+                                   {"args", record.args}};
+        ostringstream output;
+        output << json_start << ",\n" << json_end;
+        return output.str();
+    }
+
+    const string& current_thread_id()
+    {
+        static thread_local string tid;
+        if (tid.empty())
+        {
+            ostringstream thread_id;
+            thread_id << this_thread::get_id();
+            tid = thread_id.str();
+        }
+        return tid;
+    }
+
+    class TraceWriter
     {
-        lock_guard<mutex> lock(s_file_mutex);
+    public:
+        static TraceWriter& get()
+        {
+            static TraceWriter writer;
+            return writer;
+        }
+
+        ~TraceWriter() { close(); }
+        void push(TraceRecord* record)
+        {
+            if (!m_running.load(memory_order_acquire))
+            {
+                start_thread();
+            }
+            ThreadBuffer& buffer = local_buffer();
+            record->next = buffer.head.load(memory_order_relaxed);
+            while (!buffer.head.compare_exchange_weak(
+                record->next, record, memory_order_release, memory_order_relaxed))
+            {
+            }
+            if (buffer.pending.fetch_add(1, memory_order_relaxed) + 1 == s_wake_threshold)
+            {
+                lock_guard<mutex> lock(m_thread_mutex);
+                m_wake = true;
+                m_condition.notify_one();
+            }
+        }
+
+        void flush()
+        {
+            lock_guard<mutex> lock(m_sink_mutex);
+            drain();
+            if (m_sink)
+            {
+                m_sink->flush();
+            }
+        }
+
+        void close()
+        {
+            {
+                unique_lock<mutex> lock(m_thread_mutex);
+                if (m_thread.joinable())
+                {
+                    m_stop = true;
+                    m_condition.notify_one();
+                    lock.unlock();
+                    m_thread.join();
+                    lock.lock();
+                    m_stop = false;
+                }
+                m_running.store(false, memory_order_release);
+            }
+            lock_guard<mutex> lock(m_sink_mutex);
+            drain();
+            if (m_sink)
+            {
+                m_sink->flush();
+                m_sink->close();
+                m_sink.reset();
+            }
+        }
+
+        void set_sink(const shared_ptr<ngraph::EventSink>& sink)
+        {
+            lock_guard<mutex> lock(m_sink_mutex);
+            if (m_sink)
+            {
+                drain();
+                m_sink->flush();
+                m_sink->close();
+            }
+            m_sink = sink;
+        }
+
+        shared_ptr<ngraph::EventSink> get_sink()
+        {
+            lock_guard<mutex> lock(m_sink_mutex);
+            return m_sink;
+        }
+
+    private:
+        TraceWriter()
+            : m_stop(false)
+            , m_wake(false)
+            , m_running(false)
+        {
+        }
+
+        ThreadBuffer& local_buffer()
+        {
+            // The registry shares ownership so events queued just before a thread exits are
+            // still written
+            static thread_local shared_ptr<ThreadBuffer> buffer;
+            if (!buffer)
+            {
+                buffer = make_shared<ThreadBuffer>();
+                lock_guard<mutex> lock(m_registry_mutex);
+                m_buffers.push_back(buffer);
+            }
+            return *buffer;
+        }
+
+        void start_thread()
+        {
+            lock_guard<mutex> lock(m_thread_mutex);
+            if (!m_thread.joinable())
+            {
+                m_thread = thread(&TraceWriter::run, this);
+            }
+            m_running.store(true, memory_order_release);
+        }
 
-        static bool so_initialized = false;
-        if (!so_initialized)
+        void run()
         {
-            // Open the file
-            s_event_log.open("ngraph_event_trace.json", ios_base::trunc);
-            s_event_log << "[\n";
-            so_initialized = true;
+            unique_lock<mutex> lock(m_thread_mutex);
+            while (!m_stop)
+            {
+                m_condition.wait_for(
+                    lock, chrono::milliseconds(100), [this] { return m_stop || m_wake; });
+                m_wake = false;
+                lock.unlock();
+                {
+                    lock_guard<mutex> sink_lock(m_sink_mutex);
+                    drain();
+                }
+                lock.lock();
+            }
         }
-        else
+
+        // Requires m_sink_mutex
+        void drain()
         {
-            s_event_log << ",\n";
+            vector<shared_ptr<ThreadBuffer>> buffers;
+            {
+                lock_guard<mutex> lock(m_registry_mutex);
+                buffers = m_buffers;
+            }
+            for (auto& buffer : buffers)
+            {
+                TraceRecord* record = buffer->head.exchange(nullptr, memory_order_acquire);
+                if (record == nullptr)
+                {
+                    continue;
+                }
+                buffer->pending.store(0, memory_order_relaxed);
+
+                // Restore the order the events were written in
+                TraceRecord* ordered = nullptr;
+                while (record != nullptr)
+                {
+                    TraceRecord* next = record->next;
+                    record->next = ordered;
+                    ordered = record;
+                    record = next;
+                }
+                if (!m_sink)
+                {
+                    m_sink = make_shared<ngraph::FileEventSink>("ngraph_event_trace.json");
+                }
+                while (ordered != nullptr)
+                {
+                    TraceRecord* next = ordered->next;
+                    m_sink->write(format_record(*ordered));
+                    delete ordered;
+                    ordered = next;
+                }
+            }
+
+            // Forget threads that have exited
+            lock_guard<mutex> lock(m_registry_mutex);
+            for (auto it = m_buffers.begin(); it != m_buffers.end();)
+            {
+                if (it->use_count() == 1 && (*it)->head.load(memory_order_acquire) == nullptr)
+                {
+                    it = m_buffers.erase(it);
+                }
+                else
+                {
+                    ++it;
+                }
+            }
         }
 
-        s_event_log << event.to_json() << "\n" << flush;
+        static const size_t s_wake_threshold = 4096;
+
+        mutex m_registry_mutex;
+        vector<shared_ptr<ThreadBuffer>> m_buffers;
+
+        mutex m_sink_mutex;
+        shared_ptr<ngraph::EventSink> m_sink;
+
+        mutex m_thread_mutex;
+        condition_variable m_condition;
+        thread m_thread;
+        bool m_stop;
+        bool m_wake;
+        atomic<bool> m_running;
+    };
+}
+
+ngraph::FileEventSink::FileEventSink(const string& path)
+    : m_path(path)
+    , m_empty(true)
+{
+}
+
+ngraph::FileEventSink::~FileEventSink()
+{
+    close();
+}
+
+void ngraph::FileEventSink::write(const string& json)
+{
+    if (m_empty)
+    {
+        m_stream.open(m_path, ios_base::trunc);
+        m_stream << "[\n";
+        m_empty = false;
+    }
+    else
+    {
+        m_stream << ",\n";
+    }
+    m_stream << json;
+}
+
+void ngraph::FileEventSink::flush()
+{
+    if (m_stream.is_open())
+    {
+        m_stream.flush();
+    }
+}
+
+void ngraph::FileEventSink::close()
+{
+    if (m_stream.is_open())
+    {
+        m_stream << "\n]\n";
+        m_stream.close();
+    }
+}
+
+void ngraph::MemoryEventSink::write(const string& json)
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_events.push_back(json);
+}
+
+vector<string> ngraph::MemoryEventSink::get_events() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_events;
+}
+
+void ngraph::MemoryEventSink::clear()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_events.clear();
+}
+
+void ngraph::Event::write_trace(const ngraph::Event& event)
+{
+    if (is_tracing_enabled())
+    {
+        TraceRecord* record = new TraceRecord{event.m_name,
+                                              event.m_category,
+                                              event.m_args,
+                                              current_thread_id(),
+                                              event.m_pid,
+                                              event.m_start.time_since_epoch().count() / 1000,
+                                              event.m_stop.time_since_epoch().count() / 1000,
+                                              nullptr};
+        TraceWriter::get().push(record);
     }
 }
 
 string ngraph::Event::to_json() const
 {
-    ostringstream thread_id;
-    thread_id << this_thread::get_id();
-
-    nlohmann::json json_start = {{"name", m_name},
-                                 {"cat", m_category},
-                                 {"ph", "B"},
-                                 {"pid", m_pid},
-                                 {"tid", thread_id.str()},
-                                 {"ts", m_start.time_since_epoch().count() / 1000},
-                                 {"args", m_args}};
-    nlohmann::json json_end = {{"name", m_name},
-                               {"cat", m_category},
-                               {"ph", "E"},
-                               {"pid", m_pid},
-                               {"tid", thread_id.str()},
-                               {"ts", m_stop.time_since_epoch().count() / 1000},
-                               {"args", m_args}};
-    ostringstream output;
-    output << json_start << ",\n" << json_end;
-    return output.str();
+    TraceRecord record{m_name,
+                       m_category,
+                       m_args,
+                       current_thread_id(),
+                       m_pid,
+                       m_start.time_since_epoch().count() / 1000,
+                       m_stop.time_since_epoch().count() / 1000,
+                       nullptr};
+    return format_record(record);
+}
+
+void ngraph::Event::set_sink(const shared_ptr<EventSink>& sink)
+{
+    TraceWriter::get().set_sink(sink);
+}
+
+shared_ptr<ngraph::EventSink> ngraph::Event::get_sink()
+{
+    return TraceWriter::get().get_sink();
+}
+
+void ngraph::Event::flush()
+{
+    TraceWriter::get().flush();
+}
+
+void ngraph::Event::close()
+{
+    TraceWriter::get().close();
 }
 
 void ngraph::Event::enable_event_tracing()
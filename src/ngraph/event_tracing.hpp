@@ -18,10 +18,13 @@
 
 #include <chrono>
 #include <fstream>
+#include <functional>
 #include <iostream>
+#include <memory>
 #include <mutex>
 #include <string>
 #include <thread>
+#include <vector>
 #ifdef _WIN32
 #include <windows.h>
 // windows.h must be before processthreadsapi.h so we need this comment
@@ -63,6 +66,69 @@ namespace ngraph
     //
     // More information about this is at:
     // http://dev.chromium.org/developers/how-tos/trace-event-profiling-tool
+    //
+    // Event::write_trace only queues the event on a per-thread lock-free list. A background
+    // writer drains the lists every 100ms into the current EventSink, which defaults to a
+    // FileEventSink writing ngraph_event_trace.json. Event::flush forces a drain and
+    // Event::close also closes the sink.
+
+    /// \brief Destination for serialized trace events. A sink is only ever called from one
+    ///        thread at a time, either the background writer or a caller of Event::flush,
+    ///        Event::close or Event::set_sink.
+    class EventSink
+    {
+    public:
+        virtual ~EventSink() {}
+        /// \param json The B and E chrome trace events of one Event, comma separated
+        virtual void write(const std::string& json) = 0;
+        virtual void flush() {}
+        virtual void close() {}
+    };
+
+    /// \brief Writes events as a JSON array to a file. The file is truncated on the first
+    ///        write and the array is terminated on close.
+    class FileEventSink : public EventSink
+    {
+    public:
+        explicit FileEventSink(const std::string& path);
+        ~FileEventSink() override;
+
+        void write(const std::string& json) override;
+        void flush() override;
+        void close() override;
+
+    private:
+        std::string m_path;
+        std::ofstream m_stream;
+        bool m_empty;
+    };
+
+    /// \brief Hands each serialized event to a user callback
+    class CallbackEventSink : public EventSink
+    {
+    public:
+        explicit CallbackEventSink(const std::function<void(const std::string&)>& callback)
+            : m_callback(callback)
+        {
+        }
+
+        void write(const std::string& json) override { m_callback(json); }
+    private:
+        std::function<void(const std::string&)> m_callback;
+    };
+
+    /// \brief Keeps serialized events in memory, mostly useful for tests and tools
+    class MemoryEventSink : public EventSink
+    {
+    public:
+        void write(const std::string& json) override;
+        std::vector<std::string> get_events() const;
+        void clear();
+
+    private:
+        mutable std::mutex m_mutex;
+        std::vector<std::string> m_events;
+    };
 
     class Event
     {
@@ -90,12 +156,23 @@ namespace ngraph
             m_stop = std::chrono::high_resolution_clock::now();
         }
 
+        void set_args(const std::string& args) { m_args = args; }
         static void write_trace(const Event& event);
         static bool is_tracing_enabled() { return s_tracing_enabled; }
         static void enable_event_tracing();
         static void disable_event_tracing();
         std::string to_json() const;
 
+        /// \brief Replace the sink events are written to. Events already queued are written
+        ///        to the previous sink, which is then flushed and closed.
+        static void set_sink(const std::shared_ptr<EventSink>& sink);
+        static std::shared_ptr<EventSink> get_sink();
+        /// \brief Write all queued events to the sink and flush it
+        static void flush();
+        /// \brief Write all queued events, close the sink and stop the background writer. A
+        ///        later write_trace starts over with a new default file sink.
+        static void close();
+
         Event(const Event&) = delete;
         Event& operator=(Event const&) = delete;
 
@@ -108,8 +185,6 @@ namespace ngraph
         std::string m_category;
         std::string m_args;
 
-        static std::mutex s_file_mutex;
-        static std::ofstream s_event_log;
         static bool s_tracing_enabled;
     };
 
@@ -14,10 +14,16 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
 #include <functional>
 #include <set>
+#include <thread>
+#include <vector>
 
 #include "graph.hpp"
+#include "ngraph/provenance.hpp"
 #include "node.hpp"
 
 namespace ngraph
@@ -57,6 +63,84 @@ namespace ngraph
                 std::string domain = get_node_domain(node_proto);
                 return (domain.empty() ? "" : domain + ".") + node_proto.op_type();
             }
+
+            /// \brief      Calls f(0) .. f(count - 1) spread over the hardware threads.
+            ///
+            /// \note       If calls throw, the exception of the lowest index is rethrown, the
+            ///             same one a sequential loop would have thrown.
+            static void parallel_for(std::size_t count, const std::function<void(std::size_t)>& f)
+            {
+                std::size_t thread_count = std::min<std::size_t>(
+                    std::max(1u, std::thread::hardware_concurrency()), count);
+                std::vector<std::exception_ptr> errors(count);
+                std::atomic<std::size_t> next{0};
+                auto work = [&]() {
+                    for (std::size_t index = next++; index < count; index = next++)
+                    {
+                        try
+                        {
+                            f(index);
+                        }
+                        catch (...)
+                        {
+                            errors[index] = std::current_exception();
+                        }
+                    }
+                };
+                std::vector<std::thread> threads;
+                for (std::size_t t = 1; t < thread_count; ++t)
+                {
+                    threads.emplace_back(work);
+                }
+                work();
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+                for (const auto& error : errors)
+                {
+                    if (error)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+            }
+
+            /// \brief      Tags the nGraph nodes made for an ONNX node with its description, so
+            ///             that the tags can follow them through fusion and into performance
+            ///             data.
+            ///
+            /// \param[in]  node      The ONNX node.
+            /// \param[in]  ng_nodes  The outputs of the nGraph subgraph made for it.
+            ///
+            /// \note       The subgraph is everything above the outputs that is not above an
+            ///             input of the node. Nodes tagged by an earlier ONNX node are left as
+            ///             they are, as are parameters and constants, which several ONNX nodes
+            ///             may share.
+            static void add_provenance_tags(const Node& node, const NodeVector& ng_nodes)
+            {
+                std::set<std::shared_ptr<ngraph::Node>> visited;
+                for (const auto& input : node.get_ng_inputs())
+                {
+                    visited.insert(input);
+                }
+                NodeVector stack{ng_nodes};
+                while (!stack.empty())
+                {
+                    std::shared_ptr<ngraph::Node> ng_node = stack.back();
+                    stack.pop_back();
+                    if (!visited.insert(ng_node).second || ng_node->is_parameter() ||
+                        ng_node->is_constant() || !ng_node->get_provenance_tags().empty())
+                    {
+                        continue;
+                    }
+                    ng_node->add_provenance_tag(node.get_description());
+                    for (const auto& argument : ng_node->get_arguments())
+                    {
+                        stack.push_back(argument);
+                    }
+                }
+            }
         } // namespace detail
 
         Graph::Graph(const onnx::GraphProto& graph_proto, Model& model, const Weights& weights)
@@ -64,18 +148,32 @@ namespace ngraph
             , m_model{&model}
         {
             // Process all initializers in the graph
+            std::vector<Tensor> initializers;
             for (const auto& initializer_tensor : m_graph_proto->initializer())
             {
                 if (initializer_tensor.has_name())
                 {
-                    Tensor tensor = Tensor{initializer_tensor};
-                    m_initializers.emplace(initializer_tensor.name(), tensor);
-
-                    // For each initializer, create a Constant node and store in cache
-                    m_ng_node_cache.emplace(initializer_tensor.name(), tensor.get_ng_constant());
+                    initializers.emplace_back(initializer_tensor, m_model->get_model_proto_owner());
+                    m_initializers.emplace(initializer_tensor.name(), initializers.back());
                 }
             }
 
+            // Decoding the initializer data dominates the import of large models and is done
+            // in parallel. The Constant nodes are then created in order, so that node names
+            // do not depend on thread timing.
+            std::vector<std::unique_ptr<runtime::AlignedBuffer>> initializer_data(
+                initializers.size());
+            detail::parallel_for(initializers.size(), [&](std::size_t index) {
+                initializer_data[index] = initializers[index].get_ng_constant_data();
+            });
+            for (std::size_t index = 0; index < initializers.size(); ++index)
+            {
+                // For each initializer, create a Constant node and store in cache
+                m_ng_node_cache.emplace(
+                    initializers[index].get_name(),
+                    initializers[index].get_ng_constant(std::move(initializer_data[index])));
+            }
+
             // Process all ONNX graph inputs, convert them to nGraph nodes and store in cache
             for (const auto& input : m_graph_proto->input())
             {
@@ -128,6 +226,20 @@ namespace ngraph
                          "nGraph does not support the following ONNX operations: ",
                          detail::to_string(unknown_operators));
 
+            // Count the uses of every value, so that converters know when they can fuse a node
+            // into the one producing its input
+            for (const auto& node_proto : m_graph_proto->node())
+            {
+                for (const auto& name : node_proto.input())
+                {
+                    ++m_consumer_counts[name];
+                }
+            }
+            for (const auto& output : m_outputs)
+            {
+                ++m_consumer_counts[output.get_name()];
+            }
+
             // Process ONNX graph nodes, convert to nGraph nodes
             for (const auto& node_proto : m_graph_proto->node())
             {
@@ -135,6 +247,10 @@ namespace ngraph
                 const Node& node{m_nodes.back()};
 
                 NodeVector ng_nodes{node.get_ng_nodes()};
+                if (get_provenance_enabled())
+                {
+                    detail::add_provenance_tags(node, ng_nodes);
+                }
                 // Iterate over the number of outputs for given node in graph.
                 // Some of them may be optional and trimmed. See:
                 // https://github.com/onnx/onnx/blob/master/docs/IR.md#optional-inputs-and-outputs
@@ -155,6 +271,12 @@ namespace ngraph
             return results;
         }
 
+        std::size_t Graph::get_consumer_count(const std::string& name) const
+        {
+            auto it = m_consumer_counts.find(name);
+            return it == std::end(m_consumer_counts) ? 0 : it->second;
+        }
+
     } // namespace onnx_import
 
 } // namespace ngraph
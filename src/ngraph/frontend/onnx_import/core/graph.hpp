@@ -45,6 +45,9 @@ namespace ngraph
                 return m_ng_node_cache.at(name);
             }
 
+            /// \brief The number of node inputs and graph outputs that use the named value
+            std::size_t get_consumer_count(const std::string& name) const;
+
             const std::string& get_name() const { return m_graph_proto->name(); }
             NodeVector make_ng_nodes(const Node& node) const
             {
@@ -59,6 +62,7 @@ namespace ngraph
             ParameterVector m_parameters;
             std::map<std::string, std::shared_ptr<ngraph::Node>> m_ng_node_cache;
             std::map<std::string, Tensor> m_initializers;
+            std::map<std::string, std::size_t> m_consumer_counts;
             Model* m_model;
         };
 
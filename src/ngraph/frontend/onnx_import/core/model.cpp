@@ -45,6 +45,12 @@ namespace ngraph
             }
         }
 
+        Model::Model(const std::shared_ptr<onnx::ModelProto>& model_proto)
+            : Model{*model_proto}
+        {
+            m_model_proto_owner = model_proto;
+        }
+
         const Operator& Model::get_operator(const std::string& name,
                                             const std::string& domain) const
         {
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <onnx-ml.pb.h>
 #include <ostream>
 #include <string>
@@ -33,6 +34,10 @@ namespace ngraph
             Model() = delete;
             explicit Model(const onnx::ModelProto& model_proto);
 
+            /// \brief Model that shares ownership of the protobuf, so that constants can
+            ///        refer to the initializer data in it instead of copying it.
+            explicit Model(const std::shared_ptr<onnx::ModelProto>& model_proto);
+
             Model(const Model&) = default;
             Model(Model&&) = default;
 
@@ -42,6 +47,12 @@ namespace ngraph
             const std::string& get_producer_name() const { return m_model_proto->producer_name(); }
             const onnx::GraphProto& get_graph() const { return m_model_proto->graph(); }
             std::int64_t get_model_version() const { return m_model_proto->model_version(); }
+            /// \brief The owner of the protobuf, nullptr if it is not shared
+            const std::shared_ptr<onnx::ModelProto>& get_model_proto_owner() const
+            {
+                return m_model_proto_owner;
+            }
+
             const std::string& get_producer_version() const
             {
                 return m_model_proto->producer_version();
@@ -72,6 +83,7 @@ namespace ngraph
 
         private:
             const onnx::ModelProto* m_model_proto;
+            std::shared_ptr<onnx::ModelProto> m_model_proto_owner;
             std::unordered_map<std::string, OperatorSet> m_opset;
         };
 
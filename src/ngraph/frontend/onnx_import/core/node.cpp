@@ -42,6 +42,7 @@ namespace ngraph
             const std::vector<Attribute>& attributes() const;
             NodeVector get_ng_nodes(const Node& node) const;
             NodeVector get_ng_inputs() const;
+            bool is_sole_consumer_of_input(std::size_t index) const;
 
             const std::string& domain() const;
             const std::string& op_type() const;
@@ -137,6 +138,11 @@ namespace ngraph
             return result;
         }
 
+        bool Node::Impl::is_sole_consumer_of_input(std::size_t index) const
+        {
+            return m_graph->get_consumer_count(m_node_proto->input(index)) == 1;
+        }
+
         const std::string& Node::Impl::description() const
         {
             if (m_description.empty())
@@ -174,6 +180,11 @@ namespace ngraph
 
         NodeVector Node::get_ng_inputs() const { return m_pimpl->get_ng_inputs(); }
         NodeVector Node::get_ng_nodes() const { return m_pimpl->get_ng_nodes(*this); }
+        bool Node::is_sole_consumer_of_input(std::size_t index) const
+        {
+            return m_pimpl->is_sole_consumer_of_input(index);
+        }
+
         const std::string& Node::domain() const { return m_pimpl->domain(); }
         const std::string& Node::op_type() const { return m_pimpl->op_type(); }
         const std::string& Node::get_description() const { return m_pimpl->description(); }
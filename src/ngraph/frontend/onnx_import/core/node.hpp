@@ -65,6 +65,9 @@ namespace ngraph
 
             NodeVector get_ng_inputs() const;
             NodeVector get_ng_nodes() const;
+            /// \brief Whether this node is the only user of its input, so that the node
+            ///        producing the input may be fused into this one
+            bool is_sole_consumer_of_input(std::size_t index) const;
             const std::string& domain() const;
             const std::string& op_type() const;
             const std::string& get_name() const;
@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <cstdint>
+#include <memory>
 #include <onnx-ml.pb.h>
+#include <string>
 #include <utility>
 #include <vector>
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 
@@ -91,6 +95,15 @@ namespace ngraph
                     }
                 };
 
+                struct invalid_data_size : ngraph_error
+                {
+                    invalid_data_size(std::size_t size, std::size_t expected)
+                        : ngraph_error{"tensor holds " + std::to_string(size) +
+                                       " values, expected " + std::to_string(expected)}
+                    {
+                    }
+                };
+
             } // namespace tensor
 
         } // namespace error
@@ -321,9 +334,14 @@ namespace ngraph
             };
 
             Tensor() = delete;
-            explicit Tensor(const onnx::TensorProto& tensor)
+            /// \param tensor  the tensor protobuf.
+            /// \param owner   if set, keeps the protobuf alive; constants made from the
+            ///                tensor then use its raw data in place instead of copying it.
+            explicit Tensor(const onnx::TensorProto& tensor,
+                            const std::shared_ptr<onnx::ModelProto>& owner = nullptr)
                 : m_tensor_proto{&tensor}
                 , m_shape{std::begin(tensor.dims()), std::end(tensor.dims())}
+                , m_owner{owner}
             {
             }
 
@@ -390,45 +408,106 @@ namespace ngraph
 
             operator TensorProto_DataType() const { return m_tensor_proto->data_type(); }
             std::shared_ptr<ngraph::op::Constant> get_ng_constant() const
+            {
+                auto data = get_ng_constant_data();
+                return get_ng_constant(std::move(data));
+            }
+
+            /// \brief Makes a Constant that takes over data from get_ng_constant_data()
+            std::shared_ptr<ngraph::op::Constant>
+                get_ng_constant(std::unique_ptr<runtime::AlignedBuffer> data) const
+            {
+                return std::make_shared<ngraph::op::Constant>(
+                    get_ng_type(), m_shape, std::move(data));
+            }
+
+            /// \brief Decodes the tensor values in the layout of get_ng_type() without making a
+            ///        node, so tensors can be decoded on several threads at once.
+            std::unique_ptr<runtime::AlignedBuffer> get_ng_constant_data() const
             {
                 switch (m_tensor_proto->data_type())
                 {
                 case onnx::TensorProto_DataType::TensorProto_DataType_BOOL:
-                    return make_ng_constant<bool>(element::boolean);
+                    return make_ng_constant_data<bool>(element::boolean);
                 case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT:
                 case onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16:
-                    return make_ng_constant<float>(element::f32);
+                    return make_ng_constant_data<float>(element::f32);
                 case onnx::TensorProto_DataType::TensorProto_DataType_DOUBLE:
-                    return make_ng_constant<double>(element::f64);
+                    return make_ng_constant_data<double>(element::f64);
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT8:
-                    return make_ng_constant<int8_t>(element::i8);
+                    return make_ng_constant_data<int8_t>(element::i8);
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT16:
-                    return make_ng_constant<int16_t>(element::i16);
+                    return make_ng_constant_data<int16_t>(element::i16);
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT32:
-                    return make_ng_constant<int32_t>(element::i32);
+                    return make_ng_constant_data<int32_t>(element::i32);
                 case onnx::TensorProto_DataType::TensorProto_DataType_INT64:
-                    return make_ng_constant<int64_t>(element::i64);
+                    return make_ng_constant_data<int64_t>(element::i64);
                 case onnx::TensorProto_DataType::TensorProto_DataType_UINT8:
-                    return make_ng_constant<uint8_t>(element::u8);
+                    return make_ng_constant_data<uint8_t>(element::u8);
                 case onnx::TensorProto_DataType::TensorProto_DataType_UINT16:
-                    return make_ng_constant<uint16_t>(element::u16);
+                    return make_ng_constant_data<uint16_t>(element::u16);
                 case onnx::TensorProto_DataType::TensorProto_DataType_UINT32:
-                    return make_ng_constant<uint32_t>(element::u32);
+                    return make_ng_constant_data<uint32_t>(element::u32);
                 case onnx::TensorProto_DataType::TensorProto_DataType_UINT64:
-                    return make_ng_constant<uint64_t>(element::u64);
+                    return make_ng_constant_data<uint64_t>(element::u64);
                 default: throw error::tensor::unsupported_data_type{m_tensor_proto->data_type()};
                 }
             }
 
         private:
             template <typename T>
-            std::shared_ptr<ngraph::op::Constant> make_ng_constant(const element::Type& type) const
+            std::unique_ptr<runtime::AlignedBuffer>
+                make_ng_constant_data(const element::Type& type) const
+            {
+                if (is_raw_data_usable(type))
+                {
+                    const std::string& raw_data = m_tensor_proto->raw_data();
+                    return std::unique_ptr<runtime::AlignedBuffer>{new runtime::AlignedBuffer{
+                        const_cast<char*>(raw_data.data()), raw_data.size(), m_owner}};
+                }
+                std::vector<T> values = get_data<T>();
+                std::size_t count = shape_size(m_shape);
+                // as with op::Constant, a single value fills the whole tensor
+                if ((values.size() != 1) && (values.size() != count))
+                {
+                    throw error::tensor::invalid_data_size{values.size(), count};
+                }
+                // the alignment op::Constant allocates with
+                std::unique_ptr<runtime::AlignedBuffer> data{
+                    new runtime::AlignedBuffer{count * type.size(), 64}};
+                write_values(data->get_ptr(), values, count);
+                return data;
+            }
+
+            template <typename T>
+            static void write_values(void* data, const std::vector<T>& values, std::size_t count)
             {
-                return std::make_shared<ngraph::op::Constant>(type, m_shape, get_data<T>());
+                T* target = static_cast<T*>(data);
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    target[i] = values[values.size() == 1 ? 0 : i];
+                }
+            }
+
+            // Raw data can back a constant directly if it is already laid out as the element
+            // type, which is not the case for float16 as that is imported as f32
+            bool is_raw_data_usable(const element::Type& type) const
+            {
+                if ((m_owner == nullptr) || !m_tensor_proto->has_raw_data() ||
+                    m_tensor_proto->has_segment() ||
+                    (m_tensor_proto->data_type() ==
+                     onnx::TensorProto_DataType::TensorProto_DataType_FLOAT16))
+                {
+                    return false;
+                }
+                const std::string& raw_data = m_tensor_proto->raw_data();
+                return (raw_data.size() == shape_size(m_shape) * type.size()) &&
+                       (reinterpret_cast<std::uintptr_t>(raw_data.data()) % type.size() == 0);
             }
 
             const onnx::TensorProto* m_tensor_proto;
             Shape m_shape;
+            std::shared_ptr<onnx::ModelProto> m_owner;
         };
 
         inline std::ostream& operator<<(std::ostream& outs, const Tensor& tensor)
@@ -55,23 +55,24 @@ namespace ngraph
 
         std::shared_ptr<Function> import_onnx_model(std::istream& sin, const Weights& weights)
         {
-            onnx::ModelProto model_proto;
+            // Constants refer to the initializer data in the protobuf, which they keep alive
+            auto model_proto = std::make_shared<onnx::ModelProto>();
             // Try parsing input as a binary protobuf message
-            if (!model_proto.ParseFromIstream(&sin))
+            if (!model_proto->ParseFromIstream(&sin))
             {
                 // Rewind to the beginning and clear stream state.
                 sin.clear();
                 sin.seekg(0);
                 google::protobuf::io::IstreamInputStream iistream(&sin);
                 // Try parsing input as a prototxt message
-                if (!google::protobuf::TextFormat::Parse(&iistream, &model_proto))
+                if (!google::protobuf::TextFormat::Parse(&iistream, model_proto.get()))
                 {
                     throw detail::error::stream_parse{sin};
                 }
             }
 
             Model model{model_proto};
-            Graph graph{model_proto.graph(), model, weights};
+            Graph graph{model_proto->graph(), model, weights};
             auto function = std::make_shared<Function>(
                 graph.get_ng_outputs(), graph.get_ng_parameters(), graph.get_name());
             for (std::size_t i{0}; i < function->get_output_size(); ++i)
@@ -25,6 +25,7 @@
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/util/broadcasting.hpp"
 #include "op/conv.hpp"
@@ -129,6 +130,21 @@ namespace ngraph
                     const auto& padding_below = paddings.first;
                     const auto& padding_above = paddings.second;
 
+                    // A single group convolution with bias becomes the fused ConvolutionBias,
+                    // which backends without a kernel for it decompose
+                    if (inputs.size() > 2 && groups == 1)
+                    {
+                        return {std::make_shared<ngraph::op::ConvolutionBias>(
+                            data,
+                            filters,
+                            inputs.at(2),
+                            strides,
+                            dilations,
+                            padding_below,
+                            padding_above,
+                            Strides(strides.size(), 1))};
+                    }
+
                     auto conv_node = make_ng_convolution(
                         data, filters, strides, dilations, padding_below, padding_above, groups);
 
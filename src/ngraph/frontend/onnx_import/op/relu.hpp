@@ -18,6 +18,7 @@
 
 #include "core/node.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/relu.hpp"
 
 namespace ngraph
@@ -31,6 +32,22 @@ namespace ngraph
                 inline NodeVector relu(const Node& node)
                 {
                     NodeVector ng_inputs{node.get_ng_inputs()};
+                    // Conv with bias followed by Relu becomes one ConvolutionBias with relu
+                    auto conv_bias =
+                        std::dynamic_pointer_cast<ngraph::op::ConvolutionBias>(ng_inputs.at(0));
+                    if (conv_bias && !conv_bias->with_relu() && node.is_sole_consumer_of_input(0))
+                    {
+                        return {std::make_shared<ngraph::op::ConvolutionBias>(
+                            conv_bias->get_data_batch(),
+                            conv_bias->get_filters(),
+                            conv_bias->get_bias(),
+                            conv_bias->get_window_movement_strides(),
+                            conv_bias->get_window_dilation_strides(),
+                            conv_bias->get_padding_below(),
+                            conv_bias->get_padding_above(),
+                            conv_bias->get_data_dilation_strides(),
+                            true)};
+                    }
                     return {std::make_shared<ngraph::op::Relu>(ng_inputs.at(0))};
                 }
 
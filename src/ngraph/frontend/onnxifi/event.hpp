@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <condition_variable> // std::condition_variable
+#include <mutex>              // std::mutex, std::unique_lock
+
+#include "exceptions.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief ONNXIFI event, a one-shot flag other threads can wait on
+        class Event
+        {
+        public:
+            Event(const Event&) = delete;
+            Event& operator=(const Event&) = delete;
+
+            Event(Event&&) = delete;
+            Event& operator=(Event&&) = delete;
+
+            Event() = default;
+
+            /// \brief Wakes up all waiters. An event can be signalled only once.
+            void signal()
+            {
+                {
+                    std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                    if (m_signalled)
+                    {
+                        throw status::invalid_state{};
+                    }
+                    m_signalled = true;
+                }
+                m_condition.notify_all();
+            }
+
+            /// \brief Blocks until the event is signalled
+            void wait() const
+            {
+                std::unique_lock<decltype(m_mutex)> lock{m_mutex};
+                m_condition.wait(lock, [this] { return m_signalled; });
+            }
+
+            bool is_signalled() const
+            {
+                std::lock_guard<decltype(m_mutex)> lock{m_mutex};
+                return m_signalled;
+            }
+
+        private:
+            mutable std::mutex m_mutex{};
+            mutable std::condition_variable m_condition{};
+            bool m_signalled{false};
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -0,0 +1,243 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <future>  // std::async
+#include <sstream> // std::istringstream
+#include <string>  // std::string
+#include <utility> // std::move
+
+#include "event.hpp"
+#include "exceptions.hpp"
+#include "graph.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/frontend/onnx_import/onnx.hpp"
+#include "span.hpp"
+#include "tensor.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        namespace
+        {
+            // ONNXIFI tensors without dimensions are scalars stored as a single value
+            bool is_compatible(const Tensor& tensor, const Shape& shape)
+            {
+                return (tensor.get_shape() == shape) || (shape.empty() && (tensor.size() == 1));
+            }
+
+            // Wraps the caller buffers of the descriptors in nGraph tensors, in the order of
+            // the given names
+            template <typename T>
+            std::vector<std::shared_ptr<runtime::Tensor>>
+                bind_tensors(const Backend& backend,
+                     const std::vector<std::shared_ptr<T>>& nodes,
+                     const Span<::onnxTensorDescriptorV1>& descriptors)
+            {
+                if (descriptors.size() != nodes.size())
+                {
+                    throw status::invalid_size{};
+                }
+                std::vector<std::shared_ptr<runtime::Tensor>> tensors(nodes.size());
+                for (const auto& descriptor : descriptors)
+                {
+                    Tensor tensor{descriptor};
+                    std::size_t index{0};
+                    while ((index < nodes.size()) &&
+                           (nodes[index]->get_friendly_name() != tensor.get_name()))
+                    {
+                        ++index;
+                    }
+                    if (index == nodes.size())
+                    {
+                        throw status::unidentified_name{};
+                    }
+                    const auto& node = nodes[index];
+                    if (tensor.get_element_type() != node->get_element_type())
+                    {
+                        throw status::mismatching_datatype{};
+                    }
+                    if (!is_compatible(tensor, node->get_shape()))
+                    {
+                        throw status::mismatching_shape{};
+                    }
+                    tensors[index] =
+                        backend.create_tensor(node->get_element_type(),
+                                              node->get_shape(),
+                                              reinterpret_cast<void*>(descriptor.buffer));
+                }
+                for (const auto& tensor : tensors)
+                {
+                    if (tensor == nullptr)
+                    {
+                        // the same name was given twice
+                        throw status::invalid_name{};
+                    }
+                }
+                return tensors;
+            }
+
+            void check_fence(const ::onnxMemoryFenceV1& fence)
+            {
+                if (fence.tag != ONNXIFI_TAG_MEMORY_FENCE_V1)
+                {
+                    throw status::unsupported_tag{};
+                }
+                if ((fence.type != ONNXIFI_SYNCHRONIZATION_EVENT) &&
+                    (fence.type != ONNXIFI_SYNCHRONIZATION_IMPLICIT))
+                {
+                    throw status::unsupported_fence_type{};
+                }
+            }
+
+        } // namespace
+
+        Graph::Graph(const Backend& backend,
+                     std::size_t model_size,
+                     const void* model,
+                     std::uint32_t weights_count,
+                     const ::onnxTensorDescriptorV1* weights)
+            : m_backend{backend}
+        {
+            if ((model == nullptr) || ((weights_count != 0) && (weights == nullptr)))
+            {
+                throw status::null_pointer{};
+            }
+            if (model_size == 0)
+            {
+                throw status::invalid_size{};
+            }
+            onnx_import::Weights ng_weights;
+            for (const auto& descriptor : Span<::onnxTensorDescriptorV1>{weights, weights_count})
+            {
+                Tensor tensor{descriptor};
+                const char* data{reinterpret_cast<const char*>(tensor.data())};
+                std::size_t size{tensor.size() * tensor.get_element_type().size()};
+                ng_weights.emplace(tensor.get_name(),
+                                   onnx_import::Weight{tensor.get_element_type(),
+                                                       tensor.get_shape(),
+                                                       std::vector<char>(data, data + size)});
+            }
+            std::istringstream stream{
+                std::string{reinterpret_cast<const char*>(model), model_size}};
+            try
+            {
+                m_function = onnx_import::import_onnx_model(stream, ng_weights);
+            }
+            catch (const ngraph_error&)
+            {
+                throw status::invalid_model{};
+            }
+            m_executable = m_backend.compile(m_function);
+        }
+
+        Graph::~Graph()
+        {
+            if (m_run.valid())
+            {
+                m_run.wait();
+            }
+        }
+
+        void Graph::set_io(std::uint32_t inputs_count,
+                           const ::onnxTensorDescriptorV1* inputs,
+                           std::uint32_t outputs_count,
+                           const ::onnxTensorDescriptorV1* outputs)
+        {
+            if (((inputs_count != 0) && (inputs == nullptr)) ||
+                ((outputs_count != 0) && (outputs == nullptr)))
+            {
+                throw status::null_pointer{};
+            }
+            auto ng_inputs = bind_tensors(m_backend,
+                                          m_function->get_parameters(),
+                                          Span<::onnxTensorDescriptorV1>{inputs, inputs_count});
+            auto ng_outputs = bind_tensors(m_backend,
+                                           m_function->get_results(),
+                                           Span<::onnxTensorDescriptorV1>{outputs, outputs_count});
+            // a pending run still uses the previous buffers
+            if (m_run.valid())
+            {
+                m_run.wait();
+            }
+            m_inputs = std::move(ng_inputs);
+            m_outputs = std::move(ng_outputs);
+        }
+
+        void Graph::run(const ::onnxMemoryFenceV1& input_fence, ::onnxMemoryFenceV1& output_fence)
+        {
+            check_fence(input_fence);
+            check_fence(output_fence);
+            if (m_inputs.size() != m_function->get_parameters().size() ||
+                m_outputs.size() != m_function->get_results().size())
+            {
+                // set_io has not been called
+                throw status::invalid_state{};
+            }
+            const Event* input_event{nullptr};
+            if (input_fence.type == ONNXIFI_SYNCHRONIZATION_EVENT)
+            {
+                if (input_fence.event == nullptr)
+                {
+                    throw status::invalid_event{};
+                }
+                input_event = reinterpret_cast<const Event*>(input_fence.event);
+            }
+            Event* output_event{nullptr};
+            if (output_fence.type == ONNXIFI_SYNCHRONIZATION_EVENT)
+            {
+                output_event = new Event{};
+                output_fence.event = reinterpret_cast<::onnxEvent>(output_event);
+            }
+
+            auto previous = m_run;
+            auto executable = m_executable;
+            auto inputs = m_inputs;
+            auto outputs = m_outputs;
+            m_run = std::async(std::launch::async,
+                               [=]() {
+                                   if (previous.valid())
+                                   {
+                                       previous.wait();
+                                   }
+                                   if (input_event != nullptr)
+                                   {
+                                       input_event->wait();
+                                   }
+                                   // ONNXIFI has no way to report a failed run, the event is
+                                   // signalled anyway and the outputs are undefined
+                                   try
+                                   {
+                                       executable->call(outputs, inputs);
+                                   }
+                                   catch (...)
+                                   {
+                                   }
+                                   if (output_event != nullptr)
+                                   {
+                                       output_event->signal();
+                                   }
+                               })
+                        .share();
+            if (output_event == nullptr)
+            {
+                m_run.wait();
+            }
+        }
+
+    } // namespace onnxifi
+
+} // namespace ngraph
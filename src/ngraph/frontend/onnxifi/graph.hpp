@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>  // std::size_t
+#include <cstdint>  // std::uint32_t
+#include <future>   // std::shared_future
+#include <memory>   // std::shared_ptr
+#include <onnxifi.h>
+#include <vector>   // std::vector
+
+#include "backend.hpp"
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace onnxifi
+    {
+        /// \brief ONNXIFI graph, an ONNX model compiled for one backend
+        class Graph
+        {
+        public:
+            Graph(const Graph&) = delete;
+            Graph& operator=(const Graph&) = delete;
+
+            Graph(Graph&&) = delete;
+            Graph& operator=(Graph&&) = delete;
+
+            Graph() = delete;
+
+            /// \brief Imports and compiles an ONNX model
+            /// \param backend          the backend to compile for.
+            /// \param model_size       size of the serialized ONNX model in bytes.
+            /// \param model            the serialized ONNX model.
+            /// \param weights_count    number of weight descriptors.
+            /// \param weights          values of model inputs that become constants; they are
+            ///                         copied and need not outlive the call.
+            Graph(const Backend& backend,
+                  std::size_t model_size,
+                  const void* model,
+                  std::uint32_t weights_count,
+                  const ::onnxTensorDescriptorV1* weights);
+
+            /// \brief Waits for the last run to finish
+            ~Graph();
+
+            /// \brief Binds caller memory to the inputs and outputs of the graph
+            /// Descriptors are matched to ONNX inputs and outputs by name. Runs read and
+            /// write the buffers in place, so they must stay valid until the next call to
+            /// set_io or until the graph is released.
+            void set_io(std::uint32_t inputs_count,
+                        const ::onnxTensorDescriptorV1* inputs,
+                        std::uint32_t outputs_count,
+                        const ::onnxTensorDescriptorV1* outputs);
+
+            /// \brief Starts a run without waiting for it
+            /// The run starts once the previous one has finished and the input fence is
+            /// signalled. For an event output fence a new event is stored in it, which is
+            /// signalled when the outputs are written; an implicit output fence makes the
+            /// call wait for the run.
+            void run(const ::onnxMemoryFenceV1& input_fence, ::onnxMemoryFenceV1& output_fence);
+
+        private:
+            const Backend& m_backend;
+            std::shared_ptr<Function> m_function{nullptr};
+            std::shared_ptr<runtime::Executable> m_executable{nullptr};
+            std::vector<std::shared_ptr<runtime::Tensor>> m_inputs{};
+            std::vector<std::shared_ptr<runtime::Tensor>> m_outputs{};
+            std::shared_future<void> m_run{};
+        };
+
+    } // namespace onnxifi
+
+} // namespace ngraph
@@ -20,34 +20,64 @@
 #include <stdexcept>
 
 #include "backend_manager.hpp"
+#include "event.hpp"
 #include "exceptions.hpp"
+#include "graph.hpp"
 
 using namespace ngraph::onnxifi;
 
-extern "C" {
-
-ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
-    onnxGetBackendIDs(onnxBackendID* backendIDs, std::size_t* numBackends)
+namespace
 {
-    try
+    // Runs f and turns the exceptions it throws into ONNXIFI status codes
+    template <typename F>
+    ::onnxStatus to_status(F&& f)
     {
-        BackendManager::get_backend_ids(backendIDs, numBackends);
-        return ONNXIFI_STATUS_SUCCESS;
+        try
+        {
+            f();
+            return ONNXIFI_STATUS_SUCCESS;
+        }
+        catch (const status::runtime& e)
+        {
+            return e.get_status();
+        }
+        catch (const std::bad_alloc&)
+        {
+            return ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
+        }
+        catch (...)
+        {
+            return ONNXIFI_STATUS_INTERNAL_ERROR;
+        }
     }
-    catch (const status::runtime& e)
-    {
-        return e.get_status();
-    }
-    catch (const std::bad_alloc&)
+
+    Event& get_event(::onnxEvent event)
     {
-        return ONNXIFI_STATUS_NO_SYSTEM_MEMORY;
+        if (event == nullptr)
+        {
+            throw status::invalid_event{};
+        }
+        return *reinterpret_cast<Event*>(event);
     }
-    catch (...)
+
+    Graph& get_graph(::onnxGraph graph)
     {
-        return ONNXIFI_STATUS_INTERNAL_ERROR;
+        if (graph == nullptr)
+        {
+            throw status::invalid_graph{};
+        }
+        return *reinterpret_cast<Graph*>(graph);
     }
 }
 
+extern "C" {
+
+ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
+    onnxGetBackendIDs(onnxBackendID* backendIDs, std::size_t* numBackends)
+{
+    return to_status([&] { BackendManager::get_backend_ids(backendIDs, numBackends); });
+}
+
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
     onnxReleaseBackendID(onnxBackendID backendID)
 {
@@ -69,33 +99,58 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxGetBackendCompati
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxInitBackend(
     onnxBackendID backendID, const uint64_t* auxPropertiesList, onnxBackend* backend)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return to_status([&] {
+        if (backend == nullptr)
+        {
+            throw status::null_pointer{};
+        }
+        try
+        {
+            // The backends are owned by the BackendManager, the handle just refers to one
+            *backend = reinterpret_cast<onnxBackend>(
+                const_cast<Backend*>(&BackendManager::get(backendID)));
+        }
+        catch (const std::out_of_range&)
+        {
+            throw status::invalid_id{};
+        }
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseBackend(onnxBackend backend)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return (backend == nullptr) ? ONNXIFI_STATUS_INVALID_BACKEND : ONNXIFI_STATUS_SUCCESS;
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxInitEvent(onnxBackend backend,
                                                                          onnxEvent* event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return to_status([&] {
+        if (backend == nullptr)
+        {
+            throw status::invalid_backend{};
+        }
+        if (event == nullptr)
+        {
+            throw status::null_pointer{};
+        }
+        *event = reinterpret_cast<onnxEvent>(new Event{});
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxSignalEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return to_status([&] { get_event(event).signal(); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxWaitEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return to_status([&] { get_event(event).wait(); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseEvent(onnxEvent event)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return to_status([&] { delete &get_event(event); });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
@@ -107,7 +162,21 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
                   const onnxTensorDescriptorV1* weightDescriptors,
                   onnxGraph* graph)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return to_status([&] {
+        if (backend == nullptr)
+        {
+            throw status::invalid_backend{};
+        }
+        if (graph == nullptr)
+        {
+            throw status::null_pointer{};
+        }
+        *graph = reinterpret_cast<onnxGraph>(new Graph{*reinterpret_cast<const Backend*>(backend),
+                                                       onnxModelSize,
+                                                       onnxModel,
+                                                       weightsCount,
+                                                       weightDescriptors});
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
@@ -117,18 +186,26 @@ ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI
                    std::uint32_t outputsCount,
                    const onnxTensorDescriptorV1* outputDescriptors)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return to_status([&] {
+        get_graph(graph).set_io(inputsCount, inputDescriptors, outputsCount, outputDescriptors);
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxRunGraph(
     onnxGraph graph, const onnxMemoryFenceV1* inputFence, onnxMemoryFenceV1* outputFence)
 {
-    return ONNXIFI_STATUS_BACKEND_UNAVAILABLE;
+    return to_status([&] {
+        if ((inputFence == nullptr) || (outputFence == nullptr))
+        {
+            throw status::null_pointer{};
+        }
+        get_graph(graph).run(*inputFence, *outputFence);
+    });
 }
 
 ONNXIFI_PUBLIC ONNXIFI_CHECK_RESULT onnxStatus ONNXIFI_ABI onnxReleaseGraph(onnxGraph graph)
 {
-    return ONNXIFI_STATUS_INTERNAL_ERROR;
+    return to_status([&] { delete &get_graph(graph); });
 }
 
 } /* extern "C" */
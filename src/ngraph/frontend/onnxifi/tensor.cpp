@@ -141,6 +141,25 @@ namespace ngraph
             return tensor;
         }
 
+        const element::Type& Tensor::get_element_type() const
+        {
+            switch (m_tensor->dataType)
+            {
+            case ONNXIFI_DATATYPE_FLOAT16: return element::f16;
+            case ONNXIFI_DATATYPE_FLOAT32: return element::f32;
+            case ONNXIFI_DATATYPE_FLOAT64: return element::f64;
+            case ONNXIFI_DATATYPE_INT8: return element::i8;
+            case ONNXIFI_DATATYPE_INT16: return element::i16;
+            case ONNXIFI_DATATYPE_INT32: return element::i32;
+            case ONNXIFI_DATATYPE_INT64: return element::i64;
+            case ONNXIFI_DATATYPE_UINT8: return element::u8;
+            case ONNXIFI_DATATYPE_UINT16: return element::u16;
+            case ONNXIFI_DATATYPE_UINT32: return element::u32;
+            case ONNXIFI_DATATYPE_UINT64: return element::u64;
+            default: throw status::unsupported_datatype{};
+            }
+        }
+
         void Tensor::from_ng(const runtime::Tensor& tensor)
         {
             std::size_t readSize{tensor.get_element_count()};
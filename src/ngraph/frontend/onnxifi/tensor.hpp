@@ -52,6 +52,9 @@ namespace ngraph
             /// \param tensor     nGraph tensor to copy from.
             void from_ng(const runtime::Tensor& tensor);
 
+            /// \brief The nGraph element type of the tensor data
+            const element::Type& get_element_type() const;
+
             const void* data() const { return reinterpret_cast<const void*>(m_tensor->buffer); }
             std::size_t size() const { return m_size; }
             const Shape& get_shape() const { return m_shape; }
@@ -15,8 +15,11 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <deque>
+#include <functional>
 #include <list>
 #include <memory>
+#include <unordered_map>
 
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
@@ -78,7 +81,12 @@ Function::Function(const std::shared_ptr<Node>& result,
 
 void Function::validate_nodes_and_infer_types()
 {
-    ngraph::validate_nodes_and_infer_types(get_ops());
+    // Nodes whose inputs are unchanged since they were last validated are skipped, so this
+    // sweep only re-infers what passes have rewired and what was built under DeferValidation
+    for (auto& node : get_ordered_ops())
+    {
+        node->revalidate_and_infer_types();
+    }
 }
 
 void Function::init()
@@ -101,7 +109,133 @@ void Function::init()
 
 std::list<shared_ptr<Node>> Function::get_ordered_ops(bool include_control_deps) const
 {
-    return topological_sort(get_ops(include_control_deps), include_control_deps);
+    std::lock_guard<std::mutex> lock(m_ordered_ops_mutex);
+    OrderedOpsCache& cache = m_ordered_ops_cache[include_control_deps ? 1 : 0];
+    size_t modification_count = Node::get_graph_modification_count();
+    if (!cache.m_valid || cache.m_modification_count != modification_count)
+    {
+        cache.m_ops = sort_ops(include_control_deps);
+        cache.m_modification_count = modification_count;
+        cache.m_valid = true;
+    }
+
+    // No edge has changed since the sort, so the results still own every cached node
+    std::list<shared_ptr<Node>> ops;
+    for (Node* node : cache.m_ops)
+    {
+        ops.push_back(node->shared_from_this());
+    }
+    return ops;
+}
+
+// Same order as topological_sort(get_ops(include_control_deps), include_control_deps), but
+// walks raw pointers and keeps the per-node state in flat vectors
+std::vector<Node*> Function::sort_ops(bool include_control_deps) const
+{
+    // Discover the ops in the order traverse_nodes visits them
+    std::vector<Node*> ops;
+    std::unordered_map<Node*, size_t> op_index;
+    std::deque<Node*> stack;
+    for (auto& r : m_results)
+    {
+        stack.push_front(r.get());
+    }
+    for (auto& p : m_parameters)
+    {
+        stack.push_front(p.get());
+    }
+    while (stack.size() > 0)
+    {
+        Node* n = stack.front();
+        stack.pop_front();
+        if (op_index.emplace(n, ops.size()).second)
+        {
+            ops.push_back(n);
+        }
+        for (auto& input : n->get_inputs())
+        {
+            Node* arg = input.get_output().get_raw_pointer_node();
+            if (op_index.count(arg) == 0)
+            {
+                stack.push_front(arg);
+            }
+        }
+        if (include_control_deps)
+        {
+            for (auto& cdep : n->get_control_dependencies())
+            {
+                if (op_index.count(cdep.get()) == 0)
+                {
+                    stack.push_front(cdep.get());
+                }
+            }
+        }
+    }
+
+    std::vector<size_t> dependency_count(ops.size());
+    std::vector<std::vector<size_t>> control_deps_users(include_control_deps ? ops.size() : 0);
+    std::deque<size_t> independent_ops;
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        size_t deps_count = ops[i]->get_input_size();
+        if (include_control_deps)
+        {
+            for (auto& cdep : ops[i]->get_control_dependencies())
+            {
+                control_deps_users[op_index.at(cdep.get())].push_back(i);
+                deps_count++;
+            }
+        }
+        dependency_count[i] = deps_count;
+        if (deps_count == 0)
+        {
+            independent_ops.push_back(i);
+        }
+    }
+    if (include_control_deps)
+    {
+        // topological_sort keeps control dependency users in a std::set<Node*>
+        for (auto& users : control_deps_users)
+        {
+            std::sort(users.begin(), users.end(), [&ops](size_t a, size_t b) {
+                return std::less<Node*>()(ops[a], ops[b]);
+            });
+        }
+    }
+
+    std::vector<Node*> result;
+    result.reserve(ops.size());
+    while (independent_ops.size() > 0)
+    {
+        size_t i = independent_ops.front();
+        independent_ops.pop_front();
+        result.push_back(ops[i]);
+
+        for (auto& output : ops[i]->get_outputs())
+        {
+            for (descriptor::Input* input : output.get_inputs())
+            {
+                auto it = op_index.find(input->get_raw_pointer_node());
+                if (it != op_index.end() && --dependency_count[it->second] == 0)
+                {
+                    independent_ops.push_back(it->second);
+                }
+            }
+        }
+        if (include_control_deps)
+        {
+            for (size_t user : control_deps_users[i])
+            {
+                if (--dependency_count[user] == 0)
+                {
+                    independent_ops.push_back(user);
+                }
+            }
+        }
+    }
+
+    NGRAPH_CHECK(ops.size() == result.size());
+    return result;
 }
 
 const std::string& Function::get_friendly_name() const
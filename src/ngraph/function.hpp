@@ -20,6 +20,7 @@
 #include <initializer_list>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
@@ -87,6 +88,8 @@ namespace ngraph
         const std::string& get_friendly_name() const;
 
         std::list<std::shared_ptr<Node>> get_ops(bool include_control_deps = true) const;
+        /// \brief Returns the ops in topological order. The order is cached and reused until
+        ///        any graph is modified (see Node::get_graph_modification_count).
         std::list<std::shared_ptr<Node>> get_ordered_ops(bool include_control_deps = true) const;
         friend std::ostream& operator<<(std::ostream&, const Function&);
         size_t get_instance_id() { return m_instance_id; }
@@ -95,6 +98,8 @@ namespace ngraph
         // updates graph and m_results list
         void replace_node(std::shared_ptr<Node> old, std::shared_ptr<Node> repl);
 
+        /// \brief Re-infer types, in topological order, of the nodes whose inputs have changed
+        ///        since they were last validated (see Node::revalidate_and_infer_types).
         void validate_nodes_and_infer_types();
 
         /// \brief Returns the sum of the size of all nodes in the graph plus the size of
@@ -114,6 +119,15 @@ namespace ngraph
         size_t m_temporary_pool_size;
 
     private:
+        std::vector<Node*> sort_ops(bool include_control_deps) const;
+
+        struct OrderedOpsCache
+        {
+            bool m_valid{false};
+            size_t m_modification_count{0};
+            std::vector<Node*> m_ops;
+        };
+
         Function(const Function&) = delete;
         Function(const Function&&) = delete;
         Function& operator=(const Function&) = delete;
@@ -123,5 +137,8 @@ namespace ngraph
         std::string m_name;
         const std::string m_unique_name;
         size_t m_placement{0};
+        // Indexed by include_control_deps
+        mutable OrderedOpsCache m_ordered_ops_cache[2];
+        mutable std::mutex m_ordered_ops_mutex;
     };
 }
@@ -81,12 +81,14 @@ void ngraph::traverse_nodes(const NodeVector& subgraph_results,
     while (stack.size() > 0)
     {
         std::shared_ptr<Node> n = stack.front();
-        if (instances_seen.count(n) == 0)
+        stack.pop_front();
+        // Also stops at a result that is one of the params
+        if (instances_seen.count(n) != 0)
         {
-            instances_seen.insert(n);
-            f(n);
+            continue;
         }
-        stack.pop_front();
+        instances_seen.insert(n);
+        f(n);
         for (auto arg : n->get_arguments())
         {
             if (instances_seen.count(arg) == 0)
@@ -135,6 +137,63 @@ void ngraph::traverse_functions(std::shared_ptr<ngraph::Function> p,
     }
 }
 
+// The nodes made for a replacement are the replacement itself and its ancestors created after
+// the target that are not ancestors of the target, such as a fused op under the
+// GetOutputElement replacing the root of the fused pattern. They all take the tags of the
+// nodes between the target and the existing nodes that they use.
+static void merge_replaced_provenance_tags(const std::shared_ptr<Node>& target,
+                                           const std::shared_ptr<Node>& replacement)
+{
+    std::unordered_set<std::shared_ptr<Node>> target_ancestors;
+    traverse_nodes(
+        {target},
+        [&target_ancestors](std::shared_ptr<Node> node) { target_ancestors.insert(node); },
+        false);
+
+    NodeVector new_nodes;
+    NodeVector existing_nodes;
+    std::unordered_set<std::shared_ptr<Node>> seen;
+    std::deque<std::shared_ptr<Node>> stack{replacement};
+    while (!stack.empty())
+    {
+        std::shared_ptr<Node> node = stack.front();
+        stack.pop_front();
+        if (!seen.insert(node).second)
+        {
+            continue;
+        }
+        if (node == replacement || (node->get_instance_id() > target->get_instance_id() &&
+                                    target_ancestors.count(node) == 0))
+        {
+            new_nodes.push_back(node);
+            for (auto& arg : node->get_arguments())
+            {
+                stack.push_front(arg);
+            }
+        }
+        else
+        {
+            existing_nodes.push_back(node);
+        }
+    }
+
+    std::unordered_set<std::string> tags;
+    traverse_nodes({target},
+                   [&tags](std::shared_ptr<Node> node) {
+                       const auto& node_tags = node->get_provenance_tags();
+                       tags.insert(node_tags.begin(), node_tags.end());
+                   },
+                   false,
+                   existing_nodes);
+    for (auto& node : new_nodes)
+    {
+        for (const std::string& tag : tags)
+        {
+            node->add_provenance_tag(tag);
+        }
+    }
+}
+
 void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement)
 {
     if (target->is_output())
@@ -152,11 +211,17 @@ void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> re
 
     if (ngraph::get_provenance_enabled())
     {
-        auto set_replacement_prov = [replacement](std::shared_ptr<Node> node) {
-            replacement->merge_provenance_tags_from(node);
-        };
+        merge_replaced_provenance_tags(target, replacement);
+    }
 
-        traverse_nodes({target}, set_replacement_prov, false, replacement->get_arguments());
+    // The users keep their structural hashes only if the replacement hashes like the target
+    if (!target->has_cached_structural_hash() || !replacement->has_cached_structural_hash() ||
+        target->get_structural_hash() != replacement->get_structural_hash())
+    {
+        for (auto& user : target->get_users())
+        {
+            user->invalidate_structural_hash();
+        }
     }
 
     // For each of target's output O with replacement output O_rep:
@@ -169,6 +234,31 @@ void ngraph::replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> re
             input.replace_source_output(replacement->output(i));
         }
     }
+    ReplaceNodeObserver::notify(target, replacement);
+}
+
+// innermost live observer of this thread
+static thread_local ReplaceNodeObserver* s_replace_node_observer = nullptr;
+
+ReplaceNodeObserver::ReplaceNodeObserver(const Callback& callback)
+    : m_callback(callback)
+    , m_previous(s_replace_node_observer)
+{
+    s_replace_node_observer = this;
+}
+
+ReplaceNodeObserver::~ReplaceNodeObserver()
+{
+    s_replace_node_observer = m_previous;
+}
+
+void ReplaceNodeObserver::notify(const std::shared_ptr<Node>& target,
+                                 const std::shared_ptr<Node>& replacement)
+{
+    for (auto observer = s_replace_node_observer; observer; observer = observer->m_previous)
+    {
+        observer->m_callback(target, replacement);
+    }
 }
 
 // Check if all paths from X to a result go through Y
@@ -217,6 +307,7 @@ std::list<std::shared_ptr<ngraph::Node>>
                 cloned_args.push_back(node_map.at(arg.get()));
             }
             auto cloned_node = node->copy_with_new_args(cloned_args);
+            cloned_node->merge_provenance_tags_from(node);
 
             //copy control dependencies
             for (auto cdep : node->get_control_dependencies())
@@ -75,6 +75,29 @@ namespace ngraph
 
     void replace_node(std::shared_ptr<Node> target, std::shared_ptr<Node> replacement);
 
+    /// \brief Reports each replace_node() made on the constructing thread to a callback, for
+    /// as long as the observer is alive. The rewrite passes use it to learn which nodes their
+    /// matcher callbacks touched. Observers nest; each one sees every replacement.
+    class ReplaceNodeObserver
+    {
+    public:
+        using Callback = std::function<void(const std::shared_ptr<Node>& target,
+                                            const std::shared_ptr<Node>& replacement)>;
+
+        ReplaceNodeObserver(const Callback& callback);
+        ~ReplaceNodeObserver();
+        ReplaceNodeObserver(const ReplaceNodeObserver&) = delete;
+        ReplaceNodeObserver& operator=(const ReplaceNodeObserver&) = delete;
+
+        /// \brief Called by replace_node() once `target`'s users read from `replacement`
+        static void notify(const std::shared_ptr<Node>& target,
+                           const std::shared_ptr<Node>& replacement);
+
+    private:
+        Callback m_callback;
+        ReplaceNodeObserver* m_previous;
+    };
+
     template <typename T>
     std::list<std::shared_ptr<Node>> topological_sort(const T& nodes,
                                                       bool include_control_deps = false)
@@ -240,6 +263,8 @@ namespace ngraph
         clone_nodes(const std::list<std::shared_ptr<ngraph::Node>>& nodes, NodeMap& node_map);
 
     // input function is cloned and returned
+    // Constants share their data with the originals until one is written to (see
+    // op::Constant::make_data_unique), so cloning does not copy weights
     // NodeMap input may contain default node mapping i.e. pre-cloned nodes
     // NodeMap output (by reference) fully maps input and cloned function ops
     std::shared_ptr<ngraph::Function> clone_function(const ngraph::Function& func,
@@ -0,0 +1,240 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+#include "ngraph/check.hpp"
+#include "ngraph/metrics.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+atomic<bool> Metrics::s_enabled{false};
+
+static shared_ptr<MetricsSink> s_sink;
+
+void Metrics::set_sink(const shared_ptr<MetricsSink>& sink)
+{
+    atomic_store(&s_sink, sink);
+    s_enabled.store(sink != nullptr, memory_order_relaxed);
+}
+
+shared_ptr<MetricsSink> Metrics::get_sink()
+{
+    return atomic_load(&s_sink);
+}
+
+void Metrics::add_counter(const string& name, const MetricLabels& labels, double value)
+{
+    if (auto sink = get_sink())
+    {
+        sink->add_counter(name, labels, value);
+    }
+}
+
+void Metrics::set_gauge(const string& name, const MetricLabels& labels, double value)
+{
+    if (auto sink = get_sink())
+    {
+        sink->set_gauge(name, labels, value);
+    }
+}
+
+void Metrics::observe(const string& name, const MetricLabels& labels, double value)
+{
+    if (auto sink = get_sink())
+    {
+        sink->observe(name, labels, value);
+    }
+}
+
+void Metrics::count_cache_lookup(const string& cache, bool hit)
+{
+    if (is_enabled())
+    {
+        add_counter(
+            "ngraph_cache_lookups_total", {{"cache", cache}, {"result", hit ? "hit" : "miss"}}, 1);
+    }
+}
+
+PrometheusMetricsSink::PrometheusMetricsSink(const vector<double>& buckets)
+    : m_buckets(buckets)
+{
+    NGRAPH_CHECK(is_sorted(m_buckets.begin(), m_buckets.end()) &&
+                     adjacent_find(m_buckets.begin(), m_buckets.end()) == m_buckets.end(),
+                 "Histogram bucket bounds must be increasing");
+}
+
+vector<double> PrometheusMetricsSink::default_buckets()
+{
+    return {1e-5, 5e-5, 1e-4, 5e-4, 1e-3, 5e-3, 1e-2, 5e-2, 0.1, 0.5, 1, 5, 10};
+}
+
+PrometheusMetricsSink::Series& PrometheusMetricsSink::get_series(const string& name,
+                                                                  const MetricLabels& labels,
+                                                                  Type type)
+{
+    auto it = m_families.find(name);
+    if (it == m_families.end())
+    {
+        it = m_families.insert({name, Family{type, {}}}).first;
+    }
+    NGRAPH_CHECK(it->second.type == type, "Metric ", name, " was reported with another type");
+    Series& series = it->second.series[labels];
+    if (type == Type::histogram && series.counts.empty())
+    {
+        series.counts.resize(m_buckets.size() + 1, 0);
+    }
+    return series;
+}
+
+void PrometheusMetricsSink::add_counter(const string& name,
+                                        const MetricLabels& labels,
+                                        double value)
+{
+    lock_guard<mutex> lock(m_mutex);
+    get_series(name, labels, Type::counter).value += value;
+}
+
+void PrometheusMetricsSink::set_gauge(const string& name, const MetricLabels& labels, double value)
+{
+    lock_guard<mutex> lock(m_mutex);
+    get_series(name, labels, Type::gauge).value = value;
+}
+
+void PrometheusMetricsSink::observe(const string& name, const MetricLabels& labels, double value)
+{
+    lock_guard<mutex> lock(m_mutex);
+    Series& series = get_series(name, labels, Type::histogram);
+    series.value += value;
+    size_t bucket = lower_bound(m_buckets.begin(), m_buckets.end(), value) - m_buckets.begin();
+    series.counts[bucket]++;
+}
+
+// Label values escape backslashes, double quotes and line feeds
+static void write_labels(ostream& stream,
+                         const MetricLabels& labels,
+                         const string& le = string())
+{
+    if (labels.empty() && le.empty())
+    {
+        return;
+    }
+    stream << "{";
+    bool first = true;
+    for (auto& label : labels)
+    {
+        stream << (first ? "" : ",") << label.first << "=\"";
+        for (char c : label.second)
+        {
+            switch (c)
+            {
+            case '\\': stream << "\\\\"; break;
+            case '"': stream << "\\\""; break;
+            case '\n': stream << "\\n"; break;
+            default: stream << c;
+            }
+        }
+        stream << "\"";
+        first = false;
+    }
+    if (!le.empty())
+    {
+        stream << (first ? "" : ",") << "le=\"" << le << "\"";
+    }
+    stream << "}";
+}
+
+static string format_value(double value)
+{
+    ostringstream ss;
+    ss.precision(15);
+    ss << value;
+    return ss.str();
+}
+
+void PrometheusMetricsSink::write(ostream& stream) const
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto& family : m_families)
+    {
+        const string& name = family.first;
+        Type type = family.second.type;
+        stream << "# TYPE " << name << " "
+               << (type == Type::counter ? "counter"
+                                         : type == Type::gauge ? "gauge" : "histogram")
+               << "\n";
+        for (auto& series : family.second.series)
+        {
+            const MetricLabels& labels = series.first;
+            if (type != Type::histogram)
+            {
+                stream << name;
+                write_labels(stream, labels);
+                stream << " " << format_value(series.second.value) << "\n";
+                continue;
+            }
+            // Bucket counts are cumulative in the exposition format
+            uint64_t count = 0;
+            for (size_t i = 0; i <= m_buckets.size(); i++)
+            {
+                count += series.second.counts[i];
+                stream << name << "_bucket";
+                write_labels(stream, labels, i < m_buckets.size() ? format_value(m_buckets[i])
+                                                                  : "+Inf");
+                stream << " " << count << "\n";
+            }
+            stream << name << "_sum";
+            write_labels(stream, labels);
+            stream << " " << format_value(series.second.value) << "\n";
+            stream << name << "_count";
+            write_labels(stream, labels);
+            stream << " " << count << "\n";
+        }
+    }
+}
+
+string PrometheusMetricsSink::str() const
+{
+    ostringstream ss;
+    write(ss);
+    return ss.str();
+}
+
+void PrometheusMetricsSink::write_file(const string& path) const
+{
+    string temporary = path + ".tmp";
+    {
+        ofstream stream(temporary);
+        NGRAPH_CHECK(stream, "Unable to write metrics to ", temporary);
+        write(stream);
+    }
+    NGRAPH_CHECK(rename(temporary.c_str(), path.c_str()) == 0,
+                 "Unable to rename ",
+                 temporary,
+                 " to ",
+                 path);
+}
+
+void PrometheusMetricsSink::clear()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_families.clear();
+}
@@ -0,0 +1,130 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief Labels that tell apart the series of a metric, such as {{"backend", "CPU"}}
+    using MetricLabels = std::map<std::string, std::string>;
+
+    /// \brief Destination of the metrics the runtime updates as it runs. The methods may be
+    ///        called concurrently from any thread.
+    class MetricsSink
+    {
+    public:
+        virtual ~MetricsSink() {}
+        /// \brief Adds `value` to a counter, a total that only grows
+        virtual void
+            add_counter(const std::string& name, const MetricLabels& labels, double value) = 0;
+        /// \brief Sets a gauge, a value that can go up and down
+        virtual void
+            set_gauge(const std::string& name, const MetricLabels& labels, double value) = 0;
+        /// \brief Records a sample, such as a duration in seconds, in a histogram
+        virtual void
+            observe(const std::string& name, const MetricLabels& labels, double value) = 0;
+    };
+
+    /// \brief Keeps the metrics in memory and exports them in the Prometheus text format, to
+    ///        be served on a /metrics endpoint or written for the textfile collector of the
+    ///        node exporter.
+    class PrometheusMetricsSink : public MetricsSink
+    {
+    public:
+        /// \param buckets Upper bounds of the histogram buckets, in increasing order. A last
+        ///        +Inf bucket is always added.
+        explicit PrometheusMetricsSink(const std::vector<double>& buckets = default_buckets());
+
+        void add_counter(const std::string& name,
+                         const MetricLabels& labels,
+                         double value) override;
+        void set_gauge(const std::string& name, const MetricLabels& labels, double value) override;
+        void observe(const std::string& name, const MetricLabels& labels, double value) override;
+
+        /// \brief Writes every metric in the text exposition format, version 0.0.4
+        void write(std::ostream& stream) const;
+        std::string str() const;
+        /// \brief Writes the metrics to a temporary file renamed to `path`, so that a reader
+        ///        never sees a partial file
+        void write_file(const std::string& path) const;
+        void clear();
+
+        /// \brief Bounds from 10us to 10s, suited to call and compile durations in seconds
+        static std::vector<double> default_buckets();
+
+    private:
+        enum class Type
+        {
+            counter,
+            gauge,
+            histogram
+        };
+        struct Series
+        {
+            double value = 0;
+            // Histograms only: non-cumulative count of each bucket, the +Inf one last
+            std::vector<uint64_t> counts;
+        };
+        struct Family
+        {
+            Type type;
+            std::map<MetricLabels, Series> series;
+        };
+
+        Series& get_series(const std::string& name, const MetricLabels& labels, Type type);
+
+        std::vector<double> m_buckets;
+        std::map<std::string, Family> m_families;
+        mutable std::mutex m_mutex;
+    };
+
+    /// \brief The sink the runtime reports its metrics to. No sink is set by default, and
+    ///        the instrumented code then only pays for a check of is_enabled().
+    ///
+    /// Metrics reported by the runtime:
+    ///   ngraph_call_duration_seconds{backend} (histogram) calls of executables, and
+    ///   ngraph_call_errors_total{backend} the calls that threw;
+    ///   ngraph_context_wait_seconds_total{backend} time calls waited for a runtime context;
+    ///   ngraph_compile_duration_seconds{backend} (histogram) compilations;
+    ///   ngraph_cache_lookups_total{cache, result} hits and misses of the dynamic backend's
+    ///   executable cache, the codegen module cache and the MKL-DNN primitive cache;
+    ///   ngraph_arena_bytes{backend} memory held by runtime contexts for intermediates.
+    class Metrics
+    {
+    public:
+        static void set_sink(const std::shared_ptr<MetricsSink>& sink);
+        static std::shared_ptr<MetricsSink> get_sink();
+        static bool is_enabled() { return s_enabled.load(std::memory_order_relaxed); }
+        static void add_counter(const std::string& name, const MetricLabels& labels, double value);
+        static void set_gauge(const std::string& name, const MetricLabels& labels, double value);
+        static void observe(const std::string& name, const MetricLabels& labels, double value);
+        /// \brief Counts a hit or miss of `cache` in ngraph_cache_lookups_total
+        static void count_cache_lookup(const std::string& cache, bool hit);
+
+    private:
+        static std::atomic<bool> s_enabled;
+    };
+}
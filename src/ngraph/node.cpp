@@ -14,10 +14,13 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_set>
 
 #include "ngraph/autodiff/adjoints.hpp"
 #include "ngraph/descriptor/input.hpp"
@@ -27,18 +30,34 @@
 #include "ngraph/op/parameter.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/util.hpp"
 
 using namespace std;
 using namespace ngraph;
 
 atomic<size_t> Node::m_next_instance_id(0);
+atomic<size_t> Node::m_graph_modification_count(0);
+
+static const std::string& intern_node_type(const std::string& node_type)
+{
+    static std::mutex node_types_mutex;
+    static std::unordered_set<std::string> node_types;
+    std::lock_guard<std::mutex> lock(node_types_mutex);
+    return *node_types.insert(node_type).first;
+}
 
 Node::Node(const std::string& node_type, const NodeVector& arguments, size_t output_size)
-    : m_node_type(node_type)
+    : m_node_type(intern_node_type(node_type))
     , m_instance_id(m_next_instance_id.fetch_add(1))
     , m_unique_name(description() + "_" + to_string(m_instance_id))
 {
     // Add this node as a user of each argument.
+    size_t input_count = 0;
+    for (auto arg : arguments)
+    {
+        input_count += arg->m_outputs.size();
+    }
+    m_inputs.reserve(input_count);
     size_t i = 0;
     for (auto arg : arguments)
     {
@@ -58,18 +77,107 @@ Node::Node(const std::string& node_type, const NodeVector& arguments, size_t out
 void Node::constructor_validate_and_infer_types()
 {
 #ifdef IN_TRANSITION
-    validate_and_infer_types();
+    if (DeferValidation::is_active())
+    {
+        m_validation_deferred = true;
+        return;
+    }
+    validate_and_record_inputs();
 #endif
 }
 
 void Node::delayed_validate_and_infer_types()
 {
 #ifndef IN_TRANSITION
-    validate_and_infer_types();
+    validate_and_record_inputs();
+#else
+    if (m_validation_deferred)
+    {
+        validate_and_record_inputs();
+    }
 #endif
 }
 #undef IN_TRANSITION
 
+// Depth of the live DeferValidation guards on this thread
+static thread_local size_t s_defer_validation_depth = 0;
+
+DeferValidation::DeferValidation()
+{
+    s_defer_validation_depth++;
+}
+
+DeferValidation::~DeferValidation()
+{
+    s_defer_validation_depth--;
+}
+
+bool DeferValidation::is_active()
+{
+    return s_defer_validation_depth > 0;
+}
+
+void Node::revalidate_and_infer_types()
+{
+    if (m_validation_deferred || !inputs_unchanged_since_validation())
+    {
+        validate_and_record_inputs();
+    }
+}
+
+void Node::validate_and_record_inputs()
+{
+    // Nodes built while inferring types, such as the decomposition of a fused op, are
+    // inspected straight away and so must not defer their own validation
+    size_t defer_depth = s_defer_validation_depth;
+    s_defer_validation_depth = 0;
+    m_validated = false;
+    try
+    {
+        validate_and_infer_types();
+    }
+    catch (...)
+    {
+        s_defer_validation_depth = defer_depth;
+        throw;
+    }
+    s_defer_validation_depth = defer_depth;
+
+    m_validated_inputs.clear();
+    m_validated_inputs.reserve(m_inputs.size());
+    for (auto& input : m_inputs)
+    {
+        const descriptor::Output& output = input.get_output();
+        m_validated_inputs.push_back({output.get_raw_pointer_node()->get_instance_id(),
+                                      output.get_index(),
+                                      output.get_element_type(),
+                                      output.get_partial_shape()});
+    }
+    m_validated = true;
+    m_validation_deferred = false;
+}
+
+bool Node::inputs_unchanged_since_validation() const
+{
+    if (!m_validated || m_validated_inputs.size() != m_inputs.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < m_inputs.size(); i++)
+    {
+        const descriptor::Output& output = m_inputs[i].get_output();
+        const ValidatedInput& validated = m_validated_inputs[i];
+        if (output.get_raw_pointer_node()->get_instance_id() != validated.m_source_id ||
+            output.get_index() != validated.m_source_index ||
+            output.get_element_type() != validated.m_element_type ||
+            !output.get_partial_shape().same_scheme(validated.m_partial_shape))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 void Node::set_output_size(size_t n)
 {
     NGRAPH_CHECK(n >= m_outputs.size(), "shrinking ", m_outputs.size(), " to ", n);
@@ -100,12 +208,12 @@ void Node::set_output_type(size_t i, const element::Type& element_type, const Pa
     m_outputs.at(i).get_tensor_ptr()->set_tensor_type(element_type, pshape);
 }
 
-std::deque<descriptor::Output>& Node::get_outputs()
+StableVector<descriptor::Output>& Node::get_outputs()
 {
     return m_outputs;
 }
 
-const std::deque<descriptor::Output>& Node::get_outputs() const
+const StableVector<descriptor::Output>& Node::get_outputs() const
 {
     return m_outputs;
 }
@@ -125,6 +233,93 @@ bool Node::is_constant() const
     return false;
 }
 
+size_t Node::get_structural_hash()
+{
+    // Post-order walk with an explicit stack so that deep graphs cannot overflow the call stack
+    vector<Node*> stack{this};
+    while (!m_structural_hash_valid)
+    {
+        Node* node = stack.back();
+        bool args_hashed = true;
+        for (descriptor::Input& input : node->m_inputs)
+        {
+            Node* arg = input.get_output().get_node().get();
+            if (!arg->m_structural_hash_valid)
+            {
+                stack.push_back(arg);
+                args_hashed = false;
+            }
+        }
+        if (!args_hashed)
+        {
+            continue;
+        }
+        stack.pop_back();
+        if (node->m_structural_hash_valid)
+        {
+            // reached again through another user before it was popped
+            continue;
+        }
+
+        vector<size_t> arg_hashes;
+        for (descriptor::Input& input : node->m_inputs)
+        {
+            descriptor::Output& output = input.get_output();
+            arg_hashes.push_back(hash_combine(
+                {output.get_node()->m_structural_hash, output.get_index()}));
+        }
+        if (node->is_commutative())
+        {
+            sort(arg_hashes.begin(), arg_hashes.end());
+        }
+
+        vector<size_t> hashes{type_index(typeid(*node)).hash_code(), node->get_attribute_hash()};
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            hashes.push_back(node->get_output_element_type(i).hash());
+            const PartialShape& shape = node->get_output_partial_shape(i);
+            if (shape.rank().is_static())
+            {
+                for (size_t j = 0; j < static_cast<size_t>(shape.rank()); j++)
+                {
+                    hashes.push_back(shape[j].is_static() ? static_cast<size_t>(shape[j])
+                                                          : static_cast<size_t>(-1));
+                }
+            }
+            hashes.push_back(static_cast<size_t>(-2));
+        }
+        hashes.insert(hashes.end(), arg_hashes.begin(), arg_hashes.end());
+
+        node->m_structural_hash = hash_combine(hashes);
+        node->m_structural_hash_valid = true;
+    }
+    return m_structural_hash;
+}
+
+void Node::invalidate_structural_hash()
+{
+    // A node is only hashed after its arguments, so the users of a node without a hash have
+    // none either and the walk can stop there
+    vector<Node*> stack{this};
+    while (!stack.empty())
+    {
+        Node* node = stack.back();
+        stack.pop_back();
+        if (!node->m_structural_hash_valid)
+        {
+            continue;
+        }
+        node->m_structural_hash_valid = false;
+        for (descriptor::Output& output : node->m_outputs)
+        {
+            for (descriptor::Input* input : output.get_inputs())
+            {
+                stack.push_back(input->get_node().get());
+            }
+        }
+    }
+}
+
 const std::string& Node::description() const
 {
     return m_node_type;
@@ -171,17 +366,25 @@ void Node::set_placement_index(size_t placement)
 
 const std::unordered_set<std::string>& Node::get_provenance_tags() const
 {
-    return m_provenance_tags;
+    static const std::unordered_set<std::string> no_tags;
+    return m_provenance_tags ? *m_provenance_tags : no_tags;
 }
 
 void Node::add_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.insert(tag);
+    if (!m_provenance_tags)
+    {
+        m_provenance_tags.reset(new std::unordered_set<std::string>());
+    }
+    m_provenance_tags->insert(tag);
 }
 
 void Node::remove_provenance_tag(const std::string& tag)
 {
-    m_provenance_tags.erase(tag);
+    if (m_provenance_tags)
+    {
+        m_provenance_tags->erase(tag);
+    }
 }
 
 void Node::merge_provenance_tags_from(const std::shared_ptr<const Node>& source)
@@ -232,6 +435,7 @@ const std::set<std::shared_ptr<Node>>& Node::get_control_dependencies() const
 void Node::add_control_dependency(std::shared_ptr<Node> node)
 {
     m_control_dependencies.insert(node);
+    notify_graph_modified();
 }
 
 std::vector<std::shared_ptr<Function>> Node::get_functions() const
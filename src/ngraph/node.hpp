@@ -36,6 +36,7 @@
 #include "ngraph/descriptor/output.hpp"
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/placement.hpp"
+#include "ngraph/stable_vector.hpp"
 #include "ngraph/strides.hpp"
 
 namespace ngraph
@@ -74,6 +75,25 @@ namespace ngraph
     /// Alias useful for cloning
     using NodeMap = std::unordered_map<ngraph::Node*, std::shared_ptr<ngraph::Node>>;
 
+    /// \brief While an instance is alive, nodes constructed on this thread skip the type
+    ///        inference in their constructors. validate_nodes_and_infer_types, which the
+    ///        Function constructor runs, then validates them in one topological sweep. Only for
+    ///        bulk builders, such as deserializers, that do not read the types or shapes of the
+    ///        nodes they have just made.
+    class DeferValidation
+    {
+    public:
+        DeferValidation();
+        ~DeferValidation();
+
+        /// \brief True if nodes constructed on this thread now defer their validation
+        static bool is_active();
+
+    private:
+        DeferValidation(const DeferValidation&) = delete;
+        DeferValidation& operator=(const DeferValidation&) = delete;
+    };
+
     /// Nodes are the backbone of the graph of Value dataflow. Every node has
     /// zero or more nodes as arguments and one value, which is either a tensor
     /// or a (possibly empty) tuple of values.
@@ -109,8 +129,11 @@ namespace ngraph
         virtual void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) {}
     public:
         virtual ~Node();
-        void revalidate_and_infer_types() { validate_and_infer_types(); }
-        // Called after transition
+        /// \brief Re-run type inference after the node's inputs have changed. Does nothing if
+        ///        every input has the same source, element type and partial shape as when the
+        ///        node was last validated.
+        void revalidate_and_infer_types();
+        // Called after transition; also validates nodes built under a DeferValidation
         void delayed_validate_and_infer_types();
 
         /// \brief Produce a vector of constant nodes (one for each of this node's outputs) that
@@ -196,21 +219,36 @@ namespace ngraph
         virtual bool is_commutative() { return false; }
         virtual bool is_dynamic() const;
         size_t get_instance_id() const { return m_instance_id; }
+        /// \brief Merkle-style hash of the subgraph computing this node's outputs.
+        ///
+        /// Combines the node type, the element types and shapes of the outputs,
+        /// get_attribute_hash() and the hashes of the outputs the node reads. Structurally
+        /// equal subgraphs hash equal, but equal hashes do not imply equal subgraphs, so
+        /// users must still compare nodes on a match. Parameters hash by identity.
+        ///
+        /// The hash is cached on the node. replace_node() invalidates the hashes it makes
+        /// stale; other graph edits may leave a stale hash behind, which can only hide a
+        /// match.
+        size_t get_structural_hash();
+        bool has_cached_structural_hash() const { return m_structural_hash_valid; }
+        /// \brief Drops the cached structural hash of this node and of its users,
+        ///        transitively.
+        void invalidate_structural_hash();
         friend std::ostream& operator<<(std::ostream&, const Node&);
         virtual std::ostream& write_short_description(std::ostream&) const;
         virtual std::ostream& write_long_description(std::ostream&) const;
 
-        std::deque<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
+        StableVector<descriptor::Input>& get_inputs() NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        const std::deque<descriptor::Input>& get_inputs() const
+        const StableVector<descriptor::Input>& get_inputs() const
             NGRAPH_DEPRECATED("use inputs() instead")
         {
             return m_inputs;
         }
-        std::deque<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
-        const std::deque<descriptor::Output>& get_outputs() const
+        StableVector<descriptor::Output>& get_outputs() NGRAPH_DEPRECATED("use outputs() instead");
+        const StableVector<descriptor::Output>& get_outputs() const
             NGRAPH_DEPRECATED("use outputs() instead");
 
         /// Get control dependencies registered on the node
@@ -221,8 +259,16 @@ namespace ngraph
         void remove_control_dependency(std::shared_ptr<Node> node)
         {
             m_control_dependencies.erase(node);
+            notify_graph_modified();
         }
 
+        /// \brief Process-wide count of edge changes: rewired inputs and added or removed
+        ///        control dependencies. Caches of graph traversals are valid while it is
+        ///        unchanged.
+        static size_t get_graph_modification_count() { return m_graph_modification_count; }
+        /// \brief Bump the graph modification count after changing an edge of any graph
+        static void notify_graph_modified() { m_graph_modification_count++; }
+
         /// Returns the number of outputs from the node.
         size_t get_output_size() const;
 
@@ -367,21 +413,43 @@ namespace ngraph
 
     protected:
         void set_output_size(size_t n);
+        /// \brief Hash of the attributes that get_structural_hash() cannot see in the node's
+        ///        type, outputs and arguments, such as the values of a Constant.
+        virtual size_t get_attribute_hash() const { return 0; }
 
     private:
+        // What validate_and_infer_types last saw on one input
+        struct ValidatedInput
+        {
+            size_t m_source_id;
+            size_t m_source_index;
+            element::Type m_element_type;
+            PartialShape m_partial_shape;
+        };
+
+        void validate_and_record_inputs();
+        bool inputs_unchanged_since_validation() const;
+
         std::set<std::shared_ptr<Node>> m_control_dependencies;
+        std::vector<ValidatedInput> m_validated_inputs;
+        bool m_validated{false};
+        bool m_validation_deferred{false};
 
-        const std::string m_node_type;
+        // Interned, the nodes of a type share one string
+        const std::string& m_node_type;
         size_t m_instance_id;
         std::string m_friendly_name;
         const std::string m_unique_name;
         static std::atomic<size_t> m_next_instance_id;
-        std::unordered_set<std::string> m_provenance_tags;
-        std::deque<descriptor::Input> m_inputs;
-        std::deque<descriptor::Output> m_outputs;
-        std::unordered_map<Node*, autodiff::Adjoints> m_adjoint_map;
+        static std::atomic<size_t> m_graph_modification_count;
+        // Allocated by the first add_provenance_tag
+        std::unique_ptr<std::unordered_set<std::string>> m_provenance_tags;
+        StableVector<descriptor::Input> m_inputs;
+        StableVector<descriptor::Output> m_outputs;
         Placement m_placement = Placement::DEFAULT;
         size_t m_placement_index = placement_invalid;
+        size_t m_structural_hash = 0;
+        bool m_structural_hash_valid = false;
     };
 
     /// \brief A handle for one of a node's inputs.
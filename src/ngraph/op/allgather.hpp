@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Gathers the argument of every process, concatenated along axis 0 in rank
+        ///        order. The output is shard_count times larger than the argument.
+        class AllGather : public Op
+        {
+        public:
+            /// \param arg The shard of this process
+            /// \param shard_count The number of processes
+            AllGather(const std::shared_ptr<Node>& arg, size_t shard_count);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            size_t get_shard_count() const { return m_shard_count; }
+        private:
+            size_t m_shard_count;
+        };
+    }
+}
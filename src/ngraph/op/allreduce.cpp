@@ -19,8 +19,9 @@
 using namespace std;
 using namespace ngraph;
 
-op::AllReduce::AllReduce(const shared_ptr<Node>& arg)
+op::AllReduce::AllReduce(const shared_ptr<Node>& arg, const element::Type& compressed_type)
     : Op("AllReduce", check_single_output_args({arg}))
+    , m_compressed_type(compressed_type)
 {
     constructor_validate_and_infer_types();
 }
@@ -34,6 +35,22 @@ void op::AllReduce::validate_and_infer_types()
                           "Only element types f32 and f64 are supported (argument element type: ",
                           get_input_element_type(0),
                           ").");
+    if (is_compressed())
+    {
+        NODE_VALIDATION_CHECK(this,
+                              m_compressed_type == element::f16 ||
+                                  m_compressed_type == element::bf16,
+                              "Compressed type must be f16 or bf16 (compressed type: ",
+                              m_compressed_type,
+                              ").");
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(0).is_dynamic() ||
+                                  get_input_element_type(0) == element::f32,
+                              "Compression is only supported for element type f32 (argument "
+                              "element type: ",
+                              get_input_element_type(0),
+                              ").");
+    }
 
     set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
 }
@@ -41,5 +58,5 @@ void op::AllReduce::validate_and_infer_types()
 shared_ptr<Node> op::AllReduce::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<AllReduce>(new_args.at(0));
+    return make_shared<AllReduce>(new_args.at(0), m_compressed_type);
 }
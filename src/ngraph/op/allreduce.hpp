@@ -26,12 +26,25 @@ namespace ngraph
         class AllReduce : public Op
         {
         public:
-            AllReduce(const std::shared_ptr<Node>& arg);
+            /// \brief Constructs an all-reduce operation.
+            ///
+            /// \param arg The tensor to be summed over all processes.
+            /// \param compressed_type If f16 or bf16, an f32 \p arg is cast to this type for the
+            ///        collective, keeping the rounding error for the next call. The default,
+            ///        element::dynamic, reduces \p arg in its own type.
+            AllReduce(const std::shared_ptr<Node>& arg,
+                      const element::Type& compressed_type = element::dynamic);
 
             void validate_and_infer_types() override;
 
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+
+            const element::Type& get_compressed_type() const { return m_compressed_type; }
+            bool is_compressed() const { return m_compressed_type != element::dynamic; }
+
+        protected:
+            element::Type m_compressed_type;
         };
     }
 }
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <cmath>
+#include <cstdint>
 #include <cstdio>
 
 #include "ngraph/log.hpp"
@@ -49,105 +50,90 @@ op::Constant::~Constant()
 {
 }
 
-vector<string> op::Constant::get_value_strings() const
+size_t op::Constant::get_attribute_hash() const
 {
-    vector<string> rc;
+    // FNV-1a over the value bytes, so that CSE compares two large constants only when their
+    // values hash alike
+    size_t size = shape_size(m_shape) * m_element_type.size();
+    const unsigned char* bytes = static_cast<const unsigned char*>(get_data_ptr());
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; bytes && i < size; i++)
+    {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+}
 
+string op::Constant::convert_value_to_string(size_t index) const
+{
+    string rc;
 #pragma GCC diagnostic push
 #pragma GCC diagnostic error "-Wswitch"
 #pragma GCC diagnostic error "-Wswitch-enum"
     switch (get_element_type().get_type_enum())
     {
-    case element::Type_t::boolean:
-        for (int value : get_vector<char>())
-        {
-            rc.push_back(to_string(value));
-        }
-        break;
+    case element::Type_t::boolean: rc = to_string(get_data_ptr<char>()[index]); break;
     case element::Type_t::bf16:
-        for (bfloat16 value : get_vector<bfloat16>())
-        {
-            rc.push_back(to_cpp_string(static_cast<float>(value)));
-        }
+        rc = to_cpp_string(static_cast<float>(get_data_ptr<bfloat16>()[index]));
         break;
     case element::Type_t::f16:
-        for (float16 value : get_vector<float16>())
-        {
-            rc.push_back(to_cpp_string(static_cast<float>(value)));
-        }
-        break;
-    case element::Type_t::f32:
-        for (float value : get_vector<float>())
-        {
-            rc.push_back(to_cpp_string(value));
-        }
-        break;
-    case element::Type_t::f64:
-        for (double value : get_vector<double>())
-        {
-            rc.push_back(to_cpp_string(value));
-        }
-        break;
-    case element::Type_t::i8:
-        for (int value : get_vector<int8_t>())
-        {
-            rc.push_back(to_string(value));
-        }
-        break;
-    case element::Type_t::i16:
-        for (int value : get_vector<int16_t>())
-        {
-            rc.push_back(to_string(value));
-        }
-        break;
-    case element::Type_t::i32:
-        for (int32_t value : get_vector<int32_t>())
-        {
-            rc.push_back(to_string(value));
-        }
-        break;
-    case element::Type_t::i64:
-        for (int64_t value : get_vector<int64_t>())
-        {
-            rc.push_back(to_string(value));
-        }
-        break;
-    case element::Type_t::u8:
-        for (uint32_t value : get_vector<uint8_t>())
-        {
-            rc.push_back(to_string(value));
-        }
-        break;
-    case element::Type_t::u16:
-        for (uint32_t value : get_vector<uint16_t>())
-        {
-            rc.push_back(to_string(value));
-        }
-        break;
-    case element::Type_t::u32:
-        for (uint32_t value : get_vector<uint32_t>())
-        {
-            rc.push_back(to_string(value));
-        }
-        break;
-    case element::Type_t::u64:
-        for (uint64_t value : get_vector<uint64_t>())
-        {
-            rc.push_back(to_string(value));
-        }
-        break;
+        rc = to_cpp_string(static_cast<float>(get_data_ptr<float16>()[index]));
+        break;
+    case element::Type_t::f32: rc = to_cpp_string(get_data_ptr<float>()[index]); break;
+    case element::Type_t::f64: rc = to_cpp_string(get_data_ptr<double>()[index]); break;
+    case element::Type_t::i8: rc = to_string(get_data_ptr<int8_t>()[index]); break;
+    case element::Type_t::i16: rc = to_string(get_data_ptr<int16_t>()[index]); break;
+    case element::Type_t::i32: rc = to_string(get_data_ptr<int32_t>()[index]); break;
+    case element::Type_t::i64: rc = to_string(get_data_ptr<int64_t>()[index]); break;
+    case element::Type_t::u8: rc = to_string(get_data_ptr<uint8_t>()[index]); break;
+    case element::Type_t::u16: rc = to_string(get_data_ptr<uint16_t>()[index]); break;
+    case element::Type_t::u32: rc = to_string(get_data_ptr<uint32_t>()[index]); break;
+    case element::Type_t::u64: rc = to_string(get_data_ptr<uint64_t>()[index]); break;
     case element::Type_t::undefined: throw runtime_error("unsupported type");
     case element::Type_t::dynamic: throw runtime_error("unsupported type");
     }
 #pragma GCC diagnostic pop
+    return rc;
+}
 
+vector<string> op::Constant::get_value_strings() const
+{
+    vector<string> rc;
+    size_t count = shape_size(m_shape);
+    rc.reserve(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        rc.push_back(convert_value_to_string(i));
+    }
     return rc;
 }
 
 shared_ptr<Node> op::Constant::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<Constant>(m_element_type, m_shape, m_data->get_ptr());
+    return make_shared<Constant>(m_element_type, m_shape, m_data);
+}
+
+bool op::Constant::make_data_unique()
+{
+    if (!is_data_shared())
+    {
+        return false;
+    }
+    auto data = make_shared<runtime::AlignedBuffer>(m_data->size(), host_alignment());
+    std::memcpy(data->get_ptr(), m_data->get_ptr(), m_data->size());
+    m_data = data;
+    return true;
+}
+
+void op::Constant::share_data(const shared_ptr<runtime::AlignedBuffer>& data)
+{
+    NGRAPH_CHECK(data != nullptr && m_data != nullptr && data->size() == m_data->size() &&
+                     std::memcmp(data->get_ptr(), m_data->get_ptr(), m_data->size()) == 0,
+                 "Constant ",
+                 get_name(),
+                 " can only share a buffer holding the same data");
+    m_data = data;
 }
 
 template <typename T>
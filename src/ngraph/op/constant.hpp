@@ -144,6 +144,53 @@ namespace ngraph
                 constructor_validate_and_infer_types();
             }
 
+            /// \brief Constructs a tensor constant that uses \p data as its storage without
+            ///        copying it, e.g. a view of a memory-mapped model file.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data Buffer holding exactly the constant's data.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     std::unique_ptr<runtime::AlignedBuffer> data)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_data(std::move(data))
+            {
+                NODE_VALIDATION_CHECK(this,
+                                      m_data->size() == shape_size(m_shape) * m_element_type.size(),
+                                      "Constant buffer holds ",
+                                      m_data->size(),
+                                      " bytes, expected ",
+                                      shape_size(m_shape) * m_element_type.size());
+                constructor_validate_and_infer_types();
+            }
+
+            /// \brief Constructs a tensor constant that shares \p data with the other Constants
+            ///        holding it. Copies of a Constant share its data this way, so a Function
+            ///        compiled several times keeps one copy of its weights.
+            ///
+            /// \param type The element type of the tensor constant.
+            /// \param shape The shape of the tensor constant.
+            /// \param data Buffer holding exactly the constant's data.
+            Constant(const element::Type& type,
+                     const Shape& shape,
+                     const std::shared_ptr<runtime::AlignedBuffer>& data)
+                : Node("Constant", {})
+                , m_element_type(type)
+                , m_shape(shape)
+                , m_data(data)
+            {
+                NODE_VALIDATION_CHECK(this,
+                                      m_data->size() == shape_size(m_shape) * m_element_type.size(),
+                                      "Constant buffer holds ",
+                                      m_data->size(),
+                                      " bytes, expected ",
+                                      shape_size(m_shape) * m_element_type.size());
+                constructor_validate_and_infer_types();
+            }
+
             virtual ~Constant() override;
 
             void validate_and_infer_types() override
@@ -186,21 +233,50 @@ namespace ngraph
             /// \return The initialization literals for the tensor constant.
             std::vector<std::string> get_value_strings() const;
 
+            /// \return The initialization literal of the element at index, which is cheaper than
+            ///         get_value_strings when only a few values are needed.
+            std::string convert_value_to_string(size_t index) const;
+
+            /// \brief A read-only view of the values of a Constant. It does not copy the values
+            ///        and stays valid as long as the Constant holds its data.
             template <typename T>
-            std::vector<T> get_vector() const
+            class Values
             {
-                if (sizeof(T) > m_element_type.size() && shape_size(m_shape) > 0)
+            public:
+                Values(const T* data, size_t size)
+                    : m_data(data)
+                    , m_size(size)
                 {
-                    throw ngraph_error("Buffer over-read");
                 }
 
-                std::vector<T> rc;
-                const T* p = reinterpret_cast<const T*>(m_data->get_ptr());
-                for (size_t i = 0; i < shape_size(m_shape); i++)
+                const T* data() const { return m_data; }
+                size_t size() const { return m_size; }
+                bool empty() const { return m_size == 0; }
+                const T* begin() const { return m_data; }
+                const T* end() const { return m_data + m_size; }
+                const T& operator[](size_t index) const { return m_data[index]; }
+
+            private:
+                const T* m_data;
+                size_t m_size;
+            };
+
+            /// \return A view of the values of the tensor constant, without copying them.
+            template <typename T>
+            Values<T> get_values() const
+            {
+                if (sizeof(T) > m_element_type.size() && shape_size(m_shape) > 0)
                 {
-                    rc.push_back(p[i]);
+                    throw ngraph_error("Buffer over-read");
                 }
-                return rc;
+                return Values<T>(get_data_ptr<T>(), shape_size(m_shape));
+            }
+
+            template <typename T>
+            std::vector<T> get_vector() const
+            {
+                auto values = get_values<T>();
+                return std::vector<T>(values.begin(), values.end());
             }
 
             const void* get_data_ptr() const { return (m_data ? m_data->get_ptr() : nullptr); }
@@ -210,10 +286,29 @@ namespace ngraph
                 return reinterpret_cast<const T*>(get_data_ptr());
             }
 
+            /// \brief The alignment of the buffers Constants allocate for their data
+            static constexpr size_t host_alignment() { return 64; }
             bool is_constant() const override { return true; }
             bool are_all_data_elements_bitwise_identical() const;
 
+            /// \brief Whether the data is shared with other Constants, such as copies of this one
+            bool is_data_shared() const { return m_data.use_count() > 1; }
+            /// \brief Gives this Constant a private copy of its data if the data is shared, so
+            ///        that writing through get_data_ptr changes this Constant only. Backends
+            ///        that update constant values in place call this first.
+            /// \return true if the data was copied, which moves it
+            bool make_data_unique();
+            /// \brief The buffer holding the data
+            const std::shared_ptr<runtime::AlignedBuffer>& get_data_buffer() const
+            {
+                return m_data;
+            }
+            /// \brief Makes this Constant hold \p data instead of its own buffer, so that equal
+            ///        Constants keep one copy of their data. \p data must hold the same bytes.
+            void share_data(const std::shared_ptr<runtime::AlignedBuffer>& data);
+
         protected:
+            size_t get_attribute_hash() const override;
             void* get_data_ptr_nc() { return (m_data ? m_data->get_ptr() : nullptr); }
             Constant(const std::string& name, const NodeVector& args)
                 : Node(name, args)
@@ -300,10 +395,9 @@ namespace ngraph
 #pragma GCC diagnostic pop
             }
 
-            static constexpr size_t host_alignment() { return 64; }
             element::Type m_element_type;
             Shape m_shape{};
-            std::unique_ptr<runtime::AlignedBuffer> m_data;
+            std::shared_ptr<runtime::AlignedBuffer> m_data;
             Constant(const Constant&) = delete;
             Constant operator=(const Constant&) = delete;
         };
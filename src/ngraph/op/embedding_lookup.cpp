@@ -31,6 +31,39 @@ void op::EmbeddingLookup::validate_and_infer_types()
                               static_cast<size_t>(arg1_shape.rank()) == 2,
                           "weights are expected to be a matrix");
 
+    if (is_quantized())
+    {
+        element::Type weights_et = get_input_element_type(1);
+        NODE_VALIDATION_CHECK(this,
+                              weights_et.is_dynamic() || weights_et == element::i8 ||
+                                  weights_et == element::u8 || weights_et == element::f16,
+                              "quantized weights are expected to be i8, u8 or f16, got ",
+                              weights_et);
+
+        NODE_VALIDATION_CHECK(this,
+                              element::Type::merge(result_et,
+                                                   get_input_element_type(2),
+                                                   get_input_element_type(3)),
+                              "scale and bias element types do not match");
+        NODE_VALIDATION_CHECK(this,
+                              result_et.is_dynamic() || result_et.is_real(),
+                              "scale and bias are expected to be real, got ",
+                              result_et);
+
+        PartialShape rows_shape{arg1_shape.rank().is_static() ? arg1_shape[0]
+                                                              : Dimension::dynamic()};
+        for (size_t i = 2; i < 4; i++)
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  PartialShape::merge_into(rows_shape, get_input_partial_shape(i)),
+                                  "scale and bias are expected to have one element per row of "
+                                  "the weights, got shapes ",
+                                  get_input_partial_shape(2),
+                                  " and ",
+                                  get_input_partial_shape(3));
+        }
+    }
+
     PartialShape result_shape;
     if (arg0_shape.rank().is_static())
     {
@@ -55,5 +88,62 @@ void op::EmbeddingLookup::validate_and_infer_types()
 shared_ptr<Node> op::EmbeddingLookup::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
+    if (is_quantized())
+    {
+        return make_shared<EmbeddingLookup>(
+            new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3));
+    }
     return make_shared<EmbeddingLookup>(new_args.at(0), new_args.at(1));
 }
+
+void op::EmbeddingLookup::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    if (is_quantized())
+    {
+        throw ngraph_error("Quantized EmbeddingLookup weights are not differentiable");
+    }
+
+    auto delta = deltas.at(0);
+    auto data = get_argument(0);
+    auto weights = get_argument(1);
+
+    // the indices are not differentiable
+    adjoints.add_delta(
+        weights, make_shared<EmbeddingLookupBackprop>(data, delta, weights->get_shape()));
+}
+
+void op::EmbeddingLookupBackprop::validate_and_infer_types()
+{
+    const PartialShape& data_shape = get_input_partial_shape(0);
+    const PartialShape& delta_shape = get_input_partial_shape(1);
+
+    NODE_VALIDATION_CHECK(
+        this, m_weights_shape.size() == 2, "weights are expected to be a matrix");
+
+    PartialShape expected_delta_shape = PartialShape::dynamic();
+    if (data_shape.rank().is_static())
+    {
+        std::vector<Dimension> delta_dims(static_cast<size_t>(data_shape.rank()) + 1);
+        for (size_t i = 0; i < static_cast<size_t>(data_shape.rank()); i++)
+        {
+            delta_dims[i] = data_shape[i];
+        }
+        delta_dims[delta_dims.size() - 1] = m_weights_shape[1];
+        expected_delta_shape = PartialShape(delta_dims);
+    }
+    NODE_VALIDATION_CHECK(this,
+                          delta_shape.compatible(expected_delta_shape),
+                          "Delta shape ",
+                          delta_shape,
+                          " does not match the output shape of the lookup ",
+                          expected_delta_shape,
+                          ".");
+
+    set_output_type(0, get_input_element_type(1), m_weights_shape);
+}
+
+shared_ptr<Node> op::EmbeddingLookupBackprop::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<EmbeddingLookupBackprop>(new_args.at(0), new_args.at(1), m_weights_shape);
+}
@@ -42,15 +42,69 @@ namespace ngraph
                 constructor_validate_and_infer_types();
             }
 
+            /// \brief Constructs a EmbeddingLookup operation on a quantized weights matrix.
+            ///
+            /// Row i of the weights is stored as i8, u8 or f16 and stands for
+            /// weights[i] * scale[i] + bias[i], which is computed only for the rows looked up.
+            ///
+            /// \param data The input indices for tokens to be translated into embeddings
+            /// \param weights is the quantized matrix [N,M]
+            /// \param scale is the vector [N] of the scales of the rows, whose real element type
+            /// is the element type of the result
+            /// \param bias is the vector [N] of the biases of the rows
+            EmbeddingLookup(const std::shared_ptr<Node>& data,
+                            const std::shared_ptr<Node>& weights,
+                            const std::shared_ptr<Node>& scale,
+                            const std::shared_ptr<Node>& bias)
+                : Op("EmbeddingLookup", check_single_output_args({data, weights, scale, bias}))
+            {
+                constructor_validate_and_infer_types();
+            }
+
             void validate_and_infer_types() override;
 
-            void generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas) override
+            /// \return true if the weights are quantized and come with a scale and bias
+            bool is_quantized() const { return get_input_size() == 4; }
+
+            void generate_adjoints(autodiff::Adjoints& adjoints,
+                                   const NodeVector& deltas) override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+        };
+
+        // \brief Gradient of EmbeddingLookup with respect to the weights
+        class EmbeddingLookupBackprop : public Op
+        {
+        public:
+            /// \brief Constructs a EmbeddingLookupBackprop operation.
+            ///
+            /// The result is a dense matrix of \p weights_shape, zero except for the rows
+            /// selected by \p data, which hold the sum of the rows of \p delta looked up
+            /// through them. Repeated indices accumulate.
+            ///
+            /// \param data The input indices of the forward EmbeddingLookup
+            /// \param delta The gradient of the EmbeddingLookup output, shaped as
+            /// data's shape with the embedding length appended
+            /// \param weights_shape The shape [N,M] of the weights matrix
+            EmbeddingLookupBackprop(const std::shared_ptr<Node>& data,
+                                    const std::shared_ptr<Node>& delta,
+                                    const Shape& weights_shape)
+                : Op("EmbeddingLookupBackprop", check_single_output_args({data, delta}))
+                , m_weights_shape(weights_shape)
             {
-                throw ngraph_error("Not yet implemented");
+                constructor_validate_and_infer_types();
             }
 
+            void validate_and_infer_types() override;
+
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
+
+            const Shape& get_weights_shape() const { return m_weights_shape; }
+
+        protected:
+            Shape m_weights_shape;
         };
     }
 }
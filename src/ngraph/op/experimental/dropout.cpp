@@ -0,0 +1,119 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/experimental/dropout.hpp"
+#include "ngraph/op/get_output_element.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::Dropout::Dropout(const shared_ptr<Node>& arg,
+                     const shared_ptr<Node>& training,
+                     unsigned int seed,
+                     double keep_probability)
+    : Op("Dropout", check_single_output_args({arg, training}))
+    , m_seed(seed)
+    , m_keep_probability(keep_probability)
+{
+    constructor_validate_and_infer_types();
+}
+
+shared_ptr<Node> op::Dropout::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<Dropout>(new_args.at(0), new_args.at(1), m_seed, m_keep_probability);
+}
+
+void op::Dropout::validate_and_infer_types()
+{
+    const element::Type& element_type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          element_type.is_dynamic() || element_type.is_real(),
+                          "Argument must have a floating point element type, got ",
+                          element_type);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1).compatible(element_type),
+                          "Training flag element type ",
+                          get_input_element_type(1),
+                          " does not match the argument element type ",
+                          element_type);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(1).compatible(PartialShape{}),
+                          "Training node should be a scalar flag indicating a mode");
+    NODE_VALIDATION_CHECK(this,
+                          m_keep_probability > 0.0 && m_keep_probability <= 1.0,
+                          "Keep probability must be in (0, 1], got ",
+                          m_keep_probability);
+
+    set_output_size(2);
+    set_output_type(0, element_type, get_input_partial_shape(0));
+    set_output_type(1, element::u64, Shape{});
+}
+
+void op::Dropout::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    auto offset = make_shared<op::GetOutputElement>(shared_from_this(), 1);
+    adjoints.add_delta(get_argument(0),
+                       make_shared<DropoutBackprop>(
+                           deltas.at(0), get_argument(1), offset, m_seed, m_keep_probability));
+}
+
+op::DropoutBackprop::DropoutBackprop(const shared_ptr<Node>& delta,
+                                     const shared_ptr<Node>& training,
+                                     const shared_ptr<Node>& offset,
+                                     unsigned int seed,
+                                     double keep_probability)
+    : Op("DropoutBackprop", check_single_output_args({delta, training, offset}))
+    , m_seed(seed)
+    , m_keep_probability(keep_probability)
+{
+    constructor_validate_and_infer_types();
+}
+
+shared_ptr<Node> op::DropoutBackprop::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<DropoutBackprop>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_seed, m_keep_probability);
+}
+
+void op::DropoutBackprop::validate_and_infer_types()
+{
+    const element::Type& element_type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          element_type.is_dynamic() || element_type.is_real(),
+                          "Delta must have a floating point element type, got ",
+                          element_type);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1).compatible(element_type),
+                          "Training flag element type ",
+                          get_input_element_type(1),
+                          " does not match the delta element type ",
+                          element_type);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(1).compatible(PartialShape{}),
+                          "Training node should be a scalar flag indicating a mode");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(2).compatible(element::u64) &&
+                              get_input_partial_shape(2).compatible(PartialShape{}),
+                          "Offset must be the u64 scalar output of a Dropout");
+    NODE_VALIDATION_CHECK(this,
+                          m_keep_probability > 0.0 && m_keep_probability <= 1.0,
+                          "Keep probability must be in (0, 1], got ",
+                          m_keep_probability);
+
+    set_output_type(0, element_type, get_input_partial_shape(0));
+}
@@ -0,0 +1,91 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Inverted dropout: in training mode each element of the input is kept with
+        ///        probability keep_probability and scaled by 1 / keep_probability, or zeroed.
+        ///
+        /// The mask is drawn from the counter-based generator of RNGState and is not stored.
+        /// Output 0 is the result, output 1 is a u64 scalar holding the first counter of the
+        /// mask, from which DropoutBackprop regenerates the same mask. In inference mode the
+        /// input is passed through.
+        class Dropout : public op::Op
+        {
+        public:
+            /// \brief Constructs a Dropout operation.
+            ///
+            /// \param arg The input tensor
+            /// \param training Scalar flag of the same element type, non-zero in training mode
+            /// \param seed Seed of the mask generator
+            /// \param keep_probability Probability of an element being kept, in (0, 1]
+            Dropout(const std::shared_ptr<Node>& arg,
+                    const std::shared_ptr<Node>& training,
+                    unsigned int seed,
+                    double keep_probability);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            unsigned int get_seed() const { return m_seed; }
+            double get_keep_probability() const { return m_keep_probability; }
+        protected:
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+
+            void validate_and_infer_types() override;
+            unsigned int m_seed;
+            double m_keep_probability;
+        };
+
+        /// \brief Applies to a delta the mask a Dropout drew from the counters starting at
+        ///        offset, regenerating it instead of reading it back.
+        class DropoutBackprop : public op::Op
+        {
+        public:
+            /// \brief Constructs a DropoutBackprop operation.
+            ///
+            /// \param delta The delta of the Dropout output
+            /// \param training The training flag of the Dropout
+            /// \param offset Output 1 of the Dropout
+            /// \param seed Seed of the Dropout
+            /// \param keep_probability Keep probability of the Dropout
+            DropoutBackprop(const std::shared_ptr<Node>& delta,
+                            const std::shared_ptr<Node>& training,
+                            const std::shared_ptr<Node>& offset,
+                            unsigned int seed,
+                            double keep_probability);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            unsigned int get_seed() const { return m_seed; }
+            double get_keep_probability() const { return m_keep_probability; }
+        protected:
+            void validate_and_infer_types() override;
+            unsigned int m_seed;
+            double m_keep_probability;
+        };
+    }
+}
@@ -0,0 +1,173 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/experimental/if.hpp"
+#include "ngraph/autodiff/adjoints.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/parameter.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static NodeVector prepend(const shared_ptr<Node>& first, const NodeVector& rest)
+{
+    NodeVector args{first};
+    args.insert(args.end(), rest.begin(), rest.end());
+    return args;
+}
+
+op::If::If(const shared_ptr<Node>& condition,
+           const NodeVector& args,
+           const shared_ptr<Function>& then_body,
+           const shared_ptr<Function>& else_body)
+    : Op("If", check_single_output_args(prepend(condition, args)))
+    , m_then_body(then_body)
+    , m_else_body(else_body)
+{
+    constructor_validate_and_infer_types();
+}
+
+shared_ptr<Node> op::If::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<If>(new_args.at(0),
+                           NodeVector(new_args.begin() + 1, new_args.end()),
+                           clone_function(*m_then_body),
+                           clone_function(*m_else_body));
+}
+
+vector<shared_ptr<Function>> op::If::get_functions() const
+{
+    return vector<shared_ptr<Function>>{m_then_body, m_else_body};
+}
+
+void op::If::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0).compatible(element::boolean) &&
+                              get_input_partial_shape(0).compatible(PartialShape{}),
+                          "Condition must be a boolean scalar, got ",
+                          get_input_element_type(0),
+                          " ",
+                          get_input_partial_shape(0));
+
+    for (auto body : {m_then_body, m_else_body})
+    {
+        NODE_VALIDATION_CHECK(this, body != nullptr, "Both bodies must be given");
+        const ParameterVector& params = body->get_parameters();
+        NODE_VALIDATION_CHECK(this,
+                              params.size() == get_input_size() - 1,
+                              "Body ",
+                              body->get_name(),
+                              " has ",
+                              params.size(),
+                              " parameters for ",
+                              get_input_size() - 1,
+                              " arguments");
+        for (size_t i = 0; i < params.size(); i++)
+        {
+            NODE_VALIDATION_CHECK(
+                this,
+                params[i]->get_element_type().compatible(get_input_element_type(i + 1)) &&
+                    params[i]->get_output_partial_shape(0).compatible(
+                        get_input_partial_shape(i + 1)),
+                "Parameter ",
+                i,
+                " of body ",
+                body->get_name(),
+                " does not match argument ",
+                i,
+                " (",
+                get_input_element_type(i + 1),
+                " ",
+                get_input_partial_shape(i + 1),
+                ")");
+        }
+    }
+
+    size_t output_count = m_then_body->get_output_size();
+    NODE_VALIDATION_CHECK(this,
+                          m_else_body->get_output_size() == output_count,
+                          "The bodies return ",
+                          output_count,
+                          " and ",
+                          m_else_body->get_output_size(),
+                          " results");
+
+    set_output_size(output_count);
+    for (size_t i = 0; i < output_count; i++)
+    {
+        element::Type element_type;
+        NODE_VALIDATION_CHECK(this,
+                              element::Type::merge(element_type,
+                                                   m_then_body->get_output_element_type(i),
+                                                   m_else_body->get_output_element_type(i)),
+                              "Result ",
+                              i,
+                              " has element type ",
+                              m_then_body->get_output_element_type(i),
+                              " in then_body and ",
+                              m_else_body->get_output_element_type(i),
+                              " in else_body");
+        PartialShape shape = m_then_body->get_output_partial_shape(i);
+        if (!PartialShape::merge_into(shape, m_else_body->get_output_partial_shape(i)))
+        {
+            shape = PartialShape::dynamic();
+        }
+        set_output_type(i, element_type, shape);
+    }
+}
+
+// The backprop function of body takes the parameters of body followed by one delta per
+// result, and returns the adjoint of each parameter
+static shared_ptr<Function> make_backprop_body(const Function& body)
+{
+    auto forward = clone_function(body);
+    NodeVector ys;
+    NodeVector cs;
+    ParameterVector params = forward->get_parameters();
+    for (auto& result : forward->get_results())
+    {
+        auto c = make_shared<op::Parameter>(result->get_input_element_type(0),
+                                            result->get_input_shape(0));
+        ys.push_back(result->get_argument(0));
+        cs.push_back(c);
+        params.push_back(c);
+    }
+    autodiff::Adjoints adjoints(ys, cs);
+    NodeVector dxs;
+    for (auto& x : forward->get_parameters())
+    {
+        dxs.push_back(adjoints.backprop_node(x));
+    }
+    return make_shared<Function>(dxs, params);
+}
+
+void op::If::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    NodeVector args = get_arguments();
+    NodeVector backprop_args(args.begin() + 1, args.end());
+    backprop_args.insert(backprop_args.end(), deltas.begin(), deltas.end());
+    auto backprop = make_shared<If>(args.at(0),
+                                    backprop_args,
+                                    make_backprop_body(*m_then_body),
+                                    make_backprop_body(*m_else_body));
+    for (size_t i = 1; i < args.size(); i++)
+    {
+        adjoints.add_delta(args[i], make_shared<op::GetOutputElement>(backprop, i - 1));
+    }
+}
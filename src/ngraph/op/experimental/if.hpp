@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Runs one of two functions on the same arguments, chosen by a boolean scalar.
+        ///
+        /// Both bodies take one parameter per argument, with the argument's element type and
+        /// shape, and return results of the same element types. An output has the shape of
+        /// the corresponding results when both bodies agree on it, otherwise it is dynamic.
+        class If : public op::Op
+        {
+        public:
+            /// \brief Constructs an If operation.
+            ///
+            /// \param condition Boolean scalar, then_body runs when it is true
+            /// \param args The arguments passed to the parameters of the body that runs
+            /// \param then_body The function run when condition is true
+            /// \param else_body The function run when condition is false
+            If(const std::shared_ptr<Node>& condition,
+               const NodeVector& args,
+               const std::shared_ptr<Function>& then_body,
+               const std::shared_ptr<Function>& else_body);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            std::vector<std::shared_ptr<Function>> get_functions() const override;
+
+            const std::shared_ptr<Function>& get_then_body() const { return m_then_body; }
+            const std::shared_ptr<Function>& get_else_body() const { return m_else_body; }
+        protected:
+            /// The adjoint is an If on the same condition whose bodies are the backprop
+            /// functions of then_body and else_body.
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+
+            void validate_and_infer_types() override;
+            std::shared_ptr<Function> m_then_body;
+            std::shared_ptr<Function> m_else_body;
+        };
+    }
+}
@@ -67,6 +67,8 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
+            const DetectionOutputAttrs& get_attrs() const { return m_attrs; }
+
         private:
             DetectionOutputAttrs m_attrs;
         };
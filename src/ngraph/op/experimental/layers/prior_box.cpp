@@ -17,6 +17,7 @@
 #include "prior_box.hpp"
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/reference/prior_box.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -101,6 +102,45 @@ void op::PriorBox::validate_and_infer_types()
     }
 }
 
+vector<shared_ptr<op::Constant>> op::PriorBox::as_constants() const
+{
+    auto layer_shape = dynamic_pointer_cast<op::Constant>(get_argument(0));
+    auto image_shape = dynamic_pointer_cast<op::Constant>(get_argument(1));
+    if (!layer_shape || !image_shape || shape_size(layer_shape->get_shape()) != 2 ||
+        shape_size(image_shape->get_shape()) != 2)
+    {
+        return {};
+    }
+    auto layer = layer_shape->get_vector<int64_t>();
+    auto image = image_shape->get_vector<int64_t>();
+    size_t count = runtime::reference::prior_box_count(
+        m_min_sizes, m_max_sizes, m_aspect_ratios, m_flip, m_scale_all);
+    Shape shape{2, 4 * layer[0] * layer[1] * count};
+    // The output shape counts every given aspect ratio, so it is only that of the boxes when
+    // the ratios are distinct
+    if (get_output_partial_shape(0).is_static() && get_output_shape(0) != shape)
+    {
+        return {};
+    }
+
+    vector<float> boxes(shape_size(shape));
+    runtime::reference::prior_box(boxes.data(),
+                                  layer[0],
+                                  layer[1],
+                                  image[0],
+                                  image[1],
+                                  m_min_sizes,
+                                  m_max_sizes,
+                                  m_aspect_ratios,
+                                  m_clip,
+                                  m_flip,
+                                  m_step,
+                                  m_offset,
+                                  m_variances,
+                                  m_scale_all);
+    return {make_shared<op::Constant>(element::f32, shape, boxes)};
+}
+
 shared_ptr<Node> op::PriorBox::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
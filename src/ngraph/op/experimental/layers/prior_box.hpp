@@ -57,6 +57,18 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
+            /// \brief The prior boxes, when the layer and image shapes are constants
+            virtual std::vector<std::shared_ptr<op::Constant>> as_constants() const override;
+
+            const std::vector<float>& get_min_sizes() const { return m_min_sizes; }
+            const std::vector<float>& get_max_sizes() const { return m_max_sizes; }
+            const std::vector<float>& get_aspect_ratios() const { return m_aspect_ratios; }
+            bool get_clip() const { return m_clip; }
+            bool get_flip() const { return m_flip; }
+            float get_step() const { return m_step; }
+            float get_offset() const { return m_offset; }
+            const std::vector<float>& get_variances() const { return m_variances; }
+            bool get_scale_all() const { return m_scale_all; }
         private:
             std::vector<float> m_min_sizes;
             std::vector<float> m_max_sizes;
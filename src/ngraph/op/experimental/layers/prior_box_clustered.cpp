@@ -17,6 +17,7 @@
 #include "prior_box_clustered.hpp"
 
 #include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/reference/prior_box_clustered.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -102,6 +103,35 @@ void op::PriorBoxClustered::validate_and_infer_types()
     }
 }
 
+vector<shared_ptr<op::Constant>> op::PriorBoxClustered::as_constants() const
+{
+    auto layer_shape = dynamic_pointer_cast<op::Constant>(get_argument(0));
+    auto image_shape = dynamic_pointer_cast<op::Constant>(get_argument(1));
+    if (!layer_shape || !image_shape || shape_size(layer_shape->get_shape()) != 2 ||
+        shape_size(image_shape->get_shape()) != 2)
+    {
+        return {};
+    }
+    auto layer = layer_shape->get_vector<int64_t>();
+    auto image = image_shape->get_vector<int64_t>();
+    Shape shape{2, 4 * layer[0] * layer[1] * m_num_priors};
+
+    vector<float> boxes(shape_size(shape));
+    runtime::reference::prior_box_clustered(boxes.data(),
+                                            layer[0],
+                                            layer[1],
+                                            image[0],
+                                            image[1],
+                                            m_widths,
+                                            m_heights,
+                                            m_clip,
+                                            m_step_widths,
+                                            m_step_heights,
+                                            m_offset,
+                                            m_variances);
+    return {make_shared<op::Constant>(element::f32, shape, boxes)};
+}
+
 shared_ptr<Node> op::PriorBoxClustered::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
@@ -55,6 +55,17 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
+            /// \brief The prior boxes, when the layer and image shapes are constants
+            virtual std::vector<std::shared_ptr<op::Constant>> as_constants() const override;
+
+            size_t get_num_priors() const { return m_num_priors; }
+            const std::vector<float>& get_widths() const { return m_widths; }
+            const std::vector<float>& get_heights() const { return m_heights; }
+            bool get_clip() const { return m_clip; }
+            float get_step_widths() const { return m_step_widths; }
+            float get_step_heights() const { return m_step_heights; }
+            float get_offset() const { return m_offset; }
+            const std::vector<float>& get_variances() const { return m_variances; }
         private:
             size_t m_num_priors;
             std::vector<float> m_widths;
@@ -66,22 +66,24 @@ void op::Proposal::validate_and_infer_types()
                           "image shape input must have element type i64, but has ",
                           image_shape_et);
 
-    set_input_is_relevant_to_shape(2);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(2).compatible(PartialShape{2}),
+                          "image shape input must hold the image height and width, but has shape ",
+                          get_input_partial_shape(2));
 
-    if (auto const_shape = dynamic_pointer_cast<op::Constant>(get_argument(2)))
+    // post_nms_topn proposals for each image of the batch
+    const PartialShape& class_probs_shape = get_input_partial_shape(0);
+    if (class_probs_shape.rank().is_static() && static_cast<size_t>(class_probs_shape.rank()) > 0 &&
+        class_probs_shape[0].is_static())
     {
-        NODE_VALIDATION_CHECK(this,
-                              shape_size(const_shape->get_shape()) == 2,
-                              "Layer shape must have rank 2",
-                              const_shape->get_shape());
-
-        auto image_shape = static_cast<const int64_t*>(const_shape->get_data_ptr());
-
-        set_output_type(0, element::f32, Shape{image_shape[0] * m_post_nms_topn, 5});
+        set_output_type(
+            0,
+            element::f32,
+            Shape{static_cast<size_t>(class_probs_shape[0]) * m_post_nms_topn, 5});
     }
     else
     {
-        set_output_type(0, element::f32, PartialShape::dynamic());
+        set_output_type(0, element::f32, PartialShape{Dimension::dynamic(), 5});
     }
 }
 
@@ -29,7 +29,7 @@ namespace ngraph
             ///
             /// \param class_probs     Class probability scores
             /// \param class_logits    Class prediction logits
-            /// \param image_shape     Shape of image
+            /// \param image_shape     Height and width of the image, i64
             /// \param base_size       Anchor sizes
             /// \param pre_nms_topn    Number of boxes before nms
             /// \param post_nms_topn   Number of boxes after nms
@@ -67,6 +67,21 @@ namespace ngraph
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
+            size_t get_base_size() const { return m_base_size; }
+            size_t get_pre_nms_topn() const { return m_pre_nms_topn; }
+            size_t get_post_nms_topn() const { return m_post_nms_topn; }
+            float get_nms_threshold() const { return m_nms_threshold; }
+            size_t get_feature_stride() const { return m_feature_stride; }
+            size_t get_min_size() const { return m_min_size; }
+            const std::vector<float>& get_anchor_ratios() const { return m_anchor_ratios; }
+            const std::vector<float>& get_anchor_scales() const { return m_anchor_scales; }
+            bool get_clip_before_nms() const { return m_clip_before_nms; }
+            bool get_clip_after_nms() const { return m_clip_after_nms; }
+            bool get_normalize() const { return m_normalize; }
+            float get_box_size_scale() const { return m_box_size_scale; }
+            float get_box_coord_scale() const { return m_box_coord_scale; }
+            const std::string& get_algo() const { return m_algo; }
+
         private:
             size_t m_base_size;
             size_t m_pre_nms_topn;
@@ -0,0 +1,154 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/experimental/loop.hpp"
+#include "ngraph/graph_util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static NodeVector concat_args(const shared_ptr<Node>& trip_count,
+                              const shared_ptr<Node>& condition,
+                              const NodeVector& carried,
+                              const NodeVector& invariants)
+{
+    NodeVector args{trip_count, condition};
+    args.insert(args.end(), carried.begin(), carried.end());
+    args.insert(args.end(), invariants.begin(), invariants.end());
+    return args;
+}
+
+op::Loop::Loop(const shared_ptr<Node>& trip_count,
+               const shared_ptr<Node>& condition,
+               const NodeVector& carried,
+               const NodeVector& invariants,
+               const shared_ptr<Function>& body)
+    : Op("Loop", check_single_output_args(concat_args(trip_count, condition, carried, invariants)))
+    , m_body(body)
+    , m_carried_count(carried.size())
+{
+    constructor_validate_and_infer_types();
+}
+
+shared_ptr<Node> op::Loop::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    auto carried_end = new_args.begin() + 2 + m_carried_count;
+    return make_shared<Loop>(new_args.at(0),
+                             new_args.at(1),
+                             NodeVector(new_args.begin() + 2, carried_end),
+                             NodeVector(carried_end, new_args.end()),
+                             clone_function(*m_body));
+}
+
+vector<shared_ptr<Function>> op::Loop::get_functions() const
+{
+    return vector<shared_ptr<Function>>{m_body};
+}
+
+void op::Loop::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0).compatible(element::i64) &&
+                              get_input_partial_shape(0).compatible(PartialShape{}),
+                          "Trip count must be an i64 scalar, got ",
+                          get_input_element_type(0),
+                          " ",
+                          get_input_partial_shape(0));
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1).compatible(element::boolean) &&
+                              get_input_partial_shape(1).compatible(PartialShape{}),
+                          "Condition must be a boolean scalar, got ",
+                          get_input_element_type(1),
+                          " ",
+                          get_input_partial_shape(1));
+    NODE_VALIDATION_CHECK(this, m_body != nullptr, "A body must be given");
+
+    // The body takes the iteration number then the arguments after trip count and condition
+    const ParameterVector& params = m_body->get_parameters();
+    NODE_VALIDATION_CHECK(this,
+                          params.size() == get_input_size() - 1,
+                          "Body has ",
+                          params.size(),
+                          " parameters, expected ",
+                          get_input_size() - 1,
+                          " for the iteration number, ",
+                          m_carried_count,
+                          " loop-carried and ",
+                          get_input_size() - 2 - m_carried_count,
+                          " invariant values");
+    NODE_VALIDATION_CHECK(this,
+                          params[0]->get_element_type().compatible(element::i64) &&
+                              params[0]->get_output_partial_shape(0).compatible(PartialShape{}),
+                          "Parameter 0 of the body, the iteration number, must be an i64 scalar");
+    for (size_t i = 1; i < params.size(); i++)
+    {
+        NODE_VALIDATION_CHECK(
+            this,
+            params[i]->get_element_type().compatible(get_input_element_type(i + 1)) &&
+                params[i]->get_output_partial_shape(0).compatible(get_input_partial_shape(i + 1)),
+            "Parameter ",
+            i,
+            " of the body does not match argument ",
+            i + 1,
+            " (",
+            get_input_element_type(i + 1),
+            " ",
+            get_input_partial_shape(i + 1),
+            ")");
+    }
+
+    NODE_VALIDATION_CHECK(this,
+                          m_body->get_output_size() == m_carried_count + 1,
+                          "Body returns ",
+                          m_body->get_output_size(),
+                          " results, expected the condition and ",
+                          m_carried_count,
+                          " loop-carried values");
+    NODE_VALIDATION_CHECK(this,
+                          m_body->get_output_element_type(0).compatible(element::boolean) &&
+                              m_body->get_output_partial_shape(0).compatible(PartialShape{}),
+                          "Result 0 of the body, the condition, must be a boolean scalar");
+
+    set_output_size(m_carried_count);
+    for (size_t i = 0; i < m_carried_count; i++)
+    {
+        element::Type element_type;
+        PartialShape shape = get_input_partial_shape(i + 2);
+        NODE_VALIDATION_CHECK(
+            this,
+            element::Type::merge(element_type,
+                                 get_input_element_type(i + 2),
+                                 m_body->get_output_element_type(i + 1)) &&
+                PartialShape::merge_into(shape, m_body->get_output_partial_shape(i + 1)),
+            "Loop-carried value ",
+            i,
+            " starts as ",
+            get_input_element_type(i + 2),
+            " ",
+            get_input_partial_shape(i + 2),
+            " but the body returns ",
+            m_body->get_output_element_type(i + 1),
+            " ",
+            m_body->get_output_partial_shape(i + 1));
+        set_output_type(i, element_type, shape);
+    }
+}
+
+void op::Loop::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
+{
+    throw ngraph_error("generate_adjoints not implemented for Loop");
+}
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Runs a body function while a condition holds, passing the values it returns
+        ///        to its next iteration.
+        ///
+        /// The body takes an i64 scalar iteration number counting from 0, one parameter per
+        /// loop-carried value, then one parameter per invariant value. It returns a boolean
+        /// scalar, false to stop after this iteration, followed by the next loop-carried
+        /// values, which must keep the element type and shape of their initial values. The
+        /// outputs are the loop-carried values after the last iteration, or their initial
+        /// values when the body never runs.
+        ///
+        /// Loop has no adjoint, as the values of the intermediate iterations are not kept.
+        class Loop : public op::Op
+        {
+        public:
+            /// \brief Constructs a Loop operation.
+            ///
+            /// \param trip_count i64 scalar, the maximum number of iterations, or a negative
+            ///                   value for no limit
+            /// \param condition Boolean scalar, the body does not run at all when it is false
+            /// \param carried The initial values of the loop-carried values
+            /// \param invariants The values passed unchanged to every iteration
+            /// \param body The function run by each iteration
+            Loop(const std::shared_ptr<Node>& trip_count,
+                 const std::shared_ptr<Node>& condition,
+                 const NodeVector& carried,
+                 const NodeVector& invariants,
+                 const std::shared_ptr<Function>& body);
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            std::vector<std::shared_ptr<Function>> get_functions() const override;
+
+            const std::shared_ptr<Function>& get_body() const { return m_body; }
+            size_t get_carried_count() const { return m_carried_count; }
+        protected:
+            virtual void generate_adjoints(autodiff::Adjoints& adjoints,
+                                           const NodeVector& deltas) override;
+
+            void validate_and_infer_types() override;
+            std::shared_ptr<Function> m_body;
+            size_t m_carried_count;
+        };
+    }
+}
@@ -0,0 +1,117 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/op/util/fused_op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief One Adam optimizer step over a group of parameter tensors.
+        ///
+        /// For each parameter P with gradient G, first moment M and second moment V:
+        ///
+        /// M' = beta1 * M + (1 - beta1) * G
+        /// V' = beta2 * V + (1 - beta2) * G * G
+        /// P' = P - learning_rate * M' / (sqrt(V') + epsilon)
+        ///
+        /// The learning rate is a scalar input so that the caller can fold the bias correction
+        /// of step t into it, learning_rate = lr * sqrt(1 - beta2^t) / (1 - beta1^t), without
+        /// rebuilding the function.
+        ///
+        /// The inputs are the learning rate followed by the N parameters, the N gradients, the
+        /// N first moments and the N second moments. The outputs are the N updated parameters,
+        /// the N updated first moments and the N updated second moments. Backends that
+        /// implement the op update every tensor of the group in one kernel and may write each
+        /// output over the tensor it replaces.
+        ///
+        /// A loss-scaled update also takes the scale the loss was multiplied by and a boolean
+        /// scalar telling whether all gradients are finite, as in SgdMomentumUpdate.
+        class AdamUpdate : public ngraph::op::util::FusedOp
+        {
+        public:
+            /// \brief Constructs an AdamUpdate operation.
+            ///
+            /// \param learning_rate Scalar learning rate
+            /// \param parameters Parameter tensors to update
+            /// \param gradients Gradient of each parameter
+            /// \param first_moments Running mean of each gradient
+            /// \param second_moments Running mean of each squared gradient
+            /// \param beta1 Decay of the first moments
+            /// \param beta2 Decay of the second moments
+            /// \param epsilon Added to the denominator for numerical stability
+            AdamUpdate(const std::shared_ptr<ngraph::Node>& learning_rate,
+                       const NodeVector& parameters,
+                       const NodeVector& gradients,
+                       const NodeVector& first_moments,
+                       const NodeVector& second_moments,
+                       double beta1 = 0.9,
+                       double beta2 = 0.999,
+                       double epsilon = 1e-8);
+
+            /// \brief Constructs a loss-scaled AdamUpdate operation.
+            ///
+            /// \param learning_rate Scalar learning rate
+            /// \param loss_scale Scalar the loss was multiplied by
+            /// \param finite Boolean scalar, the update is skipped when it is false
+            /// \param parameters Parameter tensors to update
+            /// \param gradients Gradient of each parameter, multiplied by loss_scale
+            /// \param first_moments Running mean of each gradient
+            /// \param second_moments Running mean of each squared gradient
+            /// \param beta1 Decay of the first moments
+            /// \param beta2 Decay of the second moments
+            /// \param epsilon Added to the denominator for numerical stability
+            AdamUpdate(const std::shared_ptr<ngraph::Node>& learning_rate,
+                       const std::shared_ptr<ngraph::Node>& loss_scale,
+                       const std::shared_ptr<ngraph::Node>& finite,
+                       const NodeVector& parameters,
+                       const NodeVector& gradients,
+                       const NodeVector& first_moments,
+                       const NodeVector& second_moments,
+                       double beta1 = 0.9,
+                       double beta2 = 0.999,
+                       double epsilon = 1e-8);
+
+            virtual void pre_validate_and_infer_types() override;
+
+            virtual NodeVector decompose_op() const override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            /// \return The number of parameter tensors updated by the op
+            size_t get_group_size() const
+            {
+                return (get_input_size() - get_first_group_input()) / 4;
+            }
+            /// \return The index of the input of the first parameter
+            size_t get_first_group_input() const { return m_loss_scaled ? 3 : 1; }
+            bool is_loss_scaled() const { return m_loss_scaled; }
+            double get_beta1() const { return m_beta1; }
+            double get_beta2() const { return m_beta2; }
+            double get_epsilon() const { return m_epsilon; }
+        private:
+            double m_beta1;
+            double m_beta2;
+            double m_epsilon;
+            bool m_loss_scaled;
+        };
+    }
+}
@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/all_finite.hpp"
+#include "ngraph/builder/make_constant.hpp"
+#include "ngraph/op/all.hpp"
+#include "ngraph/op/and.hpp"
+#include "ngraph/op/equal.hpp"
+#include "ngraph/op/subtract.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::AllFinite::AllFinite(const NodeVector& args)
+    : FusedOp("AllFinite", args)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::AllFinite::pre_validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, get_input_size() > 0, "Expected at least one input");
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        const element::Type& element_type = get_input_element_type(i);
+        NODE_VALIDATION_CHECK(this,
+                              element_type.is_dynamic() || element_type.is_real(),
+                              "Input ",
+                              i,
+                              " must have a floating point element type, got ",
+                              element_type);
+    }
+}
+
+NodeVector op::AllFinite::decompose_op() const
+{
+    shared_ptr<Node> all_finite;
+    for (auto arg : get_arguments())
+    {
+        const Shape& shape = arg->get_shape();
+        AxisSet axes;
+        for (size_t axis = 0; axis < shape.size(); axis++)
+        {
+            axes.insert(axis);
+        }
+        // x - x is 0 for finite x, and NaN for infinities and NaN
+        auto zero = builder::make_constant(arg->get_element_type(), shape, 0);
+        shared_ptr<Node> finite =
+            make_shared<op::All>(make_shared<op::Equal>(arg - arg, zero), axes);
+        all_finite = all_finite ? make_shared<op::And>(all_finite, finite) : finite;
+    }
+    return {all_finite};
+}
+
+shared_ptr<Node> op::AllFinite::copy_with_new_args(const NodeVector& new_args) const
+{
+    return make_shared<AllFinite>(new_args);
+}
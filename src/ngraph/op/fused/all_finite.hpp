@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/op/util/fused_op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Boolean scalar that is true when no element of any input is an infinity or
+        ///        NaN.
+        ///
+        /// Mixed precision training checks every gradient of a step with one AllFinite and
+        /// skips the optimizer update when it is false, see the loss-scaled SgdMomentumUpdate
+        /// and AdamUpdate. Backends that implement the op check all inputs in one kernel.
+        class AllFinite : public ngraph::op::util::FusedOp
+        {
+        public:
+            /// \brief Constructs an AllFinite operation.
+            ///
+            /// \param args Floating point tensors to check
+            AllFinite(const NodeVector& args);
+
+            virtual void pre_validate_and_infer_types() override;
+
+            virtual NodeVector decompose_op() const override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+        };
+    }
+}
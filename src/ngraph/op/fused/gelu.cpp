@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cmath>
+
+#include "ngraph/builder/make_constant.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/erf.hpp"
+#include "ngraph/op/fused/gelu.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/tanh.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::Gelu::Gelu(const shared_ptr<Node>& data, bool approximate)
+    : FusedOp("Gelu", {data})
+    , m_approximate(approximate)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::Gelu::pre_validate_and_infer_types()
+{
+    const element::Type& element_type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          element_type.is_real(),
+                          "Argument must have a floating point element type, got ",
+                          element_type);
+}
+
+NodeVector op::Gelu::decompose_op() const
+{
+    auto data = get_argument(0);
+    const element::Type& element_type = data->get_element_type();
+    const Shape& shape = data->get_shape();
+
+    shared_ptr<Node> cdf;
+    if (m_approximate)
+    {
+        auto cube = data * data * data;
+        auto inner = builder::make_constant(element_type, shape, sqrt(2.0 / M_PI)) *
+                     (data + builder::make_constant(element_type, shape, 0.044715) * cube);
+        cdf = make_shared<op::Tanh>(inner);
+    }
+    else
+    {
+        cdf = make_shared<op::Erf>(data / builder::make_constant(element_type, shape, M_SQRT2));
+    }
+    auto half = builder::make_constant(element_type, shape, 0.5);
+    auto one = builder::make_constant(element_type, shape, 1.0);
+    return {data * half * (one + cdf)};
+}
+
+shared_ptr<Node> op::Gelu::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 1)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<Gelu>(new_args.at(0), m_approximate);
+}
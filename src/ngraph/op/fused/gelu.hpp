@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/op/util/fused_op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Gaussian Error Linear Unit
+        /// f(x) = 0.5 * x * (1 + erf(x / sqrt(2)))
+        ///
+        /// The approximate form replaces erf(x / sqrt(2)) by
+        /// tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)).
+        class Gelu : public ngraph::op::util::FusedOp
+        {
+        public:
+            /// \brief Constructs a Gelu operation.
+            ///
+            /// \param data Input tensor
+            /// \param approximate Use the tanh approximation instead of erf
+            Gelu(const std::shared_ptr<ngraph::Node>& data, bool approximate = false);
+
+            bool get_approximate() const { return m_approximate; }
+            virtual void pre_validate_and_infer_types() override;
+
+            virtual NodeVector decompose_op() const override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            bool m_approximate;
+        };
+    }
+}
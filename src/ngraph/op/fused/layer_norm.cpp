@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/op/fused/layer_norm.hpp"
+#include "ngraph/builder/make_constant.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::LayerNorm::LayerNorm(const shared_ptr<Node>& data,
+                         const shared_ptr<Node>& gamma,
+                         const shared_ptr<Node>& beta,
+                         double epsilon,
+                         size_t begin_norm_axis)
+    : FusedOp("LayerNorm", {data, gamma, beta})
+    , m_epsilon(epsilon)
+    , m_begin_norm_axis(begin_norm_axis)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::LayerNorm::pre_validate_and_infer_types()
+{
+    const element::Type& element_type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          element_type.is_real(),
+                          "Argument must have a floating point element type, got ",
+                          element_type);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(1) == element_type &&
+                              get_input_element_type(2) == element_type,
+                          "Gamma and beta element types must match the argument element type ",
+                          element_type);
+
+    const Shape& data_shape = get_input_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          m_begin_norm_axis < data_shape.size(),
+                          "Normalization axis ",
+                          m_begin_norm_axis,
+                          " is out of bounds for argument shape ",
+                          data_shape);
+
+    Shape norm_shape(data_shape.begin() + m_begin_norm_axis, data_shape.end());
+    NODE_VALIDATION_CHECK(this,
+                          get_input_shape(1) == norm_shape && get_input_shape(2) == norm_shape,
+                          "Gamma and beta must have shape ",
+                          norm_shape,
+                          ", got ",
+                          get_input_shape(1),
+                          " and ",
+                          get_input_shape(2));
+}
+
+NodeVector op::LayerNorm::decompose_op() const
+{
+    auto data = get_argument(0);
+    const element::Type& element_type = data->get_element_type();
+    const Shape& shape = data->get_shape();
+
+    AxisSet batch_axes;
+    AxisSet norm_axes;
+    for (size_t i = 0; i < shape.size(); i++)
+    {
+        (i < m_begin_norm_axis ? batch_axes : norm_axes).insert(i);
+    }
+    Shape batch_shape(shape.begin(), shape.begin() + m_begin_norm_axis);
+    size_t norm_size = shape_size(shape) / shape_size(batch_shape);
+    auto count = builder::make_constant(element_type, batch_shape, norm_size);
+
+    auto mean = make_shared<op::Sum>(data, norm_axes) / count;
+    auto centered = data - make_shared<op::Broadcast>(mean, shape, norm_axes);
+    auto variance = make_shared<op::Sum>(centered * centered, norm_axes) / count;
+    auto stddev = make_shared<op::Sqrt>(
+        variance + builder::make_constant(element_type, batch_shape, m_epsilon));
+    auto normalized = centered / make_shared<op::Broadcast>(stddev, shape, norm_axes);
+
+    auto gamma = make_shared<op::Broadcast>(get_argument(1), shape, batch_axes);
+    auto beta = make_shared<op::Broadcast>(get_argument(2), shape, batch_axes);
+    return {normalized * gamma + beta};
+}
+
+shared_ptr<Node> op::LayerNorm::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 3)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return make_shared<LayerNorm>(
+        new_args.at(0), new_args.at(1), new_args.at(2), m_epsilon, m_begin_norm_axis);
+}
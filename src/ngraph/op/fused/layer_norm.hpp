@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/op/util/fused_op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Layer normalization
+        /// f(x) = (x - mean) / sqrt(variance + epsilon) * gamma + beta
+        ///
+        /// The mean and variance are taken over the axes from `begin_norm_axis` to the last
+        /// one, separately for every index of the leading axes. `gamma` and `beta` have the
+        /// shape of the normalized axes.
+        class LayerNorm : public ngraph::op::util::FusedOp
+        {
+        public:
+            /// \brief Constructs a LayerNorm operation.
+            ///
+            /// \param data Input tensor
+            /// \param gamma Scale of the normalized values
+            /// \param beta Shift of the normalized values
+            /// \param epsilon Added to the variance to avoid dividing by zero
+            /// \param begin_norm_axis First of the normalized axes
+            LayerNorm(const std::shared_ptr<ngraph::Node>& data,
+                      const std::shared_ptr<ngraph::Node>& gamma,
+                      const std::shared_ptr<ngraph::Node>& beta,
+                      double epsilon,
+                      size_t begin_norm_axis);
+
+            double get_epsilon() const { return m_epsilon; }
+            size_t get_begin_norm_axis() const { return m_begin_norm_axis; }
+            virtual void pre_validate_and_infer_types() override;
+
+            virtual NodeVector decompose_op() const override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            double m_epsilon;
+            size_t m_begin_norm_axis;
+        };
+    }
+}
@@ -0,0 +1,144 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
+#include "ngraph/builder/make_constant.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/softmax.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::ScaledDotProductAttention::ScaledDotProductAttention(const shared_ptr<Node>& query,
+                                                         const shared_ptr<Node>& key,
+                                                         const shared_ptr<Node>& value,
+                                                         double scale)
+    : FusedOp("ScaledDotProductAttention", {query, key, value})
+    , m_scale(scale)
+{
+    constructor_validate_and_infer_types();
+}
+
+op::ScaledDotProductAttention::ScaledDotProductAttention(const shared_ptr<Node>& query,
+                                                         const shared_ptr<Node>& key,
+                                                         const shared_ptr<Node>& value,
+                                                         const shared_ptr<Node>& mask,
+                                                         double scale)
+    : FusedOp("ScaledDotProductAttention", {query, key, value, mask})
+    , m_scale(scale)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::ScaledDotProductAttention::pre_validate_and_infer_types()
+{
+    const element::Type& element_type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          element_type.is_real(),
+                          "Query must have a floating point element type, got ",
+                          element_type);
+    for (size_t i = 1; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(i) == element_type,
+                              "Input ",
+                              i,
+                              " element type ",
+                              get_input_element_type(i),
+                              " does not match the query element type ",
+                              element_type);
+    }
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_shape(i).size() == 3,
+                              "Input ",
+                              i,
+                              " must have rank 3, got shape ",
+                              get_input_shape(i));
+    }
+
+    const Shape& query_shape = get_input_shape(0);
+    const Shape& key_shape = get_input_shape(1);
+    const Shape& value_shape = get_input_shape(2);
+    NODE_VALIDATION_CHECK(this,
+                          key_shape[0] == query_shape[0] && value_shape[0] == query_shape[0],
+                          "Query, key and value batch sizes must match, got ",
+                          query_shape,
+                          ", ",
+                          key_shape,
+                          " and ",
+                          value_shape);
+    NODE_VALIDATION_CHECK(this,
+                          key_shape[2] == query_shape[2],
+                          "Query and key depths must match, got ",
+                          query_shape,
+                          " and ",
+                          key_shape);
+    NODE_VALIDATION_CHECK(this,
+                          value_shape[1] == key_shape[1],
+                          "Key and value lengths must match, got ",
+                          key_shape,
+                          " and ",
+                          value_shape);
+    if (has_mask())
+    {
+        Shape scores_shape{query_shape[0], query_shape[1], key_shape[1]};
+        NODE_VALIDATION_CHECK(this,
+                              get_input_shape(3) == scores_shape,
+                              "Mask must have shape ",
+                              scores_shape,
+                              ", got ",
+                              get_input_shape(3));
+    }
+}
+
+NodeVector op::ScaledDotProductAttention::decompose_op() const
+{
+    auto query = get_argument(0);
+    auto key = get_argument(1);
+    auto value = get_argument(2);
+
+    shared_ptr<Node> scores =
+        make_shared<op::BatchMatMul>(query, op::util::batch_mat_transpose(key));
+    scores = make_shared<op::Multiply>(
+        scores,
+        builder::make_constant(scores->get_element_type(), scores->get_shape(), m_scale));
+    if (has_mask())
+    {
+        scores = make_shared<op::Add>(scores, get_argument(3));
+    }
+    auto probabilities = make_shared<op::Softmax>(scores, AxisSet{2});
+    return {make_shared<op::BatchMatMul>(probabilities, value)};
+}
+
+shared_ptr<Node> op::ScaledDotProductAttention::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() == 3)
+    {
+        return make_shared<ScaledDotProductAttention>(
+            new_args.at(0), new_args.at(1), new_args.at(2), m_scale);
+    }
+    if (new_args.size() == 4)
+    {
+        return make_shared<ScaledDotProductAttention>(
+            new_args.at(0), new_args.at(1), new_args.at(2), new_args.at(3), m_scale);
+    }
+    throw ngraph_error("Incorrect number of new arguments");
+}
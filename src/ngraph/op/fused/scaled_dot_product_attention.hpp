@@ -0,0 +1,78 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/op/util/fused_op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Scaled dot-product attention, softmax(scale * Q.K^T + mask).V
+        ///
+        /// The inputs are batches of matrices, with the attention heads folded into the batch
+        /// dimension as for BatchMatMul: query `(batch, q_len, depth)`, key
+        /// `(batch, kv_len, depth)`, value `(batch, kv_len, value_depth)` and the optional
+        /// additive mask `(batch, q_len, kv_len)`. The softmax is taken over the kv_len axis and
+        /// the result has shape `(batch, q_len, value_depth)`.
+        ///
+        /// Backends that implement the op do not need to keep the `(batch, q_len, kv_len)`
+        /// attention scores in memory.
+        class ScaledDotProductAttention : public ngraph::op::util::FusedOp
+        {
+        public:
+            /// \brief Constructs a ScaledDotProductAttention operation.
+            ///
+            /// \param query Query matrices
+            /// \param key Key matrices
+            /// \param value Value matrices
+            /// \param scale Multiplier of the query-key products, usually 1/sqrt(depth)
+            ScaledDotProductAttention(const std::shared_ptr<Node>& query,
+                                      const std::shared_ptr<Node>& key,
+                                      const std::shared_ptr<Node>& value,
+                                      double scale);
+
+            /// \brief Constructs a masked ScaledDotProductAttention operation.
+            ///
+            /// \param query Query matrices
+            /// \param key Key matrices
+            /// \param value Value matrices
+            /// \param mask Added to the scaled query-key products before the softmax
+            /// \param scale Multiplier of the query-key products, usually 1/sqrt(depth)
+            ScaledDotProductAttention(const std::shared_ptr<Node>& query,
+                                      const std::shared_ptr<Node>& key,
+                                      const std::shared_ptr<Node>& value,
+                                      const std::shared_ptr<Node>& mask,
+                                      double scale);
+
+            double get_scale() const { return m_scale; }
+            bool has_mask() const { return get_input_size() == 4; }
+            virtual void pre_validate_and_infer_types() override;
+
+            virtual NodeVector decompose_op() const override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        private:
+            double m_scale;
+        };
+    }
+}
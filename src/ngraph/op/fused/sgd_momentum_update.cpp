@@ -0,0 +1,183 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/fused/sgd_momentum_update.hpp"
+#include "ngraph/builder/make_constant.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/util/broadcasting.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static NodeVector make_args(const NodeVector& scalars,
+                            const NodeVector& parameters,
+                            const NodeVector& gradients,
+                            const NodeVector& velocities)
+{
+    NodeVector args{scalars};
+    args.insert(args.end(), parameters.begin(), parameters.end());
+    args.insert(args.end(), gradients.begin(), gradients.end());
+    args.insert(args.end(), velocities.begin(), velocities.end());
+    return args;
+}
+
+op::SgdMomentumUpdate::SgdMomentumUpdate(const shared_ptr<Node>& learning_rate,
+                                         const NodeVector& parameters,
+                                         const NodeVector& gradients,
+                                         const NodeVector& velocities,
+                                         double momentum)
+    : FusedOp("SgdMomentumUpdate",
+              make_args(NodeVector{learning_rate}, parameters, gradients, velocities))
+    , m_momentum(momentum)
+    , m_loss_scaled(false)
+{
+    constructor_validate_and_infer_types();
+}
+
+op::SgdMomentumUpdate::SgdMomentumUpdate(const shared_ptr<Node>& learning_rate,
+                                         const shared_ptr<Node>& loss_scale,
+                                         const shared_ptr<Node>& finite,
+                                         const NodeVector& parameters,
+                                         const NodeVector& gradients,
+                                         const NodeVector& velocities,
+                                         double momentum)
+    : FusedOp("SgdMomentumUpdate",
+              make_args(NodeVector{learning_rate, loss_scale, finite},
+                        parameters,
+                        gradients,
+                        velocities))
+    , m_momentum(momentum)
+    , m_loss_scaled(true)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::SgdMomentumUpdate::pre_validate_and_infer_types()
+{
+    size_t first = get_first_group_input();
+    NODE_VALIDATION_CHECK(this,
+                          get_input_size() > first && (get_input_size() - first) % 3 == 0,
+                          "Expected a learning rate followed by the same number of parameters, "
+                          "gradients and velocities, got ",
+                          get_input_size(),
+                          " inputs");
+    const element::Type& element_type = get_input_element_type(0);
+    NODE_VALIDATION_CHECK(this,
+                          element_type.is_dynamic() || element_type.is_real(),
+                          "Learning rate must have a floating point element type, got ",
+                          element_type);
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(0).compatible(PartialShape{}),
+                          "Learning rate must be a scalar, got shape ",
+                          get_input_partial_shape(0));
+    if (m_loss_scaled)
+    {
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(1).compatible(element_type) &&
+                                  get_input_partial_shape(1).compatible(PartialShape{}),
+                              "Loss scale must be a scalar of the learning rate element type");
+        NODE_VALIDATION_CHECK(this,
+                              get_input_element_type(2).compatible(element::boolean) &&
+                                  get_input_partial_shape(2).compatible(PartialShape{}),
+                              "Finite flag must be a boolean scalar");
+    }
+
+    size_t n = get_group_size();
+    for (size_t i = 0; i < n; i++)
+    {
+        for (size_t input : {first + n + i, first + 2 * n + i})
+        {
+            NODE_VALIDATION_CHECK(this,
+                                  get_input_element_type(input).compatible(element_type) &&
+                                      get_input_element_type(first + i).compatible(element_type),
+                                  "Element types of parameter ",
+                                  i,
+                                  " and its state do not match the learning rate");
+            NODE_VALIDATION_CHECK(
+                this,
+                get_input_partial_shape(input).compatible(get_input_partial_shape(first + i)),
+                "Shapes of parameter ",
+                i,
+                " and its state do not match, ",
+                get_input_partial_shape(first + i),
+                " and ",
+                get_input_partial_shape(input));
+        }
+    }
+}
+
+NodeVector op::SgdMomentumUpdate::decompose_op() const
+{
+    size_t first = get_first_group_input();
+    size_t n = get_group_size();
+    auto learning_rate = get_argument(0);
+    NodeVector new_parameters;
+    NodeVector new_velocities;
+    for (size_t i = 0; i < n; i++)
+    {
+        auto parameter = get_argument(first + i);
+        auto gradient = get_argument(first + n + i);
+        auto velocity = get_argument(first + 2 * n + i);
+        const Shape& shape = parameter->get_shape();
+        if (m_loss_scaled)
+        {
+            gradient = gradient / make_broadcast_node(get_argument(1), shape);
+        }
+
+        auto momentum = builder::make_constant(parameter->get_element_type(), shape, m_momentum);
+        auto new_velocity = momentum * velocity + gradient;
+        auto new_parameter = parameter - make_broadcast_node(learning_rate, shape) * new_velocity;
+        if (m_loss_scaled)
+        {
+            auto finite = make_broadcast_node(get_argument(2), shape);
+            new_parameter = make_shared<op::Select>(finite, new_parameter, parameter);
+            new_velocity = make_shared<op::Select>(finite, new_velocity, velocity);
+        }
+        new_parameters.push_back(new_parameter);
+        new_velocities.push_back(new_velocity);
+    }
+    new_parameters.insert(new_parameters.end(), new_velocities.begin(), new_velocities.end());
+    return new_parameters;
+}
+
+shared_ptr<Node> op::SgdMomentumUpdate::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != get_input_size())
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    size_t n = get_group_size();
+    auto first = new_args.begin() + get_first_group_input();
+    if (m_loss_scaled)
+    {
+        return make_shared<SgdMomentumUpdate>(new_args.at(0),
+                                              new_args.at(1),
+                                              new_args.at(2),
+                                              NodeVector(first, first + n),
+                                              NodeVector(first + n, first + 2 * n),
+                                              NodeVector(first + 2 * n, first + 3 * n),
+                                              m_momentum);
+    }
+    return make_shared<SgdMomentumUpdate>(new_args.at(0),
+                                          NodeVector(first, first + n),
+                                          NodeVector(first + n, first + 2 * n),
+                                          NodeVector(first + 2 * n, first + 3 * n),
+                                          m_momentum);
+}
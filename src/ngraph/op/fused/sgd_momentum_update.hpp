@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/op/util/fused_op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief One step of stochastic gradient descent with momentum over a group of
+        ///        parameter tensors.
+        ///
+        /// For each parameter P with gradient G and velocity V:
+        ///
+        /// V' = momentum * V + G
+        /// P' = P - learning_rate * V'
+        ///
+        /// The inputs are the scalar learning rate followed by the N parameters, the N
+        /// gradients and the N velocities. The outputs are the N updated parameters followed by
+        /// the N updated velocities. Backends that implement the op update every tensor of the
+        /// group in one kernel and may write P' over P and V' over V.
+        ///
+        /// A loss-scaled update also takes the scale the loss was multiplied by and a boolean
+        /// scalar telling whether all gradients are finite, see AllFinite. The gradients are
+        /// divided by the scale, and when they are not all finite the update is skipped and
+        /// every output equals the tensor it replaces.
+        class SgdMomentumUpdate : public ngraph::op::util::FusedOp
+        {
+        public:
+            /// \brief Constructs an SgdMomentumUpdate operation.
+            ///
+            /// \param learning_rate Scalar learning rate
+            /// \param parameters Parameter tensors to update
+            /// \param gradients Gradient of each parameter
+            /// \param velocities Velocity of each parameter
+            /// \param momentum Decay of the velocity between steps
+            SgdMomentumUpdate(const std::shared_ptr<ngraph::Node>& learning_rate,
+                              const NodeVector& parameters,
+                              const NodeVector& gradients,
+                              const NodeVector& velocities,
+                              double momentum = 0.9);
+
+            /// \brief Constructs a loss-scaled SgdMomentumUpdate operation.
+            ///
+            /// \param learning_rate Scalar learning rate
+            /// \param loss_scale Scalar the loss was multiplied by
+            /// \param finite Boolean scalar, the update is skipped when it is false
+            /// \param parameters Parameter tensors to update
+            /// \param gradients Gradient of each parameter, multiplied by loss_scale
+            /// \param velocities Velocity of each parameter
+            /// \param momentum Decay of the velocity between steps
+            SgdMomentumUpdate(const std::shared_ptr<ngraph::Node>& learning_rate,
+                              const std::shared_ptr<ngraph::Node>& loss_scale,
+                              const std::shared_ptr<ngraph::Node>& finite,
+                              const NodeVector& parameters,
+                              const NodeVector& gradients,
+                              const NodeVector& velocities,
+                              double momentum = 0.9);
+
+            virtual void pre_validate_and_infer_types() override;
+
+            virtual NodeVector decompose_op() const override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            /// \return The number of parameter tensors updated by the op
+            size_t get_group_size() const
+            {
+                return (get_input_size() - get_first_group_input()) / 3;
+            }
+            /// \return The index of the input of the first parameter
+            size_t get_first_group_input() const { return m_loss_scaled ? 3 : 1; }
+            bool is_loss_scaled() const { return m_loss_scaled; }
+            double get_momentum() const { return m_momentum; }
+        private:
+            double m_momentum;
+            bool m_loss_scaled;
+        };
+    }
+}
@@ -17,13 +17,19 @@
 // This collection contains one entry for each fused op.
 //
 
+NGRAPH_OP(AdamUpdate, ngraph::op)
+NGRAPH_OP(AllFinite, ngraph::op)
 NGRAPH_OP(Elu, ngraph::op)
+NGRAPH_OP(Gelu, ngraph::op)
 NGRAPH_OP(Gemm, ngraph::op)
 NGRAPH_OP(PRelu, ngraph::op)
 NGRAPH_OP(ConvolutionBias, ngraph::op)
 NGRAPH_OP(ConvolutionBiasAdd, ngraph::op)
 NGRAPH_OP(ConvolutionBiasBackpropFiltersBias, ngraph::op)
 NGRAPH_OP(HardSigmoid, ngraph::op)
+NGRAPH_OP(LayerNorm, ngraph::op)
+NGRAPH_OP(ScaledDotProductAttention, ngraph::op)
 NGRAPH_OP(DepthToSpace, ngraph::op)
 NGRAPH_OP(SpaceToDepth, ngraph::op)
 NGRAPH_OP(GroupConvolution, ngraph::op)
+NGRAPH_OP(SgdMomentumUpdate, ngraph::op)
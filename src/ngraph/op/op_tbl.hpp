@@ -54,6 +54,7 @@ NGRAPH_OP(Abs, ngraph::op)
 NGRAPH_OP(Acos, ngraph::op)
 NGRAPH_OP(Add, ngraph::op)
 NGRAPH_OP(All, ngraph::op)
+NGRAPH_OP(AllGather, ngraph::op)
 NGRAPH_OP(AllReduce, ngraph::op)
 NGRAPH_OP(And, ngraph::op)
 NGRAPH_OP(Any, ngraph::op)
@@ -81,6 +82,8 @@ NGRAPH_OP(Cos, ngraph::op)
 NGRAPH_OP(Cosh, ngraph::op)
 NGRAPH_OP(Dequantize, ngraph::op)
 NGRAPH_OP(Divide, ngraph::op)
+NGRAPH_OP(Dropout, ngraph::op)
+NGRAPH_OP(DropoutBackprop, ngraph::op)
 NGRAPH_OP(DynBroadcast, ngraph::op)
 NGRAPH_OP(Dot, ngraph::op)
 NGRAPH_OP(DynPad, ngraph::op)
@@ -96,9 +99,11 @@ NGRAPH_OP(GenerateMask, ngraph::op)
 NGRAPH_OP(GetOutputElement, ngraph::op)
 NGRAPH_OP(Greater, ngraph::op)
 NGRAPH_OP(GreaterEq, ngraph::op)
+NGRAPH_OP(If, ngraph::op)
 NGRAPH_OP(Less, ngraph::op)
 NGRAPH_OP(LessEq, ngraph::op)
 NGRAPH_OP(Log, ngraph::op)
+NGRAPH_OP(Loop, ngraph::op)
 NGRAPH_OP(LRN, ngraph::op)
 NGRAPH_OP(Max, ngraph::op)
 NGRAPH_OP(Maximum, ngraph::op)
@@ -127,6 +132,8 @@ NGRAPH_OP(QuantizedConvolution, ngraph::op)
 NGRAPH_OP(QuantizedDotBias, ngraph::op)
 NGRAPH_OP(QuantizedDot, ngraph::op)
 NGRAPH_OP(QuantizedMaxPool, ngraph::op)
+NGRAPH_OP(Recv, ngraph::op)
+NGRAPH_OP(ReduceScatter, ngraph::op)
 NGRAPH_OP(Relu, ngraph::op)
 NGRAPH_OP(ReluBackprop, ngraph::op)
 NGRAPH_OP(ReplaceSlice, ngraph::op)
@@ -136,6 +143,7 @@ NGRAPH_OP(Reverse, ngraph::op)
 NGRAPH_OP(ReverseSequence, ngraph::op)
 NGRAPH_OP(ScalarConstantLike, ngraph::op)
 NGRAPH_OP(Select, ngraph::op)
+NGRAPH_OP(Send, ngraph::op)
 NGRAPH_OP(ShapeOf, ngraph::op)
 NGRAPH_OP(Sigmoid, ngraph::op)
 NGRAPH_OP(SigmoidBackprop, ngraph::op)
@@ -154,3 +162,4 @@ NGRAPH_OP(TopK, ngraph::op)
 NGRAPH_OP(Tile, ngraph::op)
 NGRAPH_OP(Transpose, ngraph::op)
 NGRAPH_OP(EmbeddingLookup, ngraph::op)
+NGRAPH_OP(EmbeddingLookupBackprop, ngraph::op)
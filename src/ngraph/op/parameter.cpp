@@ -29,6 +29,7 @@ op::Parameter::Parameter(const element::Type& element_type,
     , m_partial_shape(pshape)
     , m_element_type(element_type)
     , m_is_relevant_to_shapes(false)
+    , m_persistent(false)
 {
     constructor_validate_and_infer_types();
 }
@@ -42,7 +43,9 @@ void op::Parameter::validate_and_infer_types()
 shared_ptr<Node> op::Parameter::copy_with_new_args(const NodeVector& new_args) const
 {
     check_new_args_count(this, new_args);
-    return make_shared<Parameter>(m_element_type, m_partial_shape);
+    auto new_parameter = make_shared<Parameter>(m_element_type, m_partial_shape, m_cacheable);
+    new_parameter->set_persistent(m_persistent);
+    return new_parameter;
 }
 
 void op::Parameter::generate_adjoints(autodiff::Adjoints& adjoints, const NodeVector& deltas)
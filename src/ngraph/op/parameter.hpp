@@ -33,6 +33,8 @@ namespace ngraph
         protected:
             virtual void generate_adjoints(autodiff::Adjoints& adjoints,
                                            const NodeVector& deltas) override;
+            // Distinct parameters are distinct inputs, however alike their types
+            size_t get_attribute_hash() const override { return get_instance_id(); }
 
         public:
             /// \brief Constructions a tensor-typed parameter node.
@@ -53,11 +55,19 @@ namespace ngraph
             bool is_relevant_to_shapes() const;
             void set_is_relevant_to_shapes(bool is_relevant);
 
+            /// \brief A persistent parameter is bound to a tensor that is fed back to it on every
+            ///        call, such as a weight updated in place by a training step. A backend may
+            ///        keep the tensor in its preferred layout between calls and convert it only
+            ///        when the host reads or writes it.
+            bool get_persistent() const { return m_persistent; }
+            void set_persistent(bool persistent) { m_persistent = persistent; }
+
         protected:
             bool m_cacheable;
             PartialShape m_partial_shape;
             element::Type m_element_type;
             bool m_is_relevant_to_shapes;
+            bool m_persistent;
         };
     }
     using ParameterVector = std::vector<std::shared_ptr<op::Parameter>>;
@@ -0,0 +1,48 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/recv.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::Recv::Recv(const element::Type& element_type, const Shape& shape, int src_rank, int tag)
+    : Op("Recv", NodeVector{})
+    , m_element_type(element_type)
+    , m_shape(shape)
+    , m_src_rank(src_rank)
+    , m_tag(tag)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::Recv::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, m_src_rank >= 0, "Source rank must not be negative.");
+    NODE_VALIDATION_CHECK(this,
+                          m_element_type.is_static(),
+                          "Element type must be static (element type: ",
+                          m_element_type,
+                          ").");
+
+    set_output_type(0, m_element_type, m_shape);
+}
+
+shared_ptr<Node> op::Recv::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<Recv>(m_element_type, m_shape, m_src_rank, m_tag);
+}
@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Receives a tensor from the Send with the same tag in another process.
+        class Recv : public Op
+        {
+        public:
+            /// \param element_type The element type of the sent tensor
+            /// \param shape The shape of the sent tensor
+            /// \param src_rank The rank of the sending process
+            /// \param tag Matches the Recv to its Send
+            Recv(const element::Type& element_type, const Shape& shape, int src_rank, int tag);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            int get_src_rank() const { return m_src_rank; }
+            int get_tag() const { return m_tag; }
+
+        private:
+            element::Type m_element_type;
+            Shape m_shape;
+            int m_src_rank;
+            int m_tag;
+        };
+    }
+}
@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/reducescatter.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::ReduceScatter::ReduceScatter(const shared_ptr<Node>& arg, size_t shard_count)
+    : Op("ReduceScatter", check_single_output_args({arg}))
+    , m_shard_count(shard_count)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::ReduceScatter::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this,
+                          get_input_element_type(0).is_dynamic() ||
+                              get_input_element_type(0) == element::f32 ||
+                              get_input_element_type(0) == element::f64,
+                          "Only element types f32 and f64 are supported (argument element type: ",
+                          get_input_element_type(0),
+                          ").");
+    NODE_VALIDATION_CHECK(this, m_shard_count > 0, "Shard count must be positive.");
+
+    const PartialShape& arg_shape = get_input_partial_shape(0);
+    NODE_VALIDATION_CHECK(this,
+                          arg_shape.rank().is_dynamic() || static_cast<size_t>(arg_shape.rank()) > 0,
+                          "Argument must have at least one axis.");
+
+    PartialShape result_shape = arg_shape;
+    if (arg_shape.rank().is_static() && arg_shape[0].is_static())
+    {
+        size_t length = static_cast<size_t>(arg_shape[0]);
+        NODE_VALIDATION_CHECK(this,
+                              length % m_shard_count == 0,
+                              "Axis 0 of the argument (",
+                              length,
+                              ") is not divisible by the shard count (",
+                              m_shard_count,
+                              ").");
+        result_shape[0] = length / m_shard_count;
+    }
+    set_output_type(0, get_input_element_type(0), result_shape);
+}
+
+shared_ptr<Node> op::ReduceScatter::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<ReduceScatter>(new_args.at(0), m_shard_count);
+}
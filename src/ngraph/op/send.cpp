@@ -0,0 +1,46 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/op/send.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+op::Send::Send(const shared_ptr<Node>& arg, int dest_rank, int tag)
+    : Op("Send", check_single_output_args({arg}))
+    , m_dest_rank(dest_rank)
+    , m_tag(tag)
+{
+    constructor_validate_and_infer_types();
+}
+
+void op::Send::validate_and_infer_types()
+{
+    NODE_VALIDATION_CHECK(this, m_dest_rank >= 0, "Destination rank must not be negative.");
+    NODE_VALIDATION_CHECK(this,
+                          get_input_partial_shape(0).is_static(),
+                          "Argument shape must be static (argument shape: ",
+                          get_input_partial_shape(0),
+                          ").");
+
+    set_output_type(0, get_input_element_type(0), get_input_partial_shape(0));
+}
+
+shared_ptr<Node> op::Send::copy_with_new_args(const NodeVector& new_args) const
+{
+    check_new_args_count(this, new_args);
+    return make_shared<Send>(new_args.at(0), m_dest_rank, m_tag);
+}
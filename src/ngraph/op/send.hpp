@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include "ngraph/op/op.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        /// \brief Sends the argument to another process, where a Recv with the same tag
+        ///        receives it. The output is the argument, unchanged.
+        class Send : public Op
+        {
+        public:
+            /// \param arg The tensor to send
+            /// \param dest_rank The rank of the receiving process
+            /// \param tag Matches the Send to its Recv
+            Send(const std::shared_ptr<Node>& arg, int dest_rank, int tag);
+
+            void validate_and_infer_types() override;
+
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+            int get_dest_rank() const { return m_dest_rank; }
+            int get_tag() const { return m_tag; }
+
+        private:
+            int m_dest_rank;
+            int m_tag;
+        };
+    }
+}
@@ -347,7 +347,7 @@ template <typename T>
 static shared_ptr<Node>
     multiply_by(element::Type type, size_t multiplier, shared_ptr<op::Constant> cnst)
 {
-    T sum_cnst = static_cast<T>(cnst->get_vector<T>().at(0) * multiplier);
+    T sum_cnst = static_cast<T>(cnst->get_values<T>()[0] * multiplier);
     return op::Constant::create<T>(type, Shape{}, {sum_cnst});
 }
 
@@ -355,7 +355,7 @@ template <typename T>
 static shared_ptr<Node> pow_by(element::Type type, size_t multiplier, shared_ptr<op::Constant> cnst)
 {
     T prod = static_cast<T>(1);
-    T val = cnst->get_vector<T>().at(0);
+    T val = cnst->get_values<T>()[0];
     for (size_t i = 0; i < multiplier; i++)
     {
         prod *= val;
@@ -456,14 +456,54 @@ static bool simplify_reduction(shared_ptr<Node> n)
     return true;
 }
 
+//`simplify_sum` also optimizes sum(broadcast(x), reduction_axes = broadcast_axes) into
+//x * shape_size(broadcast_axes), which autodiff makes of a sum whose delta is broadcast
+static bool simplify_sum(shared_ptr<Node> n)
+{
+    if (simplify_reduction<op::Sum, get_sum_constant>(n))
+    {
+        return true;
+    }
+
+    auto sum = static_pointer_cast<op::Sum>(n);
+    auto broadcast = dynamic_pointer_cast<op::Broadcast>(n->get_argument(0));
+    if (!broadcast || broadcast->get_broadcast_axes() != sum->get_reduction_axes())
+    {
+        return false;
+    }
+
+    auto x = broadcast->get_argument(0);
+    const element::Type& type = x->get_element_type();
+    if (type == element::boolean || x->get_output_partial_shape(0).is_dynamic())
+    {
+        return false;
+    }
+
+    shared_ptr<Node> replacement = x;
+    size_t multiplier = reduction_shape_size(sum->get_reduction_axes(), broadcast->get_shape());
+    if (multiplier != 1)
+    {
+        auto cnst = op::Constant::create(type, Shape{}, vector<size_t>{multiplier});
+        AxisSet axes;
+        for (size_t i = 0; i < x->get_shape().size(); i++)
+        {
+            axes.insert(i);
+        }
+        replacement = make_shared<op::Multiply>(
+            x, make_shared<op::Broadcast>(cnst, x->get_shape(), axes));
+    }
+    NGRAPH_DEBUG << " Replacing " << n->get_name() << " with " << replacement->get_name();
+    replace_node(n, replacement);
+    return true;
+}
+
 static unordered_map<type_index, function<bool(shared_ptr<Node>)>> initialize_ops_to_simplifiers()
 {
     return unordered_map<type_index, function<bool(shared_ptr<Node>)>>(
         {{TI(op::Add), simplify_add},
          {TI(op::Multiply), simplify_multiply},
          {TI(op::Concat), simplify_concat},
-         {TI(op::Sum),
-          function<bool(shared_ptr<Node>)>{simplify_reduction<op::Sum, get_sum_constant>}},
+         {TI(op::Sum), simplify_sum},
          {TI(op::Product),
           function<bool(shared_ptr<Node>)>{simplify_reduction<op::Product, get_prod_constant>}},
          {TI(op::Log), simplify_log}});
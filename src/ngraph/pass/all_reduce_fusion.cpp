@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pass/all_reduce_fusion.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// true if `node` depends on any of `nodes`, through inputs or control dependencies
+static bool depends_on(const shared_ptr<Node>& node, const unordered_set<Node*>& nodes)
+{
+    unordered_set<Node*> visited;
+    vector<Node*> stack{node.get()};
+    while (!stack.empty())
+    {
+        Node* current = stack.back();
+        stack.pop_back();
+        if (nodes.count(current) != 0)
+        {
+            return true;
+        }
+        if (!visited.insert(current).second)
+        {
+            continue;
+        }
+        for (auto& arg : current->get_arguments())
+        {
+            stack.push_back(arg.get());
+        }
+        for (auto& cdep : current->get_control_dependencies())
+        {
+            stack.push_back(cdep.get());
+        }
+    }
+    return false;
+}
+
+static void fuse_bucket(const NodeVector& bucket)
+{
+    NodeVector flattened;
+    for (auto& all_reduce : bucket)
+    {
+        auto arg = all_reduce->get_argument(0);
+        auto& shape = arg->get_shape();
+        flattened.push_back(make_shared<op::Reshape>(
+            arg, get_default_order(shape), Shape{shape_size(shape)}));
+    }
+    auto compressed_type =
+        static_pointer_cast<op::AllReduce>(bucket.front())->get_compressed_type();
+    auto fused =
+        make_shared<op::AllReduce>(make_shared<op::Concat>(flattened, 0), compressed_type);
+    NGRAPH_DEBUG << "Fusing " << bucket.size() << " AllReduce ops into " << fused->get_name();
+
+    size_t offset = 0;
+    for (auto& all_reduce : bucket)
+    {
+        auto& shape = all_reduce->get_shape();
+        size_t size = shape_size(shape);
+        auto slice = make_shared<op::Slice>(fused, Coordinate{offset}, Coordinate{offset + size});
+        replace_node(all_reduce, make_shared<op::Reshape>(slice, AxisVector{0}, shape));
+        offset += size;
+    }
+}
+
+bool pass::AllReduceFusion::run_on_function(shared_ptr<Function> f)
+{
+    // open bucket of each element type and compressed type
+    map<pair<element::Type, element::Type>, NodeVector> buckets;
+    map<pair<element::Type, element::Type>, size_t> bucket_bytes;
+    vector<NodeVector> full_buckets;
+    for (auto& node : f->get_ordered_ops())
+    {
+        auto all_reduce_node = dynamic_pointer_cast<op::AllReduce>(node);
+        if (!all_reduce_node)
+        {
+            continue;
+        }
+        auto type = node->get_element_type();
+        size_t bytes = shape_size(node->get_shape()) * type.size();
+        auto key = make_pair(type, all_reduce_node->get_compressed_type());
+        auto& bucket = buckets[key];
+        unordered_set<Node*> bucket_nodes;
+        for (auto& all_reduce : bucket)
+        {
+            bucket_nodes.insert(all_reduce.get());
+        }
+        // an input computed from a reduction of the bucket can not be reduced with it
+        if (!bucket.empty() &&
+            (bucket_bytes[key] + bytes > m_bucket_size ||
+             depends_on(node->get_argument(0), bucket_nodes)))
+        {
+            full_buckets.push_back(bucket);
+            bucket.clear();
+            bucket_bytes[key] = 0;
+        }
+        bucket.push_back(node);
+        bucket_bytes[key] += bytes;
+    }
+    for (auto& bucket : buckets)
+    {
+        full_buckets.push_back(bucket.second);
+    }
+
+    bool replaced = false;
+    for (auto& bucket : full_buckets)
+    {
+        if (bucket.size() > 1)
+        {
+            fuse_bucket(bucket);
+            replaced = true;
+        }
+    }
+    return replaced;
+}
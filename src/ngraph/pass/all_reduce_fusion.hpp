@@ -0,0 +1,51 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class AllReduceFusion;
+    }
+}
+
+/// \brief Packs small AllReduce ops into buckets, so that the per-message latency of the
+/// collective is paid once per bucket rather than once per gradient.
+///
+/// The AllReduce ops are taken in topological order, the order in which backprop produces
+/// their inputs, so the first buckets are complete and can start early. Each bucket holds
+/// inputs of one element type and compressed type, at most bucket_size bytes in total. Its
+/// inputs are flattened and concatenated, reduced by a single AllReduce, and sliced back into
+/// the original shapes. Backends that place concats and slices in place, like the CPU backend,
+/// need no copies for these.
+class ngraph::pass::AllReduceFusion : public FunctionPass
+{
+public:
+    AllReduceFusion(size_t bucket_size = 16 * 1024 * 1024)
+        : FunctionPass()
+        , m_bucket_size(bucket_size)
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    size_t m_bucket_size;
+};
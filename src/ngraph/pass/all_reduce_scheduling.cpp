@@ -0,0 +1,89 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <unordered_set>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/pass/all_reduce_scheduling.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// `node` and every node that uses its outputs, directly or not
+static unordered_set<Node*> get_downstream_nodes(const shared_ptr<Node>& node)
+{
+    unordered_set<Node*> downstream{node.get()};
+    vector<shared_ptr<Node>> stack{node};
+    while (!stack.empty())
+    {
+        auto current = stack.back();
+        stack.pop_back();
+        for (auto& user : current->get_users(true))
+        {
+            if (downstream.insert(user.get()).second)
+            {
+                stack.push_back(user);
+            }
+        }
+    }
+    return downstream;
+}
+
+bool pass::AllReduceScheduling::run_on_function(shared_ptr<Function> f)
+{
+    vector<shared_ptr<Node>> all_reduces;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (dynamic_pointer_cast<op::AllReduce>(node))
+        {
+            all_reduces.push_back(node);
+        }
+    }
+    if (all_reduces.size() < 2)
+    {
+        return false;
+    }
+
+    bool modified = false;
+    for (auto& all_reduce : all_reduces)
+    {
+        for (auto& user : all_reduce->get_users(true))
+        {
+            // Only users with no AllReduce downstream are delayed, which also keeps the new
+            // dependencies from forming a cycle
+            auto downstream = get_downstream_nodes(user);
+            bool feeds_all_reduce = false;
+            for (auto& other : all_reduces)
+            {
+                feeds_all_reduce = feeds_all_reduce || downstream.count(other.get()) != 0;
+            }
+            if (feeds_all_reduce)
+            {
+                continue;
+            }
+            for (auto& other : all_reduces)
+            {
+                if (other != all_reduce)
+                {
+                    user->add_control_dependency(other);
+                    modified = true;
+                }
+            }
+        }
+    }
+    return modified;
+}
@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class AllReduceScheduling;
+    }
+}
+
+/// \brief Orders the AllReduce ops of a function for overlapping communication with compute.
+///
+/// Backends may run an AllReduce as a non-blocking DistributedInterface::iall_reduce and wait
+/// for it in the ops that use its result. This pass adds control dependencies so that the ops
+/// using the result of an AllReduce, unless they feed another AllReduce, run after every
+/// AllReduce has been started. In a training step all the gradient reductions are then in flight while
+/// the rest of the backward pass runs, and the optimizer updates wait for them last.
+class ngraph::pass::AllReduceScheduling : public FunctionPass
+{
+public:
+    AllReduceScheduling()
+        : FunctionPass()
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
@@ -0,0 +1,259 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cmath>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/batch_norm.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/fused/conv_fused.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/sqrt.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/pass/batch_norm_folding.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Every axis of a tensor of `rank` except `axis`
+static AxisSet all_axes_except(size_t rank, size_t axis)
+{
+    AxisSet axes;
+    for (size_t i = 0; i < rank; i++)
+    {
+        if (i != axis)
+        {
+            axes.insert(i);
+        }
+    }
+    return axes;
+}
+
+// The per-channel vector `node` broadcasts along axis 1 of a tensor of `rank`, or nullptr
+static shared_ptr<Node> get_channel_bias(const shared_ptr<Node>& node, size_t rank)
+{
+    auto broadcast = dynamic_pointer_cast<op::Broadcast>(node);
+    if (broadcast && broadcast->get_argument(0)->get_shape().size() == 1 &&
+        broadcast->get_broadcast_axes() == all_axes_except(rank, 1))
+    {
+        return broadcast->get_argument(0);
+    }
+    return nullptr;
+}
+
+template <typename T>
+static void fold_values(const op::Constant& filters,
+                        const op::Constant* bias,
+                        const op::Constant& gamma,
+                        const op::Constant& beta,
+                        const op::Constant& mean,
+                        const op::Constant& variance,
+                        double eps,
+                        vector<T>& new_filters,
+                        vector<T>& new_bias)
+{
+    new_filters = filters.get_vector<T>();
+    new_bias = beta.get_vector<T>();
+    auto gamma_values = gamma.get_vector<T>();
+    auto mean_values = mean.get_vector<T>();
+    auto variance_values = variance.get_vector<T>();
+    vector<T> bias_values = bias ? bias->get_vector<T>() : vector<T>(new_bias.size(), 0);
+
+    size_t channels = new_bias.size();
+    size_t filter_size = new_filters.size() / channels;
+    for (size_t c = 0; c < channels; c++)
+    {
+        T scale = gamma_values[c] / static_cast<T>(std::sqrt(variance_values[c] + eps));
+        new_bias[c] += (bias_values[c] - mean_values[c]) * scale;
+        for (size_t i = c * filter_size; i < (c + 1) * filter_size; i++)
+        {
+            new_filters[i] *= scale;
+        }
+    }
+}
+
+static bool fold_batch_norm(const shared_ptr<op::BatchNormInference>& bn)
+{
+    auto input = bn->get_argument(2);
+    size_t rank = input->get_shape().size();
+    if (rank < 3 || input->get_users().size() > 1)
+    {
+        return false;
+    }
+
+    shared_ptr<op::Convolution> conv;
+    shared_ptr<op::ConvolutionBias> conv_bias;
+    shared_ptr<Node> data;
+    shared_ptr<Node> filters;
+    shared_ptr<Node> bias;
+    if ((conv = dynamic_pointer_cast<op::Convolution>(input)))
+    {
+        data = conv->get_argument(0);
+        filters = conv->get_argument(1);
+    }
+    else if ((conv_bias = dynamic_pointer_cast<op::ConvolutionBias>(input)))
+    {
+        // batch norm after relu is not affine in the convolution
+        if (conv_bias->with_relu())
+        {
+            return false;
+        }
+        data = conv_bias->get_data_batch();
+        filters = conv_bias->get_filters();
+        bias = conv_bias->get_bias();
+    }
+    else if (auto add = dynamic_pointer_cast<op::Add>(input))
+    {
+        for (size_t i = 0; i < 2 && !conv; i++)
+        {
+            conv = dynamic_pointer_cast<op::Convolution>(add->get_argument(i));
+            bias = get_channel_bias(add->get_argument(1 - i), rank);
+            if (!conv || !bias || conv->get_users().size() > 1)
+            {
+                conv = nullptr;
+            }
+        }
+        if (!conv)
+        {
+            return false;
+        }
+        data = conv->get_argument(0);
+        filters = conv->get_argument(1);
+    }
+    else
+    {
+        return false;
+    }
+
+    NGRAPH_DEBUG << "Folding " << bn->get_name() << " into " << input->get_name();
+    auto type = bn->get_element_type();
+    auto gamma = bn->get_argument(0);
+    auto beta = bn->get_argument(1);
+    auto mean = bn->get_argument(3);
+    auto variance = bn->get_argument(4);
+    double eps = bn->get_eps_value();
+    size_t channels = gamma->get_shape()[0];
+
+    shared_ptr<Node> new_filters;
+    shared_ptr<Node> new_bias;
+    auto constant = [](const shared_ptr<Node>& node) {
+        return dynamic_pointer_cast<op::Constant>(node);
+    };
+    bool all_constant = constant(filters) && (!bias || constant(bias)) && constant(gamma) &&
+                        constant(beta) && constant(mean) && constant(variance);
+    if (all_constant && (type == element::f32 || type == element::f64))
+    {
+        auto bias_constant = bias ? constant(bias).get() : nullptr;
+        if (type == element::f32)
+        {
+            vector<float> filter_values;
+            vector<float> bias_values;
+            fold_values<float>(*constant(filters),
+                               bias_constant,
+                               *constant(gamma),
+                               *constant(beta),
+                               *constant(mean),
+                               *constant(variance),
+                               eps,
+                               filter_values,
+                               bias_values);
+            new_filters = op::Constant::create(type, filters->get_shape(), filter_values);
+            new_bias = op::Constant::create(type, Shape{channels}, bias_values);
+        }
+        else
+        {
+            vector<double> filter_values;
+            vector<double> bias_values;
+            fold_values<double>(*constant(filters),
+                                bias_constant,
+                                *constant(gamma),
+                                *constant(beta),
+                                *constant(mean),
+                                *constant(variance),
+                                eps,
+                                filter_values,
+                                bias_values);
+            new_filters = op::Constant::create(type, filters->get_shape(), filter_values);
+            new_bias = op::Constant::create(type, Shape{channels}, bias_values);
+        }
+    }
+    else
+    {
+        // scale = gamma / sqrt(variance + eps), bias = beta + (bias - mean) * scale
+        auto eps_node = op::Constant::create(type, Shape{channels}, vector<double>(channels, eps));
+        auto scale = make_shared<op::Divide>(
+            gamma, make_shared<op::Sqrt>(make_shared<op::Add>(variance, eps_node)));
+        if (bias)
+        {
+            auto centered = make_shared<op::Subtract>(bias, mean);
+            new_bias = make_shared<op::Add>(beta, make_shared<op::Multiply>(centered, scale));
+        }
+        else
+        {
+            new_bias = make_shared<op::Subtract>(beta, make_shared<op::Multiply>(mean, scale));
+        }
+        new_filters = make_shared<op::Multiply>(
+            filters,
+            make_shared<op::Broadcast>(
+                scale, filters->get_shape(), all_axes_except(filters->get_shape().size(), 0)));
+    }
+
+    shared_ptr<Node> replacement;
+    if (conv_bias)
+    {
+        replacement = make_shared<op::ConvolutionBias>(data,
+                                                       new_filters,
+                                                       new_bias,
+                                                       conv_bias->get_window_movement_strides(),
+                                                       conv_bias->get_window_dilation_strides(),
+                                                       conv_bias->get_padding_below(),
+                                                       conv_bias->get_padding_above(),
+                                                       conv_bias->get_data_dilation_strides());
+    }
+    else
+    {
+        auto new_conv = make_shared<op::Convolution>(data,
+                                                     new_filters,
+                                                     conv->get_window_movement_strides(),
+                                                     conv->get_window_dilation_strides(),
+                                                     conv->get_padding_below(),
+                                                     conv->get_padding_above(),
+                                                     conv->get_data_dilation_strides());
+        replacement = make_shared<op::Add>(
+            new_conv,
+            make_shared<op::Broadcast>(new_bias, new_conv->get_shape(), all_axes_except(rank, 1)));
+    }
+    replace_node(bn, replacement);
+    return true;
+}
+
+bool pass::BatchNormFolding::run_on_function(shared_ptr<Function> f)
+{
+    bool replaced = false;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (auto bn = dynamic_pointer_cast<op::BatchNormInference>(node))
+        {
+            replaced = fold_batch_norm(bn) || replaced;
+        }
+    }
+    return replaced;
+}
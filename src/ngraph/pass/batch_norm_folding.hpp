@@ -0,0 +1,46 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class BatchNormFolding;
+    }
+}
+
+/// \brief Folds a BatchNormInference into the convolution that produces its input.
+///
+/// The convolution (a Convolution, a Convolution plus a per-channel bias, or a ConvolutionBias
+/// without relu) gets its filters scaled by gamma / sqrt(variance + epsilon) per output channel
+/// and a bias of beta + (bias - mean) * gamma / sqrt(variance + epsilon), so inference no longer
+/// makes an extra pass over the activations. When the filters and the batch norm parameters are
+/// constants the new filters and bias are computed here, otherwise as ops in the graph. The
+/// convolution must only be used by the batch norm.
+class ngraph::pass::BatchNormFolding : public FunctionPass
+{
+public:
+    BatchNormFolding()
+        : FunctionPass()
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+};
@@ -0,0 +1,254 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+
+#include "ngraph/builder/quantization.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/fused/conv_fused.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/pass/calibrated_quantization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Extremes of a calibrated range, widened to include zero so it stays representable
+static pair<float, float> get_extremes(const runtime::TensorRange& range)
+{
+    float min_value = *min_element(range.min.begin(), range.min.end());
+    float max_value = *max_element(range.max.begin(), range.max.end());
+    return make_pair(min(min_value, 0.0f), max(max_value, 0.0f));
+}
+
+static shared_ptr<Node> make_scalar(float value)
+{
+    return op::Constant::create(element::f32, Shape{}, {value});
+}
+
+static shared_ptr<Node> quantize(const shared_ptr<Node>& input,
+                                 const pair<float, float>& extremes,
+                                 const element::Type& type)
+{
+    return builder::ScaledQuantize(input,
+                                   make_scalar(extremes.first),
+                                   make_scalar(extremes.second),
+                                   type,
+                                   AxisSet{},
+                                   op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+}
+
+pass::CalibratedQuantization::CalibratedQuantization(
+    const runtime::CalibrationTable& calibration_table, float min_sqnr_db)
+    : FunctionPass()
+    , m_calibration_table(calibration_table)
+    , m_min_sqnr_db(min_sqnr_db)
+{
+}
+
+bool pass::CalibratedQuantization::run_on_function(shared_ptr<Function> f)
+{
+    m_report.clear();
+    bool modified = false;
+    for (auto node : f->get_ordered_ops())
+    {
+        auto convolution = dynamic_pointer_cast<op::Convolution>(node);
+        auto convolution_bias = dynamic_pointer_cast<op::ConvolutionBias>(node);
+        auto dot = dynamic_pointer_cast<op::Dot>(node);
+        if ((!convolution && !convolution_bias && !dot) ||
+            node->get_element_type() != element::f32)
+        {
+            continue;
+        }
+        if (dot && (dot->get_reduction_axes_count() != 1 || dot->get_input_shape(0).size() != 2 ||
+                    dot->get_input_shape(1).size() != 2))
+        {
+            continue;
+        }
+
+        auto data = node->get_argument(0);
+        auto filters = dynamic_pointer_cast<op::Constant>(node->get_argument(1));
+        bool with_relu = convolution_bias && convolution_bias->with_relu();
+        shared_ptr<Node> last = node;
+        auto users = node->get_users();
+        if (users.size() == 1 && dynamic_pointer_cast<op::Relu>(users[0]))
+        {
+            last = users[0];
+            with_relu = true;
+        }
+
+        LayerReport report;
+        report.name = node->get_name();
+        report.op = node->description();
+        report.quantized = false;
+        report.sqnr_db = numeric_limits<float>::quiet_NaN();
+
+        auto input_range = m_calibration_table.find(data->get_name());
+        auto output_range = m_calibration_table.find(last->get_name());
+        if (!filters)
+        {
+            report.reason = "weights are not constant";
+        }
+        else if (input_range == m_calibration_table.end() ||
+                 output_range == m_calibration_table.end())
+        {
+            report.reason = "not calibrated";
+        }
+        else
+        {
+            report.sqnr_db = min(input_range->second.sqnr_db, output_range->second.sqnr_db);
+            if (report.sqnr_db < m_min_sqnr_db)
+            {
+                report.reason = "noise ratio below threshold";
+            }
+        }
+        if (!report.reason.empty())
+        {
+            m_report.push_back(report);
+            continue;
+        }
+
+        auto input_extremes = get_extremes(input_range->second);
+        auto output_extremes = get_extremes(output_range->second);
+        auto filter_values = filters->get_vector<float>();
+        auto filter_extremes =
+            make_pair(min(*min_element(filter_values.begin(), filter_values.end()), 0.0f),
+                      max(*max_element(filter_values.begin(), filter_values.end()), 0.0f));
+
+        auto input_type = input_extremes.first < 0 ? element::i8 : element::u8;
+        auto q_input = quantize(data, input_extremes, input_type);
+        shared_ptr<Node> q_filters = filters;
+        if (dot)
+        {
+            // QuantizedDot takes its weights as [output, input]
+            auto& shape = filters->get_shape();
+            q_filters =
+                make_shared<op::Reshape>(filters, AxisVector{1, 0}, Shape{shape[1], shape[0]});
+        }
+        q_filters = quantize(q_filters, filter_extremes, element::i8);
+
+        auto min_input = make_scalar(input_extremes.first);
+        auto max_input = make_scalar(input_extremes.second);
+        auto min_filter = make_scalar(filter_extremes.first);
+        auto max_filter = make_scalar(filter_extremes.second);
+        auto min_output = make_scalar(output_extremes.first);
+        auto max_output = make_scalar(output_extremes.second);
+
+        shared_ptr<Node> quantized;
+        if (convolution && with_relu)
+        {
+            quantized = builder::ScaledQuantizedConvolutionRelu(
+                q_input,
+                q_filters,
+                convolution->get_window_movement_strides(),
+                convolution->get_window_dilation_strides(),
+                convolution->get_padding_below(),
+                convolution->get_padding_above(),
+                convolution->get_data_dilation_strides(),
+                min_input,
+                max_input,
+                min_filter,
+                max_filter,
+                min_output,
+                max_output);
+        }
+        else if (convolution)
+        {
+            quantized = builder::ScaledQuantizedConvolution(
+                q_input,
+                q_filters,
+                convolution->get_window_movement_strides(),
+                convolution->get_window_dilation_strides(),
+                convolution->get_padding_below(),
+                convolution->get_padding_above(),
+                convolution->get_data_dilation_strides(),
+                min_input,
+                max_input,
+                min_filter,
+                max_filter,
+                min_output,
+                max_output);
+        }
+        else if (convolution_bias)
+        {
+            quantized = builder::ScaledQuantizedConvolutionBias(
+                q_input,
+                q_filters,
+                convolution_bias->get_bias(),
+                convolution_bias->get_window_movement_strides(),
+                convolution_bias->get_window_dilation_strides(),
+                convolution_bias->get_padding_below(),
+                convolution_bias->get_padding_above(),
+                convolution_bias->get_data_dilation_strides(),
+                min_input,
+                max_input,
+                min_filter,
+                max_filter,
+                min_output,
+                max_output,
+                with_relu);
+        }
+        else
+        {
+            quantized = builder::ScaledQuantizedDot(q_input,
+                                                    q_filters,
+                                                    min_input,
+                                                    max_input,
+                                                    min_filter,
+                                                    max_filter,
+                                                    min_output,
+                                                    max_output,
+                                                    true,
+                                                    with_relu);
+        }
+
+        replace_node(
+            last,
+            builder::ScaledDequantize(quantized, min_output, max_output, element::f32, AxisSet{}));
+        report.quantized = true;
+        m_report.push_back(report);
+        modified = true;
+    }
+
+    // Uncalibrated layers have no noise ratio and go last
+    stable_sort(m_report.begin(), m_report.end(), [](const LayerReport& a, const LayerReport& b) {
+        return !std::isnan(a.sqnr_db) && (std::isnan(b.sqnr_db) || a.sqnr_db < b.sqnr_db);
+    });
+    return modified;
+}
+
+void pass::CalibratedQuantization::print_report(ostream& out) const
+{
+    for (auto& layer : m_report)
+    {
+        out << layer.name << " (" << layer.op << "): ";
+        if (std::isnan(layer.sqnr_db))
+        {
+            out << "no noise estimate";
+        }
+        else
+        {
+            out << fixed << setprecision(1) << layer.sqnr_db << " dB";
+        }
+        out << ", " << (layer.quantized ? "quantized" : "kept in f32, " + layer.reason) << "\n";
+    }
+}
@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/runtime/calibrator.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class CalibratedQuantization;
+    }
+}
+
+/// \brief Replaces f32 Convolution, ConvolutionBias and Dot ops, with a following Relu fused,
+///        by their quantized forms, using ranges collected by runtime::Calibrator.
+///
+/// Each replaced op gets a Quantize on its data input, an i8 Quantize of its constant
+/// weights and a Dequantize back to f32 after it; running ConstantFolding afterwards folds
+/// the weight quantization and the scales into constants. The quantized ops take one range
+/// per tensor, so per-channel calibration ranges are reduced to their overall extremes.
+/// Layers whose estimated noise ratio is below `min_sqnr_db` are left in f32.
+class ngraph::pass::CalibratedQuantization : public FunctionPass
+{
+public:
+    class LayerReport
+    {
+    public:
+        std::string name;
+        std::string op;
+        bool quantized;
+        /// Lower of the calibrated input and output noise ratios, NaN if not calibrated
+        float sqnr_db;
+        /// Why the layer was left in f32; empty if it was quantized
+        std::string reason;
+    };
+
+    CalibratedQuantization(const runtime::CalibrationTable& calibration_table,
+                           float min_sqnr_db = 20.0f);
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \return The layers considered by the last run, most accuracy-sensitive first.
+    const std::vector<LayerReport>& get_report() const { return m_report; }
+    void print_report(std::ostream& out) const;
+
+private:
+    runtime::CalibrationTable m_calibration_table;
+    float m_min_sqnr_db;
+    std::vector<LayerReport> m_report;
+};
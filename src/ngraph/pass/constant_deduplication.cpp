@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cstring>
+#include <map>
+#include <unordered_map>
+
+#include "constant_deduplication.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Large constants are hashed and compared this many bytes at a time
+static const size_t s_chunk_size = 1 << 20;
+
+// FNV-1a of each chunk, combined
+static size_t hash_data(const char* data, size_t size)
+{
+    vector<size_t> chunk_hashes;
+    for (size_t offset = 0; offset < size; offset += s_chunk_size)
+    {
+        size_t end = min(size, offset + s_chunk_size);
+        uint64_t hash = 14695981039346656037ULL;
+        for (size_t i = offset; i < end; i++)
+        {
+            hash = (hash ^ static_cast<unsigned char>(data[i])) * 1099511628211ULL;
+        }
+        chunk_hashes.push_back(static_cast<size_t>(hash));
+    }
+    return hash_combine(chunk_hashes);
+}
+
+static bool equal_data(const char* a, const char* b, size_t size)
+{
+    for (size_t offset = 0; offset < size; offset += s_chunk_size)
+    {
+        if (memcmp(a + offset, b + offset, min(s_chunk_size, size - offset)) != 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool pass::ConstantDeduplication::run_on_function(shared_ptr<Function> f)
+{
+    // Constants that could be equal, by element type and shape, in graph order
+    map<pair<element::Type, Shape>, vector<shared_ptr<op::Constant>>> candidates;
+    for (auto& node : f->get_ordered_ops())
+    {
+        if (typeid(*node) == typeid(op::Constant))
+        {
+            auto constant = static_pointer_cast<op::Constant>(node);
+            candidates[make_pair(constant->get_element_type(), constant->get_shape())].push_back(
+                constant);
+        }
+    }
+
+    bool replaced = false;
+    size_t saved_bytes = 0;
+    for (auto& candidate : candidates)
+    {
+        auto& constants = candidate.second;
+        if (constants.size() < 2)
+        {
+            continue;
+        }
+        size_t size = shape_size(candidate.first.second) * candidate.first.first.size();
+        unordered_multimap<size_t, shared_ptr<op::Constant>> kept;
+        for (auto& constant : constants)
+        {
+            auto data = constant->get_data_ptr<char>();
+            size_t hash = hash_data(data, size);
+            shared_ptr<op::Constant> equal;
+            auto range = kept.equal_range(hash);
+            for (auto it = range.first; it != range.second && !equal; ++it)
+            {
+                if (equal_data(it->second->get_data_ptr<char>(), data, size))
+                {
+                    equal = it->second;
+                }
+            }
+            if (equal)
+            {
+                NGRAPH_DEBUG << "Replacing " << constant->get_name() << " with "
+                             << equal->get_name();
+                replace_node(constant, equal);
+                saved_bytes += size;
+                replaced = true;
+            }
+            else
+            {
+                kept.emplace(hash, constant);
+            }
+        }
+    }
+
+    if (m_saved_bytes)
+    {
+        *m_saved_bytes = saved_bytes;
+    }
+    return replaced;
+}
@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class ConstantDeduplication;
+    }
+}
+
+/// \brief Merges Constants whose element type, shape and bytes are all equal.
+///
+/// Exported models often hold many identical constants, such as repeated scales, shapes and
+/// masks, or tied embeddings that the exporter wrote out twice. Each set of equal constants
+/// is replaced by its first member. Only constants of the same element type and shape are
+/// hashed, and they are hashed and compared a chunk at a time, so a large tensor that matches
+/// no other constant is never read.
+///
+/// Run it before layout assignment, which may give equal constants different layouts.
+class ngraph::pass::ConstantDeduplication : public FunctionPass
+{
+public:
+    ConstantDeduplication()
+        : FunctionPass()
+    {
+    }
+
+    /// \param saved_bytes Set by each run to the bytes of constant data it removed
+    ConstantDeduplication(size_t& saved_bytes)
+        : FunctionPass()
+        , m_saved_bytes(&saved_bytes)
+    {
+    }
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    size_t* m_saved_bytes = nullptr;
+};
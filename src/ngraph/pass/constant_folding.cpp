@@ -14,7 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <exception>
+#include <functional>
 #include <stdint.h>
+#include <thread>
 
 #include "constant_folding.hpp"
 #include "ngraph/graph_util.hpp"
@@ -24,6 +28,9 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/experimental/layers/prior_box.hpp"
+#include "ngraph/op/experimental/layers/prior_box_clustered.hpp"
+#include "ngraph/op/experimental/shape_of.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/minimum.hpp"
 #include "ngraph/op/multiply.hpp"
@@ -56,33 +63,88 @@
 using namespace std;
 using namespace ngraph;
 
+// Elementwise folds of large constants are split into chunks of at least this many elements,
+// each evaluated on its own thread
+static const size_t s_parallel_grain = 1 << 16;
+
+static void parallel_chunks(size_t count, const function<void(size_t, size_t)>& f)
+{
+    size_t chunk_count = min<size_t>(max(1u, thread::hardware_concurrency()),
+                                     (count + s_parallel_grain - 1) / s_parallel_grain);
+    if (chunk_count <= 1)
+    {
+        f(0, count);
+        return;
+    }
+    size_t chunk_size = (count + chunk_count - 1) / chunk_count;
+    vector<exception_ptr> errors(chunk_count);
+    auto work = [&](size_t chunk) {
+        try
+        {
+            size_t begin = min(count, chunk * chunk_size);
+            f(begin, min(count, begin + chunk_size));
+        }
+        catch (...)
+        {
+            errors[chunk] = current_exception();
+        }
+    };
+    vector<thread> threads;
+    for (size_t chunk = 1; chunk < chunk_count; chunk++)
+    {
+        threads.emplace_back(work, chunk);
+    }
+    work(0);
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (const auto& error : errors)
+    {
+        if (error)
+        {
+            rethrow_exception(error);
+        }
+    }
+}
+
+// Folded values are computed straight into the buffer of the new Constant, rather than into a
+// vector that the Constant would copy element by element.
+template <class T>
+static unique_ptr<runtime::AlignedBuffer> make_folded_buffer(const Shape& shape)
+{
+    return unique_ptr<runtime::AlignedBuffer>(new runtime::AlignedBuffer(
+        shape_size(shape) * sizeof(T), op::Constant::host_alignment()));
+}
+
 template <class T>
 shared_ptr<op::Constant> fold_constant_reshape(shared_ptr<op::Constant> constant,
                                                shared_ptr<op::Reshape> reshape,
                                                NodeExecutorTy func)
 {
     auto out_shape = reshape->get_shape();
-    vector<T> out_vec(shape_size(out_shape));
+    auto out_buffer = make_folded_buffer<T>(out_shape);
+    T* out = static_cast<T*>(out_buffer->get_ptr());
 
     if (func != nullptr)
     {
         vector<void*> inputs;
         inputs.push_back(const_cast<void*>(constant->get_data_ptr()));
         vector<void*> outputs;
-        outputs.push_back(out_vec.data());
+        outputs.push_back(out);
 
         func(inputs, outputs);
     }
     else
     {
         runtime::reference::reshape<T>(constant->get_data_ptr<T>(),
-                                       out_vec.data(),
+                                       out,
                                        constant->get_shape(),
                                        reshape->get_input_order(),
                                        out_shape);
     }
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, out_vec);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, move(out_buffer));
 }
 
 template <class T>
@@ -91,7 +153,8 @@ shared_ptr<op::Constant> fold_constant_pad(shared_ptr<op::Constant> constant,
                                            NodeExecutorTy func)
 {
     auto out_shape = pad->get_shape();
-    vector<T> out_vec(shape_size(out_shape));
+    auto out_buffer = make_folded_buffer<T>(out_shape);
+    T* out = static_cast<T*>(out_buffer->get_ptr());
     auto pad_value = std::static_pointer_cast<op::Constant>(pad->get_argument(1));
 
     if (func != nullptr)
@@ -101,7 +164,7 @@ shared_ptr<op::Constant> fold_constant_pad(shared_ptr<op::Constant> constant,
         inputs.push_back(const_cast<void*>(pad_value->get_data_ptr()));
 
         vector<void*> outputs;
-        outputs.push_back(out_vec.data());
+        outputs.push_back(out);
 
         func(inputs, outputs);
     }
@@ -109,7 +172,7 @@ shared_ptr<op::Constant> fold_constant_pad(shared_ptr<op::Constant> constant,
     {
         runtime::reference::pad<T>(constant->get_data_ptr<T>(),
                                    pad_value->get_data_ptr<T>(),
-                                   out_vec.data(),
+                                   out,
                                    constant->get_shape(),
                                    out_shape,
                                    pad->get_padding_below(),
@@ -117,7 +180,7 @@ shared_ptr<op::Constant> fold_constant_pad(shared_ptr<op::Constant> constant,
                                    pad->get_pad_mode());
     }
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, out_vec);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, move(out_buffer));
 }
 
 void pass::ConstantFolding::construct_constant_pad()
@@ -256,27 +319,28 @@ shared_ptr<op::Constant> fold_constant_broadcast(shared_ptr<op::Constant> consta
                                                  NodeExecutorTy func)
 {
     auto out_shape = broadcast->get_shape();
-    vector<T> out_vec(shape_size(out_shape));
+    auto out_buffer = make_folded_buffer<T>(out_shape);
+    T* out = static_cast<T*>(out_buffer->get_ptr());
 
     if (func != nullptr)
     {
         vector<void*> inputs;
         inputs.push_back(const_cast<void*>(constant->get_data_ptr()));
         vector<void*> outputs;
-        outputs.push_back(out_vec.data());
+        outputs.push_back(out);
 
         func(inputs, outputs);
     }
     else
     {
         runtime::reference::broadcast<T>(constant->get_data_ptr<T>(),
-                                         out_vec.data(),
+                                         out,
                                          constant->get_shape(),
                                          out_shape,
                                          broadcast->get_broadcast_axes());
     }
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, out_vec);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, move(out_buffer));
 }
 
 void pass::ConstantFolding::construct_constant_broadcast()
@@ -353,7 +417,8 @@ shared_ptr<op::Constant> fold_constant_binary(shared_ptr<op::Constant> a,
                                               NodeExecutorTy func)
 {
     auto out_shape = binary->get_shape();
-    vector<T> out_vec(shape_size(out_shape));
+    auto out_buffer = make_folded_buffer<T>(out_shape);
+    T* out = static_cast<T*>(out_buffer->get_ptr());
 
     if (func != nullptr)
     {
@@ -361,50 +426,51 @@ shared_ptr<op::Constant> fold_constant_binary(shared_ptr<op::Constant> a,
         inputs.push_back(const_cast<void*>(a->get_data_ptr()));
         inputs.push_back(const_cast<void*>(b->get_data_ptr()));
         vector<void*> outputs;
-        outputs.push_back(out_vec.data());
+        outputs.push_back(out);
 
         func(inputs, outputs);
     }
     else
     {
+        void (*kernel)(const T*, const T*, T*, size_t) = nullptr;
         if (std::dynamic_pointer_cast<op::Add>(binary))
         {
-            runtime::reference::add<T>(
-                a->get_data_ptr<T>(), b->get_data_ptr<T>(), out_vec.data(), shape_size(out_shape));
+            kernel = runtime::reference::add<T>;
         }
         else if (std::dynamic_pointer_cast<op::Subtract>(binary))
         {
-            runtime::reference::subtract<T>(
-                a->get_data_ptr<T>(), b->get_data_ptr<T>(), out_vec.data(), shape_size(out_shape));
+            kernel = runtime::reference::subtract<T>;
         }
         else if (std::dynamic_pointer_cast<op::Multiply>(binary))
         {
-            runtime::reference::multiply<T>(
-                a->get_data_ptr<T>(), b->get_data_ptr<T>(), out_vec.data(), shape_size(out_shape));
+            kernel = runtime::reference::multiply<T>;
         }
         else if (std::dynamic_pointer_cast<op::Divide>(binary))
         {
-            runtime::reference::divide<T>(
-                a->get_data_ptr<T>(), b->get_data_ptr<T>(), out_vec.data(), shape_size(out_shape));
+            kernel = runtime::reference::divide<T>;
         }
         else if (std::dynamic_pointer_cast<op::Minimum>(binary))
         {
-            runtime::reference::minimum<T>(
-                a->get_data_ptr<T>(), b->get_data_ptr<T>(), out_vec.data(), shape_size(out_shape));
+            kernel = runtime::reference::minimum<T>;
         }
         else if (std::dynamic_pointer_cast<op::Maximum>(binary))
         {
-            runtime::reference::maximum<T>(
-                a->get_data_ptr<T>(), b->get_data_ptr<T>(), out_vec.data(), shape_size(out_shape));
+            kernel = runtime::reference::maximum<T>;
         }
         else
         {
             NGRAPH_CHECK(false,
                          "fold_constant_binary must be consistent with is_supported_binary_op");
         }
+
+        const T* arg0 = a->get_data_ptr<T>();
+        const T* arg1 = b->get_data_ptr<T>();
+        parallel_chunks(shape_size(out_shape), [&](size_t begin, size_t end) {
+            kernel(arg0 + begin, arg1 + begin, out + begin, end - begin);
+        });
     }
 
-    return make_shared<op::Constant>(a->get_element_type(), out_shape, out_vec);
+    return make_shared<op::Constant>(a->get_element_type(), out_shape, move(out_buffer));
 }
 
 bool is_supported_binary_op(std::shared_ptr<Node> n)
@@ -463,6 +529,12 @@ void pass::ConstantFolding::construct_constant_binary()
                          fold_constant_binary<int8_t>(a_match, b_match, binary_match, func));
             return true;
         }
+        else if (type == element::i64)
+        {
+            replace_node(m.get_match_root(),
+                         fold_constant_binary<int64_t>(a_match, b_match, binary_match, func));
+            return true;
+        }
         else if (type == element::f32)
         {
             replace_node(m.get_match_root(),
@@ -498,7 +570,7 @@ shared_ptr<op::Constant> fold_constant_unary(shared_ptr<op::Constant> constant,
     //check sqrt arg
     if (std::dynamic_pointer_cast<op::Sqrt>(unary))
     {
-        std::vector<T> values{constant->get_vector<T>()};
+        auto values = constant->get_values<T>();
         if (std::any_of(values.begin(), values.end(), [](T i) { return i < 0; }))
         {
             throw ngraph_error("Square root of negative value");
@@ -506,46 +578,49 @@ shared_ptr<op::Constant> fold_constant_unary(shared_ptr<op::Constant> constant,
     }
 
     auto out_shape = unary->get_shape();
-    vector<T> out_vec(shape_size(out_shape));
+    auto out_buffer = make_folded_buffer<T>(out_shape);
+    T* out = static_cast<T*>(out_buffer->get_ptr());
 
     if (func != nullptr)
     {
         vector<void*> inputs;
         inputs.push_back(const_cast<void*>(constant->get_data_ptr()));
         vector<void*> outputs;
-        outputs.push_back(out_vec.data());
+        outputs.push_back(out);
 
         func(inputs, outputs);
     }
     else
     {
+        void (*kernel)(const T*, T*, size_t) = nullptr;
         if (std::dynamic_pointer_cast<op::Abs>(unary))
         {
-            runtime::reference::abs<T>(
-                constant->get_data_ptr<T>(), out_vec.data(), shape_size(out_shape));
+            kernel = runtime::reference::abs<T>;
         }
         else if (std::dynamic_pointer_cast<op::Negative>(unary))
         {
-            runtime::reference::negate<T>(
-                constant->get_data_ptr<T>(), out_vec.data(), shape_size(out_shape));
+            kernel = runtime::reference::negate<T>;
         }
         else if (std::dynamic_pointer_cast<op::Relu>(unary))
         {
-            runtime::reference::relu<T>(
-                constant->get_data_ptr<T>(), out_vec.data(), shape_size(out_shape));
+            kernel = runtime::reference::relu<T>;
         }
         else if (std::dynamic_pointer_cast<op::Sqrt>(unary))
         {
-            runtime::reference::sqrt<T>(
-                constant->get_data_ptr<T>(), out_vec.data(), shape_size(out_shape));
+            kernel = runtime::reference::sqrt<T>;
         }
         else
         {
             NGRAPH_CHECK(false, "must be consistent with is_supported_unary_op");
         }
+
+        const T* arg = constant->get_data_ptr<T>();
+        parallel_chunks(shape_size(out_shape), [&](size_t begin, size_t end) {
+            kernel(arg + begin, out + begin, end - begin);
+        });
     }
 
-    return make_shared<op::Constant>(constant->get_element_type(), out_shape, out_vec);
+    return make_shared<op::Constant>(constant->get_element_type(), out_shape, move(out_buffer));
 }
 
 void pass::ConstantFolding::construct_constant_unary()
@@ -621,17 +696,35 @@ shared_ptr<op::Constant> fold_constant_dequantize(shared_ptr<op::Constant> const
                                                   shared_ptr<op::Constant> offset)
 {
     auto out_shape = constant->get_shape();
-    vector<REAL> out_vec(shape_size(out_shape));
+    auto out_buffer = make_folded_buffer<REAL>(out_shape);
+    REAL* out = static_cast<REAL*>(out_buffer->get_ptr());
 
-    runtime::reference::dequantize<QUANT, REAL>(constant->get_vector<QUANT>().data(),
-                                                scale->get_vector<REAL>().data(),
-                                                offset->get_vector<QUANT>().data(),
-                                                out_vec.data(),
-                                                constant->get_shape(),
-                                                scale->get_shape(),
-                                                dequant->get_axes());
+    if (dequant->get_axes().empty())
+    {
+        // with a single scale and offset every element is dequantized independently
+        const QUANT* arg = constant->get_data_ptr<QUANT>();
+        parallel_chunks(shape_size(out_shape), [&](size_t begin, size_t end) {
+            runtime::reference::dequantize<QUANT, REAL>(arg + begin,
+                                                        scale->get_data_ptr<REAL>(),
+                                                        offset->get_data_ptr<QUANT>(),
+                                                        out + begin,
+                                                        Shape{end - begin},
+                                                        Shape{},
+                                                        AxisSet{});
+        });
+    }
+    else
+    {
+        runtime::reference::dequantize<QUANT, REAL>(constant->get_data_ptr<QUANT>(),
+                                                    scale->get_data_ptr<REAL>(),
+                                                    offset->get_data_ptr<QUANT>(),
+                                                    out,
+                                                    constant->get_shape(),
+                                                    scale->get_shape(),
+                                                    dequant->get_axes());
+    }
 
-    return make_shared<op::Constant>(dequant->get_element_type(), out_shape, out_vec);
+    return make_shared<op::Constant>(dequant->get_element_type(), out_shape, move(out_buffer));
 }
 
 void pass::ConstantFolding::construct_constant_dequantize()
@@ -695,18 +788,37 @@ shared_ptr<op::Constant> fold_constant_quantize(shared_ptr<op::Constant> constan
                                                 shared_ptr<op::Constant> offset)
 {
     auto out_shape = constant->get_shape();
-    vector<QUANT> out_vec(shape_size(out_shape));
-
-    runtime::reference::quantize<REAL, QUANT>(constant->get_vector<REAL>().data(),
-                                              scale->get_vector<REAL>().data(),
-                                              offset->get_vector<QUANT>().data(),
-                                              out_vec.data(),
-                                              constant->get_shape(),
-                                              scale->get_shape(),
-                                              quant->get_axes(),
-                                              quant->get_round_mode());
-
-    return make_shared<op::Constant>(quant->get_element_type(), out_shape, out_vec);
+    auto out_buffer = make_folded_buffer<QUANT>(out_shape);
+    QUANT* out = static_cast<QUANT*>(out_buffer->get_ptr());
+
+    if (quant->get_axes().empty())
+    {
+        // with a single scale and offset every element is quantized independently
+        const REAL* arg = constant->get_data_ptr<REAL>();
+        parallel_chunks(shape_size(out_shape), [&](size_t begin, size_t end) {
+            runtime::reference::quantize<REAL, QUANT>(arg + begin,
+                                                      scale->get_data_ptr<REAL>(),
+                                                      offset->get_data_ptr<QUANT>(),
+                                                      out + begin,
+                                                      Shape{end - begin},
+                                                      Shape{},
+                                                      AxisSet{},
+                                                      quant->get_round_mode());
+        });
+    }
+    else
+    {
+        runtime::reference::quantize<REAL, QUANT>(constant->get_data_ptr<REAL>(),
+                                                  scale->get_data_ptr<REAL>(),
+                                                  offset->get_data_ptr<QUANT>(),
+                                                  out,
+                                                  constant->get_shape(),
+                                                  scale->get_shape(),
+                                                  quant->get_axes(),
+                                                  quant->get_round_mode());
+    }
+
+    return make_shared<op::Constant>(quant->get_element_type(), out_shape, move(out_buffer));
 }
 
 void pass::ConstantFolding::construct_constant_quantize()
@@ -763,3 +875,83 @@ void pass::ConstantFolding::construct_constant_quantize()
     this->add_matcher(
         quantize_matcher, constant_quantize_callback, PassProperty::REQUIRE_STATIC_SHAPE);
 }
+
+void pass::ConstantFolding::construct_constant_shape_of()
+{
+    auto arg_label = make_shared<pattern::op::Label>(element::f32, Shape{2, 3, 4});
+    auto shape_of = make_shared<op::ShapeOf>(arg_label);
+
+    auto constant_shape_of_callback = [arg_label](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for constant_shape_of_callback against node = "
+                     << m.get_match_root()->get_name();
+
+        auto replacement_constants = m.get_match_root()->as_constants();
+        if (replacement_constants.empty())
+        {
+            return false;
+        }
+
+        replace_node(m.get_match_root(), replacement_constants.at(0));
+        return true;
+    };
+
+    // ShapeOf only needs a static input shape, not a fully static function, so this is safe
+    // to run while other parts of the graph are still dynamic.
+    auto shape_of_matcher =
+        make_shared<pattern::Matcher>(shape_of, "ConstantFolding.ConstantShapeOf");
+    this->add_matcher(shape_of_matcher, constant_shape_of_callback, all_pass_property_off);
+}
+
+void pass::ConstantFolding::construct_constant_prior_box()
+{
+    auto layer_shape_label =
+        make_shared<pattern::op::Label>(element::i64, Shape{2}, pattern::has_class<op::Constant>());
+    auto image_shape_label =
+        make_shared<pattern::op::Label>(element::i64, Shape{2}, pattern::has_class<op::Constant>());
+    auto prior_box = make_shared<op::PriorBox>(layer_shape_label,
+                                               image_shape_label,
+                                               vector<float>{1.0f},
+                                               vector<float>{},
+                                               vector<float>{},
+                                               false,
+                                               false,
+                                               0.0f,
+                                               0.5f,
+                                               vector<float>{},
+                                               true);
+    auto prior_box_clustered = make_shared<op::PriorBoxClustered>(layer_shape_label,
+                                                                  image_shape_label,
+                                                                  1,
+                                                                  vector<float>{1.0f},
+                                                                  vector<float>{1.0f},
+                                                                  false,
+                                                                  0.0f,
+                                                                  0.0f,
+                                                                  0.5f,
+                                                                  vector<float>{});
+
+    auto constant_prior_box_callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for constant_prior_box_callback against node = "
+                     << m.get_match_root()->get_name();
+
+        auto replacement_constants = m.get_match_root()->as_constants();
+        if (replacement_constants.empty())
+        {
+            return false;
+        }
+
+        replace_node(m.get_match_root(), replacement_constants.at(0));
+        return true;
+    };
+
+    // The boxes only depend on the layer and image shapes, which are usually ShapeOf outputs
+    // folded just before, so like ShapeOf this does not need a fully static function.
+    this->add_matcher(
+        make_shared<pattern::Matcher>(prior_box, "ConstantFolding.ConstantPriorBox"),
+        constant_prior_box_callback,
+        all_pass_property_off);
+    this->add_matcher(make_shared<pattern::Matcher>(prior_box_clustered,
+                                                    "ConstantFolding.ConstantPriorBoxClustered"),
+                      constant_prior_box_callback,
+                      all_pass_property_off);
+}
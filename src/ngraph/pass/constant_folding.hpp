@@ -38,7 +38,9 @@ public:
         DEQUANTIZE,
         UNARY,
         BINARY,
-        QUANTIZE
+        QUANTIZE,
+        SHAPE_OF,
+        PRIOR_BOX
     };
 
     ConstantFolding(const ngraph::BuildNodeExecutorMap& cfmap = ngraph::BuildNodeExecutorMap())
@@ -52,6 +54,8 @@ public:
         construct_constant_binary();
         construct_constant_quantize();
         construct_constant_dequantize();
+        construct_constant_shape_of();
+        construct_constant_prior_box();
     }
 
     //this allows to specify the order in which matchers will be run
@@ -72,6 +76,8 @@ public:
             case CFTransformations::BINARY: construct_constant_binary(); break;
             case CFTransformations::DEQUANTIZE: construct_constant_dequantize(); break;
             case CFTransformations::QUANTIZE: construct_constant_quantize(); break;
+            case CFTransformations::SHAPE_OF: construct_constant_shape_of(); break;
+            case CFTransformations::PRIOR_BOX: construct_constant_prior_box(); break;
             }
         }
     }
@@ -84,6 +90,8 @@ private:
     void construct_constant_binary();
     void construct_constant_quantize();
     void construct_constant_dequantize();
+    void construct_constant_shape_of();
+    void construct_constant_prior_box();
 
     ngraph::BuildNodeExecutorMap m_cfmap;
 };
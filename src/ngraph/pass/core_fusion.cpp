@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cmath>
 #include <unordered_set>
 
 #include "ngraph/pass/core_fusion.hpp"
@@ -27,19 +28,25 @@
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/divide.hpp"
+#include "ngraph/op/erf.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
+#include "ngraph/op/fused/gelu.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/op/power.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/tanh.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -54,6 +61,49 @@ static shared_ptr<Node> construct_constant_node(int n)
     return op::Constant::create(element::f32, Shape{}, {n});
 }
 
+static shared_ptr<pattern::op::Label> make_constant_label(const element::Type& type,
+                                                          const Shape& shape)
+{
+    return make_shared<pattern::op::Label>(type, shape, pattern::has_class<op::Constant>());
+}
+
+static shared_ptr<pattern::op::Label> wrap_in_label(const shared_ptr<Node>& node)
+{
+    return make_shared<pattern::op::Label>(node, nullptr, NodeVector{node});
+}
+
+static shared_ptr<Node> skip_broadcast(const shared_ptr<Node>& node)
+{
+    return make_shared<pattern::op::Skip>(node, pattern::has_class<op::Broadcast>());
+}
+
+// Reads the value of a constant whose elements are all equal
+static bool get_constant_value(const shared_ptr<Node>& node, double& value)
+{
+    auto constant = dynamic_pointer_cast<op::Constant>(node);
+    if (!constant)
+    {
+        return false;
+    }
+    auto values = constant->get_value_strings();
+    if (values.empty() || any_of(values.begin(), values.end(), [&](const string& s) {
+            return s != values[0];
+        }))
+    {
+        return false;
+    }
+    value = stod(values[0]);
+    return true;
+}
+
+// Exporters write constants such as 1 / sqrt(2) with a few digits, so they are compared with
+// a relative tolerance
+static bool is_constant_value(const shared_ptr<Node>& node, double expected)
+{
+    double value;
+    return get_constant_value(node, value) && abs(value - expected) <= 1e-4 * abs(expected);
+}
+
 void pass::CoreFusion::construct_relu()
 {
     auto iconst0 = construct_constant_node(0);
@@ -741,6 +791,211 @@ void pass::CoreFusion::construct_reshape_softmax_reshape()
     this->add_matcher(m, callback);
 }
 
+void pass::CoreFusion::construct_layer_norm()
+{
+    Shape shape{2, 4};
+    Shape reduced_shape{2};
+    AxisSet norm_axes{1};
+    auto input = make_shared<pattern::op::Label>(element::f32, shape);
+    auto gamma = make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto beta = make_shared<pattern::op::Label>(element::f32, Shape{4});
+    auto mean_count = make_constant_label(element::f32, reduced_shape);
+    auto variance_count = make_constant_label(element::f32, reduced_shape);
+    auto epsilon = make_constant_label(element::f32, reduced_shape);
+
+    // intermediate nodes are wrapped in labels to check their attributes in the callback
+    auto mean_sum = wrap_in_label(make_shared<op::Sum>(input, norm_axes));
+    auto mean = make_shared<op::Divide>(mean_sum, skip_broadcast(mean_count));
+    auto mean_broadcast = wrap_in_label(make_shared<op::Broadcast>(mean, shape, norm_axes));
+    auto centered = wrap_in_label(make_shared<op::Subtract>(input, mean_broadcast));
+    auto variance_sum = wrap_in_label(make_shared<op::Sum>(centered * centered, norm_axes));
+    auto variance = make_shared<op::Divide>(variance_sum, skip_broadcast(variance_count));
+    auto stddev = make_shared<op::Sqrt>(make_shared<op::Add>(variance, skip_broadcast(epsilon)));
+    auto stddev_broadcast = wrap_in_label(make_shared<op::Broadcast>(stddev, shape, norm_axes));
+    auto normalized = make_shared<op::Divide>(centered, stddev_broadcast);
+    auto gamma_broadcast = wrap_in_label(make_shared<op::Broadcast>(gamma, shape, AxisSet{0}));
+    auto beta_broadcast = wrap_in_label(make_shared<op::Broadcast>(beta, shape, AxisSet{0}));
+    auto layer_norm = normalized * gamma_broadcast + beta_broadcast;
+
+    auto callback = [input,
+                     gamma,
+                     beta,
+                     mean_count,
+                     variance_count,
+                     epsilon,
+                     mean_sum,
+                     mean_broadcast,
+                     variance_sum,
+                     stddev_broadcast,
+                     gamma_broadcast,
+                     beta_broadcast](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_layer_norm against "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto input_m = pattern_map[input];
+        if (!input_m->get_element_type().is_real())
+        {
+            NGRAPH_DEBUG << "Input " << input_m->get_name() << " is not floating point";
+            return false;
+        }
+
+        // the statistics must be taken over the trailing axes
+        const Shape& shape_m = input_m->get_shape();
+        auto norm_axes_m =
+            static_pointer_cast<op::Sum>(pattern_map[mean_sum])->get_reduction_axes();
+        if (norm_axes_m.empty() || *norm_axes_m.rbegin() != shape_m.size() - 1 ||
+            norm_axes_m.size() != shape_m.size() - *norm_axes_m.begin())
+        {
+            NGRAPH_DEBUG << "Mean is not taken over the trailing axes";
+            return false;
+        }
+        size_t begin_norm_axis = *norm_axes_m.begin();
+        AxisSet batch_axes_m;
+        size_t norm_size = 1;
+        for (size_t i = 0; i < shape_m.size(); i++)
+        {
+            if (i < begin_norm_axis)
+            {
+                batch_axes_m.insert(i);
+            }
+            else
+            {
+                norm_size *= shape_m[i];
+            }
+        }
+
+        auto broadcast_axes = [&pattern_map](const shared_ptr<pattern::op::Label>& label) {
+            return static_pointer_cast<op::Broadcast>(pattern_map[label])->get_broadcast_axes();
+        };
+        if (static_pointer_cast<op::Sum>(pattern_map[variance_sum])->get_reduction_axes() !=
+                norm_axes_m ||
+            broadcast_axes(mean_broadcast) != norm_axes_m ||
+            broadcast_axes(stddev_broadcast) != norm_axes_m ||
+            broadcast_axes(gamma_broadcast) != batch_axes_m ||
+            broadcast_axes(beta_broadcast) != batch_axes_m)
+        {
+            NGRAPH_DEBUG << "Reduction and broadcast axes don't match";
+            return false;
+        }
+
+        double epsilon_value;
+        if (!is_constant_value(pattern_map[mean_count], norm_size) ||
+            !is_constant_value(pattern_map[variance_count], norm_size) ||
+            !get_constant_value(pattern_map[epsilon], epsilon_value) || epsilon_value < 0)
+        {
+            NGRAPH_DEBUG << "Unexpected element count or epsilon constants";
+            return false;
+        }
+
+        auto layer_norm_node = make_shared<op::LayerNorm>(
+            input_m, pattern_map[gamma], pattern_map[beta], epsilon_value, begin_norm_axis);
+        replace_node(m.get_match_root(), layer_norm_node);
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(layer_norm, "CoreFusion.LayerNorm");
+    this->add_matcher(m, callback);
+}
+
+void pass::CoreFusion::construct_gelu()
+{
+    // 0.5 * x * (1 + cdf) with cdf either erf(x / sqrt(2)) or
+    // tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)). Exporters spell both in several ways, so a
+    // matcher is added for each division or multiplication inside erf, each way of computing
+    // x^3 and each order of the outer products.
+    Shape shape{2, 4};
+    auto input = make_shared<pattern::op::Label>(element::f32, shape);
+    auto half = make_constant_label(element::f32, shape);
+    auto one = make_constant_label(element::f32, shape);
+    auto scale = make_constant_label(element::f32, shape);
+    auto coefficient = make_constant_label(element::f32, shape);
+    auto exponent = make_constant_label(element::f32, shape);
+
+    for (bool approximate : {false, true})
+    {
+        for (bool alternative : {false, true})
+        {
+            shared_ptr<Node> cdf;
+            if (approximate)
+            {
+                // x^3 is Power(x, 3) or x * x * x
+                shared_ptr<Node> cube =
+                    alternative ? make_shared<op::Power>(input, skip_broadcast(exponent))
+                                : input * input * input;
+                auto inner = make_shared<op::Add>(
+                    input, make_shared<op::Multiply>(skip_broadcast(coefficient), cube));
+                cdf = make_shared<op::Tanh>(
+                    make_shared<op::Multiply>(skip_broadcast(scale), inner));
+            }
+            else
+            {
+                // x / sqrt(2) or x * (1 / sqrt(2))
+                shared_ptr<Node> scaled =
+                    alternative ? input * skip_broadcast(scale) : input / skip_broadcast(scale);
+                cdf = make_shared<op::Erf>(scaled);
+            }
+            auto one_plus_cdf = make_shared<op::Add>(skip_broadcast(one), cdf);
+
+            NodeVector gelu_patterns{
+                (input * skip_broadcast(half)) * one_plus_cdf,
+                (input * one_plus_cdf) * skip_broadcast(half),
+                input * (skip_broadcast(half) * one_plus_cdf)};
+
+            auto callback = [input,
+                             half,
+                             one,
+                             scale,
+                             coefficient,
+                             exponent,
+                             approximate,
+                             alternative](pattern::Matcher& m) {
+                NGRAPH_DEBUG << "In a callback for construct_gelu against "
+                             << m.get_match_root()->get_name();
+                auto pattern_map = m.get_pattern_map();
+
+                auto input_m = pattern_map[input];
+                if (!input_m->get_element_type().is_real())
+                {
+                    NGRAPH_DEBUG << "Input " << input_m->get_name() << " is not floating point";
+                    return false;
+                }
+
+                bool constants_match = is_constant_value(pattern_map[half], 0.5) &&
+                                       is_constant_value(pattern_map[one], 1.0);
+                if (approximate)
+                {
+                    constants_match =
+                        constants_match &&
+                        is_constant_value(pattern_map[scale], sqrt(2.0 / M_PI)) &&
+                        is_constant_value(pattern_map[coefficient], 0.044715) &&
+                        (!alternative || is_constant_value(pattern_map[exponent], 3.0));
+                }
+                else
+                {
+                    constants_match =
+                        constants_match &&
+                        is_constant_value(pattern_map[scale], alternative ? M_SQRT1_2 : M_SQRT2);
+                }
+                if (!constants_match)
+                {
+                    NGRAPH_DEBUG << "Constants don't match gelu";
+                    return false;
+                }
+
+                replace_node(m.get_match_root(), make_shared<op::Gelu>(input_m, approximate));
+                return true;
+            };
+
+            for (auto gelu : gelu_patterns)
+            {
+                auto m = make_shared<pattern::Matcher>(gelu, "CoreFusion.Gelu");
+                this->add_matcher(m, callback);
+            }
+        }
+    }
+}
+
 void ngraph::pass::CoreFusion::construct_conv_bias()
 {
     Shape shape{2, 2, 1, 1};
@@ -42,6 +42,8 @@ public:
             construct_optimized_strided_conv();
             construct_reshape_broadcast();
             construct_reshape_softmax_reshape();
+            construct_layer_norm();
+            construct_gelu();
         }
         // Patterns under FOP_FUSIONS create ops (FusedOps) that might not
         // be all supported by certain backends. In such a case, backends
@@ -61,6 +63,8 @@ public:
     void construct_optimized_strided_conv();
     void construct_reshape_broadcast();
     void construct_reshape_softmax_reshape();
+    void construct_layer_norm();
+    void construct_gelu();
     void construct_conv_bias();
     void construct_conv_bias_add();
 };
@@ -183,51 +183,30 @@ static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node
 static unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>
     ops_to_cse_handlers = initialize_ops_to_cse_handlers();
 
+// Buckets nodes by their structural hash, which already covers the type, output shapes,
+// constant values and arguments, so that the op's handler only runs on likely matches
 class NodeKey
 {
 public:
-    NodeKey(shared_ptr<Node> n,
-            unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
-                backend_handlers)
+    NodeKey(shared_ptr<Node> n, const function<bool(shared_ptr<Node>, shared_ptr<Node>)>& handler)
         : m_node(n)
-        , m_backend_handlers(backend_handlers)
+        , m_hash(n->get_structural_hash())
+        , m_handler(handler)
     {
     }
 
     shared_ptr<Node> get_node() const { return m_node; }
+    size_t get_hash() const { return m_hash; }
     bool operator==(const NodeKey& other) const
     {
-        Node& p_this = *m_node.get();
-        Node& p_other = *other.get_node().get();
-
-        if (TI(p_this) != TI(p_other))
-        {
-            return false;
-        }
-
-        {
-            auto eh = ops_to_cse_handlers.find(TI(p_this));
-            if (eh != ops_to_cse_handlers.end())
-            {
-                return eh->second(m_node, other.get_node());
-            }
-        }
-
-        {
-            auto eh = m_backend_handlers.find(TI(p_this));
-            if (eh != m_backend_handlers.end())
-            {
-                return eh->second(m_node, other.get_node());
-            }
-        }
-
-        return false;
+        return m_hash == other.m_hash && TI(*m_node) == TI(*other.m_node) &&
+               m_handler(m_node, other.m_node);
     }
 
 private:
     shared_ptr<Node> m_node;
-    unordered_map<type_index, function<bool(shared_ptr<Node>, shared_ptr<Node>)>>&
-        m_backend_handlers;
+    size_t m_hash;
+    const function<bool(shared_ptr<Node>, shared_ptr<Node>)>& m_handler;
 };
 
 namespace std
@@ -235,35 +214,7 @@ namespace std
     template <>
     struct hash<NodeKey>
     {
-        size_t operator()(const NodeKey& k) const
-        {
-            Node& p_this = *k.get_node().get();
-            auto ti = TI(p_this);
-
-            hash<type_index> type_hash_compute{};
-            auto type_hash = type_hash_compute(ti);
-
-            vector<size_t> arg_ids;
-
-            arg_ids.push_back(type_hash);
-
-            auto cargs = k.get_node()->get_arguments();
-
-            // TODO: Do we need another map, so we could
-            // specify how to compute hash for each op?
-            if (p_this.is_commutative())
-            {
-                sort(begin(cargs), end(cargs));
-            }
-
-            for (auto arg : cargs)
-            {
-                arg_ids.push_back(arg->get_instance_id());
-            }
-
-            auto hashc = ngraph::hash_combine(arg_ids);
-            return hashc;
-        }
+        size_t operator()(const NodeKey& k) const { return k.get_hash(); }
     };
 }
 
@@ -279,10 +230,21 @@ bool ngraph::pass::CommonSubexpressionElimination::run_on_function(shared_ptr<ng
             continue;
         }
 
-        NodeKey n_key(n, m_backend_cse_handlers);
-        if (expressions.count(n_key))
+        auto eh = ops_to_cse_handlers.find(TI(*n));
+        if (eh == ops_to_cse_handlers.end())
+        {
+            eh = m_backend_cse_handlers.find(TI(*n));
+            if (eh == m_backend_cse_handlers.end())
+            {
+                continue;
+            }
+        }
+
+        NodeKey n_key(n, eh->second);
+        auto it = expressions.find(n_key);
+        if (it != expressions.end())
         {
-            ngraph::replace_node(n, expressions.at(n_key));
+            ngraph::replace_node(n, it->second);
             replaced = true;
         }
         else
@@ -0,0 +1,248 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/dyn_elimination.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/experimental/dyn_broadcast.hpp"
+#include "ngraph/op/experimental/dyn_pad.hpp"
+#include "ngraph/op/experimental/dyn_reshape.hpp"
+#include "ngraph/op/experimental/dyn_slice.hpp"
+#include "ngraph/op/pad.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/label.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool pass::DynElimination::run_on_function(shared_ptr<Function> f)
+{
+    bool changed = false;
+
+    // replace_node does not re-run type inference on the users of the replaced node, so a
+    // dynamic op fed (directly or not) by another dynamic op only sees a static input shape
+    // once types have been re-inferred. Keep rewriting until nothing more can be replaced.
+    do
+    {
+        m_rewritten = false;
+        GraphRewrite::run_on_function(f);
+        if (m_rewritten)
+        {
+            f->validate_nodes_and_infer_types();
+            changed = true;
+        }
+    } while (m_rewritten);
+
+    return changed;
+}
+
+static bool get_nonnegative_values(const shared_ptr<op::Constant>& constant,
+                                   vector<size_t>& values)
+{
+    values.clear();
+    for (auto v : constant->get_vector<int64_t>())
+    {
+        if (v < 0)
+        {
+            return false;
+        }
+        values.push_back(static_cast<size_t>(v));
+    }
+    return true;
+}
+
+void pass::DynElimination::construct_dyn_reshape()
+{
+    auto data_label = make_shared<pattern::op::Label>(element::f32, Shape{1, 2, 3});
+    auto pattern_label = make_shared<pattern::op::Label>(
+        element::i64, Shape{3}, pattern::has_class<op::Constant>());
+    auto dyn_reshape = make_shared<op::DynReshape>(data_label, pattern_label);
+
+    auto dyn_reshape_callback = [this, data_label, pattern_label](pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_map();
+
+        auto data_arg = pattern_map[data_label];
+        auto pattern_arg = static_pointer_cast<op::Constant>(pattern_map[pattern_label]);
+
+        if (data_arg->get_output_partial_shape(0).is_dynamic())
+        {
+            return false;
+        }
+
+        vector<size_t> output_dims;
+        if (!get_nonnegative_values(pattern_arg, output_dims))
+        {
+            return false;
+        }
+
+        Shape output_shape(output_dims.begin(), output_dims.end());
+        const Shape& input_shape = data_arg->get_output_shape(0);
+        if (shape_size(output_shape) != shape_size(input_shape))
+        {
+            return false;
+        }
+
+        auto replacement = make_shared<op::Reshape>(
+            data_arg, get_default_order(input_shape.size()), output_shape);
+        replace_node(m.get_match_root(), replacement);
+        m_rewritten = true;
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(dyn_reshape, "DynElimination.DynReshape");
+    add_matcher(m, dyn_reshape_callback, all_pass_property_off);
+}
+
+void pass::DynElimination::construct_dyn_slice()
+{
+    auto data_label = make_shared<pattern::op::Label>(element::f32, Shape{1, 2, 3});
+    auto lower_label = make_shared<pattern::op::Label>(
+        element::i64, Shape{3}, pattern::has_class<op::Constant>());
+    auto upper_label = make_shared<pattern::op::Label>(
+        element::i64, Shape{3}, pattern::has_class<op::Constant>());
+    auto strides_label = make_shared<pattern::op::Label>(
+        element::i64, Shape{3}, pattern::has_class<op::Constant>());
+    auto dyn_slice =
+        make_shared<op::DynSlice>(data_label, lower_label, upper_label, strides_label);
+
+    auto dyn_slice_callback = [this, data_label, lower_label, upper_label, strides_label](
+        pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_map();
+
+        auto data_arg = pattern_map[data_label];
+        auto lower_arg = static_pointer_cast<op::Constant>(pattern_map[lower_label]);
+        auto upper_arg = static_pointer_cast<op::Constant>(pattern_map[upper_label]);
+        auto strides_arg = static_pointer_cast<op::Constant>(pattern_map[strides_label]);
+
+        if (data_arg->get_output_partial_shape(0).is_dynamic())
+        {
+            return false;
+        }
+
+        vector<size_t> lower;
+        vector<size_t> upper;
+        vector<size_t> strides;
+        if (!get_nonnegative_values(lower_arg, lower) ||
+            !get_nonnegative_values(upper_arg, upper) ||
+            !get_nonnegative_values(strides_arg, strides))
+        {
+            return false;
+        }
+
+        // Only bounds that are directly expressible by the static Slice op are handled here.
+        const Shape& input_shape = data_arg->get_output_shape(0);
+        for (size_t i = 0; i < input_shape.size(); i++)
+        {
+            if (strides[i] == 0 || lower[i] > upper[i] || upper[i] > input_shape[i])
+            {
+                return false;
+            }
+        }
+
+        auto replacement = make_shared<op::Slice>(data_arg,
+                                                  Coordinate(lower.begin(), lower.end()),
+                                                  Coordinate(upper.begin(), upper.end()),
+                                                  Strides(strides.begin(), strides.end()));
+        replace_node(m.get_match_root(), replacement);
+        m_rewritten = true;
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(dyn_slice, "DynElimination.DynSlice");
+    add_matcher(m, dyn_slice_callback, all_pass_property_off);
+}
+
+void pass::DynElimination::construct_dyn_broadcast()
+{
+    auto data_label = make_shared<pattern::op::Label>(element::f32, Shape{1, 2, 3});
+    auto shape_label = make_shared<pattern::op::Label>(
+        element::i64, Shape{4}, pattern::has_class<op::Constant>());
+    auto axes_label = make_shared<pattern::op::Label>(
+        element::i64, Shape{1}, pattern::has_class<op::Constant>());
+    auto dyn_broadcast = make_shared<op::DynBroadcast>(data_label, shape_label, axes_label);
+
+    auto dyn_broadcast_callback = [this, data_label, shape_label, axes_label](pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_map();
+
+        auto data_arg = pattern_map[data_label];
+        auto shape_arg = static_pointer_cast<op::Constant>(pattern_map[shape_label]);
+        auto axes_arg = static_pointer_cast<op::Constant>(pattern_map[axes_label]);
+
+        if (data_arg->get_output_partial_shape(0).is_dynamic())
+        {
+            return false;
+        }
+
+        vector<size_t> shape;
+        vector<size_t> axes;
+        if (!get_nonnegative_values(shape_arg, shape) || !get_nonnegative_values(axes_arg, axes))
+        {
+            return false;
+        }
+
+        auto replacement = make_shared<op::Broadcast>(
+            data_arg, Shape(shape.begin(), shape.end()), AxisSet(axes));
+        replace_node(m.get_match_root(), replacement);
+        m_rewritten = true;
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(dyn_broadcast, "DynElimination.DynBroadcast");
+    add_matcher(m, dyn_broadcast_callback, all_pass_property_off);
+}
+
+void pass::DynElimination::construct_dyn_pad()
+{
+    auto data_label = make_shared<pattern::op::Label>(element::f32, Shape{1, 2, 3});
+    auto below_label = make_shared<pattern::op::Label>(
+        element::i64, Shape{3}, pattern::has_class<op::Constant>());
+    auto above_label = make_shared<pattern::op::Label>(
+        element::i64, Shape{3}, pattern::has_class<op::Constant>());
+    auto value_label = make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto dyn_pad = make_shared<op::DynPad>(data_label, below_label, above_label, value_label);
+
+    auto dyn_pad_callback = [this, data_label, below_label, above_label, value_label](
+        pattern::Matcher& m) {
+        auto pattern_map = m.get_pattern_map();
+
+        auto data_arg = pattern_map[data_label];
+        auto below_arg = static_pointer_cast<op::Constant>(pattern_map[below_label]);
+        auto above_arg = static_pointer_cast<op::Constant>(pattern_map[above_label]);
+        auto value_arg = pattern_map[value_label];
+
+        if (data_arg->get_output_partial_shape(0).is_dynamic())
+        {
+            return false;
+        }
+
+        auto below = below_arg->get_vector<int64_t>();
+        auto above = above_arg->get_vector<int64_t>();
+
+        auto replacement = make_shared<op::Pad>(data_arg,
+                                                value_arg,
+                                                CoordinateDiff(below.begin(), below.end()),
+                                                CoordinateDiff(above.begin(), above.end()));
+        replace_node(m.get_match_root(), replacement);
+        m_rewritten = true;
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(dyn_pad, "DynElimination.DynPad");
+    add_matcher(m, dyn_pad_callback, all_pass_property_off);
+}
@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/graph_rewrite.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class DynElimination;
+    }
+}
+
+/// \brief Replaces dynamic ops whose shape-relevant inputs are constant with their static
+///        counterparts.
+///
+/// The following rewrites are performed once the shape/bounds/padding inputs have been turned
+/// into constants (e.g. by `ConstantFolding` or `specialize_shapes` with parameter values):
+///
+/// * `DynReshape(x, Constant)` becomes `Reshape(x)`;
+/// * `DynSlice(x, Constant, Constant, Constant)` becomes `Slice(x)`;
+/// * `DynBroadcast(x, Constant, Constant)` becomes `Broadcast(x)`;
+/// * `DynPad(x, Constant, Constant, v)` becomes `Pad(x, v)`.
+///
+/// Output types downstream of a replaced op are re-inferred, so that a function whose only
+/// dynamism came from these ops is fully static after this pass.
+class ngraph::pass::DynElimination : public ngraph::pass::GraphRewrite
+{
+public:
+    DynElimination()
+        : GraphRewrite()
+    {
+        construct_dyn_reshape();
+        construct_dyn_slice();
+        construct_dyn_broadcast();
+        construct_dyn_pad();
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    void construct_dyn_reshape();
+    void construct_dyn_slice();
+    void construct_dyn_broadcast();
+    void construct_dyn_pad();
+
+    bool m_rewritten{false};
+};
@@ -0,0 +1,133 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <cmath>
+
+#include "embedding_quantization.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+#include "ngraph/type/float16.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Maps each row linearly onto the integers [offset, offset + 255] of T
+template <typename T>
+static void quantize_rows(const float* data,
+                          size_t rows,
+                          size_t columns,
+                          float offset,
+                          T* quantized,
+                          float* scale,
+                          float* bias)
+{
+    for (size_t row = 0; row < rows; row++)
+    {
+        const float* values = data + row * columns;
+        auto range = minmax_element(values, values + columns);
+        float min = columns == 0 ? 0.0f : *range.first;
+        float max = columns == 0 ? 0.0f : *range.second;
+        scale[row] = (max - min) / 255.0f;
+        bias[row] = min - offset * scale[row];
+        for (size_t column = 0; column < columns; column++)
+        {
+            float step = scale[row] == 0.0f ? 0.0f : round((values[column] - min) / scale[row]);
+            quantized[row * columns + column] =
+                static_cast<T>(std::min(255.0f, std::max(0.0f, step)) + offset);
+        }
+    }
+}
+
+pass::EmbeddingQuantization::EmbeddingQuantization(const element::Type& table_type)
+    : FunctionPass()
+    , m_table_type(table_type)
+{
+    if (m_table_type != element::i8 && m_table_type != element::u8 &&
+        m_table_type != element::f16)
+    {
+        throw ngraph_error("Embedding weights can only be quantized to i8, u8 or f16");
+    }
+}
+
+bool pass::EmbeddingQuantization::run_on_function(shared_ptr<Function> f)
+{
+    bool modified = false;
+    for (auto& node : f->get_ordered_ops())
+    {
+        auto lookup = dynamic_pointer_cast<op::EmbeddingLookup>(node);
+        if (!lookup || lookup->is_quantized())
+        {
+            continue;
+        }
+        auto weights = dynamic_pointer_cast<op::Constant>(lookup->get_argument(1));
+        if (!weights || weights->get_element_type() != element::f32 ||
+            weights->get_users().size() != 1)
+        {
+            continue;
+        }
+
+        const Shape& shape = weights->get_shape();
+        size_t rows = shape.at(0);
+        size_t columns = shape.at(1);
+        const float* data = weights->get_data_ptr<float>();
+        vector<float> scale(rows, 1.0f);
+        vector<float> bias(rows, 0.0f);
+        unique_ptr<runtime::AlignedBuffer> quantized(
+            new runtime::AlignedBuffer(shape_size(shape) * m_table_type.size(), 64));
+        void* quantized_data = quantized->get_ptr();
+        if (m_table_type == element::i8)
+        {
+            quantize_rows(data,
+                          rows,
+                          columns,
+                          -128.0f,
+                          static_cast<int8_t*>(quantized_data),
+                          scale.data(),
+                          bias.data());
+        }
+        else if (m_table_type == element::u8)
+        {
+            quantize_rows(data,
+                          rows,
+                          columns,
+                          0.0f,
+                          static_cast<uint8_t*>(quantized_data),
+                          scale.data(),
+                          bias.data());
+        }
+        else
+        {
+            float16* values = static_cast<float16*>(quantized_data);
+            for (size_t i = 0; i < shape_size(shape); i++)
+            {
+                values[i] = float16(data[i]);
+            }
+        }
+
+        auto quantized_lookup = make_shared<op::EmbeddingLookup>(
+            lookup->get_argument(0),
+            make_shared<op::Constant>(m_table_type, shape, move(quantized)),
+            make_shared<op::Constant>(element::f32, Shape{rows}, scale),
+            make_shared<op::Constant>(element::f32, Shape{rows}, bias));
+        replace_node(lookup, quantized_lookup);
+        modified = true;
+    }
+    return modified;
+}
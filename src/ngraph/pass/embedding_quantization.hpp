@@ -0,0 +1,52 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/type/element_type.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class EmbeddingQuantization;
+    }
+}
+
+/// \brief Stores the f32 constant weights of EmbeddingLookup ops as i8, u8 or f16 rows with a
+///        scale and bias per row.
+///
+/// Each lookup is replaced by one on the quantized weights, which backends dequantize only
+/// for the rows looked up. With i8 or u8, every row is mapped linearly onto the 256 values
+/// between its minimum and maximum, which takes a quarter of the memory and bandwidth at an
+/// error of at most half a step of (maximum - minimum) / 255 per element. With f16, the rows
+/// are rounded to half precision with a scale of 1 and a bias of 0.
+///
+/// Weights that are used by anything other than the lookup are left alone, since their f32
+/// copy would remain.
+class ngraph::pass::EmbeddingQuantization : public FunctionPass
+{
+public:
+    /// \param table_type Element type of the quantized weights, i8, u8 or f16
+    EmbeddingQuantization(const element::Type& table_type = element::i8);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    element::Type m_table_type;
+};
@@ -19,6 +19,7 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/util/fused_op.hpp"
+#include "ngraph/provenance.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -35,12 +36,21 @@ bool ngraph::pass::FusedOpDecomposition::run_on_node(std::shared_ptr<ngraph::Nod
             return modified;
         }
         auto subgraph_outputs = fused_op->decompose_op();
+        if (get_provenance_enabled())
+        {
+            // The ops of the decomposition do the work of the fused op
+            traverse_nodes(subgraph_outputs,
+                           [&fused_op](shared_ptr<Node> subgraph_node) {
+                               subgraph_node->merge_provenance_tags_from(fused_op);
+                           },
+                           false,
+                           fused_op->get_arguments());
+        }
         size_t i = 0;
         for (auto output_node : subgraph_outputs)
         {
             for (size_t j = 0; j < output_node->get_outputs().size(); j++, i++)
             {
-                // TODO: Provenance
                 std::set<ngraph::descriptor::Input*> fop_users{
                     begin(fused_op->get_outputs().at(i).get_inputs()),
                     end(fused_op->get_outputs().at(i).get_inputs())};
@@ -15,13 +15,20 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <deque>
 #include <iostream>
 #include <regex>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
 #include "graph_rewrite.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pattern/op/pattern.hpp"
+#include "ngraph/pattern/op/skip.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -57,6 +64,157 @@ using namespace ngraph;
 // b) you are modifying nodes after the current node in the topological order
 // c) there's no linear order of fusions which will give
 //    the correct final fusion. i.e. the same fusion needs to occur before and after some other fusion
+// Matchers are bucketed by the op type of their pattern root, since a pattern rooted at a
+// non-pattern op can only match a node of exactly that type. A node is therefore only tried
+// against the matchers of its type and the matchers rooted at a pattern op (Label, Any, ...),
+// still in registration order.
+// The first pass visits every node, sorted once. Replacements made through replace_node()
+// re-queue the replacement, its users and the arguments of both nodes; later passes only visit
+// those nodes and the nodes close enough downstream of them to root a match that reaches them.
+
+// Longest chain of graph nodes a match rooted at `pattern` can span; a Skip may stand for
+// a node of its own as well as the node that its argument matches
+static size_t get_pattern_depth(const shared_ptr<Node>& pattern,
+                                unordered_map<Node*, size_t>& depths)
+{
+    auto it = depths.find(pattern.get());
+    if (it != depths.end())
+    {
+        return it->second;
+    }
+    size_t depth = 0;
+    for (auto& arg : pattern->get_arguments())
+    {
+        depth = max(depth, get_pattern_depth(arg, depths));
+    }
+    depth += dynamic_pointer_cast<pattern::op::Skip>(pattern) ? 2 : 1;
+    depths[pattern.get()] = depth;
+    return depth;
+}
+
+namespace
+{
+    // Learns through replace_node() which nodes the matcher callbacks touch, so only those are
+    // matched again. Nodes keep the position they had in the topological order the rewrite
+    // started from; a node a callback creates takes the position of the node it replaces.
+    class RewriteWorklist
+    {
+    public:
+        RewriteWorklist(const list<shared_ptr<Node>>& ops)
+            : m_observer([this](const shared_ptr<Node>& target,
+                                const shared_ptr<Node>& replacement) {
+                replaced(target, replacement);
+            })
+        {
+            for (auto& node : ops)
+            {
+                m_positions.emplace(node.get(), m_end);
+                m_end++;
+            }
+        }
+
+        bool is_replaced(const Node* node) const { return m_replaced.count(node) != 0; }
+        // Queues `node`, its arguments and its users
+        void touch_around(const shared_ptr<Node>& node)
+        {
+            size_t position = get_position(node.get());
+            for (auto& arg : node->get_arguments())
+            {
+                touch(arg, position);
+            }
+            touch(node, position);
+            for (auto& user : node->get_users())
+            {
+                touch(user, position);
+            }
+        }
+
+        // The queued nodes and the nodes up to `depth` - 1 edges downstream of them, in
+        // topological order; empties the queue
+        vector<shared_ptr<Node>> take(size_t depth)
+        {
+            vector<shared_ptr<Node>> frontier{m_touched};
+            for (size_t level = 1; level < depth && !frontier.empty(); level++)
+            {
+                vector<shared_ptr<Node>> next;
+                for (auto& node : frontier)
+                {
+                    for (auto& user : node->get_users())
+                    {
+                        if (touch(user, get_position(node.get())))
+                        {
+                            next.push_back(user);
+                        }
+                    }
+                }
+                frontier.swap(next);
+            }
+
+            vector<shared_ptr<Node>> nodes;
+            for (auto& node : m_touched)
+            {
+                // skip nodes that were replaced or never made it into the graph
+                if (!is_replaced(node.get()) && (node->is_output() || !node->get_users().empty()))
+                {
+                    nodes.push_back(node);
+                }
+            }
+            stable_sort(nodes.begin(),
+                        nodes.end(),
+                        [this](const shared_ptr<Node>& a, const shared_ptr<Node>& b) {
+                            return m_positions.at(a.get()) < m_positions.at(b.get());
+                        });
+            m_touched.clear();
+            m_touched_set.clear();
+            return nodes;
+        }
+
+    private:
+        size_t get_position(const Node* node) const
+        {
+            auto it = m_positions.find(node);
+            return it == m_positions.end() ? m_end : it->second;
+        }
+
+        bool touch(const shared_ptr<Node>& node, size_t position)
+        {
+            m_positions.emplace(node.get(), position);
+            if (!m_touched_set.insert(node.get()).second)
+            {
+                return false;
+            }
+            m_touched.push_back(node);
+            return true;
+        }
+
+        void replaced(const shared_ptr<Node>& target, const shared_ptr<Node>& replacement)
+        {
+            m_replaced.insert(target.get());
+            m_replaced.erase(replacement.get());
+            size_t position = get_position(target.get());
+            for (auto& arg : target->get_arguments())
+            {
+                touch(arg, position);
+            }
+            for (auto& arg : replacement->get_arguments())
+            {
+                touch(arg, position);
+            }
+            touch(replacement, position);
+            for (auto& user : replacement->get_users())
+            {
+                touch(user, position);
+            }
+        }
+
+        unordered_map<const Node*, size_t> m_positions;
+        size_t m_end = 0;
+        unordered_set<const Node*> m_replaced;
+        vector<shared_ptr<Node>> m_touched;
+        unordered_set<const Node*> m_touched_set;
+        ReplaceNodeObserver m_observer;
+    };
+}
 
 bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
 {
@@ -65,6 +223,10 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
     size_t tries = NUM_TRIES;
     vector<MatchClosure> original_matchers{m_matchers};
     bool is_dyn_func = f->is_dynamic();
+    m_matcher_hits.clear();
+    auto ordered_ops = f->get_ordered_ops();
+    RewriteWorklist worklist(ordered_ops);
+    vector<shared_ptr<Node>> ops(ordered_ops.begin(), ordered_ops.end());
     do
     {
         rewritten = false;
@@ -72,10 +234,45 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
         // that need multiple passes. See comments above.
         vector<MatchClosure> matchers_to_run{m_matchers};
         m_matchers.clear();
-        for (auto node : f->get_ordered_ops())
+
+        unordered_map<type_index, vector<size_t>> typed_matchers;
+        vector<size_t> pattern_matchers;
+        for (size_t i = 0; i < matchers_to_run.size(); i++)
         {
-            for (auto& closure : matchers_to_run)
+            auto root = matchers_to_run[i].matcher->get_pattern();
+            if (dynamic_pointer_cast<pattern::op::Pattern>(root))
+            {
+                pattern_matchers.push_back(i);
+            }
+            else
             {
+                const Node& root_node = *root;
+                typed_matchers[type_index(typeid(root_node))].push_back(i);
+            }
+        }
+
+        static const vector<size_t> no_matchers;
+        vector<size_t> node_matchers;
+        for (auto node : ops)
+        {
+            if (worklist.is_replaced(node.get()))
+            {
+                continue;
+            }
+
+            const Node& graph_node = *node;
+            auto typed = typed_matchers.find(type_index(typeid(graph_node)));
+            const auto& same_type = typed == typed_matchers.end() ? no_matchers : typed->second;
+            node_matchers.clear();
+            merge(same_type.begin(),
+                  same_type.end(),
+                  pattern_matchers.begin(),
+                  pattern_matchers.end(),
+                  back_inserter(node_matchers));
+
+            for (auto index : node_matchers)
+            {
+                auto& closure = matchers_to_run[index];
                 if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
                 {
                     NGRAPH_DEBUG << "matcher callback requires static shape but the "
@@ -95,12 +292,23 @@ bool pass::GraphRewrite::run_on_function(shared_ptr<Function> f)
                     {
                         rewritten = true;
                         is_dyn_func = f->is_dynamic();
+                        m_matcher_hits[closure.matcher->get_name()]++;
+                        // covers callbacks that rewire inputs without replace_node()
+                        worklist.touch_around(node);
                         break;
                     }
                 }
             }
         }
 
+        // the next pass runs only the matchers scheduled by this pass's callbacks
+        size_t depth = 0;
+        unordered_map<Node*, size_t> depths;
+        for (auto& closure : m_matchers)
+        {
+            depth = max(depth, get_pattern_depth(closure.matcher->get_pattern(), depths));
+        }
+        ops = worklist.take(depth);
     } while (rewritten && m_matchers.size() > 0 && tries--);
 
     m_matchers.assign(original_matchers.begin(), original_matchers.end());
@@ -181,40 +389,50 @@ bool pass::RecurrentGraphRewrite::run_on_function(shared_ptr<Function> f)
     bool changed = false;
     size_t i = 0;
     bool is_dyn_func = f->is_dynamic();
+    m_matcher_hits.clear();
 
-    auto run_matchers = [&]() -> bool {
-        for (auto node : f->get_ops())
+    auto ops = f->get_ordered_ops();
+    RewriteWorklist worklist(ops);
+    // Start from the results, so that a recurrent pattern is first tried on its last cell
+    // and captures the whole chain rather than its first two cells
+    deque<shared_ptr<Node>> queue(ops.rbegin(), ops.rend());
+    while (!queue.empty() && i < m_num_iters)
+    {
+        auto node = queue.front();
+        queue.pop_front();
+        if (worklist.is_replaced(node.get()))
+        {
+            continue;
+        }
+        for (auto& closure : m_matchers)
         {
-            for (auto& closure : m_matchers)
+            if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
             {
-                if (is_dyn_func && closure.property[PassProperty::REQUIRE_STATIC_SHAPE])
-                {
-                    NGRAPH_DEBUG << "matcher callback requires static shape but the "
-                                    "function is dynamic, skipping this "
-                                    "optimization till the shapes are fully "
-                                    "materialized";
-                    continue;
-                }
-                NGRAPH_DEBUG << "Running matcher " << closure.matcher << " on " << node->get_name();
-                if (closure.matcher->match(node))
+                NGRAPH_DEBUG << "matcher callback requires static shape but the "
+                                "function is dynamic, skipping this "
+                                "optimization till the shapes are fully "
+                                "materialized";
+                continue;
+            }
+            NGRAPH_DEBUG << "Running matcher " << closure.matcher << " on " << node->get_name();
+            if (closure.matcher->match(node))
+            {
+                NGRAPH_DEBUG << "Matcher " << closure.matcher << " matched " << node->get_name();
+                if (closure.callback(*closure.matcher.get()))
                 {
-                    NGRAPH_DEBUG << "Matcher " << closure.matcher << " matched "
-                                 << node->get_name();
-                    if (closure.callback(*closure.matcher.get()))
-                    {
-                        is_dyn_func = f->is_dynamic();
-                        return true;
-                    }
+                    is_dyn_func = f->is_dynamic();
+                    changed = true;
+                    i++;
+                    // recurrent matchers are unnamed; they go by registration order
+                    m_matcher_hits["RecurrentMatcher_" + to_string(&closure - &m_matchers[0])]++;
+                    // only the nodes around the rewrite can start new matches
+                    worklist.touch_around(node);
+                    auto touched = worklist.take(1);
+                    queue.insert(queue.end(), touched.begin(), touched.end());
+                    break;
                 }
             }
         }
-        return false;
-    };
-
-    do
-    {
-        changed = run_matchers();
-        i++;
-    } while (changed && i < m_num_iters);
+    }
     return changed;
 }
@@ -17,8 +17,10 @@
 #pragma once
 
 #include <functional>
+#include <map>
 #include <memory>
 #include <set>
+#include <string>
 
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -67,6 +69,8 @@ public:
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \brief Rewrites made by each matcher, by name, in the last run_on_function
+    const std::map<std::string, size_t>& get_matcher_hits() const { return m_matcher_hits; }
 protected:
     bool is_enabled(const std::shared_ptr<pattern::Matcher>& m) const;
 
@@ -78,6 +82,7 @@ private:
         PassPropertyMask property;
     };
     std::vector<MatchClosure> m_matchers;
+    std::map<std::string, size_t> m_matcher_hits;
 };
 
 class ngraph::pass::RecurrentGraphRewrite : public FunctionPass
@@ -102,8 +107,11 @@ public:
 
     virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
 
+    /// \brief Rewrites made by each matcher, by name, in the last run_on_function
+    const std::map<std::string, size_t>& get_matcher_hits() const { return m_matcher_hits; }
 private:
     size_t m_num_iters;
+    std::map<std::string, size_t> m_matcher_hits;
 
     struct MatchClosure
     {
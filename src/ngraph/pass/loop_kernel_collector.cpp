@@ -0,0 +1,239 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <typeindex>
+#include <typeinfo>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/pass/loop_kernel_collector.hpp"
+
+#define TI(x) std::type_index(typeid(x))
+
+using namespace std;
+using namespace ngraph;
+
+pass::LoopKernelCollector::LoopKernelCollector(shared_ptr<Function> f,
+                                               size_t min_nodes_to_fuse,
+                                               const FusiblePredicate& is_fusible)
+{
+    for (auto n : f->get_ordered_ops())
+    {
+        if (is_fusible(*n))
+        {
+            auto arg_from_fusible_group = collect_fusible_args(n);
+            // create a new group
+            if (!arg_from_fusible_group)
+            {
+                m_heads.insert(make_pair(n, n));
+                m_graphs.insert(make_pair(n, LoopKernelGroup{{n}, n->get_arguments(), 0}));
+                m_group_order.push_back(n);
+                NGRAPH_DEBUG << "Created a new group for " << n->get_name();
+                log_group(n);
+            }
+            else
+            {
+                auto smallest_head = m_heads.at(arg_from_fusible_group);
+                auto& lkgraph = m_graphs.at(smallest_head);
+                lkgraph.m_nodes.push_back(n);
+                for (auto arg : n->get_arguments())
+                {
+                    if (m_heads.count(arg) == 0 || m_heads.at(arg) != smallest_head)
+                    {
+                        lkgraph.m_inputs.push_back(arg);
+                    }
+                }
+                m_heads.insert(make_pair(n, smallest_head));
+                log_group(smallest_head);
+            }
+        }
+        else if (is_trailing_reduction(*n))
+        {
+            collect_trailing_reduction(n);
+        }
+    }
+
+    prune_graphs(min_nodes_to_fuse);
+}
+
+vector<pass::LoopKernelGroup> pass::LoopKernelCollector::get_groups() const
+{
+    vector<LoopKernelGroup> groups;
+    for (auto head : m_group_order)
+    {
+        groups.push_back(m_graphs.at(head));
+    }
+    return groups;
+}
+
+bool pass::LoopKernelCollector::is_default_fusible(const Node& node)
+{
+    static const set<type_index> fusible_ops_set{TI(op::Abs),
+                                                 TI(op::Add),
+                                                 TI(op::Divide),
+                                                 TI(op::Multiply),
+                                                 TI(op::Negative),
+                                                 TI(op::Subtract),
+                                                 TI(op::Relu),
+                                                 TI(op::Minimum),
+                                                 TI(op::Maximum)};
+
+    return fusible_ops_set.count(TI(node)) != 0;
+}
+
+bool pass::LoopKernelCollector::is_trailing_reduction(const Node& node)
+{
+    if (TI(node) != TI(op::Sum) && TI(node) != TI(op::Max))
+    {
+        return false;
+    }
+
+    auto& reduction = static_cast<const op::util::ArithmeticReduction&>(node);
+    auto& axes = reduction.get_reduction_axes();
+    size_t rank = node.get_input_shape(0).size();
+    if (axes.empty() || shape_size(node.get_input_shape(0)) == 0)
+    {
+        return false;
+    }
+    // The reduced axes must be the last `axes.size()` ones
+    return *axes.begin() == rank - axes.size() && *axes.rbegin() == rank - 1;
+}
+
+void pass::LoopKernelCollector::replace_kernel_outputs(shared_ptr<Node> kernel,
+                                                       const NodeVector& node_list,
+                                                       const NodeVector& outputs)
+{
+    set<shared_ptr<Node>> kernel_nodes(node_list.begin(), node_list.end());
+    for (auto& node : node_list)
+    {
+        kernel->merge_provenance_tags_from(node);
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        auto ith_goe = make_shared<op::GetOutputElement>(kernel, i);
+        auto& ith_output = ith_goe->get_outputs().at(0);
+
+        if (outputs.at(i)->get_outputs().size() > 1)
+        {
+            throw ngraph_error(
+                "support for fusing multi-output nodes in loop kernels isn't yet implemented");
+        }
+
+        // TODO: revisit when we need support for multi-output nodes
+        auto& orig_output = outputs.at(i)->get_outputs().at(0);
+
+        // this is needed since replace_output modifies orig_output.get_inputs()
+        set<descriptor::Input*> inputs_copy{begin(orig_output.get_inputs()),
+                                            end(orig_output.get_inputs())};
+        for (auto input : inputs_copy)
+        {
+            // this user is NOT internal to this loop kernel
+            // so it needs to be replaced with corresponding kernel's GOE
+            if (kernel_nodes.count(input->get_node()) == 0)
+            {
+                input->replace_output(ith_output);
+            }
+        }
+    }
+}
+
+// A reduction over the inner axes of a group member ends that group: it joins the group
+// as an output, and nodes consuming it are never fused into the same group
+void pass::LoopKernelCollector::collect_trailing_reduction(shared_ptr<Node> n)
+{
+    auto arg = n->get_argument(0);
+    if (m_heads.count(arg) == 0 || m_reductions.count(arg) != 0)
+    {
+        return;
+    }
+
+    auto head = m_heads.at(arg);
+    auto& lkgraph = m_graphs.at(head);
+    size_t reduction_size = shape_size(arg->get_shape()) / shape_size(n->get_shape());
+    if (lkgraph.m_reduction_size != 0 && lkgraph.m_reduction_size != reduction_size)
+    {
+        NGRAPH_DEBUG << "Not fusing " << n->get_name() << ", its group reduces "
+                     << lkgraph.m_reduction_size << " elements";
+        return;
+    }
+
+    lkgraph.m_nodes.push_back(n);
+    lkgraph.m_reduction_size = reduction_size;
+    m_heads.insert(make_pair(n, head));
+    m_reductions.insert(n);
+    log_group(head);
+}
+
+void pass::LoopKernelCollector::prune_graphs(size_t min_nodes_to_fuse)
+{
+    for (auto it = m_group_order.begin(); it != m_group_order.end();)
+    {
+        if (m_graphs.at(*it).m_nodes.size() < min_nodes_to_fuse)
+        {
+            m_graphs.erase(*it);
+            it = m_group_order.erase(it);
+        }
+        else
+        {
+            it++;
+        }
+    }
+}
+
+void pass::LoopKernelCollector::log_group(shared_ptr<Node> head) const
+{
+    NGRAPH_DEBUG << "Group leader : " << head->get_name() << endl;
+    NGRAPH_DEBUG << "Group members : " << m_graphs.at(head).m_nodes << endl;
+    NGRAPH_DEBUG << "Inputs: " << m_graphs.at(head).m_inputs << endl;
+}
+
+shared_ptr<Node> pass::LoopKernelCollector::collect_fusible_args(shared_ptr<Node> n)
+{
+    shared_ptr<Node> arg_from_fusible_group;
+    for (auto arg : n->get_arguments())
+    {
+        // an argument is fusible and a part of some group
+        NGRAPH_DEBUG << "Considering " << arg->get_name();
+        if (m_heads.count(arg) != 0 && m_reductions.count(arg) == 0)
+        {
+            if (!arg_from_fusible_group)
+            {
+                arg_from_fusible_group = arg;
+            }
+            else
+            {
+                if (!is_leaf(arg) && m_heads.at(arg) != m_heads.at(arg_from_fusible_group))
+                {
+                    return {nullptr};
+                }
+            }
+        }
+    }
+    return arg_from_fusible_group;
+}
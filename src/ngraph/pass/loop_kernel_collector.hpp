@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        /// \brief A group of nodes that can be executed in the same loop
+        struct LoopKernelGroup
+        {
+            NodeVector m_nodes;
+            NodeVector m_inputs;
+            /// Elements folded by each trailing reduction in the group, 0 if it has none
+            size_t m_reduction_size;
+        };
+
+        /// \brief Collects chains of elementwise ops, and the trailing reductions that fold
+        ///        them, into groups that a backend can replace with a single loop kernel.
+        ///
+        /// The grouping is backend independent; backends choose the ops they can fuse with
+        /// the predicate passed to the constructor.
+        class LoopKernelCollector
+        {
+        public:
+            using FusiblePredicate = std::function<bool(const Node&)>;
+
+            LoopKernelCollector(std::shared_ptr<Function> f,
+                                size_t min_nodes_to_fuse,
+                                const FusiblePredicate& is_fusible = is_default_fusible);
+
+            std::vector<LoopKernelGroup> get_groups() const;
+
+            /// \return true for the elementwise arithmetic ops every loop kernel supports
+            static bool is_default_fusible(const Node& node);
+            /// \return true if `node` is a Sum or Max over the innermost axes of its
+            ///         argument, which a loop kernel can compute while it loops.
+            static bool is_trailing_reduction(const Node& node);
+            /// \brief Redirects users outside `node_list` of each of `outputs` to the
+            ///        matching output of `kernel`
+            static void replace_kernel_outputs(std::shared_ptr<Node> kernel,
+                                               const NodeVector& node_list,
+                                               const NodeVector& outputs);
+
+        private:
+            bool is_leaf(std::shared_ptr<Node> src)
+            {
+                return src->is_parameter() || src->is_constant();
+            }
+            void collect_trailing_reduction(std::shared_ptr<Node> n);
+            void prune_graphs(size_t min_nodes_to_fuse);
+            void log_group(std::shared_ptr<Node> head) const;
+            std::shared_ptr<Node> collect_fusible_args(std::shared_ptr<Node> n);
+
+            std::unordered_map<std::shared_ptr<Node>, LoopKernelGroup> m_graphs;
+            std::unordered_map<std::shared_ptr<Node>, std::shared_ptr<Node>> m_heads;
+            std::set<std::shared_ptr<Node>> m_reductions;
+            // Keeps groups in the order their heads were created so results are deterministic
+            NodeVector m_group_order;
+        };
+    }
+}
@@ -19,13 +19,19 @@
 #else
 #include <cxxabi.h>
 #endif
+#include <cstdlib>
 #include <iomanip>
 #include <iostream>
 #include <memory>
+#include <sstream>
 
+#ifdef NGRAPH_JSON_ENABLE
+#include "ngraph/event_tracing.hpp"
+#endif
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/serialize.hpp"
@@ -57,9 +63,37 @@ void pass::Manager::initialize_default_passes()
 {
 }
 
+static string get_pass_name(pass::PassBase* pass)
+{
+    string name = typeid(*pass).name();
+#ifndef _WIN32
+    int status;
+    char* demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if (demangled)
+    {
+        name = demangled;
+        free(demangled);
+    }
+#endif
+    return name;
+}
+
+static void add_matcher_hits(pass::PassProfileEntry& entry, const map<string, size_t>& hits)
+{
+    for (auto& hit : hits)
+    {
+        entry.matcher_hits[hit.first] += hit.second;
+    }
+}
+
 void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
 {
     bool profile_enabled = getenv("NGRAPH_PROFILE_PASS_ENABLE") != nullptr;
+    bool collect_profile = m_profiling || profile_enabled;
+#ifdef NGRAPH_JSON_ENABLE
+    collect_profile = collect_profile || Event::is_tracing_enabled();
+#endif
+    m_profile = collect_profile ? make_shared<PassProfile>() : nullptr;
 
     vector<std::pair<shared_ptr<Function>, bool>> fs;
     if (transitive)
@@ -87,8 +121,32 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
     stopwatch pass_timer;
     stopwatch overall_timer;
     overall_timer.start();
+    auto count_ops = [&]() {
+        size_t count = 0;
+        for (auto& f_pair : fs)
+        {
+            count += f_pair.first->get_ops().size();
+        }
+        return count;
+    };
     for (shared_ptr<PassBase> pass : m_pass_list)
     {
+        PassProfileEntry entry;
+        int64_t peak_rss_before = 0;
+#ifdef NGRAPH_JSON_ENABLE
+        unique_ptr<Event> event;
+#endif
+        if (collect_profile)
+        {
+            entry.name = get_pass_name(pass.get());
+            entry.nodes_before = count_ops();
+            peak_rss_before = get_peak_rss_kb();
+#ifdef NGRAPH_JSON_ENABLE
+            event.reset(new Event(entry.name, "Compile", ""));
+#endif
+        }
+        auto graph_rewrite = dynamic_pointer_cast<GraphRewrite>(pass);
+        auto recurrent_graph_rewrite = dynamic_pointer_cast<RecurrentGraphRewrite>(pass);
         pass_timer.start();
         pass->set_state(get_state());
         auto module_pass = dynamic_pointer_cast<ModulePass>(pass);
@@ -118,6 +176,14 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
                 }
                 bool function_modified = function_pass->run_on_function(f);
                 f_pair.second = (function_modified == true) ? f->is_dynamic() : f_pair.second;
+                if (collect_profile && graph_rewrite)
+                {
+                    add_matcher_hits(entry, graph_rewrite->get_matcher_hits());
+                }
+                else if (collect_profile && recurrent_graph_rewrite)
+                {
+                    add_matcher_hits(entry, recurrent_graph_rewrite->get_matcher_hits());
+                }
             }
         }
         else if (node_pass)
@@ -177,17 +243,37 @@ void pass::Manager::run_passes(shared_ptr<Function> func, bool transitive)
         }
         index++;
         pass_timer.stop();
-        if (profile_enabled)
+        if (collect_profile)
         {
-            PassBase* p = pass.get();
-            string name = typeid(*p).name();
-#ifndef _WIN32
-            int status;
-            name = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+#ifdef NGRAPH_JSON_ENABLE
+            event->Stop();
 #endif
-            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << name << "\n";
+            entry.wall_time_us = pass_timer.get_microseconds();
+            entry.nodes_after = count_ops();
+            entry.peak_rss_delta_kb = get_peak_rss_kb() - peak_rss_before;
+#ifdef NGRAPH_JSON_ENABLE
+            ostringstream args;
+            args << "nodes_before=" << entry.nodes_before << " nodes_after=" << entry.nodes_after
+                 << " peak_rss_delta_kb=" << entry.peak_rss_delta_kb;
+            for (auto& hits : entry.matcher_hits)
+            {
+                args << " " << hits.first << "=" << hits.second;
+            }
+            event->set_args(args.str());
+            entry.trace = event->to_json();
+            Event::write_trace(*event);
+#endif
+            m_profile->add_entry(entry);
+        }
+        if (profile_enabled)
+        {
+            cout << setw(7) << pass_timer.get_milliseconds() << "ms " << entry.name << "\n";
         }
     }
+    if (collect_profile)
+    {
+        m_profile->set_total_time_us(overall_timer.get_microseconds());
+    }
     if (profile_enabled)
     {
         cout << "passes done in " << overall_timer.get_milliseconds() << "ms\n";
@@ -24,6 +24,7 @@
 #include "ngraph/pass/manager_state.hpp"
 #include "ngraph/pass/pass.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/pass/pass_profile.hpp"
 
 namespace ngraph
 {
@@ -71,6 +72,11 @@ public:
     void set_pass_config(const PassConfig& pass_config) { m_pass_config = pass_config; }
     void set_pass_visualization(bool new_state) { m_visualize = new_state; }
     void set_pass_serialization(bool new_state) { m_serialize = new_state; }
+    /// \brief Record a PassProfile on each run_passes. NGRAPH_PROFILE_PASS_ENABLE and
+    /// NGRAPH_ENABLE_TRACING turn profiling on as well.
+    void set_pass_profiling(bool new_state) { m_profiling = new_state; }
+    /// \returns The profile of the last run_passes, nullptr if it was not profiled
+    std::shared_ptr<PassProfile> get_profile() const { return m_profile; }
 private:
     std::vector<std::string> m_pass_names;
     std::vector<std::shared_ptr<PassBase>> m_pass_list;
@@ -78,4 +84,6 @@ private:
     PassConfig m_pass_config;
     bool m_visualize = false;
     bool m_serialize = false;
+    bool m_profiling = false;
+    std::shared_ptr<PassProfile> m_profile;
 };
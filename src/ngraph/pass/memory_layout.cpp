@@ -14,7 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <exception>
+#include <numeric>
 #include <sstream>
 
 #include "ngraph/log.hpp"
@@ -30,9 +32,12 @@
 using namespace std;
 using namespace ngraph;
 
-pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
+pass::MemoryLayout::MemoryLayout(size_t alignment,
+                                 bool disable_memory_sharing,
+                                 MemoryManager::allocation_scheme scheme)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_scheme(scheme)
 {
     if (m_alignment == 0)
     {
@@ -42,7 +47,10 @@ pass::MemoryLayout::MemoryLayout(size_t alignment, bool disable_memory_sharing)
 
 bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
 {
-    MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    MemoryManager mm(m_alignment,
+                     m_disable_memory_sharing ? MemoryManager::allocation_scheme::NO_REUSE
+                                              : m_scheme);
+    vector<descriptor::Tensor*> allocated_tensors;
     for (shared_ptr<Node> node : function->get_ordered_ops())
     {
         std::map<descriptor::Tensor*, descriptor::Tensor*> in_place_outputs;
@@ -88,6 +96,7 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
                                 ? in_place_outputs.at(tensor)->get_pool_offset()
                                 : mm.allocate(tensor->size());
             tensor->set_pool_offset(offset);
+            allocated_tensors.push_back(tensor);
         }
 
         if (!m_disable_memory_sharing)
@@ -101,6 +110,14 @@ bool pass::MemoryLayout::run_on_function(shared_ptr<Function> function)
             }
         }
     }
+
+    mm.plan();
+    for (descriptor::Tensor* tensor : allocated_tensors)
+    {
+        tensor->set_pool_offset(mm.get_offset(tensor->get_pool_offset()));
+    }
+    NGRAPH_DEBUG << "MemoryLayout: allocated " << mm.max_allocated() << " bytes, lower bound "
+                 << mm.min_allocated();
     function->set_temporary_pool_size(mm.max_allocated());
 
     return false;
@@ -113,9 +130,19 @@ pass::MemoryManager::node::node(size_t size, block_state state)
 }
 
 pass::MemoryManager::MemoryManager(size_t alignment, bool disable_memory_reuse)
+    : MemoryManager(alignment,
+                    disable_memory_reuse ? allocation_scheme::NO_REUSE
+                                         : allocation_scheme::FIRST_FIT)
+{
+}
+
+pass::MemoryManager::MemoryManager(size_t alignment, allocation_scheme scheme)
     : m_alignment{alignment}
-    , m_scheme{disable_memory_reuse ? allocation_scheme::NO_REUSE : allocation_scheme::FIRST_FIT}
+    , m_scheme{scheme}
     , m_max_allocated{0}
+    , m_live{0}
+    , m_max_live{0}
+    , m_time{0}
 {
     if (m_alignment == 0)
     {
@@ -132,10 +159,22 @@ size_t pass::MemoryManager::allocate(size_t size)
     case allocation_scheme::FIRST_FIT: rc = first_fit(size); break;
     case allocation_scheme::BEST_FIT: rc = best_fit(size); break;
     case allocation_scheme::NO_REUSE: rc = no_reuse_allocator(size); break;
+    case allocation_scheme::OPTIMAL: rc = deferred_allocator(size); break;
     }
+    m_live += align(size, m_alignment);
+    m_max_live = max(m_max_live, m_live);
     return rc;
 }
 
+size_t pass::MemoryManager::deferred_allocator(size_t size)
+{
+    size = align(size, m_alignment);
+    size_t offset = m_max_allocated;
+    m_lifetimes.push_back({offset, size, m_time++, numeric_limits<size_t>::max(), 0});
+    m_max_allocated += size;
+    return offset;
+}
+
 size_t pass::MemoryManager::no_reuse_allocator(size_t size)
 {
     size_t offset = m_max_allocated;
@@ -221,12 +260,31 @@ size_t pass::MemoryManager::first_fit(size_t size)
 
 void pass::MemoryManager::free(size_t offset)
 {
+    if (m_scheme == allocation_scheme::OPTIMAL)
+    {
+        auto it = lower_bound(m_lifetimes.begin(),
+                              m_lifetimes.end(),
+                              offset,
+                              [](const lifetime& l, size_t value) {
+                                  return l.m_provisional_offset < value;
+                              });
+        if (it == m_lifetimes.end() || it->m_provisional_offset != offset ||
+            it->m_end != numeric_limits<size_t>::max())
+        {
+            throw runtime_error("bad free");
+        }
+        it->m_end = m_time++;
+        m_live -= it->m_size;
+        return;
+    }
+
     size_t search_offset = 0;
     bool found = false;
     for (auto it = m_node_list.begin(); it != m_node_list.end(); ++it)
     {
         if (offset == search_offset)
         {
+            m_live -= it->m_size;
             list<node>::iterator it_next = next(it);
             if (it == m_node_list.begin())
             {
@@ -261,6 +319,162 @@ void pass::MemoryManager::free(size_t offset)
     }
 }
 
+void pass::MemoryManager::plan()
+{
+    if (m_scheme != allocation_scheme::OPTIMAL || m_lifetimes.empty())
+    {
+        return;
+    }
+    for (lifetime& l : m_lifetimes)
+    {
+        if (l.m_end == numeric_limits<size_t>::max())
+        {
+            l.m_end = m_time;
+        }
+    }
+
+    // Greedy packing is sensitive to the order blocks are placed in, so try the usual
+    // candidates and keep the best
+    vector<size_t> by_size(m_lifetimes.size());
+    iota(by_size.begin(), by_size.end(), 0);
+    vector<size_t> by_length = by_size;
+    vector<size_t> by_area = by_size;
+    auto length = [this](size_t i) { return m_lifetimes[i].m_end - m_lifetimes[i].m_begin; };
+    stable_sort(by_size.begin(), by_size.end(), [&](size_t a, size_t b) {
+        return m_lifetimes[a].m_size > m_lifetimes[b].m_size;
+    });
+    stable_sort(by_length.begin(), by_length.end(), [&](size_t a, size_t b) {
+        return length(a) > length(b);
+    });
+    stable_sort(by_area.begin(), by_area.end(), [&](size_t a, size_t b) {
+        return double(m_lifetimes[a].m_size) * length(a) >
+               double(m_lifetimes[b].m_size) * length(b);
+    });
+
+    size_t best_peak = numeric_limits<size_t>::max();
+    vector<size_t> best_offsets;
+    for (const vector<size_t>* order : {&by_size, &by_length, &by_area})
+    {
+        size_t peak = pack(*order);
+        if (peak < best_peak)
+        {
+            best_peak = peak;
+            best_offsets.clear();
+            for (const lifetime& l : m_lifetimes)
+            {
+                best_offsets.push_back(l.m_offset);
+            }
+        }
+    }
+    for (size_t i = 0; i < m_lifetimes.size(); i++)
+    {
+        m_lifetimes[i].m_offset = best_offsets[i];
+    }
+    m_max_allocated = best_peak;
+}
+
+size_t pass::MemoryManager::pack(const vector<size_t>& order)
+{
+    vector<size_t> placed;
+    size_t peak = 0;
+    for (size_t index : order)
+    {
+        lifetime& l = m_lifetimes[index];
+        l.m_offset = place(index, placed);
+        placed.push_back(index);
+        peak = max(peak, l.m_offset + l.m_size);
+    }
+
+    // Local search: lift a block that ends at the peak out of the packing and put it back into
+    // the best gap left by all the others, until no block at the peak can move down
+    bool improved = true;
+    while (improved)
+    {
+        improved = false;
+        for (size_t k = 0; k < placed.size() && !improved; k++)
+        {
+            size_t current = placed[k];
+            lifetime& l = m_lifetimes[current];
+            if (l.m_offset + l.m_size != peak)
+            {
+                continue;
+            }
+            swap(placed[k], placed.back());
+            placed.pop_back();
+            size_t offset = place(current, placed);
+            placed.push_back(current);
+            swap(placed[k], placed.back());
+            if (offset < l.m_offset)
+            {
+                l.m_offset = offset;
+                size_t new_peak = 0;
+                for (size_t i : placed)
+                {
+                    new_peak = max(new_peak, m_lifetimes[i].m_offset + m_lifetimes[i].m_size);
+                }
+                improved = new_peak < peak;
+                peak = new_peak;
+            }
+        }
+    }
+    return peak;
+}
+
+size_t pass::MemoryManager::place(size_t index, const vector<size_t>& placed) const
+{
+    // Best fit among the gaps left by the blocks whose lifetimes overlap this one
+    const lifetime& l = m_lifetimes[index];
+    vector<pair<size_t, size_t>> busy;
+    for (size_t i : placed)
+    {
+        const lifetime& other = m_lifetimes[i];
+        if (other.m_begin < l.m_end && l.m_begin < other.m_end)
+        {
+            busy.emplace_back(other.m_offset, other.m_offset + other.m_size);
+        }
+    }
+    sort(busy.begin(), busy.end());
+
+    size_t cursor = 0;
+    size_t best_offset = numeric_limits<size_t>::max();
+    size_t best_gap = numeric_limits<size_t>::max();
+    for (auto& range : busy)
+    {
+        if (range.first > cursor)
+        {
+            size_t gap = range.first - cursor;
+            if (gap >= l.m_size && gap < best_gap)
+            {
+                best_gap = gap;
+                best_offset = cursor;
+            }
+        }
+        cursor = max(cursor, range.second);
+    }
+    return best_offset == numeric_limits<size_t>::max() ? cursor : best_offset;
+}
+
+size_t pass::MemoryManager::get_offset(size_t provisional_offset) const
+{
+    if (m_scheme != allocation_scheme::OPTIMAL)
+    {
+        return provisional_offset;
+    }
+    auto it = upper_bound(m_lifetimes.begin(),
+                          m_lifetimes.end(),
+                          provisional_offset,
+                          [](size_t value, const lifetime& l) {
+                              return value < l.m_provisional_offset;
+                          });
+    if (it == m_lifetimes.begin() || provisional_offset > prev(it)->m_provisional_offset +
+                                                              prev(it)->m_size)
+    {
+        throw runtime_error("offset was not allocated");
+    }
+    --it;
+    return it->m_offset + (provisional_offset - it->m_provisional_offset);
+}
+
 void pass::MemoryManager::dump(ostream& out)
 {
     for (const node& n : m_node_list)
@@ -19,6 +19,7 @@
 #include <limits>
 #include <list>
 #include <sstream>
+#include <vector>
 
 #include "ngraph/pass/pass.hpp"
 
@@ -32,17 +33,6 @@ namespace ngraph
     }
 }
 
-class ngraph::pass::MemoryLayout : public FunctionPass
-{
-public:
-    MemoryLayout(size_t alignment = 1, bool disable_memory_sharing = false);
-    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
-
-private:
-    size_t m_alignment;
-    bool m_disable_memory_sharing;
-};
-
 class ngraph::pass::MemoryManager
 {
 public:
@@ -56,7 +46,8 @@ public:
     {
         FIRST_FIT,
         BEST_FIT,
-        NO_REUSE
+        NO_REUSE,
+        OPTIMAL
     };
 
     class node
@@ -70,11 +61,23 @@ public:
     };
 
     MemoryManager(size_t alignment = 1, bool disable_reuse = false);
+    MemoryManager(size_t alignment, allocation_scheme scheme);
     // memory_manager& alignment(size_t a);
 
     size_t allocate(size_t size);
     void free(size_t offset);
 
+    /// \brief With allocation_scheme::OPTIMAL, allocate() returns provisional offsets that
+    ///        never overlap and free() only records the end of a lifetime. plan() then packs
+    ///        all recorded lifetimes at once, after which get_offset() translates provisional
+    ///        offsets, including ones inside a block, and max_allocated() is the planned size.
+    ///        For the other schemes plan() does nothing and get_offset() is the identity.
+    void plan();
+    size_t get_offset(size_t provisional_offset) const;
+
+    /// \brief Peak of the bytes live at any one time, a lower bound on max_allocated()
+    size_t min_allocated() const { return m_max_live; }
+
     void dump(std::ostream&);
 
     static size_t align(size_t x, size_t alignment);
@@ -86,12 +89,45 @@ public:
     const std::list<node>& get_node_list() const { return m_node_list; }
     size_t max_allocated() const { return m_max_allocated; }
 private:
+    // A tensor lifetime recorded by the OPTIMAL scheme. The block is live from allocation
+    // time m_begin up to, not including, free time m_end.
+    struct lifetime
+    {
+        size_t m_provisional_offset;
+        size_t m_size;
+        size_t m_begin;
+        size_t m_end;
+        size_t m_offset;
+    };
+
     size_t first_fit(size_t size);
     size_t best_fit(size_t size);
     size_t no_reuse_allocator(size_t size);
+    size_t deferred_allocator(size_t size);
+    size_t pack(const std::vector<size_t>& order);
+    size_t place(size_t index, const std::vector<size_t>& placed) const;
 
     std::list<node> m_node_list;
     size_t m_alignment;
     allocation_scheme m_scheme;
     size_t m_max_allocated;
+    size_t m_live;
+    size_t m_max_live;
+    size_t m_time;
+    std::vector<lifetime> m_lifetimes;
+};
+
+class ngraph::pass::MemoryLayout : public FunctionPass
+{
+public:
+    MemoryLayout(size_t alignment = 1,
+                 bool disable_memory_sharing = false,
+                 MemoryManager::allocation_scheme scheme =
+                     MemoryManager::allocation_scheme::FIRST_FIT);
+    bool run_on_function(std::shared_ptr<ngraph::Function>) override;
+
+private:
+    size_t m_alignment;
+    bool m_disable_memory_sharing;
+    MemoryManager::allocation_scheme m_scheme;
 };
@@ -0,0 +1,269 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <map>
+#include <vector>
+
+#include "ngraph/log.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/pass/mixed_precision.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const string s_allow_prefix = "MixedPrecision::Allow::";
+static const string s_deny_prefix = "MixedPrecision::Deny::";
+
+static bool starts_with(const string& str, const string& prefix)
+{
+    return str.compare(0, prefix.size(), prefix) == 0;
+}
+
+pass::MixedPrecision::MixedPrecision(const element::Type& low_precision_type,
+                                     const PassConfig& pass_config)
+    : FunctionPass()
+    , m_low_precision_type(low_precision_type)
+    , m_allow_list(get_default_allow_list())
+    , m_deny_list(get_default_deny_list())
+{
+    if (!m_low_precision_type.is_real() || m_low_precision_type == element::f32 ||
+        m_low_precision_type == element::f64)
+    {
+        throw ngraph_error("MixedPrecision needs a floating point type narrower than f32, got " +
+                           m_low_precision_type.c_type_string());
+    }
+
+    for (auto& attribute : pass_config.get_pass_attributes())
+    {
+        set<string>* list = nullptr;
+        set<string>* other_list = nullptr;
+        string op_name;
+        if (starts_with(attribute.first, s_allow_prefix))
+        {
+            list = &m_allow_list;
+            other_list = &m_deny_list;
+            op_name = attribute.first.substr(s_allow_prefix.size());
+        }
+        else if (starts_with(attribute.first, s_deny_prefix))
+        {
+            list = &m_deny_list;
+            other_list = &m_allow_list;
+            op_name = attribute.first.substr(s_deny_prefix.size());
+        }
+        else
+        {
+            continue;
+        }
+
+        if (attribute.second)
+        {
+            list->insert(op_name);
+            other_list->erase(op_name);
+        }
+        else
+        {
+            list->erase(op_name);
+        }
+    }
+}
+
+const set<string>& pass::MixedPrecision::get_default_allow_list()
+{
+    static const set<string> allow_list{"BatchMatMul",
+                                        "Convolution",
+                                        "ConvolutionAdd",
+                                        "ConvolutionBackpropData",
+                                        "ConvolutionBackpropFilters",
+                                        "ConvolutionBias",
+                                        "ConvolutionBiasAdd",
+                                        "ConvolutionRelu",
+                                        "Dot",
+                                        "GroupConvolution",
+                                        "Lstm",
+                                        "MatmulBias",
+                                        "Rnn"};
+    return allow_list;
+}
+
+const set<string>& pass::MixedPrecision::get_default_deny_list()
+{
+    static const set<string> deny_list{"BatchNormInference",
+                                       "BatchNormTraining",
+                                       "BatchNormTrainingBackprop",
+                                       "Divide",
+                                       "Exp",
+                                       "Log",
+                                       "LRN",
+                                       "Power",
+                                       "Product",
+                                       "Softmax",
+                                       "Sqrt",
+                                       "Sum"};
+    return deny_list;
+}
+
+bool pass::MixedPrecision::run_on_function(shared_ptr<Function> f)
+{
+    // f32 outputs of the Converts appended after rewritten ops, mapped to the low-precision
+    // outputs they were made from
+    map<Output<Node>, Output<Node>> low_precision_sources;
+    // f32 outputs that feed rewritten ops, mapped to their Convert to low precision
+    map<Output<Node>, Output<Node>> converted_sources;
+    // Keeps inserted Converts alive while their outputs are used as map keys
+    NodeVector inserted;
+
+    auto get_low_precision = [&](const Output<Node>& source) {
+        auto it = low_precision_sources.find(source);
+        if (it != low_precision_sources.end())
+        {
+            return it->second;
+        }
+        it = converted_sources.find(source);
+        if (it != converted_sources.end())
+        {
+            return it->second;
+        }
+        auto convert = make_shared<op::Convert>(source.get_node_shared_ptr(), m_low_precision_type);
+        inserted.push_back(convert);
+        Output<Node> result = convert->output(0);
+        converted_sources.emplace(source, result);
+        return result;
+    };
+
+    bool modified = false;
+    for (auto node : f->get_ordered_ops())
+    {
+        if (node->is_parameter() || node->is_constant() || node->is_output() ||
+            node->description() == "Convert" || m_deny_list.count(node->description()) != 0 ||
+            node->get_output_size() == 0)
+        {
+            continue;
+        }
+
+        bool all_outputs_f32 = true;
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            all_outputs_f32 = all_outputs_f32 && node->get_output_element_type(i) == element::f32;
+        }
+
+        // The values leaving a rewritten op are converted back to f32 after the op itself or,
+        // for multi-output ops, after each of the GetOutputElements that select its outputs
+        NodeVector output_nodes;
+        if (node->get_output_size() == 1)
+        {
+            output_nodes.push_back(node);
+        }
+        else
+        {
+            for (auto& user : node->get_users())
+            {
+                if (user->description() != "GetOutputElement")
+                {
+                    all_outputs_f32 = false;
+                }
+                output_nodes.push_back(user);
+            }
+        }
+        if (!all_outputs_f32)
+        {
+            continue;
+        }
+
+        vector<size_t> f32_inputs;
+        bool inputs_already_converted = true;
+        bool inputs_convertible = true;
+        for (size_t i = 0; i < node->get_input_size(); i++)
+        {
+            if (node->get_input_element_type(i) == element::f32)
+            {
+                auto source = node->input(i).get_source_output();
+                bool converted = low_precision_sources.count(source) != 0;
+                f32_inputs.push_back(i);
+                inputs_already_converted = inputs_already_converted && converted;
+                inputs_convertible = inputs_convertible &&
+                                     (converted || source.get_node()->get_output_size() == 1);
+            }
+        }
+        if (f32_inputs.empty() || !inputs_convertible ||
+            (m_allow_list.count(node->description()) == 0 && !inputs_already_converted))
+        {
+            continue;
+        }
+
+        vector<set<Input<Node>>> targets;
+        for (auto& output_node : output_nodes)
+        {
+            targets.push_back(output_node->output(0).get_target_inputs());
+        }
+
+        vector<Output<Node>> original_sources;
+        for (size_t i : f32_inputs)
+        {
+            auto source = node->input(i).get_source_output();
+            original_sources.push_back(source);
+            node->input(i).replace_source_output(get_low_precision(source));
+        }
+
+        bool rewritten = false;
+        try
+        {
+            node->revalidate_and_infer_types();
+            rewritten = true;
+            for (auto& output_node : output_nodes)
+            {
+                if (output_node != node)
+                {
+                    output_node->revalidate_and_infer_types();
+                }
+                rewritten =
+                    rewritten && output_node->get_output_element_type(0) == m_low_precision_type;
+            }
+        }
+        catch (const ngraph_error& e)
+        {
+            NGRAPH_DEBUG << "MixedPrecision: keeping " << node->get_name() << " in f32, "
+                         << e.what();
+        }
+
+        if (!rewritten)
+        {
+            for (size_t i = 0; i < f32_inputs.size(); i++)
+            {
+                node->input(f32_inputs[i]).replace_source_output(original_sources[i]);
+            }
+            node->revalidate_and_infer_types();
+            for (auto& output_node : output_nodes)
+            {
+                output_node->revalidate_and_infer_types();
+            }
+            continue;
+        }
+
+        for (size_t i = 0; i < output_nodes.size(); i++)
+        {
+            auto convert = make_shared<op::Convert>(output_nodes[i], element::f32);
+            inserted.push_back(convert);
+            for (auto& target : targets[i])
+            {
+                target.replace_source_output(convert->output(0));
+            }
+            low_precision_sources.emplace(convert->output(0), output_nodes[i]->output(0));
+        }
+        modified = true;
+    }
+
+    return modified;
+}
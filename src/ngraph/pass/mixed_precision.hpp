@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <set>
+#include <string>
+
+#include "ngraph/pass/pass.hpp"
+#include "ngraph/pass/pass_config.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class MixedPrecision;
+    }
+}
+
+/// \brief Rewrites an f32 function so that compute-heavy ops run in a lower-precision floating
+///        point type, inserting op::Convert where values cross between precisions.
+///
+/// Ops are classified by their description():
+///   - ops on the allow list always run in the low-precision type,
+///   - ops on the deny list always run in f32,
+///   - any other op runs in the low-precision type only when all of its f32 inputs are already
+///     produced in that type, so chains such as Convolution -> Add -> Relu stay converted.
+///
+/// The lists can be adjusted through pass attributes: "MixedPrecision::Allow::<Op>" and
+/// "MixedPrecision::Deny::<Op>" add (=1) or remove (=0) an op from the corresponding list.
+/// Parameters and results keep their f32 element type.
+class ngraph::pass::MixedPrecision : public FunctionPass
+{
+public:
+    MixedPrecision(const element::Type& low_precision_type = element::f16,
+                   const PassConfig& pass_config = PassConfig());
+
+    static const std::set<std::string>& get_default_allow_list();
+    static const std::set<std::string>& get_default_deny_list();
+
+    const std::set<std::string>& get_allow_list() const { return m_allow_list; }
+    const std::set<std::string>& get_deny_list() const { return m_deny_list; }
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    element::Type m_low_precision_type;
+    std::set<std::string> m_allow_list;
+    std::set<std::string> m_deny_list;
+};
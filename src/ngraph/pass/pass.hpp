@@ -53,6 +53,7 @@ namespace ngraph
             CHANGE_FUNCTION_STATE = 1 << 3
         };
         typedef EnumMask<PassProperty> PassPropertyMask;
+        const PassPropertyMask all_pass_property_off;
     }
 }
 
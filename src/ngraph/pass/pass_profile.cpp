@@ -0,0 +1,74 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+
+#include "ngraph/pass/pass_profile.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr const char* pass::PassProfile::PROFILE_ATTRIBUTE;
+
+void pass::PassProfile::print(ostream& out) const
+{
+    vector<const PassProfileEntry*> entries;
+    for (auto& entry : m_entries)
+    {
+        entries.push_back(&entry);
+    }
+    stable_sort(entries.begin(),
+                entries.end(),
+                [](const PassProfileEntry* a, const PassProfileEntry* b) {
+                    return a->wall_time_us > b->wall_time_us;
+                });
+
+    for (auto entry : entries)
+    {
+        out << setw(10) << entry->wall_time_us << "us " << setw(8) << entry->nodes_before
+            << " -> " << setw(8) << left << entry->nodes_after << right << " nodes "
+            << setw(8) << entry->peak_rss_delta_kb << "KiB " << entry->name << "\n";
+        for (auto& hits : entry->matcher_hits)
+        {
+            out << setw(40) << hits.second << " x " << hits.first << "\n";
+        }
+    }
+    out << "passes done in " << m_total_time_us << "us\n";
+    for (auto& phase : m_phases)
+    {
+        out << setw(10) << phase.wall_time_us << "us " << setw(8) << phase.peak_rss_delta_kb
+            << "KiB " << phase.name << "\n";
+    }
+}
+
+string pass::PassProfile::to_chrome_trace() const
+{
+    ostringstream trace;
+    trace << "[\n";
+    const char* separator = "";
+    for (auto& entry : m_entries)
+    {
+        if (!entry.trace.empty())
+        {
+            trace << separator << entry.trace;
+            separator = ",\n";
+        }
+    }
+    trace << "\n]\n";
+    return trace.str();
+}
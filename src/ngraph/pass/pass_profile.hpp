@@ -0,0 +1,87 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    namespace pass
+    {
+        struct PassProfileEntry;
+        struct CompilePhase;
+        class PassProfile;
+    }
+}
+
+/// \brief What running one pass cost, as recorded by pass::Manager
+struct ngraph::pass::PassProfileEntry
+{
+    /// Demangled type name of the pass
+    std::string name;
+    int64_t wall_time_us = 0;
+    /// Ops in all the functions the pass ran on, before and after it ran
+    size_t nodes_before = 0;
+    size_t nodes_after = 0;
+    /// Rewrites made per matcher name, for GraphRewrite and RecurrentGraphRewrite passes
+    std::map<std::string, size_t> matcher_hits;
+    /// Growth of the peak resident set size of the process while the pass ran, in KiB
+    int64_t peak_rss_delta_kb = 0;
+    /// The pass as a pair of Chrome trace events, see \sa Event::to_json. Empty when nGraph
+    /// is built without NGRAPH_JSON_ENABLE.
+    std::string trace;
+};
+
+/// \brief A step of a backend's compile outside pass::Manager, such as building kernels
+struct ngraph::pass::CompilePhase
+{
+    std::string name;
+    int64_t wall_time_us = 0;
+    /// Growth of the peak resident set size of the process during the phase, in KiB
+    int64_t peak_rss_delta_kb = 0;
+};
+
+/// \brief A per-pass compile-time and memory report for one pass::Manager::run_passes
+class ngraph::pass::PassProfile
+{
+public:
+    /// Pass attribute asking a backend to profile its compile (see \sa PassConfig); the
+    /// result is available from Executable::get_compile_profile
+    static constexpr const char* PROFILE_ATTRIBUTE = "ProfileCompile";
+
+    void add_entry(const PassProfileEntry& entry) { m_entries.push_back(entry); }
+    const std::vector<PassProfileEntry>& get_entries() const { return m_entries; }
+    void set_total_time_us(int64_t total_time_us) { m_total_time_us = total_time_us; }
+    int64_t get_total_time_us() const { return m_total_time_us; }
+    /// \brief Backends append the phases of their compile that follow the passes
+    void add_phase(const CompilePhase& phase) { m_phases.push_back(phase); }
+    const std::vector<CompilePhase>& get_phases() const { return m_phases; }
+    /// \brief Prints one line per pass, slowest first
+    void print(std::ostream& out) const;
+
+    /// \brief The report in the Chrome trace format (chrome://tracing), one event per pass
+    std::string to_chrome_trace() const;
+
+private:
+    std::vector<PassProfileEntry> m_entries;
+    std::vector<CompilePhase> m_phases;
+    int64_t m_total_time_us = 0;
+};
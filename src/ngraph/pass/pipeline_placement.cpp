@@ -0,0 +1,220 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/send.hpp"
+#include "ngraph/pass/pipeline_placement.hpp"
+#include "ngraph/runtime/op_cost.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool is_available_everywhere(const shared_ptr<Node>& node)
+{
+    return node->is_parameter() || node->is_constant();
+}
+
+static bool follows_argument(const shared_ptr<Node>& node)
+{
+    return node->is_output() || dynamic_pointer_cast<op::GetOutputElement>(node) != nullptr;
+}
+
+NodeVector pass::PipelinePlacement::get_pipeline_order(const shared_ptr<Function>& f)
+{
+    // get_ordered_ops breaks ties by the addresses of the users, which differ between
+    // processes, so walk depth first from the results in argument order instead
+    NodeVector order;
+    unordered_set<Node*> visited;
+    vector<pair<shared_ptr<Node>, size_t>> stack;
+    auto visit = [&](const shared_ptr<Node>& node) {
+        if (visited.insert(node.get()).second)
+        {
+            stack.emplace_back(node, 0);
+        }
+    };
+    for (auto& result : f->get_results())
+    {
+        visit(result);
+        while (!stack.empty())
+        {
+            auto node = stack.back().first;
+            size_t next = stack.back().second++;
+            if (next < node->get_input_size())
+            {
+                visit(node->get_argument(next));
+            }
+            else
+            {
+                order.push_back(node);
+                stack.pop_back();
+            }
+        }
+    }
+    return order;
+}
+
+bool pass::PipelinePlacement::run_on_function(shared_ptr<Function> f)
+{
+    NodeVector order = get_pipeline_order(f);
+    vector<uint64_t> costs(order.size(), 0);
+    uint64_t total_cost = 0;
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        if (!is_available_everywhere(order[i]) && !follows_argument(order[i]))
+        {
+            auto cost = runtime::get_op_cost(*order[i]);
+            costs[i] = cost.flops + cost.bytes();
+            total_cost += costs[i];
+        }
+    }
+
+    // an op goes to the stage that holds the midpoint of its cost
+    uint64_t prefix_cost = 0;
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        auto& node = order[i];
+        if (is_available_everywhere(node))
+        {
+            node->set_placement_index(0);
+        }
+        else if (follows_argument(node))
+        {
+            node->set_placement_index(node->get_argument(0)->get_placement_index());
+        }
+        else
+        {
+            size_t stage = 0;
+            if (total_cost > 0)
+            {
+                stage = static_cast<size_t>((prefix_cost + costs[i] / 2) * m_stage_count /
+                                            total_cost);
+            }
+            node->set_placement_index(min(stage, m_stage_count - 1));
+            prefix_cost += costs[i];
+        }
+    }
+    return true;
+}
+
+shared_ptr<Function> pass::PipelinePlacement::split_stage(const shared_ptr<Function>& f,
+                                                          size_t stage)
+{
+    NodeVector order = get_pipeline_order(f);
+    unordered_set<Node*> in_function;
+    for (auto& node : order)
+    {
+        in_function.insert(node.get());
+    }
+
+    // Number the values leaving each stage in pipeline order, so the sending and the
+    // receiving process agree on the tags
+    map<pair<Node*, size_t>, int> tags;
+    int next_tag = 0;
+    for (auto& node : order)
+    {
+        if (is_available_everywhere(node) || node->is_output())
+        {
+            continue;
+        }
+        set<size_t> destinations;
+        for (auto& user : node->get_users())
+        {
+            if (in_function.count(user.get()) != 0 &&
+                user->get_placement_index() > node->get_placement_index())
+            {
+                destinations.insert(user->get_placement_index());
+            }
+        }
+        for (size_t destination : destinations)
+        {
+            tags[make_pair(node.get(), destination)] = next_tag++;
+        }
+    }
+
+    unordered_map<Node*, shared_ptr<Node>> local;
+    ParameterVector parameters;
+    for (auto& parameter : f->get_parameters())
+    {
+        auto clone = static_pointer_cast<op::Parameter>(parameter->copy_with_new_args({}));
+        local[parameter.get()] = clone;
+        parameters.push_back(clone);
+    }
+    auto get_local = [&](const shared_ptr<Node>& arg) {
+        auto it = local.find(arg.get());
+        if (it != local.end())
+        {
+            return it->second;
+        }
+        shared_ptr<Node> value;
+        if (arg->is_constant())
+        {
+            value = arg->copy_with_new_args({});
+        }
+        else
+        {
+            value = make_shared<op::Recv>(arg->get_element_type(),
+                                          arg->get_shape(),
+                                          static_cast<int>(arg->get_placement_index()),
+                                          tags.at(make_pair(arg.get(), stage)));
+        }
+        local[arg.get()] = value;
+        return value;
+    };
+
+    ResultVector results;
+    NodeVector sends;
+    for (auto& node : order)
+    {
+        if (is_available_everywhere(node) || node->get_placement_index() != stage)
+        {
+            continue;
+        }
+        NodeVector args;
+        for (auto& arg : node->get_arguments())
+        {
+            args.push_back(get_local(arg));
+        }
+        if (node->is_output())
+        {
+            results.push_back(make_shared<op::Result>(args.at(0)));
+            continue;
+        }
+        auto clone = node->copy_with_new_args(args);
+        local[node.get()] = clone;
+        for (auto it = tags.lower_bound(make_pair(node.get(), size_t(0)));
+             it != tags.end() && it->first.first == node.get();
+             ++it)
+        {
+            sends.push_back(make_shared<op::Send>(
+                clone, static_cast<int>(it->first.second), it->second));
+        }
+    }
+    for (auto& send : sends)
+    {
+        results.push_back(make_shared<op::Result>(send));
+    }
+    return make_shared<Function>(
+        results, parameters, f->get_name() + "_stage_" + to_string(stage));
+}
@@ -0,0 +1,66 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class PipelinePlacement;
+    }
+}
+
+/// \brief Places the ops of a Function on stage_count pipeline stages, one per process, by
+///        setting their placement index.
+///
+/// The ops are cut into contiguous runs of a topological order whose costs (the FLOPs plus
+/// the bytes moved, see runtime::get_op_cost) are as equal as the order allows. Values then
+/// only flow from a stage to itself or to a later one. Parameters and constants are placed on
+/// stage 0 but are available to every stage; output selectors and results follow their
+/// argument.
+///
+/// The order does not depend on node addresses, so every process computes the same placement
+/// for the same Function.
+class ngraph::pass::PipelinePlacement : public FunctionPass
+{
+public:
+    PipelinePlacement(size_t stage_count)
+        : FunctionPass()
+        , m_stage_count(stage_count)
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \brief Builds the Function that runs the ops of a placed Function on one stage.
+    ///
+    /// The stage Function takes all parameters of f. Its results are the results of f
+    /// computed on the stage, in their original order, followed by one Send for every
+    /// value a later stage uses. Values of earlier stages arrive through Recv ops; the
+    /// Send and Recv of each value and stage share a tag.
+    static std::shared_ptr<Function> split_stage(const std::shared_ptr<Function>& f,
+                                                 size_t stage);
+
+    /// \brief A topological order of the nodes reachable from the results of f, which is the
+    ///        same in every process.
+    static NodeVector get_pipeline_order(const std::shared_ptr<Function>& f);
+
+private:
+    size_t m_stage_count;
+};
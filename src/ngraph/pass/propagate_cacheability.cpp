@@ -19,6 +19,8 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/constant.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/send.hpp"
 #include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 
@@ -47,6 +49,11 @@ bool pass::PropagateCacheability::run_on_function(shared_ptr<Function> function)
                 NGRAPH_DEBUG << "propagate cacheability: cacheability is "
                              << parameter->get_cacheable();
             }
+            else if (dynamic_pointer_cast<op::Send>(node) || dynamic_pointer_cast<op::Recv>(node))
+            {
+                // the peer expects a message on every call, and a Recv has no arguments
+                op_annotations->set_cacheable(false);
+            }
             else
             {
                 bool cacheable = true;
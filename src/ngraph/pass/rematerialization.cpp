@@ -0,0 +1,227 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/pass/rematerialization.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Ops that are not deterministic or that talk to other processes
+static const set<string> s_not_recomputable{
+    "AllReduce", "BroadcastDistributed", "Dropout", "GenerateMask"};
+
+static bool is_recomputable(const shared_ptr<Node>& node)
+{
+    return !node->is_parameter() && !node->is_constant() && !node->is_output() &&
+           !dynamic_pointer_cast<op::GetOutputElement>(node) && node->get_output_size() == 1 &&
+           node->get_output_partial_shape(0).is_static() &&
+           node->get_control_dependencies().empty() &&
+           s_not_recomputable.count(node->description()) == 0;
+}
+
+static size_t get_output_bytes(const Node* node, size_t i)
+{
+    if (!node->get_output_partial_shape(i).is_static())
+    {
+        return 0;
+    }
+    return shape_size(node->get_output_shape(i)) * node->get_output_element_type(i).size();
+}
+
+pass::Rematerialization::Rematerialization(size_t memory_budget, size_t segment_size)
+    : FunctionPass()
+    , m_memory_budget(memory_budget)
+    , m_segment_size(segment_size)
+{
+}
+
+size_t pass::Rematerialization::get_peak_live_bytes(const list<shared_ptr<Node>>& ordered_ops)
+{
+    unordered_map<const Node*, size_t> position;
+    for (auto& node : ordered_ops)
+    {
+        position.emplace(node.get(), position.size());
+    }
+
+    // bytes allocated at each position and released after it
+    vector<int64_t> delta(ordered_ops.size() + 1, 0);
+    for (auto& node : ordered_ops)
+    {
+        if (node->is_parameter() || node->is_constant())
+        {
+            continue;
+        }
+        size_t pos = position.at(node.get());
+        for (size_t i = 0; i < node->get_output_size(); i++)
+        {
+            size_t last_use = pos;
+            for (auto& input : node->output(i).get_target_inputs())
+            {
+                auto it = position.find(input.get_node());
+                if (it == position.end())
+                {
+                    continue;
+                }
+                last_use = input.get_node()->is_output() ? ordered_ops.size() - 1
+                                                         : max(last_use, it->second);
+                if (last_use == ordered_ops.size() - 1)
+                {
+                    break;
+                }
+            }
+            int64_t bytes = static_cast<int64_t>(get_output_bytes(node.get(), i));
+            delta[pos] += bytes;
+            delta[last_use + 1] -= bytes;
+        }
+    }
+
+    int64_t live = 0;
+    int64_t peak = 0;
+    for (int64_t d : delta)
+    {
+        live += d;
+        peak = max(peak, live);
+    }
+    return static_cast<size_t>(peak);
+}
+
+bool pass::Rematerialization::run_on_function(shared_ptr<Function> f)
+{
+    auto ordered_ops = f->get_ordered_ops();
+    m_peak_bytes_before = get_peak_live_bytes(ordered_ops);
+    m_peak_bytes_after = m_peak_bytes_before;
+    if (ordered_ops.empty() || (m_memory_budget > 0 && m_peak_bytes_before <= m_memory_budget))
+    {
+        return false;
+    }
+
+    vector<shared_ptr<Node>> ops(ordered_ops.begin(), ordered_ops.end());
+    size_t segment_size = m_segment_size;
+    if (segment_size == 0)
+    {
+        segment_size = max<size_t>(2, static_cast<size_t>(ceil(sqrt(ops.size()))));
+    }
+
+    unordered_map<const Node*, size_t> position;
+    unordered_set<const Node*> checkpoints;
+    for (size_t pos = 0; pos < ops.size(); pos++)
+    {
+        position.emplace(ops[pos].get(), pos);
+        if (!is_recomputable(ops[pos]) || pos % segment_size == 0)
+        {
+            checkpoints.insert(ops[pos].get());
+        }
+    }
+
+    // An output read more than a segment after it is computed, by the given inputs
+    struct Candidate
+    {
+        shared_ptr<Node> node;
+        size_t bytes;
+        vector<Input<Node>> far_inputs;
+    };
+    vector<Candidate> candidates;
+    for (auto& node : ops)
+    {
+        if (checkpoints.count(node.get()) != 0)
+        {
+            continue;
+        }
+        size_t pos = position.at(node.get());
+        Candidate candidate{node, get_output_bytes(node.get(), 0), {}};
+        for (auto& input : node->output(0).get_target_inputs())
+        {
+            auto it = position.find(input.get_node());
+            if (it != position.end() && it->second > pos + segment_size)
+            {
+                candidate.far_inputs.push_back(input);
+            }
+        }
+        if (!candidate.far_inputs.empty())
+        {
+            candidates.push_back(candidate);
+        }
+    }
+    stable_sort(candidates.begin(),
+                candidates.end(),
+                [](const Candidate& a, const Candidate& b) { return a.bytes > b.bytes; });
+
+    // Clones are shared by all readers in a segment. They depend on the last op before the
+    // segment, which can not depend on any reader in it, so the clones run as late as possible
+    // without creating a cycle.
+    map<pair<const Node*, size_t>, shared_ptr<Node>> clones;
+    function<shared_ptr<Node>(const shared_ptr<Node>&, size_t, size_t)> recompute =
+        [&](const shared_ptr<Node>& node, size_t segment, size_t depth) {
+            auto key = make_pair(node.get(), segment);
+            auto it = clones.find(key);
+            if (it != clones.end())
+            {
+                return it->second;
+            }
+            NodeVector args;
+            for (auto& arg : node->get_arguments())
+            {
+                bool keep = checkpoints.count(arg.get()) != 0 || depth >= segment_size;
+                args.push_back(keep ? arg : recompute(arg, segment, depth + 1));
+            }
+            auto clone = node->copy_with_new_args(args);
+            clone->add_control_dependency(ops.at(segment * segment_size - 1));
+            clones.emplace(key, clone);
+            return clone;
+        };
+
+    bool modified = false;
+    for (auto& candidate : candidates)
+    {
+        for (auto& input : candidate.far_inputs)
+        {
+            size_t segment = position.at(input.get_node()) / segment_size;
+            input.replace_source_output(recompute(candidate.node, segment, 1)->output(0));
+        }
+        modified = true;
+        if (m_memory_budget > 0 &&
+            get_peak_live_bytes(f->get_ordered_ops()) <= m_memory_budget)
+        {
+            break;
+        }
+    }
+
+    if (modified)
+    {
+        m_peak_bytes_after = get_peak_live_bytes(f->get_ordered_ops());
+    }
+    NGRAPH_DEBUG << "Rematerialization of " << f->get_name() << ": peak live bytes "
+                 << m_peak_bytes_before << " -> " << m_peak_bytes_after << " ("
+                 << clones.size() << " ops recomputed)";
+    if (m_memory_budget > 0 && m_peak_bytes_after > m_memory_budget)
+    {
+        NGRAPH_WARN << "Rematerialization of " << f->get_name() << " leaves " << m_peak_bytes_after
+                    << " live bytes, over the budget of " << m_memory_budget;
+    }
+    return modified;
+}
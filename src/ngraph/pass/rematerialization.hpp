@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <list>
+#include <memory>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class Rematerialization;
+    }
+}
+
+/// \brief Trades compute for memory in training graphs by recomputing forward activations
+///        next to the backward ops that read them, instead of keeping them live in between.
+///
+/// The ops of the function are split, in topological order, into segments of `segment_size`
+/// ops (sqrt of the op count by default). The first op of each segment, and every op that can
+/// not be recomputed, is a checkpoint and stays live. An output of any other op that is read
+/// more than a segment later is recomputed from the nearest checkpoints: the producing ops are
+/// cloned and scheduled, through a control dependency, at the start of the reader's segment.
+///
+/// With a non-zero `memory_budget` (in bytes) the pass does nothing when the peak live bytes
+/// already fit, and otherwise rematerializes the largest outputs first until they do. Without
+/// a budget every candidate is rematerialized.
+class ngraph::pass::Rematerialization : public FunctionPass
+{
+public:
+    Rematerialization(size_t memory_budget = 0, size_t segment_size = 0);
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+    /// \brief Peak live bytes of the last function seen, before and after rematerialization.
+    size_t get_peak_bytes_before() const { return m_peak_bytes_before; }
+    size_t get_peak_bytes_after() const { return m_peak_bytes_after; }
+    /// \brief Peak bytes of the op outputs live at once when ops run in the given order.
+    ///        Parameters and constants are not counted, function results stay live to the end.
+    static size_t get_peak_live_bytes(const std::list<std::shared_ptr<Node>>& ordered_ops);
+
+private:
+    size_t m_memory_budget;
+    size_t m_segment_size;
+    size_t m_peak_bytes_before = 0;
+    size_t m_peak_bytes_after = 0;
+};
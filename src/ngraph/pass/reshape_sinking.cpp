@@ -30,10 +30,15 @@
 #include "ngraph/op/convolution.hpp"
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/min.hpp"
 #include "ngraph/op/pad.hpp"
+#include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
 #include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
 #include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
 #include "ngraph/pattern/op/label.hpp"
@@ -452,6 +457,96 @@ static void sink_concat(shared_ptr<op::Concat> n,
     reorders[new_concat] = new_reshape;
 }
 
+static shared_ptr<Node> make_reduction(shared_ptr<op::util::ArithmeticReduction> n,
+                                       shared_ptr<Node> arg,
+                                       const AxisSet& reduction_axes)
+{
+    if (dynamic_pointer_cast<op::Sum>(n))
+    {
+        return make_shared<op::Sum>(arg, reduction_axes);
+    }
+    if (dynamic_pointer_cast<op::Product>(n))
+    {
+        return make_shared<op::Product>(arg, reduction_axes);
+    }
+    if (dynamic_pointer_cast<op::Max>(n))
+    {
+        return make_shared<op::Max>(arg, reduction_axes);
+    }
+    if (dynamic_pointer_cast<op::Min>(n))
+    {
+        return make_shared<op::Min>(arg, reduction_axes);
+    }
+    return nullptr;
+}
+
+static void sink_reduction(shared_ptr<op::util::ArithmeticReduction> n,
+                           ReshapeMap& reorders,
+                           set<shared_ptr<Node>>& reshapes_to_delete)
+{
+    auto arg_reshape = reorders.at(n->get_argument(0));
+    auto order = arg_reshape->get_input_order();
+    auto def_order = ngraph::get_permutation_to_default_order(order);
+    auto input_shape = ngraph::apply_permutation(arg_reshape->get_shape(), def_order);
+    auto dummy_correct_shape =
+        make_shared<pattern::op::Label>(arg_reshape->get_element_type(), input_shape);
+
+    // reduce the same axes of the argument before it is reordered
+    const auto& reduction_axes = n->get_reduction_axes();
+    AxisSet new_reduction_axes;
+    for (auto axis : reduction_axes)
+    {
+        new_reduction_axes.insert(order.at(axis));
+    }
+    auto new_reduction = make_reduction(n, dummy_correct_shape, new_reduction_axes);
+    if (!new_reduction)
+    {
+        materialize_shapes(n, reorders, reshapes_to_delete);
+        return;
+    }
+
+    // the remaining axes keep their relative order from the reordered argument,
+    // e.g. reducing H and W of an NHWC->NCHW reorder needs no reorder at all
+    AxisVector kept_axes;
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        if (reduction_axes.count(i) == 0)
+        {
+            kept_axes.push_back(order.at(i));
+        }
+    }
+    AxisVector sorted_kept_axes{kept_axes};
+    sort(sorted_kept_axes.begin(), sorted_kept_axes.end());
+    AxisVector new_order;
+    for (auto axis : kept_axes)
+    {
+        new_order.push_back(
+            distance(sorted_kept_axes.begin(),
+                     lower_bound(sorted_kept_axes.begin(), sorted_kept_axes.end(), axis)));
+    }
+
+    ngraph::replace_node(dummy_correct_shape, n->get_argument(0));
+    NGRAPH_DEBUG << "Replacing " << n->get_name() << " with " << new_reduction->get_name();
+    ngraph::replace_node(n, new_reduction);
+    auto new_reshape = make_shared<op::Reshape>(new_reduction, new_order, n->get_shape());
+    NGRAPH_DEBUG << "Propagating " << describe_reshape(new_reshape) << " for " << n->get_name();
+    reorders[new_reduction] = new_reshape;
+}
+
+static size_t count_transposes(shared_ptr<Function> f)
+{
+    size_t count = 0;
+    for (auto n : f->get_ops())
+    {
+        auto reshape = dynamic_pointer_cast<op::Reshape>(n);
+        if (reshape && reshape->get_is_transpose())
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
 static void sink_dequantize(shared_ptr<op::Dequantize> dequantize,
                             ReshapeMap& reorders,
                             set<shared_ptr<Node>>& reshapes_to_delete)
@@ -478,8 +573,11 @@ static void sink_dequantize(shared_ptr<op::Dequantize> dequantize,
 //For each op type we support we can either combine
 //two reshapes by replacing the existing Reshape,
 //materialize pending reshapes if they can't be propagated through op
+//Binary ops with a broadcast operand swim the reorder up through the Broadcast,
+//and reductions remap their reduction axes
 bool ngraph::pass::ReshapeSinking::run_on_function(shared_ptr<ngraph::Function> f)
 {
+    m_transposes_before = count_transposes(f);
     ReshapeMap reorders;
     NodeVector results;
     set<shared_ptr<Node>> reshapes_to_delete;
@@ -547,6 +645,10 @@ bool ngraph::pass::ReshapeSinking::run_on_function(shared_ptr<ngraph::Function>
         {
             sink_concat(concat, reorders, reshapes_to_delete);
         }
+        else if (auto reduction = dynamic_pointer_cast<op::util::ArithmeticReduction>(n))
+        {
+            sink_reduction(reduction, reorders, reshapes_to_delete);
+        }
         else
         {
             materialize_shapes(n, reorders, reshapes_to_delete);
@@ -575,5 +677,9 @@ bool ngraph::pass::ReshapeSinking::run_on_function(shared_ptr<ngraph::Function>
     {
         n->revalidate_and_infer_types();
     }
+
+    m_transposes_after = count_transposes(f);
+    NGRAPH_DEBUG << "ReshapeSinking of " << f->get_name() << ": transposes "
+                 << m_transposes_before << " -> " << m_transposes_after;
     return true;
 }
@@ -27,6 +27,13 @@ namespace ngraph
         {
         public:
             bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+            /// \brief Transposing Reshapes in the last function seen, before and after sinking.
+            size_t get_transposes_before() const { return m_transposes_before; }
+            size_t get_transposes_after() const { return m_transposes_after; }
+        private:
+            size_t m_transposes_before = 0;
+            size_t m_transposes_after = 0;
         };
     }
 }
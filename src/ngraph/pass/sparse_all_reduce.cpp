@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/pass/sparse_all_reduce.hpp"
+#include "ngraph/distributed.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/allgather.hpp"
+#include "ngraph/op/allreduce.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+bool pass::SparseAllReduce::run_on_function(shared_ptr<Function> f)
+{
+    bool replaced = false;
+    for (auto& node : f->get_ordered_ops())
+    {
+        auto all_reduce = dynamic_pointer_cast<op::AllReduce>(node);
+        if (!all_reduce || all_reduce->is_compressed())
+        {
+            continue;
+        }
+        auto backprop = dynamic_pointer_cast<op::EmbeddingLookupBackprop>(node->get_argument(0));
+        if (!backprop)
+        {
+            continue;
+        }
+
+        auto& weights_shape = backprop->get_weights_shape();
+        auto element_size = backprop->get_element_type().size();
+        size_t dense_bytes = shape_size(weights_shape) * element_size;
+        if (dense_bytes < m_threshold)
+        {
+            continue;
+        }
+
+        if (m_shard_count == 0)
+        {
+            m_shard_count = get_distributed_interface()->get_size();
+        }
+        auto indices = backprop->get_argument(0);
+        auto delta = backprop->get_argument(1);
+        size_t indices_count = shape_size(indices->get_shape());
+        size_t vec_len = weights_shape.at(1);
+        size_t sparse_bytes = m_shard_count * indices_count *
+                              (vec_len * element_size + indices->get_element_type().size());
+        if (sparse_bytes >= dense_bytes)
+        {
+            continue;
+        }
+
+        NGRAPH_DEBUG << "Reducing " << node->get_name() << " sparsely, " << sparse_bytes
+                     << " instead of " << dense_bytes << " bytes";
+        auto flat_indices = make_shared<op::Reshape>(
+            indices, get_default_order(indices->get_shape()), Shape{indices_count});
+        auto flat_delta = make_shared<op::Reshape>(
+            delta, get_default_order(delta->get_shape()), Shape{indices_count, vec_len});
+        auto sparse = make_shared<op::EmbeddingLookupBackprop>(
+            make_shared<op::AllGather>(flat_indices, m_shard_count),
+            make_shared<op::AllGather>(flat_delta, m_shard_count),
+            weights_shape);
+        replace_node(node, sparse);
+        replaced = true;
+    }
+    return replaced;
+}
@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace pass
+    {
+        class SparseAllReduce;
+    }
+}
+
+/// \brief Reduces the gradients of large embedding tables sparsely.
+///
+/// An AllReduce of an EmbeddingLookupBackprop sends the whole dense table, although only the
+/// rows that were looked up are non-zero. For tables of at least threshold bytes this pass
+/// all-gathers the indices and the deltas of every process instead, and scatter-adds them
+/// into the dense gradient locally; repeated indices, within or across processes, accumulate.
+/// Tables for which the gathered pairs would not be smaller than the table are left dense, as
+/// are compressed all-reduces.
+///
+/// shard_count is the number of processes; 0 asks the distributed interface when the pass
+/// finds a candidate.
+class ngraph::pass::SparseAllReduce : public FunctionPass
+{
+public:
+    SparseAllReduce(size_t threshold = 1024 * 1024, size_t shard_count = 0)
+        : FunctionPass()
+        , m_threshold(threshold)
+        , m_shard_count(shard_count)
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f) override;
+
+private:
+    size_t m_threshold;
+    size_t m_shard_count;
+};
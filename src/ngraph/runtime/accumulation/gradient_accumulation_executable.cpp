@@ -0,0 +1,170 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <set>
+
+#include "ngraph/check.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/accumulation/gradient_accumulation_executable.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::accumulation::GradientAccumulationExecutable::GradientAccumulationExecutable(
+    const shared_ptr<Backend>& backend,
+    const shared_ptr<Function>& function,
+    const vector<size_t>& gradients,
+    const shared_ptr<Function>& update,
+    size_t steps,
+    bool enable_performance_collection)
+    : m_backend(backend)
+    , m_steps(steps)
+{
+    NGRAPH_CHECK(m_steps > 0, "Gradients must be accumulated over at least one call");
+    NGRAPH_CHECK(update->get_parameters().size() >= gradients.size(),
+                 "The update Function takes ",
+                 update->get_parameters().size(),
+                 " parameters, fewer than the ",
+                 gradients.size(),
+                 " gradients");
+
+    // Replace each gradient result of a clone by accumulator + gradient, with the accumulators
+    // as extra parameters
+    auto clone = clone_function(*function);
+    set<size_t> gradient_set(gradients.begin(), gradients.end());
+    NGRAPH_CHECK(gradient_set.size() == gradients.size(), "Gradients must be distinct results");
+    ParameterVector parameters = clone->get_parameters();
+    ResultVector results;
+    for (size_t i = 0; i < clone->get_results().size(); i++)
+    {
+        if (gradient_set.count(i) == 0)
+        {
+            results.push_back(clone->get_results()[i]);
+        }
+    }
+    for (size_t i = 0; i < gradients.size(); i++)
+    {
+        NGRAPH_CHECK(gradients[i] < clone->get_results().size(),
+                     "Gradient ",
+                     i,
+                     " refers to result ",
+                     gradients[i],
+                     " of a Function with ",
+                     clone->get_results().size(),
+                     " results");
+        auto gradient = clone->get_results()[gradients[i]]->get_argument(0);
+        const PartialShape& shape = gradient->get_output_partial_shape(0);
+        const element::Type& type = gradient->get_output_element_type(0);
+        NGRAPH_CHECK(shape.is_static() && type.is_static(),
+                     "Gradient ",
+                     i,
+                     " must have a static shape and element type to be accumulated");
+        auto& update_parameter = update->get_parameters()[i];
+        NGRAPH_CHECK(update_parameter->get_element_type().compatible(type) &&
+                         update_parameter->get_output_partial_shape(0).compatible(shape),
+                     "Parameter ",
+                     i,
+                     " of the update Function does not match gradient ",
+                     i,
+                     " of type ",
+                     type,
+                     " and shape ",
+                     shape);
+
+        auto accumulator = make_shared<op::Parameter>(type, shape);
+        parameters.push_back(accumulator);
+        results.push_back(make_shared<op::Result>(make_shared<op::Add>(accumulator, gradient)));
+        m_accumulators.push_back(m_backend->create_tensor(type, shape.to_shape()));
+    }
+    auto accumulate = make_shared<Function>(results, parameters, function->get_name());
+
+    m_parameter_count = function->get_parameters().size();
+    m_result_count = results.size() - gradients.size();
+    m_accumulate = m_backend->compile(accumulate, enable_performance_collection);
+    m_update = m_backend->compile(update, enable_performance_collection);
+
+    // Calls take the inputs and outputs of both executables, less the accumulators
+    ParameterVector call_parameters(m_accumulate->get_parameters().begin(),
+                                    m_accumulate->get_parameters().begin() + m_parameter_count);
+    call_parameters.insert(call_parameters.end(),
+                           m_update->get_parameters().begin() + gradients.size(),
+                           m_update->get_parameters().end());
+    ResultVector call_results(m_accumulate->get_results().begin(),
+                              m_accumulate->get_results().begin() + m_result_count);
+    call_results.insert(call_results.end(),
+                        m_update->get_results().begin(),
+                        m_update->get_results().end());
+    set_parameters_and_results(call_parameters, call_results);
+
+    reset();
+}
+
+runtime::accumulation::GradientAccumulationExecutable::~GradientAccumulationExecutable()
+{
+    m_backend->remove_compiled_function(m_accumulate);
+    m_backend->remove_compiled_function(m_update);
+}
+
+void runtime::accumulation::GradientAccumulationExecutable::reset()
+{
+    for (auto& accumulator : m_accumulators)
+    {
+        vector<char> zeros(accumulator->get_size_in_bytes(), 0);
+        accumulator->write(zeros.data(), 0, zeros.size());
+    }
+    m_pending_calls = 0;
+}
+
+bool runtime::accumulation::GradientAccumulationExecutable::call(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == get_parameters().size(),
+                 "Expected ",
+                 get_parameters().size(),
+                 " inputs, got ",
+                 inputs.size());
+    NGRAPH_CHECK(outputs.size() == get_results().size(),
+                 "Expected ",
+                 get_results().size(),
+                 " outputs, got ",
+                 outputs.size());
+
+    vector<shared_ptr<runtime::Tensor>> accumulate_inputs(inputs.begin(),
+                                                          inputs.begin() + m_parameter_count);
+    accumulate_inputs.insert(
+        accumulate_inputs.end(), m_accumulators.begin(), m_accumulators.end());
+    vector<shared_ptr<runtime::Tensor>> accumulate_outputs(outputs.begin(),
+                                                           outputs.begin() + m_result_count);
+    accumulate_outputs.insert(
+        accumulate_outputs.end(), m_accumulators.begin(), m_accumulators.end());
+    bool rc = m_accumulate->call(accumulate_outputs, accumulate_inputs);
+    if (!rc || ++m_pending_calls < m_steps)
+    {
+        return rc;
+    }
+
+    vector<shared_ptr<runtime::Tensor>> update_inputs(m_accumulators);
+    update_inputs.insert(update_inputs.end(), inputs.begin() + m_parameter_count, inputs.end());
+    vector<shared_ptr<runtime::Tensor>> update_outputs(outputs.begin() + m_result_count,
+                                                       outputs.end());
+    rc = m_update->call(update_outputs, update_inputs);
+    reset();
+    return rc;
+}
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace accumulation
+        {
+            class GradientAccumulationExecutable;
+        }
+    }
+}
+
+///
+/// \brief Executable that accumulates the gradients a training Function computes over several
+///        calls, one per micro-batch, and runs an optimizer Function once every `steps` calls.
+///
+/// The results of `function` listed in `gradients` are not returned. They are added into
+/// accumulator tensors that the executable allocates on `backend` and that persist across
+/// calls: the accumulation is part of the compiled graph, and each accumulator is bound as both
+/// an input and an output of it, so it is updated in place without new gradient buffers.
+///
+/// Every `steps`-th call ends a step: `update` runs with the accumulated gradients as its
+/// first parameters, in the order of `gradients`, and the accumulators are reset to zero. The
+/// accumulators hold sums, so an update that expects the mean gradient should scale its
+/// learning rate by `1 / steps`.
+///
+/// The inputs of `call` are the parameters of `function` followed by the parameters of
+/// `update` after the gradients, such as the weights and the learning rate. The outputs are the
+/// results of `function` that are not gradients, such as the loss, followed by the results of
+/// `update`, which are only written on the calls that end a step. Binding the same tensor as a
+/// weight input and as an `update` output updates the weights in place.
+///
+class ngraph::runtime::accumulation::GradientAccumulationExecutable
+    : public ngraph::runtime::Executable
+{
+public:
+    GradientAccumulationExecutable(const std::shared_ptr<Backend>& backend,
+                                   const std::shared_ptr<Function>& function,
+                                   const std::vector<size_t>& gradients,
+                                   const std::shared_ptr<Function>& update,
+                                   size_t steps,
+                                   bool enable_performance_collection = false);
+    ~GradientAccumulationExecutable() override;
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    /// \brief Discards the accumulated gradients and starts a new step
+    void reset();
+
+    size_t get_steps() const { return m_steps; }
+    /// \brief Number of calls accumulated since the last step boundary or reset
+    size_t get_pending_calls() const { return m_pending_calls; }
+    /// \brief The accumulator of gradient `i`, valid until the next call or reset
+    std::shared_ptr<runtime::Tensor> get_accumulator(size_t i) const
+    {
+        return m_accumulators.at(i);
+    }
+
+private:
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Executable> m_accumulate;
+    std::shared_ptr<Executable> m_update;
+    size_t m_steps;
+    size_t m_pending_calls = 0;
+    size_t m_parameter_count;
+    size_t m_result_count;
+    std::vector<std::shared_ptr<runtime::Tensor>> m_accumulators;
+};
@@ -14,24 +14,75 @@
 // limitations under the License.
 //*****************************************************************************
 
+
 #include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
 
+static const size_t s_huge_page_size = 2 * 1024 * 1024;
+static const size_t s_giant_page_size = 1024 * 1024 * 1024;
+
+static runtime::AlignedBuffer::HugePages get_default_huge_pages()
+{
+    const char* env = std::getenv("NGRAPH_HUGE_PAGES");
+    if (env == nullptr)
+    {
+        return runtime::AlignedBuffer::HugePages::NONE;
+    }
+    if (strcmp(env, "transparent") == 0)
+    {
+        return runtime::AlignedBuffer::HugePages::TRANSPARENT;
+    }
+    if (strcmp(env, "2M") == 0)
+    {
+        return runtime::AlignedBuffer::HugePages::HUGETLB_2MB;
+    }
+    if (strcmp(env, "1G") == 0)
+    {
+        return runtime::AlignedBuffer::HugePages::HUGETLB_1GB;
+    }
+    return runtime::AlignedBuffer::HugePages::NONE;
+}
+
+static std::atomic<runtime::AlignedBuffer::HugePages> s_huge_pages{get_default_huge_pages()};
+
+void runtime::AlignedBuffer::set_huge_pages(HugePages policy)
+{
+    s_huge_pages = policy;
+}
+
+runtime::AlignedBuffer::HugePages runtime::AlignedBuffer::get_huge_pages()
+{
+    return s_huge_pages;
+}
+
 runtime::AlignedBuffer::AlignedBuffer()
     : m_allocated_buffer(nullptr)
     , m_aligned_buffer(nullptr)
     , m_byte_size(0)
+    , m_mapped_size(0)
 {
 }
 
 runtime::AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment)
+    : m_mapped_size(0)
 {
     m_byte_size = std::max<size_t>(1, byte_size);
+    if (m_byte_size >= s_huge_page_size && map_huge_pages(alignment))
+    {
+        return;
+    }
     size_t allocation_size = m_byte_size + alignment;
     m_allocated_buffer = static_cast<char*>(ngraph_malloc(allocation_size));
     m_aligned_buffer = m_allocated_buffer;
@@ -43,8 +94,89 @@ runtime::AlignedBuffer::AlignedBuffer(size_t byte_size, size_t alignment)
     }
 }
 
+bool runtime::AlignedBuffer::map_huge_pages(size_t alignment)
+{
+#ifdef __linux__
+    HugePages policy = s_huge_pages;
+    if (policy == HugePages::NONE || alignment > s_huge_page_size)
+    {
+        return false;
+    }
+
+    void* mapping = MAP_FAILED;
+#ifdef MAP_HUGETLB
+    // hugetlbfs mappings are aligned to their page size. The pools are reserved by the
+    // administrator and are often empty, hence the fallbacks.
+    const int huge_shift = 26; // MAP_HUGE_SHIFT
+    if (policy == HugePages::HUGETLB_1GB)
+    {
+        m_mapped_size = round_up(m_byte_size, s_giant_page_size);
+        mapping = mmap(nullptr,
+                       m_mapped_size,
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (30 << huge_shift),
+                       -1,
+                       0);
+        policy = HugePages::HUGETLB_2MB;
+    }
+    if (mapping == MAP_FAILED && policy == HugePages::HUGETLB_2MB)
+    {
+        m_mapped_size = round_up(m_byte_size, s_huge_page_size);
+        mapping = mmap(nullptr,
+                       m_mapped_size,
+                       PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (21 << huge_shift),
+                       -1,
+                       0);
+    }
+    if (mapping != MAP_FAILED)
+    {
+        m_allocated_buffer = static_cast<char*>(mapping);
+        m_aligned_buffer = m_allocated_buffer;
+        return true;
+    }
+#endif
+
+#ifdef MADV_HUGEPAGE
+    // Transparent huge pages need 2MB aligned ranges, so map an extra page to align within
+    m_mapped_size = round_up(m_byte_size, s_huge_page_size) + s_huge_page_size;
+    mapping = mmap(
+        nullptr, m_mapped_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping != MAP_FAILED)
+    {
+        m_allocated_buffer = static_cast<char*>(mapping);
+        m_aligned_buffer = reinterpret_cast<char*>(
+            round_up(reinterpret_cast<size_t>(m_allocated_buffer), s_huge_page_size));
+        // Only a hint; the buffer is usable whether or not the kernel honours it
+        madvise(m_aligned_buffer, round_up(m_byte_size, s_huge_page_size), MADV_HUGEPAGE);
+        return true;
+    }
+#endif
+    m_mapped_size = 0;
+#endif
+    return false;
+}
+
+runtime::AlignedBuffer::AlignedBuffer(void* data,
+                                      size_t byte_size,
+                                      const std::shared_ptr<void>& owner)
+    : m_allocated_buffer(nullptr)
+    , m_aligned_buffer(static_cast<char*>(data))
+    , m_byte_size(byte_size)
+    , m_mapped_size(0)
+    , m_owner(owner)
+{
+}
+
 runtime::AlignedBuffer::~AlignedBuffer()
 {
+#ifdef __linux__
+    if (m_mapped_size != 0)
+    {
+        munmap(m_allocated_buffer, m_mapped_size);
+        return;
+    }
+#endif
     if (m_allocated_buffer != nullptr)
     {
         ngraph_free(m_allocated_buffer);
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstddef>
+#include <memory>
 
 namespace ngraph
 {
@@ -29,17 +30,42 @@ namespace ngraph
 /// \brief Allocates a block of memory on the specified alignment. The actual size of the
 /// allocated memory is larger than the requested size by the alignment, so allocating 1 byte
 /// on 64 byte alignment will allocate 65 bytes.
+///
+/// Buffers of at least 2MB can be backed by huge pages, see HugePages.
 class ngraph::runtime::AlignedBuffer
 {
 public:
+    /// \brief Page policy for large buffers. The initial policy comes from NGRAPH_HUGE_PAGES,
+    /// which may be "transparent", "2M" or "1G". A policy that cannot be satisfied falls back
+    /// to the next smaller one, down to ordinary pages.
+    enum class HugePages
+    {
+        NONE,
+        /// Ask the kernel for transparent huge pages with madvise
+        TRANSPARENT,
+        /// Map pages from the 2MB hugetlbfs pool
+        HUGETLB_2MB,
+        /// Map pages from the 1GB hugetlbfs pool
+        HUGETLB_1GB
+    };
+    static void set_huge_pages(HugePages policy);
+    static HugePages get_huge_pages();
+
     AlignedBuffer(size_t byte_size, size_t alignment);
+    /// \brief Wraps memory owned by \p owner without copying it. \p owner is kept alive for
+    /// the lifetime of the buffer.
+    AlignedBuffer(void* data, size_t byte_size, const std::shared_ptr<void>& owner);
     AlignedBuffer();
     ~AlignedBuffer();
 
     size_t size() const { return m_byte_size; }
     void* get_ptr(size_t offset) const { return m_aligned_buffer + offset; }
     void* get_ptr() const { return m_aligned_buffer; }
+    /// \brief True if the buffer was mapped under a huge page policy
+    bool is_mapped() const { return m_mapped_size != 0; }
 private:
+    bool map_huge_pages(size_t alignment);
+
     AlignedBuffer(const AlignedBuffer&) = delete;
     AlignedBuffer(AlignedBuffer&&) = delete;
     AlignedBuffer& operator=(const AlignedBuffer&) = delete;
@@ -47,4 +73,6 @@ private:
     char* m_allocated_buffer;
     char* m_aligned_buffer;
     size_t m_byte_size;
+    size_t m_mapped_size;
+    std::shared_ptr<void> m_owner;
 };
@@ -17,6 +17,7 @@
 #include <sstream>
 
 #include "ngraph/file_util.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
@@ -71,6 +72,18 @@ std::shared_ptr<runtime::Executable>
     return compile(func, enable_performance_data);
 }
 
+vector<shared_ptr<runtime::Executable>>
+    runtime::Backend::compile(const vector<shared_ptr<Function>>& functions,
+                              bool enable_performance_data)
+{
+    vector<shared_ptr<Executable>> executables;
+    for (auto& function : functions)
+    {
+        executables.push_back(compile(clone_function(*function), enable_performance_data));
+    }
+    return executables;
+}
+
 bool runtime::Backend::is_supported(const Node& node) const
 {
     // The default behavior is that a backend does not support any ops. If this is not the case
@@ -86,3 +99,8 @@ bool runtime::Backend::is_supported_property(const Property prop) const
 void runtime::Backend::remove_compiled_function(std::shared_ptr<Executable> exec)
 {
 }
+
+std::shared_ptr<runtime::Executable> runtime::Backend::load(istream& input_stream)
+{
+    throw runtime_error("load operation unimplemented.");
+}
@@ -109,6 +109,18 @@ public:
                                                 ngraph::pass::PassConfig& pass_config,
                                                 bool enable_performance_data = false);
 
+    /// \brief Compiles Functions that run together, such as the encoder and decoder of a
+    ///        model, so that the backend can share resources between their executables.
+    ///
+    /// The functions may share Parameters and Constants. Each is compiled from a clone, so
+    /// that compiling one never rewrites nodes it shares with another, and the clones keep
+    /// sharing the data of their constants. Backends may share more, see CPU_Backend.
+    /// \param functions The functions to compile
+    /// \returns One executable per function, in order
+    virtual std::vector<std::shared_ptr<Executable>>
+        compile(const std::vector<std::shared_ptr<Function>>& functions,
+                bool enable_performance_data = false);
+
     /// \brief Test if a backend is capable of supporting an op
     /// \param node is the op to test.
     /// \returns true if the op is supported, false otherwise.
@@ -127,6 +139,12 @@ public:
 
     virtual void remove_compiled_function(std::shared_ptr<Executable> exec);
 
+    /// \brief Restore an Executable written by `Executable::save`.
+    /// \param input_stream The stream to read the Executable from
+    /// \returns The restored Executable, ready to be called
+    /// \throws std::runtime_error if the backend does not support loading executables
+    virtual std::shared_ptr<Executable> load(std::istream& input_stream);
+
     // \brief Return a backend specific op (that is not a core ngraph op).
     //     The string op_name is the requested op, which a backend may or may not implement.
     //     If unsupported, nullptr is returned, else a backend op is returned.
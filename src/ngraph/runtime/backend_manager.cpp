@@ -20,6 +20,8 @@
 #include <dlfcn.h>
 #endif
 
+#include <mutex>
+#include <set>
 #include <sstream>
 
 #include "ngraph/file_util.hpp"
@@ -44,6 +46,37 @@ unordered_map<string, runtime::BackendConstructor*>& runtime::BackendManager::ge
     return s_registered_backend;
 }
 
+namespace
+{
+    struct StartupProfile
+    {
+        mutex m_mutex;
+        vector<pair<string, size_t>> m_steps;
+        // backend types whose first creation is recorded
+        set<string> m_created;
+    };
+
+    StartupProfile& get_startup_profile_storage()
+    {
+        static StartupProfile s_profile;
+        return s_profile;
+    }
+}
+
+vector<pair<string, size_t>> runtime::BackendManager::get_startup_profile()
+{
+    auto& profile = get_startup_profile_storage();
+    lock_guard<mutex> lock(profile.m_mutex);
+    return profile.m_steps;
+}
+
+void runtime::BackendManager::record_startup_step(const string& name, size_t microseconds)
+{
+    auto& profile = get_startup_profile_storage();
+    lock_guard<mutex> lock(profile.m_mutex);
+    profile.m_steps.emplace_back(name, microseconds);
+}
+
 void runtime::BackendManager::register_backend(const string& name, BackendConstructor* new_backend)
 {
     get_registry()[name] = new_backend;
@@ -78,7 +111,9 @@ shared_ptr<runtime::Backend> runtime::BackendManager::create_backend(const std::
         type = type.substr(0, colon);
     }
 
-    auto registry = get_registry();
+    stopwatch timer;
+    timer.start();
+    auto& registry = get_registry();
     auto it = registry.find(type);
     if (it != registry.end())
     {
@@ -88,6 +123,9 @@ shared_ptr<runtime::Backend> runtime::BackendManager::create_backend(const std::
     else
     {
         DL_HANDLE handle = open_shared_library(type);
+        timer.stop();
+        record_startup_step(type + " library load", timer.get_microseconds());
+        timer.start();
         if (!handle)
         {
             stringstream ss;
@@ -112,6 +150,14 @@ shared_ptr<runtime::Backend> runtime::BackendManager::create_backend(const std::
                                 "' does not implement get_backend_constructor_pointer");
         }
     }
+    timer.stop();
+
+    auto& profile = get_startup_profile_storage();
+    lock_guard<mutex> lock(profile.m_mutex);
+    if (profile.m_created.insert(type).second)
+    {
+        profile.m_steps.emplace_back(type + " backend creation", timer.get_microseconds());
+    }
     return backend;
 }
 
@@ -135,6 +181,13 @@ static string find_my_file()
 #endif
 }
 
+// The directory of the containing shared library, where the backend libraries are
+static const string& get_library_directory()
+{
+    static const string s_directory = file_util::get_directory(find_my_file());
+    return s_directory;
+}
+
 DL_HANDLE runtime::BackendManager::open_shared_library(string type)
 {
     string lib_prefix = SHARED_LIB_PREFIX;
@@ -150,13 +203,14 @@ DL_HANDLE runtime::BackendManager::open_shared_library(string type)
     }
 
     string library_name = lib_prefix + to_lower(type) + "_backend" + lib_suffix;
-    string my_directory = file_util::get_directory(find_my_file());
+    const string& my_directory = get_library_directory();
     string library_path = file_util::path_join(my_directory, library_name);
 #ifdef _WIN32
     SetDllDirectory((LPCSTR)my_directory.c_str());
     handle = LoadLibrary(library_path.c_str());
 #else
-    handle = dlopen(library_path.c_str(), RTLD_NOW | RTLD_GLOBAL);
+    // Symbols are bound on first use, so loading does not resolve the whole backend up front
+    handle = dlopen(library_path.c_str(), RTLD_LAZY | RTLD_GLOBAL);
 #endif
     return handle;
 }
@@ -164,7 +218,7 @@ DL_HANDLE runtime::BackendManager::open_shared_library(string type)
 map<string, string> runtime::BackendManager::get_registered_device_map()
 {
     map<string, string> rc;
-    string my_directory = file_util::get_directory(find_my_file());
+    const string& my_directory = get_library_directory();
     vector<string> backend_list;
 
     auto f = [&](const string& file, bool is_dir) {
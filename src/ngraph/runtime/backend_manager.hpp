@@ -21,6 +21,7 @@
 #include <memory>
 #include <string>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #ifdef _WIN32
@@ -63,6 +64,16 @@ public:
     /// \returns A vector of all registered devices.
     static std::vector<std::string> get_registered_backends();
 
+    /// \brief Time taken by each step of backend startup so far, in the order they ran: loading
+    ///        a backend library, creating the first backend of each type, and the steps
+    ///        backends initialize lazily on first use, such as the CPU thread pools.
+    /// \returns Pairs of step name and microseconds
+    static std::vector<std::pair<std::string, size_t>> get_startup_profile();
+
+    /// \brief Used by backends to add a step of their own initialization to the startup
+    ///        profile.
+    static void record_startup_step(const std::string& name, size_t microseconds);
+
 private:
     static std::shared_ptr<runtime::Backend> create_backend(const std::string& type);
     static std::unordered_map<std::string, BackendConstructor*>& get_registry();
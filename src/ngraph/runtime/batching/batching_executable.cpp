@@ -0,0 +1,318 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/batching/batching_executable.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/specialize_shapes.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::batching::BatchingExecutable::BatchingExecutable(shared_ptr<Function> function,
+                                                          shared_ptr<Backend> backend,
+                                                          size_t max_batch_size,
+                                                          chrono::microseconds batch_window,
+                                                          bool enable_performance_collection)
+    : m_function(function)
+    , m_backend(backend)
+    , m_max_batch_size(max_batch_size)
+    , m_batch_window(batch_window)
+    , m_enable_performance_collection(enable_performance_collection)
+    , m_queued_samples(0)
+    , m_stop(false)
+{
+    NGRAPH_CHECK(m_max_batch_size > 0, "Maximum batch size must be positive");
+    for (auto& parameter : function->get_parameters())
+    {
+        NGRAPH_CHECK(parameter->get_output_partial_shape(0).rank().is_dynamic() ||
+                         static_cast<size_t>(parameter->get_output_partial_shape(0).rank()) > 0,
+                     "Batched parameters must have a batch axis");
+    }
+
+    set_parameters_and_results(*function);
+
+    m_statistics.batch_fill_histogram.resize(m_max_batch_size + 1, 0);
+    m_dispatcher = thread(&BatchingExecutable::dispatch, this);
+}
+
+runtime::batching::BatchingExecutable::~BatchingExecutable()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_dispatcher.join();
+
+    for (auto& variant : m_variants)
+    {
+        m_backend->remove_compiled_function(variant.second.executable);
+    }
+}
+
+bool runtime::batching::BatchingExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                                 const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    return begin_call(outputs, inputs).get();
+}
+
+future<bool>
+    runtime::batching::BatchingExecutable::begin_call(const vector<shared_ptr<Tensor>>& outputs,
+                                                      const vector<shared_ptr<Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == get_parameters().size(),
+                 "Call input count ",
+                 inputs.size(),
+                 " does not match Function's Parameter count ",
+                 get_parameters().size());
+    NGRAPH_CHECK(outputs.size() == get_results().size(),
+                 "Call output count ",
+                 outputs.size(),
+                 " does not match Function's Result count ",
+                 get_results().size());
+
+    auto request = make_shared<Request>();
+    request->outputs = outputs;
+    request->inputs = inputs;
+    request->batch_size = 0;
+    for (auto& tensor : inputs)
+    {
+        const Shape& shape = tensor->get_shape();
+        NGRAPH_CHECK(shape.size() > 0, "Batched inputs must have a batch axis");
+        NGRAPH_CHECK(request->batch_size == 0 || request->batch_size == shape[0],
+                     "All inputs of a request must have the same batch size");
+        request->batch_size = shape[0];
+    }
+    NGRAPH_CHECK(request->batch_size > 0, "Requests must have at least one sample");
+    request->submitted = chrono::steady_clock::now();
+    future<bool> result = request->promise.get_future();
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        NGRAPH_CHECK(!m_stop, "BatchingExecutable is shutting down");
+        m_queue.push_back(request);
+        m_queued_samples += request->batch_size;
+    }
+    m_cv.notify_all();
+    return result;
+}
+
+runtime::batching::BatchingStatistics
+    runtime::batching::BatchingExecutable::get_statistics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_statistics;
+}
+
+bool runtime::batching::BatchingExecutable::compatible(const Request& a, const Request& b)
+{
+    for (size_t i = 0; i < a.inputs.size(); i++)
+    {
+        const Shape& shape_a = a.inputs[i]->get_shape();
+        const Shape& shape_b = b.inputs[i]->get_shape();
+        if (a.inputs[i]->get_element_type() != b.inputs[i]->get_element_type() ||
+            shape_a.size() != shape_b.size() ||
+            !equal(shape_a.begin() + 1, shape_a.end(), shape_b.begin() + 1))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+void runtime::batching::BatchingExecutable::dispatch()
+{
+    while (true)
+    {
+        vector<shared_ptr<Request>> batch = take_batch();
+        if (batch.empty())
+        {
+            break;
+        }
+        run_batch(batch);
+    }
+}
+
+vector<shared_ptr<runtime::batching::BatchingExecutable::Request>>
+    runtime::batching::BatchingExecutable::take_batch()
+{
+    unique_lock<mutex> lock(m_mutex);
+    m_cv.wait(lock, [this]() { return m_stop || !m_queue.empty(); });
+    if (m_queue.empty())
+    {
+        return {};
+    }
+
+    // Give the batch until the oldest request's window closes to fill up. Requests still queued
+    // at shutdown are run without waiting.
+    auto deadline = m_queue.front()->submitted + m_batch_window;
+    m_cv.wait_until(
+        lock, deadline, [this]() { return m_stop || m_queued_samples >= m_max_batch_size; });
+
+    vector<shared_ptr<Request>> batch{m_queue.front()};
+    size_t batch_size = m_queue.front()->batch_size;
+    m_queue.pop_front();
+    for (auto it = m_queue.begin(); it != m_queue.end() && batch_size < m_max_batch_size;)
+    {
+        if (batch_size + (*it)->batch_size <= m_max_batch_size && compatible(*batch[0], **it))
+        {
+            batch_size += (*it)->batch_size;
+            batch.push_back(*it);
+            it = m_queue.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
+    }
+    m_queued_samples -= batch_size;
+    return batch;
+}
+
+runtime::batching::BatchingExecutable::Variant&
+    runtime::batching::BatchingExecutable::get_variant(const shared_ptr<Request>& request,
+                                                       size_t batch_size)
+{
+    auto it = m_variants.find(batch_size);
+    if (it != m_variants.end())
+    {
+        return it->second;
+    }
+
+    vector<element::Type> arg_element_types;
+    vector<PartialShape> arg_shapes;
+    for (auto& tensor : request->inputs)
+    {
+        Shape shape = tensor->get_shape();
+        shape[0] = batch_size;
+        arg_element_types.push_back(tensor->get_element_type());
+        arg_shapes.push_back(shape);
+    }
+
+    Variant variant;
+    auto clone = specialize_shapes(m_function, arg_element_types, arg_shapes);
+    variant.executable = m_backend->compile(clone, m_enable_performance_collection);
+    for (size_t i = 0; i < arg_shapes.size(); i++)
+    {
+        variant.inputs.push_back(
+            m_backend->create_tensor(arg_element_types[i], arg_shapes[i].to_shape()));
+    }
+    for (auto& result : variant.executable->get_results())
+    {
+        NGRAPH_CHECK(result->get_shape().size() > 0 && result->get_shape()[0] == batch_size,
+                     "Batched results must have the batch size as dimension 0, got ",
+                     result->get_shape());
+        variant.outputs.push_back(
+            m_backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+    return m_variants.emplace(batch_size, move(variant)).first->second;
+}
+
+void runtime::batching::BatchingExecutable::run_batch(const vector<shared_ptr<Request>>& batch)
+{
+    size_t batch_size = 0;
+    for (auto& request : batch)
+    {
+        batch_size += request->batch_size;
+    }
+
+    try
+    {
+        Variant& variant = get_variant(batch[0], batch_size);
+        bool rc;
+        if (batch.size() == 1)
+        {
+            rc = variant.executable->call(batch[0]->outputs, batch[0]->inputs);
+        }
+        else
+        {
+            vector<char> staging;
+            for (size_t i = 0; i < variant.inputs.size(); i++)
+            {
+                size_t offset = 0;
+                for (auto& request : batch)
+                {
+                    size_t size = request->inputs[i]->get_size_in_bytes();
+                    staging.resize(size);
+                    request->inputs[i]->read(staging.data(), 0, size);
+                    variant.inputs[i]->write(staging.data(), offset, size);
+                    offset += size;
+                }
+            }
+
+            rc = variant.executable->call(variant.outputs, variant.inputs);
+
+            for (size_t i = 0; i < variant.outputs.size(); i++)
+            {
+                size_t sample_size = variant.outputs[i]->get_size_in_bytes() / batch_size;
+                size_t offset = 0;
+                for (auto& request : batch)
+                {
+                    size_t size = sample_size * request->batch_size;
+                    NGRAPH_CHECK(request->outputs[i]->get_size_in_bytes() == size,
+                                 "Output ",
+                                 i,
+                                 " has ",
+                                 request->outputs[i]->get_size_in_bytes(),
+                                 " bytes, expected ",
+                                 size);
+                    staging.resize(size);
+                    variant.outputs[i]->read(staging.data(), offset, size);
+                    request->outputs[i]->write(staging.data(), 0, size);
+                    offset += size;
+                }
+            }
+        }
+
+        record(batch, batch_size);
+        for (auto& request : batch)
+        {
+            request->promise.set_value(rc);
+        }
+    }
+    catch (...)
+    {
+        record(batch, batch_size);
+        for (auto& request : batch)
+        {
+            request->promise.set_exception(current_exception());
+        }
+    }
+}
+
+void runtime::batching::BatchingExecutable::record(const vector<shared_ptr<Request>>& batch,
+                                                   size_t batch_size)
+{
+    auto now = chrono::steady_clock::now();
+    lock_guard<mutex> lock(m_mutex);
+    m_statistics.batches++;
+    m_statistics.batch_fill_histogram[min(batch_size, m_max_batch_size)]++;
+    for (auto& request : batch)
+    {
+        auto latency = chrono::duration_cast<chrono::microseconds>(now - request->submitted);
+        size_t bucket = 0;
+        for (auto us = latency.count(); us > 1; us >>= 1)
+        {
+            bucket++;
+        }
+        if (bucket >= m_statistics.latency_histogram.size())
+        {
+            m_statistics.latency_histogram.resize(bucket + 1, 0);
+        }
+        m_statistics.latency_histogram[bucket]++;
+        m_statistics.requests++;
+    }
+}
@@ -0,0 +1,147 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace batching
+        {
+            struct BatchingStatistics;
+            class BatchingExecutable;
+        }
+    }
+}
+
+///
+/// \brief Counters collected by a `BatchingExecutable`.
+///
+struct ngraph::runtime::batching::BatchingStatistics
+{
+    /// Number of requests served.
+    size_t requests = 0;
+    /// Number of batched calls made on the wrapped backend.
+    size_t batches = 0;
+    /// Entry `i` counts the batches that held `i` samples along the batch axis
+    /// (`max_batch_size + 1` entries).
+    std::vector<size_t> batch_fill_histogram;
+    /// Entry `i` counts the requests whose latency, from submission until their outputs were
+    /// written, was in `[2^i, 2^(i+1))` microseconds (entry 0 also holds latencies under 1us).
+    std::vector<size_t> latency_histogram;
+};
+
+///
+/// \brief Executable that serves many small concurrent requests against one Function by
+///        running them together as a single batch.
+///
+/// The wrapped function must have a dynamic (or at least batch-generic) dimension 0 on every
+/// parameter and result, which is the batch axis. Each request passes static tensors whose
+/// dimension 0 is that request's own batch (typically 1). Requests submitted through `call` or
+/// `begin_call` are queued. A dispatcher thread:
+///
+/// 1. waits until either `max_batch_size` samples are queued or the oldest queued request has
+///    waited for `batch_window`;
+/// 2. takes queued requests, in order, whose non-batch dimensions match the first one, up to
+///    `max_batch_size` samples in total;
+/// 3. copies their inputs back to back into preallocated tensors for that batch size, makes one
+///    call on an executable specialized (see `specialize_shapes`) to that batch size, and copies
+///    the outputs back into each request's output tensors.
+///
+/// Specialized executables and their batch tensors are cached per batch size. A batch made up of
+/// a single request runs directly on that request's tensors.
+///
+class ngraph::runtime::batching::BatchingExecutable : public ngraph::runtime::Executable
+{
+public:
+    BatchingExecutable(std::shared_ptr<Function> function,
+                       std::shared_ptr<Backend> backend,
+                       size_t max_batch_size,
+                       std::chrono::microseconds batch_window,
+                       bool enable_performance_collection = false);
+    ~BatchingExecutable() override;
+
+    /// \brief Queues a request and waits for its batch to complete.
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    /// \brief Queues a request without waiting for its batch to complete.
+    std::future<bool>
+        begin_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    size_t get_max_batch_size() const { return m_max_batch_size; }
+    std::chrono::microseconds get_batch_window() const { return m_batch_window; }
+    BatchingStatistics get_statistics() const;
+
+private:
+    struct Request
+    {
+        std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+        size_t batch_size;
+        std::chrono::steady_clock::time_point submitted;
+        std::promise<bool> promise;
+    };
+
+    struct Variant
+    {
+        std::shared_ptr<Executable> executable;
+        std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+    };
+
+    void dispatch();
+    std::vector<std::shared_ptr<Request>> take_batch();
+    void run_batch(const std::vector<std::shared_ptr<Request>>& batch);
+    Variant& get_variant(const std::shared_ptr<Request>& request, size_t batch_size);
+    void record(const std::vector<std::shared_ptr<Request>>& batch, size_t batch_size);
+    static bool compatible(const Request& a, const Request& b);
+
+    std::shared_ptr<Function> m_function;
+    std::shared_ptr<Backend> m_backend;
+    size_t m_max_batch_size;
+    std::chrono::microseconds m_batch_window;
+    bool m_enable_performance_collection;
+
+    // Only touched by the dispatcher thread.
+    std::map<size_t, Variant> m_variants;
+
+    std::deque<std::shared_ptr<Request>> m_queue;
+    size_t m_queued_samples;
+    bool m_stop;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    BatchingStatistics m_statistics;
+    std::thread m_dispatcher;
+};
@@ -0,0 +1,226 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cstdlib>
+
+#include "ngraph/runtime/buffer_pool.hpp"
+#include "ngraph/util.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+constexpr size_t runtime::BufferPool::s_min_class_size;
+constexpr size_t runtime::BufferPool::s_max_class_bits;
+constexpr size_t runtime::BufferPool::s_num_classes;
+constexpr size_t runtime::BufferPool::s_thread_cache_blocks;
+constexpr size_t runtime::BufferPool::s_header_size;
+
+// Blocks freed by one thread, handed to the shared lists when the thread exits
+class runtime::BufferPool::ThreadCache
+{
+public:
+    ThreadCache()
+        : m_blocks(s_num_classes)
+    {
+    }
+
+    ~ThreadCache() { flush(); }
+    void flush()
+    {
+        auto& pool = BufferPool::get();
+        lock_guard<mutex> lock(pool.m_mutex);
+        for (size_t i = 0; i < m_blocks.size(); i++)
+        {
+            auto& list = pool.m_free_lists[i];
+            list.insert(list.end(), m_blocks[i].begin(), m_blocks[i].end());
+            m_blocks[i].clear();
+        }
+    }
+
+    vector<vector<char*>> m_blocks;
+};
+
+runtime::BufferPool& runtime::BufferPool::get()
+{
+    // Never destroyed, so that tensors freed during static destruction can still use it
+    static BufferPool* s_pool = new BufferPool();
+    return *s_pool;
+}
+
+runtime::BufferPool::ThreadCache& runtime::BufferPool::get_thread_cache()
+{
+    // The pool is constructed first, so it outlives the cache of every thread
+    get();
+    static thread_local ThreadCache s_cache;
+    return s_cache;
+}
+
+runtime::BufferPool::BufferPool()
+    : m_free_lists(s_num_classes)
+{
+    if (const char* env = getenv("NGRAPH_TENSOR_POOL_LIMIT"))
+    {
+        m_retained_limit = strtoull(env, nullptr, 0);
+    }
+}
+
+size_t runtime::BufferPool::get_size_class(size_t& size)
+{
+    if (size <= s_min_class_size)
+    {
+        size = s_min_class_size;
+        return 0;
+    }
+    // size is in (2^bits, 2^(bits + 1)], which is split in four classes
+    size_t bits = 6;
+    while ((size_t(1) << (bits + 1)) < size)
+    {
+        bits++;
+    }
+    if (bits >= s_max_class_bits)
+    {
+        return s_num_classes;
+    }
+    size_t step = size_t(1) << (bits - 2);
+    size = round_up(size, step);
+    return (bits - 6) * 4 + (size >> (bits - 2)) - 4;
+}
+
+size_t runtime::BufferPool::get_class_size(size_t index)
+{
+    if (index == 0)
+    {
+        return s_min_class_size;
+    }
+    size_t bits = 6 + (index - 1) / 4;
+    return (size_t(1) << bits) + ((index - 1) % 4 + 1) * (size_t(1) << (bits - 2));
+}
+
+bool runtime::BufferPool::reserve(size_t size)
+{
+    size_t retained = m_retained_bytes.load();
+    do
+    {
+        if (retained + size > m_retained_limit)
+        {
+            return false;
+        }
+    } while (!m_retained_bytes.compare_exchange_weak(retained, retained + size));
+    return true;
+}
+
+void* runtime::BufferPool::allocate(size_t size)
+{
+    m_allocations++;
+    size_t class_size = size;
+    size_t index = m_retained_limit == 0 ? s_num_classes : get_size_class(class_size);
+
+    char* block = nullptr;
+    if (index < s_num_classes)
+    {
+        auto& cached = get_thread_cache().m_blocks[index];
+        if (!cached.empty())
+        {
+            block = cached.back();
+            cached.pop_back();
+        }
+        else
+        {
+            lock_guard<mutex> lock(m_mutex);
+            auto& list = m_free_lists[index];
+            if (!list.empty())
+            {
+                block = list.back();
+                list.pop_back();
+            }
+        }
+        if (block != nullptr)
+        {
+            m_retained_bytes -= class_size;
+            m_hits++;
+        }
+    }
+    if (block == nullptr)
+    {
+        block = static_cast<char*>(ngraph_malloc(class_size + s_header_size));
+        *reinterpret_cast<size_t*>(block) = index;
+    }
+    return block + s_header_size;
+}
+
+void runtime::BufferPool::deallocate(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    char* block = static_cast<char*>(ptr) - s_header_size;
+    size_t index = *reinterpret_cast<size_t*>(block);
+    if (index == s_num_classes)
+    {
+        ngraph_free(block);
+        return;
+    }
+
+    size_t class_size = get_class_size(index);
+    if (!reserve(class_size))
+    {
+        ngraph_free(block);
+        return;
+    }
+    m_recycled++;
+
+    auto& cached = get_thread_cache().m_blocks[index];
+    if (cached.size() < s_thread_cache_blocks)
+    {
+        cached.push_back(block);
+    }
+    else
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_free_lists[index].push_back(block);
+    }
+}
+
+void runtime::BufferPool::set_retained_limit(size_t bytes)
+{
+    m_retained_limit = bytes;
+    if (m_retained_bytes > bytes)
+    {
+        trim();
+    }
+}
+
+void runtime::BufferPool::trim()
+{
+    get_thread_cache().flush();
+    lock_guard<mutex> lock(m_mutex);
+    for (size_t i = 0; i < m_free_lists.size(); i++)
+    {
+        for (char* block : m_free_lists[i])
+        {
+            ngraph_free(block);
+            m_retained_bytes -= get_class_size(i);
+        }
+        m_free_lists[i].clear();
+    }
+}
+
+runtime::BufferPool::Counters runtime::BufferPool::get_counters() const
+{
+    return Counters{m_allocations, m_hits, m_recycled, m_retained_bytes};
+}
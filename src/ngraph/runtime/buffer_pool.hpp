@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class BufferPool;
+    }
+}
+
+/// \brief Recycles the storage of host tensors.
+///
+/// Blocks are grouped in size classes, four per power of two. A freed block is kept for the
+/// next allocation of its class, first in a small cache owned by the freeing thread and then
+/// in a shared list, as long as the total kept stays under the retained byte limit. The limit
+/// defaults to the value of NGRAPH_TENSOR_POOL_LIMIT, in bytes, or 0, which disables pooling.
+class ngraph::runtime::BufferPool
+{
+public:
+    class Counters
+    {
+    public:
+        /// Calls to allocate
+        size_t allocations;
+        /// Allocations served with a recycled block
+        size_t hits;
+        /// Blocks kept by deallocate rather than freed
+        size_t recycled;
+        /// Bytes currently kept for reuse
+        size_t retained_bytes;
+    };
+
+    static BufferPool& get();
+
+    /// \brief Allocate at least \p size bytes, aligned to 16 bytes.
+    void* allocate(size_t size);
+    /// \brief Free a block returned by allocate.
+    void deallocate(void* ptr);
+
+    void set_retained_limit(size_t bytes);
+    size_t get_retained_limit() const { return m_retained_limit; }
+    /// \brief Free every block kept in the shared lists and in the calling thread's cache.
+    /// The caches of other threads are freed when those threads exit.
+    void trim();
+
+    Counters get_counters() const;
+
+private:
+    class ThreadCache;
+
+    BufferPool();
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    static ThreadCache& get_thread_cache();
+    // Index of the size class of \p size, updating \p size to the size of the class. Returns
+    // s_num_classes when the size is too large to pool.
+    static size_t get_size_class(size_t& size);
+    static size_t get_class_size(size_t index);
+    bool reserve(size_t size);
+
+    static constexpr size_t s_min_class_size = 64;
+    static constexpr size_t s_max_class_bits = 36;
+    static constexpr size_t s_num_classes = 1 + (s_max_class_bits - 6) * 4;
+    static constexpr size_t s_thread_cache_blocks = 4;
+    // Each block starts with its size class, which keeps the memory after it 16 byte aligned
+    static constexpr size_t s_header_size = 16;
+
+    std::atomic<size_t> m_retained_limit{0};
+    std::atomic<size_t> m_retained_bytes{0};
+    std::atomic<size_t> m_allocations{0};
+    std::atomic<size_t> m_hits{0};
+    std::atomic<size_t> m_recycled{0};
+    std::mutex m_mutex;
+    std::vector<std::vector<char*>> m_free_lists;
+};
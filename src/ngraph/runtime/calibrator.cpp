@@ -0,0 +1,258 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numeric>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/calibrator.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static const size_t s_histogram_bins = 2048;
+static const size_t s_quantized_bins = 128;
+
+// Finds the clipping threshold whose 8-bit quantization of the |x| histogram loses the least
+// information, measured as the KL divergence between the clipped and the quantized
+// distributions
+static float kl_threshold(const vector<double>& histogram, float bin_width)
+{
+    size_t best_bins = histogram.size();
+    double best_divergence = numeric_limits<double>::max();
+    for (size_t bins = s_quantized_bins; bins <= histogram.size(); bins++)
+    {
+        // Reference distribution: the first bins, with the clipped outliers folded into the last
+        vector<double> reference(histogram.begin(), histogram.begin() + bins);
+        reference[bins - 1] += accumulate(histogram.begin() + bins, histogram.end(), 0.0);
+
+        // Candidate distribution: the same bins merged into the quantized levels, each level
+        // spread evenly back over the non-empty bins it covers
+        vector<double> candidate(bins, 0.0);
+        double bins_per_level = static_cast<double>(bins) / s_quantized_bins;
+        for (size_t level = 0; level < s_quantized_bins; level++)
+        {
+            size_t begin = static_cast<size_t>(level * bins_per_level);
+            size_t end = (level + 1 == s_quantized_bins)
+                             ? bins
+                             : static_cast<size_t>((level + 1) * bins_per_level);
+            double total = 0;
+            size_t non_empty = 0;
+            for (size_t i = begin; i < end; i++)
+            {
+                total += reference[i];
+                non_empty += reference[i] != 0;
+            }
+            for (size_t i = begin; i < end; i++)
+            {
+                if (reference[i] != 0)
+                {
+                    candidate[i] = total / non_empty;
+                }
+            }
+        }
+
+        double reference_total = accumulate(reference.begin(), reference.end(), 0.0);
+        double candidate_total = accumulate(candidate.begin(), candidate.end(), 0.0);
+        if (reference_total == 0 || candidate_total == 0)
+        {
+            continue;
+        }
+        double divergence = 0;
+        for (size_t i = 0; i < bins; i++)
+        {
+            if (reference[i] != 0)
+            {
+                double p = reference[i] / reference_total;
+                divergence += p * log(p * candidate_total / candidate[i]);
+            }
+        }
+        if (divergence < best_divergence)
+        {
+            best_divergence = divergence;
+            best_bins = bins;
+        }
+    }
+    return (best_bins + 0.5f) * bin_width;
+}
+
+static float estimate_sqnr_db(const vector<double>& histogram,
+                              float bin_width,
+                              float threshold,
+                              bool is_signed)
+{
+    double levels = is_signed ? numeric_limits<int8_t>::max() : numeric_limits<uint8_t>::max();
+    double step = threshold / levels;
+    double signal = 0;
+    double noise = 0;
+    for (size_t i = 0; i < histogram.size(); i++)
+    {
+        double value = (i + 0.5) * bin_width;
+        double quantized = step > 0 ? min(round(value / step), levels) * step : 0;
+        signal += histogram[i] * value * value;
+        noise += histogram[i] * (value - quantized) * (value - quantized);
+    }
+    if (noise == 0 || signal == 0)
+    {
+        return numeric_limits<float>::infinity();
+    }
+    return static_cast<float>(10 * log10(signal / noise));
+}
+
+runtime::Calibrator::Calibrator(const shared_ptr<Backend>& backend,
+                                const shared_ptr<Function>& function,
+                                CalibrationMode mode)
+    : m_backend(backend)
+    , m_mode(mode)
+{
+    NodeMap node_map;
+    auto clone = clone_function(*function, node_map);
+    ResultVector results = clone->get_results();
+    for (auto& result : results)
+    {
+        m_outputs.push_back(
+            m_backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+
+    for (auto& node : function->get_ordered_ops())
+    {
+        if (node->is_constant() || node->is_output() || node->get_output_size() != 1 ||
+            node->get_element_type() != element::f32 ||
+            node->get_output_partial_shape(0).is_dynamic())
+        {
+            continue;
+        }
+        results.push_back(make_shared<op::Result>(node_map.at(node.get())));
+
+        ObservedTensor observed;
+        observed.name = node->get_name();
+        observed.shape = node->get_shape();
+        observed.tensor = m_backend->create_tensor(element::f32, observed.shape);
+        m_outputs.push_back(observed.tensor);
+        m_observed.push_back(observed);
+    }
+
+    m_executable = m_backend->compile(make_shared<Function>(results, clone->get_parameters()));
+}
+
+void runtime::Calibrator::run(const vector<shared_ptr<Tensor>>& batch)
+{
+    m_executable->call_with_validate(m_outputs, batch);
+}
+
+runtime::CalibrationTable
+    runtime::Calibrator::calibrate(const vector<vector<shared_ptr<Tensor>>>& batches)
+{
+    if (batches.empty())
+    {
+        throw ngraph_error("Calibration needs at least one batch");
+    }
+
+    // First pass: per-channel extremes
+    vector<vector<float>> mins;
+    vector<vector<float>> maxes;
+    vector<size_t> inner_sizes;
+    for (auto& observed : m_observed)
+    {
+        size_t channels = 1;
+        size_t inner_size = shape_size(observed.shape);
+        if (m_mode == CalibrationMode::PER_CHANNEL_MIN_MAX && observed.shape.size() >= 2)
+        {
+            channels = observed.shape[1];
+            inner_size = shape_size(Shape(observed.shape.begin() + 2, observed.shape.end()));
+        }
+        mins.emplace_back(channels, numeric_limits<float>::max());
+        maxes.emplace_back(channels, numeric_limits<float>::lowest());
+        inner_sizes.push_back(inner_size);
+    }
+
+    vector<float> values;
+    for (auto& batch : batches)
+    {
+        run(batch);
+        for (size_t t = 0; t < m_observed.size(); t++)
+        {
+            values.resize(shape_size(m_observed[t].shape));
+            m_observed[t].tensor->read(values.data(), 0, values.size() * sizeof(float));
+            size_t channels = mins[t].size();
+            for (size_t i = 0; i < values.size(); i++)
+            {
+                size_t channel = (i / inner_sizes[t]) % channels;
+                mins[t][channel] = min(mins[t][channel], values[i]);
+                maxes[t][channel] = max(maxes[t][channel], values[i]);
+            }
+        }
+    }
+
+    // Second pass: histograms of magnitudes, for KL thresholds and noise estimates
+    vector<float> tensor_mins;
+    vector<float> tensor_maxes;
+    vector<float> bin_widths;
+    vector<vector<double>> histograms(m_observed.size(), vector<double>(s_histogram_bins, 0.0));
+    for (size_t t = 0; t < m_observed.size(); t++)
+    {
+        tensor_mins.push_back(*min_element(mins[t].begin(), mins[t].end()));
+        tensor_maxes.push_back(*max_element(maxes[t].begin(), maxes[t].end()));
+        float max_abs = max(abs(tensor_mins[t]), abs(tensor_maxes[t]));
+        bin_widths.push_back(max_abs / s_histogram_bins);
+    }
+    for (auto& batch : batches)
+    {
+        run(batch);
+        for (size_t t = 0; t < m_observed.size(); t++)
+        {
+            values.resize(shape_size(m_observed[t].shape));
+            m_observed[t].tensor->read(values.data(), 0, values.size() * sizeof(float));
+            for (float value : values)
+            {
+                size_t bin = bin_widths[t] > 0 ? static_cast<size_t>(abs(value) / bin_widths[t])
+                                              : 0;
+                histograms[t][min(bin, s_histogram_bins - 1)]++;
+            }
+        }
+    }
+
+    CalibrationTable table;
+    for (size_t t = 0; t < m_observed.size(); t++)
+    {
+        TensorRange range;
+        if (m_mode == CalibrationMode::KL_DIVERGENCE)
+        {
+            float threshold = kl_threshold(histograms[t], bin_widths[t]);
+            range.min.push_back(max(tensor_mins[t], -threshold));
+            range.max.push_back(min(tensor_maxes[t], threshold));
+        }
+        else
+        {
+            range.min = mins[t];
+            range.max = maxes[t];
+        }
+
+        float threshold = 0;
+        for (size_t c = 0; c < range.min.size(); c++)
+        {
+            threshold = max(threshold, max(abs(range.min[c]), abs(range.max[c])));
+        }
+        range.sqnr_db =
+            estimate_sqnr_db(histograms[t], bin_widths[t], threshold, tensor_mins[t] < 0);
+        table.emplace(m_observed[t].name, range);
+    }
+    return table;
+}
@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        enum class CalibrationMode
+        {
+            /// One range per tensor, from the smallest and largest values seen
+            MIN_MAX,
+            /// One range per channel (axis 1), from the smallest and largest values seen
+            PER_CHANNEL_MIN_MAX,
+            /// One range per tensor, clipped to the threshold that minimizes the KL divergence
+            /// between the observed distribution and its 8-bit quantization
+            KL_DIVERGENCE
+        };
+
+        /// \brief Range chosen for one tensor during calibration.
+        class TensorRange
+        {
+        public:
+            /// One entry for per-tensor ranges, one entry per channel otherwise
+            std::vector<float> min;
+            std::vector<float> max;
+            /// Estimated signal to quantization noise ratio, in dB, of quantizing the tensor
+            /// to 8 bits over its per-tensor range; higher is better
+            float sqnr_db;
+        };
+
+        /// Calibrated ranges keyed by the name of the node producing each tensor
+        using CalibrationTable = std::map<std::string, TensorRange>;
+
+        class Calibrator;
+    }
+}
+
+/// \brief Collects the value ranges of the intermediate f32 tensors of a Function by running
+///        it over sample inputs, for use by pass::CalibratedQuantization.
+///
+/// The Function is cloned, every single-output f32 node of the clone is made an additional
+/// result, and the clone is compiled once on the given backend. The Function itself is not
+/// modified.
+class ngraph::runtime::Calibrator
+{
+public:
+    Calibrator(const std::shared_ptr<Backend>& backend,
+               const std::shared_ptr<Function>& function,
+               CalibrationMode mode = CalibrationMode::MIN_MAX);
+
+    /// \brief Runs the Function once per batch, twice over for KL_DIVERGENCE and for the
+    ///        noise estimates, and returns the range of every observed tensor.
+    /// \param batches Each batch holds one tensor per parameter of the Function.
+    CalibrationTable calibrate(const std::vector<std::vector<std::shared_ptr<Tensor>>>& batches);
+
+private:
+    class ObservedTensor
+    {
+    public:
+        std::string name;
+        Shape shape;
+        std::shared_ptr<Tensor> tensor;
+    };
+
+    void run(const std::vector<std::shared_ptr<Tensor>>& batch);
+
+    std::shared_ptr<Backend> m_backend;
+    CalibrationMode m_mode;
+    std::shared_ptr<Executable> m_executable;
+    std::vector<std::shared_ptr<Tensor>> m_outputs;
+    std::vector<ObservedTensor> m_observed;
+};
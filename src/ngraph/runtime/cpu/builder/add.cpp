@@ -50,6 +50,12 @@ namespace ngraph
                         external_function->get_buffer_index(args[1].get_name());
                     auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, sum_pd, add_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_elementwise_add(
+                                ctx->mkldnn_primitives, sum_pd, deps, add_index);
+                        });
+
                     auto functor = [&,
                                     sum_pd,
                                     add_index,
@@ -57,11 +63,6 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_elementwise_add(
-                                ctx->mkldnn_primitives, sum_pd, deps, add_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
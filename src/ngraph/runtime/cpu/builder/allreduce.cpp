@@ -14,7 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <cstring>
+#include <vector>
+
 #include "ngraph/op/allreduce.hpp"
+#include "ngraph/distributed.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 
@@ -48,13 +52,45 @@ namespace ngraph
                     node->get_friendly_name().c_str(),
                     count);
 
-                auto functor = [&, count, data_type, arg_buffer_index, out_buffer_index](
-                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                    get_distributed_interface()->all_reduce(ctx->buffer_data[arg_buffer_index],
-                                                            ctx->buffer_data[out_buffer_index],
-                                                            data_type,
-                                                            count);
-                };
+                auto all_reduce = static_cast<const ngraph::op::AllReduce*>(node);
+                if (all_reduce->is_compressed())
+                {
+                    auto compressed_type = all_reduce->get_compressed_type().get_type_enum();
+                    // The rounding error is carried from one call of the function to the next
+                    auto error_feedback = make_shared<vector<float>>(count, 0.0f);
+                    auto functor = [&, count, compressed_type, error_feedback, arg_buffer_index,
+                                    out_buffer_index](CPURuntimeContext* ctx,
+                                                      CPUExecutionContext* ectx) {
+                        get_distributed_interface()->compressed_all_reduce(
+                            static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
+                            static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                            compressed_type,
+                            count,
+                            error_feedback->data());
+                    };
+                    functors.emplace_back(functor);
+                    return;
+                }
+
+                auto request_index =
+                    external_function->add_distributed_request(out[0].get_name());
+                auto element_size = args[0].get_element_type().size();
+
+                // The reduction runs in place on the output, so the input can be reused as soon
+                // as the op returns. Users of the output wait for the request, see
+                // CPU_ExternalFunction::build.
+                auto functor =
+                    [&, count, data_type, element_size, arg_buffer_index, out_buffer_index,
+                     request_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        void* in = ctx->buffer_data[arg_buffer_index];
+                        void* out = ctx->buffer_data[out_buffer_index];
+                        if (in != out)
+                        {
+                            memcpy(out, in, count * element_size);
+                        }
+                        ctx->distributed_requests[request_index] =
+                            get_distributed_interface()->iall_reduce(out, out, data_type, count);
+                    };
                 functors.emplace_back(functor);
             }
 
@@ -59,14 +59,15 @@ namespace ngraph
                     size_t avg_pool_index = mkldnn_emitter->reserve_primitive_space(3);
                     auto& deps = mkldnn_emitter->get_primitive_deps(avg_pool_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, avg_pool_desc, avg_pool_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_pooling_forward(
+                                ctx->mkldnn_primitives, avg_pool_desc, deps, avg_pool_index);
+                        });
+
                     auto functor =
                         [&, avg_pool_desc, avg_pool_index, arg0_buffer_index, out_buffer_index](
                             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            if (ctx->first_iteration)
-                            {
-                                mkldnn_emitter->build_pooling_forward(
-                                    ctx->mkldnn_primitives, avg_pool_desc, deps, avg_pool_index);
-                            }
                             cpu::mkldnn_utils::set_memory_ptr(
                                 ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                             cpu::mkldnn_utils::set_memory_ptr(
@@ -141,6 +142,16 @@ namespace ngraph
                     size_t avg_pool_index = mkldnn_emitter->reserve_primitive_space(3);
                     auto& deps = mkldnn_emitter->get_primitive_deps(avg_pool_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, avg_pool_desc, avg_pool_fwd_desc, avg_pool_index](
+                            CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_pooling_backward(ctx->mkldnn_primitives,
+                                                                   avg_pool_desc,
+                                                                   avg_pool_fwd_desc,
+                                                                   deps,
+                                                                   avg_pool_index);
+                        });
+
                     auto functor = [&,
                                     avg_pool_desc,
                                     avg_pool_fwd_desc,
@@ -148,14 +159,6 @@ namespace ngraph
                                     delta_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_pooling_backward(ctx->mkldnn_primitives,
-                                                                   avg_pool_desc,
-                                                                   avg_pool_fwd_desc,
-                                                                   deps,
-                                                                   avg_pool_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[delta_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -20,6 +20,7 @@
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/kernel/batchnorm.hpp"
+#include "ngraph/runtime/cpu/kernel/relu.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
@@ -90,6 +91,18 @@ namespace ngraph
                     auto batchnorm_index = mkldnn_emitter->reserve_primitive_space(6);
                     auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, batchnorm_desc, weights_desc, training, ops, batchnorm_index](
+                            CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_batchnorm_forward(ctx->mkldnn_primitives,
+                                                                    batchnorm_desc,
+                                                                    weights_desc,
+                                                                    training,
+                                                                    deps,
+                                                                    batchnorm_index,
+                                                                    ops);
+                        });
+
                     auto functor = [&,
                                     batchnorm_desc,
                                     weights_desc,
@@ -105,16 +118,6 @@ namespace ngraph
                                     out1_buffer_index,
                                     out2_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_batchnorm_forward(ctx->mkldnn_primitives,
-                                                                    batchnorm_desc,
-                                                                    weights_desc,
-                                                                    training,
-                                                                    deps,
-                                                                    batchnorm_index,
-                                                                    ops);
-                        }
                         memcpy(stacked_weights.get(),
                                ctx->buffer_data[arg0_buffer_index],
                                weight_sizes[0]);
@@ -156,6 +159,18 @@ namespace ngraph
                     auto batchnorm_index = mkldnn_emitter->reserve_primitive_space(6);
                     auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, batchnorm_desc, weights_desc, training, ops, batchnorm_index](
+                            CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_batchnorm_forward(ctx->mkldnn_primitives,
+                                                                    batchnorm_desc,
+                                                                    weights_desc,
+                                                                    training,
+                                                                    deps,
+                                                                    batchnorm_index,
+                                                                    ops);
+                        });
+
                     auto functor = [&,
                                     batchnorm_desc,
                                     weights_desc,
@@ -171,16 +186,6 @@ namespace ngraph
                                     arg4_buffer_index,
                                     out0_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_batchnorm_forward(ctx->mkldnn_primitives,
-                                                                    batchnorm_desc,
-                                                                    weights_desc,
-                                                                    training,
-                                                                    deps,
-                                                                    batchnorm_index,
-                                                                    ops);
-                        }
                         memcpy(stacked_weights.get(),
                                ctx->buffer_data[arg0_buffer_index],
                                weight_sizes[0]);
@@ -379,8 +384,14 @@ namespace ngraph
                 }
             }
 
-            template <>
-            void Builder::BUILDER_DECL(ngraph::op::BatchNormTrainingBackprop)
+            // With fused_relu, args[5] is the forward output and delta is first masked with the
+            // relu derivative into the input delta's buffer, which MKLDNN then updates in place
+            template <typename OP>
+            static void build_batch_norm_backprop(CPU_ExternalFunction* external_function,
+                                                  const ngraph::Node* node,
+                                                  const std::vector<TensorViewWrapper>& args,
+                                                  const std::vector<TensorViewWrapper>& out,
+                                                  bool fused_relu)
             {
                 auto& functors = external_function->get_functors();
 
@@ -390,6 +401,8 @@ namespace ngraph
                 auto arg3_buffer_index = external_function->get_buffer_index(args[3].get_name());
                 auto arg4_buffer_index = external_function->get_buffer_index(args[4].get_name());
                 auto arg5_buffer_index = external_function->get_buffer_index(args[5].get_name());
+                auto delta_buffer_index =
+                    external_function->get_buffer_index(args.back().get_name());
 
                 auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
                 auto out1_buffer_index = external_function->get_buffer_index(out[1].get_name());
@@ -410,7 +423,7 @@ namespace ngraph
                                                      std::default_delete<uint8_t[]>());
 
                 auto& mkldnn_emitter = external_function->get_mkldnn_emitter();
-                auto batchnorm_desc = mkldnn_emitter->get_batchnorm_backward_desc(node);
+                auto batchnorm_desc = mkldnn_emitter->get_batchnorm_backward_desc<OP>(node);
                 auto weights_shape = Shape{2, args[0].get_size()};
                 auto weights_desc = mkldnn_emitter->build_memory_descriptor(
                     weights_shape, args[0].get_element_type(), mkldnn::memory::format::nc);
@@ -421,6 +434,21 @@ namespace ngraph
                 // dinput, dweights, and batch_normalization_backward.
                 auto batchnorm_index = mkldnn_emitter->reserve_primitive_space(8);
                 auto& deps = mkldnn_emitter->get_primitive_deps(batchnorm_index);
+                // the delta buffer may hold a padded MKLDNN layout
+                size_t delta_count =
+                    node->get_output_tensor_ptr(0)->get_tensor_layout()->get_allocated_size() /
+                    out[0].get_element_type().size();
+
+                external_function->add_mkldnn_primitive_builder(
+                    [&, batchnorm_desc, weights_desc, dweights_desc, batchnorm_index](
+                        CPURuntimeContext* ctx) {
+                        mkldnn_emitter->build_batchnorm_backward(ctx->mkldnn_primitives,
+                                                                 batchnorm_desc,
+                                                                 weights_desc,
+                                                                 dweights_desc,
+                                                                 deps,
+                                                                 batchnorm_index);
+                    });
 
                 auto functor = [&,
                                 batchnorm_desc,
@@ -436,19 +464,13 @@ namespace ngraph
                                 arg3_buffer_index,
                                 arg4_buffer_index,
                                 arg5_buffer_index,
+                                delta_buffer_index,
+                                delta_count,
+                                fused_relu,
                                 out0_buffer_index,
                                 out1_buffer_index,
                                 out2_buffer_index](CPURuntimeContext* ctx,
                                                    CPUExecutionContext* ectx) {
-                    if (ctx->first_iteration)
-                    {
-                        mkldnn_emitter->build_batchnorm_backward(ctx->mkldnn_primitives,
-                                                                 batchnorm_desc,
-                                                                 weights_desc,
-                                                                 dweights_desc,
-                                                                 deps,
-                                                                 batchnorm_index);
-                    }
                     memcpy(stacked_weights.get(),
                            ctx->buffer_data[arg0_buffer_index],
                            weight_sizes[0]);
@@ -463,8 +485,22 @@ namespace ngraph
                         ctx, deps[2], ctx->buffer_data[arg3_buffer_index]);
                     cpu::mkldnn_utils::set_memory_ptr(
                         ctx, deps[3], ctx->buffer_data[arg4_buffer_index]);
-                    cpu::mkldnn_utils::set_memory_ptr(
-                        ctx, deps[4], ctx->buffer_data[arg5_buffer_index]);
+                    if (fused_relu)
+                    {
+                        runtime::cpu::kernel::relu_backprop<float>(
+                            ctx->buffer_data[arg5_buffer_index],
+                            ctx->buffer_data[delta_buffer_index],
+                            ctx->buffer_data[out0_buffer_index],
+                            delta_count,
+                            ectx->arena);
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[4], ctx->buffer_data[out0_buffer_index]);
+                    }
+                    else
+                    {
+                        cpu::mkldnn_utils::set_memory_ptr(
+                            ctx, deps[4], ctx->buffer_data[delta_buffer_index]);
+                    }
                     cpu::mkldnn_utils::set_memory_ptr(
                         ctx, deps[5], ctx->buffer_data[out0_buffer_index]);
                     cpu::mkldnn_utils::set_memory_ptr(ctx, deps[6], stacked_dweights.get());
@@ -481,6 +517,25 @@ namespace ngraph
                 functors.emplace_back(functor);
             }
 
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BatchNormTrainingBackprop)
+            {
+                build_batch_norm_backprop<ngraph::op::BatchNormTrainingBackprop>(
+                    external_function, node, args, out, false);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::BatchNormTrainingReluBackprop)
+            {
+                if (!mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error(
+                        "BatchNormReluBackprop is only supported with 4-D MKLDNN kernel.");
+                }
+                build_batch_norm_backprop<ngraph::op::BatchNormTrainingReluBackprop>(
+                    external_function, node, args, out, true);
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::BatchNormTrainingRelu)
             {
@@ -508,6 +563,7 @@ namespace ngraph
             REGISTER_OP_BUILDER(BatchNormTrainingRelu);
             REGISTER_OP_BUILDER(BatchNormInferenceRelu);
             REGISTER_OP_BUILDER(BatchNormTrainingBackprop);
+            REGISTER_OP_BUILDER(BatchNormTrainingReluBackprop);
         }
     }
 }
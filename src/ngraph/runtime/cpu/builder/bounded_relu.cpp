@@ -48,19 +48,20 @@ namespace ngraph
                     auto bounded_relu_index = mkldnn_emitter->reserve_primitive_space(3);
                     auto& deps = mkldnn_emitter->get_primitive_deps(bounded_relu_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, bounded_relu_desc, bounded_relu_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_bounded_relu(ctx->mkldnn_primitives,
+                                                               bounded_relu_desc,
+                                                               deps,
+                                                               bounded_relu_index);
+                        });
+
                     auto functor = [&,
                                     bounded_relu_desc,
                                     bounded_relu_index,
                                     input_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_bounded_relu(ctx->mkldnn_primitives,
-                                                               bounded_relu_desc,
-                                                               deps,
-                                                               bounded_relu_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[input_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -155,10 +155,38 @@ namespace ngraph
                     }
                 }
 
-                SELECT_KERNEL_BY_RANK(kernel,
-                                      broadcast->get_input_element_type(0),
-                                      out_rank,
-                                      runtime::cpu::kernel::broadcast);
+                // Merge neighbouring axes that are both broadcast or both copied
+                // Ex. [2, 3, 1, 1] -> [6, 1] for output shape [2, 3, 4, 5] -> [6, 20]
+                Shape collapsed_input_shape, collapsed_out_shape;
+                for (size_t j = 0; j < out_rank; j++)
+                {
+                    bool broadcast_axis = expanded_input_shape[j] != out_shape[j];
+                    if (j > 0 &&
+                        broadcast_axis == (expanded_input_shape[j - 1] != out_shape[j - 1]))
+                    {
+                        collapsed_input_shape.back() *= expanded_input_shape[j];
+                        collapsed_out_shape.back() *= out_shape[j];
+                    }
+                    else
+                    {
+                        collapsed_input_shape.push_back(expanded_input_shape[j]);
+                        collapsed_out_shape.push_back(out_shape[j]);
+                    }
+                }
+                expanded_input_shape = collapsed_input_shape;
+                out_shape = collapsed_out_shape;
+                out_rank = out_shape.size();
+
+                auto& storage_type = storage_element_type(broadcast->get_input_element_type(0));
+                if (out_rank > MAX_EIGEN_KERNEL_RANK)
+                {
+                    SELECT_KERNEL(kernel, storage_type, runtime::cpu::kernel::broadcast_ref);
+                }
+                else
+                {
+                    SELECT_KERNEL_BY_RANK(
+                        kernel, storage_type, out_rank, runtime::cpu::kernel::broadcast);
+                }
             }
 
             template <>
@@ -109,6 +109,15 @@ namespace ngraph
                     auto concat_index = mkldnn_emitter->reserve_primitive_space(nargs + 2);
                     auto& deps = mkldnn_emitter->get_primitive_deps(concat_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, concat_pd, inputs_data_desc, concat_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_concat(ctx->mkldnn_primitives,
+                                                         concat_pd,
+                                                         inputs_data_desc,
+                                                         deps,
+                                                         concat_index);
+                        });
+
                     auto functor = [&,
                                     concat_pd,
                                     inputs_data_desc,
@@ -117,14 +126,6 @@ namespace ngraph
                                     concat_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_concat(ctx->mkldnn_primitives,
-                                                         concat_pd,
-                                                         inputs_data_desc,
-                                                         deps,
-                                                         concat_index);
-                        }
                         for (size_t i = 0; i < nargs; i++)
                         {
                             cpu::mkldnn_utils::set_memory_ptr(
@@ -142,7 +143,7 @@ namespace ngraph
                     std::function<decltype(runtime::cpu::kernel::concat<float, 1>)> kernel;
 
                     SELECT_KERNEL_BY_RANK(kernel,
-                                          out[0].get_element_type(),
+                                          storage_element_type(out[0].get_element_type()),
                                           out[0].get_shape().size(),
                                           runtime::cpu::kernel::concat);
 
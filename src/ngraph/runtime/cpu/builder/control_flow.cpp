@@ -0,0 +1,170 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/op/experimental/if.hpp"
+#include "ngraph/op/experimental/loop.hpp"
+#include "ngraph/runtime/cpu/cpu_backend.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // The body is compiled once, on a clone so that the caller's function is left
+            // as it is. Every run of the op calls the same executable, which keeps its call
+            // frame and memory plan between calls.
+            static shared_ptr<CPU_Executable> compile_body(const Function& body)
+            {
+                ngraph::pass::PassConfig pass_config;
+                return make_shared<CPU_Executable>(clone_function(body), pass_config, false);
+            }
+
+            static vector<size_t> get_buffer_indices(CPU_ExternalFunction* external_function,
+                                                     const vector<TensorViewWrapper>& tvs)
+            {
+                vector<size_t> indices;
+                for (auto& tv : tvs)
+                {
+                    indices.push_back(external_function->get_buffer_index(tv.get_name()));
+                }
+                return indices;
+            }
+
+            // Tensors over the buffers of tvs, starting from the first-th
+            static vector<shared_ptr<runtime::Tensor>>
+                wrap_buffers(CPURuntimeContext* ctx,
+                             const vector<TensorViewWrapper>& tvs,
+                             const vector<size_t>& buffer_indices,
+                             size_t first = 0)
+            {
+                vector<shared_ptr<runtime::Tensor>> tensors;
+                for (size_t i = first; i < tvs.size(); i++)
+                {
+                    tensors.push_back(
+                        make_shared<CPUTensorView>(tvs[i].get_element_type(),
+                                                   tvs[i].get_shape(),
+                                                   ctx->buffer_data[buffer_indices[i]]));
+                }
+                return tensors;
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::If)
+            {
+                auto& functors = external_function->get_functors();
+                auto if_op = static_cast<const ngraph::op::If*>(node);
+
+                auto then_executable = compile_body(*if_op->get_then_body());
+                auto else_executable = compile_body(*if_op->get_else_body());
+                auto arg_buffer_indices = get_buffer_indices(external_function, args);
+                auto out_buffer_indices = get_buffer_indices(external_function, out);
+
+                auto functor = [then_executable,
+                                else_executable,
+                                args,
+                                out,
+                                arg_buffer_indices,
+                                out_buffer_indices](CPURuntimeContext* ctx,
+                                                    CPUExecutionContext* ectx) {
+                    bool condition =
+                        static_cast<char*>(ctx->buffer_data[arg_buffer_indices[0]])[0] != 0;
+                    (condition ? then_executable : else_executable)
+                        ->call(wrap_buffers(ctx, out, out_buffer_indices),
+                               wrap_buffers(ctx, args, arg_buffer_indices, 1));
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Loop)
+            {
+                auto& functors = external_function->get_functors();
+                auto loop = static_cast<const ngraph::op::Loop*>(node);
+
+                auto executable = compile_body(*loop->get_body());
+                size_t carried_count = loop->get_carried_count();
+                auto arg_buffer_indices = get_buffer_indices(external_function, args);
+                auto out_buffer_indices = get_buffer_indices(external_function, out);
+
+                auto functor = [executable,
+                                carried_count,
+                                args,
+                                out,
+                                arg_buffer_indices,
+                                out_buffer_indices](CPURuntimeContext* ctx,
+                                                    CPUExecutionContext* ectx) {
+                    int64_t trip_count =
+                        static_cast<int64_t*>(ctx->buffer_data[arg_buffer_indices[0]])[0];
+                    bool condition =
+                        static_cast<char*>(ctx->buffer_data[arg_buffer_indices[1]])[0] != 0;
+
+                    // The loop-carried values start in the op's outputs. Each iteration
+                    // writes the next values to the other buffer of their pair, and the two
+                    // buffers swap roles, so no value is copied between iterations.
+                    auto results = wrap_buffers(ctx, out, out_buffer_indices);
+                    auto iteration = make_shared<CPUTensorView>(element::i64, Shape{});
+                    auto next_condition = make_shared<CPUTensorView>(element::boolean, Shape{});
+                    vector<shared_ptr<runtime::Tensor>> inputs{iteration};
+                    vector<shared_ptr<runtime::Tensor>> outputs{next_condition};
+                    for (size_t i = 0; i < carried_count; i++)
+                    {
+                        results[i]->write(ctx->buffer_data[arg_buffer_indices[i + 2]],
+                                          0,
+                                          out[i].get_size() * out[i].get_element_type().size());
+                        inputs.push_back(results[i]);
+                        outputs.push_back(make_shared<CPUTensorView>(out[i].get_element_type(),
+                                                                     out[i].get_shape()));
+                    }
+                    auto invariants =
+                        wrap_buffers(ctx, args, arg_buffer_indices, 2 + carried_count);
+                    inputs.insert(inputs.end(), invariants.begin(), invariants.end());
+
+                    for (int64_t i = 0; condition && (trip_count < 0 || i < trip_count); i++)
+                    {
+                        *reinterpret_cast<int64_t*>(iteration->get_data_ptr()) = i;
+                        executable->call(outputs, inputs);
+                        condition = next_condition->get_data_ptr()[0] != 0;
+                        for (size_t j = 1; j <= carried_count; j++)
+                        {
+                            swap(inputs[j], outputs[j]);
+                        }
+                    }
+                    for (size_t i = 0; i < carried_count; i++)
+                    {
+                        if (inputs[i + 1] != results[i])
+                        {
+                            inputs[i + 1]->read(
+                                ctx->buffer_data[out_buffer_indices[i]],
+                                0,
+                                out[i].get_size() * out[i].get_element_type().size());
+                        }
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(If);
+            REGISTER_OP_BUILDER(Loop);
+        }
+    }
+}
@@ -46,9 +46,24 @@ namespace ngraph
                 }
                 else if (out[0].get_element_type() == element::f32)
                 {
-                    SELECT_KERNEL(kernel,
-                                  args[0].get_element_type(),
-                                  runtime::cpu::kernel::convert_to_float32);
+                    if (args[0].get_element_type() == element::bf16)
+                    {
+                        kernel = runtime::cpu::kernel::convert_bf16_to_float32;
+                    }
+                    else
+                    {
+                        SELECT_KERNEL(kernel,
+                                      args[0].get_element_type(),
+                                      runtime::cpu::kernel::convert_to_float32);
+                    }
+                }
+                else if (out[0].get_element_type() == element::bf16)
+                {
+                    if (args[0].get_element_type() != element::f32)
+                    {
+                        throw ngraph_error("CPU backend only converts bf16 from and to f32");
+                    }
+                    kernel = runtime::cpu::kernel::convert_float32_to_bf16;
                 }
                 else if (out[0].get_element_type() == element::f64)
                 {
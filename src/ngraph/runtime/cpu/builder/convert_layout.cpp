@@ -84,17 +84,18 @@ namespace ngraph
                 // ConvertLayout needs 3 primitives: input, result, and reorder.
                 size_t reorder_index = mkldnn_emitter->reserve_primitive_space(3);
                 auto& deps = mkldnn_emitter->get_primitive_deps(reorder_index);
+                external_function->add_mkldnn_primitive_builder(
+                    [&, input_desc, result_desc, reorder_index](CPURuntimeContext* ctx) {
+                        mkldnn_emitter->build_reorder(ctx->mkldnn_primitives,
+                                                      input_desc,
+                                                      result_desc,
+                                                      deps,
+                                                      reorder_index);
+                    });
+
                 auto functor =
                     [&, input_desc, result_desc, reorder_index, arg_buffer_index, out_buffer_index](
                         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_reorder(ctx->mkldnn_primitives,
-                                                          input_desc,
-                                                          result_desc,
-                                                          deps,
-                                                          reorder_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
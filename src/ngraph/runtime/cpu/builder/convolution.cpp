@@ -58,6 +58,17 @@ namespace ngraph
                     size_t conv_index = mkldnn_emitter->convolution_forward_init();
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, conv_desc, conv_attr, conv_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_convolution_forward<false>(
+                                ctx->mkldnn_primitives,
+                                conv_desc,
+                                conv_attr,
+                                executor::global_cpu_engine,
+                                deps,
+                                conv_index);
+                        });
+
                     auto functor = [&,
                                     conv_desc,
                                     conv_attr,
@@ -66,16 +77,6 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_convolution_forward<false>(
-                                ctx->mkldnn_primitives,
-                                conv_desc,
-                                conv_attr,
-                                executor::global_cpu_engine,
-                                deps,
-                                conv_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -152,6 +153,17 @@ namespace ngraph
                     size_t conv_index = mkldnn_emitter->convolution_forward_init();
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, conv_desc, conv_attr, conv_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_convolution_forward<false>(
+                                ctx->mkldnn_primitives,
+                                conv_desc,
+                                conv_attr,
+                                executor::global_cpu_engine,
+                                deps,
+                                conv_index);
+                        });
+
                     auto functor = [&,
                                     conv_desc,
                                     conv_attr,
@@ -160,16 +172,6 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_convolution_forward<false>(
-                                ctx->mkldnn_primitives,
-                                conv_desc,
-                                conv_attr,
-                                executor::global_cpu_engine,
-                                deps,
-                                conv_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -208,6 +210,17 @@ namespace ngraph
                     size_t conv_index = mkldnn_emitter->convolution_forward_init(true);
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, conv_desc, conv_attr, conv_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_convolution_forward<true>(
+                                ctx->mkldnn_primitives,
+                                conv_desc,
+                                conv_attr,
+                                executor::global_cpu_engine,
+                                deps,
+                                conv_index);
+                        });
+
                     auto functor = [&,
                                     conv_desc,
                                     conv_attr,
@@ -217,16 +230,6 @@ namespace ngraph
                                     arg2_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_convolution_forward<true>(
-                                ctx->mkldnn_primitives,
-                                conv_desc,
-                                conv_attr,
-                                executor::global_cpu_engine,
-                                deps,
-                                conv_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -269,6 +272,17 @@ namespace ngraph
                     size_t conv_index = mkldnn_emitter->convolution_forward_init(true);
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, conv_desc, conv_attr, conv_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_convolution_forward<true>(
+                                ctx->mkldnn_primitives,
+                                conv_desc,
+                                conv_attr,
+                                executor::global_cpu_engine,
+                                deps,
+                                conv_index);
+                        });
+
                     auto functor = [&,
                                     conv_desc,
                                     conv_attr,
@@ -280,16 +294,6 @@ namespace ngraph
                                     arg3_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_convolution_forward<true>(
-                                ctx->mkldnn_primitives,
-                                conv_desc,
-                                conv_attr,
-                                executor::global_cpu_engine,
-                                deps,
-                                conv_index);
-                        }
                         if (ctx->buffer_data[out_buffer_index] !=
                             ctx->buffer_data[arg3_buffer_index])
                         {
@@ -338,6 +342,17 @@ namespace ngraph
                     size_t conv_index = mkldnn_emitter->convolution_forward_init(false);
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, conv_desc, conv_attr, conv_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_convolution_forward<false>(
+                                ctx->mkldnn_primitives,
+                                conv_desc,
+                                conv_attr,
+                                executor::global_cpu_engine,
+                                deps,
+                                conv_index);
+                        });
+
                     auto functor = [&,
                                     conv_desc,
                                     conv_attr,
@@ -348,16 +363,6 @@ namespace ngraph
                                     arg2_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_convolution_forward<false>(
-                                ctx->mkldnn_primitives,
-                                conv_desc,
-                                conv_attr,
-                                executor::global_cpu_engine,
-                                deps,
-                                conv_index);
-                        }
                         if (ctx->buffer_data[out_buffer_index] !=
                             ctx->buffer_data[arg2_buffer_index])
                         {
@@ -407,6 +412,12 @@ namespace ngraph
                     auto conv_index = mkldnn_emitter->reserve_primitive_space(4);
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, bwd_desc, fwd_desc, conv_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_convolution_backward_data(
+                                ctx->mkldnn_primitives, bwd_desc, fwd_desc, deps, conv_index);
+                        });
+
                     auto functor = [&,
                                     bwd_desc,
                                     fwd_desc,
@@ -415,11 +426,6 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_convolution_backward_data(
-                                ctx->mkldnn_primitives, bwd_desc, fwd_desc, deps, conv_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -507,6 +513,12 @@ namespace ngraph
                     auto conv_index = mkldnn_emitter->reserve_primitive_space(4);
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, bwd_desc, fwd_desc, conv_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_convolution_backward_weights(
+                                ctx->mkldnn_primitives, bwd_desc, fwd_desc, deps, conv_index);
+                        });
+
                     auto functor = [&,
                                     bwd_desc,
                                     fwd_desc,
@@ -515,11 +527,6 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_convolution_backward_weights(
-                                ctx->mkldnn_primitives, bwd_desc, fwd_desc, deps, conv_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -603,6 +610,12 @@ namespace ngraph
                     auto conv_index = mkldnn_emitter->reserve_primitive_space(5);
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, bwd_desc, fwd_desc, conv_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_convolution_backward_weights_bias(
+                                ctx->mkldnn_primitives, bwd_desc, fwd_desc, deps, conv_index);
+                        });
+
                     auto functor = [&,
                                     bwd_desc,
                                     fwd_desc,
@@ -612,11 +625,6 @@ namespace ngraph
                                     out0_buffer_index,
                                     out1_buffer_index](CPURuntimeContext* ctx,
                                                        CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_convolution_backward_weights_bias(
-                                ctx->mkldnn_primitives, bwd_desc, fwd_desc, deps, conv_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -657,6 +665,17 @@ namespace ngraph
                     size_t conv_index = mkldnn_emitter->convolution_forward_init();
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, conv_desc, conv_attr, conv_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_convolution_forward<false>(
+                                ctx->mkldnn_primitives,
+                                conv_desc,
+                                conv_attr,
+                                executor::global_cpu_engine,
+                                deps,
+                                conv_index);
+                        });
+
                     auto functor = [&,
                                     conv_desc,
                                     conv_attr,
@@ -665,16 +684,6 @@ namespace ngraph
                                     arg1_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_convolution_forward<false>(
-                                ctx->mkldnn_primitives,
-                                conv_desc,
-                                conv_attr,
-                                executor::global_cpu_engine,
-                                deps,
-                                conv_index);
-                        }
 
                         // group convolution
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -715,6 +724,17 @@ namespace ngraph
                     size_t conv_index = mkldnn_emitter->convolution_forward_init(true);
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, conv_desc, conv_attr, conv_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_convolution_forward<true>(
+                                ctx->mkldnn_primitives,
+                                conv_desc,
+                                conv_attr,
+                                executor::global_cpu_engine,
+                                deps,
+                                conv_index);
+                        });
+
                     auto functor = [&,
                                     conv_desc,
                                     conv_attr,
@@ -724,16 +744,6 @@ namespace ngraph
                                     arg2_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_convolution_forward<true>(
-                                ctx->mkldnn_primitives,
-                                conv_desc,
-                                conv_attr,
-                                executor::global_cpu_engine,
-                                deps,
-                                conv_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -781,6 +791,15 @@ namespace ngraph
                     auto conv_index = mkldnn_emitter->reserve_primitive_space(5);
                     auto& deps = mkldnn_emitter->get_primitive_deps(conv_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, deconvbias_desc, conv_index, weights_desc](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_deconvolutionbias_forward(ctx->mkldnn_primitives,
+                                                                            deconvbias_desc,
+                                                                            deps,
+                                                                            conv_index,
+                                                                            weights_desc);
+                        });
+
                     auto functor = [&,
                                     deconvbias_desc,
                                     conv_index,
@@ -790,14 +809,6 @@ namespace ngraph
                                     arg2_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_deconvolutionbias_forward(ctx->mkldnn_primitives,
-                                                                            deconvbias_desc,
-                                                                            deps,
-                                                                            conv_index,
-                                                                            weights_desc);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
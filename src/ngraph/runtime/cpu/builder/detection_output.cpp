@@ -0,0 +1,90 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/op/experimental/layers/detection_output.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/detection_output.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DetectionOutput)
+            {
+                auto& functors = external_function->get_functors();
+
+                if (args[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported type in CPU Builder for DetectionOutput");
+                }
+                auto detection_output = static_cast<const ngraph::op::DetectionOutput*>(node);
+                auto attrs = detection_output->get_attrs();
+
+                auto loc_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto conf_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto prior_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto arm_conf_buffer_index =
+                    external_function->get_buffer_index(args[3].get_name());
+                auto arm_loc_buffer_index =
+                    external_function->get_buffer_index(args[4].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto loc_shape = args[0].get_shape();
+                auto prior_shape = args[2].get_shape();
+                auto arm_conf_shape = args[3].get_shape();
+                auto out_shape = out[0].get_shape();
+
+                auto functor = [&,
+                                attrs,
+                                loc_shape,
+                                prior_shape,
+                                arm_conf_shape,
+                                out_shape,
+                                loc_buffer_index,
+                                conf_buffer_index,
+                                prior_buffer_index,
+                                arm_conf_buffer_index,
+                                arm_loc_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    runtime::cpu::kernel::detection_output(
+                        ctx->buffer_data[loc_buffer_index],
+                        ctx->buffer_data[conf_buffer_index],
+                        ctx->buffer_data[prior_buffer_index],
+                        ctx->buffer_data[arm_conf_buffer_index],
+                        ctx->buffer_data[arm_loc_buffer_index],
+                        ctx->buffer_data[out_buffer_index],
+                        loc_shape,
+                        prior_shape,
+                        arm_conf_shape,
+                        out_shape,
+                        attrs,
+                        ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(DetectionOutput);
+        }
+    }
+}
@@ -20,6 +20,8 @@
 #include "ngraph/op/dot.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/cpu_packed_gemm.hpp"
+#include "ngraph/runtime/cpu/cpu_sparse_gemm.hpp"
 #include "ngraph/runtime/cpu/kernel/dot.hpp"
 
 using namespace std;
@@ -196,6 +198,81 @@ namespace ngraph
                     auto lda = arg0_shape[1];
                     auto ldb = arg1_shape[1];
                     const float beta = 0.0f;
+
+                    // A batch by weights only multiplies the rows of the call's batch. The
+                    // sparse and packed operands are built for all the rows, so they are not
+                    // used then.
+                    size_t batch = 0;
+                    if (!external_function->is_batched(node->get_argument(1).get()))
+                    {
+                        batch = external_function->scale_with_batch(node);
+                    }
+
+                    // A mostly zero constant operand only has its nonzeros multiplied
+                    auto sparse_a = batch ? nullptr : CPU_SparseGemmOperand::sparse_constant(
+                                                          node, 0, transpose_A, m, n, k, lda);
+                    auto sparse_b = batch || sparse_a ? nullptr
+                                                      : CPU_SparseGemmOperand::sparse_constant(
+                                                            node, 1, transpose_B, m, n, k, ldb);
+                    if (sparse_a || sparse_b)
+                    {
+                        auto sparse = sparse_a ? sparse_a : sparse_b;
+                        auto other_buffer_index =
+                            sparse_a ? arg1_buffer_index : arg0_buffer_index;
+                        auto ld_other = sparse_a ? ldb : lda;
+                        auto functor = [&,
+                                        sparse,
+                                        ld_other,
+                                        beta,
+                                        result_shape,
+                                        other_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
+                            sparse->multiply(
+                                static_cast<float*>(ctx->buffer_data[other_buffer_index]),
+                                false,
+                                ld_other,
+                                beta,
+                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                                result_shape[1],
+                                ectx->arena);
+                        };
+                        functors.emplace_back(functor);
+                        return;
+                    }
+
+                    // A constant operand is packed once here rather than by every sgemm call
+                    auto packed_a = batch ? nullptr : CPU_PackedGemmOperand::pack_constant(
+                                                          node, 0, transpose_A, m, n, k, lda);
+                    auto packed_b = batch || packed_a ? nullptr
+                                                      : CPU_PackedGemmOperand::pack_constant(
+                                                            node, 1, transpose_B, m, n, k, ldb);
+                    if (packed_a || packed_b)
+                    {
+                        auto packed = packed_a ? packed_a : packed_b;
+                        auto other_buffer_index =
+                            packed_a ? arg1_buffer_index : arg0_buffer_index;
+                        auto ld_other = packed_a ? ldb : lda;
+                        auto functor = [&,
+                                        packed,
+                                        ld_other,
+                                        beta,
+                                        result_shape,
+                                        other_buffer_index,
+                                        out_buffer_index](CPURuntimeContext* ctx,
+                                                          CPUExecutionContext* ectx) {
+                            packed->multiply(
+                                static_cast<float*>(ctx->buffer_data[other_buffer_index]),
+                                false,
+                                ld_other,
+                                beta,
+                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                                result_shape[1]);
+                        };
+                        functors.emplace_back(functor);
+                        return;
+                    }
+
                     auto functor = [&,
                                     transpose_A,
                                     transpose_B,
@@ -205,6 +282,7 @@ namespace ngraph
                                     lda,
                                     ldb,
                                     beta,
+                                    batch,
                                     result_shape,
                                     arg0_buffer_index,
                                     arg1_buffer_index,
@@ -214,7 +292,7 @@ namespace ngraph
                             cblas::Layout::RowMajor,
                             transpose_A ? cblas::Transpose::Transpose : cblas::Transpose::None,
                             transpose_B ? cblas::Transpose::Transpose : cblas::Transpose::None,
-                            m,
+                            batch_elements(ctx, m, batch),
                             n,
                             k,
                             1.0f,
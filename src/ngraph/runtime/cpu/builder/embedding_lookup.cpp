@@ -14,16 +14,115 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstdint>
-#include <cstring>
-
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/embedding_lookup.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_lookup.hpp"
 
 using namespace std;
 using namespace ngraph;
 
+template <typename ElementType>
+static std::function<decltype(
+    runtime::cpu::kernel::embedding_lookup_backprop<ElementType, int>)>
+    get_embedding_backprop_kernel(const element::Type& index_element_type)
+{
+    if (index_element_type == element::i32)
+    {
+        return runtime::cpu::kernel::embedding_lookup_backprop<ElementType, int>;
+    }
+    else if (index_element_type == element::i64)
+    {
+        return runtime::cpu::kernel::embedding_lookup_backprop<ElementType, int64_t>;
+    }
+    else if (index_element_type == element::f32)
+    {
+        return runtime::cpu::kernel::embedding_lookup_backprop<ElementType, float>;
+    }
+    throw ngraph_error("Unsupported index type in CPU Builder for EmbeddingLookupBackprop");
+}
+
+template <typename QuantizedType>
+static std::function<decltype(
+    runtime::cpu::kernel::embedding_lookup_dequantize<QuantizedType, int>)>
+    get_embedding_dequantize_kernel(const element::Type& index_element_type)
+{
+    if (index_element_type == element::i32)
+    {
+        return runtime::cpu::kernel::embedding_lookup_dequantize<QuantizedType, int>;
+    }
+    else if (index_element_type == element::i64)
+    {
+        return runtime::cpu::kernel::embedding_lookup_dequantize<QuantizedType, int64_t>;
+    }
+    else if (index_element_type == element::f32)
+    {
+        return runtime::cpu::kernel::embedding_lookup_dequantize<QuantizedType, float>;
+    }
+    throw ngraph_error("Unsupported index type in CPU Builder for EmbeddingLookup");
+}
+
+// Lookup in a quantized table, which is dequantized row by row as it is gathered
+static void build_embedding_lookup_dequantize(runtime::cpu::CPU_ExternalFunction* external_function,
+                                              const ngraph::Node* node,
+                                              const vector<runtime::cpu::TensorViewWrapper>& args,
+                                              const vector<runtime::cpu::TensorViewWrapper>& out)
+{
+    auto& functors = external_function->get_functors();
+
+    auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+    auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+    auto arg2_buffer_index = external_function->get_buffer_index(args[2].get_name());
+    auto arg3_buffer_index = external_function->get_buffer_index(args[3].get_name());
+    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+    size_t element_count = shape_size(args[0].get_shape());
+    size_t vec_len = args[1].get_shape().at(1);
+    auto index_element_type = args[0].get_element_type();
+    auto weights_element_type = args[1].get_element_type();
+    if (out[0].get_element_type() != element::f32)
+    {
+        throw ngraph_error("Unsupported element type in CPU Builder for quantized " +
+                           node->description());
+    }
+
+    std::function<decltype(runtime::cpu::kernel::embedding_lookup_dequantize<int8_t, int>)>
+        kernel;
+    if (weights_element_type == element::i8)
+    {
+        kernel = get_embedding_dequantize_kernel<int8_t>(index_element_type);
+    }
+    else if (weights_element_type == element::u8)
+    {
+        kernel = get_embedding_dequantize_kernel<uint8_t>(index_element_type);
+    }
+    else
+    {
+        // Eigen::half has the bits of ngraph::float16
+        kernel = get_embedding_dequantize_kernel<Eigen::half>(index_element_type);
+    }
+
+    auto functor = [&,
+                    kernel,
+                    element_count,
+                    vec_len,
+                    arg0_buffer_index,
+                    arg1_buffer_index,
+                    arg2_buffer_index,
+                    arg3_buffer_index,
+                    out_buffer_index](runtime::cpu::CPURuntimeContext* ctx,
+                                      runtime::cpu::CPUExecutionContext* ectx) {
+        kernel(ctx->buffer_data[arg0_buffer_index],
+               ctx->buffer_data[arg1_buffer_index],
+               ctx->buffer_data[arg2_buffer_index],
+               ctx->buffer_data[arg3_buffer_index],
+               ctx->buffer_data[out_buffer_index],
+               element_count,
+               vec_len,
+               ectx->arena);
+    };
+    functors.emplace_back(functor);
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -33,218 +132,112 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::EmbeddingLookup)
             {
+                if (static_cast<const ngraph::op::EmbeddingLookup*>(node)->is_quantized())
+                {
+                    build_embedding_lookup_dequantize(external_function, node, args, out);
+                    return;
+                }
+
                 auto& functors = external_function->get_functors();
 
-                CPUKernelFunctor functor;
                 auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
 
-                if (out[0].get_element_type() != element::f32 &&
-                    out[0].get_element_type() != element::f64)
-                {
-                    throw ngraph_error("Unsupported output element type");
-                }
-                auto in_shape = args[1].get_shape();
+                // Rows are copied as raw bytes, so every table element type shares a kernel
                 size_t element_count = shape_size(args[0].get_shape());
-                auto out_shape = out[0].get_shape();
-                auto element_type = out[0].get_element_type();
+                size_t row_bytes = args[1].get_shape().at(1) * out[0].get_element_type().size();
                 auto index_element_type = args[0].get_element_type();
-                if (element_type == element::f32)
+
+                std::function<decltype(runtime::cpu::kernel::embedding_lookup<int>)> kernel;
+                if (index_element_type == element::i32)
                 {
-                    if (index_element_type == element::f32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<float, float>(
-                                static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<float, int>(
-                                static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<float, int64_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else
-                    {
-                        throw ngraph_error(
-                            "Unsupported index type in CPU Builder for EmbeddingLookup");
-                    }
+                    kernel = runtime::cpu::kernel::embedding_lookup<int>;
                 }
-                else if (element_type == element::f64)
+                else if (index_element_type == element::i64)
                 {
-                    if (index_element_type == element::f32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<double, float>(
-                                static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<double, int>(
-                                static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<double, int64_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else
-                    {
-                        throw ngraph_error(
-                            "Unsupported index type in CPU Builder for EmbeddingLookup");
-                    }
+                    kernel = runtime::cpu::kernel::embedding_lookup<int64_t>;
                 }
-                else if (element_type == element::i32)
+                else if (index_element_type == element::f32)
                 {
-                    if (index_element_type == element::f32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<int, float>(
-                                static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i32)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<int, int>(
-                                static_cast<int*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
-                                element_count,
-                                in_shape);
-                        };
-                    }
-                    else if (index_element_type == element::i64)
-                    {
-                        functor = [&,
-                                   in_shape,
-                                   element_count,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-
-                            ngraph::runtime::reference::embedding<int, int64_t>(
-                                static_cast<int64_t*>(ctx->buffer_data[arg0_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[arg1_buffer_index]),
-                                static_cast<int*>(ctx->buffer_data[out_buffer_index]),
+                    kernel = runtime::cpu::kernel::embedding_lookup<float>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported index type in CPU Builder for EmbeddingLookup");
+                }
+
+                auto functor = [&,
+                                kernel,
                                 element_count,
-                                in_shape);
-                        };
-                    }
-                    else
-                    {
-                        throw ngraph_error(
-                            "Unsupported index type in CPU Builder for EmbeddingLookup");
-                    }
+                                row_bytes,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           element_count,
+                           row_bytes,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::EmbeddingLookupBackprop)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                size_t element_count = shape_size(args[0].get_shape());
+                size_t row_count = out[0].get_shape().at(0);
+                size_t vec_len = out[0].get_shape().at(1);
+                auto index_element_type = args[0].get_element_type();
+
+                std::function<decltype(
+                    runtime::cpu::kernel::embedding_lookup_backprop<float, int>)>
+                    kernel;
+                if (out[0].get_element_type() == element::f32)
+                {
+                    kernel = get_embedding_backprop_kernel<float>(index_element_type);
+                }
+                else if (out[0].get_element_type() == element::f64)
+                {
+                    kernel = get_embedding_backprop_kernel<double>(index_element_type);
                 }
                 else
                 {
-                    throw ngraph_error("Unsupported type in CPU Builder for EmbeddingLookup");
+                    throw ngraph_error(
+                        "Unsupported element type in CPU Builder for EmbeddingLookupBackprop");
                 }
 
+                auto functor = [&,
+                                kernel,
+                                element_count,
+                                row_count,
+                                vec_len,
+                                arg0_buffer_index,
+                                arg1_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[arg1_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           element_count,
+                           row_count,
+                           vec_len,
+                           ectx->arena);
+                };
                 functors.emplace_back(functor);
             }
 
             REGISTER_OP_BUILDER(EmbeddingLookup);
+            REGISTER_OP_BUILDER(EmbeddingLookupBackprop);
         }
     }
 }
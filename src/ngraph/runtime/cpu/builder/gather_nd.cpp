@@ -14,11 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <cstring>
-
 #include "ngraph/op/gather_nd.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/gather_nd.hpp"
+#include "ngraph/runtime/cpu/kernel/gather.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -33,108 +31,46 @@ namespace ngraph
             void Builder::BUILDER_DECL(ngraph::op::GatherND)
             {
                 auto& functors = external_function->get_functors();
-                CPUKernelFunctor functor;
 
                 auto params_buffer_index = external_function->get_buffer_index(args[0].get_name());
                 auto indices_buffer_index = external_function->get_buffer_index(args[1].get_name());
                 auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
-                if (args[1].get_element_type() != element::i64 &&
-                    args[1].get_element_type() != element::i32)
-                {
-                    throw ngraph_error("Unsupported index element type");
-                }
-                bool is_int64 = args[1].get_element_type() == element::i64;
-                auto params_shape = args[0].get_shape();
-                auto indices_shape = args[1].get_shape();
-                auto out_shape = out[0].get_shape();
-                auto element_type = args[0].get_element_type();
-                if (element_type == element::f32)
+
+                std::function<decltype(runtime::cpu::kernel::gather_nd<int64_t>)> kernel;
+                if (args[1].get_element_type() == element::i64)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   params_shape,
-                                   indices_shape,
-                                   out_shape,
-                                   params_buffer_index,
-                                   indices_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::gather_nd<float, int64_t>(
-                                static_cast<float*>(ctx->buffer_data[params_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                params_shape,
-                                indices_shape,
-                                out_shape);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   params_shape,
-                                   indices_shape,
-                                   out_shape,
-                                   params_buffer_index,
-                                   indices_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::gather_nd<float, int32_t>(
-                                static_cast<float*>(ctx->buffer_data[params_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                params_shape,
-                                indices_shape,
-                                out_shape);
-                        };
-                    }
+                    kernel = runtime::cpu::kernel::gather_nd<int64_t>;
                 }
-                else if (element_type == element::f64)
+                else if (args[1].get_element_type() == element::i32)
                 {
-                    if (is_int64)
-                    {
-                        functor = [&,
-                                   params_shape,
-                                   indices_shape,
-                                   out_shape,
-                                   params_buffer_index,
-                                   indices_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::gather_nd<double, int64_t>(
-                                static_cast<double*>(ctx->buffer_data[params_buffer_index]),
-                                static_cast<int64_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                params_shape,
-                                indices_shape,
-                                out_shape);
-                        };
-                    }
-                    else
-                    {
-                        functor = [&,
-                                   params_shape,
-                                   indices_shape,
-                                   out_shape,
-                                   params_buffer_index,
-                                   indices_buffer_index,
-                                   out_buffer_index](CPURuntimeContext* ctx,
-                                                     CPUExecutionContext* ectx) {
-                            ngraph::runtime::reference::gather_nd<double, int32_t>(
-                                static_cast<double*>(ctx->buffer_data[params_buffer_index]),
-                                static_cast<int32_t*>(ctx->buffer_data[indices_buffer_index]),
-                                static_cast<double*>(ctx->buffer_data[out_buffer_index]),
-                                params_shape,
-                                indices_shape,
-                                out_shape);
-                        };
-                    }
+                    kernel = runtime::cpu::kernel::gather_nd<int32_t>;
                 }
                 else
                 {
-                    throw ngraph_error("Unsupported type in CPU Builder for GatherND");
+                    throw ngraph_error("Unsupported index element type");
                 }
+                auto params_shape = args[0].get_shape();
+                auto indices_shape = args[1].get_shape();
+                // Slices are copied as raw bytes, so every element type shares a kernel
+                auto element_size = args[0].get_element_type().size();
 
+                auto functor = [&,
+                                kernel,
+                                params_shape,
+                                indices_shape,
+                                element_size,
+                                params_buffer_index,
+                                indices_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[params_buffer_index],
+                           ctx->buffer_data[indices_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           params_shape,
+                           indices_shape,
+                           element_size,
+                           ectx->arena);
+                };
                 functors.emplace_back(functor);
             }
 
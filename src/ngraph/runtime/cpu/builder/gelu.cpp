@@ -0,0 +1,76 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/op/fused/gelu.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/gelu.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Gelu)
+            {
+                auto gelu = static_cast<const ngraph::op::Gelu*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto element_count = out[0].get_size();
+                auto approximate = gelu->get_approximate();
+
+                std::function<decltype(runtime::cpu::kernel::gelu<float>)> kernel;
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::gelu<float>;
+                }
+                else if (element_type == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::gelu<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       element_type.c_type_string() + " for Gelu");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                arg0_buffer_index,
+                                out0_buffer_index,
+                                element_count,
+                                approximate](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg0_buffer_index],
+                           ctx->buffer_data[out0_buffer_index],
+                           element_count,
+                           approximate,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(Gelu);
+        }
+    }
+}
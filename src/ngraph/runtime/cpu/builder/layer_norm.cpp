@@ -0,0 +1,86 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/op/fused/layer_norm.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/layer_norm.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::LayerNorm)
+            {
+                auto layer_norm = static_cast<const ngraph::op::LayerNorm*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto gamma_buffer_index = external_function->get_buffer_index(args[1].get_name());
+                auto beta_buffer_index = external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto row_size = args[1].get_size();
+                auto rows = row_size == 0 ? 0 : args[0].get_size() / row_size;
+                auto epsilon = layer_norm->get_epsilon();
+
+                std::function<decltype(runtime::cpu::kernel::layer_norm<float>)> kernel;
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::layer_norm<float>;
+                }
+                else if (element_type == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::layer_norm<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       element_type.c_type_string() + " for LayerNorm");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                arg_buffer_index,
+                                gamma_buffer_index,
+                                beta_buffer_index,
+                                out_buffer_index,
+                                rows,
+                                row_size,
+                                epsilon](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[arg_buffer_index],
+                           ctx->buffer_data[gamma_buffer_index],
+                           ctx->buffer_data[beta_buffer_index],
+                           ctx->buffer_data[out_buffer_index],
+                           rows,
+                           row_size,
+                           epsilon,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(LayerNorm);
+        }
+    }
+}
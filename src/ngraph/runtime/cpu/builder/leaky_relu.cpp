@@ -48,17 +48,18 @@ namespace ngraph
                     auto leaky_relu_index = mkldnn_emitter->reserve_primitive_space(3);
                     auto& deps = mkldnn_emitter->get_primitive_deps(leaky_relu_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, leaky_relu_desc, leaky_relu_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_leaky_relu(
+                                ctx->mkldnn_primitives, leaky_relu_desc, deps, leaky_relu_index);
+                        });
+
                     auto functor = [&,
                                     leaky_relu_desc,
                                     leaky_relu_index,
                                     input_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_leaky_relu(
-                                ctx->mkldnn_primitives, leaky_relu_desc, deps, leaky_relu_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[input_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
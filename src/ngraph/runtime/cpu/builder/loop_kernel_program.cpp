@@ -0,0 +1,191 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/loop_kernel.hpp"
+#include "ngraph/runtime/cpu/op/loop_kernel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+#define TI(x) type_index(typeid(x))
+
+// Members of a LoopKernel may reach values of other kernels through GetOutputElements,
+// while the kernel's own inputs may already bypass them
+static const descriptor::Output* get_source_output(const descriptor::Output* output)
+{
+    while (auto goe = dynamic_pointer_cast<ngraph::op::GetOutputElement>(output->get_node()))
+    {
+        output = &goe->get_inputs().at(0).get_output();
+    }
+    return output;
+}
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::runtime::cpu::op::LoopKernel)
+            {
+                using runtime::cpu::kernel::loop_program::Instruction;
+                using runtime::cpu::kernel::loop_program::Opcode;
+
+                static const unordered_map<type_index, Opcode> opcodes{
+                    {TI(ngraph::op::Abs), Opcode::ABS},
+                    {TI(ngraph::op::Add), Opcode::ADD},
+                    {TI(ngraph::op::Divide), Opcode::DIVIDE},
+                    {TI(ngraph::op::Maximum), Opcode::MAXIMUM},
+                    {TI(ngraph::op::Minimum), Opcode::MINIMUM},
+                    {TI(ngraph::op::Multiply), Opcode::MULTIPLY},
+                    {TI(ngraph::op::Negative), Opcode::NEGATIVE},
+                    {TI(ngraph::op::Relu), Opcode::RELU},
+                    {TI(ngraph::op::Subtract), Opcode::SUBTRACT},
+                    {TI(ngraph::op::Sum), Opcode::SUM},
+                    {TI(ngraph::op::Max), Opcode::MAX}};
+
+                auto loop_kernel = static_cast<const ngraph::runtime::cpu::op::LoopKernel*>(node);
+                auto& functors = external_function->get_functors();
+
+                // Compile the member ops to register steps once, at build time
+                runtime::cpu::kernel::loop_program::Program program;
+                unordered_map<const descriptor::Output*, size_t> registers;
+                unordered_map<const Node*, size_t> accumulators;
+                vector<size_t> arg_buffer_indices;
+                for (size_t i = 0; i < args.size(); i++)
+                {
+                    registers.emplace(get_source_output(&node->get_inputs().at(i).get_output()),
+                                      i);
+                    arg_buffer_indices.push_back(
+                        external_function->get_buffer_index(args[i].get_name()));
+                }
+                program.input_count = args.size();
+                program.register_count = args.size();
+                program.loop_size = shape_size(args[0].get_shape());
+                program.reduction_size = loop_kernel->get_reduction_size();
+
+                for (auto& member : loop_kernel->get_node_list())
+                {
+                    const Node& member_node = *member;
+                    auto opcode = opcodes.find(TI(member_node));
+                    if (opcode == opcodes.end())
+                    {
+                        throw ngraph_error("Unsupported op in a LoopKernel: " +
+                                           member->description());
+                    }
+
+                    Instruction instruction;
+                    instruction.opcode = opcode->second;
+                    instruction.arg0 = registers.at(
+                        get_source_output(&member->get_inputs().at(0).get_output()));
+                    instruction.arg1 =
+                        member->get_input_size() > 1
+                            ? registers.at(
+                                  get_source_output(&member->get_inputs().at(1).get_output()))
+                            : instruction.arg0;
+                    if (ngraph::runtime::cpu::op::LoopKernel::is_trailing_reduction(*member))
+                    {
+                        instruction.result = program.accumulator_count++;
+                        accumulators.emplace(member.get(), instruction.result);
+                    }
+                    else
+                    {
+                        instruction.result = program.register_count++;
+                        registers.emplace(&member->get_outputs().at(0), instruction.result);
+                    }
+                    program.instructions.push_back(instruction);
+                }
+
+                vector<size_t> out_buffer_indices;
+                auto& kernel_outputs = loop_kernel->get_kernel_outputs();
+                for (size_t i = 0; i < out.size(); i++)
+                {
+                    out_buffer_indices.push_back(
+                        external_function->get_buffer_index(out[i].get_name()));
+                    auto& kernel_output = kernel_outputs.at(i);
+                    if (accumulators.count(kernel_output.get()))
+                    {
+                        program.accumulator_outputs.emplace_back(
+                            accumulators.at(kernel_output.get()), i);
+                    }
+                    else
+                    {
+                        program.register_outputs.emplace_back(
+                            registers.at(&kernel_output->get_outputs().at(0)), i);
+                    }
+                }
+
+                std::function<decltype(runtime::cpu::kernel::loop_kernel<float>)> kernel;
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::loop_kernel<float>;
+                }
+                else if (element_type == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::loop_kernel<double>;
+                }
+                else if (element_type == element::i32)
+                {
+                    kernel = runtime::cpu::kernel::loop_kernel<int32_t>;
+                }
+                else if (element_type == element::i64)
+                {
+                    kernel = runtime::cpu::kernel::loop_kernel<int64_t>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " + element_type.c_type_string() +
+                                       " for a LoopKernel");
+                }
+
+                auto functor = [&, kernel, program, arg_buffer_indices, out_buffer_indices](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    vector<void*> inputs;
+                    for (auto index : arg_buffer_indices)
+                    {
+                        inputs.push_back(ctx->buffer_data[index]);
+                    }
+                    vector<void*> outputs;
+                    for (auto index : out_buffer_indices)
+                    {
+                        outputs.push_back(ctx->buffer_data[index]);
+                    }
+                    kernel(program, inputs, outputs, ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+        }
+    }
+}
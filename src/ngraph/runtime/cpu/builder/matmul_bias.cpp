@@ -18,6 +18,8 @@
 #include "ngraph/op/experimental/batch_mat_mul.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/cpu_packed_gemm.hpp"
+#include "ngraph/runtime/cpu/cpu_sparse_gemm.hpp"
 #include "ngraph/runtime/cpu/op/batch_mat_mul_transpose.hpp"
 
 using namespace std;
@@ -67,36 +69,134 @@ namespace ngraph
 
                 const float beta = 0.0f;
 
-                auto mm_functor = [&,
-                                   transpose_A,
-                                   transpose_B,
-                                   m,
-                                   n,
-                                   k,
-                                   lda,
-                                   ldb,
-                                   beta,
-                                   arg2_shape,
-                                   arg0_buffer_index,
-                                   arg1_buffer_index,
-                                   out0_buffer_index](CPURuntimeContext* ctx,
-                                                      CPUExecutionContext* ectx) {
-                    cblas::cblas_sgemm(
-                        cblas::Layout::RowMajor,
-                        transpose_A ? cblas::Transpose::Transpose : cblas::Transpose::None,
-                        transpose_B ? cblas::Transpose::Transpose : cblas::Transpose::None,
-                        m,
-                        n,
-                        k,
-                        1.0f,
-                        static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
-                        max<size_t>(1, lda),
-                        static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
-                        max<size_t>(1, ldb),
-                        beta,
-                        static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
-                        max<size_t>(1, arg2_shape[1]));
-                };
+                // A batch by weights and bias only multiplies the rows of the call's batch,
+                // without the sparse and packed operands built for all the rows
+                size_t batch = 0;
+                bool batched_weights = false;
+                for (size_t i = 1; i < node->get_input_size(); i++)
+                {
+                    batched_weights = batched_weights ||
+                                      external_function->is_batched(node->get_argument(i).get());
+                }
+                if (!transpose_A && !batched_weights)
+                {
+                    batch = external_function->scale_with_batch(node);
+                }
+
+                // Mostly zero constant weights only have their nonzeros multiplied, other
+                // constant weights are packed once here rather than by every sgemm call
+                CPUKernelFunctor mm_functor;
+                auto sparse_a = batch ? nullptr : CPU_SparseGemmOperand::sparse_constant(
+                                                      node, 0, transpose_A, m, n, k, lda);
+                auto sparse_b = batch || sparse_a ? nullptr
+                                                  : CPU_SparseGemmOperand::sparse_constant(
+                                                        node, 1, transpose_B, m, n, k, ldb);
+                bool unpacked = batch || sparse_a || sparse_b;
+                auto packed_a = unpacked ? nullptr : CPU_PackedGemmOperand::pack_constant(
+                                                         node, 0, transpose_A, m, n, k, lda);
+                auto packed_b = unpacked || packed_a ? nullptr
+                                                     : CPU_PackedGemmOperand::pack_constant(
+                                                           node, 1, transpose_B, m, n, k, ldb);
+                if (sparse_a)
+                {
+                    mm_functor = [&,
+                                  sparse_a,
+                                  transpose_B,
+                                  ldb,
+                                  beta,
+                                  arg2_shape,
+                                  arg1_buffer_index,
+                                  out0_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                        auto other = static_cast<float*>(ctx->buffer_data[arg1_buffer_index]);
+                        auto out = static_cast<float*>(ctx->buffer_data[out0_buffer_index]);
+                        sparse_a->multiply(
+                            other, transpose_B, ldb, beta, out, arg2_shape[1], ectx->arena);
+                    };
+                }
+                else if (sparse_b)
+                {
+                    mm_functor = [&,
+                                  sparse_b,
+                                  transpose_A,
+                                  lda,
+                                  beta,
+                                  arg2_shape,
+                                  arg0_buffer_index,
+                                  out0_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                        auto other = static_cast<float*>(ctx->buffer_data[arg0_buffer_index]);
+                        auto out = static_cast<float*>(ctx->buffer_data[out0_buffer_index]);
+                        sparse_b->multiply(
+                            other, transpose_A, lda, beta, out, arg2_shape[1], ectx->arena);
+                    };
+                }
+                else if (packed_a)
+                {
+                    mm_functor = [&,
+                                  packed_a,
+                                  transpose_B,
+                                  ldb,
+                                  beta,
+                                  arg2_shape,
+                                  arg1_buffer_index,
+                                  out0_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                        auto other = static_cast<float*>(ctx->buffer_data[arg1_buffer_index]);
+                        auto out = static_cast<float*>(ctx->buffer_data[out0_buffer_index]);
+                        packed_a->multiply(other, transpose_B, ldb, beta, out, arg2_shape[1]);
+                    };
+                }
+                else if (packed_b)
+                {
+                    mm_functor = [&,
+                                  packed_b,
+                                  transpose_A,
+                                  lda,
+                                  beta,
+                                  arg2_shape,
+                                  arg0_buffer_index,
+                                  out0_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                        auto other = static_cast<float*>(ctx->buffer_data[arg0_buffer_index]);
+                        auto out = static_cast<float*>(ctx->buffer_data[out0_buffer_index]);
+                        packed_b->multiply(other, transpose_A, lda, beta, out, arg2_shape[1]);
+                    };
+                }
+                else
+                {
+                    mm_functor = [&,
+                                  transpose_A,
+                                  transpose_B,
+                                  m,
+                                  n,
+                                  k,
+                                  lda,
+                                  ldb,
+                                  beta,
+                                  batch,
+                                  arg2_shape,
+                                  arg0_buffer_index,
+                                  arg1_buffer_index,
+                                  out0_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                        cblas::cblas_sgemm(
+                            cblas::Layout::RowMajor,
+                            transpose_A ? cblas::Transpose::Transpose : cblas::Transpose::None,
+                            transpose_B ? cblas::Transpose::Transpose : cblas::Transpose::None,
+                            batch_elements(ctx, m, batch),
+                            n,
+                            k,
+                            1.0f,
+                            static_cast<float*>(ctx->buffer_data[arg0_buffer_index]),
+                            max<size_t>(1, lda),
+                            static_cast<float*>(ctx->buffer_data[arg1_buffer_index]),
+                            max<size_t>(1, ldb),
+                            beta,
+                            static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                            max<size_t>(1, arg2_shape[1]));
+                    };
+                }
 
                 CPUKernelFunctor bias_functor = [](CPURuntimeContext* ctx,
                                                    CPUExecutionContext* ectx) {};
@@ -112,81 +212,93 @@ namespace ngraph
                         if (*(axes.begin()) == 0)
                         {
                             vector<float> ones_row(arg2_shape[0], 1.0f);
-                            bias_functor =
-                                [&, ones_row, arg2_shape, arg2_buffer_index, out0_buffer_index](
-                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                    cblas::cblas_sgemm(
-                                        cblas::Layout::RowMajor,
-                                        cblas::Transpose::None,
-                                        cblas::Transpose::None,
-                                        arg2_shape[0],
-                                        arg2_shape[1],
-                                        1,
-                                        1.0f,
-                                        ones_row.data(),
-                                        1UL,
-                                        static_cast<float*>(ctx->buffer_data[arg2_buffer_index]),
-                                        max<size_t>(1, arg2_shape[1]),
-                                        1.0f,
-                                        static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
-                                        max<size_t>(1, arg2_shape[1]));
-                                };
+                            bias_functor = [&,
+                                            ones_row,
+                                            batch,
+                                            arg2_shape,
+                                            arg2_buffer_index,
+                                            out0_buffer_index](CPURuntimeContext* ctx,
+                                                               CPUExecutionContext* ectx) {
+                                cblas::cblas_sgemm(
+                                    cblas::Layout::RowMajor,
+                                    cblas::Transpose::None,
+                                    cblas::Transpose::None,
+                                    batch_elements(ctx, arg2_shape[0], batch),
+                                    arg2_shape[1],
+                                    1,
+                                    1.0f,
+                                    ones_row.data(),
+                                    1UL,
+                                    static_cast<float*>(ctx->buffer_data[arg2_buffer_index]),
+                                    max<size_t>(1, arg2_shape[1]),
+                                    1.0f,
+                                    static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                                    max<size_t>(1, arg2_shape[1]));
+                            };
                         }
                         else
                         {
                             vector<float> ones_col(arg2_shape[1], 1.0f);
-                            bias_functor =
-                                [&, ones_col, arg2_shape, arg2_buffer_index, out0_buffer_index](
-                                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                    cblas::cblas_sgemm(
-                                        cblas::Layout::RowMajor,
-                                        cblas::Transpose::None,
-                                        cblas::Transpose::None,
-                                        arg2_shape[0],
-                                        arg2_shape[1],
-                                        1,
-                                        1.0f,
-                                        static_cast<float*>(ctx->buffer_data[arg2_buffer_index]),
-                                        1UL,
-                                        ones_col.data(),
-                                        max<size_t>(1, arg2_shape[1]),
-                                        1.0f,
-                                        static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
-                                        max<size_t>(1, arg2_shape[1]));
-                                };
-                        }
-                    }
-                    else
-                    {
-                        if (axes.size() != 2)
-                        {
-                            throw ngraph_error("unexpected broadcast rank");
-                        }
-
-                        vector<float> ones_scalar(arg2_shape[0], 1.0f);
-
-                        bias_functor =
-                            [&, ones_scalar, arg2_shape, arg2_buffer_index, out0_buffer_index](
-                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                                vector<float> bias(
-                                    arg2_shape[1],
-                                    *static_cast<float*>(ctx->buffer_data[arg2_buffer_index]));
+                            bias_functor = [&,
+                                            ones_col,
+                                            batch,
+                                            arg2_shape,
+                                            arg2_buffer_index,
+                                            out0_buffer_index](CPURuntimeContext* ctx,
+                                                               CPUExecutionContext* ectx) {
                                 cblas::cblas_sgemm(
                                     cblas::Layout::RowMajor,
                                     cblas::Transpose::None,
                                     cblas::Transpose::None,
-                                    arg2_shape[0],
+                                    batch_elements(ctx, arg2_shape[0], batch),
                                     arg2_shape[1],
                                     1,
                                     1.0f,
-                                    ones_scalar.data(),
+                                    static_cast<float*>(ctx->buffer_data[arg2_buffer_index]),
                                     1UL,
-                                    bias.data(),
+                                    ones_col.data(),
                                     max<size_t>(1, arg2_shape[1]),
                                     1.0f,
                                     static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
                                     max<size_t>(1, arg2_shape[1]));
                             };
+                        }
+                    }
+                    else
+                    {
+                        if (axes.size() != 2)
+                        {
+                            throw ngraph_error("unexpected broadcast rank");
+                        }
+
+                        vector<float> ones_scalar(arg2_shape[0], 1.0f);
+
+                        bias_functor = [&,
+                                        ones_scalar,
+                                        batch,
+                                        arg2_shape,
+                                        arg2_buffer_index,
+                                        out0_buffer_index](CPURuntimeContext* ctx,
+                                                           CPUExecutionContext* ectx) {
+                            vector<float> bias(
+                                arg2_shape[1],
+                                *static_cast<float*>(ctx->buffer_data[arg2_buffer_index]));
+                            cblas::cblas_sgemm(
+                                cblas::Layout::RowMajor,
+                                cblas::Transpose::None,
+                                cblas::Transpose::None,
+                                batch_elements(ctx, arg2_shape[0], batch),
+                                arg2_shape[1],
+                                1,
+                                1.0f,
+                                ones_scalar.data(),
+                                1UL,
+                                bias.data(),
+                                max<size_t>(1, arg2_shape[1]),
+                                1.0f,
+                                static_cast<float*>(ctx->buffer_data[out0_buffer_index]),
+                                max<size_t>(1, arg2_shape[1]));
+                        };
                     }
                 }
 
@@ -58,14 +58,15 @@ namespace ngraph
                     size_t max_pool_index = mkldnn_emitter->reserve_primitive_space(3);
                     auto& deps = mkldnn_emitter->get_primitive_deps(max_pool_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, max_pool_desc, max_pool_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_pooling_forward(
+                                ctx->mkldnn_primitives, max_pool_desc, deps, max_pool_index);
+                        });
+
                     auto functor =
                         [&, max_pool_desc, max_pool_index, arg0_buffer_index, out_buffer_index](
                             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            if (ctx->first_iteration)
-                            {
-                                mkldnn_emitter->build_pooling_forward(
-                                    ctx->mkldnn_primitives, max_pool_desc, deps, max_pool_index);
-                            }
                             cpu::mkldnn_utils::set_memory_ptr(
                                 ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                             cpu::mkldnn_utils::set_memory_ptr(
@@ -254,6 +255,12 @@ namespace ngraph
                 size_t max_pool_index = mkldnn_emitter->reserve_primitive_space(4);
                 auto& deps = mkldnn_emitter->get_primitive_deps(max_pool_index);
 
+                external_function->add_mkldnn_primitive_builder(
+                    [&, max_pool_desc, max_pool_index](CPURuntimeContext* ctx) {
+                        mkldnn_emitter->build_max_pooling_with_indices_forward(
+                            ctx->mkldnn_primitives, max_pool_desc, deps, max_pool_index);
+                    });
+
                 auto functor = [&,
                                 max_pool_desc,
                                 max_pool_index,
@@ -261,11 +268,6 @@ namespace ngraph
                                 out0_buffer_index,
                                 out1_buffer_index](CPURuntimeContext* ctx,
                                                    CPUExecutionContext* ectx) {
-                    if (ctx->first_iteration)
-                    {
-                        mkldnn_emitter->build_max_pooling_with_indices_forward(
-                            ctx->mkldnn_primitives, max_pool_desc, deps, max_pool_index);
-                    }
                     cpu::mkldnn_utils::set_memory_ptr(
                         ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                     cpu::mkldnn_utils::set_memory_ptr(
@@ -305,6 +307,16 @@ namespace ngraph
                 size_t max_pool_index = mkldnn_emitter->reserve_primitive_space(4);
                 auto& deps = mkldnn_emitter->get_primitive_deps(max_pool_index);
 
+                external_function->add_mkldnn_primitive_builder(
+                    [&, bwd_pool_desc, fwd_pool_desc, max_pool_index](CPURuntimeContext* ctx) {
+                        mkldnn_emitter->build_max_pooling_with_indices_backward(
+                            ctx->mkldnn_primitives,
+                            bwd_pool_desc,
+                            fwd_pool_desc,
+                            deps,
+                            max_pool_index);
+                    });
+
                 auto functor = [&,
                                 bwd_pool_desc,
                                 fwd_pool_desc,
@@ -313,15 +325,6 @@ namespace ngraph
                                 arg2_buffer_index,
                                 out_buffer_index](CPURuntimeContext* ctx,
                                                   CPUExecutionContext* ectx) {
-                    if (ctx->first_iteration)
-                    {
-                        mkldnn_emitter->build_max_pooling_with_indices_backward(
-                            ctx->mkldnn_primitives,
-                            bwd_pool_desc,
-                            fwd_pool_desc,
-                            deps,
-                            max_pool_index);
-                    }
                     cpu::mkldnn_utils::set_memory_ptr(
                         ctx, deps[0], ctx->buffer_data[arg1_buffer_index]);
                     cpu::mkldnn_utils::set_memory_ptr(
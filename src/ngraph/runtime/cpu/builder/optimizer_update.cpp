@@ -0,0 +1,306 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/op/fused/adam_update.hpp"
+#include "ngraph/op/fused/all_finite.hpp"
+#include "ngraph/op/fused/sgd_momentum_update.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/optimizer_update.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Buffer indices of the tensors of one parameter, in input then output order
+            static vector<size_t> get_group_buffer_indices(CPU_ExternalFunction* external_function,
+                                                           const vector<TensorViewWrapper>& args,
+                                                           const vector<TensorViewWrapper>& out,
+                                                           size_t first,
+                                                           size_t i,
+                                                           size_t n)
+            {
+                vector<size_t> indices;
+                for (size_t input = first + i; input < args.size(); input += n)
+                {
+                    indices.push_back(external_function->get_buffer_index(args[input].get_name()));
+                }
+                for (size_t output = i; output < out.size(); output += n)
+                {
+                    indices.push_back(external_function->get_buffer_index(out[output].get_name()));
+                }
+                return indices;
+            }
+
+            // A skipped update forwards the parameter and each state tensor of the group to
+            // the output that replaces it
+            static void forward_group(CPURuntimeContext* ctx,
+                                      const vector<size_t>& group,
+                                      size_t size_in_bytes)
+            {
+                // The inputs are the parameter, its gradient and its state tensors, so there is
+                // one more input than outputs
+                size_t outputs = (group.size() - 1) / 2;
+                size_t inputs = group.size() - outputs;
+                for (size_t k = 0; k < outputs; k++)
+                {
+                    void* input = ctx->buffer_data[group[k == 0 ? 0 : k + 1]];
+                    void* output = ctx->buffer_data[group[inputs + k]];
+                    if (input != output)
+                    {
+                        memcpy(output, input, size_in_bytes);
+                    }
+                }
+            }
+
+            template <typename ElementType>
+            static void build_sgd_momentum_update(CPU_ExternalFunction* external_function,
+                                                  const ngraph::op::SgdMomentumUpdate* update,
+                                                  const vector<TensorViewWrapper>& args,
+                                                  const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                size_t n = update->get_group_size();
+                auto learning_rate_index = external_function->get_buffer_index(args[0].get_name());
+                bool loss_scaled = update->is_loss_scaled();
+                auto loss_scale_index =
+                    loss_scaled ? external_function->get_buffer_index(args[1].get_name()) : 0;
+                auto finite_index =
+                    loss_scaled ? external_function->get_buffer_index(args[2].get_name()) : 0;
+                auto momentum = static_cast<ElementType>(update->get_momentum());
+
+                vector<vector<size_t>> groups;
+                vector<size_t> counts;
+                size_t first = update->get_first_group_input();
+                for (size_t i = 0; i < n; i++)
+                {
+                    groups.push_back(
+                        get_group_buffer_indices(external_function, args, out, first, i, n));
+                    counts.push_back(args[first + i].get_size());
+                }
+
+                // All parameters of the group are updated by the one functor
+                auto functor = [&,
+                                groups,
+                                counts,
+                                learning_rate_index,
+                                loss_scaled,
+                                loss_scale_index,
+                                finite_index,
+                                momentum](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    auto learning_rate =
+                        *static_cast<ElementType*>(ctx->buffer_data[learning_rate_index]);
+                    auto gradient_scale = ElementType(1);
+                    if (loss_scaled)
+                    {
+                        // Skip the whole update when a gradient overflowed
+                        if (!*static_cast<char*>(ctx->buffer_data[finite_index]))
+                        {
+                            for (size_t i = 0; i < groups.size(); i++)
+                            {
+                                forward_group(ctx, groups[i], counts[i] * sizeof(ElementType));
+                            }
+                            return;
+                        }
+                        auto loss_scale =
+                            *static_cast<ElementType*>(ctx->buffer_data[loss_scale_index]);
+                        gradient_scale = ElementType(1) / loss_scale;
+                    }
+                    for (size_t i = 0; i < groups.size(); i++)
+                    {
+                        const vector<size_t>& group = groups[i];
+                        runtime::cpu::kernel::sgd_momentum_update<ElementType>(
+                            ctx->buffer_data[group[0]],
+                            ctx->buffer_data[group[1]],
+                            ctx->buffer_data[group[2]],
+                            ctx->buffer_data[group[3]],
+                            ctx->buffer_data[group[4]],
+                            learning_rate,
+                            momentum,
+                            gradient_scale,
+                            counts[i],
+                            ectx->arena);
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <typename ElementType>
+            static void build_adam_update(CPU_ExternalFunction* external_function,
+                                          const ngraph::op::AdamUpdate* update,
+                                          const vector<TensorViewWrapper>& args,
+                                          const vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                size_t n = update->get_group_size();
+                auto learning_rate_index = external_function->get_buffer_index(args[0].get_name());
+                bool loss_scaled = update->is_loss_scaled();
+                auto loss_scale_index =
+                    loss_scaled ? external_function->get_buffer_index(args[1].get_name()) : 0;
+                auto finite_index =
+                    loss_scaled ? external_function->get_buffer_index(args[2].get_name()) : 0;
+                auto beta1 = static_cast<ElementType>(update->get_beta1());
+                auto beta2 = static_cast<ElementType>(update->get_beta2());
+                auto epsilon = static_cast<ElementType>(update->get_epsilon());
+
+                vector<vector<size_t>> groups;
+                vector<size_t> counts;
+                size_t first = update->get_first_group_input();
+                for (size_t i = 0; i < n; i++)
+                {
+                    groups.push_back(
+                        get_group_buffer_indices(external_function, args, out, first, i, n));
+                    counts.push_back(args[first + i].get_size());
+                }
+
+                // All parameters of the group are updated by the one functor
+                auto functor = [&,
+                                groups,
+                                counts,
+                                learning_rate_index,
+                                loss_scaled,
+                                loss_scale_index,
+                                finite_index,
+                                beta1,
+                                beta2,
+                                epsilon](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    auto learning_rate =
+                        *static_cast<ElementType*>(ctx->buffer_data[learning_rate_index]);
+                    auto gradient_scale = ElementType(1);
+                    if (loss_scaled)
+                    {
+                        // Skip the whole update when a gradient overflowed
+                        if (!*static_cast<char*>(ctx->buffer_data[finite_index]))
+                        {
+                            for (size_t i = 0; i < groups.size(); i++)
+                            {
+                                forward_group(ctx, groups[i], counts[i] * sizeof(ElementType));
+                            }
+                            return;
+                        }
+                        auto loss_scale =
+                            *static_cast<ElementType*>(ctx->buffer_data[loss_scale_index]);
+                        gradient_scale = ElementType(1) / loss_scale;
+                    }
+                    for (size_t i = 0; i < groups.size(); i++)
+                    {
+                        const vector<size_t>& group = groups[i];
+                        runtime::cpu::kernel::adam_update<ElementType>(
+                            ctx->buffer_data[group[0]],
+                            ctx->buffer_data[group[1]],
+                            ctx->buffer_data[group[2]],
+                            ctx->buffer_data[group[3]],
+                            ctx->buffer_data[group[4]],
+                            ctx->buffer_data[group[5]],
+                            ctx->buffer_data[group[6]],
+                            learning_rate,
+                            beta1,
+                            beta2,
+                            epsilon,
+                            gradient_scale,
+                            counts[i],
+                            ectx->arena);
+                    }
+                };
+                functors.emplace_back(functor);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::SgdMomentumUpdate)
+            {
+                auto update = static_cast<const ngraph::op::SgdMomentumUpdate*>(node);
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    build_sgd_momentum_update<float>(external_function, update, args, out);
+                }
+                else if (element_type == element::f64)
+                {
+                    build_sgd_momentum_update<double>(external_function, update, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       element_type.c_type_string() + " for SgdMomentumUpdate");
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AdamUpdate)
+            {
+                auto update = static_cast<const ngraph::op::AdamUpdate*>(node);
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    build_adam_update<float>(external_function, update, args, out);
+                }
+                else if (element_type == element::f64)
+                {
+                    build_adam_update<double>(external_function, update, args, out);
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       element_type.c_type_string() + " for AdamUpdate");
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::AllFinite)
+            {
+                auto& functors = external_function->get_functors();
+                vector<size_t> input_indices;
+                vector<size_t> counts;
+                vector<bool> is_f64;
+                for (auto& arg : args)
+                {
+                    input_indices.push_back(external_function->get_buffer_index(arg.get_name()));
+                    counts.push_back(arg.get_size());
+                    is_f64.push_back(arg.get_element_type() == element::f64);
+                }
+                auto out_index = external_function->get_buffer_index(out[0].get_name());
+
+                // All inputs are checked by the one functor, which stops at the first tensor
+                // that is not finite
+                auto functor = [&, input_indices, counts, is_f64, out_index](
+                    CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    bool finite = true;
+                    for (size_t i = 0; i < input_indices.size() && finite; i++)
+                    {
+                        void* input = ctx->buffer_data[input_indices[i]];
+                        finite = is_f64[i]
+                                     ? runtime::cpu::kernel::all_finite<double>(
+                                           input, counts[i], ectx->arena)
+                                     : runtime::cpu::kernel::all_finite<float>(
+                                           input, counts[i], ectx->arena);
+                    }
+                    *static_cast<char*>(ctx->buffer_data[out_index]) = finite;
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(SgdMomentumUpdate);
+            REGISTER_OP_BUILDER(AdamUpdate);
+            REGISTER_OP_BUILDER(AllFinite);
+        }
+    }
+}
@@ -50,12 +50,13 @@ namespace ngraph
                 auto padding_above = pad->get_padding_above();
                 auto pad_mode = pad->get_pad_mode();
 
-                if (pad_mode == ngraph::op::PadMode::CONSTANT)
+                if (pad_mode == ngraph::op::PadMode::CONSTANT &&
+                    arg_shape.size() <= MAX_EIGEN_KERNEL_RANK)
                 {
                     std::function<decltype(runtime::cpu::kernel::pad_and_slice<float, 1>)> kernel;
 
                     SELECT_KERNEL_BY_RANK(kernel,
-                                          args[0].get_element_type(),
+                                          storage_element_type(args[0].get_element_type()),
                                           arg_shape.size(),
                                           runtime::cpu::kernel::pad_and_slice);
 
@@ -84,8 +85,9 @@ namespace ngraph
                 {
                     std::function<decltype(runtime::cpu::kernel::pad_ref<float>)> kernel;
 
-                    SELECT_KERNEL(
-                        kernel, args[0].get_element_type(), runtime::cpu::kernel::pad_ref);
+                    SELECT_KERNEL(kernel,
+                                  storage_element_type(args[0].get_element_type()),
+                                  runtime::cpu::kernel::pad_ref);
 
                     auto functor = [&,
                                     kernel,
@@ -125,12 +127,13 @@ namespace ngraph
                 auto padding_above = pad->get_padding_above();
                 auto pad_mode = pad->get_pad_mode();
 
-                if (pad_mode == ngraph::op::PadMode::CONSTANT)
+                if (pad_mode == ngraph::op::PadMode::CONSTANT &&
+                    arg_shape.size() <= MAX_EIGEN_KERNEL_RANK)
                 {
                     std::function<decltype(runtime::cpu::kernel::pad_and_slice<float, 1>)> kernel;
 
                     SELECT_KERNEL_BY_RANK(kernel,
-                                          pad->get_input_element_type(0),
+                                          storage_element_type(pad->get_input_element_type(0)),
                                           arg_shape.size(),
                                           runtime::cpu::kernel::pad_and_slice);
 
@@ -151,8 +154,9 @@ namespace ngraph
                 {
                     std::function<decltype(runtime::cpu::kernel::pad_ref<float>)> kernel;
 
-                    SELECT_KERNEL(
-                        kernel, pad->get_input_element_type(0), runtime::cpu::kernel::pad_ref);
+                    SELECT_KERNEL(kernel,
+                                  storage_element_type(pad->get_input_element_type(0)),
+                                  runtime::cpu::kernel::pad_ref);
 
                     auto functor =
                         [kernel, arg_shape, out_shape, padding_below, padding_above, pad_mode](
@@ -18,6 +18,7 @@
 
 #include "ngraph/op/product.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_deterministic.hpp"
 #include "ngraph/runtime/cpu/kernel/reduce_product.hpp"
 
 #include "reduction.hpp"
@@ -34,6 +35,7 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Product)
             {
+                BUILD_DETERMINISTIC_REDUCTION_FUNCTOR(Product, product, kernel::ProductReducer);
                 BUILD_REDUCTION_FUNCTOR(Product, product);
             }
 
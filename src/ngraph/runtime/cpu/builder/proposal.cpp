@@ -0,0 +1,105 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/op/experimental/layers/proposal.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/proposal.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Proposal)
+            {
+                auto& functors = external_function->get_functors();
+
+                if (args[0].get_element_type() != element::f32)
+                {
+                    throw ngraph_error("Unsupported type in CPU Builder for Proposal");
+                }
+                auto proposal = static_cast<const ngraph::op::Proposal*>(node);
+
+                runtime::cpu::kernel::ProposalParams params;
+                params.pre_nms_topn = proposal->get_pre_nms_topn();
+                params.post_nms_topn = proposal->get_post_nms_topn();
+                params.nms_threshold = proposal->get_nms_threshold();
+                params.feature_stride = proposal->get_feature_stride();
+                params.min_size = proposal->get_min_size();
+                params.clip_before_nms = proposal->get_clip_before_nms();
+                params.clip_after_nms = proposal->get_clip_after_nms();
+                params.normalize = proposal->get_normalize();
+                params.box_size_scale = proposal->get_box_size_scale();
+                params.box_coord_scale = proposal->get_box_coord_scale();
+                params.offset = proposal->get_algo() == "tensorflow" ? 0.0f : 1.0f;
+                params.anchors =
+                    runtime::cpu::kernel::proposal_anchors(proposal->get_base_size(),
+                                                           proposal->get_anchor_ratios(),
+                                                           proposal->get_anchor_scales(),
+                                                           params.offset);
+
+                auto class_probs_shape = args[0].get_shape();
+                auto anchor_count = params.anchors.size() / 4;
+                if (class_probs_shape.size() != 4 || class_probs_shape[1] != 2 * anchor_count ||
+                    args[1].get_shape() != Shape{class_probs_shape[0],
+                                                 4 * anchor_count,
+                                                 class_probs_shape[2],
+                                                 class_probs_shape[3]} ||
+                    out[0].get_shape() !=
+                        Shape{class_probs_shape[0] * params.post_nms_topn, 5})
+                {
+                    throw ngraph_error(
+                        "Proposal inputs and output do not match the anchors and post_nms_topn "
+                        "in CPU Builder for Proposal");
+                }
+
+                auto class_probs_buffer_index =
+                    external_function->get_buffer_index(args[0].get_name());
+                auto bbox_deltas_buffer_index =
+                    external_function->get_buffer_index(args[1].get_name());
+                auto image_shape_buffer_index =
+                    external_function->get_buffer_index(args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto functor = [&,
+                                params,
+                                class_probs_shape,
+                                class_probs_buffer_index,
+                                bbox_deltas_buffer_index,
+                                image_shape_buffer_index,
+                                out_buffer_index](CPURuntimeContext* ctx,
+                                                  CPUExecutionContext* ectx) {
+                    runtime::cpu::kernel::proposal(ctx->buffer_data[class_probs_buffer_index],
+                                                   ctx->buffer_data[bbox_deltas_buffer_index],
+                                                   ctx->buffer_data[image_shape_buffer_index],
+                                                   ctx->buffer_data[out_buffer_index],
+                                                   class_probs_shape,
+                                                   params,
+                                                   ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(Proposal);
+        }
+    }
+}
@@ -21,6 +21,7 @@
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/quantization.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
@@ -35,6 +36,47 @@ namespace ngraph
     {
         namespace cpu
         {
+            using DequantizeKernel =
+                std::function<decltype(runtime::cpu::kernel::dequantize<int8_t, float>)>;
+            using QuantizeKernel =
+                std::function<decltype(runtime::cpu::kernel::quantize<float, int8_t>)>;
+
+            template <typename REAL>
+            static DequantizeKernel select_dequantize_kernel(const element::Type& input_type)
+            {
+                if (input_type == element::i8)
+                {
+                    return runtime::cpu::kernel::dequantize<int8_t, REAL>;
+                }
+                else if (input_type == element::u8)
+                {
+                    return runtime::cpu::kernel::dequantize<uint8_t, REAL>;
+                }
+                else if (input_type == element::i32)
+                {
+                    return runtime::cpu::kernel::dequantize<int32_t, REAL>;
+                }
+                throw ngraph_error("Unsupported input element type");
+            }
+
+            template <typename REAL>
+            static QuantizeKernel select_quantize_kernel(const element::Type& output_type)
+            {
+                if (output_type == element::i8)
+                {
+                    return runtime::cpu::kernel::quantize<REAL, int8_t>;
+                }
+                else if (output_type == element::u8)
+                {
+                    return runtime::cpu::kernel::quantize<REAL, uint8_t>;
+                }
+                else if (output_type == element::i32)
+                {
+                    return runtime::cpu::kernel::quantize<REAL, int32_t>;
+                }
+                throw ngraph_error("Unsupported quantization element type");
+            }
+
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Dequantize)
             {
@@ -146,7 +188,38 @@ namespace ngraph
                     auto arg1_shape = args[1].get_shape();
                     auto daxes = dequantize->get_axes();
 
-                    if (args[0].get_element_type() == element::i8)
+                    size_t outer, channels, inner;
+                    if (runtime::cpu::kernel::get_quantization_layout(
+                            arg0_shape, daxes, outer, channels, inner) &&
+                        (out[0].get_element_type() == element::f32 ||
+                         out[0].get_element_type() == element::f64))
+                    {
+                        DequantizeKernel kernel =
+                            out[0].get_element_type() == element::f32
+                                ? select_dequantize_kernel<float>(args[0].get_element_type())
+                                : select_dequantize_kernel<double>(args[0].get_element_type());
+
+                        functor = [&,
+                                   kernel,
+                                   outer,
+                                   channels,
+                                   inner,
+                                   arg0_buffer_index,
+                                   arg1_buffer_index,
+                                   arg2_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg0_buffer_index],
+                                   ctx->buffer_data[arg1_buffer_index],
+                                   ctx->buffer_data[arg2_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   outer,
+                                   channels,
+                                   inner,
+                                   ectx->arena);
+                        };
+                    }
+                    else if (args[0].get_element_type() == element::i8)
                     {
                         if (out[0].get_element_type() == element::f32)
                         {
@@ -375,6 +448,17 @@ namespace ngraph
                         size_t quantize_index = mkldnn_emitter->reserve_primitive_space(3);
                         auto& deps = mkldnn_emitter->get_primitive_deps(quantize_index);
 
+                        external_function->add_mkldnn_primitive_builder(
+                            [&, input_desc, result_desc, scales, quantize_index](
+                                CPURuntimeContext* ctx) {
+                                mkldnn_emitter->build_quantize_reorder(ctx->mkldnn_primitives,
+                                                                       input_desc,
+                                                                       result_desc,
+                                                                       scales,
+                                                                       deps,
+                                                                       quantize_index);
+                            });
+
                         auto functor = [&,
                                         input_desc,
                                         result_desc,
@@ -383,15 +467,6 @@ namespace ngraph
                                         arg0_buffer_index,
                                         out_buffer_index](CPURuntimeContext* ctx,
                                                           CPUExecutionContext* ectx) {
-                            if (ctx->first_iteration)
-                            {
-                                mkldnn_emitter->build_quantize_reorder(ctx->mkldnn_primitives,
-                                                                       input_desc,
-                                                                       result_desc,
-                                                                       scales,
-                                                                       deps,
-                                                                       quantize_index);
-                            }
                             cpu::mkldnn_utils::set_memory_ptr(
                                 ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                             cpu::mkldnn_utils::set_memory_ptr(
@@ -422,7 +497,40 @@ namespace ngraph
                     auto daxes = quantize->get_axes();
                     ngraph::op::Quantize::RoundMode round_mode = quantize->get_round_mode();
 
-                    if (args[0].get_element_type() == element::f32)
+                    size_t outer, channels, inner;
+                    if (runtime::cpu::kernel::get_quantization_layout(
+                            arg0_shape, daxes, outer, channels, inner) &&
+                        (args[0].get_element_type() == element::f32 ||
+                         args[0].get_element_type() == element::f64))
+                    {
+                        QuantizeKernel kernel =
+                            args[0].get_element_type() == element::f32
+                                ? select_quantize_kernel<float>(out[0].get_element_type())
+                                : select_quantize_kernel<double>(out[0].get_element_type());
+
+                        functor = [&,
+                                   kernel,
+                                   outer,
+                                   channels,
+                                   inner,
+                                   round_mode,
+                                   arg0_buffer_index,
+                                   arg1_buffer_index,
+                                   arg2_buffer_index,
+                                   out_buffer_index](CPURuntimeContext* ctx,
+                                                     CPUExecutionContext* ectx) {
+                            kernel(ctx->buffer_data[arg0_buffer_index],
+                                   ctx->buffer_data[arg1_buffer_index],
+                                   ctx->buffer_data[arg2_buffer_index],
+                                   ctx->buffer_data[out_buffer_index],
+                                   outer,
+                                   channels,
+                                   inner,
+                                   round_mode,
+                                   ectx->arena);
+                        };
+                    }
+                    else if (args[0].get_element_type() == element::f32)
                     {
                         if (out[0].get_element_type() == element::i8)
                         {
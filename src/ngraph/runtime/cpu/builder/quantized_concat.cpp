@@ -61,6 +61,15 @@ namespace ngraph
                     auto concat_index = mkldnn_emitter->reserve_primitive_space(nargs + 2);
                     auto& deps = mkldnn_emitter->get_primitive_deps(concat_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, concat_pd, inputs_data_desc, concat_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_concat(ctx->mkldnn_primitives,
+                                                         concat_pd,
+                                                         inputs_data_desc,
+                                                         deps,
+                                                         concat_index);
+                        });
+
                     auto functor = [&,
                                     concat_pd,
                                     inputs_data_desc,
@@ -69,14 +78,6 @@ namespace ngraph
                                     concat_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_concat(ctx->mkldnn_primitives,
-                                                         concat_pd,
-                                                         inputs_data_desc,
-                                                         deps,
-                                                         concat_index);
-                        }
                         for (size_t i = 0; i < nargs; i++)
                         {
                             cpu::mkldnn_utils::set_memory_ptr(
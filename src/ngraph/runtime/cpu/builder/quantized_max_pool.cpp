@@ -47,14 +47,15 @@ namespace ngraph
                     size_t qmax_pool_index = mkldnn_emitter->reserve_primitive_space(3);
                     auto& deps = mkldnn_emitter->get_primitive_deps(qmax_pool_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, qmax_pool_desc, qmax_pool_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_pooling_forward(
+                                ctx->mkldnn_primitives, qmax_pool_desc, deps, qmax_pool_index);
+                        });
+
                     auto functor =
                         [&, qmax_pool_desc, qmax_pool_index, arg_buffer_index, out_buffer_index](
                             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            if (ctx->first_iteration)
-                            {
-                                mkldnn_emitter->build_pooling_forward(
-                                    ctx->mkldnn_primitives, qmax_pool_desc, deps, qmax_pool_index);
-                            }
                             cpu::mkldnn_utils::set_memory_ptr(
                                 ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
                             cpu::mkldnn_utils::set_memory_ptr(
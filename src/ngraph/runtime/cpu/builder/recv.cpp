@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Recv)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto recv = static_cast<const ngraph::op::Recv*>(node);
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = out[0].get_size();
+                auto data_type = out[0].get_element_type().get_type_enum();
+                auto src_rank = recv->get_src_rank();
+                auto tag = recv->get_tag();
+
+                auto request_index =
+                    external_function->add_distributed_request(out[0].get_name());
+
+                // The message lands in the output buffer of the memory plan. Users of the
+                // output wait for the request, see CPU_ExternalFunction::build.
+                auto functor =
+                    [&, count, data_type, src_rank, tag, out_buffer_index, request_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        ctx->distributed_requests[request_index] =
+                            get_distributed_interface()->irecv(ctx->buffer_data[out_buffer_index],
+                                                               data_type,
+                                                               count,
+                                                               src_rank,
+                                                               tag);
+                    };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(Recv);
+        }
+    }
+}
@@ -14,6 +14,77 @@
 // limitations under the License.
 //*****************************************************************************
 
+// Builds Sum and Product of f32 and f64 in an executable compiled with
+// CPU_Executable::DETERMINISTIC_REDUCTIONS_ATTRIBUTE, whose results must not depend on the number
+// of threads. Contiguous reduction axes use kernel::reduce_deterministic with the reducer R,
+// others the sequential reference kernel K. Other executables fall through to the next builder.
+#define BUILD_DETERMINISTIC_REDUCTION_FUNCTOR(OP, K, R)                                            \
+if (external_function->has_deterministic_reductions() &&                                           \
+    (out[0].get_element_type() == element::f32 || out[0].get_element_type() == element::f64) &&    \
+    !static_cast<const ngraph::op::OP*>(node)->get_reduction_axes().empty())                       \
+{                                                                                                  \
+    auto& functors = external_function->get_functors();                                            \
+                                                                                                   \
+    auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());               \
+    auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());                \
+                                                                                                   \
+    auto arg_shape = args[0].get_shape();                                                          \
+    auto result_shape = out[0].get_shape();                                                        \
+    bool is_double = out[0].get_element_type() == element::f64;                                    \
+    auto reduction_axes = static_cast<const ngraph::op::OP*>(node)->get_reduction_axes();          \
+                                                                                                   \
+    size_t first_axis = *reduction_axes.begin();                                                   \
+    size_t last_axis = *reduction_axes.rbegin();                                                   \
+    if (last_axis - first_axis + 1 == reduction_axes.size())                                       \
+    {                                                                                              \
+        size_t outer = 1, reduced = 1, inner = 1;                                                  \
+        for (size_t i = 0; i < arg_shape.size(); i++)                                              \
+        {                                                                                          \
+            (i < first_axis ? outer : i <= last_axis ? reduced : inner) *= arg_shape[i];           \
+        }                                                                                          \
+        std::function<decltype(runtime::cpu::kernel::reduce_deterministic<float, R>)> kernel =     \
+            runtime::cpu::kernel::reduce_deterministic<float, R>;                                  \
+        if (is_double)                                                                             \
+        {                                                                                          \
+            kernel = runtime::cpu::kernel::reduce_deterministic<double, R>;                        \
+        }                                                                                          \
+        auto functor = [&, kernel, outer, reduced, inner, arg_buffer_index, out_buffer_index](     \
+            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
+            kernel(ctx->buffer_data[arg_buffer_index],                                             \
+                   ctx->buffer_data[out_buffer_index],                                             \
+                   outer,                                                                          \
+                   reduced,                                                                        \
+                   inner,                                                                          \
+                   ectx->arena);                                                                   \
+        };                                                                                         \
+        functors.emplace_back(functor);                                                            \
+        return;                                                                                    \
+    }                                                                                              \
+                                                                                                   \
+    std::function<decltype(runtime::cpu::kernel::K<float>)> ref_kernel =                           \
+        runtime::cpu::kernel::K<float>;                                                            \
+    if (is_double)                                                                                 \
+    {                                                                                              \
+        ref_kernel = runtime::cpu::kernel::K<double>;                                              \
+    }                                                                                              \
+    auto functor = [&,                                                                             \
+                    ref_kernel,                                                                    \
+                    arg_shape,                                                                     \
+                    result_shape,                                                                  \
+                    reduction_axes,                                                                \
+                    arg_buffer_index,                                                              \
+                    out_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {         \
+        ref_kernel(ctx->buffer_data[arg_buffer_index],                                             \
+                   ctx->buffer_data[out_buffer_index],                                             \
+                   arg_shape,                                                                      \
+                   result_shape,                                                                   \
+                   reduction_axes,                                                                 \
+                   ectx->arena);                                                                   \
+    };                                                                                             \
+    functors.emplace_back(functor);                                                                \
+    return;                                                                                        \
+}
+
 #define BUILD_REDUCTION_FUNCTOR(OP, K)                                                             \
     auto& functors = external_function->get_functors();                                            \
                                                                                                    \
@@ -41,7 +112,7 @@
         return;                                                                                    \
     }                                                                                              \
                                                                                                    \
-    if (reduction_axes.size() == arg_rank)                                                         \
+    if (reduction_axes.size() == arg_rank && arg_rank <= MAX_EIGEN_KERNEL_RANK)                    \
     {                                                                                              \
         std::function<decltype(runtime::cpu::kernel::reduce_##K##_all<float, 2>)> kernel;          \
         SELECT_KERNEL_BY_RANK(                                                                     \
@@ -58,7 +129,7 @@
         return;                                                                                    \
     }                                                                                              \
                                                                                                    \
-    if (reduction_axes.size() == 1)                                                                \
+    if (reduction_axes.size() == 1 && arg_rank <= MAX_EIGEN_KERNEL_RANK)                           \
     {                                                                                              \
         if (*reduction_axes.begin() == arg_rank - 1)                                               \
         {                                                                                          \
@@ -45,13 +45,14 @@ namespace ngraph
                     size_t relu_index = mkldnn_emitter->reserve_primitive_space(3);
                     auto& deps = mkldnn_emitter->get_primitive_deps(relu_index);
 
-                    auto functor = [&, relu_desc, relu_index, arg_buffer_index, out_buffer_index](
-                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, relu_desc, relu_index](CPURuntimeContext* ctx) {
                             mkldnn_emitter->build_relu_forward(
                                 ctx->mkldnn_primitives, relu_desc, deps, relu_index);
-                        }
+                        });
+
+                    auto functor = [&, relu_desc, relu_index, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -85,6 +86,12 @@ namespace ngraph
                     size_t relu_index = mkldnn_emitter->reserve_primitive_space(4);
                     auto& deps = mkldnn_emitter->get_primitive_deps(relu_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, bwd_desc, fwd_desc, relu_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_relu_backward(
+                                ctx->mkldnn_primitives, bwd_desc, fwd_desc, deps, relu_index);
+                        });
+
                     auto functor = [&,
                                     bwd_desc,
                                     fwd_desc,
@@ -93,11 +100,6 @@ namespace ngraph
                                     delta_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_relu_backward(
-                                ctx->mkldnn_primitives, bwd_desc, fwd_desc, deps, relu_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg_fwd_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -81,30 +81,34 @@ namespace ngraph
                     return;
                 }
 
-                if (arg_rank == 1)
+                auto& storage_type = storage_element_type(result_element_type);
+                if (result_rank > MAX_EIGEN_KERNEL_RANK)
+                {
+                    SELECT_KERNEL(ref_kernel, storage_type, runtime::cpu::kernel::reshape_ref);
+                }
+                else if (arg_rank == 1)
                 {
                     SELECT_KERNEL_BY_RANK(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_1d);
+                        kernel, storage_type, result_rank, runtime::cpu::kernel::reshape_1d);
                 }
                 else if (arg_rank == 2)
                 {
                     SELECT_KERNEL_BY_RANK(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_2d);
+                        kernel, storage_type, result_rank, runtime::cpu::kernel::reshape_2d);
                 }
                 else if (arg_rank == 3)
                 {
                     SELECT_KERNEL_BY_RANK(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_3d);
+                        kernel, storage_type, result_rank, runtime::cpu::kernel::reshape_3d);
                 }
                 else if (arg_rank == 4)
                 {
                     SELECT_KERNEL_BY_RANK(
-                        kernel, result_element_type, result_rank, runtime::cpu::kernel::reshape_4d);
+                        kernel, storage_type, result_rank, runtime::cpu::kernel::reshape_4d);
                 }
                 else
                 {
-                    SELECT_KERNEL(
-                        ref_kernel, result_element_type, runtime::cpu::kernel::reshape_ref);
+                    SELECT_KERNEL(ref_kernel, storage_type, runtime::cpu::kernel::reshape_ref);
                 }
             }
 
@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/scaled_dot_product_attention.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::ScaledDotProductAttention)
+            {
+                auto attention = static_cast<const ngraph::op::ScaledDotProductAttention*>(node);
+                auto& functors = external_function->get_functors();
+
+                auto query_index = external_function->get_buffer_index(args[0].get_name());
+                auto key_index = external_function->get_buffer_index(args[1].get_name());
+                auto value_index = external_function->get_buffer_index(args[2].get_name());
+                bool has_mask = attention->has_mask();
+                auto mask_index =
+                    has_mask ? external_function->get_buffer_index(args[3].get_name()) : 0;
+                auto out_index = external_function->get_buffer_index(out[0].get_name());
+
+                auto query_shape = args[0].get_shape();
+                auto value_shape = args[2].get_shape();
+                auto scale = attention->get_scale();
+
+                std::function<decltype(runtime::cpu::kernel::scaled_dot_product_attention<float>)>
+                    kernel;
+                auto element_type = args[0].get_element_type();
+                if (element_type == element::f32)
+                {
+                    kernel = runtime::cpu::kernel::scaled_dot_product_attention<float>;
+                }
+                else if (element_type == element::f64)
+                {
+                    kernel = runtime::cpu::kernel::scaled_dot_product_attention<double>;
+                }
+                else
+                {
+                    throw ngraph_error("Unsupported element type " +
+                                       element_type.c_type_string() +
+                                       " for ScaledDotProductAttention");
+                }
+
+                auto functor = [&,
+                                kernel,
+                                query_index,
+                                key_index,
+                                value_index,
+                                has_mask,
+                                mask_index,
+                                out_index,
+                                query_shape,
+                                value_shape,
+                                scale](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    kernel(ctx->buffer_data[query_index],
+                           ctx->buffer_data[key_index],
+                           ctx->buffer_data[value_index],
+                           has_mask ? ctx->buffer_data[mask_index] : nullptr,
+                           ctx->buffer_data[out_index],
+                           query_shape,
+                           value_shape,
+                           scale,
+                           ectx->arena);
+                };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(ScaledDotProductAttention);
+        }
+    }
+}
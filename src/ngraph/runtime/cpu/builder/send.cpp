@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/distributed.hpp"
+#include "ngraph/op/send.hpp"
+#include "ngraph/runtime/cpu/cpu_builder.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Send)
+            {
+                auto& functors = external_function->get_functors();
+
+                auto send = static_cast<const ngraph::op::Send*>(node);
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                auto count = args[0].get_size();
+                auto size = args[0].get_size() * args[0].get_element_type().size();
+                auto data_type = args[0].get_element_type().get_type_enum();
+                auto dest_rank = send->get_dest_rank();
+                auto tag = send->get_tag();
+
+                auto functor =
+                    [&, count, size, data_type, dest_rank, tag, arg_buffer_index, out_buffer_index](
+                        CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                        get_distributed_interface()->send(
+                            ctx->buffer_data[arg_buffer_index], data_type, count, dest_rank, tag);
+                        if (ctx->buffer_data[arg_buffer_index] != ctx->buffer_data[out_buffer_index])
+                        {
+                            memcpy(ctx->buffer_data[out_buffer_index],
+                                   ctx->buffer_data[arg_buffer_index],
+                                   size);
+                        }
+                    };
+                functors.emplace_back(functor);
+            }
+
+            REGISTER_OP_BUILDER(Send);
+        }
+    }
+}
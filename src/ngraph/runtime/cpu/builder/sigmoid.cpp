@@ -47,14 +47,15 @@ namespace ngraph
                 auto sigmoid_index = mkldnn_emitter->reserve_primitive_space(3);
                 auto& deps = mkldnn_emitter->get_primitive_deps(sigmoid_index);
 
+                external_function->add_mkldnn_primitive_builder(
+                    [&, sigmoid_desc, sigmoid_index](CPURuntimeContext* ctx) {
+                        mkldnn_emitter->build_sigmoid_forward(
+                            ctx->mkldnn_primitives, sigmoid_desc, deps, sigmoid_index);
+                    });
+
                 auto functor =
                     [&, sigmoid_desc, sigmoid_index, arg0_buffer_index, out_buffer_index](
                         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_sigmoid_forward(
-                                ctx->mkldnn_primitives, sigmoid_desc, deps, sigmoid_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -84,6 +85,12 @@ namespace ngraph
                 size_t sigmoid_index = mkldnn_emitter->reserve_primitive_space(4);
                 auto& deps = mkldnn_emitter->get_primitive_deps(sigmoid_index);
 
+                external_function->add_mkldnn_primitive_builder(
+                    [&, bwd_desc, fwd_desc, sigmoid_index](CPURuntimeContext* ctx) {
+                        mkldnn_emitter->build_sigmoid_backward(
+                            ctx->mkldnn_primitives, bwd_desc, fwd_desc, deps, sigmoid_index);
+                    });
+
                 auto functor = [&,
                                 bwd_desc,
                                 fwd_desc,
@@ -92,11 +99,6 @@ namespace ngraph
                                 arg1_buffer_index,
                                 out_buffer_index](CPURuntimeContext* ctx,
                                                   CPUExecutionContext* ectx) {
-                    if (ctx->first_iteration)
-                    {
-                        mkldnn_emitter->build_sigmoid_backward(
-                            ctx->mkldnn_primitives, bwd_desc, fwd_desc, deps, sigmoid_index);
-                    }
                     cpu::mkldnn_utils::set_memory_ptr(
                         ctx, deps[0], ctx->buffer_data[arg0_buffer_index]);
                     cpu::mkldnn_utils::set_memory_ptr(
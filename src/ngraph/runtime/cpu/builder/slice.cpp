@@ -97,6 +97,18 @@ namespace ngraph
                     auto slice_index = mkldnn_emitter->reserve_primitive_space(3);
                     auto& deps = mkldnn_emitter->get_primitive_deps(slice_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, input_desc, result_desc, lower_bounds, out_shape, slice_index](
+                            CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_slice(ctx->mkldnn_primitives,
+                                                        input_desc,
+                                                        result_desc,
+                                                        lower_bounds,
+                                                        out_shape,
+                                                        deps,
+                                                        slice_index);
+                        });
+
                     auto functor = [&,
                                     input_desc,
                                     result_desc,
@@ -106,16 +118,6 @@ namespace ngraph
                                     arg_buffer_index,
                                     out_buffer_index](CPURuntimeContext* ctx,
                                                       CPUExecutionContext* ectx) {
-                        if (ctx->first_iteration)
-                        {
-                            mkldnn_emitter->build_slice(ctx->mkldnn_primitives,
-                                                        input_desc,
-                                                        result_desc,
-                                                        lower_bounds,
-                                                        out_shape,
-                                                        deps,
-                                                        slice_index);
-                        }
                         cpu::mkldnn_utils::set_memory_ptr(
                             ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
                         cpu::mkldnn_utils::set_memory_ptr(
@@ -127,15 +129,23 @@ namespace ngraph
                 }
                 else
                 {
-                    if (is_strided(strides))
+                    if (is_strided(strides) || arg_shape.size() > MAX_EIGEN_KERNEL_RANK)
                     {
                         std::function<decltype(runtime::cpu::kernel::strided_slice<float, 2>)>
                             kernel;
 
-                        SELECT_KERNEL_BY_RANK(kernel,
-                                              args[0].get_element_type(),
-                                              arg_shape.size(),
-                                              runtime::cpu::kernel::strided_slice);
+                        auto& storage_type = storage_element_type(args[0].get_element_type());
+                        if (arg_shape.size() > MAX_EIGEN_KERNEL_RANK)
+                        {
+                            SELECT_KERNEL(kernel, storage_type, runtime::cpu::kernel::slice_ref);
+                        }
+                        else
+                        {
+                            SELECT_KERNEL_BY_RANK(kernel,
+                                                  storage_type,
+                                                  arg_shape.size(),
+                                                  runtime::cpu::kernel::strided_slice);
+                        }
 
                         auto functor = [&,
                                         kernel,
@@ -163,7 +173,7 @@ namespace ngraph
                         std::function<decltype(runtime::cpu::kernel::slice<float, 2>)> kernel;
 
                         SELECT_KERNEL_BY_RANK(kernel,
-                                              args[0].get_element_type(),
+                                              storage_element_type(args[0].get_element_type()),
                                               arg_shape.size(),
                                               runtime::cpu::kernel::slice);
 
@@ -19,7 +19,6 @@
 #include "ngraph/runtime/cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/cpu/mkldnn_invoke.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
-#include "ngraph/runtime/reference/softmax.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -52,14 +51,15 @@ namespace ngraph
                     size_t softmax_index = mkldnn_emitter->reserve_primitive_space(3);
                     auto& deps = mkldnn_emitter->get_primitive_deps(softmax_index);
 
+                    external_function->add_mkldnn_primitive_builder(
+                        [&, softmax_desc, softmax_index](CPURuntimeContext* ctx) {
+                            mkldnn_emitter->build_softmax_forward(
+                                ctx->mkldnn_primitives, softmax_desc, deps, softmax_index);
+                        });
+
                     auto functor =
                         [&, softmax_desc, softmax_index, arg_buffer_index, out_buffer_index](
                             CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            if (ctx->first_iteration)
-                            {
-                                mkldnn_emitter->build_softmax_forward(
-                                    ctx->mkldnn_primitives, softmax_desc, deps, softmax_index);
-                            }
                             cpu::mkldnn_utils::set_memory_ptr(
                                 ctx, deps[0], ctx->buffer_data[arg_buffer_index]);
                             cpu::mkldnn_utils::set_memory_ptr(
@@ -172,25 +172,25 @@ namespace ngraph
                             };
                         functors.emplace_back(functor);
                     }
-                    else if (softmax->get_element_type() == element::f32)
-                    {
-                        NGRAPH_WARN << "Falling back to refernce kernel for softmax " << arg_shape
-                                    << " over " << axes;
-                        auto functor = [&, arg_shape, axes, arg_buffer_index, out_buffer_index](
-                            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
-                            runtime::reference::softmax<float>(
-                                static_cast<float*>(ctx->buffer_data[arg_buffer_index]),
-                                static_cast<float*>(ctx->buffer_data[out_buffer_index]),
-                                arg_shape,
-                                axes);
-                        };
-                        functors.emplace_back(functor);
-                    }
                     else
                     {
-                        NGRAPH_ERR << "Unsupported Softmax " << arg_shape << " over " << axes
-                                   << " in cpu buiilder";
-                        throw ngraph_error("Unsupported Softmax");
+                        std::function<decltype(runtime::cpu::kernel::softmax_any_axes<float>)>
+                            kernel;
+
+                        SELECT_KERNEL(kernel,
+                                      args[0].get_element_type(),
+                                      runtime::cpu::kernel::softmax_any_axes);
+
+                        auto functor =
+                            [&, kernel, arg_shape, axes, arg_buffer_index, out_buffer_index](
+                                CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                                kernel(ctx->buffer_data[arg_buffer_index],
+                                       ctx->buffer_data[out_buffer_index],
+                                       arg_shape,
+                                       axes,
+                                       ectx->arena);
+                            };
+                        functors.emplace_back(functor);
                     }
                 }
             }
@@ -14,9 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include "ngraph/op/experimental/dropout.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
-#include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/cpu/kernel/dropout.hpp"
+#include "ngraph/runtime/cpu/kernel/generate_mask.hpp"
 #include "ngraph/state/rng_state.hpp"
 
 using namespace std;
@@ -50,11 +52,12 @@ namespace ngraph
                         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                         bool training = static_cast<bool>(
                             static_cast<float*>(ctx->buffer_data[arg_buffer_index])[0]);
-                        reference::generate_mask(
-                            static_cast<float*>(ctx->buffer_data[out_buffer_index]),
+                        runtime::cpu::kernel::generate_mask<float>(
+                            ctx->buffer_data[out_buffer_index],
                             element_count,
                             static_cast<RNGState*>(ctx->states[index]),
-                            training);
+                            training,
+                            ectx->arena);
                     };
                 }
                 else if (args[0].get_element_type() == element::f64)
@@ -63,11 +66,12 @@ namespace ngraph
                         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
                         bool training = static_cast<bool>(
                             static_cast<double*>(ctx->buffer_data[arg_buffer_index])[0]);
-                        reference::generate_mask(
-                            static_cast<double*>(ctx->buffer_data[out_buffer_index]),
+                        runtime::cpu::kernel::generate_mask<double>(
+                            ctx->buffer_data[out_buffer_index],
                             element_count,
                             static_cast<RNGState*>(ctx->states[index]),
-                            training);
+                            training,
+                            ectx->arena);
                     };
                 }
                 else
@@ -79,7 +83,106 @@ namespace ngraph
                 functors.emplace_back(functor);
             }
 
+            template <typename T>
+            static CPUKernelFunctor make_dropout_functor(size_t index,
+                                                         size_t element_count,
+                                                         size_t arg_buffer_index,
+                                                         size_t training_buffer_index,
+                                                         size_t offset_buffer_index,
+                                                         size_t out_buffer_index,
+                                                         bool reserve)
+            {
+                // The forward op reserves the counters of its mask and writes the first one
+                // to its offset output, the backprop op reads it from its offset input
+                return [index,
+                        element_count,
+                        arg_buffer_index,
+                        training_buffer_index,
+                        offset_buffer_index,
+                        out_buffer_index,
+                        reserve](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {
+                    auto state = static_cast<RNGState*>(ctx->states[index]);
+                    auto offset = static_cast<uint64_t*>(ctx->buffer_data[offset_buffer_index]);
+                    bool training = static_cast<bool>(
+                        static_cast<T*>(ctx->buffer_data[training_buffer_index])[0]);
+                    if (reserve)
+                    {
+                        offset[0] = training ? state->reserve(element_count) : 0;
+                    }
+                    runtime::cpu::kernel::dropout<T>(ctx->buffer_data[arg_buffer_index],
+                                                     ctx->buffer_data[out_buffer_index],
+                                                     element_count,
+                                                     state,
+                                                     offset[0],
+                                                     training,
+                                                     ectx->arena);
+                };
+            }
+
+            template <typename OP>
+            static void build_dropout(CPU_ExternalFunction* external_function,
+                                      const ngraph::Node* node,
+                                      const std::vector<TensorViewWrapper>& args,
+                                      const std::vector<TensorViewWrapper>& out)
+            {
+                auto& functors = external_function->get_functors();
+                auto dropout = static_cast<const OP*>(node);
+                bool reserve = std::is_same<OP, ngraph::op::Dropout>::value;
+
+                auto arg_buffer_index = external_function->get_buffer_index(args[0].get_name());
+                auto training_buffer_index =
+                    external_function->get_buffer_index(args[1].get_name());
+                auto offset_buffer_index = external_function->get_buffer_index(
+                    reserve ? out[1].get_name() : args[2].get_name());
+                auto out_buffer_index = external_function->get_buffer_index(out[0].get_name());
+                size_t element_count = out[0].get_size();
+
+                auto index = external_function->add_state(ngraph::RNGState::create_rng_state(
+                    dropout->get_seed(), dropout->get_keep_probability()));
+
+                if (args[0].get_element_type() == element::f32)
+                {
+                    functors.emplace_back(make_dropout_functor<float>(index,
+                                                                      element_count,
+                                                                      arg_buffer_index,
+                                                                      training_buffer_index,
+                                                                      offset_buffer_index,
+                                                                      out_buffer_index,
+                                                                      reserve));
+                }
+                else if (args[0].get_element_type() == element::f64)
+                {
+                    functors.emplace_back(make_dropout_functor<double>(index,
+                                                                       element_count,
+                                                                       arg_buffer_index,
+                                                                       training_buffer_index,
+                                                                       offset_buffer_index,
+                                                                       out_buffer_index,
+                                                                       reserve));
+                }
+                else
+                {
+                    throw ngraph_error(std::string("Unsupported type ") +
+                                       args[0].get_element_type().c_type_string() + " for " +
+                                       node->description());
+                }
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::Dropout)
+            {
+                build_dropout<ngraph::op::Dropout>(external_function, node, args, out);
+            }
+
+            template <>
+            void Builder::BUILDER_DECL(ngraph::op::DropoutBackprop)
+            {
+                build_dropout<ngraph::op::DropoutBackprop>(external_function, node, args, out);
+            }
+
             REGISTER_OP_BUILDER(GenerateMask);
+            REGISTER_OP_BUILDER(Dropout);
+            REGISTER_OP_BUILDER(DropoutBackprop);
         }
     }
 }
@@ -18,6 +18,7 @@
 
 #include "ngraph/op/sum.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_deterministic.hpp"
 #include "ngraph/runtime/cpu/kernel/reduce_sum.hpp"
 
 #include "reduction.hpp"
@@ -34,6 +35,7 @@ namespace ngraph
             template <>
             void Builder::BUILDER_DECL(ngraph::op::Sum)
             {
+                BUILD_DETERMINISTIC_REDUCTION_FUNCTOR(Sum, sum, kernel::SumReducer);
                 BUILD_REDUCTION_FUNCTOR(Sum, sum);
             }
 
@@ -18,16 +18,27 @@
 
 #include "cpu_backend_visibility.h"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/metrics.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_constant_pool.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_workspace.hpp"
 #include "ngraph/util.hpp"
 
+#ifdef NGRAPH_JSON_ENABLE
+#include "ngraph/serializer.hpp"
+#endif
+
 using namespace ngraph;
 using namespace std;
 
+static const string s_saved_executable_magic = "ngraph_cpu_executable";
+static const int s_saved_executable_version = 1;
+
 extern "C" runtime::BackendConstructor* get_backend_constructor_pointer()
 {
     class CPU_BackendConstructor : public runtime::BackendConstructor
@@ -37,6 +48,8 @@ extern "C" runtime::BackendConstructor* get_backend_constructor_pointer()
         {
             // Force TBB to link to the backend
             tbb::TBB_runtime_interface_version();
+            // Fix the threading before any MKL-DNN primitive starts the OpenMP runtime
+            runtime::cpu::executor::GetCPUExecutor();
             return make_shared<runtime::cpu::CPU_Backend>();
         }
     };
@@ -98,24 +111,72 @@ shared_ptr<runtime::Executable>
     }
     else
     {
-        rc = make_shared<CPU_Executable>(func, pass_config, performance_counters_enabled);
+        rc = make_shared<CPU_Executable>(
+            func, pass_config, performance_counters_enabled, m_workspace);
         m_exec_map.insert({func, rc});
     }
     return rc;
 }
 
+vector<shared_ptr<runtime::Executable>>
+    runtime::cpu::CPU_Backend::compile(const vector<shared_ptr<Function>>& functions,
+                                       bool performance_counters_enabled)
+{
+    auto workspace = m_workspace;
+    if (workspace == nullptr)
+    {
+        workspace = make_shared<CPU_Workspace>(CPU_ExternalFunction::s_memory_pool_alignment);
+    }
+    auto constant_pool = make_shared<CPU_ConstantPool>();
+    vector<shared_ptr<runtime::Executable>> executables;
+    for (auto& function : functions)
+    {
+        ngraph::pass::PassConfig pass_config;
+        executables.push_back(make_shared<CPU_Executable>(clone_function(*function),
+                                                          pass_config,
+                                                          performance_counters_enabled,
+                                                          workspace,
+                                                          constant_pool));
+    }
+    return executables;
+}
+
+constexpr const char* runtime::cpu::CPU_Executable::SAVEABLE_ATTRIBUTE;
+constexpr const char* runtime::cpu::CPU_Executable::BATCH_POLYMORPHIC_ATTRIBUTE;
+constexpr const char* runtime::cpu::CPU_Executable::DETERMINISTIC_REDUCTIONS_ATTRIBUTE;
+
 runtime::cpu::CPU_Executable::CPU_Executable(shared_ptr<Function> func,
                                              ngraph::pass::PassConfig& pass_config,
-                                             bool performance_counters_enabled)
+                                             bool performance_counters_enabled,
+                                             const shared_ptr<CPU_Workspace>& workspace,
+                                             const shared_ptr<CPU_ConstantPool>& constant_pool)
+    : m_pass_config(pass_config)
 {
+    if (pass_config.get_pass_attribute(SAVEABLE_ATTRIBUTE))
+    {
+        m_source_function = clone_function(*func);
+    }
+
     FunctionInstance& instance = m_function_instance;
+    instance.m_performance_counters_enabled = performance_counters_enabled;
     if (instance.m_external_function == nullptr)
     {
         instance.m_external_function = make_shared<CPU_ExternalFunction>(func);
         instance.m_external_function->m_emit_timing = performance_counters_enabled;
+        instance.m_external_function->m_workspace = workspace;
+        instance.m_external_function->m_constant_pool = constant_pool;
+        auto start = chrono::steady_clock::now();
         auto cf = instance.m_external_function->make_call_frame(pass_config);
         instance.m_call_frame = dynamic_pointer_cast<CPU_CallFrame>(cf);
+        if (Metrics::is_enabled())
+        {
+            Metrics::observe(
+                "ngraph_compile_duration_seconds",
+                {{"backend", "CPU"}},
+                chrono::duration<double>(chrono::steady_clock::now() - start).count());
+        }
     }
+    set_compile_profile(instance.m_external_function->get_compile_profile());
     set_parameters_and_results(*func);
 }
 
@@ -125,6 +186,33 @@ std::shared_ptr<ngraph::runtime::cpu::CPU_CallFrame> runtime::cpu::CPU_Executabl
     return instance.m_call_frame;
 }
 
+void runtime::cpu::CPU_Executable::set_concurrency(size_t num_ctx)
+{
+    m_function_instance.m_call_frame->set_concurrency(num_ctx);
+}
+
+void runtime::cpu::CPU_Executable::set_context_affinity(bool enable)
+{
+    m_function_instance.m_call_frame->set_context_affinity(enable);
+}
+
+void runtime::cpu::CPU_Executable::set_priority(CallPriority priority)
+{
+    m_function_instance.m_call_frame->set_priority(priority);
+}
+
+void runtime::cpu::CPU_Executable::set_latency_sample_period(size_t period)
+{
+    NGRAPH_CHECK(m_function_instance.m_external_function->is_direct_execution(),
+                 "Latency histograms are only recorded in DEX mode");
+    m_function_instance.m_external_function->set_latency_sample_period(period);
+}
+
+runtime::cpu::LatencyReport runtime::cpu::CPU_Executable::get_latency_report(bool reset)
+{
+    return m_function_instance.m_call_frame->get_latency_report(reset);
+}
+
 bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                         const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
@@ -142,6 +230,41 @@ bool runtime::cpu::CPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
     return rc;
 }
 
+future<bool>
+    runtime::cpu::CPU_Executable::begin_call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                             const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    // std::function requires a copyable target, so the promise is shared with the task.
+    auto promise = make_shared<std::promise<bool>>();
+    auto result = promise->get_future();
+
+    executor::GetCPUExecutor().schedule_call([this, promise, outputs, inputs]() {
+        try
+        {
+            promise->set_value(call(outputs, inputs));
+        }
+        catch (...)
+        {
+            promise->set_exception(std::current_exception());
+        }
+    });
+
+    return result;
+}
+
+void runtime::cpu::CPU_Backend::set_shared_workspace(bool enable)
+{
+    if (!enable)
+    {
+        m_workspace = nullptr;
+    }
+    else if (m_workspace == nullptr)
+    {
+        m_workspace =
+            make_shared<CPU_Workspace>(runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment);
+    }
+}
+
 void runtime::cpu::CPU_Backend::remove_compiled_function(shared_ptr<Executable> exec)
 {
     for (auto it = m_exec_map.begin(); it != m_exec_map.end(); ++it)
@@ -167,6 +290,131 @@ vector<runtime::PerformanceCounter> runtime::cpu::CPU_Executable::get_performanc
     return rc;
 }
 
+runtime::MemoryStatistics
+    runtime::cpu::CPU_Executable::get_memory_statistics(size_t top_tensors) const
+{
+    const FunctionInstance& instance = m_function_instance;
+    MemoryStatistics statistics;
+    if (instance.m_external_function != nullptr)
+    {
+        statistics = instance.m_external_function->get_memory_statistics(top_tensors);
+    }
+    if (instance.m_call_frame != nullptr)
+    {
+        statistics.resident_bytes = instance.m_call_frame->get_resident_bytes();
+        statistics.reclaimed_bytes = instance.m_call_frame->get_reclaimed_bytes();
+    }
+    return statistics;
+}
+
+void runtime::cpu::CPU_Executable::update_constants(
+    const std::map<const ngraph::op::Constant*, const void*>& values)
+{
+    m_function_instance.m_external_function->update_constants(values);
+    m_function_instance.m_call_frame->update_shared_values();
+}
+
+void runtime::cpu::CPU_Executable::prepare()
+{
+    m_function_instance.m_call_frame->prepare();
+}
+
+size_t runtime::cpu::CPU_Executable::reclaim_memory(bool keep_constant_values)
+{
+    return m_function_instance.m_call_frame->reclaim_memory(keep_constant_values);
+}
+
+void runtime::cpu::CPU_Executable::set_idle_timeout(std::chrono::milliseconds timeout,
+                                                    bool keep_constant_values)
+{
+    m_function_instance.m_call_frame->set_idle_timeout(timeout, keep_constant_values);
+}
+
+const vector<string>& runtime::cpu::CPU_Executable::get_result_copies() const
+{
+    return m_function_instance.m_external_function->get_result_copies();
+}
+
+vector<runtime::cpu::LayoutConversion>
+    runtime::cpu::CPU_Executable::get_layout_conversions() const
+{
+    return m_function_instance.m_external_function->get_layout_conversions();
+}
+
+void runtime::cpu::CPU_Executable::save(ostream& output_stream)
+{
+#ifdef NGRAPH_JSON_ENABLE
+    if (m_source_function == nullptr)
+    {
+        throw ngraph_error(string("CPU executable can only be saved when compiled with the ") +
+                           SAVEABLE_ATTRIBUTE + " pass attribute");
+    }
+
+    output_stream << s_saved_executable_magic << " " << s_saved_executable_version << "\n";
+    output_stream << m_function_instance.m_performance_counters_enabled << "\n";
+    output_stream << m_pass_config.get_enables().size() << "\n";
+    for (auto& enable : m_pass_config.get_enables())
+    {
+        output_stream << enable.first << " " << enable.second << "\n";
+    }
+    output_stream << m_pass_config.get_pass_attributes().size() << "\n";
+    for (auto& attribute : m_pass_config.get_pass_attributes())
+    {
+        output_stream << attribute.first << " " << attribute.second << "\n";
+    }
+    serialize(output_stream, m_source_function);
+#else
+    throw ngraph_error("Saving CPU executables requires NGRAPH_JSON_ENABLE");
+#endif
+}
+
+shared_ptr<runtime::Executable> runtime::cpu::CPU_Backend::load(istream& input_stream)
+{
+#ifdef NGRAPH_JSON_ENABLE
+    string magic;
+    int version;
+    input_stream >> magic >> version;
+    if (!input_stream || magic != s_saved_executable_magic)
+    {
+        throw ngraph_error("Stream does not hold a saved CPU executable");
+    }
+    if (version != s_saved_executable_version)
+    {
+        throw ngraph_error("Unsupported saved CPU executable version " + to_string(version));
+    }
+
+    bool performance_counters_enabled;
+    input_stream >> performance_counters_enabled;
+    ngraph::pass::PassConfig pass_config;
+    size_t count;
+    input_stream >> count;
+    for (size_t i = 0; i < count; i++)
+    {
+        string name;
+        bool enable;
+        input_stream >> name >> enable;
+        pass_config.set_pass_enable(name, enable);
+    }
+    input_stream >> count;
+    for (size_t i = 0; i < count; i++)
+    {
+        string name;
+        bool enable;
+        input_stream >> name >> enable;
+        pass_config.set_pass_attribute(name, enable);
+    }
+    if (!input_stream)
+    {
+        throw ngraph_error("Saved CPU executable header is truncated");
+    }
+
+    auto func = deserialize(input_stream);
+    return compile(func, pass_config, performance_counters_enabled);
+#else
+    throw ngraph_error("Loading CPU executables requires NGRAPH_JSON_ENABLE");
+#endif
+}
+
 bool runtime::cpu::CPU_Backend::is_supported(const Node& op) const
 {
     return true;
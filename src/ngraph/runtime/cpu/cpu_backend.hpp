@@ -22,6 +22,9 @@
 #include "cpu_backend_visibility.h"
 #include "ngraph/pass/pass_config.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/cpu/cpu_call_priority.hpp"
+#include "ngraph/runtime/cpu/cpu_latency_histogram.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_conversions.hpp"
 
 namespace ngraph
 {
@@ -31,6 +34,8 @@ namespace ngraph
         {
             class CPU_ExternalFunction;
             class CPU_CallFrame;
+            class CPU_Workspace;
+            class CPU_ConstantPool;
 
             class CPU_BACKEND_API CPU_Backend : public runtime::Backend
             {
@@ -57,14 +62,42 @@ namespace ngraph
                             ngraph::pass::PassConfig& pass_config,
                             bool enable_performance_counters = false) override;
 
+                /// \brief Compiles functions that run together. Besides compiling clones,
+                ///        the executables share
+                ///        - one copy of each distinct constant, compared after the weights are
+                ///          reordered into their MKL-DNN layouts, and
+                ///        - the temporary memory, borrowed per call from a workspace as with
+                ///          set_shared_workspace, so the group needs the memory of its largest
+                ///          function. This is the backend's workspace when it is shared.
+                ///
+                /// Constants are only shared in DEX mode.
+                std::vector<std::shared_ptr<Executable>>
+                    compile(const std::vector<std::shared_ptr<Function>>& functions,
+                            bool enable_performance_counters = false) override;
+
                 void remove_compiled_function(std::shared_ptr<Executable> exec) override;
 
+                /// \brief Make executables compiled from now on borrow their temporary memory
+                ///        from a workspace shared with the other executables of this backend.
+                ///
+                /// Each call holds a workspace buffer only while it runs, so the temporary
+                /// memory in use follows the largest executable and the number of concurrent
+                /// calls instead of the total over all executables. Intermediates are then
+                /// recomputed on every call rather than cached between calls. Executables that
+                /// were already compiled are not affected.
+                void set_shared_workspace(bool enable);
+
+                /// \brief Restore an executable written by CPU_Executable::save. The restored
+                ///        executable is compiled with the pass configuration it was saved with.
+                std::shared_ptr<Executable> load(std::istream& input_stream) override;
+
                 bool is_supported(const Node& node) const override;
                 bool is_supported_property(const Property prop) const override;
 
             private:
                 std::unordered_map<std::shared_ptr<Function>, std::shared_ptr<Executable>>
                     m_exec_map;
+                std::shared_ptr<CPU_Workspace> m_workspace;
             };
 
             class CPU_BACKEND_API CPU_Executable : public runtime::Executable
@@ -72,13 +105,114 @@ namespace ngraph
             public:
                 CPU_Executable(std::shared_ptr<Function> func,
                                ngraph::pass::PassConfig& pass_config,
-                               bool performance_counters_enabled);
+                               bool performance_counters_enabled,
+                               const std::shared_ptr<CPU_Workspace>& workspace = nullptr,
+                               const std::shared_ptr<CPU_ConstantPool>& constant_pool = nullptr);
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+                std::future<bool> begin_call(
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
                 std::shared_ptr<CPU_CallFrame> get_call_frame();
 
+                /// \brief Set the number of calls to this executable that may run concurrently.
+                ///        Overrides NGRAPH_CPU_CONCURRENCY for this executable only.
+                void set_concurrency(size_t num_ctx);
+                /// \brief Ask for each calling thread to reuse the runtime context it used
+                ///        last, when that context is idle.
+                void set_context_affinity(bool enable);
+                /// \brief Set the priority class of the calls to this executable, e.g. High for
+                ///        interactive requests and Low for batch jobs. Between its ops, a call
+                ///        waits for the calls of higher priorities to finish, and High calls
+                ///        run on the thread pools reserved with NGRAPH_CPU_RESERVED_POOLS. Calls
+                ///        are Normal by default. Waiting between ops is only done in DEX mode
+                ///        without NGRAPH_CPU_USE_TBB.
+                void set_priority(CallPriority priority);
+                /// \brief Record the latency of each op, and of the whole call, for one call in
+                ///        every `period`; 0 stops sampling. Can be changed while calls run.
+                ///        Defaults to NGRAPH_CPU_LATENCY_SAMPLE_PERIOD. Only supported in DEX
+                ///        mode.
+                void set_latency_sample_period(size_t period);
+                /// \brief Snapshot the sampled latency histograms, merged over the runtime
+                ///        contexts, for percentiles by op and by call.
+                /// \param reset Start new histograms once these are read
+                LatencyReport get_latency_report(bool reset = false);
+
                 std::vector<PerformanceCounter> get_performance_data() const override;
+                MemoryStatistics get_memory_statistics(size_t top_tensors = 10) const override;
+
+                /// \brief Overwrite constants of the compiled function. Constants that were
+                ///        folded into other ops or merged with equal constants during
+                ///        compilation can not be updated; weights that must stay updatable
+                ///        can be passed as cacheable Parameters instead. Only supported in DEX
+                ///        mode.
+                void update_constants(
+                    const std::map<const ngraph::op::Constant*, const void*>& values) override;
+
+                /// \brief Create the runtime contexts allowed by the concurrency and do their
+                ///        first-iteration work, in parallel: build their MKL-DNN primitives,
+                ///        and compute the cached ops that only depend on constants, such as
+                ///        weight layout conversions. Those are computed once, into buffers all
+                ///        the contexts share, rather than once per context. Only has an effect
+                ///        in DEX mode.
+                void prepare() override;
+
+                /// \brief Free the temporary buffers of the runtime contexts that are not
+                ///        running a call, and unless `keep_constant_values` is set, the values
+                ///        prepare() computed from constants. Only has an effect in DEX mode
+                ///        without a workspace, whose buffers are only held during calls.
+                size_t reclaim_memory(bool keep_constant_values = true) override;
+                void set_idle_timeout(std::chrono::milliseconds timeout,
+                                      bool keep_constant_values = true) override;
+
+                /// \brief Report which results are computed directly in the caller's output
+                ///        tensors.
+                /// \returns For each result, in order, an empty string if the result is computed
+                ///          in its output tensor, or otherwise the reason why it is copied there
+                ///          (for instance the result is a parameter or a constant).
+                const std::vector<std::string>& get_result_copies() const;
+
+                /// \brief List the layout conversions CPULayout inserted between MKL-DNN and
+                ///        native kernels, with their source and destination formats and the
+                ///        bytes they move. Their run time is included when the function was
+                ///        compiled with performance counters enabled.
+                std::vector<LayoutConversion> get_layout_conversions() const;
+
+                /// \brief Save the executable so that CPU_Backend::load can restore it.
+                ///
+                /// Only executables compiled with the "CPUExecutable::Saveable" pass attribute
+                /// can be saved, since compilation rewrites the function in place and the
+                /// source graph has to be kept for this.
+                void save(std::ostream& output_stream) override;
+
+                static constexpr const char* SAVEABLE_ATTRIBUTE = "CPUExecutable::Saveable";
+
+                /// \brief Pass attribute to compile a function once for the largest batch and
+                ///        call it on any smaller one.
+                ///
+                /// The parameters that are not cacheable must share their leading dimension,
+                /// the largest batch. A call may pass them, and the results that depend on
+                /// them, with a smaller leading dimension; the kernels then only run on that
+                /// many items, in the memory planned for the largest batch. Only supported in
+                /// DEX mode, and by the ops whose builders scale with the batch (elementwise
+                /// ops, and Dot and MatmulBias of a batch by weights). Batched ops are kept off
+                /// MKL-DNN, whose primitives are built for fixed shapes. Smaller batches are
+                /// passed to `call`, as `call_with_validate` expects the parameters' shapes.
+                static constexpr const char* BATCH_POLYMORPHIC_ATTRIBUTE =
+                    "CPUExecutable::BatchPolymorphic";
+
+                /// \brief Pass attribute to make the f32 and f64 Sum and Product of a function
+                ///        give the same bits for any number of threads.
+                ///
+                /// The reductions then split their input into blocks whose size only depends
+                /// on the shape, and combine the partial results in a fixed order, so that a
+                /// result can be reproduced on a machine with a different core count. Only
+                /// supported in DEX mode. MKL-DNN primitives, such as the statistics of
+                /// BatchNorm training, are not covered.
+                static constexpr const char* DETERMINISTIC_REDUCTIONS_ATTRIBUTE =
+                    "CPUExecutable::DeterministicReductions";
 
             private:
                 class FunctionInstance
@@ -88,6 +222,10 @@ namespace ngraph
                     std::shared_ptr<CPU_CallFrame> m_call_frame = nullptr;
                     bool m_performance_counters_enabled = false;
                 } m_function_instance;
+
+                // Unoptimized copy of the compiled function, kept only for saveable executables
+                std::shared_ptr<Function> m_source_function;
+                ngraph::pass::PassConfig m_pass_config;
             };
         }
     }
@@ -122,6 +122,10 @@
         KV = K<uint64_t, uint64_t, uint64_t>;                                                      \
     }
 
+// Highest rank the SELECT_RANK macros instantiate Eigen kernels for. Data movement and
+// reduction builders switch to rank-generic reference kernels above it.
+#define MAX_EIGEN_KERNEL_RANK 7
+
 #define SELECT_RANK(KV, ET, R, K)                                                                  \
     if (R == 1)                                                                                    \
         KV = K<ET, 1>;                                                                             \
@@ -254,14 +258,15 @@
     SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
                                                                                                    \
     auto element_count = out[0].get_size();                                                        \
+    auto batch = external_function->scale_with_batch(node);                                        \
     auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
     auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());               \
                                                                                                    \
-    auto functor = [&, kernel, element_count, arg0_buffer_index, out0_buffer_index](               \
+    auto functor = [&, kernel, element_count, batch, arg0_buffer_index, out0_buffer_index](        \
         CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                       \
         kernel(ctx->buffer_data[arg0_buffer_index],                                                \
                ctx->buffer_data[out0_buffer_index],                                                \
-               element_count,                                                                      \
+               batch_elements(ctx, element_count, batch),                                          \
                ectx->arena);                                                                       \
     };                                                                                             \
     functors.emplace_back(functor);
@@ -273,19 +278,24 @@
     SELECT_KERNEL(kernel, args[0].get_element_type(), OP);                                         \
                                                                                                    \
     auto element_count = out[0].get_size();                                                        \
+    auto batch = external_function->scale_with_batch(node);                                        \
     auto arg0_buffer_index = external_function->get_buffer_index(args[0].get_name());              \
     auto arg1_buffer_index = external_function->get_buffer_index(args[1].get_name());              \
     auto out0_buffer_index = external_function->get_buffer_index(out[0].get_name());               \
                                                                                                    \
-    auto functor =                                                                                 \
-        [&, kernel, element_count, arg0_buffer_index, arg1_buffer_index, out0_buffer_index](       \
-            CPURuntimeContext* ctx, CPUExecutionContext* ectx) {                                   \
-            kernel(ctx->buffer_data[arg0_buffer_index],                                            \
-                   ctx->buffer_data[arg1_buffer_index],                                            \
-                   ctx->buffer_data[out0_buffer_index],                                            \
-                   element_count,                                                                  \
-                   ectx->arena);                                                                   \
-        };                                                                                         \
+    auto functor = [&,                                                                             \
+                    kernel,                                                                        \
+                    element_count,                                                                 \
+                    batch,                                                                         \
+                    arg0_buffer_index,                                                             \
+                    arg1_buffer_index,                                                             \
+                    out0_buffer_index](CPURuntimeContext* ctx, CPUExecutionContext* ectx) {        \
+        kernel(ctx->buffer_data[arg0_buffer_index],                                                \
+               ctx->buffer_data[arg1_buffer_index],                                                \
+               ctx->buffer_data[out0_buffer_index],                                                \
+               batch_elements(ctx, element_count, batch),                                          \
+               ectx->arena);                                                                       \
+    };                                                                                             \
     functors.emplace_back(functor);
 
 #define BUILD_UNARY_ELEMWISE_CF_FUNCTOR(OP)                                                        \
@@ -377,6 +387,25 @@ namespace ngraph
             // build the map to use cpu kernel for node execution
             CPU_BACKEND_API BuildNodeExecutorMap& GetGlobalCFDispatcherCPU();
 
+            /// \brief The element type to select a data movement kernel with for `type`.
+            ///
+            /// Kernels that only move values have no bf16 instantiation; they move bf16 values
+            /// as the u16 bit patterns of the same size.
+            inline const element::Type& storage_element_type(const element::Type& type)
+            {
+                return type == element::bf16 ? element::u16 : type;
+            }
+
+            /// \brief The part of a tensor of `count` elements, built for a batch of `batch`
+            ///        items, that the running call uses.
+            ///
+            /// `batch` is the value CPU_ExternalFunction::scale_with_batch returned for the
+            /// node, 0 when its tensors do not scale with the batch of the call.
+            inline size_t batch_elements(const CPURuntimeContext* ctx, size_t count, size_t batch)
+            {
+                return batch == 0 ? count : count / batch * ctx->batch_size;
+            }
+
             class Builder
             {
             public:
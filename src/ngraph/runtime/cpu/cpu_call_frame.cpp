@@ -15,11 +15,19 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cstring>
+#include <limits>
 #include <thread>
 
+#include <tbb/task_group.h>
+
+#include "ngraph/metrics.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_idle_reclaimer.hpp"
+#include "ngraph/runtime/cpu/cpu_latency_histogram.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
@@ -27,6 +35,28 @@
 using namespace std;
 using namespace ngraph;
 
+// Bytes held by the runtime contexts of every CPU call frame, see ngraph_arena_bytes
+static std::atomic<size_t> s_arena_bytes{0};
+
+static const MetricLabels& cpu_metric_labels()
+{
+    static const MetricLabels labels{{"backend", "CPU"}};
+    return labels;
+}
+
+static double seconds_since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+static void report_arena_bytes()
+{
+    if (Metrics::is_enabled())
+    {
+        Metrics::set_gauge("ngraph_arena_bytes", cpu_metric_labels(), s_arena_bytes.load());
+    }
+}
+
 runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction> external_function,
                                            InitContextFuncCG compiled_init_ctx_func,
                                            DestroyContextFuncCG compiled_destroy_ctx_func,
@@ -37,8 +67,8 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
     , m_compiled_function(compiled_function)
 {
     const auto envConcurrency = std::getenv("NGRAPH_CPU_CONCURRENCY");
-    m_num_ctx = envConcurrency == nullptr ? 1 : std::atoi(envConcurrency);
-    if (m_num_ctx > std::thread::hardware_concurrency())
+    m_max_ctx = envConcurrency == nullptr ? 1 : std::atoi(envConcurrency);
+    if (m_max_ctx > std::thread::hardware_concurrency())
     {
         throw ngraph_error(
             "Unexpected value specified for NGRAPH_CPU_CONCURRENCY "
@@ -46,6 +76,20 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
             std::string(envConcurrency) + "). Please specify a value in range [1-" +
             std::to_string(std::thread::hardware_concurrency()) + "]");
     }
+    m_max_ctx = std::max<size_t>(m_max_ctx, 1);
+
+    // Codegen mode shares a single generated context, so it can never grow past one.
+    m_ctx_capacity = m_external_function->is_direct_execution()
+                         ? std::max<size_t>(m_max_ctx, std::thread::hardware_concurrency())
+                         : 1;
+    NGRAPH_CHECK(m_max_ctx <= m_ctx_capacity, "Codegen mode supports a single runtime context");
+    m_ctx_busy.reset(new std::atomic<bool>[m_ctx_capacity]);
+    for (size_t i = 0; i < m_ctx_capacity; i++)
+    {
+        m_ctx_busy[i] = false;
+    }
+    m_ctx_vec.resize(m_ctx_capacity, nullptr);
+    m_last_call = std::chrono::steady_clock::now().time_since_epoch().count();
 
     setup_runtime_context();
     if (!m_external_function->is_direct_execution())
@@ -58,6 +102,10 @@ runtime::cpu::CPU_CallFrame::CPU_CallFrame(std::shared_ptr<CPU_ExternalFunction>
 
 runtime::cpu::CPU_CallFrame::~CPU_CallFrame()
 {
+    if (m_idle_timeout_registered)
+    {
+        IdleReclaimer::get().remove(this);
+    }
     cleanup_runtime_context();
     if (!m_external_function->is_direct_execution())
     {
@@ -78,14 +126,18 @@ void runtime::cpu::CPU_CallFrame::inner_call(
     {
         shared_ptr<runtime::cpu::CPUTensorView> tv =
             static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i]);
+        // An input is only known to be unchanged if it is not stale and this context's
+        // cached intermediates were computed from the same version of it
+        size_t version = tv->get_version();
         if (disable_caching)
         {
             m_ctx_vec[id]->p_en[i] = true;
         }
         else
         {
-            m_ctx_vec[id]->p_en[i] = tv->get_stale();
+            m_ctx_vec[id]->p_en[i] = tv->get_stale() || m_ctx_vec[id]->p_versions[i] != version;
         }
+        m_ctx_vec[id]->p_versions[i] = version;
 
         inputs.push_back(tv->get_data_ptr());
     }
@@ -96,6 +148,12 @@ void runtime::cpu::CPU_CallFrame::inner_call(
         outputs.push_back(tv->get_data_ptr());
     }
 
+    cpu::Timestamp call_start;
+    if (runtime::cpu::IsTracingEnabled())
+    {
+        call_start = cpu::Clock::now();
+    }
+
     // Invoke compiled computation
     if (!m_external_function->is_direct_execution())
     {
@@ -108,9 +166,176 @@ void runtime::cpu::CPU_CallFrame::inner_call(
 
     if (runtime::cpu::IsTracingEnabled())
     {
-        GenerateTimeline(m_external_function->get_op_attrs(),
-                         m_ctx_vec[id]->op_durations,
-                         m_external_function->get_function_name() + ".timeline.json");
+        auto& recorder = TimelineRecorder::get();
+        size_t trace_id = m_external_function->get_trace_id();
+        if (!m_external_function->is_direct_execution())
+        {
+            // Generated code only measures durations; it runs its ops one after the other
+            cpu::Timestamp op_start = call_start;
+            for (size_t i = 0; i < m_external_function->get_op_attrs().size(); i++)
+            {
+                cpu::Timestamp op_end = op_start + Timescale(m_ctx_vec[id]->op_durations[i]);
+                recorder.record_op(trace_id, i, op_start, op_end);
+                op_start = op_end;
+            }
+        }
+        recorder.record_call(trace_id, call_start, cpu::Clock::now());
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::set_concurrency(size_t num_ctx)
+{
+    NGRAPH_CHECK(num_ctx >= 1 && num_ctx <= m_ctx_capacity,
+                 "Unexpected concurrency ",
+                 num_ctx,
+                 " requested. Please specify a value in range [1-",
+                 m_ctx_capacity,
+                 "]");
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_max_ctx = std::max(num_ctx, m_num_ctx.load());
+    // Waiters may now be able to create a new context.
+    m_cv.notify_all();
+}
+
+size_t runtime::cpu::CPU_CallFrame::get_concurrency() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_max_ctx;
+}
+
+runtime::cpu::LatencyReport runtime::cpu::CPU_CallFrame::get_latency_report(bool reset)
+{
+    LatencyReport report;
+    for (auto& name : m_external_function->get_op_names())
+    {
+        report.ops.emplace_back(name, LatencyHistogram());
+    }
+
+    size_t num_ctx = m_num_ctx.load(std::memory_order_acquire);
+    for (size_t i = 0; i < num_ctx; i++)
+    {
+        LatencyRecorder* latencies = m_ctx_vec[i]->latencies.load(std::memory_order_acquire);
+        if (latencies == nullptr)
+        {
+            continue;
+        }
+        latencies->call.collect(report.call, reset);
+        for (size_t j = 0; j < latencies->num_ops && j < report.ops.size(); j++)
+        {
+            latencies->ops[j].collect(report.ops[j].second, reset);
+        }
+    }
+    return report;
+}
+
+bool runtime::cpu::CPU_CallFrame::try_acquire_context(size_t id)
+{
+    bool expected = false;
+    return !m_ctx_busy[id].load(std::memory_order_relaxed) &&
+           m_ctx_busy[id].compare_exchange_strong(expected, true, std::memory_order_acquire);
+}
+
+bool runtime::cpu::CPU_CallFrame::try_acquire_on_least_loaded_node(size_t num_ctx, size_t& id)
+{
+    auto& executor = executor::GetCPUExecutor();
+    vector<size_t> load(executor.get_num_numa_nodes(), 0);
+    for (size_t i = 0; i < num_ctx; i++)
+    {
+        if (m_ctx_busy[i].load(std::memory_order_relaxed))
+        {
+            load[executor.get_numa_node(m_ctx_vec[i]->arena)]++;
+        }
+    }
+    int node = static_cast<int>(min_element(load.begin(), load.end()) - load.begin());
+
+    for (size_t i = 0; i < num_ctx; i++)
+    {
+        if (executor.get_numa_node(m_ctx_vec[i]->arena) == node && try_acquire_context(i))
+        {
+            id = i;
+            return true;
+        }
+    }
+    return false;
+}
+
+size_t runtime::cpu::CPU_CallFrame::acquire_context()
+{
+    // Call frame and context last used by this thread. Only a hint: it is range-checked and
+    // claimed through the same busy flag as any other context.
+    static thread_local std::pair<const CPU_CallFrame*, size_t> s_preferred_ctx{nullptr, 0};
+
+    size_t num_ctx = m_num_ctx.load(std::memory_order_acquire);
+
+    if (m_ctx_affinity && s_preferred_ctx.first == this && s_preferred_ctx.second < num_ctx &&
+        try_acquire_context(s_preferred_ctx.second))
+    {
+        return s_preferred_ctx.second;
+    }
+
+    // On NUMA hosts contexts are spread over the nodes (see create_runtime_context). Prefer an
+    // idle context on the node that is running the fewest calls.
+    size_t numa_id;
+    if (num_ctx > 1 && executor::GetCPUExecutor().get_num_numa_nodes() > 1 &&
+        try_acquire_on_least_loaded_node(num_ctx, numa_id))
+    {
+        s_preferred_ctx = {this, numa_id};
+        return numa_id;
+    }
+
+    // Fast path: claim any idle context without taking the lock. Start at a rotating offset
+    // so concurrent callers do not all contend on the first context.
+    size_t start = m_next_ctx.fetch_add(1, std::memory_order_relaxed);
+    for (size_t i = 0; i < num_ctx; i++)
+    {
+        size_t id = (start + i) % num_ctx;
+        if (try_acquire_context(id))
+        {
+            s_preferred_ctx = {this, id};
+            return id;
+        }
+    }
+
+    // Slow path: grow the pool if allowed, otherwise wait for a context to be released.
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_num_waiters++;
+    while (true)
+    {
+        num_ctx = m_num_ctx.load(std::memory_order_acquire);
+        for (size_t id = 0; id < num_ctx; id++)
+        {
+            if (try_acquire_context(id))
+            {
+                m_num_waiters--;
+                s_preferred_ctx = {this, id};
+                return id;
+            }
+        }
+
+        if (num_ctx < m_max_ctx)
+        {
+            size_t id = num_ctx;
+            m_ctx_vec[id] = create_runtime_context(id);
+            m_ctx_busy[id] = true;
+            m_num_ctx.store(num_ctx + 1, std::memory_order_release);
+            m_num_waiters--;
+            s_preferred_ctx = {this, id};
+            return id;
+        }
+
+        m_cv.wait(lock);
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::release_context(size_t id)
+{
+    m_ctx_busy[id].store(false, std::memory_order_seq_cst);
+    // A waiter registers itself under the lock before rescanning, so if none is registered
+    // here it is guaranteed to observe the flag cleared above.
+    if (m_num_waiters.load(std::memory_order_seq_cst) > 0)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_cv.notify_one();
     }
 }
 
@@ -118,44 +343,146 @@ void runtime::cpu::CPU_CallFrame::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& output_tvs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& input_tvs)
 {
-    auto id = 0;
-    auto disable_caching = false;
+    bool metrics = Metrics::is_enabled();
+    auto start = std::chrono::steady_clock::now();
+    size_t id = acquire_context();
+    if (metrics)
+    {
+        Metrics::add_counter(
+            "ngraph_context_wait_seconds_total", cpu_metric_labels(), seconds_since(start));
+    }
+    m_last_call = std::chrono::steady_clock::now().time_since_epoch().count();
+
+    auto& workspace = m_external_function->get_workspace();
+    auto ctx = m_ctx_vec[id];
+    ctx->pc = 0;
+    auto& executor = executor::GetCPUExecutor();
+    CallPriority priority = m_priority;
+    if (ctx->priority != priority && m_external_function->is_direct_execution())
+    {
+        ctx->priority = priority;
+        ctx->arena = executor.get_thread_pool(priority, id);
+    }
+    executor.begin_call(priority);
+    try
     {
-        std::unique_lock<std::mutex> lck(m_mutex);
-        while (m_num_ctx_available == 0)
+        // The buffers of a context are reclaimed after it stays idle, see set_idle_timeout
+        if (!workspace && ctx->memory_buffers.empty())
         {
-            m_cv.wait(lck);
+            allocate_memory_buffers(ctx);
         }
+        // Intermediates cached by the context were computed for the batch of its last call
+        bool batch_changed = false;
+        if (m_external_function->is_batch_polymorphic())
+        {
+            size_t batch = m_external_function->get_call_batch_size(output_tvs, input_tvs);
+            batch_changed = batch != ctx->batch_size;
+            ctx->batch_size = batch;
+        }
+        // A smaller batch than compiled gives the batched tensors other shapes than their
+        // parameters and results. They keep their native layouts.
+        bool reshaped = ctx->batch_size != m_external_function->get_batch_size();
 
-        for (auto i = 0; i < m_num_ctx; i++)
+        if (workspace)
         {
-            if (m_id_pool[i])
+            ctx->memory_buffers =
+                workspace->acquire(m_external_function->get_memory_buffer_sizes());
+        }
+        // Inputs are brought into their parameters' layouts before the outputs take the
+        // results' layouts, as a persistent tensor can be both
+        auto& parameter_layouts = m_external_function->get_parameter_layout_descriptors();
+        for (size_t i = 0; i < input_tvs.size() && i < parameter_layouts.size(); i++)
+        {
+            if (!reshaped || !m_external_function->is_batched_input(i))
             {
-                id = i;
-                break;
+                static_pointer_cast<runtime::cpu::CPUTensorView>(input_tvs[i])
+                    ->convert_layout(parameter_layouts[i]);
             }
         }
-        NGRAPH_CHECK(id != m_num_ctx);
-        m_id_pool[id] = false;
-        if (id != m_prev_ctx)
+        auto& result_layouts = m_external_function->get_result_layout_descriptors();
+        if (!reshaped)
+        {
+            propagate_layouts(output_tvs, result_layouts);
+        }
+        else
         {
-            // Disable caching since staleness hints are no longer
-            // applicable to this context
-            disable_caching = true;
+            for (size_t i = 0; i < output_tvs.size(); i++)
+            {
+                if (!m_external_function->is_batched_output(i))
+                {
+                    propagate_layouts({output_tvs[i]}, {result_layouts[i]});
+                }
+            }
         }
-        m_prev_ctx = id;
-        m_num_ctx_available--;
+        inner_call(output_tvs, input_tvs, id, batch_changed);
+    }
+    catch (...)
+    {
+        if (workspace)
+        {
+            workspace->release(ctx->memory_buffers);
+        }
+        executor.end_call(priority);
+        release_context(id);
+        if (metrics)
+        {
+            Metrics::add_counter("ngraph_call_errors_total", cpu_metric_labels(), 1);
+        }
+        throw;
+    }
+
+    if (workspace)
+    {
+        workspace->release(ctx->memory_buffers);
+    }
+    executor.end_call(priority);
+    m_last_call = std::chrono::steady_clock::now().time_since_epoch().count();
+    release_context(id);
+    if (metrics)
+    {
+        Metrics::observe("ngraph_call_duration_seconds", cpu_metric_labels(), seconds_since(start));
+    }
+}
+
+void runtime::cpu::CPU_CallFrame::prepare()
+{
+    // Codegen builds its primitives when its single context is initialized
+    if (!m_external_function->is_direct_execution())
+    {
+        return;
     }
 
-    m_ctx_vec[id]->pc = 0;
-    propagate_layouts(output_tvs, m_external_function->get_result_layout_descriptors());
-    inner_call(output_tvs, input_tvs, id, disable_caching);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        size_t num_ctx = m_num_ctx.load(std::memory_order_acquire);
+        for (size_t id = num_ctx; id < m_max_ctx; id++)
+        {
+            m_ctx_vec[id] = create_runtime_context(id);
+            m_ctx_busy[id] = false;
+        }
+        if (m_max_ctx > num_ctx)
+        {
+            m_num_ctx.store(m_max_ctx, std::memory_order_release);
+        }
+    }
+
+    size_t num_ctx = m_num_ctx.load(std::memory_order_acquire);
+    tbb::task_group contexts;
+    for (size_t id = 0; id < num_ctx; id++)
+    {
+        auto ctx = m_ctx_vec[id];
+        contexts.run([this, ctx]() { m_external_function->prepare_context(ctx); });
+    }
+    contexts.wait();
+    m_external_function->compute_shared_values(m_ctx_vec[0]);
+}
 
-    m_mutex.lock();
-    m_id_pool[id] = true;
-    m_num_ctx_available++;
-    m_mutex.unlock();
-    m_cv.notify_one();
+void runtime::cpu::CPU_CallFrame::update_shared_values()
+{
+    if (m_external_function->has_shared_values())
+    {
+        m_external_function->compute_shared_values(m_ctx_vec[0]);
+    }
 }
 
 void runtime::cpu::CPU_CallFrame::propagate_layouts(
@@ -178,82 +505,246 @@ void runtime::cpu::CPU_CallFrame::propagate_layouts(
     }
 }
 
-void runtime::cpu::CPU_CallFrame::setup_runtime_context()
+runtime::cpu::CPURuntimeContext* runtime::cpu::CPU_CallFrame::create_runtime_context(size_t id)
 {
-    for (auto i = 0; i < m_num_ctx; i++)
+    auto ctx = new CPURuntimeContext;
+    auto& executor = executor::GetCPUExecutor();
+
+    ctx->pc = 0;
+    // Spread contexts over the thread pools of their priority, and so over the NUMA nodes, when
+    // the executor has bound its pools to nodes. Generated code always uses the first pool.
+    ctx->priority = m_priority;
+    ctx->arena = m_external_function->is_direct_execution()
+                     ? executor.get_thread_pool(ctx->priority, id)
+                     : 0;
+    ctx->op_durations = nullptr;
+    ctx->latencies = nullptr;
+    ctx->latency_calls = 0;
+    ctx->sampled_latencies = nullptr;
+    // DEX records op events itself; generated code only fills in durations
+    if (runtime::cpu::IsTracingEnabled() && !m_external_function->is_direct_execution())
     {
-        m_id_pool[i] = true;
-        auto ctx = new CPURuntimeContext;
-        m_ctx_vec.push_back(ctx);
+        ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
+    }
+    size_t num_inputs = m_external_function->get_parameter_layout_descriptors().size();
+    ctx->p_en = new bool[num_inputs];
+    // Version 0 is never assigned to a tensor, so the first call sees every input as changed
+    ctx->p_versions = new size_t[num_inputs]();
+    ctx->c_versions = new size_t[m_external_function->get_updatable_constant_count()]();
+    ctx->t_en = new bool[m_external_function->get_tensor_stale_count()]();
+    ctx->distributed_requests.resize(m_external_function->get_distributed_request_count());
+    ctx->batch_size = m_external_function->get_batch_size();
 
-        ctx->pc = 0;
-        ctx->op_durations = nullptr;
-        if (runtime::cpu::IsTracingEnabled())
-        {
-            ctx->op_durations = new int64_t[m_external_function->get_op_attrs().size()];
-        }
-        ctx->p_en = new bool[m_external_function->get_parameter_layout_descriptors().size()];
+    ctx->first_iteration = true;
+    ctx->prepared = false;
+
+    ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+
+    // Create temporary buffer pools, unless they are borrowed from a workspace for each call
+    if (m_external_function->get_workspace() == nullptr)
+    {
+        allocate_memory_buffers(ctx);
+    }
+    const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
 
-        ctx->first_iteration = true;
+    if (m_external_function->is_direct_execution())
+    {
+        ctx->mkldnn_primitives =
+            std::vector<mkldnn::primitive*>(mkldnn_emitter->get_mkldnn_primitives().size());
+    }
+    else
+    {
+        // single thread for codegen
+        NGRAPH_CHECK(m_ctx_capacity == 1);
+        ctx->mkldnn_primitives.swap(mkldnn_emitter->get_mkldnn_primitives());
+        ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces();
+    }
 
-        ctx->buffer_data = std::vector<void*>(m_external_function->get_buffer_size());
+    ctx->states = m_external_function->m_states.data();
 
-        // Create temporary buffer pools
-        size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
-        for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+    if (m_external_function->is_direct_execution() &&
+        std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
+    {
+        // For codegen mode, graph and global control are now part of the code generated
+        // CPURuntimeContextCG class.
+        ctx->G = new tbb::flow::graph;
+        const auto parallelism = executor::get_threading_config().inter_op_pools;
+        ctx->c =
+            new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
+    }
+
+    return ctx;
+}
+
+void runtime::cpu::CPU_CallFrame::allocate_memory_buffers(CPURuntimeContext* ctx)
+{
+    auto& executor = executor::GetCPUExecutor();
+    bool numa = executor.get_num_numa_nodes() > 1 && m_external_function->is_direct_execution();
+    size_t alignment = runtime::cpu::CPU_ExternalFunction::s_memory_pool_alignment;
+    for (auto buffer_size : m_external_function->get_memory_buffer_sizes())
+    {
+        auto buffer = new AlignedBuffer(buffer_size, alignment);
+        ctx->memory_buffers.push_back(buffer);
+        m_resident_bytes += buffer_size;
+        s_arena_bytes += buffer_size;
+        if (numa)
         {
-            auto buffer = new AlignedBuffer(buffer_size, alignment);
-            ctx->memory_buffers.push_back(buffer);
+            // Pages are placed on the node of the thread that first touches them
+            executor.run_on_node(ctx->arena, [buffer, buffer_size]() {
+                memset(buffer->get_ptr(), 0, buffer_size);
+            });
         }
-        const auto& mkldnn_emitter = m_external_function->get_mkldnn_emitter();
+    }
+    report_arena_bytes();
+}
+
+size_t runtime::cpu::CPU_CallFrame::release_memory_buffers(CPURuntimeContext* ctx)
+{
+    size_t released = 0;
+    for (auto buffer : ctx->memory_buffers)
+    {
+        released += buffer->size();
+        delete buffer;
+    }
+    ctx->memory_buffers.clear();
+    m_resident_bytes -= released;
+    s_arena_bytes -= released;
+    report_arena_bytes();
+
+    // The intermediates cached in the buffers are lost, so the next call on the context sees
+    // every input and constant as changed: version 0 is never assigned to a tensor, and no
+    // constant is updated that many times
+    size_t num_inputs = m_external_function->get_parameter_layout_descriptors().size();
+    std::fill(ctx->p_versions, ctx->p_versions + num_inputs, 0);
+    std::fill(ctx->c_versions,
+              ctx->c_versions + m_external_function->get_updatable_constant_count(),
+              std::numeric_limits<size_t>::max());
+    return released;
+}
 
-        if (m_external_function->is_direct_execution())
+size_t runtime::cpu::CPU_CallFrame::reclaim_memory(bool keep_constant_values)
+{
+    // Generated code computes the values derived from constants on its first call only, and
+    // workspace buffers are only held during calls
+    if (!m_external_function->is_direct_execution() ||
+        m_external_function->get_workspace() != nullptr)
+    {
+        return 0;
+    }
+
+    // Only the contexts that are not running a call are reclaimed
+    size_t num_ctx = m_num_ctx.load(std::memory_order_acquire);
+    vector<size_t> held;
+    for (size_t id = 0; id < num_ctx; id++)
+    {
+        if (try_acquire_context(id))
         {
-            ctx->mkldnn_primitives =
-                std::vector<mkldnn::primitive*>(mkldnn_emitter->get_mkldnn_primitives().size());
+            held.push_back(id);
         }
-        else
+    }
+
+    size_t reclaimed = 0;
+    for (auto id : held)
+    {
+        reclaimed += release_memory_buffers(m_ctx_vec[id]);
+    }
+    if (!keep_constant_values)
+    {
+        // Without shared values each context computes the values derived from constants in
+        // its own buffers again, so all of them must have been reset. Holding the lock keeps
+        // new contexts from being created meanwhile.
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (held.size() == m_num_ctx.load(std::memory_order_acquire))
         {
-            // single thread for codegen
-            NGRAPH_CHECK(m_num_ctx == 1);
-            ctx->mkldnn_primitives.swap(mkldnn_emitter->get_mkldnn_primitives());
-            ctx->mkldnn_workspaces = mkldnn_emitter->get_mkldnn_workspaces();
+            reclaimed += m_external_function->release_shared_values();
         }
+    }
+    for (auto id : held)
+    {
+        release_context(id);
+    }
 
-        ctx->states = m_external_function->m_states.data();
+    m_reclaimed_bytes += reclaimed;
+    return reclaimed;
+}
 
-        if (m_external_function->is_direct_execution() &&
-            std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
-        {
-            // For codegen mode, graph and global control are now part of the code generated
-            // CPURuntimeContextCG class.
-            ctx->G = new tbb::flow::graph;
-            const auto envParallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
-            const auto parallelism = envParallelism == nullptr ? 1 : std::atoi(envParallelism);
-            ctx->c =
-                new tbb::global_control(tbb::global_control::max_allowed_parallelism, parallelism);
-        }
+void runtime::cpu::CPU_CallFrame::set_priority(CallPriority priority)
+{
+    m_priority = priority;
+}
+
+void runtime::cpu::CPU_CallFrame::set_idle_timeout(std::chrono::milliseconds timeout,
+                                                   bool keep_constant_values)
+{
+    m_keep_constant_values_when_idle = keep_constant_values;
+    m_idle_timeout_ms = timeout.count();
+    if (timeout.count() > 0)
+    {
+        IdleReclaimer::get().add(this);
+    }
+    else if (m_idle_timeout_registered)
+    {
+        IdleReclaimer::get().remove(this);
     }
-    m_num_ctx_available = m_num_ctx;
+    m_idle_timeout_registered = timeout.count() > 0;
+}
+
+std::chrono::milliseconds
+    runtime::cpu::CPU_CallFrame::reclaim_if_idle(std::chrono::steady_clock::time_point now)
+{
+    std::chrono::milliseconds timeout(m_idle_timeout_ms.load());
+    if (timeout.count() <= 0)
+    {
+        return std::chrono::hours(1);
+    }
+    auto idle = now - std::chrono::steady_clock::time_point(
+                          std::chrono::steady_clock::duration(m_last_call.load()));
+    if (idle >= timeout)
+    {
+        reclaim_memory(m_keep_constant_values_when_idle);
+        return timeout;
+    }
+    return std::chrono::duration_cast<std::chrono::milliseconds>(timeout - idle) +
+           std::chrono::milliseconds(1);
+}
+
+size_t runtime::cpu::CPU_CallFrame::get_resident_bytes() const
+{
+    return m_resident_bytes + m_external_function->get_shared_values_size();
+}
+
+void runtime::cpu::CPU_CallFrame::setup_runtime_context()
+{
+    // Contexts beyond the first are created on demand by acquire_context, except that the
+    // NGRAPH_CPU_CONCURRENCY contexts requested up front are preallocated.
+    size_t num_ctx = m_max_ctx;
+    for (size_t i = 0; i < num_ctx; i++)
+    {
+        m_ctx_vec[i] = create_runtime_context(i);
+        m_ctx_busy[i] = false;
+    }
+    m_num_ctx.store(num_ctx, std::memory_order_release);
 }
 
 void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
 {
-    for (auto i = 0; i < m_num_ctx; i++)
+    size_t num_ctx = m_num_ctx.exchange(0);
+    for (size_t i = 0; i < num_ctx; i++)
     {
-        auto ctx = m_ctx_vec.back();
-        m_ctx_vec.pop_back();
+        auto ctx = m_ctx_vec[i];
+        m_ctx_vec[i] = nullptr;
 
+        release_memory_buffers(ctx);
         delete[] ctx->op_durations;
+        delete ctx->latencies.load();
         delete[] ctx->p_en;
+        delete[] ctx->p_versions;
+        delete[] ctx->c_versions;
+        delete[] ctx->t_en;
         for (auto p : ctx->mkldnn_primitives)
         {
             delete p;
         }
-        for (auto buffer : ctx->memory_buffers)
-        {
-            delete buffer;
-        }
         if (m_external_function->is_direct_execution() &&
             std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
         {
@@ -276,5 +767,4 @@ void runtime::cpu::CPU_CallFrame::cleanup_runtime_context()
         }
         delete ctx;
     }
-    m_num_ctx_available = 0;
 }
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <functional>
 #include <memory>
@@ -24,6 +26,7 @@
 #include <vector>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/cpu/cpu_latency_histogram.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_runtime_context.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -75,6 +78,61 @@ namespace ngraph
                 void setup_cg_runtime_context();
                 void cleanup_runtime_context();
 
+                /// \brief Set the maximum number of runtime contexts, i.e. the number of calls
+                ///        that may execute concurrently. Contexts are created on demand, so
+                ///        raising the limit is cheap; lowering it below the number of contexts
+                ///        already created has no effect. Defaults to NGRAPH_CPU_CONCURRENCY.
+                void set_concurrency(size_t num_ctx);
+                size_t get_concurrency() const;
+
+                /// \brief When enabled, a calling thread first tries to reuse the runtime
+                ///        context it used last. This keeps per-context state (cached
+                ///        intermediates, first-iteration primitives, cache-resident buffers) with
+                ///        the thread that warmed it up.
+                void set_context_affinity(bool enable) { m_ctx_affinity = enable; }
+                bool get_context_affinity() const { return m_ctx_affinity; }
+
+                /// \brief Set the priority of the calls that start from now on. A DEX call
+                ///        waits between its ops while calls of a higher priority run, from
+                ///        any executable, and CallPriority::High calls run on the thread
+                ///        pools reserved by executor::ThreadingConfig::reserved_pools.
+                void set_priority(CallPriority priority);
+                CallPriority get_priority() const { return m_priority; }
+
+                /// \brief Merge the sampled latency histograms of all runtime contexts.
+                /// \param reset Zero the histograms once they are read
+                LatencyReport get_latency_report(bool reset);
+
+                /// \brief Create the contexts allowed by the concurrency, build their MKL-DNN
+                ///        primitives in parallel, and compute the values shared by all the
+                ///        contexts (see CPU_ExternalFunction::compute_shared_values). DEX only;
+                ///        no call may be running.
+                void prepare();
+                /// \brief Compute the shared values again after constants were updated, if
+                ///        prepare() computed them
+                void update_shared_values();
+
+                /// \brief Free the temporary buffers of the contexts that are not running a
+                ///        call. A context allocates them again on its next call, and recomputes
+                ///        the intermediates it had cached in them. DEX only.
+                /// \param keep_constant_values Keep the values prepare() computed from
+                ///        constants alone. Otherwise they are freed too, provided that no
+                ///        call is running, and each context computes them again.
+                /// \returns The number of bytes freed
+                size_t reclaim_memory(bool keep_constant_values);
+                /// \brief Reclaim the memory, as reclaim_memory does, once no call has started
+                ///        or ended for `timeout`; 0 disables it. A single background thread
+                ///        checks every call frame given a timeout.
+                void set_idle_timeout(std::chrono::milliseconds timeout,
+                                      bool keep_constant_values);
+                /// \brief Reclaim the memory if the call frame has been idle for its timeout.
+                /// \returns How long to wait before checking again
+                std::chrono::milliseconds
+                    reclaim_if_idle(std::chrono::steady_clock::time_point now);
+                /// \brief Bytes of the temporary buffers and shared values currently allocated
+                size_t get_resident_bytes() const;
+                /// \brief Bytes freed by reclaim_memory so far
+                size_t get_reclaimed_bytes() const { return m_reclaimed_bytes; }
             protected:
                 CPU_CallFrame(const CPU_CallFrame&) = delete;
                 CPU_CallFrame(CPU_CallFrame&&) = delete;
@@ -85,16 +143,44 @@ namespace ngraph
                                 const size_t id,
                                 const bool disable_caching = true);
 
+                CPURuntimeContext* create_runtime_context(size_t id);
+                void allocate_memory_buffers(CPURuntimeContext* ctx);
+                // Frees the context's temporary buffers and invalidates what it cached in them
+                size_t release_memory_buffers(CPURuntimeContext* ctx);
+                bool try_acquire_context(size_t id);
+                bool try_acquire_on_least_loaded_node(size_t num_ctx, size_t& id);
+                size_t acquire_context();
+                void release_context(size_t id);
+
                 std::shared_ptr<CPU_ExternalFunction> m_external_function;
 
-                std::mutex m_mutex;
+                // Runtime contexts are claimed by flipping their m_ctx_busy flag, so the common
+                // case of a call finding an idle context needs no lock. m_ctx_vec and
+                // m_ctx_busy are allocated up front with room for m_ctx_capacity entries and
+                // never reallocated; m_num_ctx is published only after the new context is fully
+                // constructed, so readers never observe a partially built context. m_mutex
+                // guards context creation and the slow path where a caller has to wait for a
+                // context to be released.
+                mutable std::mutex m_mutex;
                 std::condition_variable m_cv;
-                volatile size_t m_num_ctx_available = 0;
-                size_t m_prev_ctx = 0;
-                size_t m_num_ctx = 1;
-                std::unordered_map<size_t, bool> m_id_pool;
+                std::atomic<size_t> m_num_waiters{0};
+                std::atomic<size_t> m_num_ctx{0};
+                std::atomic<size_t> m_next_ctx{0};
+                std::atomic<bool> m_ctx_affinity{false};
+                std::atomic<CallPriority> m_priority{CallPriority::Normal};
+                size_t m_max_ctx = 1;
+                size_t m_ctx_capacity = 1;
+                std::unique_ptr<std::atomic<bool>[]> m_ctx_busy;
                 std::vector<CPURuntimeContext*> m_ctx_vec;
 
+                // Time of the last call start or end, as a steady_clock count
+                std::atomic<std::chrono::steady_clock::rep> m_last_call{0};
+                std::atomic<int64_t> m_idle_timeout_ms{0};
+                std::atomic<bool> m_keep_constant_values_when_idle{true};
+                bool m_idle_timeout_registered = false;
+                std::atomic<size_t> m_resident_bytes{0};
+                std::atomic<size_t> m_reclaimed_bytes{0};
+
                 /* Codegen specific */
 
                 /// Function that initializes the context used in codegen mode.
@@ -0,0 +1,37 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Priority classes of calls sharing the CPU executor. A DEX call waits between its
+            // ops while calls of a higher priority run, and high priority calls may have
+            // thread pools of their own, see executor::ThreadingConfig::reserved_pools.
+            enum class CallPriority
+            {
+                High,
+                Normal,
+                Low
+            };
+        }
+    }
+}
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/runtime/cpu/cpu_constant_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// FNV-1a over the bytes of a buffer
+static size_t hash_bytes(const runtime::AlignedBuffer& buffer)
+{
+    const unsigned char* bytes = static_cast<const unsigned char*>(buffer.get_ptr());
+    uint64_t hash = 14695981039346656037ULL;
+    for (size_t i = 0; i < buffer.size(); i++)
+    {
+        hash = (hash ^ bytes[i]) * 1099511628211ULL;
+    }
+    return static_cast<size_t>(hash);
+}
+
+void runtime::cpu::CPU_ConstantPool::share(op::Constant& constant)
+{
+    const shared_ptr<AlignedBuffer>& data = constant.get_data_buffer();
+    if (data == nullptr || data->size() == 0)
+    {
+        return;
+    }
+    size_t hash = hash_bytes(*data);
+
+    lock_guard<mutex> lock(m_mutex);
+    auto range = m_buffers.equal_range(hash);
+    for (auto it = range.first; it != range.second;)
+    {
+        auto buffer = it->second.lock();
+        if (buffer == nullptr)
+        {
+            it = m_buffers.erase(it);
+            continue;
+        }
+        if (buffer == data)
+        {
+            return;
+        }
+        if (buffer->size() == data->size() &&
+            memcmp(buffer->get_ptr(), data->get_ptr(), data->size()) == 0)
+        {
+            constant.share_data(buffer);
+            return;
+        }
+        ++it;
+    }
+    m_buffers.emplace(hash, data);
+}
+
+size_t runtime::cpu::CPU_ConstantPool::get_shared_size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    size_t size = 0;
+    for (auto& entry : m_buffers)
+    {
+        if (auto buffer = entry.second.lock())
+        {
+            size += buffer->size();
+        }
+    }
+    return size;
+}
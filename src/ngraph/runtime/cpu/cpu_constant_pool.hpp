@@ -0,0 +1,55 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Constant data shared by the executables that CPU_Backend compiles as one group.
+            //
+            // Each executable adds its constants once its compilation passes have run, so
+            // weights already reordered into their MKL-DNN layouts are compared too. A constant
+            // whose bytes equal those of a constant added before takes over that constant's
+            // buffer, and the group keeps one copy of each distinct weight.
+            class CPU_ConstantPool
+            {
+            public:
+                // Makes `constant` share the data of an equal constant of the pool, or adds
+                // its data to the pool if there is none
+                void share(op::Constant& constant);
+
+                // Bytes of the distinct constant data still alive in the pool
+                size_t get_shared_size() const;
+
+            private:
+                mutable std::mutex m_mutex;
+                // Buffers by hash of their bytes. Entries do not keep their buffer alive.
+                std::unordered_multimap<size_t, std::weak_ptr<AlignedBuffer>> m_buffers;
+            };
+        }
+    }
+}
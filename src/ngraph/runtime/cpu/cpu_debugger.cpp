@@ -41,6 +41,9 @@ void runtime::cpu::CPU_CountTracepoint::operator()(void** outputs, const std::st
 runtime::cpu::CPU_Debugger::CPU_Debugger(ngraph::runtime::cpu::CPU_CallFrame& callframe)
     : m_callframe(callframe)
 {
+    // Stepping keeps intermediates in the first context between calls
+    NGRAPH_CHECK(m_callframe.m_external_function->get_workspace() == nullptr,
+                 "Cannot debug an executable that uses a shared workspace");
 }
 
 runtime::cpu::CPU_Debugger::~CPU_Debugger()
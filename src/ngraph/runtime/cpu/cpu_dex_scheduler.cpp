@@ -0,0 +1,252 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_dex_scheduler.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    struct WorkerQueue
+    {
+        mutex queue_mutex;
+        deque<size_t> ops;
+    };
+
+    // State shared by the workers of one DEXScheduler::run. Helper threads hold a reference
+    // to it, since they may only get to run after every op has completed.
+    struct RunState
+    {
+        RunState(size_t num_ops, size_t num_workers)
+            : pending(new atomic<size_t>[num_ops])
+            , queues(num_workers)
+        {
+        }
+
+        // Number of predecessors of each op that have not completed yet
+        unique_ptr<atomic<size_t>[]> pending;
+        vector<WorkerQueue> queues;
+        atomic<size_t> remaining{0};
+        atomic<size_t> in_flight{0};
+        atomic<bool> failed{false};
+        mutex error_mutex;
+        exception_ptr error;
+    };
+}
+
+void runtime::cpu::DEXScheduler::set_num_ops(size_t num_ops)
+{
+    m_successors.assign(num_ops, {});
+    m_num_predecessors.assign(num_ops, 0);
+    m_costs.assign(num_ops, 1);
+    m_priorities.clear();
+    m_roots.clear();
+}
+
+void runtime::cpu::DEXScheduler::add_dependency(size_t from, size_t to)
+{
+    NGRAPH_CHECK(from < get_num_ops() && to < get_num_ops() && from != to);
+    auto& successors = m_successors[from];
+    if (find(successors.begin(), successors.end(), to) == successors.end())
+    {
+        successors.push_back(to);
+        m_num_predecessors[to]++;
+    }
+}
+
+void runtime::cpu::DEXScheduler::set_cost(size_t op, size_t cost)
+{
+    m_costs.at(op) = max<size_t>(cost, 1);
+}
+
+void runtime::cpu::DEXScheduler::finalize()
+{
+    size_t num_ops = get_num_ops();
+
+    // Topological order, then priorities from the end of the graph backwards
+    vector<size_t> order;
+    vector<size_t> pending(m_num_predecessors);
+    for (size_t op = 0; op < num_ops; op++)
+    {
+        if (pending[op] == 0)
+        {
+            order.push_back(op);
+        }
+    }
+    for (size_t i = 0; i < order.size(); i++)
+    {
+        for (size_t successor : m_successors[order[i]])
+        {
+            if (--pending[successor] == 0)
+            {
+                order.push_back(successor);
+            }
+        }
+    }
+    NGRAPH_CHECK(order.size() == num_ops, "DEX op dependencies contain a cycle");
+
+    m_priorities.assign(num_ops, 0);
+    for (auto it = order.rbegin(); it != order.rend(); ++it)
+    {
+        size_t longest_tail = 0;
+        for (size_t successor : m_successors[*it])
+        {
+            longest_tail = max(longest_tail, m_priorities[successor]);
+        }
+        m_priorities[*it] = m_costs[*it] + longest_tail;
+    }
+
+    m_roots.clear();
+    for (size_t op = 0; op < num_ops; op++)
+    {
+        if (m_num_predecessors[op] == 0)
+        {
+            m_roots.push_back(op);
+        }
+    }
+    auto by_priority = [this](size_t a, size_t b) { return m_priorities[a] < m_priorities[b]; };
+    stable_sort(m_roots.begin(), m_roots.end(), by_priority);
+}
+
+void runtime::cpu::DEXScheduler::run(size_t num_workers,
+                                     const function<void(size_t)>& run_op) const
+{
+    size_t num_ops = get_num_ops();
+    NGRAPH_CHECK(m_priorities.size() == num_ops, "DEXScheduler::finalize was not called");
+    if (num_ops == 0)
+    {
+        return;
+    }
+    num_workers = max<size_t>(1, min(num_workers, num_ops));
+
+    auto state = make_shared<RunState>(num_ops, num_workers);
+    for (size_t op = 0; op < num_ops; op++)
+    {
+        state->pending[op] = m_num_predecessors[op];
+    }
+    state->remaining = num_ops;
+    // Deal the roots out so that each queue is in increasing priority order
+    for (size_t i = 0; i < m_roots.size(); i++)
+    {
+        state->queues[i % num_workers].ops.push_back(m_roots[i]);
+    }
+
+    auto pop = [state, num_workers](size_t worker, size_t& op) {
+        {
+            WorkerQueue& own = state->queues[worker];
+            lock_guard<mutex> lock(own.queue_mutex);
+            if (!own.ops.empty())
+            {
+                op = own.ops.back();
+                own.ops.pop_back();
+                return true;
+            }
+        }
+        for (size_t i = 1; i < num_workers; i++)
+        {
+            WorkerQueue& victim = state->queues[(worker + i) % num_workers];
+            lock_guard<mutex> lock(victim.queue_mutex);
+            if (!victim.ops.empty())
+            {
+                op = victim.ops.front();
+                victim.ops.pop_front();
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // Ops are only popped while some remain, and every access to the scheduler and to run_op
+    // happens before the op's completion is counted, so neither is touched once run returns.
+    auto work = [this, state, pop, &run_op](size_t worker) {
+        vector<size_t> ready;
+        while (state->remaining.load() != 0 && !state->failed.load())
+        {
+            state->in_flight++;
+            size_t op;
+            if (state->failed.load() || !pop(worker, op))
+            {
+                state->in_flight--;
+                this_thread::yield();
+                continue;
+            }
+
+            try
+            {
+                run_op(op);
+            }
+            catch (...)
+            {
+                lock_guard<mutex> lock(state->error_mutex);
+                if (!state->error)
+                {
+                    state->error = current_exception();
+                }
+                state->failed = true;
+            }
+
+            ready.clear();
+            for (size_t successor : m_successors[op])
+            {
+                if (state->pending[successor].fetch_sub(1) == 1)
+                {
+                    ready.push_back(successor);
+                }
+            }
+            if (!ready.empty())
+            {
+                auto by_priority = [this](size_t a, size_t b) {
+                    return m_priorities[a] < m_priorities[b];
+                };
+                sort(ready.begin(), ready.end(), by_priority);
+                WorkerQueue& own = state->queues[worker];
+                lock_guard<mutex> lock(own.queue_mutex);
+                own.ops.insert(own.ops.end(), ready.begin(), ready.end());
+            }
+            state->remaining--;
+            state->in_flight--;
+        }
+    };
+
+    auto& executor = executor::GetCPUExecutor();
+    for (size_t worker = 1; worker < num_workers; worker++)
+    {
+        executor.schedule_dex_worker([work, worker]() { work(worker); });
+    }
+    work(0);
+
+    // After a failure, wait for ops still running on helpers before unwinding
+    while (state->in_flight.load() != 0)
+    {
+        this_thread::yield();
+    }
+    if (state->error)
+    {
+        rethrow_exception(state->error);
+    }
+}
@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Dependency-counting, work-stealing scheduler for the ops of a DEX executor.
+            //
+            // Ops are identified by their index in the executor's functor list. An op becomes
+            // ready once all of its predecessors have run. Each worker keeps its own deque of
+            // ready ops and runs the most recently readied, highest priority op first; a worker
+            // that runs out of work steals the oldest op from another worker's deque.
+            class DEXScheduler
+            {
+            public:
+                DEXScheduler() = default;
+
+                // Adds an edge so that op `to` only runs after op `from` has completed.
+                void add_dependency(size_t from, size_t to);
+                // Sets the estimated cost of running op `op`, used to order ready ops.
+                void set_cost(size_t op, size_t cost);
+                // Sets the number of ops; must be called before adding dependencies or costs.
+                void set_num_ops(size_t num_ops);
+                size_t get_num_ops() const { return m_successors.size(); }
+                // Computes op priorities (the cost of the most expensive path from each op to
+                // the end of the graph). Must be called once all dependencies have been added.
+                void finalize();
+
+                // Runs every op once, calling `run_op(index)` on the calling thread and up to
+                // `num_workers - 1` helper threads from the CPU executor. Returns once every
+                // op has run. If an op throws, no new ops are started and the first exception
+                // is rethrown once running ops have finished.
+                void run(size_t num_workers, const std::function<void(size_t)>& run_op) const;
+
+            private:
+                std::vector<std::vector<size_t>> m_successors;
+                std::vector<size_t> m_num_predecessors;
+                std::vector<size_t> m_costs;
+                std::vector<size_t> m_priorities;
+                // Ops without predecessors, highest priority last
+                std::vector<size_t> m_roots;
+            };
+        }
+    }
+}
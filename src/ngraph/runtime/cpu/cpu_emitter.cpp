@@ -27,6 +27,7 @@
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/all.hpp"
+#include "ngraph/op/allgather.hpp"
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/and.hpp"
 #include "ngraph/op/any.hpp"
@@ -53,6 +54,7 @@
 #include "ngraph/op/erf.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/op/experimental/dropout.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/quantized_avg_pool.hpp"
 #include "ngraph/op/experimental/quantized_concat.hpp"
@@ -63,7 +65,10 @@
 #include "ngraph/op/experimental/quantized_max_pool.hpp"
 #include "ngraph/op/floor.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
+#include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/gather_nd.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -90,6 +95,8 @@
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/reducescatter.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
@@ -97,6 +104,7 @@
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
 #include "ngraph/op/select.hpp"
+#include "ngraph/op/send.hpp"
 #include "ngraph/op/sign.hpp"
 #include "ngraph/op/sin.hpp"
 #include "ngraph/op/sinh.hpp"
@@ -206,6 +214,22 @@ namespace ngraph
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::AllReduce)
             {
+                auto all_reduce = static_cast<const ngraph::op::AllReduce*>(node);
+                if (all_reduce->is_compressed())
+                {
+                    writer.block_begin();
+                    // function-local static so the rounding error survives between calls
+                    writer << "static std::vector<float> error_feedback(" << out[0].get_size()
+                           << ");\n";
+                    writer << "ngraph::get_distributed_interface()->compressed_all_reduce("
+                           << "static_cast<const float*>(" << args[0].get_name() << "), "
+                           << "static_cast<float*>(" << out[0].get_name() << "), "
+                           << "ngraph::element::Type_t::"
+                           << all_reduce->get_compressed_type().get_type_name() << ", "
+                           << out[0].get_size() << ", error_feedback.data());\n";
+                    writer.block_end();
+                    return;
+                }
                 writer << "ngraph::get_distributed_interface()->all_reduce(" << args[0].get_name()
                        << ", " << out[0].get_name() << ", "
                        << "ngraph::element::Type_t::" << args[0].get_element_type().get_type_name()
@@ -221,6 +245,51 @@ namespace ngraph
                        << ", " << args[0].get_size() << ");\n;";
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::AllGather)
+            {
+                writer << "ngraph::get_distributed_interface()->all_gather(" << args[0].get_name()
+                       << ", " << out[0].get_name() << ", "
+                       << "ngraph::element::Type_t::" << args[0].get_element_type().get_type_name()
+                       << ", " << args[0].get_size() << ");\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::ReduceScatter)
+            {
+                writer << "ngraph::get_distributed_interface()->reduce_scatter("
+                       << args[0].get_name() << ", " << out[0].get_name() << ", "
+                       << "ngraph::element::Type_t::" << args[0].get_element_type().get_type_name()
+                       << ", " << out[0].get_size() << ");\n";
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Send)
+            {
+                auto send = static_cast<const ngraph::op::Send*>(node);
+                writer << "ngraph::get_distributed_interface()->send(" << args[0].get_name()
+                       << ", "
+                       << "ngraph::element::Type_t::" << args[0].get_element_type().get_type_name()
+                       << ", " << args[0].get_size() << ", " << send->get_dest_rank() << ", "
+                       << send->get_tag() << ");\n";
+                if (args[0].get_name() != out[0].get_name())
+                {
+                    writer << "memcpy(" << out[0].get_name() << ", " << args[0].get_name() << ", "
+                           << out[0].get_size() * out[0].get_element_type().size() << ");\n";
+                }
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Recv)
+            {
+                auto recv = static_cast<const ngraph::op::Recv*>(node);
+                writer << "ngraph::get_distributed_interface()->recv(" << out[0].get_name()
+                       << ", "
+                       << "ngraph::element::Type_t::" << out[0].get_element_type().get_type_name()
+                       << ", " << out[0].get_size() << ", " << recv->get_src_rank() << ", "
+                       << recv->get_tag() << ");\n";
+            }
+
             static void emitCblasSgemmBatch(CodeWriter& writer,
                                             const Shape& shape_a,
                                             const Shape& shape_b,
@@ -729,8 +798,12 @@ namespace ngraph
                     external_function, writer, node, args, out, true, false);
             }
 
-            template <>
-            void CPU_Emitter::EMITTER_DECL(ngraph::op::BatchNormTrainingBackprop)
+            void CPU_Emitter::emitBatchNormBackprop(CPU_ExternalFunction* external_function,
+                                                    CodeWriter& writer,
+                                                    const ngraph::Node* node,
+                                                    const std::vector<TensorViewWrapper>& args,
+                                                    const std::vector<TensorViewWrapper>& out,
+                                                    bool fused_relu)
             {
                 writer.block_begin();
                 // define weights
@@ -757,8 +830,27 @@ namespace ngraph
                        << args[3].get_name() << ");\n";
                 writer << "cg_ctx->set_memory_ptr(" << to_string(deps[3]) << ", "
                        << args[4].get_name() << ");\n";
-                writer << "cg_ctx->set_memory_ptr(" << to_string(deps[4]) << ", "
-                       << args[5].get_name() << ");\n";
+                if (fused_relu)
+                {
+                    // mask delta with the relu derivative into the input delta, which the
+                    // batchnorm backward primitive then updates in place
+                    size_t count =
+                        node->get_output_tensor_ptr(0)->get_tensor_layout()->get_allocated_size() /
+                        out[0].get_element_type().size();
+                    writer << "#pragma omp parallel for\n";
+                    writer << "for (size_t i = 0; i < " << count << "; i++)\n";
+                    writer.block_begin();
+                    writer << out[0].get_name() << "[i] = " << args[5].get_name() << "[i] > 0 ? "
+                           << args[6].get_name() << "[i] : 0;\n";
+                    writer.block_end();
+                    writer << "cg_ctx->set_memory_ptr(" << to_string(deps[4]) << ", "
+                           << out[0].get_name() << ");\n";
+                }
+                else
+                {
+                    writer << "cg_ctx->set_memory_ptr(" << to_string(deps[4]) << ", "
+                           << args[5].get_name() << ");\n";
+                }
                 writer << "cg_ctx->set_memory_ptr(" << to_string(deps[5]) << ", "
                        << out[0].get_name() << ");\n";
                 writer << "cg_ctx->set_memory_ptr(" << to_string(deps[6])
@@ -775,6 +867,23 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::BatchNormTrainingBackprop)
+            {
+                emitBatchNormBackprop(external_function, writer, node, args, out, false);
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::BatchNormTrainingReluBackprop)
+            {
+                if (!mkldnn_utils::use_mkldnn_kernel(node))
+                {
+                    throw ngraph_error(
+                        "BatchNormReluBackprop is only supported with 4-D MKLDNN kernel.");
+                }
+                emitBatchNormBackprop(external_function, writer, node, args, out, true);
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Dot)
             {
@@ -1551,6 +1660,24 @@ namespace ngraph
                 auto index_type_name = embed->get_argument(0)->get_element_type().c_type_string();
                 auto type_name = embed->get_element_type().c_type_string();
                 auto element_count = shape_size(embed->get_argument(0)->get_shape());
+                if (embed->is_quantized())
+                {
+                    auto weights_type = embed->get_input_element_type(1);
+                    string weights_type_name = weights_type == element::f16
+                                                   ? "ngraph::float16"
+                                                   : weights_type.c_type_string();
+                    writer << "reference::embedding_dequantize<" << type_name << ","
+                           << weights_type_name << "," << index_type_name << ">(";
+                    writer << "            " << args[0].get_name() << ",\n";
+                    writer << "            " << args[1].get_name() << ",\n";
+                    writer << "            " << args[2].get_name() << ",\n";
+                    writer << "            " << args[3].get_name() << ",\n";
+                    writer << "            " << out[0].get_name() << ",\n";
+                    writer << "            " << element_count << ",\n";
+                    writer << "            " << args[1].get_shape().at(1) << ");\n";
+                    writer.block_end();
+                    return;
+                }
                 writer << "reference::embedding<" << type_name << "," << index_type_name << ">(";
                 writer << "            " << args[0].get_name() << ",\n";
                 writer << "            " << args[1].get_name() << ",\n";
@@ -1560,6 +1687,25 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::EmbeddingLookupBackprop)
+            {
+                writer.block_begin();
+                const ngraph::op::EmbeddingLookupBackprop* embed =
+                    static_cast<const ngraph::op::EmbeddingLookupBackprop*>(node);
+                auto index_type_name = embed->get_argument(0)->get_element_type().c_type_string();
+                auto type_name = embed->get_element_type().c_type_string();
+                auto element_count = shape_size(embed->get_argument(0)->get_shape());
+                writer << "reference::embedding_backprop<" << type_name << "," << index_type_name
+                       << ">(";
+                writer << "            " << args[0].get_name() << ",\n";
+                writer << "            " << args[1].get_name() << ",\n";
+                writer << "            " << out[0].get_name() << ",\n";
+                writer << "            " << element_count << ",\n";
+                writer << "            {" << join(out[0].get_shape()) << "});\n";
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Sin)
             {
@@ -3670,6 +3816,8 @@ namespace ngraph
                 auto nege =
                     std::bind(emit_prefix_operator, std::string("-"), std::placeholders::_1);
                 auto sube = std::bind(emit_infix_operator, std::string("-"), std::placeholders::_1);
+                auto mule = std::bind(emit_infix_operator, std::string("*"), std::placeholders::_1);
+                auto dive = std::bind(emit_infix_operator, std::string("/"), std::placeholders::_1);
 
                 return std::unordered_map<
                     std::type_index,
@@ -3681,6 +3829,8 @@ namespace ngraph
                     {TI(ngraph::op::Add), adde},
                     {TI(ngraph::op::Negative), nege},
                     {TI(ngraph::op::Subtract), sube},
+                    {TI(ngraph::op::Multiply), mule},
+                    {TI(ngraph::op::Divide), dive},
                 };
             }
 
@@ -3723,25 +3873,89 @@ namespace ngraph
                 }
 
                 // add outputs so we write output values directly into their
-                // corresponding tensors
+                // corresponding tensors; reductions accumulate into a temp instead and
+                // store it once their inner loop is done
+                std::vector<std::pair<std::string, std::string>> reduction_stores;
                 for (size_t i = 0; i < out.size(); i++)
                 {
-                    std::string sname = std::string(out[i].get_name()) + "[i]";
                     // TODO: no support for multiple-output ops in loop kernel
-                    auto entry = std::make_pair(&output_nodes.at(i)->get_outputs().at(0), sname);
-                    loop_symbol_table.insert(entry);
+                    auto output = &output_nodes.at(i)->get_outputs().at(0);
+                    if (ngraph::runtime::cpu::op::LoopKernel::is_trailing_reduction(
+                            *output_nodes.at(i)))
+                    {
+                        std::string acc = "acc" + std::to_string(reduction_stores.size());
+                        loop_symbol_table.insert(std::make_pair(output, acc));
+                        reduction_stores.push_back(
+                            std::make_pair(std::string(out[i].get_name()) + "[o]", acc));
+                    }
+                    else
+                    {
+                        std::string sname = std::string(out[i].get_name()) + "[i]";
+                        loop_symbol_table.insert(std::make_pair(output, sname));
+                    }
                 }
 
                 std::string tmp_prefix{"tmp"};
+                size_t reduction_size = clk->get_reduction_size();
+                size_t loop_size = shape_size(clk->get_input_shape(0));
 
                 writer << "#pragma omp parallel for\n";
-                writer << "for (size_t i = 0; i < " << out[0].get_size() << "; i++)\n";
-                writer.block_begin();
+                if (reduction_stores.empty())
+                {
+                    writer << "for (size_t i = 0; i < " << loop_size << "; i++)\n";
+                    writer.block_begin();
+                }
+                else
+                {
+                    writer << "for (size_t o = 0; o < " << loop_size / reduction_size
+                           << "; o++)\n";
+                    writer.block_begin();
+                    for (auto& output_node : output_nodes)
+                    {
+                        if (!ngraph::runtime::cpu::op::LoopKernel::is_trailing_reduction(
+                                *output_node))
+                        {
+                            continue;
+                        }
+                        auto et = output_node->get_element_type();
+                        std::string init = "0";
+                        if (output_node->description() == "Max")
+                        {
+                            init = et.is_real() ? "-std::numeric_limits<" + et.c_type_string() +
+                                                      ">::infinity()"
+                                                : "std::numeric_limits<" + et.c_type_string() +
+                                                      ">::lowest()";
+                        }
+                        writer << et.c_type_string() << " "
+                               << loop_symbol_table.at(&output_node->get_outputs().at(0))
+                               << " = " << init << ";\n";
+                    }
+                    writer << "for (size_t j = 0; j < " << reduction_size << "; j++)\n";
+                    writer.block_begin();
+                    writer << "size_t i = o * " << reduction_size << " + j;\n";
+                }
 
                 for (size_t i = 0; i < node_list.size(); i++)
                 {
                     auto op_node = node_list[i];
                     auto op = &op_node->get_outputs().at(0);
+
+                    if (ngraph::runtime::cpu::op::LoopKernel::is_trailing_reduction(*op_node))
+                    {
+                        auto& acc = loop_symbol_table.at(op);
+                        auto& arg = loop_symbol_table.at(
+                            get_goe_input_output(&op_node->get_inputs().at(0).get_output()));
+                        if (op_node->description() == "Max")
+                        {
+                            writer << acc << " = std::max(" << acc << ", " << arg << ");\n";
+                        }
+                        else
+                        {
+                            writer << acc << " += " << arg << ";\n";
+                        }
+                        continue;
+                    }
+
                     std::string tmp;
                     if (loop_symbol_table.count(op) == 0)
                     {
@@ -3782,6 +3996,14 @@ namespace ngraph
                 }
 
                 writer.block_end();
+                if (!reduction_stores.empty())
+                {
+                    for (auto& store : reduction_stores)
+                    {
+                        writer << store.first << " = " << store.second << ";\n";
+                    }
+                    writer.block_end();
+                }
             }
 
             template <>
@@ -3801,6 +4023,94 @@ namespace ngraph
                 writer.block_end();
             }
 
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Dropout)
+            {
+                auto dropout = static_cast<const ngraph::op::Dropout*>(node);
+                writer.block_begin();
+                auto index = external_function->add_state(ngraph::RNGState::create_rng_state(
+                    dropout->get_seed(), dropout->get_keep_probability()));
+                writer << "auto state = static_cast<ngraph::RNGState*>(ctx->states[" << index
+                       << "]);\n";
+                writer << "bool training = static_cast<bool>(" << args[1].get_name() << "[0]);\n";
+                writer << out[1].get_name() << "[0] = training ? state->reserve("
+                       << out[0].get_size() << ") : 0;\n";
+                writer << "reference::dropout(";
+                writer << "            " << args[0].get_name() << ",\n";
+                writer << "            " << out[0].get_name() << ",\n";
+                writer << "            " << out[0].get_size() << ",\n";
+                writer << "            state, " << out[1].get_name() << "[0], training);\n";
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::DropoutBackprop)
+            {
+                auto dropout = static_cast<const ngraph::op::DropoutBackprop*>(node);
+                writer.block_begin();
+                auto index = external_function->add_state(ngraph::RNGState::create_rng_state(
+                    dropout->get_seed(), dropout->get_keep_probability()));
+                writer << "auto state = static_cast<ngraph::RNGState*>(ctx->states[" << index
+                       << "]);\n";
+                writer << "bool training = static_cast<bool>(" << args[1].get_name() << "[0]);\n";
+                writer << "reference::dropout(";
+                writer << "            " << args[0].get_name() << ",\n";
+                writer << "            " << out[0].get_name() << ",\n";
+                writer << "            " << out[0].get_size() << ",\n";
+                writer << "            state, " << args[2].get_name() << "[0], training);\n";
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::ScaledDotProductAttention)
+            {
+                auto attention = static_cast<const ngraph::op::ScaledDotProductAttention*>(node);
+                writer.block_begin();
+                writer << "reference::scaled_dot_product_attention<" << args[0].get_type()
+                       << ">(" << args[0].get_name() << ",\n";
+                writer << "            " << args[1].get_name() << ",\n";
+                writer << "            " << args[2].get_name() << ",\n";
+                writer << "            " << (attention->has_mask() ? args[3].get_name() : "nullptr")
+                       << ",\n";
+                writer << "            " << out[0].get_name() << ",\n";
+                writer << "            {" << join(args[0].get_shape()) << "},\n";
+                writer << "            {" << join(args[2].get_shape()) << "},\n";
+                writer << "            " << attention->get_scale() << ");\n";
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::LayerNorm)
+            {
+                auto layer_norm = static_cast<const ngraph::op::LayerNorm*>(node);
+                auto row_size = args[1].get_size();
+                writer.block_begin();
+                writer << "reference::layer_norm<" << args[0].get_type() << ">("
+                       << args[0].get_name() << ",\n";
+                writer << "            " << args[1].get_name() << ",\n";
+                writer << "            " << args[2].get_name() << ",\n";
+                writer << "            " << out[0].get_name() << ",\n";
+                writer << "            " << (row_size == 0 ? 0 : args[0].get_size() / row_size)
+                       << ",\n";
+                writer << "            " << row_size << ",\n";
+                writer << "            " << layer_norm->get_epsilon() << ");\n";
+                writer.block_end();
+            }
+
+            template <>
+            void CPU_Emitter::EMITTER_DECL(ngraph::op::Gelu)
+            {
+                auto gelu = static_cast<const ngraph::op::Gelu*>(node);
+                writer.block_begin();
+                writer << "reference::gelu<" << args[0].get_type() << ">(" << args[0].get_name()
+                       << ",\n";
+                writer << "            " << out[0].get_name() << ",\n";
+                writer << "            " << out[0].get_size() << ",\n";
+                writer << "            " << (gelu->get_approximate() ? "true" : "false")
+                       << ");\n";
+                writer.block_end();
+            }
+
             template <>
             void CPU_Emitter::EMITTER_DECL(ngraph::op::Dequantize)
             {
@@ -68,6 +68,13 @@ namespace ngraph
                                           bool append_relu,
                                           bool training);
 
+                static void emitBatchNormBackprop(CPU_ExternalFunction* external_function,
+                                                  CodeWriter& writer,
+                                                  const ngraph::Node* node,
+                                                  const std::vector<TensorViewWrapper>& args,
+                                                  const std::vector<TensorViewWrapper>& out,
+                                                  bool fused_relu);
+
             private:
                 static std::string emit_vector(const TensorViewWrapper&,
                                                const std::string& name = "");
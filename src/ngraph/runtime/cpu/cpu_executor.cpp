@@ -14,15 +14,26 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <fstream>
+#include <mutex>
+#include <sstream>
 #include <thread>
 
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
 #include "cpu_executor.hpp"
 
 #include "ngraph/except.hpp"
+#include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/util.hpp"
 
 #define MAX_PARALLELISM_THRESHOLD 2
 
-static int GetNumCores()
+// Threads of each intra-op pool set in the environment, or 0
+static int GetIntraOpParallelism()
 {
     const auto omp_num_threads = std::getenv("OMP_NUM_THREADS");
     const auto ngraph_intra_op_parallelism = std::getenv("NGRAPH_INTRA_OP_PARALLELISM");
@@ -36,37 +47,166 @@ static int GetNumCores()
     {
         count = std::atoi(ngraph_intra_op_parallelism);
     }
-    else
+
+    return count < 1 ? 0 : count;
+}
+
+static int GetNumThreadPools()
+{
+    const auto ngraph_inter_op_parallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
+    int count = 0;
+
+    if (ngraph_inter_op_parallelism)
     {
-        count = std::thread::hardware_concurrency() / 2;
+        count = std::atoi(ngraph_inter_op_parallelism);
     }
 
-    int max_parallelism_allowed = MAX_PARALLELISM_THRESHOLD * std::thread::hardware_concurrency();
-    if (count > max_parallelism_allowed)
+    return count < 1 ? 1 : count;
+}
+
+static int GetNumReservedPools()
+{
+    const auto ngraph_reserved_pools = std::getenv("NGRAPH_CPU_RESERVED_POOLS");
+    int count = 0;
+
+    if (ngraph_reserved_pools)
     {
-        throw ngraph::ngraph_error(
-            "OMP_NUM_THREADS and/or NGRAPH_INTRA_OP_PARALLELISM is too high: "
-            "(" +
-            std::to_string(count) + "). Please specify a value in range [1-" +
-            std::to_string(max_parallelism_allowed) + "]");
+        count = std::atoi(ngraph_reserved_pools);
+    }
+
+    return count < 1 ? 0 : count;
+}
+
+static int GetNumAsyncCallThreads()
+{
+    const auto ngraph_async_call_threads = std::getenv("NGRAPH_CPU_ASYNC_CALL_THREADS");
+    int count = 0;
+
+    if (ngraph_async_call_threads)
+    {
+        count = std::atoi(ngraph_async_call_threads);
+    }
+    else
+    {
+        count = std::thread::hardware_concurrency();
     }
 
     return count < 1 ? 1 : count;
 }
 
-static int GetNumThreadPools()
+static int GetNumDEXWorkers()
 {
-    const auto ngraph_inter_op_parallelism = std::getenv("NGRAPH_INTER_OP_PARALLELISM");
+    const auto ngraph_dex_workers = std::getenv("NGRAPH_CPU_DEX_WORKERS");
     int count = 0;
 
-    if (ngraph_inter_op_parallelism)
+    if (ngraph_dex_workers)
     {
-        count = std::atoi(ngraph_inter_op_parallelism);
+        count = std::atoi(ngraph_dex_workers);
     }
 
     return count < 1 ? 1 : count;
 }
 
+static int SetEnv(const char* name, const std::string& value)
+{
+#ifdef _WIN32
+    return _putenv_s(name, value.c_str());
+#else
+    return setenv(name, value.c_str(), 1);
+#endif
+}
+
+// Parses a Linux CPU or node list such as "0-3,8-11"
+static std::vector<int> ParseIdList(const std::string& list)
+{
+    std::vector<int> ids;
+    std::stringstream ss(list);
+    std::string range;
+    while (std::getline(ss, range, ','))
+    {
+        if (range.empty())
+        {
+            continue;
+        }
+        auto dash = range.find('-');
+        int first = std::atoi(range.substr(0, dash).c_str());
+        int last = dash == std::string::npos ? first : std::atoi(range.substr(dash + 1).c_str());
+        for (int id = first; id <= last; id++)
+        {
+            ids.push_back(id);
+        }
+    }
+    return ids;
+}
+
+// Returns the CPUs this process may run on, grouped by NUMA node. Returns no nodes when
+// there is only one node, the topology is unknown, or NGRAPH_CPU_NUMA_AFFINITY=0.
+static std::vector<std::vector<int>> GetNumaNodeCpus()
+{
+    std::vector<std::vector<int>> nodes;
+#if defined(__linux__)
+    const auto numa_affinity = std::getenv("NGRAPH_CPU_NUMA_AFFINITY");
+    if (numa_affinity != nullptr && std::atoi(numa_affinity) == 0)
+    {
+        return nodes;
+    }
+
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string node_list;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0 || !std::getline(online, node_list))
+    {
+        return nodes;
+    }
+
+    for (int node : ParseIdList(node_list))
+    {
+        std::ifstream cpulist("/sys/devices/system/node/node" + std::to_string(node) +
+                              "/cpulist");
+        std::string cpu_list;
+        std::getline(cpulist, cpu_list);
+        std::vector<int> cpus;
+        for (int cpu : ParseIdList(cpu_list))
+        {
+            if (cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed))
+            {
+                cpus.push_back(cpu);
+            }
+        }
+        // Nodes without usable CPUs (e.g. memory-only nodes) get no thread pool
+        if (!cpus.empty())
+        {
+            nodes.push_back(cpus);
+        }
+    }
+
+    if (nodes.size() < 2)
+    {
+        nodes.clear();
+    }
+#endif
+    return nodes;
+}
+
+static void BindCurrentThread(const std::vector<int>& cpus)
+{
+#if defined(__linux__)
+    if (cpus.empty())
+    {
+        return;
+    }
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (int cpu : cpus)
+    {
+        CPU_SET(cpu, &cpu_set);
+    }
+    // Binding is an optimization only, so a failure is not an error
+    sched_setaffinity(0, sizeof(cpu_set), &cpu_set);
+#endif
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -75,63 +215,358 @@ namespace ngraph
         {
             namespace executor
             {
-                CPUExecutor::CPUExecutor(int num_thread_pools)
-                    : m_num_thread_pools(num_thread_pools)
+                static std::mutex s_threading_config_mutex;
+                static ThreadingConfig s_threading_config;
+                // Set once the thread pools are created, after which the config is resolved
+                // and fixed
+                static bool s_threading_config_fixed = false;
+
+                static ThreadingConfig ResolveThreadingConfig(ThreadingConfig config)
+                {
+                    const int hardware_threads = std::thread::hardware_concurrency();
+                    if (config.inter_op_pools < 1)
+                    {
+                        config.inter_op_pools = GetNumThreadPools();
+                    }
+                    if (config.intra_op_threads < 1)
+                    {
+                        config.intra_op_threads = GetIntraOpParallelism();
+                    }
+                    if (config.intra_op_threads < 1)
+                    {
+                        // The pools run kernels at the same time, so they split the cores
+                        // instead of each taking all of them
+                        config.intra_op_threads =
+                            std::max(1, hardware_threads / 2 / config.inter_op_pools);
+                    }
+                    int max_parallelism_allowed = MAX_PARALLELISM_THRESHOLD * hardware_threads;
+                    if (config.intra_op_threads > max_parallelism_allowed)
+                    {
+                        throw ngraph_error(
+                            "Intra-op parallelism (OMP_NUM_THREADS, NGRAPH_INTRA_OP_PARALLELISM "
+                            "or ThreadingConfig::intra_op_threads) is too high: (" +
+                            std::to_string(config.intra_op_threads) +
+                            "). Please specify a value in range [1-" +
+                            std::to_string(max_parallelism_allowed) + "]");
+                    }
+
+                    // Eigen threadpool will still be used for reductions
+                    // and other tensor operations that dont use a parallelFor
+                    char* eigen_tp_count = std::getenv("NGRAPH_CPU_EIGEN_THREAD_COUNT");
+                    bool eigen_threads_given = config.eigen_threads > 0 || eigen_tp_count;
+                    if (config.eigen_threads < 1 && eigen_tp_count != nullptr)
+                    {
+                        config.eigen_threads = std::atoi(eigen_tp_count);
+                    }
+                    if (eigen_threads_given && (config.eigen_threads < 1 ||
+                                                config.eigen_threads > config.intra_op_threads))
+                    {
+                        throw ngraph_error(
+                            "Unexpected value specified for NGRAPH_CPU_EIGEN_THREAD_COUNT or "
+                            "ThreadingConfig::eigen_threads. Please specify a value in range "
+                            "[1-" +
+                            std::to_string(config.intra_op_threads) + "]");
+                    }
+                    if (!eigen_threads_given)
+                    {
+                        config.eigen_threads = config.intra_op_threads;
+                    }
+
+                    if (config.reserved_pools < 1)
+                    {
+                        config.reserved_pools = GetNumReservedPools();
+                    }
+                    if (config.reserved_pools >= config.inter_op_pools)
+                    {
+                        throw ngraph_error(
+                            "Unexpected value specified for NGRAPH_CPU_RESERVED_POOLS or "
+                            "ThreadingConfig::reserved_pools (" +
+                            std::to_string(config.reserved_pools) +
+                            "). Please specify a value in range [0-" +
+                            std::to_string(config.inter_op_pools - 1) + "]");
+                    }
+
+                    const char* wait_policy = std::getenv("NGRAPH_CPU_WAIT_POLICY");
+                    if (config.wait_policy == WaitPolicy::Default && wait_policy != nullptr)
+                    {
+                        if (std::string(wait_policy) == "spin")
+                        {
+                            config.wait_policy = WaitPolicy::Spin;
+                        }
+                        else if (std::string(wait_policy) == "sleep")
+                        {
+                            config.wait_policy = WaitPolicy::Sleep;
+                        }
+                        else
+                        {
+                            throw ngraph_error("Unexpected value specified for "
+                                               "NGRAPH_CPU_WAIT_POLICY (" +
+                                               std::string(wait_policy) +
+                                               "). Please specify spin or sleep");
+                        }
+                    }
+                    return config;
+                }
+
+                // MKL-DNN runs its kernels on OpenMP, which reads its settings from the
+                // environment when it starts. The backend creates the executor before it
+                // builds any MKL-DNN primitive, so exporting them here is early enough.
+                static void ExportOpenMPConfig(const ThreadingConfig& config)
                 {
+                    SetEnv("OMP_NUM_THREADS", std::to_string(config.intra_op_threads));
+                    if (config.wait_policy != WaitPolicy::Default)
+                    {
+                        SetEnv("OMP_WAIT_POLICY",
+                               config.wait_policy == WaitPolicy::Spin ? "ACTIVE" : "PASSIVE");
+                    }
+                }
+
+                void set_threading_config(const ThreadingConfig& config)
+                {
+                    std::lock_guard<std::mutex> lock(s_threading_config_mutex);
+                    if (s_threading_config_fixed)
+                    {
+                        throw ngraph_error(
+                            "The CPU threading config must be set before the first CPU backend "
+                            "is created");
+                    }
+                    s_threading_config = config;
+                }
+
+                ThreadingConfig get_threading_config()
+                {
+                    std::lock_guard<std::mutex> lock(s_threading_config_mutex);
+                    if (!s_threading_config_fixed)
+                    {
+                        return ResolveThreadingConfig(s_threading_config);
+                    }
+                    return s_threading_config;
+                }
+
+                BoundThreadEnvironment::EnvThread*
+                    BoundThreadEnvironment::CreateThread(std::function<void()> f)
+                {
+                    auto thread_cpus = cpus;
+                    return new EnvThread([thread_cpus, f]() {
+                        BindCurrentThread(thread_cpus);
+                        f();
+                    });
+                }
+
+                CPUExecutor::CPUExecutor(const ThreadingConfig& config)
+                    : m_num_threads_per_pool(config.eigen_threads)
+                    , m_allow_spinning(config.wait_policy != WaitPolicy::Sleep)
+                    , m_num_thread_pools(config.inter_op_pools)
+                    , m_numa_node_cpus(GetNumaNodeCpus())
+                    , m_num_dex_workers(GetNumDEXWorkers())
+                    , m_num_reserved_pools(config.reserved_pools)
+                {
+                    for (auto& count : m_running_calls)
+                    {
+                        count = 0;
+                    }
+                    int num_thread_pools = config.inter_op_pools;
+                    m_num_numa_nodes =
+                        m_numa_node_cpus.empty() ? 1 : static_cast<int>(m_numa_node_cpus.size());
+                    // Every node gets at least one pool so that calls can be spread over them
+                    num_thread_pools = std::max(num_thread_pools, m_num_numa_nodes);
+                    m_num_thread_pools = num_thread_pools;
                     for (int i = 0; i < num_thread_pools; i++)
                     {
-                        int num_threads_per_pool;
+                        m_tbb_arenas.emplace_back(1);
+                    }
+                }
 
-                        // Eigen threadpool will still be used for reductions
-                        // and other tensor operations that dont use a parallelFor
-                        num_threads_per_pool = GetNumCores();
+                void CPUExecutor::create_thread_pools()
+                {
+                    std::lock_guard<std::mutex> lock(m_thread_pools_mutex);
+                    if (m_thread_pools_created.load(std::memory_order_relaxed))
+                    {
+                        return;
+                    }
+                    stopwatch timer;
+                    timer.start();
+                    for (int i = 0; i < m_num_thread_pools; i++)
+                    {
+                        int num_threads_per_pool = m_num_threads_per_pool;
 
-                        // User override
-                        char* eigen_tp_count = std::getenv("NGRAPH_CPU_EIGEN_THREAD_COUNT");
-                        if (eigen_tp_count != nullptr)
+                        BoundThreadEnvironment env;
+                        if (!m_numa_node_cpus.empty())
                         {
-                            const int tp_count = std::atoi(eigen_tp_count);
-                            if (tp_count < 1 || tp_count > GetNumCores())
-                            {
-                                throw ngraph_error(
-                                    "Unexpected value specified for NGRAPH_CPU_EIGEN_THREAD_COUNT "
-                                    "(" +
-                                    std::string(eigen_tp_count) +
-                                    "). Please specify a value in range [1-" +
-                                    std::to_string(GetNumCores()) + "]");
-                            }
-                            num_threads_per_pool = tp_count;
+                            env.cpus = m_numa_node_cpus[get_numa_node(i)];
+                            num_threads_per_pool =
+                                std::min(num_threads_per_pool, static_cast<int>(env.cpus.size()));
                         }
 
-                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPool>(
-                            new Eigen::ThreadPool(num_threads_per_pool)));
+                        m_thread_pools.push_back(std::unique_ptr<Eigen::ThreadPoolInterface>(
+                            new Eigen::ThreadPoolTempl<BoundThreadEnvironment>(
+                                num_threads_per_pool, m_allow_spinning, env)));
                         m_thread_pool_devices.push_back(
                             std::unique_ptr<Eigen::ThreadPoolDevice>(new Eigen::ThreadPoolDevice(
                                 m_thread_pools[i].get(), num_threads_per_pool)));
-                        m_tbb_arenas.emplace_back(1);
+                        m_serial_devices.push_back(std::unique_ptr<Eigen::ThreadPoolDevice>(
+                            new Eigen::ThreadPoolDevice(m_thread_pools[i].get(), 1)));
                     }
+                    m_thread_pools_created.store(true, std::memory_order_release);
+                    timer.stop();
+                    BackendManager::record_startup_step("CPU thread pools",
+                                                        timer.get_microseconds());
                 }
 
+                thread_local bool CPUExecutor::s_run_serial = false;
+
                 void CPUExecutor::execute(CPUKernelFunctor& f,
                                           CPURuntimeContext* ctx,
                                           CPUExecutionContext* ectx,
                                           bool use_tbb)
                 {
-                    auto tbb_functor = [&]() { f(ctx, ectx); };
+                    // Kernels call get_device on the thread that runs them, which for a TBB
+                    // arena may not be this one, so the flag is set around f itself
+                    auto run = [&]() {
+                        bool previous = s_run_serial;
+                        s_run_serial = ectx->serial;
+                        try
+                        {
+                            f(ctx, ectx);
+                        }
+                        catch (...)
+                        {
+                            s_run_serial = previous;
+                            throw;
+                        }
+                        s_run_serial = previous;
+                    };
+                    auto tbb_functor = [&]() {
+                        if (!m_numa_node_cpus.empty())
+                        {
+                            // TBB workers are shared between arenas, so rebind a worker whenever
+                            // it moves to an arena on another node
+                            static thread_local int s_bound_node = -1;
+                            int node = get_numa_node(ectx->arena);
+                            if (s_bound_node != node)
+                            {
+                                BindCurrentThread(m_numa_node_cpus[node]);
+                                s_bound_node = node;
+                            }
+                        }
+                        run();
+                    };
                     if (use_tbb)
                     {
                         m_tbb_arenas[ectx->arena].execute(tbb_functor);
                     }
                     else
                     {
-                        f(ctx, ectx);
+                        run();
+                    }
+                }
+
+                void CPUExecutor::schedule_call(std::function<void()> f)
+                {
+                    std::call_once(m_call_pool_init, [this]() {
+                        m_call_pool.reset(
+                            new Eigen::ThreadPool(GetNumAsyncCallThreads(), m_allow_spinning));
+                    });
+                    m_call_pool->Schedule(std::move(f));
+                }
+
+                void CPUExecutor::schedule_dex_worker(std::function<void()> f)
+                {
+                    std::call_once(m_dex_worker_pool_init, [this]() {
+                        m_dex_worker_pool.reset(new Eigen::ThreadPool(
+                            std::max(1, m_num_dex_workers - 1), m_allow_spinning));
+                    });
+                    m_dex_worker_pool->Schedule(std::move(f));
+                }
+
+                int CPUExecutor::get_thread_pool(CallPriority priority, size_t ctx_id) const
+                {
+                    // Contexts are spread over the pools of their class when the pools are
+                    // bound to NUMA nodes, and otherwise share the first one
+                    bool numa = m_num_numa_nodes > 1;
+                    int num_shared_pools = m_num_thread_pools - m_num_reserved_pools;
+                    if (priority == CallPriority::High && m_num_reserved_pools > 0)
+                    {
+                        return num_shared_pools +
+                               (numa ? static_cast<int>(ctx_id % m_num_reserved_pools) : 0);
+                    }
+                    return numa ? static_cast<int>(ctx_id % num_shared_pools) : 0;
+                }
+
+                void CPUExecutor::begin_call(CallPriority priority)
+                {
+                    m_running_calls[static_cast<int>(priority)]++;
+                }
+
+                void CPUExecutor::end_call(CallPriority priority)
+                {
+                    if (--m_running_calls[static_cast<int>(priority)] == 0)
+                    {
+                        // A waiter checks the counts under the lock, so it is either waiting
+                        // already or sees the new count
+                        std::lock_guard<std::mutex> lock(m_priority_mutex);
+                        m_priority_cv.notify_all();
                     }
                 }
 
+                void CPUExecutor::yield_to_higher_priority(CallPriority priority)
+                {
+                    auto higher_running = [this, priority]() {
+                        for (int p = 0; p < static_cast<int>(priority); p++)
+                        {
+                            if (m_running_calls[p].load() > 0)
+                            {
+                                return true;
+                            }
+                        }
+                        return false;
+                    };
+                    if (!higher_running())
+                    {
+                        return;
+                    }
+                    std::unique_lock<std::mutex> lock(m_priority_mutex);
+                    m_priority_cv.wait(lock, [&]() { return !higher_running(); });
+                }
+
+                void CPUExecutor::run_on_node(int pool_id, const std::function<void()>& f)
+                {
+                    if (m_numa_node_cpus.empty())
+                    {
+                        f();
+                        return;
+                    }
+                    std::exception_ptr error;
+                    std::thread thread([this, pool_id, &f, &error]() {
+                        BindCurrentThread(m_numa_node_cpus[get_numa_node(pool_id)]);
+                        try
+                        {
+                            f();
+                        }
+                        catch (...)
+                        {
+                            error = std::current_exception();
+                        }
+                    });
+                    thread.join();
+                    if (error)
+                    {
+                        std::rethrow_exception(error);
+                    }
+                }
+
+                static ThreadingConfig FixThreadingConfig()
+                {
+                    std::lock_guard<std::mutex> lock(s_threading_config_mutex);
+                    s_threading_config = ResolveThreadingConfig(s_threading_config);
+                    s_threading_config_fixed = true;
+                    ExportOpenMPConfig(s_threading_config);
+                    return s_threading_config;
+                }
+
                 CPUExecutor& GetCPUExecutor()
                 {
-                    static int num_thread_pools = GetNumThreadPools();
-                    static CPUExecutor cpu_executor(num_thread_pools < 1 ? 1 : num_thread_pools);
+                    static CPUExecutor cpu_executor(FixThreadingConfig());
                     return cpu_executor;
                 }
 
@@ -16,8 +16,12 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <functional>
+#include <mutex>
 #include <thread>
+#include <vector>
 
 #include <mkldnn.hpp>
 
@@ -38,15 +42,73 @@ namespace ngraph
             {
                 extern mkldnn::engine global_cpu_engine;
 
+                // How idle threads wait for work, in the intra-op, call and DEX worker pools
+                // and in the OpenMP runtime of MKL-DNN
+                enum class WaitPolicy
+                {
+                    // The default of each runtime
+                    Default,
+                    // Spin before sleeping, for the lowest latency on back-to-back work
+                    Spin,
+                    // Sleep at once, which leaves the cores to other calls under concurrency
+                    Sleep
+                };
+
+                // Threading of the CPU backend, shared by Eigen, TBB and MKL-DNN. Fields left
+                // at zero or Default are taken from NGRAPH_INTRA_OP_PARALLELISM (or
+                // OMP_NUM_THREADS), NGRAPH_INTER_OP_PARALLELISM, NGRAPH_CPU_EIGEN_THREAD_COUNT,
+                // NGRAPH_CPU_WAIT_POLICY ("spin" or "sleep") and NGRAPH_CPU_RESERVED_POOLS.
+                struct ThreadingConfig
+                {
+                    // Threads of each intra-op pool, which is also the OpenMP thread count of
+                    // MKL-DNN kernels. Unless given, the cores are split between the pools.
+                    int intra_op_threads = 0;
+                    // Number of intra-op pools, i.e. of calls whose kernels run concurrently
+                    int inter_op_pools = 0;
+                    // Threads of Eigen kernels in each pool, at most intra_op_threads
+                    int eigen_threads = 0;
+                    WaitPolicy wait_policy = WaitPolicy::Default;
+                    // Intra-op pools, out of inter_op_pools, that only run the kernels of
+                    // CallPriority::High calls, so that other calls can not take their threads
+                    int reserved_pools = 0;
+                };
+
+                // Sets the threading of the CPU backend. It must be called before the first
+                // CPU backend is created, since the thread pools are created only once.
+                void set_threading_config(const ThreadingConfig& config);
+                // The threading in effect, with every field resolved
+                ThreadingConfig get_threading_config();
+
+                // Thread environment for Eigen thread pools whose threads are bound to a fixed
+                // set of CPUs. An empty set leaves the threads unbound.
+                struct BoundThreadEnvironment : public Eigen::StlThreadEnvironment
+                {
+                    std::vector<int> cpus;
+
+                    EnvThread* CreateThread(std::function<void()> f);
+                };
+
                 // CPUExecutor owns the resources for executing a graph.
+                //
+                // On hosts with more than one NUMA node (and unless NGRAPH_CPU_NUMA_AFFINITY=0),
+                // there is at least one thread pool per node, and pool i and its TBB arena are
+                // bound to the CPUs of node get_numa_node(i).
                 class CPUExecutor
                 {
                 public:
-                    explicit CPUExecutor(int num_thread_pools);
+                    explicit CPUExecutor(const ThreadingConfig& config);
 
+                    // The device of thread pool `id`. While a serial kernel runs (see
+                    // CPUExecutionContext::serial) this is a device of one thread, on which
+                    // Eigen evaluates inline without waking the pool.
                     Eigen::ThreadPoolDevice& get_device(int id)
                     {
-                        return *m_thread_pool_devices[id].get();
+                        if (!m_thread_pools_created.load(std::memory_order_acquire))
+                        {
+                            create_thread_pools();
+                        }
+                        return s_run_serial ? *m_serial_devices[id].get()
+                                            : *m_thread_pool_devices[id].get();
                     }
 
                     void execute(CPUKernelFunctor& f,
@@ -54,11 +116,68 @@ namespace ngraph
                                  CPUExecutionContext* ectx,
                                  bool use_tbb = false);
                     int get_num_thread_pools() { return m_num_thread_pools; }
+                    // Number of NUMA nodes the thread pools are spread over; 1 when pools are
+                    // not bound to nodes.
+                    int get_num_numa_nodes() const { return m_num_numa_nodes; }
+                    int get_numa_node(int pool_id) const { return pool_id % m_num_numa_nodes; }
+                    // Runs `f` on a thread bound to the NUMA node of thread pool `pool_id` and
+                    // waits for it, so that memory first touched by `f` is placed on that node.
+                    void run_on_node(int pool_id, const std::function<void()>& f);
+                    // Runs `f` asynchronously on the call dispatch pool. This pool is
+                    // separate from the intra-op pools so that a dispatched call blocking on
+                    // its kernels can never starve the threads those kernels run on. It is
+                    // created on first use and sized by NGRAPH_CPU_ASYNC_CALL_THREADS
+                    // (default: number of hardware threads).
+                    void schedule_call(std::function<void()> f);
+                    // Number of threads, including the calling thread, that run independent
+                    // ops of one DEX call concurrently. Set by NGRAPH_CPU_DEX_WORKERS (default:
+                    // 1, i.e. ops run one at a time in program order).
+                    int get_num_dex_workers() const { return m_num_dex_workers; }
+                    // Runs `f` asynchronously on the DEX worker pool. Like the call dispatch
+                    // pool, it is separate from the intra-op pools and created on first use.
+                    void schedule_dex_worker(std::function<void()> f);
+
+                    // The thread pool of a call of `priority` on runtime context `ctx_id`.
+                    // High priority calls run on the reserved pools, if any, and the other
+                    // calls on the remaining ones.
+                    int get_thread_pool(CallPriority priority, size_t ctx_id) const;
+                    int get_num_reserved_pools() const { return m_num_reserved_pools; }
+                    // Count the calls of each priority that are running
+                    void begin_call(CallPriority priority);
+                    void end_call(CallPriority priority);
+                    // Called by DEX calls between their ops: waits while a call of a higher
+                    // priority than `priority` runs
+                    void yield_to_higher_priority(CallPriority priority);
+
                 private:
-                    std::vector<std::unique_ptr<Eigen::ThreadPool>> m_thread_pools;
+                    // The intra-op pools start their threads on first use rather than when the
+                    // backend is created, so startup and compilation do not pay for them
+                    void create_thread_pools();
+
+                    int m_num_threads_per_pool;
+                    bool m_allow_spinning;
+                    std::atomic<bool> m_thread_pools_created{false};
+                    std::mutex m_thread_pools_mutex;
+                    std::vector<std::unique_ptr<Eigen::ThreadPoolInterface>> m_thread_pools;
                     std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_thread_pool_devices;
+                    std::vector<std::unique_ptr<Eigen::ThreadPoolDevice>> m_serial_devices;
+                    static thread_local bool s_run_serial;
                     std::vector<tbb::task_arena> m_tbb_arenas;
                     int m_num_thread_pools;
+                    int m_num_numa_nodes;
+                    // CPUs of each NUMA node, empty when pools are not bound to nodes
+                    std::vector<std::vector<int>> m_numa_node_cpus;
+                    std::unique_ptr<Eigen::ThreadPool> m_call_pool;
+                    std::once_flag m_call_pool_init;
+                    int m_num_dex_workers;
+                    std::unique_ptr<Eigen::ThreadPool> m_dex_worker_pool;
+                    std::once_flag m_dex_worker_pool_init;
+                    // the last m_num_reserved_pools pools
+                    int m_num_reserved_pools;
+                    // running calls of each CallPriority
+                    std::atomic<size_t> m_running_calls[3];
+                    std::mutex m_priority_mutex;
+                    std::condition_variable m_priority_cv;
                 };
 
                 extern CPUExecutor& GetCPUExecutor();
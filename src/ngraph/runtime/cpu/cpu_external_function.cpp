@@ -14,18 +14,24 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
 #include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <iostream>
+#include <map>
 #include <memory>
 #include <string>
 #include <tuple>
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 
 #define TBB_PREVIEW_FLOW_GRAPH_TRACE 1
 
 #include <tbb/flow_graph.h>
+#include <tbb/task_group.h>
 
 #if !defined(NGRAPH_DEX_ONLY)
 #include "ngraph/code_writer.hpp"
@@ -35,14 +41,17 @@
 
 #include "ngraph/descriptor/input.hpp"
 #include "ngraph/descriptor/output.hpp"
+#include "ngraph/distributed.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/all.hpp"
+#include "ngraph/op/allgather.hpp"
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/and.hpp"
 #include "ngraph/op/any.hpp"
@@ -69,6 +78,7 @@
 #include "ngraph/op/erf.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/op/experimental/dropout.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/quantized_avg_pool.hpp"
 #include "ngraph/op/experimental/quantized_concat.hpp"
@@ -79,8 +89,14 @@
 #include "ngraph/op/experimental/quantized_dot_bias.hpp"
 #include "ngraph/op/experimental/quantized_max_pool.hpp"
 #include "ngraph/op/floor.hpp"
+#include "ngraph/op/fused/adam_update.hpp"
+#include "ngraph/op/fused/all_finite.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
+#include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
+#include "ngraph/op/fused/sgd_momentum_update.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/gather_nd.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -107,6 +123,8 @@
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/reducescatter.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
@@ -114,6 +132,7 @@
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
 #include "ngraph/op/select.hpp"
+#include "ngraph/op/send.hpp"
 #include "ngraph/op/sign.hpp"
 #include "ngraph/op/sin.hpp"
 #include "ngraph/op/sinh.hpp"
@@ -126,12 +145,17 @@
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/op/topk.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/all_reduce_fusion.hpp"
+#include "ngraph/pass/all_reduce_scheduling.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
+#include "ngraph/pass/batch_norm_folding.hpp"
 #include "ngraph/pass/common_function_collection.hpp"
+#include "ngraph/pass/constant_deduplication.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/cse.hpp"
 #include "ngraph/pass/dump_sorted.hpp"
+#include "ngraph/pass/embedding_quantization.hpp"
 #include "ngraph/pass/fused_op_decomposition.hpp"
 #include "ngraph/pass/get_output_element_elimination.hpp"
 #include "ngraph/pass/like_replacement.hpp"
@@ -142,6 +166,7 @@
 #include "ngraph/pass/propagate_cacheability.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
 #include "ngraph/pass/reshape_sinking.hpp"
+#include "ngraph/pass/sparse_all_reduce.hpp"
 #include "ngraph/pass/zero_dim_tensor_elimination.hpp"
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
@@ -151,11 +176,15 @@
 #include "ngraph/runtime/cpu/cpu_emitter.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
+#include "ngraph/runtime/cpu/cpu_hw_counters.hpp"
+#include "ngraph/runtime/cpu/cpu_latency_histogram.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_conversions.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
 #include "ngraph/runtime/cpu/cpu_tracing.hpp"
 #include "ngraph/runtime/cpu/cpu_visualize_tree.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_mat_mul_transpose.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
@@ -179,6 +208,7 @@
 #include "ngraph/runtime/cpu/pass/cpu_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_horizontal_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_layout.hpp"
+#include "ngraph/runtime/cpu/pass/cpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_mat_fusion.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_assignment.hpp"
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
@@ -224,6 +254,10 @@ runtime::cpu::CPU_ExternalFunction::CPU_ExternalFunction(
     : m_function(function)
     , m_release_function(release_function)
     , m_emit_timing(false)
+    , m_collect_hw_counters(std::getenv("NGRAPH_CPU_HW_COUNTERS") != nullptr)
+    , m_latency_sample_period(std::getenv("NGRAPH_CPU_LATENCY_SAMPLE_PERIOD") == nullptr
+                                  ? 0
+                                  : std::atoi(std::getenv("NGRAPH_CPU_LATENCY_SAMPLE_PERIOD")))
     , m_use_tbb(std::getenv("NGRAPH_CPU_USE_TBB") != nullptr)
 #if !defined(NGRAPH_DEX_ONLY)
     , m_is_compiled(false)
@@ -252,6 +286,50 @@ public:
     StaticInitializers(string directory) { ngraph::file_util::remove_directory(directory); }
 };
 
+namespace
+{
+    // Adds the steps of a compile that follow the passes to its profile, if it has one
+    class CompilePhaseTimer
+    {
+    public:
+        explicit CompilePhaseTimer(const shared_ptr<ngraph::pass::PassProfile>& profile)
+            : m_profile(profile)
+        {
+            restart();
+        }
+
+        // Ends the phase started by the previous call, or by the constructor
+        void end_phase(const string& name)
+        {
+            if (m_profile)
+            {
+                ngraph::pass::CompilePhase phase;
+                phase.name = name;
+                phase.wall_time_us = chrono::duration_cast<chrono::microseconds>(
+                                         chrono::steady_clock::now() - m_start)
+                                         .count();
+                phase.peak_rss_delta_kb = get_peak_rss_kb() - m_peak_rss_kb;
+                m_profile->add_phase(phase);
+                restart();
+            }
+        }
+
+    private:
+        void restart()
+        {
+            if (m_profile)
+            {
+                m_start = chrono::steady_clock::now();
+                m_peak_rss_kb = get_peak_rss_kb();
+            }
+        }
+
+        shared_ptr<ngraph::pass::PassProfile> m_profile;
+        chrono::steady_clock::time_point m_start;
+        int64_t m_peak_rss_kb = 0;
+    };
+}
+
 #if !defined(NGRAPH_DEX_ONLY)
 
 static const string s_output_dir = "cpu_codegen";
@@ -297,6 +375,10 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::AllReduce), &runtime::cpu::CPU_Emitter::emit<op::AllReduce>},
     {TI(ngraph::op::BroadcastDistributed),
      &runtime::cpu::CPU_Emitter::emit<op::BroadcastDistributed>},
+    {TI(ngraph::op::AllGather), &runtime::cpu::CPU_Emitter::emit<op::AllGather>},
+    {TI(ngraph::op::Recv), &runtime::cpu::CPU_Emitter::emit<op::Recv>},
+    {TI(ngraph::op::Send), &runtime::cpu::CPU_Emitter::emit<op::Send>},
+    {TI(ngraph::op::ReduceScatter), &runtime::cpu::CPU_Emitter::emit<op::ReduceScatter>},
     {TI(ngraph::op::MatmulBias), &runtime::cpu::CPU_Emitter::emit<op::MatmulBias>},
     {TI(ngraph::op::Dot), &runtime::cpu::CPU_Emitter::emit<op::Dot>},
     {TI(ngraph::op::Multiply), &runtime::cpu::CPU_Emitter::emit<op::Multiply>},
@@ -334,6 +416,8 @@ static const runtime::cpu::OpMap dispatcher{
     {TI(ngraph::op::Slice), &runtime::cpu::CPU_Emitter::emit<op::Slice>},
     {TI(ngraph::op::Sum), &runtime::cpu::CPU_Emitter::emit<op::Sum>},
     {TI(ngraph::op::EmbeddingLookup), &runtime::cpu::CPU_Emitter::emit<op::EmbeddingLookup>},
+    {TI(ngraph::op::EmbeddingLookupBackprop),
+     &runtime::cpu::CPU_Emitter::emit<op::EmbeddingLookupBackprop>},
     {TI(ngraph::op::Exp), &runtime::cpu::CPU_Emitter::emit<op::Exp>},
     {TI(ngraph::op::Sin), &runtime::cpu::CPU_Emitter::emit<op::Sin>},
     {TI(ngraph::op::Sinh), &runtime::cpu::CPU_Emitter::emit<op::Sinh>},
@@ -398,6 +482,8 @@ static const runtime::cpu::OpMap dispatcher{
      &runtime::cpu::CPU_Emitter::emit<op::BatchNormInferenceRelu>},
     {TI(ngraph::op::BatchNormTrainingBackprop),
      &runtime::cpu::CPU_Emitter::emit<op::BatchNormTrainingBackprop>},
+    {TI(ngraph::op::BatchNormTrainingReluBackprop),
+     &runtime::cpu::CPU_Emitter::emit<op::BatchNormTrainingReluBackprop>},
     {TI(ngraph::op::BoundedRelu), &runtime::cpu::CPU_Emitter::emit<op::BoundedRelu>},
     {TI(ngraph::op::Lstm), &runtime::cpu::CPU_Emitter::emit<op::Lstm>},
     {TI(ngraph::op::MaxPoolBackprop), &runtime::cpu::CPU_Emitter::emit<op::MaxPoolBackprop>},
@@ -422,6 +508,13 @@ static const runtime::cpu::OpMap dispatcher{
      &runtime::cpu::CPU_Emitter::emit<runtime::cpu::op::LoopKernel>},
     {TI(ngraph::op::LRN), &runtime::cpu::CPU_Emitter::emit<ngraph::op::LRN>},
     {TI(ngraph::op::GenerateMask), &runtime::cpu::CPU_Emitter::emit<ngraph::op::GenerateMask>},
+    {TI(ngraph::op::Dropout), &runtime::cpu::CPU_Emitter::emit<ngraph::op::Dropout>},
+    {TI(ngraph::op::DropoutBackprop),
+     &runtime::cpu::CPU_Emitter::emit<ngraph::op::DropoutBackprop>},
+    {TI(ngraph::op::ScaledDotProductAttention),
+     &runtime::cpu::CPU_Emitter::emit<ngraph::op::ScaledDotProductAttention>},
+    {TI(ngraph::op::LayerNorm), &runtime::cpu::CPU_Emitter::emit<ngraph::op::LayerNorm>},
+    {TI(ngraph::op::Gelu), &runtime::cpu::CPU_Emitter::emit<ngraph::op::Gelu>},
     {TI(ngraph::op::ConvolutionAdd), &runtime::cpu::CPU_Emitter::emit<op::ConvolutionAdd>},
     {TI(ngraph::op::Quantize), &runtime::cpu::CPU_Emitter::emit<ngraph::op::Quantize>},
     {TI(ngraph::op::Dequantize), &runtime::cpu::CPU_Emitter::emit<ngraph::op::Dequantize>},
@@ -460,6 +553,24 @@ static void generate_runtime_context_class(CodeWriter& writer)
            << "\n";
 }
 
+// Fewer ops than this are not worth the cost of another translation unit
+static const size_t s_min_ops_per_codegen_unit = 32;
+
+// Emitted in the main translation unit only, unlike the class shared by all of them
+static void generate_runtime_context_functions(CodeWriter& writer)
+{
+    writer << "extern \"C\" CPURuntimeContextCG* init_cg_ctx()\n";
+    writer.block_begin();
+    writer << "return new CPURuntimeContextCG;\n";
+    writer.block_end();
+    writer << "\n";
+    writer << "extern \"C\" void destroy_cg_ctx(CPURuntimeContextCG* cg_ctx)\n";
+    writer.block_begin();
+    writer << "delete cg_ctx;\n";
+    writer.block_end();
+    writer << "\n";
+}
+
 void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_config)
 {
     if (m_is_compiled)
@@ -467,6 +578,16 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
         return;
     }
 
+    if (pass_config.get_pass_attribute(CPU_Executable::BATCH_POLYMORPHIC_ATTRIBUTE))
+    {
+        throw ngraph_error("CPU Backend: batch polymorphic functions are only supported in DEX "
+                           "mode");
+    }
+    if (pass_config.get_pass_attribute(CPU_Executable::DETERMINISTIC_REDUCTIONS_ATTRIBUTE))
+    {
+        throw ngraph_error("CPU Backend: deterministic reductions are only supported in DEX mode");
+    }
+
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
 
     ngraph::pass::Manager pass_manager;
@@ -488,6 +609,13 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
     pass_manager.register_pass<ngraph::pass::CommonFunctionCollection>(
         femitter, node_function_map, common_function_string);
     pass_manager.run_passes(m_function);
+    m_compile_profile = pass_manager.get_profile();
+    CompilePhaseTimer phase_timer(m_compile_profile);
+    m_layout_conversions = find_layout_conversions(*m_function);
+    if (std::getenv("NGRAPH_CPU_LAYOUT_REPORT") != nullptr)
+    {
+        print_layout_conversions(std::cout, m_layout_conversions);
+    }
 
     unordered_map<shared_ptr<Function>, list<shared_ptr<Node>>> function_ordered_ops;
     // only one function is allowed
@@ -498,7 +626,34 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
         function_ordered_ops.insert({current_function, current_function->get_ordered_ops()});
     }
 
+    m_compiler.reset(new codegen::Compiler());
+
+    // Large functions are split into several translation units that are compiled in parallel.
+    // Each unit runs a contiguous range of the ops, in order. Timing, tracing and TBB keep
+    // state local to the entry function, so they need a single unit.
+    size_t op_count = 0;
+    for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
+    {
+        for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
+        {
+            if (!node->is_parameter() && !node->is_constant())
+            {
+                op_count++;
+            }
+        }
+    }
+    size_t unit_count = 1;
+    if (!m_use_tbb && !m_emit_timing && !runtime::cpu::IsTracingEnabled())
+    {
+        unit_count = max<size_t>(
+            1,
+            min(m_compiler->get_job_count(),
+                (op_count + s_min_ops_per_codegen_unit - 1) / s_min_ops_per_codegen_unit));
+    }
+
     CodeWriter writer;
+    // The translation units other than `writer`, when the function is split
+    vector<string> unit_sources;
 
     writer << "// Generated by the nGraph CPU backend\n";
     if (m_use_tbb)
@@ -537,10 +692,13 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 #include "ngraph/runtime/reference/convolution.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/dropout.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/gather.hpp"
 #include "ngraph/runtime/reference/gather_nd.hpp"
+#include "ngraph/runtime/reference/gelu.hpp"
 #include "ngraph/runtime/reference/generate_mask.hpp"
+#include "ngraph/runtime/reference/layer_norm.hpp"
 #include "ngraph/runtime/reference/lrn.hpp"
 #include "ngraph/runtime/reference/max.hpp"
 #include "ngraph/runtime/reference/max_pool.hpp"
@@ -557,6 +715,7 @@ void runtime::cpu::CPU_ExternalFunction::compile(ngraph::pass::PassConfig& pass_
 #include "ngraph/runtime/reference/result.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
+#include "ngraph/runtime/reference/scaled_dot_product_attention.hpp"
 #include "ngraph/runtime/reference/slice.hpp"
 #include "ngraph/runtime/reference/sum.hpp"
 #include "ngraph/runtime/reference/topk.hpp"
@@ -633,7 +792,9 @@ using namespace ngraph::runtime;
         writer << "\n";
     }
 
-    writer << "// Declare all constants\n";
+    // Declarations shared by all translation units
+    CodeWriter unit_declarations;
+    unit_declarations << "// Declare all constants\n";
     for (shared_ptr<Function> current_function : pass_manager.get_state().get_functions())
     {
         for (shared_ptr<Node> node : function_ordered_ops.at(current_function))
@@ -644,8 +805,8 @@ using namespace ngraph::runtime;
                 m_active_constants.push_back(node);
                 shared_ptr<descriptor::Tensor> tv = node->get_outputs()[0].get_tensor_ptr();
                 string type = tv->get_element_type().c_type_string();
-                writer << "static " << type << "* " << tv->get_name() << " = ((" << type << "*)("
-                       << c->get_data_ptr() << "));\n";
+                unit_declarations << "static " << type << "* " << tv->get_name() << " = (("
+                                  << type << "*)(" << c->get_data_ptr() << "));\n";
 
                 auto output_tensor = &node->get_output_tensor();
                 auto tensor_set = get_tensor_set(output_tensor);
@@ -660,7 +821,9 @@ using namespace ngraph::runtime;
         }
     }
 
-    generate_class_declarations(writer);
+    generate_class_declarations(unit_declarations);
+    generate_runtime_context_class(unit_declarations);
+    writer << unit_declarations.get_code();
 
     const char* func_params =
         "(void** inputs, void** outputs, cpu::CPURuntimeContext* ctx, CPURuntimeContextCG* cg_ctx)";
@@ -669,12 +832,21 @@ using namespace ngraph::runtime;
     for (shared_ptr<Function> f : pass_manager.get_state().get_functions())
     {
         writer << "extern \"C\" void " << f->get_name() << func_params << ";\n";
+        for (size_t unit = 0; unit_count > 1 && unit < unit_count; unit++)
+        {
+            writer << "extern \"C\" void " << f->get_name() << "_part" << unit << func_params
+                   << ";\n";
+        }
     }
     writer << "\n";
 
-    generate_runtime_context_class(writer);
+    generate_runtime_context_functions(writer);
 
-    writer << common_function_string << "\n";
+    // With several units the common functions are emitted in the units that call them
+    if (unit_count == 1)
+    {
+        writer << common_function_string << "\n";
+    }
 
     //initiate mkldnn_primitives for CPURuntimeContextCG
     writer << "void inline CPURuntimeContextCG::init_mkldnn_primitives()\n";
@@ -756,14 +928,19 @@ using namespace ngraph::runtime;
                    << "int profiler_count = 0;\n\n";
         }
 
+        // Locals used by the ops, in the entry function or in each unit
+        CodeWriter unit_prologue;
         if (temporaries_used)
         {
-            writer << "size_t pool_base_ptr = (size_t) ctx->memory_buffers["
-                   << m_memory_buffer_sizes.size() - 1 << "]->get_ptr();\n";
-            writer << "\n";
+            unit_prologue << "size_t pool_base_ptr = (size_t) ctx->memory_buffers["
+                          << m_memory_buffer_sizes.size() - 1 << "]->get_ptr();\n";
+            unit_prologue << "\n";
+        }
+        unit_prologue << "bool* t_en = (bool*)" << current_function->get_name() << "_t_en;\n";
+        if (unit_count == 1)
+        {
+            writer << unit_prologue.get_code();
         }
-
-        writer << "bool* t_en = (bool*)" << current_function->get_name() << "_t_en;\n";
 
         if (m_use_tbb)
         {
@@ -839,8 +1016,19 @@ using namespace ngraph::runtime;
             }
         }
 
+        // The ops of each unit, and the common functions that they call
+        vector<CodeWriter> unit_writers(unit_count);
+        vector<vector<Node*>> unit_common_functions(unit_count);
+        size_t op_index = 0;
         for (shared_ptr<Node> node : ordered_ops)
         {
+            size_t unit = min(unit_count * op_index / max<size_t>(op_count, 1), unit_count - 1);
+            CodeWriter& unit_writer = unit_writers[unit];
+            if (!node->is_parameter() && !node->is_constant())
+            {
+                op_index++;
+            }
+
             auto& n = *node; // Work around a compiler warning (*node inside typeid may have effects
             // with shared pointers, which is fine here but clang doesn't like it.)
             auto handler = dispatcher.find(type_index(typeid(n)));
@@ -876,40 +1064,41 @@ using namespace ngraph::runtime;
                 }
                 if (m_use_tbb)
                 {
-                    writer << "tbb::flow::continue_node<tbb::flow::continue_msg>* "
-                              "flowgraph_node_"
-                           << node->get_name()
-                           << " = new tbb::flow::continue_node<tbb::flow::continue_msg> "
-                              "(*(cg_ctx->tbb_graph), [&](const tbb::flow::continue_msg &msg)\n{\n";
-                    writer.indent++;
+                    unit_writer << "tbb::flow::continue_node<tbb::flow::continue_msg>* "
+                                   "flowgraph_node_"
+                                << node->get_name()
+                                << " = new tbb::flow::continue_node<tbb::flow::continue_msg> "
+                                   "(*(cg_ctx->tbb_graph), "
+                                   "[&](const tbb::flow::continue_msg &msg)\n{\n";
+                    unit_writer.indent++;
                 }
                 if (runtime::cpu::IsTracingEnabled() &&
                     current_function->get_name() == m_function_name)
                 {
-                    writer << "start_ts = cpu::Clock::now();\n";
+                    unit_writer << "start_ts = cpu::Clock::now();\n";
                 }
             }
 
             if (!node->is_parameter() && !node->is_constant())
             {
-                writer << "\n// " << node->get_name() << "(";
+                unit_writer << "\n// " << node->get_name() << "(";
                 vector<string> parameter_nodes = node_input_names;
                 parameter_nodes.insert(
                     parameter_nodes.end(), node_output_names.begin(), node_output_names.end());
-                writer << join(parameter_nodes);
-                writer << ")\n";
+                unit_writer << join(parameter_nodes);
+                unit_writer << ")\n";
             }
 
             // Emit operation body
             if (!node->is_parameter() && !node->is_constant())
             {
-                emit_debug_function_entry(writer, node.get(), in, out);
+                emit_debug_function_entry(unit_writer, node.get(), in, out);
             }
 
             // Op Control
             if (!node->is_parameter() && !node->is_constant())
             {
-                writer << "if (ctx->first_iteration ";
+                unit_writer << "if (ctx->first_iteration ";
                 for (const descriptor::Input& input : node->get_inputs())
                 {
                     const descriptor::Output& output = input.get_output();
@@ -918,29 +1107,30 @@ using namespace ngraph::runtime;
 
                     if (output.get_node()->is_parameter())
                     {
-                        writer << " || ctx->p_en[" << param_index_map[input_name] << "]";
+                        unit_writer << " || ctx->p_en[" << param_index_map[input_name] << "]";
                     }
                     else if (!output.get_node()->is_constant())
                     {
-                        writer << " || t_en[" << tensor_index_map[input_name] << "]";
+                        unit_writer << " || t_en[" << tensor_index_map[input_name] << "]";
                     }
                 }
 
                 // Always enable nodes computing output tensors or nodes whose outputs might get
                 // overwritten due to inplace kernels
                 // TODO (jbobba) - Do we need to handle cacheability
-                if (computes_result(node.get()) || possibly_overwritten(node.get()))
+                if (computes_result(node.get()) || possibly_overwritten(node.get()) ||
+                    m_workspace != nullptr)
                 {
-                    writer << " || 1";
+                    unit_writer << " || 1";
                 }
-                writer << ") {\n";
-                writer.indent++;
+                unit_writer << ") {\n";
+                unit_writer.indent++;
             }
 
             auto it = node_function_map.find(node.get());
             if (it == node_function_map.end())
             {
-                handler->second(this, writer, node.get(), in, out);
+                handler->second(this, unit_writer, node.get(), in, out);
             }
             else
             {
@@ -955,7 +1145,13 @@ using namespace ngraph::runtime;
                 {
                     names.push_back(tv.get_name());
                 }
-                writer << func_name << "(" << join(names) << ", ctx, cg_ctx);\n";
+                unit_writer << func_name << "(" << join(names) << ", ctx, cg_ctx);\n";
+                auto& common_functions = unit_common_functions[unit];
+                if (find(common_functions.begin(), common_functions.end(), it->second) ==
+                    common_functions.end())
+                {
+                    common_functions.push_back(it->second);
+                }
             }
 
             // skip multi-output nodes since they would be covered by GetOutputElement
@@ -970,12 +1166,12 @@ using namespace ngraph::runtime;
                 {
                     if (std::getenv("NGRAPH_CPU_NAN_CHECK"))
                     {
-                        generate_isnan_isinf_check(writer, node, out, "isnan");
+                        generate_isnan_isinf_check(unit_writer, node, out, "isnan");
                     }
 
                     if (std::getenv("NGRAPH_CPU_INF_CHECK"))
                     {
-                        generate_isnan_isinf_check(writer, node, out, "isinf");
+                        generate_isnan_isinf_check(unit_writer, node, out, "isinf");
                     }
                 }
             }
@@ -985,30 +1181,63 @@ using namespace ngraph::runtime;
             {
                 for (auto output_name : node_output_names)
                 {
-                    writer << "t_en[" << tensor_index_map[output_name] << "] = true;\n";
+                    unit_writer << "t_en[" << tensor_index_map[output_name] << "] = true;\n";
                 }
-                writer.indent--;
-                writer << "} else {\n";
-                writer.indent++;
+                unit_writer.indent--;
+                unit_writer << "} else {\n";
+                unit_writer.indent++;
                 for (auto output_name : node_output_names)
                 {
-                    writer << "t_en[" << tensor_index_map[output_name] << "] = false;\n";
+                    unit_writer << "t_en[" << tensor_index_map[output_name] << "] = false;\n";
                 }
-                writer.indent--;
-                writer << "}\n";
-                emit_debug_function_exit(writer, node.get(), in, out);
+                unit_writer.indent--;
+                unit_writer << "}\n";
+                emit_debug_function_exit(unit_writer, node.get(), in, out);
                 if (runtime::cpu::IsTracingEnabled() &&
                     current_function->get_name() == m_function_name)
                 {
-                    writer << "ctx->op_durations[profiler_count++] = "
-                           << "(std::chrono::duration_cast<cpu::Timescale>(cpu::Clock::now() - "
-                              "start_ts)).count();\n";
+                    unit_writer << "ctx->op_durations[profiler_count++] = "
+                                << "(std::chrono::duration_cast<cpu::Timescale>("
+                                   "cpu::Clock::now() - start_ts)).count();\n";
                 }
                 if (m_use_tbb)
                 {
-                    writer.indent--;
-                    writer << "});\n";
+                    unit_writer.indent--;
+                    unit_writer << "});\n";
+                }
+            }
+        }
+
+        if (unit_count == 1)
+        {
+            writer << unit_writers[0].get_code();
+        }
+        else
+        {
+            for (size_t unit = 0; unit < unit_count; unit++)
+            {
+                string unit_function_name =
+                    current_function->get_name() + "_part" + to_string(unit);
+                CodeWriter unit_source;
+                unit_source << pch_header_source;
+                unit_source << unit_declarations.get_code();
+                unit_source << "extern bool " << current_function->get_name() << "_t_en["
+                            << tensor_index << "];\n\n";
+                for (Node* common_function : unit_common_functions[unit])
+                {
+                    string function_name =
+                        ngraph::pass::CommonFunctionCollection::create_function_name(
+                            *common_function);
+                    unit_source << emit_op_as_function(*common_function, function_name) << "\n";
                 }
+                unit_source << "extern \"C\" void " << unit_function_name << func_params << "\n";
+                unit_source.block_begin();
+                unit_source << unit_prologue.get_code();
+                unit_source << unit_writers[unit].get_code();
+                unit_source.block_end();
+                unit_sources.push_back(unit_source.get_code());
+
+                writer << unit_function_name << "(inputs, outputs, ctx, cg_ctx);\n";
             }
         }
 
@@ -1058,20 +1287,33 @@ using namespace ngraph::runtime;
     string filename = file_util::path_join(s_output_dir, m_function_name + "_codegen.cpp");
     string code = writer.get_code();
     runtime::cpu::CPU_ExternalFunction::write_to_file(writer.get_code(), s_output_dir, filename);
+    for (size_t unit = 0; unit < unit_sources.size(); unit++)
+    {
+        string unit_filename = file_util::path_join(
+            s_output_dir, m_function_name + "_codegen_part" + to_string(unit) + ".cpp");
+        runtime::cpu::CPU_ExternalFunction::write_to_file(
+            unit_sources[unit], s_output_dir, unit_filename);
+    }
+
+    phase_timer.end_phase("emit code");
 
-    m_compiler.reset(new codegen::Compiler());
     m_execution_engine.reset(new codegen::ExecutionEngine());
 
     m_compiler->set_precompiled_header_source(pch_header_source);
 
-    auto codegen_module = m_compiler->compile(code);
+    unit_sources.insert(unit_sources.begin(), code);
+    auto codegen_modules = m_compiler->compile(unit_sources);
 
-    if (codegen_module == nullptr)
+    for (auto& codegen_module : codegen_modules)
     {
-        throw runtime_error("function failed to compile");
+        if (codegen_module == nullptr)
+        {
+            throw runtime_error("function failed to compile");
+        }
+        m_execution_engine->add_module(codegen_module);
     }
-    m_execution_engine->add_module(codegen_module);
     m_execution_engine->finalize();
+    phase_timer.end_phase("jit compile");
 
     m_compiled_init_ctx_func = m_execution_engine->find_function<InitContextFuncTy>("init_cg_ctx");
 
@@ -1131,6 +1373,13 @@ using namespace ngraph::runtime;
         }
     }
 
+    if (runtime::cpu::IsTracingEnabled())
+    {
+        m_trace_id = TimelineRecorder::get().register_function(
+            m_function_name, m_op_attrs, std::vector<std::string>());
+    }
+    record_memory_statistics();
+    record_result_copies();
     m_is_compiled = true;
     if (m_release_function)
     {
@@ -1143,10 +1392,44 @@ using namespace ngraph::runtime;
 void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     ngraph::pass::Manager& pass_manager, ngraph::pass::PassConfig& pass_config)
 {
+    if (pass_config.get_pass_attribute(ngraph::pass::PassProfile::PROFILE_ATTRIBUTE))
+    {
+        pass_manager.set_pass_profiling(true);
+    }
     auto pass_map = pass_config.get_enables();
 
     auto dex = is_direct_execution();
     auto is_supported = [dex](const Node& node) {
+        // ConvolutionBias only has an MKLDNN kernel, other cases are decomposed
+        if (typeid(node) == typeid(ngraph::op::ConvolutionBias) &&
+            !runtime::cpu::mkldnn_utils::can_use_mkldnn_conv<ngraph::op::ConvolutionBias>(
+                const_cast<Node*>(&node)))
+        {
+            return false;
+        }
+        // The optimizer update, finite check, attention, layer norm and gelu kernels only
+        // cover f32 and f64
+        if ((typeid(node) == typeid(ngraph::op::SgdMomentumUpdate) ||
+             typeid(node) == typeid(ngraph::op::AdamUpdate) ||
+             typeid(node) == typeid(ngraph::op::ScaledDotProductAttention) ||
+             typeid(node) == typeid(ngraph::op::LayerNorm) ||
+             typeid(node) == typeid(ngraph::op::Gelu)) &&
+            node.get_input_element_type(0) != element::f32 &&
+            node.get_input_element_type(0) != element::f64)
+        {
+            return false;
+        }
+        if (typeid(node) == typeid(ngraph::op::AllFinite))
+        {
+            for (size_t i = 0; i < node.get_input_size(); i++)
+            {
+                if (node.get_input_element_type(i) != element::f32 &&
+                    node.get_input_element_type(i) != element::f64)
+                {
+                    return false;
+                }
+            }
+        }
         if (dex)
         {
             auto handler = GetGlobalBuildDispatcher().find(type_index(typeid(node)));
@@ -1174,7 +1457,20 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS_WITH_ARGS(FusedOpDecomposition, true, ngraph::pass, is_supported);
     REGISTER_KNOBBED_PASS(NopElimination, true, ngraph::pass);
     REGISTER_KNOBBED_PASS(ZeroDimTensorElimination, true, ngraph::pass);
+    // Off by default since it changes results, i8 unless the F16 attribute is set
+    auto embedding_table_type = pass_config.get_pass_attribute("EmbeddingQuantization::F16")
+                                    ? element::f16
+                                    : element::i8;
+    REGISTER_KNOBBED_PASS_WITH_ARGS(
+        EmbeddingQuantization, false, ngraph::pass, embedding_table_type);
+    m_deduplicated_constant_bytes = 0;
+    REGISTER_KNOBBED_PASS_WITH_ARGS(
+        ConstantDeduplication, true, ngraph::pass, m_deduplicated_constant_bytes);
+    REGISTER_KNOBBED_PASS(SparseAllReduce, true, ngraph::pass);
+    REGISTER_KNOBBED_PASS(AllReduceFusion, true, ngraph::pass);
+    REGISTER_KNOBBED_PASS(QuantizedRnnDotLowering, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(LSTMFusion, true, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(GRUFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(RNNFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(AlgebraicSimplification, true, ngraph::pass);
     REGISTER_KNOBBED_PASS(MultiLayerRNNFusion, true, runtime::cpu::pass);
@@ -1184,11 +1480,13 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(CPUBatchFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(ReshapeSinking, false, ngraph::pass);
     REGISTER_KNOBBED_PASS(ReshapeElimination, false, ngraph::pass);
+    REGISTER_KNOBBED_PASS(BatchNormFolding, true, ngraph::pass);
     REGISTER_KNOBBED_PASS(CoreFusion, true, ngraph::pass);
     REGISTER_KNOBBED_PASS(CPUFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(CPUQuantFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(CPUHorizontalFusion, true, runtime::cpu::pass);
     REGISTER_KNOBBED_PASS(CPUCollapseDims, true, runtime::cpu::pass);
+    REGISTER_KNOBBED_PASS(CPULoopKernelFusion, false, runtime::cpu::pass);
 #if defined(NGRAPH_HALIDE)
     REGISTER_KNOBBED_PASS(HalideSubgraphExtraction, true, ngraph::runtime::cpu::pass);
 #endif
@@ -1206,14 +1504,182 @@ void runtime::cpu::CPU_ExternalFunction::register_common_passes(
     REGISTER_KNOBBED_PASS(GetOutputElementElimination, false, ngraph::pass);
     REGISTER_KNOBBED_PASS_WITH_ARGS(
         PropagateCacheability, true, ngraph::pass, runtime::cpu::get_annotations_factory());
+    REGISTER_KNOBBED_PASS(AllReduceScheduling, true, ngraph::pass);
     bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                         pass_config.get_pass_attribute("ReuseMemory");
+    bool optimal_planning =
+        pass_config.get_pass_attribute("CPUMemoryAssignment::OptimalPlanning") ||
+        pass_config.get_pass_attribute("OptimalMemoryPlanning");
     pass_manager.register_pass<runtime::cpu::pass::CPUMemoryAssignment>(
-        bufferID_to_tensorSets, tensor_to_bufferID, size_t(s_memory_pool_alignment), !reuse_memory);
+        bufferID_to_tensorSets,
+        tensor_to_bufferID,
+        size_t(s_memory_pool_alignment),
+        !reuse_memory,
+        optimal_planning ? ngraph::pass::MemoryManager::allocation_scheme::OPTIMAL
+                         : ngraph::pass::MemoryManager::allocation_scheme::FIRST_FIT);
 
     pass_manager.get_state().set_visualize_tree_ops_map(runtime::cpu::get_visualize_tree_ops_map());
 }
 
+void runtime::cpu::CPU_ExternalFunction::update_constants(
+    const std::map<const ngraph::op::Constant*, const void*>& values)
+{
+    if (!m_direct_execution || !m_is_built)
+    {
+        throw ngraph_error("CPU Backend: constants can only be updated in built DEX functions");
+    }
+
+    vector<UpdatableConstant*> updates;
+    for (auto& value : values)
+    {
+        auto it = m_updatable_constant_index.find(value.first);
+        if (it == m_updatable_constant_index.end())
+        {
+            throw ngraph_error("CPU Backend: constant " + value.first->get_name() +
+                               " was folded during compilation and can not be updated; pass it "
+                               "as a cacheable Parameter instead");
+        }
+        auto& constant = m_updatable_constants[it->second];
+        if (m_merged_constants.count(constant.node))
+        {
+            throw ngraph_error("CPU Backend: constant " + value.first->get_name() +
+                               " was merged with equal constants during compilation and can "
+                               "not be updated on its own");
+        }
+        updates.push_back(&constant);
+    }
+
+    // Check everything before writing anything, so that a failed update changes nothing
+    auto update = updates.begin();
+    for (auto& value : values)
+    {
+        auto& constant = **update++;
+        // Data shared with copies of the constant, e.g. in other executables compiled from
+        // the same model, is copied first; contexts pick up the new buffer on their next call
+        if (constant.node->make_data_unique())
+        {
+            constant.tensor_data->second = const_cast<void*>(constant.node->get_data_ptr());
+        }
+        size_t size = shape_size(constant.node->get_shape()) *
+                      constant.node->get_element_type().size();
+        memcpy(const_cast<void*>(constant.node->get_data_ptr()), value.second, size);
+        constant.version++;
+    }
+}
+
+void runtime::cpu::CPU_ExternalFunction::prepare_context(CPURuntimeContext* ctx)
+{
+    if (ctx->prepared)
+    {
+        return;
+    }
+    // Primitive creation dominates the first iteration of convolution-heavy functions; the
+    // indices were reserved in node order at build time
+    tbb::task_group primitive_builds;
+    for (auto& builder : m_mkldnn_primitive_builders)
+    {
+        primitive_builds.run([&builder, ctx]() { builder(ctx); });
+    }
+    primitive_builds.wait();
+    NGRAPH_DEBUG << "MKL-DNN primitive descriptor cache: "
+                 << runtime::cpu::MKLDNNPrimitiveCache::get().get_stats();
+    ctx->prepared = true;
+}
+
+void runtime::cpu::CPU_ExternalFunction::compute_shared_values(CPURuntimeContext* ctx)
+{
+    NGRAPH_CHECK(m_direct_execution && m_is_built,
+                 "Shared values are only computed for built DEX functions");
+    prepare_context(ctx);
+
+    for (auto& p : constant_tensor_data)
+    {
+        ctx->buffer_data[p.first] = p.second;
+    }
+    for (auto& tensor : m_shared_tensors)
+    {
+        if (tensor.buffer == nullptr)
+        {
+            tensor.buffer.reset(new AlignedBuffer(tensor.size, s_memory_pool_alignment));
+        }
+        ctx->buffer_data[tensor.buffer_index] = tensor.buffer->get_ptr();
+    }
+
+    // Kernels that set themselves up on the first iteration of a context did so the first
+    // time these ops ran on `ctx`
+    bool first_iteration = ctx->first_iteration;
+    ctx->first_iteration = first_iteration && !m_shared_values_computed;
+    for (size_t index = 0; index < functors.size(); index++)
+    {
+        if (m_shared_ops.at(index))
+        {
+            CPUExecutionContext ectx{ctx->arena, m_serial_ops.at(index)};
+            executor::GetCPUExecutor().execute(functors.at(index), ctx, &ectx);
+        }
+    }
+    ctx->first_iteration = first_iteration;
+    m_shared_values_computed = true;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::release_shared_values()
+{
+    size_t released = get_shared_values_size();
+    m_shared_values_computed = false;
+    for (auto& tensor : m_shared_tensors)
+    {
+        tensor.buffer.reset();
+    }
+    return released;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_shared_values_size() const
+{
+    size_t size = 0;
+    if (m_shared_values_computed)
+    {
+        for (auto& tensor : m_shared_tensors)
+        {
+            size += tensor.size;
+        }
+    }
+    return size;
+}
+
+// Ops whose work is under this many elements, weighted by their cost per element, run their
+// Eigen expressions on the calling thread: waking the pool takes longer than such an op does
+// on one thread. Set by NGRAPH_CPU_SERIAL_WORK, where 0 lets every op use the pool.
+static size_t get_serial_work_threshold()
+{
+    static const size_t threshold = std::getenv("NGRAPH_CPU_SERIAL_WORK") == nullptr
+                                        ? 32768
+                                        : std::atol(std::getenv("NGRAPH_CPU_SERIAL_WORK"));
+    return threshold;
+}
+
+// Rough work of a node, counting each element it reads or writes, with transcendental and
+// division ops weighted by their higher cost per element
+static size_t estimate_work(const Node& node)
+{
+    static const unordered_set<type_index> s_expensive_ops{TI(ngraph::op::Divide),
+                                                           TI(ngraph::op::Erf),
+                                                           TI(ngraph::op::Exp),
+                                                           TI(ngraph::op::Log),
+                                                           TI(ngraph::op::Power),
+                                                           TI(ngraph::op::Sigmoid),
+                                                           TI(ngraph::op::Softmax),
+                                                           TI(ngraph::op::Tanh)};
+    size_t elements = 0;
+    for (size_t i = 0; i < node.get_input_size(); i++)
+    {
+        elements += shape_size(node.get_input_shape(i));
+    }
+    for (size_t i = 0; i < node.get_output_size(); i++)
+    {
+        elements += shape_size(node.get_output_shape(i));
+    }
+    return s_expensive_ops.count(type_index(typeid(node))) ? 8 * elements : elements;
+}
+
 bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
 {
     for (size_t i = 0; i < node->get_output_size(); i++)
@@ -1228,6 +1694,89 @@ bool runtime::cpu::CPU_ExternalFunction::computes_result(Node* node)
     return false;
 }
 
+void runtime::cpu::CPU_ExternalFunction::build_dex_scheduler(
+    ngraph::pass::PassConfig& pass_config)
+{
+    // Ops may only run out of program order when every intermediate has its own buffer
+    bool reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
+                        pass_config.get_pass_attribute("ReuseMemory");
+    m_num_dex_workers = reuse_memory ? 1 : executor::GetCPUExecutor().get_num_dex_workers();
+    if (m_num_dex_workers < 2 || m_use_tbb)
+    {
+        return;
+    }
+
+    // Functor indices follow the order in which build() visited the ops
+    unordered_map<Node*, size_t> op_index;
+    vector<Node*> ops;
+    for (shared_ptr<Node> node : m_function->get_ordered_ops())
+    {
+        if (!node->is_parameter() && !node->is_constant())
+        {
+            op_index[node.get()] = ops.size();
+            ops.push_back(node.get());
+        }
+    }
+    NGRAPH_CHECK(ops.size() == functors.size());
+
+    m_dex_scheduler.set_num_ops(ops.size());
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        Node* node = ops[i];
+        auto add_dependency = [&](Node* from) {
+            auto it = op_index.find(from);
+            if (it != op_index.end())
+            {
+                m_dex_scheduler.add_dependency(it->second, i);
+            }
+        };
+        for (auto& arg : node->get_arguments())
+        {
+            add_dependency(arg.get());
+        }
+        for (auto& dep : node->get_control_dependencies())
+        {
+            add_dependency(dep.get());
+        }
+
+        // A destructive in-place op overwrites its input, so it must also wait for every other
+        // op reading that input
+        if (node->is_op())
+        {
+            auto op = static_cast<ngraph::op::Op*>(node);
+            if (auto op_annotations = op->get_op_annotations())
+            {
+                for (auto oi_pair : op_annotations->get_in_place_oi_pairs())
+                {
+                    if (!oi_pair.destructive)
+                    {
+                        continue;
+                    }
+                    auto& output = node->get_inputs().at(oi_pair.input).get_output();
+                    for (auto reader : output.get_inputs())
+                    {
+                        auto it = op_index.find(reader->get_node().get());
+                        if (it != op_index.end() && it->second < i)
+                        {
+                            m_dex_scheduler.add_dependency(it->second, i);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Output size is the cost hint: it tracks the work of most kernels well enough to
+        // start long chains first
+        size_t cost = 0;
+        for (size_t j = 0; j < node->get_output_size(); j++)
+        {
+            cost += shape_size(node->get_output_shape(j));
+        }
+        m_dex_scheduler.set_cost(i, cost);
+    }
+    m_dex_scheduler.finalize();
+}
+
 void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_config)
 {
     if (m_is_built)
@@ -1235,20 +1784,76 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         return;
     }
 
-    if (m_use_tbb && (runtime::cpu::IsTracingEnabled() || m_emit_timing))
+    if (m_use_tbb && m_emit_timing)
     {
         throw ngraph_error(
-            "CPU Backend: Tracing and performance breakdowns might not be accurate with TBB "
-            "enabled due to concurrent graph execution");
+            "CPU Backend: Performance breakdowns might not be accurate with TBB enabled due to "
+            "concurrent graph execution");
     }
 
     // stream writer to dump the debug manifest for the DEX
     static const string s_debug_dir = "cpu_codegen";
     static StaticInitializers s_static_initializers(s_debug_dir);
     m_mkldnn_emitter.reset(new MKLDNNEmitter());
+    m_deterministic_reductions =
+        pass_config.get_pass_attribute(CPU_Executable::DETERMINISTIC_REDUCTIONS_ATTRIBUTE);
+
+    // The batch is the leading dimension of the parameters that are not cacheable; it is set
+    // before the passes, which keep the nodes on the batch off MKL-DNN
+    if (pass_config.get_pass_attribute(CPU_Executable::BATCH_POLYMORPHIC_ATTRIBUTE))
+    {
+        for (auto& parameter : m_function->get_parameters())
+        {
+            if (parameter->get_cacheable())
+            {
+                continue;
+            }
+            const Shape& shape = parameter->get_shape();
+            NGRAPH_CHECK(!shape.empty() && shape[0] != 0 &&
+                             (m_batch_size == 0 || shape[0] == m_batch_size),
+                         "Batch polymorphic function has parameter ",
+                         parameter->get_name(),
+                         " of shape ",
+                         shape,
+                         ", its parameters that are not cacheable must share a nonzero leading "
+                         "dimension");
+            m_batch_size = shape[0];
+        }
+        NGRAPH_CHECK(m_batch_size != 0,
+                     "Batch polymorphic function has no parameter that is not cacheable");
+    }
+
     ngraph::pass::Manager pass_manager;
     register_common_passes(pass_manager, pass_config);
-    pass_manager.run_passes(m_function, false);
+    {
+        ReplaceNodeObserver merged_constants(
+            [this](const shared_ptr<Node>& target, const shared_ptr<Node>& replacement) {
+                if (target->is_constant() && replacement->is_constant())
+                {
+                    m_merged_constants.insert(replacement);
+                }
+            });
+        pass_manager.run_passes(m_function, false);
+    }
+    m_compile_profile = pass_manager.get_profile();
+    CompilePhaseTimer phase_timer(m_compile_profile);
+    if (m_constant_pool)
+    {
+        // After the passes, so that weights are compared in the layouts they are used in
+        for (auto& node : m_function->get_ordered_ops())
+        {
+            if (auto constant = dynamic_pointer_cast<ngraph::op::Constant>(node))
+            {
+                m_constant_pool->share(*constant);
+            }
+        }
+        phase_timer.end_phase("share constants");
+    }
+    m_layout_conversions = find_layout_conversions(*m_function);
+    if (std::getenv("NGRAPH_CPU_LAYOUT_REPORT") != nullptr)
+    {
+        print_layout_conversions(std::cout, m_layout_conversions);
+    }
 
     // Store layouts assigned for arguments
     for (const auto& parameter : m_function->get_parameters())
@@ -1286,8 +1891,42 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         }
     }
 
+    // Calls on a smaller batch pass tensors of other shapes than the batched parameters and
+    // results. Their layouts are not converted, so they must be native.
+    if (is_batch_polymorphic())
+    {
+        find_batched_nodes(m_function->get_ordered_ops());
+        auto batched_shape = [this](const Node* node,
+                                    const shared_ptr<LayoutDescriptor>& layout) {
+            if (!is_batched(node))
+            {
+                return Shape{};
+            }
+            NGRAPH_CHECK(!layout->is_mkldnn_layout(),
+                         "Batched tensor of ",
+                         node->get_name(),
+                         " was given an MKL-DNN layout");
+            return node->get_shape();
+        };
+        const auto& parameters = m_function->get_parameters();
+        for (size_t i = 0; i < parameters.size(); i++)
+        {
+            m_batched_input_shapes.push_back(
+                batched_shape(parameters[i].get(), parameter_layout_descriptors.at(i)));
+        }
+        const auto& results = m_function->get_results();
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            m_batched_output_shapes.push_back(
+                batched_shape(results[i].get(), result_layout_descriptors.at(i)));
+        }
+    }
+
     // Build executor
     size_t buffer_index = 0;
+    auto get_stale_index = [this](const std::string& name) {
+        return tensor_stale_index.emplace(name, tensor_stale_index.size()).first->second;
+    };
     // Temporaries
     if (m_function->get_temporary_pool_size())
     {
@@ -1315,9 +1954,14 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         {
             auto output_tensor = &node->get_output_tensor();
             m_buffer_indices[output_tensor->get_name()] = buffer_index;
-            constant_tensor_data.emplace_back(
-                buffer_index,
-                const_cast<void*>(static_pointer_cast<ngraph::op::Constant>(node)->get_data_ptr()));
+            auto constant = static_pointer_cast<ngraph::op::Constant>(node);
+            constant_tensor_data.emplace_back(buffer_index,
+                                              const_cast<void*>(constant->get_data_ptr()));
+            m_updatable_constant_index[constant.get()] = m_updatable_constants.size();
+            m_updatable_constants.push_back({constant,
+                                             get_stale_index(output_tensor->get_name()),
+                                             prev(constant_tensor_data.end()),
+                                             0});
             auto tensor_set = get_tensor_set(output_tensor);
             // process all tensors in the set containing the output tensor of the constant
             for (auto& ele_t : tensor_set)
@@ -1342,7 +1986,7 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
             auto output_tensor = &param->get_outputs().at(i).get_tensor();
             auto tensor_set = get_tensor_set(output_tensor);
 
-            auto& stale = tensor_stale[output_tensor->get_name()];
+            auto stale = get_stale_index(output_tensor->get_name());
             // process all tensors in the set containing the output tensor of the parameter
             for (auto& ele_t : tensor_set)
             {
@@ -1378,6 +2022,14 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
     // After processing inputs, outputs, constants, and intermediates, set the buffer size.
     m_buffer_size = buffer_index;
+    phase_timer.end_phase("buffer assignment");
+
+    auto has_role = [this](const string& name, CPUTensorRole role) {
+        auto it = m_tensor_roles.find(name);
+        return it != m_tensor_roles.end() && it->second == role;
+    };
+    // outputs of the ops compute_shared_values computes
+    unordered_set<string> shared_tensor_names;
 
     for (shared_ptr<Node> node : m_function->get_ordered_ops())
     {
@@ -1413,8 +2065,36 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
 
         m_op_attrs.emplace_back(node->description(), out_names, in_names);
         op_names.push_back(node->get_name());
+        m_serial_ops.push_back(estimate_work(n) < get_serial_work_threshold());
         handler->second(this, node.get(), in, out);
 
+        // Wait for the non-blocking all-reduces and receives that write the inputs of the node
+        vector<size_t> request_indices;
+        for (const auto& name : in_names)
+        {
+            auto it = m_distributed_requests.find(name);
+            if (it != m_distributed_requests.end())
+            {
+                request_indices.push_back(it->second);
+            }
+        }
+        if (!request_indices.empty())
+        {
+            auto kernel = functors.back();
+            functors.back() = [kernel, request_indices](CPURuntimeContext* ctx,
+                                                        CPUExecutionContext* ectx) {
+                for (auto index : request_indices)
+                {
+                    if (auto request = ctx->distributed_requests[index])
+                    {
+                        request->wait();
+                        ctx->distributed_requests[index] = nullptr;
+                    }
+                }
+                kernel(ctx, ectx);
+            };
+        }
+
         auto cacheable = true;
         auto reuse_memory = pass_config.get_pass_attribute("CPUMemoryAssignment::ReuseMemory") ||
                             pass_config.get_pass_attribute("ReuseMemory");
@@ -1428,39 +2108,42 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         bool disable_caching =
             (reuse_memory &&
              !cacheable) // Check cacheability only if we are reusing intermediate tensors
-            || computes_result(node.get()) || possibly_overwritten(node.get());
+            || computes_result(node.get()) || possibly_overwritten(node.get()) ||
+            m_workspace != nullptr;
 
-        vector<reference_wrapper<bool>> in_stale, out_stale;
+        vector<size_t> in_stale, out_stale;
         for (const auto& name : in_names)
         {
             if (tensor_alias.count(name))
             {
-                in_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                in_stale.emplace_back(get_stale_index(tensor_alias[name]));
             }
             else
             {
-                in_stale.emplace_back(tensor_stale[name]);
+                in_stale.emplace_back(get_stale_index(name));
             }
         }
         for (const auto& name : out_names)
         {
             if (tensor_alias.count(name))
             {
-                out_stale.emplace_back(tensor_stale[tensor_alias[name]]);
+                out_stale.emplace_back(get_stale_index(tensor_alias[name]));
             }
             else
             {
-                out_stale.emplace_back(tensor_stale[name]);
+                out_stale.emplace_back(get_stale_index(name));
             }
         }
 
+        // Staleness flags live in the runtime context so that concurrent calls on different
+        // contexts each track what their own cached intermediates were computed from
         function<bool(CPURuntimeContext*)> enable;
         if (disable_caching)
         {
             enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
-                for (auto& stale : out_stale)
+                for (auto stale : out_stale)
                 {
-                    stale.get() = true;
+                    ctx->t_en[stale] = true;
                 }
                 return true;
             };
@@ -1469,17 +2152,17 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         {
             enable = [in_stale, out_stale](CPURuntimeContext* ctx) -> bool {
                 bool en = false;
-                for (const auto& stale : in_stale)
+                for (auto stale : in_stale)
                 {
-                    if (stale)
+                    if (ctx->t_en[stale])
                     {
                         en = true;
                         break;
                     }
                 }
-                for (auto& stale : out_stale)
+                for (auto stale : out_stale)
                 {
-                    stale.get() = en;
+                    ctx->t_en[stale] = en;
                 }
                 return en;
             };
@@ -1488,9 +2171,51 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         enables.emplace_back(enable);
         enable_nodename_list.emplace_back(make_pair(enable, node->get_name()));
 
+        // A cached op computed from constants alone, whose outputs do not share their buffers
+        // with other tensors, can be computed once for all the contexts
+        bool shared = !disable_caching && !in_names.empty();
+        for (const auto& name : in_names)
+        {
+            shared = shared && (has_role(name, CPUTensorRole::CONSTANT) ||
+                                shared_tensor_names.count(name) != 0);
+        }
+        for (size_t i = 0; i < node->get_output_size() && shared; i++)
+        {
+            auto tensor = &node->get_output_tensor(i);
+            shared = has_role(tensor->get_name(), CPUTensorRole::INTERMEDIATE) &&
+                     tensor_alias.count(tensor->get_name()) == 0 &&
+                     tensor_to_bufferID.count(tensor) != 0 && get_tensor_set(tensor).size() == 1;
+        }
+        m_shared_ops.push_back(shared);
+        for (size_t i = 0; i < node->get_output_size() && shared; i++)
+        {
+            auto& tensor = node->get_output_tensor(i);
+            shared_tensor_names.insert(tensor.get_name());
+            m_shared_tensors.push_back(
+                {get_buffer_index(tensor.get_name()), tensor.size(), nullptr});
+        }
+
         m_perf_counters.emplace_back(node, 0, 0);
     }
 
+    if (is_batch_polymorphic())
+    {
+        for (auto& node : m_function->get_ordered_ops())
+        {
+            NGRAPH_CHECK(node->is_parameter() || !is_batched(node.get()) ||
+                             m_batch_scaled_nodes.count(node.get()),
+                         "Batch polymorphic function has ",
+                         node->get_name(),
+                         " on the batch, whose CPU kernel can not run on a smaller batch");
+        }
+        m_batched_nodes.clear();
+        m_batch_scaled_nodes.clear();
+    }
+
+    phase_timer.end_phase("build kernels");
+    build_dex_scheduler(pass_config);
+    phase_timer.end_phase("schedule");
+
     if ((std::getenv("NGRAPH_DEX_DEBUG") != nullptr))
     {
         string filename = file_util::path_join(s_debug_dir, m_function_name + "_debug.txt");
@@ -1555,27 +2280,64 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
     NGRAPH_CHECK(m_op_attrs.size() == functors.size());
 
     executor = [&](CPURuntimeContext* ctx, vector<void*>& inputs, vector<void*>& outputs) {
-        cpu::Timestamp start_ts, end_ts;
         int profiler_count = 0;
 
-        if (ctx->first_iteration)
+        // One call in m_latency_sample_period records its latencies
+        cpu::Timestamp call_start_ts;
+        size_t sample_period = m_latency_sample_period.load(std::memory_order_relaxed);
+        ctx->sampled_latencies = nullptr;
+        if (sample_period != 0 && ctx->latency_calls++ % sample_period == 0)
+        {
+            ctx->sampled_latencies = ctx->latencies.load(std::memory_order_relaxed);
+            if (ctx->sampled_latencies == nullptr)
+            {
+                ctx->sampled_latencies = new LatencyRecorder(functors.size());
+                ctx->latencies.store(ctx->sampled_latencies, std::memory_order_release);
+            }
+            call_start_ts = cpu::Clock::now();
+        }
+
+        // A shared workspace may lend a different pool to every call
+        if (ctx->first_iteration || m_workspace != nullptr)
         {
             for (auto& p : intermediates_offsets)
             {
                 ctx->buffer_data[p.first] =
                     static_cast<uint8_t*>(ctx->memory_buffers[0]->get_ptr()) + p.second;
             }
+        }
+
+        // Constants updated through update_constants may have moved to a buffer of their own
+        for (auto& p : constant_tensor_data)
+        {
+            ctx->buffer_data[p.first] = p.second;
+        }
 
-            for (auto& p : constant_tensor_data)
+        prepare_context(ctx);
+
+        // Values computed once for all the contexts by compute_shared_values
+        bool shared_values = m_shared_values_computed.load(std::memory_order_relaxed);
+        if (shared_values)
+        {
+            for (auto& tensor : m_shared_tensors)
             {
-                ctx->buffer_data[p.first] = p.second;
+                ctx->buffer_data[tensor.buffer_index] = tensor.buffer->get_ptr();
             }
         }
 
+        // Only the cached ops downstream of constants updated since the last call on this
+        // context run again
+        for (size_t i = 0; i < m_updatable_constants.size(); i++)
+        {
+            auto& constant = m_updatable_constants[i];
+            ctx->t_en[constant.stale_index] = ctx->c_versions[i] != constant.version;
+            ctx->c_versions[i] = constant.version;
+        }
+
         for (const auto& p : function_input_index_offset)
         {
             ctx->buffer_data[get<0>(p)] = static_cast<uint8_t*>(inputs[get<1>(p)]) + get<2>(p);
-            get<3>(p).get() = ctx->p_en[get<1>(p)];
+            ctx->t_en[get<3>(p)] = ctx->p_en[get<1>(p)];
         }
 
         for (const auto& p : function_output_index_offset)
@@ -1601,24 +2363,45 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                     tbb::flow::continue_node<tbb::flow::continue_msg>* flowgraph_node =
                         new tbb::flow::continue_node<tbb::flow::continue_msg>(
                             *(ctx->G), [&, functor, index](const tbb::flow::continue_msg& msg) {
-                                if (p(ctx) || ctx->first_iteration)
+                                if ((p(ctx) || ctx->first_iteration) &&
+                                    !(m_shared_values_computed && m_shared_ops.at(index)))
                                 {
-                                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                                    // Flow graph nodes run concurrently, so each keeps its own
+                                    // timestamps
+                                    cpu::Timestamp start_ts, end_ts;
+                                    HardwareCounters* hw_counters =
+                                        m_emit_timing && m_collect_hw_counters
+                                            ? HardwareCounters::get_thread_counters()
+                                            : nullptr;
+                                    HardwareCounterValues hw_start;
+                                    if (hw_counters && !hw_counters->read(hw_start))
+                                    {
+                                        hw_counters = nullptr;
+                                    }
+                                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing ||
+                                        ctx->sampled_latencies)
                                     {
                                         start_ts = cpu::Clock::now();
                                     }
-                                    CPUExecutionContext ectx{0};
+                                    CPUExecutionContext ectx{ctx->arena,
+                                                             m_serial_ops.at(index)};
                                     executor::GetCPUExecutor().execute(*functor, ctx, &ectx, true);
-                                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing ||
+                                        ctx->sampled_latencies)
                                     {
                                         end_ts = cpu::Clock::now();
 
+                                        HardwareCounterValues hw_end;
+                                        if (hw_counters && hw_counters->read(hw_end))
+                                        {
+                                            accumulate_hardware_counters(
+                                                m_perf_counters[index], hw_start, hw_end);
+                                        }
+
                                         if (runtime::cpu::IsTracingEnabled())
                                         {
-                                            ctx->op_durations[index] =
-                                                (std::chrono::duration_cast<cpu::Timescale>(
-                                                     end_ts - start_ts))
-                                                    .count();
+                                            TimelineRecorder::get().record_op(
+                                                m_trace_id, index, start_ts, end_ts);
                                         }
                                         if (m_emit_timing)
                                         {
@@ -1628,14 +2411,17 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                                                     .count();
                                             m_perf_counters[index].m_call_count++;
                                         }
+                                        if (ctx->sampled_latencies)
+                                        {
+                                            ctx->sampled_latencies->ops[index].record(
+                                                std::chrono::duration_cast<
+                                                    std::chrono::nanoseconds>(end_ts - start_ts)
+                                                    .count());
+                                        }
                                     }
                                 }
                                 else
                                 {
-                                    if (runtime::cpu::IsTracingEnabled())
-                                    {
-                                        ctx->op_durations[index] = 0;
-                                    }
                                     if (m_emit_timing)
                                     {
                                         m_perf_counters[index].m_call_count++;
@@ -1720,56 +2506,105 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
                 }
             }
 
-            for (; ctx->pc < functors.size(); ctx->pc++)
-            {
-                auto index = profiler_count++;
-                if ((enables.at(ctx->pc))(ctx) || ctx->first_iteration)
+            // Runs op `index` unless its cached outputs are still valid. Returns true if the op
+            // ran and a debugger breakpoint is set right after it.
+            // The ops of the shared values do not run, but their enables still pass the
+            // staleness of updated constants on
+            auto run_op = [&](size_t index) {
+                if (((enables.at(index))(ctx) || ctx->first_iteration) &&
+                    !(shared_values && m_shared_ops.at(index)))
                 {
+                    // Op boundaries are where lower priority calls give way
+                    executor::GetCPUExecutor().yield_to_higher_priority(ctx->priority);
                     // Each Op will have exactly one functor, start the clock before the exceution of functor
                     // and collect the profiler_count once the execution complets
-                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                    cpu::Timestamp op_start_ts;
+                    // Counters are read outside the timed region so the reads do not count
+                    // towards the op's wall time
+                    HardwareCounters* hw_counters = m_emit_timing && m_collect_hw_counters
+                                                        ? HardwareCounters::get_thread_counters()
+                                                        : nullptr;
+                    HardwareCounterValues hw_start;
+                    if (hw_counters && !hw_counters->read(hw_start))
                     {
-                        start_ts = cpu::Clock::now();
+                        hw_counters = nullptr;
                     }
-                    CPUExecutionContext ectx{0};
-                    executor::GetCPUExecutor().execute(functors.at(ctx->pc), ctx, &ectx);
-                    if (ctx->breakpoints.count(ctx->pc + 1))
+                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing ||
+                        ctx->sampled_latencies)
                     {
-                        ctx->pc++;
-                        break;
+                        op_start_ts = cpu::Clock::now();
+                    }
+                    // A run of serial ops executes back to back on this thread as one task,
+                    // with no pool wakeup between them
+                    CPUExecutionContext ectx{ctx->arena, m_serial_ops.at(index)};
+                    executor::GetCPUExecutor().execute(functors.at(index), ctx, &ectx);
+                    if (ctx->breakpoints.count(index + 1))
+                    {
+                        return true;
                     }
 
-                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing)
+                    if (runtime::cpu::IsTracingEnabled() || m_emit_timing ||
+                        ctx->sampled_latencies)
                     {
-                        end_ts = cpu::Clock::now();
+                        cpu::Timestamp op_end_ts = cpu::Clock::now();
+
+                        HardwareCounterValues hw_end;
+                        if (hw_counters && hw_counters->read(hw_end))
+                        {
+                            accumulate_hardware_counters(m_perf_counters[index], hw_start, hw_end);
+                        }
 
                         if (runtime::cpu::IsTracingEnabled())
                         {
-                            ctx->op_durations[index] =
-                                (std::chrono::duration_cast<cpu::Timescale>(end_ts - start_ts))
-                                    .count();
+                            TimelineRecorder::get().record_op(
+                                m_trace_id, index, op_start_ts, op_end_ts);
                         }
                         if (m_emit_timing)
                         {
                             m_perf_counters[index].m_total_microseconds +=
-                                std::chrono::duration_cast<std::chrono::microseconds>(end_ts -
-                                                                                      start_ts)
+                                std::chrono::duration_cast<std::chrono::microseconds>(
+                                    op_end_ts - op_start_ts)
                                     .count();
                             m_perf_counters[index].m_call_count++;
                         }
+                        if (ctx->sampled_latencies)
+                        {
+                            ctx->sampled_latencies->ops[index].record(
+                                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    op_end_ts - op_start_ts)
+                                    .count());
+                        }
                     }
                 }
                 else
                 {
-                    if (runtime::cpu::IsTracingEnabled())
-                    {
-                        ctx->op_durations[index] = 0;
-                    }
                     if (m_emit_timing)
                     {
                         m_perf_counters[index].m_call_count++;
                     }
                 }
+                return false;
+            };
+
+            if (m_num_dex_workers > 1 && ctx->pc == 0 && ctx->breakpoints.empty())
+            {
+                // Independent ops run concurrently; each op only touches its own
+                // counters, durations and staleness flags.
+                m_dex_scheduler.run(m_num_dex_workers, [&](size_t index) { run_op(index); });
+                ctx->pc = functors.size();
+                profiler_count = static_cast<int>(functors.size());
+            }
+            else
+            {
+                for (; ctx->pc < functors.size(); ctx->pc++)
+                {
+                    profiler_count++;
+                    if (run_op(ctx->pc))
+                    {
+                        ctx->pc++;
+                        break;
+                    }
+                }
             }
         }
         ctx->first_iteration = false;
@@ -1777,9 +2612,23 @@ void runtime::cpu::CPU_ExternalFunction::build(ngraph::pass::PassConfig& pass_co
         {
             NGRAPH_CHECK(m_op_attrs.size() == profiler_count);
         }
+        if (ctx->sampled_latencies)
+        {
+            ctx->sampled_latencies->call.record(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(cpu::Clock::now() -
+                                                                     call_start_ts)
+                    .count());
+        }
 
     };
 
+    if (runtime::cpu::IsTracingEnabled())
+    {
+        m_trace_id =
+            TimelineRecorder::get().register_function(m_function_name, m_op_attrs, op_names);
+    }
+    record_memory_statistics();
+    record_result_copies();
     m_is_built = true;
 
     if (m_release_function && !m_use_tbb)
@@ -1802,6 +2651,82 @@ size_t runtime::cpu::CPU_ExternalFunction::get_buffer_index(const std::string& n
     }
 }
 
+void runtime::cpu::CPU_ExternalFunction::find_batched_nodes(
+    const std::list<std::shared_ptr<Node>>& nodes)
+{
+    m_batched_nodes.clear();
+    for (auto& node : nodes)
+    {
+        bool batched = false;
+        if (auto parameter = dynamic_pointer_cast<ngraph::op::Parameter>(node))
+        {
+            batched = !parameter->get_cacheable();
+        }
+        for (auto& argument : node->get_arguments())
+        {
+            batched = batched || is_batched(argument.get());
+        }
+        if (batched)
+        {
+            m_batched_nodes.insert(node.get());
+        }
+    }
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::scale_with_batch(const Node* node)
+{
+    if (!is_batched(node))
+    {
+        return 0;
+    }
+    m_batch_scaled_nodes.insert(node);
+    return m_batch_size;
+}
+
+size_t runtime::cpu::CPU_ExternalFunction::get_call_batch_size(
+    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) const
+{
+    size_t batch = 0;
+    auto check = [&batch](const char* kind, size_t i, const Shape& shape, const Shape& batched) {
+        if (batched.empty())
+        {
+            return;
+        }
+        NGRAPH_CHECK(shape.size() == batched.size() && shape[0] != 0 && shape[0] <= batched[0] &&
+                         equal(shape.begin() + 1, shape.end(), batched.begin() + 1),
+                     kind,
+                     " ",
+                     i,
+                     " of shape ",
+                     shape,
+                     " does not have the shape ",
+                     batched,
+                     " of the batch polymorphic function, up to a smaller batch");
+        NGRAPH_CHECK(batch == 0 || shape[0] == batch,
+                     kind,
+                     " ",
+                     i,
+                     " has a batch of ",
+                     shape[0],
+                     " while the other tensors of the call have a batch of ",
+                     batch);
+        batch = shape[0];
+    };
+    NGRAPH_CHECK(inputs.size() == m_batched_input_shapes.size() &&
+                     outputs.size() == m_batched_output_shapes.size(),
+                 "Call of the batch polymorphic function has the wrong number of tensors");
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        check("Input", i, inputs[i]->get_shape(), m_batched_input_shapes[i]);
+    }
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        check("Output", i, outputs[i]->get_shape(), m_batched_output_shapes[i]);
+    }
+    return batch;
+}
+
 bool runtime::cpu::CPU_ExternalFunction::is_codegen(const ngraph::pass::PassConfig& pc)
 {
     auto attrs = pc.get_pass_attributes();
@@ -1857,6 +2782,154 @@ const runtime::cpu::LayoutDescriptorPtrs&
     return result_layout_descriptors;
 }
 
+void runtime::cpu::CPU_ExternalFunction::record_memory_statistics()
+{
+    // Recorded at compile time since the function may be released afterwards
+    m_memory_statistics = MemoryStatistics();
+    MemoryStatistics& stats = m_memory_statistics;
+    stats.temporary_bytes = m_function->get_temporary_pool_size();
+    stats.deduplicated_constant_bytes = m_deduplicated_constant_bytes;
+
+    // Live range of every tensor, in execution order
+    unordered_map<descriptor::Tensor*, pair<size_t, size_t>> live_ranges;
+    size_t position = 0;
+    for (auto& node : m_function->get_ordered_ops())
+    {
+        for (auto& output : node->outputs())
+        {
+            descriptor::Tensor* tensor = &output.get_tensor();
+            live_ranges.insert({tensor, {position, position}});
+            if (node->is_constant())
+            {
+                stats.constant_bytes += tensor->size();
+            }
+        }
+        for (auto& input : node->inputs())
+        {
+            auto it = live_ranges.find(&input.get_tensor());
+            if (it != live_ranges.end())
+            {
+                it->second.second = position;
+            }
+        }
+        position++;
+    }
+
+    // Every tensor in a buffer set beyond the one the buffer is sized for lives in memory it
+    // shares with the rest of the set. Destructive in-place outputs are put in their own set
+    // but placed at the offset of their input.
+    map<size_t, size_t> intermediate_sets;
+    for (auto& ele : bufferID_to_tensorSets)
+    {
+        size_t total = 0;
+        size_t largest = 0;
+        for (auto tensor : ele.second.second)
+        {
+            total += tensor->size();
+            largest = std::max(largest, tensor->size());
+        }
+        stats.in_place_bytes += total - largest;
+        if (ele.second.first == CPUTensorRole::INTERMEDIATE && !ele.second.second.empty())
+        {
+            size_t offset = (*ele.second.second.begin())->get_pool_offset();
+            auto it = intermediate_sets.find(offset);
+            if (it == intermediate_sets.end())
+            {
+                intermediate_sets.insert({offset, ele.first});
+            }
+            else
+            {
+                auto& other = bufferID_to_tensorSets.at(it->second).second;
+                bool overlap = false;
+                for (auto a : other)
+                {
+                    for (auto b : ele.second.second)
+                    {
+                        auto ra = live_ranges.find(a);
+                        auto rb = live_ranges.find(b);
+                        if (ra != live_ranges.end() && rb != live_ranges.end() &&
+                            ra->second.first <= rb->second.second &&
+                            rb->second.first <= ra->second.second)
+                        {
+                            overlap = true;
+                        }
+                    }
+                }
+                // Sets at the same offset with touching live ranges are in-place pairs;
+                // disjoint ones just reuse memory freed earlier
+                if (overlap)
+                {
+                    stats.in_place_bytes += largest;
+                }
+            }
+        }
+    }
+
+    for (auto& ele : live_ranges)
+    {
+        descriptor::Tensor* tensor = ele.first;
+        auto role = m_tensor_roles.find(tensor->get_name());
+        bool temporary =
+            role != m_tensor_roles.end() && role->second == CPUTensorRole::INTERMEDIATE;
+        stats.largest_tensors.push_back({tensor->get_name(),
+                                         tensor->size(),
+                                         temporary ? tensor->get_pool_offset() : 0,
+                                         temporary,
+                                         ele.second.first,
+                                         ele.second.second});
+    }
+    sort(stats.largest_tensors.begin(),
+         stats.largest_tensors.end(),
+         [](const TensorMemoryInfo& a, const TensorMemoryInfo& b) {
+             return a.size != b.size ? a.size > b.size : a.name < b.name;
+         });
+}
+
+void runtime::cpu::CPU_ExternalFunction::record_result_copies()
+{
+    m_result_copies.clear();
+    for (auto& result : m_function->get_results())
+    {
+        auto output_tensor = &result->get_output_tensor();
+        auto input_tensor = &result->get_inputs().at(0).get_tensor();
+        auto output_id = tensor_to_bufferID.find(output_tensor);
+        auto input_id = tensor_to_bufferID.find(input_tensor);
+        if (output_id == tensor_to_bufferID.end() || input_id == tensor_to_bufferID.end())
+        {
+            m_result_copies.push_back("no memory assignment");
+            continue;
+        }
+        if (output_id->second == input_id->second)
+        {
+            m_result_copies.push_back("");
+            continue;
+        }
+        switch (bufferID_to_tensorSets.at(input_id->second).first)
+        {
+        case CPUTensorRole::INPUT: m_result_copies.push_back("value of a parameter"); break;
+        case CPUTensorRole::CONSTANT: m_result_copies.push_back("value of a constant"); break;
+        case CPUTensorRole::OUTPUT:
+            m_result_copies.push_back("buffer already bound to another output");
+            break;
+        case CPUTensorRole::INTERMEDIATE:
+            // The only intermediates not merged into their result's buffer are in-place slices
+            m_result_copies.push_back("in-place slice of a larger buffer");
+            break;
+        }
+    }
+}
+
+runtime::MemoryStatistics
+    runtime::cpu::CPU_ExternalFunction::get_memory_statistics(size_t top_tensors) const
+{
+    MemoryStatistics stats = m_memory_statistics;
+    if (stats.largest_tensors.size() > top_tensors)
+    {
+        stats.largest_tensors.resize(top_tensors);
+    }
+    return stats;
+}
+
 const vector<runtime::PerformanceCounter>& runtime::cpu::CPU_ExternalFunction::get_perf_counters()
 {
 #if !defined(NGRAPH_DEX_ONLY)
@@ -1901,6 +2974,33 @@ const vector<runtime::PerformanceCounter>& runtime::cpu::CPU_ExternalFunction::g
     return m_perf_counters;
 }
 
+vector<runtime::cpu::LayoutConversion>
+    runtime::cpu::CPU_ExternalFunction::get_layout_conversions()
+{
+    vector<LayoutConversion> conversions = m_layout_conversions;
+    if (m_emit_timing)
+    {
+        unordered_map<string, const PerformanceCounter*> counters;
+        for (const PerformanceCounter& counter : get_perf_counters())
+        {
+            if (counter.get_node())
+            {
+                counters[counter.get_node()->get_name()] = &counter;
+            }
+        }
+        for (LayoutConversion& conversion : conversions)
+        {
+            auto it = counters.find(conversion.name);
+            if (it != counters.end())
+            {
+                conversion.call_count = it->second->call_count();
+                conversion.total_microseconds = it->second->total_microseconds();
+            }
+        }
+    }
+    return conversions;
+}
+
 void runtime::cpu::CPU_ExternalFunction::write_to_file(const std::string& code,
                                                        const std::string& directory,
                                                        const std::string& filename)
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <functional>
 #include <list>
 #include <map>
@@ -24,6 +25,7 @@
 #include <typeindex>
 #include <typeinfo>
 #include <unordered_map>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -41,12 +43,19 @@
 
 #include "ngraph/function.hpp"
 #include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_dex_scheduler.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_conversions.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
+#include "ngraph/runtime/cpu/cpu_constant_pool.hpp"
+#include "ngraph/runtime/cpu/cpu_workspace.hpp"
 #include "ngraph/runtime/cpu/mkldnn_emitter.hpp"
+#include "ngraph/runtime/memory_statistics.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/state/state.hpp"
 #include "ngraph/util.hpp"
@@ -104,11 +113,26 @@ namespace ngraph
 
                 const LayoutDescriptorPtrs& get_parameter_layout_descriptors();
                 const LayoutDescriptorPtrs& get_result_layout_descriptors();
+                // Shared pools the temporaries are borrowed from for each call, or null if the
+                // call frame allocates its own
+                const std::shared_ptr<CPU_Workspace>& get_workspace() const
+                {
+                    return m_workspace;
+                }
                 const std::vector<size_t>& get_memory_buffer_sizes() const
                 {
                     return m_memory_buffer_sizes;
                 }
                 const std::vector<OpAttributes>& get_op_attrs() const { return m_op_attrs; }
+                // id of the function's events in TimelineRecorder, when tracing
+                size_t get_trace_id() const { return m_trace_id; }
+                // names of the DEX ops, in execution order
+                const std::vector<std::string>& get_op_names() const { return op_names; }
+                // One DEX call in `period` records the latency of each op and of the whole call
+                // in its runtime context (CPURuntimeContext::latencies); 0 stops sampling.
+                // Defaults to NGRAPH_CPU_LATENCY_SAMPLE_PERIOD, or 0.
+                void set_latency_sample_period(size_t period) { m_latency_sample_period = period; }
+                size_t get_latency_sample_period() const { return m_latency_sample_period; }
                 const std::unique_ptr<MKLDNNEmitter>& get_mkldnn_emitter() const
                 {
                     return m_mkldnn_emitter;
@@ -149,9 +173,53 @@ namespace ngraph
                 static constexpr size_t s_memory_pool_alignment = 4096;
 
                 std::vector<CPUKernelFunctor>& get_functors() { return functors; }
+                // Creates the MKL-DNN primitives of one node in a context. Each builder fills only
+                // the primitive indices reserved for its node, so the DEX executor runs them all
+                // in parallel before the first iteration of a context.
+                void add_mkldnn_primitive_builder(
+                    const std::function<void(CPURuntimeContext*)>& builder)
+                {
+                    m_mkldnn_primitive_builders.push_back(builder);
+                }
                 // return an index into the cpu_runtime_context's buffer_data vector to get the tensor
                 size_t get_buffer_index(const std::string& name);
                 size_t get_buffer_size() const { return m_buffer_size; }
+                // number of per-context tensor staleness flags (CPURuntimeContext::t_en)
+                size_t get_tensor_stale_count() const { return tensor_stale_index.size(); }
+                // slot in CPURuntimeContext::distributed_requests of the non-blocking
+                // all-reduce or receive that writes the tensor, see AllReduceScheduling
+                size_t add_distributed_request(const std::string& name)
+                {
+                    return m_distributed_requests.emplace(name, m_distributed_requests.size())
+                        .first->second;
+                }
+                size_t get_distributed_request_count() const
+                {
+                    return m_distributed_requests.size();
+                }
+                // number of constants update_constants() can overwrite
+                // (CPURuntimeContext::c_versions)
+                size_t get_updatable_constant_count() const { return m_updatable_constants.size(); }
+                // Overwrites constants of a built DEX function. The next call on each runtime
+                // context reruns the cached ops downstream of them, such as weight layout
+                // conversions. Values the builders read at compile time, like quantization
+                // scales, are not updated.
+                void update_constants(
+                    const std::map<const ngraph::op::Constant*, const void*>& values);
+                // Builds the MKL-DNN primitives of a context, unless they were built already.
+                // The executor does it on the first call on the context.
+                void prepare_context(CPURuntimeContext* ctx);
+                // Runs the cached ops that only depend on constants, such as weight layout
+                // conversions, on `ctx` into buffers shared by all the contexts. From then on
+                // the calls read those buffers and skip these ops. Called again after the
+                // constants are updated. No call may be running.
+                void compute_shared_values(CPURuntimeContext* ctx);
+                bool has_shared_values() const { return m_shared_values_computed; }
+                // Frees the shared values, which every context then computes again in its own
+                // buffers. Their caches must have been invalidated and no call may be running.
+                // Returns the number of bytes freed.
+                size_t release_shared_values();
+                size_t get_shared_values_size() const;
                 std::function<void(CPURuntimeContext*, std::vector<void*>&, std::vector<void*>&)>&
                     get_executor()
                 {
@@ -163,11 +231,55 @@ namespace ngraph
                     return callees;
                 }
                 bool is_direct_execution() const { return m_direct_execution; }
+                // Largest batch of a function built with
+                // CPU_Executable::BATCH_POLYMORPHIC_ATTRIBUTE, or 0
+                size_t get_batch_size() const { return m_batch_size; }
+                bool is_batch_polymorphic() const { return m_batch_size != 0; }
+                // Whether the function was built with
+                // CPU_Executable::DETERMINISTIC_REDUCTIONS_ATTRIBUTE
+                bool has_deterministic_reductions() const { return m_deterministic_reductions; }
+                // Finds the nodes of a batch polymorphic function that depend on its batched
+                // parameters, and so have the batch as their leading dimension. `nodes` is in
+                // topological order.
+                void find_batched_nodes(const std::list<std::shared_ptr<Node>>& nodes);
+                bool is_batched(const Node* node) const { return m_batched_nodes.count(node) != 0; }
+                // Called by the builders whose kernels only run on the leading
+                // CPURuntimeContext::batch_size items of their batched inputs and output.
+                // Returns the batch the node was built for, or 0 if it is not batched.
+                size_t scale_with_batch(const Node* node);
+                // Batch of a call, the leading dimension shared by its batched inputs and
+                // outputs, which must otherwise have the shapes of their parameters and results
+                size_t get_call_batch_size(
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                    const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) const;
+                bool is_batched_input(size_t i) const
+                {
+                    return !m_batched_input_shapes.at(i).empty();
+                }
+                bool is_batched_output(size_t i) const
+                {
+                    return !m_batched_output_shapes.at(i).empty();
+                }
                 void write_to_file(const std::string& code,
                                    const std::string& directory,
                                    const std::string& filename);
 
                 const std::vector<PerformanceCounter>& get_perf_counters();
+                // Memory planned by CPUMemoryAssignment for the compiled function
+                MemoryStatistics get_memory_statistics(size_t top_tensors) const;
+                const std::shared_ptr<ngraph::pass::PassProfile>& get_compile_profile() const
+                {
+                    return m_compile_profile;
+                }
+                // For each result, why its value is copied into the output tensor, or an empty
+                // string if it is computed in place there
+                const std::vector<std::string>& get_result_copies() const
+                {
+                    return m_result_copies;
+                }
+                // Reorders inserted by CPULayout, with their run time when compiled with
+                // performance counters enabled
+                std::vector<LayoutConversion> get_layout_conversions();
 
 #if defined(NGRAPH_HALIDE)
                 std::unordered_map<std::string, Halide::Func>& get_halide_functions()
@@ -205,7 +317,10 @@ namespace ngraph
                                             ngraph::pass::PassConfig& pass_config);
 
                 bool computes_result(Node* node);
+                void build_dex_scheduler(ngraph::pass::PassConfig& pass_config);
                 void release_function() { m_function = nullptr; }
+                void record_memory_statistics();
+                void record_result_copies();
 #if !defined(NGRAPH_DEX_ONLY)
                 void emit_debug_function_entry(CodeWriter& writer,
                                                Node* node,
@@ -244,12 +359,34 @@ namespace ngraph
                 std::shared_ptr<ngraph::Function> m_function;
                 bool m_release_function;
                 bool m_emit_timing;
+                // Also read hardware counters around each op when timing (DEX only)
+                bool m_collect_hw_counters;
+                std::atomic<size_t> m_latency_sample_period;
+                size_t m_trace_id = 0;
+                // Set before compilation. Temporaries do not outlive a call when shared, so
+                // intermediates are not cached across calls.
+                std::shared_ptr<CPU_Workspace> m_workspace;
+                // Set before compilation to share constant data with the other executables
+                // compiled in one group
+                std::shared_ptr<CPU_ConstantPool> m_constant_pool;
 
                 bool m_use_tbb;
+                // Threads running independent ops of one DEX call; 1 runs ops in program order
+                int m_num_dex_workers = 1;
+                DEXScheduler m_dex_scheduler;
 #if !defined(NGRAPH_DEX_ONLY)
                 bool m_is_compiled;
 #endif
                 bool m_direct_execution;
+                size_t m_batch_size = 0;
+                bool m_deterministic_reductions = false;
+                // Batched nodes while the function is built, and those whose builders scaled
+                // their kernels with the batch
+                std::unordered_set<const Node*> m_batched_nodes;
+                std::unordered_set<const Node*> m_batch_scaled_nodes;
+                // Shapes of the batched parameters and results, and empty shapes for the others
+                std::vector<Shape> m_batched_input_shapes;
+                std::vector<Shape> m_batched_output_shapes;
 
                 /// Function that initializes the context used in codegen mode.
                 InitContextFuncCG m_compiled_init_ctx_func;
@@ -276,7 +413,22 @@ namespace ngraph
                 std::string m_function_name;
 
                 std::vector<CPUKernelFunctor> functors;
+                std::vector<std::function<void(CPURuntimeContext*)>> m_mkldnn_primitive_builders;
                 std::vector<std::string> op_names;
+                // for each functor, whether its op is small enough to run without the pool
+                std::vector<bool> m_serial_ops;
+                // for each functor, whether its op is computed by compute_shared_values
+                std::vector<bool> m_shared_ops;
+                struct SharedTensor
+                {
+                    // index into the cpu_runtime_context's buffer_data vector
+                    size_t buffer_index;
+                    size_t size;
+                    std::unique_ptr<AlignedBuffer> buffer;
+                };
+                // outputs of the shared ops, in buffers allocated by compute_shared_values
+                std::vector<SharedTensor> m_shared_tensors;
+                std::atomic<bool> m_shared_values_computed{false};
                 std::vector<std::function<bool(CPURuntimeContext*)>> enables;
                 std::list<std::pair<std::function<bool(CPURuntimeContext*)>, std::string>>
                     enable_nodename_list;
@@ -284,7 +436,11 @@ namespace ngraph
                     executor;
                 // name of a tensor and index into the cpu_runtime_context's buffer_data vector to get the tensor
                 std::unordered_map<std::string, size_t> m_buffer_indices;
-                std::unordered_map<std::string, bool> tensor_stale;
+                // name of a tensor and index into the cpu_runtime_context's t_en array holding
+                // the tensor's staleness as seen by that context
+                std::unordered_map<std::string, size_t> tensor_stale_index;
+                // tensor written by a non-blocking all-reduce to its request slot
+                std::unordered_map<std::string, size_t> m_distributed_requests;
                 // Each tensor is put into one buffer set.
                 // All the tensors in the same buffer set share the same memory buffer.
                 // bufferID_to_tensorSets maps bufferID to the pair of CPUTensorRole and buffer set.
@@ -306,11 +462,25 @@ namespace ngraph
                 // and the tensor pointer.
                 // used to get the address at runtime
                 std::list<std::pair<size_t, void*>> constant_tensor_data;
+                struct UpdatableConstant
+                {
+                    std::shared_ptr<ngraph::op::Constant> node;
+                    // index of the constant's staleness flag in CPURuntimeContext::t_en
+                    size_t stale_index;
+                    // the constant's entry in constant_tensor_data
+                    std::list<std::pair<size_t, void*>>::iterator tensor_data;
+                    // bumped by each update, compared against CPURuntimeContext::c_versions
+                    size_t version;
+                };
+                std::vector<UpdatableConstant> m_updatable_constants;
+                std::unordered_map<const ngraph::op::Constant*, size_t> m_updatable_constant_index;
+                // Constants CSE merged other constants into during compilation; updating one
+                // would also change the values of the constants it stands for
+                std::unordered_set<std::shared_ptr<Node>> m_merged_constants;
                 // index into the cpu_runtime_context's buffer_data vector to get a tensor,
-                // input index, offset into the input, and if the input is stale
+                // input index, offset into the input, and index of the input's staleness flag
                 // used to calculate the correct address at runtime
-                std::list<std::tuple<size_t, size_t, size_t, std::reference_wrapper<bool>>>
-                    function_input_index_offset;
+                std::list<std::tuple<size_t, size_t, size_t, size_t>> function_input_index_offset;
                 // index to the cpu_runtime_context's buffer_data vector to get a tensor,
                 // output index, and offset into the output.
                 // used to calculate the correct address at runtime
@@ -319,6 +489,12 @@ namespace ngraph
                 size_t m_buffer_size = 0;
                 std::unordered_map<std::string, std::shared_ptr<CPU_ExternalFunction>> callees;
                 bool m_is_built;
+                MemoryStatistics m_memory_statistics;
+                // Set by the ConstantDeduplication pass
+                size_t m_deduplicated_constant_bytes = 0;
+                std::shared_ptr<ngraph::pass::PassProfile> m_compile_profile;
+                std::vector<std::string> m_result_copies;
+                std::vector<LayoutConversion> m_layout_conversions;
                 std::vector<runtime::PerformanceCounter> m_perf_counters;
 
 #if defined(NGRAPH_HALIDE)
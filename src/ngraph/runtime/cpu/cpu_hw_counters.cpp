@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cstring>
+#include <memory>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include "ngraph/runtime/cpu/cpu_hw_counters.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t runtime::cpu::HardwareCounters::counter_count;
+
+#ifdef __linux__
+static int open_counter(uint64_t config, int group_fd)
+{
+    perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.size = sizeof(attr);
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.config = config;
+    // The leader starts disabled and enables the whole group at once
+    attr.disabled = group_fd == -1 ? 1 : 0;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_GROUP;
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, group_fd, 0));
+}
+#endif
+
+runtime::cpu::HardwareCounters::HardwareCounters()
+    : m_open(false)
+{
+    for (size_t i = 0; i < counter_count; i++)
+    {
+        m_fds[i] = -1;
+    }
+#ifdef __linux__
+    const uint64_t configs[counter_count] = {
+        PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS, PERF_COUNT_HW_CACHE_MISSES};
+    for (size_t i = 0; i < counter_count; i++)
+    {
+        m_fds[i] = open_counter(configs[i], m_fds[0]);
+        if (m_fds[i] == -1)
+        {
+            return;
+        }
+    }
+    ioctl(m_fds[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+    m_open = ioctl(m_fds[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) == 0;
+#endif
+}
+
+runtime::cpu::HardwareCounters::~HardwareCounters()
+{
+#ifdef __linux__
+    for (size_t i = 0; i < counter_count; i++)
+    {
+        if (m_fds[i] != -1)
+        {
+            close(m_fds[i]);
+        }
+    }
+#endif
+}
+
+runtime::cpu::HardwareCounters* runtime::cpu::HardwareCounters::get_thread_counters()
+{
+    static thread_local unique_ptr<HardwareCounters> counters;
+    static thread_local bool opened = false;
+    if (!opened)
+    {
+        opened = true;
+        counters.reset(new HardwareCounters());
+        if (!counters->m_open)
+        {
+            counters.reset();
+        }
+    }
+    return counters.get();
+}
+
+bool runtime::cpu::HardwareCounters::read(HardwareCounterValues& values) const
+{
+#ifdef __linux__
+    // PERF_FORMAT_GROUP layout: the number of counters followed by their values
+    uint64_t buffer[counter_count + 1];
+    if (::read(m_fds[0], buffer, sizeof(buffer)) != static_cast<ssize_t>(sizeof(buffer)) ||
+        buffer[0] != counter_count)
+    {
+        return false;
+    }
+    values.cycles = buffer[1];
+    values.instructions = buffer[2];
+    values.llc_misses = buffer[3];
+    return true;
+#else
+    return false;
+#endif
+}
+
+void runtime::cpu::accumulate_hardware_counters(PerformanceCounter& counter,
+                                                const HardwareCounterValues& start,
+                                                const HardwareCounterValues& end)
+{
+    counter.m_has_hardware_counters = true;
+    counter.m_cycles += end.cycles - start.cycles;
+    counter.m_instructions += end.instructions - start.instructions;
+    counter.m_llc_misses += end.llc_misses - start.llc_misses;
+}
@@ -0,0 +1,68 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstdint>
+
+#include "ngraph/runtime/performance_counter.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            struct HardwareCounterValues
+            {
+                uint64_t cycles = 0;
+                uint64_t instructions = 0;
+                uint64_t llc_misses = 0;
+            };
+
+            // User space cycles, instructions and last level cache misses of the calling
+            // thread, read through a Linux perf_event counter group. Work a kernel hands to
+            // threads it did not create itself (OpenMP or MKL-DNN pools) is not counted.
+            class HardwareCounters
+            {
+            public:
+                // Counters of the calling thread, opened on first use; nullptr when
+                // perf_event is unavailable, e.g. not on Linux or with a restrictive
+                // perf_event_paranoid setting
+                static HardwareCounters* get_thread_counters();
+
+                ~HardwareCounters();
+                bool read(HardwareCounterValues& values) const;
+
+                HardwareCounters(const HardwareCounters&) = delete;
+                HardwareCounters& operator=(const HardwareCounters&) = delete;
+
+            private:
+                HardwareCounters();
+
+                static constexpr size_t counter_count = 3;
+                int m_fds[counter_count];
+                bool m_open;
+            };
+
+            // Add the counts between two readings to `counter`
+            void accumulate_hardware_counters(PerformanceCounter& counter,
+                                              const HardwareCounterValues& start,
+                                              const HardwareCounterValues& end);
+        }
+    }
+}
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+
+#include "ngraph/runtime/cpu/cpu_call_frame.hpp"
+#include "ngraph/runtime/cpu/cpu_idle_reclaimer.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::IdleReclaimer& runtime::cpu::IdleReclaimer::get()
+{
+    static IdleReclaimer reclaimer;
+    return reclaimer;
+}
+
+runtime::cpu::IdleReclaimer::IdleReclaimer()
+{
+    m_thread = thread(&IdleReclaimer::run, this);
+}
+
+runtime::cpu::IdleReclaimer::~IdleReclaimer()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+}
+
+void runtime::cpu::IdleReclaimer::add(CPU_CallFrame* call_frame)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_call_frames.insert(call_frame);
+    }
+    m_wake.notify_one();
+}
+
+void runtime::cpu::IdleReclaimer::remove(CPU_CallFrame* call_frame)
+{
+    // The thread reclaims while holding the lock
+    lock_guard<mutex> lock(m_mutex);
+    m_call_frames.erase(call_frame);
+}
+
+void runtime::cpu::IdleReclaimer::run()
+{
+    unique_lock<mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+        if (m_call_frames.empty())
+        {
+            m_wake.wait(lock);
+            continue;
+        }
+        auto now = chrono::steady_clock::now();
+        // A wait_for with a huge duration may overflow the clock
+        chrono::milliseconds wait = chrono::hours(1);
+        for (auto call_frame : m_call_frames)
+        {
+            wait = min(wait, call_frame->reclaim_if_idle(now));
+        }
+        m_wake.wait_for(lock, wait);
+    }
+}
@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            class CPU_CallFrame;
+
+            // Reclaims the temporary memory of the call frames given an idle timeout (see
+            // CPU_CallFrame::set_idle_timeout) from a single background thread, which sleeps
+            // until the earliest of their timeouts may have expired.
+            class IdleReclaimer
+            {
+            public:
+                static IdleReclaimer& get();
+                ~IdleReclaimer();
+
+                // Starts checking `call_frame`, or checks it again after its timeout changed
+                void add(CPU_CallFrame* call_frame);
+                // Returns once the background thread no longer uses `call_frame`
+                void remove(CPU_CallFrame* call_frame);
+
+            private:
+                IdleReclaimer();
+                IdleReclaimer(const IdleReclaimer&) = delete;
+                IdleReclaimer& operator=(const IdleReclaimer&) = delete;
+
+                void run();
+
+                std::mutex m_mutex;
+                std::condition_variable m_wake;
+                std::unordered_set<CPU_CallFrame*> m_call_frames;
+                bool m_stop = false;
+                std::thread m_thread;
+            };
+        }
+    }
+}
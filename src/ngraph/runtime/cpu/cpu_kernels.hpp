@@ -104,6 +104,40 @@ namespace cblas
                            const int64_t* ldc_array,
                            const int64_t group_count,
                            const int64_t* group_size);
+
+    // Packed GEMM. cblas_sgemm_compute takes Transpose or Storage::Packed values for the
+    // operands, as int64_t.
+    float* cblas_sgemm_alloc(const Ident identifier,
+                             const int64_t M,
+                             const int64_t N,
+                             const int64_t K);
+
+    void cblas_sgemm_pack(const Layout layout,
+                          const Ident identifier,
+                          const Transpose trans,
+                          const int64_t M,
+                          const int64_t N,
+                          const int64_t K,
+                          const float alpha,
+                          const float* src,
+                          const int64_t ld,
+                          float* dest);
+
+    void cblas_sgemm_compute(const Layout layout,
+                             const int64_t transa,
+                             const int64_t transb,
+                             const int64_t M,
+                             const int64_t N,
+                             const int64_t K,
+                             const float* A,
+                             const int64_t lda,
+                             const float* B,
+                             const int64_t ldb,
+                             const float beta,
+                             float* C,
+                             const int64_t ldc);
+
+    void cblas_sgemm_free(float* dest);
     }
 }
 
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <cmath>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/cpu/cpu_latency_histogram.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+constexpr size_t runtime::cpu::LatencyHistogram::bucket_count;
+
+size_t runtime::cpu::LatencyHistogram::get_bucket(uint64_t ns)
+{
+    if (ns < sub_bucket_count)
+    {
+        return static_cast<size_t>(ns);
+    }
+    if (ns >> max_value_bits)
+    {
+        return bucket_count - 1;
+    }
+    size_t msb = 63 - static_cast<size_t>(__builtin_clzll(ns));
+    size_t sub_bucket = static_cast<size_t>(ns >> (msb - sub_bucket_bits)) & (sub_bucket_count - 1);
+    return (msb - sub_bucket_bits + 1) * sub_bucket_count + sub_bucket;
+}
+
+uint64_t runtime::cpu::LatencyHistogram::get_bucket_lower_bound(size_t bucket)
+{
+    if (bucket < sub_bucket_count)
+    {
+        return bucket;
+    }
+    size_t msb = bucket / sub_bucket_count + sub_bucket_bits - 1;
+    uint64_t mantissa = sub_bucket_count + bucket % sub_bucket_count;
+    return mantissa << (msb - sub_bucket_bits);
+}
+
+void runtime::cpu::LatencyHistogram::add(size_t bucket, uint64_t count, uint64_t max_ns)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    m_counts.at(bucket) += count;
+    m_count += count;
+    m_max = std::max(m_max, max_ns);
+}
+
+void runtime::cpu::LatencyHistogram::merge(const LatencyHistogram& other)
+{
+    for (size_t i = 0; i < bucket_count; i++)
+    {
+        m_counts[i] += other.m_counts[i];
+    }
+    m_count += other.m_count;
+    m_max = std::max(m_max, other.m_max);
+}
+
+void runtime::cpu::LatencyHistogram::reset()
+{
+    m_counts.fill(0);
+    m_count = 0;
+    m_max = 0;
+}
+
+uint64_t runtime::cpu::LatencyHistogram::get_percentile(double q) const
+{
+    NGRAPH_CHECK(q >= 0 && q <= 1, "Quantile ", q, " is not in [0, 1]");
+    if (m_count == 0)
+    {
+        return 0;
+    }
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(q * m_count)));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < bucket_count; i++)
+    {
+        seen += m_counts[i];
+        if (seen >= rank)
+        {
+            if (i + 1 == bucket_count)
+            {
+                return m_max;
+            }
+            return std::min(m_max, get_bucket_lower_bound(i + 1) - 1);
+        }
+    }
+    return m_max;
+}
+
+runtime::cpu::AtomicLatencyHistogram::AtomicLatencyHistogram()
+    : m_max(0)
+{
+    for (auto& count : m_counts)
+    {
+        count.store(0, memory_order_relaxed);
+    }
+}
+
+void runtime::cpu::AtomicLatencyHistogram::record(uint64_t ns)
+{
+    m_counts[LatencyHistogram::get_bucket(ns)].fetch_add(1, memory_order_relaxed);
+    // Single writer, so a plain compare is enough
+    if (ns > m_max.load(memory_order_relaxed))
+    {
+        m_max.store(ns, memory_order_relaxed);
+    }
+}
+
+void runtime::cpu::AtomicLatencyHistogram::collect(LatencyHistogram& histogram, bool reset)
+{
+    uint64_t max_ns = reset ? m_max.exchange(0, memory_order_relaxed)
+                            : m_max.load(memory_order_relaxed);
+    for (size_t i = 0; i < LatencyHistogram::bucket_count; i++)
+    {
+        uint64_t count = reset ? m_counts[i].exchange(0, memory_order_relaxed)
+                               : m_counts[i].load(memory_order_relaxed);
+        histogram.add(i, count, max_ns);
+    }
+}
@@ -0,0 +1,112 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // HDR-style histogram of latencies in nanoseconds. Values below 8 have a bucket
+            // each and every larger power of two is split into 8 linear buckets, so a bucket
+            // is at most 12.5% wider than its lower bound. Values of 2^40ns (about 18 minutes)
+            // or more share the last bucket.
+            class LatencyHistogram
+            {
+            public:
+                static constexpr size_t sub_bucket_bits = 3;
+                static constexpr size_t sub_bucket_count = 1 << sub_bucket_bits;
+                static constexpr size_t max_value_bits = 40;
+                static constexpr size_t bucket_count =
+                    (max_value_bits - sub_bucket_bits + 1) * sub_bucket_count;
+
+                static size_t get_bucket(uint64_t ns);
+                static uint64_t get_bucket_lower_bound(size_t bucket);
+
+                void record(uint64_t ns) { add(get_bucket(ns), 1, ns); }
+                void add(size_t bucket, uint64_t count, uint64_t max_ns);
+                void merge(const LatencyHistogram& other);
+                void reset();
+
+                uint64_t get_count() const { return m_count; }
+                uint64_t get_max() const { return m_max; }
+                uint64_t get_bucket_count(size_t bucket) const { return m_counts.at(bucket); }
+                // Highest latency of the bucket holding quantile q (in [0, 1]), capped at the
+                // largest latency recorded; 0 if nothing was recorded
+                uint64_t get_percentile(double q) const;
+
+            private:
+                std::array<uint64_t, bucket_count> m_counts{};
+                uint64_t m_count = 0;
+                uint64_t m_max = 0;
+            };
+
+            // Lock-free recorder behind a LatencyHistogram. Each histogram has a single writer
+            // at a time, the call holding its runtime context, while snapshots may be taken
+            // concurrently from any thread.
+            class AtomicLatencyHistogram
+            {
+            public:
+                AtomicLatencyHistogram();
+
+                void record(uint64_t ns);
+                // Add the counts to `histogram`, and zero them if `reset` is set
+                void collect(LatencyHistogram& histogram, bool reset);
+
+            private:
+                AtomicLatencyHistogram(const AtomicLatencyHistogram&) = delete;
+                AtomicLatencyHistogram& operator=(const AtomicLatencyHistogram&) = delete;
+
+                std::array<std::atomic<uint32_t>, LatencyHistogram::bucket_count> m_counts;
+                std::atomic<uint64_t> m_max;
+            };
+
+            // The histograms of one runtime context: one for each op, in execution order, and
+            // one for the calls as a whole
+            struct LatencyRecorder
+            {
+                LatencyRecorder(size_t num_ops)
+                    : ops(new AtomicLatencyHistogram[num_ops])
+                    , num_ops(num_ops)
+                {
+                }
+
+                AtomicLatencyHistogram call;
+                std::unique_ptr<AtomicLatencyHistogram[]> ops;
+                const size_t num_ops;
+            };
+
+            // Sampled latencies of an executable, merged over its runtime contexts
+            struct LatencyReport
+            {
+                LatencyHistogram call;
+                // Op names with their histograms, in execution order
+                std::vector<std::pair<std::string, LatencyHistogram>> ops;
+            };
+        }
+    }
+}
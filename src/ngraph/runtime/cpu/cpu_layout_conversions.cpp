@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <iomanip>
+
+#include "ngraph/runtime/cpu/cpu_layout_conversions.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/mkldnn_utils.hpp"
+#include "ngraph/runtime/cpu/op/convert_layout.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static string layout_format(const descriptor::Tensor& tensor)
+{
+    auto layout =
+        dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(tensor.get_tensor_layout());
+    if (layout && layout->is_mkldnn_layout())
+    {
+        return runtime::cpu::mkldnn_utils::get_mkldnn_format_string(
+            static_cast<mkldnn::memory::format>(layout->get_mkldnn_md().data.format));
+    }
+    return "native";
+}
+
+static size_t tensor_bytes(const descriptor::Tensor& tensor)
+{
+    auto layout = tensor.get_tensor_layout();
+    return layout ? layout->get_allocated_size() : tensor.size();
+}
+
+vector<runtime::cpu::LayoutConversion>
+    runtime::cpu::find_layout_conversions(const Function& function)
+{
+    vector<LayoutConversion> conversions;
+    for (const auto& node : function.get_ordered_ops())
+    {
+        if (!dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node))
+        {
+            continue;
+        }
+        const auto& input = node->get_inputs().at(0);
+        const auto& output = input.get_output();
+        const auto& input_tensor = input.get_tensor();
+        const auto& output_tensor = node->get_output_tensor(0);
+
+        LayoutConversion conversion;
+        conversion.name = node->get_name();
+        conversion.source = output.get_node()->get_name() + ":" + to_string(output.get_index());
+        conversion.source_format = layout_format(input_tensor);
+        conversion.destination_format = layout_format(output_tensor);
+        conversion.bytes = tensor_bytes(input_tensor) + tensor_bytes(output_tensor);
+        conversions.push_back(conversion);
+    }
+    return conversions;
+}
+
+void runtime::cpu::print_layout_conversions(ostream& out,
+                                            const vector<LayoutConversion>& conversions)
+{
+    size_t total_bytes = 0;
+    size_t total_microseconds = 0;
+    out << "---- Layout conversions ----\n";
+    for (const LayoutConversion& conversion : conversions)
+    {
+        out << setw(24) << left << conversion.name << " " << conversion.source << " "
+            << conversion.source_format << " -> " << conversion.destination_format << ", "
+            << conversion.bytes << " bytes";
+        if (conversion.call_count > 0)
+        {
+            out << ", " << conversion.total_microseconds << "us over " << conversion.call_count
+                << " calls";
+        }
+        out << "\n";
+        total_bytes += conversion.bytes;
+        total_microseconds += conversion.total_microseconds;
+    }
+    out << conversions.size() << " conversions, " << total_bytes << " bytes per call";
+    if (total_microseconds > 0)
+    {
+        out << ", " << total_microseconds << "us total";
+    }
+    out << "\n";
+}
@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // A ConvertLayout inserted by CPULayout to reorder a tensor between MKL-DNN and
+            // native kernels
+            struct LayoutConversion
+            {
+                // Name of the ConvertLayout node
+                std::string name;
+                // Producer of the reordered tensor, as "<node>:<output index>"
+                std::string source;
+                // Layout formats, "native" for non MKL-DNN layouts
+                std::string source_format;
+                std::string destination_format;
+                // Bytes read plus bytes written by one reorder
+                size_t bytes = 0;
+                // Filled from the performance counters when the function is compiled with
+                // performance counters enabled
+                size_t call_count = 0;
+                size_t total_microseconds = 0;
+            };
+
+            // The layout conversions of a function, in execution order
+            std::vector<LayoutConversion> find_layout_conversions(const Function& function);
+
+            void print_layout_conversions(std::ostream& out,
+                                          const std::vector<LayoutConversion>& conversions);
+        }
+    }
+}
@@ -0,0 +1,100 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/cpu/cpu_kernels.hpp"
+#include "ngraph/runtime/cpu/cpu_packed_gemm.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPU_PackedGemmOperand::CPU_PackedGemmOperand(bool is_a,
+                                                           const float* data,
+                                                           bool transpose,
+                                                           size_t m,
+                                                           size_t n,
+                                                           size_t k,
+                                                           size_t ld)
+    : m_is_a(is_a)
+    , m_m(m)
+    , m_n(n)
+    , m_k(k)
+{
+    auto identifier = m_is_a ? cblas::Ident::AMatrix : cblas::Ident::BMatrix;
+    m_packed = cblas::cblas_sgemm_alloc(identifier, m_m, m_n, m_k);
+    if (m_packed == nullptr)
+    {
+        throw ngraph_error("Failed to allocate a packed GEMM operand");
+    }
+    cblas::cblas_sgemm_pack(cblas::Layout::RowMajor,
+                            identifier,
+                            transpose ? cblas::Transpose::Transpose : cblas::Transpose::None,
+                            m_m,
+                            m_n,
+                            m_k,
+                            1.0f,
+                            data,
+                            max<size_t>(1, ld),
+                            m_packed);
+}
+
+runtime::cpu::CPU_PackedGemmOperand::~CPU_PackedGemmOperand()
+{
+    cblas::cblas_sgemm_free(m_packed);
+}
+
+void runtime::cpu::CPU_PackedGemmOperand::multiply(const float* other,
+                                                   bool transpose_other,
+                                                   size_t ld_other,
+                                                   float beta,
+                                                   float* c,
+                                                   size_t ldc) const
+{
+    auto packed = static_cast<int64_t>(cblas::Storage::Packed);
+    auto other_trans = static_cast<int64_t>(transpose_other ? cblas::Transpose::Transpose
+                                                            : cblas::Transpose::None);
+    // The leading dimension of the packed operand is ignored
+    cblas::cblas_sgemm_compute(cblas::Layout::RowMajor,
+                               m_is_a ? packed : other_trans,
+                               m_is_a ? other_trans : packed,
+                               m_m,
+                               m_n,
+                               m_k,
+                               m_is_a ? m_packed : other,
+                               m_is_a ? 1 : max<size_t>(1, ld_other),
+                               m_is_a ? other : m_packed,
+                               m_is_a ? max<size_t>(1, ld_other) : 1,
+                               beta,
+                               c,
+                               max<size_t>(1, ldc));
+}
+
+shared_ptr<runtime::cpu::CPU_PackedGemmOperand>
+    runtime::cpu::CPU_PackedGemmOperand::pack_constant(
+        const Node* node, size_t arg, bool transpose, size_t m, size_t n, size_t k, size_t ld)
+{
+    auto constant = dynamic_pointer_cast<op::Constant>(node->get_argument(arg));
+    if (!constant || constant->get_element_type() != element::f32)
+    {
+        return nullptr;
+    }
+    return make_shared<CPU_PackedGemmOperand>(
+        arg == 0, constant->get_data_ptr<float>(), transpose, m, n, k, ld);
+}
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // One operand of a row-major f32 GEMM, C = A * B + beta * C, packed by MKL into
+            // its internal blocked format.
+            //
+            // cblas_sgemm repacks both operands on every call. When one of them is a constant,
+            // such as the weights of a fully connected layer, the builder packs it once at
+            // compile time and the kernel multiplies with cblas_sgemm_compute, which only
+            // packs the other operand. The packed copy lives as long as the kernel functors
+            // that hold it, so as long as the executable.
+            class CPU_PackedGemmOperand
+            {
+            public:
+                // Packs `data`, the A operand (M x K, or K x M if `transpose`) when
+                // `is_a` and the B operand (K x N, or N x K if `transpose`) otherwise
+                CPU_PackedGemmOperand(bool is_a,
+                                      const float* data,
+                                      bool transpose,
+                                      size_t m,
+                                      size_t n,
+                                      size_t k,
+                                      size_t ld);
+                ~CPU_PackedGemmOperand();
+                CPU_PackedGemmOperand(const CPU_PackedGemmOperand&) = delete;
+                CPU_PackedGemmOperand& operator=(const CPU_PackedGemmOperand&) = delete;
+
+                // C = A * B + beta * C, where `other` is the operand that is not packed
+                void multiply(const float* other,
+                              bool transpose_other,
+                              size_t ld_other,
+                              float beta,
+                              float* c,
+                              size_t ldc) const;
+
+                // Packs argument `arg` (0 for A, 1 for B) of `node` if it is a f32 constant,
+                // returns nullptr otherwise
+                static std::shared_ptr<CPU_PackedGemmOperand> pack_constant(const Node* node,
+                                                                            size_t arg,
+                                                                            bool transpose,
+                                                                            size_t m,
+                                                                            size_t n,
+                                                                            size_t k,
+                                                                            size_t ld);
+
+            private:
+                bool m_is_a;
+                size_t m_m;
+                size_t m_n;
+                size_t m_k;
+                float* m_packed;
+            };
+        }
+    }
+}
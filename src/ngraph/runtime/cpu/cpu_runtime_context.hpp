@@ -16,8 +16,10 @@
 
 #pragma once
 
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <memory>
 #include <set>
 
 #define TBB_PREVIEW_GLOBAL_CONTROL 1
@@ -26,6 +28,8 @@
 #include <tbb/global_control.h>
 #include <tbb/task_scheduler_init.h>
 
+#include "ngraph/runtime/cpu/cpu_call_priority.hpp"
+
 namespace mkldnn
 {
     class primitive;
@@ -38,9 +42,21 @@ namespace ngraph
         class AlignedBuffer;
     }
 
+    class DistributedRequest;
     class State;
 }
 
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            struct LatencyRecorder;
+        }
+    }
+}
+
 namespace ngraph
 {
     namespace runtime
@@ -56,7 +72,16 @@ namespace ngraph
             {
                 int64_t* op_durations;
                 bool* p_en;
+                // version of each input tensor seen by the last call on this context
+                size_t* p_versions;
+                // version of each updatable constant seen by the last call on this context
+                size_t* c_versions;
+                // staleness of the tensors tracked by the DEX executor, for this context
+                bool* t_en;
                 bool first_iteration;
+                // the MKL-DNN primitives of the DEX function were built for this context, see
+                // CPU_ExternalFunction::prepare_context
+                bool prepared;
                 // stores tensor pointers
                 std::vector<void*> buffer_data;
                 std::vector<mkldnn::primitive*> mkldnn_primitives;
@@ -67,12 +92,32 @@ namespace ngraph
                 State* const* states;
                 std::set<size_t> breakpoints;
                 size_t pc;
+                // thread pool and TBB arena (CPUExecutionContext::arena) that this context's
+                // kernels run on
+                int arena;
+                // sampled op and call latencies, created by the first sampled call
+                std::atomic<LatencyRecorder*> latencies;
+                // calls made on this context, to pick the sampled ones
+                size_t latency_calls;
+                // latencies of the running call are recorded here, unless it is null
+                LatencyRecorder* sampled_latencies;
+                // all-reduces and receives started by this context and not yet waited on,
+                // indexed by CPU_ExternalFunction::get_distributed_request_index
+                std::vector<std::shared_ptr<DistributedRequest>> distributed_requests;
+                // leading dimension of the batched tensors of the running call, for functions
+                // compiled with CPU_Executable::BATCH_POLYMORPHIC_ATTRIBUTE, and 0 otherwise
+                size_t batch_size;
+                // priority of the running call
+                CallPriority priority;
             };
             }
 
             struct CPUExecutionContext
             {
                 int arena;
+                // the kernel is too small to gain from the thread pool, so its Eigen
+                // expressions run on the calling thread
+                bool serial;
             };
 
             typedef std::function<void(CPURuntimeContext*, CPUExecutionContext*)> CPUKernelFunctor;
@@ -0,0 +1,167 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <limits>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/constant.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_sparse_gemm.hpp"
+#include "ngraph/util.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// The fraction of zeros from which a constant operand is stored sparse, over 1 to never do so
+static double get_sparsity_threshold()
+{
+    static const double threshold = [] {
+        const char* env = getenv("NGRAPH_CPU_SPARSE_GEMM_THRESHOLD");
+        return env == nullptr ? 0.8 : atof(env);
+    }();
+    return threshold;
+}
+
+runtime::cpu::CPU_SparseGemmOperand::CPU_SparseGemmOperand(bool is_a,
+                                                           const float* data,
+                                                           bool transpose,
+                                                           size_t m,
+                                                           size_t n,
+                                                           size_t k,
+                                                           size_t ld)
+    : m_is_a(is_a)
+    , m_m(m)
+    , m_n(n)
+    , m_k(k)
+{
+    if (m_k > numeric_limits<uint32_t>::max())
+    {
+        throw ngraph_error("Sparse GEMM operands must have fewer than 2^32 columns");
+    }
+    // Element (row, column) of A, or of B transposed, where columns run along K
+    size_t rows = m_is_a ? m_m : m_n;
+    size_t row_stride = transpose == m_is_a ? 1 : ld;
+    size_t column_stride = transpose == m_is_a ? ld : 1;
+    m_row_offsets.reserve(rows + 1);
+    m_row_offsets.push_back(0);
+    for (size_t row = 0; row < rows; row++)
+    {
+        for (size_t column = 0; column < m_k; column++)
+        {
+            float value = data[row * row_stride + column * column_stride];
+            if (value != 0.0f)
+            {
+                m_columns.push_back(static_cast<uint32_t>(column));
+                m_values.push_back(value);
+            }
+        }
+        m_row_offsets.push_back(m_values.size());
+    }
+}
+
+void runtime::cpu::CPU_SparseGemmOperand::multiply(const float* other,
+                                                   bool transpose_other,
+                                                   size_t ld_other,
+                                                   float beta,
+                                                   float* c,
+                                                   size_t ldc,
+                                                   int arena) const
+{
+    using Row = Eigen::Map<Eigen::ArrayXf>;
+    using StridedRow = Eigen::Map<const Eigen::ArrayXf, 0, Eigen::InnerStride<>>;
+    auto& device = runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+    double nonzeros_per_row = static_cast<double>(m_values.size()) / max<size_t>(1, m_m);
+    if (m_is_a)
+    {
+        // Row i of C is the sum of the rows of B picked by the nonzeros of row i of A
+        size_t row_stride = transpose_other ? 1 : ld_other;
+        size_t column_stride = transpose_other ? ld_other : 1;
+        Eigen::TensorOpCost cost(nonzeros_per_row * (m_n + 2) * sizeof(float),
+                                 m_n * sizeof(float),
+                                 2 * nonzeros_per_row * m_n);
+        device.parallelFor(m_m, cost, [&](Eigen::Index first, Eigen::Index last) {
+            for (Eigen::Index i = first; i < last; i++)
+            {
+                Row c_row(c + i * ldc, m_n);
+                if (beta == 0.0f)
+                {
+                    c_row.setZero();
+                }
+                else
+                {
+                    c_row *= beta;
+                }
+                for (size_t p = m_row_offsets[i]; p < m_row_offsets[i + 1]; p++)
+                {
+                    StridedRow b_row(other + m_columns[p] * row_stride,
+                                     m_n,
+                                     Eigen::InnerStride<>(column_stride));
+                    c_row += m_values[p] * b_row;
+                }
+            }
+        });
+    }
+    else
+    {
+        // Element (i, j) of C is row i of A dotted with the nonzeros of column j of B
+        size_t row_stride = transpose_other ? 1 : ld_other;
+        size_t column_stride = transpose_other ? ld_other : 1;
+        nonzeros_per_row = static_cast<double>(m_values.size()) / max<size_t>(1, m_n);
+        Eigen::TensorOpCost cost(m_n * nonzeros_per_row * 2 * sizeof(float),
+                                 m_n * sizeof(float),
+                                 2 * m_n * nonzeros_per_row);
+        device.parallelFor(m_m, cost, [&](Eigen::Index first, Eigen::Index last) {
+            for (Eigen::Index i = first; i < last; i++)
+            {
+                const float* a_row = other + i * row_stride;
+                float* c_row = c + i * ldc;
+                for (size_t j = 0; j < m_n; j++)
+                {
+                    float sum = 0.0f;
+                    for (size_t p = m_row_offsets[j]; p < m_row_offsets[j + 1]; p++)
+                    {
+                        sum += m_values[p] * a_row[m_columns[p] * column_stride];
+                    }
+                    c_row[j] = beta == 0.0f ? sum : sum + beta * c_row[j];
+                }
+            }
+        });
+    }
+}
+
+shared_ptr<runtime::cpu::CPU_SparseGemmOperand>
+    runtime::cpu::CPU_SparseGemmOperand::sparse_constant(
+        const Node* node, size_t arg, bool transpose, size_t m, size_t n, size_t k, size_t ld)
+{
+    auto constant = dynamic_pointer_cast<op::Constant>(node->get_argument(arg));
+    if (!constant || constant->get_element_type() != element::f32)
+    {
+        return nullptr;
+    }
+    const float* data = constant->get_data_ptr<float>();
+    size_t size = shape_size(constant->get_shape());
+    size_t zeros = count(data, data + size, 0.0f);
+    if (size == 0 || zeros < get_sparsity_threshold() * size)
+    {
+        return nullptr;
+    }
+    return make_shared<CPU_SparseGemmOperand>(arg == 0, data, transpose, m, n, k, ld);
+}
@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // A constant operand of a row-major f32 GEMM, C = A * B + beta * C, that is mostly
+            // zeros, such as the weights of a pruned fully connected layer, stored in CSR
+            // format.
+            //
+            // The builder stores a constant operand this way when at least the fraction of its
+            // elements given by NGRAPH_CPU_SPARSE_GEMM_THRESHOLD, 0.8 by default, are zero. The
+            // kernel then only multiplies the nonzeros, so the work drops with the density.
+            // Below that sparsity the dense, packed GEMM is faster.
+            class CPU_SparseGemmOperand
+            {
+            public:
+                // Stores the nonzeros of `data`, the A operand (M x K, or K x M if `transpose`)
+                // when `is_a` and the B operand (K x N, or N x K if `transpose`) otherwise
+                CPU_SparseGemmOperand(bool is_a,
+                                      const float* data,
+                                      bool transpose,
+                                      size_t m,
+                                      size_t n,
+                                      size_t k,
+                                      size_t ld);
+
+                // C = A * B + beta * C, where `other` is the dense operand, with the rows of C
+                // spread over the threads of `arena`
+                void multiply(const float* other,
+                              bool transpose_other,
+                              size_t ld_other,
+                              float beta,
+                              float* c,
+                              size_t ldc,
+                              int arena) const;
+
+                size_t get_nonzero_count() const { return m_values.size(); }
+                // Stores argument `arg` (0 for A, 1 for B) of `node` if it is a f32 constant
+                // that is sparse enough, returns nullptr otherwise
+                static std::shared_ptr<CPU_SparseGemmOperand> sparse_constant(const Node* node,
+                                                                              size_t arg,
+                                                                              bool transpose,
+                                                                              size_t m,
+                                                                              size_t n,
+                                                                              size_t k,
+                                                                              size_t ld);
+
+            private:
+                bool m_is_a;
+                size_t m_m;
+                size_t m_n;
+                size_t m_k;
+                // The rows of A, or the columns of B, each of which is a row of nonzeros along
+                // the K axis
+                std::vector<size_t> m_row_offsets;
+                std::vector<uint32_t> m_columns;
+                std::vector<float> m_values;
+            };
+        }
+    }
+}
@@ -16,10 +16,12 @@
 
 #include <cstring>
 #include <memory>
+#include <vector>
 
 #include "cpu_tensor_view.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/runtime/buffer_pool.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
@@ -55,7 +57,7 @@ runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_
     else if (buffer_size > 0)
     {
         size_t allocation_size = buffer_size + BufferAlignment;
-        auto ptr = ngraph_malloc(allocation_size);
+        auto ptr = BufferPool::get().allocate(allocation_size);
         buffer = static_cast<char*>(ptr);
 
 // GCC major versions below 5 do not implement C++11 std::align
@@ -79,7 +81,7 @@ runtime::cpu::CPUTensorView::CPUTensorView(const ngraph::element::Type& element_
 
 runtime::cpu::CPUTensorView::~CPUTensorView()
 {
-    ngraph_free(buffer);
+    BufferPool::get().deallocate(buffer);
 }
 
 char* runtime::cpu::CPUTensorView::get_data_ptr()
@@ -92,12 +94,32 @@ const char* runtime::cpu::CPUTensorView::get_data_ptr() const
     return aligned_buffer;
 }
 
+// True if the data in a layout is in row-major order, so the host can access it directly
+static bool is_native_layout(const runtime::Tensor& tensor,
+                             const runtime::cpu::LayoutDescriptor* cpu_tvl)
+{
+    if (!cpu_tvl || !cpu_tvl->is_mkldnn_layout() || cpu_tvl->get_size() <= 1)
+    {
+        return true;
+    }
+    auto native_md = runtime::cpu::mkldnn_utils::create_blocked_mkldnn_md(
+        tensor.get_shape(), cpu_tvl->get_strides(), tensor.get_element_type());
+    return runtime::cpu::mkldnn_utils::compare_mkldnn_mds(cpu_tvl->get_mkldnn_md(), native_md);
+}
+
 void runtime::cpu::CPUTensorView::write(const void* source, size_t tensor_offset, size_t n)
 {
     if (tensor_offset + n > buffer_size)
     {
         throw out_of_range("write access past end of tensor");
     }
+    // The host writes row-major data, a tensor kept in an MKLDNN layout by a previous call
+    // goes back to the native layout first so that partial writes keep the rest intact
+    auto cpu_tvl = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(get_tensor_layout());
+    if (!is_native_layout(*this, cpu_tvl.get()))
+    {
+        convert_layout(std::make_shared<runtime::cpu::LayoutDescriptor>(*m_descriptor));
+    }
     char* target = get_data_ptr();
     memcpy(&target[tensor_offset], source, n);
 }
@@ -112,29 +134,7 @@ void runtime::cpu::CPUTensorView::read(void* target, size_t tensor_offset, size_
     auto tvl = this->get_tensor_layout();
     auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
 
-    auto needs_conversion = [&]() {
-        if (!cpu_tvl)
-        {
-            return false;
-        }
-        if (!cpu_tvl->is_mkldnn_layout())
-        {
-            return false;
-        }
-        if (cpu_tvl->get_size() <= 1)
-        {
-            return false;
-        }
-        auto native_md = mkldnn_utils::create_blocked_mkldnn_md(
-            this->get_shape(), cpu_tvl->get_strides(), this->get_element_type());
-        if (mkldnn_utils::compare_mkldnn_mds(cpu_tvl->get_mkldnn_md(), native_md))
-        {
-            return false;
-        }
-        return true;
-    };
-
-    if (needs_conversion())
+    if (!is_native_layout(*this, cpu_tvl))
     {
         auto tensor_shape = this->get_shape();
         auto input_desc = cpu_tvl->get_mkldnn_md();
@@ -153,3 +153,142 @@ void runtime::cpu::CPUTensorView::read(void* target, size_t tensor_offset, size_
         memcpy(target, &source[tensor_offset], n);
     }
 }
+
+// Copies the runs of a region between a row-major tensor and a buffer, on the threads of the
+// first executor pool when the region is large enough to pay for it
+static void copy_region(const runtime::TensorRegion& region,
+                        const char* source,
+                        char* target,
+                        bool to_tensor)
+{
+    size_t run_size = region.get_run_size();
+    auto copy_runs = [&](Eigen::Index first, Eigen::Index last) {
+        for (Eigen::Index run = first; run < last; run++)
+        {
+            size_t tensor_offset;
+            size_t buffer_offset;
+            region.get_run_offsets(run, tensor_offset, buffer_offset);
+            if (to_tensor)
+            {
+                memcpy(target + tensor_offset, source + buffer_offset, run_size);
+            }
+            else
+            {
+                memcpy(target + buffer_offset, source + tensor_offset, run_size);
+            }
+        }
+    };
+    if (region.get_run_count() <= 1)
+    {
+        copy_runs(0, region.get_run_count());
+        return;
+    }
+    auto& device = runtime::cpu::executor::GetCPUExecutor().get_device(0);
+    Eigen::TensorOpCost cost(run_size, run_size, 0);
+    device.parallelFor(region.get_run_count(), cost, copy_runs);
+}
+
+void runtime::cpu::CPUTensorView::write_region(const void* p,
+                                               const Coordinate& lower,
+                                               const Coordinate& upper,
+                                               const Strides& strides)
+{
+    TensorRegion region(get_shape(), get_element_type().size(), lower, upper, strides);
+    // As for write, the rest of the tensor is kept by going back to the native layout
+    auto cpu_tvl = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(get_tensor_layout());
+    if (!is_native_layout(*this, cpu_tvl.get()))
+    {
+        convert_layout(std::make_shared<runtime::cpu::LayoutDescriptor>(*m_descriptor));
+    }
+    copy_region(region, static_cast<const char*>(p), get_data_ptr(), true);
+}
+
+void runtime::cpu::CPUTensorView::read_region(void* p,
+                                              const Coordinate& lower,
+                                              const Coordinate& upper,
+                                              const Strides& strides) const
+{
+    TensorRegion region(get_shape(), get_element_type().size(), lower, upper, strides);
+    if (region.get_run_count() == 0)
+    {
+        return;
+    }
+    auto tvl = this->get_tensor_layout();
+    auto cpu_tvl = dynamic_cast<runtime::cpu::LayoutDescriptor*>(tvl.get());
+    if (is_native_layout(*this, cpu_tvl))
+    {
+        copy_region(region, aligned_buffer, static_cast<char*>(p), false);
+        return;
+    }
+
+    // Reorder a view of just the region into the destination strides. Views cannot split
+    // the blocks of a blocked layout, such regions are read from a native copy instead.
+    const Shape& region_shape = region.get_shape();
+    try
+    {
+        memory::primitive_desc input_pd{cpu_tvl->get_mkldnn_md(), executor::global_cpu_engine};
+        auto view_pd = view::primitive_desc(input_pd,
+                                            memory::dims(region_shape.begin(), region_shape.end()),
+                                            memory::dims(lower.begin(), lower.end()))
+                           .dst_primitive_desc();
+        auto output_desc = mkldnn_utils::create_blocked_mkldnn_md(
+            region_shape, region.get_strides(), get_element_type());
+        memory input{input_pd, aligned_buffer};
+        memory output{{output_desc, executor::global_cpu_engine}, p};
+        reorder prim{reorder::primitive_desc(view_pd, output.get_primitive_desc()), input, output};
+        mkldnn::stream s(mkldnn::stream::kind::eager);
+        s.submit({prim}).wait();
+    }
+    catch (const mkldnn::error&)
+    {
+        vector<char> native(buffer_size);
+        read(native.data(), 0, buffer_size);
+        copy_region(region, native.data(), static_cast<char*>(p), false);
+    }
+}
+
+void runtime::cpu::CPUTensorView::convert_layout(
+    const std::shared_ptr<runtime::cpu::LayoutDescriptor>& layout)
+{
+    auto cpu_tvl = dynamic_pointer_cast<runtime::cpu::LayoutDescriptor>(get_tensor_layout());
+    if (cpu_tvl == layout)
+    {
+        return;
+    }
+    bool from_native = is_native_layout(*this, cpu_tvl.get());
+    bool to_native = is_native_layout(*this, layout.get());
+    if (from_native && to_native)
+    {
+        // Nothing to reorder. The layout is left alone so that tensors shared by concurrent
+        // calls are not written to.
+        return;
+    }
+    if (!from_native && !to_native &&
+        mkldnn_utils::compare_mkldnn_mds(cpu_tvl->get_mkldnn_md(), layout->get_mkldnn_md()))
+    {
+        return;
+    }
+
+    auto native_md = [&](const runtime::cpu::LayoutDescriptor* tvl) {
+        Strides strides = tvl ? tvl->get_strides() : Strides(row_major_strides(get_shape()));
+        return mkldnn_utils::create_blocked_mkldnn_md(get_shape(), strides, get_element_type());
+    };
+    auto input_desc = from_native ? native_md(cpu_tvl.get()) : cpu_tvl->get_mkldnn_md();
+    auto output_desc = to_native ? native_md(layout.get()) : layout->get_mkldnn_md();
+    for (auto& desc : {input_desc, output_desc})
+    {
+        if (memory::primitive_desc(desc, executor::global_cpu_engine).get_size() != buffer_size)
+        {
+            throw ngraph_error("Cannot convert tensor to a padded layout");
+        }
+    }
+
+    // Reorders are not in place, so the data is copied aside first
+    std::vector<char> source(aligned_buffer, aligned_buffer + buffer_size);
+    memory input{{input_desc, executor::global_cpu_engine}, source.data()};
+    memory output{{output_desc, executor::global_cpu_engine}, aligned_buffer};
+    reorder prim{input, output};
+    mkldnn::stream s(mkldnn::stream::kind::eager);
+    s.submit({prim}).wait();
+    set_tensor_layout(layout);
+}
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <memory>
 #include <string>
 
 #include "ngraph/runtime/tensor.hpp"
@@ -30,6 +31,8 @@ namespace ngraph
     {
         namespace cpu
         {
+            class LayoutDescriptor;
+
             class CPUTensorView : public ngraph::runtime::Tensor
             {
             public:
@@ -54,6 +57,24 @@ namespace ngraph
                 /// \param n Number of bytes to read, must be integral number of elements.
                 void read(void* p, size_t tensor_offset, size_t n) const override;
 
+                /// \brief Write a region of the tensor. Large regions are copied in parallel.
+                void write_region(const void* p,
+                                  const Coordinate& lower,
+                                  const Coordinate& upper,
+                                  const Strides& strides = Strides{}) override;
+
+                /// \brief Read a region of the tensor. Large regions are copied in parallel, and
+                ///        only the region is reordered out of an MKLDNN layout.
+                void read_region(void* p,
+                                 const Coordinate& lower,
+                                 const Coordinate& upper,
+                                 const Strides& strides = Strides{}) const override;
+
+                /// \brief Reorder the data in place into a layout and make it the tensor's layout.
+                ///        Nothing is written when the data is already laid out the same way.
+                /// \param layout Layout of a parameter the tensor is bound to
+                void convert_layout(const std::shared_ptr<LayoutDescriptor>& layout);
+
                 static constexpr int BufferAlignment = NGRAPH_CPU_ALIGNMENT;
 
             private:
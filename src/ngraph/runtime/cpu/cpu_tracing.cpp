@@ -14,8 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstdlib>
 #include <fstream>
+#include <iomanip>
 #include <map>
+#ifdef _WIN32
+#include <windows.h>
+// windows.h must be before processthreadsapi.h so we need this comment
+#include <processthreadsapi.h>
+#define getpid() GetCurrentProcessId()
+#else
+#include <unistd.h>
+#endif
 
 #include "cpu_tracing.hpp"
 
@@ -90,3 +101,254 @@ bool ngraph::runtime::cpu::IsTracingEnabled()
     return false;
 }
 #endif
+
+// The op index that marks the event of a whole call
+static const uint64_t s_call_event = 0xffffffff;
+
+static size_t getenv_size(const char* name, size_t default_value)
+{
+    const char* value = std::getenv(name);
+    return value == nullptr ? default_value : static_cast<size_t>(std::atoll(value));
+}
+
+// Chrome traces are in microseconds; keep the nanoseconds as decimals
+static void write_microseconds(std::ostream& out, int64_t ns)
+{
+    out << ns / 1000 << '.' << std::setw(3) << std::setfill('0') << ns % 1000;
+}
+
+ngraph::runtime::cpu::TimelineRecorder& ngraph::runtime::cpu::TimelineRecorder::get()
+{
+    static TimelineRecorder recorder;
+    return recorder;
+}
+
+ngraph::runtime::cpu::TimelineRecorder::TimelineRecorder()
+    : m_capacity(1)
+    , m_max_calls_per_file(getenv_size("NGRAPH_CPU_TRACING_MAX_CALLS", 0))
+    , m_pid(getpid())
+{
+    size_t requested = std::max<size_t>(getenv_size("NGRAPH_CPU_TRACING_BUFFER_SIZE", 65536), 2);
+    while (m_capacity < requested)
+    {
+        m_capacity <<= 1;
+    }
+    m_slots.reset(new Slot[m_capacity]);
+    for (size_t i = 0; i < m_capacity; i++)
+    {
+        m_slots[i].sequence.store(0, std::memory_order_relaxed);
+    }
+    m_writer = std::thread(&TimelineRecorder::run_writer, this);
+}
+
+ngraph::runtime::cpu::TimelineRecorder::~TimelineRecorder()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wake_writer.notify_one();
+    m_writer.join();
+
+    for (auto& function : m_functions)
+    {
+        if (function->file.is_open())
+        {
+            function->file << "\n]\n";
+            function->file.close();
+        }
+    }
+}
+
+size_t ngraph::runtime::cpu::TimelineRecorder::register_function(
+    const std::string& name,
+    const std::vector<OpAttributes>& op_attrs,
+    const std::vector<std::string>& op_names)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::unique_ptr<FunctionTimeline> function(new FunctionTimeline);
+    function->name = name;
+    function->op_attrs = op_attrs;
+    function->op_names = op_names;
+    m_functions.push_back(std::move(function));
+    return m_functions.size() - 1;
+}
+
+void ngraph::runtime::cpu::TimelineRecorder::record_op(size_t function_id,
+                                                       size_t op_index,
+                                                       const Timestamp& start,
+                                                       const Timestamp& end)
+{
+    record((static_cast<uint64_t>(function_id) << 32) | op_index, start, end);
+}
+
+void ngraph::runtime::cpu::TimelineRecorder::record_call(size_t function_id,
+                                                         const Timestamp& start,
+                                                         const Timestamp& end)
+{
+    record((static_cast<uint64_t>(function_id) << 32) | s_call_event, start, end);
+}
+
+void ngraph::runtime::cpu::TimelineRecorder::record(uint64_t function_op,
+                                                    const Timestamp& start,
+                                                    const Timestamp& end)
+{
+    // Small, stable thread ids read better in the trace viewer than hashed std::thread::ids
+    static std::atomic<uint64_t> s_next_thread{0};
+    static thread_local uint64_t s_thread = s_next_thread++;
+
+    uint64_t position = m_head.fetch_add(1, std::memory_order_relaxed);
+    Slot& slot = m_slots[position & (m_capacity - 1)];
+    slot.sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    slot.function_op.store(function_op, std::memory_order_relaxed);
+    slot.thread.store(s_thread, std::memory_order_relaxed);
+    slot.start.store(std::chrono::duration_cast<std::chrono::nanoseconds>(start.time_since_epoch())
+                         .count(),
+                     std::memory_order_relaxed);
+    slot.end.store(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end.time_since_epoch()).count(),
+        std::memory_order_relaxed);
+    slot.sequence.store(position + 1, std::memory_order_release);
+
+    if ((position & (m_capacity / 2 - 1)) == 0)
+    {
+        // Half of the buffer has been filled since the last wake up
+        m_wake_writer.notify_one();
+    }
+}
+
+void ngraph::runtime::cpu::TimelineRecorder::flush()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    drain();
+}
+
+void ngraph::runtime::cpu::TimelineRecorder::run_writer()
+{
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (!m_stop)
+    {
+        m_wake_writer.wait_for(lock, std::chrono::milliseconds(100));
+        drain();
+    }
+    drain();
+}
+
+void ngraph::runtime::cpu::TimelineRecorder::drain()
+{
+    uint64_t head = m_head.load(std::memory_order_acquire);
+    if (head - m_tail > m_capacity)
+    {
+        m_dropped += head - m_capacity - m_tail;
+        m_tail = head - m_capacity;
+    }
+    while (m_tail < head)
+    {
+        Slot& slot = m_slots[m_tail & (m_capacity - 1)];
+        uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence < m_tail + 1)
+        {
+            // Still being written; pick it up on the next drain
+            break;
+        }
+        uint64_t function_op = slot.function_op.load(std::memory_order_relaxed);
+        uint64_t thread = slot.thread.load(std::memory_order_relaxed);
+        int64_t start = slot.start.load(std::memory_order_relaxed);
+        int64_t end = slot.end.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (sequence != m_tail + 1 || slot.sequence.load(std::memory_order_relaxed) != sequence)
+        {
+            // Overwritten by a newer event
+            m_dropped++;
+        }
+        else
+        {
+            write_event(function_op, thread, start, end);
+        }
+        m_tail++;
+    }
+
+    for (auto& function : m_functions)
+    {
+        if (function->file.is_open())
+        {
+            function->file.flush();
+        }
+    }
+}
+
+void ngraph::runtime::cpu::TimelineRecorder::write_event(uint64_t function_op,
+                                                        uint64_t thread,
+                                                        int64_t start,
+                                                        int64_t end)
+{
+    size_t function_id = static_cast<size_t>(function_op >> 32);
+    uint64_t op = function_op & s_call_event;
+    if (function_id >= m_functions.size())
+    {
+        return;
+    }
+    FunctionTimeline& function = *m_functions[function_id];
+    bool is_call = (op == s_call_event);
+    if (!is_call && op >= function.op_attrs.size())
+    {
+        return;
+    }
+
+    std::ofstream& out = function.file;
+    if (!out.is_open())
+    {
+        std::string file_name = function.name + ".timeline";
+        if (function.file_index > 0)
+        {
+            file_name += "." + std::to_string(function.file_index);
+        }
+        out.open(file_name + ".json", std::ios_base::trunc);
+        // The closing bracket is optional in the JSON array form of the format, so the file
+        // can be read before it is complete
+        out << "[";
+        function.calls_in_file = 0;
+    }
+    else
+    {
+        out << ",";
+    }
+
+    out << "\n{\"name\":\"" << (is_call ? function.name : function.op_attrs[op].Description)
+        << "\",\"cat\":\"" << (is_call ? "Call" : "Op") << "\",\"ph\":\"X\",\"pid\":" << m_pid
+        << ",\"tid\":" << thread << ",\"ts\":";
+    write_microseconds(out, start);
+    out << ",\"dur\":";
+    write_microseconds(out, std::max<int64_t>(end - start, 0));
+    out << ",\"args\":{";
+    if (!is_call)
+    {
+        const OpAttributes& attrs = function.op_attrs[op];
+        const char* separator = "";
+        if (op < function.op_names.size())
+        {
+            out << "\"Node\":\"" << function.op_names[op] << "\"";
+            separator = ",";
+        }
+        for (size_t i = 0; i < attrs.Inputs.size(); i++)
+        {
+            out << separator << "\"Input" << i + 1 << "\":\"" << attrs.Inputs[i] << "\"";
+            separator = ",";
+        }
+        for (size_t i = 0; i < attrs.Outputs.size(); i++)
+        {
+            out << separator << "\"Output" << i + 1 << "\":\"" << attrs.Outputs[i] << "\"";
+            separator = ",";
+        }
+    }
+    out << "}}";
+
+    size_t max_calls = m_max_calls_per_file;
+    if (is_call && max_calls != 0 && ++function.calls_in_file >= max_calls)
+    {
+        out << "\n]\n";
+        out.close();
+        function.file_index++;
+    }
+}
@@ -16,8 +16,14 @@
 
 #pragma once
 
+#include <atomic>
+#include <condition_variable>
 #include <cstdint>
+#include <fstream>
+#include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include "ngraph/runtime/cpu/cpu_external_function.hpp"
@@ -75,6 +81,82 @@ namespace ngraph
                                   int64_t* op_durations,
                                   const std::string& file_name);
             bool IsTracingEnabled();
+
+            // Collects the op and call events of the CPU backend while NGRAPH_CPU_TRACING is
+            // set. Recording an event only stores its start and end times and thread into a
+            // lock-free ring buffer of NGRAPH_CPU_TRACING_BUFFER_SIZE events (default 65536);
+            // a background thread drains it into <function>.timeline.json in the Chrome trace
+            // format. Events overwritten before they are written out are dropped and counted.
+            // With NGRAPH_CPU_TRACING_MAX_CALLS=N a file holds at most N calls, and the trace
+            // rotates to <function>.timeline.1.json, <function>.timeline.2.json, ...
+            class TimelineRecorder
+            {
+            public:
+                static TimelineRecorder& get();
+                ~TimelineRecorder();
+
+                // Returns the id that the events of the function's ops are recorded with
+                size_t register_function(const std::string& name,
+                                         const std::vector<OpAttributes>& op_attrs,
+                                         const std::vector<std::string>& op_names);
+                void record_op(size_t function_id,
+                               size_t op_index,
+                               const Timestamp& start,
+                               const Timestamp& end);
+                void record_call(size_t function_id, const Timestamp& start, const Timestamp& end);
+
+                // Write out every event recorded so far
+                void flush();
+                size_t get_dropped_count() const { return m_dropped; }
+                void set_max_calls_per_file(size_t max_calls) { m_max_calls_per_file = max_calls; }
+            private:
+                TimelineRecorder();
+                TimelineRecorder(const TimelineRecorder&) = delete;
+                TimelineRecorder& operator=(const TimelineRecorder&) = delete;
+
+                // Fields are atomics so that the writer thread can read a slot while it is
+                // being overwritten; `sequence` is the event's position plus one once the
+                // event is complete, and 0 while it is written.
+                struct Slot
+                {
+                    std::atomic<uint64_t> sequence;
+                    std::atomic<uint64_t> function_op;
+                    std::atomic<uint64_t> thread;
+                    std::atomic<int64_t> start;
+                    std::atomic<int64_t> end;
+                };
+
+                struct FunctionTimeline
+                {
+                    std::string name;
+                    std::vector<OpAttributes> op_attrs;
+                    std::vector<std::string> op_names;
+                    std::ofstream file;
+                    size_t file_index = 0;
+                    size_t calls_in_file = 0;
+                };
+
+                void record(uint64_t function_op, const Timestamp& start, const Timestamp& end);
+                void drain();
+                void write_event(uint64_t function_op, uint64_t thread, int64_t start, int64_t end);
+                void run_writer();
+
+                size_t m_capacity;
+                std::unique_ptr<Slot[]> m_slots;
+                std::atomic<uint64_t> m_head{0};
+                uint64_t m_tail = 0;
+                std::atomic<size_t> m_dropped{0};
+                std::atomic<size_t> m_max_calls_per_file;
+                const int m_pid;
+                const Timestamp m_epoch;
+
+                // Guards the function timelines and the draining of the ring buffer
+                std::mutex m_mutex;
+                std::vector<std::unique_ptr<FunctionTimeline>> m_functions;
+                std::condition_variable m_wake_writer;
+                bool m_stop = false;
+                std::thread m_writer;
+            };
         }
     }
 }
@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/runtime/cpu/cpu_workspace.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::cpu::CPU_Workspace::CPU_Workspace(size_t alignment)
+    : m_alignment(alignment)
+{
+}
+
+vector<runtime::AlignedBuffer*> runtime::cpu::CPU_Workspace::acquire(const vector<size_t>& sizes)
+{
+    vector<AlignedBuffer*> buffers;
+    lock_guard<mutex> lock(m_mutex);
+    for (size_t size : sizes)
+    {
+        // Take the smallest idle buffer that is large enough. If none is, grow the largest
+        // one so that the number of buffers only follows the number of concurrent calls.
+        auto better = [size](const unique_ptr<AlignedBuffer>& a,
+                             const unique_ptr<AlignedBuffer>& b) {
+            bool a_fits = a->size() >= size;
+            bool b_fits = b->size() >= size;
+            if (a_fits != b_fits)
+            {
+                return a_fits;
+            }
+            return a_fits ? a->size() < b->size() : a->size() > b->size();
+        };
+        auto best = m_idle.end();
+        for (auto it = m_idle.begin(); it != m_idle.end(); ++it)
+        {
+            if (best == m_idle.end() || better(*it, *best))
+            {
+                best = it;
+            }
+        }
+        unique_ptr<AlignedBuffer> buffer;
+        if (best != m_idle.end())
+        {
+            buffer = move(*best);
+            m_idle.erase(best);
+        }
+        if (buffer == nullptr || buffer->size() < size)
+        {
+            if (buffer != nullptr)
+            {
+                m_allocated_size -= buffer->size();
+            }
+            buffer.reset(new AlignedBuffer(size, m_alignment));
+            m_allocated_size += size;
+        }
+        buffers.push_back(buffer.release());
+    }
+    return buffers;
+}
+
+void runtime::cpu::CPU_Workspace::release(vector<AlignedBuffer*>& buffers)
+{
+    lock_guard<mutex> lock(m_mutex);
+    for (auto buffer : buffers)
+    {
+        m_idle.emplace_back(buffer);
+    }
+    buffers.clear();
+}
+
+size_t runtime::cpu::CPU_Workspace::get_allocated_size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_allocated_size;
+}
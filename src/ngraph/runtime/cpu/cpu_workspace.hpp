@@ -0,0 +1,62 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Temporary memory pools shared by the executables of one CPU_Backend.
+            //
+            // An executable using a workspace has no pools of its own. Each call borrows one
+            // buffer per pool for its duration and gives them back when it returns, so the
+            // memory held is that of the largest executable times the number of calls running
+            // at once, rather than the sum over all executables and their runtime contexts.
+            class CPU_Workspace
+            {
+            public:
+                CPU_Workspace(size_t alignment);
+
+                // Borrow a buffer of at least sizes[i] bytes for every pool i
+                std::vector<AlignedBuffer*> acquire(const std::vector<size_t>& sizes);
+                // Give back buffers returned by acquire; clears `buffers`
+                void release(std::vector<AlignedBuffer*>& buffers);
+
+                // Bytes currently allocated by the workspace, whether borrowed or idle
+                size_t get_allocated_size() const;
+
+            private:
+                CPU_Workspace(const CPU_Workspace&) = delete;
+                CPU_Workspace& operator=(const CPU_Workspace&) = delete;
+
+                size_t m_alignment;
+                mutable std::mutex m_mutex;
+                std::vector<std::unique_ptr<AlignedBuffer>> m_idle;
+                size_t m_allocated_size = 0;
+            };
+        }
+    }
+}
@@ -62,6 +62,35 @@ namespace ngraph
                     out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
                         in.broadcast(factors);
                 }
+
+                // Rank-generic version of broadcast, the axes where the input has extent 1 and
+                // the output does not are broadcast
+                template <typename ElementType>
+                void broadcast_ref(void* input,
+                                   void* output,
+                                   const Shape& input_shape,
+                                   const Shape& output_shape,
+                                   int arena)
+                {
+                    AxisSet broadcast_axes;
+                    Shape arg_shape;
+                    for (size_t i = 0; i < output_shape.size(); i++)
+                    {
+                        if (input_shape[i] == 1 && output_shape[i] != 1)
+                        {
+                            broadcast_axes.insert(i);
+                        }
+                        else
+                        {
+                            arg_shape.push_back(input_shape[i]);
+                        }
+                    }
+                    reference::broadcast(static_cast<const ElementType*>(input),
+                                         static_cast<ElementType*>(output),
+                                         arg_shape,
+                                         output_shape,
+                                         broadcast_axes);
+                }
             }
         }
     }
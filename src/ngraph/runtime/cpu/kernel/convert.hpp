@@ -16,10 +16,13 @@
 
 #pragma once
 
+#include <cstdint>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/type/bfloat16.hpp"
 
 namespace ngraph
 {
@@ -110,6 +113,41 @@ namespace ngraph
                 {
                     convert<InputElementType, bool>(input, output, count, arena);
                 }
+
+                // A bf16 value is the upper half of the bits of an f32, so the conversions
+                // between the two only shift, and round, bit patterns
+
+                inline void
+                    convert_bf16_to_float32(void* input, void* output, size_t count, int arena)
+                {
+                    auto in = static_cast<const uint16_t*>(input);
+                    auto out = static_cast<uint32_t*>(output);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count,
+                        Eigen::TensorOpCost(sizeof(uint16_t), sizeof(uint32_t), 1),
+                        [in, out](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                out[i] = static_cast<uint32_t>(in[i]) << 16;
+                            }
+                        });
+                }
+
+                inline void
+                    convert_float32_to_bf16(void* input, void* output, size_t count, int arena)
+                {
+                    auto in = static_cast<const float*>(input);
+                    auto out = static_cast<uint16_t*>(output);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        count,
+                        Eigen::TensorOpCost(sizeof(uint32_t), sizeof(uint16_t), 2),
+                        [in, out](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                out[i] = bfloat16(in[i]).to_bits();
+                            }
+                        });
+                }
             }
         }
     }
@@ -0,0 +1,391 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/op/experimental/layers/detection_output.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/nms.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                enum class BoxCoding
+                {
+                    Corner,
+                    CenterSize,
+                    CornerSize
+                };
+
+                /// \brief The coding of a DetectionOutputAttrs::code_type such as
+                ///        "caffe.PriorBoxParameter.CENTER_SIZE"
+                inline BoxCoding get_box_coding(const std::string& code_type)
+                {
+                    auto ends_with = [&code_type](const std::string& suffix) {
+                        return code_type.size() >= suffix.size() &&
+                               code_type.compare(
+                                   code_type.size() - suffix.size(), suffix.size(), suffix) == 0;
+                    };
+                    if (ends_with("CENTER_SIZE"))
+                    {
+                        return BoxCoding::CenterSize;
+                    }
+                    if (ends_with("CORNER_SIZE"))
+                    {
+                        return BoxCoding::CornerSize;
+                    }
+                    return BoxCoding::Corner;
+                }
+
+                /// \brief Applies the predicted offsets `loc` to the corners of `prior`.
+                ///        `variance` is null when the variance is encoded in the offsets.
+                inline void decode_box(const float* prior,
+                                       const float* variance,
+                                       const float* loc,
+                                       BoxCoding coding,
+                                       float* box)
+                {
+                    float v[4] = {1.0f, 1.0f, 1.0f, 1.0f};
+                    if (variance)
+                    {
+                        std::copy(variance, variance + 4, v);
+                    }
+                    float width = prior[2] - prior[0];
+                    float height = prior[3] - prior[1];
+                    switch (coding)
+                    {
+                    case BoxCoding::Corner:
+                        for (size_t k = 0; k < 4; k++)
+                        {
+                            box[k] = prior[k] + v[k] * loc[k];
+                        }
+                        break;
+                    case BoxCoding::CornerSize:
+                        box[0] = prior[0] + v[0] * loc[0] * width;
+                        box[1] = prior[1] + v[1] * loc[1] * height;
+                        box[2] = prior[2] + v[2] * loc[2] * width;
+                        box[3] = prior[3] + v[3] * loc[3] * height;
+                        break;
+                    case BoxCoding::CenterSize:
+                    {
+                        float center_x = v[0] * loc[0] * width + (prior[0] + prior[2]) / 2;
+                        float center_y = v[1] * loc[1] * height + (prior[1] + prior[3]) / 2;
+                        float box_width = std::exp(v[2] * loc[2]) * width;
+                        float box_height = std::exp(v[3] * loc[3]) * height;
+                        box[0] = center_x - box_width / 2;
+                        box[1] = center_y - box_height / 2;
+                        box[2] = center_x + box_width / 2;
+                        box[3] = center_y + box_height / 2;
+                        break;
+                    }
+                    }
+                }
+
+                /// \brief DetectionOutput of SSD-like detectors.
+                ///
+                /// Decodes the box predictions `loc` against the prior boxes, keeps the boxes
+                /// of each class whose confidence exceeds the threshold, suppresses overlapping
+                /// ones and writes the `boxes_top_k[0]` best detections of each image. Each
+                /// output row is {image, label, confidence, xmin, ymin, xmax, ymax}, grouped by
+                /// image and then by label; the rows past the last detection have image -1.
+                ///
+                /// When `arm_conf_shape` is not empty the priors are first refined by `arm_loc`,
+                /// and priors whose objectness in `arm_conf` is below the threshold are
+                /// background. Boxes are decoded in parallel, and the classes of every image
+                /// are suppressed in parallel, on the threads of `arena`.
+                inline void detection_output(const void* loc_data,
+                                             const void* conf_data,
+                                             const void* prior_data,
+                                             const void* arm_conf_data,
+                                             const void* arm_loc_data,
+                                             void* out_data,
+                                             const Shape& loc_shape,
+                                             const Shape& prior_shape,
+                                             const Shape& arm_conf_shape,
+                                             const Shape& out_shape,
+                                             const ngraph::op::DetectionOutputAttrs& attrs,
+                                             int arena)
+                {
+                    auto loc = static_cast<const float*>(loc_data);
+                    auto conf = static_cast<const float*>(conf_data);
+                    auto prior = static_cast<const float*>(prior_data);
+                    auto arm_conf = static_cast<const float*>(arm_conf_data);
+                    auto arm_loc = static_cast<const float*>(arm_loc_data);
+                    auto out = static_cast<float*>(out_data);
+
+                    size_t images = loc_shape[0];
+                    size_t classes = attrs.num_classes;
+                    size_t loc_classes = attrs.share_location ? 1 : classes;
+                    // unnormalized priors start with the index of their image
+                    size_t prior_size = attrs.normalized ? 4 : 5;
+                    size_t priors = prior_shape[2] / prior_size;
+                    bool has_variance = prior_shape[1] == 2;
+                    bool with_arm = shape_size(arm_conf_shape) > 0;
+                    BoxCoding coding = get_box_coding(attrs.code_type);
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+
+                    // The boxes of image n and location class c start at
+                    // (n * loc_classes + c) * priors
+                    BoxList boxes;
+                    boxes.resize(images * loc_classes * priors);
+                    auto decode = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            size_t p = i % priors;
+                            size_t c = (i / priors) % loc_classes;
+                            size_t n = i / priors / loc_classes;
+                            const float* prior_row =
+                                prior + (prior_shape[0] == 1 ? 0 : n) * prior_shape[1] *
+                                            prior_shape[2];
+                            float prior_box[4];
+                            std::copy(prior_row + p * prior_size + prior_size - 4,
+                                      prior_row + p * prior_size + prior_size,
+                                      prior_box);
+                            if (!attrs.normalized)
+                            {
+                                prior_box[0] /= attrs.input_width;
+                                prior_box[1] /= attrs.input_height;
+                                prior_box[2] /= attrs.input_width;
+                                prior_box[3] /= attrs.input_height;
+                            }
+                            const float* variance =
+                                has_variance ? prior_row + prior_shape[2] + p * 4 : nullptr;
+
+                            size_t loc_offset = ((n * priors + p) * loc_classes + c) * 4;
+                            float box[4];
+                            if (with_arm)
+                            {
+                                float refined[4];
+                                decode_box(
+                                    prior_box, variance, arm_loc + loc_offset, coding, refined);
+                                decode_box(refined, variance, loc + loc_offset, coding, box);
+                            }
+                            else
+                            {
+                                decode_box(prior_box, variance, loc + loc_offset, coding, box);
+                            }
+                            if (attrs.clip_before_nms)
+                            {
+                                for (float& coordinate : box)
+                                {
+                                    coordinate = std::min(std::max(coordinate, 0.0f), 1.0f);
+                                }
+                            }
+                            boxes.x0[i] = box[0];
+                            boxes.y0[i] = box[1];
+                            boxes.x1[i] = box[2];
+                            boxes.y1[i] = box[3];
+                        }
+                    };
+                    device.parallelFor(boxes.size(),
+                                       Eigen::TensorOpCost(12 * sizeof(float),
+                                                           4 * sizeof(float),
+                                                           with_arm ? 40 : 20),
+                                       decode);
+
+                    auto score = [&](size_t n, size_t p, size_t c) {
+                        if (with_arm &&
+                            arm_conf[(n * priors + p) * 2 + 1] < attrs.objectness_score_threshold)
+                        {
+                            return static_cast<int>(c) == attrs.background_label_id ? 1.0f
+                                                                                     : 0.0f;
+                        }
+                        return conf[(n * priors + p) * classes + c];
+                    };
+
+                    // Suppresses the candidates of image n, of the given classes and scores,
+                    // and adds the kept ones to the kept priors of their class
+                    std::vector<std::vector<size_t>> kept(images * classes);
+                    auto suppress = [&](size_t n,
+                                        const std::vector<size_t>& candidates,
+                                        const std::vector<size_t>& candidate_classes,
+                                        const std::vector<float>& scores) {
+                        std::vector<size_t> order = sort_scores(scores, attrs.results_top_k);
+                        BoxList sorted;
+                        sorted.resize(order.size());
+                        for (size_t j = 0; j < order.size(); j++)
+                        {
+                            size_t c = attrs.share_location ? 0 : candidate_classes[order[j]];
+                            size_t i = (n * loc_classes + c) * priors + candidates[order[j]];
+                            sorted.x0[j] = boxes.x0[i];
+                            sorted.y0[j] = boxes.y0[i];
+                            sorted.x1[j] = boxes.x1[i];
+                            sorted.y1[j] = boxes.y1[i];
+                        }
+                        std::vector<size_t> positions;
+                        nms(sorted, attrs.nms_threshold, 0.0f, order.size(), positions);
+                        for (size_t position : positions)
+                        {
+                            size_t candidate = order[position];
+                            kept[n * classes + candidate_classes[candidate]].push_back(
+                                candidates[candidate]);
+                        }
+                    };
+
+                    Eigen::TensorOpCost suppress_cost(
+                        priors * sizeof(float), priors * sizeof(size_t), priors * 32);
+                    if (attrs.decrease_label_id)
+                    {
+                        // MXNet suppresses the boxes of all classes together, each prior
+                        // labelled with its best class
+                        auto suppress_images = [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index n = first; n < last; n++)
+                            {
+                                std::vector<size_t> candidates;
+                                std::vector<size_t> candidate_classes;
+                                std::vector<float> scores;
+                                for (size_t p = 0; p < priors; p++)
+                                {
+                                    size_t best_class = 0;
+                                    float best_score = 0;
+                                    bool found = false;
+                                    for (size_t c = 0; c < classes; c++)
+                                    {
+                                        float s = score(n, p, c);
+                                        if (static_cast<int>(c) != attrs.background_label_id &&
+                                            (!found || s > best_score))
+                                        {
+                                            best_class = c;
+                                            best_score = s;
+                                            found = true;
+                                        }
+                                    }
+                                    if (found && best_score > attrs.confidence_threshold)
+                                    {
+                                        candidates.push_back(p);
+                                        candidate_classes.push_back(best_class);
+                                        scores.push_back(best_score);
+                                    }
+                                }
+                                suppress(n, candidates, candidate_classes, scores);
+                            }
+                        };
+                        device.parallelFor(images, suppress_cost * classes, suppress_images);
+                    }
+                    else
+                    {
+                        auto suppress_classes = [&](Eigen::Index first, Eigen::Index last) {
+                            for (Eigen::Index t = first; t < last; t++)
+                            {
+                                size_t n = t / classes;
+                                size_t c = t % classes;
+                                if (static_cast<int>(c) == attrs.background_label_id)
+                                {
+                                    continue;
+                                }
+                                std::vector<size_t> candidates;
+                                std::vector<float> scores;
+                                for (size_t p = 0; p < priors; p++)
+                                {
+                                    float s = score(n, p, c);
+                                    if (s > attrs.confidence_threshold)
+                                    {
+                                        candidates.push_back(p);
+                                        scores.push_back(s);
+                                    }
+                                }
+                                suppress(n,
+                                         candidates,
+                                         std::vector<size_t>(candidates.size(), c),
+                                         scores);
+                            }
+                        };
+                        device.parallelFor(images * classes, suppress_cost, suppress_classes);
+                    }
+
+                    // The best detections of each image, by label and then by decreasing score
+                    size_t rows = out_shape[2];
+                    size_t row = 0;
+                    for (size_t n = 0; n < images && row < rows; n++)
+                    {
+                        // score, class and prior
+                        std::vector<std::tuple<float, size_t, size_t>> detections;
+                        for (size_t c = 0; c < classes; c++)
+                        {
+                            for (size_t p : kept[n * classes + c])
+                            {
+                                detections.emplace_back(score(n, p, c), c, p);
+                            }
+                        }
+                        int64_t keep_top_k = attrs.boxes_top_k.empty() ? -1 : attrs.boxes_top_k[0];
+                        if (keep_top_k >= 0 && detections.size() > static_cast<size_t>(keep_top_k))
+                        {
+                            std::stable_sort(detections.begin(),
+                                             detections.end(),
+                                             [](const std::tuple<float, size_t, size_t>& a,
+                                                const std::tuple<float, size_t, size_t>& b) {
+                                                 return std::get<0>(a) > std::get<0>(b);
+                                             });
+                            detections.resize(keep_top_k);
+                            std::stable_sort(detections.begin(),
+                                             detections.end(),
+                                             [](const std::tuple<float, size_t, size_t>& a,
+                                                const std::tuple<float, size_t, size_t>& b) {
+                                                 return std::get<1>(a) < std::get<1>(b);
+                                             });
+                        }
+
+                        for (auto& detection : detections)
+                        {
+                            if (row == rows)
+                            {
+                                break;
+                            }
+                            size_t c = std::get<1>(detection);
+                            size_t i = (n * loc_classes + (attrs.share_location ? 0 : c)) *
+                                           priors +
+                                       std::get<2>(detection);
+                            float box[] = {boxes.x0[i], boxes.y0[i], boxes.x1[i], boxes.y1[i]};
+                            float* out_row = out + row * 7;
+                            out_row[0] = static_cast<float>(n);
+                            out_row[1] =
+                                static_cast<float>(c) - (attrs.decrease_label_id ? 1.0f : 0.0f);
+                            out_row[2] = std::get<0>(detection);
+                            for (size_t k = 0; k < 4; k++)
+                            {
+                                out_row[3 + k] =
+                                    attrs.clip_after_nms ? std::min(std::max(box[k], 0.0f), 1.0f)
+                                                         : box[k];
+                            }
+                            row++;
+                        }
+                    }
+                    for (; row < rows; row++)
+                    {
+                        std::fill(out + row * 7, out + row * 7 + 7, 0.0f);
+                        out[row * 7] = -1.0f;
+                    }
+                }
+            }
+        }
+    }
+}
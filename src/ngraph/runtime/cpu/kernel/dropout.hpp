@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/state/rng_state.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType>
+                void dropout(void* input,
+                             void* output,
+                             size_t count,
+                             RNGState* rng_state,
+                             uint64_t base,
+                             bool training,
+                             int arena)
+                {
+                    ElementType* in = static_cast<ElementType*>(input);
+                    ElementType* out = static_cast<ElementType*>(output);
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    if (!training)
+                    {
+                        Eigen::array<Eigen::Index, 1> dims;
+                        dims[0] = count;
+                        Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> result(
+                            out, dims);
+                        Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> arg(in,
+                                                                                         dims);
+                        result.device(device) = arg;
+                        return;
+                    }
+
+                    auto scale = static_cast<ElementType>(1.0 / rng_state->get_probability());
+                    device.parallelFor(
+                        count,
+                        Eigen::TensorOpCost(sizeof(ElementType), sizeof(ElementType), 11),
+                        [in, out, scale, base, rng_state](Eigen::Index first, Eigen::Index last) {
+                            rng_state->sample(
+                                base, first, last, [in, out, scale](size_t i, bool keep) {
+                                    out[i] = keep ? in[i] * scale : ElementType(0);
+                                });
+                        });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,235 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Rows gathered ahead of the current one are prefetched this many indices early
+                constexpr int embedding_prefetch_distance = 8;
+
+                inline void embedding_prefetch_row(const char* row, size_t row_bytes)
+                {
+                    for (size_t offset = 0; offset < row_bytes; offset += 64)
+                    {
+                        __builtin_prefetch(row + offset, 0, 0);
+                    }
+                }
+
+                /// \brief Gather the rows of `weights` selected by `indices` into `out`.
+                ///
+                /// The table is handled as rows of `row_bytes` bytes, so one instance serves
+                /// every table element type. Indices are split across the threads of `arena`.
+                template <typename IndexType>
+                void embedding_lookup(const void* indices,
+                                      const void* weights,
+                                      void* out,
+                                      size_t indices_count,
+                                      size_t row_bytes,
+                                      int arena)
+                {
+                    auto index = static_cast<const IndexType*>(indices);
+                    auto table = static_cast<const char*>(weights);
+                    auto dst = static_cast<char*>(out);
+
+                    auto gather = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            Eigen::Index ahead = i + embedding_prefetch_distance;
+                            if (ahead < last)
+                            {
+                                embedding_prefetch_row(
+                                    table + row_bytes * static_cast<size_t>(index[ahead]),
+                                    row_bytes);
+                            }
+                            memcpy(dst + row_bytes * i,
+                                   table + row_bytes * static_cast<size_t>(index[i]),
+                                   row_bytes);
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor()
+                        .get_device(arena)
+                        .parallelFor(indices_count,
+                                     Eigen::TensorOpCost(row_bytes, row_bytes, 0),
+                                     gather);
+                }
+
+                /// \brief Gather the f32 rows of quantized `weights` selected by `indices` into
+                /// `out`, where row i stands for weights[i] * scale[i] + bias[i].
+                ///
+                /// Only the gathered rows are dequantized, so the table stays in its compact
+                /// QuantizedType (int8_t, uint8_t or Eigen::half) and each row is converted
+                /// with vector instructions on its way to `out`.
+                template <typename QuantizedType, typename IndexType>
+                void embedding_lookup_dequantize(const void* indices,
+                                                 const void* weights,
+                                                 const void* scale,
+                                                 const void* bias,
+                                                 void* out,
+                                                 size_t indices_count,
+                                                 size_t vec_len,
+                                                 int arena)
+                {
+                    using QuantizedRow =
+                        Eigen::Map<const Eigen::Array<QuantizedType, Eigen::Dynamic, 1>>;
+                    using Row = Eigen::Map<Eigen::ArrayXf>;
+                    auto index = static_cast<const IndexType*>(indices);
+                    auto table = static_cast<const QuantizedType*>(weights);
+                    auto row_scale = static_cast<const float*>(scale);
+                    auto row_bias = static_cast<const float*>(bias);
+                    auto dst = static_cast<float*>(out);
+                    size_t row_bytes = vec_len * sizeof(QuantizedType);
+
+                    auto gather = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            Eigen::Index ahead = i + embedding_prefetch_distance;
+                            if (ahead < last)
+                            {
+                                embedding_prefetch_row(
+                                    reinterpret_cast<const char*>(
+                                        table + vec_len * static_cast<size_t>(index[ahead])),
+                                    row_bytes);
+                            }
+                            size_t row = static_cast<size_t>(index[i]);
+                            QuantizedRow quantized(table + vec_len * row, vec_len);
+                            Row(dst + vec_len * i, vec_len) =
+                                quantized.template cast<float>() * row_scale[row] + row_bias[row];
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor()
+                        .get_device(arena)
+                        .parallelFor(
+                            indices_count,
+                            Eigen::TensorOpCost(row_bytes, vec_len * sizeof(float), 2 * vec_len),
+                            gather);
+                }
+
+                /// \brief Scatter-add the rows of `delta` into the rows of `out` selected by
+                /// `indices`, the other rows of `out` are zeroed.
+                ///
+                /// Repeated indices accumulate into the same row, so the threads of `arena`
+                /// split the columns of the table rather than the indices.
+                template <typename ElementType, typename IndexType>
+                void embedding_lookup_backprop(const void* indices,
+                                               const void* delta,
+                                               void* out,
+                                               size_t indices_count,
+                                               size_t row_count,
+                                               size_t vec_len,
+                                               int arena)
+                {
+                    auto index = static_cast<const IndexType*>(indices);
+                    auto src = static_cast<const ElementType*>(delta);
+                    auto dst = static_cast<ElementType*>(out);
+
+                    std::fill(dst, dst + row_count * vec_len, ElementType(0));
+                    auto scatter = [&](Eigen::Index first, Eigen::Index last) {
+                        for (size_t i = 0; i < indices_count; i++)
+                        {
+                            ElementType* row = dst + vec_len * static_cast<size_t>(index[i]);
+                            const ElementType* delta_row = src + vec_len * i;
+                            for (Eigen::Index k = first; k < last; k++)
+                            {
+                                row[k] += delta_row[k];
+                            }
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor()
+                        .get_device(arena)
+                        .parallelFor(vec_len,
+                                     Eigen::TensorOpCost(indices_count * sizeof(ElementType),
+                                                         indices_count * sizeof(ElementType),
+                                                         indices_count),
+                                     scatter);
+                }
+
+                /// \brief Sum, or average when `mean` is set, the `bag_size` rows selected by
+                /// each consecutive group of `indices` into one row of `out`.
+                template <typename ElementType, typename IndexType>
+                void embedding_bag(const void* indices,
+                                   const void* weights,
+                                   void* out,
+                                   size_t bag_count,
+                                   size_t bag_size,
+                                   size_t vec_len,
+                                   bool mean,
+                                   int arena)
+                {
+                    auto index = static_cast<const IndexType*>(indices);
+                    auto table = static_cast<const ElementType*>(weights);
+                    auto dst = static_cast<ElementType*>(out);
+
+                    auto pool = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index bag = first; bag < last; bag++)
+                        {
+                            const IndexType* bag_index = index + bag * bag_size;
+                            ElementType* out_row = dst + bag * vec_len;
+                            std::fill(out_row, out_row + vec_len, ElementType(0));
+                            for (size_t j = 0; j < bag_size; j++)
+                            {
+                                size_t ahead = j + embedding_prefetch_distance;
+                                if (ahead < bag_size)
+                                {
+                                    const ElementType* next =
+                                        table + vec_len * static_cast<size_t>(bag_index[ahead]);
+                                    embedding_prefetch_row(reinterpret_cast<const char*>(next),
+                                                           vec_len * sizeof(ElementType));
+                                }
+                                const ElementType* row =
+                                    table + vec_len * static_cast<size_t>(bag_index[j]);
+                                for (size_t k = 0; k < vec_len; k++)
+                                {
+                                    out_row[k] += row[k];
+                                }
+                            }
+                            if (mean && bag_size > 0)
+                            {
+                                for (size_t k = 0; k < vec_len; k++)
+                                {
+                                    out_row[k] /= static_cast<ElementType>(bag_size);
+                                }
+                            }
+                        }
+                    };
+                    size_t row_bytes = vec_len * sizeof(ElementType);
+                    ngraph::runtime::cpu::executor::GetCPUExecutor()
+                        .get_device(arena)
+                        .parallelFor(bag_count,
+                                     Eigen::TensorOpCost(bag_size * row_bytes,
+                                                         row_bytes,
+                                                         bag_size * vec_len),
+                                     pool);
+                }
+            }
+        }
+    }
+}
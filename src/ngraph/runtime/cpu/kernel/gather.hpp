@@ -0,0 +1,143 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstring>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Gather along `axis`: out[o, n, :] = params[o, indices[n], :], where o
+                /// runs over the dimensions before `axis` and n over every index.
+                ///
+                /// Each selected slice is contiguous, so it is copied with a single memcpy of
+                /// `element_size` times the product of the dimensions after `axis` bytes.
+                template <typename IndexType>
+                void gather(const void* params,
+                            const void* indices,
+                            void* out,
+                            const Shape& params_shape,
+                            const Shape& indices_shape,
+                            size_t axis,
+                            size_t element_size,
+                            int arena)
+                {
+                    size_t outer_count = 1;
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer_count *= params_shape[i];
+                    }
+                    size_t slice_bytes = element_size;
+                    for (size_t i = axis + 1; i < params_shape.size(); i++)
+                    {
+                        slice_bytes *= params_shape[i];
+                    }
+                    size_t axis_bytes = params_shape[axis] * slice_bytes;
+                    size_t indices_count = shape_size(indices_shape);
+
+                    auto index = static_cast<const IndexType*>(indices);
+                    auto src = static_cast<const char*>(params);
+                    auto dst = static_cast<char*>(out);
+
+                    auto copy = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            size_t outer = i / indices_count;
+                            size_t n = i % indices_count;
+                            memcpy(dst + i * slice_bytes,
+                                   src + outer * axis_bytes +
+                                       static_cast<size_t>(index[n]) * slice_bytes,
+                                   slice_bytes);
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor()
+                        .get_device(arena)
+                        .parallelFor(outer_count * indices_count,
+                                     Eigen::TensorOpCost(slice_bytes, slice_bytes, 0),
+                                     copy);
+                }
+
+                /// \brief Gather the slices of `params` addressed by the vectors along the last
+                /// dimension of `indices`. The slices are contiguous and copied whole.
+                template <typename IndexType>
+                void gather_nd(const void* params,
+                               const void* indices,
+                               void* out,
+                               const Shape& params_shape,
+                               const Shape& indices_shape,
+                               size_t element_size,
+                               int arena)
+                {
+                    size_t slice_rank = indices_shape.back();
+                    size_t slice_bytes = element_size;
+                    for (size_t i = slice_rank; i < params_shape.size(); i++)
+                    {
+                        slice_bytes *= params_shape[i];
+                    }
+                    // byte strides of the dimensions addressed by an index vector
+                    std::vector<size_t> strides(slice_rank);
+                    size_t stride = slice_bytes;
+                    for (size_t i = slice_rank; i-- > 0;)
+                    {
+                        strides[i] = stride;
+                        stride *= params_shape[i];
+                    }
+                    size_t slice_count = 1;
+                    for (size_t i = 0; i + 1 < indices_shape.size(); i++)
+                    {
+                        slice_count *= indices_shape[i];
+                    }
+
+                    auto index = static_cast<const IndexType*>(indices);
+                    auto src = static_cast<const char*>(params);
+                    auto dst = static_cast<char*>(out);
+
+                    auto copy = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index i = first; i < last; i++)
+                        {
+                            const IndexType* vector = index + i * slice_rank;
+                            size_t offset = 0;
+                            for (size_t j = 0; j < slice_rank; j++)
+                            {
+                                offset += static_cast<size_t>(vector[j]) * strides[j];
+                            }
+                            memcpy(dst + i * slice_bytes, src + offset, slice_bytes);
+                        }
+                    };
+                    ngraph::runtime::cpu::executor::GetCPUExecutor()
+                        .get_device(arena)
+                        .parallelFor(slice_count,
+                                     Eigen::TensorOpCost(slice_bytes, slice_bytes, slice_rank),
+                                     copy);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,72 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cmath>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+#include <unsupported/Eigen/SpecialFunctions>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // The whole expression is one Eigen evaluation, so every element is read and
+                // written once
+                template <typename ElementType>
+                void gelu(void* input0, void* output, size_t count, bool approximate, int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> out_dims, in_dims;
+
+                    out_dims[0] = in_dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> out(
+                        static_cast<ElementType*>(output), out_dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in0(
+                        static_cast<ElementType*>(input0), in_dims);
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    const ElementType half(0.5);
+                    const ElementType one(1);
+                    if (approximate)
+                    {
+                        const ElementType scale(std::sqrt(2.0 / M_PI));
+                        const ElementType coefficient(0.044715);
+                        out.device(device) =
+                            in0 * half *
+                            (((in0 + in0 * in0 * in0 * coefficient) * scale).tanh() + one);
+                    }
+                    else
+                    {
+                        const ElementType scale(M_SQRT1_2);
+                        auto erf = Eigen::internal::scalar_erf_op<ElementType>();
+                        out.device(device) = in0 * half * ((in0 * scale).unaryExpr(erf) + one);
+                    }
+                }
+            }
+        }
+    }
+}
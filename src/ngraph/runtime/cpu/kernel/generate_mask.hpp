@@ -0,0 +1,63 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/state/rng_state.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                template <typename ElementType>
+                void generate_mask(
+                    void* output, size_t count, RNGState* rng_state, bool training, int arena)
+                {
+                    ElementType* out = static_cast<ElementType*>(output);
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    if (!training)
+                    {
+                        Eigen::array<Eigen::Index, 1> dims;
+                        dims[0] = count;
+                        Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> mask(
+                            out, dims);
+                        mask.device(device) = mask.constant(ElementType(1));
+                        return;
+                    }
+
+                    // The counters of each element are fixed by the reservation, so the mask
+                    // does not depend on how it is split between threads
+                    uint64_t base = rng_state->reserve(count);
+                    device.parallelFor(
+                        count,
+                        Eigen::TensorOpCost(0, sizeof(ElementType), 10),
+                        [out, base, rng_state](Eigen::Index first, Eigen::Index last) {
+                            rng_state->generate(out, base, first, last);
+                        });
+                }
+            }
+        }
+    }
+}
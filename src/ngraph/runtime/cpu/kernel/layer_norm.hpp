@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cmath>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // The rows are split between the threads of the arena. Each row is read for the
+                // mean, the variance and the output while it is in cache, and written once,
+                // without the intermediate tensors of the decomposition.
+                template <typename ElementType>
+                void layer_norm(void* input,
+                                void* gamma,
+                                void* beta,
+                                void* output,
+                                size_t rows,
+                                size_t row_size,
+                                double epsilon,
+                                int arena)
+                {
+                    using Vector = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+                    const ElementType* in = static_cast<const ElementType*>(input);
+                    const ElementType* g = static_cast<const ElementType*>(gamma);
+                    const ElementType* b = static_cast<const ElementType*>(beta);
+                    ElementType* out = static_cast<ElementType*>(output);
+                    const ElementType eps = static_cast<ElementType>(epsilon);
+
+                    Eigen::TensorOpCost row_cost(3 * row_size * sizeof(ElementType),
+                                                 row_size * sizeof(ElementType),
+                                                 6 * row_size);
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        rows,
+                        row_cost,
+                        [in, g, b, out, row_size, eps](Eigen::Index first, Eigen::Index last) {
+                            Eigen::Map<const Vector> gamma_row(g, row_size);
+                            Eigen::Map<const Vector> beta_row(b, row_size);
+                            for (Eigen::Index row = first; row < last; row++)
+                            {
+                                Eigen::Map<const Vector> x(in + row * row_size, row_size);
+                                Eigen::Map<Vector> y(out + row * row_size, row_size);
+                                ElementType mean = x.mean();
+                                ElementType variance = (x - mean).square().mean();
+                                ElementType inv_stddev = 1 / std::sqrt(variance + eps);
+                                y = (x - mean) * inv_stddev * gamma_row + beta_row;
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
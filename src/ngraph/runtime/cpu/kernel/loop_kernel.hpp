@@ -0,0 +1,240 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <limits>
+#include <utility>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                namespace loop_program
+                {
+                    enum class Opcode
+                    {
+                        ABS,
+                        ADD,
+                        DIVIDE,
+                        MAXIMUM,
+                        MINIMUM,
+                        MULTIPLY,
+                        NEGATIVE,
+                        RELU,
+                        SUBTRACT,
+                        SUM,
+                        MAX
+                    };
+
+                    /// \brief One step of a compiled LoopKernel. Elementwise steps write
+                    /// register `result` from registers `arg0` and `arg1` (`arg1` repeats
+                    /// `arg0` for unary steps); SUM and MAX fold register `arg0` into
+                    /// accumulator `result`.
+                    struct Instruction
+                    {
+                        Opcode opcode;
+                        size_t result;
+                        size_t arg0;
+                        size_t arg1;
+                    };
+
+                    /// \brief A LoopKernel compiled, once, to steps over registers that each
+                    /// hold one block of elements. The first `input_count` registers read the
+                    /// kernel inputs; the others hold the values the kernel computes.
+                    struct Program
+                    {
+                        std::vector<Instruction> instructions;
+                        size_t input_count = 0;
+                        size_t register_count = 0;
+                        size_t accumulator_count = 0;
+                        /// (register, output) pairs for registers written straight into an
+                        /// output tensor
+                        std::vector<std::pair<size_t, size_t>> register_outputs;
+                        /// (accumulator, output) pairs for the reduction outputs
+                        std::vector<std::pair<size_t, size_t>> accumulator_outputs;
+                        /// Elements of each elementwise tensor of the kernel
+                        size_t loop_size = 0;
+                        /// Elements folded into each reduction output, 1 without reductions
+                        size_t reduction_size = 1;
+                    };
+
+                    // Elements per register; the registers of a block stay in L1
+                    constexpr size_t block_size = 256;
+
+                    template <typename ElementType>
+                    void run_block(const Program& program,
+                                   ElementType* const* registers,
+                                   size_t count,
+                                   ElementType* accumulators)
+                    {
+                        using Array = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+                        using Map = Eigen::Map<Array>;
+
+                        for (auto& instruction : program.instructions)
+                        {
+                            Map a(registers[instruction.arg0], count);
+                            if (instruction.opcode == Opcode::SUM)
+                            {
+                                accumulators[instruction.result] += a.sum();
+                                continue;
+                            }
+                            if (instruction.opcode == Opcode::MAX)
+                            {
+                                accumulators[instruction.result] =
+                                    std::max(accumulators[instruction.result], a.maxCoeff());
+                                continue;
+                            }
+
+                            Map b(registers[instruction.arg1], count);
+                            Map r(registers[instruction.result], count);
+                            switch (instruction.opcode)
+                            {
+                            case Opcode::ABS: r = a.abs(); break;
+                            case Opcode::ADD: r = a + b; break;
+                            case Opcode::DIVIDE: r = a / b; break;
+                            case Opcode::MAXIMUM: r = a.max(b); break;
+                            case Opcode::MINIMUM: r = a.min(b); break;
+                            case Opcode::MULTIPLY: r = a * b; break;
+                            case Opcode::NEGATIVE: r = -a; break;
+                            case Opcode::RELU: r = a.max(ElementType(0)); break;
+                            case Opcode::SUBTRACT: r = a - b; break;
+                            case Opcode::SUM:
+                            case Opcode::MAX: break;
+                            }
+                        }
+                    }
+                }
+
+                /// \brief Run a compiled LoopKernel over its tensors.
+                ///
+                /// Each thread of `arena` evaluates the kernel one block of elements at a
+                /// time, so the intermediate values never leave the cache and every step is
+                /// a vectorized Eigen expression. Inputs and outputs are read and written in
+                /// place; with reductions, threads own whole reduction outputs.
+                template <typename ElementType>
+                void loop_kernel(const loop_program::Program& program,
+                                 const std::vector<void*>& inputs,
+                                 const std::vector<void*>& outputs,
+                                 int arena)
+                {
+                    const size_t block_size = loop_program::block_size;
+
+                    // Points the registers at the elements from `offset` on
+                    auto bind_registers = [&](std::vector<ElementType*>& registers,
+                                              ElementType* scratch,
+                                              size_t offset) {
+                        for (size_t i = 0; i < program.register_count; i++)
+                        {
+                            registers[i] = i < program.input_count
+                                               ? static_cast<ElementType*>(inputs[i]) + offset
+                                               : scratch + i * block_size;
+                        }
+                        for (auto& output : program.register_outputs)
+                        {
+                            registers[output.first] =
+                                static_cast<ElementType*>(outputs[output.second]) + offset;
+                        }
+                    };
+
+                    auto bytes_per_element =
+                        (program.input_count + program.register_outputs.size()) *
+                        sizeof(ElementType);
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+
+                    if (program.accumulator_count == 0)
+                    {
+                        size_t blocks = (program.loop_size + block_size - 1) / block_size;
+                        device.parallelFor(
+                            blocks,
+                            Eigen::TensorOpCost(bytes_per_element * block_size,
+                                                0,
+                                                program.instructions.size() * block_size),
+                            [&](Eigen::Index first, Eigen::Index last) {
+                                std::vector<ElementType> scratch(program.register_count *
+                                                                 block_size);
+                                std::vector<ElementType*> registers(program.register_count);
+                                for (Eigen::Index block = first; block < last; block++)
+                                {
+                                    size_t offset = block * block_size;
+                                    size_t count =
+                                        std::min(block_size, program.loop_size - offset);
+                                    bind_registers(registers, scratch.data(), offset);
+                                    loop_program::run_block<ElementType>(
+                                        program, registers.data(), count, nullptr);
+                                }
+                            });
+                        return;
+                    }
+
+                    const ElementType sum_init = 0;
+                    const ElementType max_init = std::numeric_limits<ElementType>::has_infinity
+                                                     ? -std::numeric_limits<ElementType>::infinity()
+                                                     : std::numeric_limits<ElementType>::lowest();
+                    std::vector<ElementType> initial(program.accumulator_count, sum_init);
+                    for (auto& instruction : program.instructions)
+                    {
+                        if (instruction.opcode == loop_program::Opcode::MAX)
+                        {
+                            initial[instruction.result] = max_init;
+                        }
+                    }
+
+                    size_t rows = program.loop_size / program.reduction_size;
+                    device.parallelFor(
+                        rows,
+                        Eigen::TensorOpCost(bytes_per_element * program.reduction_size,
+                                            0,
+                                            program.instructions.size() *
+                                                program.reduction_size),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            std::vector<ElementType> scratch(program.register_count * block_size);
+                            std::vector<ElementType*> registers(program.register_count);
+                            std::vector<ElementType> accumulators;
+                            for (Eigen::Index row = first; row < last; row++)
+                            {
+                                accumulators = initial;
+                                size_t row_offset = row * program.reduction_size;
+                                for (size_t j = 0; j < program.reduction_size; j += block_size)
+                                {
+                                    size_t count = std::min(block_size, program.reduction_size - j);
+                                    bind_registers(registers, scratch.data(), row_offset + j);
+                                    loop_program::run_block(
+                                        program, registers.data(), count, accumulators.data());
+                                }
+                                for (auto& output : program.accumulator_outputs)
+                                {
+                                    static_cast<ElementType*>(outputs[output.second])[row] =
+                                        accumulators[output.first];
+                                }
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
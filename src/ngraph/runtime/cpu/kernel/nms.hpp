@@ -0,0 +1,129 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Corners of a list of boxes, one array per coordinate so that the
+                ///        overlap of one box with all the others is a vectorizable loop.
+                struct BoxList
+                {
+                    void resize(size_t count)
+                    {
+                        x0.resize(count);
+                        y0.resize(count);
+                        x1.resize(count);
+                        y1.resize(count);
+                    }
+                    size_t size() const { return x0.size(); }
+                    std::vector<float> x0;
+                    std::vector<float> y0;
+                    std::vector<float> x1;
+                    std::vector<float> y1;
+                };
+
+                /// \brief Greedy non-maximum suppression of `boxes`, sorted by decreasing
+                ///        score.
+                ///
+                /// A box is kept unless its intersection over union with a box kept before
+                /// exceeds `threshold`. `offset` is added to the extents, 1 for boxes in
+                /// pixel coordinates that include both corners and 0 otherwise. Appends the
+                /// positions of at most `max_kept` kept boxes to `kept`.
+                inline void nms(const BoxList& boxes,
+                                float threshold,
+                                float offset,
+                                size_t max_kept,
+                                std::vector<size_t>& kept)
+                {
+                    size_t count = boxes.size();
+                    const float* x0 = boxes.x0.data();
+                    const float* y0 = boxes.y0.data();
+                    const float* x1 = boxes.x1.data();
+                    const float* y1 = boxes.y1.data();
+                    std::vector<float> areas(count);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        areas[i] = std::max(0.0f, x1[i] - x0[i] + offset) *
+                                   std::max(0.0f, y1[i] - y0[i] + offset);
+                    }
+
+                    std::vector<char> suppressed(count, 0);
+                    size_t first_kept = kept.size();
+                    for (size_t i = 0; i < count && kept.size() - first_kept < max_kept; i++)
+                    {
+                        if (suppressed[i])
+                        {
+                            continue;
+                        }
+                        kept.push_back(i);
+                        for (size_t j = i + 1; j < count; j++)
+                        {
+                            float width =
+                                std::min(x1[i], x1[j]) - std::max(x0[i], x0[j]) + offset;
+                            float height =
+                                std::min(y1[i], y1[j]) - std::max(y0[i], y0[j]) + offset;
+                            float intersection =
+                                std::max(0.0f, width) * std::max(0.0f, height);
+                            // compared as a product rather than divided, so empty boxes
+                            // suppress nothing
+                            float overlap = areas[i] + areas[j] - intersection;
+                            suppressed[j] |= intersection > threshold * overlap;
+                        }
+                    }
+                }
+
+                /// \brief Positions of `scores` by decreasing score, keeping only the first
+                ///        `top_k` unless it is negative. Ties keep their order.
+                inline std::vector<size_t>
+                    sort_scores(const std::vector<float>& scores, int64_t top_k)
+                {
+                    std::vector<size_t> order(scores.size());
+                    for (size_t i = 0; i < order.size(); i++)
+                    {
+                        order[i] = i;
+                    }
+                    auto higher = [&scores](size_t a, size_t b) {
+                        return scores[a] > scores[b] || (!(scores[b] > scores[a]) && a < b);
+                    };
+                    if (top_k >= 0 && static_cast<size_t>(top_k) < order.size())
+                    {
+                        std::partial_sort(
+                            order.begin(), order.begin() + top_k, order.end(), higher);
+                        order.resize(top_k);
+                    }
+                    else
+                    {
+                        std::sort(order.begin(), order.end(), higher);
+                    }
+                    return order;
+                }
+            }
+        }
+    }
+}
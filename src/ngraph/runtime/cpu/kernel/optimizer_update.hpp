@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Every output element only depends on the input elements at the same index,
+                // so the outputs may share their buffer with the tensors they replace.
+
+                template <typename ElementType>
+                void sgd_momentum_update(void* parameter,
+                                         void* gradient,
+                                         void* velocity,
+                                         void* parameter_out,
+                                         void* velocity_out,
+                                         ElementType learning_rate,
+                                         ElementType momentum,
+                                         ElementType gradient_scale,
+                                         size_t count,
+                                         int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> p(
+                        static_cast<ElementType*>(parameter), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> g(
+                        static_cast<ElementType*>(gradient), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> v(
+                        static_cast<ElementType*>(velocity), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> p_out(
+                        static_cast<ElementType*>(parameter_out), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> v_out(
+                        static_cast<ElementType*>(velocity_out), dims);
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    v_out.device(device) = v * momentum + g * gradient_scale;
+                    p_out.device(device) = p - v_out * learning_rate;
+                }
+
+                template <typename ElementType>
+                void adam_update(void* parameter,
+                                 void* gradient,
+                                 void* first_moment,
+                                 void* second_moment,
+                                 void* parameter_out,
+                                 void* first_moment_out,
+                                 void* second_moment_out,
+                                 ElementType learning_rate,
+                                 ElementType beta1,
+                                 ElementType beta2,
+                                 ElementType epsilon,
+                                 ElementType gradient_scale,
+                                 size_t count,
+                                 int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> p(
+                        static_cast<ElementType*>(parameter), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> g(
+                        static_cast<ElementType*>(gradient), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> m(
+                        static_cast<ElementType*>(first_moment), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> v(
+                        static_cast<ElementType*>(second_moment), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> p_out(
+                        static_cast<ElementType*>(parameter_out), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> m_out(
+                        static_cast<ElementType*>(first_moment_out), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> v_out(
+                        static_cast<ElementType*>(second_moment_out), dims);
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    m_out.device(device) =
+                        m * beta1 + g * gradient_scale * (ElementType(1) - beta1);
+                    v_out.device(device) =
+                        v * beta2 + (g * gradient_scale).square() * (ElementType(1) - beta2);
+                    p_out.device(device) =
+                        p - m_out * learning_rate / (v_out.sqrt() + epsilon);
+                }
+
+                // Returns false when an element of `input` is an infinity or NaN. x * 0 is 0
+                // for finite x and NaN otherwise, so one sum reduction covers both cases.
+                template <typename ElementType>
+                bool all_finite(void* input, size_t count, int arena)
+                {
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> in(
+                        static_cast<ElementType*>(input), dims);
+                    Eigen::Tensor<ElementType, 0, Eigen::RowMajor> sum;
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    sum.device(device) = (in * ElementType(0)).sum();
+                    return sum() == ElementType(0);
+                }
+            }
+        }
+    }
+}
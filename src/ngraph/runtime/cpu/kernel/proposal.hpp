@@ -0,0 +1,242 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/kernel/nms.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief Proposal parameters that do not depend on the input shapes
+                struct ProposalParams
+                {
+                    size_t pre_nms_topn;
+                    size_t post_nms_topn;
+                    float nms_threshold;
+                    size_t feature_stride;
+                    size_t min_size;
+                    bool clip_before_nms;
+                    bool clip_after_nms;
+                    bool normalize;
+                    float box_size_scale;
+                    float box_coord_scale;
+                    // 1 for Caffe boxes, whose extents include both corners, 0 for TensorFlow
+                    float offset;
+                    // {x0, y0, x1, y1} of each anchor centered on the first feature
+                    std::vector<float> anchors;
+                };
+
+                /// \brief The anchors of a Faster R-CNN region proposal network, for each ratio
+                ///        the boxes of each scale, centered on a base_size square
+                inline std::vector<float> proposal_anchors(size_t base_size,
+                                                           const std::vector<float>& ratios,
+                                                           const std::vector<float>& scales,
+                                                           float offset)
+                {
+                    std::vector<float> anchors;
+                    float base_area = static_cast<float>(base_size * base_size);
+                    float center = 0.5f * (base_size - offset);
+                    for (float ratio : ratios)
+                    {
+                        float ratio_width = std::round(std::sqrt(base_area / ratio));
+                        float ratio_height = std::round(ratio_width * ratio);
+                        for (float scale : scales)
+                        {
+                            float half_width = 0.5f * (ratio_width * scale - offset);
+                            float half_height = 0.5f * (ratio_height * scale - offset);
+                            anchors.insert(anchors.end(),
+                                           {center - half_width,
+                                            center - half_height,
+                                            center + half_width,
+                                            center + half_height});
+                        }
+                    }
+                    return anchors;
+                }
+
+                /// \brief Proposal of a Faster R-CNN region proposal network.
+                ///
+                /// `class_probs` has shape {N, 2 * A, H, W}, the background then the object
+                /// probability of each of the A anchors at each feature, and `bbox_deltas`
+                /// shape {N, 4 * A, H, W}. `image_shape` holds the image height and width.
+                /// Each image gets `post_nms_topn` output rows {image, x0, y0, x1, y1}: the
+                /// anchors moved by their deltas, the `pre_nms_topn` most probable first, after
+                /// non-maximum suppression. Rows past the last proposal have image -1.
+                ///
+                /// The images are processed in parallel on the threads of `arena`.
+                inline void proposal(const void* class_probs_data,
+                                     const void* bbox_deltas_data,
+                                     const void* image_shape_data,
+                                     void* out_data,
+                                     const Shape& class_probs_shape,
+                                     const ProposalParams& params,
+                                     int arena)
+                {
+                    auto class_probs = static_cast<const float*>(class_probs_data);
+                    auto bbox_deltas = static_cast<const float*>(bbox_deltas_data);
+                    auto image_shape = static_cast<const int64_t*>(image_shape_data);
+                    auto out = static_cast<float*>(out_data);
+
+                    size_t images = class_probs_shape[0];
+                    size_t anchor_count = params.anchors.size() / 4;
+                    size_t height = class_probs_shape[2];
+                    size_t width = class_probs_shape[3];
+                    size_t features = height * width;
+                    float image_height = static_cast<float>(image_shape[0]);
+                    float image_width = static_cast<float>(image_shape[1]);
+                    float offset = params.offset;
+
+                    auto propose = [&](Eigen::Index first, Eigen::Index last) {
+                        for (Eigen::Index n = first; n < last; n++)
+                        {
+                            const float* probs =
+                                class_probs + (n * 2 + 1) * anchor_count * features;
+                            const float* deltas = bbox_deltas + n * 4 * anchor_count * features;
+
+                            BoxList boxes;
+                            boxes.resize(features * anchor_count);
+                            std::vector<float> scores(boxes.size());
+                            size_t count = 0;
+                            for (size_t f = 0; f < features; f++)
+                            {
+                                float shift_x = (f % width) * params.feature_stride;
+                                float shift_y = (f / width) * params.feature_stride;
+                                for (size_t a = 0; a < anchor_count; a++)
+                                {
+                                    const float* anchor = &params.anchors[a * 4];
+                                    float x0 = anchor[0] + shift_x;
+                                    float y0 = anchor[1] + shift_y;
+                                    float box_width = anchor[2] - anchor[0] + offset;
+                                    float box_height = anchor[3] - anchor[1] + offset;
+                                    const float* delta = deltas + a * 4 * features + f;
+                                    float center_x = x0 + 0.5f * box_width +
+                                                     params.box_coord_scale * delta[0] *
+                                                         box_width;
+                                    float center_y = y0 + 0.5f * box_height +
+                                                     params.box_coord_scale *
+                                                         delta[features] * box_height;
+                                    box_width *=
+                                        std::exp(params.box_size_scale * delta[2 * features]);
+                                    box_height *=
+                                        std::exp(params.box_size_scale * delta[3 * features]);
+
+                                    float box[] = {center_x - 0.5f * box_width,
+                                                   center_y - 0.5f * box_height,
+                                                   center_x + 0.5f * box_width - offset,
+                                                   center_y + 0.5f * box_height - offset};
+                                    if (params.clip_before_nms)
+                                    {
+                                        box[0] = std::min(std::max(box[0], 0.0f),
+                                                          image_width - offset);
+                                        box[1] = std::min(std::max(box[1], 0.0f),
+                                                          image_height - offset);
+                                        box[2] = std::min(std::max(box[2], 0.0f),
+                                                          image_width - offset);
+                                        box[3] = std::min(std::max(box[3], 0.0f),
+                                                          image_height - offset);
+                                    }
+                                    // boxes smaller than min_size are dropped
+                                    if (box[2] - box[0] + offset < params.min_size ||
+                                        box[3] - box[1] + offset < params.min_size)
+                                    {
+                                        continue;
+                                    }
+                                    boxes.x0[count] = box[0];
+                                    boxes.y0[count] = box[1];
+                                    boxes.x1[count] = box[2];
+                                    boxes.y1[count] = box[3];
+                                    scores[count] = probs[a * features + f];
+                                    count++;
+                                }
+                            }
+                            boxes.resize(count);
+                            scores.resize(count);
+
+                            std::vector<size_t> order =
+                                sort_scores(scores, static_cast<int64_t>(params.pre_nms_topn));
+                            BoxList sorted;
+                            sorted.resize(order.size());
+                            for (size_t j = 0; j < order.size(); j++)
+                            {
+                                sorted.x0[j] = boxes.x0[order[j]];
+                                sorted.y0[j] = boxes.y0[order[j]];
+                                sorted.x1[j] = boxes.x1[order[j]];
+                                sorted.y1[j] = boxes.y1[order[j]];
+                            }
+                            std::vector<size_t> kept;
+                            nms(sorted, params.nms_threshold, offset, params.post_nms_topn, kept);
+
+                            float* out_rows = out + n * params.post_nms_topn * 5;
+                            for (size_t j = 0; j < params.post_nms_topn; j++)
+                            {
+                                float* row = out_rows + j * 5;
+                                if (j >= kept.size())
+                                {
+                                    std::fill(row, row + 5, 0.0f);
+                                    row[0] = -1.0f;
+                                    continue;
+                                }
+                                float box[] = {sorted.x0[kept[j]],
+                                               sorted.y0[kept[j]],
+                                               sorted.x1[kept[j]],
+                                               sorted.y1[kept[j]]};
+                                if (params.clip_after_nms)
+                                {
+                                    box[0] = std::min(std::max(box[0], 0.0f), image_width);
+                                    box[1] = std::min(std::max(box[1], 0.0f), image_height);
+                                    box[2] = std::min(std::max(box[2], 0.0f), image_width);
+                                    box[3] = std::min(std::max(box[3], 0.0f), image_height);
+                                }
+                                if (params.normalize)
+                                {
+                                    box[0] /= image_width;
+                                    box[1] /= image_height;
+                                    box[2] /= image_width;
+                                    box[3] /= image_height;
+                                }
+                                row[0] = static_cast<float>(n);
+                                std::copy(box, box + 4, row + 1);
+                            }
+                        }
+                    };
+                    size_t boxes_per_image = features * anchor_count;
+                    executor::GetCPUExecutor().get_device(arena).parallelFor(
+                        images,
+                        Eigen::TensorOpCost(boxes_per_image * 5 * sizeof(float),
+                                            params.post_nms_topn * 5 * sizeof(float),
+                                            boxes_per_image * 64),
+                        propose);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,239 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <limits>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/op/quantize.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Views the input as [outer, channels, inner] where the scale and zero point
+                // vary along channels only. This holds when the quantization axes are empty
+                // (per-tensor) or consecutive (per-channel). Returns false otherwise.
+                inline bool get_quantization_layout(const Shape& input_shape,
+                                                    const AxisSet& axes,
+                                                    size_t& outer,
+                                                    size_t& channels,
+                                                    size_t& inner)
+                {
+                    outer = 1;
+                    channels = 1;
+                    inner = shape_size(input_shape);
+                    if (axes.empty())
+                    {
+                        return true;
+                    }
+                    size_t first_axis = *axes.begin();
+                    size_t last_axis = *axes.rbegin();
+                    if (last_axis - first_axis + 1 != axes.size())
+                    {
+                        return false;
+                    }
+                    inner = 1;
+                    for (size_t i = 0; i < input_shape.size(); i++)
+                    {
+                        if (i < first_axis)
+                        {
+                            outer *= input_shape[i];
+                        }
+                        else if (i <= last_axis)
+                        {
+                            channels *= input_shape[i];
+                        }
+                        else
+                        {
+                            inner *= input_shape[i];
+                        }
+                    }
+                    return true;
+                }
+
+                // Same rounding as reference::quantize, on whole arrays
+                template <typename REAL>
+                void quantize_round(REAL* data, size_t count, op::Quantize::RoundMode round_mode)
+                {
+                    using Vector = Eigen::Array<REAL, Eigen::Dynamic, 1>;
+                    Eigen::Map<Vector> q(data, count);
+                    const REAL half = 0.5;
+                    switch (round_mode)
+                    {
+                    case op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_INFINITY:
+                        q = (q < 0).select(-(q.abs() + half).floor(), (q.abs() + half).floor());
+                        break;
+                    case op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_ZERO:
+                        q = (q < 0).select(-(q.abs() - half).ceil(), (q.abs() - half).ceil());
+                        break;
+                    case op::Quantize::RoundMode::ROUND_NEAREST_UPWARD:
+                        q = (q + half).floor();
+                        break;
+                    case op::Quantize::RoundMode::ROUND_NEAREST_DOWNWARD:
+                        q = (q - half).ceil();
+                        break;
+                    case op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN:
+                    {
+                        // the nearest value rounded up, unless it is odd
+                        Vector up = (q + half).floor();
+                        q = ((up * half).floor() * 2 == up).select(up, (q - half).ceil());
+                        break;
+                    }
+                    case op::Quantize::RoundMode::ROUND_TOWARD_INFINITY:
+                        q = (q < 0).select(-q.abs().ceil(), q.abs().ceil());
+                        break;
+                    case op::Quantize::RoundMode::ROUND_TOWARD_ZERO:
+                        q = (q < 0).select(-q.abs().floor(), q.abs().floor());
+                        break;
+                    case op::Quantize::RoundMode::ROUND_UP: q = q.ceil(); break;
+                    case op::Quantize::RoundMode::ROUND_DOWN: q = q.floor(); break;
+                    }
+                }
+
+                // The elements are split between the threads of the arena. Each thread walks
+                // its range in segments that share one scale (per-tensor, or channels over
+                // several elements) or that line up with the scale vector (innermost
+                // channels), so the arithmetic runs on contiguous arrays.
+                template <typename REAL, typename QUANT>
+                void quantize(void* input,
+                              void* scale,
+                              void* zero_point,
+                              void* output,
+                              size_t outer,
+                              size_t channels,
+                              size_t inner,
+                              op::Quantize::RoundMode round_mode,
+                              int arena)
+                {
+                    using Vector = Eigen::Array<REAL, Eigen::Dynamic, 1>;
+                    using QuantVector = Eigen::Array<QUANT, Eigen::Dynamic, 1>;
+                    const REAL* in = static_cast<const REAL*>(input);
+                    const REAL* s = static_cast<const REAL*>(scale);
+                    const QUANT* zp = static_cast<const QUANT*>(zero_point);
+                    QUANT* out = static_cast<QUANT*>(output);
+
+                    const REAL min = static_cast<REAL>(std::numeric_limits<QUANT>::min());
+                    const REAL max = static_cast<REAL>(std::numeric_limits<QUANT>::max());
+                    // innermost channels are walked along the scale vector
+                    const bool per_element = inner == 1 && channels > 1;
+                    const size_t row_size = per_element ? channels : inner;
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        outer * channels * inner,
+                        Eigen::TensorOpCost(sizeof(REAL), sizeof(QUANT), 8),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            Vector q(std::min<size_t>(last - first, row_size));
+                            for (size_t e = first; e < static_cast<size_t>(last);)
+                            {
+                                size_t row = e / row_size;
+                                size_t offset = e % row_size;
+                                size_t count = std::min(last - e, row_size - offset);
+                                Eigen::Map<const Vector> x(in + e, count);
+                                auto y = q.head(count);
+                                if (per_element)
+                                {
+                                    y = x / Eigen::Map<const Vector>(s + offset, count);
+                                    quantize_round(q.data(), count, round_mode);
+                                    y += Eigen::Map<const QuantVector>(zp + offset, count)
+                                             .template cast<REAL>();
+                                }
+                                else
+                                {
+                                    size_t channel = row % channels;
+                                    y = x / s[channel];
+                                    quantize_round(q.data(), count, round_mode);
+                                    y += static_cast<REAL>(zp[channel]);
+                                }
+                                Eigen::Map<QuantVector>(out + e, count) =
+                                    y.max(min).min(max).template cast<QUANT>();
+                                e += count;
+                            }
+                        });
+                }
+
+                template <typename QUANT, typename REAL>
+                void dequantize(void* input,
+                                void* scale,
+                                void* zero_point,
+                                void* output,
+                                size_t outer,
+                                size_t channels,
+                                size_t inner,
+                                int arena)
+                {
+                    using Vector = Eigen::Array<REAL, Eigen::Dynamic, 1>;
+                    using QuantVector = Eigen::Array<QUANT, Eigen::Dynamic, 1>;
+                    const QUANT* in = static_cast<const QUANT*>(input);
+                    const REAL* s = static_cast<const REAL*>(scale);
+                    const QUANT* zp = static_cast<const QUANT*>(zero_point);
+                    REAL* out = static_cast<REAL*>(output);
+
+                    const bool per_element = inner == 1 && channels > 1;
+                    const size_t row_size = per_element ? channels : inner;
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        outer * channels * inner,
+                        Eigen::TensorOpCost(sizeof(QUANT), sizeof(REAL), 3),
+                        [&](Eigen::Index first, Eigen::Index last) {
+                            for (size_t e = first; e < static_cast<size_t>(last);)
+                            {
+                                size_t row = e / row_size;
+                                size_t offset = e % row_size;
+                                size_t count = std::min(last - e, row_size - offset);
+                                // the zero point is subtracted in integers, like the reference
+                                auto x = Eigen::Map<const QuantVector>(in + e, count)
+                                             .template cast<int32_t>();
+                                Eigen::Map<Vector> y(out + e, count);
+                                if (per_element)
+                                {
+                                    y = (x - Eigen::Map<const QuantVector>(zp + offset, count)
+                                                 .template cast<int32_t>())
+                                            .template cast<REAL>() *
+                                        Eigen::Map<const Vector>(s + offset, count);
+                                }
+                                else
+                                {
+                                    size_t channel = row % channels;
+                                    y = (x - static_cast<int32_t>(zp[channel]))
+                                            .template cast<REAL>() *
+                                        s[channel];
+                                }
+                                e += count;
+                            }
+                        });
+                }
+            }
+        }
+    }
+}
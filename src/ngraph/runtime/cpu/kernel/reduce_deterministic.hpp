@@ -0,0 +1,202 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // Reducers of reduce_deterministic. `accumulate` takes Eigen arrays as well as
+                // scalars, and applies the operation lane by lane.
+                struct SumReducer
+                {
+                    template <typename T>
+                    static T identity()
+                    {
+                        return T(0);
+                    }
+                    template <typename A, typename B>
+                    static void accumulate(A&& acc, const B& x)
+                    {
+                        acc += x;
+                    }
+                };
+
+                struct ProductReducer
+                {
+                    template <typename T>
+                    static T identity()
+                    {
+                        return T(1);
+                    }
+                    template <typename A, typename B>
+                    static void accumulate(A&& acc, const B& x)
+                    {
+                        acc *= x;
+                    }
+                };
+
+                // Elements a task reduces, at least a full row of the kept inner axes.
+                constexpr size_t deterministic_reduction_block = 16384;
+                // Most blocks a reduced axis is split into.
+                constexpr size_t deterministic_reduction_max_blocks = 64;
+                // Inner elements a task reduces.
+                constexpr size_t deterministic_reduction_inner_chunk = 1024;
+                // Interleaved accumulators of a contiguous reduction. This is a fixed
+                // number, not the vector width, so that the result does not depend on the ISA.
+                constexpr size_t deterministic_reduction_lanes = 16;
+
+                // Reduces `n` contiguous values with interleaved accumulators, which are then
+                // combined pairwise.
+                template <typename ElementType, typename Reducer>
+                ElementType reduce_lanes(const ElementType* x, size_t n)
+                {
+                    constexpr size_t lanes = deterministic_reduction_lanes;
+                    using Lanes = Eigen::Array<ElementType, lanes, 1>;
+                    Lanes acc = Lanes::Constant(Reducer::template identity<ElementType>());
+                    size_t i = 0;
+                    for (; i + lanes <= n; i += lanes)
+                    {
+                        Reducer::accumulate(acc, Eigen::Map<const Lanes>(x + i));
+                    }
+                    for (size_t j = 0; i < n; i++, j++)
+                    {
+                        Reducer::accumulate(acc(j), x[i]);
+                    }
+                    for (size_t width = lanes / 2; width > 0; width /= 2)
+                    {
+                        for (size_t j = 0; j < width; j++)
+                        {
+                            Reducer::accumulate(acc(j), acc(j + width));
+                        }
+                    }
+                    return acc(0);
+                }
+
+                // Reduces axis 1 of `input`, viewed as [outer, reduced, inner], into `output`,
+                // viewed as [outer, inner].
+                //
+                // The reduced axis is split into blocks whose size only depends on the shape.
+                // The tasks reduce the blocks, each in a fixed order, in parallel, and the
+                // partial results of a row are then combined in block order. The result is so
+                // the same for any number of threads, unlike an Eigen reduction, whose blocking
+                // follows the thread pool.
+                template <typename ElementType, typename Reducer>
+                void reduce_deterministic(const void* input,
+                                          void* output,
+                                          size_t outer,
+                                          size_t reduced,
+                                          size_t inner,
+                                          int arena)
+                {
+                    auto in = static_cast<const ElementType*>(input);
+                    auto out = static_cast<ElementType*>(output);
+                    if (outer == 0 || inner == 0)
+                    {
+                        return;
+                    }
+
+                    size_t chunk = std::min(inner, deterministic_reduction_inner_chunk);
+                    size_t chunks = (inner + chunk - 1) / chunk;
+                    size_t block_rows = std::max(
+                        (deterministic_reduction_block + chunk - 1) / chunk,
+                        (reduced + deterministic_reduction_max_blocks - 1) /
+                            deterministic_reduction_max_blocks);
+                    size_t blocks = std::max<size_t>(1, (reduced + block_rows - 1) / block_rows);
+                    // Partial results of every block but the first, which goes to the output
+                    std::vector<ElementType> partials(outer * (blocks - 1) * inner);
+
+                    auto reduce_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                        using Row = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+                        for (Eigen::Index task = first; task < last; task++)
+                        {
+                            size_t o = task / (blocks * chunks);
+                            size_t b = task / chunks % blocks;
+                            size_t c = task % chunks;
+                            size_t begin = b * block_rows;
+                            size_t end = std::min(reduced, begin + block_rows);
+                            size_t i0 = c * chunk;
+                            size_t width = std::min(inner - i0, chunk);
+                            ElementType* acc = b == 0 ? out + o * inner
+                                                      : &partials[(o * (blocks - 1) + b - 1) *
+                                                                  inner];
+                            const ElementType* rows = in + o * reduced * inner + i0;
+                            if (inner == 1)
+                            {
+                                acc[0] = reduce_lanes<ElementType, Reducer>(rows + begin,
+                                                                            end - begin);
+                                continue;
+                            }
+                            Eigen::Map<Row> dst(acc + i0, width);
+                            dst.setConstant(Reducer::template identity<ElementType>());
+                            for (size_t r = begin; r < end; r++)
+                            {
+                                Reducer::accumulate(
+                                    dst, Eigen::Map<const Row>(rows + r * inner, width));
+                            }
+                        }
+                    };
+
+                    auto& device = executor::GetCPUExecutor().get_device(arena);
+                    size_t task_size = std::min(reduced, block_rows) * chunk;
+                    device.parallelFor(outer * blocks * chunks,
+                                       Eigen::TensorOpCost(task_size * sizeof(ElementType),
+                                                           chunk * sizeof(ElementType),
+                                                           task_size),
+                                       reduce_blocks);
+                    if (blocks == 1)
+                    {
+                        return;
+                    }
+
+                    auto combine_blocks = [&](Eigen::Index first, Eigen::Index last) {
+                        using Row = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+                        for (Eigen::Index o = first; o < last; o++)
+                        {
+                            Eigen::Map<Row> dst(out + o * inner, inner);
+                            for (size_t b = 1; b < blocks; b++)
+                            {
+                                Reducer::accumulate(
+                                    dst,
+                                    Eigen::Map<const Row>(
+                                        &partials[(o * (blocks - 1) + b - 1) * inner], inner));
+                            }
+                        }
+                    };
+                    device.parallelFor(outer,
+                                       Eigen::TensorOpCost(blocks * inner * sizeof(ElementType),
+                                                           inner * sizeof(ElementType),
+                                                           blocks * inner),
+                                       combine_blocks);
+                }
+            }
+        }
+    }
+}
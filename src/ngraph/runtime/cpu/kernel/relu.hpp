@@ -20,7 +20,6 @@
 #include <unsupported/Eigen/CXX11/Tensor>
 
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
-#include "ngraph/runtime/reference/relu.hpp"
 
 namespace ngraph
 {
@@ -83,10 +82,20 @@ namespace ngraph
                 template <typename ElementType>
                 void relu_backprop(void* arg, void* delta_arg, void* out, size_t count, int arena)
                 {
-                    reference::relu_backprop<ElementType>(static_cast<ElementType*>(arg),
-                                                          static_cast<ElementType*>(delta_arg),
-                                                          static_cast<ElementType*>(out),
-                                                          count);
+                    Eigen::array<Eigen::Index, 1> dims;
+                    dims[0] = count;
+
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> result(
+                        static_cast<ElementType*>(out), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> fwd(
+                        static_cast<ElementType*>(arg), dims);
+                    Eigen::TensorMap<Eigen::Tensor<ElementType, 1, Eigen::RowMajor>> delta(
+                        static_cast<ElementType*>(delta_arg), dims);
+
+                    result.device(
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
+                        (fwd > fwd.constant(ElementType(0)))
+                            .select(delta, delta.constant(ElementType(0)));
                 }
             }
         }
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/scaled_dot_product_attention.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                // The query rows of all batches are split between the threads of the arena,
+                // each row runs the key-blocked online softmax of the reference kernel
+                template <typename ElementType>
+                void scaled_dot_product_attention(void* query,
+                                                  void* key,
+                                                  void* value,
+                                                  void* mask,
+                                                  void* output,
+                                                  const Shape& query_shape,
+                                                  const Shape& value_shape,
+                                                  double scale,
+                                                  int arena)
+                {
+                    const ElementType* q = static_cast<const ElementType*>(query);
+                    const ElementType* k = static_cast<const ElementType*>(key);
+                    const ElementType* v = static_cast<const ElementType*>(value);
+                    const ElementType* m = static_cast<const ElementType*>(mask);
+                    ElementType* out = static_cast<ElementType*>(output);
+
+                    const size_t rows = query_shape[0] * query_shape[1];
+                    const size_t kv_len = value_shape[1];
+                    const size_t row_width = query_shape[2] + value_shape[2];
+                    Eigen::TensorOpCost row_cost(kv_len * row_width * sizeof(ElementType),
+                                                 value_shape[2] * sizeof(ElementType),
+                                                 2 * kv_len * row_width);
+
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        rows,
+                        row_cost,
+                        [q, k, v, m, out, &query_shape, &value_shape, scale](Eigen::Index first,
+                                                                             Eigen::Index last) {
+                            reference::scaled_dot_product_attention_rows(q,
+                                                                         k,
+                                                                         v,
+                                                                         m,
+                                                                         out,
+                                                                         query_shape,
+                                                                         value_shape,
+                                                                         scale,
+                                                                         first,
+                                                                         last);
+                        });
+                }
+            }
+        }
+    }
+}
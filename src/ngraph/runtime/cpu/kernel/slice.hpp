@@ -21,6 +21,7 @@
 
 #include "ngraph/coordinate.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/reference/slice.hpp"
 #include "ngraph/shape.hpp"
 
 namespace ngraph
@@ -88,6 +89,26 @@ namespace ngraph
                     out.device(ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena)) =
                         in.stridedSlice(start_indices, stop_indices, strides);
                 }
+
+                // Rank-generic version of strided_slice
+                template <typename ElementType>
+                void slice_ref(void* input,
+                               void* output,
+                               const Shape& input_shape,
+                               const Shape& output_shape,
+                               const Coordinate& lower_bounds,
+                               const Coordinate& upper_bounds,
+                               const Strides& slice_strides,
+                               int arena)
+                {
+                    reference::slice(static_cast<const ElementType*>(input),
+                                     static_cast<ElementType*>(output),
+                                     input_shape,
+                                     lower_bounds,
+                                     upper_bounds,
+                                     slice_strides,
+                                     output_shape);
+                }
             }
         }
     }
@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <vector>
+
 #define EIGEN_USE_THREADS
 #include <unsupported/Eigen/CXX11/Tensor>
 
@@ -164,6 +166,88 @@ namespace ngraph
                 {
                     softmax<ElementType, 4, 3>(input, output, input_shape, softmax_axes, arena);
                 }
+
+                // Softmax over any set of axes. The kept axes after the last softmax axis form
+                // contiguous rows of `inner` elements that are processed together, so the
+                // reduction walks whole rows even when the softmax axes are not innermost. The
+                // outer coordinates are split between the threads of the arena. Each input row
+                // is read once for a running maximum and rescaled sum, and once more to write
+                // the scaled exponentials.
+                template <typename ElementType>
+                void softmax_any_axes(void* input,
+                                      void* output,
+                                      const Shape& input_shape,
+                                      const AxisSet& softmax_axes,
+                                      int arena)
+                {
+                    using Vector = Eigen::Array<ElementType, Eigen::Dynamic, 1>;
+                    const ElementType* in = static_cast<const ElementType*>(input);
+                    ElementType* out = static_cast<ElementType*>(output);
+
+                    size_t rank = input_shape.size();
+                    size_t first_inner_axis = softmax_axes.empty() ? 0 : *softmax_axes.rbegin() + 1;
+                    size_t inner = 1;
+                    for (size_t i = first_inner_axis; i < rank; i++)
+                    {
+                        inner *= input_shape[i];
+                    }
+
+                    // Offsets of the outer coordinates and of the softmax coordinates, in
+                    // elements, enumerated in row-major order
+                    std::vector<size_t> outer_offsets{0}, reduced_offsets{0};
+                    size_t stride = inner;
+                    for (size_t i = first_inner_axis; i-- > 0;)
+                    {
+                        auto& offsets = softmax_axes.count(i) ? reduced_offsets : outer_offsets;
+                        size_t count = offsets.size();
+                        for (size_t j = 1; j < input_shape[i]; j++)
+                        {
+                            for (size_t k = 0; k < count; k++)
+                            {
+                                offsets.push_back(offsets[k] + j * stride);
+                            }
+                        }
+                        stride *= input_shape[i];
+                    }
+
+                    size_t reduced_count = reduced_offsets.size();
+                    Eigen::TensorOpCost outer_cost(2 * reduced_count * inner * sizeof(ElementType),
+                                                   reduced_count * inner * sizeof(ElementType),
+                                                   10 * reduced_count * inner);
+                    auto& device =
+                        ngraph::runtime::cpu::executor::GetCPUExecutor().get_device(arena);
+                    device.parallelFor(
+                        outer_offsets.size(),
+                        outer_cost,
+                        [&, in, out, inner, reduced_count](Eigen::Index first, Eigen::Index last) {
+                            Vector max(inner), sum(inner), next_max(inner);
+                            for (Eigen::Index i = first; i < last; i++)
+                            {
+                                const ElementType* in_base = in + outer_offsets[i];
+                                ElementType* out_base = out + outer_offsets[i];
+
+                                max = Eigen::Map<const Vector>(in_base, inner);
+                                sum.setOnes();
+                                for (size_t r = 1; r < reduced_count; r++)
+                                {
+                                    Eigen::Map<const Vector> x(in_base + reduced_offsets[r],
+                                                               inner);
+                                    next_max = max.max(x);
+                                    sum = sum * (max - next_max).exp() + (x - next_max).exp();
+                                    max = next_max;
+                                }
+
+                                sum = sum.inverse();
+                                for (size_t r = 0; r < reduced_count; r++)
+                                {
+                                    Eigen::Map<const Vector> x(in_base + reduced_offsets[r],
+                                                               inner);
+                                    Eigen::Map<Vector> y(out_base + reduced_offsets[r], inner);
+                                    y = (x - max).exp() * sum;
+                                }
+                            }
+                        });
+                }
             }
         }
     }
@@ -0,0 +1,136 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+#define EIGEN_USE_THREADS
+#include <unsupported/Eigen/CXX11/Tensor>
+
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            namespace kernel
+            {
+                /// \brief TopK along `axis`, matching reference::topk: values are ordered from
+                /// best to worst and ties go to the lower index.
+                ///
+                /// Each row keeps a heap of its k best candidates, so a row of n elements costs
+                /// O(n log k) instead of a full sort. Rows are split across the threads of
+                /// `arena`.
+                template <typename ElementType, typename IndexType>
+                void topk(const void* arg,
+                          void* out_indices,
+                          void* out_values,
+                          const Shape& in_shape,
+                          size_t axis,
+                          size_t k,
+                          bool compute_max,
+                          int arena)
+                {
+                    typedef std::pair<ElementType, IndexType> entry;
+
+                    size_t outer_count = 1;
+                    for (size_t i = 0; i < axis; i++)
+                    {
+                        outer_count *= in_shape[i];
+                    }
+                    size_t inner_count = 1;
+                    for (size_t i = axis + 1; i < in_shape.size(); i++)
+                    {
+                        inner_count *= in_shape[i];
+                    }
+                    size_t axis_length = in_shape[axis];
+
+                    auto in = static_cast<const ElementType*>(arg);
+                    auto indices = static_cast<IndexType*>(out_indices);
+                    auto values = static_cast<ElementType*>(out_values);
+
+// values are compared exactly, as in reference::topk
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wfloat-equal"
+                    // `better(a, b)` is true when a ranks ahead of b
+                    auto better = [compute_max](const entry& a, const entry& b) {
+                        if (a.first == b.first)
+                        {
+                            return a.second < b.second;
+                        }
+                        return compute_max ? a.first > b.first : a.first < b.first;
+                    };
+#pragma GCC diagnostic pop
+
+                    auto select = [&](Eigen::Index first, Eigen::Index last) {
+                        std::vector<entry> heap;
+                        heap.reserve(k);
+                        for (Eigen::Index row = first; row < last; row++)
+                        {
+                            size_t outer = row / inner_count;
+                            size_t inner = row % inner_count;
+                            const ElementType* in_row =
+                                in + outer * axis_length * inner_count + inner;
+
+                            // with `better` as the ordering, the heap front is the worst of the
+                            // candidates kept so far
+                            heap.clear();
+                            for (size_t i = 0; i < axis_length; i++)
+                            {
+                                entry candidate(in_row[i * inner_count], static_cast<IndexType>(i));
+                                if (heap.size() < k)
+                                {
+                                    heap.push_back(candidate);
+                                    std::push_heap(heap.begin(), heap.end(), better);
+                                }
+                                else if (k > 0 && better(candidate, heap.front()))
+                                {
+                                    std::pop_heap(heap.begin(), heap.end(), better);
+                                    heap.back() = candidate;
+                                    std::push_heap(heap.begin(), heap.end(), better);
+                                }
+                            }
+                            std::sort_heap(heap.begin(), heap.end(), better);
+
+                            size_t out_index = outer * k * inner_count + inner;
+                            for (const entry& e : heap)
+                            {
+                                values[out_index] = e.first;
+                                indices[out_index] = e.second;
+                                out_index += inner_count;
+                            }
+                        }
+                    };
+                    size_t out_row_bytes = k * (sizeof(ElementType) + sizeof(IndexType));
+                    ngraph::runtime::cpu::executor::GetCPUExecutor()
+                        .get_device(arena)
+                        .parallelFor(outer_count * inner_count,
+                                     Eigen::TensorOpCost(axis_length * sizeof(ElementType),
+                                                         out_row_bytes,
+                                                         axis_length),
+                                     select);
+                }
+            }
+        }
+    }
+}
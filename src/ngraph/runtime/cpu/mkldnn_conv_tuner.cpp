@@ -0,0 +1,300 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+#include <sstream>
+#include <unistd.h>
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/mkldnn_conv_tuner.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// Iterations timed per candidate after a warm up run, the fastest one counts
+static const int s_timed_runs = 5;
+
+static mkldnn::memory::desc get_any_md(const mkldnn::memory::desc& md)
+{
+    mkldnn::memory::dims dims(md.data.dims, md.data.dims + md.data.ndims);
+    return mkldnn::memory::desc(dims,
+                                static_cast<mkldnn::memory::data_type>(md.data.data_type),
+                                mkldnn::memory::format::any);
+}
+
+static void append_dims(ostringstream& ss, const char* name, const mkldnn::memory::dims& dims)
+{
+    ss << name;
+    for (size_t i = 0; i < dims.size(); i++)
+    {
+        ss << (i == 0 ? "" : "x") << dims[i];
+    }
+}
+
+static unique_ptr<mkldnn::memory> make_zeroed_memory(const mkldnn::memory::primitive_desc& pd)
+{
+    unique_ptr<mkldnn::memory> m{new mkldnn::memory(pd)};
+    memset(m->get_data_handle(), 0, pd.get_size());
+    return m;
+}
+
+// Seconds per run of the fastest timed run, or a negative value if MKLDNN has no
+// implementation of `algorithm` for this convolution
+static double time_convolution(mkldnn::algorithm algorithm,
+                               const mkldnn::memory::desc& data_desc,
+                               const mkldnn::memory::desc& weights_desc,
+                               const mkldnn::memory::desc* bias_desc,
+                               const mkldnn::memory::desc& result_desc,
+                               const mkldnn::memory::dims& strides,
+                               const mkldnn::memory::dims& dilation,
+                               const mkldnn::memory::dims& padding_below,
+                               const mkldnn::memory::dims& padding_above)
+{
+    try
+    {
+        unique_ptr<mkldnn::convolution_forward::desc> desc;
+        if (bias_desc)
+        {
+            desc.reset(new mkldnn::convolution_forward::desc(mkldnn::prop_kind::forward_inference,
+                                                             algorithm,
+                                                             get_any_md(data_desc),
+                                                             get_any_md(weights_desc),
+                                                             get_any_md(*bias_desc),
+                                                             get_any_md(result_desc),
+                                                             strides,
+                                                             dilation,
+                                                             padding_below,
+                                                             padding_above,
+                                                             mkldnn::padding_kind::zero));
+        }
+        else
+        {
+            desc.reset(new mkldnn::convolution_forward::desc(mkldnn::prop_kind::forward_inference,
+                                                             algorithm,
+                                                             get_any_md(data_desc),
+                                                             get_any_md(weights_desc),
+                                                             get_any_md(result_desc),
+                                                             strides,
+                                                             dilation,
+                                                             padding_below,
+                                                             padding_above,
+                                                             mkldnn::padding_kind::zero));
+        }
+        mkldnn::convolution_forward::primitive_desc pd(*desc,
+                                                       runtime::cpu::executor::global_cpu_engine);
+
+        auto data = make_zeroed_memory(pd.src_primitive_desc());
+        auto weights = make_zeroed_memory(pd.weights_primitive_desc());
+        auto result = make_zeroed_memory(pd.dst_primitive_desc());
+        unique_ptr<mkldnn::memory> bias;
+        unique_ptr<mkldnn::convolution_forward> convolution;
+        if (bias_desc)
+        {
+            bias = make_zeroed_memory(pd.bias_primitive_desc());
+            convolution.reset(
+                new mkldnn::convolution_forward(pd, *data, *weights, *bias, *result));
+        }
+        else
+        {
+            convolution.reset(new mkldnn::convolution_forward(pd, *data, *weights, *result));
+        }
+
+        double fastest = numeric_limits<double>::max();
+        for (int run = 0; run <= s_timed_runs; run++)
+        {
+            auto start = chrono::steady_clock::now();
+            mkldnn::stream(mkldnn::stream::kind::eager).submit({*convolution}).wait();
+            chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+            // run 0 warms up caches and JIT state
+            if (run > 0)
+            {
+                fastest = min(fastest, elapsed.count());
+            }
+        }
+        return fastest;
+    }
+    catch (const mkldnn::error&)
+    {
+        return -1;
+    }
+}
+
+// CPU model and MKLDNN version, entries are whitespace separated so this is a single token
+static string get_machine()
+{
+    string model = "unknown";
+    ifstream cpuinfo("/proc/cpuinfo");
+    string line;
+    while (getline(cpuinfo, line))
+    {
+        if (line.compare(0, 10, "model name") == 0 && line.find(':') != string::npos)
+        {
+            model = line.substr(line.find(':') + 1);
+            break;
+        }
+    }
+    model.erase(0, model.find_first_not_of(' '));
+    for (char& c : model)
+    {
+        c = isspace(static_cast<unsigned char>(c)) ? '_' : c;
+    }
+#if defined(MKLDNN_VERSION_MAJOR) && defined(MKLDNN_VERSION_MINOR) &&                             \
+    defined(MKLDNN_VERSION_PATCH)
+    auto version = mkldnn_version();
+    model += "_mkldnn" + to_string(version->major) + "." + to_string(version->minor) + "." +
+             to_string(version->patch);
+#endif
+    return model;
+}
+
+runtime::cpu::MKLDNNConvolutionTuner& runtime::cpu::MKLDNNConvolutionTuner::get()
+{
+    static const char* s_path = getenv("NGRAPH_CPU_CONV_ALGO_CACHE");
+    static MKLDNNConvolutionTuner s_tuner(getenv("NGRAPH_CPU_CONV_AUTOTUNE") != nullptr,
+                                          s_path == nullptr ? "" : s_path);
+    return s_tuner;
+}
+
+runtime::cpu::MKLDNNConvolutionTuner::MKLDNNConvolutionTuner(bool enabled, const string& path)
+    : m_enabled(enabled)
+    , m_path(path)
+{
+    if (m_enabled && !m_path.empty())
+    {
+        m_machine = get_machine();
+        read_file();
+    }
+}
+
+mkldnn::algorithm
+    runtime::cpu::MKLDNNConvolutionTuner::select(const mkldnn::memory::desc& data_desc,
+                                                 const mkldnn::memory::desc& weights_desc,
+                                                 const mkldnn::memory::desc* bias_desc,
+                                                 const mkldnn::memory::desc& result_desc,
+                                                 const mkldnn::memory::dims& strides,
+                                                 const mkldnn::memory::dims& dilation,
+                                                 const mkldnn::memory::dims& padding_below,
+                                                 const mkldnn::memory::dims& padding_above)
+{
+    auto get_dims = [](const mkldnn::memory::desc& md) {
+        return mkldnn::memory::dims(md.data.dims, md.data.dims + md.data.ndims);
+    };
+    ostringstream ss;
+    ss << m_machine << "/";
+    append_dims(ss, "d", get_dims(data_desc));
+    append_dims(ss, "_w", get_dims(weights_desc));
+    append_dims(ss, "_b", bias_desc ? get_dims(*bias_desc) : mkldnn::memory::dims{});
+    append_dims(ss, "_r", get_dims(result_desc));
+    append_dims(ss, "_s", strides);
+    append_dims(ss, "_dl", dilation);
+    append_dims(ss, "_pb", padding_below);
+    append_dims(ss, "_pa", padding_above);
+    ss << "_t" << data_desc.data.data_type;
+    string key = ss.str();
+
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it != m_entries.end())
+    {
+        return static_cast<mkldnn::algorithm>(it->second);
+    }
+
+    auto algorithm = mkldnn::algorithm::convolution_direct;
+    double direct_time = time_convolution(mkldnn::algorithm::convolution_direct,
+                                          data_desc,
+                                          weights_desc,
+                                          bias_desc,
+                                          result_desc,
+                                          strides,
+                                          dilation,
+                                          padding_below,
+                                          padding_above);
+    double winograd_time = time_convolution(mkldnn::algorithm::convolution_winograd,
+                                            data_desc,
+                                            weights_desc,
+                                            bias_desc,
+                                            result_desc,
+                                            strides,
+                                            dilation,
+                                            padding_below,
+                                            padding_above);
+    if (winograd_time >= 0 && (direct_time < 0 || winograd_time < direct_time))
+    {
+        algorithm = mkldnn::algorithm::convolution_winograd;
+    }
+    NGRAPH_DEBUG << "Convolution " << key << ": direct " << direct_time << "s, winograd "
+                 << winograd_time << "s";
+
+    m_entries[key] = static_cast<int>(algorithm);
+    if (!m_path.empty())
+    {
+        write_file();
+    }
+    return algorithm;
+}
+
+void runtime::cpu::MKLDNNConvolutionTuner::read_file()
+{
+    ifstream in(m_path);
+    string key;
+    int algorithm;
+    while (in >> key >> algorithm)
+    {
+        m_entries[key] = algorithm;
+    }
+}
+
+void runtime::cpu::MKLDNNConvolutionTuner::write_file()
+{
+    // pick up entries other processes stored since this one read the file
+    auto entries = m_entries;
+    read_file();
+    for (auto& e : entries)
+    {
+        m_entries[e.first] = e.second;
+    }
+
+    // Write to a file of this process first so that concurrent processes never read a
+    // partially written cache
+    string temporary = m_path + "." + to_string(getpid());
+    {
+        ofstream out(temporary);
+        for (auto& e : m_entries)
+        {
+            out << e.first << " " << e.second << "\n";
+        }
+        if (!out)
+        {
+            NGRAPH_DEBUG << "Unable to write convolution algorithm cache " << temporary;
+            remove(temporary.c_str());
+            return;
+        }
+    }
+    if (rename(temporary.c_str(), m_path.c_str()) != 0)
+    {
+        remove(temporary.c_str());
+    }
+}
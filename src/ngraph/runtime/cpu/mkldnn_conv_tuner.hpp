@@ -0,0 +1,77 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <mkldnn.hpp>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            /// \brief Chooses the MKLDNN forward convolution algorithm, direct or Winograd, by
+            ///        timing both on this host.
+            ///
+            /// Enabled by setting NGRAPH_CPU_CONV_AUTOTUNE. Decisions are keyed by the
+            /// convolution dims, data type, strides, dilation and padding, and are kept for the
+            /// process. When NGRAPH_CPU_CONV_ALGO_CACHE names a file they are also stored there
+            /// along with the CPU model and MKLDNN version, so later compiles on the same
+            /// machine reuse them instead of timing again.
+            class MKLDNNConvolutionTuner
+            {
+            public:
+                /// The tuner configured by NGRAPH_CPU_CONV_AUTOTUNE and
+                /// NGRAPH_CPU_CONV_ALGO_CACHE
+                static MKLDNNConvolutionTuner& get();
+                /// A tuner persisting its decisions to `path`, or only in memory if it is empty
+                MKLDNNConvolutionTuner(bool enabled, const std::string& path);
+
+                bool is_enabled() const { return m_enabled; }
+                /// \returns the faster algorithm for a convolution with the dims and data types
+                ///          of the given descriptors; their formats are ignored. `bias_desc` is
+                ///          null for convolutions without bias.
+                mkldnn::algorithm select(const mkldnn::memory::desc& data_desc,
+                                         const mkldnn::memory::desc& weights_desc,
+                                         const mkldnn::memory::desc* bias_desc,
+                                         const mkldnn::memory::desc& result_desc,
+                                         const mkldnn::memory::dims& strides,
+                                         const mkldnn::memory::dims& dilation,
+                                         const mkldnn::memory::dims& padding_below,
+                                         const mkldnn::memory::dims& padding_above);
+
+                MKLDNNConvolutionTuner(const MKLDNNConvolutionTuner&) = delete;
+                MKLDNNConvolutionTuner& operator=(const MKLDNNConvolutionTuner&) = delete;
+
+            private:
+                void read_file();
+                void write_file();
+
+                bool m_enabled;
+                std::string m_path;
+                std::string m_machine;
+                std::unordered_map<std::string, int> m_entries;
+                std::mutex m_mutex;
+            };
+        }
+    }
+}
@@ -1361,24 +1361,6 @@ void MKLDNNEmitter::build_batchnorm_forward(
     }
 }
 
-mkldnn::batch_normalization_backward::desc
-    MKLDNNEmitter::get_batchnorm_backward_desc(const ngraph::Node* node)
-{
-    const ngraph::op::BatchNormTrainingBackprop* batchnorm =
-        static_cast<const ngraph::op::BatchNormTrainingBackprop*>(node);
-    auto eps = batchnorm->get_eps_value();
-
-    auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 2);
-    auto delta_desc = mkldnn_utils::get_input_mkldnn_md(node, 5);
-
-    return mkldnn::batch_normalization_backward::desc(
-        mkldnn::prop_kind::backward,
-        delta_desc,
-        input_desc,
-        eps,
-        mkldnn::batch_normalization_flag::use_scale_shift);
-}
-
 void MKLDNNEmitter::build_batchnorm_backward(
     std::vector<mkldnn::primitive*>& mkldnn_primitives,
     const mkldnn::batch_normalization_backward::desc& batchnorm_desc,
@@ -20,6 +20,8 @@
 
 #pragma once
 
+#include <cmath>
+#include <limits>
 #include <memory>
 #include <unordered_map>
 #include <utility>
@@ -45,8 +47,11 @@
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_tensor_view_wrapper.hpp"
+#include "ngraph/runtime/cpu/mkldnn_conv_tuner.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
 #include "ngraph/runtime/cpu/op/conv_add.hpp"
@@ -109,16 +114,35 @@ namespace ngraph
                 return static_cast<const OP*>(node)->with_relu();
             }
 
+            // Upper bound of the relu fused into OP, infinity unless it is a bounded relu
+            template <typename OP>
+            float get_relu_upper_bound(const ngraph::Node* node)
+            {
+                if (std::is_same<OP, ngraph::op::GroupConvolutionBias>::value)
+                {
+                    return static_cast<const ngraph::op::GroupConvolutionBias*>(node)
+                        ->get_relu_upper_bound();
+                }
+                return std::numeric_limits<float>::infinity();
+            }
+
             class MKLDNNWorkspace
             {
             public:
-                MKLDNNWorkspace(size_t size) { buf = reinterpret_cast<char*>(ngraph_malloc(size)); }
-                ~MKLDNNWorkspace() { ngraph_free(buf); }
+                // Backed by an AlignedBuffer so that large workspaces follow the huge page policy
+                MKLDNNWorkspace(size_t size)
+                    : m_buffer(size, 64)
+                {
+                    buf = static_cast<char*>(m_buffer.get_ptr());
+                }
                 char* buf;
 
                 MKLDNNWorkspace(const MKLDNNWorkspace&) = delete;
                 MKLDNNWorkspace(MKLDNNWorkspace&&) = delete;
                 MKLDNNWorkspace& operator=(const MKLDNNWorkspace&) = delete;
+
+            private:
+                runtime::AlignedBuffer m_buffer;
             };
 
             class MKLDNNEmitter
@@ -719,8 +743,25 @@ namespace ngraph
                     size_t batchnorm_index,
                     const mkldnn::post_ops& pops = mkldnn::post_ops());
 
+                // delta is the last input of OP
+                template <typename OP>
                 mkldnn::batch_normalization_backward::desc
-                    get_batchnorm_backward_desc(const ngraph::Node* node);
+                    get_batchnorm_backward_desc(const ngraph::Node* node)
+                {
+                    const OP* batchnorm = static_cast<const OP*>(node);
+                    auto eps = batchnorm->get_eps_value();
+
+                    auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 2);
+                    auto delta_desc =
+                        mkldnn_utils::get_input_mkldnn_md(node, node->get_input_size() - 1);
+
+                    return mkldnn::batch_normalization_backward::desc(
+                        mkldnn::prop_kind::backward,
+                        delta_desc,
+                        input_desc,
+                        eps,
+                        mkldnn::batch_normalization_flag::use_scale_shift);
+                }
 
                 void build_batchnorm_backward(
                     std::vector<mkldnn::primitive*>& mkldnn_primitives,
@@ -1056,6 +1097,26 @@ namespace ngraph
                         weights_desc.data.format = mkldnn_oidhw;
                     auto result_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
 
+                    auto& tuner = MKLDNNConvolutionTuner::get();
+                    if (node->get_input_element_type(0) == element::f32 && tuner.is_enabled())
+                    {
+                        std::unique_ptr<mkldnn::memory::desc> bias_desc;
+                        if (has_bias<OP>())
+                        {
+                            bias_desc.reset(new mkldnn::memory::desc(
+                                mkldnn_utils::get_input_mkldnn_md(node, 2)));
+                        }
+                        convolution_algo =
+                            tuner.select(data_desc,
+                                         weights_desc,
+                                         bias_desc.get(),
+                                         result_desc,
+                                         MKLDNN_DIMS(convolution->get_window_movement_strides()),
+                                         MKLDNN_DIMS(window_dilation_strides_adjusted),
+                                         MKLDNN_DIMS(convolution->get_padding_below()),
+                                         MKLDNN_DIMS(convolution->get_padding_above()));
+                    }
+
                     if (has_bias<OP>())
                     {
                         auto bias_desc = mkldnn_utils::get_input_mkldnn_md(node, 2);
@@ -1107,7 +1168,17 @@ namespace ngraph
                         ops.append_sum(sum_scale_val[0]);
                     }
 
-                    if (has_relu<OP>(node))
+                    if (has_relu<OP>(node) && std::isfinite(get_relu_upper_bound<OP>(node)))
+                    {
+                        const float ops_scale = 1.f;
+                        const float ops_alpha = get_relu_upper_bound<OP>(node); // upper bound
+                        const float ops_beta = 0.f;
+                        ops.append_eltwise(ops_scale,
+                                           mkldnn::algorithm::eltwise_bounded_relu,
+                                           ops_alpha,
+                                           ops_beta);
+                    }
+                    else if (has_relu<OP>(node))
                     {
                         const float ops_scale = 1.f;
                         const float ops_alpha = -0.f; // relu negative slope
@@ -1158,10 +1229,12 @@ namespace ngraph
                     mkldnn_primitives[results_idx] =
                         new mkldnn::memory({{desc.data.dst_desc}, engine}, nullptr);
 
+                    auto pd = MKLDNNPrimitiveCache::get().get_primitive_desc<
+                        mkldnn::convolution_forward::primitive_desc>(desc, attr, engine);
                     mkldnn::primitive* prim;
                     if (with_bias)
                     {
-                        prim = new mkldnn::convolution_forward({desc, attr, engine},
+                        prim = new mkldnn::convolution_forward(*pd,
                                                                *mkldnn_primitives[input_idx],
                                                                *mkldnn_primitives[weights_idx],
                                                                *mkldnn_primitives[bias_idx],
@@ -1169,7 +1242,7 @@ namespace ngraph
                     }
                     else
                     {
-                        prim = new mkldnn::convolution_forward({desc, attr, engine},
+                        prim = new mkldnn::convolution_forward(*pd,
                                                                *mkldnn_primitives[input_idx],
                                                                *mkldnn_primitives[weights_idx],
                                                                *mkldnn_primitives[results_idx]);
@@ -1260,10 +1333,12 @@ namespace ngraph
                     mkldnn_primitives[results_idx] =
                         new mkldnn::memory({{desc.data.dst_desc}, engine}, nullptr);
 
+                    auto pd = MKLDNNPrimitiveCache::get().get_primitive_desc<
+                        mkldnn::inner_product_forward::primitive_desc>(desc, attr, engine);
                     mkldnn::primitive* prim;
                     if (with_bias)
                     {
-                        prim = new mkldnn::inner_product_forward({desc, attr, engine},
+                        prim = new mkldnn::inner_product_forward(*pd,
                                                                  *mkldnn_primitives[input_idx],
                                                                  *mkldnn_primitives[weights_idx],
                                                                  *mkldnn_primitives[bias_idx],
@@ -1271,7 +1346,7 @@ namespace ngraph
                     }
                     else
                     {
-                        prim = new mkldnn::inner_product_forward({desc, attr, engine},
+                        prim = new mkldnn::inner_product_forward(*pd,
                                                                  *mkldnn_primitives[input_idx],
                                                                  *mkldnn_primitives[weights_idx],
                                                                  *mkldnn_primitives[results_idx]);
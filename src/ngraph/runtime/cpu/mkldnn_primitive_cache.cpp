@@ -0,0 +1,167 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cstdlib>
+#include <vector>
+
+#include "ngraph/metrics.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
+
+using namespace ngraph;
+
+namespace
+{
+    template <typename T>
+    void append_bytes(std::string& key, const T& value)
+    {
+        key.append(reinterpret_cast<const char*>(&value), sizeof(value));
+    }
+
+    size_t get_default_capacity()
+    {
+        const char* env_capacity = std::getenv("NGRAPH_MKLDNN_PRIMITIVE_CACHE_CAPACITY");
+        return env_capacity ? std::strtoul(env_capacity, nullptr, 10) : 1024;
+    }
+}
+
+runtime::cpu::MKLDNNPrimitiveCache& runtime::cpu::MKLDNNPrimitiveCache::get()
+{
+    static MKLDNNPrimitiveCache cache;
+    return cache;
+}
+
+runtime::cpu::MKLDNNPrimitiveCache::MKLDNNPrimitiveCache()
+{
+    m_stats.capacity = get_default_capacity();
+}
+
+std::string runtime::cpu::MKLDNNPrimitiveCache::make_key(const std::type_info& type,
+                                                         const void* desc,
+                                                         size_t desc_size,
+                                                         const mkldnn::primitive_attr& attr,
+                                                         const mkldnn::engine& engine)
+{
+    std::string key = type.name();
+    key.push_back('\0');
+    key.append(static_cast<const char*>(desc), desc_size);
+    append_bytes(key, engine.get());
+
+    append_bytes(key, attr.get_int_output_round_mode());
+    int mask;
+    std::vector<float> scales;
+    attr.get_output_scales(mask, scales);
+    append_bytes(key, mask);
+    append_bytes(key, scales.size());
+    key.append(reinterpret_cast<const char*>(scales.data()), scales.size() * sizeof(float));
+
+    const mkldnn::post_ops ops = attr.get_post_ops();
+    append_bytes(key, ops.len());
+    for (int i = 0; i < ops.len(); i++)
+    {
+        auto kind = ops.kind(i);
+        append_bytes(key, kind);
+        if (kind == mkldnn::primitive::kind::sum)
+        {
+            float scale;
+            ops.get_params_sum(i, scale);
+            append_bytes(key, scale);
+        }
+        else if (kind == mkldnn::primitive::kind::eltwise)
+        {
+            float scale, alpha, beta;
+            mkldnn::algorithm alg;
+            ops.get_params_eltwise(i, scale, alg, alpha, beta);
+            append_bytes(key, scale);
+            append_bytes(key, alg);
+            append_bytes(key, alpha);
+            append_bytes(key, beta);
+        }
+    }
+    return key;
+}
+
+std::shared_ptr<const void> runtime::cpu::MKLDNNPrimitiveCache::lookup(const std::string& key)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_index.find(key);
+    if (it == m_index.end())
+    {
+        m_stats.misses++;
+        Metrics::count_cache_lookup("mkldnn_primitive", false);
+        return nullptr;
+    }
+    m_stats.hits++;
+    Metrics::count_cache_lookup("mkldnn_primitive", true);
+    m_lru.splice(m_lru.begin(), m_lru, it->second);
+    return it->second->second;
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::insert(const std::string& key,
+                                                const std::shared_ptr<const void>& desc)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Another thread may have created the same descriptor since our lookup missed
+    if (m_stats.capacity == 0 || m_index.find(key) != m_index.end())
+    {
+        return;
+    }
+    m_lru.emplace_front(key, desc);
+    m_index[key] = m_lru.begin();
+    evict_to_capacity();
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::evict_to_capacity()
+{
+    while (m_lru.size() > m_stats.capacity)
+    {
+        m_index.erase(m_lru.back().first);
+        m_lru.pop_back();
+        m_stats.evictions++;
+    }
+    m_stats.entries = m_lru.size();
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::set_capacity(size_t capacity)
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.capacity = capacity;
+    evict_to_capacity();
+}
+
+void runtime::cpu::MKLDNNPrimitiveCache::clear()
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_lru.clear();
+    m_index.clear();
+    size_t capacity = m_stats.capacity;
+    m_stats = Stats();
+    m_stats.capacity = capacity;
+}
+
+runtime::cpu::MKLDNNPrimitiveCache::Stats runtime::cpu::MKLDNNPrimitiveCache::get_stats() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+std::ostream& runtime::cpu::operator<<(std::ostream& out,
+                                       const MKLDNNPrimitiveCache::Stats& stats)
+{
+    return out << stats.hits << " hits, " << stats.misses << " misses ("
+               << static_cast<int>(stats.hit_rate() * 100) << "% hit rate), " << stats.evictions
+               << " evictions, " << stats.entries << "/" << stats.capacity << " entries";
+}
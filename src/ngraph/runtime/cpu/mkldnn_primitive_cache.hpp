@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <typeinfo>
+#include <unordered_map>
+#include <utility>
+
+#include <mkldnn.hpp>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace cpu
+        {
+            // Process-wide cache of MKL-DNN primitive descriptors.
+            //
+            // Creating a convolution or inner product primitive descriptor runs MKL-DNN's
+            // implementation selection, which is repeated for every identical node each time a
+            // model is compiled again (a second instance, a new batch size that keeps some
+            // layer shapes). Entries are keyed by the operation descriptor, which carries the
+            // op kind and all memory descriptors, together with the attributes (post-ops,
+            // output scales, rounding mode) and the engine.
+            //
+            // Descriptors are immutable and shared by reference count, so evicting an entry
+            // once the cache is over capacity never invalidates a descriptor still in use.
+            // Primitives themselves are not cached: an MKL-DNN primitive is bound to its
+            // memory primitives, whose data handles are rebound on every call of every
+            // runtime context.
+            //
+            // The capacity is read from NGRAPH_MKLDNN_PRIMITIVE_CACHE_CAPACITY (default 1024
+            // entries); 0 disables caching.
+            class MKLDNNPrimitiveCache
+            {
+            public:
+                struct Stats
+                {
+                    size_t hits = 0;
+                    size_t misses = 0;
+                    size_t evictions = 0;
+                    size_t entries = 0;
+                    size_t capacity = 0;
+
+                    double hit_rate() const
+                    {
+                        size_t lookups = hits + misses;
+                        return lookups == 0 ? 0.0 : static_cast<double>(hits) / lookups;
+                    }
+                };
+
+                static MKLDNNPrimitiveCache& get();
+
+                // Returns the descriptor of primitive type PD for `desc`, creating it on a
+                // miss. Throws whatever MKL-DNN throws when no implementation exists.
+                template <typename PD, typename DESC>
+                std::shared_ptr<const PD> get_primitive_desc(const DESC& desc,
+                                                             const mkldnn::primitive_attr& attr,
+                                                             const mkldnn::engine& engine)
+                {
+                    const std::string key =
+                        make_key(typeid(PD), &desc.data, sizeof(desc.data), attr, engine);
+                    if (auto cached = lookup(key))
+                    {
+                        return std::static_pointer_cast<const PD>(cached);
+                    }
+                    auto created = std::make_shared<const PD>(desc, attr, engine);
+                    insert(key, created);
+                    return created;
+                }
+
+                void set_capacity(size_t capacity);
+                void clear();
+                Stats get_stats() const;
+
+            private:
+                MKLDNNPrimitiveCache();
+
+                static std::string make_key(const std::type_info& type,
+                                            const void* desc,
+                                            size_t desc_size,
+                                            const mkldnn::primitive_attr& attr,
+                                            const mkldnn::engine& engine);
+                std::shared_ptr<const void> lookup(const std::string& key);
+                void insert(const std::string& key, const std::shared_ptr<const void>& desc);
+                void evict_to_capacity();
+
+                using Entry = std::pair<std::string, std::shared_ptr<const void>>;
+
+                mutable std::mutex m_mutex;
+                // Most recently used first
+                std::list<Entry> m_lru;
+                std::unordered_map<std::string, std::list<Entry>::iterator> m_index;
+                Stats m_stats;
+            };
+
+            std::ostream& operator<<(std::ostream& out, const MKLDNNPrimitiveCache::Stats& stats);
+        }
+    }
+}
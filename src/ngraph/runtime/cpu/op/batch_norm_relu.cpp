@@ -76,6 +76,59 @@ ngraph::op::BatchNormTrainingRelu::BatchNormTrainingRelu(double eps,
     set_output_type(2, input->get_element_type(), channel_shape);
 }
 
+ngraph::op::BatchNormTrainingReluBackprop::BatchNormTrainingReluBackprop(
+    double eps,
+    std::shared_ptr<ngraph::Node> gamma,
+    std::shared_ptr<ngraph::Node> beta,
+    std::shared_ptr<ngraph::Node> input,
+    std::shared_ptr<ngraph::Node> mean,
+    std::shared_ptr<ngraph::Node> variance,
+    std::shared_ptr<ngraph::Node> output,
+    std::shared_ptr<ngraph::Node> delta)
+    : Op("BatchNormTrainingReluBackprop",
+         check_single_output_args({gamma, beta, input, mean, variance, output, delta}))
+    , m_epsilon(eps)
+{
+    constructor_validate_and_infer_types();
+
+    auto bn_input_shape = get_input_shape(INPUT);
+
+    if (bn_input_shape.size() != 4 && bn_input_shape.size() != 5)
+    {
+        throw ngraph_error("input tensor to batchnorm must have rank 4/rank5");
+    }
+
+    auto channel_shape = Shape{bn_input_shape.at(1)};
+
+    for (size_t i : {MEAN, VARIANCE, GAMMA, BETA})
+    {
+        if (get_input_shape(i) != channel_shape)
+        {
+            throw ngraph_error("gamma, beta, mean and variance must have the channel shape");
+        }
+    }
+
+    if (get_input_shape(OUTPUT) != bn_input_shape || get_input_shape(DELTA) != bn_input_shape)
+    {
+        throw ngraph_error("output and delta must have the shape of the input");
+    }
+
+    auto et = input->get_element_type();
+    for (size_t i = 0; i < get_input_size(); i++)
+    {
+        if (get_input_element_type(i) != et)
+        {
+            throw ngraph_error("All inputs to BatchNormTrainingReluBackprop must have the input's "
+                               "element type");
+        }
+    }
+
+    set_output_size(3);
+    set_output_type(0, et, bn_input_shape);
+    set_output_type(1, et, channel_shape);
+    set_output_type(2, et, channel_shape);
+}
+
 ngraph::op::BatchNormInferenceRelu::BatchNormInferenceRelu(double eps,
                                                            std::shared_ptr<ngraph::Node> gamma,
                                                            std::shared_ptr<ngraph::Node> beta,
@@ -144,6 +197,23 @@ std::shared_ptr<ngraph::Node>
     }
 }
 
+std::shared_ptr<ngraph::Node>
+    ngraph::op::BatchNormTrainingReluBackprop::copy_with_new_args(const NodeVector& new_args) const
+{
+    if (new_args.size() != 7)
+    {
+        throw ngraph_error("Incorrect number of new arguments");
+    }
+    return std::make_shared<BatchNormTrainingReluBackprop>(m_epsilon,
+                                                           new_args.at(0),
+                                                           new_args.at(1),
+                                                           new_args.at(2),
+                                                           new_args.at(3),
+                                                           new_args.at(4),
+                                                           new_args.at(5),
+                                                           new_args.at(6));
+}
+
 std::shared_ptr<ngraph::Node>
     ngraph::op::BatchNormInferenceRelu::copy_with_new_args(const NodeVector& new_args) const
 {
@@ -54,6 +54,41 @@ namespace ngraph
             double m_epsilon;
         };
 
+        /// \brief Backprop of BatchNormTrainingRelu. Takes the forward output to mask delta
+        ///        with the relu derivative before the batch norm backprop, and has the outputs
+        ///        of BatchNormTrainingBackprop: the input, gamma and beta deltas.
+        class BatchNormTrainingReluBackprop : public Op
+        {
+        public:
+            CPU_BACKEND_API BatchNormTrainingReluBackprop(double eps,
+                                                          std::shared_ptr<Node> gamma,
+                                                          std::shared_ptr<Node> beta,
+                                                          std::shared_ptr<Node> input,
+                                                          std::shared_ptr<Node> mean,
+                                                          std::shared_ptr<Node> variance,
+                                                          std::shared_ptr<Node> output,
+                                                          std::shared_ptr<Node> delta);
+
+            double get_eps_value() const { return m_epsilon; }
+            virtual std::shared_ptr<Node>
+                copy_with_new_args(const NodeVector& new_args) const override;
+
+        protected:
+            enum
+            {
+                GAMMA,
+                BETA,
+                INPUT,
+                MEAN,
+                VARIANCE,
+                OUTPUT,
+                DELTA
+            };
+
+        private:
+            double m_epsilon;
+        };
+
         class BatchNormInferenceRelu : public Op
         {
         public:
@@ -100,7 +100,8 @@ op::GroupConvolutionBias::GroupConvolutionBias(const shared_ptr<op::GroupConvolu
                                                size_t groups,
                                                const Shape& output_shape,
                                                bool with_relu,
-                                               float alpha)
+                                               float alpha,
+                                               float relu_upper_bound)
     : Op("GroupConvolutionBias",
          check_single_output_args({conv->get_argument(0), conv->get_argument(1), bias}))
     , m_window_movement_strides(conv->get_window_movement_strides())
@@ -111,6 +112,7 @@ op::GroupConvolutionBias::GroupConvolutionBias(const shared_ptr<op::GroupConvolu
     , m_with_relu(with_relu)
     , m_groups(groups)
     , m_alpha(alpha)
+    , m_relu_upper_bound(relu_upper_bound)
 {
     constructor_validate_and_infer_types();
 
@@ -139,7 +141,8 @@ op::GroupConvolutionBias::GroupConvolutionBias(const shared_ptr<Node>& data_batc
                                                size_t groups,
                                                const Shape& output_shape,
                                                bool with_relu,
-                                               float alpha)
+                                               float alpha,
+                                               float relu_upper_bound)
     : Op("GroupConvolutionBias", check_single_output_args({data_batch, filters, bias}))
     , m_window_movement_strides(window_movement_strides)
     , m_window_dilation_strides(window_dilation_strides)
@@ -149,6 +152,7 @@ op::GroupConvolutionBias::GroupConvolutionBias(const shared_ptr<Node>& data_batc
     , m_with_relu(with_relu)
     , m_groups(groups)
     , m_alpha(alpha)
+    , m_relu_upper_bound(relu_upper_bound)
 {
     constructor_validate_and_infer_types();
 
@@ -189,7 +193,8 @@ shared_ptr<Node> op::GroupConvolutionBias::copy_with_new_args(const NodeVector&
                                                      get_groups(),
                                                      get_output_shape(0),
                                                      m_with_relu,
-                                                     get_alpha()));
+                                                     get_alpha(),
+                                                     get_relu_upper_bound()));
 }
 
 void op::GroupConvolutionBias::generate_adjoints(autodiff::Adjoints& adjoints,
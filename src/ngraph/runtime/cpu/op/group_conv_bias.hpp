@@ -15,6 +15,9 @@
 //*****************************************************************************
 
 #pragma once
+
+#include <limits>
+
 #include "ngraph/op/fused/group_conv.hpp"
 #include "ngraph/op/op.hpp"
 
@@ -24,6 +27,9 @@ namespace ngraph
     {
         /// \brief GroupConvolution + Bias + Relu forward prop for
         ///  batched GroupConvolution operation.
+        ///
+        /// A finite relu_upper_bound clips the fused relu to [0, relu_upper_bound], which
+        /// folds the ReLU6 following depthwise convolutions into the convolution kernel.
         class GroupConvolutionBias : public Op
         {
         public:
@@ -32,7 +38,8 @@ namespace ngraph
                                  const size_t groups,
                                  const Shape& output_shape,
                                  bool with_relu,
-                                 float alpha = 1.0);
+                                 float alpha = 1.0,
+                                 float relu_upper_bound = std::numeric_limits<float>::infinity());
 
             GroupConvolutionBias(const std::shared_ptr<Node>& data_batch,
                                  const std::shared_ptr<Node>& filters,
@@ -45,7 +52,8 @@ namespace ngraph
                                  size_t groups,
                                  const Shape& output_shape,
                                  bool with_relu,
-                                 float alpha = 1.0);
+                                 float alpha = 1.0,
+                                 float relu_upper_bound = std::numeric_limits<float>::infinity());
 
             Shape get_weights_dimensions();
             const Strides& get_window_movement_strides() const { return m_window_movement_strides; }
@@ -59,6 +67,7 @@ namespace ngraph
             size_t get_groups() const { return m_groups; }
             bool with_relu() const { return m_with_relu; }
             float get_alpha() const { return m_alpha; }
+            float get_relu_upper_bound() const { return m_relu_upper_bound; }
             virtual std::shared_ptr<Node>
                 copy_with_new_args(const NodeVector& new_args) const override;
 
@@ -73,6 +82,7 @@ namespace ngraph
             bool m_with_relu;
             size_t m_groups = 1;
             float m_alpha = 1.0;
+            float m_relu_upper_bound;
         };
     }
 }
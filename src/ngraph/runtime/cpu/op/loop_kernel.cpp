@@ -14,8 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <typeindex>
+#include <typeinfo>
+
 #include "ngraph/runtime/cpu/op/loop_kernel.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/pass/loop_kernel_collector.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -65,18 +69,67 @@ ngraph::runtime::cpu::op::LoopKernel::LoopKernel(const NodeVector& node_list,
     : Op("LoopKernel", check_single_output_args({args}))
     , m_node_list(node_list)
     , m_output_nodes(outputs)
+    , m_reduction_size(1)
 {
     constructor_validate_and_infer_types();
     set_output_size(m_output_nodes.size());
 
-    auto ref = node_list.at(0);
+    shared_ptr<Node> ref;
     for (auto n : node_list)
     {
+        if (is_trailing_reduction(*n))
+        {
+            continue;
+        }
+        if (!ref)
+        {
+            ref = n;
+        }
         if (n->get_shape() != ref->get_shape() || n->get_element_type() != ref->get_element_type())
         {
             throw ngraph_error("types and shapes of the nodes in node_list are different");
         }
     }
+    if (!ref)
+    {
+        throw ngraph_error("LoopKernel needs at least one elementwise node");
+    }
+
+    bool has_reduction = false;
+    for (auto n : node_list)
+    {
+        if (!is_trailing_reduction(*n))
+        {
+            continue;
+        }
+        auto arg = n->get_argument(0);
+        if (std::find(node_list.begin(), node_list.end(), arg) == node_list.end() ||
+            arg->get_shape() != ref->get_shape() ||
+            n->get_element_type() != ref->get_element_type())
+        {
+            throw ngraph_error(n->get_name() + " doesn't reduce a node of the LoopKernel");
+        }
+        if (std::find(outputs.begin(), outputs.end(), n) == outputs.end())
+        {
+            throw ngraph_error(n->get_name() + " must be an output of the LoopKernel");
+        }
+        for (auto m : node_list)
+        {
+            auto m_args = m->get_arguments();
+            if (std::find(m_args.begin(), m_args.end(), n) != m_args.end())
+            {
+                throw ngraph_error(n->get_name() + " can't feed other nodes of the LoopKernel");
+            }
+        }
+
+        size_t reduction_size = shape_size(ref->get_shape()) / shape_size(n->get_shape());
+        if (has_reduction && reduction_size != m_reduction_size)
+        {
+            throw ngraph_error("reductions in a LoopKernel must produce the same shape");
+        }
+        m_reduction_size = reduction_size;
+        has_reduction = true;
+    }
 
     for (size_t i = 0; i < outputs.size(); ++i)
     {
@@ -89,3 +142,8 @@ ngraph::runtime::cpu::op::LoopKernel::LoopKernel(const NodeVector& node_list,
         set_output_type(i, o->get_element_type(), o->get_shape());
     }
 }
+
+bool ngraph::runtime::cpu::op::LoopKernel::is_trailing_reduction(const Node& node)
+{
+    return ngraph::pass::LoopKernelCollector::is_trailing_reduction(node);
+}
@@ -29,6 +29,11 @@ namespace ngraph
             {
                 /// \brief LoopKernel represents graphs consisting
                 /// of arithmetic operations that can be executed in the same loop
+                ///
+                /// The graph may end in trailing reductions (Sum or Max over the innermost
+                /// axes of the elementwise shape), which fold the values computed by the loop
+                /// as it goes. Reductions must be kernel outputs, may not feed other nodes
+                /// of the kernel and must all produce the same shape.
                 class LoopKernel : public ngraph::op::Op
                 {
                 public:
@@ -40,9 +45,17 @@ namespace ngraph
 
                     const NodeVector& get_node_list() const { return m_node_list; }
                     const NodeVector& get_kernel_outputs() const { return m_output_nodes; }
+                    /// \return The number of elements folded into each reduction output; 1 if
+                    ///         the kernel has no reductions.
+                    size_t get_reduction_size() const { return m_reduction_size; }
+                    /// \return true if `node` is a Sum or Max over the innermost axes of its
+                    ///         argument, which a LoopKernel can compute while it loops.
+                    static bool is_trailing_reduction(const Node& node);
+
                 private:
                     NodeVector m_node_list;
                     NodeVector m_output_nodes;
+                    size_t m_reduction_size;
                 };
             }
         }
@@ -40,14 +40,17 @@
 #include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/experimental/quantized_dot_bias.hpp"
 #include "ngraph/op/experimental/quantized_max_pool.hpp"
+#include "ngraph/op/fused/adam_update.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/sgd_momentum_update.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/replace_slice.hpp"
+#include "ngraph/op/send.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
@@ -599,6 +602,15 @@ namespace ngraph
                     }
                 }
 
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::BatchNormTrainingReluBackprop)
+                {
+                    if (mkldnn_utils::can_use_mkldnn_batchnorm_bprop(node))
+                    {
+                        runtime::cpu::mkldnn_utils::assign_mkldnn_kernel(node);
+                    }
+                }
+
                 template <>
                 void CPUAssignment::ASSIGN_DECL(ngraph::op::Lstm)
                 {
@@ -901,6 +913,50 @@ namespace ngraph
                         convert->set_op_annotations(op_annotations);
                     }
                 }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::Send)
+                {
+                    // the output is the argument, it shares its buffer instead of a copy
+                    auto send = static_cast<ngraph::op::Send*>(node);
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    op_annotations->add_in_place_oi_pair({0, 0, false});
+                    send->set_op_annotations(op_annotations);
+                }
+
+                // Output k of the optimizer updates replaces input first + k for the parameters
+                // and input first + n + k for the optimizer state, so the kernel writes over
+                // them
+                static void assign_optimizer_update(ngraph::op::Op* update,
+                                                    size_t first,
+                                                    size_t group_size)
+                {
+                    auto op_annotations =
+                        std::make_shared<ngraph::runtime::cpu::CPUOpAnnotations>();
+                    for (size_t k = 0; k < update->get_output_size(); k++)
+                    {
+                        size_t input = k < group_size ? first + k : first + group_size + k;
+                        op_annotations->add_in_place_oi_pair({k, input, true});
+                    }
+                    update->set_op_annotations(op_annotations);
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::SgdMomentumUpdate)
+                {
+                    auto update = static_cast<ngraph::op::SgdMomentumUpdate*>(node);
+                    assign_optimizer_update(
+                        update, update->get_first_group_input(), update->get_group_size());
+                }
+
+                template <>
+                void CPUAssignment::ASSIGN_DECL(ngraph::op::AdamUpdate)
+                {
+                    auto update = static_cast<ngraph::op::AdamUpdate*>(node);
+                    assign_optimizer_update(
+                        update, update->get_first_group_input(), update->get_group_size());
+                }
             }
         }
     }
@@ -912,6 +968,7 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
     {TI(ngraph::op::Add), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Add>},
     {TI(ngraph::op::Concat), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Concat>},
     {TI(ngraph::op::Convert), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Convert>},
+    {TI(ngraph::op::Send), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Send>},
     {TI(ngraph::op::AvgPool), &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AvgPool>},
     {TI(ngraph::op::AvgPoolBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AvgPoolBackprop>},
@@ -923,6 +980,8 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::BoundedRelu>},
     {TI(ngraph::op::BatchNormTrainingBackprop),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::BatchNormTrainingBackprop>},
+    {TI(ngraph::op::BatchNormTrainingReluBackprop),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::BatchNormTrainingReluBackprop>},
     {TI(ngraph::op::Convolution),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::Convolution>},
     {TI(ngraph::op::GroupConvolution),
@@ -995,6 +1054,10 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::QuantizedDotBias>},
     {TI(ngraph::op::GetOutputElement),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::GetOutputElement>},
+    {TI(ngraph::op::SgdMomentumUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::SgdMomentumUpdate>},
+    {TI(ngraph::op::AdamUpdate),
+     &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::AdamUpdate>},
     {TI(ngraph::op::DeconvolutionBias),
      &runtime::cpu::pass::CPUAssignment::assign<ngraph::op::DeconvolutionBias>},
 };
@@ -1002,8 +1065,19 @@ static const runtime::cpu::pass::AssignOpMap s_dispatcher{
 bool runtime::cpu::pass::CPUAssignment::run_on_call_graph(
     const std::list<std::shared_ptr<Node>>& nodes)
 {
+    // MKL-DNN primitives are built for the shapes of the function, so the nodes on the batch of
+    // a batch polymorphic function keep their native kernels
+    bool batch_polymorphic = m_external_function->is_batch_polymorphic();
+    if (batch_polymorphic)
+    {
+        m_external_function->find_batched_nodes(nodes);
+    }
     for (const auto& node : nodes)
     {
+        if (batch_polymorphic && m_external_function->is_batched(node.get()))
+        {
+            continue;
+        }
         auto& n = *node;
         auto handler = s_dispatcher.find(TI(n));
         if (handler != s_dispatcher.end())
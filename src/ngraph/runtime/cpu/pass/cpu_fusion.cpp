@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <numeric>
 #include <string>
@@ -36,6 +37,7 @@
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
+#include "ngraph/op/experimental/batch_mat_mul.hpp"
 #include "ngraph/op/experimental/quantized_avg_pool.hpp"
 #include "ngraph/op/experimental/quantized_concat.hpp"
 #include "ngraph/op/experimental/quantized_conv.hpp"
@@ -44,6 +46,7 @@
 #include "ngraph/op/experimental/quantized_max_pool.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/maximum.hpp"
@@ -58,6 +61,7 @@
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sqrt.hpp"
 #include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
@@ -865,6 +869,84 @@ void ngraph::runtime::cpu::pass::CPUFusion::construct_batch_norm_relu()
     this->add_matcher(m, callback);
 }
 
+void ngraph::runtime::cpu::pass::CPUFusion::construct_batch_norm_relu_backprop()
+{
+    // Autodiff of relu(batch_norm(x)) gives batch_norm_bprop(relu_bprop(relu_output, delta)),
+    // where relu_output is the output of the fused BatchNormTrainingRelu
+    auto input_shape = Shape{1, 2, 2, 2};
+    auto channel_shape = Shape{2};
+    auto input = std::make_shared<pattern::op::Label>(element::f32, input_shape);
+    auto gamma = std::make_shared<pattern::op::Label>(element::f32, channel_shape);
+    auto beta = std::make_shared<pattern::op::Label>(element::f32, channel_shape);
+    auto mean = std::make_shared<pattern::op::Label>(element::f32, channel_shape);
+    auto var = std::make_shared<pattern::op::Label>(element::f32, channel_shape);
+    auto output = std::make_shared<pattern::op::Label>(
+        element::f32, input_shape, [](std::shared_ptr<Node> node) {
+            auto goe = std::dynamic_pointer_cast<ngraph::op::GetOutputElement>(node);
+            return goe && goe->get_n() == 0 &&
+                   std::dynamic_pointer_cast<ngraph::op::BatchNormTrainingRelu>(
+                       goe->get_argument(0));
+        });
+    auto delta = std::make_shared<pattern::op::Label>(element::f32, input_shape);
+    auto relu_bprop = std::make_shared<ngraph::op::ReluBackprop>(output, delta);
+    double eps = 0.001;
+    auto bn_bprop = std::make_shared<ngraph::op::BatchNormTrainingBackprop>(
+        eps, gamma, beta, input, mean, var, relu_bprop);
+
+    auto callback = [input, gamma, beta, mean, var, output, delta](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for construct_batch_norm_relu_backprop against node = "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+        auto m_bn_bprop =
+            std::static_pointer_cast<ngraph::op::BatchNormTrainingBackprop>(m.get_match_root());
+        auto bn_relu = std::static_pointer_cast<ngraph::op::BatchNormTrainingRelu>(
+            pattern_map[output]->get_argument(0));
+
+        // The backprop must belong to the forward op whose output masks delta
+        auto is_output_of_bn_relu = [&bn_relu](std::shared_ptr<Node> node, size_t n) {
+            auto goe = std::dynamic_pointer_cast<ngraph::op::GetOutputElement>(node);
+            return goe && goe->get_n() == n && goe->get_argument(0) == bn_relu;
+        };
+        if (bn_relu->get_argument(0) != pattern_map[gamma] ||
+            bn_relu->get_argument(1) != pattern_map[beta] ||
+            bn_relu->get_argument(2) != pattern_map[input] ||
+            !is_output_of_bn_relu(pattern_map[mean], 1) ||
+            !is_output_of_bn_relu(pattern_map[var], 2) ||
+            bn_relu->get_eps_value() != m_bn_bprop->get_eps_value())
+        {
+            NGRAPH_DEBUG << "BatchNorm backprop doesn't belong to the BatchNormRelu";
+            return false;
+        }
+
+        if (m_bn_bprop->get_argument(5)->get_users().size() > 1)
+        {
+            NGRAPH_DEBUG << "BatchNorm backprop isn't the only user of ReluBackprop's output";
+            return false;
+        }
+
+        if (!mkldnn_utils::can_use_mkldnn_batchnorm_bprop(m_bn_bprop.get()))
+        {
+            return false;
+        }
+
+        auto bn_relu_bprop =
+            std::make_shared<ngraph::op::BatchNormTrainingReluBackprop>(m_bn_bprop->get_eps_value(),
+                                                                        pattern_map[gamma],
+                                                                        pattern_map[beta],
+                                                                        pattern_map[input],
+                                                                        pattern_map[mean],
+                                                                        pattern_map[var],
+                                                                        pattern_map[output],
+                                                                        pattern_map[delta]);
+        ngraph::replace_node(m_bn_bprop, bn_relu_bprop);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(bn_bprop, "CPUFusion.BatchNormReluBprop");
+    this->add_matcher(m, callback);
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::construct_batch_norm_relu_global_stats()
 {
     auto input_shape = Shape{1, 2, 2, 2};
@@ -1812,6 +1894,92 @@ void ngraph::runtime::cpu::pass::CPUFusion::
     this->add_matcher(m, callback);
 }
 
+// Minimum(GroupConvolutionBias with relu, alpha) -> GroupConvolutionBias with a bounded relu.
+// MobileNet style models clip depthwise convolutions with ReLU6, this lets MKLDNN apply the
+// clip as a post-op so the depthwise output is written once, already clipped, for the
+// pointwise convolution that reads it.
+void ngraph::runtime::cpu::pass::CPUFusion::construct_groupconv_bias_bounded_relu()
+{
+    Shape shape_a{1, 32, 2, 2};
+    Shape shape_b{32, 1, 1, 1};
+    Shape shape_r{1, 32, 2, 2};
+    Shape shape_bias{32};
+
+    auto input = std::make_shared<pattern::op::Label>(element::f32, shape_a);
+    auto filters = std::make_shared<pattern::op::Label>(element::f32, shape_b);
+    auto bias = std::make_shared<pattern::op::Label>(element::f32, shape_bias);
+
+    auto conv = std::make_shared<ngraph::op::GroupConvolutionBias>(input,
+                                                                   filters,
+                                                                   bias,
+                                                                   Strides{1, 1},
+                                                                   Strides{1, 1},
+                                                                   CoordinateDiff{0, 0},
+                                                                   CoordinateDiff{0, 0},
+                                                                   Strides{1, 1},
+                                                                   32,
+                                                                   shape_r,
+                                                                   true);
+    auto conv_label = std::make_shared<pattern::op::Label>(conv, nullptr, NodeVector{conv});
+
+    auto iconst1 = ngraph::op::Constant::create(element::f32, Shape{}, {1});
+    auto alpha = std::make_shared<pattern::op::Label>(iconst1);
+    auto broadcast_pred = [](std::shared_ptr<Node> n) {
+        return (std::dynamic_pointer_cast<ngraph::op::Broadcast>(n) != nullptr);
+    };
+    auto skip_broadcast = std::make_shared<pattern::op::Skip>(alpha, broadcast_pred);
+    auto min = std::make_shared<ngraph::op::Minimum>(conv_label, skip_broadcast);
+
+    auto callback = [conv_label, alpha](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In callback for GroupConvBias + BoundedRelu folding against node = "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto conv_m =
+            std::static_pointer_cast<ngraph::op::GroupConvolutionBias>(pattern_map[conv_label]);
+        if (!conv_m->with_relu() || conv_m->get_users().size() > 1)
+        {
+            NGRAPH_DEBUG << "GroupConvolutionBias has no relu or has more than one user";
+            return false;
+        }
+
+        auto alpha_const_op = std::dynamic_pointer_cast<ngraph::op::Constant>(pattern_map[alpha]);
+        if (!alpha_const_op || alpha_const_op->get_element_type() != element::f32 ||
+            alpha_const_op->get_shape() != conv_m->get_shape())
+        {
+            NGRAPH_DEBUG << "alpha must be a float constant of the convolution shape";
+            return false;
+        }
+        auto alpha_vals = alpha_const_op->get_vector<float>();
+        if (std::adjacent_find(alpha_vals.begin(), alpha_vals.end(), std::not_equal_to<float>()) !=
+            alpha_vals.end())
+        {
+            NGRAPH_DEBUG << "alpha must have a single value";
+            return false;
+        }
+
+        auto g_conv_bias_bounded_relu = std::make_shared<ngraph::op::GroupConvolutionBias>(
+            conv_m->get_argument(0),
+            conv_m->get_argument(1),
+            conv_m->get_argument(2),
+            conv_m->get_window_movement_strides(),
+            conv_m->get_window_dilation_strides(),
+            conv_m->get_padding_below(),
+            conv_m->get_padding_above(),
+            conv_m->get_data_dilation_strides(),
+            conv_m->get_groups(),
+            conv_m->get_output_shape(0),
+            true,
+            conv_m->get_alpha(),
+            std::min(conv_m->get_relu_upper_bound(), alpha_vals.at(0)));
+        ngraph::replace_node(m.get_match_root(), g_conv_bias_bounded_relu);
+        return true;
+    };
+
+    auto m = std::make_shared<ngraph::pattern::Matcher>(min, "CPUFusion.GroupconvBiasBoundedRelu");
+    this->add_matcher(m, callback);
+}
+
 void ngraph::runtime::cpu::pass::CPUFusion::construct_deconvolution_affine_folding()
 {
     Shape data_batch_shape{100, 512, 4, 4};
@@ -2519,3 +2687,131 @@ void ngraph::runtime::cpu::pass::CPUQuantFusion::construct_qconvb_add()
     auto m = std::make_shared<pattern::Matcher>(prelu, "CPUQuantFusion.QConvBiasSignedAdd");
     this->add_matcher(m, callback);
 }
+
+void ngraph::runtime::cpu::pass::CPUFusion::construct_scaled_dot_product_attention()
+{
+    // softmax(Q.K^T * scale + mask).V, where the scale is a Multiply or a Divide and the
+    // mask Add is optional
+    for (bool divide : {false, true})
+    {
+        for (bool masked : {false, true})
+        {
+            auto query = std::make_shared<pattern::op::Label>(element::f32, Shape{4, 8, 16});
+            auto key_t = std::make_shared<pattern::op::Label>(element::f32, Shape{4, 16, 8});
+            auto value = std::make_shared<pattern::op::Label>(element::f32, Shape{4, 8, 16});
+            auto mask = std::make_shared<pattern::op::Label>(element::f32, Shape{4, 8, 8});
+            auto scale = std::make_shared<pattern::op::Label>(
+                element::f32, Shape{}, pattern::has_class<ngraph::op::Constant>());
+            auto broadcast_pred = [](std::shared_ptr<Node> n) {
+                return (std::dynamic_pointer_cast<ngraph::op::Broadcast>(n) != nullptr);
+            };
+            auto skip_broadcast = std::make_shared<pattern::op::Skip>(scale, broadcast_pred);
+
+            auto qk = std::make_shared<ngraph::op::BatchMatMul>(query, key_t);
+            auto qk_label = std::make_shared<pattern::op::Label>(qk, nullptr, NodeVector{qk});
+            std::shared_ptr<Node> scores;
+            if (divide)
+            {
+                scores = std::make_shared<ngraph::op::Divide>(qk_label, skip_broadcast);
+            }
+            else
+            {
+                scores = std::make_shared<ngraph::op::Multiply>(qk_label, skip_broadcast);
+            }
+            if (masked)
+            {
+                scores = std::make_shared<ngraph::op::Add>(scores, mask);
+            }
+            auto softmax = std::make_shared<ngraph::op::Softmax>(scores, AxisSet{2});
+            auto softmax_label =
+                std::make_shared<pattern::op::Label>(softmax, nullptr, NodeVector{softmax});
+            auto attention = std::make_shared<ngraph::op::BatchMatMul>(softmax_label, value);
+
+            auto callback = [query,
+                             key_t,
+                             value,
+                             mask,
+                             scale,
+                             qk_label,
+                             softmax_label,
+                             divide,
+                             masked](pattern::Matcher& m) {
+                NGRAPH_DEBUG << "In a callback for construct_scaled_dot_product_attention against "
+                             << m.get_match_root()->get_name();
+                auto pattern_map = m.get_pattern_map();
+
+                auto element_type = m.get_match_root()->get_element_type();
+                if (element_type != element::f32 && element_type != element::f64)
+                {
+                    NGRAPH_DEBUG << "Attention kernel only supports f32 and f64";
+                    return false;
+                }
+
+                auto softmax_node =
+                    std::static_pointer_cast<ngraph::op::Softmax>(pattern_map[softmax_label]);
+                if (softmax_node->get_axes() != AxisSet{2})
+                {
+                    NGRAPH_DEBUG << "Softmax is not over the key axis";
+                    return false;
+                }
+                // the scores are only dropped when nothing else reads them
+                if (pattern_map[qk_label]->get_users().size() != 1 ||
+                    softmax_node->get_users().size() != 1)
+                {
+                    NGRAPH_DEBUG << "Attention scores or probabilities have other users";
+                    return false;
+                }
+
+                auto scale_node =
+                    std::static_pointer_cast<ngraph::op::Constant>(pattern_map[scale]);
+                auto scale_values = scale_node->get_value_strings();
+                if (std::any_of(scale_values.begin(),
+                                scale_values.end(),
+                                [&](const std::string& s) { return s != scale_values[0]; }))
+                {
+                    NGRAPH_DEBUG << "Attention scale is not a single value";
+                    return false;
+                }
+                double scale_value = std::stod(scale_values[0]);
+                if (divide)
+                {
+                    scale_value = 1.0 / scale_value;
+                }
+
+                // K^T is usually an explicit transpose of K, reuse its input
+                std::shared_ptr<Node> key;
+                auto reshape = std::dynamic_pointer_cast<ngraph::op::Reshape>(pattern_map[key_t]);
+                if (reshape && reshape->get_input_order() == AxisVector{0, 2, 1})
+                {
+                    key = reshape->get_argument(0);
+                }
+                else
+                {
+                    key = ngraph::op::util::batch_mat_transpose(pattern_map[key_t]);
+                }
+
+                std::shared_ptr<Node> fused;
+                if (masked)
+                {
+                    fused = std::make_shared<ngraph::op::ScaledDotProductAttention>(
+                        pattern_map[query],
+                        key,
+                        pattern_map[value],
+                        pattern_map[mask],
+                        scale_value);
+                }
+                else
+                {
+                    fused = std::make_shared<ngraph::op::ScaledDotProductAttention>(
+                        pattern_map[query], key, pattern_map[value], scale_value);
+                }
+                ngraph::replace_node(m.get_match_root(), fused);
+                return true;
+            };
+
+            auto m = std::make_shared<pattern::Matcher>(attention,
+                                                        "CPUFusion.ScaledDotProductAttention");
+            this->add_matcher(m, callback);
+        }
+    }
+}
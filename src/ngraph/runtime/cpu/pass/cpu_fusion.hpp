@@ -59,7 +59,12 @@ public:
             construct_conv_bias_affine_folding();
             construct_groupconv_batchnorm_global_stats_folding();
             construct_groupconv_batchnorm_global_stats_folding_relu();
+            // after construct_groupconv_batchnorm_global_stats_folding_relu(), which creates
+            // the GroupConvolutionBias with relu it matches
+            construct_groupconv_bias_bounded_relu();
             construct_batch_norm_relu();
+            // after construct_batch_norm_relu(), which creates the forward op it matches
+            construct_batch_norm_relu_backprop();
             construct_batch_norm_relu_global_stats();
             construct_conv_relu();
             construct_conv_bias_relu();
@@ -72,6 +77,7 @@ public:
             construct_conv_add_relu();
             construct_update_slice();
             construct_fuse_lstm_recurrent_state();
+            construct_scaled_dot_product_attention();
             if (std::getenv("NGRAPH_DECONV_FUSE") != nullptr)
             {
                 // Note: enable when the deconv perf is better than convbackpropdata
@@ -92,6 +98,7 @@ private:
     void construct_zero_padded_conv();
     void construct_zero_padded_conv_backprop_filters();
     void construct_batch_norm_relu();
+    void construct_batch_norm_relu_backprop();
     void construct_batch_norm_relu_global_stats();
     void construct_conv_relu();
     void construct_conv_bias_relu();
@@ -105,8 +112,10 @@ private:
     void construct_conv_bias_affine_folding();
     void construct_groupconv_batchnorm_global_stats_folding();
     void construct_groupconv_batchnorm_global_stats_folding_relu();
+    void construct_groupconv_bias_bounded_relu();
     void construct_update_slice();
     void construct_fuse_lstm_recurrent_state();
+    void construct_scaled_dot_product_attention();
     void construct_deconvolution_affine_folding();
     void construct_deconvolution_affine_folding_relu();
 };
@@ -20,12 +20,15 @@
 #include "ngraph/op/avg_pool.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
+#include "ngraph/runtime/cpu/op/matmul_bias.hpp"
 
 using namespace ngraph;
 using namespace std;
@@ -192,3 +195,327 @@ void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_conv_horizontal_fusion
         make_shared<pattern::Matcher>(conv_bias, "CPUHorizontalFusion.CpuConvHorizontalFusion");
     this->add_matcher(m, callback);
 }
+
+// Collects the users of `shared` that take it as input `shared_index` and compute the same
+// kind of product as `root`. Their other inputs have to be parameters or constants, so the
+// concatenation of those can not depend on the products it replaces.
+template <typename T>
+static NodeVector get_sibling_products(const std::shared_ptr<Node>& shared,
+                                       size_t shared_index,
+                                       const std::shared_ptr<T>& root,
+                                       std::function<bool(const T&, const T&)> same_kind)
+{
+    NodeVector products;
+    for (auto u : shared->get_users())
+    {
+        if (!is_used(u.get()) || std::find(products.begin(), products.end(), u) != products.end())
+        {
+            continue;
+        }
+        if (typeid(*u) != typeid(T) || u->get_input_size() != root->get_input_size() ||
+            u->get_argument(shared_index) != shared)
+        {
+            NGRAPH_DEBUG << "horizontal_fusion: " << u->get_name() << " is not a sibling\n";
+            continue;
+        }
+        bool fixed_inputs = true;
+        for (size_t i = 0; i < u->get_input_size(); i++)
+        {
+            auto arg = u->get_argument(i);
+            if (i != shared_index && !arg->is_constant() && !arg->is_parameter())
+            {
+                fixed_inputs = false;
+            }
+        }
+        if (!fixed_inputs)
+        {
+            NGRAPH_DEBUG << "horizontal_fusion: " << u->get_name()
+                         << " has computed weights\n";
+            continue;
+        }
+        if (!same_kind(*std::static_pointer_cast<T>(u), *root))
+        {
+            continue;
+        }
+        products.push_back(u);
+    }
+    return products;
+}
+
+static NodeVector get_arguments(const NodeVector& nodes, size_t index)
+{
+    NodeVector args;
+    for (auto n : nodes)
+    {
+        args.push_back(n->get_argument(index));
+    }
+    return args;
+}
+
+// Replaces every product by its slice of `fused` along `axis`. Slices along axis 0 are
+// contiguous and become views of the fused output in CPUMemoryOptimization.
+static void replace_with_slices(const NodeVector& products,
+                                const std::shared_ptr<Node>& fused,
+                                size_t axis)
+{
+    size_t index = 0;
+    for (auto product : products)
+    {
+        const Shape& slice_shape = product->get_output_shape(0);
+        Coordinate lower_bounds(slice_shape.size(), 0);
+        Coordinate upper_bounds(slice_shape);
+        lower_bounds[axis] = index;
+        index += slice_shape[axis];
+        upper_bounds[axis] = index;
+        NGRAPH_DEBUG << "horizontal_fusion: slice " << lower_bounds << " to " << upper_bounds
+                     << "\n";
+        auto slice = std::make_shared<ngraph::op::Slice>(fused, lower_bounds, upper_bounds);
+        ngraph::replace_node(product, slice);
+    }
+}
+
+void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_dot_horizontal_fusion()
+{
+    auto has_multiple_users = [](std::shared_ptr<Node> n) {
+        auto inputs = n->get_output_inputs(0);
+        return inputs.size() > 1;
+    };
+
+    // the shared input is either the data of x.W products, or the data of W.x products
+    for (size_t shared_index : {0, 1})
+    {
+        auto data = std::make_shared<pattern::op::Label>(
+            element::f32, Shape{4, 16}, has_multiple_users);
+        auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{16, 4});
+        auto dot = shared_index == 0 ? std::make_shared<ngraph::op::Dot>(data, weights)
+                                     : std::make_shared<ngraph::op::Dot>(weights, data);
+
+        auto callback = [data, shared_index](pattern::Matcher& m) {
+            NGRAPH_DEBUG << "dot_horizontal_fusion: In a callback for "
+                         << m.get_match_root()->get_name();
+
+            auto dot_root = std::static_pointer_cast<ngraph::op::Dot>(m.get_match_root());
+            if (dot_root->get_users().empty())
+            {
+                NGRAPH_DEBUG << "dot_horizontal_fusion: root node has been replaced\n";
+                return false;
+            }
+
+            // the weights are matrices, concatenated along their non-reduced axis
+            size_t weights_index = 1 - shared_index;
+            size_t reduced_axis = shared_index == 0 ? 0 : 1;
+            auto same_kind = [weights_index, reduced_axis](const ngraph::op::Dot& dot,
+                                                           const ngraph::op::Dot& root) {
+                const Shape& weights_shape = dot.get_input_shape(weights_index);
+                return dot.get_reduction_axes_count() == 1 && weights_shape.size() == 2 &&
+                       weights_shape[reduced_axis] ==
+                           root.get_input_shape(weights_index)[reduced_axis] &&
+                       dot.get_input_element_type(weights_index) ==
+                           root.get_input_element_type(weights_index);
+            };
+            if (!same_kind(*dot_root, *dot_root))
+            {
+                NGRAPH_DEBUG << "dot_horizontal_fusion: root is not a matrix product\n";
+                return false;
+            }
+
+            auto shared = m.get_pattern_map()[data];
+            auto dots = get_sibling_products<ngraph::op::Dot>(
+                shared, shared_index, dot_root, same_kind);
+            if (dots.size() <= 1)
+            {
+                NGRAPH_DEBUG << "dot_horizontal_fusion: need more than one nodes to do fusion\n";
+                return false;
+            }
+
+            auto concat_weights = std::make_shared<ngraph::op::Concat>(
+                get_arguments(dots, weights_index), 1 - reduced_axis);
+            std::shared_ptr<Node> dot_new;
+            if (shared_index == 0)
+            {
+                dot_new = std::make_shared<ngraph::op::Dot>(shared, concat_weights, 1);
+            }
+            else
+            {
+                dot_new = std::make_shared<ngraph::op::Dot>(concat_weights, shared, 1);
+            }
+            NGRAPH_DEBUG << "dot_horizontal_fusion: new dot shape "
+                         << dot_new->get_output_shape(0) << "\n";
+            replace_with_slices(
+                dots, dot_new, shared_index == 0 ? dot_new->get_output_shape(0).size() - 1 : 0);
+            return true;
+        };
+
+        auto m = make_shared<pattern::Matcher>(dot, "CPUHorizontalFusion.DotHorizontalFusion");
+        this->add_matcher(m, callback);
+    }
+}
+
+void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_matmul_bias_horizontal_fusion()
+{
+    auto has_multiple_users = [](std::shared_ptr<Node> n) {
+        auto inputs = n->get_output_inputs(0);
+        return inputs.size() > 1;
+    };
+
+    for (size_t shared_index : {0, 1})
+    {
+        for (bool with_bias : {false, true})
+        {
+            auto data = std::make_shared<pattern::op::Label>(
+                element::f32, Shape{4, 16}, has_multiple_users);
+            auto weights = std::make_shared<pattern::op::Label>(element::f32, Shape{16, 4});
+            auto W = shared_index == 0 ? data : weights;
+            auto x = shared_index == 0 ? weights : data;
+            std::shared_ptr<Node> matmul;
+            if (with_bias)
+            {
+                auto bias = std::make_shared<pattern::op::Label>(element::f32, Shape{4});
+                matmul = std::make_shared<ngraph::op::MatmulBias>(
+                    W, x, bias, W->get_shape(), x->get_shape(), false, false, AxisSet{0});
+            }
+            else
+            {
+                matmul = std::make_shared<ngraph::op::MatmulBias>(
+                    W, x, nullptr, W->get_shape(), x->get_shape(), false, false);
+            }
+
+            auto callback = [data, shared_index](pattern::Matcher& m) {
+                NGRAPH_DEBUG << "matmul_bias_horizontal_fusion: In a callback for "
+                             << m.get_match_root()->get_name();
+
+                auto matmul_root =
+                    std::static_pointer_cast<ngraph::op::MatmulBias>(m.get_match_root());
+                if (matmul_root->get_users().empty())
+                {
+                    NGRAPH_DEBUG << "matmul_bias_horizontal_fusion: root node has been "
+                                    "replaced\n";
+                    return false;
+                }
+
+                // x.W products split their output columns and take a bias per column,
+                // W.x products split their output rows and take a bias per row
+                size_t weights_index = 1 - shared_index;
+                size_t output_axis = shared_index == 0 ? 1 : 0;
+                size_t concat_axis = shared_index == 0
+                                         ? (matmul_root->get_is_b_transposed() ? 0 : 1)
+                                         : (matmul_root->get_is_a_transposed() ? 1 : 0);
+                auto same_kind = [weights_index, output_axis, concat_axis](
+                    const ngraph::op::MatmulBias& matmul, const ngraph::op::MatmulBias& root) {
+                    if (matmul.get_input_size() > 2 &&
+                        (matmul.get_broadcast_axes() != AxisSet{1 - output_axis} ||
+                         matmul.get_input_shape(2).size() != 1))
+                    {
+                        return false;
+                    }
+                    return matmul.get_is_a_transposed() == root.get_is_a_transposed() &&
+                           matmul.get_is_b_transposed() == root.get_is_b_transposed() &&
+                           matmul.get_input_shape(weights_index).size() == 2 &&
+                           matmul.get_input_shape(weights_index)[1 - concat_axis] ==
+                               root.get_input_shape(weights_index)[1 - concat_axis];
+                };
+                if (!same_kind(*matmul_root, *matmul_root))
+                {
+                    NGRAPH_DEBUG << "matmul_bias_horizontal_fusion: bias is not per "
+                                    "output slice\n";
+                    return false;
+                }
+
+                auto shared = m.get_pattern_map()[data];
+                auto matmuls = get_sibling_products<ngraph::op::MatmulBias>(
+                    shared, shared_index, matmul_root, same_kind);
+                if (matmuls.size() <= 1)
+                {
+                    NGRAPH_DEBUG << "matmul_bias_horizontal_fusion: need more than one nodes "
+                                    "to do fusion\n";
+                    return false;
+                }
+
+                std::shared_ptr<Node> concat_weights = std::make_shared<ngraph::op::Concat>(
+                    get_arguments(matmuls, weights_index), concat_axis);
+                std::shared_ptr<Node> concat_bias;
+                if (matmul_root->get_input_size() > 2)
+                {
+                    concat_bias =
+                        std::make_shared<ngraph::op::Concat>(get_arguments(matmuls, 2), 0);
+                }
+                auto W = shared_index == 0 ? shared : concat_weights;
+                auto x = shared_index == 0 ? concat_weights : shared;
+                auto matmul_new =
+                    std::make_shared<ngraph::op::MatmulBias>(W,
+                                                             x,
+                                                             concat_bias,
+                                                             W->get_shape(),
+                                                             x->get_shape(),
+                                                             matmul_root->get_is_a_transposed(),
+                                                             matmul_root->get_is_b_transposed(),
+                                                             matmul_root->get_broadcast_axes());
+                NGRAPH_DEBUG << "matmul_bias_horizontal_fusion: new matmul shape "
+                             << matmul_new->get_output_shape(0) << "\n";
+                replace_with_slices(matmuls, matmul_new, output_axis);
+                return true;
+            };
+
+            auto m = make_shared<pattern::Matcher>(
+                matmul, "CPUHorizontalFusion.MatmulBiasHorizontalFusion");
+            this->add_matcher(m, callback);
+        }
+    }
+}
+
+void ngraph::runtime::cpu::pass::CPUHorizontalFusion::cpu_quantized_dot_horizontal_fusion()
+{
+    auto has_multiple_users = [](std::shared_ptr<Node> n) {
+        auto inputs = n->get_output_inputs(0);
+        return inputs.size() > 1;
+    };
+
+    auto data = std::make_shared<pattern::op::Label>(element::u8, Shape{4, 16}, has_multiple_users);
+    auto weights = std::make_shared<pattern::op::Label>(element::i8, Shape{4, 16});
+    auto scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto quantized_dot = std::make_shared<ngraph::op::QuantizedDot>(data, weights, scale);
+
+    auto callback = [data](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "quantized_dot_horizontal_fusion: In a callback for "
+                     << m.get_match_root()->get_name();
+
+        auto qdot_root = std::static_pointer_cast<ngraph::op::QuantizedDot>(m.get_match_root());
+        if (qdot_root->get_users().empty())
+        {
+            NGRAPH_DEBUG << "quantized_dot_horizontal_fusion: root node has been replaced\n";
+            return false;
+        }
+
+        // the weights are [oc, ic] and stack along oc, the requantization has to be shared
+        auto same_kind = [](const ngraph::op::QuantizedDot& qdot,
+                            const ngraph::op::QuantizedDot& root) {
+            return qdot.requantize() == root.requantize() &&
+                   qdot.with_relu() == root.with_relu() &&
+                   qdot.get_argument(2) == root.get_argument(2) &&
+                   qdot.get_input_element_type(1) == root.get_input_element_type(1);
+        };
+        auto qdots = get_sibling_products<ngraph::op::QuantizedDot>(
+            m.get_pattern_map()[data], 0, qdot_root, same_kind);
+        if (qdots.size() <= 1)
+        {
+            NGRAPH_DEBUG << "quantized_dot_horizontal_fusion: need more than one nodes to do "
+                            "fusion\n";
+            return false;
+        }
+
+        auto concat_weights = std::make_shared<ngraph::op::Concat>(get_arguments(qdots, 1), 0);
+        auto qdot_new = std::make_shared<ngraph::op::QuantizedDot>(qdot_root->get_argument(0),
+                                                                   concat_weights,
+                                                                   qdot_root->get_argument(2),
+                                                                   qdot_root->requantize(),
+                                                                   qdot_root->with_relu());
+        NGRAPH_DEBUG << "quantized_dot_horizontal_fusion: new quantized dot shape "
+                     << qdot_new->get_output_shape(0) << "\n";
+        replace_with_slices(qdots, qdot_new, 1);
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(quantized_dot,
+                                           "CPUHorizontalFusion.QuantizedDotHorizontalFusion");
+    this->add_matcher(m, callback);
+}
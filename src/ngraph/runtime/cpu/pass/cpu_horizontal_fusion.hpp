@@ -39,8 +39,14 @@ public:
         : GraphRewrite()
     {
         cpu_conv_horizontal_fusion();
+        cpu_dot_horizontal_fusion();
+        cpu_matmul_bias_horizontal_fusion();
+        cpu_quantized_dot_horizontal_fusion();
     }
 
 private:
     void cpu_conv_horizontal_fusion();
+    void cpu_dot_horizontal_fusion();
+    void cpu_matmul_bias_horizontal_fusion();
+    void cpu_quantized_dot_horizontal_fusion();
 };
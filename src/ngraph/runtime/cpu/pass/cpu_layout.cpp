@@ -19,6 +19,8 @@
 #include <string>
 #include <typeindex>
 #include <typeinfo>
+#include <unordered_map>
+#include <utility>
 
 #include <mkldnn.hpp>
 
@@ -48,6 +50,7 @@
 #include "ngraph/op/lrn.hpp"
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/op.hpp"
+#include "ngraph/op/parameter.hpp"
 #include "ngraph/op/quantize.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
@@ -58,6 +61,7 @@
 #include "ngraph/runtime/cpu/cpu_executor.hpp"
 #include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
 #include "ngraph/runtime/cpu/cpu_op_annotations.hpp"
+#include "ngraph/runtime/cpu/mkldnn_conv_tuner.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/batch_norm_relu.hpp"
 #include "ngraph/runtime/cpu/op/bounded_relu.hpp"
@@ -76,6 +80,16 @@ using namespace mkldnn;
 using namespace ngraph;
 using namespace ngraph::runtime::cpu;
 
+// Estimated bytes reordered downstream of an elementwise node when its output is kept in the
+// native layout (first) or in an MKLDNN blocked layout (second)
+using LayoutCostMap = std::unordered_map<const Node*, std::pair<size_t, size_t>>;
+
+static bool is_native_md(const memory::desc& md, const Shape& shape, const element::Type& et)
+{
+    return mkldnn_utils::compare_mkldnn_mds(
+        md, mkldnn_utils::create_blocked_mkldnn_md(shape, row_major_strides(shape), et));
+}
+
 // Check if the input layout matches the layout requested in `required_mds`
 // If not, insert a layout conversion node between the input tensor and
 // the `node`. For now, only MKLDNN nodes/kernels can request specific layouts
@@ -125,6 +139,8 @@ static shared_ptr<Node>
             layout->set_mkldnn_md(required_mds[index]);
             auto new_node = std::shared_ptr<Node>(
                 new runtime::cpu::op::ConvertLayout(output.get_node(), output.get_index(), layout));
+            // Conversions of an op's inputs count toward the op
+            new_node->merge_provenance_tags_from(node);
             new_args.push_back(new_node);
             replace_node = true;
             NGRAPH_DEBUG << "Inserted conversion node " << new_node->get_name() << " between "
@@ -206,6 +222,7 @@ static void set_native_layouts(runtime::cpu::CPU_ExternalFunction* external_func
                 layout->set_mkldnn_md(native_md);
                 auto new_node = std::shared_ptr<Node>(new runtime::cpu::op::ConvertLayout(
                     output.get_node(), output.get_index(), layout));
+                new_node->merge_provenance_tags_from(node);
                 new_args.push_back(new_node);
                 if (use_replace)
                 {
@@ -294,7 +311,8 @@ static void set_layouts_unaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction*
 }
 
 void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* external_function,
-                               std::shared_ptr<ngraph::Node> node)
+                               std::shared_ptr<ngraph::Node> node,
+                               const LayoutCostMap& layout_costs)
 {
     std::vector<mkldnn::memory::desc> arg_mds{mkldnn_utils::get_input_mkldnn_md(node.get(), 0),
                                               mkldnn_utils::get_input_mkldnn_md(node.get(), 1)};
@@ -309,6 +327,23 @@ void set_layouts_binaryeltwise(ngraph::runtime::cpu::CPU_ExternalFunction* exter
         vector<memory::desc> i_mds;
         vector<memory::desc> o_mds;
         int select = 0;
+        // Either choice reorders one input. When only one argument is blocked, keep the
+        // layout that is cheaper for the users of the result rather than always following
+        // argument 0.
+        auto costs = layout_costs.find(node.get());
+        bool blocked0 =
+            !is_native_md(arg_mds[0], node->get_input_shape(0), node->get_input_element_type(0));
+        bool blocked1 =
+            !is_native_md(arg_mds[1], node->get_input_shape(1), node->get_input_element_type(1));
+        if (costs != layout_costs.end() && blocked0 != blocked1)
+        {
+            size_t native_cost = costs->second.first;
+            size_t blocked_cost = costs->second.second;
+            if (blocked0 ? native_cost < blocked_cost : blocked_cost < native_cost)
+            {
+                select = 1;
+            }
+        }
         char* ngraph_pass_cpu_layout_eltwise = std::getenv("NGRAPH_PASS_CPU_LAYOUT_ELTWISE");
         if (ngraph_pass_cpu_layout_eltwise != nullptr)
         {
@@ -401,6 +436,30 @@ namespace ngraph
                         convolution_algo = mkldnn::algorithm::convolution_direct;
                     }
 
+                    // The formats chosen here depend on the algorithm, so the tuned choice is
+                    // made here first and the emitter finds it in the tuner later
+                    auto& tuner = MKLDNNConvolutionTuner::get();
+                    if (node->get_input_element_type(0) == element::f32 && tuner.is_enabled())
+                    {
+                        std::unique_ptr<memory::desc> bias_desc;
+                        if (use_bias)
+                        {
+                            auto arg2_shape = node->get_input_shape(2);
+                            bias_desc.reset(new memory::desc(
+                                memory::dims(arg2_shape.begin(), arg2_shape.end()),
+                                mkldnn_utils::get_mkldnn_data_type(node->get_input_element_type(2)),
+                                memory::format::any));
+                        }
+                        convolution_algo = tuner.select(input_data_desc,
+                                                        weights_desc,
+                                                        bias_desc.get(),
+                                                        result_desc,
+                                                        mkldnn_filter_strides,
+                                                        mkldnn_dilated_strides,
+                                                        mkldnn_padding_below,
+                                                        mkldnn_padding_above);
+                    }
+
                     if (use_bias)
                     {
                         memory::data_type et_bias =
@@ -1698,6 +1757,76 @@ namespace ngraph
                     }
                 }
 
+                // Returns the layout an MKLDNN convolution prefers for its data (0) or
+                // weights (1) input
+                static bool get_preferred_input_md(std::shared_ptr<ngraph::Node> node,
+                                                   size_t index,
+                                                   memory::desc& input_md)
+                {
+                    vector<memory::desc> i_mds;
+                    vector<memory::desc> o_mds;
+                    auto& n = *node;
+                    auto type = std::type_index(typeid(n));
+                    if (type == typeid(ngraph::op::Convolution))
+                    {
+                        ConvolutionLayout<ngraph::op::Convolution, false>(node, i_mds, o_mds);
+                    }
+                    else if (type == typeid(ngraph::op::ConvolutionRelu))
+                    {
+                        ConvolutionLayout<ngraph::op::ConvolutionRelu, false>(node, i_mds, o_mds);
+                    }
+                    else if (type == typeid(ngraph::op::ConvolutionAdd))
+                    {
+                        ConvolutionLayout<ngraph::op::ConvolutionAdd, false>(node, i_mds, o_mds);
+                    }
+                    else if (type == typeid(ngraph::op::ConvolutionBias))
+                    {
+                        ConvolutionLayout<ngraph::op::ConvolutionBias, true>(node, i_mds, o_mds);
+                    }
+                    else if (type == typeid(ngraph::op::ConvolutionBiasAdd))
+                    {
+                        ConvolutionLayout<ngraph::op::ConvolutionBiasAdd, true>(node, i_mds, o_mds);
+                    }
+                    else
+                    {
+                        return false;
+                    }
+                    if (index >= i_mds.size())
+                    {
+                        return false;
+                    }
+                    input_md = i_mds[index];
+                    return true;
+                }
+
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::Parameter)
+                {
+                    // A persistent parameter is fed back from a result on every call, so it is
+                    // kept in the layout its MKLDNN convolution users want for their weights.
+                    // The call frame converts the bound tensor only when its layout differs.
+                    auto parameter = static_cast<const ngraph::op::Parameter*>(node.get());
+                    if (parameter->get_persistent() &&
+                        !node->get_output_tensor_ptr(0)->get_tensor_layout())
+                    {
+                        for (auto& user : node->get_users())
+                        {
+                            memory::desc weights_md;
+                            if (!mkldnn_utils::use_mkldnn_kernel(user.get()) ||
+                                user->get_argument(1) != node ||
+                                !get_preferred_input_md(user, 1, weights_md) ||
+                                mkldnn_utils::is_mkldnn_padded_layout(
+                                    weights_md, ngraph::get_default_order(node->get_shape())))
+                            {
+                                continue;
+                            }
+                            set_output_layouts(node, {weights_md});
+                            return;
+                        }
+                    }
+                    set_native_layouts(external_function, node);
+                }
+
                 static bool can_be_rotated(const ngraph::op::Reshape* reshape,
                                            const mkldnn::memory::desc& md)
                 {
@@ -2121,6 +2250,58 @@ namespace ngraph
                     }
                 }
 
+                template <>
+                void CPULayout::LAYOUT_DECL(ngraph::op::BatchNormTrainingReluBackprop)
+                {
+                    if (mkldnn_utils::use_mkldnn_kernel(node.get()))
+                    {
+                        auto kernel_md = mkldnn_utils::get_input_mkldnn_md(node.get(), 2);
+                        auto kernel_layout = static_cast<memory::format>(kernel_md.data.format);
+                        auto arg0_md = mkldnn_utils::create_default_mkldnn_md(
+                            node.get(), 0, false, memory::format::x);
+                        auto arg1_md = mkldnn_utils::create_default_mkldnn_md(
+                            node.get(), 1, false, memory::format::x);
+                        auto arg3_md = mkldnn_utils::create_default_mkldnn_md(
+                            node.get(), 3, false, memory::format::x);
+                        auto arg4_md = mkldnn_utils::create_default_mkldnn_md(
+                            node.get(), 4, false, memory::format::x);
+                        auto out1_md = mkldnn_utils::create_default_mkldnn_md(
+                            node.get(), 1, true, memory::format::x);
+                        auto out2_md = mkldnn_utils::create_default_mkldnn_md(
+                            node.get(), 2, true, memory::format::x);
+
+                        if (!mkldnn_utils::is_mkldnn_blocked_data_format(kernel_layout))
+                        {
+                            // Propagate delta layout
+                            kernel_md = mkldnn_utils::get_input_mkldnn_md(node.get(), 6);
+                        }
+
+                        vector<memory::desc> i_mds;
+                        vector<memory::desc> o_mds;
+
+                        i_mds.push_back(arg0_md);
+                        i_mds.push_back(arg1_md);
+                        i_mds.push_back(kernel_md);
+                        i_mds.push_back(arg3_md);
+                        i_mds.push_back(arg4_md);
+                        // the relu mask is applied element-wise, so the forward output and
+                        // delta share the input layout
+                        i_mds.push_back(kernel_md);
+                        i_mds.push_back(kernel_md);
+
+                        o_mds.push_back(kernel_md);
+                        o_mds.push_back(out1_md);
+                        o_mds.push_back(out2_md);
+
+                        node = insert_input_conversions(external_function, node, i_mds);
+                        set_output_layouts(node, o_mds);
+                    }
+                    else
+                    {
+                        throw ngraph_error("Batchnorm Backprop only supported in MKLDNN for now");
+                    }
+                }
+
                 template <>
                 void CPULayout::LAYOUT_DECL(ngraph::op::Slice)
                 {
@@ -2363,10 +2544,13 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::BatchNormTrainingRelu>},
     {TI(ngraph::op::BatchNormTrainingBackprop),
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::BatchNormTrainingBackprop>},
+    {TI(ngraph::op::BatchNormTrainingReluBackprop),
+     &runtime::cpu::pass::CPULayout::layout<ngraph::op::BatchNormTrainingReluBackprop>},
     {TI(ngraph::op::GetOutputElement),
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::GetOutputElement>},
     {TI(ngraph::op::LRN), &runtime::cpu::pass::CPULayout::layout<ngraph::op::LRN>},
     {TI(ngraph::op::Reshape), &runtime::cpu::pass::CPULayout::layout<ngraph::op::Reshape>},
+    {TI(ngraph::op::Parameter), &runtime::cpu::pass::CPULayout::layout<ngraph::op::Parameter>},
     {TI(ngraph::op::Result), &runtime::cpu::pass::CPULayout::layout<ngraph::op::Result>},
     {TI(ngraph::op::ReluBackprop),
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::ReluBackprop>},
@@ -2398,8 +2582,69 @@ static const runtime::cpu::pass::LayoutOpMap s_dispatcher{
      &runtime::cpu::pass::CPULayout::layout<ngraph::op::QuantizedDot>},
 };
 
+// Fills in the layout costs of an elementwise node from its users. Elementwise users
+// propagate the layout they are given, so their own costs are added on, and MKLDNN
+// convolutions count a reorder unless they are fed the data layout they prefer.
+static void estimate_layout_costs(const shared_ptr<Node>& node, LayoutCostMap& layout_costs)
+{
+    size_t native_cost = 0;
+    size_t blocked_cost = 0;
+    size_t bytes = shape_size(node->get_shape()) * node->get_element_type().size();
+    for (descriptor::Input* input : node->get_output_inputs(0))
+    {
+        auto user = input->get_node();
+        auto costs = layout_costs.find(user.get());
+        memory::desc preferred_md;
+        if (costs != layout_costs.end())
+        {
+            native_cost += costs->second.first;
+            blocked_cost += costs->second.second;
+        }
+        else if (mkldnn_utils::use_mkldnn_kernel(user.get()))
+        {
+            if (runtime::cpu::pass::get_preferred_input_md(
+                    user, input->get_index(), preferred_md))
+            {
+                if (is_native_md(preferred_md, node->get_shape(), node->get_element_type()))
+                {
+                    blocked_cost += bytes;
+                }
+                else
+                {
+                    native_cost += bytes;
+                }
+            }
+        }
+        else if (auto result = dynamic_pointer_cast<ngraph::op::Result>(user))
+        {
+            if (result->needs_default_layout())
+            {
+                blocked_cost += bytes;
+            }
+        }
+        else
+        {
+            // native kernels convert blocked inputs back
+            blocked_cost += bytes;
+        }
+    }
+    layout_costs[node.get()] = std::make_pair(native_cost, blocked_cost);
+}
+
 bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::shared_ptr<Node>>& nodes)
 {
+    LayoutCostMap layout_costs;
+    for (auto it = nodes.rbegin(); it != nodes.rend(); ++it)
+    {
+        const auto& node = *it;
+        if (node->get_output_size() == 1 &&
+            (dynamic_pointer_cast<ngraph::op::util::UnaryElementwiseArithmetic>(node) ||
+             dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(node)))
+        {
+            estimate_layout_costs(node, layout_costs);
+        }
+    }
+
     for (const auto& node : nodes)
     {
         auto& n = *node;
@@ -2416,7 +2661,7 @@ bool runtime::cpu::pass::CPULayout::run_on_call_graph(const std::list<std::share
         else if (dynamic_pointer_cast<ngraph::op::util::BinaryElementwiseArithmetic>(node) !=
                  nullptr)
         {
-            set_layouts_binaryeltwise(m_external_function, node);
+            set_layouts_binaryeltwise(m_external_function, node, layout_costs);
         }
         else
         {
@@ -36,9 +36,11 @@ runtime::cpu::pass::CPUMemoryAssignment::CPUMemoryAssignment(
         bufferID_to_tensorSets,
     unordered_map<descriptor::Tensor*, size_t>& tensor_to_bufferID,
     size_t alignment,
-    bool disable_memory_sharing)
+    bool disable_memory_sharing,
+    ngraph::pass::MemoryManager::allocation_scheme scheme)
     : m_alignment(alignment)
     , m_disable_memory_sharing(disable_memory_sharing)
+    , m_scheme(scheme)
     , m_bufferID_to_tensorSets(bufferID_to_tensorSets)
     , m_tensor_to_bufferID(tensor_to_bufferID)
 {
@@ -652,7 +654,12 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
     // memory assignment using liveness analysis result
 
     // memory manager for non-cacheable ops, memory allocation will be freed when not longer in use
-    ngraph::pass::MemoryManager mm(m_alignment, m_disable_memory_sharing);
+    ngraph::pass::MemoryManager mm(
+        m_alignment,
+        m_disable_memory_sharing ? ngraph::pass::MemoryManager::allocation_scheme::NO_REUSE
+                                 : m_scheme);
+    // tensors whose offsets come from mm, remapped once mm has planned all lifetimes
+    unordered_set<descriptor::Tensor*> mm_tensors;
     // memory manager for cacheable ops, memory allocation will never be freed
     ngraph::pass::MemoryManager mm_caching(m_alignment, true);
 
@@ -783,9 +790,14 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                         // do not combine those two sets.
                         // change the label of output tensor set to that of input tensor set
                         output_buffer_it->second.first = input_buffer_it->second.first;
+                        bool from_mm = mm_tensors.count(input_tensor) != 0;
                         for (auto& ele_t : output_set)
                         {
                             ele_t->set_pool_offset(offset);
+                            if (from_mm)
+                            {
+                                mm_tensors.insert(ele_t);
+                            }
                         }
                     }
                 }
@@ -818,6 +830,8 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
             else
             {
                 offset = mm.allocate(size);
+                mm_tensors.insert(tensor);
+                mm_tensors.insert(tensor_set.begin(), tensor_set.end());
             }
             tensor->set_pool_offset(offset);
             for (auto& e : tensor_set)
@@ -844,6 +858,13 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
         }
     }
 
+    // offsets are final from here on, concat and slice below work relative to them
+    mm.plan();
+    for (auto tensor : mm_tensors)
+    {
+        tensor->set_pool_offset(mm.get_offset(tensor->get_pool_offset()));
+    }
+
     // update offsets in concat and slice tensors set.
     // In place concatenation optimization
     process_in_place_concat(ops);
@@ -871,6 +892,7 @@ bool runtime::cpu::pass::CPUMemoryAssignment::run_on_function(shared_ptr<ngraph:
                  << mm_caching.max_allocated();
     NGRAPH_DEBUG << "cpu_memory_assignment: max allocated in total is "
                  << mm.max_allocated() + mm_caching.max_allocated();
+    NGRAPH_DEBUG << "cpu_memory_assignment: lower bound for mm is " << mm.min_allocated();
 
     function->set_temporary_pool_size(mm.max_allocated() + mm_caching.max_allocated());
 
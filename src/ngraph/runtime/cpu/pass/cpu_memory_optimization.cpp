@@ -45,6 +45,12 @@
 ///                               concat
 ///
 /// After optimization: the result of add1 is stored to the memory buffer assigned to concat, same for add2 and add3.
+///
+/// The arguments may be in-place ops themselves. A destructive in-place argument, e.g. a MKLDNN
+/// Relu or a ConvolutionAdd, gets an output buffer of its own when it does not overwrite its
+/// input, so its output is placed in the concat buffer like any other op's. Blocked MKLDNN layouts
+/// are allowed as long as every argument uses the format of the concat output without padding, so
+/// the channel offsets of the arguments are multiples of the block size.
 
 #include "ngraph/runtime/cpu/pass/cpu_memory_optimization.hpp"
 
@@ -58,6 +64,43 @@
 
 using namespace ngraph;
 
+// The output of arg can be written into the concat buffer unless arg shares it with its input
+// through a non-destructive in-place pair. CPUMemoryAssignment then moves the buffer of the input
+// as well, which is only safe when that input feeds nothing else and is not in place itself.
+static bool can_write_to_concat_buffer(const std::shared_ptr<Node>& arg)
+{
+    if (!arg->is_op())
+    {
+        return true;
+    }
+    auto annotation = std::static_pointer_cast<ngraph::op::Op>(arg)->get_op_annotations();
+    if (!annotation)
+    {
+        return true;
+    }
+    for (auto& oi_pair : annotation->get_in_place_oi_pairs())
+    {
+        if (oi_pair.destructive)
+        {
+            continue;
+        }
+        const auto& input_output = arg->get_inputs().at(oi_pair.input).get_output();
+        auto producer = input_output.get_node();
+        if (producer->is_constant() || producer->is_parameter() ||
+            input_output.get_inputs().size() != 1 || !producer->is_op())
+        {
+            return false;
+        }
+        auto producer_annotation =
+            std::static_pointer_cast<ngraph::op::Op>(producer)->get_op_annotations();
+        if (producer_annotation && producer_annotation->get_in_place_oi_pairs().size() > 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<Function> function)
 {
     for (auto n : function->get_ordered_ops())
@@ -130,21 +173,12 @@ bool runtime::cpu::pass::CPUMemoryOptimization::run_on_function(std::shared_ptr<
 
                 NGRAPH_CHECK(arg->get_output_size() == 1);
 
-                if (arg->description() != "Concat")
+                if (arg->description() != "Concat" && !can_write_to_concat_buffer(arg))
                 {
-                    if (arg->is_op())
-                    {
-                        auto op = std::static_pointer_cast<ngraph::op::Op>(arg);
-                        auto annotation = op->get_op_annotations();
-                        if (annotation && annotation->get_in_place_oi_pairs().size() > 0)
-
-                        {
-                            NGRAPH_DEBUG << "cpu_memory_optimization: " << arg->get_name()
-                                         << ": in place non-concat op, no in place concat";
-                            in_place_concat = false;
-                            break;
-                        }
-                    }
+                    NGRAPH_DEBUG << "cpu_memory_optimization: " << arg->get_name()
+                                 << ": shares its input buffer, no in place concat";
+                    in_place_concat = false;
+                    break;
                 }
 
                 if (output.get_inputs().size() != 1)
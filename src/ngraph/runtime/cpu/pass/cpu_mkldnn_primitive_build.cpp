@@ -554,12 +554,18 @@ namespace ngraph
                         false /*Training*/);
                 }
 
-                template <>
-                void MKLDNNPrimitiveBuildPass::CONSTRUCT_PRIMITIVE_BUILD_STRING_DECL(
-                    BatchNormTrainingBackprop)
+                // delta is the last input of OP
+                template <typename OP>
+                void construct_primitive_build_string_batchnorm_backprop(
+                    ngraph::runtime::cpu::MKLDNNEmitter& mkldnn_emitter,
+                    ngraph::Node* node,
+                    std::string& construct_string,
+                    std::vector<size_t>& deps,
+                    size_t& index,
+                    std::ofstream& desc_file)
                 {
                     const auto& args = node->get_inputs();
-                    const auto* batchnorm = static_cast<const BatchNormTrainingBackprop*>(node);
+                    const auto* batchnorm = static_cast<const OP*>(node);
                     auto eps = batchnorm->get_eps_value();
 
                     auto weights_shape =
@@ -569,7 +575,8 @@ namespace ngraph
                     auto input_desc = mkldnn_utils::get_input_mkldnn_md(node, 2);
                     auto mean_desc = mkldnn_utils::get_input_mkldnn_md(node, 3);
                     auto variance_desc = mkldnn_utils::get_input_mkldnn_md(node, 4);
-                    auto delta_desc = mkldnn_utils::get_input_mkldnn_md(node, 5);
+                    auto delta_desc =
+                        mkldnn_utils::get_input_mkldnn_md(node, node->get_input_size() - 1);
                     auto dinput_desc = mkldnn_utils::get_output_mkldnn_md(node, 0);
                     auto dweights_desc = mkldnn_emitter.build_memory_descriptor(
                         weights_shape, args[0].get_element_type(), mkldnn::memory::format::nc);
@@ -629,6 +636,23 @@ namespace ngraph
                     construct_string = writer.get_code();
                 }
 
+                template <>
+                void MKLDNNPrimitiveBuildPass::CONSTRUCT_PRIMITIVE_BUILD_STRING_DECL(
+                    BatchNormTrainingBackprop)
+                {
+                    construct_primitive_build_string_batchnorm_backprop<BatchNormTrainingBackprop>(
+                        mkldnn_emitter, node, construct_string, deps, index, desc_file);
+                }
+
+                template <>
+                void MKLDNNPrimitiveBuildPass::CONSTRUCT_PRIMITIVE_BUILD_STRING_DECL(
+                    BatchNormTrainingReluBackprop)
+                {
+                    construct_primitive_build_string_batchnorm_backprop<
+                        BatchNormTrainingReluBackprop>(
+                        mkldnn_emitter, node, construct_string, deps, index, desc_file);
+                }
+
                 template <>
                 void MKLDNNPrimitiveBuildPass::CONSTRUCT_PRIMITIVE_BUILD_STRING_DECL(Concat)
                 {
@@ -806,11 +830,28 @@ namespace ngraph
                     mkldnn_emitter.reserve_descriptor_space(descs.size());
                     serialize_memory_descs(desc_file, descs, deps[0]);
 
+                    std::string algorithm = "convolution_direct";
+                    auto& tuner = MKLDNNConvolutionTuner::get();
+                    if (node->get_input_element_type(0) == element::f32 && tuner.is_enabled() &&
+                        tuner.select(data_desc,
+                                     weights_desc,
+                                     mkldnn_emitter.has_bias<OP>() ? &descs[2] : nullptr,
+                                     result_desc,
+                                     MKLDNN_DIMS(strides),
+                                     MKLDNN_DIMS(window_dilation_strides_adjusted),
+                                     MKLDNN_DIMS(pad_below),
+                                     MKLDNN_DIMS(pad_above)) ==
+                            mkldnn::algorithm::convolution_winograd)
+                    {
+                        algorithm = "convolution_winograd";
+                    }
+
                     writer << "\n// build QConv primitive descriptor\n";
                     writer << "auto conv_desc = "
                               "mkldnn::convolution_forward::desc(mkldnn::prop_kind::forward,\n"
-                              "mkldnn::algorithm::convolution_direct,\n"
-                              "*cg_ctx->mkldnn_descriptors["
+                              "mkldnn::algorithm::"
+                           << algorithm << ",\n"
+                                           "*cg_ctx->mkldnn_descriptors["
                            << desc_index << "],\n"
                                             "*cg_ctx->mkldnn_descriptors["
                            << desc_index + 1 << "],\n";
@@ -899,7 +940,18 @@ namespace ngraph
                         writer << "ops.append_sum(dyn_post_op_scales[0]);\n";
                     }
 
-                    if (has_relu<OP>(node))
+                    if (has_relu<OP>(node) && std::isfinite(get_relu_upper_bound<OP>(node)))
+                    {
+                        writer << "const float ops_scale = 1.f;\n";
+                        writer << "const float ops_alpha = "
+                               << std::to_string(get_relu_upper_bound<OP>(node))
+                               << "; // upper bound\n";
+                        writer << "const float ops_beta = 0.f;\n";
+                        writer << "ops.append_eltwise("
+                                  "ops_scale, mkldnn::algorithm::eltwise_bounded_relu, ops_alpha, "
+                                  "ops_beta);\n";
+                    }
+                    else if (has_relu<OP>(node))
                     {
                         writer << "const float ops_scale = 1.f;\n";
                         writer << "const float ops_alpha = -0.f; // relu negative slope\n";
@@ -1711,6 +1763,8 @@ static const PrimitiveBuildStringConstructOpMap prim_build_string_construct_disp
      &MKLDNNPrimitiveBuildPass::construct_primitive_build_string<BatchNormTrainingRelu>},
     {TI(BatchNormTrainingBackprop),
      &MKLDNNPrimitiveBuildPass::construct_primitive_build_string<BatchNormTrainingBackprop>},
+    {TI(BatchNormTrainingReluBackprop),
+     &MKLDNNPrimitiveBuildPass::construct_primitive_build_string<BatchNormTrainingReluBackprop>},
     {TI(LRN), &MKLDNNPrimitiveBuildPass::construct_primitive_build_string<LRN>},
     {TI(Lstm), &MKLDNNPrimitiveBuildPass::construct_primitive_build_string<Lstm>},
     {TI(Rnn), &MKLDNNPrimitiveBuildPass::construct_primitive_build_string<Rnn>},
@@ -1757,6 +1811,7 @@ static bool in_new_map(const std::shared_ptr<Node>& node)
         std::dynamic_pointer_cast<ngraph::op::BatchNormInferenceRelu>(node) ||
         std::dynamic_pointer_cast<ngraph::op::BatchNormTrainingRelu>(node) ||
         std::dynamic_pointer_cast<ngraph::op::BatchNormTrainingBackprop>(node) ||
+        std::dynamic_pointer_cast<ngraph::op::BatchNormTrainingReluBackprop>(node) ||
         std::dynamic_pointer_cast<ngraph::op::LRN>(node) ||
         std::dynamic_pointer_cast<ngraph::op::Lstm>(node) ||
         std::dynamic_pointer_cast<ngraph::op::Rnn>(node) ||
@@ -21,8 +21,11 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
 #include "ngraph/op/convolution.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
@@ -267,3 +270,176 @@ void ngraph::runtime::cpu::pass::CPUPostLayoutOptimizations::
         cvt_lt, "CPUPostLayoutOptimizations.ConstructReshapeConvertLayoutFusion");
     this->add_matcher(m, callback);
 }
+
+// Convert, Quantize and Dequantize next to a ConvertLayout
+// A ConvertLayout is an MKLDNN reorder, which can also change the data type and scale the
+// values on the way. Quantize and Dequantize run on MKLDNN are scaled reorders already, and
+// Convert is one with unit scale for the conversions below. Either way the pair is folded into
+// a single reorder, which saves a pass over the tensor and its intermediate buffer.
+// E.g.,
+// u8 (nchw) --(Convert)--> f32 (nchw) --(ConvertLayout)--> f32 (nChw16c)
+// is changed to
+// u8 (nchw) --(ConvertLayout)--> f32 (nChw16c)
+
+// The conversions of Convert that a reorder computes alike. Reorders round to nearest and
+// saturate, while Convert truncates and wraps, so narrowing conversions are left alone.
+static bool is_reorder_conversion(const element::Type& from, const element::Type& to)
+{
+    if (to == element::f32)
+    {
+        return from == element::i8 || from == element::u8 || from == element::i32;
+    }
+    if (to == element::i32)
+    {
+        return from == element::i8 || from == element::u8;
+    }
+    return false;
+}
+
+static bool is_fusable_with_reorder(const shared_ptr<Node>& node)
+{
+    if (auto convert = dynamic_pointer_cast<ngraph::op::Convert>(node))
+    {
+        return is_reorder_conversion(convert->get_input_element_type(0),
+                                     convert->get_output_element_type(0));
+    }
+    return (dynamic_pointer_cast<ngraph::op::Quantize>(node) ||
+            dynamic_pointer_cast<ngraph::op::Dequantize>(node)) &&
+           runtime::cpu::mkldnn_utils::use_mkldnn_kernel(node.get());
+}
+
+// Whether a single reorder can go from `input_md` to `output_md`. The ConvertLayout builder
+// reinterprets some weight layouts instead of reordering them, which would lose the conversion.
+static bool can_fuse_reorder(const mkldnn::memory::desc& input_md,
+                             const mkldnn::memory::desc& output_md)
+{
+    return input_md.data.format != mkldnn_format_undef &&
+           output_md.data.format != mkldnn_format_undef &&
+           input_md.data.ndims == output_md.data.ndims &&
+           output_md.data.format != mkldnn_goihw &&
+           output_md.data.format != mkldnn_OIhw4i16o4i_s8s8;
+}
+
+void ngraph::runtime::cpu::pass::CPUPostLayoutOptimizations::
+    construct_convert_convertLayout_fusion()
+{
+    auto input = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{1, 1, 1, 1}, is_fusable_with_reorder);
+    auto lt_desc =
+        std::make_shared<runtime::cpu::LayoutDescriptor>(*input->get_output_tensor_ptr());
+    auto cvt_lt = std::make_shared<runtime::cpu::op::ConvertLayout>(input, lt_desc);
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_convert_convertLayout against "
+                     << m.get_match_root()->get_name();
+
+        auto cvt_lt_m = static_pointer_cast<runtime::cpu::op::ConvertLayout>(m.get_match_root());
+        auto convert_m = cvt_lt_m->get_argument(0);
+
+        if (convert_m->get_users().size() > 1)
+        {
+            NGRAPH_DEBUG << "ConvertConvertLayout: " << convert_m->get_name()
+                         << " has multiple users";
+            return false;
+        }
+
+        auto& out_md = runtime::cpu::mkldnn_utils::get_output_mkldnn_md(cvt_lt_m.get(), 0);
+        if (!can_fuse_reorder(
+                runtime::cpu::mkldnn_utils::get_input_mkldnn_md(convert_m.get(), 0), out_md))
+        {
+            NGRAPH_DEBUG << "ConvertConvertLayout: layouts cannot be reordered in one step";
+            return false;
+        }
+
+        if (dynamic_pointer_cast<ngraph::op::Convert>(convert_m))
+        {
+            // Reorder the input of the Convert straight to the converted layout
+            auto cvt_lt_n_layout = std::make_shared<runtime::cpu::LayoutDescriptor>(
+                *cvt_lt_m->get_output_tensor_ptr());
+            cvt_lt_n_layout->set_mkldnn_md(out_md);
+            auto cvt_lt_n = std::make_shared<runtime::cpu::op::ConvertLayout>(
+                convert_m->get_argument(0),
+                convert_m->input(0).get_source_output().get_index(),
+                cvt_lt_n_layout);
+            cvt_lt_n->set_op_annotations(cvt_lt_m->get_op_annotations());
+            ngraph::replace_node(cvt_lt_m, cvt_lt_n);
+        }
+        else
+        {
+            // Let the scaled reorder of Quantize or Dequantize write the converted layout
+            convert_m->get_output_tensor_ptr()->set_tensor_layout(
+                cvt_lt_m->get_output_tensor_ptr()->get_tensor_layout());
+            ngraph::replace_node(cvt_lt_m, convert_m);
+        }
+        NGRAPH_DEBUG << "ConvertConvertLayout: Folded " << convert_m->get_name() << " and "
+                     << cvt_lt_m->get_name() << " into one reorder";
+
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(
+        cvt_lt, "CPUPostLayoutOptimizations.ConstructConvertConvertLayoutFusion");
+    this->add_matcher(m, callback);
+}
+
+void ngraph::runtime::cpu::pass::CPUPostLayoutOptimizations::
+    construct_convertLayout_convert_fusion()
+{
+    auto convert = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{1, 1, 1, 1}, [](shared_ptr<Node> n) {
+            return is_fusable_with_reorder(n) &&
+                   dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(n->get_argument(0));
+        });
+
+    auto callback = [](pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_convertLayout_convert against "
+                     << m.get_match_root()->get_name();
+
+        auto convert_m = m.get_match_root();
+        auto cvt_lt_m =
+            static_pointer_cast<runtime::cpu::op::ConvertLayout>(convert_m->get_argument(0));
+
+        if (cvt_lt_m->get_users().size() > 1)
+        {
+            NGRAPH_DEBUG << "ConvertLayoutConvert: " << cvt_lt_m->get_name()
+                         << " has multiple users";
+            return false;
+        }
+
+        auto& out_md = runtime::cpu::mkldnn_utils::get_output_mkldnn_md(convert_m.get(), 0);
+        if (!can_fuse_reorder(runtime::cpu::mkldnn_utils::get_input_mkldnn_md(cvt_lt_m.get(), 0),
+                              out_md))
+        {
+            NGRAPH_DEBUG << "ConvertLayoutConvert: layouts cannot be reordered in one step";
+            return false;
+        }
+
+        if (dynamic_pointer_cast<ngraph::op::Convert>(convert_m))
+        {
+            // Reorder the input of the ConvertLayout straight to the output of the Convert
+            auto cvt_lt_n_layout = std::make_shared<runtime::cpu::LayoutDescriptor>(
+                *convert_m->get_output_tensor_ptr());
+            cvt_lt_n_layout->set_mkldnn_md(out_md);
+            auto cvt_lt_n = std::make_shared<runtime::cpu::op::ConvertLayout>(
+                cvt_lt_m->get_argument(0),
+                cvt_lt_m->input(0).get_source_output().get_index(),
+                cvt_lt_n_layout);
+            cvt_lt_n->set_op_annotations(cvt_lt_m->get_op_annotations());
+            ngraph::replace_node(convert_m, cvt_lt_n);
+        }
+        else
+        {
+            // Let the scaled reorder of Quantize or Dequantize read the original layout
+            convert_m->input(0).replace_source_output(cvt_lt_m->input(0).get_source_output());
+            convert_m->invalidate_structural_hash();
+        }
+        NGRAPH_DEBUG << "ConvertLayoutConvert: Folded " << cvt_lt_m->get_name() << " and "
+                     << convert_m->get_name() << " into one reorder";
+
+        return true;
+    };
+
+    auto m = make_shared<pattern::Matcher>(
+        convert, "CPUPostLayoutOptimizations.ConstructConvertLayoutConvertFusion");
+    this->add_matcher(m, callback);
+}
@@ -42,8 +42,14 @@ public:
         construct_weight_fusion();
         construct_slice_convertLayout_fusion();
         construct_reshape_convertLayout_fusion();
+        construct_convert_convertLayout_fusion();
+        construct_convertLayout_convert_fusion();
     }
     void construct_weight_fusion();
     void construct_slice_convertLayout_fusion();
     void construct_reshape_convertLayout_fusion();
+    /// \brief Folds a Convert, Quantize or Dequantize into the ConvertLayout reading its output
+    void construct_convert_convertLayout_fusion();
+    /// \brief Folds a ConvertLayout into the Convert, Quantize or Dequantize reading its output
+    void construct_convertLayout_convert_fusion();
 };
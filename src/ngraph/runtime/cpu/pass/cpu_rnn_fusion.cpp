@@ -29,19 +29,23 @@
 #include "ngraph/op/broadcast.hpp"
 #include "ngraph/op/concat.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/divide.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/exp.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/multiply.hpp"
 #include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/op/quantize.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
 #include "ngraph/op/slice.hpp"
+#include "ngraph/op/subtract.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -62,6 +66,176 @@
     }
 
 using namespace ngraph;
+
+// Reads a per-tensor f32 scale, which must be a constant with a single element
+static bool get_scalar_scale(const std::shared_ptr<Node>& node, float& scale)
+{
+    auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node);
+    if (!constant || constant->get_element_type() != element::f32 ||
+        shape_size(constant->get_shape()) != 1)
+    {
+        return false;
+    }
+    scale = constant->get_vector<float>()[0];
+    return true;
+}
+
+// True if the gate pre-activations computed by node are sliced into at least two gates,
+// reaching the Slices directly or through the bias and recurrent projection Adds
+static bool feeds_rnn_gates(const std::shared_ptr<Node>& node)
+{
+    NodeVector frontier{node};
+    for (size_t depth = 0; depth < 3 && !frontier.empty(); depth++)
+    {
+        size_t gate_slices = 0;
+        NodeVector next;
+        for (auto& n : frontier)
+        {
+            for (auto& user : n->get_users())
+            {
+                if (std::dynamic_pointer_cast<ngraph::op::Add>(user))
+                {
+                    next.push_back(user);
+                }
+                else if (std::dynamic_pointer_cast<ngraph::op::Slice>(user))
+                {
+                    for (auto& activation : user->get_users())
+                    {
+                        if (std::dynamic_pointer_cast<ngraph::op::Sigmoid>(activation) ||
+                            std::dynamic_pointer_cast<ngraph::op::Tanh>(activation) ||
+                            std::dynamic_pointer_cast<ngraph::op::Negative>(activation))
+                        {
+                            gate_slices++;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+        if (gate_slices >= 2)
+        {
+            return true;
+        }
+        frontier = next;
+    }
+    return false;
+}
+
+template <typename T>
+static std::vector<float> dequantize_transposed_weights(const ngraph::op::Constant& weights,
+                                                        float scale)
+{
+    // QuantizedDot weights are [oc, ic], Dot weights are [ic, oc]
+    auto oc = weights.get_shape()[0];
+    auto ic = weights.get_shape()[1];
+    auto values = weights.get_vector<T>();
+    std::vector<float> result(ic * oc);
+    for (size_t o = 0; o < oc; o++)
+    {
+        for (size_t i = 0; i < ic; i++)
+        {
+            result[i * oc + o] = static_cast<float>(values[o * ic + i]) * scale;
+        }
+    }
+    return result;
+}
+
+void ngraph::runtime::cpu::pass::QuantizedRnnDotLowering::construct_quantized_dot()
+{
+    auto input = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50});
+    auto input_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto input_zero = std::make_shared<pattern::op::Label>(element::i8, Shape{});
+    auto quantize = std::make_shared<ngraph::op::Quantize>(
+        input,
+        input_scale,
+        input_zero,
+        element::i8,
+        AxisSet{},
+        ngraph::op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+    auto weights = std::make_shared<pattern::op::Label>(element::i8, Shape{400, 50});
+    auto dot_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto qdot =
+        std::make_shared<ngraph::op::QuantizedDot>(quantize, weights, dot_scale, false, false);
+    auto output_scale = std::make_shared<pattern::op::Label>(element::f32, Shape{});
+    auto output_zero = std::make_shared<pattern::op::Label>(element::i32, Shape{});
+    auto dequantize = std::make_shared<ngraph::op::Dequantize>(
+        qdot, output_scale, output_zero, element::f32, AxisSet{});
+
+    auto callback = [input, input_scale, input_zero, weights, dot_scale, output_scale, output_zero](
+        pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_quantized_dot against "
+                     << m.get_match_root()->get_name();
+        auto pattern_map = m.get_pattern_map();
+
+        auto dq = std::static_pointer_cast<ngraph::op::Dequantize>(m.get_match_root());
+        auto qdot = std::static_pointer_cast<ngraph::op::QuantizedDot>(dq->get_argument(0));
+        auto q = std::static_pointer_cast<ngraph::op::Quantize>(qdot->get_argument(0));
+        if (qdot->requantize() || qdot->with_relu() || !q->get_axes().empty() ||
+            !dq->get_axes().empty())
+        {
+            NGRAPH_DEBUG << "Only per-tensor QuantizedDots with i32 outputs are lowered";
+            return false;
+        }
+
+        if (!ngraph::is_zero(pattern_map[input_zero]) ||
+            !ngraph::is_zero(pattern_map[output_zero]))
+        {
+            NGRAPH_DEBUG << "Quantization with a zero point offset is not lowered";
+            return false;
+        }
+
+        float in_scale, qdot_scale, out_scale;
+        if (!get_scalar_scale(pattern_map[input_scale], in_scale) ||
+            !get_scalar_scale(pattern_map[dot_scale], qdot_scale) ||
+            !get_scalar_scale(pattern_map[output_scale], out_scale) || in_scale == 0.0f)
+        {
+            NGRAPH_DEBUG << "Scales are not constant";
+            return false;
+        }
+
+        auto weights_constant =
+            std::dynamic_pointer_cast<ngraph::op::Constant>(pattern_map[weights]);
+        if (!weights_constant)
+        {
+            NGRAPH_DEBUG << "Weights are not constant";
+            return false;
+        }
+
+        if (!feeds_rnn_gates(dq))
+        {
+            NGRAPH_DEBUG << "QuantizedDot does not compute recurrent cell gates";
+            return false;
+        }
+
+        // x_q = x / in_scale and dq = sum(x_q * w_q) * qdot_scale * out_scale
+        float weights_scale = qdot_scale * out_scale / in_scale;
+        std::vector<float> weights_f32;
+        auto weights_et = weights_constant->get_element_type();
+        if (weights_et == element::i8)
+        {
+            weights_f32 = dequantize_transposed_weights<int8_t>(*weights_constant, weights_scale);
+        }
+        else if (weights_et == element::u8)
+        {
+            weights_f32 = dequantize_transposed_weights<uint8_t>(*weights_constant, weights_scale);
+        }
+        else
+        {
+            NGRAPH_DEBUG << "Unsupported weights element type " << weights_et;
+            return false;
+        }
+
+        auto& weights_shape = weights_constant->get_shape();
+        auto dot_weights = std::make_shared<ngraph::op::Constant>(
+            element::f32, Shape{weights_shape[1], weights_shape[0]}, weights_f32);
+        auto dot = std::make_shared<ngraph::op::Dot>(pattern_map[input], dot_weights);
+        ngraph::replace_node(m.get_match_root(), dot);
+        return true;
+    };
+    auto m = std::make_shared<pattern::Matcher>(dequantize, "QuantizedRnnDotLowering");
+    this->add_matcher(m, callback);
+}
+
 void ngraph::runtime::cpu::pass::LSTMFusion::construct_sigmoid()
 {
     // construct variance
@@ -323,6 +497,166 @@ void ngraph::runtime::cpu::pass::LSTMFusion::construct_lstm_fprop()
     this->add_matcher(m, callback);
 }
 
+void ngraph::runtime::cpu::pass::GRUFusion::construct_gru_fprop()
+{
+    // This pattern captures the MKL-DNN GRU cell equations in the given data flow graph
+    //
+    //   u_t = sigmoid(W_u x_t + U_u h_{(t-1)} + b_u);
+    //   r_t = sigmoid(W_r x_t + U_r h_{(t-1)} + b_r);
+    //   o_t = tanh   (W_o x_t + U_o (r_t * h_{(t-1)}) + b_o);
+    //   h_t = u_t * h_{(t-1)} + (1 - u_t) * o_t;
+    //
+    // Assumes the input weights of the 3 gates are fused in the order update (u),
+    // reset (r) and candidate (o), and the recurrent weights of u and r are fused
+    // separately from U_o, as the latter is applied after the reset gate
+    auto xt = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 100});
+    auto ht_1 = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50});
+    auto w_i2h = std::make_shared<pattern::op::Label>(element::f32, Shape{100, 150});
+    auto bias_i2h = std::make_shared<pattern::op::Label>(element::f32, Shape{150});
+    auto w_h2h_ur = std::make_shared<pattern::op::Label>(element::f32, Shape{50, 100});
+    auto w_h2h_o = std::make_shared<pattern::op::Label>(element::f32, Shape{50, 50});
+    auto one = std::make_shared<pattern::op::Label>(
+        element::f32, Shape{}, pattern::has_class<ngraph::op::Constant>());
+
+    auto broadcast_pred = [](std::shared_ptr<Node> n) {
+        return ((std::dynamic_pointer_cast<ngraph::op::Broadcast>(n) != nullptr) ||
+                (std::dynamic_pointer_cast<ngraph::op::Reshape>(n) != nullptr));
+    };
+
+    // (W_u | W_r | W_o) * x_t + (b_u | b_r | b_o)
+    auto dot_i2h = std::make_shared<ngraph::op::Dot>(xt, w_i2h);
+    auto add_i2h = std::make_shared<ngraph::op::Add>(
+        dot_i2h, std::make_shared<pattern::op::Skip>(bias_i2h, broadcast_pred));
+    auto x_proj = std::make_shared<pattern::op::Label>(add_i2h, nullptr, NodeVector{add_i2h});
+    // (U_u | U_r) * h_{(t-1)}
+    auto dot_h2h = std::make_shared<ngraph::op::Dot>(ht_1, w_h2h_ur);
+    auto h_proj = std::make_shared<pattern::op::Label>(dot_h2h, nullptr, NodeVector{dot_h2h});
+
+    // the matcher does not compare the slice bounds, so the gate slices are labelled
+    // and checked in the callback
+    auto make_gate_slice = [](std::shared_ptr<Node> arg, size_t gate) {
+        auto slice = std::make_shared<ngraph::op::Slice>(
+            arg, Coordinate{0, gate * 50}, Coordinate{10, (gate + 1) * 50});
+        return std::make_shared<pattern::op::Label>(slice, nullptr, NodeVector{slice});
+    };
+    auto x_u = make_gate_slice(x_proj, 0);
+    auto x_r = make_gate_slice(x_proj, 1);
+    auto x_o = make_gate_slice(x_proj, 2);
+    auto h_u = make_gate_slice(h_proj, 0);
+    auto h_r = make_gate_slice(h_proj, 1);
+
+    // construct gates
+    auto ut = std::make_shared<ngraph::op::Sigmoid>(std::make_shared<ngraph::op::Add>(x_u, h_u));
+    auto rt = std::make_shared<ngraph::op::Sigmoid>(std::make_shared<ngraph::op::Add>(x_r, h_r));
+    auto ot = std::make_shared<ngraph::op::Tanh>(std::make_shared<ngraph::op::Add>(
+        x_o,
+        std::make_shared<ngraph::op::Dot>(std::make_shared<ngraph::op::Multiply>(rt, ht_1),
+                                          w_h2h_o)));
+
+    // construct (h_t)
+    auto one_minus_ut = std::make_shared<ngraph::op::Subtract>(
+        std::make_shared<pattern::op::Skip>(one, broadcast_pred), ut);
+    auto ht = std::make_shared<ngraph::op::Add>(std::make_shared<ngraph::op::Multiply>(ut, ht_1),
+                                                std::make_shared<ngraph::op::Multiply>(
+                                                    one_minus_ut, ot));
+
+    // Define a call back that needs to called once the DFG matches the pattern
+    auto callback = [xt, ht_1, w_i2h, bias_i2h, w_h2h_ur, w_h2h_o, one, x_u, x_r, x_o, h_u, h_r](
+        pattern::Matcher& m) {
+        NGRAPH_DEBUG << "In a callback for construct_gru_fprop pattern against "
+                     << m.get_match_root()->get_name();
+
+        auto pattern_map = m.get_pattern_map();
+
+        if (m.get_match_root()->get_element_type() != element::f32)
+        {
+            NGRAPH_DEBUG << "mpattern = " << m.get_match_root()->get_name()
+                         << " type is not float!";
+            return false;
+        }
+
+        CHECK_RANK(pattern_map[xt], 2);
+        CHECK_RANK(pattern_map[ht_1], 2);
+        CHECK_RANK(pattern_map[w_i2h], 2);
+        CHECK_RANK(pattern_map[w_h2h_ur], 2);
+        CHECK_RANK(pattern_map[w_h2h_o], 2);
+        CHECK_RANK(pattern_map[bias_i2h], 1);
+
+        if (!ngraph::is_one(pattern_map[one]))
+        {
+            NGRAPH_DEBUG << "Update gate is not subtracted from one";
+            return false;
+        }
+
+        // set GRU cell attributes
+        size_t gru_n_gates = 3;
+        size_t batch_size = pattern_map[xt]->get_shape()[0];
+        auto slc = pattern_map[w_i2h]->get_shape()[0];
+        auto dic = pattern_map[w_h2h_o]->get_shape()[1];
+        auto sic = pattern_map[w_h2h_o]->get_shape()[0];
+        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type =
+            ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru;
+
+        if (sic != dic || pattern_map[ht_1]->get_shape() != Shape{batch_size, dic})
+        {
+            NGRAPH_DEBUG << "Not fusing, since GRU kernel requires the recurrent state feature "
+                         << "size to be the same for the input and output";
+            return false;
+        }
+
+        if (pattern_map[w_i2h]->get_shape()[1] != gru_n_gates * dic ||
+            pattern_map[w_h2h_ur]->get_shape() != Shape{sic, 2 * dic} ||
+            pattern_map[bias_i2h]->get_shape() != Shape{gru_n_gates * dic})
+        {
+            NGRAPH_DEBUG << "Weights and bias do not hold the 3 gates of the GRU cell";
+            return false;
+        }
+
+        // every gate slice must take all the rows and the columns of its gate
+        auto check_gate_slice = [&](std::shared_ptr<pattern::op::Label> label, size_t gate) {
+            auto slice = std::static_pointer_cast<ngraph::op::Slice>(pattern_map[label]);
+            return slice->get_lower_bounds() == Coordinate{0, gate * dic} &&
+                   slice->get_upper_bounds() == Coordinate{batch_size, (gate + 1) * dic} &&
+                   slice->get_strides() == Strides{1, 1};
+        };
+        if (!check_gate_slice(x_u, 0) || !check_gate_slice(x_r, 1) ||
+            !check_gate_slice(x_o, 2) || !check_gate_slice(h_u, 0) || !check_gate_slice(h_r, 1))
+        {
+            NGRAPH_DEBUG << "Gate slices are not in the (u, r, o) order";
+            return false;
+        }
+
+        if (pattern_map[xt]->get_shape()[1] != slc)
+        {
+            NGRAPH_DEBUG << "Feature size mismatch between weights and input tensors";
+            return false;
+        }
+
+        auto weights_iter = std::make_shared<ngraph::op::Concat>(
+            NodeVector{pattern_map[w_h2h_ur], pattern_map[w_h2h_o]}, 1);
+
+        auto rnn = std::make_shared<ngraph::op::Rnn>(pattern_map[xt],
+                                                     pattern_map[ht_1],
+                                                     pattern_map[w_i2h],
+                                                     weights_iter,
+                                                     pattern_map[bias_i2h],
+                                                     1,
+                                                     gru_n_gates,
+                                                     1,
+                                                     1,
+                                                     1,
+                                                     1,
+                                                     rnn_type);
+
+        // with a single timestep and a single state, dst_layer holds h_t
+        auto rnn_ht_output = std::make_shared<ngraph::op::GetOutputElement>(rnn, 0);
+        ngraph::replace_node(m.get_match_root(), rnn_ht_output);
+        return true;
+    };
+    auto m = std::make_shared<pattern::Matcher>(ht, "GRUFusion.Fprop");
+    this->add_matcher(m, callback);
+}
+
 void ngraph::runtime::cpu::pass::RNNFusion::construct_rnn_lstm_fprop()
 {
     // Captures multiple LSTM cells corresponding to the timesteps of a single RNN
@@ -564,6 +898,140 @@ void ngraph::runtime::cpu::pass::RNNFusion::construct_rnn_lstm_fprop()
     this->add_matcher(m, callback);
 }
 
+void ngraph::runtime::cpu::pass::RNNFusion::construct_rnn_gru_fprop()
+{
+    // Captures the single timestep GRU Rnn's created by GRUFusion for the timesteps of a
+    // single layer. The hidden state of a cell is the src_iter of the next one, while the
+    // weights and the bias are shared across cells
+    auto gru_src_layer = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 100});
+    auto gru_src_iter = std::make_shared<pattern::op::Label>(element::f32, Shape{10, 50});
+    auto gru_weights_layer = std::make_shared<pattern::op::Label>(element::f32, Shape{100, 150});
+    auto gru_weights_iter_ur = std::make_shared<pattern::op::Label>(element::f32, Shape{50, 100});
+    auto gru_weights_iter_o = std::make_shared<pattern::op::Label>(element::f32, Shape{50, 50});
+    auto gru_weights_iter = std::make_shared<ngraph::op::Concat>(
+        NodeVector{gru_weights_iter_ur, gru_weights_iter_o}, 1);
+    auto gru_bias = std::make_shared<pattern::op::Label>(element::f32, Shape{150});
+    ngraph::runtime::cpu::rnn_utils::rnntype ref_rnn_type =
+        ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru;
+
+    auto gru = std::make_shared<ngraph::op::Rnn>(gru_src_layer,
+                                                 gru_src_iter,
+                                                 gru_weights_layer,
+                                                 gru_weights_iter,
+                                                 gru_bias,
+                                                 1,
+                                                 3,
+                                                 1,
+                                                 1,
+                                                 1,
+                                                 1,
+                                                 ref_rnn_type);
+    auto gru_goe = std::make_shared<ngraph::op::GetOutputElement>(gru, 0);
+    // We cannot attach labels to multi-output nodes, so we attach a label to the goe instead
+    auto gru_goe_label =
+        std::make_shared<pattern::op::Label>(gru_goe, nullptr, NodeVector{gru_goe});
+
+    auto callback = [gru_goe_label, gru_src_layer, gru_src_iter, gru_weights_layer, gru_bias](
+        pattern::RecurrentMatcher& m) {
+
+        NGRAPH_DEBUG << " In recurrent GRU fusion callback";
+
+        const auto sequence_len = m.get_number_of_recurrent_matches();
+        if (sequence_len < 2)
+        {
+            NGRAPH_DEBUG << "Single timestep RNN";
+            return false;
+        }
+
+        // PM captures the cells in the reverse order, {GRU_t, ..., GRU_1, GRU_0}
+        auto gru_goes = m.get_bound_nodes_for_pattern(gru_goe_label);
+        std::reverse(gru_goes.begin(), gru_goes.end());
+        std::vector<std::shared_ptr<ngraph::op::Rnn>> gru_nodes;
+        for (auto gru_goe : gru_goes)
+        {
+            auto gru_node = std::static_pointer_cast<ngraph::op::Rnn>(gru_goe->get_argument(0));
+            if (gru_node->get_rnn_type() != ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru ||
+                gru_node->get_num_timesteps() != 1 || gru_node->get_direction() != 1 ||
+                gru_node->get_num_fused_layers() != 1)
+            {
+                NGRAPH_DEBUG << "Not fusing, " << gru_node->get_name()
+                             << " is not a single GRU cell";
+                return false;
+            }
+            gru_nodes.push_back(gru_node);
+        }
+
+        // src_layer -> concatenate input symbols from different GRU cells belonging to same
+        // RNN layer in the order 0, 1, 2... t time slice
+        auto src_layers = m.get_bound_nodes_for_pattern(gru_src_layer);
+        std::reverse(src_layers.begin(), src_layers.end());
+        auto rnn_src_layer = std::make_shared<ngraph::op::Concat>(src_layers, 0);
+        // pick src_iter from first GRU
+        auto rnn_src_iter = m.get_bound_nodes_for_pattern(gru_src_iter)[sequence_len - 1];
+        // weights and bias are shared across GRUs. so pick any
+        auto rnn_weights_layer = m.get_bound_nodes_for_pattern(gru_weights_layer)[0];
+        auto rnn_weights_iter = gru_nodes[0]->get_argument(3);
+        auto rnn_bias = m.get_bound_nodes_for_pattern(gru_bias)[0];
+
+        const size_t gru_n_gates = 3;
+        const size_t batch_size = rnn_src_iter->get_shape()[0];
+        const size_t src_iter_feature_size = rnn_src_iter->get_shape()[1];
+        const size_t num_cell_states = 1;
+        const size_t direction = 1;
+        const size_t num_fused_rnn_layers = 1;
+        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type =
+            ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_gru;
+
+        NGRAPH_DEBUG << "src_layer: " << join(rnn_src_layer->get_shape());
+        NGRAPH_DEBUG << "src_iter: " << join(rnn_src_iter->get_shape());
+        NGRAPH_DEBUG << "weights_layer: " << join(rnn_weights_layer->get_shape());
+        NGRAPH_DEBUG << "weights_iter: " << join(rnn_weights_iter->get_shape());
+        NGRAPH_DEBUG << "bias: " << join(rnn_bias->get_shape());
+        NGRAPH_DEBUG << "src_seq_len: " << sequence_len;
+        NGRAPH_DEBUG << "batch_size: " << batch_size;
+
+        auto rnn = std::make_shared<ngraph::op::Rnn>(rnn_src_layer,
+                                                     rnn_src_iter,
+                                                     rnn_weights_layer,
+                                                     rnn_weights_iter,
+                                                     rnn_bias,
+                                                     sequence_len,
+                                                     gru_n_gates,
+                                                     sequence_len,
+                                                     num_cell_states,
+                                                     direction,
+                                                     num_fused_rnn_layers,
+                                                     rnn_type);
+        auto rnn_ht_goe = std::make_shared<ngraph::op::GetOutputElement>(rnn, 0);
+
+        // both outputs of a GRU cell hold its h_t, which is a row slice of the fused dst_layer
+        for (size_t i = 0, start_index = 0; i < sequence_len; i++, start_index += batch_size)
+        {
+            auto ht_slice = std::make_shared<ngraph::op::Slice>(
+                rnn_ht_goe,
+                Coordinate{start_index, 0},
+                Coordinate{start_index + batch_size, src_iter_feature_size});
+            for (auto goe : ngraph::op::get_output_elements(gru_nodes[i]))
+            {
+                if (goe)
+                {
+                    ngraph::replace_node(goe, ht_slice);
+                }
+            }
+        }
+        NGRAPH_DEBUG << "End of recurrent GRU fusion call back "
+                     << "matched_node: " << m.get_match_root()->get_name();
+        return true;
+    };
+
+    auto m = std::make_shared<pattern::RecurrentMatcher>(
+        gru_goe_label,
+        gru_src_iter,
+        std::set<std::shared_ptr<pattern::op::Label>>{
+            gru_weights_layer, gru_weights_iter_ur, gru_weights_iter_o, gru_bias});
+    this->add_matcher(m, callback);
+}
+
 static std::shared_ptr<Node> stack_rnn_inputs(NodeVector rnn_input_nodes)
 {
     std::reverse(rnn_input_nodes.begin(), rnn_input_nodes.end());
@@ -655,7 +1123,8 @@ void ngraph::runtime::cpu::pass::MultiLayerRNNFusion::construct_multi_layer_rnn_
                 (rnn_node->get_src_sequence_length() != sequence_len) ||
                 (rnn_node->get_src_iter_feature_size() != src_iter_feature_size) ||
                 (rnn_node->get_num_cell_states() != num_rnn_cell_states) ||
-                (rnn_node->get_direction() != rnn_direction))
+                (rnn_node->get_direction() != rnn_direction) ||
+                (rnn_node->get_rnn_type() != rnn_type))
             {
                 NGRAPH_DEBUG << "RNN attributes dont match";
                 return false;
@@ -717,11 +1186,13 @@ void ngraph::runtime::cpu::pass::MultiLayerRNNFusion::construct_multi_layer_rnn_
 
             // multi layerd fused rnn second output {GOE1} holds the recurrent output state tensors for the last cell
             // of all the layers, {{ht_1 | ct_1} || {ht2 |ct2} || ....{htn | ctn}}
-            // we will slice the cell state output tensor {ct_*} from the fused RNN kerenel output and feeds
-            // {ct_*} consumer if any
+            // we will slice the last state of each layer, {ct_*} for lstm or {ht_*} for gru,
+            // from the fused RNN kerenel output and feeds its consumer if any
             auto ct_slice = std::make_shared<ngraph::op::Slice>(
                 mrnn_ht_ct,
-                Coordinate{((layer - 1) * batch_size * num_rnn_cell_states) + batch_size, 0},
+                Coordinate{((layer - 1) * batch_size * num_rnn_cell_states) +
+                               (num_rnn_cell_states - 1) * batch_size,
+                           0},
                 Coordinate{layer * batch_size * num_rnn_cell_states, src_iter_feature_size});
 
             replace_collapse_node_user(rnn_ct_goe1, ct_slice->get_outputs().at(0));
@@ -831,6 +1302,14 @@ void ngraph::runtime::cpu::pass::BiDirectionalRnn::construct_bidirectional_rnn()
             return false;
         }
 
+        if (rnn_ltor_node->get_rnn_type() != rnn_rtol_node->get_rnn_type() ||
+            rnn_ltor_node->get_gates_per_cell() != rnn_rtol_node->get_gates_per_cell() ||
+            rnn_ltor_node->get_num_cell_states() != rnn_rtol_node->get_num_cell_states())
+        {
+            NGRAPH_DEBUG << " Not fusing, cell type of rnn's in both direction should match";
+            return false;
+        }
+
         if (rnn_ltor_node->get_batch_size() != rnn_rtol_node->get_batch_size())
         {
             NGRAPH_DEBUG << " Not fusing, feature_size of rnn's in both direction should match";
@@ -849,8 +1328,7 @@ void ngraph::runtime::cpu::pass::BiDirectionalRnn::construct_bidirectional_rnn()
         size_t num_rnn_cell_states = rnn_ltor_node->get_num_cell_states();
         size_t rnn_direction = 2;
         size_t num_fused_rnn_layers = 1;
-        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type =
-            ngraph::runtime::cpu::rnn_utils::rnntype::vanilla_lstm;
+        ngraph::runtime::cpu::rnn_utils::rnntype rnn_type = rnn_ltor_node->get_rnn_type();
 
         auto construct_birnn_inputs = [&](int index) {
 
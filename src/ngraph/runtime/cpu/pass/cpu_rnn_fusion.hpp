@@ -28,7 +28,9 @@ namespace ngraph
         {
             namespace pass
             {
+                class QuantizedRnnDotLowering;
                 class LSTMFusion;
+                class GRUFusion;
                 class RNNFusion;
                 class BiDirectionalRnn;
                 class MultiLayerRNNFusion;
@@ -37,6 +39,28 @@ namespace ngraph
     }
 }
 
+/// \brief Lowers the int8 projections of quantized recurrent cells back to f32 Dots.
+///
+/// MKL-DNN 0.18 has no int8 RNN primitive, so a cell whose gate projections are written as
+/// Dequantize(QuantizedDot(Quantize(x), W_q)) can not be fused into an Rnn and runs as a chain
+/// of small int8 GEMMs and reorders per timestep. When W_q is a constant and the scales are
+/// per-tensor constants, the projection is replaced by a Dot with the weights dequantized at
+/// compile time, which lets LSTMFusion, GRUFusion and RNNFusion build the fused f32 Rnn.
+/// Only projections feeding gate Slices are lowered; other QuantizedDots keep the int8 path.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::QuantizedRnnDotLowering
+    : public ngraph::pass::GraphRewrite
+{
+public:
+    QuantizedRnnDotLowering()
+        : GraphRewrite()
+    {
+        construct_quantized_dot();
+    }
+
+private:
+    void construct_quantized_dot();
+};
+
 class CPU_BACKEND_API ngraph::runtime::cpu::pass::LSTMFusion : public ngraph::pass::GraphRewrite
 {
 public:
@@ -52,6 +76,30 @@ private:
     void construct_lstm_fprop();
 };
 
+/// \brief Replaces a GRU cell written with core ops by a single timestep GRU Rnn.
+///
+/// The cell must follow the MKL-DNN GRU equations with the gates fused in the order
+/// update (u), reset (r) and candidate (o):
+///
+///   u_t = sigmoid(W_u x_t + U_u h_{t-1} + b_u)
+///   r_t = sigmoid(W_r x_t + U_r h_{t-1} + b_r)
+///   o_t = tanh(W_o x_t + U_o (r_t * h_{t-1}) + b_o)
+///   h_t = u_t * h_{t-1} + (1 - u_t) * o_t
+///
+/// MKL-DNN has no separate recurrent bias, so only the input projection may carry a bias.
+class CPU_BACKEND_API ngraph::runtime::cpu::pass::GRUFusion : public ngraph::pass::GraphRewrite
+{
+public:
+    GRUFusion()
+        : GraphRewrite()
+    {
+        construct_gru_fprop();
+    }
+
+private:
+    void construct_gru_fprop();
+};
+
 class CPU_BACKEND_API ngraph::runtime::cpu::pass::RNNFusion
     : public ngraph::pass::RecurrentGraphRewrite
 {
@@ -60,10 +108,12 @@ public:
         : RecurrentGraphRewrite()
     {
         construct_rnn_lstm_fprop();
+        construct_rnn_gru_fprop();
     }
 
 private:
     void construct_rnn_lstm_fprop();
+    void construct_rnn_gru_fprop();
 };
 
 class CPU_BACKEND_API ngraph::runtime::cpu::pass::MultiLayerRNNFusion
@@ -123,6 +123,7 @@ bool runtime::cpu::pass::CPUWorkspaceInsertion::transform(pattern::Matcher& m)
                                                  m_max_pool->get_padding_below(),
                                                  m_max_pool->get_padding_above());
 
+    max_pool_with_indices->merge_provenance_tags_from(m_max_pool);
     auto max_pool_with_indices_output =
         std::make_shared<op::GetOutputElement>(max_pool_with_indices, 0);
     auto max_pool_with_indices_indices =
@@ -117,16 +117,6 @@ private:
 	}
 };
 
-extern "C" CPURuntimeContextCG* init_cg_ctx()
-{
-    return new CPURuntimeContextCG;
-}
-
-extern "C" void destroy_cg_ctx(CPURuntimeContextCG* cg_ctx)
-{
-    delete cg_ctx;
-}
-
 static void
 	deserialize_memory_descs_and_build_memory_primitives(std::ifstream& desc_file,
 														 CPURuntimeContextCG* cg_ctx,
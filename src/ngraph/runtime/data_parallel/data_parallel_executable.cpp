@@ -0,0 +1,298 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <exception>
+#include <future>
+#include <sstream>
+
+#include "ngraph/check.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/runtime/data_parallel/data_parallel_executable.hpp"
+#include "ngraph/specialize_shapes.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Parameters and results with a dynamic dimension 0 are split, or gathered, along it
+static bool is_batched(const PartialShape& shape)
+{
+    return shape.rank().is_static() && static_cast<size_t>(shape.rank()) > 0 &&
+           shape[0].is_dynamic();
+}
+
+template <typename T>
+static void sum_into(char* sum, const char* value, size_t size)
+{
+    T* s = reinterpret_cast<T*>(sum);
+    const T* v = reinterpret_cast<const T*>(value);
+    for (size_t i = 0; i < size / sizeof(T); i++)
+    {
+        s[i] += v[i];
+    }
+}
+
+runtime::data_parallel::DataParallelExecutable::DataParallelExecutable(
+    shared_ptr<Function> function,
+    const vector<shared_ptr<Backend>>& replicas,
+    bool enable_performance_collection)
+    : m_function(function)
+    , m_replicas(replicas)
+    , m_enable_performance_collection(enable_performance_collection)
+{
+    NGRAPH_CHECK(!m_replicas.empty(), "Data parallel execution needs at least one replica");
+    bool any_batched = false;
+    for (auto& parameter : function->get_parameters())
+    {
+        m_batched_parameters.push_back(is_batched(parameter->get_output_partial_shape(0)));
+        any_batched = any_batched || m_batched_parameters.back();
+    }
+    NGRAPH_CHECK(any_batched, "At least one parameter must have a dynamic batch axis");
+    for (auto& result : function->get_results())
+    {
+        m_batched_results.push_back(is_batched(result->get_output_partial_shape(0)));
+    }
+
+    set_parameters_and_results(*function);
+}
+
+runtime::data_parallel::DataParallelExecutable::~DataParallelExecutable()
+{
+    for (auto& variant : m_variants)
+    {
+        for (auto& replica : variant.second)
+        {
+            m_replicas[replica.backend]->remove_compiled_function(replica.executable);
+        }
+    }
+}
+
+vector<runtime::data_parallel::DataParallelExecutable::Replica>&
+    runtime::data_parallel::DataParallelExecutable::get_replicas(
+        const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    vector<Shape> key;
+    size_t batch_size = 0;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        key.push_back(inputs[i]->get_shape());
+        if (m_batched_parameters[i])
+        {
+            const Shape& shape = inputs[i]->get_shape();
+            NGRAPH_CHECK(shape.size() > 0, "Batched inputs must have a batch axis");
+            NGRAPH_CHECK(batch_size == 0 || batch_size == shape[0],
+                         "All batched inputs must have the same batch size");
+            batch_size = shape[0];
+        }
+    }
+    auto it = m_variants.find(key);
+    if (it != m_variants.end())
+    {
+        return it->second;
+    }
+    NGRAPH_CHECK(batch_size > 0, "Calls must have at least one sample");
+
+    // Slices differ by at most one sample; replicas left without a sample do not run
+    vector<Replica> replicas;
+    size_t batch_offset = 0;
+    for (size_t r = 0; r < m_replicas.size() && batch_offset < batch_size; r++)
+    {
+        Replica replica;
+        replica.backend = r;
+        replica.batch_offset = batch_offset;
+        replica.batch_size =
+            batch_size / m_replicas.size() + (r < batch_size % m_replicas.size() ? 1 : 0);
+        batch_offset += replica.batch_size;
+
+        vector<element::Type> arg_element_types;
+        vector<PartialShape> arg_shapes;
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            Shape shape = inputs[i]->get_shape();
+            if (m_batched_parameters[i])
+            {
+                shape[0] = replica.batch_size;
+            }
+            arg_element_types.push_back(inputs[i]->get_element_type());
+            arg_shapes.push_back(shape);
+        }
+
+        auto& backend = m_replicas[r];
+        auto clone = specialize_shapes(m_function, arg_element_types, arg_shapes);
+        replica.executable = backend->compile(clone, m_enable_performance_collection);
+        for (size_t i = 0; i < arg_shapes.size(); i++)
+        {
+            replica.inputs.push_back(
+                backend->create_tensor(arg_element_types[i], arg_shapes[i].to_shape()));
+        }
+        auto& results = replica.executable->get_results();
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            const Shape& shape = results[i]->get_shape();
+            NGRAPH_CHECK(!m_batched_results[i] || shape[0] == replica.batch_size,
+                         "Batched results must have the batch size as dimension 0, got ",
+                         shape);
+            replica.outputs.push_back(
+                backend->create_tensor(results[i]->get_element_type(), shape));
+        }
+        replicas.push_back(move(replica));
+    }
+    return m_variants.emplace(key, move(replicas)).first->second;
+}
+
+bool runtime::data_parallel::DataParallelExecutable::call(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == get_parameters().size(),
+                 "Call input count ",
+                 inputs.size(),
+                 " does not match Function's Parameter count ",
+                 get_parameters().size());
+    NGRAPH_CHECK(outputs.size() == get_results().size(),
+                 "Call output count ",
+                 outputs.size(),
+                 " does not match Function's Result count ",
+                 get_results().size());
+
+    vector<Replica>& replicas = get_replicas(inputs);
+    size_t batch_size = replicas.back().batch_offset + replicas.back().batch_size;
+
+    vector<vector<char>> host_inputs(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        host_inputs[i].resize(inputs[i]->get_size_in_bytes());
+        inputs[i]->read(host_inputs[i].data(), 0, host_inputs[i].size());
+    }
+
+    // Each replica copies its slice in, runs and copies its outputs back on its own thread
+    vector<vector<vector<char>>> host_outputs(replicas.size());
+    vector<future<bool>> calls;
+    for (size_t r = 0; r < replicas.size(); r++)
+    {
+        calls.push_back(async(launch::async, [&, r]() {
+            Replica& replica = replicas[r];
+            for (size_t i = 0; i < replica.inputs.size(); i++)
+            {
+                size_t size = replica.inputs[i]->get_size_in_bytes();
+                size_t offset = 0;
+                if (m_batched_parameters[i])
+                {
+                    offset = host_inputs[i].size() / batch_size * replica.batch_offset;
+                }
+                replica.inputs[i]->write(host_inputs[i].data() + offset, 0, size);
+            }
+            bool rc = replica.executable->call(replica.outputs, replica.inputs);
+            for (auto& output : replica.outputs)
+            {
+                host_outputs[r].emplace_back(output->get_size_in_bytes());
+                output->read(host_outputs[r].back().data(), 0, host_outputs[r].back().size());
+            }
+            return rc;
+        }));
+    }
+
+    // Wait for every replica before rethrowing the first failure
+    bool rc = true;
+    exception_ptr failure;
+    for (auto& f : calls)
+    {
+        try
+        {
+            rc = f.get() && rc;
+        }
+        catch (...)
+        {
+            if (!failure)
+            {
+                failure = current_exception();
+            }
+        }
+    }
+    if (failure)
+    {
+        rethrow_exception(failure);
+    }
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        if (m_batched_results[i])
+        {
+            size_t sample_size = host_outputs[0][i].size() / replicas[0].batch_size;
+            NGRAPH_CHECK(outputs[i]->get_size_in_bytes() == sample_size * batch_size,
+                         "Output ",
+                         i,
+                         " has ",
+                         outputs[i]->get_size_in_bytes(),
+                         " bytes, expected ",
+                         sample_size * batch_size);
+            for (size_t r = 0; r < replicas.size(); r++)
+            {
+                outputs[i]->write(host_outputs[r][i].data(),
+                                  sample_size * replicas[r].batch_offset,
+                                  host_outputs[r][i].size());
+            }
+        }
+        else
+        {
+            vector<char>& sum = host_outputs[0][i];
+            for (size_t r = 1; r < replicas.size(); r++)
+            {
+                accumulate(outputs[i]->get_element_type(),
+                           sum.data(),
+                           host_outputs[r][i].data(),
+                           sum.size());
+            }
+            NGRAPH_CHECK(outputs[i]->get_size_in_bytes() == sum.size(),
+                         "Output ",
+                         i,
+                         " has ",
+                         outputs[i]->get_size_in_bytes(),
+                         " bytes, expected ",
+                         sum.size());
+            outputs[i]->write(sum.data(), 0, sum.size());
+        }
+    }
+    return rc;
+}
+
+void runtime::data_parallel::DataParallelExecutable::accumulate(const element::Type& type,
+                                                                char* sum,
+                                                                const char* value,
+                                                                size_t size)
+{
+    stringstream ss;
+    switch (type.get_type_enum())
+    {
+    case element::Type_t::f32: sum_into<float>(sum, value, size); break;
+    case element::Type_t::f64: sum_into<double>(sum, value, size); break;
+    case element::Type_t::i8: sum_into<int8_t>(sum, value, size); break;
+    case element::Type_t::i16: sum_into<int16_t>(sum, value, size); break;
+    case element::Type_t::i32: sum_into<int32_t>(sum, value, size); break;
+    case element::Type_t::i64: sum_into<int64_t>(sum, value, size); break;
+    case element::Type_t::u8: sum_into<uint8_t>(sum, value, size); break;
+    case element::Type_t::u16: sum_into<uint16_t>(sum, value, size); break;
+    case element::Type_t::u32: sum_into<uint32_t>(sum, value, size); break;
+    case element::Type_t::u64: sum_into<uint64_t>(sum, value, size); break;
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic:
+    case element::Type_t::boolean:
+    case element::Type_t::bf16:
+    case element::Type_t::f16:
+        ss << "Unable to sum the replicas of a result of element type " << type;
+        throw ngraph_error(ss.str());
+    }
+}
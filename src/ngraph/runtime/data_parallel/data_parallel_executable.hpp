@@ -0,0 +1,88 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace data_parallel
+        {
+            class DataParallelExecutable;
+        }
+    }
+}
+
+///
+/// \brief Executable that runs one Function on several backends at once, for example one GPU
+///        backend per local device, by splitting each call's batch between them.
+///
+/// Parameters with a dynamic dimension 0 are batched: every call splits their dimension 0 into
+/// contiguous slices, one per replica, that differ in size by at most one sample. Every other
+/// parameter, such as the weights, is passed whole to each replica.
+///
+/// Results with a dynamic dimension 0 are gathered: the slices the replicas computed are
+/// concatenated in replica order. Every other result is reduced: the values of the replicas are
+/// summed, which all-reduces the gradients of a training Function.
+///
+/// The Function is specialized (see `specialize_shapes`) and compiled on every replica for each
+/// distinct set of input shapes, and replicas run concurrently through `begin_call`.
+///
+class ngraph::runtime::data_parallel::DataParallelExecutable : public ngraph::runtime::Executable
+{
+public:
+    DataParallelExecutable(std::shared_ptr<Function> function,
+                           const std::vector<std::shared_ptr<Backend>>& replicas,
+                           bool enable_performance_collection = false);
+    ~DataParallelExecutable() override;
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    size_t get_replica_count() const { return m_replicas.size(); }
+private:
+    struct Replica
+    {
+        size_t backend;
+        size_t batch_offset;
+        size_t batch_size;
+        std::shared_ptr<Executable> executable;
+        std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+    };
+
+    std::vector<Replica>& get_replicas(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+    static void accumulate(const element::Type& type, char* sum, const char* value, size_t size);
+
+    std::shared_ptr<Function> m_function;
+    std::vector<std::shared_ptr<Backend>> m_replicas;
+    bool m_enable_performance_collection;
+    std::vector<bool> m_batched_parameters;
+    std::vector<bool> m_batched_results;
+    // Replicas compiled for each distinct set of input shapes
+    std::map<std::vector<Shape>, std::vector<Replica>> m_variants;
+};
@@ -16,6 +16,9 @@
 
 #include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "ngraph/graph_util.hpp"
+#include "ngraph/metrics.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/dyn_elimination.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/shape_relevance.hpp"
 #include "ngraph/specialize_shapes.hpp"
@@ -26,6 +29,7 @@ using namespace ngraph;
 
 runtime::dynamic::DynamicBackend::DynamicBackend(shared_ptr<runtime::Backend> wrapped_backend)
     : m_wrapped_backend(std::move(wrapped_backend))
+    , m_tensor_pool(make_shared<DynamicTensorPool>(m_wrapped_backend))
 {
 }
 
@@ -45,7 +49,7 @@ std::shared_ptr<runtime::Tensor>
     runtime::dynamic::DynamicBackend::create_dynamic_tensor(const element::Type& type,
                                                             const PartialShape& shape)
 {
-    return make_shared<DynamicTensor>(type, shape, m_wrapped_backend);
+    return make_shared<DynamicTensor>(type, shape, m_wrapped_backend, m_tensor_pool);
 }
 
 shared_ptr<runtime::Executable>
@@ -56,29 +60,125 @@ shared_ptr<runtime::Executable>
         function, m_wrapped_backend, enable_performance_collection);
 }
 
+constexpr size_t runtime::dynamic::DynamicExecutable::DEFAULT_CACHE_CAPACITY;
+
 runtime::dynamic::DynamicExecutable::DynamicExecutable(shared_ptr<Function> wrapped_function,
                                                        shared_ptr<runtime::Backend> wrapped_backend,
                                                        bool enable_performance_collection)
-    : m_wrapped_function(wrapped_function)
+    : m_wrapped_function(clone_function(*wrapped_function))
     , m_wrapped_backend(wrapped_backend)
     , m_enable_performance_collection(enable_performance_collection)
+    , m_cache_capacity(DEFAULT_CACHE_CAPACITY)
+    , m_cache_hits(0)
+    , m_cache_misses(0)
 {
+    // Subgraphs that do not depend on any parameter, such as reshaped or converted weights,
+    // are folded once here on a private clone. Every specialization then shares the data of
+    // the folded constants instead of folding them again.
     pass::Manager passes;
+    passes.register_pass<pass::ConstantFolding>();
     passes.register_pass<pass::ShapeRelevance>();
     passes.run_passes(m_wrapped_function);
 
     set_parameters_and_results(*wrapped_function);
 }
 
+runtime::dynamic::DynamicExecutable::~DynamicExecutable()
+{
+    evict_to_capacity(0);
+}
+
+void runtime::dynamic::DynamicExecutable::set_cache_capacity(size_t capacity)
+{
+    evict_to_capacity(capacity);
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    m_cache_capacity = capacity;
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_capacity() const
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    return m_cache_capacity;
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_size() const
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    return m_lru.size();
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_hits() const
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    return m_cache_hits;
+}
+
+size_t runtime::dynamic::DynamicExecutable::get_cache_misses() const
+{
+    std::lock_guard<std::mutex> lock(m_cache_mutex);
+    return m_cache_misses;
+}
+
+void runtime::dynamic::DynamicExecutable::evict_to_capacity(size_t capacity)
+{
+    std::vector<std::shared_ptr<runtime::Executable>> evicted;
+    {
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        while (m_lru.size() > capacity)
+        {
+            m_cache.erase(m_lru.back().first);
+            evicted.push_back(m_lru.back().second);
+            m_lru.pop_back();
+        }
+    }
+
+    // Release outside of the lock; the wrapped backend may do arbitrary work here.
+    for (auto& exec : evicted)
+    {
+        m_wrapped_backend->remove_compiled_function(exec);
+    }
+}
+
+//
+// The cache key is a byte string encoding, for each input, its element type and shape, followed
+// (for shape-relevant parameters only) by the raw contents of the tensor. Each field is
+// prefixed with its length so that distinct inputs can never produce the same key.
+//
+std::string runtime::dynamic::DynamicExecutable::make_cache_key(
+    const std::vector<element::Type>& arg_element_types,
+    const std::vector<PartialShape>& arg_shapes,
+    const std::vector<std::vector<char>>& arg_value_buffers) const
+{
+    std::string key;
+    auto append_size = [&key](size_t v) {
+        key.append(reinterpret_cast<const char*>(&v), sizeof(v));
+    };
+
+    for (size_t i = 0; i < arg_shapes.size(); i++)
+    {
+        const Shape& shape = arg_shapes[i].to_shape();
+
+        append_size(static_cast<size_t>(arg_element_types[i].get_type_enum()));
+        append_size(shape.size());
+        for (auto d : shape)
+        {
+            append_size(d);
+        }
+
+        if (m_wrapped_function->get_parameters()[i]->is_relevant_to_shapes())
+        {
+            append_size(arg_value_buffers[i].size());
+            key.append(arg_value_buffers[i].data(), arg_value_buffers[i].size());
+        }
+    }
+
+    return key;
+}
+
 bool runtime::dynamic::DynamicExecutable::call(
     const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
     const std::vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
-    // TODO: Get cached executable out if it exists.
-    // We will cache on:
-    // (1) all shapes;
-    // (2) all values of shape-relevant input tensors.
-
     std::vector<std::shared_ptr<runtime::Tensor>> wrapped_inputs;
     std::vector<element::Type> arg_element_types;
     std::vector<PartialShape> arg_shapes;
@@ -100,10 +200,87 @@ bool runtime::dynamic::DynamicExecutable::call(
         }
     }
 
-    // TODO: specialize_shapes needs to fill in values of shape-relevant params.
-    auto clone = specialize_shapes(m_wrapped_function, arg_element_types, arg_shapes);
-    // TODO: run constant folding and de-dynification on clone.
-    const ResultVector& results = clone->get_results();
+    // Read back the values of shape-relevant inputs. These are part of the cache key, and are
+    // substituted into the specialized function as constants so that the dynamic ops they
+    // feed can be replaced with static ones.
+    const ParameterVector& params = m_wrapped_function->get_parameters();
+    NGRAPH_CHECK(params.size() == wrapped_inputs.size());
+
+    std::vector<std::vector<char>> arg_value_buffers(wrapped_inputs.size());
+    std::vector<void*> arg_values(wrapped_inputs.size(), nullptr);
+
+    for (size_t i = 0; i < wrapped_inputs.size(); i++)
+    {
+        if (params[i]->is_relevant_to_shapes())
+        {
+            size_t size_in_bytes =
+                shape_size(wrapped_inputs[i]->get_shape()) * arg_element_types[i].size();
+            arg_value_buffers[i].resize(size_in_bytes);
+            wrapped_inputs[i]->read(arg_value_buffers[i].data(), 0, size_in_bytes);
+            arg_values[i] = arg_value_buffers[i].data();
+        }
+    }
+
+    std::string key = make_cache_key(arg_element_types, arg_shapes, arg_value_buffers);
+    std::shared_ptr<runtime::Executable> compiled_executable;
+
+    {
+        std::lock_guard<std::mutex> lock(m_cache_mutex);
+        auto it = m_cache.find(key);
+        if (it != m_cache.end())
+        {
+            m_lru.splice(m_lru.begin(), m_lru, it->second);
+            compiled_executable = it->second->second;
+            m_cache_hits++;
+        }
+        else
+        {
+            m_cache_misses++;
+        }
+        Metrics::count_cache_lookup("dynamic_executable", compiled_executable != nullptr);
+    }
+
+    if (compiled_executable == nullptr)
+    {
+        auto clone =
+            specialize_shapes(m_wrapped_function, arg_element_types, arg_shapes, arg_values);
+
+        // Now that all parameter shapes (and the values of shape-relevant parameters) are
+        // known, fold ShapeOf into constants and replace dynamic ops with their static
+        // counterparts. ConstantFolding runs again afterwards, since most of its rewrites are
+        // only enabled once the function has become fully static.
+        pass::Manager passes;
+        passes.register_pass<pass::ConstantFolding>();
+        passes.register_pass<pass::DynElimination>();
+        passes.register_pass<pass::ConstantFolding>();
+        passes.run_passes(clone);
+
+        compiled_executable = m_wrapped_backend->compile(clone, m_enable_performance_collection);
+
+        bool inserted = false;
+        {
+            std::lock_guard<std::mutex> lock(m_cache_mutex);
+            // Another thread may have compiled the same specialization in the meantime, in which
+            // case the entry already in the cache wins.
+            auto it = m_cache.find(key);
+            if (it != m_cache.end())
+            {
+                m_lru.splice(m_lru.begin(), m_lru, it->second);
+            }
+            else if (m_cache_capacity > 0)
+            {
+                m_lru.emplace_front(key, compiled_executable);
+                m_cache[key] = m_lru.begin();
+                inserted = true;
+            }
+        }
+        if (inserted)
+        {
+            evict_to_capacity(get_cache_capacity());
+        }
+    }
+
+    const ResultVector& results = compiled_executable->get_results();
     NGRAPH_CHECK(results.size() == outputs.size());
 
     std::vector<std::shared_ptr<runtime::Tensor>> wrapped_outputs;
@@ -123,23 +300,32 @@ bool runtime::dynamic::DynamicExecutable::call(
         {
             wrapped_outputs.push_back(output);
         }
+        results_it++;
     }
 
-    // TODO: Put compiled executable in the cache.
-    auto compiled_executable = m_wrapped_backend->compile(clone, m_enable_performance_collection);
     auto result = compiled_executable->call(wrapped_outputs, wrapped_inputs);
 
     return result;
 }
 
+constexpr size_t runtime::dynamic::DynamicTensor::SHRINK_AFTER;
+
 runtime::dynamic::DynamicTensor::DynamicTensor(
     const element::Type& element_type,
     const PartialShape& shape,
-    const std::shared_ptr<runtime::Backend>& wrapped_backend)
+    const std::shared_ptr<runtime::Backend>& wrapped_backend,
+    const std::shared_ptr<DynamicTensorPool>& pool)
     : Tensor(make_shared<descriptor::Tensor>(element_type, shape, "wrapped_dynamic"))
     , m_wrapped_tensor(nullptr)
     , m_wrapped_backend(wrapped_backend)
+    , m_pool(pool ? pool : make_shared<DynamicTensorPool>(wrapped_backend))
+    , m_undersized_calls(0)
+{
+}
+
+runtime::dynamic::DynamicTensor::~DynamicTensor()
 {
+    release_storage();
 }
 
 const element::Type& runtime::dynamic::DynamicTensor::get_element_type() const
@@ -189,7 +375,18 @@ bool runtime::dynamic::DynamicTensor::has_storage() const
 
 void runtime::dynamic::DynamicTensor::release_storage()
 {
+    if (m_buffer)
+    {
+        m_wrapped_tensor = nullptr;
+        m_pool->release_buffer(std::move(m_buffer));
+    }
+    else if (m_wrapped_tensor)
+    {
+        m_pool->release_tensor(std::move(m_wrapped_tensor));
+    }
+    m_buffer = nullptr;
     m_wrapped_tensor = nullptr;
+    m_undersized_calls = 0;
 }
 
 void runtime::dynamic::DynamicTensor::make_storage(const element::Type& element_type,
@@ -206,7 +403,51 @@ void runtime::dynamic::DynamicTensor::make_storage(const element::Type& element_
                  shape,
                  " which is incompatible with dynamic tensor shape ",
                  get_partial_shape());
-    m_wrapped_tensor = m_wrapped_backend->create_tensor(element_type, shape);
+
+    bool same_value_type = m_wrapped_tensor != nullptr &&
+                           m_wrapped_tensor->get_element_type() == element_type &&
+                           m_wrapped_tensor->get_shape() == shape;
+
+    if (!m_pool->attaches_memory())
+    {
+        if (!same_value_type)
+        {
+            release_storage();
+            m_wrapped_tensor = m_pool->acquire_tensor(element_type, shape);
+        }
+        return;
+    }
+
+    size_t byte_size = shape_size(shape) * element_type.size();
+    bool fits = m_buffer != nullptr && m_buffer->size() >= byte_size;
+    if (fits && byte_size * 4 < m_buffer->size())
+    {
+        // Shrink only once the smaller values have persisted, not on a single short one
+        fits = ++m_undersized_calls < SHRINK_AFTER;
+    }
+    else
+    {
+        m_undersized_calls = 0;
+    }
+
+    if (!fits)
+    {
+        // Grow geometrically so that slowly growing values do not reallocate every call
+        size_t capacity = byte_size;
+        if (m_buffer != nullptr && m_buffer->size() < byte_size)
+        {
+            capacity = std::max(byte_size, m_buffer->size() + m_buffer->size() / 2);
+        }
+        release_storage();
+        m_buffer = m_pool->acquire_buffer(capacity);
+        same_value_type = false;
+    }
+
+    if (!same_value_type)
+    {
+        m_wrapped_tensor =
+            m_wrapped_backend->create_tensor(element_type, shape, m_buffer->get_ptr());
+    }
 }
 
 const std::shared_ptr<ngraph::runtime::Tensor>&
@@ -214,3 +455,129 @@ const std::shared_ptr<ngraph::runtime::Tensor>&
 {
     return m_wrapped_tensor;
 }
+
+constexpr size_t runtime::dynamic::DynamicTensorPool::DEFAULT_MAX_POOLED_BYTES;
+
+runtime::dynamic::DynamicTensorPool::DynamicTensorPool(
+    const std::shared_ptr<runtime::Backend>& wrapped_backend, size_t max_pooled_bytes)
+    : m_wrapped_backend(wrapped_backend)
+    , m_attaches_memory(wrapped_backend->is_supported_property(Backend::Property::memory_attach))
+    , m_pooled_bytes(0)
+    , m_max_pooled_bytes(max_pooled_bytes)
+    , m_allocations(0)
+{
+}
+
+std::shared_ptr<runtime::AlignedBuffer>
+    runtime::dynamic::DynamicTensorPool::acquire_buffer(size_t byte_size)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        // Best fit among the buffers the value would fill at least half of
+        auto best = m_entries.end();
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if (it->buffer != nullptr && it->byte_size >= byte_size &&
+                it->byte_size / 2 <= byte_size &&
+                (best == m_entries.end() || it->byte_size < best->byte_size))
+            {
+                best = it;
+            }
+        }
+        if (best != m_entries.end())
+        {
+            auto buffer = best->buffer;
+            m_pooled_bytes -= best->byte_size;
+            m_entries.erase(best);
+            return buffer;
+        }
+        m_allocations++;
+    }
+    return make_shared<AlignedBuffer>(byte_size, 64);
+}
+
+void runtime::dynamic::DynamicTensorPool::release_buffer(std::shared_ptr<AlignedBuffer> buffer)
+{
+    if (buffer != nullptr)
+    {
+        size_t byte_size = buffer->size();
+        release({std::move(buffer), nullptr, byte_size});
+    }
+}
+
+std::shared_ptr<runtime::Tensor>
+    runtime::dynamic::DynamicTensorPool::acquire_tensor(const element::Type& element_type,
+                                                        const Shape& shape)
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_entries.begin(); it != m_entries.end(); ++it)
+        {
+            if (it->tensor != nullptr && it->tensor->get_element_type() == element_type &&
+                it->tensor->get_shape() == shape)
+            {
+                auto tensor = it->tensor;
+                m_pooled_bytes -= it->byte_size;
+                m_entries.erase(it);
+                return tensor;
+            }
+        }
+        m_allocations++;
+    }
+    return m_wrapped_backend->create_tensor(element_type, shape);
+}
+
+void runtime::dynamic::DynamicTensorPool::release_tensor(std::shared_ptr<runtime::Tensor> tensor)
+{
+    if (tensor != nullptr)
+    {
+        size_t byte_size = shape_size(tensor->get_shape()) * tensor->get_element_type().size();
+        release({nullptr, std::move(tensor), byte_size});
+    }
+}
+
+void runtime::dynamic::DynamicTensorPool::release(Entry entry)
+{
+    // Dropped storage is freed after the lock is released
+    std::vector<Entry> dropped;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_pooled_bytes += entry.byte_size;
+    m_entries.push_front(std::move(entry));
+    trim(dropped);
+}
+
+void runtime::dynamic::DynamicTensorPool::trim(std::vector<Entry>& dropped)
+{
+    while (m_pooled_bytes > m_max_pooled_bytes)
+    {
+        m_pooled_bytes -= m_entries.back().byte_size;
+        dropped.push_back(std::move(m_entries.back()));
+        m_entries.pop_back();
+    }
+}
+
+void runtime::dynamic::DynamicTensorPool::set_max_pooled_bytes(size_t max_pooled_bytes)
+{
+    std::vector<Entry> dropped;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_max_pooled_bytes = max_pooled_bytes;
+    trim(dropped);
+}
+
+size_t runtime::dynamic::DynamicTensorPool::get_max_pooled_bytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_max_pooled_bytes;
+}
+
+size_t runtime::dynamic::DynamicTensorPool::get_pooled_bytes() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_pooled_bytes;
+}
+
+size_t runtime::dynamic::DynamicTensorPool::get_allocations() const
+{
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_allocations;
+}
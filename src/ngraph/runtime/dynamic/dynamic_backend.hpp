@@ -16,11 +16,15 @@
 
 #pragma once
 
+#include <list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
+#include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/tensor.hpp"
@@ -34,6 +38,7 @@ namespace ngraph
             class DynamicBackend;
             class DynamicExecutable;
             class DynamicTensor;
+            class DynamicTensorPool;
         }
     }
 }
@@ -70,8 +75,11 @@ public:
     std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
                                         bool enable_performance_data = false) override;
 
+    /// \returns The pool shared by all dynamic tensors created by this backend.
+    const std::shared_ptr<DynamicTensorPool>& get_tensor_pool() const { return m_tensor_pool; }
 private:
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
+    std::shared_ptr<DynamicTensorPool> m_tensor_pool;
 };
 
 ///
@@ -86,6 +94,14 @@ private:
 /// 2. compiles the clone using the wrapped backend;
 /// 3. fowards the input tensors to the clone executable for actual execution.
 ///
+/// Executables compiled in step 2 are kept in an LRU cache keyed on the element types and
+/// shapes of all inputs, plus the values of all shape-relevant inputs (see
+/// `pass::ShapeRelevance`), so steps 1 and 2 are skipped when a call matches a previous one.
+/// Entries evicted from the cache are released via `Backend::remove_compiled_function`.
+///
+/// The stored function is a clone of the one passed to `compile()`, with its parameter-free
+/// subgraphs already constant-folded, so the clones of step 1 share their constant data.
+///
 /// `DynamicExecutable` objects are produced by `DynamicBackend::compile()`.
 ///
 class ngraph::runtime::dynamic::DynamicExecutable : public ngraph::runtime::Executable
@@ -94,13 +110,43 @@ public:
     DynamicExecutable(std::shared_ptr<Function> wrapped_function,
                       std::shared_ptr<ngraph::runtime::Backend> wrapped_backend,
                       bool enable_performance_collection = false);
+    ~DynamicExecutable() override;
     virtual bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                       const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+    /// \brief Set the maximum number of specialized executables kept in the cache. If the
+    ///        cache currently holds more entries than `capacity`, the least recently used
+    ///        entries are evicted immediately. A capacity of zero disables caching.
+    void set_cache_capacity(size_t capacity);
+    size_t get_cache_capacity() const;
+    /// \returns The number of specialized executables currently held in the cache.
+    size_t get_cache_size() const;
+    /// \returns The number of calls that reused a cached executable.
+    size_t get_cache_hits() const;
+    /// \returns The number of calls that had to specialize and compile a new executable.
+    size_t get_cache_misses() const;
+
+    static constexpr size_t DEFAULT_CACHE_CAPACITY = 32;
+
 private:
+    std::string make_cache_key(const std::vector<element::Type>& arg_element_types,
+                               const std::vector<PartialShape>& arg_shapes,
+                               const std::vector<std::vector<char>>& arg_value_buffers) const;
+    void evict_to_capacity(size_t capacity);
+
+    using CacheEntry = std::pair<std::string, std::shared_ptr<runtime::Executable>>;
+
     std::shared_ptr<ngraph::Function> m_wrapped_function;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
     bool m_enable_performance_collection;
+
+    // Most recently used entries are at the front of m_lru.
+    std::list<CacheEntry> m_lru;
+    std::unordered_map<std::string, std::list<CacheEntry>::iterator> m_cache;
+    size_t m_cache_capacity;
+    size_t m_cache_hits;
+    size_t m_cache_misses;
+    mutable std::mutex m_cache_mutex;
 };
 
 ///
@@ -121,23 +167,94 @@ private:
 ///    called until the storage has been released via `release_storage()`.
 /// 4. `release_storage()` unassigns previously assigned storage.
 ///
+/// Storage is kept across `make_storage()` calls whenever it can hold the new value, so an
+/// output written by a series of calls is only reallocated when it grows, or after it has
+/// used less than a quarter of its storage for several calls in a row. Storage that is
+/// replaced or released goes back to a `DynamicTensorPool`.
+///
 class ngraph::runtime::dynamic::DynamicTensor : public ngraph::runtime::Tensor
 {
 public:
+    /// \param pool Pool to take storage from and return it to. If null, the tensor uses a
+    ///             pool of its own.
     DynamicTensor(const element::Type& element_type,
                   const PartialShape& shape,
-                  const std::shared_ptr<runtime::Backend>& wrapped_backend);
+                  const std::shared_ptr<runtime::Backend>& wrapped_backend,
+                  const std::shared_ptr<DynamicTensorPool>& pool = nullptr);
+    ~DynamicTensor() override;
     virtual const element::Type& get_element_type() const override;
     virtual const ngraph::Shape& get_shape() const override;
     virtual void write(const void* p, size_t offset, size_t n) override;
     virtual void read(void* p, size_t offset, size_t n) const override;
     virtual void copy_from(const ngraph::runtime::Tensor& source) override;
     bool has_storage() const;
+    /// \brief Unassigns the storage and returns it to the pool. Wrapped tensors obtained
+    ///        from `get_wrapped_tensor()` must not be used afterwards.
     void release_storage();
     void make_storage(const element::Type& element_type, const Shape& shape);
     const std::shared_ptr<ngraph::runtime::Tensor>& get_wrapped_tensor() const;
 
+    /// Number of consecutive undersized `make_storage()` calls after which storage is shrunk
+    static constexpr size_t SHRINK_AFTER = 8;
+
 private:
     std::shared_ptr<ngraph::runtime::Tensor> m_wrapped_tensor;
     std::shared_ptr<ngraph::runtime::Backend> m_wrapped_backend;
+    std::shared_ptr<DynamicTensorPool> m_pool;
+    // Only used on backends that attach memory, m_wrapped_tensor is a view on it
+    std::shared_ptr<AlignedBuffer> m_buffer;
+    size_t m_undersized_calls;
+};
+
+///
+/// \brief Storage released by `DynamicTensor`s, handed out again to later values.
+///
+/// On backends supporting `Backend::Property::memory_attach` the pool holds host buffers,
+/// which are reused for any value that fills at least half of them. On other backends it
+/// holds tensors of the wrapped backend, which are reused for values of the same element type
+/// and shape. Released storage is kept up to a byte limit; the least recently released is
+/// dropped first.
+///
+class ngraph::runtime::dynamic::DynamicTensorPool
+{
+public:
+    DynamicTensorPool(const std::shared_ptr<runtime::Backend>& wrapped_backend,
+                      size_t max_pooled_bytes = DEFAULT_MAX_POOLED_BYTES);
+
+    /// \returns True if storage is held as host buffers that wrapped tensors attach to.
+    bool attaches_memory() const { return m_attaches_memory; }
+    std::shared_ptr<AlignedBuffer> acquire_buffer(size_t byte_size);
+    void release_buffer(std::shared_ptr<AlignedBuffer> buffer);
+    std::shared_ptr<runtime::Tensor> acquire_tensor(const element::Type& element_type,
+                                                    const Shape& shape);
+    void release_tensor(std::shared_ptr<runtime::Tensor> tensor);
+
+    void set_max_pooled_bytes(size_t max_pooled_bytes);
+    size_t get_max_pooled_bytes() const;
+    /// \returns The bytes of released storage currently held.
+    size_t get_pooled_bytes() const;
+    /// \returns The number of buffers or tensors that had to be newly allocated.
+    size_t get_allocations() const;
+
+    static constexpr size_t DEFAULT_MAX_POOLED_BYTES = 64 * 1024 * 1024;
+
+private:
+    struct Entry
+    {
+        std::shared_ptr<AlignedBuffer> buffer;
+        std::shared_ptr<runtime::Tensor> tensor;
+        size_t byte_size;
+    };
+    void release(Entry entry);
+    // Drops the least recently released entries over the limit, called with m_mutex held
+    void trim(std::vector<Entry>& dropped);
+
+    std::shared_ptr<runtime::Backend> m_wrapped_backend;
+    bool m_attaches_memory;
+    // Most recently released entries are at the front
+    std::list<Entry> m_entries;
+    size_t m_pooled_bytes;
+    size_t m_max_pooled_bytes;
+    size_t m_allocations;
+    mutable std::mutex m_mutex;
 };
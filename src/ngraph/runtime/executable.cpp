@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <atomic>
 #include <sstream>
 
 #include "ngraph/file_util.hpp"
@@ -24,7 +26,24 @@
 using namespace std;
 using namespace ngraph;
 
+static size_t next_signature_version()
+{
+    static atomic<size_t> s_next_signature_version{1};
+    return s_next_signature_version.fetch_add(1, memory_order_relaxed);
+}
+
+namespace
+{
+    // Type versions of the tensors of a call that passed validation
+    struct ValidatedCall
+    {
+        size_t signature_version = 0;
+        vector<size_t> type_versions;
+    };
+}
+
 runtime::Executable::Executable()
+    : m_signature_version(next_signature_version())
 {
 }
 
@@ -39,8 +58,85 @@ bool runtime::Executable::call_with_validate(const vector<shared_ptr<runtime::Te
     return call(outputs, inputs);
 }
 
+future<bool> runtime::Executable::begin_call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                            const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    // The tensor vectors are captured by value so the tensors stay alive until the call ends.
+    return async(launch::async, [this, outputs, inputs]() { return call(outputs, inputs); });
+}
+
 void runtime::Executable::validate(const vector<std::shared_ptr<runtime::Tensor>>& outputs,
                                    const vector<std::shared_ptr<runtime::Tensor>>& inputs)
+{
+    // A few executables per thread, e.g. the stages of a pipeline
+    static const size_t s_cached_calls = 4;
+    static thread_local ValidatedCall s_validated[s_cached_calls];
+    static thread_local size_t s_next_evicted = 0;
+
+    // The type versions are unique, so equal versions mean the same tensors of the same types.
+    // Version 0 is never cached.
+    auto matches = [&](const ValidatedCall& validated) {
+        if (validated.signature_version != m_signature_version ||
+            validated.type_versions.size() != inputs.size() + outputs.size())
+        {
+            return false;
+        }
+        auto version = validated.type_versions.begin();
+        for (auto& tensor : inputs)
+        {
+            if (tensor->get_type_version() != *version++)
+            {
+                return false;
+            }
+        }
+        for (auto& tensor : outputs)
+        {
+            if (tensor->get_type_version() != *version++)
+            {
+                return false;
+            }
+        }
+        return true;
+    };
+    ValidatedCall* entry = nullptr;
+    for (auto& validated : s_validated)
+    {
+        if (matches(validated))
+        {
+            return;
+        }
+        if (validated.signature_version == m_signature_version)
+        {
+            entry = &validated;
+        }
+    }
+
+    check_signature(outputs, inputs);
+
+    if (entry == nullptr)
+    {
+        entry = &s_validated[s_next_evicted];
+        s_next_evicted = (s_next_evicted + 1) % s_cached_calls;
+    }
+    entry->signature_version = 0;
+    entry->type_versions.clear();
+    for (auto& tensor : inputs)
+    {
+        entry->type_versions.push_back(tensor->get_type_version());
+    }
+    for (auto& tensor : outputs)
+    {
+        entry->type_versions.push_back(tensor->get_type_version());
+    }
+    if (find(entry->type_versions.begin(), entry->type_versions.end(), 0) ==
+        entry->type_versions.end())
+    {
+        entry->signature_version = m_signature_version;
+    }
+}
+
+void runtime::Executable::check_signature(const vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                                          const vector<std::shared_ptr<runtime::Tensor>>& inputs)
 {
     const ParameterVector& parameters = get_parameters();
     const ResultVector& results = get_results();
@@ -112,9 +208,46 @@ void runtime::Executable::set_parameters_and_results(const Function& func)
 {
     m_parameters = func.get_parameters();
     m_results = func.get_results();
+    m_signature_version = next_signature_version();
+}
+
+void runtime::Executable::set_parameters_and_results(const ParameterVector& parameters,
+                                                     const ResultVector& results)
+{
+    m_parameters = parameters;
+    m_results = results;
+    m_signature_version = next_signature_version();
 }
 
 vector<runtime::PerformanceCounter> runtime::Executable::get_performance_data() const
 {
     return vector<PerformanceCounter>();
 }
+
+runtime::MemoryStatistics runtime::Executable::get_memory_statistics(size_t top_tensors) const
+{
+    return MemoryStatistics();
+}
+
+void runtime::Executable::save(std::ostream& output_stream)
+{
+    throw runtime_error("save operation unimplemented.");
+}
+
+void runtime::Executable::update_constants(const std::map<const op::Constant*, const void*>&)
+{
+    throw runtime_error("update_constants operation unimplemented.");
+}
+
+void runtime::Executable::prepare()
+{
+}
+
+size_t runtime::Executable::reclaim_memory(bool)
+{
+    return 0;
+}
+
+void runtime::Executable::set_idle_timeout(std::chrono::milliseconds, bool)
+{
+}
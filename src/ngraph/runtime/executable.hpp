@@ -16,15 +16,30 @@
 
 #pragma once
 
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <map>
 #include <memory>
 
 #include "ngraph/function.hpp"
+#include "ngraph/runtime/memory_statistics.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/shape.hpp"
 #include "ngraph/type/element_type.hpp"
 
 namespace ngraph
 {
+    namespace op
+    {
+        class Constant;
+    }
+
+    namespace pass
+    {
+        class PassProfile;
+    }
+
     namespace runtime
     {
         class Tensor;
@@ -51,11 +66,80 @@ public:
     bool call_with_validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                             const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
 
+    /// \brief Starts executing a single iteration of a Function without waiting for it to
+    ///        finish.
+    /// \param outputs vector of runtime::Tensor used as outputs
+    /// \param inputs vector of runtime::Tensor used as inputs
+    /// \returns A future that becomes ready once the iteration has completed. Its value is
+    ///     what `call` would have returned; an exception thrown during execution is rethrown
+    ///     from `get()`. Use `wait()` or `get()` on the future to block until completion.
+    ///
+    /// The tensors must not be read or written, and the Executable must not be destroyed,
+    /// until the future is ready. The default implementation runs `call` on a new thread;
+    /// backends override this to schedule the work on their own execution resources.
+    virtual std::future<bool>
+        begin_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
     /// \brief Collect performance information gathered on a Function.
     /// \returns Vector of PerformanceCounter information.
     virtual std::vector<PerformanceCounter> get_performance_data() const;
 
-    /// \brief Validates a Function.
+    /// \brief Report the memory the backend planned for this Executable.
+    /// \param top_tensors Number of largest tensors to describe
+    /// \returns Pool and constant sizes, and the largest tensors with their live ranges. The
+    ///     default implementation returns empty statistics.
+    virtual MemoryStatistics get_memory_statistics(size_t top_tensors = 10) const;
+
+    /// \brief The pass::Manager profile of compiling this Executable
+    /// \returns The per-pass compile-time and memory report, or nullptr if compilation was not
+    ///     profiled (see NGRAPH_PROFILE_PASS_ENABLE and NGRAPH_ENABLE_TRACING) or the backend
+    ///     does not record one
+    std::shared_ptr<const pass::PassProfile> get_compile_profile() const
+    {
+        return m_compile_profile;
+    }
+
+    /// \brief Save this compiled Executable to an output stream. The saved Executable can be
+    ///        restored with `Backend::load` on the same type of backend.
+    /// \param output_stream The stream to write the Executable to
+    /// \throws std::runtime_error if the backend does not support saving executables
+    virtual void save(std::ostream& output_stream);
+
+    /// \brief Overwrite the values of constants of the compiled Function, e.g. to swap in
+    ///        fine-tuned weights without recompiling. Only the cached computations derived
+    ///        from the updated constants run again; the optimized graph and its kernels are
+    ///        kept. Must not be called while a call on this Executable is running.
+    /// \param values The new data of each constant, in the constant's element type and
+    ///        row-major layout, and of the constant's size
+    /// \throws std::runtime_error if the backend does not support updating constants, or
+    ///         ngraph_error if a constant was folded away during compilation
+    virtual void update_constants(const std::map<const op::Constant*, const void*>& values);
+
+    /// \brief Do ahead of time the work that would otherwise slow down the first calls, such
+    ///        as creating kernels and computing the values derived from constants alone, so
+    ///        that the first requests do not pay for it. Must not be called while a call on
+    ///        this Executable is running. The default implementation does nothing.
+    virtual void prepare();
+
+    /// \brief Free the memory that is only used while calls run, such as the temporary
+    ///        buffers of intermediates, e.g. for an executable that is rarely called. It is
+    ///        allocated again by the next call, which also recomputes the intermediates that
+    ///        were cached in it. The default implementation frees nothing.
+    /// \param keep_constant_values Keep the values computed from constants alone, such as
+    ///        weights converted to the layouts of their kernels
+    /// \returns The number of bytes freed
+    virtual size_t reclaim_memory(bool keep_constant_values = true);
+
+    /// \brief Reclaim the memory, as reclaim_memory does, whenever this Executable has not
+    ///        been called for `timeout`. A zero timeout, the default, disables it. The default
+    ///        implementation does nothing.
+    virtual void set_idle_timeout(std::chrono::milliseconds timeout,
+                                  bool keep_constant_values = true);
+
+    /// \brief Validates a Function. The type versions of the tensors that pass are cached
+    ///     per thread, so later calls with the same tensors are only checked again once the
+    ///     type of one of them changes.
     /// \param outputs vector of runtime::Tensor used as outputs
     /// \param inputs vector of runtime::Tensor used as inputs
     void validate(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
@@ -75,7 +159,24 @@ protected:
     /// \param func The function with Results fully resolved.
     void set_parameters_and_results(const Function& func);
 
+    /// \brief Sets the values returned by get_parameters and get_results for an Executable
+    ///     whose calls do not map onto the signature of a single Function
+    void set_parameters_and_results(const ParameterVector& parameters,
+                                    const ResultVector& results);
+
+    void set_compile_profile(const std::shared_ptr<const pass::PassProfile>& profile)
+    {
+        m_compile_profile = profile;
+    }
+
 private:
+    void check_signature(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                         const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
     ngraph::ParameterVector m_parameters;
     ngraph::ResultVector m_results;
+    // Unique across executables and changed with the parameters and results, to key the
+    // signatures validate() caches
+    size_t m_signature_version;
+    std::shared_ptr<const pass::PassProfile> m_compile_profile;
 };
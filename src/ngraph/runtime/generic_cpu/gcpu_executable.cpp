@@ -20,11 +20,20 @@
 #include "ngraph/op/convert.hpp"
 #include "ngraph/op/select.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/pass/algebraic_simplification.hpp"
 #include "ngraph/pass/assign_layout.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/cse.hpp"
+#include "ngraph/pass/fused_op_decomposition.hpp"
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/memory_layout.hpp"
+#include "ngraph/pass/nop_elimination.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/pass/reshape_elimination.hpp"
+#include "ngraph/pass/reshape_sinking.hpp"
+#include "ngraph/pass/zero_dim_tensor_elimination.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/util.hpp"
 
@@ -33,13 +42,48 @@ using namespace ngraph;
 
 using descriptor::layout::DenseTensorLayout;
 
+// NGRAPH_PASS_ENABLES turns these on and off by name, as it does for the CPU backend
+template <typename T>
+static void register_knobbed_pass(pass::Manager& pass_manager,
+                                  const pass::PassConfig& pass_config,
+                                  const string& name,
+                                  bool enable_by_default)
+{
+    auto& pass_map = pass_config.get_enables();
+    auto it = pass_map.find(name);
+    if (it != pass_map.end() ? it->second : enable_by_default)
+    {
+        pass_manager.register_pass<T>();
+    }
+}
+
 runtime::gcpu::GCPUExecutable::GCPUExecutable(const shared_ptr<Function>& function,
                                               bool enable_performance_collection)
 {
     {
         m_is_compiled = true;
         pass::Manager pass_manager;
-        pass_manager.register_pass<pass::LikeReplacement>();
+        pass::PassConfig pass_config;
+        // The device independent part of the CPU backend's pipeline, without its MKL-DNN
+        // fusions and layouts
+        register_knobbed_pass<pass::LikeReplacement>(
+            pass_manager, pass_config, "LikeReplacement", true);
+        register_knobbed_pass<pass::FusedOpDecomposition>(
+            pass_manager, pass_config, "FusedOpDecomposition", true);
+        register_knobbed_pass<pass::NopElimination>(
+            pass_manager, pass_config, "NopElimination", true);
+        register_knobbed_pass<pass::ZeroDimTensorElimination>(
+            pass_manager, pass_config, "ZeroDimTensorElimination", true);
+        register_knobbed_pass<pass::AlgebraicSimplification>(
+            pass_manager, pass_config, "AlgebraicSimplification", true);
+        register_knobbed_pass<pass::ReshapeSinking>(
+            pass_manager, pass_config, "ReshapeSinking", false);
+        register_knobbed_pass<pass::ReshapeElimination>(
+            pass_manager, pass_config, "ReshapeElimination", false);
+        register_knobbed_pass<pass::ConstantFolding>(
+            pass_manager, pass_config, "ConstantFolding", true);
+        register_knobbed_pass<pass::CommonSubexpressionElimination>(
+            pass_manager, pass_config, "CommonSubexpressionElimination", true);
         pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
         pass_manager.register_pass<pass::Liveness>();
         pass_manager.run_passes(function);
@@ -35,6 +35,7 @@
 #include "ngraph/op/dequantize.hpp"
 #include "ngraph/op/dot.hpp"
 #include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/op/experimental/dropout.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/shape_of.hpp"
 #include "ngraph/op/gather.hpp"
@@ -48,11 +49,13 @@
 #include "ngraph/op/passthrough.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
+#include "ngraph/op/recv.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/send.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sum.hpp"
@@ -60,8 +63,13 @@
 #include "ngraph/runtime/aligned_buffer.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/broadcast.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/convolution.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/dot.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/pool.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/reduce.hpp"
 #include "ngraph/runtime/generic_cpu/kernel/reshape.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/softmax.hpp"
 #include "ngraph/runtime/generic_cpu/node_wrapper.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/interpreter/node_wrapper.hpp"
@@ -69,6 +77,7 @@
 #include "ngraph/runtime/reference/acos.hpp"
 #include "ngraph/runtime/reference/add.hpp"
 #include "ngraph/runtime/reference/all.hpp"
+#include "ngraph/runtime/reference/allgather.hpp"
 #include "ngraph/runtime/reference/allreduce.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/any.hpp"
@@ -89,6 +98,7 @@
 #include "ngraph/runtime/reference/cosh.hpp"
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
+#include "ngraph/runtime/reference/dropout.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/equal.hpp"
 #include "ngraph/runtime/reference/exp.hpp"
@@ -117,12 +127,15 @@
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/recv.hpp"
+#include "ngraph/runtime/reference/reducescatter.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
 #include "ngraph/runtime/reference/replace_slice.hpp"
 #include "ngraph/runtime/reference/result.hpp"
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
 #include "ngraph/runtime/reference/select.hpp"
+#include "ngraph/runtime/reference/send.hpp"
 #include "ngraph/runtime/reference/shape_of.hpp"
 #include "ngraph/runtime/reference/sigmoid.hpp"
 #include "ngraph/runtime/reference/sign.hpp"
@@ -215,10 +228,10 @@ private:
         case OP_TYPEID::Add:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::add<T>(static_cast<const T*>(args[0]),
-                              static_cast<const T*>(args[1]),
-                              static_cast<T*>(out[0]),
-                              element_count);
+            gcpu::kernel::add<T>(static_cast<const T*>(args[0]),
+                                 static_cast<const T*>(args[1]),
+                                 static_cast<T*>(out[0]),
+                                 element_count);
             break;
         }
         case OP_TYPEID::All:
@@ -231,6 +244,14 @@ private:
                            all->get_reduction_axes());
             break;
         }
+        case OP_TYPEID::AllGather:
+        {
+            reference::allgather<T>(static_cast<T*>(const_cast<void*>(args[0])),
+                                    static_cast<T*>(out[0]),
+                                    node.get_input_element_type(0).get_type_enum(),
+                                    static_cast<int>(shape_size(node.get_input_shape(0))));
+            break;
+        }
         case OP_TYPEID::AllReduce:
         {
             reference::allreduce<T>(static_cast<T*>(const_cast<void*>(args[0])),
@@ -328,15 +349,15 @@ private:
         {
             const op::AvgPool* avg_pool = static_cast<const op::AvgPool*>(&node);
 
-            reference::avg_pool<T>(static_cast<const T*>(args[0]),
-                                   static_cast<T*>(out[0]),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   avg_pool->get_window_shape(),
-                                   avg_pool->get_window_movement_strides(),
-                                   avg_pool->get_padding_below(),
-                                   avg_pool->get_padding_above(),
-                                   avg_pool->get_include_padding_in_avg_computation());
+            gcpu::kernel::avg_pool<T>(static_cast<const T*>(args[0]),
+                                      static_cast<T*>(out[0]),
+                                      node.get_input_shape(0),
+                                      node.get_output_shape(0),
+                                      avg_pool->get_window_shape(),
+                                      avg_pool->get_window_movement_strides(),
+                                      avg_pool->get_padding_below(),
+                                      avg_pool->get_padding_above(),
+                                      avg_pool->get_include_padding_in_avg_computation());
             break;
         }
         case OP_TYPEID::GenerateMask:
@@ -555,24 +576,17 @@ private:
         case OP_TYPEID::Convolution:
         {
             const op::Convolution* c = static_cast<const op::Convolution*>(&node);
-            reference::convolution<T>(static_cast<const T*>(args[0]),
-                                      static_cast<const T*>(args[1]),
-                                      static_cast<T*>(out[0]),
-                                      node.get_input_shape(0),
-                                      node.get_input_shape(1),
-                                      node.get_output_shape(0),
-                                      c->get_window_movement_strides(),
-                                      c->get_window_dilation_strides(),
-                                      c->get_padding_below(),
-                                      c->get_padding_above(),
-                                      c->get_data_dilation_strides(),
-                                      0,
-                                      1,
-                                      1,
-                                      0,
-                                      0,
-                                      1,
-                                      false);
+            gcpu::kernel::convolution<T>(static_cast<const T*>(args[0]),
+                                         static_cast<const T*>(args[1]),
+                                         static_cast<T*>(out[0]),
+                                         node.get_input_shape(0),
+                                         node.get_input_shape(1),
+                                         node.get_output_shape(0),
+                                         c->get_window_movement_strides(),
+                                         c->get_window_dilation_strides(),
+                                         c->get_padding_below(),
+                                         c->get_padding_above(),
+                                         c->get_data_dilation_strides());
             break;
         }
         case OP_TYPEID::ConvolutionBackpropFilters:
@@ -694,13 +708,62 @@ private:
                               dot->get_reduction_axes_count());
             break;
         }
+        case OP_TYPEID::Dropout:
+        {
+            if (m_states.count(&node) == 0)
+            {
+                const op::Dropout* dropout = static_cast<const op::Dropout*>(&node);
+                m_states[&node] = std::unique_ptr<ngraph::RNGState>(
+                    ngraph::RNGState::create_rng_state(dropout->get_seed(),
+                                                       dropout->get_keep_probability()));
+            }
+
+            bool training = static_cast<bool>(static_cast<const T*>(args[1])[0]);
+            auto state = m_states.at(&node).get();
+            size_t element_count = shape_size(node.get_output_shape(0));
+            uint64_t base = training ? state->reserve(element_count) : 0;
+            reference::dropout<T>(static_cast<const T*>(args[0]),
+                                  static_cast<T*>(out[0]),
+                                  element_count,
+                                  state,
+                                  base,
+                                  training);
+            static_cast<uint64_t*>(out[1])[0] = base;
+            break;
+        }
+        case OP_TYPEID::DropoutBackprop:
+        {
+            if (m_states.count(&node) == 0)
+            {
+                const op::DropoutBackprop* dropout = static_cast<const op::DropoutBackprop*>(&node);
+                m_states[&node] = std::unique_ptr<ngraph::RNGState>(
+                    ngraph::RNGState::create_rng_state(dropout->get_seed(),
+                                                       dropout->get_keep_probability()));
+            }
+
+            bool training = static_cast<bool>(static_cast<const T*>(args[1])[0]);
+            uint64_t base = static_cast<const uint64_t*>(args[2])[0];
+            size_t element_count = shape_size(node.get_output_shape(0));
+            auto state = m_states.at(&node).get();
+            reference::dropout<T>(static_cast<const T*>(args[0]),
+                                  static_cast<T*>(out[0]),
+                                  element_count,
+                                  state,
+                                  base,
+                                  training);
+            break;
+        }
         case OP_TYPEID::EmbeddingLookup:
         {
             const op::EmbeddingLookup* embed = static_cast<const op::EmbeddingLookup*>(&node);
             auto type = embed->get_argument(0)->get_element_type();
             size_t element_count = shape_size(embed->get_argument(0)->get_shape());
 
-            if (type == element::f32)
+            if (embed->is_quantized())
+            {
+                throw unsupported_op("Quantized EmbeddingLookup weights are not supported");
+            }
+            else if (type == element::f32)
             {
                 reference::embedding<T, float>(static_cast<const float*>(args[0]),
                                                static_cast<const T*>(args[1]),
@@ -739,6 +802,52 @@ private:
             }
             break;
         }
+        case OP_TYPEID::EmbeddingLookupBackprop:
+        {
+            const op::EmbeddingLookupBackprop* embed =
+                static_cast<const op::EmbeddingLookupBackprop*>(&node);
+            auto type = embed->get_argument(0)->get_element_type();
+            size_t element_count = shape_size(embed->get_argument(0)->get_shape());
+
+            if (type == element::f32)
+            {
+                reference::embedding_backprop<T, float>(static_cast<const float*>(args[0]),
+                                                        static_cast<const T*>(args[1]),
+                                                        static_cast<T*>(out[0]),
+                                                        element_count,
+                                                        embed->get_weights_shape());
+            }
+            else if (type == element::f64)
+            {
+                reference::embedding_backprop<T, double>(static_cast<const double*>(args[0]),
+                                                         static_cast<const T*>(args[1]),
+                                                         static_cast<T*>(out[0]),
+                                                         element_count,
+                                                         embed->get_weights_shape());
+            }
+            else if (type == element::i32)
+            {
+                reference::embedding_backprop<T, int>(static_cast<const int*>(args[0]),
+                                                      static_cast<const T*>(args[1]),
+                                                      static_cast<T*>(out[0]),
+                                                      element_count,
+                                                      embed->get_weights_shape());
+            }
+            else if (type == element::i64)
+            {
+                reference::embedding_backprop<T, int64_t>(static_cast<const int64_t*>(args[0]),
+                                                          static_cast<const T*>(args[1]),
+                                                          static_cast<T*>(out[0]),
+                                                          element_count,
+                                                          embed->get_weights_shape());
+            }
+            else
+            {
+                throw ngraph_error(std::string("Unsupported index type ") + type.c_type_string() +
+                                   std::string("in EmbeddingLookupBackprop"));
+            }
+            break;
+        }
         case OP_TYPEID::Equal:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -751,7 +860,7 @@ private:
         case OP_TYPEID::Exp:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::exp<T>(
+            gcpu::kernel::exp<T>(
                 static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
             break;
         }
@@ -835,6 +944,11 @@ private:
                                      element_count);
             break;
         }
+        case OP_TYPEID::If:
+        case OP_TYPEID::Loop:
+        {
+            throw unsupported_op("Unsupported op '" + node.description() + "'");
+        }
         case OP_TYPEID::Less:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -875,34 +989,33 @@ private:
         case OP_TYPEID::Max:
         {
             const op::Max* max = static_cast<const op::Max*>(&node);
-            reference::max<T>(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              max->get_reduction_axes());
+            gcpu::kernel::max<T>(static_cast<const T*>(args[0]),
+                                 static_cast<T*>(out[0]),
+                                 node.get_input_shape(0),
+                                 max->get_reduction_axes());
             break;
         }
         case OP_TYPEID::Maximum:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::maximum<T>(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<T*>(out[0]),
-                                  element_count);
+            gcpu::kernel::maximum<T>(static_cast<const T*>(args[0]),
+                                     static_cast<const T*>(args[1]),
+                                     static_cast<T*>(out[0]),
+                                     element_count);
             break;
         }
         case OP_TYPEID::MaxPool:
         {
             const op::MaxPool* max_pool = static_cast<const op::MaxPool*>(&node);
 
-            reference::max_pool<T>(static_cast<const T*>(args[0]),
-                                   static_cast<T*>(out[0]),
-                                   node.get_input_shape(0),
-                                   node.get_output_shape(0),
-                                   max_pool->get_window_shape(),
-                                   max_pool->get_window_movement_strides(),
-                                   max_pool->get_padding_below(),
-                                   max_pool->get_padding_above());
+            gcpu::kernel::max_pool<T>(static_cast<const T*>(args[0]),
+                                      static_cast<T*>(out[0]),
+                                      node.get_input_shape(0),
+                                      node.get_output_shape(0),
+                                      max_pool->get_window_shape(),
+                                      max_pool->get_window_movement_strides(),
+                                      max_pool->get_padding_below(),
+                                      max_pool->get_padding_above());
             break;
         }
         case OP_TYPEID::MaxPoolBackprop:
@@ -924,35 +1037,34 @@ private:
         case OP_TYPEID::Min:
         {
             const op::Min* min = static_cast<const op::Min*>(&node);
-            reference::min<T>(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              min->get_reduction_axes());
+            gcpu::kernel::min<T>(static_cast<const T*>(args[0]),
+                                 static_cast<T*>(out[0]),
+                                 node.get_input_shape(0),
+                                 min->get_reduction_axes());
             break;
         }
         case OP_TYPEID::Minimum:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::minimum<T>(static_cast<const T*>(args[0]),
-                                  static_cast<const T*>(args[1]),
-                                  static_cast<T*>(out[0]),
-                                  element_count);
+            gcpu::kernel::minimum<T>(static_cast<const T*>(args[0]),
+                                     static_cast<const T*>(args[1]),
+                                     static_cast<T*>(out[0]),
+                                     element_count);
             break;
         }
         case OP_TYPEID::Multiply:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::multiply<T>(static_cast<const T*>(args[0]),
-                                   static_cast<const T*>(args[1]),
-                                   static_cast<T*>(out[0]),
-                                   element_count);
+            gcpu::kernel::multiply<T>(static_cast<const T*>(args[0]),
+                                      static_cast<const T*>(args[1]),
+                                      static_cast<T*>(out[0]),
+                                      element_count);
             break;
         }
         case OP_TYPEID::Negative:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::negate<T>(
+            gcpu::kernel::negate<T>(
                 static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
             break;
         }
@@ -1089,10 +1201,28 @@ private:
         {
             throw unsupported_op("Unsupported op '" + node.description() + "'.");
         }
+        case OP_TYPEID::Recv:
+        {
+            const op::Recv* recv = static_cast<const op::Recv*>(&node);
+            reference::recv<T>(static_cast<T*>(out[0]),
+                               node.get_output_element_type(0).get_type_enum(),
+                               shape_size(node.get_output_shape(0)),
+                               recv->get_src_rank(),
+                               recv->get_tag());
+            break;
+        }
+        case OP_TYPEID::ReduceScatter:
+        {
+            reference::reducescatter<T>(static_cast<T*>(const_cast<void*>(args[0])),
+                                        static_cast<T*>(out[0]),
+                                        node.get_input_element_type(0).get_type_enum(),
+                                        static_cast<int>(shape_size(node.get_output_shape(0))));
+            break;
+        }
         case OP_TYPEID::Relu:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::relu<T>(
+            gcpu::kernel::relu<T>(
                 static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
             break;
         }
@@ -1175,6 +1305,17 @@ private:
                                  element_count);
             break;
         }
+        case OP_TYPEID::Send:
+        {
+            const op::Send* send = static_cast<const op::Send*>(&node);
+            reference::send<T>(static_cast<const T*>(args[0]),
+                               static_cast<T*>(out[0]),
+                               node.get_input_element_type(0).get_type_enum(),
+                               shape_size(node.get_input_shape(0)),
+                               send->get_dest_rank(),
+                               send->get_tag());
+            break;
+        }
         case OP_TYPEID::ShapeOf:
         {
             reference::shape_of(node.get_input_shape(0), static_cast<uint64_t*>(out[0]));
@@ -1183,7 +1324,7 @@ private:
         case OP_TYPEID::Sigmoid:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sigmoid<T>(
+            gcpu::kernel::sigmoid<T>(
                 static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
             break;
         }
@@ -1232,16 +1373,16 @@ private:
         case OP_TYPEID::Softmax:
         {
             const op::Softmax* softmax = static_cast<const op::Softmax*>(&node);
-            reference::softmax<T>(static_cast<const T*>(args[0]),
-                                  static_cast<T*>(out[0]),
-                                  node.get_output_shape(0),
-                                  softmax->get_axes());
+            gcpu::kernel::softmax<T>(static_cast<const T*>(args[0]),
+                                     static_cast<T*>(out[0]),
+                                     node.get_output_shape(0),
+                                     softmax->get_axes());
             break;
         }
         case OP_TYPEID::Sqrt:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::sqrt<T>(
+            gcpu::kernel::sqrt<T>(
                 static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
             break;
         }
@@ -1250,20 +1391,19 @@ private:
         case OP_TYPEID::Subtract:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::subtract<T>(static_cast<const T*>(args[0]),
-                                   static_cast<const T*>(args[1]),
-                                   static_cast<T*>(out[0]),
-                                   element_count);
+            gcpu::kernel::subtract<T>(static_cast<const T*>(args[0]),
+                                      static_cast<const T*>(args[1]),
+                                      static_cast<T*>(out[0]),
+                                      element_count);
             break;
         }
         case OP_TYPEID::Sum:
         {
             const op::Sum* sum = static_cast<const op::Sum*>(&node);
-            reference::sum<T>(static_cast<const T*>(args[0]),
-                              static_cast<T*>(out[0]),
-                              node.get_input_shape(0),
-                              node.get_output_shape(0),
-                              sum->get_reduction_axes());
+            gcpu::kernel::sum<T>(static_cast<const T*>(args[0]),
+                                 static_cast<T*>(out[0]),
+                                 node.get_input_shape(0),
+                                 sum->get_reduction_axes());
             break;
         }
         case OP_TYPEID::Tan:
@@ -1276,7 +1416,7 @@ private:
         case OP_TYPEID::Tanh:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
-            reference::tanh<T>(
+            gcpu::kernel::tanh<T>(
                 static_cast<const T*>(args[0]), static_cast<T*>(out[0]), element_count);
             break;
         }
@@ -0,0 +1,151 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstddef>
+#include <omp.h>
+#include <type_traits>
+#include <vector>
+
+#include "ngraph/coordinate_diff.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/gemm.hpp"
+#include "ngraph/runtime/reference/convolution.hpp"
+#include "ngraph/shape.hpp"
+#include "ngraph/strides.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // 2D convolution of [N, C, H, W] images with [K, C, R, S] filters as one
+                // matrix product per image: the image is unrolled (im2col) into a
+                // [C * R * S, OH * OW] matrix that the [K, C * R * S] filter matrix multiplies.
+                template <typename T>
+                void convolution_im2col(const T* in,
+                                        const T* filters,
+                                        T* out,
+                                        const Shape& in_shape,
+                                        const Shape& filters_shape,
+                                        const Shape& out_shape,
+                                        const Strides& strides,
+                                        const Strides& dilation,
+                                        const CoordinateDiff& padding_below)
+                {
+                    const size_t channels = in_shape[1];
+                    const size_t in_h = in_shape[2];
+                    const size_t in_w = in_shape[3];
+                    const size_t out_channels = filters_shape[0];
+                    const size_t filter_h = filters_shape[2];
+                    const size_t filter_w = filters_shape[3];
+                    const size_t out_h = out_shape[2];
+                    const size_t out_w = out_shape[3];
+                    const size_t rows = channels * filter_h * filter_w;
+                    const size_t cols = out_h * out_w;
+
+                    std::vector<T> columns(rows * cols);
+                    for (size_t n = 0; n < in_shape[0]; n++)
+                    {
+                        const T* image = in + n * channels * in_h * in_w;
+#pragma omp parallel for if (rows * cols >= s_parallel_elements)
+                        for (size_t row = 0; row < rows; row++)
+                        {
+                            size_t c = row / (filter_h * filter_w);
+                            size_t r = row / filter_w % filter_h;
+                            size_t s = row % filter_w;
+                            T* dst = columns.data() + row * cols;
+                            for (size_t oh = 0; oh < out_h; oh++)
+                            {
+                                // signed, the padding puts the first rows above the image
+                                ptrdiff_t ih =
+                                    static_cast<ptrdiff_t>(oh * strides[0] + r * dilation[0]) -
+                                    padding_below[0];
+                                for (size_t ow = 0; ow < out_w; ow++)
+                                {
+                                    ptrdiff_t iw =
+                                        static_cast<ptrdiff_t>(ow * strides[1] + s * dilation[1]) -
+                                        padding_below[1];
+                                    bool inside = ih >= 0 && ih < static_cast<ptrdiff_t>(in_h) &&
+                                                  iw >= 0 && iw < static_cast<ptrdiff_t>(in_w);
+                                    dst[oh * out_w + ow] =
+                                        inside ? image[(c * in_h + ih) * in_w + iw] : T(0);
+                                }
+                            }
+                        }
+                        gemm(filters,
+                             columns.data(),
+                             out + n * out_channels * cols,
+                             out_channels,
+                             cols,
+                             rows);
+                    }
+                }
+
+                template <typename T>
+                void convolution(const T* in,
+                                 const T* filters,
+                                 T* out,
+                                 const Shape& in_shape,
+                                 const Shape& filters_shape,
+                                 const Shape& out_shape,
+                                 const Strides& strides,
+                                 const Strides& dilation,
+                                 const CoordinateDiff& padding_below,
+                                 const CoordinateDiff& padding_above,
+                                 const Strides& data_dilation)
+                {
+                    bool im2col = std::is_floating_point<T>::value && in_shape.size() == 4 &&
+                                  data_dilation == Strides(2, 1);
+                    for (size_t i = 0; im2col && i < 2; i++)
+                    {
+                        im2col = padding_below[i] >= 0 && padding_above[i] >= 0;
+                    }
+                    if (im2col)
+                    {
+                        convolution_im2col(in,
+                                           filters,
+                                           out,
+                                           in_shape,
+                                           filters_shape,
+                                           out_shape,
+                                           strides,
+                                           dilation,
+                                           padding_below);
+                    }
+                    else
+                    {
+                        reference::convolution<T>(in,
+                                                  filters,
+                                                  out,
+                                                  in_shape,
+                                                  filters_shape,
+                                                  out_shape,
+                                                  strides,
+                                                  dilation,
+                                                  padding_below,
+                                                  padding_above,
+                                                  data_dilation);
+                    }
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,128 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+#include <omp.h>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Loops shorter than this are not worth waking the OpenMP team for
+                static const size_t s_parallel_elements = 1 << 15;
+
+                // The loops are written so that the compiler can vectorize them for the
+                // host's SIMD width, the OpenMP simd pragma makes that explicit
+                template <typename T, typename F>
+                void unary_elementwise(const T* arg, T* out, size_t count, F f)
+                {
+#pragma omp parallel for simd if (count >= s_parallel_elements)
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = f(arg[i]);
+                    }
+                }
+
+                template <typename T, typename F>
+                void binary_elementwise(const T* arg0, const T* arg1, T* out, size_t count, F f)
+                {
+#pragma omp parallel for simd if (count >= s_parallel_elements)
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = f(arg0[i], arg1[i]);
+                    }
+                }
+
+                template <typename T>
+                void add(const T* arg0, const T* arg1, T* out, size_t count)
+                {
+                    binary_elementwise(arg0, arg1, out, count, [](T a, T b) { return a + b; });
+                }
+
+                template <typename T>
+                void subtract(const T* arg0, const T* arg1, T* out, size_t count)
+                {
+                    binary_elementwise(arg0, arg1, out, count, [](T a, T b) { return a - b; });
+                }
+
+                template <typename T>
+                void multiply(const T* arg0, const T* arg1, T* out, size_t count)
+                {
+                    binary_elementwise(arg0, arg1, out, count, [](T a, T b) { return a * b; });
+                }
+
+                template <typename T>
+                void maximum(const T* arg0, const T* arg1, T* out, size_t count)
+                {
+                    binary_elementwise(
+                        arg0, arg1, out, count, [](T a, T b) { return a > b ? a : b; });
+                }
+
+                template <typename T>
+                void minimum(const T* arg0, const T* arg1, T* out, size_t count)
+                {
+                    binary_elementwise(
+                        arg0, arg1, out, count, [](T a, T b) { return a < b ? a : b; });
+                }
+
+                template <typename T>
+                void negate(const T* arg, T* out, size_t count)
+                {
+                    unary_elementwise(arg, out, count, [](T x) { return -x; });
+                }
+
+                template <typename T>
+                void relu(const T* arg, T* out, size_t count)
+                {
+                    unary_elementwise(arg, out, count, [](T x) { return x > T(0) ? x : T(0); });
+                }
+
+                template <typename T>
+                void exp(const T* arg, T* out, size_t count)
+                {
+                    unary_elementwise(arg, out, count, [](T x) { return std::exp(x); });
+                }
+
+                template <typename T>
+                void sqrt(const T* arg, T* out, size_t count)
+                {
+                    unary_elementwise(arg, out, count, [](T x) { return std::sqrt(x); });
+                }
+
+                template <typename T>
+                void tanh(const T* arg, T* out, size_t count)
+                {
+                    unary_elementwise(arg, out, count, [](T x) { return std::tanh(x); });
+                }
+
+                template <typename T>
+                void sigmoid(const T* arg, T* out, size_t count)
+                {
+                    unary_elementwise(arg, out, count, [](T x) {
+                        return T(1) / (T(1) + std::exp(-x));
+                    });
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,80 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <Eigen/Dense>
+#include <algorithm>
+#include <cstddef>
+
+#ifdef NGRAPH_GCPU_CBLAS_ENABLE
+#include <cblas.h>
+#endif
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // c[m, n] = a[m, k] * b[k, n], all row-major
+                template <typename T>
+                void gemm(const T* a, const T* b, T* c, size_t m, size_t n, size_t k)
+                {
+                    using Matrix =
+                        Eigen::Matrix<T, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+                    Eigen::Map<const Matrix> a_matrix(a, m, k);
+                    Eigen::Map<const Matrix> b_matrix(b, k, n);
+                    Eigen::Map<Matrix> c_matrix(c, m, n);
+                    c_matrix.noalias() = a_matrix * b_matrix;
+                }
+
+#ifdef NGRAPH_GCPU_CBLAS_ENABLE
+                // With NGRAPH_GENERIC_CPU_BLAS_ENABLE the floating point products go to the
+                // CBLAS library found at build time, e.g. OpenBLAS with its NEON kernels on
+                // aarch64
+                template <>
+                inline void gemm<float>(
+                    const float* a, const float* b, float* c, size_t m, size_t n, size_t k)
+                {
+                    if (m == 0 || n == 0 || k == 0)
+                    {
+                        std::fill(c, c + m * n, float(0));
+                        return;
+                    }
+                    cblas_sgemm(
+                        CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1, a, k, b, n, 0, c, n);
+                }
+
+                template <>
+                inline void gemm<double>(
+                    const double* a, const double* b, double* c, size_t m, size_t n, size_t k)
+                {
+                    if (m == 0 || n == 0 || k == 0)
+                    {
+                        std::fill(c, c + m * n, double(0));
+                        return;
+                    }
+                    cblas_dgemm(
+                        CblasRowMajor, CblasNoTrans, CblasNoTrans, m, n, k, 1, a, k, b, n, 0, c, n);
+                }
+#endif
+            }
+        }
+    }
+}
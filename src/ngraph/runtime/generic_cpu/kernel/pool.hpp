@@ -0,0 +1,115 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <omp.h>
+
+#include "ngraph/runtime/reference/avg_pool.hpp"
+#include "ngraph/runtime/reference/max_pool.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Pooling windows never cross channels, so every (batch, channel) image is
+                // pooled on its own as a [1, 1, spatial...] tensor and the images are spread
+                // over the threads
+                template <typename T, typename F>
+                void pool_per_channel(
+                    const T* arg, T* out, const Shape& arg_shape, const Shape& out_shape, F f)
+                {
+                    size_t channels = arg_shape[0] * arg_shape[1];
+                    Shape channel_arg_shape(arg_shape);
+                    Shape channel_out_shape(out_shape);
+                    channel_arg_shape[0] = channel_arg_shape[1] = 1;
+                    channel_out_shape[0] = channel_out_shape[1] = 1;
+                    size_t arg_size = shape_size(channel_arg_shape);
+                    size_t out_size = shape_size(channel_out_shape);
+#pragma omp parallel for if (channels > 1)
+                    for (size_t c = 0; c < channels; c++)
+                    {
+                        f(arg + c * arg_size,
+                          out + c * out_size,
+                          channel_arg_shape,
+                          channel_out_shape);
+                    }
+                }
+
+                template <typename T>
+                void max_pool(const T* arg,
+                              T* out,
+                              const Shape& arg_shape,
+                              const Shape& out_shape,
+                              const Shape& window_shape,
+                              const Strides& window_movement_strides,
+                              const Shape& padding_below,
+                              const Shape& padding_above)
+                {
+                    pool_per_channel(
+                        arg,
+                        out,
+                        arg_shape,
+                        out_shape,
+                        [&](const T* a, T* o, const Shape& a_shape, const Shape& o_shape) {
+                            reference::max_pool<T>(a,
+                                                   o,
+                                                   a_shape,
+                                                   o_shape,
+                                                   window_shape,
+                                                   window_movement_strides,
+                                                   padding_below,
+                                                   padding_above);
+                        });
+                }
+
+                template <typename T>
+                void avg_pool(const T* arg,
+                              T* out,
+                              const Shape& arg_shape,
+                              const Shape& out_shape,
+                              const Shape& window_shape,
+                              const Strides& window_movement_strides,
+                              const Shape& padding_below,
+                              const Shape& padding_above,
+                              bool include_padding_in_avg_computation)
+                {
+                    pool_per_channel(
+                        arg,
+                        out,
+                        arg_shape,
+                        out_shape,
+                        [&](const T* a, T* o, const Shape& a_shape, const Shape& o_shape) {
+                            reference::avg_pool<T>(a,
+                                                   o,
+                                                   a_shape,
+                                                   o_shape,
+                                                   window_shape,
+                                                   window_movement_strides,
+                                                   padding_below,
+                                                   padding_above,
+                                                   include_padding_in_avg_computation);
+                        });
+                }
+            }
+        }
+    }
+}
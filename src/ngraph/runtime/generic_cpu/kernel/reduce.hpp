@@ -0,0 +1,193 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <omp.h>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Columns of the inner axes are reduced in chunks this wide, small enough to
+                // keep a chunk of partial results in L1
+                static const size_t s_reduce_chunk = 1024;
+
+                // Reduces a contiguous run of axes. The input is viewed as [outer, reduced,
+                // inner] and the output as [outer, inner]; every output row accumulates the
+                // `reduced` input rows above it so that the inner loop runs over contiguous
+                // memory on both sides.
+                template <typename T, typename F>
+                void reduce_block(const T* arg,
+                                  T* out,
+                                  size_t outer,
+                                  size_t reduced,
+                                  size_t inner,
+                                  T init,
+                                  F f)
+                {
+                    size_t chunks = (inner + s_reduce_chunk - 1) / s_reduce_chunk;
+                    size_t tasks = outer * chunks;
+#pragma omp parallel for if (outer * reduced * inner >= s_parallel_elements)
+                    for (size_t task = 0; task < tasks; task++)
+                    {
+                        size_t o = task / chunks;
+                        size_t begin = (task % chunks) * s_reduce_chunk;
+                        size_t end = std::min(inner, begin + s_reduce_chunk);
+                        T* dst = out + o * inner;
+                        std::fill(dst + begin, dst + end, init);
+                        for (size_t r = 0; r < reduced; r++)
+                        {
+                            const T* src = arg + (o * reduced + r) * inner;
+#pragma omp simd
+                            for (size_t i = begin; i < end; i++)
+                            {
+                                dst[i] = f(dst[i], src[i]);
+                            }
+                        }
+                    }
+                }
+
+                // Same as reduce_block, with the Kahan summation of reference::sum
+                template <typename T>
+                void sum_block(const T* arg, T* out, size_t outer, size_t reduced, size_t inner)
+                {
+                    size_t chunks = (inner + s_reduce_chunk - 1) / s_reduce_chunk;
+                    size_t tasks = outer * chunks;
+#pragma omp parallel for if (outer * reduced * inner >= s_parallel_elements)
+                    for (size_t task = 0; task < tasks; task++)
+                    {
+                        size_t o = task / chunks;
+                        size_t begin = (task % chunks) * s_reduce_chunk;
+                        size_t end = std::min(inner, begin + s_reduce_chunk);
+                        T* dst = out + o * inner;
+                        T c[s_reduce_chunk];
+                        std::fill(c, c + (end - begin), T(0));
+                        std::fill(dst + begin, dst + end, T(0));
+                        for (size_t r = 0; r < reduced; r++)
+                        {
+                            const T* src = arg + (o * reduced + r) * inner;
+#pragma omp simd
+                            for (size_t i = begin; i < end; i++)
+                            {
+                                T y = src[i] - c[i - begin];
+                                T t = dst[i] + y;
+                                c[i - begin] = (t - dst[i]) - y;
+                                dst[i] = t;
+                            }
+                        }
+                    }
+                }
+
+                // Reduces any set of axes as a sequence of contiguous runs, the last run first
+                // so that the indices of the runs still to do are unchanged.
+                // block(arg, out, outer, reduced, inner) reduces one run.
+                template <typename T, typename B>
+                void reduce(const T* arg,
+                            T* out,
+                            const Shape& in_shape,
+                            const AxisSet& reduction_axes,
+                            B block)
+                {
+                    Shape shape = in_shape;
+                    if (reduction_axes.empty())
+                    {
+                        std::memcpy(out, arg, shape_size(shape) * sizeof(T));
+                        return;
+                    }
+                    std::vector<T> buffers[2];
+                    const T* src = arg;
+                    auto axis = reduction_axes.rbegin();
+                    for (size_t run = 0; axis != reduction_axes.rend(); run++)
+                    {
+                        size_t last = *axis;
+                        size_t first = last;
+                        while (++axis != reduction_axes.rend() && *axis == first - 1)
+                        {
+                            first--;
+                        }
+                        size_t outer = shape_size(Shape(shape.begin(), shape.begin() + first));
+                        size_t reduced =
+                            shape_size(Shape(shape.begin() + first, shape.begin() + last + 1));
+                        size_t inner = shape_size(Shape(shape.begin() + last + 1, shape.end()));
+                        shape.erase(shape.begin() + first, shape.begin() + last + 1);
+
+                        T* dst = out;
+                        if (axis != reduction_axes.rend())
+                        {
+                            buffers[run % 2].resize(outer * inner);
+                            dst = buffers[run % 2].data();
+                        }
+                        block(src, dst, outer, reduced, inner);
+                        src = dst;
+                    }
+                }
+
+                template <typename T>
+                void sum(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
+                {
+                    reduce(arg, out, in_shape, reduction_axes, sum_block<T>);
+                }
+
+                template <typename T>
+                void max(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
+                {
+                    T minval = std::numeric_limits<T>::has_infinity
+                                   ? -std::numeric_limits<T>::infinity()
+                                   : std::numeric_limits<T>::min();
+                    reduce(arg,
+                           out,
+                           in_shape,
+                           reduction_axes,
+                           [minval](const T* a, T* o, size_t outer, size_t reduced, size_t inner) {
+                               reduce_block(a, o, outer, reduced, inner, minval, [](T x, T y) {
+                                   return y > x ? y : x;
+                               });
+                           });
+                }
+
+                template <typename T>
+                void min(const T* arg, T* out, const Shape& in_shape, const AxisSet& reduction_axes)
+                {
+                    T maxval = std::numeric_limits<T>::has_infinity
+                                   ? std::numeric_limits<T>::infinity()
+                                   : std::numeric_limits<T>::max();
+                    reduce(arg,
+                           out,
+                           in_shape,
+                           reduction_axes,
+                           [maxval](const T* a, T* o, size_t outer, size_t reduced, size_t inner) {
+                               reduce_block(a, o, outer, reduced, inner, maxval, [](T x, T y) {
+                                   return y < x ? y : x;
+                               });
+                           });
+                }
+            }
+        }
+    }
+}
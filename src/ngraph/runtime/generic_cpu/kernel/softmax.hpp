@@ -0,0 +1,108 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <omp.h>
+#include <vector>
+
+#include "ngraph/axis_set.hpp"
+#include "ngraph/runtime/generic_cpu/kernel/elementwise.hpp"
+#include "ngraph/runtime/reference/softmax.hpp"
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gcpu
+        {
+            namespace kernel
+            {
+                // Softmax over a contiguous run of axes, viewing the tensor as [outer, reduced,
+                // inner]. Each outer slice is normalized by one thread, the inner loops run
+                // over contiguous memory.
+                template <typename T>
+                void softmax_block(const T* arg, T* out, size_t outer, size_t reduced, size_t inner)
+                {
+#pragma omp parallel if (outer * reduced * inner >= s_parallel_elements)
+                    {
+                        std::vector<T> max_values(inner);
+                        std::vector<T> sums(inner);
+#pragma omp for
+                        for (size_t o = 0; o < outer; o++)
+                        {
+                            const T* src = arg + o * reduced * inner;
+                            T* dst = out + o * reduced * inner;
+                            std::fill(max_values.begin(),
+                                      max_values.end(),
+                                      std::numeric_limits<T>::has_infinity
+                                          ? -std::numeric_limits<T>::infinity()
+                                          : std::numeric_limits<T>::lowest());
+                            std::fill(sums.begin(), sums.end(), T(0));
+                            for (size_t r = 0; r < reduced; r++)
+                            {
+                                for (size_t i = 0; i < inner; i++)
+                                {
+                                    T x = src[r * inner + i];
+                                    max_values[i] = x > max_values[i] ? x : max_values[i];
+                                }
+                            }
+                            for (size_t r = 0; r < reduced; r++)
+                            {
+                                for (size_t i = 0; i < inner; i++)
+                                {
+                                    T e = std::exp(src[r * inner + i] - max_values[i]);
+                                    dst[r * inner + i] = e;
+                                    sums[i] += e;
+                                }
+                            }
+                            for (size_t r = 0; r < reduced; r++)
+                            {
+#pragma omp simd
+                                for (size_t i = 0; i < inner; i++)
+                                {
+                                    dst[r * inner + i] /= sums[i];
+                                }
+                            }
+                        }
+                    }
+                }
+
+                template <typename T>
+                void softmax(const T* arg, T* out, const Shape& shape, const AxisSet& axes)
+                {
+                    if (axes.empty() || *axes.rbegin() - *axes.begin() + 1 != axes.size())
+                    {
+                        // the axes are not one contiguous run
+                        reference::softmax<T>(arg, out, shape, axes);
+                        return;
+                    }
+                    auto first = shape.begin() + *axes.begin();
+                    auto last = shape.begin() + *axes.rbegin() + 1;
+                    softmax_block(arg,
+                                  out,
+                                  shape_size(Shape(shape.begin(), first)),
+                                  shape_size(Shape(first, last)),
+                                  shape_size(Shape(last, shape.end())));
+                }
+            }
+        }
+    }
+}
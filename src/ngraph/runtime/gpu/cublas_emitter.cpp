@@ -15,8 +15,10 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/gpu/cublas_emitter.hpp"
+#include "ngraph/runtime/gpu/cuda_emitter.hpp"
 #include "ngraph/runtime/gpu/gpu_emitter.hpp"
 #include "ngraph/runtime/gpu/gpu_primitive_emitter.hpp"
+#include "ngraph/runtime/gpu/gpu_util.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -34,9 +36,11 @@ size_t runtime::gpu::CUBLASEmitter::build_dot(const element::Type& dtype,
                                               size_t reduction_axes,
                                               const Node* node)
 {
+    bool tensor_op_math = runtime::gpu::use_tensor_op_math() && dtype == element::f32;
     std::stringstream ss;
     ss << "dot_op"
-       << "_dtype_" << dtype.c_type_string() << "_reduction_axes_count_" << reduction_axes;
+       << "_dtype_" << dtype.c_type_string() << "_reduction_axes_count_" << reduction_axes
+       << (tensor_op_math ? "_tensor_op" : "");
     std::string hash = ss.str() + "_i_" + join(arg0_shape, "_") + "_i_" + join(arg1_shape, "_");
 
     size_t primitive_index = m_primitive_emitter->lookup(hash);
@@ -181,30 +185,77 @@ size_t runtime::gpu::CUBLASEmitter::build_dot(const element::Type& dtype,
             }
         }
 
-        dot.reset(new gpu::primitive{[=](void** inputs, void** outputs) {
-            const float alpha = 1.0;
-            const float beta = 0;
+        if (tensor_op_math)
+        {
+            // f16 inputs with f32 accumulation, so that Tensor Cores can be used
+            auto& cuda_emitter = m_primitive_emitter->get_cuda_emitter();
+            auto half_arg0 = cuda_emitter->build_half_input(m * k, node->get_argument(0));
+            auto half_arg1 = cuda_emitter->build_half_input(k * n, node->get_argument(1));
+            dot.reset(new gpu::primitive{[=](void** inputs, void** outputs) {
+                const float alpha = 1.0;
+                const float beta = 0;
+                void* arg0 = half_arg0(inputs[0]);
+                void* arg1 = half_arg1(inputs[1]);
 
-            CUBLAS_SAFE_CALL(cublasSetPointerMode(*m_ctx->cublas_handle, CUBLAS_POINTER_MODE_HOST));
-            CUBLAS_SAFE_CALL(cublasSgemm(*m_ctx->cublas_handle,
-                                         CUBLAS_OP_N,
-                                         CUBLAS_OP_N,
-                                         n,
-                                         m,
-                                         k,
-                                         &alpha,
-                                         static_cast<const float*>(inputs[1]),
-                                         n,
-                                         static_cast<const float*>(inputs[0]),
-                                         k,
-                                         &beta,
-                                         static_cast<float*>(outputs[0]),
-                                         n));
-            CUBLAS_SAFE_CALL(
-                cublasSetPointerMode(*m_ctx->cublas_handle, CUBLAS_POINTER_MODE_DEVICE));
+                CUBLAS_SAFE_CALL(
+                    cublasSetPointerMode(*m_ctx->cublas_handle, CUBLAS_POINTER_MODE_HOST));
+                CUBLAS_SAFE_CALL(cublasGemmEx(*m_ctx->cublas_handle,
+                                              CUBLAS_OP_N,
+                                              CUBLAS_OP_N,
+                                              n,
+                                              m,
+                                              k,
+                                              &alpha,
+                                              arg1,
+                                              CUDA_R_16F,
+                                              n,
+                                              arg0,
+                                              CUDA_R_16F,
+                                              k,
+                                              &beta,
+                                              outputs[0],
+                                              CUDA_R_32F,
+                                              n,
+#if CUDART_VERSION >= 11000
+                                              CUBLAS_COMPUTE_32F,
+#else
+                                              CUDA_R_32F,
+#endif
+                                              CUBLAS_GEMM_DEFAULT_TENSOR_OP));
+                CUBLAS_SAFE_CALL(
+                    cublasSetPointerMode(*m_ctx->cublas_handle, CUBLAS_POINTER_MODE_DEVICE));
 
-            debug_sync();
-        }});
+                debug_sync();
+            }});
+        }
+        else
+        {
+            dot.reset(new gpu::primitive{[=](void** inputs, void** outputs) {
+                const float alpha = 1.0;
+                const float beta = 0;
+
+                CUBLAS_SAFE_CALL(
+                    cublasSetPointerMode(*m_ctx->cublas_handle, CUBLAS_POINTER_MODE_HOST));
+                CUBLAS_SAFE_CALL(cublasSgemm(*m_ctx->cublas_handle,
+                                             CUBLAS_OP_N,
+                                             CUBLAS_OP_N,
+                                             n,
+                                             m,
+                                             k,
+                                             &alpha,
+                                             static_cast<const float*>(inputs[1]),
+                                             n,
+                                             static_cast<const float*>(inputs[0]),
+                                             k,
+                                             &beta,
+                                             static_cast<float*>(outputs[0]),
+                                             n));
+                CUBLAS_SAFE_CALL(
+                    cublasSetPointerMode(*m_ctx->cublas_handle, CUBLAS_POINTER_MODE_DEVICE));
+
+                debug_sync();
+            }});
+        }
         primitive_index = this->m_primitive_emitter->register_primitive(dot, hash);
     }
 
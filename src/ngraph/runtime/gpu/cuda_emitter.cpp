@@ -17,11 +17,27 @@
 #include <algorithm>
 #include <iostream>
 #include <limits>
+#include <map>
 #include <ostream>
 #include <string>
+#include <typeindex>
+#include <unordered_map>
 #include <vector>
 
 #include "ngraph/code_writer.hpp"
+#include "ngraph/op/abs.hpp"
+#include "ngraph/op/add.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/divide.hpp"
+#include "ngraph/op/max.hpp"
+#include "ngraph/op/maximum.hpp"
+#include "ngraph/op/minimum.hpp"
+#include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
+#include "ngraph/op/relu.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/pass/loop_kernel_collector.hpp"
 #include "ngraph/runtime/gpu/cuda_emitter.hpp"
 #include "ngraph/runtime/gpu/cudnn_emitter.hpp"
 #include "ngraph/runtime/gpu/gpu_cuda_kernel_builder.hpp"
@@ -32,6 +48,7 @@
 #include "ngraph/runtime/gpu/gpu_runtime_context.hpp"
 #include "ngraph/runtime/gpu/gpu_util.hpp"
 #include "ngraph/runtime/gpu/type_info.hpp"
+#include "ngraph/type/float16.hpp"
 #include "ngraph/util.hpp"
 
 using namespace ngraph;
@@ -204,7 +221,7 @@ size_t runtime::gpu::CUDAEmitter::build_concat(const std::string& dtype,
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list.data(),
                                           nullptr)); // arguments
             debug_sync();
@@ -308,7 +325,7 @@ size_t runtime::gpu::CUDAEmitter::build_topk(const std::vector<element::Type>& d
                                               1,
                                               1,
                                               0,
-                                              nullptr, // stream
+                                              m_ctx->stream, // stream
                                               args_list,
                                               nullptr)); // arguments
                 debug_sync();
@@ -332,7 +349,7 @@ size_t runtime::gpu::CUDAEmitter::build_topk(const std::vector<element::Type>& d
                                               1,
                                               1,
                                               shared_data_bytes, // shared mem
-                                              nullptr,           //stream
+                                              m_ctx->stream,     // stream
                                               args_list,
                                               nullptr)); // arguments
                 debug_sync();
@@ -395,7 +412,7 @@ size_t runtime::gpu::CUDAEmitter::build_onehot(const std::array<std::string, 2>&
         new gpu::primitive{[=](void** inputs, void** outputs) mutable {
             std::vector<void*> args_list{
                 &inputs[0], &outputs[0], &hot_axis_stride, &hot_axis_shape, &nthreads};
-            runtime::gpu::cuda_memset(outputs[0], 0, output_size);
+            runtime::gpu::cuda_memset(outputs[0], 0, output_size, m_ctx->stream);
             CUDA_SAFE_CALL(cuLaunchKernel(*compiled_kernel.get(),
                                           aligned_grid_size_x,
                                           1,
@@ -404,7 +421,7 @@ size_t runtime::gpu::CUDAEmitter::build_onehot(const std::array<std::string, 2>&
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list.data(),
                                           nullptr)); // arguments
             debug_sync();
@@ -475,7 +492,7 @@ size_t runtime::gpu::CUDAEmitter::build_reverse(const std::array<std::string, 2>
                                       1,
                                       1, // block dim
                                       0,
-                                      nullptr, // shared mem and stream
+                                      m_ctx->stream, // shared mem and stream
                                       args_list.data(),
                                       nullptr)); // arguments
         debug_sync();
@@ -560,7 +577,7 @@ size_t runtime::gpu::CUDAEmitter::build_pad(const std::vector<std::string>& dtyp
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -648,7 +665,7 @@ size_t runtime::gpu::CUDAEmitter::build_pad_fill(const std::vector<std::string>&
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -732,7 +749,7 @@ size_t runtime::gpu::CUDAEmitter::build_reshape(const std::array<std::string, 2>
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -818,7 +835,7 @@ size_t runtime::gpu::CUDAEmitter::build_reshape_2d(const std::array<std::string,
                                           block_size,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -908,7 +925,7 @@ size_t runtime::gpu::CUDAEmitter::build_reshape_3d(const std::array<std::string,
                                           block_size[1],
                                           block_size[2], // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -995,7 +1012,7 @@ size_t runtime::gpu::CUDAEmitter::build_slice(const std::array<std::string, 2>&
                                       1,
                                       1, // block dim
                                       0,
-                                      nullptr, // shared mem and stream
+                                      m_ctx->stream, // shared mem and stream
                                       args_list.data(),
                                       nullptr)); // arguments
         debug_sync();
@@ -1076,7 +1093,7 @@ size_t runtime::gpu::CUDAEmitter::build_reverse_sequence(const std::array<std::s
                                       1,
                                       1, // block dim
                                       0,
-                                      nullptr, // shared mem and stream
+                                      m_ctx->stream, // shared mem and stream
                                       args_list.data(),
                                       nullptr)); // arguments
         debug_sync();
@@ -1134,7 +1151,7 @@ size_t runtime::gpu::CUDAEmitter::build_1d_max_pool(const std::array<std::string
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -1319,7 +1336,7 @@ size_t runtime::gpu::CUDAEmitter::build_avg_pool(const std::array<std::string, 2
                                           1,
                                           1,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -1393,7 +1410,7 @@ size_t runtime::gpu::CUDAEmitter::build_elementwise_n_to_1(const std::vector<std
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list.data(),
                                           nullptr)); // arguments
             debug_sync();
@@ -1455,7 +1472,7 @@ size_t runtime::gpu::CUDAEmitter::build_memset(const std::string& dtype, uint32_
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -1520,7 +1537,7 @@ size_t runtime::gpu::CUDAEmitter::build_cudnn_bn_inv_var(const std::vector<std::
                                           1,
                                           1, // block dim
                                           0,
-                                          nullptr, // shared mem and stream
+                                          m_ctx->stream, // shared mem and stream
                                           args_list,
                                           nullptr)); // arguments
             debug_sync();
@@ -1529,6 +1546,93 @@ size_t runtime::gpu::CUDAEmitter::build_cudnn_bn_inv_var(const std::vector<std::
     return this->m_primitive_emitter->register_primitive(kernel_launch, hash);
 }
 
+size_t runtime::gpu::CUDAEmitter::build_half_conversion(size_t count, bool to_half)
+{
+    uint32_t nthreads = static_cast<uint32_t>(count);
+    // kernel_name is used to check if the cuda kernel has been previously compiled
+    std::string kernel_name = to_half ? "convert_float_to_half" : "convert_half_to_float";
+
+    // hash is used to check if the emitted primitive already exists
+    std::string hash = kernel_name + "_s" + std::to_string(count);
+
+    // if the primitive exists, we are done
+    size_t primitive_index = m_primitive_emitter->lookup(hash);
+    if (primitive_index != std::numeric_limits<size_t>::max())
+    {
+        return primitive_index;
+    }
+
+    uint32_t block_size_x = 512;
+    int num_SMs;
+    CUDA_RT_SAFE_CALL(cudaDeviceGetAttribute(&num_SMs, cudaDevAttrMultiProcessorCount, 0));
+    uint32_t aligned_grid_size_x = fmin(num_SMs * 32, align_to_block_size(nthreads, block_size_x));
+
+    auto args = m_primitive_emitter->add_kernel_args();
+    args.add_placeholder(to_half ? "float" : "uint16_t", "in")
+        .add_placeholder(to_half ? "uint16_t" : "float", "out")
+        .add("nthreads", nthreads);
+
+    auto compiled_kernel = m_ctx->compiled_kernel_pool->get(kernel_name);
+    if (compiled_kernel == nullptr)
+    {
+        CodeWriter writer;
+        CudaKernelBuilder::add_pod_typedefs(writer);
+        CudaKernelBuilder::get_half_conversion_op(writer, kernel_name, args, to_half);
+        compiled_kernel = m_ctx->compiled_kernel_pool->set(kernel_name, writer.get_code());
+    }
+
+    // create the launch primitive
+    std::unique_ptr<gpu::primitive> kernel_launch(
+        new gpu::primitive{[=](void** inputs, void** outputs) mutable {
+            void** args_list = args.resolve_placeholder(0, &inputs[0])
+                                   .resolve_placeholder(1, &outputs[0])
+                                   .get_argument_list();
+            CUDA_SAFE_CALL(cuLaunchKernel(*compiled_kernel.get(),
+                                          aligned_grid_size_x,
+                                          1,
+                                          1, // grid dim
+                                          block_size_x,
+                                          1,
+                                          1, // block dim
+                                          0,
+                                          m_ctx->stream, // shared mem and stream
+                                          args_list,
+                                          nullptr)); // arguments
+            debug_sync();
+        }});
+
+    return this->m_primitive_emitter->register_primitive(kernel_launch, hash);
+}
+
+std::function<void*(void*)>
+    runtime::gpu::CUDAEmitter::build_half_input(size_t count, std::shared_ptr<Node> source)
+{
+    GPUAllocator allocator = this->m_primitive_emitter->get_memory_allocator();
+    if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(source))
+    {
+        // constants such as weights are converted on the host once, at compile time
+        auto values = constant->get_vector<float>();
+        std::vector<uint16_t> half_values(values.size());
+        for (size_t i = 0; i < values.size(); i++)
+        {
+            half_values[i] = float16(values[i]).to_bits();
+        }
+        size_t idx_half = allocator.reserve_argspace(half_values);
+        return [=](void* ptr) { return runtime::gpu::invoke_memory_primitive(m_ctx, idx_half); };
+    }
+
+    size_t idx_half = allocator.reserve_workspace(count * sizeof(uint16_t), false);
+    size_t convert_index = build_half_conversion(count, true);
+    return [=](void* ptr) {
+        void* half_ptr = runtime::gpu::invoke_memory_primitive(m_ctx, idx_half);
+        gpu::invoke_primitive(m_ctx,
+                              convert_index,
+                              std::vector<void*>{ptr}.data(),
+                              std::vector<void*>{half_ptr}.data());
+        return half_ptr;
+    };
+}
+
 size_t runtime::gpu::CUDAEmitter::build_primitive(const op::MaxPool* node)
 {
     auto& args = node->get_inputs();
@@ -1742,7 +1846,7 @@ size_t runtime::gpu::CUDAEmitter::build_softmax(const std::vector<element::Type>
                                               1,
                                               1,
                                               0,
-                                              nullptr,
+                                              m_ctx->stream,
                                               args_list,
                                               nullptr));
                 debug_sync();
@@ -1800,7 +1904,7 @@ size_t runtime::gpu::CUDAEmitter::build_softmax(const std::vector<element::Type>
                                               1,
                                               1,
                                               shared_data_bytes,
-                                              nullptr,
+                                              m_ctx->stream,
                                               args_list,
                                               nullptr));
                 debug_sync();
@@ -1810,6 +1914,96 @@ size_t runtime::gpu::CUDAEmitter::build_softmax(const std::vector<element::Type>
     }
 }
 
+size_t runtime::gpu::CUDAEmitter::build_layer_norm(const std::vector<element::Type>& dtypes,
+                                                   size_t rows,
+                                                   size_t row_size,
+                                                   double epsilon)
+{
+    std::vector<std::string> dtypes_str = get_string_vector(dtypes);
+    // one block per row, sized to the largest power of two that fits in the row
+    uint32_t block_size_x = 1;
+    while ((block_size_x << 1) <= fmin(512, row_size))
+    {
+        block_size_x <<= 1;
+    }
+    std::string kernel_name =
+        "layer_norm_" + join(dtypes_str, "_") + "_bs_" + std::to_string(block_size_x);
+    std::replace(kernel_name.begin(), kernel_name.end(), ' ', '_');
+
+    std::stringstream ss;
+    ss << kernel_name << "_r_" << rows << "_c_" << row_size << "_eps_" << epsilon;
+    auto hash = ss.str();
+    // check if the requested kernel is already an inserted primitive
+    size_t primitive_index = m_primitive_emitter->lookup(hash);
+    if (primitive_index != std::numeric_limits<size_t>::max())
+    {
+        return primitive_index;
+    }
+
+    // room for the per warp sums and sums of squares, then the row mean and inverse deviation
+    uint32_t shared_data_bytes =
+        std::max(2u, 2 * (block_size_x >> 5)) * static_cast<uint32_t>(dtypes[3].size());
+    uint32_t aligned_grid_size_x = static_cast<uint32_t>(rows);
+    auto args = m_primitive_emitter->add_kernel_args();
+    args.add_placeholder(dtypes_str[0], "in")
+        .add_placeholder(dtypes_str[1], "gamma")
+        .add_placeholder(dtypes_str[2], "beta")
+        .add_placeholder(dtypes_str[3], "out")
+        .add("row_size", static_cast<uint32_t>(row_size))
+        .add("epsilon", static_cast<float>(epsilon));
+
+    // if the kernel has not been compiled, build it
+    auto compiled_kernel = m_ctx->compiled_kernel_pool->get(kernel_name);
+    if (compiled_kernel == nullptr)
+    {
+        CodeWriter writer;
+        CudaKernelBuilder::add_pod_typedefs(writer);
+        runtime::gpu::CudaKernelBuilder::get_layer_norm_op(
+            writer, kernel_name, args, dtypes_str, block_size_x);
+        compiled_kernel = m_ctx->compiled_kernel_pool->set(kernel_name, writer.get_code());
+    }
+
+    std::unique_ptr<gpu::primitive> layer_norm(
+        new gpu::primitive{[=](void** inputs, void** outputs) mutable {
+            void** args_list = args.resolve_placeholder(0, &inputs[0])
+                                   .resolve_placeholder(1, &inputs[1])
+                                   .resolve_placeholder(2, &inputs[2])
+                                   .resolve_placeholder(3, &outputs[0])
+                                   .get_argument_list();
+
+            CUDA_SAFE_CALL(cuLaunchKernel(*compiled_kernel.get(),
+                                          aligned_grid_size_x,
+                                          1,
+                                          1,
+                                          block_size_x,
+                                          1,
+                                          1,
+                                          shared_data_bytes,
+                                          m_ctx->stream,
+                                          args_list,
+                                          nullptr));
+            debug_sync();
+        }});
+
+    return this->m_primitive_emitter->register_primitive(layer_norm, hash);
+}
+
+size_t runtime::gpu::CUDAEmitter::build_gelu(const std::vector<std::string>& dtypes,
+                                             NVShape tensor_shape,
+                                             bool approximate)
+{
+    if (approximate)
+    {
+        return build_elementwise_n_to_1(
+            dtypes,
+            tensor_shape,
+            "gelu_tanh",
+            "0.5f * x0 * (1.0f + tanhf(0.7978845608f * (x0 + 0.044715f * x0 * x0 * x0)))");
+    }
+    return build_elementwise_n_to_1(
+        dtypes, tensor_shape, "gelu", "0.5f * x0 * (1.0f + erff(x0 * 0.7071067812f))");
+}
+
 size_t runtime::gpu::CUDAEmitter::build_reduce_to_nd(const std::vector<element::Type>& dtypes,
                                                      NVShape input_shape,
                                                      NVShape reduce_axis,
@@ -1909,7 +2103,7 @@ size_t runtime::gpu::CUDAEmitter::build_reduce_to_nd(const std::vector<element::
                                           1,
                                           1,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -1983,7 +2177,7 @@ size_t runtime::gpu::CUDAEmitter::build_reduce_to_scalar(const std::vector<eleme
                                           1,
                                           1,
                                           shared_data_bytes,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -2052,7 +2246,7 @@ size_t
                                           1,
                                           1,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
         }});
@@ -2145,7 +2339,7 @@ size_t runtime::gpu::CUDAEmitter::build_reduce(const std::vector<element::Type>&
         size_t size = nthreads * data_bytes;
         std::unique_ptr<gpu::primitive> memcopy(
             new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-                runtime::gpu::cuda_memcpyDtD(outputs[0], inputs[0], size);
+                runtime::gpu::cuda_memcpyDtD(outputs[0], inputs[0], size, m_ctx->stream);
             }});
         primitive_index = this->m_primitive_emitter->insert(std::move(memcopy));
     }
@@ -2329,7 +2523,7 @@ size_t
                                           1,
                                           1,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -2338,6 +2532,197 @@ size_t
     return this->m_primitive_emitter->register_primitive(ew_collective, hash);
 }
 
+size_t runtime::gpu::CUDAEmitter::build_primitive(const ngraph::op::gpu::LoopKernel* node)
+{
+    struct LoopKernelOp
+    {
+        const char* op;
+        const char* math_kernel;
+    };
+#define LOOP_KERNEL_OP(T)                                                                          \
+    {                                                                                              \
+        std::type_index(typeid(T)), { CudaOpMap<T>::op, CudaOpMap<T>::math_kernel }                \
+    }
+    static const std::unordered_map<std::type_index, LoopKernelOp> loop_kernel_ops{
+        LOOP_KERNEL_OP(ngraph::op::Abs),
+        LOOP_KERNEL_OP(ngraph::op::Add),
+        LOOP_KERNEL_OP(ngraph::op::Divide),
+        LOOP_KERNEL_OP(ngraph::op::Multiply),
+        LOOP_KERNEL_OP(ngraph::op::Negative),
+        LOOP_KERNEL_OP(ngraph::op::Subtract),
+        LOOP_KERNEL_OP(ngraph::op::Relu),
+        LOOP_KERNEL_OP(ngraph::op::Minimum),
+        LOOP_KERNEL_OP(ngraph::op::Maximum),
+        // trailing reductions fold with the matching binary op
+        {std::type_index(typeid(ngraph::op::Sum)),
+         {CudaOpMap<ngraph::op::Add>::op, CudaOpMap<ngraph::op::Add>::math_kernel}},
+        {std::type_index(typeid(ngraph::op::Max)),
+         {CudaOpMap<ngraph::op::Maximum>::op, CudaOpMap<ngraph::op::Maximum>::math_kernel}}};
+#undef LOOP_KERNEL_OP
+
+    auto args = node->get_arguments();
+    auto& kernel_outputs = node->get_kernel_outputs();
+    std::string dtype = node->get_output_element_type(0).c_type_string();
+
+    // name a register for every kernel input and node, and write the expression of each
+    // elementwise node in terms of them. The kernel name encodes the expressions, so
+    // kernels with the same structure are compiled once whatever their shapes
+    std::unordered_map<const Node*, std::string> registers;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        registers.insert({args[i].get(), "i" + std::to_string(i)});
+    }
+    std::vector<std::string> expressions;
+    std::map<std::string, std::pair<std::string, size_t>> device_helpers;
+    std::stringstream kernel_name;
+    kernel_name << "loop_kernel_" << dtype << "_i" << args.size();
+    for (auto& n : node->get_node_list())
+    {
+        auto& lk_op = loop_kernel_ops.at(std::type_index(typeid(*n)));
+        size_t arity = ngraph::pass::LoopKernelCollector::is_trailing_reduction(*n)
+                           ? 2
+                           : n->get_input_size();
+        if (lk_op.math_kernel)
+        {
+            device_helpers[lk_op.op] = std::make_pair(lk_op.math_kernel, arity);
+        }
+        if (ngraph::pass::LoopKernelCollector::is_trailing_reduction(*n))
+        {
+            registers.insert({n.get(), registers.at(n->get_argument(0).get())});
+            continue;
+        }
+
+        std::vector<std::string> operands;
+        for (auto& arg : n->get_arguments())
+        {
+            operands.push_back(registers.at(arg.get()));
+        }
+        registers.insert({n.get(), "t" + std::to_string(expressions.size())});
+        expressions.push_back(std::string(lk_op.op) + "(" + join(operands, ", ") + ")");
+        kernel_name << "_" << lk_op.op << "_" << join(operands, "_");
+    }
+
+    std::vector<std::string> output_registers;
+    std::vector<std::string> reduce_ops;
+    for (auto& o : kernel_outputs)
+    {
+        output_registers.push_back(registers.at(o.get()));
+        bool is_reduction = ngraph::pass::LoopKernelCollector::is_trailing_reduction(*o);
+        reduce_ops.push_back(is_reduction ? loop_kernel_ops.at(std::type_index(typeid(*o))).op
+                                          : "");
+        kernel_name << "_o" << reduce_ops.back() << output_registers.back();
+    }
+
+    size_t nthreads = shape_size(node->get_node_list()[0]->get_shape());
+    size_t reduction_size = node->get_reduction_size();
+    size_t rows = nthreads / reduction_size;
+
+    // hash is used to check if the emitted primitive already exists
+    std::stringstream ss;
+    ss << kernel_name.str() << "_s" << nthreads << "_r" << reduction_size;
+    auto hash = ss.str();
+
+    // if the primitive exists, we are done
+    size_t primitive_index = m_primitive_emitter->lookup(hash);
+    if (primitive_index != std::numeric_limits<size_t>::max())
+    {
+        return primitive_index;
+    }
+
+    auto kernel_args = this->m_primitive_emitter->add_kernel_args();
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        kernel_args.add_placeholder(dtype, "in" + std::to_string(i));
+    }
+    for (size_t i = 0; i < kernel_outputs.size(); i++)
+    {
+        kernel_args.add_placeholder(dtype, "out" + std::to_string(i));
+    }
+
+    uint32_t block_size_x = 512;
+    uint32_t aligned_grid_size_x;
+    size_t shared_data_bytes = 0;
+    if (node->has_reduction())
+    {
+        // one block per row, sized to the row so short rows don't leave threads idle
+        block_size_x = 32;
+        while (block_size_x < reduction_size && block_size_x < 512)
+        {
+            block_size_x <<= 1;
+        }
+        aligned_grid_size_x = static_cast<uint32_t>(
+            std::min(rows, static_cast<size_t>(std::numeric_limits<uint16_t>::max())));
+        size_t num_reductions =
+            std::count_if(reduce_ops.begin(), reduce_ops.end(), [](const std::string& op) {
+                return !op.empty();
+            });
+        shared_data_bytes =
+            block_size_x * num_reductions * node->get_output_element_type(0).size();
+        kernel_args.add("rows", static_cast<uint32_t>(rows))
+            .add("reduction_size", static_cast<uint32_t>(reduction_size));
+    }
+    else
+    {
+        int num_SMs;
+        CUDA_RT_SAFE_CALL(cudaDeviceGetAttribute(&num_SMs, cudaDevAttrMultiProcessorCount, 0));
+        aligned_grid_size_x =
+            fmin(num_SMs * 32, align_to_block_size(static_cast<uint32_t>(nthreads), block_size_x));
+        kernel_args.add("n", static_cast<uint32_t>(nthreads));
+    }
+
+    auto compiled_kernel = m_ctx->compiled_kernel_pool->get(kernel_name.str());
+    if (compiled_kernel == nullptr)
+    {
+        CodeWriter writer;
+        CudaKernelBuilder::add_pod_typedefs(writer);
+        for (auto& helper : device_helpers)
+        {
+            std::vector<std::string> dtypes(helper.second.second + 1, dtype);
+            CudaKernelBuilder::get_device_helper(
+                writer, helper.first, helper.second.first, dtypes);
+        }
+        CudaKernelBuilder::get_loop_kernel_op(writer,
+                                              kernel_name.str(),
+                                              kernel_args,
+                                              dtype,
+                                              args.size(),
+                                              expressions,
+                                              output_registers,
+                                              reduce_ops);
+        compiled_kernel = m_ctx->compiled_kernel_pool->set(kernel_name.str(), writer.get_code());
+    }
+
+    size_t num_inputs = args.size();
+    size_t num_outputs = kernel_outputs.size();
+    std::unique_ptr<gpu::primitive> loop_kernel(
+        new gpu::primitive{[=](void** inputs, void** outputs) mutable {
+            for (size_t i = 0; i < num_inputs; i++)
+            {
+                kernel_args.resolve_placeholder(i, &inputs[i]);
+            }
+            for (size_t i = 0; i < num_outputs; i++)
+            {
+                kernel_args.resolve_placeholder(num_inputs + i, &outputs[i]);
+            }
+            void** args_list = kernel_args.get_argument_list();
+
+            CUDA_SAFE_CALL(cuLaunchKernel(*compiled_kernel.get(),
+                                          aligned_grid_size_x,
+                                          1,
+                                          1,
+                                          block_size_x,
+                                          1,
+                                          1,
+                                          static_cast<unsigned int>(shared_data_bytes),
+                                          m_ctx->stream,
+                                          args_list,
+                                          nullptr));
+            debug_sync();
+        }});
+
+    return this->m_primitive_emitter->register_primitive(loop_kernel, hash);
+}
+
 size_t runtime::gpu::CUDAEmitter::build_broadcast(const std::array<std::string, 2>& dtypes,
                                                   NVShape result_shape,
                                                   const std::set<size_t>& reduce_axes)
@@ -2428,7 +2813,7 @@ size_t runtime::gpu::CUDAEmitter::build_broadcast(const std::array<std::string,
                                           1,
                                           1,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -2626,7 +3011,7 @@ size_t runtime::gpu::CUDAEmitter::build_primitive(const op::ReplaceSlice* node,
         size_t size = nthreads * args[1].get_element_type().size();
         std::unique_ptr<gpu::primitive> kernel_launch(
             new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-                runtime::gpu::cuda_memcpyDtD(outputs[0], inputs[0], size);
+                runtime::gpu::cuda_memcpyDtD(outputs[0], inputs[0], size, m_ctx->stream);
                 runtime::gpu::invoke_primitive(
                     m_ctx, pad_index, std::vector<void*>{inputs[1]}.data(), outputs);
             }});
@@ -2833,7 +3218,7 @@ size_t runtime::gpu::CUDAEmitter::build_convolution(const std::array<std::string
                                           threads.y,
                                           threads.z,
                                           0,
-                                          nullptr,
+                                          m_ctx->stream,
                                           args_list,
                                           nullptr));
             debug_sync();
@@ -17,6 +17,8 @@
 #pragma once
 
 #include <array>
+#include <functional>
+#include <memory>
 #include "ngraph/code_writer.hpp"
 #include "ngraph/runtime/gpu/gpu_cuda_kernel_ops.hpp"
 #include "ngraph/runtime/gpu/gpu_host_parameters.hpp"
@@ -28,6 +30,7 @@
 #include "ngraph/op/max_pool.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/softmax.hpp"
+#include "ngraph/runtime/gpu/op/loop_kernel.hpp"
 
 namespace ngraph
 {
@@ -48,6 +51,7 @@ namespace ngraph
                 size_t build_primitive(const op::Convolution* node);
                 size_t build_primitive(const op::MaxPool* node);
                 size_t build_primitive(const op::ReplaceSlice* node, bool in_place_op);
+                size_t build_primitive(const ngraph::op::gpu::LoopKernel* node);
 
             public:
                 size_t build_memset(const std::string& dtype, uint32_t tensor_size);
@@ -116,6 +120,16 @@ namespace ngraph
                         dtypes, tensor_shape, CudaOpMap<T>::op, CudaOpMap<T>::math_kernel);
                 }
 
+                /// \brief Converts `count` f32 values to f16, stored as uint16_t, or back
+                size_t build_half_conversion(size_t count, bool to_half);
+
+                /// \brief Returns a function that takes the device address of `count` f32 values
+                ///        produced by `source` and yields the address of an f16 copy of them.
+                ///        Constants are converted once at compile time, other values into
+                ///        workspace whenever the function is called.
+                std::function<void*(void*)> build_half_input(size_t count,
+                                                             std::shared_ptr<Node> source);
+
                 size_t build_cudnn_bn_inv_var(const std::vector<std::string>& dtypes,
                                               NVShape tensor_shape,
                                               const double& eps);
@@ -187,6 +201,15 @@ namespace ngraph
                                      NVShape input_shape,
                                      NVShape reduce_axis);
 
+                size_t build_layer_norm(const std::vector<element::Type>& dtypes,
+                                        size_t rows,
+                                        size_t row_size,
+                                        double epsilon);
+
+                size_t build_gelu(const std::vector<std::string>& dtypes,
+                                  NVShape tensor_shape,
+                                  bool approximate);
+
                 void debug_sync();
                 void sync();
 
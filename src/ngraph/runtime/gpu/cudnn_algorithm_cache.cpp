@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cudnn.h>
+#include <fstream>
+#include <sstream>
+#include <unistd.h>
+
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/gpu/cuda_error_check.hpp"
+#include "ngraph/runtime/gpu/cudnn_algorithm_cache.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+runtime::gpu::CUDNNAlgorithmCache& runtime::gpu::CUDNNAlgorithmCache::get()
+{
+    static const char* s_path = getenv("NGRAPH_GPU_CUDNN_ALGO_CACHE");
+    static CUDNNAlgorithmCache s_cache(s_path == nullptr ? "" : s_path);
+    return s_cache;
+}
+
+runtime::gpu::CUDNNAlgorithmCache::CUDNNAlgorithmCache(const string& path)
+    : m_path(path)
+{
+    if (!m_path.empty())
+    {
+        read_file();
+    }
+}
+
+string runtime::gpu::CUDNNAlgorithmCache::get_key(const string& direction,
+                                                  const string& descriptor)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if (m_device.empty())
+    {
+        int device = 0;
+        cudaDeviceProp properties;
+        CUDA_RT_SAFE_CALL(cudaGetDevice(&device));
+        CUDA_RT_SAFE_CALL(cudaGetDeviceProperties(&properties, device));
+        // entries are whitespace separated, keep the device name a single token
+        string name = properties.name;
+        for (char& c : name)
+        {
+            c = isspace(static_cast<unsigned char>(c)) ? '_' : c;
+        }
+        m_device = name + "_sm" + to_string(properties.major) + to_string(properties.minor) +
+                   "_cudnn" + to_string(cudnnGetVersion());
+    }
+    return m_device + "/" + direction + "/" + descriptor;
+}
+
+void runtime::gpu::CUDNNAlgorithmCache::read_file()
+{
+    ifstream in(m_path);
+    string key;
+    Entry entry;
+    while (in >> key >> entry.algo >> entry.workspace_size)
+    {
+        m_entries[key] = entry;
+    }
+}
+
+bool runtime::gpu::CUDNNAlgorithmCache::load(const string& key, Entry& entry)
+{
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_entries.find(key);
+    if (it == m_entries.end())
+    {
+        return false;
+    }
+    entry = it->second;
+    return true;
+}
+
+void runtime::gpu::CUDNNAlgorithmCache::store(const string& key, const Entry& entry)
+{
+    lock_guard<mutex> lock(m_mutex);
+    // pick up entries other processes stored since this one read the file
+    read_file();
+    m_entries[key] = entry;
+
+    // Write to a file of this process first so that concurrent processes never read a
+    // partially written cache
+    string temporary = m_path + "." + to_string(getpid());
+    {
+        ofstream out(temporary);
+        for (auto& e : m_entries)
+        {
+            out << e.first << " " << e.second.algo << " " << e.second.workspace_size << "\n";
+        }
+        if (!out)
+        {
+            NGRAPH_DEBUG << "Unable to write cuDNN algorithm cache " << temporary;
+            remove(temporary.c_str());
+            return;
+        }
+    }
+    if (rename(temporary.c_str(), m_path.c_str()) != 0)
+    {
+        remove(temporary.c_str());
+    }
+}
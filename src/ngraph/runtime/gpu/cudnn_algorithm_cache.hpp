@@ -0,0 +1,71 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gpu
+        {
+            /// \brief Persistent record of the cuDNN convolution algorithms chosen by
+            ///        benchmarking, so that later compiles and processes reuse them instead of
+            ///        running cudnnFind* again.
+            ///
+            /// Enabled by setting NGRAPH_GPU_CUDNN_ALGO_CACHE to the cache file. Entries are
+            /// keyed by the convolution direction and descriptors, the name and compute
+            /// capability of the current device and the cuDNN version.
+            class CUDNNAlgorithmCache
+            {
+            public:
+                struct Entry
+                {
+                    int algo;
+                    size_t workspace_size;
+                };
+
+                /// The cache configured by NGRAPH_GPU_CUDNN_ALGO_CACHE
+                static CUDNNAlgorithmCache& get();
+                /// A cache backed by the file `path`, disabled if it is empty
+                explicit CUDNNAlgorithmCache(const std::string& path);
+
+                bool is_enabled() const { return !m_path.empty(); }
+                std::string get_key(const std::string& direction, const std::string& descriptor);
+                /// \returns false if there is no entry for `key`
+                bool load(const std::string& key, Entry& entry);
+                void store(const std::string& key, const Entry& entry);
+
+                CUDNNAlgorithmCache(const CUDNNAlgorithmCache&) = delete;
+                CUDNNAlgorithmCache& operator=(const CUDNNAlgorithmCache&) = delete;
+
+            private:
+                void read_file();
+
+                std::string m_path;
+                std::string m_device;
+                std::unordered_map<std::string, Entry> m_entries;
+                std::mutex m_mutex;
+            };
+        }
+    }
+}
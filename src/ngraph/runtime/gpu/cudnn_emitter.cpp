@@ -15,11 +15,14 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <functional>
 #include <iostream>
 #include <sstream>
 #include <vector>
 
 #include "ngraph/log.hpp"
+#include "ngraph/runtime/gpu/cuda_emitter.hpp"
+#include "ngraph/runtime/gpu/cudnn_algorithm_cache.hpp"
 #include "ngraph/runtime/gpu/cudnn_emitter.hpp"
 #include "ngraph/runtime/gpu/gpu_emitter.hpp"
 #include "ngraph/runtime/gpu/gpu_invoke.hpp"
@@ -507,14 +510,15 @@ size_t runtime::gpu::CUDNNEmitter::build_primitive(const op::Convolution* node)
     CoordinateDiff padding_below_diff = node->get_padding_below();
     CoordinateDiff padding_above_diff = node->get_padding_above();
     auto dtype = out[0].get_element_type().c_type_string();
+    bool tensor_op_math = runtime::gpu::use_tensor_op_math() && dtype == "float";
 
     // construct hash to determine if kernel needs to be emitted
     // or if it already exists in the primitive list
     std::stringstream ss;
-    ss << "convolution_op_" << dtype << "_i" << join(input_shape, "_") << "_w"
-       << join(filter_shape, "_") << "_o" << join(output_shape, "_") << "_ws"
-       << join(window_movement_strides, "_") << "_wd" << join(window_dilation_strides, "_") << "_p"
-       << join(padding_below_diff, "_");
+    ss << "convolution_op_" << dtype << (tensor_op_math ? "_tensor_op" : "") << "_i"
+       << join(input_shape, "_") << "_w" << join(filter_shape, "_") << "_o"
+       << join(output_shape, "_") << "_ws" << join(window_movement_strides, "_") << "_wd"
+       << join(window_dilation_strides, "_") << "_p" << join(padding_below_diff, "_");
     std::string hash = ss.str();
 
     // check if the requested kernel is already an inserted primitive
@@ -579,10 +583,47 @@ size_t runtime::gpu::CUDNNEmitter::build_primitive(const op::Convolution* node)
                                           window_movement_strides,
                                           window_dilation_strides,
                                           padding_below,
-                                          algo_policy);
+                                          algo_policy,
+                                          tensor_op_math);
+
+    // with tensor op math the convolution reads f16 copies of its inputs, the filter of a
+    // constant is converted once, and writes an f16 result that is converted back to f32
+    std::function<void*(void*)> conv_input = [](void* ptr) { return ptr; };
+    std::function<void*(void*)> conv_filter = [](void* ptr) { return ptr; };
+    std::function<void*(void*)> conv_output = [](void* ptr) { return ptr; };
+    std::function<void(void*, void*)> convert_output = [](void* conv_out, void* out) {};
+    if (tensor_op_math)
+    {
+        auto& cuda_emitter = m_primitive_emitter->get_cuda_emitter();
+        GPUAllocator allocator = m_primitive_emitter->get_memory_allocator();
+        std::shared_ptr<Node> input_source = node->get_argument(0);
+        if (pad_index != std::numeric_limits<size_t>::max())
+        {
+            // converts the padded copy of the input
+            input_source = nullptr;
+        }
+        conv_input = cuda_emitter->build_half_input(shape_size(input_shape_padded), input_source);
+        conv_filter =
+            cuda_emitter->build_half_input(shape_size(filter_shape), node->get_argument(1));
+
+        size_t idx_half_output =
+            allocator.reserve_workspace(shape_size(output_shape) * sizeof(uint16_t), false);
+        size_t convert_output_index =
+            cuda_emitter->build_half_conversion(shape_size(output_shape), false);
+        conv_output = [=](void* ptr) {
+            return runtime::gpu::invoke_memory_primitive(m_ctx, idx_half_output);
+        };
+        convert_output = [=](void* conv_out, void* out) {
+            gpu::invoke_primitive(m_ctx,
+                                  convert_output_index,
+                                  std::vector<void*>{conv_out}.data(),
+                                  std::vector<void*>{out}.data());
+        };
+    }
 
     std::unique_ptr<gpu::primitive> kernel_launch(
         new gpu::primitive{[=](void** inputs, void** outputs) mutable {
+            void* input = inputs[0];
             if (idx_workspace != std::numeric_limits<size_t>::max() &&
                 pad_index != std::numeric_limits<size_t>::max())
             {
@@ -591,13 +632,13 @@ size_t runtime::gpu::CUDNNEmitter::build_primitive(const op::Convolution* node)
                                       pad_index,
                                       std::vector<void*>{inputs[0]}.data(),
                                       std::vector<void*>{pad_buffer}.data());
-                gpu::invoke_primitive(
-                    m_ctx, conv_index, std::vector<void*>{pad_buffer, inputs[1]}.data(), outputs);
-            }
-            else
-            {
-                gpu::invoke_primitive(m_ctx, conv_index, inputs, outputs);
+                input = pad_buffer;
             }
+            void* output = conv_output(outputs[0]);
+            std::vector<void*> conv_args{conv_input(input), conv_filter(inputs[1])};
+            gpu::invoke_primitive(
+                m_ctx, conv_index, conv_args.data(), std::vector<void*>{output}.data());
+            convert_output(output, outputs[0]);
         }});
 
     return this->m_primitive_emitter->register_primitive(kernel_launch, hash);
@@ -970,14 +1011,16 @@ size_t runtime::gpu::CUDNNEmitter::build_primitive(const op::Max* node)
 
         kernel_launch.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
             void* temp_d = runtime::gpu::invoke_memory_primitive(m_ctx, idx_float_inf);
-            runtime::gpu::cuda_memcpyDtD(outputs[0], temp_d, output_size * output_element_size);
+            runtime::gpu::cuda_memcpyDtD(
+                outputs[0], temp_d, output_size * output_element_size, m_ctx->stream);
         }});
     }
     else if (input_size == output_size)
     {
         // no reduction
         kernel_launch.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-            runtime::gpu::cuda_memcpyDtD(outputs[0], inputs[0], output_size * output_element_size);
+            runtime::gpu::cuda_memcpyDtD(
+                outputs[0], inputs[0], output_size * output_element_size, m_ctx->stream);
         }});
     }
     else
@@ -1033,14 +1076,16 @@ size_t runtime::gpu::CUDNNEmitter::build_primitive(const op::Min* node)
 
         kernel_launch.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
             void* temp_d = runtime::gpu::invoke_memory_primitive(m_ctx, idx_float_inf);
-            runtime::gpu::cuda_memcpyDtD(outputs[0], temp_d, output_size * output_element_size);
+            runtime::gpu::cuda_memcpyDtD(
+                outputs[0], temp_d, output_size * output_element_size, m_ctx->stream);
         }});
     }
     else if (input_size == output_size)
     {
         // no reduction
         kernel_launch.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-            runtime::gpu::cuda_memcpyDtD(outputs[0], inputs[0], output_size * output_element_size);
+            runtime::gpu::cuda_memcpyDtD(
+                outputs[0], inputs[0], output_size * output_element_size, m_ctx->stream);
         }});
     }
     else
@@ -1288,6 +1333,59 @@ size_t runtime::gpu::CUDNNEmitter::build_primitive(const op::gpu::Rnn* node)
 }
 #endif
 
+// A whitespace free summary of a convolution for CUDNNAlgorithmCache keys
+static std::string convolution_descriptor(const std::string& dtype,
+                                          const std::vector<Shape>& shapes,
+                                          const Strides& window_movement_strides,
+                                          const Strides& window_dilation_strides,
+                                          const Shape& padding_below,
+                                          bool tensor_op_math = false)
+{
+    std::stringstream ss;
+    ss << dtype;
+    for (auto& shape : shapes)
+    {
+        ss << "_" << join(shape, "x");
+    }
+    ss << "_s" << join(window_movement_strides, "x") << "_d" << join(window_dilation_strides, "x")
+       << "_p" << join(padding_below, "x") << (tensor_op_math ? "_tensor_op" : "");
+    return ss.str();
+}
+
+template <typename PERF_TYPE, typename ALGO_TYPE>
+ALGO_TYPE runtime::gpu::CUDNNEmitter::find_convolution_algo(
+    const std::string& direction,
+    const std::string& descriptor,
+    const algo_search find_algo,
+    const std::function<std::vector<PERF_TYPE>(algo_search)>& search)
+{
+    size_t workspace_budget = m_primitive_emitter->get_workspace_budget();
+    auto& algo_cache = CUDNNAlgorithmCache::get();
+    std::string key;
+    if (find_algo == algo_search::EXPLICIT && algo_cache.is_enabled())
+    {
+        key = algo_cache.get_key(direction, descriptor);
+        CUDNNAlgorithmCache::Entry entry;
+        if (algo_cache.load(key, entry) && entry.workspace_size <= workspace_budget)
+        {
+            return static_cast<ALGO_TYPE>(entry.algo);
+        }
+    }
+
+    for (auto const& result : search(find_algo))
+    {
+        if (result.status == CUDNN_STATUS_SUCCESS && result.memory <= workspace_budget)
+        {
+            if (!key.empty())
+            {
+                algo_cache.store(key, {static_cast<int>(result.algo), result.memory});
+            }
+            return result.algo;
+        }
+    }
+    throw ngraph_error("No suitable cuDNN algorithm was found for the requested operation.");
+}
+
 size_t runtime::gpu::CUDNNEmitter::build_convolution(const std::string& dtype,
                                                      const Shape& input_tensor_shape,
                                                      const Shape& input_filter_shape,
@@ -1295,9 +1393,12 @@ size_t runtime::gpu::CUDNNEmitter::build_convolution(const std::string& dtype,
                                                      const Strides& window_movement_strides,
                                                      const Strides& window_dilation_strides,
                                                      const Shape& padding_below,
-                                                     const algo_search find_algo)
+                                                     const algo_search find_algo,
+                                                     bool tensor_op_math)
 {
-    cudnnDataType_t data_type = get_cudnn_datatype(dtype);
+    cudnnDataType_t compute_type = get_cudnn_datatype(dtype);
+    // with tensor op math the tensors are f16 copies and accumulation stays in f32
+    cudnnDataType_t data_type = tensor_op_math ? CUDNN_DATA_HALF : compute_type;
     const cudnnTensorFormat_t tensor_format = CUDNN_TENSOR_NCHW;
     const cudnnConvolutionMode_t mode = CUDNN_CROSS_CORRELATION;
 
@@ -1307,34 +1408,51 @@ size_t runtime::gpu::CUDNNEmitter::build_convolution(const std::string& dtype,
         tensor_descriptor_from_shape(output_tensor_shape, data_type, tensor_format);
     auto& filter_desc = get_cudnn_filter_descriptor(input_filter_shape, data_type, tensor_format);
     auto& conv_desc = get_cudnn_convolution_descriptor(
-        padding_below, window_movement_strides, window_dilation_strides, mode, data_type);
+        padding_below, window_movement_strides, window_dilation_strides, mode, compute_type);
+    if (tensor_op_math)
+    {
+        CUDNN_SAFE_CALL(cudnnSetConvolutionMathType(conv_desc, CUDNN_TENSOR_OP_MATH));
+    }
     cudnnConvolutionFwdAlgo_t conv_fwd_algo = CUDNN_CONVOLUTION_FWD_ALGO_IMPLICIT_GEMM;
 
     if (find_algo != algo_search::NONE)
     {
-        int num_algos;
-        int max_algos = 0;
-        CUDNN_SAFE_CALL(
-            cudnnGetConvolutionForwardAlgorithmMaxCount(*m_ctx->cudnn_handle, &max_algos));
-        std::vector<cudnnConvolutionFwdAlgoPerf_t> results(max_algos);
-        auto cudnn_algo_search = (find_algo == algo_search::EXPLICIT)
-                                     ? cudnnFindConvolutionForwardAlgorithm
-                                     : cudnnGetConvolutionForwardAlgorithm_v7;
-        CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
-                                             tensor_desc_0,
-                                             filter_desc,
-                                             conv_desc,
-                                             tensor_desc_1,
-                                             static_cast<int>(results.size()),
-                                             &num_algos,
-                                             results.data()));
-        results.resize(num_algos);
+        auto search = [&](algo_search policy) {
+            int num_algos;
+            int max_algos = 0;
+            CUDNN_SAFE_CALL(
+                cudnnGetConvolutionForwardAlgorithmMaxCount(*m_ctx->cudnn_handle, &max_algos));
+            std::vector<cudnnConvolutionFwdAlgoPerf_t> results(max_algos);
+            auto cudnn_algo_search = (policy == algo_search::EXPLICIT)
+                                         ? cudnnFindConvolutionForwardAlgorithm
+                                         : cudnnGetConvolutionForwardAlgorithm_v7;
+            CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
+                                                 tensor_desc_0,
+                                                 filter_desc,
+                                                 conv_desc,
+                                                 tensor_desc_1,
+                                                 static_cast<int>(results.size()),
+                                                 &num_algos,
+                                                 results.data()));
+            results.resize(num_algos);
+            return results;
+        };
         conv_fwd_algo =
-            select_cudnn_algo<cudnnConvolutionFwdAlgoPerf_t, cudnnConvolutionFwdAlgo_t>(results);
-    }
-
-    void* alpha = m_host_parameters.allocate_by_datatype(data_type, 1.0);
-    void* beta = m_host_parameters.allocate_by_datatype(data_type, 0);
+            find_convolution_algo<cudnnConvolutionFwdAlgoPerf_t, cudnnConvolutionFwdAlgo_t>(
+                "forward",
+                convolution_descriptor(
+                    dtype,
+                    {input_tensor_shape, input_filter_shape, output_tensor_shape},
+                    window_movement_strides,
+                    window_dilation_strides,
+                    padding_below,
+                    tensor_op_math),
+                find_algo,
+                search);
+    }
+
+    void* alpha = m_host_parameters.allocate_by_datatype(compute_type, 1.0);
+    void* beta = m_host_parameters.allocate_by_datatype(compute_type, 0);
 
     size_t workspace_size_in_bytes = 0;
     CUDNN_SAFE_CALL(cudnnGetConvolutionForwardWorkspaceSize(*m_ctx->cudnn_handle,
@@ -1398,26 +1516,38 @@ size_t runtime::gpu::CUDNNEmitter::build_convolution_backward_data(
     cudnnConvolutionBwdDataAlgo_t conv_bwd_data_algo = CUDNN_CONVOLUTION_BWD_DATA_ALGO_0;
     if (find_algo != algo_search::NONE)
     {
-        int num_algos;
-        int max_algos = 0;
-        CUDNN_SAFE_CALL(
-            cudnnGetConvolutionBackwardDataAlgorithmMaxCount(*m_ctx->cudnn_handle, &max_algos));
-        std::vector<cudnnConvolutionBwdDataAlgoPerf_t> results(max_algos);
-        auto cudnn_algo_search = (find_algo == algo_search::EXPLICIT)
-                                     ? cudnnFindConvolutionBackwardDataAlgorithm
-                                     : cudnnGetConvolutionBackwardDataAlgorithm_v7;
-        CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
-                                             filter_desc,
-                                             tensor_desc_0,
-                                             conv_desc,
-                                             tensor_desc_1,
-                                             static_cast<int>(results.size()),
-                                             &num_algos,
-                                             results.data()));
-        results.resize(num_algos);
+        auto search = [&](algo_search policy) {
+            int num_algos;
+            int max_algos = 0;
+            CUDNN_SAFE_CALL(cudnnGetConvolutionBackwardDataAlgorithmMaxCount(
+                *m_ctx->cudnn_handle, &max_algos));
+            std::vector<cudnnConvolutionBwdDataAlgoPerf_t> results(max_algos);
+            auto cudnn_algo_search = (policy == algo_search::EXPLICIT)
+                                         ? cudnnFindConvolutionBackwardDataAlgorithm
+                                         : cudnnGetConvolutionBackwardDataAlgorithm_v7;
+            CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
+                                                 filter_desc,
+                                                 tensor_desc_0,
+                                                 conv_desc,
+                                                 tensor_desc_1,
+                                                 static_cast<int>(results.size()),
+                                                 &num_algos,
+                                                 results.data()));
+            results.resize(num_algos);
+            return results;
+        };
         conv_bwd_data_algo =
-            select_cudnn_algo<cudnnConvolutionBwdDataAlgoPerf_t, cudnnConvolutionBwdDataAlgo_t>(
-                results);
+            find_convolution_algo<cudnnConvolutionBwdDataAlgoPerf_t,
+                                  cudnnConvolutionBwdDataAlgo_t>(
+                "backward_data",
+                convolution_descriptor(
+                    dtype,
+                    {input_filter_shape, input_tensor_shape, output_tensor_shape},
+                    window_movement_strides,
+                    window_dilation_strides,
+                    padding_below),
+                find_algo,
+                search);
     }
 
     void* alpha = m_host_parameters.allocate_by_datatype(data_type, 1.0);
@@ -1485,26 +1615,38 @@ size_t runtime::gpu::CUDNNEmitter::build_convolution_backward_filter(
     cudnnConvolutionBwdFilterAlgo_t conv_bwd_filter_algo = CUDNN_CONVOLUTION_BWD_FILTER_ALGO_0;
     if (find_algo != algo_search::NONE)
     {
-        int num_algos;
-        int max_algos = 0;
-        CUDNN_SAFE_CALL(
-            cudnnGetConvolutionBackwardFilterAlgorithmMaxCount(*m_ctx->cudnn_handle, &max_algos));
-        std::vector<cudnnConvolutionBwdFilterAlgoPerf_t> results(max_algos);
-        auto cudnn_algo_search = (find_algo == algo_search::EXPLICIT)
-                                     ? cudnnFindConvolutionBackwardFilterAlgorithm
-                                     : cudnnGetConvolutionBackwardFilterAlgorithm_v7;
-        CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
-                                             tensor_desc_0,
-                                             tensor_desc_1,
-                                             conv_desc,
-                                             filter_desc,
-                                             static_cast<int>(results.size()),
-                                             &num_algos,
-                                             results.data()));
-        results.resize(num_algos);
+        auto search = [&](algo_search policy) {
+            int num_algos;
+            int max_algos = 0;
+            CUDNN_SAFE_CALL(cudnnGetConvolutionBackwardFilterAlgorithmMaxCount(
+                *m_ctx->cudnn_handle, &max_algos));
+            std::vector<cudnnConvolutionBwdFilterAlgoPerf_t> results(max_algos);
+            auto cudnn_algo_search = (policy == algo_search::EXPLICIT)
+                                         ? cudnnFindConvolutionBackwardFilterAlgorithm
+                                         : cudnnGetConvolutionBackwardFilterAlgorithm_v7;
+            CUDNN_SAFE_CALL((*cudnn_algo_search)(*m_ctx->cudnn_handle,
+                                                 tensor_desc_0,
+                                                 tensor_desc_1,
+                                                 conv_desc,
+                                                 filter_desc,
+                                                 static_cast<int>(results.size()),
+                                                 &num_algos,
+                                                 results.data()));
+            results.resize(num_algos);
+            return results;
+        };
         conv_bwd_filter_algo =
-            select_cudnn_algo<cudnnConvolutionBwdFilterAlgoPerf_t, cudnnConvolutionBwdFilterAlgo_t>(
-                results);
+            find_convolution_algo<cudnnConvolutionBwdFilterAlgoPerf_t,
+                                  cudnnConvolutionBwdFilterAlgo_t>(
+                "backward_filter",
+                convolution_descriptor(
+                    dtype,
+                    {input_tensor_shape_0, input_tensor_shape_1, output_filter_shape},
+                    window_movement_strides,
+                    window_dilation_strides,
+                    padding_below),
+                find_algo,
+                search);
     }
 
     size_t workspace_size_in_bytes = 0;
@@ -18,6 +18,7 @@
 
 #include <functional>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include <cublas_v2.h>
@@ -92,7 +93,8 @@ namespace ngraph
                                          const Strides& window_movement_strides,
                                          const Strides& window_dilation_strides,
                                          const Shape& padding_below,
-                                         const algo_search find_algo = algo_search::NONE);
+                                         const algo_search find_algo = algo_search::NONE,
+                                         bool tensor_op_math = false);
 
                 size_t build_convolution_backward_data(
                     const std::string& dtype,
@@ -192,23 +194,16 @@ namespace ngraph
                                                      cudnnConvolutionMode_t mode,
                                                      cudnnDataType_t data_type);
 
+                /// \brief Choose the first algorithm `search` returns whose workspace fits
+                ///        the budget of the memory manager. EXPLICIT searches benchmark the
+                ///        candidates, so with the CUDNNAlgorithmCache enabled their choice is
+                ///        looked up and recorded under `direction` and `descriptor`.
                 template <typename PERF_TYPE, typename ALGO_TYPE>
-                ALGO_TYPE
-                    select_cudnn_algo(const std::vector<PERF_TYPE>& perf_results,
-                                      size_t workspace_byte = std::numeric_limits<size_t>::max())
-                {
-                    for (auto i = 0; i != perf_results.size(); ++i)
-                    {
-                        auto const& result = perf_results[i];
-                        if (result.status == CUDNN_STATUS_SUCCESS &&
-                            result.memory <= workspace_byte)
-                        {
-                            return result.algo;
-                        }
-                    }
-                    throw ngraph_error(
-                        "No suitable cuDNN algorithm was found for the requested operation.");
-                }
+                ALGO_TYPE find_convolution_algo(
+                    const std::string& direction,
+                    const std::string& descriptor,
+                    const algo_search find_algo,
+                    const std::function<std::vector<PERF_TYPE>(algo_search)>& search);
 
                 CUDNNDescriptors m_descriptors;
                 CUDNNHostParameters m_host_parameters;
@@ -20,12 +20,15 @@
 #include <cudnn.h>
 
 #include "ngraph/graph_util.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/op/batch_norm.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/gpu/cuda_error_check.hpp"
 #include "ngraph/runtime/gpu/gpu_backend.hpp"
 #include "ngraph/runtime/gpu/gpu_external_function.hpp"
 #include "ngraph/runtime/gpu/gpu_internal_function.hpp"
 #include "ngraph/runtime/gpu/gpu_primitive_emitter.hpp"
+#include "ngraph/runtime/gpu/gpu_staging_pool.hpp"
 #include "ngraph/runtime/gpu/gpu_tensor.hpp"
 #include "ngraph/runtime/gpu/gpu_util.hpp"
 #include "ngraph/runtime/hybrid/hybrid_backend.hpp"
@@ -41,7 +44,14 @@ extern "C" runtime::BackendConstructor* get_backend_constructor_pointer()
     public:
         std::shared_ptr<runtime::Backend> create(const std::string& config) override
         {
-            return std::make_shared<runtime::gpu::GPU_Backend>();
+            // "GPU" is device 0, "GPU:<n>" is device n
+            int device = 0;
+            auto colon = config.find(':');
+            if (colon != std::string::npos)
+            {
+                device = std::stoi(config.substr(colon + 1));
+            }
+            return std::make_shared<runtime::gpu::GPU_Backend>(device);
         }
     };
 
@@ -50,21 +60,27 @@ extern "C" runtime::BackendConstructor* get_backend_constructor_pointer()
     return s_backend_constructor.get();
 }
 
-runtime::gpu::GPU_Backend::GPU_Backend()
+runtime::gpu::GPU_Backend::GPU_Backend(int device)
     : runtime::Backend()
+    , m_device(device)
+    , m_staging_pool(make_shared<StagingPool>())
 {
 }
 
-runtime::gpu::GPU_Backend::BackendContext::BackendContext()
+runtime::gpu::GPU_Backend::BackendContext::BackendContext(int device)
     : m_runtime_context(new GPURuntimeContext)
     , m_primitive_emitter(new GPUPrimitiveEmitter(m_runtime_context))
-    , m_cuda_manager(new CudaContextManager)
+    , m_cuda_manager(new CudaContextManager(device))
 {
     // Create context use driver API and make it current, the runtime call will pickup the context
     // http://docs.nvidia.com/cuda/cuda-c-programming-guide/index.html
     // #interoperability-between-runtime-and-driver-apis
     bind_cuda_context_to_thread();
 
+    // A stream per context lets the executables owning one run concurrently on the device.
+    // It is a blocking stream, so work left on the default stream is still ordered with it.
+    CUDA_RT_SAFE_CALL(cudaStreamCreate(&m_runtime_context->stream));
+
     m_runtime_context->cublas_handle = new cublasHandle_t;
     cublasStatus_t cublasStatus = cublasCreate(m_runtime_context->cublas_handle);
     if (cublasStatus != CUBLAS_STATUS_SUCCESS)
@@ -73,6 +89,7 @@ runtime::gpu::GPU_Backend::BackendContext::BackendContext()
     }
     // Pass scalars as reference on the Device
     cublasSetPointerMode(*m_runtime_context->cublas_handle, CUBLAS_POINTER_MODE_DEVICE);
+    cublasSetStream(*m_runtime_context->cublas_handle, m_runtime_context->stream);
 
     m_runtime_context->cudnn_handle = new cudnnHandle_t;
     cudnnStatus_t cudnnStatus = cudnnCreate(m_runtime_context->cudnn_handle);
@@ -80,6 +97,7 @@ runtime::gpu::GPU_Backend::BackendContext::BackendContext()
     {
         throw runtime_error("cuDNN create handle failed");
     }
+    cudnnSetStream(*m_runtime_context->cudnn_handle, m_runtime_context->stream);
 
     // register with c-api runtime context
     m_runtime_context->compiled_kernel_pool = new CudaFunctionPool;
@@ -106,12 +124,15 @@ runtime::gpu::GPU_Backend::BackendContext::~BackendContext()
     cudnnDestroy(*m_runtime_context->cudnn_handle);
     delete m_runtime_context->cudnn_handle;
     delete m_runtime_context->compiled_kernel_pool;
+    cudaStreamDestroy(m_runtime_context->stream);
 }
 
 shared_ptr<runtime::Tensor>
     runtime::gpu::GPU_Backend::create_tensor(const element::Type& element_type, const Shape& shape)
 {
-    return make_shared<runtime::gpu::GPUTensor>(element_type, shape);
+    // the tensor is allocated on the current device
+    CUDA_RT_SAFE_CALL(cudaSetDevice(m_device));
+    return make_shared<runtime::gpu::GPUTensor>(element_type, shape, nullptr, m_staging_pool);
 }
 
 shared_ptr<runtime::Tensor> runtime::gpu::GPU_Backend::create_tensor(
@@ -121,7 +142,15 @@ shared_ptr<runtime::Tensor> runtime::gpu::GPU_Backend::create_tensor(
     {
         throw ngraph_error("The pointer passed to create_tensor is not a device pointer.");
     }
-    return make_shared<runtime::gpu::GPUTensor>(element_type, shape, memory_pointer);
+    if (memory_pointer != nullptr && get_pointer_device(memory_pointer) != m_device)
+    {
+        throw ngraph_error("The pointer passed to create_tensor is on device " +
+                           to_string(get_pointer_device(memory_pointer)) +
+                           ", not on the device of the backend, " + to_string(m_device));
+    }
+    CUDA_RT_SAFE_CALL(cudaSetDevice(m_device));
+    return make_shared<runtime::gpu::GPUTensor>(
+        element_type, shape, memory_pointer, m_staging_pool);
 }
 
 shared_ptr<runtime::Executable> runtime::gpu::GPU_Backend::compile(shared_ptr<Function> func,
@@ -135,14 +164,17 @@ shared_ptr<runtime::Executable> runtime::gpu::GPU_Backend::compile(shared_ptr<Fu
     }
     else
     {
-        rc = make_shared<GPU_Executable>(func, timing_enable);
+        rc = make_shared<GPU_Executable>(func, timing_enable, m_device);
         m_exec_map.insert({func, rc});
     }
     return rc;
 }
 
-runtime::gpu::GPU_Executable::GPU_Executable(shared_ptr<Function> func, bool enable_timing)
-    : m_context(new GPU_Backend::BackendContext())
+runtime::gpu::GPU_Executable::GPU_Executable(shared_ptr<Function> func,
+                                             bool enable_timing,
+                                             int device)
+    : m_context(new GPU_Backend::BackendContext(device))
+    , m_device(device)
 
 {
     FunctionInstance& instance = m_function_instance;
@@ -157,6 +189,23 @@ runtime::gpu::GPU_Executable::GPU_Executable(shared_ptr<Function> func, bool ena
         instance.m_outputs.resize(func->get_output_size());
     }
     set_parameters_and_results(*func);
+    m_release_workspace = (getenv("NGRAPH_GPU_SHARED_WORKSPACE") != nullptr);
+#if CUDART_VERSION >= 10010
+    // Replay needs the workspace and the device addresses baked into the graph to stay put,
+    // and the per-op stopwatches to be read on the host
+    m_use_cuda_graph = (getenv("NGRAPH_GPU_CUDA_GRAPH") != nullptr) && !m_release_workspace &&
+                       !enable_timing;
+#endif
+}
+
+runtime::gpu::GPU_Executable::~GPU_Executable()
+{
+#if CUDART_VERSION >= 10010
+    if (m_function_instance.m_graph_exec != nullptr)
+    {
+        cudaGraphExecDestroy(m_function_instance.m_graph_exec);
+    }
+#endif
 }
 
 void runtime::gpu::GPU_Executable::initialize_io(void** target,
@@ -168,6 +217,13 @@ void runtime::gpu::GPU_Executable::initialize_io(void** target,
             dynamic_pointer_cast<runtime::gpu::GPUTensor>(source[i]);
         if (tv)
         {
+            // Kernels only address the memory of their own device
+            if (tv->m_allocated_buffer_pool != nullptr && tv->get_device() != m_device)
+            {
+                throw invalid_argument("Tensor on device " + to_string(tv->get_device()) +
+                                       " passed to an executable for device " +
+                                       to_string(m_device));
+            }
             target[i] = tv->m_allocated_buffer_pool;
         }
         else
@@ -194,11 +250,115 @@ bool runtime::gpu::GPU_Executable::call(const vector<shared_ptr<runtime::Tensor>
     initialize_io(instance.m_outputs.data(), outputs);
 
     auto ctx = m_context->m_runtime_context.get();
-    instance.m_runtime(instance.m_inputs.data(), instance.m_outputs.data(), ctx);
+    // The first call runs the primitives directly, so that the workspace is allocated and
+    // constants are uploaded before any capture
+    if (m_use_cuda_graph && instance.m_call_count > 0 &&
+        (instance.m_graph_exec == nullptr || instance.m_inputs != instance.m_graph_inputs ||
+         instance.m_outputs != instance.m_graph_outputs))
+    {
+        m_use_cuda_graph = capture_graph(ctx);
+    }
+    instance.m_call_count++;
+
+#if CUDART_VERSION >= 10010
+    if (m_use_cuda_graph && instance.m_graph_exec != nullptr)
+    {
+        CUDA_RT_SAFE_CALL(cudaGraphLaunch(instance.m_graph_exec, ctx->stream));
+    }
+    else
+#endif
+    {
+        instance.m_runtime(instance.m_inputs.data(), instance.m_outputs.data(), ctx);
+    }
+    CUDA_RT_SAFE_CALL(cudaStreamSynchronize(ctx->stream));
+
+    if (m_release_workspace)
+    {
+        m_context->m_primitive_emitter->release_primitive_memory();
+    }
 
     return true;
 }
 
+bool runtime::gpu::GPU_Executable::capture_graph(GPURuntimeContext* ctx)
+{
+#if CUDART_VERSION >= 10010
+    FunctionInstance& instance = m_function_instance;
+    // Nothing runs while the stream is captured. Primitives that synchronize, use the default
+    // stream or allocate memory end the capture with an error; the call then runs directly
+    // and later calls are not captured again.
+    CUDA_RT_SAFE_CALL(cudaStreamBeginCapture(ctx->stream, cudaStreamCaptureModeThreadLocal));
+    bool captured = true;
+    try
+    {
+        instance.m_runtime(instance.m_inputs.data(), instance.m_outputs.data(), ctx);
+    }
+    catch (const exception&)
+    {
+        captured = false;
+    }
+    cudaGraph_t graph = nullptr;
+    captured = (cudaStreamEndCapture(ctx->stream, &graph) == cudaSuccess) && captured;
+    if (captured && instance.m_graph_exec != nullptr)
+    {
+#if CUDART_VERSION >= 11010
+        // Only the device pointers of the kernel and copy nodes differ from the last capture,
+        // so try patching the instantiated graph before instantiating a new one
+        cudaGraphNode_t error_node;
+        cudaGraphExecUpdateResult update_result;
+        if (cudaGraphExecUpdate(instance.m_graph_exec, graph, &error_node, &update_result) !=
+            cudaSuccess)
+#endif
+        {
+            cudaGraphExecDestroy(instance.m_graph_exec);
+            instance.m_graph_exec = nullptr;
+        }
+    }
+    if (captured && instance.m_graph_exec == nullptr)
+    {
+        captured = (cudaGraphInstantiate(&instance.m_graph_exec, graph, nullptr, nullptr, 0) ==
+                    cudaSuccess);
+    }
+    if (graph != nullptr)
+    {
+        cudaGraphDestroy(graph);
+    }
+    // Clear the error left by a failed capture
+    cudaGetLastError();
+
+    if (!captured)
+    {
+        if (instance.m_graph_exec != nullptr)
+        {
+            cudaGraphExecDestroy(instance.m_graph_exec);
+            instance.m_graph_exec = nullptr;
+        }
+        NGRAPH_DEBUG << "GPU function can not be captured in a CUDA graph";
+        return false;
+    }
+    instance.m_graph_inputs = instance.m_inputs;
+    instance.m_graph_outputs = instance.m_outputs;
+    return true;
+#else
+    return false;
+#endif
+}
+
+cudaStream_t runtime::gpu::GPU_Executable::get_stream() const
+{
+    return m_context->m_runtime_context->stream;
+}
+
+runtime::gpu::GPUMemoryUsage runtime::gpu::GPU_Executable::get_memory_usage() const
+{
+    return m_context->m_primitive_emitter->get_memory_usage();
+}
+
+runtime::gpu::GPUMemoryUsage runtime::gpu::GPU_Backend::get_process_memory_usage()
+{
+    return GPUMemoryManager::get_process_memory_usage();
+}
+
 // void runtime::gpu::GPU_Backend::remove_compiled_function(shared_ptr<Function> func)
 // {
 //     m_function_map.erase(func);
@@ -230,8 +390,15 @@ bool runtime::gpu::GPU_Backend::is_supported(const Node& op) const
                                    "SelectAndScatter",
                                    "StopGradient",
                                    "EmbeddingLookup",
+                                   "EmbeddingLookupBackprop",
+                                   "Send",
+                                   "Recv",
                                    "GenerateMask",
+                                   "Dropout",
+                                   "DropoutBackprop",
                                    "DynBroadcast",
+                                   "If",
+                                   "Loop",
                                    "Transpose"};
 
     set<string> float_only = {"MaxPoolBackprop", "AvgPoolBackprop", "MaxPool", "Dot"};
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cuda_runtime.h>
 #include <map>
 #include <memory>
 
@@ -33,6 +34,8 @@ namespace ngraph
             class GPUPrimitiveEmitter;
             struct GPURuntimeContext;
             class CudaContextManager;
+            class StagingPool;
+            struct GPUMemoryUsage;
 
             using EntryPoint_t = void(void** inputs, void** outputs, GPURuntimeContext* ctx);
             using EntryPoint = std::function<EntryPoint_t>;
@@ -40,8 +43,16 @@ namespace ngraph
             class GPU_Backend : public Backend
             {
             public:
-                GPU_Backend();
-
+                /// \param device Ordinal of the CUDA device the tensors and executables of this
+                ///        backend live on, selected with the "GPU:<device>" config
+                GPU_Backend(int device = 0);
+
+                /// \brief Wrap device memory owned by the caller in a tensor, without a copy.
+                ///
+                /// \p memory_pointer must point to at least the size of the tensor of device
+                /// or managed memory on the device of this backend, and stay valid while the
+                /// tensor is used. The tensor never frees it. Like any GPU tensor it can be
+                /// passed as an input or output of the executables of this backend.
                 std::shared_ptr<ngraph::runtime::Tensor>
                     create_tensor(const ngraph::element::Type& element_type,
                                   const Shape& shape,
@@ -56,10 +67,14 @@ namespace ngraph
 
                 bool is_supported(const Node& node) const override;
 
+                /// \brief Device memory held by every GPU executable of the process, for
+                ///        placing more functions on a device.
+                static GPUMemoryUsage get_process_memory_usage();
+
                 class BackendContext
                 {
                 public:
-                    BackendContext();
+                    BackendContext(int device = 0);
                     ~BackendContext();
                     void prepare_runtime_context();
                     void bind_cuda_context_to_thread();
@@ -71,18 +86,33 @@ namespace ngraph
                     std::unique_ptr<CudaContextManager> m_cuda_manager;
                 };
 
+                int get_device() const { return m_device; }
             private:
+                int m_device;
                 std::map<std::shared_ptr<Function>, std::shared_ptr<Executable>> m_exec_map;
+                // Pinned buffers shared by the transfers of every tensor of this backend
+                std::shared_ptr<StagingPool> m_staging_pool;
             };
 
             class GPU_Executable : public Executable
             {
             public:
-                GPU_Executable(std::shared_ptr<Function> func, bool enable_timing);
+                GPU_Executable(std::shared_ptr<Function> func, bool enable_timing, int device = 0);
+                ~GPU_Executable() override;
 
                 bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
                           const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
 
+                /// \brief The stream this executable runs on. Transfers queued on it with
+                /// GPUTensor::write_async and read_async are ordered with its calls, and
+                /// overlap with the calls of other executables. call() returns once the work
+                /// it queued on the stream has completed.
+                cudaStream_t get_stream() const;
+
+                /// \brief Device memory held by this executable. Compilation fails when it
+                /// exceeds NGRAPH_GPU_MEMORY_BUDGET.
+                GPUMemoryUsage get_memory_usage() const;
+
                 // void remove_compiled_function(std::shared_ptr<Function> func) override;
                 std::vector<PerformanceCounter> get_performance_data() const override;
 
@@ -95,18 +125,34 @@ namespace ngraph
                     EntryPoint m_runtime;
                     std::vector<void*> m_inputs;
                     std::vector<void*> m_outputs;
+                    size_t m_call_count = 0;
+                    // Calls replayed from a CUDA graph, captured with these inputs and outputs
+                    cudaGraphExec_t m_graph_exec = nullptr;
+                    std::vector<void*> m_graph_inputs;
+                    std::vector<void*> m_graph_outputs;
                 } m_function_instance;
 
+                /// \brief Capture the primitives of one call with the current inputs and
+                /// outputs into the CUDA graph of the function instance.
+                /// \returns false if a primitive can not be captured
+                bool capture_graph(GPURuntimeContext* ctx);
+
                 /// \brief Convert a vector of Tensor into a vector of void* where each void*
                 /// points to a Tensor's data buffer.
                 /// \param target Pointer to a pre-allocated array of void* with
                 /// size >= source.size()
-                /// \param source Source vector of Tensors
-                static void
-                    initialize_io(void** target,
-                                  const std::vector<std::shared_ptr<runtime::Tensor>>& source);
+                /// \param source Source vector of Tensors, which must be GPU tensors on the
+                /// device of this executable
+                void initialize_io(void** target,
+                                   const std::vector<std::shared_ptr<runtime::Tensor>>& source);
 
                 std::shared_ptr<GPU_Backend::BackendContext> m_context;
+                int m_device;
+                // Give the workspace back to the shared device allocator after each call so
+                // that executables which do not run concurrently share device memory
+                bool m_release_workspace = false;
+                // Replay calls from a CUDA graph, see NGRAPH_GPU_CUDA_GRAPH
+                bool m_use_cuda_graph = false;
             };
         }
     }
@@ -0,0 +1,140 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cuda_runtime.h>
+
+#include "ngraph/runtime/gpu/cuda_error_check.hpp"
+#include "ngraph/runtime/gpu/gpu_caching_allocator.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+double runtime::gpu::GPUCachingAllocator::Statistics::get_fragmentation() const
+{
+    size_t held = in_use_bytes + cached_bytes;
+    return held == 0 ? 0.0 : static_cast<double>(held - requested_bytes) / held;
+}
+
+runtime::gpu::GPUCachingAllocator& runtime::gpu::GPUCachingAllocator::get()
+{
+    // Never destroyed: device memory is reclaimed with the CUDA context, and compiled
+    // functions may free into the allocator during static destruction
+    static GPUCachingAllocator* s_allocator = new GPUCachingAllocator();
+    return *s_allocator;
+}
+
+size_t runtime::gpu::GPUCachingAllocator::get_bin_size(size_t size)
+{
+    const size_t min_bin_size = 512;
+    if (size <= min_bin_size)
+    {
+        return min_bin_size;
+    }
+    // size is in (2^bits, 2^(bits + 1)], which is split in four bins
+    size_t bits = 9;
+    while ((size_t(1) << (bits + 1)) < size)
+    {
+        bits++;
+    }
+    size_t step = size_t(1) << (bits - 2);
+    return (size + step - 1) / step * step;
+}
+
+void* runtime::gpu::GPUCachingAllocator::allocate(size_t size)
+{
+    size_t bin_size = get_bin_size(size);
+    int device = 0;
+    CUDA_RT_SAFE_CALL(cudaGetDevice(&device));
+    lock_guard<mutex> lock(m_mutex);
+
+    void* ptr = nullptr;
+    auto it = m_free_blocks.find({device, bin_size});
+    if (it != m_free_blocks.end() && !it->second.empty())
+    {
+        ptr = it->second.back();
+        it->second.pop_back();
+        m_cached_bytes -= bin_size;
+    }
+    else
+    {
+        if (cudaMalloc(&ptr, bin_size) != cudaSuccess)
+        {
+            // Out of memory, or too fragmented: give the cached blocks back and retry
+            cudaGetLastError();
+            release_cached_blocks();
+            CUDA_RT_SAFE_CALL(cudaMalloc(&ptr, bin_size));
+        }
+        m_device_allocations++;
+    }
+    m_used_blocks[ptr] = {bin_size, size, device};
+    m_in_use_bytes += bin_size;
+    m_requested_bytes += size;
+    return ptr;
+}
+
+void runtime::gpu::GPUCachingAllocator::free(void* ptr)
+{
+    if (ptr == nullptr)
+    {
+        return;
+    }
+    lock_guard<mutex> lock(m_mutex);
+    auto it = m_used_blocks.find(ptr);
+    if (it == m_used_blocks.end())
+    {
+        throw runtime_error("Attempt to free device memory not owned by GPUCachingAllocator");
+    }
+    m_in_use_bytes -= it->second.size;
+    m_requested_bytes -= it->second.requested;
+    m_cached_bytes += it->second.size;
+    m_free_blocks[{it->second.device, it->second.size}].push_back(ptr);
+    m_used_blocks.erase(it);
+}
+
+void runtime::gpu::GPUCachingAllocator::empty_cache()
+{
+    lock_guard<mutex> lock(m_mutex);
+    release_cached_blocks();
+}
+
+void runtime::gpu::GPUCachingAllocator::release_cached_blocks()
+{
+    // free each block on the device it was allocated on
+    int current_device = 0;
+    CUDA_RT_SAFE_CALL_NO_THROW(cudaGetDevice(&current_device));
+    for (auto& bin : m_free_blocks)
+    {
+        if (!bin.second.empty())
+        {
+            CUDA_RT_SAFE_CALL_NO_THROW(cudaSetDevice(bin.first.first));
+        }
+        for (void* ptr : bin.second)
+        {
+            CUDA_RT_SAFE_CALL_NO_THROW(cudaFree(ptr));
+        }
+        bin.second.clear();
+    }
+    CUDA_RT_SAFE_CALL_NO_THROW(cudaSetDevice(current_device));
+    m_cached_bytes = 0;
+}
+
+runtime::gpu::GPUCachingAllocator::Statistics
+    runtime::gpu::GPUCachingAllocator::get_statistics() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return Statistics{m_in_use_bytes, m_requested_bytes, m_cached_bytes, m_device_allocations};
+}
@@ -0,0 +1,96 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gpu
+        {
+            class GPUCachingAllocator;
+        }
+    }
+}
+
+/// \brief Device memory allocator shared by every compiled function in the process.
+///
+/// Freed blocks are kept in free lists binned by size, four bins per power of two, and handed
+/// out again for requests of the same bin instead of going back to cudaFree. When cudaMalloc
+/// runs out of memory the cached blocks are released and the allocation is retried. Blocks are
+/// allocated on the current device and only reused for requests made on the same device.
+class ngraph::runtime::gpu::GPUCachingAllocator
+{
+public:
+    class Statistics
+    {
+    public:
+        /// Bytes of the blocks handed out
+        size_t in_use_bytes;
+        /// Bytes actually requested for the blocks handed out
+        size_t requested_bytes;
+        /// Bytes of the blocks kept for reuse
+        size_t cached_bytes;
+        /// Calls that had to go to cudaMalloc
+        size_t device_allocations;
+
+        /// \brief Fraction of the device memory held by the allocator that holds no requested
+        /// data, from bin rounding or from idle cached blocks.
+        double get_fragmentation() const;
+    };
+
+    static GPUCachingAllocator& get();
+
+    void* allocate(size_t size);
+    void free(void* ptr);
+    /// \brief Return every cached block to the device.
+    void empty_cache();
+
+    Statistics get_statistics() const;
+
+private:
+    GPUCachingAllocator() = default;
+    GPUCachingAllocator(const GPUCachingAllocator&) = delete;
+    GPUCachingAllocator& operator=(const GPUCachingAllocator&) = delete;
+
+    static size_t get_bin_size(size_t size);
+    void release_cached_blocks();
+
+    struct block
+    {
+        size_t size;
+        size_t requested;
+        int device;
+    };
+
+    mutable std::mutex m_mutex;
+    // keyed by device and bin size
+    std::map<std::pair<int, size_t>, std::vector<void*>> m_free_blocks;
+    std::unordered_map<void*, block> m_used_blocks;
+    size_t m_in_use_bytes = 0;
+    size_t m_requested_bytes = 0;
+    size_t m_cached_bytes = 0;
+    size_t m_device_allocations = 0;
+};
@@ -23,6 +23,7 @@
 #include <fstream>
 #include <locale>
 #include <mutex>
+#include <sstream>
 #include <string>
 #include <tuple>
 
@@ -32,10 +33,14 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/function.hpp"
 #include "ngraph/node.hpp"
+#include "ngraph/op/fused/gelu.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/batch_norm_folding.hpp"
 #include "ngraph/pass/fused_op_decomposition.hpp"
 #include "ngraph/pass/get_output_element_elimination.hpp"
 #include "ngraph/pass/like_replacement.hpp"
+#include "ngraph/pass/pass_config.hpp"
 
 #include "ngraph/runtime/gpu/gpu_backend.hpp"
 #include "ngraph/runtime/gpu/gpu_compiled_function.hpp"
@@ -45,6 +50,7 @@
 #include "ngraph/runtime/gpu/op/rnn.hpp"
 #include "ngraph/runtime/gpu/pass/gpu_batch_norm_cache.hpp"
 #include "ngraph/runtime/gpu/pass/gpu_layout.hpp"
+#include "ngraph/runtime/gpu/pass/gpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/gpu/pass/gpu_rnn_fusion.hpp"
 #include "ngraph/runtime/gpu/pass/tensor_memory_reservation.hpp"
 
@@ -169,14 +175,30 @@ void runtime::gpu::GPUCompiledFunction::compile()
 #else
     pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
 #endif
+    pass_manager.register_pass<ngraph::pass::BatchNormFolding>();
     pass_manager.register_pass<runtime::gpu::pass::BatchNormCache>();
     pass_manager.register_pass<ngraph::pass::LikeReplacement>();
-    pass_manager.register_pass<ngraph::pass::FusedOpDecomposition>();
+    // LayerNorm and Gelu have CUDA kernels for f32, the other fused ops are decomposed
+    pass_manager.register_pass<ngraph::pass::FusedOpDecomposition>([](const Node& node) {
+        return (typeid(node) == typeid(ngraph::op::LayerNorm) ||
+                typeid(node) == typeid(ngraph::op::Gelu)) &&
+               node.get_output_element_type(0) == element::f32;
+    });
+    if (ngraph::pass::PassConfig().get_pass_enable("GPULoopKernelFusion"))
+    {
+        pass_manager.register_pass<runtime::gpu::pass::GPULoopKernelFusion>();
+    }
     pass_manager.register_pass<runtime::gpu::pass::GPULayout>(this);
     pass_manager.register_pass<ngraph::pass::AssignLayout<descriptor::layout::DenseTensorLayout>>();
     pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
     pass_manager.register_pass<ngraph::pass::Liveness>();
-    pass_manager.register_pass<ngraph::pass::MemoryLayout>(get_memory_alignment());
+    // NGRAPH_PASS_ATTRIBUTES="OptimalMemoryPlanning" selects the offline planner
+    bool optimal_planning = ngraph::pass::PassConfig().get_pass_attribute("OptimalMemoryPlanning");
+    pass_manager.register_pass<ngraph::pass::MemoryLayout>(
+        get_memory_alignment(),
+        false,
+        optimal_planning ? ngraph::pass::MemoryManager::allocation_scheme::OPTIMAL
+                         : ngraph::pass::MemoryManager::allocation_scheme::FIRST_FIT);
     pass_manager.register_pass<runtime::gpu::pass::TensorMemoryReservation>(
         *allocator, m_tensor_memory_buffers);
     string dump_filename = file_util::path_join(get_output_dir(), m_function_name + "_ops.txt");
@@ -193,6 +215,20 @@ void runtime::gpu::GPUCompiledFunction::compile()
 
     // allocate device buffers for primitive arguments and workspace
     allocator->close();
+    if (size_t budget = GPUMemoryManager::get_memory_budget())
+    {
+        GPUMemoryUsage usage = m_shared_context->m_primitive_emitter->get_memory_usage();
+        if (usage.total() > budget)
+        {
+            std::stringstream ss;
+            ss << "Function " << m_function_name << " needs " << usage.total()
+               << " bytes of device memory (argspace " << usage.argspace << ", workspace "
+               << usage.workspace << ", constants " << usage.constants << ", tensors "
+               << usage.tensors << "), over the NGRAPH_GPU_MEMORY_BUDGET of " << budget
+               << " bytes";
+            throw ngraph_error(ss.str());
+        }
+    }
     m_shared_context->m_primitive_emitter->allocate_primitive_memory();
 
     compile_function();
@@ -29,7 +29,8 @@ namespace ngraph
             class CudaContextManager
             {
             public:
-                CudaContextManager();
+                /// \brief Retain the primary context of the CUDA device with ordinal `device`
+                explicit CudaContextManager(int device = 0);
                 ~CudaContextManager();
 
                 CudaContextManager(CudaContextManager const&) = delete;
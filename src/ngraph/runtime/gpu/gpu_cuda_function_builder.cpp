@@ -21,14 +21,14 @@
 #include "ngraph/runtime/gpu/cuda_error_check.hpp"
 #include "ngraph/runtime/gpu/gpu_cuda_context_manager.hpp"
 #include "ngraph/runtime/gpu/gpu_cuda_function_builder.hpp"
+#include "ngraph/runtime/gpu/gpu_kernel_cache.hpp"
 #include "ngraph/runtime/gpu/gpu_util.hpp"
 
 using namespace ngraph;
 
-std::shared_ptr<CUfunction> runtime::gpu::CudaFunctionBuilder::get(const std::string& name,
-                                                                   const std::string& kernel,
-                                                                   int number_of_options,
-                                                                   const char** options)
+static std::string compile_ptx(const std::string& kernel,
+                               int number_of_options,
+                               const char** options)
 {
     nvrtcProgram prog;
     NVRTC_SAFE_CALL(nvrtcCreateProgram(&prog,
@@ -65,19 +65,40 @@ std::shared_ptr<CUfunction> runtime::gpu::CudaFunctionBuilder::get(const std::st
     // output any compiler warnings
     emit_log();
 
-    // retrieve the intermediate PTX
+    // retrieve the intermediate PTX, including its terminating null
     size_t ptx_size;
     NVRTC_SAFE_CALL(nvrtcGetPTXSize(prog, &ptx_size));
-    char* ptx = new char[ptx_size];
-    NVRTC_SAFE_CALL(
-        nvrtcGetPTX(prog,
-                    ptx)); // Load the generated PTX and get a handle to the parent kernel.
+    std::string ptx(ptx_size, '\0');
+    NVRTC_SAFE_CALL(nvrtcGetPTX(prog, &ptx[0]));
     NVRTC_SAFE_CALL(nvrtcDestroyProgram(&prog)); // Destroy the program.
+    return ptx;
+}
+
+std::shared_ptr<CUfunction> runtime::gpu::CudaFunctionBuilder::get(const std::string& name,
+                                                                   const std::string& kernel,
+                                                                   int number_of_options,
+                                                                   const char** options)
+{
+    KernelCache& cache = KernelCache::get();
+    std::string key;
+    std::string ptx;
+    if (cache.is_enabled())
+    {
+        key = cache.get_key(kernel, number_of_options, options);
+    }
+    if (!cache.is_enabled() || !cache.load(key, ptx))
+    {
+        ptx = compile_ptx(kernel, number_of_options, options);
+        if (cache.is_enabled())
+        {
+            cache.store(key, ptx);
+        }
+    }
 
-    // extract the compiled function
+    // Load the generated PTX and extract the compiled function
     CUmodule module;
     CUfunction function;
-    CUDA_SAFE_CALL(cuModuleLoadDataEx(&module, ptx, 0, nullptr, nullptr));
+    CUDA_SAFE_CALL(cuModuleLoadDataEx(&module, ptx.c_str(), 0, nullptr, nullptr));
     CUDA_SAFE_CALL(cuModuleGetFunction(&function, module, name.c_str()));
     return std::make_shared<CUfunction>(function);
 }
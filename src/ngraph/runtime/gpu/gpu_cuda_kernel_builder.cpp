@@ -80,6 +80,35 @@ void runtime::gpu::CudaKernelBuilder::get_memset_op(CodeWriter& writer,
     return;
 }
 
+void runtime::gpu::CudaKernelBuilder::get_half_conversion_op(CodeWriter& writer,
+                                                             const std::string& name,
+                                                             runtime::gpu::GPUKernelArgs& args,
+                                                             bool to_half)
+{
+    // f16 values are stored as uint16_t and converted with PTX cvt, which every target
+    // supports, so the kernel doesn't depend on cuda_fp16.h being visible to NVRTC
+    writer << "extern \"C\" __global__ void cuda_" << name << args.get_input_signature();
+    writer.block_begin();
+    {
+        writer << "uint32_t tid = blockIdx.x * blockDim.x + threadIdx.x; \n";
+        writer << "uint32_t step = gridDim.x * blockDim.x; \n";
+        writer << "for (; tid < nthreads; tid += step)\n";
+        writer.block_begin();
+        if (to_half)
+        {
+            writer << "asm(\"cvt.rn.f16.f32 %0, %1;\" : \"=h\"(out[tid]) : \"f\"(in[tid]));\n";
+        }
+        else
+        {
+            writer << "asm(\"cvt.f32.f16 %0, %1;\" : \"=f\"(out[tid]) : \"h\"(in[tid]));\n";
+        }
+        writer.block_end();
+    }
+    writer.block_end();
+
+    return;
+}
+
 void runtime::gpu::CudaKernelBuilder::get_cudnn_bn_inv_var_op(CodeWriter& writer,
                                                               const std::string& name,
                                                               runtime::gpu::GPUKernelArgs& args)
@@ -179,6 +208,140 @@ void runtime::gpu::CudaKernelBuilder::get_ew_collective_op(
     return;
 }
 
+void runtime::gpu::CudaKernelBuilder::get_loop_kernel_op(
+    CodeWriter& writer,
+    const std::string& name,
+    GPUKernelArgs& args,
+    const std::string& data_type,
+    size_t num_inputs,
+    const std::vector<std::string>& expressions,
+    const std::vector<std::string>& output_registers,
+    const std::vector<std::string>& reduce_ops)
+{
+    bool has_reduction = false;
+    for (auto& reduce_op : reduce_ops)
+    {
+        has_reduction |= !reduce_op.empty();
+    }
+
+    // loads the inputs of element idx and computes every node of the loop kernel into
+    // registers t0, t1, ...; elementwise outputs are stored as soon as they are computed
+    auto compute_element = [&]() {
+        for (size_t i = 0; i < num_inputs; i++)
+        {
+            writer << data_type << " i" << i << " = in" << i << "[idx];\n";
+        }
+        for (size_t i = 0; i < expressions.size(); i++)
+        {
+            writer << data_type << " t" << i << " = " << expressions[i] << ";\n";
+        }
+        for (size_t i = 0; i < output_registers.size(); i++)
+        {
+            if (reduce_ops[i].empty())
+            {
+                writer << "out" << i << "[idx] = " << output_registers[i] << ";\n";
+            }
+        }
+    };
+
+    writer << "extern \"C\" __global__ void cuda_" << name << args.get_input_signature();
+    writer.block_begin();
+    if (!has_reduction)
+    {
+        writer << "uint32_t idx = blockIdx.x * blockDim.x + threadIdx.x;\n";
+        writer << "uint32_t step = gridDim.x * blockDim.x;\n";
+        writer << "for (; idx < n; idx += step)\n";
+        writer.block_begin();
+        compute_element();
+        writer.block_end();
+    }
+    else
+    {
+        // one block per reduced row: every thread folds a strided slice of the row into
+        // registers, then the block combines them through shared memory
+        writer << "extern __shared__ " << data_type << " sdata[];\n";
+        writer << "uint32_t tid = threadIdx.x;\n";
+        writer << "uint32_t active = reduction_size < blockDim.x ? reduction_size : blockDim.x;\n";
+        writer << "for (uint32_t row = blockIdx.x; row < rows; row += gridDim.x)\n";
+        writer.block_begin();
+        {
+            for (size_t i = 0; i < output_registers.size(); i++)
+            {
+                if (!reduce_ops[i].empty())
+                {
+                    writer << data_type << " r" << i << " = 0;\n";
+                }
+            }
+            writer << "for (uint32_t col = tid; col < reduction_size; col += blockDim.x)\n";
+            writer.block_begin();
+            {
+                writer << "uint32_t idx = row * reduction_size + col;\n";
+                compute_element();
+                for (size_t i = 0; i < output_registers.size(); i++)
+                {
+                    if (!reduce_ops[i].empty())
+                    {
+                        writer << "r" << i << " = (col == tid) ? " << output_registers[i] << " : "
+                               << reduce_ops[i] << "(r" << i << ", " << output_registers[i]
+                               << ");\n";
+                    }
+                }
+            }
+            writer.block_end();
+
+            size_t slot = 0;
+            for (size_t i = 0; i < output_registers.size(); i++)
+            {
+                if (!reduce_ops[i].empty())
+                {
+                    writer << "sdata[" << slot++ << " * blockDim.x + tid] = r" << i << ";\n";
+                }
+            }
+            writer << "__syncthreads();\n";
+            writer << "for (uint32_t s = blockDim.x >> 1; s > 0; s >>= 1)\n";
+            writer.block_begin();
+            {
+                writer << "if (tid < s && tid + s < active)\n";
+                writer.block_begin();
+                slot = 0;
+                for (size_t i = 0; i < output_registers.size(); i++)
+                {
+                    if (!reduce_ops[i].empty())
+                    {
+                        std::string lhs = "sdata[" + std::to_string(slot) + " * blockDim.x + tid]";
+                        std::string rhs =
+                            "sdata[" + std::to_string(slot) + " * blockDim.x + tid + s]";
+                        writer << lhs << " = " << reduce_ops[i] << "(" << lhs << ", " << rhs
+                               << ");\n";
+                        slot++;
+                    }
+                }
+                writer.block_end();
+                writer << "__syncthreads();\n";
+            }
+            writer.block_end();
+
+            writer << "if (tid == 0)\n";
+            writer.block_begin();
+            slot = 0;
+            for (size_t i = 0; i < output_registers.size(); i++)
+            {
+                if (!reduce_ops[i].empty())
+                {
+                    writer << "out" << i << "[row] = sdata[" << slot++ << " * blockDim.x];\n";
+                }
+            }
+            writer.block_end();
+            // sdata is reused by the next row
+            writer << "__syncthreads();\n";
+        }
+        writer.block_end();
+    }
+    writer.block_end();
+
+    return;
+}
+
 void runtime::gpu::CudaKernelBuilder::get_topk(CodeWriter& writer,
                                                const std::string& name,
                                                const std::vector<std::string>& dtypes,
@@ -771,6 +934,96 @@ void runtime::gpu::CudaKernelBuilder::get_softmax_block_reduce_op(
     return;
 }
 
+void runtime::gpu::CudaKernelBuilder::get_layer_norm_op(CodeWriter& writer,
+                                                        const std::string& name,
+                                                        runtime::gpu::GPUKernelArgs& args,
+                                                        const std::vector<std::string>& data_types,
+                                                        size_t block_size_x)
+{
+    writer << runtime::gpu::nvrtc::define_non_coherent_load(data_types[0], "load");
+
+    auto reduce_lambda = [&](uint32_t count) {
+        // accumulate count threads for each warp
+        for (int i = (WARPSIZE >> 1); i >= 1; i >>= 1)
+        {
+            if (count > i)
+            {
+                writer << "r_sum += __shfl_down_sync(0xffffffff, r_sum, " << i << ", " << WARPSIZE
+                       << ");\n";
+                writer << "r_sumsq += __shfl_down_sync(0xffffffff, r_sumsq, " << i << ", "
+                       << WARPSIZE << ");\n";
+            }
+        }
+    };
+
+    writer << "extern \"C\" __global__ void cuda_" << name << args.get_input_signature();
+    writer.block_begin();
+    {
+        // one block normalizes one row
+        writer << "extern __shared__ " << data_types[3] << " sdata[];\n";
+        writer << "uint32_t tid = threadIdx.x;\n";
+        writer << "uint32_t step = blockDim.x;\n";
+        writer << "size_t row_offset = static_cast<size_t>(blockIdx.x) * row_size;\n";
+        writer << "in += row_offset;\n";
+        writer << "out += row_offset;\n";
+
+        // the sums are taken around the first element of the row, which keeps
+        // sumsq - sum * sum from cancelling when the mean is large
+        writer << data_types[3] << " shift = load(in, 0);\n";
+        writer << data_types[3] << " r_sum = 0;\n";
+        writer << data_types[3] << " r_sumsq = 0;\n";
+        writer << "for (uint32_t i = tid; i < row_size; i += step)\n";
+        writer.block_begin();
+        {
+            writer << data_types[3] << " d = load(in, i) - shift;\n";
+            writer << "r_sum += d;\n";
+            writer << "r_sumsq += d * d;\n";
+        }
+        writer.block_end();
+        reduce_lambda(block_size_x);
+        if (block_size_x > WARPSIZE)
+        {
+            uint32_t num_of_warp = block_size_x >> 5;
+            writer << "uint32_t lane_idx = threadIdx.x & " << WARPSIZE - 1 << ";\n";
+            writer << "uint32_t warp_idx = threadIdx.x >> 5;\n";
+            writer << "if (lane_idx == 0)\n";
+            writer.block_begin();
+            {
+                writer << "sdata[warp_idx] = r_sum;\n";
+                writer << "sdata[" << num_of_warp << " + warp_idx] = r_sumsq;\n";
+            }
+            writer.block_end();
+            writer << "__syncthreads();\n";
+            writer << "r_sum = tid < " << num_of_warp << " ? sdata[tid] : 0;\n";
+            writer << "r_sumsq = tid < " << num_of_warp << " ? sdata[" << num_of_warp
+                   << " + tid] : 0;\n";
+            // every warp has read its partial sums before thread 0 overwrites them
+            writer << "__syncthreads();\n";
+            reduce_lambda(num_of_warp);
+        }
+        // save and broadcast the row statistics
+        writer << "if (tid == 0)\n";
+        writer.block_begin();
+        {
+            writer << data_types[3] << " mean = r_sum / row_size;\n";
+            writer << data_types[3] << " variance = r_sumsq / row_size - mean * mean;\n";
+            writer << "sdata[0] = shift + mean;\n";
+            writer << "sdata[1] = rsqrt((variance > 0 ? variance : 0) + epsilon);\n";
+        }
+        writer.block_end();
+        writer << "__syncthreads();\n";
+        writer << data_types[3] << " mean = sdata[0];\n";
+        writer << data_types[3] << " inv_std = sdata[1];\n";
+        writer << "for (uint32_t i = tid; i < row_size; i += step)\n";
+        writer.block_begin();
+        {
+            writer << "out[i] = (load(in, i) - mean) * inv_std * load(gamma, i) + load(beta, i);\n";
+        }
+        writer.block_end();
+    }
+    writer.block_end();
+}
+
 //each thread calculate the whole reduction of one output
 void runtime::gpu::CudaKernelBuilder::get_reduce_to_nd_op(
     CodeWriter& writer,
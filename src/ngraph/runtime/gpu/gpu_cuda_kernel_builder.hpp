@@ -45,6 +45,12 @@ namespace ngraph
                                           const std::string& data_type,
                                           runtime::gpu::GPUKernelArgs& args);
 
+                /// \brief Converts between f32 and f16 values stored as uint16_t
+                static void get_half_conversion_op(CodeWriter& writer,
+                                                   const std::string& name,
+                                                   runtime::gpu::GPUKernelArgs& args,
+                                                   bool to_half);
+
                 static void get_cudnn_bn_inv_var_op(CodeWriter& writer,
                                                     const std::string& name,
                                                     runtime::gpu::GPUKernelArgs& args);
@@ -171,6 +177,20 @@ namespace ngraph
                                                  bool save_elementwise,
                                                  size_t rank);
 
+                /// \brief Emits a kernel that loads in<i>[idx] into register i<i>, evaluates
+                ///        `expressions` into registers t0, t1, ... and stores
+                ///        `output_registers[o]` to out<o>. Outputs with a non-empty entry in
+                ///        `reduce_ops` are folded with that device function over rows of
+                ///        `reduction_size` elements, one block per row, instead of stored.
+                static void get_loop_kernel_op(CodeWriter& writer,
+                                               const std::string& name,
+                                               GPUKernelArgs& args,
+                                               const std::string& data_type,
+                                               size_t num_inputs,
+                                               const std::vector<std::string>& expressions,
+                                               const std::vector<std::string>& output_registers,
+                                               const std::vector<std::string>& reduce_ops);
+
                 static void get_max_pool_1d(CodeWriter& writer,
                                             const std::string& name,
                                             const std::array<std::string, 2>& data_types,
@@ -210,6 +230,12 @@ namespace ngraph
                                                         size_t reduce_rank,
                                                         size_t block_size_x);
 
+                static void get_layer_norm_op(CodeWriter& writer,
+                                              const std::string& name,
+                                              runtime::gpu::GPUKernelArgs& args,
+                                              const std::vector<std::string>& data_types,
+                                              size_t block_size_x);
+
                 static void add_pod_typedefs(CodeWriter& writer);
 
                 static void coordinate_transform_to_multi_d(CodeWriter& writer,
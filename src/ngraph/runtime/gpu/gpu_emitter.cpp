@@ -34,6 +34,7 @@
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/all.hpp"
+#include "ngraph/op/allgather.hpp"
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/and.hpp"
 #include "ngraph/op/any.hpp"
@@ -60,6 +61,7 @@
 #include "ngraph/op/erf.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/op/experimental/dropout.hpp"
 #include "ngraph/op/experimental/dyn_broadcast.hpp"
 #include "ngraph/op/experimental/dyn_pad.hpp"
 #include "ngraph/op/experimental/dyn_reshape.hpp"
@@ -76,6 +78,8 @@
 #include "ngraph/op/experimental/tile.hpp"
 #include "ngraph/op/experimental/transpose.hpp"
 #include "ngraph/op/floor.hpp"
+#include "ngraph/op/fused/gelu.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/gather_nd.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -103,6 +107,7 @@
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
+#include "ngraph/op/reducescatter.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
@@ -130,6 +135,7 @@
 #include "ngraph/runtime/gpu/gpu_primitive_emitter.hpp"
 #include "ngraph/runtime/gpu/gpu_util.hpp"
 #include "ngraph/runtime/gpu/op/batch_norm.hpp"
+#include "ngraph/runtime/gpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/gpu/op/rnn.hpp"
 #include "ngraph/runtime/gpu/type_info.hpp"
 #include "ngraph/util.hpp"
@@ -177,6 +183,13 @@ std::string runtime::gpu::GPU_Emitter::emit_All(EMIT_ARGS)
     throw unsupported_op("Unsupported op '" + node->description() + "'");
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_AllGather(EMIT_ARGS)
+{
+    auto& host_emitter = compiled_function->get_primitive_emitter()->get_host_emitter();
+    size_t index = host_emitter->build_all_gather(args[0].get_element_type(), args[0].get_size());
+    return compiled_function->add_to_runtime(index, function_name, args, out);
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_AllReduce(EMIT_ARGS)
 {
     throw unsupported_op("Unsupported op '" + node->description() + "'");
@@ -607,6 +620,16 @@ std::string runtime::gpu::GPU_Emitter::emit_Dot(EMIT_ARGS)
     return compiled_function->add_to_runtime(index, function_name, args, out);
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_Dropout(EMIT_ARGS)
+{
+    throw ngraph_error("Dropout is not supported yet on NVIDIA GPU");
+}
+
+std::string runtime::gpu::GPU_Emitter::emit_DropoutBackprop(EMIT_ARGS)
+{
+    throw ngraph_error("DropoutBackprop is not supported yet on NVIDIA GPU");
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_DynReshape(EMIT_ARGS)
 {
     throw unsupported_op("Unsupported op '" + node->description() + "'");
@@ -622,6 +645,11 @@ std::string runtime::gpu::GPU_Emitter::emit_EmbeddingLookup(EMIT_ARGS)
     throw ngraph_error("EmbeddingLookup is not yet implemented for NVIDIA GPU");
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_EmbeddingLookupBackprop(EMIT_ARGS)
+{
+    throw ngraph_error("EmbeddingLookupBackprop is not yet implemented for NVIDIA GPU");
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_Equal(EMIT_ARGS)
 {
     return emit_elementwise<ngraph::op::Equal>(compiled_function, function_name, node, args, out);
@@ -652,6 +680,21 @@ std::string runtime::gpu::GPU_Emitter::emit_GatherND(EMIT_ARGS)
     throw unsupported_op("Unsupported op '" + node->description() + "'");
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_Gelu(EMIT_ARGS)
+{
+    if (out[0].get_size() == 0)
+    {
+        return "";
+    }
+
+    auto gelu = static_cast<const ngraph::op::Gelu*>(node);
+    auto& cuda_emitter = compiled_function->get_primitive_emitter()->get_cuda_emitter();
+    size_t index = cuda_emitter->build_gelu(
+        {args[0].get_type(), out[0].get_type()}, out[0].get_shape(), gelu->get_approximate());
+
+    return compiled_function->add_to_runtime(index, function_name, args, out);
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_GenerateMask(EMIT_ARGS)
 {
     throw ngraph_error("GenerateMask is not supported yet on NVIDIA GPU");
@@ -679,6 +722,34 @@ std::string runtime::gpu::GPU_Emitter::emit_GreaterEq(EMIT_ARGS)
         compiled_function, function_name, node, args, out);
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_If(EMIT_ARGS)
+{
+    throw unsupported_op("Unsupported op '" + node->description() + "'");
+}
+
+std::string runtime::gpu::GPU_Emitter::emit_LayerNorm(EMIT_ARGS)
+{
+    if (out[0].get_size() == 0)
+    {
+        return "";
+    }
+
+    auto layer_norm = static_cast<const ngraph::op::LayerNorm*>(node);
+    std::vector<element::Type> dtypes;
+    for (auto& arg : args)
+    {
+        dtypes.push_back(arg.get_element_type());
+    }
+    dtypes.push_back(out[0].get_element_type());
+    // gamma holds one row of the normalized axes
+    size_t row_size = args[1].get_size();
+    auto& cuda_emitter = compiled_function->get_primitive_emitter()->get_cuda_emitter();
+    size_t index = cuda_emitter->build_layer_norm(
+        dtypes, out[0].get_size() / row_size, row_size, layer_norm->get_epsilon());
+
+    return compiled_function->add_to_runtime(index, function_name, args, out);
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_Less(EMIT_ARGS)
 {
     return emit_elementwise<ngraph::op::Less>(compiled_function, function_name, node, args, out);
@@ -694,6 +765,24 @@ std::string runtime::gpu::GPU_Emitter::emit_Log(EMIT_ARGS)
     return emit_elementwise<ngraph::op::Log>(compiled_function, function_name, node, args, out);
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_Loop(EMIT_ARGS)
+{
+    throw unsupported_op("Unsupported op '" + node->description() + "'");
+}
+
+std::string runtime::gpu::GPU_Emitter::emit_LoopKernel(EMIT_ARGS)
+{
+    if (out[0].get_size() == 0)
+    {
+        return "";
+    }
+    auto loop_kernel = static_cast<const ngraph::op::gpu::LoopKernel*>(node);
+    auto& cuda_emitter = compiled_function->get_primitive_emitter()->get_cuda_emitter();
+    auto index = cuda_emitter->build_primitive(loop_kernel);
+
+    return compiled_function->add_to_runtime(index, function_name, args, out);
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_LRN(EMIT_ARGS)
 {
     auto lrn = static_cast<const ngraph::op::LRN*>(node);
@@ -992,6 +1081,18 @@ std::string runtime::gpu::GPU_Emitter::emit_QuantizedMaxPool(EMIT_ARGS)
     throw unsupported_op("Unsupported op '" + node->description() + "'");
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_Recv(EMIT_ARGS)
+{
+    throw unsupported_op("Unsupported op '" + node->description() + "'");
+}
+
+std::string runtime::gpu::GPU_Emitter::emit_ReduceScatter(EMIT_ARGS)
+{
+    auto& host_emitter = compiled_function->get_primitive_emitter()->get_host_emitter();
+    size_t index = host_emitter->build_reduce_scatter(out[0].get_element_type(), out[0].get_size());
+    return compiled_function->add_to_runtime(index, function_name, args, out);
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_Relu(EMIT_ARGS)
 {
     return emit_elementwise<ngraph::op::Relu>(compiled_function, function_name, node, args, out);
@@ -1232,6 +1333,11 @@ std::string runtime::gpu::GPU_Emitter::emit_Select(EMIT_ARGS)
     return emit_elementwise<ngraph::op::Select>(compiled_function, function_name, node, args, out);
 }
 
+std::string runtime::gpu::GPU_Emitter::emit_Send(EMIT_ARGS)
+{
+    throw unsupported_op("Unsupported op '" + node->description() + "'");
+}
+
 std::string runtime::gpu::GPU_Emitter::emit_ShapeOf(EMIT_ARGS)
 {
     throw unsupported_op("Unsupported op '" + node->description() + "'");
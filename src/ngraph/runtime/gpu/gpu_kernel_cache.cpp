@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <unistd.h>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/runtime/gpu/cuda_error_check.hpp"
+#include "ngraph/runtime/gpu/gpu_kernel_cache.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// FNV-1a, stable across processes and standard library versions unlike std::hash
+static uint64_t hash_bytes(const string& bytes, uint64_t hash = 14695981039346656037ULL)
+{
+    for (unsigned char c : bytes)
+    {
+        hash = (hash ^ c) * 1099511628211ULL;
+    }
+    return hash;
+}
+
+runtime::gpu::KernelCache& runtime::gpu::KernelCache::get()
+{
+    static const char* s_directory = getenv("NGRAPH_GPU_KERNEL_CACHE");
+    static KernelCache s_cache(s_directory == nullptr ? "" : s_directory);
+    return s_cache;
+}
+
+runtime::gpu::KernelCache::KernelCache(const string& directory)
+    : m_directory(directory)
+{
+    if (!m_directory.empty())
+    {
+        file_util::make_directory(m_directory);
+        int major = 0;
+        int minor = 0;
+        NVRTC_SAFE_CALL(nvrtcVersion(&major, &minor));
+        m_nvrtc_version = to_string(major) + "." + to_string(minor);
+    }
+}
+
+string runtime::gpu::KernelCache::get_key(const string& kernel,
+                                          int number_of_options,
+                                          const char** options)
+{
+    // The kernels are compiled for the device of the current context
+    CUdevice device;
+    int major = 0;
+    int minor = 0;
+    CUDA_SAFE_CALL(cuCtxGetDevice(&device));
+    CUDA_SAFE_CALL(
+        cuDeviceGetAttribute(&major, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR, device));
+    CUDA_SAFE_CALL(
+        cuDeviceGetAttribute(&minor, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR, device));
+
+    uint64_t hash = hash_bytes(kernel);
+    for (int i = 0; i < number_of_options; i++)
+    {
+        hash = hash_bytes(string(1, '\0') + options[i], hash);
+    }
+    stringstream key;
+    key << "sm" << major << minor << "_nvrtc" << m_nvrtc_version << "_" << hex << setw(16)
+        << setfill('0') << hash;
+    return key.str();
+}
+
+string runtime::gpu::KernelCache::get_path(const string& key) const
+{
+    return file_util::path_join(m_directory, key + ".ptx");
+}
+
+bool runtime::gpu::KernelCache::load(const string& key, string& ptx) const
+{
+    ifstream in(get_path(key), ios::binary);
+    if (!in)
+    {
+        return false;
+    }
+    stringstream contents;
+    contents << in.rdbuf();
+    ptx = contents.str();
+    return !ptx.empty();
+}
+
+void runtime::gpu::KernelCache::store(const string& key, const string& ptx) const
+{
+    // Write to a file of this process first so that concurrent processes never load a
+    // partially written entry
+    string path = get_path(key);
+    string temporary = path + "." + to_string(getpid());
+    {
+        ofstream out(temporary, ios::binary);
+        out << ptx;
+        if (!out)
+        {
+            NGRAPH_DEBUG << "Unable to write GPU kernel cache entry " << temporary;
+            remove(temporary.c_str());
+            return;
+        }
+    }
+    if (rename(temporary.c_str(), path.c_str()) != 0)
+    {
+        remove(temporary.c_str());
+    }
+}
@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <string>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gpu
+        {
+            /// \brief On-disk cache of the PTX NVRTC generates for CUDAEmitter kernels, so
+            ///        that a new process loads kernels instead of compiling them again.
+            ///
+            /// Enabled by setting NGRAPH_GPU_KERNEL_CACHE to the cache directory. Entries are
+            /// keyed by a hash of the kernel source and compile options, the compute
+            /// capability of the current device and the NVRTC version.
+            class KernelCache
+            {
+            public:
+                /// The cache configured by NGRAPH_GPU_KERNEL_CACHE
+                static KernelCache& get();
+                /// A cache in `directory`, disabled if it is empty
+                explicit KernelCache(const std::string& directory);
+
+                bool is_enabled() const { return !m_directory.empty(); }
+                std::string get_key(const std::string& kernel,
+                                    int number_of_options,
+                                    const char** options);
+                /// \returns false if there is no entry for `key`
+                bool load(const std::string& key, std::string& ptx) const;
+                void store(const std::string& key, const std::string& ptx) const;
+
+                KernelCache(const KernelCache&) = delete;
+                KernelCache& operator=(const KernelCache&) = delete;
+
+            private:
+                std::string get_path(const std::string& key) const;
+
+                std::string m_directory;
+                std::string m_nvrtc_version;
+            };
+        }
+    }
+}
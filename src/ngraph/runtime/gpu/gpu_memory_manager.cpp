@@ -14,8 +14,12 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cstdlib>
 #include <cstring>
 
+#include "ngraph/runtime/gpu/cuda_error_check.hpp"
+#include "ngraph/runtime/gpu/gpu_caching_allocator.hpp"
 #include "ngraph/runtime/gpu/gpu_memory_manager.hpp"
 #include "ngraph/runtime/gpu/gpu_primitive_emitter.hpp"
 #include "ngraph/runtime/gpu/gpu_util.hpp"
@@ -24,14 +28,31 @@ using namespace ngraph;
 
 constexpr const uint32_t initial_buffer_size = 10 * 1024 * 1024;
 
+std::mutex runtime::gpu::GPUMemoryManager::s_managers_mutex;
+std::set<const runtime::gpu::GPUMemoryManager*> runtime::gpu::GPUMemoryManager::s_managers;
+
+runtime::gpu::GPUMemoryUsage& runtime::gpu::GPUMemoryUsage::
+    operator+=(const runtime::gpu::GPUMemoryUsage& other)
+{
+    argspace += other.argspace;
+    workspace += other.workspace;
+    constants += other.constants;
+    tensors += other.tensors;
+    return *this;
+}
+
 runtime::gpu::GPUMemoryManager::GPUMemoryManager(GPUPrimitiveEmitter* emitter)
     : m_buffer_offset(0)
+    , m_constant_size(0)
+    , m_tensor_pool_size(0)
     , m_buffered_mem(initial_buffer_size, 0)
     , m_workspace_manager(new pass::MemoryManager(runtime::gpu::GPUMemoryManager::alignment))
     , m_argspace_mem(1, {nullptr, 0})
     , m_workspace_mem(1, {nullptr, 0})
     , m_primitive_emitter(emitter)
 {
+    std::lock_guard<std::mutex> lock(s_managers_mutex);
+    s_managers.insert(this);
 }
 
 size_t runtime::gpu::GPUMemoryManager::get_allocation_size() const
@@ -48,15 +69,80 @@ size_t runtime::gpu::GPUMemoryManager::get_allocation_size() const
     return allocation_size;
 }
 
+size_t runtime::gpu::GPUMemoryManager::get_workspace_budget() const
+{
+    size_t free_bytes = 0;
+    size_t total_bytes = 0;
+    CUDA_RT_SAFE_CALL(cudaMemGetInfo(&free_bytes, &total_bytes));
+    size_t budget = (free_bytes > m_buffer_offset) ? free_bytes - m_buffer_offset : 0;
+    if (const char* env = std::getenv("NGRAPH_GPU_WORKSPACE_LIMIT"))
+    {
+        budget = std::min(budget, static_cast<size_t>(std::strtoull(env, nullptr, 10)));
+    }
+    if (size_t memory_budget = get_memory_budget())
+    {
+        // the workspace already reserved is counted whole, although a new reservation may
+        // reuse the part of it that is free
+        size_t reserved = get_memory_usage().total();
+        budget = std::min(budget, (memory_budget > reserved) ? memory_budget - reserved : 0);
+    }
+    return budget;
+}
+
+runtime::gpu::GPUMemoryUsage runtime::gpu::GPUMemoryManager::get_memory_usage() const
+{
+    size_t argspace_size = ngraph::pass::MemoryManager::align(
+        m_buffer_offset, runtime::gpu::GPUMemoryManager::alignment);
+    for (auto const& alloc : m_argspace_mem)
+    {
+        argspace_size += alloc.size;
+    }
+    size_t workspace_size = m_workspace_manager->max_allocated();
+    for (auto const& alloc : m_workspace_mem)
+    {
+        workspace_size += alloc.size;
+    }
+
+    GPUMemoryUsage usage;
+    usage.constants = m_constant_size;
+    usage.tensors = m_tensor_pool_size;
+    usage.argspace = (argspace_size > m_constant_size) ? argspace_size - m_constant_size : 0;
+    usage.workspace =
+        (workspace_size > m_tensor_pool_size) ? workspace_size - m_tensor_pool_size : 0;
+    return usage;
+}
+
+runtime::gpu::GPUMemoryUsage runtime::gpu::GPUMemoryManager::get_process_memory_usage()
+{
+    std::lock_guard<std::mutex> lock(s_managers_mutex);
+    GPUMemoryUsage usage;
+    for (auto manager : s_managers)
+    {
+        usage += manager->get_memory_usage();
+    }
+    return usage;
+}
+
+size_t runtime::gpu::GPUMemoryManager::get_memory_budget()
+{
+    const char* env = std::getenv("NGRAPH_GPU_MEMORY_BUDGET");
+    return env ? static_cast<size_t>(std::strtoull(env, nullptr, 10)) : 0;
+}
+
 runtime::gpu::GPUMemoryManager::~GPUMemoryManager()
 {
+    {
+        std::lock_guard<std::mutex> lock(s_managers_mutex);
+        s_managers.erase(this);
+    }
+    auto& allocator = GPUCachingAllocator::get();
     for (auto& alloc : m_argspace_mem)
     {
-        runtime::gpu::free_gpu_buffer(alloc.ptr);
+        allocator.free(alloc.ptr);
     }
     for (auto& alloc : m_workspace_mem)
     {
-        runtime::gpu::free_gpu_buffer(alloc.ptr);
+        allocator.free(alloc.ptr);
     }
 }
 
@@ -73,7 +159,7 @@ void runtime::gpu::GPUMemoryManager::allocate()
         m_buffer_offset = ngraph::pass::MemoryManager::align(
             m_buffer_offset, runtime::gpu::GPUMemoryManager::alignment);
         // the back most node is always empty, fill it here
-        m_argspace_mem.back().ptr = runtime::gpu::create_gpu_buffer(m_buffer_offset);
+        m_argspace_mem.back().ptr = GPUCachingAllocator::get().allocate(m_buffer_offset);
         m_argspace_mem.back().size = m_buffer_offset;
         // copy buffered kernel arguments to device
         runtime::gpu::cuda_memcpyHtD(
@@ -88,7 +174,8 @@ void runtime::gpu::GPUMemoryManager::allocate()
     auto workspace_size = m_workspace_manager->max_allocated();
     if (workspace_size)
     {
-        m_workspace_mem.back().ptr = runtime::gpu::create_gpu_buffer(workspace_size);
+        // the workspace itself is only acquired the first time one of its memory
+        // primitives is evaluated, see acquire_workspace
         m_workspace_mem.back().size = workspace_size;
         m_workspace_mem.push_back({nullptr, 0});
         m_workspace_manager.reset(
@@ -96,6 +183,25 @@ void runtime::gpu::GPUMemoryManager::allocate()
     }
 }
 
+void* runtime::gpu::GPUMemoryManager::acquire_workspace(std::list<allocation>::iterator workspace)
+{
+    if (workspace->ptr == nullptr && workspace->size != 0)
+    {
+        workspace->ptr = GPUCachingAllocator::get().allocate(workspace->size);
+    }
+    return workspace->ptr;
+}
+
+void runtime::gpu::GPUMemoryManager::release_workspace()
+{
+    auto& allocator = GPUCachingAllocator::get();
+    for (auto& alloc : m_workspace_mem)
+    {
+        allocator.free(alloc.ptr);
+        alloc.ptr = nullptr;
+    }
+}
+
 size_t runtime::gpu::GPUMemoryManager::queue_for_transfer(const void* data, size_t size)
 {
     // if the current allocation will overflow the host buffer
@@ -162,11 +268,12 @@ size_t runtime::gpu::GPUAllocator::reserve_workspace(size_t size, bool zero_init
 
     size_t offset = m_manager->m_workspace_manager->allocate(size);
     m_active.push(offset);
+    auto manager = m_manager;
     auto local = std::prev(m_manager->m_workspace_mem.end());
     // return a lambda that will yield the gpu memory address. this
     // should only be evaluated by the runtime invoked primitive
     gpu::memory_primitive mem_primitive = [=]() {
-        void* workspace = (*local).ptr;
+        void* workspace = manager->acquire_workspace(local);
         if (workspace == nullptr)
         {
             throw std::runtime_error("An attempt was made to use unallocated device memory.");
@@ -182,6 +289,20 @@ size_t runtime::gpu::GPUAllocator::reserve_workspace(size_t size, bool zero_init
     return m_manager->m_primitive_emitter->insert(std::move(mem_primitive));
 }
 
+size_t runtime::gpu::GPUAllocator::reserve_constant(const void* data, size_t size)
+{
+    m_manager->m_constant_size +=
+        ngraph::pass::MemoryManager::align(size, runtime::gpu::GPUMemoryManager::alignment);
+    return reserve_argspace(data, size);
+}
+
+size_t runtime::gpu::GPUAllocator::reserve_tensor_pool(size_t size)
+{
+    m_manager->m_tensor_pool_size +=
+        ngraph::pass::MemoryManager::align(size, runtime::gpu::GPUMemoryManager::alignment);
+    return reserve_workspace(size, false);
+}
+
 void runtime::gpu::GPUAllocator::close()
 {
     while (!m_active.empty())
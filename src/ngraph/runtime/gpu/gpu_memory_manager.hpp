@@ -18,6 +18,8 @@
 
 #include <list>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <stack>
 #include <vector>
 
@@ -32,6 +34,22 @@ namespace ngraph
             class GPUPrimitiveEmitter;
             class GPUMemoryManager;
 
+            /// \brief Device memory held by a compiled function, in bytes
+            struct GPUMemoryUsage
+            {
+                /// Kernel arguments copied to the device, other than constants
+                size_t argspace = 0;
+                /// Scratch memory of the primitives
+                size_t workspace = 0;
+                /// Constant tensors of the function
+                size_t constants = 0;
+                /// Pool of the intermediate tensors of the function
+                size_t tensors = 0;
+
+                size_t total() const { return argspace + workspace + constants + tensors; }
+                GPUMemoryUsage& operator+=(const GPUMemoryUsage& other);
+            };
+
             class GPUAllocator
             {
             public:
@@ -48,6 +66,10 @@ namespace ngraph
                 }
                 size_t reserve_argspace(const void* data, size_t size);
                 size_t reserve_workspace(size_t size, bool zero_initialize = true);
+                /// \brief reserve_argspace for the data of a constant tensor
+                size_t reserve_constant(const void* data, size_t size);
+                /// \brief reserve_workspace for the pool of the intermediate tensors
+                size_t reserve_tensor_pool(size_t size);
 
                 void close();
 
@@ -65,26 +87,51 @@ namespace ngraph
                 ~GPUMemoryManager();
 
                 void allocate();
+                /// \brief Return the workspace buffers to the shared device allocator. They
+                ///        are acquired again, possibly at another address, the next time a
+                ///        workspace memory primitive is evaluated.
+                void release_workspace();
                 size_t get_allocation_size() const;
+                /// \brief Bytes of workspace a primitive being built may request: the free
+                ///        device memory less the argument space queued for transfer, capped
+                ///        by NGRAPH_GPU_WORKSPACE_LIMIT (in bytes) when it is set.
+                ///        The budget is further capped by what is left of
+                ///        NGRAPH_GPU_MEMORY_BUDGET after the memory already reserved, so that
+                ///        cuDNN falls back to algorithms that need less workspace.
+                size_t get_workspace_budget() const;
+                /// \brief Device memory reserved so far, including reservations that are not
+                ///        allocated yet.
+                GPUMemoryUsage get_memory_usage() const;
+                /// \brief Sum of get_memory_usage over every memory manager of the process.
+                static GPUMemoryUsage get_process_memory_usage();
+                /// \brief Bytes of device memory one compiled function may use, set with
+                ///        NGRAPH_GPU_MEMORY_BUDGET, or 0 when there is no budget.
+                static size_t get_memory_budget();
                 GPUAllocator build_allocator() { return GPUAllocator(this); }
             private:
+                struct allocation
+                {
+                    void* ptr;
+                    size_t size;
+                };
+
                 GPUMemoryManager(GPUPrimitiveEmitter* emitter);
                 size_t queue_for_transfer(const void* data, size_t size);
+                void* acquire_workspace(std::list<allocation>::iterator workspace);
 
                 size_t m_buffer_offset;
+                size_t m_constant_size;
+                size_t m_tensor_pool_size;
                 std::vector<uint8_t> m_buffered_mem;
                 std::unique_ptr<ngraph::pass::MemoryManager> m_workspace_manager;
                 static constexpr const uint16_t alignment = 8;
 
-                struct allocation
-                {
-                    void* ptr;
-                    size_t size;
-                };
-
                 std::list<allocation> m_argspace_mem;
                 std::list<allocation> m_workspace_mem;
                 GPUPrimitiveEmitter* m_primitive_emitter;
+
+                static std::mutex s_managers_mutex;
+                static std::set<const GPUMemoryManager*> s_managers;
             };
         }
     }
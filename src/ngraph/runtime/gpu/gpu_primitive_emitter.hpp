@@ -50,7 +50,13 @@ namespace ngraph
                 void cache(const std::string& hash, const size_t& index);
                 GPUAllocator get_memory_allocator() { return m_memory_manager.build_allocator(); }
                 void allocate_primitive_memory() { m_memory_manager.allocate(); }
+                void release_primitive_memory() { m_memory_manager.release_workspace(); }
                 size_t sizeof_device_allocation() { return m_memory_manager.get_allocation_size(); }
+                size_t get_workspace_budget() { return m_memory_manager.get_workspace_budget(); }
+                GPUMemoryUsage get_memory_usage() const
+                {
+                    return m_memory_manager.get_memory_usage();
+                }
                 GPUKernelArgs add_kernel_args() { return GPUKernelArgs(m_host_parameters); }
                 size_t register_primitive(std::unique_ptr<gpu::primitive>&, std::string);
 
@@ -21,12 +21,12 @@ using namespace ngraph;
 
 extern "C" void runtime::gpu::start_stopwatch(GPURuntimeContext* ctx, size_t idx)
 {
-    ctx->stopwatch_pool->get(idx).start();
+    ctx->stopwatch_pool->get(idx).start(ctx->stream);
 }
 
 extern "C" void runtime::gpu::stop_stopwatch(GPURuntimeContext* ctx, size_t idx)
 {
-    ctx->stopwatch_pool->get(idx).stop();
+    ctx->stopwatch_pool->get(idx).stop(ctx->stream);
 }
 extern "C" size_t runtime::gpu::count_stopwatch(GPURuntimeContext* ctx, size_t idx)
 {
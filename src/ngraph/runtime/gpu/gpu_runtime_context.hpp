@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cublas_v2.h>
+#include <cuda_runtime.h>
 #include <cudnn.h>
 #include <functional>
 #include <string>
@@ -41,6 +42,9 @@ namespace ngraph
             {
                 cudnnHandle_t* cudnn_handle;
                 cublasHandle_t* cublas_handle;
+                // Stream of all primitives, copies and kernel launches of the executable
+                // owning this context; the cuDNN and cuBLAS handles are bound to it
+                cudaStream_t stream;
                 gpu::primitive* const* gpu_primitives;
                 const gpu::memory_primitive* gpu_memory_primitives;
                 CudaFunctionPool* compiled_kernel_pool;
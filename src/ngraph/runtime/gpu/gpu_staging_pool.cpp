@@ -0,0 +1,139 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+#include "ngraph/runtime/gpu/cuda_error_check.hpp"
+#include "ngraph/runtime/gpu/gpu_staging_pool.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+runtime::gpu::StagingPool::StagingPool()
+    : m_chunk_size(4 * 1024 * 1024)
+{
+    if (const char* env = getenv("NGRAPH_GPU_STAGING_CHUNK_SIZE"))
+    {
+        m_chunk_size = max<size_t>(strtoull(env, nullptr, 0), 4096);
+    }
+}
+
+runtime::gpu::StagingPool::~StagingPool()
+{
+    for (size_t i = 0; i < s_num_buffers; i++)
+    {
+        if (m_buffers[i] != nullptr)
+        {
+            CUDA_RT_SAFE_CALL_NO_THROW(cudaEventSynchronize(m_events[i]));
+            CUDA_RT_SAFE_CALL_NO_THROW(cudaEventDestroy(m_events[i]));
+            CUDA_RT_SAFE_CALL_NO_THROW(cudaFreeHost(m_buffers[i]));
+        }
+    }
+}
+
+void runtime::gpu::StagingPool::allocate()
+{
+    // Pinned memory is allocated on first use, once a CUDA context is current
+    for (size_t i = 0; i < s_num_buffers; i++)
+    {
+        if (m_buffers[i] == nullptr)
+        {
+            CUDA_RT_SAFE_CALL(cudaHostAlloc(
+                reinterpret_cast<void**>(&m_buffers[i]), m_chunk_size, cudaHostAllocDefault));
+            CUDA_RT_SAFE_CALL(cudaEventCreateWithFlags(&m_events[i], cudaEventDisableTiming));
+        }
+    }
+}
+
+bool runtime::gpu::StagingPool::is_pinned(const void* ptr)
+{
+    cudaPointerAttributes attributes;
+    if (cudaPointerGetAttributes(&attributes, ptr) != cudaSuccess)
+    {
+        // Pageable memory is reported as an error by older runtimes; clear it
+        cudaGetLastError();
+        return false;
+    }
+#if CUDART_VERSION >= 10000
+    return attributes.type == cudaMemoryTypeHost;
+#else
+    return attributes.memoryType == cudaMemoryTypeHost;
+#endif
+}
+
+void runtime::gpu::StagingPool::copy_to_device(void* dst,
+                                               const void* src,
+                                               size_t n_bytes,
+                                               cudaStream_t stream)
+{
+    lock_guard<mutex> lock(m_mutex);
+    allocate();
+    for (size_t offset = 0, i = 0; offset < n_bytes; offset += m_chunk_size, i++)
+    {
+        size_t b = i % s_num_buffers;
+        size_t size = min(m_chunk_size, n_bytes - offset);
+        // Wait for the DMA that last read from this buffer, then refill it
+        CUDA_RT_SAFE_CALL(cudaEventSynchronize(m_events[b]));
+        memcpy(m_buffers[b], static_cast<const char*>(src) + offset, size);
+        CUDA_RT_SAFE_CALL(cudaMemcpyAsync(static_cast<char*>(dst) + offset,
+                                          m_buffers[b],
+                                          size,
+                                          cudaMemcpyHostToDevice,
+                                          stream));
+        CUDA_RT_SAFE_CALL(cudaEventRecord(m_events[b], stream));
+    }
+}
+
+void runtime::gpu::StagingPool::copy_to_host(void* dst,
+                                             const void* src,
+                                             size_t n_bytes,
+                                             cudaStream_t stream)
+{
+    lock_guard<mutex> lock(m_mutex);
+    allocate();
+    size_t num_chunks = (n_bytes + m_chunk_size - 1) / m_chunk_size;
+    auto issue = [&](size_t i) {
+        size_t b = i % s_num_buffers;
+        size_t offset = i * m_chunk_size;
+        // The buffer may still be read by a transfer queued on another stream
+        CUDA_RT_SAFE_CALL(cudaStreamWaitEvent(stream, m_events[b], 0));
+        CUDA_RT_SAFE_CALL(cudaMemcpyAsync(m_buffers[b],
+                                          static_cast<const char*>(src) + offset,
+                                          min(m_chunk_size, n_bytes - offset),
+                                          cudaMemcpyDeviceToHost,
+                                          stream));
+        CUDA_RT_SAFE_CALL(cudaEventRecord(m_events[b], stream));
+    };
+    if (num_chunks > 0)
+    {
+        issue(0);
+    }
+    for (size_t i = 0; i < num_chunks; i++)
+    {
+        // Start the DMA of the next chunk before draining this one
+        if (i + 1 < num_chunks)
+        {
+            issue(i + 1);
+        }
+        size_t b = i % s_num_buffers;
+        size_t offset = i * m_chunk_size;
+        CUDA_RT_SAFE_CALL(cudaEventSynchronize(m_events[b]));
+        memcpy(static_cast<char*>(dst) + offset, m_buffers[b], min(m_chunk_size, n_bytes - offset));
+    }
+}
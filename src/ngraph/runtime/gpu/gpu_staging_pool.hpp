@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cuda_runtime.h>
+#include <mutex>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gpu
+        {
+            class StagingPool;
+        }
+    }
+}
+
+/// \brief Pinned host buffers used to move data between pageable host memory and the device.
+///
+/// Transfers are split in chunks that alternate between two pinned buffers, so that copying
+/// one chunk on the host overlaps with the DMA of the previous one. Transfers larger than a
+/// chunk then run at close to the bandwidth of pinned memory. The chunk size defaults to 4MB
+/// and can be set with NGRAPH_GPU_STAGING_CHUNK_SIZE.
+class ngraph::runtime::gpu::StagingPool
+{
+public:
+    StagingPool();
+    ~StagingPool();
+
+    /// \brief Copy \p n_bytes from host memory \p src to device memory \p dst on \p stream.
+    ///
+    /// Returns once \p src may be reused; the copy to the device completes asynchronously on
+    /// \p stream.
+    void copy_to_device(void* dst, const void* src, size_t n_bytes, cudaStream_t stream);
+
+    /// \brief Copy \p n_bytes from device memory \p src to host memory \p dst after the work
+    /// already queued on \p stream. Returns once the data is in \p dst.
+    void copy_to_host(void* dst, const void* src, size_t n_bytes, cudaStream_t stream);
+
+    /// \brief True if \p ptr is page-locked host memory, which needs no staging
+    static bool is_pinned(const void* ptr);
+
+    size_t get_chunk_size() const { return m_chunk_size; }
+private:
+    StagingPool(const StagingPool&) = delete;
+    StagingPool& operator=(const StagingPool&) = delete;
+
+    void allocate();
+
+    static const size_t s_num_buffers = 2;
+
+    std::mutex m_mutex;
+    size_t m_chunk_size;
+    char* m_buffers[s_num_buffers] = {};
+    // Recorded after the last copy out of or into each buffer
+    cudaEvent_t m_events[s_num_buffers] = {};
+};
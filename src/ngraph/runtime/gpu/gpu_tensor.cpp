@@ -21,6 +21,7 @@
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/runtime/gpu/cuda_error_check.hpp"
 #include "ngraph/runtime/gpu/gpu_backend.hpp"
+#include "ngraph/runtime/gpu/gpu_staging_pool.hpp"
 #include "ngraph/runtime/gpu/gpu_tensor.hpp"
 #include "ngraph/runtime/gpu/gpu_util.hpp"
 
@@ -29,9 +30,11 @@ using namespace std;
 
 runtime::gpu::GPUTensor::GPUTensor(const ngraph::element::Type& element_type,
                                    const Shape& shape,
-                                   void* memory_pointer)
+                                   void* memory_pointer,
+                                   const std::shared_ptr<StagingPool>& staging_pool)
     : runtime::Tensor(std::make_shared<ngraph::descriptor::Tensor>(element_type, shape, ""))
     , m_custom_memory(false)
+    , m_staging_pool(staging_pool)
 {
     m_descriptor->set_tensor_layout(
         std::make_shared<ngraph::descriptor::layout::DenseTensorLayout>(*m_descriptor));
@@ -43,20 +46,32 @@ runtime::gpu::GPUTensor::GPUTensor(const ngraph::element::Type& element_type,
         {
             m_allocated_buffer_pool = memory_pointer;
             m_custom_memory = true;
+            m_device = get_pointer_device(memory_pointer);
         }
         else
         {
             throw ngraph_error("The pointer passed to GPUTensor is not a device pointer.");
         }
     }
-    else if (m_buffer_size > 0)
+    else
     {
-        m_allocated_buffer_pool = runtime::gpu::create_gpu_buffer(m_buffer_size);
+        CUDA_RT_SAFE_CALL(cudaGetDevice(&m_device));
+        if (m_buffer_size > 0)
+        {
+            m_allocated_buffer_pool = runtime::gpu::create_gpu_buffer(m_buffer_size);
+        }
     }
 }
 
+runtime::gpu::GPUTensor::GPUTensor(const ngraph::element::Type& element_type,
+                                   const Shape& shape,
+                                   void* memory_pointer)
+    : GPUTensor(element_type, shape, memory_pointer, nullptr)
+{
+}
+
 runtime::gpu::GPUTensor::GPUTensor(const ngraph::element::Type& element_type, const Shape& shape)
-    : GPUTensor(element_type, shape, nullptr)
+    : GPUTensor(element_type, shape, nullptr, nullptr)
 {
 }
 
@@ -70,12 +85,59 @@ runtime::gpu::GPUTensor::~GPUTensor()
 
 void runtime::gpu::GPUTensor::write(const void* source, size_t tensor_offset, size_t n_bytes)
 {
-    runtime::gpu::cuda_memcpyHtD(m_allocated_buffer_pool, source, n_bytes);
+    write_async(source, tensor_offset, n_bytes, 0);
+    CUDA_RT_SAFE_CALL(cudaStreamSynchronize(0));
 }
 
 void runtime::gpu::GPUTensor::read(void* target, size_t tensor_offset, size_t n_bytes) const
 {
-    runtime::gpu::cuda_memcpyDtH(target, m_allocated_buffer_pool, n_bytes);
+    read_async(target, tensor_offset, n_bytes, 0);
+    CUDA_RT_SAFE_CALL(cudaStreamSynchronize(0));
+}
+
+void runtime::gpu::GPUTensor::write_async(const void* source,
+                                          size_t tensor_offset,
+                                          size_t n_bytes,
+                                          cudaStream_t stream)
+{
+    if (tensor_offset + n_bytes > m_buffer_size)
+    {
+        throw out_of_range("write access past end of tensor");
+    }
+    void* target = static_cast<char*>(m_allocated_buffer_pool) + tensor_offset;
+    // A single chunk gains nothing from staging
+    if (m_staging_pool && n_bytes > m_staging_pool->get_chunk_size() &&
+        !StagingPool::is_pinned(source))
+    {
+        m_staging_pool->copy_to_device(target, source, n_bytes, stream);
+    }
+    else
+    {
+        CUDA_RT_SAFE_CALL(
+            cudaMemcpyAsync(target, source, n_bytes, cudaMemcpyHostToDevice, stream));
+    }
+}
+
+void runtime::gpu::GPUTensor::read_async(void* target,
+                                         size_t tensor_offset,
+                                         size_t n_bytes,
+                                         cudaStream_t stream) const
+{
+    if (tensor_offset + n_bytes > m_buffer_size)
+    {
+        throw out_of_range("read access past end of tensor");
+    }
+    const void* source = static_cast<const char*>(m_allocated_buffer_pool) + tensor_offset;
+    if (m_staging_pool && n_bytes > m_staging_pool->get_chunk_size() &&
+        !StagingPool::is_pinned(target))
+    {
+        m_staging_pool->copy_to_host(target, source, n_bytes, stream);
+    }
+    else
+    {
+        CUDA_RT_SAFE_CALL(
+            cudaMemcpyAsync(target, source, n_bytes, cudaMemcpyDeviceToHost, stream));
+    }
 }
 
 void runtime::gpu::GPUTensor::copy_from(const runtime::Tensor& source)
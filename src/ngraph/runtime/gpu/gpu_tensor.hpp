@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cuda_runtime.h>
 #include <memory>
 
 #include "ngraph/runtime/backend.hpp"
@@ -29,6 +30,7 @@ namespace ngraph
         namespace gpu
         {
             class GPUTensor;
+            class StagingPool;
         }
     }
 }
@@ -38,6 +40,12 @@ class ngraph::runtime::gpu::GPUTensor : public ngraph::runtime::Tensor
 public:
     GPUTensor(const ngraph::element::Type& element_type, const Shape& shape);
     GPUTensor(const ngraph::element::Type& element_type, const Shape& shape, void* memory_pointer);
+    /// \brief Tensor whose transfers from and to pageable host memory go through the pinned
+    /// buffers of \p staging_pool.
+    GPUTensor(const ngraph::element::Type& element_type,
+              const Shape& shape,
+              void* memory_pointer,
+              const std::shared_ptr<StagingPool>& staging_pool);
     virtual ~GPUTensor() override;
 
     /// \brief Write bytes directly into the tensor
@@ -52,15 +60,30 @@ public:
     /// \param n_bytes Number of bytes to read, must be integral number of elements.
     void read(void* p, size_t tensor_offset, size_t n_bytes) const override;
 
+    /// \brief Queue a write on \p stream. Returns once \p p may be reused, which for pinned
+    /// memory is as soon as the copy is queued.
+    void write_async(const void* p, size_t tensor_offset, size_t n_bytes, cudaStream_t stream);
+
+    /// \brief Queue a read on \p stream. Reads into pinned memory complete asynchronously;
+    /// reads into pageable memory are staged and complete before returning.
+    void read_async(void* p, size_t tensor_offset, size_t n_bytes, cudaStream_t stream) const;
+
     /// \brief Copy directly from the another GPU tensor
     /// \param source Another GPU tensor
     void copy_from(const runtime::Tensor& source) override;
 
+    /// \brief The CUDA device the tensor's memory is on. The outputs of a GPU executable can
+    /// be passed as inputs to any executable of a backend for the same device without a copy.
+    int get_device() const { return m_device; }
+
     void* m_allocated_buffer_pool = nullptr;
     size_t m_buffer_size;
     bool m_custom_memory;
 
 private:
+    std::shared_ptr<StagingPool> m_staging_pool;
+    int m_device = 0;
+
     GPUTensor(const GPUTensor&) = delete;
     GPUTensor(GPUTensor&&) = delete;
     GPUTensor& operator=(const GPUTensor&) = delete;
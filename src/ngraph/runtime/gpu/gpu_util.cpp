@@ -73,6 +73,13 @@ bool runtime::gpu::is_device_pointer(const void* ptr)
     return false;
 }
 
+int runtime::gpu::get_pointer_device(const void* ptr)
+{
+    cudaPointerAttributes attributes;
+    CUDA_RT_SAFE_CALL(cudaPointerGetAttributes(&attributes, ptr));
+    return attributes.device;
+}
+
 void runtime::gpu::cuda_memcpyDtD(void* dst, const void* src, size_t buffer_size)
 {
     CUDA_RT_SAFE_CALL(cudaMemcpy(dst, src, buffer_size, cudaMemcpyDeviceToDevice));
@@ -93,6 +100,19 @@ void runtime::gpu::cuda_memset(void* dst, int value, size_t buffer_size)
     CUDA_RT_SAFE_CALL(cudaMemset(dst, value, buffer_size));
 }
 
+void runtime::gpu::cuda_memcpyDtD(void* dst,
+                                  const void* src,
+                                  size_t buffer_size,
+                                  cudaStream_t stream)
+{
+    CUDA_RT_SAFE_CALL(cudaMemcpyAsync(dst, src, buffer_size, cudaMemcpyDeviceToDevice, stream));
+}
+
+void runtime::gpu::cuda_memset(void* dst, int value, size_t buffer_size, cudaStream_t stream)
+{
+    CUDA_RT_SAFE_CALL(cudaMemsetAsync(dst, value, buffer_size, stream));
+}
+
 namespace
 {
     // Unsigned integer exponentiation by squaring adapted
@@ -204,7 +224,12 @@ uint32_t runtime::gpu::idiv_ceil(int n, int d)
     return n / d + (n % d > 0);
 }
 
-void runtime::gpu::StopWatch::start()
+bool runtime::gpu::use_tensor_op_math()
+{
+    return std::getenv("NGRAPH_GPU_TENSOR_OP_MATH") != nullptr;
+}
+
+void runtime::gpu::StopWatch::start(cudaStream_t stream)
 {
     if (m_active == false)
     {
@@ -212,18 +237,18 @@ void runtime::gpu::StopWatch::start()
         m_active = true;
         cudaEvent_t start;
         cudaEventCreate(&start);
-        cudaEventRecord(start);
+        cudaEventRecord(start, stream);
         starts.push_back(start);
     }
 }
 
-void runtime::gpu::StopWatch::stop()
+void runtime::gpu::StopWatch::stop(cudaStream_t stream)
 {
     if (m_active == true)
     {
         cudaEvent_t stop;
         cudaEventCreate(&stop);
-        cudaEventRecord(stop);
+        cudaEventRecord(stop, stream);
         stops.push_back(stop);
         m_active = false;
     }
@@ -31,13 +31,25 @@ namespace ngraph
             void* create_gpu_buffer(size_t buffer_size, const void* data = nullptr);
             void free_gpu_buffer(void* buffer);
             bool is_device_pointer(const void* ptr);
+            /// \brief The device a pointer to device or managed memory belongs to
+            int get_pointer_device(const void* ptr);
             void cuda_memcpyDtD(void* dst, const void* src, size_t buffer_size);
             void cuda_memcpyHtD(void* dst, const void* src, size_t buffer_size);
             void cuda_memcpyDtH(void* dst, const void* src, size_t buffer_size);
             void cuda_memset(void* dst, int value, size_t buffer_size);
+            // Queue the copy or memset on `stream` and return without waiting for it
+            void cuda_memcpyDtD(void* dst,
+                                const void* src,
+                                size_t buffer_size,
+                                cudaStream_t stream);
+            void cuda_memset(void* dst, int value, size_t buffer_size, cudaStream_t stream);
             std::pair<uint64_t, uint64_t> idiv_magic_u32(uint64_t max_numerator, uint64_t divisor);
             std::pair<uint64_t, uint64_t> idiv_magic_u64(uint64_t divisor);
             uint32_t idiv_ceil(int n, int d);
+            /// \brief true if NGRAPH_GPU_TENSOR_OP_MATH is set, in which case f32 convolutions
+            ///        and GEMMs run on f16 copies of their inputs with f32 accumulation so
+            ///        that they can use Tensor Cores
+            bool use_tensor_op_math();
 
             template <typename T, typename... Args>
             std::unique_ptr<T> make_unique(Args&&... args)
@@ -59,8 +71,9 @@ namespace ngraph
             class StopWatch
             {
             public:
-                void start();
-                void stop();
+                // Record on `stream` around the work to time
+                void start(cudaStream_t stream = 0);
+                void stop(cudaStream_t stream = 0);
                 size_t get_call_count();
                 size_t get_total_seconds();
                 size_t get_total_milliseconds();
@@ -19,6 +19,7 @@
 #include <sstream>
 #include <vector>
 
+#include "ngraph/distributed.hpp"
 #include "ngraph/runtime/gpu/gpu_invoke.hpp"
 #include "ngraph/runtime/gpu/gpu_primitive_emitter.hpp"
 #include "ngraph/runtime/gpu/gpu_runtime_context.hpp"
@@ -51,7 +52,12 @@ size_t runtime::gpu::HostEmitter::build_memcpy(const cudaMemcpyKind& kind,
 
     std::unique_ptr<gpu::primitive> launch_kernel(
         new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-            CUDA_RT_SAFE_CALL(cudaMemcpy(outputs[dst], inputs[src], size, kind));
+            CUDA_RT_SAFE_CALL(
+                cudaMemcpyAsync(outputs[dst], inputs[src], size, kind, m_ctx->stream));
+            if (kind != cudaMemcpyDeviceToDevice)
+            {
+                CUDA_RT_SAFE_CALL(cudaStreamSynchronize(m_ctx->stream));
+            }
         }});
 
     return this->m_primitive_emitter->register_primitive(launch_kernel, hash);
@@ -76,15 +82,81 @@ size_t runtime::gpu::HostEmitter::build_zero_out(size_t dst, size_t size, bool i
     {
         launch_kernel.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
             void* tensor = gpu::invoke_memory_primitive(m_ctx, dst);
-            CUDA_RT_SAFE_CALL(cudaMemset(tensor, 0, size));
+            CUDA_RT_SAFE_CALL(cudaMemsetAsync(tensor, 0, size, m_ctx->stream));
         }});
     }
     else
     {
         launch_kernel.reset(new gpu::primitive{[=](void** inputs, void** outputs) mutable {
-            CUDA_RT_SAFE_CALL(cudaMemset(outputs[dst], 0, size));
+            CUDA_RT_SAFE_CALL(cudaMemsetAsync(outputs[dst], 0, size, m_ctx->stream));
         }});
     }
 
     return this->m_primitive_emitter->register_primitive(launch_kernel, hash);
 }
+
+size_t runtime::gpu::HostEmitter::build_all_gather(const element::Type& type, size_t count)
+{
+    std::stringstream ss;
+    ss << "all_gather_" << type.c_type_string() << "_count" << count;
+    std::string hash = ss.str();
+
+    // check if the requested kernel is already an inserted primitive
+    size_t primitive_index = m_primitive_emitter->lookup(hash);
+    if (primitive_index != std::numeric_limits<size_t>::max())
+    {
+        return primitive_index;
+    }
+
+    auto data_type = type.get_type_enum();
+    size_t in_size = count * type.size();
+    size_t out_size = in_size * get_distributed_interface()->get_size();
+    std::vector<char> host_in(in_size);
+    std::vector<char> host_out(out_size);
+    std::unique_ptr<gpu::primitive> launch_kernel(
+        new gpu::primitive{[=](void** inputs, void** outputs) mutable {
+            CUDA_RT_SAFE_CALL(cudaMemcpyAsync(
+                host_in.data(), inputs[0], in_size, cudaMemcpyDeviceToHost, m_ctx->stream));
+            CUDA_RT_SAFE_CALL(cudaStreamSynchronize(m_ctx->stream));
+            get_distributed_interface()->all_gather(
+                host_in.data(), host_out.data(), data_type, count);
+            CUDA_RT_SAFE_CALL(cudaMemcpyAsync(
+                outputs[0], host_out.data(), out_size, cudaMemcpyHostToDevice, m_ctx->stream));
+            CUDA_RT_SAFE_CALL(cudaStreamSynchronize(m_ctx->stream));
+        }});
+
+    return this->m_primitive_emitter->register_primitive(launch_kernel, hash);
+}
+
+size_t runtime::gpu::HostEmitter::build_reduce_scatter(const element::Type& type, size_t count)
+{
+    std::stringstream ss;
+    ss << "reduce_scatter_" << type.c_type_string() << "_count" << count;
+    std::string hash = ss.str();
+
+    // check if the requested kernel is already an inserted primitive
+    size_t primitive_index = m_primitive_emitter->lookup(hash);
+    if (primitive_index != std::numeric_limits<size_t>::max())
+    {
+        return primitive_index;
+    }
+
+    auto data_type = type.get_type_enum();
+    size_t out_size = count * type.size();
+    size_t in_size = out_size * get_distributed_interface()->get_size();
+    std::vector<char> host_in(in_size);
+    std::vector<char> host_out(out_size);
+    std::unique_ptr<gpu::primitive> launch_kernel(
+        new gpu::primitive{[=](void** inputs, void** outputs) mutable {
+            CUDA_RT_SAFE_CALL(cudaMemcpyAsync(
+                host_in.data(), inputs[0], in_size, cudaMemcpyDeviceToHost, m_ctx->stream));
+            CUDA_RT_SAFE_CALL(cudaStreamSynchronize(m_ctx->stream));
+            get_distributed_interface()->reduce_scatter(
+                host_in.data(), host_out.data(), data_type, count);
+            CUDA_RT_SAFE_CALL(cudaMemcpyAsync(
+                outputs[0], host_out.data(), out_size, cudaMemcpyHostToDevice, m_ctx->stream));
+            CUDA_RT_SAFE_CALL(cudaStreamSynchronize(m_ctx->stream));
+        }});
+
+    return this->m_primitive_emitter->register_primitive(launch_kernel, hash);
+}
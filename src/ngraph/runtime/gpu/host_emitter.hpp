@@ -22,6 +22,8 @@
 
 #include <cuda_runtime.h>
 
+#include "ngraph/type/element_type.hpp"
+
 namespace ngraph
 {
     namespace runtime
@@ -40,6 +42,9 @@ namespace ngraph
                                     size_t dst = 0,
                                     size_t src = 0);
                 size_t build_zero_out(size_t dst, size_t size, bool is_local = false);
+                // collectives are staged through host memory, count is elements per rank
+                size_t build_all_gather(const element::Type& type, size_t count);
+                size_t build_reduce_scatter(const element::Type& type, size_t count);
 
             private:
                 HostEmitter(GPUPrimitiveEmitter* emitter, GPURuntimeContext* ctx);
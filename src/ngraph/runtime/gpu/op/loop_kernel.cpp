@@ -0,0 +1,141 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+
+#include "ngraph/pass/loop_kernel_collector.hpp"
+#include "ngraph/runtime/gpu/op/loop_kernel.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+ngraph::op::gpu::LoopKernel::LoopKernel(const NodeVector& node_list,
+                                        const NodeVector& outputs,
+                                        const NodeVector& args)
+    : Op("LoopKernel", check_single_output_args({args}))
+    , m_node_list(node_list)
+    , m_output_nodes(outputs)
+    , m_reduction_size(1)
+    , m_has_reduction(false)
+{
+    constructor_validate_and_infer_types();
+    set_output_size(m_output_nodes.size());
+
+    shared_ptr<Node> ref;
+    for (auto n : node_list)
+    {
+        if (ngraph::pass::LoopKernelCollector::is_trailing_reduction(*n))
+        {
+            continue;
+        }
+        if (!ref)
+        {
+            ref = n;
+        }
+        if (n->get_shape() != ref->get_shape() || n->get_element_type() != ref->get_element_type())
+        {
+            throw ngraph_error("types and shapes of the nodes in node_list are different");
+        }
+    }
+    if (!ref)
+    {
+        throw ngraph_error("LoopKernel needs at least one elementwise node");
+    }
+
+    for (auto n : node_list)
+    {
+        if (!ngraph::pass::LoopKernelCollector::is_trailing_reduction(*n))
+        {
+            continue;
+        }
+        auto arg = n->get_argument(0);
+        if (find(node_list.begin(), node_list.end(), arg) == node_list.end() ||
+            arg->get_shape() != ref->get_shape() ||
+            n->get_element_type() != ref->get_element_type())
+        {
+            throw ngraph_error(n->get_name() + " doesn't reduce a node of the LoopKernel");
+        }
+        if (find(outputs.begin(), outputs.end(), n) == outputs.end())
+        {
+            throw ngraph_error(n->get_name() + " must be an output of the LoopKernel");
+        }
+        for (auto m : node_list)
+        {
+            auto m_args = m->get_arguments();
+            if (find(m_args.begin(), m_args.end(), n) != m_args.end())
+            {
+                throw ngraph_error(n->get_name() + " can't feed other nodes of the LoopKernel");
+            }
+        }
+
+        size_t reduction_size = shape_size(ref->get_shape()) / shape_size(n->get_shape());
+        if (m_has_reduction && reduction_size != m_reduction_size)
+        {
+            throw ngraph_error("reductions in a LoopKernel must produce the same shape");
+        }
+        m_reduction_size = reduction_size;
+        m_has_reduction = true;
+    }
+
+    for (size_t i = 0; i < outputs.size(); ++i)
+    {
+        auto& o = outputs.at(i);
+
+        if (find(node_list.begin(), node_list.end(), o) == node_list.end())
+        {
+            throw ngraph_error(o->get_name() + " isn't in node_list");
+        }
+        set_output_type(i, o->get_element_type(), o->get_shape());
+    }
+}
+
+shared_ptr<Node> ngraph::op::gpu::LoopKernel::copy_with_new_args(const NodeVector& new_args) const
+{
+    auto args = get_arguments();
+    if (new_args.size() != args.size())
+    {
+        throw ngraph_error("number of arguments don't match");
+    }
+
+    // map inputs
+    NodeMap nm;
+    for (size_t i = 0; i < args.size(); i++)
+    {
+        nm[args.at(i).get()] = new_args.at(i);
+    }
+
+    NodeVector new_node_list;
+    for (auto n : m_node_list)
+    {
+        NodeVector cur_args;
+        for (auto a : n->get_arguments())
+        {
+            cur_args.push_back(nm.at(a.get()));
+        }
+        auto new_n = n->copy_with_new_args(cur_args);
+        nm[n.get()] = new_n;
+        new_node_list.push_back(new_n);
+    }
+
+    NodeVector new_outputs;
+    for (auto o : m_output_nodes)
+    {
+        new_outputs.push_back(nm.at(o.get()));
+    }
+
+    return make_shared<LoopKernel>(new_node_list, new_outputs, new_args);
+}
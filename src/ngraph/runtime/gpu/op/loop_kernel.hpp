@@ -0,0 +1,64 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <memory>
+
+#include "ngraph/node.hpp"
+#include "ngraph/op/op.hpp"
+#include "ngraph/util.hpp"
+
+namespace ngraph
+{
+    namespace op
+    {
+        namespace gpu
+        {
+            /// \brief LoopKernel represents a chain of elementwise operations, and the
+            /// trailing reductions that fold it, emitted as a single CUDA kernel
+            ///
+            /// Reductions are Sum or Max over the innermost axes of the elementwise shape.
+            /// They must be kernel outputs, may not feed other nodes of the kernel and must
+            /// all produce the same shape.
+            class LoopKernel : public ngraph::op::Op
+            {
+            public:
+                LoopKernel(const NodeVector& node_list,
+                           const NodeVector& outputs,
+                           const NodeVector& args);
+
+                const NodeVector& get_node_list() const { return m_node_list; }
+                const NodeVector& get_kernel_outputs() const { return m_output_nodes; }
+                /// \return The number of elements folded into each reduction output; 1 if the
+                ///         kernel has no reductions.
+                size_t get_reduction_size() const { return m_reduction_size; }
+                bool has_reduction() const { return m_has_reduction; }
+
+            protected:
+                virtual std::shared_ptr<Node>
+                    copy_with_new_args(const NodeVector& new_args) const override;
+
+            private:
+                NodeVector m_node_list;
+                NodeVector m_output_nodes;
+                size_t m_reduction_size;
+                bool m_has_reduction;
+            };
+        }
+    }
+}
@@ -19,3 +19,6 @@
 NGRAPH_OP(Rnn, ngraph::op::gpu)
 #endif
 NGRAPH_OP(BatchNormTrainingWithStats, ngraph::op::gpu)
+NGRAPH_OP(LoopKernel, ngraph::op::gpu)
+NGRAPH_OP(LayerNorm, ngraph::op)
+NGRAPH_OP(Gelu, ngraph::op)
@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <memory>
+
+#include "ngraph/graph_util.hpp"
+#include "ngraph/pass/loop_kernel_collector.hpp"
+#include "ngraph/runtime/gpu/op/loop_kernel.hpp"
+#include "ngraph/runtime/gpu/pass/gpu_loop_kernel_fusion.hpp"
+
+using namespace ngraph;
+
+bool runtime::gpu::pass::GPULoopKernelFusion::is_fusible(const Node& node)
+{
+    // the generated kernel uses single precision math functions
+    return ngraph::pass::LoopKernelCollector::is_default_fusible(node) &&
+           node.get_element_type() == element::f32;
+}
+
+bool runtime::gpu::pass::GPULoopKernelFusion::run_on_function(std::shared_ptr<Function> f)
+{
+    ngraph::pass::LoopKernelCollector lkc(f, m_min_kernel_size, is_fusible);
+    auto groups = lkc.get_groups();
+
+    for (auto& group : groups)
+    {
+        NodeVector member_outputs = get_subgraph_outputs(group.m_nodes, NodeVector{});
+        auto lk = std::make_shared<ngraph::op::gpu::LoopKernel>(
+            group.m_nodes, member_outputs, group.m_inputs);
+        ngraph::pass::LoopKernelCollector::replace_kernel_outputs(
+            lk, lk->get_node_list(), lk->get_kernel_outputs());
+    }
+
+    return !groups.empty();
+}
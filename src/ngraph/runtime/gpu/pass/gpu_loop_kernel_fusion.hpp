@@ -0,0 +1,56 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace gpu
+        {
+            namespace pass
+            {
+                class GPULoopKernelFusion;
+            }
+        }
+    }
+}
+
+/// \brief Replaces chains of f32 elementwise ops, and the trailing reductions that fold them,
+///        with op::gpu::LoopKernel so they run as a single generated CUDA kernel.
+///
+/// Disabled by default, enable it with NGRAPH_PASS_ENABLES="GPULoopKernelFusion:1".
+class ngraph::runtime::gpu::pass::GPULoopKernelFusion : public ngraph::pass::FunctionPass
+{
+public:
+    GPULoopKernelFusion(size_t min_kernel_size = 2)
+        : FunctionPass()
+        , m_min_kernel_size(min_kernel_size)
+    {
+    }
+
+    virtual bool run_on_function(std::shared_ptr<ngraph::Function> f);
+
+    /// \return true if the CUDA loop kernel can compute `node`
+    static bool is_fusible(const Node& node);
+
+protected:
+    size_t m_min_kernel_size;
+};
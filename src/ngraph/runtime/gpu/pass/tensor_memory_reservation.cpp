@@ -34,7 +34,7 @@ bool runtime::gpu::pass::TensorMemoryReservation::run_on_function(shared_ptr<Fun
     // intermediate memory reservation
     if (mem_pool_size)
     {
-        size_t pool_idx = m_allocator.reserve_workspace(mem_pool_size, false);
+        size_t pool_idx = m_allocator.reserve_tensor_pool(mem_pool_size);
         m_memory_buffers.insert({f->get_name(), pool_idx});
         reservation = true;
     }
@@ -45,7 +45,7 @@ bool runtime::gpu::pass::TensorMemoryReservation::run_on_function(shared_ptr<Fun
         if (auto constant = std::dynamic_pointer_cast<ngraph::op::Constant>(node))
         {
             std::shared_ptr<descriptor::Tensor> tv = node->get_outputs()[0].get_tensor_ptr();
-            size_t idx = m_allocator.reserve_argspace(constant->get_data_ptr(), tv->size());
+            size_t idx = m_allocator.reserve_constant(constant->get_data_ptr(), tv->size());
             m_memory_buffers.insert({node->get_name(), idx});
             reservation = true;
         }
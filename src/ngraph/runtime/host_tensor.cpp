@@ -18,6 +18,7 @@
 #include <memory>
 
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
+#include "ngraph/runtime/buffer_pool.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/util.hpp"
 
@@ -47,7 +48,7 @@ runtime::HostTensor::HostTensor(const ngraph::element::Type& element_type,
     else if (m_buffer_size > 0)
     {
         size_t allocation_size = m_buffer_size + alignment;
-        m_allocated_buffer_pool = static_cast<char*>(ngraph_malloc(allocation_size));
+        m_allocated_buffer_pool = static_cast<char*>(BufferPool::get().allocate(allocation_size));
         m_aligned_buffer_pool = m_allocated_buffer_pool;
         size_t mod = size_t(m_aligned_buffer_pool) % alignment;
         if (mod != 0)
@@ -80,7 +81,7 @@ runtime::HostTensor::~HostTensor()
 {
     if (m_allocated_buffer_pool != nullptr)
     {
-        ngraph_free(m_allocated_buffer_pool);
+        BufferPool::get().deallocate(m_allocated_buffer_pool);
     }
 }
 
@@ -21,7 +21,7 @@
 #include "ngraph/runtime/host_tensor.hpp"
 #include "ngraph/runtime/hybrid/hybrid_backend.hpp"
 #include "ngraph/runtime/hybrid/hybrid_util.hpp"
-#include "ngraph/runtime/hybrid/pass/default_placement.hpp"
+#include "ngraph/runtime/hybrid/pass/cost_placement.hpp"
 #include "ngraph/runtime/hybrid/pass/dump.hpp"
 #include "ngraph/runtime/hybrid/pass/fix_get_output_element.hpp"
 #include "ngraph/runtime/hybrid/pass/liveness.hpp"
@@ -46,7 +46,7 @@ runtime::hybrid::HybridExecutable::HybridExecutable(
     }
     // Run placement pass
     ngraph::pass::Manager pass_manager;
-    pass_manager.register_pass<runtime::hybrid::pass::DefaultPlacement>(m_backend_list);
+    pass_manager.register_pass<runtime::hybrid::pass::CostPlacement>(m_backend_list);
     pass_manager.register_pass<runtime::hybrid::pass::FixGetOutputElement>();
     pass_manager.register_pass<runtime::hybrid::pass::Liveness>();
     pass_manager.register_pass<runtime::hybrid::pass::Dump>("graph.dump");
@@ -102,7 +102,6 @@ bool runtime::hybrid::HybridExecutable::call(const vector<shared_ptr<runtime::Te
 
     // Prepare result Tensors
     vector<shared_ptr<runtime::Tensor>> results;
-    map<runtime::Tensor*, runtime::Tensor*> copy_back;
     for (const shared_ptr<op::Result>& result_node : m_function->get_results())
     {
         auto it = map_node_to_tensor.find(result_node);
@@ -116,13 +115,9 @@ bool runtime::hybrid::HybridExecutable::call(const vector<shared_ptr<runtime::Te
         }
     }
 
+    // The subfunctions share the caller's tensors and the main function's buffers, see the
+    // FunctionCall kernel of the interpreter
     m_executable->call(results, parameters);
 
-    // Need to copy any results to the correct device
-    for (const auto& p : copy_back)
-    {
-        p.second->copy_from(*p.first);
-    }
-
     return rc;
 }
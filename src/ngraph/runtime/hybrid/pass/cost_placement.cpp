@@ -0,0 +1,221 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <limits>
+#include <list>
+#include <unordered_map>
+
+#include "ngraph/function.hpp"
+#include "ngraph/node.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/hybrid/pass/cost_placement.hpp"
+#include "ngraph/shape.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// Every crossing between backends is a FunctionCall with its own tensors, this is its cost
+// in elements of work regardless of the amount of data moved
+static const double s_transfer_latency = 4096;
+static const double s_transfer_cost_per_byte = 0.25;
+// Bounds the refinement, which otherwise runs until no single node can be moved
+static const size_t s_max_refine_sweeps = 8;
+
+static size_t output_bytes(const Output<Node>& output)
+{
+    return shape_size(output.get_shape()) * output.get_element_type().size();
+}
+
+runtime::hybrid::pass::CostPlacement::CostPlacement(
+    const vector<shared_ptr<runtime::Backend>>& placement_backends, const OpCost& op_cost)
+    : m_placement_backends(placement_backends)
+    , m_op_cost(op_cost)
+{
+    for (auto backend : m_placement_backends)
+    {
+        m_shares_host_memory.push_back(
+            backend->is_supported_property(runtime::Backend::Property::memory_attach));
+    }
+}
+
+double runtime::hybrid::pass::CostPlacement::default_op_cost(const Node& node,
+                                                             size_t /* backend_index */)
+{
+    if (node.is_parameter() || node.is_output() || node.is_constant())
+    {
+        return 0;
+    }
+    double elements = 0;
+    for (auto input : node.inputs())
+    {
+        elements += shape_size(input.get_shape());
+    }
+    for (auto output : node.outputs())
+    {
+        elements += shape_size(output.get_shape());
+    }
+    return elements;
+}
+
+double runtime::hybrid::pass::CostPlacement::transfer_cost(size_t bytes,
+                                                           size_t from,
+                                                           size_t to) const
+{
+    if (from == to)
+    {
+        return 0;
+    }
+    bool shared = m_shares_host_memory.at(from) && m_shares_host_memory.at(to);
+    return s_transfer_latency + (shared ? 0 : bytes * s_transfer_cost_per_byte);
+}
+
+bool runtime::hybrid::pass::CostPlacement::run_on_function(shared_ptr<Function> function)
+{
+    const double infinity = numeric_limits<double>::infinity();
+    const size_t backend_count = m_placement_backends.size();
+    list<shared_ptr<Node>> ordered_ops = function->get_ordered_ops();
+    vector<shared_ptr<Node>> ops(ordered_ops.begin(), ordered_ops.end());
+    unordered_map<const Node*, size_t> indices;
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        indices.insert({ops[i].get(), i});
+    }
+
+    // op_costs is infinite on the backends a node can not be placed on
+    vector<vector<double>> op_costs(ops.size(), vector<double>(backend_count, infinity));
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        const shared_ptr<Node>& node = ops[i];
+        bool placed = false;
+        for (size_t b = 0; b < backend_count; b++)
+        {
+            bool pinned = node->is_parameter() || node->is_output();
+            if (pinned ? b == 0 : m_placement_backends[b]->is_supported(*node))
+            {
+                op_costs[i][b] = m_op_cost(*node, b);
+                placed = true;
+            }
+        }
+        if (!placed)
+        {
+            throw runtime_error("Node " + node->get_name() + " not supported by any backend");
+        }
+    }
+
+    // costs[i][b] is the cost of node i on backend b plus the best way to feed its
+    // arguments. Only the excess over the cheapest backend of each argument is carried on,
+    // so that arguments shared by several users do not add up along the graph.
+    vector<vector<double>> costs(ops.size(), vector<double>(backend_count));
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        for (size_t b = 0; b < backend_count; b++)
+        {
+            double cost = op_costs[i][b];
+            for (auto input : ops[i]->inputs())
+            {
+                auto source = input.get_source_output();
+                size_t j = indices.at(source.get_node());
+                size_t bytes = output_bytes(source);
+                double best = infinity;
+                for (size_t from = 0; from < backend_count; from++)
+                {
+                    best = min(best, costs[j][from] + transfer_cost(bytes, from, b));
+                }
+                cost += best;
+            }
+            costs[i][b] = cost;
+        }
+        double cheapest = *min_element(costs[i].begin(), costs[i].end());
+        for (double& cost : costs[i])
+        {
+            cost -= cheapest;
+        }
+    }
+
+    // Pick backends from the results back, each node going where it is cheapest given
+    // where its users already are
+    vector<size_t> placements(ops.size());
+    for (size_t i = ops.size(); i-- > 0;)
+    {
+        double best = infinity;
+        for (size_t b = 0; b < backend_count; b++)
+        {
+            double cost = costs[i][b];
+            for (auto output : ops[i]->outputs())
+            {
+                size_t bytes = output_bytes(output);
+                for (auto target : output.get_target_inputs())
+                {
+                    cost += transfer_cost(bytes, b, placements[indices.at(target.get_node())]);
+                }
+            }
+            if (cost < best)
+            {
+                best = cost;
+                placements[i] = b;
+            }
+        }
+    }
+
+    // Move single nodes while that lowers the total cost
+    auto local_cost = [&](size_t i, size_t b) {
+        double cost = op_costs[i][b];
+        for (auto input : ops[i]->inputs())
+        {
+            auto source = input.get_source_output();
+            size_t from = placements[indices.at(source.get_node())];
+            cost += transfer_cost(output_bytes(source), from, b);
+        }
+        for (auto output : ops[i]->outputs())
+        {
+            size_t bytes = output_bytes(output);
+            for (auto target : output.get_target_inputs())
+            {
+                cost += transfer_cost(bytes, b, placements[indices.at(target.get_node())]);
+            }
+        }
+        return cost;
+    };
+    for (size_t sweep = 0; sweep < s_max_refine_sweeps; sweep++)
+    {
+        bool changed = false;
+        for (size_t i = 0; i < ops.size(); i++)
+        {
+            double best = local_cost(i, placements[i]);
+            for (size_t b = 0; b < backend_count; b++)
+            {
+                double cost = local_cost(i, b);
+                if (cost < best)
+                {
+                    best = cost;
+                    placements[i] = b;
+                    changed = true;
+                }
+            }
+        }
+        if (!changed)
+        {
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < ops.size(); i++)
+    {
+        ops[i]->set_placement_index(placements[i]);
+    }
+    return false;
+}
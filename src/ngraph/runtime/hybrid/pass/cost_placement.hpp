@@ -0,0 +1,75 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class Backend;
+
+        namespace hybrid
+        {
+            namespace pass
+            {
+                class CostPlacement;
+            }
+        }
+    }
+}
+
+/// \brief Places every node on one of the backends so that the estimated time of the ops
+///        plus the time spent moving tensors between backends is smallest.
+///
+/// Placement runs a dynamic program over the topological order: each node keeps, for each
+/// backend, the cost of running there given the best choices for its arguments. The
+/// backends are then picked from the results back to the parameters, and refined until no
+/// single node can be moved more cheaply. This is exact when the graph is a tree.
+///
+/// Every boundary between backends costs a fixed latency on top of the copy itself, so that
+/// small fragments stay with their neighbours instead of bouncing between backends. The
+/// copy is free between backends that can both attach host memory. Parameters and results
+/// stay on the first backend, which runs the rewritten function.
+class ngraph::runtime::hybrid::pass::CostPlacement : public ngraph::pass::FunctionPass
+{
+public:
+    /// \brief Estimated time of running `node` on backend `backend_index`, in the units of
+    ///        default_op_cost. Measured timings or a per-op table can be plugged in here.
+    using OpCost = std::function<double(const Node& node, size_t backend_index)>;
+
+    CostPlacement(const std::vector<std::shared_ptr<ngraph::runtime::Backend>>& placement_backends,
+                  const OpCost& op_cost = default_op_cost);
+
+    bool run_on_function(std::shared_ptr<ngraph::Function> function) override;
+
+    /// \brief The number of elements read and written by `node`, the same on every backend.
+    static double default_op_cost(const Node& node, size_t backend_index);
+
+    /// \brief Cost of moving `bytes` from backend `from` to backend `to`.
+    double transfer_cost(size_t bytes, size_t from, size_t to) const;
+
+private:
+    std::vector<std::shared_ptr<ngraph::runtime::Backend>> m_placement_backends;
+    OpCost m_op_cost;
+    std::vector<bool> m_shares_host_memory;
+};
@@ -36,6 +36,7 @@
 #include <CPP/mutable_data.hpp>
 #include <CPP/permute.hpp>
 #include <CPP/pooling.hpp>
+#include <CPP/reorder.hpp>
 #include <CPP/reshape.hpp>
 #include <CPP/select.hpp>
 #include <CPP/softmax.hpp>
@@ -43,8 +44,10 @@
 
 #include "ngraph/pass/algebraic_simplification.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
+#include "ngraph/pass/batch_norm_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/cse.hpp"
+#include "ngraph/pass/fused_op_decomposition.hpp"
 #include "ngraph/pass/get_output_element_elimination.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/nop_elimination.hpp"
@@ -55,11 +58,13 @@
 #include "ngraph/runtime/intelgpu/intelgpu_kernels.hpp"
 #include "ngraph/runtime/intelgpu/intelgpu_layout.hpp"
 #include "ngraph/runtime/intelgpu/intelgpu_op_custom_kernels.hpp"
+#include "ngraph/runtime/intelgpu/intelgpu_pass_half_precision.hpp"
 #include "ngraph/runtime/intelgpu/intelgpu_tensor_view.hpp"
 #include "ngraph/runtime/intelgpu/visualize_tree.hpp"
 
 #include "ngraph/file_util.hpp"
 #include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
 #include "ngraph/node.hpp"
 #include "ngraph/op/all.hpp"
 #include "ngraph/op/and.hpp"
@@ -80,9 +85,11 @@
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/depth_to_space.hpp"
 #include "ngraph/op/fused/elu.hpp"
+#include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/gemm.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
 #include "ngraph/op/fused/hard_sigmoid.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
 #include "ngraph/op/fused/space_to_depth.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/greater.hpp"
@@ -108,6 +115,9 @@
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sum.hpp"
 #include "ngraph/op/topk.hpp"
+#ifdef NGRAPH_JSON_ENABLE
+#include "ngraph/serializer.hpp"
+#endif
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -147,6 +157,12 @@ static OP_TYPEID get_typeid(const string& s)
     return it->second;
 }
 
+// clDNN primitives compute in these types. Custom kernels do not support f16.
+static bool is_cldnn_float(const element::Type& type)
+{
+    return type == element::f32 || type == element::f16;
+}
+
 static void do_eltwise_operation(cldnn::topology& topology,
                                  const shared_ptr<Node>& op,
                                  const string& custom_op,
@@ -155,9 +171,9 @@ static void do_eltwise_operation(cldnn::topology& topology,
 {
     runtime::intelgpu::arguments_check(op, 2, 1);
 
-    if (op->get_input_element_type(0) != element::f32 ||
-        op->get_input_element_type(1) != element::f32 ||
-        op->get_output_element_type(0) != element::f32)
+    if (!is_cldnn_float(op->get_input_element_type(0)) ||
+        !is_cldnn_float(op->get_input_element_type(1)) ||
+        !is_cldnn_float(op->get_output_element_type(0)))
     {
         runtime::intelgpu::do_eltwise_kernel(topology,
                                              op->get_input_tensor_name(0),
@@ -222,7 +238,7 @@ static void do_universal_unary(cldnn::topology& topology,
 {
     runtime::intelgpu::arguments_check(op, 1, 1);
 
-    if (force_custom || (op->get_input_element_type(0) != element::f32))
+    if (force_custom || !is_cldnn_float(op->get_input_element_type(0)))
     {
         do_custom_unary(topology, op, operation);
     }
@@ -343,6 +359,12 @@ runtime::intelgpu::IntelGPUBackend::IntelGPUBackend()
         m_cldnn_dump_enable = true;
     }
 
+    // Runs the operations clDNN supports in f16 in half precision, see pass::HalfPrecision
+    if (getenv("NGRAPH_INTELGPU_FP16") != nullptr)
+    {
+        m_half_precision_enable = true;
+    }
+
     // Delete compiled Function from the cache after execution.
     // It helps in cases where a lot of small functions used
     // in case of memory consumption. It slow overall execution
@@ -352,6 +374,17 @@ runtime::intelgpu::IntelGPUBackend::IntelGPUBackend()
         m_function_cache_disabled = true;
     }
 
+    // Keeps the OpenCL program binaries built for clDNN kernels in a directory, so that
+    // later processes load them instead of compiling the kernels again. The cache itself
+    // is kept by the Intel OpenCL driver, which reads its location from cl_cache_dir.
+    const char* kernel_cache_dir = getenv("NGRAPH_INTELGPU_KERNEL_CACHE_DIR");
+    if (kernel_cache_dir != nullptr && *kernel_cache_dir != '\0')
+    {
+        file_util::make_directory(kernel_cache_dir);
+        // an explicit cl_cache_dir in the environment wins
+        setenv("cl_cache_dir", kernel_cache_dir, 0);
+    }
+
     cldnn::engine_configuration cldnn_configuration(profiling,
                                                     false,
                                                     m_cldnn_dump_enable,
@@ -389,9 +422,22 @@ shared_ptr<runtime::Executable>
         return it->second;
     }
 
+    // A structurally identical function, such as the same model imported again, shares the
+    // network built for the first one. The executable binds arguments by position.
+    const string structure_key = get_structure_key(func);
+    if (!structure_key.empty())
+    {
+        auto sit = cldnn_structure_networks.find(structure_key);
+        if (sit != cldnn_structure_networks.end())
+        {
+            cldnn_networks.insert({func, sit->second});
+            return sit->second;
+        }
+    }
+
     set<cldnn::primitive_id> func_output_names;
     cldnn::topology topology;
-    CustomKernels kern(topology);
+    CustomKernels kern(topology, !m_disable_backend_optimizations);
     stopwatch timer_compile;
     double consumed_memory = 0.0;
     double compilation_time = 0.0;
@@ -416,7 +462,13 @@ shared_ptr<runtime::Executable>
         pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
         pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
         pass_manager.register_pass<ngraph::pass::ReshapeElimination>();
+        pass_manager.register_pass<ngraph::pass::BatchNormFolding>();
         pass_manager.register_pass<ngraph::pass::CoreFusion>(ngraph::pass::ALL_FUSIONS);
+        // CoreFusion creates LayerNorm and Gelu, which have no clDNN kernels here
+        pass_manager.register_pass<ngraph::pass::FusedOpDecomposition>([](const Node& node) {
+            return typeid(node) != typeid(ngraph::op::LayerNorm) &&
+                   typeid(node) != typeid(ngraph::op::Gelu);
+        });
 
         // GetOutputElementElimination must be after CommonSubexpressionElimination
         pass_manager.register_pass<ngraph::pass::GetOutputElementElimination>();
@@ -429,6 +481,20 @@ shared_ptr<runtime::Executable>
         }
     }
 
+    if (m_half_precision_enable)
+    {
+        ngraph::pass::Manager pass_manager;
+
+        pass_manager.register_pass<runtime::intelgpu::pass::HalfPrecision>();
+
+        pass_manager.run_passes(func);
+
+        if (m_dump_graph_enable)
+        {
+            visualize_tree(func, "intelgpu_", "_f16");
+        }
+    }
+
     for (shared_ptr<Node> op : func->get_ops())
     {
         const OP_TYPEID op_type_id = get_typeid(op->description());
@@ -569,6 +635,17 @@ shared_ptr<runtime::Executable>
                 do_equal_propagation(
                     topology, op->get_input_tensor_name(0), op->get_output_tensor_name(0));
             }
+            else if (is_cldnn_float(op->get_input_element_type(0)) &&
+                     is_cldnn_float(op->get_output_element_type(0)))
+            {
+                const cldnn::layout layout = IntelGPULayout::create_cldnn_layout(
+                    op->get_output_element_type(0), op->get_output_shape(0));
+                const cldnn::reorder op_reorder(op->get_output_tensor_name(0),
+                                                op->get_input_tensor_name(0),
+                                                layout.format,
+                                                layout.data_type);
+                topology.add(op_reorder);
+            }
             else
             {
                 do_convert_operation(topology,
@@ -592,7 +669,7 @@ shared_ptr<runtime::Executable>
             const size_t ngraph_concat_axis = concat_op->get_concatenation_axis();
 
             if (!shape_size(op->get_output_shape(0)) ||
-                (op->get_input_element_type(0) != element::f32) ||
+                !is_cldnn_float(op->get_input_element_type(0)) ||
                 op->get_output_shape(0).size() > 4)
             {
                 vector<string> input_names;
@@ -670,7 +747,7 @@ shared_ptr<runtime::Executable>
             // clDNN has limited support for Softmax operation
             // following are the checks to go with custom kernel
             if ((shape_dim_count > 3) || ((shape_dim_count == 3) && (axes_size == 2)) ||
-                (op->get_input_element_type(0) != element::f32))
+                !is_cldnn_float(op->get_input_element_type(0)))
             {
                 kern.emit<op::Softmax>(softmax_op);
             }
@@ -810,7 +887,7 @@ shared_ptr<runtime::Executable>
             const shared_ptr<op::MaxPool> max_pool = static_pointer_cast<op::MaxPool>(op);
 
             if ((op->get_input_shape(0).size() > 4) ||
-                (op->get_output_element_type(0) != element::f32) ||
+                !is_cldnn_float(op->get_output_element_type(0)) ||
                 has_non_zero(max_pool->get_padding_below()) ||
                 has_non_zero(max_pool->get_padding_above()))
             {
@@ -877,7 +954,7 @@ shared_ptr<runtime::Executable>
             const shared_ptr<op::AvgPool> avg_pool = static_pointer_cast<op::AvgPool>(op);
 
             if ((op->get_input_shape(0).size() > 4) ||
-                (op->get_output_element_type(0) != element::f32) ||
+                !is_cldnn_float(op->get_output_element_type(0)) ||
                 avg_pool->get_include_padding_in_avg_computation() ||
                 has_non_zero(avg_pool->get_padding_below()) ||
                 has_non_zero(avg_pool->get_padding_above()))
@@ -1022,7 +1099,7 @@ shared_ptr<runtime::Executable>
             const shared_ptr<op::Reshape> op_reshape = static_pointer_cast<op::Reshape>(op);
             const AxisVector& reshape_axes = op_reshape->get_input_order();
 
-            if ((op->get_input_element_type(0) != element::f32) ||
+            if (!is_cldnn_float(op->get_input_element_type(0)) ||
                 (op->get_input_shape(0).size() > 4) || (op->get_output_shape(0).size() > 4))
             {
                 do_reshape_operation(topology,
@@ -1505,7 +1582,7 @@ shared_ptr<runtime::Executable>
             if ((win_stride.size() != 2) || (pad_below.size() != 2) || (pad_above.size() != 2) ||
                 (win_dilation.size() != 2) || (data_dilation.size() != 2) ||
                 (data_dilation.at(0) != 1) || (data_dilation.at(1) != 1) ||
-                (op->get_output_element_type(0) != element::f32))
+                !is_cldnn_float(op->get_output_element_type(0)))
             {
                 if (op_type_id == OP_TYPEID::ConvolutionBias)
                 {
@@ -1973,23 +2050,33 @@ shared_ptr<runtime::Executable>
                               false);
             break;
         }
+        case OP_TYPEID::AdamUpdate:
+        case OP_TYPEID::AllFinite:
+        case OP_TYPEID::AllGather:
         case OP_TYPEID::AllReduce:
         case OP_TYPEID::BatchMatMul:
         case OP_TYPEID::BroadcastDistributed:
         case OP_TYPEID::BroadcastLike:
         case OP_TYPEID::DepthToSpace:
+        case OP_TYPEID::Dropout:
+        case OP_TYPEID::DropoutBackprop:
         case OP_TYPEID::DynBroadcast:
         case OP_TYPEID::DynPad:
         case OP_TYPEID::DynReshape:
         case OP_TYPEID::DynSlice:
         case OP_TYPEID::Elu:
         case OP_TYPEID::EmbeddingLookup:
+        case OP_TYPEID::EmbeddingLookupBackprop:
         case OP_TYPEID::Erf:
         case OP_TYPEID::Gather:
         case OP_TYPEID::GatherND:
+        case OP_TYPEID::Gelu:
         case OP_TYPEID::Gemm:
         case OP_TYPEID::GenerateMask:
         case OP_TYPEID::HardSigmoid:
+        case OP_TYPEID::If:
+        case OP_TYPEID::LayerNorm:
+        case OP_TYPEID::Loop:
         case OP_TYPEID::PRelu:
         case OP_TYPEID::Passthrough:
         case OP_TYPEID::QuantizedAvgPool:
@@ -2001,8 +2088,13 @@ shared_ptr<runtime::Executable>
         case OP_TYPEID::QuantizedDot:
         case OP_TYPEID::QuantizedDotBias:
         case OP_TYPEID::QuantizedMaxPool:
+        case OP_TYPEID::Recv:
+        case OP_TYPEID::ReduceScatter:
         case OP_TYPEID::ReplaceSlice:
         case OP_TYPEID::ScalarConstantLike:
+        case OP_TYPEID::ScaledDotProductAttention:
+        case OP_TYPEID::Send:
+        case OP_TYPEID::SgdMomentumUpdate:
         case OP_TYPEID::ShapeOf:
         case OP_TYPEID::SpaceToDepth:
         case OP_TYPEID::StopGradient:
@@ -2017,6 +2109,8 @@ shared_ptr<runtime::Executable>
         }
     }
 
+    kern.flush();
+
     cldnn::build_options network_build_options;
 
     network_build_options.set_option(cldnn::build_option::optimize_data(m_cldnn_graph_optimize));
@@ -2052,21 +2146,46 @@ shared_ptr<runtime::Executable>
     if (!m_function_cache_disabled)
     {
         cldnn_networks.insert({func, rc});
+        if (!structure_key.empty())
+        {
+            cldnn_structure_networks.insert({structure_key, rc});
+        }
     }
 
     return rc;
 }
 
-void runtime::intelgpu::IntelGPUBackend::remove_compiled_function(shared_ptr<Executable> exec)
+string runtime::intelgpu::IntelGPUBackend::get_structure_key(const shared_ptr<Function>& func)
 {
-    for (auto it = cldnn_networks.begin(); it != cldnn_networks.end(); ++it)
+#ifdef NGRAPH_JSON_ENABLE
+    if (!m_function_cache_disabled)
     {
-        if (it->second == exec)
+        try
         {
-            cldnn_networks.erase(it);
-            break;
+            return serialize_structure(func);
+        }
+        catch (const exception& e)
+        {
+            // Ops the serializer does not know are only cached by identity
+            NGRAPH_DEBUG << "Function " << func->get_name() << " is cached by identity only: "
+                         << e.what();
         }
     }
+#endif
+    return string();
+}
+
+void runtime::intelgpu::IntelGPUBackend::remove_compiled_function(shared_ptr<Executable> exec)
+{
+    // Several functions may share the executable
+    for (auto it = cldnn_networks.begin(); it != cldnn_networks.end();)
+    {
+        it = it->second == exec ? cldnn_networks.erase(it) : next(it);
+    }
+    for (auto it = cldnn_structure_networks.begin(); it != cldnn_structure_networks.end();)
+    {
+        it = it->second == exec ? cldnn_structure_networks.erase(it) : next(it);
+    }
 }
 
 bool runtime::intelgpu::IntelGPUBackend::is_supported_property(const Property prop) const
@@ -18,6 +18,8 @@
 
 #include <map>
 #include <memory>
+#include <string>
+#include <unordered_map>
 
 #include <CPP/engine.hpp>
 
@@ -53,8 +55,14 @@ public:
     bool is_supported_property(const Property prop) const override;
 
 private:
+    // Returns the canonical structure of the function (see ngraph::serialize_structure), or an
+    // empty string if it cannot be made.
+    std::string get_structure_key(const std::shared_ptr<Function>& func);
+
     std::shared_ptr<cldnn::engine> cldnn_engine;
     std::map<std::shared_ptr<Function>, std::shared_ptr<runtime::Executable>> cldnn_networks;
+    std::unordered_map<std::string, std::shared_ptr<runtime::Executable>>
+        cldnn_structure_networks;
 
     bool m_profile_enable = false;
     long m_profile_lines_limit_count = 10;
@@ -63,5 +71,6 @@ private:
     bool m_cldnn_dump_enable = false;
     bool m_function_cache_disabled = false;
     bool m_disable_backend_optimizations = false;
+    bool m_half_precision_enable = false;
     std::string m_cldnn_dump_dir = std::string("intelgpu_codegen");
 };
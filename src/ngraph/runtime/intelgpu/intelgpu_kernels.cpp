@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <iterator>
+
 #include <CPP/custom_gpu_primitive.hpp>
 
 #include "ngraph/runtime/intelgpu/intelgpu_kernels.hpp"
@@ -26,6 +29,151 @@
 using namespace std;
 using namespace ngraph;
 
+// OpenCL expression of a fusible elementwise operation over the given argument expressions,
+// or an empty string if the operation is not fusible
+static string get_eltwise_expression(const Node& op, const vector<string>& args)
+{
+    static const map<string, string> comparisons = {{"And", " && "},
+                                                    {"Equal", " == "},
+                                                    {"Greater", " > "},
+                                                    {"GreaterEq", " >= "},
+                                                    {"Less", " < "},
+                                                    {"LessEq", " <= "},
+                                                    {"NotEqual", " != "},
+                                                    {"Or", " || "}};
+
+    const string& description = op.description();
+    if (description == "Select" && args.size() == 3)
+    {
+        return "(" + args.at(0) + " ? " + args.at(1) + " : " + args.at(2) + ")";
+    }
+
+    auto it = comparisons.find(description);
+    if (it != comparisons.end() && args.size() == 2)
+    {
+        return "(" + args.at(0) + it->second + args.at(1) + " ? 1 : 0)";
+    }
+
+    return string();
+}
+
+bool runtime::intelgpu::CustomKernels::defer_eltwise(const shared_ptr<Node>& op)
+{
+    if (op->get_output_size() != 1 ||
+        get_eltwise_expression(*op, vector<string>(op->get_input_size())).empty())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < op->get_input_size(); ++i)
+    {
+        if (op->get_input_shape(i) != op->get_output_shape(0))
+        {
+            return false;
+        }
+    }
+
+    // An argument computed by a held back operation, and read only here, is folded into this
+    // operation's kernel
+    for (const descriptor::Input& input : op->get_inputs())
+    {
+        const descriptor::Output& arg = input.get_output();
+        const shared_ptr<Node> arg_op = arg.get_node();
+        if (arg.get_inputs().size() == 1 &&
+            find(m_eltwise.begin(), m_eltwise.end(), arg_op) != m_eltwise.end())
+        {
+            m_inlined.insert({arg.get_tensor().get_name(), arg_op});
+        }
+    }
+
+    m_eltwise.push_back(op);
+    return true;
+}
+
+string runtime::intelgpu::CustomKernels::build_eltwise_expression(
+    const shared_ptr<Node>& op, vector<string>& input_names, vector<string>& input_types) const
+{
+    const Shape& shape = op->get_output_shape(0);
+    vector<string> args;
+
+    for (size_t i = 0; i < op->get_input_size(); ++i)
+    {
+        const string& name = op->get_input_tensor_name(i);
+        auto it = m_inlined.find(name);
+        if (it != m_inlined.end())
+        {
+            // Keep the conversion that storing the intermediate result would do
+            args.push_back("((" + get_opencl_type_name(it->second->get_output_element_type(0)) +
+                           ")" + build_eltwise_expression(it->second, input_names, input_types) +
+                           ")");
+            continue;
+        }
+
+        auto pos = find(input_names.begin(), input_names.end(), name);
+        if (pos == input_names.end())
+        {
+            input_names.push_back(name);
+            input_types.push_back(get_opencl_type_name(op->get_input_element_type(i)));
+            pos = prev(input_names.end());
+        }
+        args.push_back("input" + to_string(distance(input_names.begin(), pos)) +
+                       access_dims(shape));
+    }
+
+    return get_eltwise_expression(*op, args);
+}
+
+void runtime::intelgpu::CustomKernels::flush()
+{
+    for (const shared_ptr<Node>& op : m_eltwise)
+    {
+        const string& output_name = op->get_output_tensor_name(0);
+        if (m_inlined.count(output_name))
+        {
+            continue;
+        }
+
+        const Shape& output_shape = op->get_output_shape(0);
+        const element::Type& output_type = op->get_output_element_type(0);
+        const string entry_point_name = "eltwise_fused_" + output_name;
+        vector<string> input_names;
+        vector<string> input_types;
+        const string expression = build_eltwise_expression(op, input_names, input_types);
+        CodeWriter writer;
+        vector<size_t> gws;
+
+        gen_func_def(writer,
+                     entry_point_name,
+                     input_types,
+                     vector<Shape>(input_names.size(), output_shape),
+                     get_opencl_type_name(output_type),
+                     output_shape);
+
+        writer.block_begin();
+        {
+            // Main loops
+            gws = generate_loops(writer, output_shape, true);
+
+            writer << "output" << access_dims(output_shape) << " = " << expression << ";\n";
+
+            // Closing brackets for main loops
+            generate_loops(writer, output_shape, false);
+        }
+        writer.block_end();
+
+        const CustomKernelInfo krn_ret(output_name,
+                                       output_shape,
+                                       output_type,
+                                       input_names,
+                                       {writer.get_code()},
+                                       entry_point_name,
+                                       gws);
+        queue_krnl({krn_ret}, op);
+    }
+
+    m_eltwise.clear();
+    m_inlined.clear();
+}
+
 void runtime::intelgpu::CustomKernels::queue_krnl(const krnl_info& krnl_info,
                                                   const shared_ptr<Node>& op)
 {
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
@@ -99,8 +100,9 @@ class ngraph::runtime::intelgpu::CustomKernels
 public:
     using krnl_info = std::vector<CustomKernelInfo>;
 
-    explicit CustomKernels(cldnn::topology& backend_stream)
+    explicit CustomKernels(cldnn::topology& backend_stream, bool fuse_eltwise = true)
         : stream(backend_stream)
+        , m_fuse_eltwise(fuse_eltwise)
     {
         m_count_krnls = 0;
     }
@@ -108,6 +110,11 @@ public:
     template <typename OP>
     void emit(const std::shared_ptr<OP>& op)
     {
+        if (m_fuse_eltwise && defer_eltwise(op))
+        {
+            return;
+        }
+
         krnl_info krnl_info;
 
         krnl_info = build_krnl(op);
@@ -115,10 +122,22 @@ public:
         queue_krnl(krnl_info, op);
     }
 
+    // Emits the elementwise operations held back by emit(). Chains of them whose intermediate
+    // results have no other users, such as select(cmp(a, b), x, y), become one kernel that
+    // keeps the intermediate values in registers. Must be called once all operations of the
+    // function are emitted.
+    void flush();
+
     size_t get_custom_kernel_count() const { return m_count_krnls; }
 private:
     void queue_krnl(const krnl_info& krn_info, const std::shared_ptr<Node>& op);
 
+    // Holds back an elementwise operation whose inputs all have the output shape
+    bool defer_eltwise(const std::shared_ptr<Node>& op);
+    std::string build_eltwise_expression(const std::shared_ptr<Node>& op,
+                                         std::vector<std::string>& input_names,
+                                         std::vector<std::string>& input_types) const;
+
     krnl_info build_krnl(const std::shared_ptr<op::All>& op) const;
     krnl_info build_krnl(const std::shared_ptr<op::And>& op) const;
     krnl_info build_krnl(const std::shared_ptr<op::Any>& op) const;
@@ -150,4 +169,8 @@ private:
 
     cldnn::topology& stream;
     size_t m_count_krnls;
+    bool m_fuse_eltwise;
+    std::vector<std::shared_ptr<Node>> m_eltwise;
+    // Output tensor names of the held back operations folded into their only user
+    std::map<std::string, std::shared_ptr<Node>> m_inlined;
 };
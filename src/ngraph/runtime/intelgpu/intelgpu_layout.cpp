@@ -61,6 +61,7 @@ cldnn::data_types
     case element::Type_t::u8: return cldnn::data_types::u8;
     case element::Type_t::i32: return cldnn::data_types::i32;
     case element::Type_t::i64: return cldnn::data_types::i64;
+    case element::Type_t::f16: return cldnn::data_types::f16;
     case element::Type_t::f32: return cldnn::data_types::f32;
     }
 
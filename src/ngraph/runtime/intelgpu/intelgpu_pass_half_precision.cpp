@@ -0,0 +1,189 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <map>
+#include <set>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convert.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/softmax.hpp"
+#include "ngraph/runtime/intelgpu/intelgpu_pass_half_precision.hpp"
+#include "ngraph/shape.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static bool has_non_zero(const Shape& shape)
+{
+    for (size_t dim : shape)
+    {
+        if (dim)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Mirrors the conditions under which IntelGPUBackend::compile() uses clDNN primitives
+bool runtime::intelgpu::pass::HalfPrecision::is_half_capable(const Node& node)
+{
+    static const set<string> eltwise_and_activations = {"Abs",
+                                                        "Add",
+                                                        "Maximum",
+                                                        "Minimum",
+                                                        "Multiply",
+                                                        "Relu",
+                                                        "Sigmoid",
+                                                        "Sqrt",
+                                                        "Subtract",
+                                                        "Tanh"};
+
+    if (node.get_output_size() != 1 || node.get_output_element_type(0) != element::f32)
+    {
+        return false;
+    }
+    for (size_t i = 0; i < node.get_input_size(); ++i)
+    {
+        if (node.get_input_element_type(i) != element::f32)
+        {
+            return false;
+        }
+    }
+
+    const string& description = node.description();
+    if (eltwise_and_activations.count(description))
+    {
+        return true;
+    }
+    if (auto softmax = dynamic_cast<const op::Softmax*>(&node))
+    {
+        const size_t rank = node.get_input_shape(0).size();
+        return rank < 3 || (rank == 3 && softmax->get_axes().size() != 2);
+    }
+    if (auto max_pool = dynamic_cast<const op::MaxPool*>(&node))
+    {
+        return node.get_input_shape(0).size() <= 4 &&
+               !has_non_zero(max_pool->get_padding_below()) &&
+               !has_non_zero(max_pool->get_padding_above());
+    }
+    if (auto avg_pool = dynamic_cast<const op::AvgPool*>(&node))
+    {
+        return node.get_input_shape(0).size() <= 4 &&
+               !avg_pool->get_include_padding_in_avg_computation() &&
+               !has_non_zero(avg_pool->get_padding_below()) &&
+               !has_non_zero(avg_pool->get_padding_above());
+    }
+    if (dynamic_cast<const op::Reshape*>(&node))
+    {
+        return node.get_input_shape(0).size() <= 4 && node.get_output_shape(0).size() <= 4;
+    }
+    if (dynamic_cast<const op::Concat*>(&node))
+    {
+        return shape_size(node.get_output_shape(0)) && node.get_output_shape(0).size() <= 4;
+    }
+    if (auto conv = dynamic_cast<const op::Convolution*>(&node))
+    {
+        return description == "Convolution" && conv->get_window_movement_strides().size() == 2 &&
+               conv->get_window_dilation_strides().size() == 2 &&
+               conv->get_padding_below().size() == 2 && conv->get_padding_above().size() == 2 &&
+               conv->get_data_dilation_strides() == Strides{1, 1};
+    }
+    return false;
+}
+
+bool runtime::intelgpu::pass::HalfPrecision::run_on_function(shared_ptr<Function> func)
+{
+    set<Node*> half_nodes;
+    // Each value is converted once, however many operations read it
+    map<pair<Node*, size_t>, shared_ptr<Node>> to_half;
+    map<pair<Node*, size_t>, shared_ptr<Node>> to_single;
+
+    for (const shared_ptr<Node>& node : func->get_ordered_ops())
+    {
+        if (!is_half_capable(*node))
+        {
+            continue;
+        }
+
+        for (descriptor::Input& input : node->get_inputs())
+        {
+            descriptor::Output& output = input.get_output();
+            const shared_ptr<Node> arg = output.get_node();
+            if (half_nodes.count(arg.get()))
+            {
+                continue;
+            }
+
+            const pair<Node*, size_t> key{arg.get(), output.get_index()};
+            auto it = to_half.find(key);
+            if (it == to_half.end())
+            {
+                shared_ptr<Node> converted;
+                if (auto constant = dynamic_pointer_cast<op::Constant>(arg))
+                {
+                    // Weights are stored in f16 rather than converted on every call
+                    converted = make_shared<op::Constant>(
+                        element::f16, constant->get_shape(), constant->get_vector<float>());
+                }
+                else
+                {
+                    converted = make_shared<op::Convert>(arg, element::f16);
+                }
+                it = to_half.insert({key, converted}).first;
+            }
+            input.replace_output(it->second, 0);
+        }
+
+        node->revalidate_and_infer_types();
+        half_nodes.insert(node.get());
+    }
+
+    // Convert back for the f32 operations and results reading f16 values
+    for (const shared_ptr<Node>& node : func->get_ordered_ops())
+    {
+        if (half_nodes.count(node.get()))
+        {
+            continue;
+        }
+        for (descriptor::Input& input : node->get_inputs())
+        {
+            descriptor::Output& output = input.get_output();
+            const shared_ptr<Node> arg = output.get_node();
+            if (!half_nodes.count(arg.get()))
+            {
+                continue;
+            }
+
+            const pair<Node*, size_t> key{arg.get(), output.get_index()};
+            auto it = to_single.find(key);
+            if (it == to_single.end())
+            {
+                it = to_single.insert({key, make_shared<op::Convert>(arg, element::f32)}).first;
+            }
+            input.replace_output(it->second, 0);
+        }
+    }
+
+    return !half_nodes.empty();
+}
@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include "ngraph/pass/pass.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace intelgpu
+        {
+            namespace pass
+            {
+                class HalfPrecision;
+            }
+        }
+    }
+}
+
+// Runs the f32 operations that clDNN primitives can compute in half precision in f16.
+// Constants read by them are converted to f16, and Convert operations are placed wherever a
+// value crosses between f32 and f16 operations. Parameters and results keep their types, so
+// callers are unaffected. Operations that would be lowered to custom OpenCL kernels, which
+// have no f16 support, stay in f32.
+class ngraph::runtime::intelgpu::pass::HalfPrecision : public ngraph::pass::FunctionPass
+{
+public:
+    bool run_on_function(std::shared_ptr<ngraph::Function> func) override;
+
+    // Tells if the backend computes the operation with a clDNN primitive once its f32 inputs
+    // and outputs become f16
+    static bool is_half_capable(const Node& node);
+};
@@ -72,3 +72,9 @@ bool runtime::interpreter::INTBackend::is_supported(const Node& node) const
 {
     return m_unsupported_op_name_list.find(node.description()) == m_unsupported_op_name_list.end();
 }
+
+bool runtime::interpreter::INTBackend::is_supported_property(const Property prop) const
+{
+    // tensors are host memory, so they can wrap buffers owned by another host backend
+    return prop == Property::memory_attach;
+}
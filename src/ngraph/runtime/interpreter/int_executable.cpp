@@ -14,11 +14,19 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <mutex>
+
 #include "ngraph/runtime/interpreter/int_executable.hpp"
+#include "ngraph/runtime/interpreter/int_thread_pool.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
+#include "ngraph/graph_util.hpp"
 #include "ngraph/op/convert.hpp"
+#include "ngraph/op/experimental/if.hpp"
+#include "ngraph/op/experimental/loop.hpp"
+#include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/select.hpp"
+#include "ngraph/op/util/op_annotations.hpp"
 #include "ngraph/op/util/binary_elementwise_comparison.hpp"
 #include "ngraph/pass/assign_layout.hpp"
 #include "ngraph/pass/core_fusion.hpp"
@@ -35,73 +43,79 @@ using namespace ngraph;
 
 using descriptor::layout::DenseTensorLayout;
 
+namespace
+{
+    // Lets MemoryLayout place each GetOutputElement on the output it selects, so that the
+    // plan can read that output directly instead of copying it
+    class AnnotateGetOutputElement : public pass::NodePass
+    {
+    public:
+        bool run_on_node(shared_ptr<Node> node) override
+        {
+            auto goe = dynamic_pointer_cast<op::GetOutputElement>(node);
+            if (goe && !goe->get_op_annotations())
+            {
+                auto op_annotations = make_shared<op::util::OpAnnotations>();
+                op_annotations->add_in_place_oi_pair({0, goe->get_n(), false});
+                goe->set_op_annotations(op_annotations);
+            }
+            return false;
+        }
+    };
+}
+
 runtime::interpreter::INTExecutable::INTExecutable(const shared_ptr<Function>& function,
                                                    bool enable_performance_collection)
     : m_performance_counters_enabled{enable_performance_collection}
 {
     m_is_compiled = true;
+    if (ThreadPool::get().get_thread_count() > 1)
+    {
+        m_thread_pool = &ThreadPool::get();
+    }
     pass::Manager pass_manager;
     pass_manager.register_pass<pass::LikeReplacement>();
     pass_manager.register_pass<pass::FusedOpDecomposition>();
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
+    pass_manager.register_pass<AnnotateGetOutputElement>();
     pass_manager.register_pass<pass::Liveness>();
+    // Ops running concurrently must not reuse each other's memory. FunctionCalls keep reading
+    // their inputs while the following ops run.
+    bool has_function_call = false;
+    for (auto& node : function->get_ops())
+    {
+        has_function_call |= node->description() == "FunctionCall";
+    }
+    pass_manager.register_pass<pass::MemoryLayout>(get_alignment(),
+                                                   m_thread_pool != nullptr || has_function_call);
     pass_manager.run_passes(function);
+    set_compile_profile(pass_manager.get_profile());
 
     for (const shared_ptr<Node>& node : function->get_ordered_ops())
     {
         m_wrapped_nodes.emplace_back(node);
     }
     set_parameters_and_results(*function);
+    build_plan(*function);
 }
 
-bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
-                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+void runtime::interpreter::INTExecutable::build_plan(Function& function)
 {
-    // convert inputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_inputs;
-    for (auto tensor : inputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_inputs.push_back(host_tensor);
-    }
-    if (m_nan_check_enabled)
-    {
-        perform_nan_check(func_inputs);
-    }
-
-    // convert outputs to HostTensor
-    vector<shared_ptr<HostTensor>> func_outputs;
-    for (auto tensor : outputs)
-    {
-        auto host_tensor = static_pointer_cast<runtime::HostTensor>(tensor);
-        func_outputs.push_back(host_tensor);
-    }
-
-    // map function params -> HostTensor
-    unordered_map<descriptor::Tensor*, shared_ptr<HostTensor>> tensor_map;
-    size_t input_count = 0;
+    unordered_map<const descriptor::Tensor*, size_t> slots;
     for (auto param : get_parameters())
     {
         for (size_t i = 0; i < param->get_output_size(); ++i)
         {
-            descriptor::Tensor* tensor = &param->output(i).get_tensor();
-            tensor_map.insert({tensor, func_inputs[input_count++]});
+            slots.insert({&param->output(i).get_tensor(), m_slot_count++});
         }
     }
-
-    // map function outputs -> HostTensor
-    for (size_t output_count = 0; output_count < get_results().size(); ++output_count)
+    m_input_count = m_slot_count;
+    for (auto result : get_results())
     {
-        auto output = get_results()[output_count];
-        if (!dynamic_pointer_cast<op::Result>(output))
-        {
-            throw ngraph_error("One of function's outputs isn't op::Result");
-        }
-        descriptor::Tensor* tensor = &output->output(0).get_tensor();
-        tensor_map.insert({tensor, func_outputs[output_count]});
+        slots.insert({&result->output(0).get_tensor(), m_slot_count++});
     }
+    m_output_count = m_slot_count - m_input_count;
 
-    // for each ordered op in the graph
     for (const NodeWrapper& wrapped : m_wrapped_nodes)
     {
         auto op = wrapped.get_node();
@@ -110,35 +124,48 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         {
             continue;
         }
+        if (type_id == OP_TYPEID::Constant)
+        {
+            // Constants are read in place rather than copied on every call
+            slots.insert({&op->output(0).get_tensor(), m_slot_count});
+            m_constants.push_back(static_cast<const op::Constant*>(op.get()));
+            m_constant_slots.push_back(m_slot_count++);
+            m_constant_tensors.emplace_back();
+            bind_constant(m_constants.size() - 1);
+            continue;
+        }
+        if (type_id == OP_TYPEID::GetOutputElement)
+        {
+            // The selected output is shared with the GetOutputElement, which needs no step
+            auto goe = static_cast<const op::GetOutputElement*>(op.get());
+            size_t slot = slots.at(&op->input(goe->get_n()).get_tensor());
+            slots.insert({&op->output(0).get_tensor(), slot});
+            continue;
+        }
 
-        // get op inputs from map
-        vector<shared_ptr<HostTensor>> op_inputs;
+        Step step;
+        step.wrapped = &wrapped;
         for (auto input : op->inputs())
         {
-            descriptor::Tensor* tensor = &input.get_tensor();
-            op_inputs.push_back(tensor_map.at(tensor));
+            step.inputs.push_back(slots.at(&input.get_tensor()));
         }
-
-        // get op outputs from map or create
-        vector<shared_ptr<HostTensor>> op_outputs;
         for (size_t i = 0; i < op->get_output_size(); ++i)
         {
             descriptor::Tensor* tensor = &op->output(i).get_tensor();
-            shared_ptr<HostTensor> host_tensor;
-            auto it = tensor_map.find(tensor);
-            if (it == tensor_map.end())
+            auto it = slots.find(tensor);
+            if (it == slots.end())
             {
-                const Shape& shape = op->get_output_shape(i);
-                const element::Type& type = op->get_output_element_type(i);
-                string name = op->output(i).get_tensor().get_name();
-                host_tensor = make_shared<runtime::HostTensor>(type, shape, name);
-                tensor_map.insert({tensor, host_tensor});
+                it = slots.insert({tensor, m_slot_count++}).first;
+                m_arena_tensors.push_back({it->second, tensor->get_pool_offset(), tensor});
             }
-            else
-            {
-                host_tensor = it->second;
-            }
-            op_outputs.push_back(host_tensor);
+            step.outputs.push_back(it->second);
+        }
+
+        if (type_id == OP_TYPEID::If || type_id == OP_TYPEID::Loop)
+        {
+            step.kernel = make_control_flow_kernel(*op);
+            m_plan.push_back(step);
+            continue;
         }
 
         // get op type
@@ -167,51 +194,524 @@ bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::
         default: type = op->get_output_element_type(0); break;
         }
 #pragma GCC diagnostic pop
+        step.kernel = make_kernel(type, wrapped);
+        if (type_id == OP_TYPEID::FunctionCall)
+        {
+            step.async_kernel = make_function_call(*op);
+            step.async_index = m_async_count++;
+        }
+        m_plan.push_back(step);
+    }
+
+    // The async steps are waited for by the first steps that read what they write
+    unordered_map<size_t, size_t> async_outputs;
+    for (Step& step : m_plan)
+    {
+        for (size_t slot : step.inputs)
+        {
+            auto it = async_outputs.find(slot);
+            if (it != async_outputs.end() &&
+                find(step.waits.begin(), step.waits.end(), it->second) == step.waits.end())
+            {
+                step.waits.push_back(it->second);
+            }
+        }
+        if (step.async_kernel)
+        {
+            m_async_steps.push_back(&step);
+            for (size_t slot : step.outputs)
+            {
+                async_outputs[slot] = step.async_index;
+            }
+        }
+    }
+    m_arena_size = function.get_temporary_pool_size();
+    m_frame = make_call_frame();
+
+    if (m_performance_counters_enabled)
+    {
+        // steps running concurrently update their own timers only
+        for (const Step& step : m_plan)
+        {
+            m_timer_map[step.wrapped->get_node()];
+        }
+    }
+    if (m_thread_pool)
+    {
+        build_levels();
+    }
+}
+
+runtime::interpreter::INTExecutable::Kernel
+    runtime::interpreter::INTExecutable::make_split_kernel(size_t rows,
+                                                           size_t min_rows,
+                                                           const SplitKernel& kernel)
+{
+    size_t chunks =
+        m_thread_pool ? min(m_thread_pool->get_thread_count(), rows / max<size_t>(min_rows, 1))
+                      : 0;
+    if (chunks < 2)
+    {
+        return [rows, kernel](const vector<shared_ptr<HostTensor>>& out,
+                              const vector<shared_ptr<HostTensor>>& args) {
+            kernel(out, args, 0, rows);
+        };
+    }
+    ThreadPool* pool = m_thread_pool;
+    return [pool, rows, chunks, kernel](const vector<shared_ptr<HostTensor>>& out,
+                                        const vector<shared_ptr<HostTensor>>& args) {
+        pool->parallel_for(chunks, [&](size_t chunk) {
+            kernel(out, args, rows * chunk / chunks, rows * (chunk + 1) / chunks);
+        });
+    };
+}
+
+// Ops that communicate or keep state are never run at the same time as each other
+static bool is_serial_op(runtime::interpreter::OP_TYPEID type_id)
+{
+    using runtime::interpreter::OP_TYPEID;
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+    switch (type_id)
+    {
+    case OP_TYPEID::AllGather:
+    case OP_TYPEID::AllReduce:
+    case OP_TYPEID::BroadcastDistributed:
+    case OP_TYPEID::Dropout:
+    case OP_TYPEID::FunctionCall:
+    case OP_TYPEID::GenerateMask:
+    case OP_TYPEID::Recv:
+    case OP_TYPEID::ReduceScatter:
+    case OP_TYPEID::Send: return true;
+    default: return false;
+    }
+#pragma GCC diagnostic pop
+}
+
+void runtime::interpreter::INTExecutable::build_levels()
+{
+    // A step's level is one more than the levels of the steps it depends on, so the steps
+    // of a level can run concurrently once the previous levels are done
+    vector<size_t> slot_levels(m_slot_count, 0);
+    unordered_map<const Node*, size_t> node_levels;
+    size_t max_level = 0;
+    for (size_t i = 0; i < m_plan.size(); i++)
+    {
+        const Step& step = m_plan[i];
+        auto node = step.wrapped->get_node();
+        size_t level = 1;
+        for (size_t slot : step.inputs)
+        {
+            level = max(level, slot_levels[slot] + 1);
+        }
+        for (auto& dependency : node->get_control_dependencies())
+        {
+            auto it = node_levels.find(dependency.get());
+            if (it != node_levels.end())
+            {
+                level = max(level, it->second + 1);
+            }
+        }
+        if (is_serial_op(step.wrapped->get_typeid()))
+        {
+            level = max(level, max_level + 1);
+        }
+        for (size_t slot : step.outputs)
+        {
+            slot_levels[slot] = level;
+        }
+        node_levels[node.get()] = level;
+        max_level = max(max_level, level);
+        m_levels.resize(max_level);
+        m_levels[level - 1].push_back(i);
+    }
+}
+
+void runtime::interpreter::INTExecutable::run_step(const Step& step,
+                                                   const vector<shared_ptr<HostTensor>>& tensors,
+                                                   vector<shared_ptr<HostTensor>>& op_inputs,
+                                                   vector<shared_ptr<HostTensor>>& op_outputs)
+{
+    op_inputs.clear();
+    for (size_t slot : step.inputs)
+    {
+        op_inputs.push_back(tensors[slot]);
+    }
+    op_outputs.clear();
+    for (size_t slot : step.outputs)
+    {
+        op_outputs.push_back(tensors[slot]);
+    }
+
+    auto op = step.wrapped->get_node();
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).start();
+    }
+    step.kernel(op_outputs, op_inputs);
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).stop();
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(op_outputs, op.get());
+    }
+}
+
+void runtime::interpreter::INTExecutable::run_plan(const vector<shared_ptr<HostTensor>>& tensors)
+{
+    vector<future<bool>> pending(m_async_count);
+    try
+    {
+        // for each planned op in the graph
+        vector<shared_ptr<HostTensor>> op_inputs;
+        vector<shared_ptr<HostTensor>> op_outputs;
+        for (const Step& step : m_plan)
+        {
+            for (size_t index : step.waits)
+            {
+                finish_step(*m_async_steps[index], tensors, pending[index]);
+            }
+            if (step.async_kernel)
+            {
+                pending[step.async_index] = start_step(step, tensors);
+            }
+            else
+            {
+                run_step(step, tensors, op_inputs, op_outputs);
+            }
+        }
+        for (size_t index = 0; index < m_async_count; index++)
+        {
+            finish_step(*m_async_steps[index], tensors, pending[index]);
+        }
+    }
+    catch (...)
+    {
+        // the calls still running use the frame's tensors
+        for (future<bool>& done : pending)
+        {
+            if (done.valid())
+            {
+                done.wait();
+            }
+        }
+        throw;
+    }
+}
+
+future<bool>
+    runtime::interpreter::INTExecutable::start_step(const Step& step,
+                                                    const vector<shared_ptr<HostTensor>>& tensors)
+{
+    vector<shared_ptr<HostTensor>> op_inputs;
+    for (size_t slot : step.inputs)
+    {
+        op_inputs.push_back(tensors[slot]);
+    }
+    vector<shared_ptr<HostTensor>> op_outputs;
+    for (size_t slot : step.outputs)
+    {
+        op_outputs.push_back(tensors[slot]);
+    }
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(step.wrapped->get_node()).start();
+    }
+    return step.async_kernel(op_outputs, op_inputs);
+}
+
+void runtime::interpreter::INTExecutable::finish_step(const Step& step,
+                                                      const vector<shared_ptr<HostTensor>>& tensors,
+                                                      future<bool>& done)
+{
+    if (!done.valid())
+    {
+        return;
+    }
+    done.get();
+    auto op = step.wrapped->get_node();
+    if (m_performance_counters_enabled)
+    {
+        m_timer_map.at(op).stop();
+    }
+    if (m_nan_check_enabled)
+    {
+        vector<shared_ptr<HostTensor>> op_outputs;
+        for (size_t slot : step.outputs)
+        {
+            op_outputs.push_back(tensors[slot]);
+        }
+        perform_nan_check(op_outputs, op.get());
+    }
+}
+
+runtime::interpreter::INTExecutable::AsyncKernel
+    runtime::interpreter::INTExecutable::make_function_call(const Node& node)
+{
+    auto f = static_cast<const runtime::hybrid::op::FunctionCall*>(&node);
+    auto backend = f->get_backend();
+    auto executable = f->get_executable();
+
+    // Backends that can address host memory work on our buffers directly, the others get
+    // their own tensors and the data is copied across
+    bool attach = backend->is_supported_property(Backend::Property::memory_attach);
+    return [backend, executable, attach](const vector<shared_ptr<HostTensor>>& out,
+                                         const vector<shared_ptr<HostTensor>>& args) {
+        vector<shared_ptr<Tensor>> outputs;
+        vector<shared_ptr<Tensor>> inputs;
+        for (const shared_ptr<HostTensor>& t : out)
+        {
+            outputs.push_back(
+                attach ? backend->create_tensor(
+                             t->get_element_type(), t->get_shape(), t->get_data_ptr())
+                       : backend->create_tensor(t->get_element_type(), t->get_shape()));
+        }
+        for (const shared_ptr<HostTensor>& t : args)
+        {
+            if (attach)
+            {
+                inputs.push_back(backend->create_tensor(
+                    t->get_element_type(), t->get_shape(), t->get_data_ptr()));
+            }
+            else
+            {
+                auto tensor = backend->create_tensor(t->get_element_type(), t->get_shape());
+                tensor->write(t->get_data_ptr(), 0, t->get_size_in_bytes());
+                inputs.push_back(tensor);
+            }
+        }
+        future<bool> done = executable->begin_call(outputs, inputs);
+        if (attach)
+        {
+            return done;
+        }
+        // the outputs are copied back by whoever waits for them
+        auto call = make_shared<future<bool>>(move(done));
+        return async(launch::deferred, [call, outputs, out]() {
+            bool rc = call->get();
+            for (size_t i = 0; i < out.size(); ++i)
+            {
+                outputs[i]->read(out[i]->get_data_ptr(), 0, out[i]->get_size_in_bytes());
+            }
+            return rc;
+        });
+    };
+}
+
+runtime::interpreter::INTExecutable::Kernel
+    runtime::interpreter::INTExecutable::make_control_flow_kernel(const Node& node)
+{
+    auto as_tensors = [](const vector<shared_ptr<HostTensor>>& host_tensors) {
+        return vector<shared_ptr<Tensor>>(host_tensors.begin(), host_tensors.end());
+    };
+
+    if (auto if_op = dynamic_cast<const op::If*>(&node))
+    {
+        auto then_executable = make_shared<INTExecutable>(clone_function(*if_op->get_then_body()));
+        auto else_executable = make_shared<INTExecutable>(clone_function(*if_op->get_else_body()));
+        return [then_executable, else_executable, as_tensors](
+            const vector<shared_ptr<HostTensor>>& out,
+            const vector<shared_ptr<HostTensor>>& args) {
+            bool condition = args[0]->get_data_ptr<const char>()[0] != 0;
+            vector<shared_ptr<Tensor>> inputs(args.begin() + 1, args.end());
+            (condition ? then_executable : else_executable)->call(as_tensors(out), inputs);
+        };
+    }
+
+    auto loop = static_cast<const op::Loop*>(&node);
+    auto executable = make_shared<INTExecutable>(clone_function(*loop->get_body()));
+    size_t carried_count = loop->get_carried_count();
+    return [executable, carried_count](const vector<shared_ptr<HostTensor>>& out,
+                                       const vector<shared_ptr<HostTensor>>& args) {
+        int64_t trip_count = args[0]->get_data_ptr<const int64_t>()[0];
+        bool condition = args[1]->get_data_ptr<const char>()[0] != 0;
+
+        // The loop-carried values live in the outputs, each iteration writes the next ones
+        // to the other buffer of their pair and the two are swapped
+        auto iteration = make_shared<HostTensor>(element::i64, Shape{});
+        auto next_condition = make_shared<HostTensor>(element::boolean, Shape{});
+        vector<shared_ptr<Tensor>> inputs{iteration};
+        vector<shared_ptr<Tensor>> outputs{next_condition};
+        for (size_t i = 0; i < carried_count; i++)
+        {
+            out[i]->write(args[i + 2]->get_data_ptr(), 0, out[i]->get_size_in_bytes());
+            inputs.push_back(out[i]);
+            outputs.push_back(
+                make_shared<HostTensor>(out[i]->get_element_type(), out[i]->get_shape()));
+        }
+        inputs.insert(inputs.end(), args.begin() + 2 + carried_count, args.end());
 
-        if (m_performance_counters_enabled)
+        for (int64_t i = 0; condition && (trip_count < 0 || i < trip_count); i++)
+        {
+            iteration->get_data_ptr<int64_t>()[0] = i;
+            executable->call(outputs, inputs);
+            condition = next_condition->get_data_ptr<const char>()[0] != 0;
+            for (size_t j = 1; j <= carried_count; j++)
+            {
+                swap(inputs[j], outputs[j]);
+            }
+        }
+        for (size_t i = 0; i < carried_count; i++)
+        {
+            if (inputs[i + 1] != out[i])
+            {
+                inputs[i + 1]->read(out[i]->get_data_ptr(), 0, out[i]->get_size_in_bytes());
+            }
+        }
+    };
+}
+
+unique_ptr<runtime::interpreter::INTExecutable::CallFrame>
+    runtime::interpreter::INTExecutable::make_call_frame() const
+{
+    unique_ptr<CallFrame> frame(new CallFrame);
+    frame->arena.reset(new AlignedBuffer(m_arena_size, get_alignment()));
+    frame->tensors.resize(m_slot_count);
+    for (const ArenaTensor& arena_tensor : m_arena_tensors)
+    {
+        const descriptor::Tensor* tensor = arena_tensor.tensor;
+        frame->tensors[arena_tensor.slot] =
+            make_shared<HostTensor>(tensor->get_element_type(),
+                                    tensor->get_shape(),
+                                    frame->arena->get_ptr(arena_tensor.offset),
+                                    tensor->get_name());
+    }
+    return frame;
+}
+
+void runtime::interpreter::INTExecutable::bind_constant(size_t index)
+{
+    const op::Constant* constant = m_constants[index];
+    m_constant_tensors[index] =
+        make_shared<HostTensor>(constant->get_element_type(),
+                                constant->get_shape(),
+                                const_cast<void*>(constant->get_data_ptr()),
+                                constant->get_output_tensor(0).get_name());
+}
+
+void runtime::interpreter::INTExecutable::update_constants(
+    const map<const op::Constant*, const void*>& values)
+{
+    // Constants are read in place on every call, so overwriting their data is all it takes
+    unordered_map<const op::Constant*, size_t> indices;
+    for (size_t i = 0; i < m_constants.size(); i++)
+    {
+        indices.insert({m_constants[i], i});
+    }
+    for (auto& value : values)
+    {
+        if (indices.count(value.first) == 0)
+        {
+            throw ngraph_error("Constant " + value.first->get_name() +
+                               " is not part of the compiled function");
+        }
+    }
+    for (auto& value : values)
+    {
+        // Data shared with copies of the constant is copied first, so that only this
+        // executable sees the update
+        auto constant = const_cast<op::Constant*>(value.first);
+        if (constant->make_data_unique())
         {
-            m_timer_map[op].start();
+            bind_constant(indices.at(value.first));
         }
-        generate_calls(type, wrapped, op_outputs, op_inputs);
-        if (m_performance_counters_enabled)
+        size_t size = shape_size(constant->get_shape()) * constant->get_element_type().size();
+        memcpy(const_cast<void*>(constant->get_data_ptr()), value.second, size);
+    }
+}
+
+bool runtime::interpreter::INTExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    // Calls running at the same time as the one holding the cached frame get their own
+    unique_ptr<CallFrame> frame;
+    {
+        lock_guard<mutex> lock(m_frame_mutex);
+        frame = move(m_frame);
+    }
+    if (!frame)
+    {
+        frame = make_call_frame();
+    }
+    vector<shared_ptr<HostTensor>>& tensors = frame->tensors;
+
+    // bind function params and outputs to their slots
+    for (size_t i = 0; i < m_input_count; ++i)
+    {
+        tensors[i] = static_pointer_cast<runtime::HostTensor>(inputs[i]);
+    }
+    for (size_t i = 0; i < m_output_count; ++i)
+    {
+        tensors[m_input_count + i] = static_pointer_cast<runtime::HostTensor>(outputs[i]);
+    }
+    for (size_t i = 0; i < m_constants.size(); ++i)
+    {
+        tensors[m_constant_slots[i]] = m_constant_tensors[i];
+    }
+    if (m_nan_check_enabled)
+    {
+        perform_nan_check(vector<shared_ptr<HostTensor>>(tensors.begin(),
+                                                         tensors.begin() + m_input_count));
+        for (size_t i = 0; i < m_constants.size(); ++i)
         {
-            m_timer_map[op].stop();
+            perform_nan_check({m_constant_tensors[i]}, m_constants[i]);
         }
-        if (m_nan_check_enabled)
+    }
+
+    if (m_levels.empty())
+    {
+        run_plan(tensors);
+    }
+    else
+    {
+        for (const vector<size_t>& level : m_levels)
         {
-            perform_nan_check(op_outputs, op.get());
+            m_thread_pool->parallel_for(level.size(), [&](size_t i) {
+                vector<shared_ptr<HostTensor>> op_inputs;
+                vector<shared_ptr<HostTensor>> op_outputs;
+                run_step(m_plan[level[i]], tensors, op_inputs, op_outputs);
+            });
         }
     }
 
+    // the frame does not keep the caller's tensors alive
+    fill(tensors.begin(), tensors.begin() + m_input_count + m_output_count, nullptr);
+    lock_guard<mutex> lock(m_frame_mutex);
+    m_frame = move(frame);
     return true;
 }
 
-void runtime::interpreter::INTExecutable::generate_calls(const element::Type& type,
-                                                         const NodeWrapper& op,
-                                                         const vector<shared_ptr<HostTensor>>& out,
-                                                         const vector<shared_ptr<HostTensor>>& in)
+runtime::interpreter::INTExecutable::Kernel
+    runtime::interpreter::INTExecutable::make_kernel(const element::Type& type,
+                                                     const NodeWrapper& op)
 {
-    stringstream ss;
     switch (type.get_type_enum())
     {
-    case element::Type_t::boolean: op_engine<char>(op, out, in); break;
-    case element::Type_t::f32: op_engine<float>(op, out, in); break;
-    case element::Type_t::f64: op_engine<double>(op, out, in); break;
-    case element::Type_t::i8: op_engine<int8_t>(op, out, in); break;
-    case element::Type_t::i16: op_engine<int16_t>(op, out, in); break;
-    case element::Type_t::i32: op_engine<int32_t>(op, out, in); break;
-    case element::Type_t::i64: op_engine<int64_t>(op, out, in); break;
-    case element::Type_t::u8: op_engine<uint8_t>(op, out, in); break;
-    case element::Type_t::u16: op_engine<uint16_t>(op, out, in); break;
-    case element::Type_t::u32: op_engine<uint32_t>(op, out, in); break;
-    case element::Type_t::u64: op_engine<uint64_t>(op, out, in); break;
+    case element::Type_t::boolean: return make_kernel<char>(op);
+    case element::Type_t::f32: return make_kernel<float>(op);
+    case element::Type_t::f64: return make_kernel<double>(op);
+    case element::Type_t::i8: return make_kernel<int8_t>(op);
+    case element::Type_t::i16: return make_kernel<int16_t>(op);
+    case element::Type_t::i32: return make_kernel<int32_t>(op);
+    case element::Type_t::i64: return make_kernel<int64_t>(op);
+    case element::Type_t::u8: return make_kernel<uint8_t>(op);
+    case element::Type_t::u16: return make_kernel<uint16_t>(op);
+    case element::Type_t::u32: return make_kernel<uint32_t>(op);
+    case element::Type_t::u64: return make_kernel<uint64_t>(op);
     case element::Type_t::undefined:
     case element::Type_t::dynamic:
     case element::Type_t::bf16:
-    case element::Type_t::f16:
-        ss << "unsupported element type " << type << " op " << op.get_node()->get_name();
-        throw ngraph_error(ss.str());
+    case element::Type_t::f16: break;
     }
+    // Functions with unsupported element types still compile, and fail when they are called
+    stringstream ss;
+    ss << "unsupported element type " << type << " op " << op.get_node()->get_name();
+    string message = ss.str();
+    return [message](const vector<shared_ptr<HostTensor>>&, const vector<shared_ptr<HostTensor>>&) {
+        throw ngraph_error(message);
+    };
 }
 
 void runtime::interpreter::INTExecutable::set_nan_check(bool enable)
@@ -16,8 +16,11 @@
 
 #pragma once
 
+#include <functional>
+#include <future>
 #include <initializer_list>
 #include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -37,6 +40,7 @@
 #include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/experimental/batch_mat_mul.hpp"
 #include "ngraph/op/experimental/dyn_broadcast.hpp"
+#include "ngraph/op/experimental/dropout.hpp"
 #include "ngraph/op/experimental/dyn_pad.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
 #include "ngraph/op/experimental/shape_of.hpp"
@@ -51,11 +55,13 @@
 #include "ngraph/op/passthrough.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
+#include "ngraph/op/recv.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/result.hpp"
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
+#include "ngraph/op/send.hpp"
 #include "ngraph/op/slice.hpp"
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/op/sum.hpp"
@@ -69,6 +75,7 @@
 #include "ngraph/runtime/reference/acos.hpp"
 #include "ngraph/runtime/reference/add.hpp"
 #include "ngraph/runtime/reference/all.hpp"
+#include "ngraph/runtime/reference/allgather.hpp"
 #include "ngraph/runtime/reference/allreduce.hpp"
 #include "ngraph/runtime/reference/and.hpp"
 #include "ngraph/runtime/reference/any.hpp"
@@ -92,6 +99,7 @@
 #include "ngraph/runtime/reference/dequantize.hpp"
 #include "ngraph/runtime/reference/divide.hpp"
 #include "ngraph/runtime/reference/dot.hpp"
+#include "ngraph/runtime/reference/dropout.hpp"
 #include "ngraph/runtime/reference/embedding_lookup.hpp"
 #include "ngraph/runtime/reference/equal.hpp"
 #include "ngraph/runtime/reference/erf.hpp"
@@ -121,6 +129,8 @@
 #include "ngraph/runtime/reference/power.hpp"
 #include "ngraph/runtime/reference/product.hpp"
 #include "ngraph/runtime/reference/quantize.hpp"
+#include "ngraph/runtime/reference/recv.hpp"
+#include "ngraph/runtime/reference/reducescatter.hpp"
 #include "ngraph/runtime/reference/relu.hpp"
 #include "ngraph/runtime/reference/replace_slice.hpp"
 #include "ngraph/runtime/reference/reshape.hpp"
@@ -128,6 +138,7 @@
 #include "ngraph/runtime/reference/reverse.hpp"
 #include "ngraph/runtime/reference/reverse_sequence.hpp"
 #include "ngraph/runtime/reference/select.hpp"
+#include "ngraph/runtime/reference/send.hpp"
 #include "ngraph/runtime/reference/shape_of.hpp"
 #include "ngraph/runtime/reference/sigmoid.hpp"
 #include "ngraph/runtime/reference/sign.hpp"
@@ -152,6 +163,7 @@ namespace ngraph
         {
             class INTBackend;
             class INTExecutable;
+            class ThreadPool;
         } // namespace interpreter
     }     // namespace runtime
 } // namespace ngraph
@@ -167,25 +179,381 @@ public:
 
     void set_nan_check(bool enable);
 
+    void update_constants(const std::map<const op::Constant*, const void*>& values) override;
+
     std::vector<PerformanceCounter> get_performance_data() const override;
 
 private:
+    /// \brief The reference kernel of one op, specialized for its element type
+    using Kernel = std::function<void(const std::vector<std::shared_ptr<HostTensor>>& out,
+                                      const std::vector<std::shared_ptr<HostTensor>>& args)>;
+
+    /// \brief A kernel that computes the rows [begin, end) of its output
+    using SplitKernel = std::function<void(const std::vector<std::shared_ptr<HostTensor>>& out,
+                                           const std::vector<std::shared_ptr<HostTensor>>& args,
+                                           size_t begin,
+                                           size_t end)>;
+
+    /// \brief A kernel that only starts its work, the future is ready once it is done
+    using AsyncKernel =
+        std::function<std::future<bool>(const std::vector<std::shared_ptr<HostTensor>>& out,
+                                        const std::vector<std::shared_ptr<HostTensor>>& args)>;
+
+    /// \brief An op to run, with its kernel and the slots of its input and output tensors
+    struct Step
+    {
+        const NodeWrapper* wrapped;
+        Kernel kernel;
+        std::vector<size_t> inputs;
+        std::vector<size_t> outputs;
+        // Set for FunctionCall, whose backend runs while the following steps do
+        AsyncKernel async_kernel;
+        size_t async_index = 0;
+        // The async steps, by async_index, whose outputs this step reads
+        std::vector<size_t> waits;
+    };
+
+    /// \brief An intermediate tensor and where it lives in the arena
+    struct ArenaTensor
+    {
+        size_t slot;
+        size_t offset;
+        const descriptor::Tensor* tensor;
+    };
+
+    /// \brief The tensors of one call, indexed by slot. Intermediate tensors are views into
+    ///        one arena laid out by pass::MemoryLayout; the other slots are bound on each call.
+    struct CallFrame
+    {
+        std::unique_ptr<AlignedBuffer> arena;
+        std::vector<std::shared_ptr<HostTensor>> tensors;
+    };
+
+    void build_plan(Function& function);
+    void build_levels();
+    std::unique_ptr<CallFrame> make_call_frame() const;
+    void bind_constant(size_t index);
+    void run_step(const Step& step,
+                  const std::vector<std::shared_ptr<HostTensor>>& tensors,
+                  std::vector<std::shared_ptr<HostTensor>>& op_inputs,
+                  std::vector<std::shared_ptr<HostTensor>>& op_outputs);
+    void run_plan(const std::vector<std::shared_ptr<HostTensor>>& tensors);
+    std::future<bool> start_step(const Step& step,
+                                 const std::vector<std::shared_ptr<HostTensor>>& tensors);
+    void finish_step(const Step& step,
+                     const std::vector<std::shared_ptr<HostTensor>>& tensors,
+                     std::future<bool>& done);
+    static AsyncKernel make_function_call(const Node& node);
+    /// \brief Makes the kernel of an If or a Loop. The bodies are compiled once into
+    ///        executables that every call of the kernel reuses.
+    static Kernel make_control_flow_kernel(const Node& node);
+
     int get_alignment() const { return 64; }
+    // Elementwise kernels smaller than this are not split across threads
+    static const size_t s_min_split_elements = 1 << 14;
     bool m_is_compiled = false;
     bool m_nan_check_enabled = false;
     bool m_performance_counters_enabled = false;
     std::unordered_map<std::shared_ptr<const Node>, stopwatch> m_timer_map;
     std::vector<NodeWrapper> m_wrapped_nodes;
+
+    // The outputs of the parameters take the first slots, in the order of the call's inputs,
+    // and the results the next ones
+    std::vector<Step> m_plan;
+    size_t m_input_count = 0;
+    size_t m_output_count = 0;
+    size_t m_slot_count = 0;
+    size_t m_arena_size = 0;
+    std::vector<ArenaTensor> m_arena_tensors;
+    std::vector<const op::Constant*> m_constants;
+    std::vector<size_t> m_constant_slots;
+    std::vector<std::shared_ptr<HostTensor>> m_constant_tensors;
+    // Set when NGRAPH_INTERPRETER_THREADS asks for threads. The steps of each level are then
+    // run concurrently, and large kernels are split across the pool.
+    ThreadPool* m_thread_pool = nullptr;
+    std::vector<std::vector<size_t>> m_levels;
+    // The steps with an async_kernel, by async_index
+    size_t m_async_count = 0;
+    std::vector<const Step*> m_async_steps;
+    // The frame of the last call is reused unless another call is using it
+    std::mutex m_frame_mutex;
+    std::unique_ptr<CallFrame> m_frame;
     std::unordered_map<const Node*, std::shared_ptr<RNGState>> m_states;
     std::set<std::string> m_unsupported_op_name_list;
 
     static void perform_nan_check(const std::vector<std::shared_ptr<HostTensor>>&,
                                   const Node* op = nullptr);
 
-    void generate_calls(const element::Type& type,
-                        const NodeWrapper& op,
-                        const std::vector<std::shared_ptr<HostTensor>>& outputs,
-                        const std::vector<std::shared_ptr<HostTensor>>& inputs);
+    Kernel make_kernel(const element::Type& type, const NodeWrapper& op);
+
+    /// \brief Makes a kernel that runs kernel(begin, end) over [0, rows), split into chunks
+    ///        of at least min_rows rows across the thread pool if there is one. Every output
+    ///        element is computed by exactly one chunk, so results do not depend on the split.
+    Kernel make_split_kernel(size_t rows, size_t min_rows, const SplitKernel& kernel);
+
+    template <typename T>
+    Kernel make_unary_kernel(void (*kernel)(const T*, T*, size_t), size_t element_count)
+    {
+        return make_split_kernel(
+            element_count,
+            s_min_split_elements,
+            [kernel](const std::vector<std::shared_ptr<HostTensor>>& out,
+                     const std::vector<std::shared_ptr<HostTensor>>& args,
+                     size_t begin,
+                     size_t end) {
+                kernel(args[0]->get_data_ptr<const T>() + begin,
+                       out[0]->get_data_ptr<T>() + begin,
+                       end - begin);
+            });
+    }
+
+    template <typename T>
+    Kernel make_binary_kernel(void (*kernel)(const T*, const T*, T*, size_t),
+                              size_t element_count)
+    {
+        return make_split_kernel(
+            element_count,
+            s_min_split_elements,
+            [kernel](const std::vector<std::shared_ptr<HostTensor>>& out,
+                     const std::vector<std::shared_ptr<HostTensor>>& args,
+                     size_t begin,
+                     size_t end) {
+                kernel(args[0]->get_data_ptr<const T>() + begin,
+                       args[1]->get_data_ptr<const T>() + begin,
+                       out[0]->get_data_ptr<T>() + begin,
+                       end - begin);
+            });
+    }
+
+    // Kernels that split Dot, Sum and Convolution along the first axis of their output. Ops
+    // that can not be split that way return an empty Kernel and run through op_engine.
+    template <typename T>
+    Kernel make_row_split_kernel(const NodeWrapper& node_wrapper)
+    {
+        const Node& node = *node_wrapper.get_node();
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+        switch (node_wrapper.get_typeid())
+        {
+        case OP_TYPEID::Convolution:
+        {
+            const op::Convolution* c = static_cast<const op::Convolution*>(&node);
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            if (shape_size(arg0_shape) == 0 || shape_size(out_shape) == 0)
+            {
+                break;
+            }
+            size_t arg0_row = shape_size(arg0_shape) / arg0_shape[0];
+            size_t out_row = shape_size(out_shape) / out_shape[0];
+            Strides window_movement_strides = c->get_window_movement_strides();
+            Strides window_dilation_strides = c->get_window_dilation_strides();
+            CoordinateDiff padding_below = c->get_padding_below();
+            CoordinateDiff padding_above = c->get_padding_above();
+            Strides data_dilation_strides = c->get_data_dilation_strides();
+            return make_split_kernel(
+                arg0_shape[0],
+                1,
+                [=](const std::vector<std::shared_ptr<HostTensor>>& out,
+                    const std::vector<std::shared_ptr<HostTensor>>& args,
+                    size_t begin,
+                    size_t end) {
+                    Shape arg0_rows = arg0_shape;
+                    arg0_rows[0] = end - begin;
+                    Shape out_rows = out_shape;
+                    out_rows[0] = end - begin;
+                    reference::convolution<T>(args[0]->get_data_ptr<const T>() + begin * arg0_row,
+                                              args[1]->get_data_ptr<const T>(),
+                                              out[0]->get_data_ptr<T>() + begin * out_row,
+                                              arg0_rows,
+                                              arg1_shape,
+                                              out_rows,
+                                              window_movement_strides,
+                                              window_dilation_strides,
+                                              padding_below,
+                                              padding_above,
+                                              data_dilation_strides);
+                });
+        }
+        case OP_TYPEID::Dot:
+        {
+            const op::Dot* dot = static_cast<const op::Dot*>(&node);
+            Shape arg0_shape = node.get_input_shape(0);
+            Shape arg1_shape = node.get_input_shape(1);
+            Shape out_shape = node.get_output_shape(0);
+            size_t reduction_axes_count = dot->get_reduction_axes_count();
+            if (arg0_shape.size() <= reduction_axes_count || shape_size(arg0_shape) == 0 ||
+                shape_size(out_shape) == 0)
+            {
+                break;
+            }
+            size_t arg0_row = shape_size(arg0_shape) / arg0_shape[0];
+            size_t out_row = shape_size(out_shape) / out_shape[0];
+            return make_split_kernel(
+                arg0_shape[0],
+                1,
+                [=](const std::vector<std::shared_ptr<HostTensor>>& out,
+                    const std::vector<std::shared_ptr<HostTensor>>& args,
+                    size_t begin,
+                    size_t end) {
+                    Shape arg0_rows = arg0_shape;
+                    arg0_rows[0] = end - begin;
+                    Shape out_rows = out_shape;
+                    out_rows[0] = end - begin;
+                    reference::dot(args[0]->get_data_ptr<const T>() + begin * arg0_row,
+                                   args[1]->get_data_ptr<const T>(),
+                                   out[0]->get_data_ptr<T>() + begin * out_row,
+                                   arg0_rows,
+                                   arg1_shape,
+                                   out_rows,
+                                   reduction_axes_count);
+                });
+        }
+        case OP_TYPEID::Sum:
+        {
+            const op::Sum* sum = static_cast<const op::Sum*>(&node);
+            Shape arg_shape = node.get_input_shape(0);
+            Shape out_shape = node.get_output_shape(0);
+            AxisSet reduction_axes = sum->get_reduction_axes();
+            if (arg_shape.empty() || reduction_axes.count(0) != 0 || shape_size(arg_shape) == 0)
+            {
+                break;
+            }
+            size_t arg_row = shape_size(arg_shape) / arg_shape[0];
+            size_t out_row = shape_size(out_shape) / out_shape[0];
+            return make_split_kernel(
+                arg_shape[0],
+                std::max<size_t>(1, s_min_split_elements / arg_row),
+                [=](const std::vector<std::shared_ptr<HostTensor>>& out,
+                    const std::vector<std::shared_ptr<HostTensor>>& args,
+                    size_t begin,
+                    size_t end) {
+                    Shape arg_rows = arg_shape;
+                    arg_rows[0] = end - begin;
+                    Shape out_rows = out_shape;
+                    out_rows[0] = end - begin;
+                    reference::sum<T>(args[0]->get_data_ptr<const T>() + begin * arg_row,
+                                      out[0]->get_data_ptr<T>() + begin * out_row,
+                                      arg_rows,
+                                      out_rows,
+                                      reduction_axes);
+                });
+        }
+        default: break;
+        }
+#pragma GCC diagnostic pop
+        return Kernel();
+    }
+
+    // The most common elementwise ops get kernels that call the reference implementation
+    // directly with their element count; every other op goes through op_engine
+    template <typename T>
+    Kernel make_kernel(const NodeWrapper& node_wrapper)
+    {
+        const Node& node = *node_wrapper.get_node();
+        if (m_thread_pool)
+        {
+            if (Kernel kernel = make_row_split_kernel<T>(node_wrapper))
+            {
+                return kernel;
+            }
+        }
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wswitch-enum"
+        switch (node_wrapper.get_typeid())
+        {
+        case OP_TYPEID::Abs:
+            return make_unary_kernel<T>(reference::abs<T>, shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Add:
+            return make_binary_kernel<T>(reference::add<T>, shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Exp:
+            return make_unary_kernel<T>(reference::exp<T>, shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Log:
+            return make_unary_kernel<T>(reference::log<T>, shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Maximum:
+            return make_binary_kernel<T>(reference::maximum<T>,
+                                         shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Minimum:
+            return make_binary_kernel<T>(reference::minimum<T>,
+                                         shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Multiply:
+            return make_binary_kernel<T>(reference::multiply<T>,
+                                         shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Negative:
+            return make_unary_kernel<T>(reference::negate<T>,
+                                        shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Relu:
+            return make_unary_kernel<T>(reference::relu<T>, shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Result:
+            return make_unary_kernel<T>(reference::result<T>,
+                                        shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Sigmoid:
+            return make_unary_kernel<T>(reference::sigmoid<T>,
+                                        shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Sqrt:
+            return make_unary_kernel<T>(reference::sqrt<T>, shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Subtract:
+            return make_binary_kernel<T>(reference::subtract<T>,
+                                         shape_size(node.get_output_shape(0)));
+        case OP_TYPEID::Tanh:
+            return make_unary_kernel<T>(reference::tanh<T>, shape_size(node.get_output_shape(0)));
+        default:
+        {
+            const NodeWrapper* wrapped = &node_wrapper;
+            return [this, wrapped](const std::vector<std::shared_ptr<HostTensor>>& out,
+                                   const std::vector<std::shared_ptr<HostTensor>>& args) {
+                op_engine<T>(*wrapped, out, args);
+            };
+        }
+        }
+#pragma GCC diagnostic pop
+    }
+
+    // Lookup in quantized weights stored as Q
+    template <typename T, typename Q, typename U>
+    static void embedding_dequantize(const U* indices,
+                                     const op::EmbeddingLookup& embed,
+                                     const std::vector<std::shared_ptr<HostTensor>>& out,
+                                     const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
+        reference::embedding_dequantize<T, Q, U>(indices,
+                                                 args[1]->get_data_ptr<const Q>(),
+                                                 args[2]->get_data_ptr<const T>(),
+                                                 args[3]->get_data_ptr<const T>(),
+                                                 out[0]->get_data_ptr<T>(),
+                                                 shape_size(embed.get_input_shape(0)),
+                                                 embed.get_input_shape(1).at(1));
+    }
+
+    template <typename T, typename Q>
+    static void embedding_dequantize(const op::EmbeddingLookup& embed,
+                                     const std::vector<std::shared_ptr<HostTensor>>& out,
+                                     const std::vector<std::shared_ptr<HostTensor>>& args)
+    {
+        auto type = embed.get_input_element_type(0);
+        if (type == element::f32)
+        {
+            embedding_dequantize<T, Q>(args[0]->get_data_ptr<const float>(), embed, out, args);
+        }
+        else if (type == element::f64)
+        {
+            embedding_dequantize<T, Q>(args[0]->get_data_ptr<const double>(), embed, out, args);
+        }
+        else if (type == element::i32)
+        {
+            embedding_dequantize<T, Q>(args[0]->get_data_ptr<const int>(), embed, out, args);
+        }
+        else if (type == element::i64)
+        {
+            embedding_dequantize<T, Q>(args[0]->get_data_ptr<const int64_t>(), embed, out, args);
+        }
+        else
+        {
+            throw ngraph_error(std::string("Unsupported index type ") + type.c_type_string() +
+                               std::string("in EmbeddingLookup"));
+        }
+    }
 
     template <typename T>
     void op_engine(const NodeWrapper& node_wrapper,
@@ -236,6 +604,14 @@ private:
                            all->get_reduction_axes());
             break;
         }
+        case OP_TYPEID::AllGather:
+        {
+            reference::allgather<T>(args[0]->get_data_ptr<T>(),
+                                    out[0]->get_data_ptr<T>(),
+                                    node.get_input_element_type(0).get_type_enum(),
+                                    static_cast<int>(shape_size(node.get_input_shape(0))));
+            break;
+        }
         case OP_TYPEID::AllReduce:
         {
             reference::allreduce<T>(args[0]->get_data_ptr<T>(),
@@ -700,6 +1076,51 @@ private:
                            dot->get_reduction_axes_count());
             break;
         }
+        case OP_TYPEID::Dropout:
+        {
+            if (m_states.count(&node) == 0)
+            {
+                const op::Dropout* dropout = static_cast<const op::Dropout*>(&node);
+                m_states[&node] = std::unique_ptr<ngraph::RNGState>(
+                    ngraph::RNGState::create_rng_state(dropout->get_seed(),
+                                                       dropout->get_keep_probability()));
+            }
+
+            bool training = static_cast<bool>(args[1]->get_data_ptr<const T>()[0]);
+            auto state = m_states.at(&node).get();
+            size_t element_count = shape_size(node.get_output_shape(0));
+            uint64_t base = training ? state->reserve(element_count) : 0;
+            reference::dropout<T>(args[0]->get_data_ptr<const T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  element_count,
+                                  state,
+                                  base,
+                                  training);
+            out[1]->get_data_ptr<uint64_t>()[0] = base;
+            break;
+        }
+        case OP_TYPEID::DropoutBackprop:
+        {
+            if (m_states.count(&node) == 0)
+            {
+                const op::DropoutBackprop* dropout = static_cast<const op::DropoutBackprop*>(&node);
+                m_states[&node] = std::unique_ptr<ngraph::RNGState>(
+                    ngraph::RNGState::create_rng_state(dropout->get_seed(),
+                                                       dropout->get_keep_probability()));
+            }
+
+            bool training = static_cast<bool>(args[1]->get_data_ptr<const T>()[0]);
+            uint64_t base = args[2]->get_data_ptr<const uint64_t>()[0];
+            size_t element_count = shape_size(node.get_output_shape(0));
+            auto state = m_states.at(&node).get();
+            reference::dropout<T>(args[0]->get_data_ptr<const T>(),
+                                  out[0]->get_data_ptr<T>(),
+                                  element_count,
+                                  state,
+                                  base,
+                                  training);
+            break;
+        }
         case OP_TYPEID::DynReshape:
         {
             throw unsupported_op("Unsupported op '" + node.description() + "'");
@@ -716,7 +1137,23 @@ private:
             auto type = embed->get_argument(0)->get_element_type();
             size_t element_count = shape_size(embed->get_argument(0)->get_shape());
 
-            if (type == element::f32)
+            if (embed->is_quantized())
+            {
+                auto weights_type = embed->get_input_element_type(1);
+                if (weights_type == element::i8)
+                {
+                    embedding_dequantize<T, int8_t>(*embed, out, args);
+                }
+                else if (weights_type == element::u8)
+                {
+                    embedding_dequantize<T, uint8_t>(*embed, out, args);
+                }
+                else
+                {
+                    embedding_dequantize<T, float16>(*embed, out, args);
+                }
+            }
+            else if (type == element::f32)
             {
                 reference::embedding<T, float>(args[0]->get_data_ptr<const float>(),
                                                args[1]->get_data_ptr<const T>(),
@@ -755,6 +1192,52 @@ private:
             }
             break;
         }
+        case OP_TYPEID::EmbeddingLookupBackprop:
+        {
+            const op::EmbeddingLookupBackprop* embed =
+                static_cast<const op::EmbeddingLookupBackprop*>(&node);
+            auto type = embed->get_argument(0)->get_element_type();
+            size_t element_count = shape_size(embed->get_argument(0)->get_shape());
+
+            if (type == element::f32)
+            {
+                reference::embedding_backprop<T, float>(args[0]->get_data_ptr<const float>(),
+                                                        args[1]->get_data_ptr<const T>(),
+                                                        out[0]->get_data_ptr<T>(),
+                                                        element_count,
+                                                        embed->get_weights_shape());
+            }
+            else if (type == element::f64)
+            {
+                reference::embedding_backprop<T, double>(args[0]->get_data_ptr<const double>(),
+                                                         args[1]->get_data_ptr<const T>(),
+                                                         out[0]->get_data_ptr<T>(),
+                                                         element_count,
+                                                         embed->get_weights_shape());
+            }
+            else if (type == element::i32)
+            {
+                reference::embedding_backprop<T, int>(args[0]->get_data_ptr<const int>(),
+                                                      args[1]->get_data_ptr<const T>(),
+                                                      out[0]->get_data_ptr<T>(),
+                                                      element_count,
+                                                      embed->get_weights_shape());
+            }
+            else if (type == element::i64)
+            {
+                reference::embedding_backprop<T, int64_t>(args[0]->get_data_ptr<const int64_t>(),
+                                                          args[1]->get_data_ptr<const T>(),
+                                                          out[0]->get_data_ptr<T>(),
+                                                          element_count,
+                                                          embed->get_weights_shape());
+            }
+            else
+            {
+                throw ngraph_error(std::string("Unsupported index type ") + type.c_type_string() +
+                                   std::string("in EmbeddingLookupBackprop"));
+            }
+            break;
+        }
         case OP_TYPEID::Equal:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -780,25 +1263,7 @@ private:
         }
         case OP_TYPEID::FunctionCall:
         {
-            auto f = static_cast<const runtime::hybrid::op::FunctionCall*>(&node);
-            auto backend = f->get_backend();
-            auto executable = f->get_executable();
-
-            std::vector<std::shared_ptr<Tensor>> outputs;
-            std::vector<std::shared_ptr<Tensor>> inputs;
-            for (const std::shared_ptr<HostTensor>& t : out)
-            {
-                auto backend_tensor = backend->create_tensor(
-                    t->get_element_type(), t->get_shape(), t->get_data_ptr());
-                outputs.push_back(backend_tensor);
-            }
-            for (const std::shared_ptr<HostTensor>& t : args)
-            {
-                auto backend_tensor = backend->create_tensor(
-                    t->get_element_type(), t->get_shape(), t->get_data_ptr());
-                inputs.push_back(backend_tensor);
-            }
-            executable->call(outputs, inputs);
+            make_function_call(node)(out, args).get();
             break;
         }
         case OP_TYPEID::Floor:
@@ -881,6 +1346,12 @@ private:
                                      element_count);
             break;
         }
+        case OP_TYPEID::If:
+        case OP_TYPEID::Loop:
+        {
+            // the plan runs these with the kernel of make_control_flow_kernel
+            throw ngraph_error(node.description() + " must run through its body executables");
+        }
         case OP_TYPEID::Less:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -1136,6 +1607,24 @@ private:
             throw unsupported_op("Unsupported op '" + node.description() +
                                  "' in Interpreter back end.");
         }
+        case OP_TYPEID::Recv:
+        {
+            const op::Recv* recv = static_cast<const op::Recv*>(&node);
+            reference::recv<T>(out[0]->get_data_ptr<T>(),
+                               node.get_output_element_type(0).get_type_enum(),
+                               shape_size(node.get_output_shape(0)),
+                               recv->get_src_rank(),
+                               recv->get_tag());
+            break;
+        }
+        case OP_TYPEID::ReduceScatter:
+        {
+            reference::reducescatter<T>(args[0]->get_data_ptr<T>(),
+                                        out[0]->get_data_ptr<T>(),
+                                        node.get_input_element_type(0).get_type_enum(),
+                                        static_cast<int>(shape_size(node.get_output_shape(0))));
+            break;
+        }
         case OP_TYPEID::Relu:
         {
             size_t element_count = shape_size(node.get_output_shape(0));
@@ -1222,6 +1711,17 @@ private:
                                  element_count);
             break;
         }
+        case OP_TYPEID::Send:
+        {
+            const op::Send* send = static_cast<const op::Send*>(&node);
+            reference::send<T>(args[0]->get_data_ptr<const T>(),
+                               out[0]->get_data_ptr<T>(),
+                               node.get_input_element_type(0).get_type_enum(),
+                               shape_size(node.get_input_shape(0)),
+                               send->get_dest_rank(),
+                               send->get_tag());
+            break;
+        }
         case OP_TYPEID::ShapeOf:
         {
             reference::shape_of(node.get_input_shape(0), out[0]->get_data_ptr<uint64_t>());
@@ -0,0 +1,142 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstdlib>
+
+#include "ngraph/runtime/interpreter/int_thread_pool.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Set on the pool's workers and while the calling thread runs tasks, so nested parallel_for
+// calls run serially instead of waiting for busy workers
+static thread_local bool t_running_task = false;
+
+runtime::interpreter::ThreadPool& runtime::interpreter::ThreadPool::get()
+{
+    static ThreadPool pool([]() {
+        const char* env_threads = getenv("NGRAPH_INTERPRETER_THREADS");
+        return env_threads != nullptr && atoi(env_threads) > 1
+                   ? static_cast<size_t>(atoi(env_threads))
+                   : size_t{1};
+    }());
+    return pool;
+}
+
+runtime::interpreter::ThreadPool::ThreadPool(size_t thread_count)
+{
+    for (size_t i = 1; i < thread_count; i++)
+    {
+        m_workers.emplace_back(&ThreadPool::work, this);
+    }
+}
+
+runtime::interpreter::ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_work_cv.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+void runtime::interpreter::ThreadPool::parallel_for(size_t count, const function<void(size_t)>& f)
+{
+    unique_lock<mutex> submit_lock(m_submit_mutex, defer_lock);
+    if (count < 2 || m_workers.empty() || t_running_task || !submit_lock.try_lock())
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            f(i);
+        }
+        return;
+    }
+
+    vector<exception_ptr> errors(count);
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_task = &f;
+        m_count = count;
+        m_next = 0;
+        m_errors = &errors;
+        m_active = m_workers.size();
+        m_generation++;
+    }
+    m_work_cv.notify_all();
+
+    t_running_task = true;
+    run_tasks();
+    t_running_task = false;
+    {
+        unique_lock<mutex> lock(m_mutex);
+        m_done_cv.wait(lock, [this]() { return m_active == 0; });
+        m_task = nullptr;
+        m_errors = nullptr;
+    }
+
+    for (const auto& error : errors)
+    {
+        if (error)
+        {
+            rethrow_exception(error);
+        }
+    }
+}
+
+void runtime::interpreter::ThreadPool::run_tasks()
+{
+    for (size_t index = m_next++; index < m_count; index = m_next++)
+    {
+        try
+        {
+            (*m_task)(index);
+        }
+        catch (...)
+        {
+            (*m_errors)[index] = current_exception();
+        }
+    }
+}
+
+void runtime::interpreter::ThreadPool::work()
+{
+    t_running_task = true;
+    size_t generation = 0;
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_work_cv.wait(lock, [&]() { return m_stop || m_generation != generation; });
+            if (m_stop)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+        run_tasks();
+        {
+            lock_guard<mutex> lock(m_mutex);
+            if (--m_active == 0)
+            {
+                m_done_cv.notify_one();
+            }
+        }
+    }
+}
@@ -0,0 +1,82 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace interpreter
+        {
+            class ThreadPool;
+        }
+    }
+}
+
+/// \brief Worker threads that run the tasks of one parallel_for at a time.
+///
+/// The interpreter is single-threaded unless NGRAPH_INTERPRETER_THREADS is set to more than
+/// one thread, in which case executables split large kernels across the shared pool and run
+/// independent ops concurrently.
+class ngraph::runtime::interpreter::ThreadPool
+{
+public:
+    /// \brief The pool shared by all interpreter executables
+    static ThreadPool& get();
+
+    /// \param thread_count The number of threads running tasks, including the thread that
+    ///        calls parallel_for
+    explicit ThreadPool(size_t thread_count);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    size_t get_thread_count() const { return m_workers.size() + 1; }
+    /// \brief Calls f(i) for every i in [0, count) and returns when all calls are done.
+    ///
+    /// Tasks run on the calling thread and the pool's workers. A parallel_for called from a
+    /// task, or while another thread's parallel_for is running, runs its tasks on the calling
+    /// thread. If tasks throw, the exception of the lowest index is rethrown.
+    void parallel_for(size_t count, const std::function<void(size_t)>& f);
+
+private:
+    void run_tasks();
+    void work();
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_submit_mutex;
+    std::mutex m_mutex;
+    std::condition_variable m_work_cv;
+    std::condition_variable m_done_cv;
+    bool m_stop = false;
+    size_t m_generation = 0;
+    size_t m_active = 0;
+    const std::function<void(size_t)>* m_task = nullptr;
+    size_t m_count = 0;
+    std::atomic<size_t> m_next{0};
+    std::vector<std::exception_ptr>* m_errors = nullptr;
+};
@@ -0,0 +1,223 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cstdlib>
+
+#include "ngraph/check.hpp"
+#include "ngraph/runtime/lazy/lazy_executable.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::lazy::LazyExecutable::LazyExecutable(shared_ptr<Function> function,
+                                              shared_ptr<Backend> backend,
+                                              CompilePriority priority,
+                                              bool enable_performance_collection)
+    : m_state(make_shared<State>())
+{
+    m_state->function = function;
+    m_state->backend = backend;
+    m_state->enable_performance_collection = enable_performance_collection;
+    set_parameters_and_results(*function);
+    LazyCompiler::get().submit(m_state, priority);
+}
+
+runtime::lazy::LazyExecutable::~LazyExecutable()
+{
+    shared_ptr<Executable> executable;
+    {
+        unique_lock<mutex> lock(m_state->mutex);
+        if (m_state->status == Status::QUEUED)
+        {
+            m_state->status = Status::CANCELLED;
+        }
+        // A compile in progress can not be interrupted
+        m_state->ready.wait(lock, [this]() { return m_state->status != Status::COMPILING; });
+        executable = m_state->executable;
+        m_state->executable = nullptr;
+    }
+    if (executable)
+    {
+        m_state->backend->remove_compiled_function(executable);
+    }
+}
+
+void runtime::lazy::LazyExecutable::compile(const shared_ptr<State>& state)
+{
+    {
+        lock_guard<mutex> lock(state->mutex);
+        if (state->status != Status::QUEUED)
+        {
+            return;
+        }
+        state->status = Status::COMPILING;
+    }
+
+    shared_ptr<Executable> executable;
+    exception_ptr error;
+    try
+    {
+        executable =
+            state->backend->compile(state->function, state->enable_performance_collection);
+        NGRAPH_CHECK(executable != nullptr, "Backend failed to compile the function");
+    }
+    catch (...)
+    {
+        error = current_exception();
+    }
+
+    {
+        lock_guard<mutex> lock(state->mutex);
+        state->executable = executable;
+        state->error = error;
+        state->status = error ? Status::FAILED : Status::READY;
+    }
+    state->ready.notify_all();
+}
+
+shared_ptr<runtime::Executable> runtime::lazy::LazyExecutable::get_executable() const
+{
+    // Compile here rather than wait if no compiler thread has taken the function yet
+    compile(m_state);
+
+    unique_lock<mutex> lock(m_state->mutex);
+    m_state->ready.wait(lock, [this]() {
+        return m_state->status == Status::READY || m_state->status == Status::FAILED;
+    });
+    if (m_state->error)
+    {
+        rethrow_exception(m_state->error);
+    }
+    return m_state->executable;
+}
+
+bool runtime::lazy::LazyExecutable::is_ready() const
+{
+    lock_guard<mutex> lock(m_state->mutex);
+    return m_state->status == Status::READY || m_state->status == Status::FAILED;
+}
+
+bool runtime::lazy::LazyExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                         const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    return get_executable()->call(outputs, inputs);
+}
+
+future<bool>
+    runtime::lazy::LazyExecutable::begin_call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                              const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    return get_executable()->begin_call(outputs, inputs);
+}
+
+vector<runtime::PerformanceCounter> runtime::lazy::LazyExecutable::get_performance_data() const
+{
+    return get_executable()->get_performance_data();
+}
+
+runtime::MemoryStatistics
+    runtime::lazy::LazyExecutable::get_memory_statistics(size_t top_tensors) const
+{
+    return get_executable()->get_memory_statistics(top_tensors);
+}
+
+void runtime::lazy::LazyExecutable::update_constants(
+    const map<const op::Constant*, const void*>& values)
+{
+    get_executable()->update_constants(values);
+}
+
+void runtime::lazy::LazyExecutable::save(ostream& output_stream)
+{
+    get_executable()->save(output_stream);
+}
+
+runtime::lazy::LazyCompiler& runtime::lazy::LazyCompiler::get()
+{
+    static LazyCompiler compiler;
+    return compiler;
+}
+
+runtime::lazy::LazyCompiler::LazyCompiler()
+    : m_num_threads(1)
+    , m_stop(false)
+{
+    const char* env_threads = getenv("NGRAPH_LAZY_COMPILE_THREADS");
+    if (env_threads != nullptr && atoi(env_threads) > 0)
+    {
+        m_num_threads = static_cast<size_t>(atoi(env_threads));
+    }
+}
+
+runtime::lazy::LazyCompiler::~LazyCompiler()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    for (auto& thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+size_t runtime::lazy::LazyCompiler::get_queue_size() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_interactive.size() + m_background.size();
+}
+
+void runtime::lazy::LazyCompiler::submit(const shared_ptr<LazyExecutable::State>& state,
+                                         CompilePriority priority)
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        if (m_threads.empty())
+        {
+            for (size_t i = 0; i < m_num_threads; i++)
+            {
+                m_threads.emplace_back(&LazyCompiler::work, this);
+            }
+        }
+        (priority == CompilePriority::INTERACTIVE ? m_interactive : m_background)
+            .push_back(state);
+    }
+    m_cv.notify_one();
+}
+
+void runtime::lazy::LazyCompiler::work()
+{
+    while (true)
+    {
+        shared_ptr<LazyExecutable::State> state;
+        {
+            unique_lock<mutex> lock(m_mutex);
+            m_cv.wait(lock, [this]() {
+                return m_stop || !m_interactive.empty() || !m_background.empty();
+            });
+            if (m_stop)
+            {
+                return;
+            }
+            auto& queue = m_interactive.empty() ? m_background : m_interactive;
+            state = queue.front();
+            queue.pop_front();
+        }
+        LazyExecutable::compile(state);
+    }
+}
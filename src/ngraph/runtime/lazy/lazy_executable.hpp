@@ -0,0 +1,159 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace lazy
+        {
+            enum class CompilePriority;
+            class LazyCompiler;
+            class LazyExecutable;
+        }
+    }
+}
+
+///
+/// \brief Order in which the background compiler prepares queued executables.
+///
+enum class ngraph::runtime::lazy::CompilePriority
+{
+    /// Compiled in the background after all queued interactive executables.
+    BACKGROUND,
+    /// Compiled before any queued background executable, e.g. for latency-sensitive models.
+    INTERACTIVE
+};
+
+///
+/// \brief Executable that returns from construction immediately and compiles its Function on
+///        a background compiler thread.
+///
+/// A call made before the background compile is done waits for it. If the executable is still
+/// queued at that point, the calling thread compiles it at once instead of waiting for a
+/// compiler thread. Compilation errors are rethrown by every call.
+///
+/// The Function must not be used by anything else until the executable is compiled, since
+/// backends may rewrite it during compilation.
+///
+class ngraph::runtime::lazy::LazyExecutable : public ngraph::runtime::Executable
+{
+public:
+    LazyExecutable(std::shared_ptr<Function> function,
+                   std::shared_ptr<Backend> backend,
+                   CompilePriority priority = CompilePriority::BACKGROUND,
+                   bool enable_performance_collection = false);
+    ~LazyExecutable() override;
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    std::future<bool>
+        begin_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    std::vector<PerformanceCounter> get_performance_data() const override;
+    MemoryStatistics get_memory_statistics(size_t top_tensors = 10) const override;
+    void update_constants(const std::map<const op::Constant*, const void*>& values) override;
+    void save(std::ostream& output_stream) override;
+
+    /// \brief True once the Function is compiled, or failed to compile.
+    bool is_ready() const;
+    /// \brief Waits for the Function to be compiled and returns the backend's executable.
+    /// \throws whatever the backend's compile threw
+    std::shared_ptr<Executable> get_executable() const;
+
+private:
+    friend class LazyCompiler;
+
+    enum class Status
+    {
+        QUEUED,
+        COMPILING,
+        READY,
+        FAILED,
+        // The executable was destroyed before a compiler thread took it
+        CANCELLED
+    };
+
+    // Shared with the compiler queue, which may outlive the executable
+    struct State
+    {
+        std::shared_ptr<Function> function;
+        std::shared_ptr<Backend> backend;
+        bool enable_performance_collection;
+        Status status = Status::QUEUED;
+        std::shared_ptr<Executable> executable;
+        std::exception_ptr error;
+        std::mutex mutex;
+        std::condition_variable ready;
+    };
+
+    // Compiles `state` unless another thread already took it
+    static void compile(const std::shared_ptr<State>& state);
+
+    std::shared_ptr<State> m_state;
+};
+
+///
+/// \brief Process-wide pool of threads compiling queued `LazyExecutable`s.
+///
+/// The number of threads is set by NGRAPH_LAZY_COMPILE_THREADS (default: 1). Threads are
+/// started on first use.
+///
+class ngraph::runtime::lazy::LazyCompiler
+{
+public:
+    static LazyCompiler& get();
+    ~LazyCompiler();
+
+    size_t get_num_threads() const { return m_num_threads; }
+    /// \brief Number of executables queued and not yet taken by a compiler thread.
+    size_t get_queue_size() const;
+
+private:
+    friend class LazyExecutable;
+
+    LazyCompiler();
+    void submit(const std::shared_ptr<LazyExecutable::State>& state, CompilePriority priority);
+    void work();
+
+    size_t m_num_threads;
+    std::deque<std::shared_ptr<LazyExecutable::State>> m_interactive;
+    std::deque<std::shared_ptr<LazyExecutable::State>> m_background;
+    bool m_stop;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<std::thread> m_threads;
+};
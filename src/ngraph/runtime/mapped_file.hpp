@@ -0,0 +1,49 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        class MappedFile;
+    }
+}
+
+/// \brief Maps a whole file into memory copy-on-write. Writes through get_ptr() are private to
+/// the process and never reach the file.
+class ngraph::runtime::MappedFile
+{
+public:
+    MappedFile(const std::string& path);
+    ~MappedFile();
+
+    size_t size() const { return m_byte_size; }
+    char* get_ptr(size_t offset) const { return m_data + offset; }
+    char* get_ptr() const { return m_data; }
+private:
+    MappedFile(const MappedFile&) = delete;
+    MappedFile(MappedFile&&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    char* m_data;
+    size_t m_byte_size;
+};
@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Placement of one tensor chosen by a backend's memory planner.
+        class TensorMemoryInfo
+        {
+        public:
+            std::string name;
+            size_t size;
+            /// Offset in the temporary pool; only meaningful if `temporary` is set
+            size_t pool_offset;
+            bool temporary;
+            /// Positions, in execution order, of the op producing the tensor and of its
+            /// last user
+            size_t first_use;
+            size_t last_use;
+        };
+
+        /// \brief Memory planned for a compiled Function.
+        class MemoryStatistics
+        {
+        public:
+            /// Size of the temporary pool allocated for each call
+            size_t temporary_bytes = 0;
+            /// Size of all constant data referenced by the Function
+            size_t constant_bytes = 0;
+            /// Bytes of tensors that share a buffer with another tensor rather than having
+            /// their own, from in-place ops and in-place memory optimizations
+            size_t in_place_bytes = 0;
+            /// Bytes of constant data removed by merging constants equal to another one
+            size_t deduplicated_constant_bytes = 0;
+            /// Bytes of temporary buffers and values computed from constants that are
+            /// currently allocated, over all the concurrent calls the Executable has run
+            size_t resident_bytes = 0;
+            /// Bytes freed so far by Executable::reclaim_memory and idle timeouts
+            size_t reclaimed_bytes = 0;
+            /// Largest tensors first
+            std::vector<TensorMemoryInfo> largest_tensors;
+        };
+    }
+}
@@ -14,6 +14,11 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <unordered_map>
+
 #include "ngraph/runtime/nop/nop_backend.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/except.hpp"
@@ -24,7 +29,9 @@
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/memory_layout.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
+#include "ngraph/runtime/op_cost.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -39,7 +46,7 @@ extern "C" runtime::BackendConstructor* get_backend_constructor_pointer()
     public:
         std::shared_ptr<runtime::Backend> create(const std::string& config) override
         {
-            return std::make_shared<runtime::nop::NOPBackend>();
+            return std::make_shared<runtime::nop::NOPBackend>(config);
         }
     };
 
@@ -48,6 +55,64 @@ extern "C" runtime::BackendConstructor* get_backend_constructor_pointer()
     return s_backend_constructor.get();
 }
 
+runtime::nop::SimulationConfig::SimulationConfig(const string& config)
+{
+    auto colon = config.find(':');
+    if (colon == string::npos)
+    {
+        return;
+    }
+    for (const string& attribute : split(config.substr(colon + 1), ',', true))
+    {
+        if (attribute.empty())
+        {
+            continue;
+        }
+        auto equals = attribute.find('=');
+        string key = attribute.substr(0, equals);
+        string value = equals == string::npos ? "" : attribute.substr(equals + 1);
+        if (key == "peak_gflops")
+        {
+            peak_gflops = stod(value);
+        }
+        else if (key == "peak_gbps")
+        {
+            peak_gbps = stod(value);
+        }
+        else if (key == "op_overhead_us")
+        {
+            op_overhead_us = stod(value);
+        }
+        else if (key == "alignment")
+        {
+            alignment = stoul(value);
+        }
+        else if (key != "simulate")
+        {
+            throw ngraph_error("Unknown NOP backend attribute '" + key + "'");
+        }
+        enabled = true;
+    }
+    if (peak_gflops <= 0 || peak_gbps <= 0 || alignment == 0)
+    {
+        throw ngraph_error("NOP backend peak rates and alignment must be positive");
+    }
+}
+
+double runtime::nop::SimulationConfig::estimate_microseconds(const Node& node) const
+{
+    OpCost cost = get_op_cost(node);
+    // GFLOP/s and GB/s are both 1e3 per microsecond
+    double compute_us = cost.flops / (peak_gflops * 1e3);
+    double memory_us = cost.bytes() / (peak_gbps * 1e3);
+    return std::max(compute_us, memory_us) + op_overhead_us;
+}
+
+runtime::nop::NOPBackend::NOPBackend(const string& config)
+    : m_simulation(config)
+{
+}
+
 shared_ptr<runtime::Tensor> runtime::nop::NOPBackend::create_tensor(const element::Type& type,
                                                                     const Shape& shape)
 {
@@ -65,21 +130,150 @@ shared_ptr<runtime::Executable>
     runtime::nop::NOPBackend::compile(shared_ptr<Function> function,
                                       bool enable_performance_collection)
 {
-    return make_shared<NOPExecutable>(function, enable_performance_collection);
+    return make_shared<NOPExecutable>(function, enable_performance_collection, m_simulation);
 }
 
 runtime::nop::NOPExecutable::NOPExecutable(shared_ptr<Function> function,
-                                           bool enable_performance_collection)
+                                           bool enable_performance_collection,
+                                           const SimulationConfig& simulation)
+    : m_simulate(simulation.enabled)
 {
     pass::Manager pass_manager;
     pass_manager.register_pass<pass::AssignLayout<DenseTensorLayout>>();
+    if (m_simulate)
+    {
+        pass_manager.register_pass<pass::Liveness>();
+        pass_manager.register_pass<pass::MemoryLayout>(simulation.alignment);
+    }
     pass_manager.run_passes(function);
 
+    if (m_simulate)
+    {
+        for (auto& node : function->get_ordered_ops())
+        {
+            if (node->is_op() && !node->is_parameter() && !node->is_constant() &&
+                !node->is_output() && node->description() != "GetOutputElement")
+            {
+                m_estimated_microseconds.emplace_back(node,
+                                                      simulation.estimate_microseconds(*node));
+            }
+        }
+        record_memory_statistics(*function);
+    }
+
     set_parameters_and_results(*function);
 }
 
 bool runtime::nop::NOPExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
                                        const vector<shared_ptr<runtime::Tensor>>& inputs)
 {
+    m_call_count++;
     return true;
 }
+
+vector<runtime::PerformanceCounter> runtime::nop::NOPExecutable::get_performance_data() const
+{
+    vector<runtime::PerformanceCounter> rc;
+    for (auto& estimate : m_estimated_microseconds)
+    {
+        size_t total = static_cast<size_t>(std::llround(estimate.second * m_call_count));
+        rc.emplace_back(estimate.first, total, m_call_count);
+    }
+    return rc;
+}
+
+double runtime::nop::NOPExecutable::get_estimated_microseconds() const
+{
+    double total = 0;
+    for (auto& estimate : m_estimated_microseconds)
+    {
+        total += estimate.second;
+    }
+    return total;
+}
+
+void runtime::nop::NOPExecutable::record_memory_statistics(Function& function)
+{
+    MemoryStatistics& stats = m_memory_statistics;
+    stats.temporary_bytes = function.get_temporary_pool_size();
+
+    // Tensors placed by MemoryLayout are the ones in some liveness_new_list
+    unordered_map<descriptor::Tensor*, pair<size_t, size_t>> live_ranges;
+    unordered_map<descriptor::Tensor*, bool> temporary;
+    size_t position = 0;
+    for (auto& node : function.get_ordered_ops())
+    {
+        for (auto& output : node->outputs())
+        {
+            descriptor::Tensor* tensor = &output.get_tensor();
+            live_ranges.insert({tensor, {position, position}});
+            temporary[tensor] = node->liveness_new_list.count(tensor) != 0;
+            if (node->is_constant())
+            {
+                stats.constant_bytes += tensor->size();
+            }
+        }
+        for (auto& input : node->inputs())
+        {
+            auto it = live_ranges.find(&input.get_tensor());
+            if (it != live_ranges.end())
+            {
+                it->second.second = position;
+            }
+        }
+        position++;
+    }
+
+    // A temporary placed at the offset of another temporary that is still live shares its
+    // buffer in place
+    map<size_t, vector<pair<size_t, descriptor::Tensor*>>> by_offset;
+    for (auto& ele : live_ranges)
+    {
+        if (temporary[ele.first])
+        {
+            by_offset[ele.first->get_pool_offset()].push_back({ele.second.first, ele.first});
+        }
+    }
+    for (auto& ele : by_offset)
+    {
+        auto& tensors = ele.second;
+        sort(tensors.begin(), tensors.end());
+        size_t live_until = live_ranges.at(tensors[0].second).second;
+        for (size_t i = 1; i < tensors.size(); i++)
+        {
+            if (tensors[i].first <= live_until)
+            {
+                stats.in_place_bytes += tensors[i].second->size();
+            }
+            live_until = std::max(live_until, live_ranges.at(tensors[i].second).second);
+        }
+    }
+
+    for (auto& ele : live_ranges)
+    {
+        descriptor::Tensor* tensor = ele.first;
+        bool is_temporary = temporary[tensor];
+        stats.largest_tensors.push_back({tensor->get_name(),
+                                         tensor->size(),
+                                         is_temporary ? tensor->get_pool_offset() : 0,
+                                         is_temporary,
+                                         ele.second.first,
+                                         ele.second.second});
+    }
+    sort(stats.largest_tensors.begin(),
+         stats.largest_tensors.end(),
+         [](const TensorMemoryInfo& a, const TensorMemoryInfo& b) {
+             return a.size != b.size ? a.size > b.size : a.name < b.name;
+         });
+}
+
+runtime::MemoryStatistics
+    runtime::nop::NOPExecutable::get_memory_statistics(size_t top_tensors) const
+{
+    MemoryStatistics stats = m_memory_statistics;
+    if (stats.largest_tensors.size() > top_tensors)
+    {
+        stats.largest_tensors.resize(top_tensors);
+    }
+    return stats;
+}
@@ -23,6 +23,8 @@
 
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/runtime/host_tensor.hpp"
+#include "ngraph/runtime/memory_statistics.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
 #include "ngraph/runtime/tensor.hpp"
 
 namespace ngraph
@@ -33,13 +35,39 @@ namespace ngraph
         {
             class NOPBackend;
             class NOPExecutable;
+            class SimulationConfig;
         }
     }
 }
 
+/// \brief Target hardware for the "NOP:simulate" mode.
+///
+/// Every op is given the roofline time max(flops / peak_gflops, bytes / peak_gbps) plus a
+/// fixed per-op overhead, using the shape inferred cost from \sa get_op_cost.
+class ngraph::runtime::nop::SimulationConfig
+{
+public:
+    /// \brief Parses the attributes of a backend config string, for example
+    ///        "NOP:simulate,peak_gflops=2000,peak_gbps=200,op_overhead_us=2,alignment=64".
+    ///        Anything after the colon enables simulation; unset attributes keep their
+    ///        defaults. Throws ngraph_error for unknown attributes.
+    SimulationConfig(const std::string& config);
+
+    bool enabled = false;
+    double peak_gflops = 1000;
+    double peak_gbps = 100;
+    double op_overhead_us = 0;
+    size_t alignment = 64;
+
+    /// Estimated time of one execution of `node`, in microseconds
+    double estimate_microseconds(const Node& node) const;
+};
+
 class ngraph::runtime::nop::NOPBackend : public Backend
 {
 public:
+    NOPBackend(const std::string& config = "NOP");
+
     std::shared_ptr<Tensor>
         create_tensor(const element::Type& type, const Shape& shape, void* memory_pointer) override;
 
@@ -47,12 +75,36 @@ public:
 
     std::shared_ptr<Executable> compile(std::shared_ptr<Function> function,
                                         bool enable_performance_data = false) override;
+
+private:
+    SimulationConfig m_simulation;
 };
 
 class ngraph::runtime::nop::NOPExecutable : public Executable
 {
 public:
-    NOPExecutable(std::shared_ptr<Function> function, bool enable_performance_collection = false);
+    NOPExecutable(std::shared_ptr<Function> function,
+                  bool enable_performance_collection = false,
+                  const SimulationConfig& simulation = SimulationConfig("NOP"));
     bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
               const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    /// \brief In simulate mode, the estimated time of every op multiplied by the number of
+    ///        calls made so far, whether or not performance collection was enabled. Totals
+    ///        are rounded to whole microseconds, see get_estimated_microseconds.
+    std::vector<PerformanceCounter> get_performance_data() const override;
+    /// \brief In simulate mode, the plan made by pass::MemoryLayout with the configured
+    ///        alignment; empty otherwise.
+    MemoryStatistics get_memory_statistics(size_t top_tensors = 10) const override;
+
+    /// Estimated time of one call, 0 unless in simulate mode
+    double get_estimated_microseconds() const;
+
+private:
+    void record_memory_statistics(Function& function);
+
+    bool m_simulate;
+    size_t m_call_count = 0;
+    std::vector<std::pair<std::shared_ptr<const Node>, double>> m_estimated_microseconds;
+    MemoryStatistics m_memory_statistics;
 };
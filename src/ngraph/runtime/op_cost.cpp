@@ -0,0 +1,131 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/runtime/op_cost.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/get_output_element.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/util/arithmetic_reduction.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static uint64_t tensor_bytes(const element::Type& type, const Shape& shape)
+{
+    return type.size() * shape_size(shape);
+}
+
+// Multiply-accumulates per output element of a convolution with these filters
+static uint64_t filter_macs(const Shape& filters)
+{
+    return filters.empty() || filters[0] == 0 ? 0 : shape_size(filters) / filters[0];
+}
+
+static uint64_t get_flops(const Node& node)
+{
+    const string& op = node.description();
+    const Shape& out = node.get_output_shape(0);
+    if (auto dot = dynamic_cast<const op::Dot*>(&node))
+    {
+        const Shape& arg0 = node.get_input_shape(0);
+        uint64_t reduction = 1;
+        for (size_t i = arg0.size() - dot->get_reduction_axes_count(); i < arg0.size(); i++)
+        {
+            reduction *= arg0[i];
+        }
+        return 2 * shape_size(out) * reduction;
+    }
+    if (op == "BatchMatMul" || op == "MatmulBias")
+    {
+        // [b, m, k] x [b, k, n], or [m, k] x [k, n] for MatmulBias, either possibly
+        // transposed; the first argument has m * k elements per batch whichever way round
+        return 2 * shape_size(node.get_input_shape(0)) * (out.empty() ? 0 : out.back());
+    }
+    if (op == "ConvolutionBackpropData")
+    {
+        // Inputs are the filters and the forward output delta
+        return 2 * shape_size(node.get_input_shape(1)) * filter_macs(node.get_input_shape(0));
+    }
+    if (op == "ConvolutionBackpropFilters" || op == "ConvolutionBiasBackpropFiltersBias")
+    {
+        // Inputs are the forward data and output delta, the output has the filter shape
+        return 2 * shape_size(node.get_input_shape(1)) * filter_macs(out);
+    }
+    if (op.find("Convolution") != string::npos && node.get_input_size() >= 2)
+    {
+        // Convolution, GroupConvolution and the fused ConvolutionBias, ConvolutionRelu...
+        // variants all take the data and then the filters
+        return 2 * shape_size(out) * filter_macs(node.get_input_shape(1));
+    }
+    if (auto pool = dynamic_cast<const op::AvgPool*>(&node))
+    {
+        return shape_size(out) * shape_size(pool->get_window_shape());
+    }
+    if (auto pool = dynamic_cast<const op::MaxPool*>(&node))
+    {
+        return shape_size(out) * shape_size(pool->get_window_shape());
+    }
+    if (op == "Softmax")
+    {
+        // exp, sum and divide per element
+        return 3 * shape_size(out);
+    }
+    if (dynamic_cast<const op::util::ArithmeticReduction*>(&node))
+    {
+        return shape_size(node.get_input_shape(0));
+    }
+    if (dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(&node) ||
+        dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(&node))
+    {
+        return shape_size(out);
+    }
+    return 0;
+}
+
+runtime::OpCost runtime::get_op_cost(const Node& node)
+{
+    OpCost cost;
+    if (node.is_parameter() || node.is_constant() || node.is_output() ||
+        dynamic_cast<const op::GetOutputElement*>(&node))
+    {
+        return cost;
+    }
+    for (auto& input : node.inputs())
+    {
+        if (!input.get_partial_shape().is_static() || !input.get_element_type().is_static())
+        {
+            return cost;
+        }
+        cost.input_bytes += tensor_bytes(input.get_element_type(), input.get_shape());
+    }
+    for (auto& output : node.outputs())
+    {
+        if (!output.get_partial_shape().is_static() || !output.get_element_type().is_static())
+        {
+            return OpCost();
+        }
+        cost.output_bytes += tensor_bytes(output.get_element_type(), output.get_shape());
+    }
+    if (node.get_output_size() > 0)
+    {
+        cost.flops = get_flops(node);
+    }
+    return cost;
+}
@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstdint>
+
+#include "ngraph/node.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        /// \brief Work done by one execution of an op, inferred from its shapes.
+        class OpCost
+        {
+        public:
+            /// Floating point (or integer arithmetic) operations; 0 for data movement ops
+            /// and ops without a model, see \sa get_op_cost
+            uint64_t flops = 0;
+            /// Bytes of all inputs read and outputs written, each counted once. Backend
+            /// scratch space is not visible from the graph and is not included.
+            uint64_t input_bytes = 0;
+            uint64_t output_bytes = 0;
+
+            uint64_t bytes() const { return input_bytes + output_bytes; }
+            /// FLOPs per byte moved, 0 if no bytes are moved
+            double arithmetic_intensity() const
+            {
+                return bytes() == 0 ? 0 : static_cast<double>(flops) / bytes();
+            }
+        };
+
+        /// \brief Shape inferred cost of `node`. FLOPs are modeled for Dot, BatchMatMul, the
+        /// Convolution family (including backend fused variants), pooling, Softmax,
+        /// arithmetic reductions and elementwise arithmetic. Nodes with dynamic shapes, and
+        /// parameters, constants, results and output selectors, cost nothing.
+        OpCost get_op_cost(const Node& node);
+    }
+}
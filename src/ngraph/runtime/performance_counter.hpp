@@ -17,9 +17,12 @@
 #pragma once
 
 #include <cstddef>
+#include <cstdint>
 #include <string>
+#include <unordered_set>
 
 #include "ngraph/node.hpp"
+#include "ngraph/runtime/op_cost.hpp"
 
 namespace ngraph
 {
@@ -32,18 +35,53 @@ namespace ngraph
                 : m_node(n)
                 , m_total_microseconds(us)
                 , m_call_count(calls)
+                , m_cost(n ? get_op_cost(*n) : OpCost())
             {
             }
             std::shared_ptr<const Node> get_node() const { return m_node; }
+            /// The provenance tags of the node, which name the framework nodes it was made from
+            /// when NGRAPH_PROVENANCE_ENABLE is set
+            std::unordered_set<std::string> get_provenance_tags() const
+            {
+                return m_node ? m_node->get_provenance_tags() : std::unordered_set<std::string>();
+            }
             size_t total_microseconds() const { return m_total_microseconds; }
             size_t microseconds() const
             {
                 return m_call_count == 0 ? 0 : m_total_microseconds / m_call_count;
             }
             size_t call_count() const { return m_call_count; }
+            /// Hardware counters summed over all calls, only collected by backends that support
+            /// them (see NGRAPH_CPU_HW_COUNTERS) and zero otherwise
+            bool has_hardware_counters() const { return m_has_hardware_counters; }
+            uint64_t total_cycles() const { return m_cycles; }
+            uint64_t total_instructions() const { return m_instructions; }
+            uint64_t total_llc_misses() const { return m_llc_misses; }
+            /// Memory traffic estimated as one 64 byte cache line per last level cache miss
+            uint64_t estimated_memory_bytes() const { return m_llc_misses * 64; }
+            /// Shape inferred FLOPs and bytes moved by one call, see \sa get_op_cost
+            const OpCost& get_cost() const { return m_cost; }
+            /// Achieved rates over all calls, 0 when no time was recorded
+            double gflops() const
+            {
+                return m_total_microseconds == 0
+                           ? 0
+                           : m_cost.flops * m_call_count / (m_total_microseconds * 1e3);
+            }
+            double gbytes_per_second() const
+            {
+                return m_total_microseconds == 0
+                           ? 0
+                           : m_cost.bytes() * m_call_count / (m_total_microseconds * 1e3);
+            }
             std::shared_ptr<const Node> m_node;
             size_t m_total_microseconds;
             size_t m_call_count;
+            bool m_has_hardware_counters = false;
+            uint64_t m_cycles = 0;
+            uint64_t m_instructions = 0;
+            uint64_t m_llc_misses = 0;
+            OpCost m_cost;
         };
     }
 }
@@ -0,0 +1,292 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <algorithm>
+#include <sstream>
+
+#include "ngraph/check.hpp"
+#include "ngraph/distributed.hpp"
+#include "ngraph/except.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/pipeline_placement.hpp"
+#include "ngraph/runtime/pipeline/pipeline_executable.hpp"
+#include "ngraph/specialize_shapes.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+// Parameters and results with a dynamic dimension 0 are split, or gathered, along it
+static bool is_batched(const PartialShape& shape)
+{
+    return shape.rank().is_static() && static_cast<size_t>(shape.rank()) > 0 &&
+           shape[0].is_dynamic();
+}
+
+template <typename T>
+static void sum_into(char* sum, const char* value, size_t size)
+{
+    T* s = reinterpret_cast<T*>(sum);
+    const T* v = reinterpret_cast<const T*>(value);
+    for (size_t i = 0; i < size / sizeof(T); i++)
+    {
+        s[i] += v[i];
+    }
+}
+
+runtime::pipeline::PipelineExecutable::PipelineExecutable(shared_ptr<Function> function,
+                                                          shared_ptr<Backend> backend,
+                                                          size_t micro_batch_count,
+                                                          bool enable_performance_collection)
+    : m_function(function)
+    , m_backend(backend)
+    , m_micro_batch_count(micro_batch_count)
+    , m_enable_performance_collection(enable_performance_collection)
+{
+    NGRAPH_CHECK(m_micro_batch_count > 0, "Pipeline execution needs at least one micro-batch");
+    auto distributed = get_distributed_interface();
+    m_stage = static_cast<size_t>(distributed->get_rank());
+    m_stage_count = static_cast<size_t>(max(distributed->get_size(), 1));
+
+    bool any_batched = false;
+    for (auto& parameter : function->get_parameters())
+    {
+        m_batched_parameters.push_back(is_batched(parameter->get_output_partial_shape(0)));
+        any_batched = any_batched || m_batched_parameters.back();
+    }
+    NGRAPH_CHECK(any_batched, "At least one parameter must have a dynamic batch axis");
+    for (auto& result : function->get_results())
+    {
+        m_batched_results.push_back(is_batched(result->get_output_partial_shape(0)));
+    }
+
+    set_parameters_and_results(*function);
+}
+
+runtime::pipeline::PipelineExecutable::~PipelineExecutable()
+{
+    for (auto& variant : m_variants)
+    {
+        if (variant.second.executable)
+        {
+            m_backend->remove_compiled_function(variant.second.executable);
+        }
+    }
+}
+
+runtime::pipeline::PipelineExecutable::Stage&
+    runtime::pipeline::PipelineExecutable::get_stage_variant(
+        const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    vector<Shape> key;
+    size_t batch_size = 0;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        key.push_back(inputs[i]->get_shape());
+        if (m_batched_parameters[i])
+        {
+            const Shape& shape = inputs[i]->get_shape();
+            NGRAPH_CHECK(shape.size() > 0, "Batched inputs must have a batch axis");
+            NGRAPH_CHECK(batch_size == 0 || batch_size == shape[0],
+                         "All batched inputs must have the same batch size");
+            batch_size = shape[0];
+        }
+    }
+    auto it = m_variants.find(key);
+    if (it != m_variants.end())
+    {
+        return it->second;
+    }
+    NGRAPH_CHECK(batch_size > 0 && batch_size % m_micro_batch_count == 0,
+                 "The batch size ",
+                 batch_size,
+                 " is not a multiple of the micro-batch count ",
+                 m_micro_batch_count);
+
+    Stage stage;
+    stage.micro_batch_size = batch_size / m_micro_batch_count;
+    vector<element::Type> arg_element_types;
+    vector<PartialShape> arg_shapes;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        Shape shape = inputs[i]->get_shape();
+        if (m_batched_parameters[i])
+        {
+            shape[0] = stage.micro_batch_size;
+        }
+        arg_element_types.push_back(inputs[i]->get_element_type());
+        arg_shapes.push_back(shape);
+    }
+
+    // Every process places the same specialized Function, so they agree on the stages
+    auto clone = specialize_shapes(m_function, arg_element_types, arg_shapes);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::PipelinePlacement>(m_stage_count);
+    pass_manager.run_passes(clone);
+
+    auto& results = clone->get_results();
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        if (results[i]->get_placement_index() == m_stage)
+        {
+            const Shape& shape = results[i]->get_shape();
+            NGRAPH_CHECK(!m_batched_results[i] || shape[0] == stage.micro_batch_size,
+                         "Batched results must have the batch size as dimension 0, got ",
+                         shape);
+            stage.result_indices.push_back(i);
+        }
+    }
+
+    auto stage_function = pass::PipelinePlacement::split_stage(clone, m_stage);
+    if (!stage_function->get_results().empty())
+    {
+        stage.executable = m_backend->compile(stage_function, m_enable_performance_collection);
+        for (size_t i = 0; i < arg_shapes.size(); i++)
+        {
+            stage.inputs.push_back(
+                m_backend->create_tensor(arg_element_types[i], arg_shapes[i].to_shape()));
+        }
+        for (auto& result : stage.executable->get_results())
+        {
+            stage.outputs.push_back(
+                m_backend->create_tensor(result->get_element_type(), result->get_shape()));
+        }
+    }
+    return m_variants.emplace(key, move(stage)).first->second;
+}
+
+bool runtime::pipeline::PipelineExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                                 const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == get_parameters().size(),
+                 "Call input count ",
+                 inputs.size(),
+                 " does not match Function's Parameter count ",
+                 get_parameters().size());
+    NGRAPH_CHECK(outputs.size() == get_results().size(),
+                 "Call output count ",
+                 outputs.size(),
+                 " does not match Function's Result count ",
+                 get_results().size());
+
+    Stage& stage = get_stage_variant(inputs);
+    if (!stage.executable)
+    {
+        return true;
+    }
+
+    vector<vector<char>> host_inputs(inputs.size());
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        host_inputs[i].resize(inputs[i]->get_size_in_bytes());
+        inputs[i]->read(host_inputs[i].data(), 0, host_inputs[i].size());
+    }
+
+    // The micro-batches run in order; the Sends of one overlap the next stage's work on it
+    bool rc = true;
+    vector<vector<char>> sums(stage.result_indices.size());
+    vector<char> value;
+    for (size_t m = 0; m < m_micro_batch_count; m++)
+    {
+        for (size_t i = 0; i < inputs.size(); i++)
+        {
+            size_t size = stage.inputs[i]->get_size_in_bytes();
+            if (m_batched_parameters[i])
+            {
+                stage.inputs[i]->write(host_inputs[i].data() + size * m, 0, size);
+            }
+            else if (m == 0)
+            {
+                stage.inputs[i]->write(host_inputs[i].data(), 0, size);
+            }
+        }
+        rc = stage.executable->call(stage.outputs, stage.inputs) && rc;
+
+        for (size_t j = 0; j < stage.result_indices.size(); j++)
+        {
+            size_t r = stage.result_indices[j];
+            size_t size = stage.outputs[j]->get_size_in_bytes();
+            if (m_batched_results[r])
+            {
+                NGRAPH_CHECK(outputs[r]->get_size_in_bytes() == size * m_micro_batch_count,
+                             "Output ",
+                             r,
+                             " has ",
+                             outputs[r]->get_size_in_bytes(),
+                             " bytes, expected ",
+                             size * m_micro_batch_count);
+                value.resize(size);
+                stage.outputs[j]->read(value.data(), 0, size);
+                outputs[r]->write(value.data(), size * m, size);
+            }
+            else if (m == 0)
+            {
+                sums[j].resize(size);
+                stage.outputs[j]->read(sums[j].data(), 0, size);
+            }
+            else
+            {
+                value.resize(size);
+                stage.outputs[j]->read(value.data(), 0, size);
+                accumulate(outputs[r]->get_element_type(), sums[j].data(), value.data(), size);
+            }
+        }
+    }
+
+    for (size_t j = 0; j < stage.result_indices.size(); j++)
+    {
+        size_t r = stage.result_indices[j];
+        if (!m_batched_results[r])
+        {
+            NGRAPH_CHECK(outputs[r]->get_size_in_bytes() == sums[j].size(),
+                         "Output ",
+                         r,
+                         " has ",
+                         outputs[r]->get_size_in_bytes(),
+                         " bytes, expected ",
+                         sums[j].size());
+            outputs[r]->write(sums[j].data(), 0, sums[j].size());
+        }
+    }
+    return rc;
+}
+
+void runtime::pipeline::PipelineExecutable::accumulate(const element::Type& type,
+                                                       char* sum,
+                                                       const char* value,
+                                                       size_t size)
+{
+    stringstream ss;
+    switch (type.get_type_enum())
+    {
+    case element::Type_t::f32: sum_into<float>(sum, value, size); break;
+    case element::Type_t::f64: sum_into<double>(sum, value, size); break;
+    case element::Type_t::i8: sum_into<int8_t>(sum, value, size); break;
+    case element::Type_t::i16: sum_into<int16_t>(sum, value, size); break;
+    case element::Type_t::i32: sum_into<int32_t>(sum, value, size); break;
+    case element::Type_t::i64: sum_into<int64_t>(sum, value, size); break;
+    case element::Type_t::u8: sum_into<uint8_t>(sum, value, size); break;
+    case element::Type_t::u16: sum_into<uint16_t>(sum, value, size); break;
+    case element::Type_t::u32: sum_into<uint32_t>(sum, value, size); break;
+    case element::Type_t::u64: sum_into<uint64_t>(sum, value, size); break;
+    case element::Type_t::undefined:
+    case element::Type_t::dynamic:
+    case element::Type_t::boolean:
+    case element::Type_t::bf16:
+    case element::Type_t::f16:
+        ss << "Unable to sum the micro-batches of a result of element type " << type;
+        throw ngraph_error(ss.str());
+    }
+}
@@ -0,0 +1,98 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace pipeline
+        {
+            class PipelineExecutable;
+        }
+    }
+}
+
+///
+/// \brief Executable that runs one Function as a pipeline over the processes of the
+///        distributed interface, in the style of GPipe. Every process constructs it with the
+///        same Function and calls it with the same inputs.
+///
+/// The ops are placed on one stage per process by pass::PipelinePlacement, and each process
+/// compiles and runs the ops of its own stage, exchanging values with the other stages
+/// through Send and Recv ops. Sends do not wait for the receiver, so while a stage works on
+/// one micro-batch the next stage works on the previous one.
+///
+/// Parameters with a dynamic dimension 0 are batched: every call splits their dimension 0
+/// into micro_batch_count equal micro-batches, which run through the pipeline in order. Every
+/// other parameter, such as the weights, is passed whole to each micro-batch.
+///
+/// Results with a dynamic dimension 0 are gathered: the micro-batch results are concatenated.
+/// Every other result is reduced: the micro-batch results are summed, which accumulates the
+/// gradients of a training Function. A process only writes the outputs of the results its own
+/// stage computes; the other outputs are left untouched.
+///
+class ngraph::runtime::pipeline::PipelineExecutable : public ngraph::runtime::Executable
+{
+public:
+    PipelineExecutable(std::shared_ptr<Function> function,
+                       std::shared_ptr<Backend> backend,
+                       size_t micro_batch_count,
+                       bool enable_performance_collection = false);
+    ~PipelineExecutable() override;
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    size_t get_stage() const { return m_stage; }
+    size_t get_stage_count() const { return m_stage_count; }
+    size_t get_micro_batch_count() const { return m_micro_batch_count; }
+private:
+    struct Stage
+    {
+        size_t micro_batch_size;
+        // nullptr if no op was placed on this stage
+        std::shared_ptr<Executable> executable;
+        std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+        // Index of the Function result of each stage output, the Sends come last
+        std::vector<size_t> result_indices;
+    };
+
+    Stage& get_stage_variant(const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+    static void accumulate(const element::Type& type, char* sum, const char* value, size_t size);
+
+    std::shared_ptr<Function> m_function;
+    std::shared_ptr<Backend> m_backend;
+    size_t m_micro_batch_count;
+    bool m_enable_performance_collection;
+    size_t m_stage;
+    size_t m_stage_count;
+    std::vector<bool> m_batched_parameters;
+    std::vector<bool> m_batched_results;
+    // The stage compiled for each distinct set of input shapes
+    std::map<std::vector<Shape>, Stage> m_variants;
+};
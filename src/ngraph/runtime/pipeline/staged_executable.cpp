@@ -0,0 +1,226 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "ngraph/runtime/pipeline/staged_executable.hpp"
+#include "ngraph/check.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::pipeline::StagedExecutable::StagedExecutable(const vector<shared_ptr<Executable>>& stages,
+                                                      shared_ptr<Backend> backend,
+                                                      size_t buffer_count)
+    : m_stages(stages)
+    , m_backend(backend)
+    , m_buffer_count(buffer_count)
+    , m_submitted(0)
+    , m_stop(false)
+{
+    NGRAPH_CHECK(!m_stages.empty(), "A staged executable needs at least one stage");
+    NGRAPH_CHECK(m_buffer_count > 0, "A staged executable needs at least one buffer set");
+    for (size_t s = 0; s + 1 < m_stages.size(); s++)
+    {
+        const ResultVector& results = m_stages[s]->get_results();
+        const ParameterVector& parameters = m_stages[s + 1]->get_parameters();
+        NGRAPH_CHECK(results.size() == parameters.size(),
+                     "Stage ",
+                     s,
+                     " has ",
+                     results.size(),
+                     " results, the next stage has ",
+                     parameters.size(),
+                     " parameters");
+        for (size_t i = 0; i < results.size(); i++)
+        {
+            NGRAPH_CHECK(results[i]->get_output_partial_shape(0).is_static() &&
+                             results[i]->get_element_type() == parameters[i]->get_element_type() &&
+                             results[i]->get_shape() == parameters[i]->get_shape(),
+                         "Result ",
+                         i,
+                         " of stage ",
+                         s,
+                         " (",
+                         results[i]->get_element_type(),
+                         " ",
+                         results[i]->get_output_partial_shape(0),
+                         ") does not match parameter ",
+                         i,
+                         " of the next stage (",
+                         parameters[i]->get_element_type(),
+                         " ",
+                         parameters[i]->get_output_partial_shape(0),
+                         ")");
+        }
+
+        m_buffers.emplace_back(m_buffer_count);
+        for (auto& buffers : m_buffers.back())
+        {
+            for (auto& result : results)
+            {
+                buffers.push_back(
+                    m_backend->create_tensor(result->get_element_type(), result->get_shape()));
+            }
+        }
+    }
+
+    set_parameters_and_results(m_stages.front()->get_parameters(),
+                               m_stages.back()->get_results());
+
+    m_queues.resize(m_stages.size());
+    m_finished.assign(m_stages.size(), 0);
+    m_timings.resize(m_stages.size());
+    for (size_t s = 0; s < m_stages.size(); s++)
+    {
+        m_workers.emplace_back(&StagedExecutable::run_stage, this, s);
+    }
+}
+
+runtime::pipeline::StagedExecutable::~StagedExecutable()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    for (auto& worker : m_workers)
+    {
+        worker.join();
+    }
+}
+
+bool runtime::pipeline::StagedExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                               const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    return begin_call(outputs, inputs).get();
+}
+
+future<bool>
+    runtime::pipeline::StagedExecutable::begin_call(const vector<shared_ptr<Tensor>>& outputs,
+                                                    const vector<shared_ptr<Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == get_parameters().size(),
+                 "Call input count ",
+                 inputs.size(),
+                 " does not match the first stage's Parameter count ",
+                 get_parameters().size());
+    NGRAPH_CHECK(outputs.size() == get_results().size(),
+                 "Call output count ",
+                 outputs.size(),
+                 " does not match the last stage's Result count ",
+                 get_results().size());
+
+    auto request = make_shared<Request>();
+    request->outputs = outputs;
+    request->inputs = inputs;
+    future<bool> result = request->promise.get_future();
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        NGRAPH_CHECK(!m_stop, "StagedExecutable is shutting down");
+        request->index = m_submitted++;
+        m_queues[0].push_back(request);
+    }
+    m_cv.notify_all();
+    return result;
+}
+
+vector<runtime::pipeline::StageTiming>
+    runtime::pipeline::StagedExecutable::get_stage_timings() const
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_timings;
+}
+
+void runtime::pipeline::StagedExecutable::run_stage(size_t stage)
+{
+    bool is_last = stage + 1 == m_stages.size();
+    while (true)
+    {
+        shared_ptr<Request> request;
+        chrono::steady_clock::duration blocked{0};
+        {
+            unique_lock<mutex> lock(m_mutex);
+            // At shutdown, a stage only stops once it is done with every submitted request
+            m_cv.wait(lock, [this, stage]() {
+                return !m_queues[stage].empty() ||
+                       (m_stop && m_finished[stage] == m_submitted);
+            });
+            if (m_queues[stage].empty())
+            {
+                return;
+            }
+            request = m_queues[stage].front();
+            m_queues[stage].pop_front();
+
+            // The set this request writes to was last used by request index - m_buffer_count,
+            // which the next stage has to be done reading
+            if (!is_last && request->index - m_finished[stage + 1] >= m_buffer_count)
+            {
+                auto start = chrono::steady_clock::now();
+                m_cv.wait(lock, [this, stage, &request]() {
+                    return request->index - m_finished[stage + 1] < m_buffer_count;
+                });
+                blocked = chrono::steady_clock::now() - start;
+            }
+        }
+
+        bool ran = request->rc && !request->error;
+        chrono::steady_clock::duration busy{0};
+        if (ran)
+        {
+            size_t buffer = request->index % m_buffer_count;
+            auto& outputs = is_last ? request->outputs : m_buffers[stage][buffer];
+            auto& inputs = stage == 0 ? request->inputs : m_buffers[stage - 1][buffer];
+            auto start = chrono::steady_clock::now();
+            try
+            {
+                request->rc = m_stages[stage]->call(outputs, inputs);
+            }
+            catch (...)
+            {
+                request->error = current_exception();
+            }
+            busy = chrono::steady_clock::now() - start;
+        }
+
+        {
+            lock_guard<mutex> lock(m_mutex);
+            m_finished[stage]++;
+            StageTiming& timing = m_timings[stage];
+            timing.calls += ran ? 1 : 0;
+            timing.busy += chrono::duration_cast<chrono::nanoseconds>(busy);
+            timing.blocked += chrono::duration_cast<chrono::nanoseconds>(blocked);
+            if (!is_last)
+            {
+                m_queues[stage + 1].push_back(request);
+            }
+        }
+        m_cv.notify_all();
+
+        if (is_last)
+        {
+            if (request->error)
+            {
+                request->promise.set_exception(request->error);
+            }
+            else
+            {
+                request->promise.set_value(request->rc);
+            }
+        }
+    }
+}
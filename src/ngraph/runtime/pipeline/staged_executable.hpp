@@ -0,0 +1,130 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace pipeline
+        {
+            struct StageTiming;
+            class StagedExecutable;
+        }
+    }
+}
+
+///
+/// \brief Counters of one stage of a `StagedExecutable`.
+///
+struct ngraph::runtime::pipeline::StageTiming
+{
+    /// Number of requests the stage ran.
+    size_t calls = 0;
+    /// Time spent in the calls of the stage's executable.
+    std::chrono::nanoseconds busy{0};
+    /// Time the stage waited for the next stage to free one of the tensors it writes to.
+    std::chrono::nanoseconds blocked{0};
+};
+
+///
+/// \brief Executable that chains several Executables, such as preprocessing, a model and
+///        postprocessing, and runs them concurrently on successive requests.
+///
+/// The results of each stage are the parameters of the next one, in order, with the same
+/// element types and static shapes. The parameters of the first stage and the results of the
+/// last one are those of the StagedExecutable. The intermediate values live in
+/// `buffer_count` sets of tensors per link, created on `backend`, on which all the stages must
+/// run: a stage writes its outputs straight into the tensors the next stage reads, so nothing
+/// is copied between stages.
+///
+/// Each stage runs on its own thread and takes the requests in the order they were submitted.
+/// Request `k` uses the tensors of set `k % buffer_count`. While a stage works on a request,
+/// the previous stage can work on the next one, so with two sets or more the throughput
+/// approaches that of the slowest stage rather than that of the whole chain. A stage whose
+/// next set is still being read waits, which its StageTiming reports as blocked time.
+///
+/// A stage that returns false or throws ends its request: the later stages skip it, and its
+/// future returns false or rethrows.
+///
+class ngraph::runtime::pipeline::StagedExecutable : public ngraph::runtime::Executable
+{
+public:
+    StagedExecutable(const std::vector<std::shared_ptr<Executable>>& stages,
+                     std::shared_ptr<Backend> backend,
+                     size_t buffer_count = 2);
+    ~StagedExecutable() override;
+
+    /// \brief Runs a request through every stage and waits for it.
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    /// \brief Queues a request on the first stage without waiting for it.
+    std::future<bool>
+        begin_call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+                   const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    size_t get_stage_count() const { return m_stages.size(); }
+    size_t get_buffer_count() const { return m_buffer_count; }
+    std::shared_ptr<Executable> get_stage(size_t stage) const { return m_stages.at(stage); }
+    std::vector<StageTiming> get_stage_timings() const;
+
+private:
+    struct Request
+    {
+        std::vector<std::shared_ptr<runtime::Tensor>> outputs;
+        std::vector<std::shared_ptr<runtime::Tensor>> inputs;
+        // Position of the request in the order of submission
+        size_t index;
+        bool rc = true;
+        std::exception_ptr error;
+        std::promise<bool> promise;
+    };
+
+    void run_stage(size_t stage);
+
+    std::vector<std::shared_ptr<Executable>> m_stages;
+    std::shared_ptr<Backend> m_backend;
+    size_t m_buffer_count;
+    // m_buffers[s][b] are the outputs of stage s, and inputs of stage s + 1, in set b
+    std::vector<std::vector<std::vector<std::shared_ptr<runtime::Tensor>>>> m_buffers;
+
+    // Requests waiting for each stage
+    std::vector<std::deque<std::shared_ptr<Request>>> m_queues;
+    size_t m_submitted;
+    // Number of requests each stage is done with
+    std::vector<size_t> m_finished;
+    std::vector<StageTiming> m_timings;
+    bool m_stop;
+    mutable std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::vector<std::thread> m_workers;
+};
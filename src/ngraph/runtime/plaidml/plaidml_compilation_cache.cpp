@@ -15,30 +15,77 @@
 //*****************************************************************************
 
 #include "ngraph/runtime/plaidml/plaidml_compilation_cache.hpp"
+#include "ngraph/log.hpp"
+#ifdef NGRAPH_JSON_ENABLE
+#include "ngraph/serializer.hpp"
+#endif
 
 std::shared_ptr<ngraph::runtime::plaidml::PlaidML_Executable>
     ngraph::runtime::plaidml::CompilationCache::compile(std::shared_ptr<Function> func,
                                                         Compiler* compiler)
 {
     std::lock_guard<std::mutex> lock{m_mu};
-    auto it_inserted = m_cache.insert(std::make_pair(func, std::shared_ptr<PlaidML_Executable>{}));
-    if (it_inserted.second)
+    auto it = m_cache.find(func);
+    if (it != m_cache.end())
     {
-        try
-        {
-            it_inserted.first->second = compiler->compile(func);
-        }
-        catch (...)
+        ++m_hits;
+        return it->second;
+    }
+
+    std::string key = structure_key(func);
+    if (!key.empty())
+    {
+        auto sit = m_structure_cache.find(key);
+        if (sit != m_structure_cache.end())
         {
-            m_cache.erase(it_inserted.first);
-            throw;
+            ++m_hits;
+            m_cache.emplace(func, sit->second);
+            return sit->second;
         }
     }
-    return it_inserted.first->second;
+
+    auto exec = compiler->compile(func);
+    m_cache.emplace(func, exec);
+    if (!key.empty())
+    {
+        m_structure_cache.emplace(std::move(key), exec);
+    }
+    return exec;
 }
 
 void ngraph::runtime::plaidml::CompilationCache::forget(std::shared_ptr<PlaidML_Executable> exec)
 {
     std::lock_guard<std::mutex> lock{m_mu};
-    m_cache.erase(exec->src_func());
+    for (auto it = m_cache.begin(); it != m_cache.end();)
+    {
+        it = it->second == exec ? m_cache.erase(it) : std::next(it);
+    }
+    for (auto it = m_structure_cache.begin(); it != m_structure_cache.end();)
+    {
+        it = it->second == exec ? m_structure_cache.erase(it) : std::next(it);
+    }
+}
+
+std::size_t ngraph::runtime::plaidml::CompilationCache::get_hits() const
+{
+    std::lock_guard<std::mutex> lock{m_mu};
+    return m_hits;
+}
+
+std::string
+    ngraph::runtime::plaidml::CompilationCache::structure_key(const std::shared_ptr<Function>& func)
+{
+#ifdef NGRAPH_JSON_ENABLE
+    try
+    {
+        return serialize_structure(func);
+    }
+    catch (const std::exception& e)
+    {
+        // Ops the serializer does not know are only cached by identity
+        NGRAPH_DEBUG << "Function " << func->get_name() << " is cached by identity only: "
+                     << e.what();
+    }
+#endif
+    return std::string{};
 }
@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <mutex>
+#include <string>
 #include <unordered_map>
 
 #include "ngraph/function.hpp"
@@ -36,20 +37,36 @@ namespace ngraph
 }
 
 // A compilation cacher.
+//
+// Functions are looked up by identity first and then by structure (see
+// ngraph::serialize_structure), so a structurally identical function, such as the same model
+// imported again, shares the executable compiled for the first one.  Structural lookup needs
+// NGRAPH_JSON_ENABLE; without it only identical functions hit.
 class ngraph::runtime::plaidml::CompilationCache final
 {
 public:
-    // Looks up the supplied function in the compilation cache.  If the function is not in the
-    // cache, compiles it using the specified compiler (which must not be nullptr), adds the
-    // compiled function to the cache, and returns the compiled function.
+    // Looks up the supplied function in the compilation cache.  If neither the function nor a
+    // structurally identical one is in the cache, compiles it using the specified compiler
+    // (which must not be nullptr), adds the compiled function to the cache, and returns the
+    // compiled function.
     std::shared_ptr<PlaidML_Executable> compile(std::shared_ptr<Function> func, Compiler* compiler);
 
-    // Drops the supplied function's compiled function from the compilation cache.
+    // Drops the supplied compiled function from the compilation cache, for every function
+    // that shares it.
     void forget(std::shared_ptr<PlaidML_Executable> func);
 
+    // The number of compile() calls answered from the cache.
+    std::size_t get_hits() const;
+
 private:
-    std::mutex m_mu;
+    // Returns the structural key of the function, or an empty string if it cannot be made.
+    static std::string structure_key(const std::shared_ptr<Function>& func);
+
+    mutable std::mutex m_mu;
 
-    // N.B. The key here is the original source function, *not* the copy that's been processed by the compilation passes.
+    // N.B. The keys here are the original source functions, *not* the copies that have been
+    // processed by the compilation passes.
     std::unordered_map<std::shared_ptr<Function>, std::shared_ptr<PlaidML_Executable>> m_cache;
+    std::unordered_map<std::string, std::shared_ptr<PlaidML_Executable>> m_structure_cache;
+    std::size_t m_hits = 0;
 };
@@ -18,8 +18,10 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/pass/algebraic_simplification.hpp"
+#include "ngraph/pass/batch_norm_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
 #include "ngraph/pass/cse.hpp"
+#include "ngraph/pass/fused_op_decomposition.hpp"
 #include "ngraph/pass/get_output_element_elimination.hpp"
 #include "ngraph/pass/like_replacement.hpp"
 #include "ngraph/pass/liveness.hpp"
@@ -69,7 +71,14 @@ namespace
 }
 
 ngraph::runtime::plaidml::Compiler::Compiler(Config* config)
+    : Compiler{config, std::make_shared<WinogradTuner>(config)}
+{
+}
+
+ngraph::runtime::plaidml::Compiler::Compiler(Config* config,
+                                             std::shared_ptr<WinogradTuner> winograd_tuner)
     : m_config{config}
+    , m_winograd_tuner{std::move(winograd_tuner)}
 {
 }
 
@@ -91,7 +100,10 @@ std::shared_ptr<ngraph::runtime::plaidml::PlaidML_Executable>
     pass_manager.register_pass<ngraph::pass::ZeroDimTensorElimination>();
     pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
     pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.register_pass<ngraph::pass::BatchNormFolding>();
     pass_manager.register_pass<ngraph::pass::CoreFusion>();
+    // There are no fused op kernels here, including LayerNorm and Gelu from CoreFusion
+    pass_manager.register_pass<ngraph::pass::FusedOpDecomposition>();
     // N.B. We'd like to register ngraph::pass::GetOutputElementElimination, but it breaks BatchNorm
     // backprop
     pass_manager.register_pass<ngraph::pass::Liveness>();
@@ -103,9 +115,11 @@ std::shared_ptr<ngraph::runtime::plaidml::PlaidML_Executable>
     pass_manager.register_pass<ngraph::runtime::plaidml::pass::ImplicitBroadcast>();
     pass_manager.register_pass<ngraph::pass::PrefixReshapeElimination>();
     pass_manager.register_pass<ngraph::runtime::plaidml::pass::LowerConvolutions>();
-    if (pass_manager.get_pass_config().get_pass_enable("Winograd"))
+    if (pass_manager.get_pass_config().get_pass_enable("Winograd") ||
+        !m_config->winograd_tuning.empty())
     {
-        pass_manager.register_pass<ngraph::runtime::plaidml::pass::Winograd>();
+        pass_manager.register_pass<ngraph::runtime::plaidml::pass::Winograd>(
+            m_winograd_tuner.get());
     }
     if (!m_config->graphviz.empty())
     {
@@ -23,6 +23,7 @@
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/plaidml/plaidml_config.hpp"
 #include "ngraph/runtime/plaidml/plaidml_executable.hpp"
+#include "ngraph/runtime/plaidml/plaidml_winograd_tuner.hpp"
 
 namespace ngraph
 {
@@ -41,6 +42,7 @@ class ngraph::runtime::plaidml::Compiler final
 {
 public:
     Compiler(Config* config);
+    Compiler(Config* config, std::shared_ptr<WinogradTuner> winograd_tuner);
 
     std::shared_ptr<PlaidML_Executable> compile(std::shared_ptr<Function> func);
 
@@ -50,4 +52,5 @@ private:
     void build(std::shared_ptr<Function> func, Build* build);
 
     Config* m_config;
+    std::shared_ptr<WinogradTuner> m_winograd_tuner;
 };
@@ -77,9 +77,11 @@ ngraph::runtime::plaidml::Config
     bool help = false;
     bool list = false;
     bool debug = false;
+    bool double_buffer = false;
     std::size_t device_idx = 0;
     std::string eventlog_config;
     std::string graphviz;
+    std::string winograd_tuning;
 
 #ifdef NGRAPH_DEBUG_ENABLE
     debug = true;
@@ -195,6 +197,17 @@ ngraph::runtime::plaidml::Config
             continue;
         }
 
+        // Check for double buffering of tensors
+        if (is_opt("double_buffer"))
+        {
+            if (has_oval)
+            {
+                throw std::invalid_argument{"PlaidML double_buffer does not take a value"};
+            }
+            double_buffer = true;
+            continue;
+        }
+
         // Check for list_devices
         if (is_opt("list_devices"))
         {
@@ -241,14 +254,26 @@ ngraph::runtime::plaidml::Config
             continue;
         }
 
+        // Check for Winograd autotuning
+        if (is_opt("winograd_tuning"))
+        {
+            if (!oval_len)
+            {
+                throw std::invalid_argument{"PlaidML winograd_tuning requires a value"};
+            }
+            winograd_tuning = std::string{oval_begin, oval_len};
+            continue;
+        }
+
         // Reject unknown options
         err = true;
     }
 
     constexpr char help_text[] =
         "PlaidML Backend Specification: \""
-        "PlaidML[:[device_index][,debug][,help][,list_devices][,"
-        "eventlog=<filename>][,graphviz=<filename>]]\".  For example: \"PlaidML\", \""
+        "PlaidML[:[device_index][,debug][,help][,list_devices][,double_buffer][,"
+        "eventlog=<filename>][,graphviz=<filename>][,winograd_tuning=<filename>]]\".  "
+        "For example: \"PlaidML\", \""
         "PlaidML:0,list_devices\"";
     if (err)
     {
@@ -283,5 +308,9 @@ ngraph::runtime::plaidml::Config
 
     result.graphviz = graphviz;
 
+    result.double_buffer = double_buffer;
+
+    result.winograd_tuning = winograd_tuning;
+
     return result;
 }
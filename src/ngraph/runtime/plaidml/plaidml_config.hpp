@@ -40,4 +40,10 @@ struct ngraph::runtime::plaidml::Config
     std::shared_ptr<vertexai::plaidml::device> dev;
     bool debug;
     std::string graphviz;
+    // Give each tensor a second device buffer, so that writing or reading the value for one
+    // call does not wait for the previous call.
+    bool double_buffer;
+    // File recording the fastest Winograd algorithm per convolution shape; shapes missing from
+    // it are measured when compiled.  Empty to select with a heuristic instead.
+    std::string winograd_tuning;
 };
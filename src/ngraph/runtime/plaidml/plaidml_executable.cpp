@@ -47,6 +47,8 @@ bool ngraph::runtime::plaidml::PlaidML_Executable::call(
 
     m_bound_inputs.resize(inputs.size());
     m_bound_outputs.resize(outputs.size());
+    m_bound_input_buffers.resize(inputs.size());
+    m_bound_output_buffers.resize(outputs.size());
 
     std::size_t input_count = 0;
     for (const auto& param : m_func->get_parameters())
@@ -63,13 +65,15 @@ bool ngraph::runtime::plaidml::PlaidML_Executable::call(
             }
             rtv->sync_input();
             auto& bound_input = m_bound_inputs.at(input_count);
+            auto& bound_buffer = m_bound_input_buffers.at(input_count);
             ++input_count;
-            if (bound_input.lock() == input)
+            if (bound_input.lock() == input && bound_buffer == rtv->get_buffer_index())
             {
                 // No need to re-bind this input.
                 continue;
             }
             bound_input = input;
+            bound_buffer = rtv->get_buffer_index();
             NGRAPH_DEBUG << "Binding input " << m_input_names.at(tv) << " to tensor " << rtv;
             m_invoker.set_input(m_input_names.at(tv), rtv->tensor());
         }
@@ -88,14 +92,17 @@ bool ngraph::runtime::plaidml::PlaidML_Executable::call(
                 throw std::runtime_error{
                     "The PlaidML backend only operates on PlaidML tensor views"};
             }
+            rtv->prepare_output();
             auto& bound_output = m_bound_outputs.at(output_count);
+            auto& bound_buffer = m_bound_output_buffers.at(output_count);
             ++output_count;
-            if (bound_output.lock() == output)
+            if (bound_output.lock() == output && bound_buffer == rtv->get_buffer_index())
             {
                 // No need to re-bind this output.
                 continue;
             }
             bound_output = output;
+            bound_buffer = rtv->get_buffer_index();
             NGRAPH_DEBUG << "Binding output " << m_output_names.at(tv) << " to tensor " << rtv;
             m_invoker.set_output(m_output_names.at(tv), rtv->tensor());
         }
@@ -64,5 +64,8 @@ private:
     std::unordered_map<descriptor::Tensor*, std::string> m_output_names;
     mutable std::vector<std::weak_ptr<runtime::Tensor>> m_bound_inputs;
     mutable std::vector<std::weak_ptr<runtime::Tensor>> m_bound_outputs;
+    // The device buffers of the bound tensors, see PlaidML_Tensor::get_buffer_index
+    mutable std::vector<std::size_t> m_bound_input_buffers;
+    mutable std::vector<std::size_t> m_bound_output_buffers;
     mutable vertexai::plaidml::invoker m_invoker;
 };
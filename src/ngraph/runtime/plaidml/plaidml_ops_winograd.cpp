@@ -72,7 +72,7 @@ void ngraph::runtime::plaidml::ImplWinograd::Apply()
 
     set_output(vp::function{R"(
             function (I[N, X, Y, CI], K[S, S, CI, CO], A[BI, BO], B[BI, BI], G[BI, S], XO, YO, XP, YP) -> (O) {
-                Assert = assert_winograd_valid(BI - CI + 1 == BO);
+                Assert = assert_winograd_valid(BI - S + 1 == BO);
                 XB = (XO + BO - 1) / BO;
                 YB = (YO + BO - 1) / BO;
                 U1[i, j, ci, co : BI, S, CI, CO] = +(G[i, k] * K[k, j, ci, co]);
@@ -83,9 +83,42 @@ namespace
 
         return params;
     }
+
+    std::tuple<std::shared_ptr<ngraph::op::Constant>,
+               std::shared_ptr<ngraph::op::Constant>,
+               std::shared_ptr<ngraph::op::Constant>>
+        make_l_2_3()
+    {
+        std::vector<float> a_vec{1, 0, 1, 1, 1, -1, 0, -1};
+        auto a = std::make_shared<ngraph::op::Constant>(
+            ngraph::element::f32, ngraph::Shape{4, 2}, std::move(a_vec));
+
+        std::vector<float> b_vec{1, 0, 0, 0, 0, 1, -1, 1, -1, 1, 1, 0, 0, 0, 0, -1};
+        auto b = std::make_shared<ngraph::op::Constant>(
+            ngraph::element::f32, ngraph::Shape{4, 4}, std::move(b_vec));
+
+        std::vector<float> g_vec{1, 0, 0, 0.5, 0.5, 0.5, 0.5, -0.5, 0.5, 0, 0, 1};
+        auto g = std::make_shared<ngraph::op::Constant>(
+            ngraph::element::f32, ngraph::Shape{4, 3}, std::move(g_vec));
+
+        return std::make_tuple(std::move(a), std::move(b), std::move(g));
+    }
+
+    std::tuple<std::shared_ptr<ngraph::op::Constant>,
+               std::shared_ptr<ngraph::op::Constant>,
+               std::shared_ptr<ngraph::op::Constant>>
+        l_2_3()
+    {
+        static std::tuple<std::shared_ptr<ngraph::op::Constant>,
+                          std::shared_ptr<ngraph::op::Constant>,
+                          std::shared_ptr<ngraph::op::Constant>>
+            params = make_l_2_3();
+
+        return params;
+    }
 }
 
-ngraph::runtime::plaidml::pass::Winograd::Winograd()
+ngraph::runtime::plaidml::pass::Winograd::Winograd(WinogradTuner* tuner)
 {
     auto convolution_op =
         std::make_shared<pattern::op::Label>(element::i8, Shape{}, [](std::shared_ptr<Node> node) {
@@ -94,12 +127,10 @@ ngraph::runtime::plaidml::pass::Winograd::Winograd()
             {
                 return false;
             }
-            // Our Winograd implementation is limited to specific
-            // cases where we think it results in a performance
-            // improvement, and cases that were straightforward to
-            // implement -- hence all the conditions.  It may be
-            // useful to extend the implementation to cover additional
-            // cases.
+            // Our Winograd implementation is limited to 3x3 filters
+            // with unit strides and dilations, in the layouts
+            // produced by LowerConvolutions.  Whether it pays off
+            // for a particular shape is left to the tuner.
             const auto& data_shape = conv->get_input_shape(0);
             const auto& filters_shape = conv->get_input_shape(1);
             return (data_shape.size() == 4 && conv->get_data_axes() == AxisVector{0, 3, 1, 2} &&
@@ -108,16 +139,22 @@ ngraph::runtime::plaidml::pass::Winograd::Winograd()
                     conv->get_src()->get_window_movement_strides() == Strides{1, 1} &&
                     conv->get_src()->get_window_dilation_strides() == Strides{1, 1} &&
                     filters_shape.size() >= 4 && filters_shape.at(0) == 3 &&
-                    filters_shape.at(1) == 3 && filters_shape.at(2) > 4 && filters_shape.at(3) > 4);
+                    filters_shape.at(1) == 3);
         });
 
-    auto callback = [](pattern::Matcher& m) {
+    auto callback = [tuner](pattern::Matcher& m) {
         auto conv = std::static_pointer_cast<plaidml::op::Convolution>(m.get_match_root());
-        NodeVector args = conv->get_arguments();
         std::shared_ptr<ngraph::op::Constant> a;
         std::shared_ptr<ngraph::op::Constant> b;
         std::shared_ptr<ngraph::op::Constant> g;
-        std::tie(a, b, g) = l_4_3(); // N.B. => filters HW must be 3x3
+        switch (tuner->select(*conv))
+        {
+        case WinogradTuner::Algorithm::DIRECT: return false;
+        case WinogradTuner::Algorithm::F2X3: std::tie(a, b, g) = l_2_3(); break;
+        case WinogradTuner::Algorithm::F4X3: std::tie(a, b, g) = l_4_3(); break;
+        }
+        // N.B. => filters HW must be 3x3
+        NodeVector args = conv->get_arguments();
         args.emplace_back(a);
         args.emplace_back(b);
         args.emplace_back(g);
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "ngraph/pass/graph_rewrite.hpp"
+#include "ngraph/runtime/plaidml/plaidml_winograd_tuner.hpp"
 
 namespace ngraph
 {
@@ -33,9 +34,10 @@ namespace ngraph
 }
 
 // Applies Winograd to selected convolutions; see
-// <http://arxiv.org/abs/1509.09308> for details.
+// <http://arxiv.org/abs/1509.09308> for details.  The tuner chooses between F(2x2, 3x3),
+// F(4x4, 3x3), and leaving the convolution alone.
 class ngraph::runtime::plaidml::pass::Winograd final : public ngraph::pass::GraphRewrite
 {
 public:
-    Winograd();
+    Winograd(WinogradTuner* tuner);
 };
@@ -14,6 +14,9 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <algorithm>
+#include <iterator>
+
 #include "ngraph/runtime/plaidml/plaidml_tensor.hpp"
 #include "ngraph/descriptor/layout/dense_tensor_layout.hpp"
 #include "ngraph/log.hpp"
@@ -29,10 +32,13 @@ ngraph::runtime::plaidml::PlaidML_Tensor::PlaidML_Tensor(Backend* parent,
                                                          const std::string& name,
                                                          void* memory)
     : Tensor{std::make_shared<ngraph::descriptor::Tensor>(element_type, shape, name), parent}
-    , m_tensor{config->dev->allocate(
+    , m_config{config}
+    , m_buffers{config->dev->allocate(
           to_plaidml(config->ctx, element_type, shape, ConversionUse::FOR_IO))}
+    , m_current{0}
+    , m_in_use{false}
     , m_memory{memory}
-    , m_memory_size{memory ? m_tensor.get_shape().buffer_size() : 0}
+    , m_memory_size{memory ? m_buffers[0].get_shape().buffer_size() : 0}
     , m_is_logically_zero{memory ? false : true}
 {
     m_descriptor->set_tensor_layout(
@@ -46,40 +52,44 @@ void ngraph::runtime::plaidml::PlaidML_Tensor::write(const void* p, size_t tenso
     NGRAPH_DEBUG << "Write " << this << " offset=" << tensor_offset << " n=" << n
                  << " is_logically_zero=" << m_is_logically_zero;
 
+    std::lock_guard<std::mutex> lock{m_mu};
+
     // As a special case: if we get a zero-sized write to offset zero, fill the tensor with zero.
     if (n == 0 && tensor_offset == 0)
     {
         NGRAPH_DEBUG << "Logically zeroing tensor " << this;
+        m_dirty.clear();
         m_is_logically_zero = true;
         return;
     }
 
-    bool is_full_write = (tensor_offset == 0 && n == m_tensor.get_shape().buffer_size());
-
-    vp::mapping<char> mp;
-    if (m_is_logically_zero || is_full_write)
+    size_t buffer_size = tensor().get_shape().buffer_size();
+    if (tensor_offset == 0 && n == buffer_size)
     {
-        // In either of these cases, we're completely replacing the existing data.
-        mp = m_tensor.map(vp::map_for_write);
+        m_dirty.clear();
+        write_all_locked(p);
+        return;
     }
-    else
+
+    // Stage the partial write, merging it with the ranges it overlaps or touches.
+    m_staging.resize(buffer_size);
+    const char* src = static_cast<const char*>(p);
+    std::copy(src, src + n, m_staging.data() + tensor_offset);
+
+    size_t begin = tensor_offset;
+    size_t end = tensor_offset + n;
+    auto it = m_dirty.upper_bound(begin);
+    if (it != m_dirty.begin() && std::prev(it)->second >= begin)
     {
-        // There may be existing non-zero data, and this is a partial buffer write; we need to read
-        // the existing data.
-        mp = m_tensor.map(vp::map_for_update);
+        --it;
     }
-
-    if (m_is_logically_zero && !is_full_write)
+    while (it != m_dirty.end() && it->first <= end)
     {
-        // It's a partial write of a logically-zero buffer, so first, fill the buffer with physical
-        // zeros.
-        std::fill_n(mp.raw(), m_tensor.get_shape().buffer_size(), 0);
+        begin = std::min(begin, it->first);
+        end = std::max(end, it->second);
+        it = m_dirty.erase(it);
     }
-    m_is_logically_zero = false;
-
-    const char* src = static_cast<const char*>(p);
-    char* dest = mp.raw() + tensor_offset;
-    std::copy(src, src + n, dest);
+    m_dirty.emplace(begin, end);
 }
 
 void ngraph::runtime::plaidml::PlaidML_Tensor::read(void* p, size_t tensor_offset, size_t n) const
@@ -87,6 +97,9 @@ void ngraph::runtime::plaidml::PlaidML_Tensor::read(void* p, size_t tensor_offse
     NGRAPH_DEBUG << "Read " << this << " offset=" << tensor_offset << " n=" << n
                  << " is_logically_zero=" << m_is_logically_zero;
 
+    std::lock_guard<std::mutex> lock{m_mu};
+    flush_locked();
+
     char* dest = static_cast<char*>(p);
 
     if (m_is_logically_zero)
@@ -95,15 +108,104 @@ void ngraph::runtime::plaidml::PlaidML_Tensor::read(void* p, size_t tensor_offse
         return;
     }
 
-    vp::mapping<char> mp = m_tensor.map(vp::map_for_read);
+    vp::mapping<char> mp = tensor().map(vp::map_for_read);
     const char* src = mp.raw() + tensor_offset;
     std::copy(src, src + n, dest);
 }
 
+std::future<void> ngraph::runtime::plaidml::PlaidML_Tensor::read_async(void* p,
+                                                                       size_t tensor_offset,
+                                                                       size_t n) const
+{
+    std::lock_guard<std::mutex> lock{m_mu};
+    flush_locked();
+
+    char* dest = static_cast<char*>(p);
+    if (m_is_logically_zero)
+    {
+        std::fill_n(dest, n, 0);
+        std::promise<void> done;
+        done.set_value();
+        return done.get_future();
+    }
+
+    // Keep the buffer from being overwritten under the reader when double buffering
+    m_in_use = true;
+    vp::tensor<char> buffer = tensor();
+    return std::async(std::launch::async, [buffer, dest, tensor_offset, n]() {
+        vp::mapping<char> mp = buffer.map(vp::map_for_read);
+        const char* src = mp.raw() + tensor_offset;
+        std::copy(src, src + n, dest);
+    });
+}
+
+void ngraph::runtime::plaidml::PlaidML_Tensor::flush()
+{
+    std::lock_guard<std::mutex> lock{m_mu};
+    flush_locked();
+}
+
+void ngraph::runtime::plaidml::PlaidML_Tensor::flush_locked() const
+{
+    if (m_dirty.empty())
+    {
+        return;
+    }
+    NGRAPH_DEBUG << "Flushing " << m_dirty.size() << " staged writes to " << this;
+
+    // Ranges staged on a logically zero tensor are written over physical zeros; otherwise the
+    // bytes between them keep their values.
+    vp::mapping<char> mp;
+    if (m_is_logically_zero)
+    {
+        mp = tensor().map(vp::map_for_write);
+        std::fill_n(mp.raw(), tensor().get_shape().buffer_size(), 0);
+    }
+    else
+    {
+        mp = tensor().map(vp::map_for_update);
+    }
+    for (const auto& range : m_dirty)
+    {
+        std::copy(m_staging.data() + range.first,
+                  m_staging.data() + range.second,
+                  mp.raw() + range.first);
+    }
+    m_is_logically_zero = false;
+    m_dirty.clear();
+}
+
+void ngraph::runtime::plaidml::PlaidML_Tensor::write_all_locked(const void* p)
+{
+    select_buffer_for_overwrite();
+    vp::mapping<char> mp = tensor().map(vp::map_for_write);
+    const char* src = static_cast<const char*>(p);
+    std::copy(src, src + tensor().get_shape().buffer_size(), mp.raw());
+    m_is_logically_zero = false;
+}
+
+void ngraph::runtime::plaidml::PlaidML_Tensor::select_buffer_for_overwrite()
+{
+    if (!m_config->double_buffer || !m_in_use)
+    {
+        return;
+    }
+    if (m_buffers.size() == 1)
+    {
+        m_buffers.push_back(m_config->dev->allocate(to_plaidml(
+            m_config->ctx, get_element_type(), get_shape(), ConversionUse::FOR_IO)));
+    }
+    m_current = 1 - m_current;
+    m_in_use = false;
+}
+
 void ngraph::runtime::plaidml::PlaidML_Tensor::sync_input()
 {
+    std::lock_guard<std::mutex> lock{m_mu};
+    flush_locked();
     if (!get_stale())
     {
+        m_in_use = true;
         return;
     }
     set_stale(false);
@@ -114,18 +216,31 @@ void ngraph::runtime::plaidml::PlaidML_Tensor::sync_input()
             NGRAPH_DEBUG << "Flushing logically zero " << this << " to physical memory";
             // The tensor's about to be used for an input, and it's logically zero; we need to write
             // physical zeros to its buffer.
-            auto mp = m_tensor.map(vp::map_for_write);
-            std::fill_n(mp.raw(), m_tensor.get_shape().buffer_size(), 0);
+            select_buffer_for_overwrite();
+            auto mp = tensor().map(vp::map_for_write);
+            std::fill_n(mp.raw(), tensor().get_shape().buffer_size(), 0);
         }
         m_is_logically_zero = false;
+        m_in_use = true;
         return;
     }
     NGRAPH_DEBUG << "Syncing input for tensor " << this;
-    write(m_memory, 0, m_memory_size);
+    write_all_locked(m_memory);
+    m_in_use = true;
+}
+
+void ngraph::runtime::plaidml::PlaidML_Tensor::prepare_output()
+{
+    std::lock_guard<std::mutex> lock{m_mu};
+    // The call replaces the whole value
+    m_dirty.clear();
+    select_buffer_for_overwrite();
+    m_in_use = true;
 }
 
 void ngraph::runtime::plaidml::PlaidML_Tensor::sync_output()
 {
+    std::lock_guard<std::mutex> lock{m_mu};
     // The tensor's been used for an output, so it's no longer logically zero.
     m_is_logically_zero = false;
     set_stale(false);
@@ -135,5 +250,6 @@ void ngraph::runtime::plaidml::PlaidML_Tensor::sync_output()
         return;
     }
     NGRAPH_DEBUG << "Syncing output for tensor " << this;
-    read(m_memory, 0, m_memory_size);
+    vp::mapping<char> mp = tensor().map(vp::map_for_read);
+    std::copy(mp.raw(), mp.raw() + m_memory_size, static_cast<char*>(m_memory));
 }
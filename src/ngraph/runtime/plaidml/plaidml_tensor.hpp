@@ -16,6 +16,11 @@
 
 #pragma once
 
+#include <future>
+#include <map>
+#include <mutex>
+#include <vector>
+
 #include <plaidml/plaidml++.h>
 
 #include "ngraph/runtime/plaidml/plaidml_config.hpp"
@@ -32,6 +37,13 @@ namespace ngraph
     }
 }
 
+// A tensor held in PlaidML device memory.
+//
+// Writes of the whole tensor go straight to the device.  Partial writes are staged on the host
+// and coalesced, and reach the device in a single mapping when the tensor is next read or used
+// by a call.  With the "double_buffer" backend option a tensor alternates between two device
+// buffers, so that a value can be written or read for one call while the previous call still
+// uses the other buffer.
 class ngraph::runtime::plaidml::PlaidML_Tensor final : public ngraph::runtime::Tensor
 {
 public:
@@ -42,19 +54,47 @@ public:
                    const std::string& name,
                    void* memory);
     ~PlaidML_Tensor() final {}
-    const vertexai::plaidml::tensor<char>& tensor() const { return m_tensor; }
+    const vertexai::plaidml::tensor<char>& tensor() const { return m_buffers[m_current]; }
     void write(const void* p, size_t tensor_offset, size_t n) final;
     void read(void* p, size_t tensor_offset, size_t n) const final;
 
+    // Reads the tensor's current value on another thread.  The value is the one the tensor
+    // holds now, even if a later call overwrites the tensor; p must remain valid until the
+    // returned future is ready.
+    std::future<void> read_async(void* p, size_t tensor_offset, size_t n) const;
+
+    // Copies staged partial writes to the device.
+    void flush();
+
+    // Identifies the device buffer returned by tensor().  It changes when double buffering
+    // switches buffers, after which an executable has to bind the tensor again.
+    size_t get_buffer_index() const { return m_current; }
+
     // Copy the backing memory to the tensor, if needed.
     void sync_input();
 
+    // Selects the device buffer the next call writes the tensor's value to.
+    void prepare_output();
+
     // Copy the tensor to the backing memory, if needed.
     void sync_output();
 
 private:
-    vertexai::plaidml::tensor<char> m_tensor;
+    void flush_locked() const;
+    void write_all_locked(const void* p);
+    // Switches to the other buffer if the current one may still be used by a call or reader.
+    void select_buffer_for_overwrite();
+
+    Config* m_config;
+    mutable std::mutex m_mu;
+    std::vector<vertexai::plaidml::tensor<char>> m_buffers;
+    size_t m_current;
+    // Set when the current buffer is bound to a call or has a pending asynchronous read.
+    mutable bool m_in_use;
     void* m_memory;
     size_t m_memory_size;
-    bool m_is_logically_zero;
+    mutable bool m_is_logically_zero;
+    // Staged partial writes, as disjoint [begin, end) ranges of m_staging.
+    mutable std::vector<char> m_staging;
+    mutable std::map<size_t, size_t> m_dirty;
 };
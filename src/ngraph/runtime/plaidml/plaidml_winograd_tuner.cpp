@@ -0,0 +1,245 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <sstream>
+
+#include "ngraph/function.hpp"
+#include "ngraph/log.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/runtime/plaidml/plaidml_compiler.hpp"
+#include "ngraph/runtime/plaidml/plaidml_ops_convolution.hpp"
+#include "ngraph/runtime/plaidml/plaidml_tensor.hpp"
+#include "ngraph/runtime/plaidml/plaidml_winograd_tuner.hpp"
+#include "ngraph/util.hpp"
+
+namespace
+{
+    const ngraph::runtime::plaidml::WinogradTuner::Algorithm s_algorithms[] = {
+        ngraph::runtime::plaidml::WinogradTuner::Algorithm::DIRECT,
+        ngraph::runtime::plaidml::WinogradTuner::Algorithm::F2X3,
+        ngraph::runtime::plaidml::WinogradTuner::Algorithm::F4X3};
+
+    // Timed calls per candidate, after one warm-up call
+    constexpr std::size_t s_timed_calls = 3;
+
+    ngraph::Shape permute(const ngraph::Shape& shape, const ngraph::AxisVector& axes)
+    {
+        ngraph::Shape result(shape.size());
+        for (std::size_t i = 0; i < axes.size(); ++i)
+        {
+            result[i] = shape[axes[i]];
+        }
+        return result;
+    }
+}
+
+ngraph::runtime::plaidml::WinogradTuner::WinogradTuner(Config* config)
+    : m_config{config}
+    , m_fixed{false}
+    , m_algorithm{Algorithm::DIRECT}
+{
+    load();
+}
+
+ngraph::runtime::plaidml::WinogradTuner::WinogradTuner(Config* config, Algorithm algorithm)
+    : m_config{config}
+    , m_fixed{true}
+    , m_algorithm{algorithm}
+{
+}
+
+const char* ngraph::runtime::plaidml::WinogradTuner::to_string(Algorithm algorithm)
+{
+    switch (algorithm)
+    {
+    case Algorithm::DIRECT: return "direct";
+    case Algorithm::F2X3: return "f2x3";
+    case Algorithm::F4X3: return "f4x3";
+    }
+    return "direct";
+}
+
+ngraph::runtime::plaidml::WinogradTuner::Algorithm
+    ngraph::runtime::plaidml::WinogradTuner::select(const op::Convolution& conv)
+{
+    if (m_fixed)
+    {
+        return m_algorithm;
+    }
+    if (m_config->winograd_tuning.empty())
+    {
+        return heuristic(conv);
+    }
+
+    std::string key = make_key(conv);
+    std::lock_guard<std::mutex> lock{m_mu};
+    auto it = m_table.find(key);
+    if (it != m_table.end())
+    {
+        return it->second;
+    }
+    Algorithm algorithm = measure(conv);
+    m_table.emplace(key, algorithm);
+    store(key, algorithm);
+    return algorithm;
+}
+
+ngraph::runtime::plaidml::WinogradTuner::Algorithm
+    ngraph::runtime::plaidml::WinogradTuner::heuristic(const op::Convolution& conv)
+{
+    // The transforms only pay off with enough channels to amortize them over; small outputs
+    // waste less of the larger F(4x4, 3x3) tiles with F(2x2, 3x3).
+    const auto& filters_shape = conv.get_input_shape(1);
+    const auto& output_shape = conv.get_src()->get_output_shape(0);
+    if (filters_shape.at(2) <= 4 || filters_shape.at(3) <= 4)
+    {
+        return Algorithm::DIRECT;
+    }
+    if (output_shape.at(2) < 8 || output_shape.at(3) < 8)
+    {
+        return Algorithm::F2X3;
+    }
+    return Algorithm::F4X3;
+}
+
+std::string ngraph::runtime::plaidml::WinogradTuner::make_key(const op::Convolution& conv)
+{
+    // Everything the generated kernels depend on, without spaces
+    const auto& src = conv.get_src();
+    std::ostringstream key;
+    key << src->get_element_type().c_type_string()
+        << ",data=" << join(conv.get_input_shape(0), "x")
+        << ",filters=" << join(conv.get_input_shape(1), "x")
+        << ",axes=" << join(conv.get_data_axes(), "x") << "/" << join(conv.get_filters_axes(), "x")
+        << "/" << join(conv.get_output_axes(), "x")
+        << ",pad=" << join(src->get_padding_below(), "x") << "/"
+        << join(src->get_padding_above(), "x");
+    return key.str();
+}
+
+ngraph::runtime::plaidml::WinogradTuner::Algorithm
+    ngraph::runtime::plaidml::WinogradTuner::measure(const op::Convolution& conv)
+{
+    // Rebuild the convolution with the same transposes around it, so that the candidate
+    // functions lower to the same plaidml::op::Convolution
+    const auto& src = conv.get_src();
+    auto data = std::make_shared<ngraph::op::Parameter>(src->get_element_type(),
+                                                        conv.get_input_shape(0));
+    auto filters = std::make_shared<ngraph::op::Parameter>(src->get_element_type(),
+                                                           conv.get_input_shape(1));
+    auto data_t = std::make_shared<ngraph::op::Reshape>(
+        data, conv.get_data_axes(), permute(conv.get_input_shape(0), conv.get_data_axes()));
+    auto filters_t = std::make_shared<ngraph::op::Reshape>(
+        filters,
+        conv.get_filters_axes(),
+        permute(conv.get_input_shape(1), conv.get_filters_axes()));
+    auto candidate = src->copy_with_new_args(NodeVector{data_t, filters_t});
+    auto output = std::make_shared<ngraph::op::Reshape>(
+        candidate,
+        conv.get_output_axes(),
+        permute(candidate->get_output_shape(0), conv.get_output_axes()));
+
+    auto make_tensor = [this](const std::shared_ptr<Node>& node) {
+        return std::make_shared<PlaidML_Tensor>(nullptr,
+                                                m_config,
+                                                node->get_output_element_type(0),
+                                                node->get_output_shape(0),
+                                                "winograd_tuning",
+                                                nullptr);
+    };
+    std::vector<std::shared_ptr<runtime::Tensor>> inputs{make_tensor(data), make_tensor(filters)};
+    auto result = make_tensor(output);
+    std::vector<char> sink(result->get_element_type().size());
+
+    Algorithm best = Algorithm::DIRECT;
+    std::size_t best_us = std::numeric_limits<std::size_t>::max();
+    for (Algorithm algorithm : s_algorithms)
+    {
+        auto func = std::make_shared<Function>(output, ParameterVector{data, filters});
+        Compiler compiler{m_config, std::make_shared<WinogradTuner>(m_config, algorithm)};
+        std::shared_ptr<PlaidML_Executable> exec;
+        try
+        {
+            exec = compiler.compile(func);
+        }
+        catch (const std::exception& e)
+        {
+            NGRAPH_DEBUG << "Winograd tuning: " << to_string(algorithm)
+                         << " does not compile: " << e.what();
+            continue;
+        }
+
+        // Invocation is asynchronous; reading an element of the result waits for it
+        stopwatch timer;
+        for (std::size_t call = 0; call <= s_timed_calls; ++call)
+        {
+            if (call == 1)
+            {
+                timer.start();
+            }
+            exec->call({result}, inputs);
+            result->read(sink.data(), 0, sink.size());
+        }
+        timer.stop();
+
+        std::size_t us = timer.get_microseconds();
+        NGRAPH_DEBUG << "Winograd tuning: " << make_key(conv) << " " << to_string(algorithm)
+                     << " " << us / s_timed_calls << "us";
+        if (us < best_us)
+        {
+            best_us = us;
+            best = algorithm;
+        }
+    }
+    return best;
+}
+
+void ngraph::runtime::plaidml::WinogradTuner::load()
+{
+    if (m_config->winograd_tuning.empty())
+    {
+        return;
+    }
+    std::ifstream in{m_config->winograd_tuning};
+    std::string key;
+    std::string name;
+    while (in >> key >> name)
+    {
+        for (Algorithm algorithm : s_algorithms)
+        {
+            if (name == to_string(algorithm))
+            {
+                m_table[key] = algorithm;
+            }
+        }
+    }
+}
+
+void ngraph::runtime::plaidml::WinogradTuner::store(const std::string& key, Algorithm algorithm)
+{
+    std::ofstream out{m_config->winograd_tuning, std::ios::app};
+    out << key << " " << to_string(algorithm) << "\n";
+    if (!out)
+    {
+        NGRAPH_WARN << "Unable to record Winograd tuning in " << m_config->winograd_tuning;
+    }
+}
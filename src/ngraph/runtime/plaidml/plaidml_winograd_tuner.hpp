@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2018 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "ngraph/runtime/plaidml/plaidml_config.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace plaidml
+        {
+            class WinogradTuner;
+
+            namespace op
+            {
+                class Convolution;
+            }
+        }
+    }
+}
+
+// Chooses how the Winograd pass computes each 3x3 stride-1 convolution.
+//
+// Without a tuning file the choice is a heuristic.  With one (the "winograd_tuning=<filename>"
+// backend option), each convolution shape not yet in the file is compiled and timed once with
+// every algorithm, and the fastest is appended to the file, so later runs and other processes
+// using the same file skip the measurement.
+class ngraph::runtime::plaidml::WinogradTuner final
+{
+public:
+    enum class Algorithm
+    {
+        DIRECT,
+        // Winograd F(2x2, 3x3): 4x4 input tiles, 2x2 output tiles
+        F2X3,
+        // Winograd F(4x4, 3x3): 6x6 input tiles, 4x4 output tiles
+        F4X3
+    };
+
+    // Selects with the heuristic, or by measurement if config has a tuning file.
+    explicit WinogradTuner(Config* config);
+
+    // Always selects algorithm; used to compile the candidates being measured.
+    WinogradTuner(Config* config, Algorithm algorithm);
+
+    Algorithm select(const op::Convolution& conv);
+
+    static const char* to_string(Algorithm algorithm);
+
+private:
+    static Algorithm heuristic(const op::Convolution& conv);
+    static std::string make_key(const op::Convolution& conv);
+    Algorithm measure(const op::Convolution& conv);
+    void load();
+    void store(const std::string& key, Algorithm algorithm);
+
+    Config* m_config;
+    bool m_fixed;
+    Algorithm m_algorithm;
+    std::mutex m_mu;
+    std::map<std::string, Algorithm> m_table;
+};
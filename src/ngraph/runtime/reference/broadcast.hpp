@@ -18,6 +18,7 @@
 
 #include <cmath>
 
+#include "ngraph/check.hpp"
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/shape_util.hpp"
 
@@ -34,15 +35,11 @@ namespace ngraph
                            const Shape& out_shape,
                            const AxisSet& broadcast_axes)
             {
-                CoordinateTransform input_transform(in_shape);
-                CoordinateTransform output_transform(out_shape);
+                NGRAPH_CHECK(shape_size(reduce(out_shape, broadcast_axes)) == shape_size(in_shape));
 
-                for (const Coordinate& output_coord : output_transform)
+                for (size_t in_index : StridedIndexRange::projection(out_shape, broadcast_axes))
                 {
-                    Coordinate input_coord = reduce(output_coord, broadcast_axes);
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
+                    *out++ = arg[in_index];
                 }
             }
         }
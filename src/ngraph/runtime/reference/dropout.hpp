@@ -0,0 +1,54 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include "ngraph/state/rng_state.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Applies the dropout mask whose counters start at `base` to `arg`. Used by
+            ///        both Dropout and DropoutBackprop, which pass the same base.
+            template <typename T>
+            void dropout(const T* arg,
+                         T* out,
+                         size_t count,
+                         ngraph::RNGState* rng_state,
+                         uint64_t base,
+                         bool training)
+            {
+                if (training)
+                {
+                    T scale = static_cast<T>(1.0 / rng_state->get_probability());
+                    rng_state->sample(base, 0, count, [arg, out, scale](size_t i, bool keep) {
+                        out[i] = keep ? arg[i] * scale : static_cast<T>(0);
+                    });
+                }
+                else
+                {
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = arg[i];
+                    }
+                }
+            }
+        }
+    }
+}
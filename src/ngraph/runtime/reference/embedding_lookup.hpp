@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 #include <cstring>
 
@@ -45,6 +46,51 @@ namespace ngraph
                     out_iter += vec_len;
                 }
             }
+
+            /// \brief Lookup in weights whose row i is weights[i] * scale[i] + bias[i], with the
+            /// rows stored in the quantized type Q
+            template <typename T, typename Q, typename U>
+            void embedding_dequantize(const U* indices,
+                                      const Q* weights,
+                                      const T* scale,
+                                      const T* bias,
+                                      T* out,
+                                      size_t indices_count,
+                                      size_t vec_len)
+            {
+                T* out_iter = out;
+                for (size_t i = 0; i < indices_count; i++)
+                {
+                    size_t row = static_cast<size_t>(indices[i]);
+                    const Q* weights_row = &weights[vec_len * row];
+                    for (size_t j = 0; j < vec_len; j++)
+                    {
+                        out_iter[j] = static_cast<T>(static_cast<float>(weights_row[j])) *
+                                          scale[row] +
+                                      bias[row];
+                    }
+                    out_iter += vec_len;
+                }
+            }
+
+            template <typename T, typename U>
+            void embedding_backprop(const U* indices,
+                                    const T* delta,
+                                    T* out,
+                                    size_t indices_count,
+                                    const Shape& weights_shape)
+            {
+                size_t vec_len = weights_shape.at(1);
+                std::fill(out, out + shape_size(weights_shape), T(0));
+                for (size_t i = 0; i < indices_count; i++)
+                {
+                    T* row = &out[vec_len * static_cast<size_t>(indices[i])];
+                    for (size_t j = 0; j < vec_len; j++)
+                    {
+                        row[j] += delta[vec_len * i + j];
+                    }
+                }
+            }
         }
     }
 }
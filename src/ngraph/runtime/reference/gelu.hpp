@@ -0,0 +1,44 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename T>
+            void gelu(const T* arg, T* out, size_t count, bool approximate)
+            {
+                for (size_t i = 0; i < count; i++)
+                {
+                    T x = arg[i];
+                    T cdf = approximate
+                                ? std::tanh(static_cast<T>(std::sqrt(2.0 / M_PI)) *
+                                            (x + static_cast<T>(0.044715) * x * x * x))
+                                : std::erf(x * static_cast<T>(M_SQRT1_2));
+                    out[i] = static_cast<T>(0.5) * x * (1 + cdf);
+                }
+            }
+        }
+    }
+}
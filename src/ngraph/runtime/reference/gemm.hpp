@@ -0,0 +1,203 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <thread>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            namespace gemm_detail
+            {
+                // Register tile of the micro-kernel, and the cache blocks of the depth and
+                // output-column loops
+                constexpr size_t tile_rows = 4;
+                constexpr size_t tile_cols = 8;
+                constexpr size_t depth_block = 256;
+                constexpr size_t col_block = 512;
+                // Products below this many multiply-adds are not worth starting threads for
+                constexpr size_t parallel_threshold = size_t(1) << 20;
+
+                // Accumulate a partial (rows x cols) tile of C at the edges of the matrix over
+                // depth [l0, l1). Each element of C is summed in increasing depth order, exactly
+                // like the naive triple loop.
+                template <typename T>
+                void edge_tile(const T* a,
+                               const T* b,
+                               T* c,
+                               size_t n,
+                               size_t k,
+                               size_t l0,
+                               size_t l1,
+                               size_t rows,
+                               size_t cols)
+                {
+                    T acc[tile_rows][tile_cols];
+                    for (size_t r = 0; r < rows; r++)
+                    {
+                        for (size_t s = 0; s < cols; s++)
+                        {
+                            acc[r][s] = c[r * n + s];
+                        }
+                    }
+                    for (size_t l = l0; l < l1; l++)
+                    {
+                        const T* b_row = b + l * n;
+                        for (size_t r = 0; r < rows; r++)
+                        {
+                            T a_value = a[r * k + l];
+                            for (size_t s = 0; s < cols; s++)
+                            {
+                                acc[r][s] += a_value * b_row[s];
+                            }
+                        }
+                    }
+                    for (size_t r = 0; r < rows; r++)
+                    {
+                        for (size_t s = 0; s < cols; s++)
+                        {
+                            c[r * n + s] = acc[r][s];
+                        }
+                    }
+                }
+
+                // Full tiles have fixed loop bounds, so that the compiler keeps the accumulators
+                // in registers and vectorizes across the columns
+                template <typename T>
+                void full_tile(
+                    const T* a, const T* b, T* c, size_t n, size_t k, size_t l0, size_t l1)
+                {
+                    T acc[tile_rows][tile_cols];
+                    for (size_t r = 0; r < tile_rows; r++)
+                    {
+                        for (size_t s = 0; s < tile_cols; s++)
+                        {
+                            acc[r][s] = c[r * n + s];
+                        }
+                    }
+                    for (size_t l = l0; l < l1; l++)
+                    {
+                        const T* b_row = b + l * n;
+                        for (size_t r = 0; r < tile_rows; r++)
+                        {
+                            T a_value = a[r * k + l];
+                            for (size_t s = 0; s < tile_cols; s++)
+                            {
+                                acc[r][s] += a_value * b_row[s];
+                            }
+                        }
+                    }
+                    for (size_t r = 0; r < tile_rows; r++)
+                    {
+                        for (size_t s = 0; s < tile_cols; s++)
+                        {
+                            c[r * n + s] = acc[r][s];
+                        }
+                    }
+                }
+
+                template <typename T>
+                void gemm_rows(const T* a,
+                               const T* b,
+                               T* c,
+                               size_t row_begin,
+                               size_t row_end,
+                               size_t n,
+                               size_t k)
+                {
+                    for (size_t l0 = 0; l0 < k; l0 += depth_block)
+                    {
+                        size_t l1 = std::min(k, l0 + depth_block);
+                        for (size_t j0 = 0; j0 < n; j0 += col_block)
+                        {
+                            size_t j1 = std::min(n, j0 + col_block);
+                            for (size_t i = row_begin; i < row_end; i += tile_rows)
+                            {
+                                size_t rows = std::min(tile_rows, row_end - i);
+                                for (size_t j = j0; j < j1; j += tile_cols)
+                                {
+                                    size_t cols = std::min(tile_cols, j1 - j);
+                                    const T* a_tile = a + i * k;
+                                    T* c_tile = c + i * n + j;
+                                    if (rows == tile_rows && cols == tile_cols)
+                                    {
+                                        full_tile(a_tile, b + j, c_tile, n, k, l0, l1);
+                                    }
+                                    else
+                                    {
+                                        edge_tile(
+                                            a_tile, b + j, c_tile, n, k, l0, l1, rows, cols);
+                                    }
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+
+            /// \brief Row-major C = A * B, with A of shape (m, k), B (k, n) and C (m, n).
+            ///
+            /// The product is computed in cache blocks of register tiles, and large products
+            /// split their rows across threads. Every element is accumulated in increasing k
+            /// order, so the result matches the naive triple loop exactly.
+            template <typename T>
+            void gemm(const T* a, const T* b, T* c, size_t m, size_t n, size_t k)
+            {
+                using namespace gemm_detail;
+                std::fill(c, c + m * n, T(0));
+
+                size_t thread_count = 1;
+                if (m * n * k >= parallel_threshold)
+                {
+                    size_t hardware_threads = std::max(1u, std::thread::hardware_concurrency());
+                    thread_count = std::min(hardware_threads, (m + tile_rows - 1) / tile_rows);
+                }
+                if (thread_count <= 1)
+                {
+                    gemm_rows(a, b, c, 0, m, n, k);
+                    return;
+                }
+
+                // whole tiles per thread, so that only the last thread has a partial tile
+                size_t tiles = (m + tile_rows - 1) / tile_rows;
+                size_t tiles_per_thread = (tiles + thread_count - 1) / thread_count;
+                std::vector<std::thread> threads;
+                for (size_t t = 1; t < thread_count; t++)
+                {
+                    size_t row_begin = std::min(m, t * tiles_per_thread * tile_rows);
+                    size_t row_end = std::min(m, (t + 1) * tiles_per_thread * tile_rows);
+                    if (row_begin < row_end)
+                    {
+                        threads.emplace_back(gemm_rows<T>, a, b, c, row_begin, row_end, n, k);
+                    }
+                }
+                gemm_rows(a, b, c, 0, std::min(m, tiles_per_thread * tile_rows), n, k);
+                for (auto& thread : threads)
+                {
+                    thread.join();
+                }
+            }
+        }
+    }
+}
@@ -16,8 +16,6 @@
 
 #pragma once
 
-#include <random>
-
 #include "ngraph/state/rng_state.hpp"
 
 namespace ngraph
@@ -29,12 +27,16 @@ namespace ngraph
             template <typename T>
             void generate_mask(T* out, size_t count, ngraph::RNGState* rng_state, bool training)
             {
-                auto& gen = rng_state->get_generator();
-                auto& bd = rng_state->get_distribution();
-
-                for (size_t i = 0; i < count; i++)
+                if (training)
+                {
+                    rng_state->generate(out, rng_state->reserve(count), 0, count);
+                }
+                else
                 {
-                    out[i] = training ? static_cast<T>(bd(gen)) : static_cast<T>(1);
+                    for (size_t i = 0; i < count; i++)
+                    {
+                        out[i] = static_cast<T>(1);
+                    }
                 }
             }
         }
@@ -0,0 +1,81 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cmath>
+#include <cstddef>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Normalizes the rows in [begin, end) of a (rows, row_size) matrix.
+            template <typename T>
+            void layer_norm_rows(const T* arg,
+                                 const T* gamma,
+                                 const T* beta,
+                                 T* out,
+                                 size_t row_size,
+                                 double epsilon,
+                                 size_t begin,
+                                 size_t end)
+            {
+                for (size_t row = begin; row < end; row++)
+                {
+                    const T* in_row = arg + row * row_size;
+                    T* out_row = out + row * row_size;
+
+                    T mean = 0;
+                    for (size_t i = 0; i < row_size; i++)
+                    {
+                        mean += in_row[i];
+                    }
+                    mean /= row_size;
+
+                    T variance = 0;
+                    for (size_t i = 0; i < row_size; i++)
+                    {
+                        T centered = in_row[i] - mean;
+                        variance += centered * centered;
+                    }
+                    variance /= row_size;
+
+                    T inv_stddev = 1 / std::sqrt(variance + static_cast<T>(epsilon));
+                    for (size_t i = 0; i < row_size; i++)
+                    {
+                        out_row[i] = (in_row[i] - mean) * inv_stddev * gamma[i] + beta[i];
+                    }
+                }
+            }
+
+            template <typename T>
+            void layer_norm(const T* arg,
+                            const T* gamma,
+                            const T* beta,
+                            T* out,
+                            size_t rows,
+                            size_t row_size,
+                            double epsilon)
+            {
+                layer_norm_rows(arg, gamma, beta, out, row_size, epsilon, 0, rows);
+            }
+        }
+    }
+}
@@ -0,0 +1,176 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief The aspect ratios of the boxes around each prior center: 1, then each
+            ///        distinct ratio and, with `flip`, its reciprocal.
+            inline std::vector<float> prior_box_aspect_ratios(const std::vector<float>& ratios,
+                                                              bool flip)
+            {
+                std::vector<float> result{1.0f};
+                auto add = [&result](float ratio) {
+                    for (float r : result)
+                    {
+                        if (std::fabs(ratio - r) < 1e-6f)
+                        {
+                            return;
+                        }
+                    }
+                    result.push_back(ratio);
+                };
+                for (float ratio : ratios)
+                {
+                    add(ratio);
+                    if (flip)
+                    {
+                        add(1.0f / ratio);
+                    }
+                }
+                return result;
+            }
+
+            /// \brief Number of boxes that prior_box generates around each center
+            inline size_t prior_box_count(const std::vector<float>& min_sizes,
+                                          const std::vector<float>& max_sizes,
+                                          const std::vector<float>& aspect_ratios,
+                                          bool flip,
+                                          bool scale_all)
+            {
+                size_t ratio_count = prior_box_aspect_ratios(aspect_ratios, flip).size();
+                size_t count = 0;
+                for (size_t i = 0; i < min_sizes.size(); i++)
+                {
+                    count += 1 + (i < max_sizes.size() ? 1 : 0);
+                    if (scale_all || i + 1 == min_sizes.size())
+                    {
+                        count += ratio_count - 1;
+                    }
+                }
+                return count;
+            }
+
+            /// \brief Generates the SSD prior boxes of a layer_height x layer_width feature map
+            ///        for an image_height x image_width image.
+            ///
+            /// `out` has shape {2, 4 * layer_height * layer_width * prior_box_count(...)}. Row
+            /// 0 holds the corners {xmin, ymin, xmax, ymax} of each box normalized to the image
+            /// size, and row 1 the variances of each coordinate.
+            ///
+            /// Around each center there is, for each min size, a square of that size, a square
+            /// of size sqrt(min * max) when the max size exists, and then one box per aspect
+            /// ratio other than 1. Without `scale_all` the aspect ratio boxes are only made for
+            /// the first min size, after the squares of every min size.
+            template <typename T>
+            void prior_box(T* out,
+                           int64_t layer_height,
+                           int64_t layer_width,
+                           int64_t image_height,
+                           int64_t image_width,
+                           const std::vector<float>& min_sizes,
+                           const std::vector<float>& max_sizes,
+                           const std::vector<float>& aspect_ratios,
+                           bool clip,
+                           bool flip,
+                           float step,
+                           float offset,
+                           const std::vector<float>& variances,
+                           bool scale_all)
+            {
+                std::vector<float> ratios = prior_box_aspect_ratios(aspect_ratios, flip);
+                float step_x = step;
+                float step_y = step;
+                if (step == 0)
+                {
+                    step_x = static_cast<float>(image_width) / layer_width;
+                    step_y = static_cast<float>(image_height) / layer_height;
+                }
+
+                T* box = out;
+                auto add_box = [&](float center_x, float center_y, float width, float height) {
+                    float coordinates[] = {(center_x - width / 2) / image_width,
+                                           (center_y - height / 2) / image_height,
+                                           (center_x + width / 2) / image_width,
+                                           (center_y + height / 2) / image_height};
+                    for (float coordinate : coordinates)
+                    {
+                        *box++ = static_cast<T>(
+                            clip ? std::min(std::max(coordinate, 0.0f), 1.0f) : coordinate);
+                    }
+                };
+
+                for (int64_t h = 0; h < layer_height; h++)
+                {
+                    for (int64_t w = 0; w < layer_width; w++)
+                    {
+                        float center_x = (w + offset) * step_x;
+                        float center_y = (h + offset) * step_y;
+                        for (size_t i = 0; i < min_sizes.size(); i++)
+                        {
+                            float min_size = min_sizes[i];
+                            add_box(center_x, center_y, min_size, min_size);
+                            if (i < max_sizes.size())
+                            {
+                                float size = std::sqrt(min_size * max_sizes[i]);
+                                add_box(center_x, center_y, size, size);
+                            }
+                            if (scale_all || i + 1 == min_sizes.size())
+                            {
+                                float ratio_size = scale_all ? min_size : min_sizes[0];
+                                for (size_t r = 1; r < ratios.size(); r++)
+                                {
+                                    float scale = std::sqrt(ratios[r]);
+                                    add_box(center_x,
+                                            center_y,
+                                            ratio_size * scale,
+                                            ratio_size / scale);
+                                }
+                            }
+                        }
+                    }
+                }
+
+                // variances, one per coordinate or one for all
+                size_t coordinate_count = box - out;
+                for (size_t i = 0; i < coordinate_count; i++)
+                {
+                    float variance = 0.1f;
+                    if (variances.size() == 1)
+                    {
+                        variance = variances[0];
+                    }
+                    else if (variances.size() == 4)
+                    {
+                        variance = variances[i % 4];
+                    }
+                    box[i] = static_cast<T>(variance);
+                }
+            }
+        }
+    }
+}
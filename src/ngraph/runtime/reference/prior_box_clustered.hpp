@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Generates the prior boxes of a layer_height x layer_width feature map for
+            ///        an image_height x image_width image, with one box of each of the given
+            ///        widths and heights around each center.
+            ///
+            /// `out` has shape {2, 4 * layer_height * layer_width * widths.size()}, the box
+            /// corners normalized to the image size and then their variances, as for
+            /// prior_box.
+            template <typename T>
+            void prior_box_clustered(T* out,
+                                     int64_t layer_height,
+                                     int64_t layer_width,
+                                     int64_t image_height,
+                                     int64_t image_width,
+                                     const std::vector<float>& widths,
+                                     const std::vector<float>& heights,
+                                     bool clip,
+                                     float step_widths,
+                                     float step_heights,
+                                     float offset,
+                                     const std::vector<float>& variances)
+            {
+                float step_x = step_widths;
+                float step_y = step_heights;
+                if (step_x == 0 && step_y == 0)
+                {
+                    step_x = static_cast<float>(image_width) / layer_width;
+                    step_y = static_cast<float>(image_height) / layer_height;
+                }
+
+                T* box = out;
+                for (int64_t h = 0; h < layer_height; h++)
+                {
+                    for (int64_t w = 0; w < layer_width; w++)
+                    {
+                        float center_x = (w + offset) * step_x;
+                        float center_y = (h + offset) * step_y;
+                        for (size_t i = 0; i < widths.size(); i++)
+                        {
+                            float coordinates[] = {(center_x - widths[i] / 2) / image_width,
+                                                   (center_y - heights[i] / 2) / image_height,
+                                                   (center_x + widths[i] / 2) / image_width,
+                                                   (center_y + heights[i] / 2) / image_height};
+                            for (float coordinate : coordinates)
+                            {
+                                *box++ = static_cast<T>(
+                                    clip ? std::min(std::max(coordinate, 0.0f), 1.0f)
+                                         : coordinate);
+                            }
+                        }
+                    }
+                }
+
+                size_t coordinate_count = box - out;
+                for (size_t i = 0; i < coordinate_count; i++)
+                {
+                    float variance = 0.1f;
+                    if (variances.size() == 1)
+                    {
+                        variance = variances[0];
+                    }
+                    else if (variances.size() == 4)
+                    {
+                        variance = variances[i % 4];
+                    }
+                    box[i] = static_cast<T>(variance);
+                }
+            }
+        }
+    }
+}
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
 
 #include "ngraph/coordinate_transform.hpp"
@@ -34,21 +35,11 @@ namespace ngraph
                          const Shape& out_shape,
                          const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
+                std::fill(out, out + shape_size(out_shape), 1);
 
-                for (const Coordinate& output_coord : output_transform)
+                for (size_t out_index : StridedIndexRange::projection(in_shape, reduction_axes))
                 {
-                    out[output_transform.index(output_coord)] = 1;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-
-                    out[output_transform.index(output_coord)] *=
-                        arg[input_transform.index(input_coord)];
+                    out[out_index] *= *arg++;
                 }
             }
         }
@@ -42,21 +42,14 @@ namespace ngraph
 
                 CoordinateTransform input_transform(
                     in_shape, in_start_corner, in_shape, in_strides, in_axis_order);
-                CoordinateTransform output_transform(out_shape);
 
                 NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
+                             shape_size(out_shape));
 
-                CoordinateTransform::Iterator output_it = output_transform.begin();
-
-                for (const Coordinate& input_coord : input_transform)
+                // the output is written densely, in the order the transposed input is visited
+                for (size_t in_index : input_transform.source_indices())
                 {
-                    const Coordinate& output_coord = *output_it;
-
-                    out[output_transform.index(output_coord)] =
-                        arg[input_transform.index(input_coord)];
-
-                    ++output_it;
+                    *out++ = arg[in_index];
                 }
             }
         }
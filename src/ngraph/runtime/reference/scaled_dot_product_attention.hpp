@@ -0,0 +1,145 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "ngraph/shape.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            /// \brief Computes the attention of the query rows [begin, end), counting the rows
+            ///        of all batches in order, for ScaledDotProductAttention.
+            ///
+            /// The keys are visited in blocks of `block_size` and the softmax is accumulated
+            /// online: the running maximum of the scores of a row rescales its running sum
+            /// and output, so only the scores of one block are kept at a time.
+            template <typename T>
+            void scaled_dot_product_attention_rows(const T* query,
+                                                   const T* key,
+                                                   const T* value,
+                                                   const T* mask,
+                                                   T* out,
+                                                   const Shape& query_shape,
+                                                   const Shape& value_shape,
+                                                   double scale,
+                                                   size_t begin,
+                                                   size_t end,
+                                                   size_t block_size = 64)
+            {
+                const size_t q_len = query_shape[1];
+                const size_t depth = query_shape[2];
+                const size_t kv_len = value_shape[1];
+                const size_t value_depth = value_shape[2];
+                const T t_scale = static_cast<T>(scale);
+
+                std::vector<T> scores(std::min(block_size, kv_len));
+                std::vector<T> acc(value_depth);
+                for (size_t row = begin; row < end; row++)
+                {
+                    const size_t batch = row / q_len;
+                    const T* q = query + row * depth;
+                    const T* k_batch = key + batch * kv_len * depth;
+                    const T* v_batch = value + batch * kv_len * value_depth;
+                    const T* mask_row = mask ? mask + row * kv_len : nullptr;
+
+                    T row_max = -std::numeric_limits<T>::infinity();
+                    T row_sum = 0;
+                    std::fill(acc.begin(), acc.end(), static_cast<T>(0));
+                    for (size_t first = 0; first < kv_len; first += block_size)
+                    {
+                        const size_t last = std::min(first + block_size, kv_len);
+                        T block_max = -std::numeric_limits<T>::infinity();
+                        for (size_t j = first; j < last; j++)
+                        {
+                            const T* k = k_batch + j * depth;
+                            T dot = 0;
+                            for (size_t d = 0; d < depth; d++)
+                            {
+                                dot += q[d] * k[d];
+                            }
+                            T score = dot * t_scale + (mask_row ? mask_row[j] : static_cast<T>(0));
+                            scores[j - first] = score;
+                            block_max = std::max(block_max, score);
+                        }
+                        if (block_max == -std::numeric_limits<T>::infinity())
+                        {
+                            // the whole block is masked out
+                            continue;
+                        }
+
+                        // rescale what was accumulated under the previous maximum
+                        const T new_max = std::max(row_max, block_max);
+                        const T correction = std::exp(row_max - new_max);
+                        row_sum *= correction;
+                        for (size_t d = 0; d < value_depth; d++)
+                        {
+                            acc[d] *= correction;
+                        }
+                        for (size_t j = first; j < last; j++)
+                        {
+                            const T p = std::exp(scores[j - first] - new_max);
+                            const T* v = v_batch + j * value_depth;
+                            row_sum += p;
+                            for (size_t d = 0; d < value_depth; d++)
+                            {
+                                acc[d] += p * v[d];
+                            }
+                        }
+                        row_max = new_max;
+                    }
+
+                    T* out_row = out + row * value_depth;
+                    for (size_t d = 0; d < value_depth; d++)
+                    {
+                        out_row[d] = acc[d] / row_sum;
+                    }
+                }
+            }
+
+            template <typename T>
+            void scaled_dot_product_attention(const T* query,
+                                              const T* key,
+                                              const T* value,
+                                              const T* mask,
+                                              T* out,
+                                              const Shape& query_shape,
+                                              const Shape& value_shape,
+                                              double scale)
+            {
+                scaled_dot_product_attention_rows(query,
+                                                  key,
+                                                  value,
+                                                  mask,
+                                                  out,
+                                                  query_shape,
+                                                  value_shape,
+                                                  scale,
+                                                  0,
+                                                  query_shape[0] * query_shape[1]);
+            }
+        }
+    }
+}
@@ -0,0 +1,45 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <cstring>
+
+#include "ngraph/distributed.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace reference
+        {
+            template <typename T>
+            void send(const T* arg,
+                      T* out,
+                      const element::Type_t element_type,
+                      size_t count,
+                      int dest_rank,
+                      int tag)
+            {
+                get_distributed_interface()->send(arg, element_type, count, dest_rank, tag);
+                if (arg != out)
+                {
+                    memcpy(out, arg, count * sizeof(T));
+                }
+            }
+        }
+    }
+}
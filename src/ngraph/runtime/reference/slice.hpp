@@ -37,20 +37,14 @@ namespace ngraph
                        const Shape& out_shape)
             {
                 CoordinateTransform input_transform(arg_shape, lower_bounds, upper_bounds, strides);
-                CoordinateTransform output_transform(out_shape);
-
-                CoordinateTransform::Iterator output_it = output_transform.begin();
 
                 NGRAPH_CHECK(shape_size(input_transform.get_target_shape()) ==
-                             shape_size(output_transform.get_target_shape()));
+                             shape_size(out_shape));
 
-                for (const Coordinate& in_coord : input_transform)
+                // the output is written densely, in the order the input window is visited
+                for (size_t in_index : input_transform.source_indices())
                 {
-                    const Coordinate& out_coord = *output_it;
-
-                    out[output_transform.index(out_coord)] = arg[input_transform.index(in_coord)];
-
-                    ++output_it;
+                    *out++ = arg[in_index];
                 }
             }
         }
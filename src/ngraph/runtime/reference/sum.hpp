@@ -16,7 +16,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cmath>
+#include <vector>
 
 #include "ngraph/coordinate_transform.hpp"
 #include "ngraph/shape_util.hpp"
@@ -34,26 +36,16 @@ namespace ngraph
                      const Shape& out_shape,
                      const AxisSet& reduction_axes)
             {
-                CoordinateTransform output_transform(out_shape);
-                std::vector<T> c(shape_size(out_shape));
+                std::vector<T> c(shape_size(out_shape), 0);
+                std::fill(out, out + shape_size(out_shape), 0);
 
-                for (const Coordinate& output_coord : output_transform)
+                // Kahan summation of each input element into its reduced output element
+                for (size_t out_index : StridedIndexRange::projection(in_shape, reduction_axes))
                 {
-                    out[output_transform.index(output_coord)] = 0;
-                    c[output_transform.index(output_coord)] = 0;
-                }
-
-                CoordinateTransform input_transform(in_shape);
-
-                for (const Coordinate& input_coord : input_transform)
-                {
-                    Coordinate output_coord = reduce(input_coord, reduction_axes);
-                    T y = arg[input_transform.index(input_coord)] -
-                          c[output_transform.index(output_coord)];
-                    T t = out[output_transform.index(output_coord)] + y;
-                    c[output_transform.index(output_coord)] =
-                        (t - out[output_transform.index(output_coord)]) - y;
-                    out[output_transform.index(output_coord)] = t;
+                    T y = *arg++ - c[out_index];
+                    T t = out[out_index] + y;
+                    c[out_index] = (t - out[out_index]) - y;
+                    out[out_index] = t;
                 }
             }
         }
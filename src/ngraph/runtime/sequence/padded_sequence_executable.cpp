@@ -0,0 +1,261 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "ngraph/check.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/runtime/sequence/padded_sequence_executable.hpp"
+#include "ngraph/specialize_shapes.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+runtime::sequence::PaddedSequenceExecutable::PaddedSequenceExecutable(
+    const shared_ptr<Backend>& backend,
+    const shared_ptr<Function>& function,
+    size_t max_length,
+    const shared_ptr<op::Parameter>& length,
+    bool enable_performance_collection)
+    : m_backend(backend)
+    , m_max_length(max_length)
+{
+    NGRAPH_CHECK(m_max_length > 0, "Maximum sequence length must be positive");
+
+    const ParameterVector& parameters = function->get_parameters();
+    m_length_index = parameters.size();
+    ParameterVector call_parameters;
+    vector<element::Type> element_types;
+    vector<PartialShape> shapes;
+    bool has_sequence = false;
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        const element::Type& element_type = parameters[i]->get_element_type();
+        if (parameters[i] == length)
+        {
+            NGRAPH_CHECK(
+                (element_type == element::i32 || element_type == element::i64) &&
+                    length->get_output_partial_shape(0).compatible(PartialShape{}),
+                "The length parameter must be an i32 or i64 scalar");
+            m_length_index = i;
+            element_types.push_back(element_type);
+            shapes.push_back(PartialShape{});
+            continue;
+        }
+        m_inputs.push_back(make_binding(parameters[i]->get_output_partial_shape(0),
+                                        element_type,
+                                        "Parameter " + to_string(i)));
+        auto& binding = m_inputs.back();
+        has_sequence = has_sequence || binding.is_sequence;
+        element_types.push_back(element_type);
+        shapes.push_back(binding.is_sequence ? PartialShape(binding.padded->get_shape())
+                                             : parameters[i]->get_output_partial_shape(0));
+        call_parameters.push_back(parameters[i]);
+    }
+    NGRAPH_CHECK(length == nullptr || m_length_index < parameters.size(),
+                 "The length parameter is not a parameter of the function");
+    NGRAPH_CHECK(has_sequence, "The function has no parameter with a sequence axis");
+
+    // One compilation for the longest sequences
+    auto padded_function = specialize_shapes(function, element_types, shapes);
+    m_executable = m_backend->compile(padded_function, enable_performance_collection);
+
+    const ResultVector& results = function->get_results();
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        m_outputs.push_back(make_binding(results[i]->get_output_partial_shape(0),
+                                         results[i]->get_element_type(),
+                                         "Result " + to_string(i)));
+        auto& binding = m_outputs.back();
+        const Shape& padded_shape = m_executable->get_results().at(i)->get_shape();
+        NGRAPH_CHECK(!binding.is_sequence || padded_shape == binding.padded->get_shape(),
+                     "Result ",
+                     i,
+                     " has the padded shape ",
+                     padded_shape,
+                     ", its dynamic dimension is not the sequence length");
+    }
+    if (length)
+    {
+        m_length = m_backend->create_tensor(length->get_element_type(), Shape{});
+    }
+    set_parameters_and_results(call_parameters, results);
+}
+
+runtime::sequence::PaddedSequenceExecutable::~PaddedSequenceExecutable()
+{
+}
+
+runtime::sequence::PaddedSequenceExecutable::Binding
+    runtime::sequence::PaddedSequenceExecutable::make_binding(const PartialShape& shape,
+                                                              const element::Type& element_type,
+                                                              const string& name)
+{
+    NGRAPH_CHECK(shape.rank().is_static() && element_type.is_static(),
+                 name,
+                 " must have a static rank and element type");
+    Binding binding;
+    size_t rank = static_cast<size_t>(shape.rank());
+    for (size_t i = 0; i < rank; i++)
+    {
+        if (shape[i].is_dynamic())
+        {
+            NGRAPH_CHECK(!binding.is_sequence,
+                         name,
+                         " has the shape ",
+                         shape,
+                         ", only the sequence dimension may be dynamic");
+            binding.is_sequence = true;
+            binding.axis = i;
+        }
+    }
+    if (binding.is_sequence)
+    {
+        Shape padded_shape(rank);
+        binding.outer = 1;
+        binding.inner_bytes = element_type.size();
+        for (size_t i = 0; i < rank; i++)
+        {
+            padded_shape[i] = i == binding.axis ? m_max_length : size_t(shape[i]);
+            if (i < binding.axis)
+            {
+                binding.outer *= padded_shape[i];
+            }
+            else if (i > binding.axis)
+            {
+                binding.inner_bytes *= padded_shape[i];
+            }
+        }
+        binding.padded = m_backend->create_tensor(element_type, padded_shape);
+        binding.staging.resize(shape_size(padded_shape) * element_type.size());
+    }
+    return binding;
+}
+
+bool runtime::sequence::PaddedSequenceExecutable::call(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == m_inputs.size() && outputs.size() == m_outputs.size(),
+                 "Expected ",
+                 m_inputs.size(),
+                 " inputs and ",
+                 m_outputs.size(),
+                 " outputs, got ",
+                 inputs.size(),
+                 " and ",
+                 outputs.size());
+
+    size_t length = 0;
+    bool has_length = false;
+    vector<shared_ptr<runtime::Tensor>> padded_inputs;
+    vector<char> unpadded;
+    for (size_t i = 0; i < inputs.size(); i++)
+    {
+        Binding& binding = m_inputs[i];
+        if (!binding.is_sequence)
+        {
+            padded_inputs.push_back(inputs[i]);
+            continue;
+        }
+        size_t input_length = inputs[i]->get_shape().at(binding.axis);
+        NGRAPH_CHECK(!has_length || input_length == length,
+                     "Input ",
+                     i,
+                     " has the sequence length ",
+                     input_length,
+                     ", other inputs have ",
+                     length);
+        NGRAPH_CHECK(input_length <= m_max_length,
+                     "Sequence length ",
+                     input_length,
+                     " is over the maximum of ",
+                     m_max_length);
+        length = input_length;
+        has_length = true;
+
+        // Copy each run of positions to the front of its padded run and zero the rest
+        size_t run_bytes = length * binding.inner_bytes;
+        size_t padded_run_bytes = m_max_length * binding.inner_bytes;
+        unpadded.resize(binding.outer * run_bytes);
+        inputs[i]->read(unpadded.data(), 0, unpadded.size());
+        for (size_t j = 0; j < binding.outer; j++)
+        {
+            char* padded_run = binding.staging.data() + j * padded_run_bytes;
+            memcpy(padded_run, unpadded.data() + j * run_bytes, run_bytes);
+            memset(padded_run + run_bytes, 0, padded_run_bytes - run_bytes);
+        }
+        binding.padded->write(binding.staging.data(), 0, binding.staging.size());
+        padded_inputs.push_back(binding.padded);
+    }
+    if (m_length)
+    {
+        if (m_length->get_element_type() == element::i64)
+        {
+            int64_t value = length;
+            m_length->write(&value, 0, sizeof(value));
+        }
+        else
+        {
+            int32_t value = length;
+            m_length->write(&value, 0, sizeof(value));
+        }
+        padded_inputs.insert(padded_inputs.begin() + m_length_index, m_length);
+    }
+
+    vector<shared_ptr<runtime::Tensor>> padded_outputs;
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        Binding& binding = m_outputs[i];
+        if (binding.is_sequence)
+        {
+            NGRAPH_CHECK(outputs[i]->get_shape().at(binding.axis) == length,
+                         "Output ",
+                         i,
+                         " has the sequence length ",
+                         outputs[i]->get_shape().at(binding.axis),
+                         ", the inputs have ",
+                         length);
+        }
+        padded_outputs.push_back(binding.is_sequence ? binding.padded : outputs[i]);
+    }
+
+    if (!m_executable->call(padded_outputs, padded_inputs))
+    {
+        return false;
+    }
+
+    for (size_t i = 0; i < outputs.size(); i++)
+    {
+        Binding& binding = m_outputs[i];
+        if (!binding.is_sequence)
+        {
+            continue;
+        }
+        size_t run_bytes = length * binding.inner_bytes;
+        size_t padded_run_bytes = m_max_length * binding.inner_bytes;
+        binding.padded->read(binding.staging.data(), 0, binding.staging.size());
+        unpadded.resize(binding.outer * run_bytes);
+        for (size_t j = 0; j < binding.outer; j++)
+        {
+            memcpy(unpadded.data() + j * run_bytes,
+                   binding.staging.data() + j * padded_run_bytes,
+                   run_bytes);
+        }
+        outputs[i]->write(unpadded.data(), 0, unpadded.size());
+    }
+    return true;
+}
@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace sequence
+        {
+            class PaddedSequenceExecutable;
+        }
+    }
+}
+
+///
+/// \brief Executable that runs a Function over sequences of any length up to `max_length`
+///        with a single compilation, instead of one specialized compilation per length.
+///
+/// Every parameter and result of `function` either has a static shape or a static rank with a
+/// single dynamic dimension, which is the sequence axis. The function is specialized once with
+/// `max_length` in place of the dynamic dimensions and compiled on `backend`, so the primitives
+/// and the memory plan are built once and shared by all lengths.
+///
+/// On each call the sequence inputs, which must all have the same length, are copied into
+/// preallocated tensors and padded with zeros up to `max_length`. Sequence results are cut back
+/// to the call's length. Static inputs and results are bound directly.
+///
+/// Padded positions are computed like any other. If the function is given a `length`
+/// parameter, a scalar i32 or i64, the executable sets it to the call's length, so the graph
+/// can mask padded positions out of reductions such as the loss. `length` is not one of the
+/// inputs of `call`.
+///
+class ngraph::runtime::sequence::PaddedSequenceExecutable : public ngraph::runtime::Executable
+{
+public:
+    PaddedSequenceExecutable(const std::shared_ptr<Backend>& backend,
+                             const std::shared_ptr<Function>& function,
+                             size_t max_length,
+                             const std::shared_ptr<op::Parameter>& length = nullptr,
+                             bool enable_performance_collection = false);
+    ~PaddedSequenceExecutable() override;
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    size_t get_max_length() const { return m_max_length; }
+    /// \brief The compiled executable, specialized to `max_length`
+    std::shared_ptr<Executable> get_padded_executable() const { return m_executable; }
+
+private:
+    // A parameter or result, with the sequence axis of its unpadded shape if it has one
+    struct Binding
+    {
+        bool is_sequence = false;
+        size_t axis = 0;
+        // elements before the sequence axis, and bytes of one position along it
+        size_t outer = 0;
+        size_t inner_bytes = 0;
+        std::shared_ptr<runtime::Tensor> padded;
+        std::vector<char> staging;
+    };
+
+    Binding make_binding(const PartialShape& shape,
+                         const element::Type& element_type,
+                         const std::string& name);
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Executable> m_executable;
+    size_t m_max_length;
+    // index of `length` among the parameters of `function`, if given
+    size_t m_length_index;
+    std::shared_ptr<runtime::Tensor> m_length;
+    std::vector<Binding> m_inputs;
+    std::vector<Binding> m_outputs;
+};
@@ -0,0 +1,201 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "ngraph/runtime/stateful/stateful_executable.hpp"
+#include "ngraph/check.hpp"
+#include "ngraph/op/result.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+void runtime::stateful::StatefulExecutable::Stream::reset()
+{
+    for (auto& state : m_states)
+    {
+        state->reset();
+    }
+}
+
+vector<vector<char>> runtime::stateful::StatefulExecutable::Stream::snapshot() const
+{
+    vector<vector<char>> snapshot;
+    for (auto& state : m_states)
+    {
+        snapshot.push_back(state->snapshot());
+    }
+    return snapshot;
+}
+
+void runtime::stateful::StatefulExecutable::Stream::restore(
+    const vector<vector<char>>& snapshot)
+{
+    NGRAPH_CHECK(snapshot.size() == m_states.size(),
+                 "Snapshot of ",
+                 snapshot.size(),
+                 " states restored to a stream of ",
+                 m_states.size());
+    for (size_t i = 0; i < m_states.size(); i++)
+    {
+        m_states[i]->restore(snapshot[i]);
+    }
+}
+
+runtime::stateful::StatefulExecutable::StatefulExecutable(
+    const shared_ptr<Backend>& backend,
+    const shared_ptr<Function>& function,
+    const vector<StateBinding>& state_bindings,
+    bool enable_performance_collection)
+    : m_backend(backend)
+    , m_state_bindings(state_bindings)
+{
+    const ParameterVector& parameters = function->get_parameters();
+    const ResultVector& results = function->get_results();
+    m_parameter_states.assign(parameters.size(), -1);
+    m_result_states.assign(results.size(), -1);
+    for (size_t i = 0; i < m_state_bindings.size(); i++)
+    {
+        size_t parameter_index = m_state_bindings[i].parameter_index;
+        size_t result_index = m_state_bindings[i].result_index;
+        NGRAPH_CHECK(parameter_index < parameters.size() && result_index < results.size(),
+                     "State ",
+                     i,
+                     " binds parameter ",
+                     parameter_index,
+                     " and result ",
+                     result_index,
+                     ", the function has ",
+                     parameters.size(),
+                     " parameters and ",
+                     results.size(),
+                     " results");
+        NGRAPH_CHECK(m_parameter_states[parameter_index] < 0 && m_result_states[result_index] < 0,
+                     "State ",
+                     i,
+                     " binds a parameter or result already bound to another state");
+        auto& parameter = parameters[parameter_index];
+        auto& result = results[result_index];
+        NGRAPH_CHECK(parameter->get_output_partial_shape(0).is_static() &&
+                         parameter->get_element_type().is_static() &&
+                         parameter->get_element_type() == result->get_element_type() &&
+                         parameter->get_output_partial_shape(0).same_scheme(
+                             result->get_output_partial_shape(0)),
+                     "State ",
+                     i,
+                     " binds parameter ",
+                     parameter_index,
+                     " (",
+                     parameter->get_element_type(),
+                     " ",
+                     parameter->get_output_partial_shape(0),
+                     ") and result ",
+                     result_index,
+                     " (",
+                     result->get_element_type(),
+                     " ",
+                     result->get_output_partial_shape(0),
+                     "), they must have the same static element type and shape");
+        m_state_parameters.push_back(parameter);
+        m_parameter_states[parameter_index] = i;
+        m_result_states[result_index] = i;
+    }
+
+    m_executable = m_backend->compile(function, enable_performance_collection);
+
+    ParameterVector call_parameters;
+    for (size_t i = 0; i < parameters.size(); i++)
+    {
+        if (m_parameter_states[i] < 0)
+        {
+            call_parameters.push_back(parameters[i]);
+        }
+    }
+    ResultVector call_results;
+    for (size_t i = 0; i < results.size(); i++)
+    {
+        if (m_result_states[i] < 0)
+        {
+            call_results.push_back(results[i]);
+        }
+    }
+    set_parameters_and_results(call_parameters, call_results);
+    m_default_stream = create_stream();
+}
+
+runtime::stateful::StatefulExecutable::~StatefulExecutable()
+{
+}
+
+shared_ptr<runtime::stateful::StatefulExecutable::Stream>
+    runtime::stateful::StatefulExecutable::create_stream() const
+{
+    auto stream = make_shared<Stream>();
+    for (auto& parameter : m_state_parameters)
+    {
+        stream->m_states.push_back(make_shared<TensorState>(
+            m_backend->create_tensor(parameter->get_element_type(), parameter->get_shape()),
+            m_backend->create_tensor(parameter->get_element_type(), parameter->get_shape())));
+    }
+    return stream;
+}
+
+bool runtime::stateful::StatefulExecutable::call(
+    Stream& stream,
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    NGRAPH_CHECK(stream.m_states.size() == m_state_bindings.size(),
+                 "The stream was not made by this executable");
+    NGRAPH_CHECK(inputs.size() == get_parameters().size() &&
+                     outputs.size() == get_results().size(),
+                 "Expected ",
+                 get_parameters().size(),
+                 " inputs and ",
+                 get_results().size(),
+                 " outputs, got ",
+                 inputs.size(),
+                 " and ",
+                 outputs.size());
+
+    vector<shared_ptr<runtime::Tensor>> all_inputs;
+    auto input = inputs.begin();
+    for (int64_t state : m_parameter_states)
+    {
+        all_inputs.push_back(state < 0 ? *input++ : stream.m_states[state]->get_current());
+    }
+    vector<shared_ptr<runtime::Tensor>> all_outputs;
+    auto output = outputs.begin();
+    for (int64_t state : m_result_states)
+    {
+        all_outputs.push_back(state < 0 ? *output++ : stream.m_states[state]->get_next());
+    }
+
+    if (!m_executable->call(all_outputs, all_inputs))
+    {
+        return false;
+    }
+    for (auto& state : stream.m_states)
+    {
+        state->swap();
+    }
+    return true;
+}
+
+bool runtime::stateful::StatefulExecutable::call(
+    const vector<shared_ptr<runtime::Tensor>>& outputs,
+    const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    return call(*m_default_stream, outputs, inputs);
+}
@@ -0,0 +1,110 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/state/tensor_state.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace stateful
+        {
+            class StatefulExecutable;
+        }
+    }
+}
+
+///
+/// \brief Executable that keeps some tensors of a Function alive across calls, such as the
+///        hidden and cell states of a recurrent network fed one chunk of a stream at a time.
+///
+/// Each StateBinding pairs a parameter of `function` with the result holding its next value,
+/// for example the initial and final hidden state of an RNN. The two must have the same static
+/// element type and shape. Bound parameters and results are not among the inputs and outputs
+/// of `call`: the executable feeds the state to the parameter and keeps the result as the
+/// state for the next call.
+///
+/// The state of each independent stream lives in a Stream made by create_stream(). A stream
+/// holds two backend tensors per state. A call reads one and writes the other, and they then
+/// swap roles, so the state is neither copied nor aliased between input and output, which
+/// kernels such as the MKL-DNN RNN do not allow. `call` without a stream uses a default one.
+///
+class ngraph::runtime::stateful::StatefulExecutable : public ngraph::runtime::Executable
+{
+public:
+    struct StateBinding
+    {
+        size_t parameter_index;
+        size_t result_index;
+    };
+
+    /// \brief The states of one stream
+    class Stream
+    {
+    public:
+        /// \brief Sets every state to zero, as at the start of a new stream
+        void reset();
+        /// \brief A copy of every state, to be restored later
+        std::vector<std::vector<char>> snapshot() const;
+        void restore(const std::vector<std::vector<char>>& snapshot);
+        const std::vector<std::shared_ptr<TensorState>>& get_states() const { return m_states; }
+    private:
+        friend class StatefulExecutable;
+        std::vector<std::shared_ptr<TensorState>> m_states;
+    };
+
+    StatefulExecutable(const std::shared_ptr<Backend>& backend,
+                       const std::shared_ptr<Function>& function,
+                       const std::vector<StateBinding>& state_bindings,
+                       bool enable_performance_collection = false);
+    ~StatefulExecutable() override;
+
+    /// \brief Makes a stream whose states are all zero
+    std::shared_ptr<Stream> create_stream() const;
+
+    /// \brief Runs the function on the states of `stream`, then updates them
+    bool call(Stream& stream,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs);
+
+    /// \brief Runs the function on the default stream
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    Stream& get_default_stream() { return *m_default_stream; }
+    const std::vector<StateBinding>& get_state_bindings() const { return m_state_bindings; }
+    std::shared_ptr<Executable> get_executable() const { return m_executable; }
+
+private:
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Executable> m_executable;
+    std::vector<StateBinding> m_state_bindings;
+    // the parameter of each state, which gives its element type and shape
+    ParameterVector m_state_parameters;
+    // for each parameter and result of `function`, its state or -1 if it is not bound
+    std::vector<int64_t> m_parameter_states;
+    std::vector<int64_t> m_result_states;
+    std::shared_ptr<Stream> m_default_stream;
+};
@@ -14,6 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
+
 #include "ngraph/runtime/tensor.hpp"
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
 #include "ngraph/log.hpp"
@@ -23,6 +25,74 @@
 using namespace ngraph;
 using namespace std;
 
+runtime::TensorRegion::TensorRegion(const Shape& shape,
+                                    size_t element_size,
+                                    const Coordinate& lower,
+                                    const Coordinate& upper,
+                                    const Strides& strides)
+    : m_element_size(element_size)
+    , m_lower(lower)
+    , m_tensor_strides(row_major_strides(shape))
+{
+    size_t rank = shape.size();
+    if (lower.size() != rank || upper.size() != rank)
+    {
+        throw invalid_argument("runtime::TensorRegion coordinates must match the tensor rank");
+    }
+    for (size_t i = 0; i < rank; i++)
+    {
+        if (lower[i] > upper[i] || upper[i] > shape[i])
+        {
+            throw out_of_range("runtime::TensorRegion is not within the tensor");
+        }
+        m_shape.push_back(upper[i] - lower[i]);
+    }
+    m_strides = strides.empty() ? Strides(row_major_strides(m_shape)) : strides;
+    if (m_strides.size() != rank)
+    {
+        throw invalid_argument("runtime::TensorRegion strides must match the tensor rank");
+    }
+
+    // Grow the run from the last axis while the axis below it is covered entirely, which
+    // makes the run contiguous in the tensor, and the buffer is compact across it
+    m_run_axis = rank;
+    size_t run_elements = 1;
+    if (rank > 0 && m_strides[rank - 1] == 1)
+    {
+        m_run_axis = rank - 1;
+        run_elements = m_shape[rank - 1];
+        while (m_run_axis > 0 && m_shape[m_run_axis] == shape[m_run_axis] &&
+               m_strides[m_run_axis - 1] == run_elements)
+        {
+            m_run_axis--;
+            run_elements *= m_shape[m_run_axis];
+        }
+    }
+    m_run_size = run_elements * element_size;
+    m_run_count = shape_size(m_shape) == 0 ? 0 : shape_size(m_shape) / run_elements;
+}
+
+void runtime::TensorRegion::get_run_offsets(size_t run,
+                                            size_t& tensor_offset,
+                                            size_t& buffer_offset) const
+{
+    tensor_offset = 0;
+    buffer_offset = 0;
+    for (size_t i = m_shape.size(); i-- > 0;)
+    {
+        size_t index = 0;
+        if (i < m_run_axis)
+        {
+            index = run % m_shape[i];
+            run /= m_shape[i];
+        }
+        tensor_offset += (m_lower[i] + index) * m_tensor_strides[i];
+        buffer_offset += index * m_strides[i];
+    }
+    tensor_offset *= m_element_size;
+    buffer_offset *= m_element_size;
+}
+
 const Shape& runtime::Tensor::get_shape() const
 {
     return m_descriptor->get_shape();
@@ -68,14 +138,77 @@ const std::string& runtime::Tensor::get_name() const
     return m_descriptor->get_name();
 }
 
+size_t runtime::Tensor::next_version()
+{
+    // Version 0 is never handed out, it is the "never seen" value for consumers
+    static atomic<size_t> s_next_version{1};
+    return s_next_version.fetch_add(1, memory_order_relaxed);
+}
+
 bool runtime::Tensor::get_stale() const
 {
-    return m_stale;
+    return m_version != m_clean_version;
 }
 
 void runtime::Tensor::set_stale(bool val)
 {
-    m_stale = val;
+    if (val)
+    {
+        m_version = next_version();
+    }
+    else
+    {
+        m_clean_version = m_version;
+    }
+}
+
+size_t runtime::Tensor::get_version() const
+{
+    return m_version;
+}
+
+size_t runtime::Tensor::get_type_version() const
+{
+    // get_element_type and get_shape may be overridden to report a type the descriptor does
+    // not fix
+    if (m_descriptor->get_element_type().is_dynamic() ||
+        m_descriptor->get_partial_shape().is_dynamic())
+    {
+        return 0;
+    }
+    return m_descriptor->get_type_version();
+}
+
+void runtime::Tensor::write_region(const void* p,
+                                   const Coordinate& lower,
+                                   const Coordinate& upper,
+                                   const Strides& strides)
+{
+    TensorRegion region(get_shape(), get_element_type().size(), lower, upper, strides);
+    const char* source = static_cast<const char*>(p);
+    for (size_t run = 0; run < region.get_run_count(); run++)
+    {
+        size_t tensor_offset;
+        size_t buffer_offset;
+        region.get_run_offsets(run, tensor_offset, buffer_offset);
+        write(source + buffer_offset, tensor_offset, region.get_run_size());
+    }
+}
+
+void runtime::Tensor::read_region(void* p,
+                                  const Coordinate& lower,
+                                  const Coordinate& upper,
+                                  const Strides& strides) const
+{
+    TensorRegion region(get_shape(), get_element_type().size(), lower, upper, strides);
+    char* target = static_cast<char*>(p);
+    for (size_t run = 0; run < region.get_run_count(); run++)
+    {
+        size_t tensor_offset;
+        size_t buffer_offset;
+        region.get_run_offsets(run, tensor_offset, buffer_offset);
+        read(target + buffer_offset, tensor_offset, region.get_run_size());
+    }
 }
 
 void runtime::Tensor::copy_from(const ngraph::runtime::Tensor& source)
@@ -20,6 +20,7 @@
 #include <vector>
 
 #include "ngraph/descriptor/layout/tensor_layout.hpp"
+#include "ngraph/coordinate.hpp"
 #include "ngraph/descriptor/tensor.hpp"
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/shape.hpp"
@@ -35,12 +36,53 @@ namespace ngraph
 
     namespace runtime
     {
+        /// \brief The elements of a tensor between two coordinates, as copied to or from a
+        ///        buffer laid out with given strides.
+        ///
+        /// The copy is split into runs of elements that are contiguous both in the row-major
+        /// tensor and in the buffer. Trailing axes that the region covers entirely are merged
+        /// into one run when the buffer strides allow it, so a batch slice of a tensor is a
+        /// single run. Runs are independent and can be copied in parallel.
+        class TensorRegion
+        {
+        public:
+            /// \param shape Shape of the tensor
+            /// \param element_size Size in bytes of an element
+            /// \param lower First coordinate of the region
+            /// \param upper Coordinate one past the last of the region on every axis
+            /// \param strides Strides in elements of the buffer, row-major if empty
+            TensorRegion(const Shape& shape,
+                         size_t element_size,
+                         const Coordinate& lower,
+                         const Coordinate& upper,
+                         const Strides& strides = Strides{});
+
+            const Shape& get_shape() const { return m_shape; }
+            const Strides& get_strides() const { return m_strides; }
+            size_t get_run_count() const { return m_run_count; }
+            size_t get_run_size() const { return m_run_size; }
+            /// \brief Byte offsets of a run in the row-major tensor and in the buffer
+            void get_run_offsets(size_t run, size_t& tensor_offset, size_t& buffer_offset) const;
+
+        private:
+            size_t m_element_size;
+            Coordinate m_lower;
+            Shape m_shape;
+            Strides m_strides;
+            Strides m_tensor_strides;
+            // Axes before m_run_axis are iterated over, the others are within a run
+            size_t m_run_axis;
+            size_t m_run_count;
+            size_t m_run_size;
+        };
+
         class Tensor
         {
         protected:
             Tensor(const std::shared_ptr<ngraph::descriptor::Tensor>& descriptor)
                 : m_descriptor(descriptor)
-                , m_stale(true)
+                , m_version(next_version())
+                , m_clean_version(0)
             {
             }
 
@@ -90,9 +132,21 @@ namespace ngraph
             bool get_stale() const;
 
             /// \brief Set the stale value of the tensor. A tensor is stale if its data is
-            /// changed.
+            /// changed. Marking a tensor stale gives it a new version.
             void set_stale(bool val);
 
+            /// \brief Get the version of the tensor's data. Versions are unique across all
+            /// tensors and change whenever the tensor is marked stale, so a backend can tell
+            /// whether the data it last saw in a given input is still current.
+            /// \return the current version of the tensor
+            size_t get_version() const;
+
+            /// \brief Get the version of the tensor's element type and shape, which changes
+            /// whenever they do. 0 if they may change without a new version, as for tensors
+            /// whose descriptor is dynamic, such as the tensors of the dynamic backend.
+            /// \return the current type version of the tensor
+            size_t get_type_version() const;
+
             /// \brief Write bytes directly into the tensor
             /// \param p Pointer to source of data
             /// \param offset Offset into tensor storage to begin writing. Must be element-aligned.
@@ -105,13 +159,37 @@ namespace ngraph
             /// \param n Number of bytes to read, must be integral number of elements.
             virtual void read(void* p, size_t offset, size_t n) const = 0;
 
+            /// \brief Write the elements of a region of the tensor
+            /// \param p Pointer to source of data
+            /// \param lower First coordinate of the region
+            /// \param upper Coordinate one past the last of the region on every axis
+            /// \param strides Strides in elements of the source, row-major if empty
+            virtual void write_region(const void* p,
+                                      const Coordinate& lower,
+                                      const Coordinate& upper,
+                                      const Strides& strides = Strides{});
+
+            /// \brief Read the elements of a region of the tensor
+            /// \param p Pointer to destination for data
+            /// \param lower First coordinate of the region
+            /// \param upper Coordinate one past the last of the region on every axis
+            /// \param strides Strides in elements of the destination, row-major if empty
+            virtual void read_region(void* p,
+                                     const Coordinate& lower,
+                                     const Coordinate& upper,
+                                     const Strides& strides = Strides{}) const;
+
             /// \brief copy bytes directly from source to this tensor
             /// \param source The source tensor
             virtual void copy_from(const ngraph::runtime::Tensor& source);
 
         protected:
+            static size_t next_version();
+
             std::shared_ptr<ngraph::descriptor::Tensor> m_descriptor;
-            bool m_stale;
+            // The tensor is stale unless it was marked not stale at its current version.
+            size_t m_version;
+            size_t m_clean_version;
         };
 
         using TensorViewPtrs = std::vector<std::shared_ptr<Tensor>>;
@@ -0,0 +1,625 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include "ngraph/check.hpp"
+#include "ngraph/coordinate_transform.hpp"
+#include "ngraph/op/avg_pool.hpp"
+#include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/concat.hpp"
+#include "ngraph/op/constant.hpp"
+#include "ngraph/op/convolution.hpp"
+#include "ngraph/op/max_pool.hpp"
+#include "ngraph/op/result.hpp"
+#include "ngraph/op/select.hpp"
+#include "ngraph/op/slice.hpp"
+#include "ngraph/op/util/binary_elementwise_arithmetic.hpp"
+#include "ngraph/op/util/binary_elementwise_comparison.hpp"
+#include "ngraph/op/util/binary_elementwise_logical.hpp"
+#include "ngraph/op/util/unary_elementwise_arithmetic.hpp"
+#include "ngraph/runtime/tiled/tiled_executable.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // The sliding window of a Convolution or pooling over the spatial axes
+    struct Window
+    {
+        Shape shape;
+        Strides strides;
+        Strides dilations;
+        CoordinateDiff padding_below;
+        CoordinateDiff padding_above;
+    };
+}
+
+static bool get_window(const Node& node, Window& window)
+{
+    if (auto convolution = dynamic_cast<const op::Convolution*>(&node))
+    {
+        const Shape& filters_shape = node.get_input_shape(1);
+        window.shape = Shape(filters_shape.begin() + 2, filters_shape.end());
+        window.strides = convolution->get_window_movement_strides();
+        window.dilations = convolution->get_window_dilation_strides();
+        window.padding_below = convolution->get_padding_below();
+        window.padding_above = convolution->get_padding_above();
+        return true;
+    }
+    if (auto max_pool = dynamic_cast<const op::MaxPool*>(&node))
+    {
+        window.shape = max_pool->get_window_shape();
+        window.strides = max_pool->get_window_movement_strides();
+        window.dilations = Strides(window.shape.size(), 1);
+        window.padding_below = CoordinateDiff(max_pool->get_padding_below().begin(),
+                                              max_pool->get_padding_below().end());
+        window.padding_above = CoordinateDiff(max_pool->get_padding_above().begin(),
+                                              max_pool->get_padding_above().end());
+        return true;
+    }
+    if (auto avg_pool = dynamic_cast<const op::AvgPool*>(&node))
+    {
+        window.shape = avg_pool->get_window_shape();
+        window.strides = avg_pool->get_window_movement_strides();
+        window.dilations = Strides(window.shape.size(), 1);
+        window.padding_below = CoordinateDiff(avg_pool->get_padding_below().begin(),
+                                              avg_pool->get_padding_below().end());
+        window.padding_above = CoordinateDiff(avg_pool->get_padding_above().begin(),
+                                              avg_pool->get_padding_above().end());
+        return true;
+    }
+    return false;
+}
+
+static bool is_padded(const Window& window)
+{
+    return any_of(window.padding_below.begin(),
+                  window.padding_below.end(),
+                  [](ptrdiff_t p) { return p > 0; }) ||
+           any_of(window.padding_above.begin(),
+                  window.padding_above.end(),
+                  [](ptrdiff_t p) { return p > 0; });
+}
+
+// Ops that compute each spatial position from the same position of their inputs
+static bool is_pointwise(const Node& node)
+{
+    if (auto concat = dynamic_cast<const op::Concat*>(&node))
+    {
+        return concat->get_concatenation_axis() < 2;
+    }
+    return dynamic_cast<const op::util::UnaryElementwiseArithmetic*>(&node) ||
+           dynamic_cast<const op::util::BinaryElementwiseArithmetic*>(&node) ||
+           dynamic_cast<const op::util::BinaryElementwiseComparison*>(&node) ||
+           dynamic_cast<const op::util::BinaryElementwiseLogical*>(&node) ||
+           node.description() == "BatchNormInference" || node.description() == "Convert" ||
+           node.description() == "Not" || node.description() == "Select" || node.is_output();
+}
+
+// A Broadcast of data without spatial axes over all of them, which is the same at any size
+static bool is_uniform(const Node& node, size_t rank)
+{
+    auto broadcast = dynamic_cast<const op::Broadcast*>(&node);
+    if (!broadcast || node.get_output_shape(0).size() != rank ||
+        node.description() != "Broadcast")
+    {
+        return false;
+    }
+    for (size_t axis = 2; axis < rank; axis++)
+    {
+        if (broadcast->get_broadcast_axes().count(axis) == 0)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Calls f(tile_index, index, count) for each run along the last axis of a tile of shape `tile`,
+// at `start` on the spatial axes of a tensor of shape `shape`, that is inside the tensor.
+// Indices count elements.
+static void for_each_run(const Shape& tile,
+                         const Shape& shape,
+                         const vector<int64_t>& start,
+                         const function<void(size_t, size_t, size_t)>& f)
+{
+    size_t last = tile.size() - 1;
+    int64_t begin = max<int64_t>(0, -start.back());
+    int64_t end = min<int64_t>(tile[last], static_cast<int64_t>(shape[last]) - start.back());
+    if (begin >= end)
+    {
+        return;
+    }
+    size_t row = 0;
+    for (const Coordinate& c : CoordinateTransform(Shape(tile.begin(), tile.end() - 1)))
+    {
+        size_t index = 0;
+        bool inside = true;
+        for (size_t i = 0; i < last && inside; i++)
+        {
+            int64_t p = i < 2 ? c[i] : start[i - 2] + c[i];
+            inside = p >= 0 && p < static_cast<int64_t>(shape[i]);
+            index = index * shape[i] + p;
+        }
+        if (inside)
+        {
+            f(row * tile[last] + begin, index * shape[last] + start.back() + begin, end - begin);
+        }
+        row++;
+    }
+}
+
+runtime::tiled::TiledExecutable::TiledExecutable(const shared_ptr<Backend>& backend,
+                                                 const shared_ptr<Function>& function,
+                                                 const Shape& tile_shape,
+                                                 const shared_ptr<op::Parameter>& input,
+                                                 bool enable_performance_collection)
+    : m_backend(backend)
+    , m_tile_shape(tile_shape)
+    , m_input(input ? input : function->get_parameters().at(0))
+{
+    NGRAPH_CHECK(!function->is_dynamic(), "Tiled functions must have static shapes");
+    const ParameterVector& parameters = function->get_parameters();
+    m_input_index = find(parameters.begin(), parameters.end(), m_input) - parameters.begin();
+    NGRAPH_CHECK(m_input_index < parameters.size(),
+                 "The tiled input is not a parameter of the function");
+    size_t rank = m_input->get_shape().size();
+    NGRAPH_CHECK(rank >= 3 && tile_shape.size() == rank - 2,
+                 "The tile shape ",
+                 tile_shape,
+                 " must have a dimension for each spatial axis of the input shape ",
+                 m_input->get_shape());
+    NGRAPH_CHECK(shape_size(tile_shape) > 0, "The tile shape ", tile_shape, " is empty");
+    m_spatial_rank = rank - 2;
+
+    compute_regions(function);
+    m_executable = m_backend->compile(make_tile_function(function), enable_performance_collection);
+
+    const Shape& output_shape = function->get_output_shape(0);
+    for (size_t i = 0; i < m_spatial_rank; i++)
+    {
+        m_tile_counts.push_back((output_shape[i + 2] + tile_shape[i] - 1) / tile_shape[i]);
+    }
+    const ParameterVector& tile_parameters = m_executable->get_parameters();
+    m_input_tile = m_backend->create_tensor(m_input->get_element_type(),
+                                            tile_parameters.at(m_input_index)->get_shape());
+    m_input_staging.resize(m_input_tile->get_size_in_bytes());
+    for (size_t i = 0; i < m_masks.size(); i++)
+    {
+        Mask& mask = m_masks[i];
+        mask.tensor = m_backend->create_tensor(element::boolean, mask.region.extent);
+        mask.staging.resize(shape_size(mask.region.extent));
+    }
+    for (const auto& result : m_executable->get_results())
+    {
+        m_output_tiles.push_back(
+            m_backend->create_tensor(result->get_element_type(), result->get_shape()));
+    }
+    set_parameters_and_results(parameters, function->get_results());
+}
+
+runtime::tiled::TiledExecutable::~TiledExecutable()
+{
+}
+
+Shape runtime::tiled::TiledExecutable::get_input_tile_shape() const
+{
+    return m_regions.at(m_input.get()).extent;
+}
+
+void runtime::tiled::TiledExecutable::compute_regions(const shared_ptr<Function>& function)
+{
+    size_t rank = m_spatial_rank + 2;
+    auto ops = function->get_ordered_ops();
+
+    // The nodes computed from the input, which must all be supported
+    unordered_set<const Node*> spatial{m_input.get()};
+    for (const auto& node : ops)
+    {
+        bool depends_on_input = false;
+        for (const auto& argument : node->get_arguments())
+        {
+            depends_on_input = depends_on_input || spatial.count(argument.get()) > 0;
+        }
+        if (!depends_on_input)
+        {
+            NGRAPH_CHECK(!node->is_output(),
+                         "Result ",
+                         node->get_name(),
+                         " is not computed from the tiled input");
+            continue;
+        }
+        NGRAPH_CHECK(node->get_output_size() == 1 && node->get_output_shape(0).size() == rank,
+                     "Node ",
+                     node->get_name(),
+                     " changes the rank of the tiled data, only convolutions, poolings and ops "
+                     "that work on each spatial position can be tiled");
+        Window window;
+        if (get_window(*node, window))
+        {
+            NGRAPH_CHECK(spatial.count(node->get_argument(0).get()) > 0 &&
+                             (node->get_input_size() == 1 ||
+                              spatial.count(node->get_argument(1).get()) == 0),
+                         "Node ",
+                         node->get_name(),
+                         " has its filters computed from the tiled input");
+            if (auto convolution = dynamic_cast<const op::Convolution*>(node.get()))
+            {
+                const Strides& data_dilation = convolution->get_data_dilation_strides();
+                NGRAPH_CHECK(all_of(data_dilation.begin(),
+                                    data_dilation.end(),
+                                    [](size_t d) { return d == 1; }),
+                             "Convolution ",
+                             node->get_name(),
+                             " dilates its data, which cannot be tiled");
+            }
+            auto avg_pool = dynamic_cast<const op::AvgPool*>(node.get());
+            NGRAPH_CHECK(!is_padded(window) || node->description() == "Convolution" ||
+                             (avg_pool && avg_pool->get_include_padding_in_avg_computation()),
+                         "Pooling ",
+                         node->get_name(),
+                         " is padded with values other than zero, which cannot be tiled");
+        }
+        else
+        {
+            NGRAPH_CHECK(is_pointwise(*node), "Node ", node->get_name(), " cannot be tiled");
+            for (const auto& argument : node->get_arguments())
+            {
+                if (spatial.count(argument.get()) > 0)
+                {
+                    continue;
+                }
+                if (is_uniform(*argument, rank))
+                {
+                    m_uniform.insert(argument.get());
+                    continue;
+                }
+                NGRAPH_CHECK(argument->get_output_shape(0).size() < rank,
+                             "Node ",
+                             node->get_name(),
+                             " reads the spatial axes of ",
+                             argument->get_name(),
+                             ", which is not computed from the tiled input");
+            }
+        }
+        spatial.insert(node.get());
+    }
+
+    const ResultVector& results = function->get_results();
+    for (const auto& result : results)
+    {
+        const Shape& shape = result->get_shape();
+        NGRAPH_CHECK(equal(shape.begin() + 2, shape.end(), results[0]->get_shape().begin() + 2),
+                     "The results must have the same spatial shape");
+        m_regions[result.get()] = Region{vector<int64_t>(m_spatial_rank, 1),
+                                         vector<int64_t>(m_spatial_rank, 0),
+                                         m_tile_shape};
+    }
+
+    // Going back from the results, each node must compute what all of its users read
+    auto require = [this](const Node* node, const Region& region) {
+        auto it = m_regions.find(node);
+        if (it == m_regions.end())
+        {
+            m_regions[node] = region;
+            return;
+        }
+        Region& merged = it->second;
+        NGRAPH_CHECK(merged.scale == region.scale,
+                     "Node ",
+                     node->get_name(),
+                     " is read with different strides, its users cannot be tiled alike");
+        for (size_t i = 0; i < region.offset.size(); i++)
+        {
+            int64_t end = max(merged.offset[i] + static_cast<int64_t>(merged.extent[i]),
+                              region.offset[i] + static_cast<int64_t>(region.extent[i]));
+            merged.offset[i] = min(merged.offset[i], region.offset[i]);
+            merged.extent[i] = end - merged.offset[i];
+        }
+    };
+    for (auto it = ops.rbegin(); it != ops.rend(); ++it)
+    {
+        const Node* node = it->get();
+        if (node == m_input.get() || m_uniform.count(node) > 0 || spatial.count(node) == 0)
+        {
+            continue;
+        }
+        const Region& region = m_regions.at(node);
+        Window window;
+        if (get_window(*node, window))
+        {
+            Region input_region;
+            for (size_t i = 0; i < m_spatial_rank; i++)
+            {
+                int64_t stride = window.strides[i];
+                input_region.scale.push_back(region.scale[i] * stride);
+                input_region.offset.push_back(region.offset[i] * stride -
+                                              window.padding_below[i]);
+                input_region.extent.push_back((region.extent[i] - 1) * stride +
+                                              (window.shape[i] - 1) * window.dilations[i] + 1);
+            }
+            const Node* data = node->get_argument(0).get();
+            require(data, input_region);
+            if (is_padded(window) && data != m_input.get())
+            {
+                m_needs_mask.insert(data);
+            }
+            continue;
+        }
+        for (const auto& argument : node->get_arguments())
+        {
+            if (spatial.count(argument.get()) > 0 || m_uniform.count(argument.get()) > 0)
+            {
+                require(argument.get(), region);
+            }
+        }
+    }
+    NGRAPH_CHECK(m_regions.count(m_input.get()) > 0, "The results do not use the tiled input");
+}
+
+shared_ptr<Function>
+    runtime::tiled::TiledExecutable::make_tile_function(const shared_ptr<Function>& function)
+{
+    unordered_map<const Node*, shared_ptr<Node>> tiled;
+    ParameterVector parameters;
+    for (const auto& parameter : function->get_parameters())
+    {
+        Shape shape = parameter->get_shape();
+        if (parameter == m_input)
+        {
+            const Shape& extent = m_regions.at(parameter.get()).extent;
+            copy(extent.begin(), extent.end(), shape.begin() + 2);
+        }
+        parameters.push_back(make_shared<op::Parameter>(parameter->get_element_type(), shape));
+        tiled[parameter.get()] = parameters.back();
+    }
+
+    // The part of a tiled node a user reads
+    auto read_region = [&](const shared_ptr<Node>& node, const Region& region) {
+        Shape shape = node->get_output_shape(0);
+        copy(region.extent.begin(), region.extent.end(), shape.begin() + 2);
+        if (m_uniform.count(node.get()) > 0)
+        {
+            auto broadcast = static_pointer_cast<op::Broadcast>(node);
+            return static_pointer_cast<Node>(make_shared<op::Broadcast>(
+                tiled.at(node->get_argument(0).get()), shape, broadcast->get_broadcast_axes()));
+        }
+        shared_ptr<Node> tile = tiled.at(node.get());
+        if (tile->get_shape() == shape)
+        {
+            return tile;
+        }
+        const Region& computed = m_regions.at(node.get());
+        Coordinate lower(shape.size(), 0);
+        Coordinate upper(shape);
+        for (size_t i = 0; i < m_spatial_rank; i++)
+        {
+            lower[i + 2] = region.offset[i] - computed.offset[i];
+            upper[i + 2] = lower[i + 2] + region.extent[i];
+        }
+        return static_pointer_cast<Node>(make_shared<op::Slice>(tile, lower, upper));
+    };
+
+    NodeVector outputs;
+    ParameterVector masks;
+    for (const auto& node : function->get_ordered_ops())
+    {
+        if (node->is_parameter())
+        {
+            continue;
+        }
+        auto it = m_regions.find(node.get());
+        if (it == m_regions.end() || m_uniform.count(node.get()) > 0)
+        {
+            NodeVector arguments;
+            for (const auto& argument : node->get_arguments())
+            {
+                arguments.push_back(tiled.at(argument.get()));
+            }
+            tiled[node.get()] = node->copy_with_new_args(arguments);
+            continue;
+        }
+        const Region& region = it->second;
+        if (node->is_output())
+        {
+            outputs.push_back(read_region(node->get_argument(0), region));
+            continue;
+        }
+
+        shared_ptr<Node> tile;
+        Window window;
+        if (get_window(*node, window))
+        {
+            Region input_region;
+            for (size_t i = 0; i < m_spatial_rank; i++)
+            {
+                input_region.offset.push_back(region.offset[i] * window.strides[i] -
+                                              window.padding_below[i]);
+                input_region.extent.push_back((region.extent[i] - 1) * window.strides[i] +
+                                              (window.shape[i] - 1) * window.dilations[i] + 1);
+            }
+            auto data = read_region(node->get_argument(0), input_region);
+            if (node->description() == "Convolution")
+            {
+                CoordinateDiff no_padding(m_spatial_rank, 0);
+                tile = make_shared<op::Convolution>(data,
+                                                    tiled.at(node->get_argument(1).get()),
+                                                    window.strides,
+                                                    window.dilations,
+                                                    no_padding,
+                                                    no_padding,
+                                                    Strides(m_spatial_rank, 1));
+            }
+            else if (node->description() == "MaxPool")
+            {
+                tile = make_shared<op::MaxPool>(data, window.shape, window.strides);
+            }
+            else
+            {
+                tile = make_shared<op::AvgPool>(data, window.shape, window.strides);
+            }
+        }
+        else
+        {
+            NodeVector arguments;
+            for (const auto& argument : node->get_arguments())
+            {
+                arguments.push_back(m_regions.count(argument.get()) > 0
+                                        ? read_region(argument, region)
+                                        : tiled.at(argument.get()));
+            }
+            tile = node->copy_with_new_args(arguments);
+        }
+        const Shape& shape = tile->get_shape();
+        NGRAPH_CHECK(equal(shape.begin() + 2, shape.end(), region.extent.begin()),
+                     "Tile of ",
+                     node->get_name(),
+                     " has the shape ",
+                     shape,
+                     ", expected the spatial shape ",
+                     region.extent);
+
+        if (m_needs_mask.count(node.get()) > 0)
+        {
+            // Padding is zero, so zero what the node computes outside the image
+            auto mask = make_shared<op::Parameter>(element::boolean, region.extent);
+            AxisSet all_axes;
+            for (size_t i = 0; i < shape.size(); i++)
+            {
+                all_axes.insert(i);
+            }
+            auto zero = make_shared<op::Broadcast>(
+                op::Constant::create(tile->get_element_type(), Shape{}, {0}), shape, all_axes);
+            tile = make_shared<op::Select>(
+                make_shared<op::Broadcast>(mask, shape, AxisSet{0, 1}), tile, zero);
+            const Shape& node_shape = node->get_shape();
+            m_masks.push_back(
+                Mask{region, Shape(node_shape.begin() + 2, node_shape.end()), nullptr, {}});
+            masks.push_back(mask);
+        }
+        tiled[node.get()] = tile;
+    }
+
+    parameters.insert(parameters.end(), masks.begin(), masks.end());
+    return make_shared<Function>(outputs, parameters);
+}
+
+vector<int64_t> runtime::tiled::TiledExecutable::get_region_start(const Region& region,
+                                                                  const Shape& tile) const
+{
+    vector<int64_t> start;
+    for (size_t i = 0; i < m_spatial_rank; i++)
+    {
+        start.push_back(region.scale[i] * static_cast<int64_t>(tile[i]) + region.offset[i]);
+    }
+    return start;
+}
+
+bool runtime::tiled::TiledExecutable::call(const vector<shared_ptr<runtime::Tensor>>& outputs,
+                                           const vector<shared_ptr<runtime::Tensor>>& inputs)
+{
+    NGRAPH_CHECK(inputs.size() == get_parameters().size() &&
+                     outputs.size() == get_results().size(),
+                 "Expected ",
+                 get_parameters().size(),
+                 " inputs and ",
+                 get_results().size(),
+                 " outputs, got ",
+                 inputs.size(),
+                 " and ",
+                 outputs.size());
+    const shared_ptr<runtime::Tensor>& input = inputs[m_input_index];
+    NGRAPH_CHECK(input->get_shape() == m_input->get_shape(),
+                 "The tiled input has the shape ",
+                 input->get_shape(),
+                 ", expected ",
+                 m_input->get_shape());
+
+    vector<shared_ptr<runtime::Tensor>> tile_inputs = inputs;
+    tile_inputs[m_input_index] = m_input_tile;
+    for (const Mask& mask : m_masks)
+    {
+        tile_inputs.push_back(mask.tensor);
+    }
+    size_t input_element_size = m_input->get_element_type().size();
+    const Region& input_region = m_regions.at(m_input.get());
+
+    for (const Coordinate& tile_index : CoordinateTransform(m_tile_counts))
+    {
+        Shape tile(m_spatial_rank);
+        for (size_t i = 0; i < m_spatial_rank; i++)
+        {
+            tile[i] = tile_index[i] * m_tile_shape[i];
+        }
+
+        // The input region of the tile, with the halo, and zeros outside the image
+        memset(m_input_staging.data(), 0, m_input_staging.size());
+        for_each_run(m_input_tile->get_shape(),
+                     input->get_shape(),
+                     get_region_start(input_region, tile),
+                     [&](size_t tile_offset, size_t offset, size_t count) {
+                         input->read(m_input_staging.data() + tile_offset * input_element_size,
+                                     offset * input_element_size,
+                                     count * input_element_size);
+                     });
+        m_input_tile->write(m_input_staging.data(), 0, m_input_staging.size());
+
+        for (Mask& mask : m_masks)
+        {
+            vector<int64_t> start = get_region_start(mask.region, tile);
+            size_t index = 0;
+            for (const Coordinate& c : CoordinateTransform(mask.region.extent))
+            {
+                bool inside = true;
+                for (size_t i = 0; i < m_spatial_rank; i++)
+                {
+                    int64_t p = start[i] + c[i];
+                    inside = inside && p >= 0 && p < static_cast<int64_t>(mask.image_shape[i]);
+                }
+                mask.staging[index++] = inside;
+            }
+            mask.tensor->write(mask.staging.data(), 0, mask.staging.size());
+        }
+
+        if (!m_executable->call(m_output_tiles, tile_inputs))
+        {
+            return false;
+        }
+
+        vector<int64_t> output_start(tile.begin(), tile.end());
+        for (size_t i = 0; i < outputs.size(); i++)
+        {
+            const shared_ptr<runtime::Tensor>& output_tile = m_output_tiles[i];
+            size_t element_size = output_tile->get_element_type().size();
+            m_output_staging.resize(output_tile->get_size_in_bytes());
+            output_tile->read(m_output_staging.data(), 0, m_output_staging.size());
+            for_each_run(output_tile->get_shape(),
+                         outputs[i]->get_shape(),
+                         output_start,
+                         [&](size_t tile_offset, size_t offset, size_t count) {
+                             outputs[i]->write(m_output_staging.data() + tile_offset * element_size,
+                                               offset * element_size,
+                                               count * element_size);
+                         });
+        }
+    }
+    return true;
+}
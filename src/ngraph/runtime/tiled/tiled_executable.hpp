@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "ngraph/function.hpp"
+#include "ngraph/op/parameter.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/executable.hpp"
+#include "ngraph/runtime/tensor.hpp"
+
+namespace ngraph
+{
+    namespace runtime
+    {
+        namespace tiled
+        {
+            class TiledExecutable;
+        }
+    }
+}
+
+///
+/// \brief Executable that runs a fully convolutional Function on an input too large for one
+///        compilation, such as a whole-slide image, one spatial tile at a time.
+///
+/// `input` is a [N, C, d1, ..., dn] parameter of `function` and every result is a
+/// [N, C', e1, ..., en] tensor computed from it by convolutions, poolings and ops that work on
+/// each spatial position on its own, such as elementwise ops, BatchNormInference and Concat
+/// along the channel axis. The output is cut into tiles of `tile_shape` positions. Going back
+/// from the results, the window of every Convolution and pooling gives the region each node
+/// must compute for one tile, which includes the halo the windows of the layers after it read.
+/// A tile-sized version of the function, without padding, is compiled once on `backend`.
+///
+/// On each call the executable copies the region of every tile out of the caller's input,
+/// with zeros outside the image, runs the tile executable and copies the tile's outputs into
+/// the caller's output tensors, so the backend never holds more than one tile. Padding of
+/// layers after the first is reproduced by zeroing their inputs outside the image. Other
+/// parameters, such as the weights, are bound directly.
+///
+/// The shapes of `function` must be static. MaxPool and AvgPool without the padding in the
+/// average must not be padded, and Convolutions must not dilate their data.
+///
+class ngraph::runtime::tiled::TiledExecutable : public ngraph::runtime::Executable
+{
+public:
+    /// \param tile_shape The spatial shape of one output tile, [t1, ..., tn]
+    /// \param input The parameter to tile, the first parameter of `function` if null
+    TiledExecutable(const std::shared_ptr<Backend>& backend,
+                    const std::shared_ptr<Function>& function,
+                    const Shape& tile_shape,
+                    const std::shared_ptr<op::Parameter>& input = nullptr,
+                    bool enable_performance_collection = false);
+    ~TiledExecutable() override;
+
+    bool call(const std::vector<std::shared_ptr<runtime::Tensor>>& outputs,
+              const std::vector<std::shared_ptr<runtime::Tensor>>& inputs) override;
+
+    const Shape& get_tile_shape() const { return m_tile_shape; }
+    /// \brief The spatial shape of the input region read for one tile, including the halo
+    Shape get_input_tile_shape() const;
+    /// \brief The number of tiles along each spatial axis
+    const Shape& get_tile_counts() const { return m_tile_counts; }
+    /// \brief The compiled executable that runs one tile
+    std::shared_ptr<Executable> get_tile_executable() const { return m_executable; }
+
+private:
+    // The region a node computes for the tile whose outputs start at `t`, along each spatial
+    // axis: positions [scale * t + offset, scale * t + offset + extent)
+    struct Region
+    {
+        std::vector<int64_t> scale;
+        std::vector<int64_t> offset;
+        Shape extent;
+    };
+
+    // A node whose input must be zero outside the image, and the tensor that tells the tile
+    // executable where the image ends
+    struct Mask
+    {
+        Region region;
+        Shape image_shape;
+        std::shared_ptr<runtime::Tensor> tensor;
+        std::vector<char> staging;
+    };
+
+    void compute_regions(const std::shared_ptr<Function>& function);
+    std::shared_ptr<Function> make_tile_function(const std::shared_ptr<Function>& function);
+    std::vector<int64_t> get_region_start(const Region& region, const Shape& tile) const;
+
+    std::shared_ptr<Backend> m_backend;
+    std::shared_ptr<Executable> m_executable;
+    Shape m_tile_shape;
+    Shape m_tile_counts;
+    std::shared_ptr<op::Parameter> m_input;
+    size_t m_input_index;
+    size_t m_spatial_rank;
+    // the nodes of `function` computed per tile, and the region each needs
+    std::unordered_map<const Node*, Region> m_regions;
+    // Broadcasts over the spatial axes, rebuilt at the size of each region
+    std::unordered_set<const Node*> m_uniform;
+    std::unordered_set<const Node*> m_needs_mask;
+    std::shared_ptr<runtime::Tensor> m_input_tile;
+    std::vector<char> m_input_staging;
+    std::vector<Mask> m_masks;
+    std::vector<std::shared_ptr<runtime::Tensor>> m_output_tiles;
+    std::vector<char> m_output_staging;
+};
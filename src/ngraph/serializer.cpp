@@ -14,16 +14,23 @@
 // limitations under the License.
 //*****************************************************************************
 
+#include <atomic>
 #include <fstream>
 #include <functional>
+#include <set>
+#include <thread>
+#include <unordered_set>
 
+#include "ngraph/compression.hpp"
 #include "ngraph/cpio.hpp"
+#include "ngraph/distributed.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/op/abs.hpp"
 #include "ngraph/op/acos.hpp"
 #include "ngraph/op/add.hpp"
 #include "ngraph/op/all.hpp"
+#include "ngraph/op/allgather.hpp"
 #include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/and.hpp"
 #include "ngraph/op/any.hpp"
@@ -50,11 +57,14 @@
 #include "ngraph/op/erf.hpp"
 #include "ngraph/op/exp.hpp"
 #include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/op/experimental/dropout.hpp"
 #include "ngraph/op/experimental/dyn_broadcast.hpp"
 #include "ngraph/op/experimental/dyn_pad.hpp"
 #include "ngraph/op/experimental/dyn_reshape.hpp"
 #include "ngraph/op/experimental/dyn_slice.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
+#include "ngraph/op/experimental/if.hpp"
+#include "ngraph/op/experimental/loop.hpp"
 #include "ngraph/op/experimental/quantized_avg_pool.hpp"
 #include "ngraph/op/experimental/quantized_conv.hpp"
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
@@ -66,13 +76,19 @@
 #include "ngraph/op/experimental/tile.hpp"
 #include "ngraph/op/experimental/transpose.hpp"
 #include "ngraph/op/floor.hpp"
+#include "ngraph/op/fused/adam_update.hpp"
+#include "ngraph/op/fused/all_finite.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/depth_to_space.hpp"
 #include "ngraph/op/fused/elu.hpp"
+#include "ngraph/op/fused/gelu.hpp"
 #include "ngraph/op/fused/gemm.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
 #include "ngraph/op/fused/hard_sigmoid.hpp"
+#include "ngraph/op/fused/layer_norm.hpp"
 #include "ngraph/op/fused/prelu.hpp"
+#include "ngraph/op/fused/scaled_dot_product_attention.hpp"
+#include "ngraph/op/fused/sgd_momentum_update.hpp"
 #include "ngraph/op/fused/space_to_depth.hpp"
 #include "ngraph/op/gather.hpp"
 #include "ngraph/op/gather_nd.hpp"
@@ -100,6 +116,8 @@
 #include "ngraph/op/power.hpp"
 #include "ngraph/op/product.hpp"
 #include "ngraph/op/quantize.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/reducescatter.hpp"
 #include "ngraph/op/relu.hpp"
 #include "ngraph/op/replace_slice.hpp"
 #include "ngraph/op/reshape.hpp"
@@ -107,6 +125,7 @@
 #include "ngraph/op/reverse.hpp"
 #include "ngraph/op/reverse_sequence.hpp"
 #include "ngraph/op/select.hpp"
+#include "ngraph/op/send.hpp"
 #include "ngraph/op/sigmoid.hpp"
 #include "ngraph/op/sign.hpp"
 #include "ngraph/op/sin.hpp"
@@ -120,6 +139,7 @@
 #include "ngraph/op/tan.hpp"
 #include "ngraph/op/tanh.hpp"
 #include "ngraph/op/topk.hpp"
+#include "ngraph/runtime/mapped_file.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
 #include "nlohmann/json.hpp"
@@ -137,6 +157,31 @@ void ngraph::set_serialize_output_shapes(bool enable)
     s_serialize_output_shapes_enabled = enable;
 }
 
+// Alignment of constant payloads in CPIO archives, enough for any SIMD load
+static const size_t s_cpio_alignment = 64;
+
+// Constants of at least this many bytes are compressed in CPIO archives, 0 keeps them all raw
+static size_t s_compression_threshold =
+    std::getenv("NGRAPH_SERIALIZER_COMPRESS") != nullptr
+        ? std::strtoull(std::getenv("NGRAPH_SERIALIZER_COMPRESS"), nullptr, 10)
+        : 0;
+
+// A compressed constant is stored in a record named after the constant with this suffix
+static const string s_compressed_suffix = ".z";
+
+void ngraph::set_serialize_compression_threshold(size_t threshold)
+{
+    s_compression_threshold = threshold;
+}
+
+static bool s_deserialize_mapped_constants_enabled =
+    (std::getenv("NGRAPH_DESERIALIZE_MMAP") != nullptr);
+
+void ngraph::set_deserialize_mapped_constants(bool enable)
+{
+    s_deserialize_mapped_constants_enabled = enable;
+}
+
 // This expands the op list in op_tbl.hpp into a list of enumerations that look like this:
 // Abs,
 // Acos,
@@ -186,6 +231,8 @@ static json write(const ngraph::Function&, bool binary_constant_data);
 static json write(const ngraph::Node&, bool binary_constant_data);
 static string
     serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data);
+static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, size_t indent);
+static void serialize_to_binary(ostream& out, shared_ptr<ngraph::Function> func);
 
 static json write_dimension(Dimension d)
 {
@@ -288,8 +335,21 @@ static element::Type read_element_type(const json& j)
 
 void ngraph::serialize(const string& path, shared_ptr<ngraph::Function> func, size_t indent)
 {
-    ofstream out(path);
-    serialize(out, func, indent);
+    if (file_util::get_file_ext(path) == ".cpio")
+    {
+        ofstream out(path, ios_base::binary | ios_base::out);
+        serialize_to_cpio(out, func, indent);
+    }
+    else if (file_util::get_file_ext(path) == ".ngb")
+    {
+        ofstream out(path, ios_base::binary | ios_base::out);
+        serialize_to_binary(out, func);
+    }
+    else
+    {
+        ofstream out(path);
+        serialize(out, func, indent);
+    }
 }
 
 void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
@@ -297,28 +357,270 @@ void ngraph::serialize(ostream& out, shared_ptr<ngraph::Function> func, size_t i
     out << ::serialize(func, indent, false);
 }
 
-#if defined ENABLE_CPIO_FILE
-static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
+// The constants of func and the functions it calls, each name once
+static vector<shared_ptr<op::Constant>> get_constants(shared_ptr<ngraph::Function> func)
 {
-    string j = ::serialize(func, indent, true);
-    cpio::Writer writer(out);
-    writer.write(func->get_name(), j.c_str(), static_cast<uint32_t>(j.size()));
-
+    vector<shared_ptr<op::Constant>> constants;
+    unordered_set<string> constant_names;
     traverse_functions(func, [&](shared_ptr<ngraph::Function> f) {
         traverse_nodes(const_cast<Function*>(f.get()),
                        [&](shared_ptr<Node> node) {
-                           if (auto c = dynamic_pointer_cast<op::Constant>(node))
+                           auto c = dynamic_pointer_cast<op::Constant>(node);
+                           if (c && constant_names.insert(c->get_name()).second)
                            {
-                               uint32_t size =
-                                   static_cast<uint32_t>(shape_size(c->get_output_shape(0)) *
-                                                         c->get_output_element_type(0).size());
-                               writer.write(c->get_name(), c->get_data_ptr(), size);
+                               constants.push_back(c);
                            }
                        },
                        true);
     });
+    return constants;
+}
+
+static size_t get_constant_size(const op::Constant& c)
+{
+    return shape_size(c.get_output_shape(0)) * c.get_output_element_type(0).size();
+}
+
+// Runs f(0) ... f(count - 1) on all cores and rethrows the exception of the lowest failing index
+static void parallel_for(size_t count, const function<void(size_t)>& f)
+{
+    size_t thread_count = min<size_t>(max(1u, thread::hardware_concurrency()), count);
+    vector<exception_ptr> errors(count);
+    atomic<size_t> next{0};
+    auto work = [&]() {
+        for (size_t index = next++; index < count; index = next++)
+        {
+            try
+            {
+                f(index);
+            }
+            catch (...)
+            {
+                errors[index] = current_exception();
+            }
+        }
+    };
+    vector<thread> threads;
+    for (size_t t = 1; t < thread_count; ++t)
+    {
+        threads.emplace_back(work);
+    }
+    work();
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+    for (const auto& error : errors)
+    {
+        if (error)
+        {
+            rethrow_exception(error);
+        }
+    }
+}
+
+static void serialize_to_cpio(ostream& out, shared_ptr<ngraph::Function> func, size_t indent)
+{
+    string j = ::serialize(func, indent, true);
+
+    vector<shared_ptr<op::Constant>> constants = get_constants(func);
+
+    // Large constants are compressed, the bytes of floats shuffled first, and kept only if
+    // that makes them smaller
+    vector<vector<char>> compressed(constants.size());
+    if (s_compression_threshold > 0)
+    {
+        parallel_for(constants.size(), [&](size_t i) {
+            const op::Constant& c = *constants[i];
+            size_t size = get_constant_size(c);
+            if (size >= s_compression_threshold)
+            {
+                const element::Type& et = c.get_output_element_type(0);
+                compressed[i] =
+                    compression::compress(c.get_data_ptr(), size, et.is_real() ? et.size() : 1);
+                if (compressed[i].size() >= size)
+                {
+                    compressed[i].clear();
+                }
+            }
+        });
+    }
+
+    // Constant payloads are aligned so a mapped archive can be used in place
+    cpio::Writer writer(out);
+    writer.set_alignment(s_cpio_alignment);
+    vector<pair<string, uint32_t>> records;
+    records.emplace_back(func->get_name(), static_cast<uint32_t>(j.size()));
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        if (compressed[i].empty())
+        {
+            records.emplace_back(constants[i]->get_name(),
+                                 static_cast<uint32_t>(get_constant_size(*constants[i])));
+        }
+        else
+        {
+            records.emplace_back(constants[i]->get_name() + s_compressed_suffix,
+                                 static_cast<uint32_t>(compressed[i].size()));
+        }
+    }
+    writer.write_index(records);
+
+    writer.write(func->get_name(), j.c_str(), static_cast<uint32_t>(j.size()));
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        if (compressed[i].empty())
+        {
+            writer.write(constants[i]->get_name(),
+                         constants[i]->get_data_ptr(),
+                         static_cast<uint32_t>(get_constant_size(*constants[i])));
+        }
+        else
+        {
+            writer.write(records[i + 1].first,
+                         compressed[i].data(),
+                         static_cast<uint32_t>(compressed[i].size()));
+        }
+    }
+}
+
+// Binary model files (".ngb") start with a header of tables and are followed by the records the
+// tables point at. All integers are little endian and strings are a u32 length and the bytes.
+//
+//     magic "NGRAPHBF", u32 version
+//     u32 op count, op names
+//     u32 function count, per function: name, u64 offset, u64 size
+//     u32 constant count, per constant: name, u64 offset, u64 size
+//     function records, each the CBOR encoding of the function's json with every node's "op"
+//     replaced by its index in the op table, in the order they must be read
+//     constant data, each aligned to s_cpio_alignment from the start of the file
+//
+// Offsets are from the start of the file, so a reader can seek to any record without decoding
+// the ones before it.
+static const char s_binary_magic[] = "NGRAPHBF";
+static const size_t s_binary_magic_size = sizeof(s_binary_magic) - 1;
+static const uint32_t s_binary_version = 1;
+
+namespace
+{
+    struct BinaryRecord
+    {
+        string name;
+        uint64_t offset;
+        uint64_t size;
+    };
+
+    struct BinaryHeader
+    {
+        vector<string> ops;
+        vector<BinaryRecord> functions;
+        vector<BinaryRecord> constants;
+    };
+}
+
+static void write_binary_uint(ostream& out, uint64_t value, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        out.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+}
+
+static void write_binary_string(ostream& out, const string& s)
+{
+    write_binary_uint(out, s.size(), 4);
+    out.write(s.data(), s.size());
+}
+
+static void write_binary_header(ostream& out, const BinaryHeader& header)
+{
+    out.write(s_binary_magic, s_binary_magic_size);
+    write_binary_uint(out, s_binary_version, 4);
+    write_binary_uint(out, header.ops.size(), 4);
+    for (const string& op : header.ops)
+    {
+        write_binary_string(out, op);
+    }
+    for (const vector<BinaryRecord>* records : {&header.functions, &header.constants})
+    {
+        write_binary_uint(out, records->size(), 4);
+        for (const BinaryRecord& record : *records)
+        {
+            write_binary_string(out, record.name);
+            write_binary_uint(out, record.offset, 8);
+            write_binary_uint(out, record.size, 8);
+        }
+    }
+}
+
+static void serialize_to_binary(ostream& out, shared_ptr<ngraph::Function> func)
+{
+    BinaryHeader header;
+    unordered_map<string, size_t> op_index;
+
+    // Callees are written before their callers, as in the json format
+    vector<shared_ptr<Function>> functions;
+    traverse_functions(func, [&](shared_ptr<ngraph::Function> f) { functions.push_back(f); });
+    reverse(functions.begin(), functions.end());
+    vector<vector<uint8_t>> function_data;
+    for (shared_ptr<Function> f : functions)
+    {
+        json j = write(*f, true);
+        for (json& node : j.at("ops"))
+        {
+            string op = node.at("op").get<string>();
+            auto it = op_index.find(op);
+            if (it == op_index.end())
+            {
+                it = op_index.insert({op, header.ops.size()}).first;
+                header.ops.push_back(op);
+            }
+            node["op"] = it->second;
+        }
+        function_data.push_back(json::to_cbor(j));
+        header.functions.push_back({f->get_name(), 0, function_data.back().size()});
+    }
+    vector<shared_ptr<op::Constant>> constants = get_constants(func);
+    for (auto& c : constants)
+    {
+        header.constants.push_back({c->get_name(), 0, get_constant_size(*c)});
+    }
+
+    // The offsets do not change the size of the header, so measure it before filling them in
+    stringstream header_size;
+    write_binary_header(header_size, header);
+    uint64_t offset = header_size.str().size();
+    for (BinaryRecord& record : header.functions)
+    {
+        record.offset = offset;
+        offset += record.size;
+    }
+    for (BinaryRecord& record : header.constants)
+    {
+        offset = (offset + s_cpio_alignment - 1) / s_cpio_alignment * s_cpio_alignment;
+        record.offset = offset;
+        offset += record.size;
+    }
+
+    write_binary_header(out, header);
+    for (const vector<uint8_t>& data : function_data)
+    {
+        out.write(reinterpret_cast<const char*>(data.data()), data.size());
+    }
+    uint64_t position = header.functions.empty()
+                            ? header_size.str().size()
+                            : header.functions.back().offset + header.functions.back().size;
+    for (size_t i = 0; i < constants.size(); i++)
+    {
+        const BinaryRecord& record = header.constants[i];
+        for (; position < record.offset; position++)
+        {
+            out.put(0);
+        }
+        out.write(static_cast<const char*>(constants[i]->get_data_ptr()), record.size);
+        position += record.size;
+    }
 }
-#endif
 
 static string serialize(shared_ptr<ngraph::Function> func, size_t indent, bool binary_constant_data)
 {
@@ -349,47 +651,400 @@ std::string ngraph::serialize(std::shared_ptr<ngraph::Function> func, size_t ind
     return ::serialize(func, indent, false);
 }
 
-shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+std::string ngraph::serialize_structure(std::shared_ptr<ngraph::Function> func)
 {
-    shared_ptr<Function> rc;
-    if (cpio::is_cpio(in))
+    // Names are unique per process, so nodes are referred to by their position instead
+    unordered_map<const Node*, size_t> positions;
+    json ops = json::array();
+    for (shared_ptr<Node> node : func->get_ordered_ops(true))
+    {
+        json op = write(*node, true);
+        op.erase("name");
+        op.erase("friendly_name");
+        op.erase("provenance_tags");
+        op.erase("output_shapes");
+
+        json inputs = json::array();
+        for (auto& input : node->inputs())
+        {
+            auto source = input.get_source_output();
+            inputs.push_back({positions.at(source.get_node()), source.get_index()});
+        }
+        op["inputs"] = inputs;
+        json control_deps = json::array();
+        for (auto cdep : node->get_control_dependencies())
+        {
+            control_deps.push_back(positions.at(cdep.get()));
+        }
+        op["control_deps"] = control_deps;
+        json outputs = json::array();
+        for (auto& output : node->outputs())
+        {
+            outputs.push_back({write_element_type(output.get_element_type()),
+                               write_partial_shape(output.get_partial_shape())});
+        }
+        op["outputs"] = outputs;
+        if (node->is_constant())
+        {
+            // The structural hash of a constant covers its value bytes
+            op["value_hash"] = node->get_structural_hash();
+        }
+
+        size_t position = positions.size();
+        positions[node.get()] = position;
+        ops.push_back(op);
+    }
+
+    json function;
+    json parameters = json::array();
+    for (auto& param : func->get_parameters())
+    {
+        parameters.push_back(positions.at(param.get()));
+    }
+    function["parameters"] = parameters;
+    json results = json::array();
+    for (auto& result : func->get_results())
+    {
+        results.push_back(positions.at(result.get()));
+    }
+    function["results"] = results;
+    function["ops"] = ops;
+    return function.dump();
+}
+
+// Reads the payload of a record, from the mapping if there is one, into data
+static const char* read_cpio_record(cpio::Reader& reader,
+                                    const cpio::FileInfo& info,
+                                    const shared_ptr<runtime::MappedFile>& mapped_file,
+                                    vector<char>& data)
+{
+    if (mapped_file && info.get_offset() + info.get_size() <= mapped_file->size())
+    {
+        return static_cast<const char*>(mapped_file->get_ptr(info.get_offset()));
+    }
+    data.resize(info.get_size());
+    reader.read(info.get_name(), data.data(), info.get_size());
+    return data.data();
+}
+
+static unique_ptr<runtime::AlignedBuffer> decompress_cpio_record(const cpio::FileInfo& info,
+                                                                 const char* compressed)
+{
+    size_t size = compression::get_uncompressed_size(compressed, info.get_size());
+    unique_ptr<runtime::AlignedBuffer> buffer(new runtime::AlignedBuffer(size, s_cpio_alignment));
+    compression::decompress(compressed, info.get_size(), buffer->get_ptr(), size);
+    return buffer;
+}
+
+static shared_ptr<op::Constant> make_decompressed_constant(
+    unique_ptr<runtime::AlignedBuffer> buffer, const element::Type& et, const Shape& shape)
+{
+    if (buffer->size() != shape_size(shape) * et.size())
     {
-        cpio::Reader reader(in);
-        vector<cpio::FileInfo> file_info = reader.get_file_info();
-        if (file_info.size() > 0)
+        throw ngraph_error("Compressed constant data has the wrong size");
+    }
+    return make_shared<op::Constant>(et, shape, move(buffer));
+}
+
+// If mapped_file is set it holds the same bytes as the archive and a constant whose data is
+// suitably aligned in it becomes a view of the mapping instead of a copy. A compressed constant
+// is decompressed into a buffer of its own.
+static shared_ptr<op::Constant>
+    read_cpio_constant(cpio::Reader& reader,
+                       const vector<cpio::FileInfo>& file_info,
+                       const shared_ptr<runtime::MappedFile>& mapped_file,
+                       const string& const_name,
+                       const element::Type& et,
+                       const Shape& shape)
+{
+    shared_ptr<op::Constant> const_node;
+    for (const cpio::FileInfo& info : file_info)
+    {
+        if (info.get_name() == const_name)
         {
-            // The first file is the model
-            uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
-            char* data = new char[size];
-            reader.read(file_info[0].get_name(), data, size);
-            string jstr(data, size);
-            delete[] data;
-            json js = json::parse(jstr);
-            unordered_map<string, shared_ptr<Function>> function_map;
-            for (json func : js)
-            {
-                shared_ptr<Function> f = read_function(
-                    func,
-                    function_map,
-                    [&](const string& const_name, const element::Type& et, const Shape& shape) {
-                        shared_ptr<Node> const_node;
-                        for (const cpio::FileInfo& info : file_info)
-                        {
-                            if (info.get_name() == const_name)
-                            {
-                                void* const_data = ngraph_malloc(info.get_size());
-                                reader.read(const_name, const_data, info.get_size());
-                                const_node = make_shared<op::Constant>(et, shape, const_data);
-                                ngraph_free(const_data);
-                                break;
-                            }
-                        }
-                        return const_node;
-                    });
-                rc = f;
+            size_t alignment = max<size_t>(1, et.size());
+            if (mapped_file && info.get_offset() % alignment == 0 &&
+                info.get_offset() + info.get_size() <= mapped_file->size())
+            {
+                unique_ptr<runtime::AlignedBuffer> view(new runtime::AlignedBuffer(
+                    mapped_file->get_ptr(info.get_offset()), info.get_size(), mapped_file));
+                const_node = make_shared<op::Constant>(et, shape, move(view));
+            }
+            else
+            {
+                void* const_data = ngraph_malloc(info.get_size());
+                reader.read(const_name, const_data, info.get_size());
+                const_node = make_shared<op::Constant>(et, shape, const_data);
+                ngraph_free(const_data);
             }
+            break;
+        }
+        else if (info.get_name() == const_name + s_compressed_suffix)
+        {
+            vector<char> data;
+            const char* compressed = read_cpio_record(reader, info, mapped_file, data);
+            const_node = make_decompressed_constant(
+                decompress_cpio_record(info, compressed), et, shape);
+            break;
+        }
+    }
+    return const_node;
+}
+
+// Decompresses every compressed constant of the archive at once, in parallel. The buffers are
+// keyed by constant name.
+static unordered_map<string, unique_ptr<runtime::AlignedBuffer>>
+    decompress_cpio_constants(cpio::Reader& reader,
+                              const vector<cpio::FileInfo>& file_info,
+                              const shared_ptr<runtime::MappedFile>& mapped_file)
+{
+    vector<const cpio::FileInfo*> infos;
+    for (const cpio::FileInfo& info : file_info)
+    {
+        const string& name = info.get_name();
+        if (name.size() > s_compressed_suffix.size() &&
+            name.compare(name.size() - s_compressed_suffix.size(),
+                         s_compressed_suffix.size(),
+                         s_compressed_suffix) == 0)
+        {
+            infos.push_back(&info);
+        }
+    }
+    // the stream is read in order, only the decompression runs in parallel
+    vector<vector<char>> data(infos.size());
+    vector<const char*> compressed(infos.size());
+    for (size_t i = 0; i < infos.size(); i++)
+    {
+        compressed[i] = read_cpio_record(reader, *infos[i], mapped_file, data[i]);
+    }
+    vector<unique_ptr<runtime::AlignedBuffer>> buffers(infos.size());
+    parallel_for(infos.size(), [&](size_t i) {
+        buffers[i] = decompress_cpio_record(*infos[i], compressed[i]);
+        vector<char>().swap(data[i]);
+    });
+
+    unordered_map<string, unique_ptr<runtime::AlignedBuffer>> rc;
+    for (size_t i = 0; i < infos.size(); i++)
+    {
+        const string& name = infos[i]->get_name();
+        rc[name.substr(0, name.size() - s_compressed_suffix.size())] = move(buffers[i]);
+    }
+    return rc;
+}
+
+// The model is the first file of the archive
+static string read_cpio_model(cpio::Reader& reader, const vector<cpio::FileInfo>& file_info)
+{
+    uint32_t size = static_cast<uint32_t>(file_info[0].get_size());
+    char* data = new char[size];
+    reader.read(file_info[0].get_name(), data, size);
+    string jstr(data, size);
+    delete[] data;
+    return jstr;
+}
+
+static shared_ptr<ngraph::Function>
+    deserialize_cpio(istream& in, const shared_ptr<runtime::MappedFile>& mapped_file)
+{
+    shared_ptr<Function> rc;
+    cpio::Reader reader(in);
+    vector<cpio::FileInfo> file_info = reader.get_file_info();
+    if (file_info.size() > 0)
+    {
+        json js = json::parse(read_cpio_model(reader, file_info));
+        auto decompressed = decompress_cpio_constants(reader, file_info, mapped_file);
+        unordered_map<string, shared_ptr<Function>> function_map;
+        for (json func : js)
+        {
+            shared_ptr<Function> f = read_function(
+                func,
+                function_map,
+                [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                    auto it = decompressed.find(const_name);
+                    if (it != decompressed.end() && it->second)
+                    {
+                        return make_decompressed_constant(move(it->second), et, shape);
+                    }
+                    return read_cpio_constant(
+                        reader, file_info, mapped_file, const_name, et, shape);
+                });
+            rc = f;
+        }
+    }
+    return rc;
+}
+
+static bool is_binary(istream& in)
+{
+    auto position = in.tellg();
+    char magic[s_binary_magic_size];
+    in.seekg(0, ios_base::beg);
+    in.read(magic, s_binary_magic_size);
+    bool rc = in.gcount() == static_cast<streamsize>(s_binary_magic_size) &&
+              equal(magic, magic + s_binary_magic_size, s_binary_magic);
+    in.clear();
+    in.seekg(position);
+    return rc;
+}
+
+static uint64_t read_binary_uint(istream& in, size_t size)
+{
+    uint64_t value = 0;
+    for (size_t i = 0; i < size; i++)
+    {
+        int ch = in.get();
+        if (ch == char_traits<char>::eof())
+        {
+            throw ngraph_error("Binary model is truncated");
+        }
+        value |= static_cast<uint64_t>(static_cast<uint8_t>(ch)) << (8 * i);
+    }
+    return value;
+}
+
+static string read_binary_string(istream& in)
+{
+    string s(read_binary_uint(in, 4), '\0');
+    in.read(&s[0], s.size());
+    if (in.gcount() != static_cast<streamsize>(s.size()))
+    {
+        throw ngraph_error("Binary model is truncated");
+    }
+    return s;
+}
+
+static BinaryHeader read_binary_header(istream& in)
+{
+    BinaryHeader header;
+    in.seekg(s_binary_magic_size, ios_base::beg);
+    uint32_t version = static_cast<uint32_t>(read_binary_uint(in, 4));
+    if (version != s_binary_version)
+    {
+        stringstream ss;
+        ss << "Binary model version " << version << " is not supported, expected version "
+           << s_binary_version;
+        throw ngraph_error(ss.str());
+    }
+    header.ops.resize(read_binary_uint(in, 4));
+    for (string& op : header.ops)
+    {
+        op = read_binary_string(in);
+    }
+    for (vector<BinaryRecord>* records : {&header.functions, &header.constants})
+    {
+        records->resize(read_binary_uint(in, 4));
+        for (BinaryRecord& record : *records)
+        {
+            record.name = read_binary_string(in);
+            record.offset = read_binary_uint(in, 8);
+            record.size = read_binary_uint(in, 8);
         }
     }
+    return header;
+}
+
+static void read_binary_record(istream& in, const BinaryRecord& record, void* data)
+{
+    in.clear();
+    in.seekg(record.offset, ios_base::beg);
+    in.read(static_cast<char*>(data), record.size);
+    if (in.gcount() != static_cast<streamsize>(record.size))
+    {
+        throw ngraph_error("Binary model is truncated in record " + record.name);
+    }
+}
+
+// Reads the constant in record, as a view of mapped_file if it is set, holds the same bytes as
+// in and the data is suitably aligned in it
+static shared_ptr<op::Constant>
+    read_binary_constant(istream& in,
+                         const BinaryRecord& record,
+                         const shared_ptr<runtime::MappedFile>& mapped_file,
+                         const element::Type& et,
+                         const Shape& shape)
+{
+    if (record.size != shape_size(shape) * et.size())
+    {
+        throw ngraph_error("Binary model has the wrong data size for constant " + record.name);
+    }
+    unique_ptr<runtime::AlignedBuffer> buffer;
+    if (mapped_file && record.offset % max<size_t>(1, et.size()) == 0 &&
+        record.offset + record.size <= mapped_file->size())
+    {
+        buffer.reset(new runtime::AlignedBuffer(
+            mapped_file->get_ptr(record.offset), record.size, mapped_file));
+    }
+    else
+    {
+        buffer.reset(new runtime::AlignedBuffer(record.size, s_cpio_alignment));
+        read_binary_record(in, record, buffer->get_ptr());
+    }
+    return make_shared<op::Constant>(et, shape, move(buffer));
+}
+
+// Decodes the json of the function in record, with the op names restored
+static json
+    read_binary_function(istream& in, const BinaryHeader& header, const BinaryRecord& record)
+{
+    vector<uint8_t> data(record.size);
+    read_binary_record(in, record, data.data());
+    json func = json::from_cbor(data);
+    for (json& node : func.at("ops"))
+    {
+        size_t index = node.at("op").get<size_t>();
+        if (index >= header.ops.size())
+        {
+            throw ngraph_error("Binary model has an op index out of range in function " +
+                               record.name);
+        }
+        node["op"] = header.ops[index];
+    }
+    return func;
+}
+
+// Functions are decoded one record at a time, so only one function's json is held in memory.
+// Constants are read from their offsets as the nodes that use them are created.
+static shared_ptr<ngraph::Function>
+    deserialize_binary(istream& in, const shared_ptr<runtime::MappedFile>& mapped_file)
+{
+    BinaryHeader header = read_binary_header(in);
+    unordered_map<string, const BinaryRecord*> constant_records;
+    for (const BinaryRecord& record : header.constants)
+    {
+        constant_records.insert({record.name, &record});
+    }
+    auto const_data_callback =
+        [&](const string& const_name, const element::Type& et, const Shape& shape) {
+            shared_ptr<op::Constant> const_node;
+            auto it = constant_records.find(const_name);
+            if (it != constant_records.end())
+            {
+                const_node = read_binary_constant(in, *it->second, mapped_file, et, shape);
+            }
+            return const_node;
+        };
+
+    shared_ptr<Function> rc;
+    unordered_map<string, shared_ptr<Function>> function_map;
+    for (const BinaryRecord& record : header.functions)
+    {
+        rc = read_function(
+            read_binary_function(in, header, record), function_map, const_data_callback);
+    }
+    return rc;
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize(istream& in)
+{
+    shared_ptr<Function> rc;
+    if (cpio::is_cpio(in))
+    {
+        rc = deserialize_cpio(in, nullptr);
+    }
+    else if (is_binary(in))
+    {
+        rc = deserialize_binary(in, nullptr);
+    }
     else
     {
         // json file?
@@ -407,7 +1062,18 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     {
         // s is a file and not a json string
         ifstream in(s, ios_base::binary | ios_base::in);
-        rc = deserialize(in);
+        if (s_deserialize_mapped_constants_enabled && cpio::is_cpio(in))
+        {
+            rc = deserialize_cpio(in, make_shared<runtime::MappedFile>(s));
+        }
+        else if (s_deserialize_mapped_constants_enabled && is_binary(in))
+        {
+            rc = deserialize_binary(in, make_shared<runtime::MappedFile>(s));
+        }
+        else
+        {
+            rc = deserialize(in);
+        }
     }
     else
     {
@@ -423,6 +1089,253 @@ shared_ptr<ngraph::Function> ngraph::deserialize(const string& s)
     return rc;
 }
 
+namespace
+{
+    // Keeps the model file open and reads each function, with its constants, the first time
+    // it is asked for
+    class LazySerializedModel : public SerializedModel
+    {
+    public:
+        LazySerializedModel(const string& path);
+
+        const vector<string>& get_function_names() const override { return m_names; }
+        shared_ptr<Function> get_function(const string& name) override;
+
+    private:
+        ifstream m_in;
+        shared_ptr<runtime::MappedFile> m_mapped_file;
+        vector<string> m_names;
+        unordered_map<string, shared_ptr<Function>> m_function_map;
+        function<const_data_callback_t> m_const_data_callback;
+
+        // json and CPIO models, the json of each function is released once it is read
+        json m_functions;
+        unique_ptr<cpio::Reader> m_reader;
+        vector<cpio::FileInfo> m_file_info;
+
+        // binary models
+        bool m_is_binary = false;
+        BinaryHeader m_header;
+        unordered_map<string, const BinaryRecord*> m_constant_records;
+    };
+}
+
+LazySerializedModel::LazySerializedModel(const string& path)
+    : m_in(path, ios_base::binary | ios_base::in)
+{
+    if (!m_in)
+    {
+        throw ngraph_error("Unable to open model file " + path);
+    }
+    bool is_cpio = cpio::is_cpio(m_in);
+    m_is_binary = !is_cpio && is_binary(m_in);
+    if ((is_cpio || m_is_binary) && s_deserialize_mapped_constants_enabled)
+    {
+        m_mapped_file = make_shared<runtime::MappedFile>(path);
+    }
+
+    if (m_is_binary)
+    {
+        m_header = read_binary_header(m_in);
+        for (const BinaryRecord& record : m_header.functions)
+        {
+            m_names.push_back(record.name);
+        }
+        for (const BinaryRecord& record : m_header.constants)
+        {
+            m_constant_records.insert({record.name, &record});
+        }
+        m_const_data_callback =
+            [this](const string& const_name, const element::Type& et, const Shape& shape) {
+                shared_ptr<op::Constant> const_node;
+                auto it = m_constant_records.find(const_name);
+                if (it != m_constant_records.end())
+                {
+                    const_node =
+                        read_binary_constant(m_in, *it->second, m_mapped_file, et, shape);
+                }
+                return const_node;
+            };
+    }
+    else
+    {
+        if (is_cpio)
+        {
+            m_reader.reset(new cpio::Reader(m_in));
+            m_file_info = m_reader->get_file_info();
+            if (m_file_info.size() > 0)
+            {
+                m_functions = json::parse(read_cpio_model(*m_reader, m_file_info));
+            }
+            m_const_data_callback =
+                [this](const string& const_name, const element::Type& et, const Shape& shape) {
+                    return read_cpio_constant(
+                        *m_reader, m_file_info, m_mapped_file, const_name, et, shape);
+                };
+        }
+        else
+        {
+            m_functions = json::parse(m_in);
+        }
+        for (const json& func : m_functions)
+        {
+            m_names.push_back(func.at("name").get<string>());
+        }
+    }
+}
+
+shared_ptr<Function> LazySerializedModel::get_function(const string& name)
+{
+    auto it = m_function_map.find(name);
+    if (it != m_function_map.end())
+    {
+        return it->second;
+    }
+    auto name_it = find(m_names.begin(), m_names.end(), name);
+    if (name_it == m_names.end())
+    {
+        throw ngraph_error("Model has no function named " + name);
+    }
+    size_t index = distance(m_names.begin(), name_it);
+    if (m_is_binary)
+    {
+        return read_function(read_binary_function(m_in, m_header, m_header.functions[index]),
+                             m_function_map,
+                             m_const_data_callback);
+    }
+    shared_ptr<Function> rc =
+        read_function(m_functions[index], m_function_map, m_const_data_callback);
+    m_functions[index] = nullptr;
+    return rc;
+}
+
+shared_ptr<SerializedModel> ngraph::deserialize_lazy(const string& path)
+{
+    return make_shared<LazySerializedModel>(path);
+}
+
+// Broadcasts size bytes from rank 0 in chunks, which keeps every message within the int count
+// of the communication libraries
+static void
+    broadcast_bytes(DistributedInterface& distributed, void* data, size_t size, size_t chunk_size)
+{
+    char* bytes = static_cast<char*>(data);
+    for (size_t offset = 0; offset < size; offset += chunk_size)
+    {
+        distributed.broadcast(bytes + offset, element::Type_t::u8, min(chunk_size, size - offset));
+    }
+}
+
+shared_ptr<ngraph::Function> ngraph::deserialize_distributed(const string& path,
+                                                             size_t chunk_size)
+{
+    DistributedInterface* distributed = get_distributed_interface();
+    if (distributed->get_size() <= 1)
+    {
+        return deserialize(path);
+    }
+    NGRAPH_CHECK(chunk_size > 0, "Broadcast chunk size must be positive");
+    bool is_root = distributed->get_rank() == 0;
+
+    // Rank 0 tells the others what kind of model it found and how long the model json is
+    enum : uint64_t
+    {
+        MISSING,
+        JSON,
+        CPIO,
+        BINARY
+    };
+    uint64_t header[2] = {MISSING, 0};
+    ifstream in;
+    unique_ptr<cpio::Reader> reader;
+    vector<cpio::FileInfo> file_info;
+    shared_ptr<runtime::MappedFile> mapped_file;
+    string model;
+    if (is_root && file_util::exists(path))
+    {
+        in.open(path, ios_base::binary | ios_base::in);
+        if (is_binary(in))
+        {
+            header[0] = BINARY;
+        }
+        else if (cpio::is_cpio(in))
+        {
+            reader.reset(new cpio::Reader(in));
+            file_info = reader->get_file_info();
+            if (file_info.size() > 0)
+            {
+                model = read_cpio_model(*reader, file_info);
+                header[0] = CPIO;
+            }
+            if (s_deserialize_mapped_constants_enabled)
+            {
+                mapped_file = make_shared<runtime::MappedFile>(path);
+            }
+        }
+        else
+        {
+            stringstream ss;
+            ss << in.rdbuf();
+            model = ss.str();
+            header[0] = JSON;
+        }
+        header[1] = model.size();
+    }
+    broadcast_bytes(*distributed, header, sizeof(header), chunk_size);
+    if (header[0] == MISSING)
+    {
+        throw ngraph_error("Rank 0 could not read a model from " + path);
+    }
+    if (header[0] == BINARY)
+    {
+        throw ngraph_error("Binary model " + path +
+                           " can not be deserialized across ranks, convert it with reserialize "
+                           "to a CPIO archive");
+    }
+    model.resize(header[1]);
+    broadcast_bytes(*distributed, &model[0], model.size(), chunk_size);
+
+    function<const_data_callback_t> const_data_callback;
+    if (header[0] == CPIO)
+    {
+        // Every rank reads the same json and so asks for the constants in the same order. Rank 0
+        // broadcasts each one as it reads it and the others receive into fresh buffers.
+        const_data_callback =
+            [&](const string& const_name, const element::Type& et, const Shape& shape) {
+                size_t size = shape_size(shape) * et.size();
+                shared_ptr<op::Constant> const_node;
+                if (is_root)
+                {
+                    const_node =
+                        read_cpio_constant(*reader, file_info, mapped_file, const_name, et, shape);
+                    NGRAPH_CHECK(const_node, "No data found for constant ", const_name);
+                    // the root's buffer is only read, so a read-only mapping can be sent as is
+                    broadcast_bytes(*distributed,
+                                    const_cast<void*>(const_node->get_data_ptr()),
+                                    size,
+                                    chunk_size);
+                }
+                else
+                {
+                    unique_ptr<runtime::AlignedBuffer> buffer(
+                        new runtime::AlignedBuffer(size, s_cpio_alignment));
+                    broadcast_bytes(*distributed, buffer->get_ptr(), size, chunk_size);
+                    const_node = make_shared<op::Constant>(et, shape, move(buffer));
+                }
+                return const_node;
+            };
+    }
+
+    shared_ptr<Function> rc;
+    json js = json::parse(model);
+    unordered_map<string, shared_ptr<Function>> function_map;
+    for (json func : js)
+    {
+        rc = read_function(func, function_map, const_data_callback);
+    }
+    return rc;
+}
+
 static json write(const Function& f, bool binary_constant_data)
 {
     json function;
@@ -484,6 +1397,7 @@ static shared_ptr<ngraph::Function>
             string friendly_name = get_value<string>(node_js, "friendly_name");
             vector<string> node_inputs = get_value<vector<string>>(node_js, "inputs");
             vector<string> control_deps_inputs = get_value<vector<string>>(node_js, "control_deps");
+            vector<string> provenance_tags = get_value<vector<string>>(node_js, "provenance_tags");
             vector<string> node_outputs = get_value<vector<string>>(node_js, "outputs");
             shared_ptr<Node> node;
             vector<shared_ptr<Node>> args;
@@ -507,6 +1421,41 @@ static shared_ptr<ngraph::Function>
                 node = make_shared<op::Acos>(args[0]);
                 break;
             }
+            case OP_TYPEID::AdamUpdate:
+            {
+                auto beta1 = node_js.at("beta1").get<double>();
+                auto beta2 = node_js.at("beta2").get<double>();
+                auto epsilon = node_js.at("epsilon").get<double>();
+                auto loss_scaled = get_or_default<bool>(node_js, "loss_scaled", false);
+                size_t scalars = loss_scaled ? 3 : 1;
+                size_t n = (args.size() - scalars) / 4;
+                auto first = args.begin() + scalars;
+                if (loss_scaled)
+                {
+                    node = make_shared<op::AdamUpdate>(args[0],
+                                                       args[1],
+                                                       args[2],
+                                                       NodeVector(first, first + n),
+                                                       NodeVector(first + n, first + 2 * n),
+                                                       NodeVector(first + 2 * n, first + 3 * n),
+                                                       NodeVector(first + 3 * n, first + 4 * n),
+                                                       beta1,
+                                                       beta2,
+                                                       epsilon);
+                }
+                else
+                {
+                    node = make_shared<op::AdamUpdate>(args[0],
+                                                       NodeVector(first, first + n),
+                                                       NodeVector(first + n, first + 2 * n),
+                                                       NodeVector(first + 2 * n, first + 3 * n),
+                                                       NodeVector(first + 3 * n, first + 4 * n),
+                                                       beta1,
+                                                       beta2,
+                                                       epsilon);
+                }
+                break;
+            }
             case OP_TYPEID::Add:
             {
                 node = make_shared<op::Add>(args[0], args[1]);
@@ -518,9 +1467,23 @@ static shared_ptr<ngraph::Function>
                 node = make_shared<op::All>(args[0], reduction_axes);
                 break;
             }
+            case OP_TYPEID::AllFinite:
+            {
+                node = make_shared<op::AllFinite>(args);
+                break;
+            }
+            case OP_TYPEID::AllGather:
+            {
+                auto shard_count = node_js.at("shard_count").get<size_t>();
+                node = make_shared<op::AllGather>(args[0], shard_count);
+                break;
+            }
             case OP_TYPEID::AllReduce:
             {
-                node = make_shared<op::AllReduce>(args[0]);
+                auto compressed_type = node_js.count("compressed_type") == 0
+                                           ? element::dynamic
+                                           : read_element_type(node_js.at("compressed_type"));
+                node = make_shared<op::AllReduce>(args[0], compressed_type);
                 break;
             }
             case OP_TYPEID::And:
@@ -662,8 +1625,17 @@ static shared_ptr<ngraph::Function>
                     node_js.count("element_type") == 0 ? node_js.at("value_type") : node_js;
                 auto element_type = read_element_type(type_node_js.at("element_type"));
                 auto shape = type_node_js.at("shape");
-                auto value = node_js.at("value").get<vector<string>>();
-                node = make_shared<op::Constant>(element_type, shape, value);
+                if (node_js.count("value") == 0 && const_data_callback)
+                {
+                    // Binary constant data is stored next to the model under the node's name
+                    node = const_data_callback(node_name, element_type, shape);
+                    NGRAPH_CHECK(node, "No data found for constant ", node_name);
+                }
+                else
+                {
+                    auto value = node_js.at("value").get<vector<string>>();
+                    node = make_shared<op::Constant>(element_type, shape, value);
+                }
                 break;
             }
             case OP_TYPEID::Convert:
@@ -874,6 +1846,21 @@ static shared_ptr<ngraph::Function>
                 }
                 break;
             }
+            case OP_TYPEID::Dropout:
+            {
+                auto seed = node_js.at("seed").get<unsigned int>();
+                auto keep_probability = node_js.at("keep_probability").get<double>();
+                node = make_shared<op::Dropout>(args[0], args[1], seed, keep_probability);
+                break;
+            }
+            case OP_TYPEID::DropoutBackprop:
+            {
+                auto seed = node_js.at("seed").get<unsigned int>();
+                auto keep_probability = node_js.at("keep_probability").get<double>();
+                node = make_shared<op::DropoutBackprop>(
+                    args[0], args[1], args[2], seed, keep_probability);
+                break;
+            }
             case OP_TYPEID::DynBroadcast:
             {
                 node = make_shared<op::DynBroadcast>(args[0], args[1], args[2]);
@@ -901,7 +1888,20 @@ static shared_ptr<ngraph::Function>
             }
             case OP_TYPEID::EmbeddingLookup:
             {
-                node = make_shared<op::EmbeddingLookup>(args[0], args[1]);
+                if (args.size() == 4)
+                {
+                    node = make_shared<op::EmbeddingLookup>(args[0], args[1], args[2], args[3]);
+                }
+                else
+                {
+                    node = make_shared<op::EmbeddingLookup>(args[0], args[1]);
+                }
+                break;
+            }
+            case OP_TYPEID::EmbeddingLookupBackprop:
+            {
+                auto weights_shape = node_js.at("weights_shape").get<vector<size_t>>();
+                node = make_shared<op::EmbeddingLookupBackprop>(args[0], args[1], weights_shape);
                 break;
             }
             case OP_TYPEID::Equal:
@@ -935,6 +1935,12 @@ static shared_ptr<ngraph::Function>
                 node = make_shared<op::GatherND>(args[0], args[1]);
                 break;
             }
+            case OP_TYPEID::Gelu:
+            {
+                auto approximate = node_js.at("approximate").get<bool>();
+                node = make_shared<op::Gelu>(args[0], approximate);
+                break;
+            }
             case OP_TYPEID::Gemm:
             {
                 auto alpha = node_js.at("alpha").get<double>();
@@ -978,6 +1984,15 @@ static shared_ptr<ngraph::Function>
                 node = make_shared<op::HardSigmoid>(args[0], alpha, beta);
                 break;
             }
+            case OP_TYPEID::If:
+            {
+                // the bodies are written before the functions that call them
+                auto then_body = function_map.at(node_js.at("then_body").get<string>());
+                auto else_body = function_map.at(node_js.at("else_body").get<string>());
+                node = make_shared<op::If>(
+                    args[0], NodeVector(args.begin() + 1, args.end()), then_body, else_body);
+                break;
+            }
             case OP_TYPEID::GroupConvolution:
             {
                 auto window_movement_strides =
@@ -1005,6 +2020,14 @@ static shared_ptr<ngraph::Function>
                                                          pad_type);
                 break;
             }
+            case OP_TYPEID::LayerNorm:
+            {
+                auto epsilon = node_js.at("epsilon").get<double>();
+                auto begin_norm_axis = node_js.at("begin_norm_axis").get<size_t>();
+                node = make_shared<op::LayerNorm>(
+                    args[0], args[1], args[2], epsilon, begin_norm_axis);
+                break;
+            }
             case OP_TYPEID::Less:
             {
                 node = make_shared<op::Less>(args[0], args[1]);
@@ -1020,6 +2043,18 @@ static shared_ptr<ngraph::Function>
                 node = make_shared<op::Log>(args[0]);
                 break;
             }
+            case OP_TYPEID::Loop:
+            {
+                auto body = function_map.at(node_js.at("body").get<string>());
+                auto carried_count = node_js.at("carried_count").get<size_t>();
+                auto carried_end = args.begin() + 2 + carried_count;
+                node = make_shared<op::Loop>(args[0],
+                                             args[1],
+                                             NodeVector(args.begin() + 2, carried_end),
+                                             NodeVector(carried_end, args.end()),
+                                             body);
+                break;
+            }
             case OP_TYPEID::LRN:
             {
                 auto alpha = node_js.at("alpha").get<double>();
@@ -1179,8 +2214,10 @@ static shared_ptr<ngraph::Function>
                 auto element_type = read_element_type(type_node_js.at("element_type"));
                 auto shape = type_node_js.at("shape");
                 auto cacheable = get_or_default<bool>(node_js, "cacheable", false);
-                node =
+                auto parameter =
                     make_shared<op::Parameter>(element_type, read_partial_shape(shape), cacheable);
+                parameter->set_persistent(get_or_default<bool>(node_js, "persistent", false));
+                node = parameter;
                 break;
             }
             case OP_TYPEID::Passthrough:
@@ -1287,6 +2324,21 @@ static shared_ptr<ngraph::Function>
 
                 break;
             }
+            case OP_TYPEID::Recv:
+            {
+                auto element_type = read_element_type(node_js.at("element_type"));
+                auto shape = node_js.at("shape").get<vector<size_t>>();
+                auto src_rank = node_js.at("src_rank").get<int>();
+                auto tag = node_js.at("tag").get<int>();
+                node = make_shared<op::Recv>(element_type, shape, src_rank, tag);
+                break;
+            }
+            case OP_TYPEID::ReduceScatter:
+            {
+                auto shard_count = node_js.at("shard_count").get<size_t>();
+                node = make_shared<op::ReduceScatter>(args[0], shard_count);
+                break;
+            }
             case OP_TYPEID::Relu:
             {
                 node = make_shared<op::Relu>(args[0]);
@@ -1338,11 +2390,62 @@ static shared_ptr<ngraph::Function>
                 node = make_shared<op::ScalarConstantLike>(args[0], value);
                 break;
             }
+            case OP_TYPEID::ScaledDotProductAttention:
+            {
+                auto scale = node_js.at("scale").get<double>();
+                if (args.size() == 4)
+                {
+                    node = make_shared<op::ScaledDotProductAttention>(
+                        args[0], args[1], args[2], args[3], scale);
+                }
+                else
+                {
+                    node = make_shared<op::ScaledDotProductAttention>(
+                        args[0], args[1], args[2], scale);
+                }
+                break;
+            }
             case OP_TYPEID::Select:
             {
                 node = make_shared<op::Select>(args[0], args[1], args[2]);
                 break;
             }
+            case OP_TYPEID::Send:
+            {
+                auto dest_rank = node_js.at("dest_rank").get<int>();
+                auto tag = node_js.at("tag").get<int>();
+                node = make_shared<op::Send>(args[0], dest_rank, tag);
+                break;
+            }
+            case OP_TYPEID::SgdMomentumUpdate:
+            {
+                auto momentum = node_js.at("momentum").get<double>();
+                auto loss_scaled = get_or_default<bool>(node_js, "loss_scaled", false);
+                size_t scalars = loss_scaled ? 3 : 1;
+                size_t n = (args.size() - scalars) / 3;
+                auto first = args.begin() + scalars;
+                if (loss_scaled)
+                {
+                    node = make_shared<op::SgdMomentumUpdate>(
+                        args[0],
+                        args[1],
+                        args[2],
+                        NodeVector(first, first + n),
+                        NodeVector(first + n, first + 2 * n),
+                        NodeVector(first + 2 * n, first + 3 * n),
+                        momentum);
+                }
+                else
+                {
+                    node = make_shared<op::SgdMomentumUpdate>(
+                        args[0],
+                        NodeVector(first, first + n),
+                        NodeVector(first + n, first + 2 * n),
+                        NodeVector(first + 2 * n, first + 3 * n),
+                        momentum);
+                }
+                break;
+            }
             case OP_TYPEID::ShapeOf:
             {
                 node = make_shared<op::ShapeOf>(args[0]);
@@ -1461,6 +2564,10 @@ static shared_ptr<ngraph::Function>
             {
                 node->set_friendly_name(friendly_name);
             }
+            for (const string& tag : provenance_tags)
+            {
+                node->add_provenance_tag(tag);
+            }
             node_map[node_name] = node;
         }
         catch (...)
@@ -1524,6 +2631,12 @@ static json write(const Node& n, bool binary_constant_data)
     {
         node["friendly_name"] = n.get_friendly_name();
     }
+    if (!n.get_provenance_tags().empty())
+    {
+        // Sorted so that the same graph always serializes the same way
+        set<string> tags(n.get_provenance_tags().begin(), n.get_provenance_tags().end());
+        node["provenance_tags"] = vector<string>(tags.begin(), tags.end());
+    }
     node["op"] = n.description();
     // TODO Multiple outputs
     json inputs = json::array();
@@ -1577,6 +2690,18 @@ static json write(const Node& n, bool binary_constant_data)
     }
     case OP_TYPEID::Acos: { break;
     }
+    case OP_TYPEID::AdamUpdate:
+    {
+        auto tmp = dynamic_cast<const op::AdamUpdate*>(&n);
+        node["beta1"] = tmp->get_beta1();
+        node["beta2"] = tmp->get_beta2();
+        node["epsilon"] = tmp->get_epsilon();
+        if (tmp->is_loss_scaled())
+        {
+            node["loss_scaled"] = true;
+        }
+        break;
+    }
     case OP_TYPEID::Add: { break;
     }
     case OP_TYPEID::ArgMin:
@@ -1599,7 +2724,22 @@ static json write(const Node& n, bool binary_constant_data)
         node["reduction_axes"] = tmp->get_reduction_axes();
         break;
     }
-    case OP_TYPEID::AllReduce: { break;
+    case OP_TYPEID::AllFinite: { break;
+    }
+    case OP_TYPEID::AllGather:
+    {
+        auto tmp = dynamic_cast<const op::AllGather*>(&n);
+        node["shard_count"] = tmp->get_shard_count();
+        break;
+    }
+    case OP_TYPEID::AllReduce:
+    {
+        auto tmp = dynamic_cast<const op::AllReduce*>(&n);
+        if (tmp->is_compressed())
+        {
+            node["compressed_type"] = write_element_type(tmp->get_compressed_type());
+        }
+        break;
     }
     case OP_TYPEID::And: { break;
     }
@@ -1681,10 +2821,14 @@ static json write(const Node& n, bool binary_constant_data)
     case OP_TYPEID::Constant:
     {
         auto tmp = dynamic_cast<const op::Constant*>(&n);
-        if (tmp->are_all_data_elements_bitwise_identical())
+        if (binary_constant_data)
+        {
+            // The data is written separately by the caller
+        }
+        else if (tmp->are_all_data_elements_bitwise_identical())
         {
             vector<string> vs;
-            vs.push_back(tmp->get_value_strings()[0]);
+            vs.push_back(tmp->convert_value_to_string(0));
             node["value"] = vs;
         }
         else
@@ -1792,6 +2936,20 @@ static json write(const Node& n, bool binary_constant_data)
         node["reduction_axes_count"] = tmp->get_reduction_axes_count();
         break;
     }
+    case OP_TYPEID::Dropout:
+    {
+        auto tmp = dynamic_cast<const op::Dropout*>(&n);
+        node["seed"] = tmp->get_seed();
+        node["keep_probability"] = tmp->get_keep_probability();
+        break;
+    }
+    case OP_TYPEID::DropoutBackprop:
+    {
+        auto tmp = dynamic_cast<const op::DropoutBackprop*>(&n);
+        node["seed"] = tmp->get_seed();
+        node["keep_probability"] = tmp->get_keep_probability();
+        break;
+    }
     case OP_TYPEID::DynBroadcast: { break;
     }
     case OP_TYPEID::DynPad: { break;
@@ -1804,6 +2962,12 @@ static json write(const Node& n, bool binary_constant_data)
     }
     case OP_TYPEID::EmbeddingLookup: { break;
     }
+    case OP_TYPEID::EmbeddingLookupBackprop:
+    {
+        auto tmp = dynamic_cast<const op::EmbeddingLookupBackprop*>(&n);
+        node["weights_shape"] = tmp->get_weights_shape();
+        break;
+    }
     case OP_TYPEID::Equal: { break;
     }
     case OP_TYPEID::Erf: { break;
@@ -1826,6 +2990,12 @@ static json write(const Node& n, bool binary_constant_data)
         node["n"] = tmp->get_n();
         break;
     }
+    case OP_TYPEID::Gelu:
+    {
+        auto tmp = dynamic_cast<const op::Gelu*>(&n);
+        node["approximate"] = tmp->get_approximate();
+        break;
+    }
     case OP_TYPEID::Gemm:
     {
         auto tmp = dynamic_cast<const op::Gemm*>(&n);
@@ -1855,6 +3025,13 @@ static json write(const Node& n, bool binary_constant_data)
         node["beta"] = tmp->get_beta();
         break;
     }
+    case OP_TYPEID::If:
+    {
+        auto tmp = dynamic_cast<const op::If*>(&n);
+        node["then_body"] = tmp->get_then_body()->get_name();
+        node["else_body"] = tmp->get_else_body()->get_name();
+        break;
+    }
     case OP_TYPEID::GroupConvolution:
     {
         auto tmp = dynamic_cast<const op::GroupConvolution*>(&n);
@@ -1867,12 +3044,26 @@ static json write(const Node& n, bool binary_constant_data)
         node["pad_type"] = tmp->get_pad_type();
         break;
     }
+    case OP_TYPEID::LayerNorm:
+    {
+        auto tmp = dynamic_cast<const op::LayerNorm*>(&n);
+        node["epsilon"] = tmp->get_epsilon();
+        node["begin_norm_axis"] = tmp->get_begin_norm_axis();
+        break;
+    }
     case OP_TYPEID::Less: { break;
     }
     case OP_TYPEID::LessEq: { break;
     }
     case OP_TYPEID::Log: { break;
     }
+    case OP_TYPEID::Loop:
+    {
+        auto tmp = dynamic_cast<const op::Loop*>(&n);
+        node["body"] = tmp->get_body()->get_name();
+        node["carried_count"] = tmp->get_carried_count();
+        break;
+    }
     case OP_TYPEID::LRN:
     {
         auto tmp = dynamic_cast<const op::LRN*>(&n);
@@ -1947,6 +3138,10 @@ static json write(const Node& n, bool binary_constant_data)
         auto tmp = dynamic_cast<const op::Parameter*>(&n);
         node["shape"] = write_partial_shape(tmp->get_output_partial_shape(0));
         node["cacheable"] = tmp->get_cacheable();
+        if (tmp->get_persistent())
+        {
+            node["persistent"] = true;
+        }
         node["element_type"] = write_element_type(tmp->get_element_type());
         break;
     }
@@ -2026,6 +3221,21 @@ static json write(const Node& n, bool binary_constant_data)
         node["padding_above"] = tmp->get_padding_above();
         break;
     }
+    case OP_TYPEID::Recv:
+    {
+        auto tmp = dynamic_cast<const op::Recv*>(&n);
+        node["element_type"] = write_element_type(tmp->get_element_type());
+        node["shape"] = tmp->get_shape();
+        node["src_rank"] = tmp->get_src_rank();
+        node["tag"] = tmp->get_tag();
+        break;
+    }
+    case OP_TYPEID::ReduceScatter:
+    {
+        auto tmp = dynamic_cast<const op::ReduceScatter*>(&n);
+        node["shard_count"] = tmp->get_shard_count();
+        break;
+    }
     case OP_TYPEID::Relu: { break;
     }
     case OP_TYPEID::ReluBackprop: { break;
@@ -2064,12 +3274,35 @@ static json write(const Node& n, bool binary_constant_data)
     {
         auto tmp = dynamic_cast<const op::ScalarConstantLikeBase*>(&n);
         auto constant = tmp->as_constant();
-        node["value"] = constant->get_value_strings()[0];
+        node["value"] = constant->convert_value_to_string(0);
         node["element_type"] = write_element_type(constant->get_element_type());
         break;
     }
+    case OP_TYPEID::ScaledDotProductAttention:
+    {
+        auto tmp = dynamic_cast<const op::ScaledDotProductAttention*>(&n);
+        node["scale"] = tmp->get_scale();
+        break;
+    }
     case OP_TYPEID::Select: { break;
     }
+    case OP_TYPEID::Send:
+    {
+        auto tmp = dynamic_cast<const op::Send*>(&n);
+        node["dest_rank"] = tmp->get_dest_rank();
+        node["tag"] = tmp->get_tag();
+        break;
+    }
+    case OP_TYPEID::SgdMomentumUpdate:
+    {
+        auto tmp = dynamic_cast<const op::SgdMomentumUpdate*>(&n);
+        node["momentum"] = tmp->get_momentum();
+        if (tmp->is_loss_scaled())
+        {
+            node["loss_scaled"] = true;
+        }
+        break;
+    }
     case OP_TYPEID::ShapeOf: { break;
     }
     case OP_TYPEID::Sigmoid: { break;
@@ -30,7 +30,21 @@ namespace ngraph
     ///    indent level specified.
     std::string serialize(std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
-    /// \brief Serialize a Function to a json file
+    /// \brief Canonical json description of the computation of a Function, for use as a
+    ///        cache key. Node and tensor names are replaced by positions in topological order
+    ///        and constant values by a hash of their bytes, so two Functions built or imported
+    ///        separately describe equal when they compute the same results from the same
+    ///        parameters. Functions called by ops are referred to by name only.
+    /// \param func The Function to describe
+    std::string serialize_structure(std::shared_ptr<ngraph::Function> func);
+
+    /// \brief Serialize a Function to a json file. If path ends in ".cpio" the Function is
+    ///        written as a CPIO archive instead: the json model with each constant's data in
+    ///        its own record, aligned to 64 bytes, after an index of all records. If path ends
+    ///        in ".ngb" the Function is written in the binary format: a versioned header with
+    ///        an op table and the offsets of every function and constant, each function as a
+    ///        compact binary record and the constant data aligned to 64 bytes. indent does not
+    ///        apply to the binary format.
     /// \param path The path to the output file
     /// \param func The Function to serialize
     /// \param indent If 0 then there is no formatting applied and the resulting string is the
@@ -48,17 +62,66 @@ namespace ngraph
     ///    indent level specified.
     void serialize(std::ostream& out, std::shared_ptr<ngraph::Function> func, size_t indent = 0);
 
-    /// \brief Deserialize a Function
-    /// \param in An isteam to the input data
+    /// \brief Deserialize a Function from json, a CPIO archive or the binary format
+    /// \param in An isteam to the input data, opened in binary mode for the latter two
     std::shared_ptr<ngraph::Function> deserialize(std::istream& in);
 
     /// \brief Deserialize a Function
     /// \param str The json formatted string to deseriailze.
     std::shared_ptr<ngraph::Function> deserialize(const std::string& str);
 
+    /// \brief A model file whose functions are deserialized when they are first asked for
+    class SerializedModel
+    {
+    public:
+        virtual ~SerializedModel() {}
+        /// \brief The names of the functions in the model, in file order. The last one is the
+        ///        function that deserialize returns.
+        virtual const std::vector<std::string>& get_function_names() const = 0;
+        /// \brief Deserializes the named function and its constants the first time, and
+        ///        returns the same Function after that
+        virtual std::shared_ptr<ngraph::Function> get_function(const std::string& name) = 0;
+    };
+
+    /// \brief Open a json, CPIO or binary model file without deserializing its functions
+    /// \param path The model file, kept open while the returned model lives
+    ///
+    /// Only the functions asked for are built, and only the constants they use are read, so
+    /// memory use and load time follow what is compiled rather than the whole model. Constants
+    /// are memory mapped if set_deserialize_mapped_constants is enabled.
+    std::shared_ptr<SerializedModel> deserialize_lazy(const std::string& path);
+
+    /// \brief Deserialize a Function from a model file that only rank 0 reads
+    /// \param path The model file, needed on rank 0 only
+    /// \param chunk_size The largest broadcast, in bytes
+    ///
+    /// Rank 0 broadcasts the model json to the other ranks, then the data of each constant of a
+    /// CPIO model as it reads it, memory mapped if set_deserialize_mapped_constants is enabled.
+    /// All ranks must call this together. Without other ranks this is deserialize(path).
+    std::shared_ptr<ngraph::Function> deserialize_distributed(const std::string& path,
+                                                              size_t chunk_size = 64 << 20);
+
     /// \brief If enabled adds output shapes to the serialized graph
     /// \param enable Set to true to enable or false otherwise
     ///
     /// Option may be enabled by setting the environment variable NGRAPH_SERIALIZER_OUTPUT_SHAPES
     void set_serialize_output_shapes(bool enable);
+
+    /// \brief Constants of at least threshold bytes are compressed when a Function is
+    ///        serialized to a CPIO archive, 0 disables compression. The bytes of floating point
+    ///        constants are shuffled and all are run length encoded, see compression.hpp; a
+    ///        constant that does not get smaller stays raw. Deserializing decompresses the
+    ///        constants in parallel, each straight into the buffer of its Constant.
+    /// \param threshold Size in bytes of the smallest constant to compress
+    ///
+    /// Option may be set with the environment variable NGRAPH_SERIALIZER_COMPRESS
+    void set_serialize_compression_threshold(size_t threshold);
+
+    /// \brief If enabled, deserializing a CPIO or binary model file by path maps the file into
+    ///        memory and constants use the mapped data directly instead of a private copy. The
+    ///        mapping lives as long as the last constant that refers to it.
+    /// \param enable Set to true to enable or false otherwise
+    ///
+    /// Option may be enabled by setting the environment variable NGRAPH_DESERIALIZE_MMAP
+    void set_deserialize_mapped_constants(bool enable);
 }
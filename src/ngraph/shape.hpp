@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cstdio>
+#include <utility>
 #include <vector>
 
 #include "ngraph/axis_set.hpp"
@@ -43,6 +44,16 @@ namespace ngraph
         {
         }
 
+        Shape(std::vector<size_t>&& axis_lengths) noexcept
+            : std::vector<size_t>(std::move(axis_lengths))
+        {
+        }
+
+        Shape(Shape&& axis_lengths) noexcept
+            : std::vector<size_t>(std::move(axis_lengths))
+        {
+        }
+
         explicit Shape(size_t n, size_t initial_value = 0)
             : std::vector<size_t>(n, initial_value)
         {
@@ -60,9 +71,9 @@ namespace ngraph
             static_cast<std::vector<size_t>*>(this)->operator=(v);
             return *this;
         }
-        Shape& operator=(Shape&& v)
+        Shape& operator=(Shape&& v) noexcept
         {
-            static_cast<std::vector<size_t>*>(this)->operator=(v);
+            static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
             return *this;
         }
     };
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include "ngraph/specialize_shapes.hpp"
+#include "ngraph/op/constant.hpp"
 
 using namespace ngraph;
 
@@ -22,11 +23,25 @@ std::shared_ptr<Function>
     ngraph::specialize_shapes(std::shared_ptr<Function> f,
                               const std::vector<element::Type>& parameter_element_types,
                               const std::vector<PartialShape>& parameter_shapes)
+{
+    return specialize_shapes(f,
+                             parameter_element_types,
+                             parameter_shapes,
+                             std::vector<void*>(parameter_shapes.size(), nullptr));
+}
+
+std::shared_ptr<Function>
+    ngraph::specialize_shapes(std::shared_ptr<Function> f,
+                              const std::vector<element::Type>& parameter_element_types,
+                              const std::vector<PartialShape>& parameter_shapes,
+                              const std::vector<void*>& parameter_values)
 {
     NGRAPH_CHECK(f->get_parameters().size() == parameter_shapes.size());
     NGRAPH_CHECK(f->get_parameters().size() == parameter_element_types.size());
+    NGRAPH_CHECK(f->get_parameters().size() == parameter_values.size());
 
     NodeMap m;
+    ParameterVector new_parameters;
 
     for (size_t i = 0; i < parameter_shapes.size(); i++)
     {
@@ -35,8 +50,23 @@ std::shared_ptr<Function>
         NGRAPH_CHECK(f->get_parameters()[i]->get_element_type().is_dynamic() ||
                      parameter_element_types[i] == f->get_parameters()[i]->get_element_type());
 
-        m[f->get_parameters()[i].get()] =
+        auto new_parameter =
             std::make_shared<op::Parameter>(parameter_element_types[i], parameter_shapes[i]);
+        new_parameters.push_back(new_parameter);
+
+        if (parameter_values[i] != nullptr)
+        {
+            NGRAPH_CHECK(parameter_element_types[i].is_static() &&
+                         parameter_shapes[i].is_static());
+            m[f->get_parameters()[i].get()] =
+                std::make_shared<op::Constant>(parameter_element_types[i],
+                                               parameter_shapes[i].to_shape(),
+                                               parameter_values[i]);
+        }
+        else
+        {
+            m[f->get_parameters()[i].get()] = new_parameter;
+        }
     }
 
     for (auto old_node : f->get_ordered_ops())
@@ -56,12 +86,6 @@ std::shared_ptr<Function>
         m[old_node.get()] = old_node->copy_with_new_args(new_args);
     }
 
-    ParameterVector new_parameters = f->get_parameters();
-    for (size_t i = 0; i < new_parameters.size(); i++)
-    {
-        new_parameters[i] = std::static_pointer_cast<op::Parameter>(m[new_parameters[i].get()]);
-    }
-
     ResultVector new_results = f->get_results();
     for (size_t i = 0; i < new_results.size(); i++)
     {
@@ -88,4 +88,26 @@ namespace ngraph
         specialize_shapes(std::shared_ptr<Function> f,
                           const std::vector<element::Type>& parameter_element_types,
                           const std::vector<PartialShape>& parameter_shapes);
+
+    /// \brief Creates a shape-specialized clone of a function, additionally substituting known
+    ///        values for some of its parameters.
+    /// \param f The function to be cloned.
+    /// \param parameter_element_types The new parameter element types to substitute.
+    /// \param parameter_shapes The new parameter shapes to substitute.
+    /// \param parameter_values Parameter values to substitute. Each entry is either nullptr
+    ///        (the parameter is left as-is) or a pointer to a buffer holding the parameter's
+    ///        value, laid out according to its specialized element type and shape.
+    /// \return A clone of f, with the parameter element types and shapes specialized, and every
+    ///         use of a parameter with a supplied value replaced by a Constant.
+    ///
+    /// The parameters themselves are kept (with specialized types and shapes) so that the clone
+    /// still takes the same inputs as f; only their uses are replaced. For each non-null entry of
+    /// parameter_values the corresponding element type and shape must be static. This is
+    /// typically used to fill in the values of shape-relevant parameters (see
+    /// pass::ShapeRelevance) so that later passes can resolve dynamic shapes.
+    std::shared_ptr<Function>
+        specialize_shapes(std::shared_ptr<Function> f,
+                          const std::vector<element::Type>& parameter_element_types,
+                          const std::vector<PartialShape>& parameter_shapes,
+                          const std::vector<void*>& parameter_values);
 }
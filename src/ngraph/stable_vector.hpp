@@ -0,0 +1,138 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ngraph
+{
+    /// \brief A vector of individually allocated elements. Elements never move once
+    ///        constructed, so they can be neither copyable nor movable, and pointers to them
+    ///        stay valid as the vector grows. Unlike std::deque, an empty StableVector does
+    ///        not allocate.
+    template <typename T>
+    class StableVector
+    {
+        using Storage = std::vector<std::unique_ptr<T>>;
+
+        template <typename Value, typename BaseIterator>
+        class Iterator
+        {
+        public:
+            using iterator_category = std::random_access_iterator_tag;
+            using value_type = typename std::remove_const<Value>::type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = Value*;
+            using reference = Value&;
+
+            Iterator() = default;
+            explicit Iterator(BaseIterator it)
+                : m_it(it)
+            {
+            }
+            // const_iterator from iterator
+            template <typename OtherValue, typename OtherBase>
+            Iterator(const Iterator<OtherValue, OtherBase>& other)
+                : m_it(other.base())
+            {
+            }
+
+            Value& operator*() const { return **m_it; }
+            Value* operator->() const { return m_it->get(); }
+            Value& operator[](std::ptrdiff_t n) const { return *m_it[n]; }
+            Iterator& operator++()
+            {
+                ++m_it;
+                return *this;
+            }
+            Iterator operator++(int) { return Iterator(m_it++); }
+            Iterator& operator--()
+            {
+                --m_it;
+                return *this;
+            }
+            Iterator operator--(int) { return Iterator(m_it--); }
+            Iterator& operator+=(std::ptrdiff_t n)
+            {
+                m_it += n;
+                return *this;
+            }
+            Iterator& operator-=(std::ptrdiff_t n)
+            {
+                m_it -= n;
+                return *this;
+            }
+            Iterator operator+(std::ptrdiff_t n) const { return Iterator(m_it + n); }
+            Iterator operator-(std::ptrdiff_t n) const { return Iterator(m_it - n); }
+            std::ptrdiff_t operator-(const Iterator& other) const { return m_it - other.m_it; }
+            bool operator==(const Iterator& other) const { return m_it == other.m_it; }
+            bool operator!=(const Iterator& other) const { return m_it != other.m_it; }
+            bool operator<(const Iterator& other) const { return m_it < other.m_it; }
+            bool operator>(const Iterator& other) const { return m_it > other.m_it; }
+            bool operator<=(const Iterator& other) const { return m_it <= other.m_it; }
+            bool operator>=(const Iterator& other) const { return m_it >= other.m_it; }
+            const BaseIterator& base() const { return m_it; }
+        private:
+            BaseIterator m_it;
+        };
+
+    public:
+        using value_type = T;
+        using size_type = size_t;
+        using reference = T&;
+        using const_reference = const T&;
+        using iterator = Iterator<T, typename Storage::iterator>;
+        using const_iterator = Iterator<const T, typename Storage::const_iterator>;
+
+        StableVector() = default;
+        StableVector(const StableVector&) = delete;
+        StableVector& operator=(const StableVector&) = delete;
+
+        template <typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            std::unique_ptr<T> element(new T(std::forward<Args>(args)...));
+            m_elements.push_back(std::move(element));
+            return *m_elements.back();
+        }
+        void reserve(size_t n) { m_elements.reserve(n); }
+        size_t size() const { return m_elements.size(); }
+        bool empty() const { return m_elements.empty(); }
+        T& operator[](size_t i) { return *m_elements[i]; }
+        const T& operator[](size_t i) const { return *m_elements[i]; }
+        T& at(size_t i) { return *m_elements.at(i); }
+        const T& at(size_t i) const { return *m_elements.at(i); }
+        T& front() { return *m_elements.front(); }
+        const T& front() const { return *m_elements.front(); }
+        T& back() { return *m_elements.back(); }
+        const T& back() const { return *m_elements.back(); }
+        iterator begin() { return iterator(m_elements.begin()); }
+        iterator end() { return iterator(m_elements.end()); }
+        const_iterator begin() const { return const_iterator(m_elements.begin()); }
+        const_iterator end() const { return const_iterator(m_elements.end()); }
+        const_iterator cbegin() const { return begin(); }
+        const_iterator cend() const { return end(); }
+    private:
+        Storage m_elements;
+    };
+}
@@ -14,7 +14,8 @@
 // limitations under the License.
 //*****************************************************************************
 
-#include <random>
+#include <cmath>
+#include <string>
 
 #include "except.hpp"
 #include "rng_state.hpp"
@@ -22,6 +23,49 @@
 using namespace std;
 using namespace ngraph;
 
+ngraph::RNGState::RNGState(unsigned int seed, double probability)
+    : State()
+    , m_seed(seed)
+    , m_probability(probability)
+    , m_threshold(static_cast<uint64_t>(std::ldexp(probability, 32)))
+{
+    if (probability < 0.0 || probability > 1.0)
+    {
+        throw ngraph_error("RNGState probability must be in [0, 1], got " +
+                           std::to_string(probability));
+    }
+}
+
+uint64_t ngraph::RNGState::reserve(size_t count)
+{
+    return m_counter.fetch_add((count + 3) / 4);
+}
+
+array<uint32_t, 4> ngraph::RNGState::philox(uint64_t counter, uint32_t key)
+{
+    const uint32_t multiplier0 = 0xD2511F53;
+    const uint32_t multiplier1 = 0xCD9E8D57;
+    const uint32_t weyl0 = 0x9E3779B9;
+    const uint32_t weyl1 = 0xBB67AE85;
+
+    array<uint32_t, 4> block{
+        {static_cast<uint32_t>(counter), static_cast<uint32_t>(counter >> 32), 0, 0}};
+    uint32_t key0 = key;
+    uint32_t key1 = 0;
+    for (int round = 0; round < 10; round++)
+    {
+        uint64_t product0 = static_cast<uint64_t>(multiplier0) * block[0];
+        uint64_t product1 = static_cast<uint64_t>(multiplier1) * block[2];
+        block = {{static_cast<uint32_t>(product1 >> 32) ^ block[1] ^ key0,
+                  static_cast<uint32_t>(product1),
+                  static_cast<uint32_t>(product0 >> 32) ^ block[3] ^ key1,
+                  static_cast<uint32_t>(product0)}};
+        key0 += weyl0;
+        key1 += weyl1;
+    }
+    return block;
+}
+
 void ngraph::RNGState::activate()
 {
 }
@@ -16,15 +16,23 @@
 
 #pragma once
 
-#include <functional>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
-#include <random>
 
 #include "state.hpp"
 
 namespace ngraph
 {
-    //can be based on TensorSate to cache values instead of just caching seed
+    /// \brief Random state of a GenerateMask or Dropout op, drawn from the Philox4x32-10
+    ///        counter-based generator.
+    ///
+    /// Philox turns a 64-bit counter and the seed into four 32-bit random values without any
+    /// sequential state, so every element of a mask can be computed independently. Element i of
+    /// a mask uses value i % 4 of counter base + i / 4, which keeps masks identical whatever the
+    /// number of threads generating them. Each mask reserves a fresh range of counters, so
+    /// consecutive calls still draw different masks.
     class RNGState : public State
     {
     public:
@@ -34,19 +42,48 @@ namespace ngraph
             return rng;
         }
 
-        RNGState(unsigned int seed, double probability)
-            : State()
-            , m_generator(seed)
-            , m_distribution(probability)
-        {
-        }
+        RNGState(unsigned int seed, double probability);
         virtual void activate() override;
         virtual void deactivate() override;
         virtual ~RNGState() override {}
-        std::mt19937& get_generator() { return m_generator; }
-        std::bernoulli_distribution& get_distribution() { return m_distribution; }
+        unsigned int get_seed() const { return m_seed; }
+        double get_probability() const { return m_probability; }
+        /// \brief Reserves the counters of a mask of `count` elements.
+        /// \return The first counter of the mask
+        uint64_t reserve(size_t count);
+
+        /// \brief Calls f(i, keep) for elements [begin, end) of the mask whose counters start
+        ///        at `base`, where keep is true with the probability of the state.
+        template <typename F>
+        void sample(uint64_t base, size_t begin, size_t end, F f) const
+        {
+            size_t i = begin;
+            while (i < end)
+            {
+                auto values = philox(base + i / 4, m_seed);
+                for (size_t j = i % 4; j < 4 && i < end; j++, i++)
+                {
+                    f(i, values[j] < m_threshold);
+                }
+            }
+        }
+
+        /// \brief Writes elements [begin, end) of the mask whose counters start at `base`:
+        ///        1 with the probability of the state, 0 otherwise.
+        template <typename T>
+        void generate(T* out, uint64_t base, size_t begin, size_t end) const
+        {
+            sample(base, begin, end, [out](size_t i, bool keep) { out[i] = static_cast<T>(keep); });
+        }
+
+        /// \brief The Philox4x32-10 block for a counter and key.
+        static std::array<uint32_t, 4> philox(uint64_t counter, uint32_t key);
+
     protected:
-        std::mt19937 m_generator;
-        std::bernoulli_distribution m_distribution;
+        unsigned int m_seed;
+        double m_probability;
+        // probability scaled to 2^32, so that 1.0 accepts every value
+        uint64_t m_threshold;
+        std::atomic<uint64_t> m_counter{0};
     };
 }
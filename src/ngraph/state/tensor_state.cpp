@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "tensor_state.hpp"
+#include "ngraph/check.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+ngraph::TensorState::TensorState(const shared_ptr<runtime::Tensor>& current,
+                                 const shared_ptr<runtime::Tensor>& next)
+    : State()
+    , m_current(current)
+    , m_next(next)
+{
+    NGRAPH_CHECK(m_current->get_element_type() == m_next->get_element_type() &&
+                     m_current->get_shape() == m_next->get_shape(),
+                 "The tensors of a state must have the same element type and shape");
+    reset();
+}
+
+void ngraph::TensorState::activate()
+{
+}
+
+void ngraph::TensorState::deactivate()
+{
+}
+
+void ngraph::TensorState::reset()
+{
+    vector<char> zeros(size(), 0);
+    m_current->write(zeros.data(), 0, zeros.size());
+}
+
+vector<char> ngraph::TensorState::snapshot() const
+{
+    vector<char> data(size());
+    m_current->read(data.data(), 0, data.size());
+    return data;
+}
+
+void ngraph::TensorState::restore(const vector<char>& data)
+{
+    NGRAPH_CHECK(data.size() == size(),
+                 "Snapshot of ",
+                 data.size(),
+                 " bytes restored to a state of ",
+                 size(),
+                 " bytes");
+    m_current->write(data.data(), 0, data.size());
+}
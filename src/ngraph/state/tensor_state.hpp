@@ -0,0 +1,61 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "ngraph/runtime/tensor.hpp"
+#include "state.hpp"
+
+namespace ngraph
+{
+    /// \brief A tensor that persists across the calls of an executable, such as the hidden or
+    ///        cell state of a recurrent network run on a stream one chunk at a time.
+    ///
+    /// The state owns two backend tensors of the same element type and shape. A call reads
+    /// the current one and writes the next one, then swap() exchanges them, so the value is
+    /// never copied between calls.
+    class TensorState : public State
+    {
+    public:
+        /// \brief Makes a state from two tensors of the same element type and shape, and
+        ///        resets it to zero.
+        TensorState(const std::shared_ptr<runtime::Tensor>& current,
+                    const std::shared_ptr<runtime::Tensor>& next);
+
+        virtual void activate() override;
+        virtual void deactivate() override;
+
+        /// \brief The tensor holding the value, read by the next call
+        const std::shared_ptr<runtime::Tensor>& get_current() const { return m_current; }
+        /// \brief The tensor the next call writes the new value to
+        const std::shared_ptr<runtime::Tensor>& get_next() const { return m_next; }
+        /// \brief Makes the value written by the last call the current value
+        void swap() { m_current.swap(m_next); }
+        /// \brief Sets the current value to zero
+        void reset();
+        /// \brief A copy of the current value
+        std::vector<char> snapshot() const;
+        /// \brief Sets the current value to a snapshot of a state of the same size
+        void restore(const std::vector<char>& data);
+        size_t size() const { return m_current->get_size_in_bytes(); }
+    protected:
+        std::shared_ptr<runtime::Tensor> m_current;
+        std::shared_ptr<runtime::Tensor> m_next;
+    };
+}
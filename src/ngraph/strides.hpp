@@ -18,6 +18,7 @@
 
 #include <cstddef>
 #include <ostream>
+#include <utility>
 #include <vector>
 
 namespace ngraph
@@ -41,6 +42,16 @@ namespace ngraph
         {
         }
 
+        Strides(std::vector<size_t>&& axis_strides) noexcept
+            : std::vector<size_t>(std::move(axis_strides))
+        {
+        }
+
+        Strides(Strides&& axis_strides) noexcept
+            : std::vector<size_t>(std::move(axis_strides))
+        {
+        }
+
         explicit Strides(size_t n, size_t initial_value = 0)
             : std::vector<size_t>(n, initial_value)
         {
@@ -58,9 +69,9 @@ namespace ngraph
             static_cast<std::vector<size_t>*>(this)->operator=(v);
             return *this;
         }
-        Strides& operator=(Strides&& v)
+        Strides& operator=(Strides&& v) noexcept
         {
-            static_cast<std::vector<size_t>*>(this)->operator=(v);
+            static_cast<std::vector<size_t>*>(this)->operator=(std::move(v));
             return *this;
         }
     };
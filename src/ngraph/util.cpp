@@ -16,6 +16,7 @@
 
 #include <algorithm>
 #include <deque>
+#include <fstream>
 #include <forward_list>
 #include <iomanip>
 #include <map>
@@ -33,6 +34,10 @@
 #include "ngraph/util.hpp"
 
 #include <iostream>
+#ifndef _WIN32
+#include <sys/resource.h>
+#include <unistd.h>
+#endif
 
 using namespace std;
 using namespace ngraph;
@@ -195,6 +200,36 @@ size_t ngraph::round_up(size_t size, size_t alignment)
     return size + alignment - remainder;
 }
 
+int64_t ngraph::get_peak_rss_kb()
+{
+#ifdef _WIN32
+    return 0;
+#else
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+#ifdef __APPLE__
+    return usage.ru_maxrss / 1024;
+#else
+    return usage.ru_maxrss;
+#endif
+#endif
+}
+
+int64_t ngraph::get_current_rss_kb()
+{
+#ifdef __linux__
+    // The second field of statm is the resident set in pages
+    ifstream statm("/proc/self/statm");
+    int64_t size = 0;
+    int64_t resident = 0;
+    if (statm >> size >> resident)
+    {
+        return resident * (sysconf(_SC_PAGESIZE) / 1024);
+    }
+#endif
+    return 0;
+}
+
 ngraph::FpropCache ngraph::cache_fprop(std::shared_ptr<ngraph::Function> fprop,
                                        std::shared_ptr<ngraph::Function> bprop)
 {
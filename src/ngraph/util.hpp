@@ -18,6 +18,7 @@
 
 #include <chrono>
 #include <cmath>
+#include <cstdint>
 #include <cstdlib> // llvm 8.1 gets confused about `malloc` otherwise
 #include <functional>
 #include <iostream>
@@ -196,6 +197,13 @@ namespace ngraph
     void ngraph_free(void*);
 
     size_t round_up(size_t size, size_t alignment);
+
+    /// \returns The peak resident set size of the process so far in KiB, 0 on Windows
+    int64_t get_peak_rss_kb();
+    /// \returns The current resident set size of the process in KiB, 0 where only the peak is
+    ///          available (anything but Linux)
+    int64_t get_current_rss_kb();
+
     template <typename T>
     T apply_permutation(T input, ngraph::AxisVector order);
 
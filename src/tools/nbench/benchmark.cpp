@@ -106,7 +106,7 @@ void init_real_tv(shared_ptr<runtime::Tensor> tv, T min, T max)
     tv->write(vec.data(), 0, vec.size() * sizeof(T));
 }
 
-static void random_init(shared_ptr<runtime::Tensor> tv)
+void random_init(shared_ptr<runtime::Tensor> tv)
 {
     element::Type et = tv->get_element_type();
     switch (et.get_type_enum())
@@ -131,7 +131,8 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
                                                   size_t iterations,
                                                   bool timing_detail,
                                                   int warmup_iterations,
-                                                  bool copy_data)
+                                                  bool copy_data,
+                                                  BenchmarkTimes* times)
 {
     stopwatch timer;
     timer.start();
@@ -215,6 +216,11 @@ vector<runtime::PerformanceCounter> run_benchmark(shared_ptr<Function> f,
     t1.stop();
     float time = t1.get_milliseconds();
     cout << time / iterations << "ms per iteration" << endl;
+    if (times)
+    {
+        times->compile_us = timer.get_microseconds();
+        times->iteration_us = t1.get_microseconds() / iterations;
+    }
 
     vector<runtime::PerformanceCounter> perf_data = compiled_func->get_performance_data();
     return perf_data;
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -23,14 +24,29 @@
 
 #include "ngraph/function.hpp"
 #include "ngraph/runtime/performance_counter.hpp"
+#include "ngraph/runtime/tensor.hpp"
 
 /// performance test utilities
+void set_denormals_flush_to_zero();
+
+/// Fill a tensor with random values suitable for its element type
+void random_init(std::shared_ptr<ngraph::runtime::Tensor> tv);
+
 std::multimap<size_t, std::string>
     aggregate_timing(const std::vector<ngraph::runtime::PerformanceCounter>& perf_data);
 
+/// Wall times measured by run_benchmark
+struct BenchmarkTimes
+{
+    int64_t compile_us = 0;
+    /// Average over the timed iterations, excluding warmup
+    int64_t iteration_us = 0;
+};
+
 std::vector<ngraph::runtime::PerformanceCounter> run_benchmark(std::shared_ptr<ngraph::Function> f,
                                                                const std::string& backend_name,
                                                                size_t iterations,
                                                                bool timing_detail,
                                                                int warmup_iterations,
-                                                               bool copy_data);
+                                                               bool copy_data,
+                                                               BenchmarkTimes* times = nullptr);
@@ -0,0 +1,137 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "benchmark.hpp"
+#include "compile_benchmark.hpp"
+#include "ngraph/pass/pass_config.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/serializer.hpp"
+#include "ngraph/util.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+CompileResult run_compile_benchmark(const string& model,
+                                    const string& backend_name,
+                                    size_t iterations)
+{
+    CompileResult result;
+    result.model = model;
+    auto backend = runtime::Backend::create(backend_name);
+    result.rss_before_kb = get_current_rss_kb();
+    int64_t peak_before = get_peak_rss_kb();
+
+    stopwatch timer;
+    timer.start();
+    shared_ptr<Function> f = deserialize(model);
+    timer.stop();
+    result.deserialize_us = timer.get_microseconds();
+
+    pass::PassConfig pass_config;
+    pass_config.set_pass_attribute(pass::PassProfile::PROFILE_ATTRIBUTE, true);
+    timer.start();
+    auto exec = backend->compile(f, pass_config, false);
+    timer.stop();
+    result.compile_us = timer.get_microseconds();
+    result.peak_rss_kb = get_peak_rss_kb();
+    result.peak_rss_delta_kb = result.peak_rss_kb - peak_before;
+
+    if (auto profile = exec->get_compile_profile())
+    {
+        result.passes = profile->get_entries();
+        result.passes_us = profile->get_total_time_us();
+        result.phases = profile->get_phases();
+    }
+    runtime::MemoryStatistics memory = exec->get_memory_statistics(0);
+    result.temporary_bytes = memory.temporary_bytes;
+    result.constant_bytes = memory.constant_bytes;
+
+    vector<shared_ptr<runtime::Tensor>> args;
+    for (shared_ptr<op::Parameter> param : f->get_parameters())
+    {
+        auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+        random_init(tensor);
+        args.push_back(tensor);
+    }
+    vector<shared_ptr<runtime::Tensor>> results;
+    for (shared_ptr<Node> out : f->get_results())
+    {
+        results.push_back(backend->create_tensor(out->get_element_type(), out->get_shape()));
+    }
+    set_denormals_flush_to_zero();
+    for (size_t i = 0; i < iterations; i++)
+    {
+        exec->call(results, args);
+    }
+    result.steady_rss_kb = get_current_rss_kb();
+    return result;
+}
+
+void print_compile_result(const CompileResult& result, ostream& out)
+{
+    out << "deserialize: " << result.deserialize_us << "us\n";
+    out << "compile: " << result.compile_us << "us";
+    if (!result.passes.empty())
+    {
+        out << ", " << result.passes.size() << " passes in " << result.passes_us << "us";
+    }
+    out << "\n";
+    for (const pass::CompilePhase& phase : result.phases)
+    {
+        out << "    " << phase.name << ": " << phase.wall_time_us << "us\n";
+    }
+    out << "rss: " << result.rss_before_kb << "KiB before, peak " << result.peak_rss_kb
+        << "KiB (+" << result.peak_rss_delta_kb << "KiB while compiling), steady "
+        << result.steady_rss_kb << "KiB\n";
+    out << "temporary pool: " << result.temporary_bytes
+        << " bytes, constants: " << result.constant_bytes << " bytes\n";
+}
+
+string compile_result_to_json(const CompileResult& result)
+{
+    nlohmann::json passes = nlohmann::json::array();
+    for (const pass::PassProfileEntry& entry : result.passes)
+    {
+        passes.push_back({{"name", entry.name},
+                          {"wall_time_us", entry.wall_time_us},
+                          {"nodes_before", entry.nodes_before},
+                          {"nodes_after", entry.nodes_after},
+                          {"peak_rss_delta_kb", entry.peak_rss_delta_kb}});
+    }
+    nlohmann::json phases = nlohmann::json::array();
+    for (const pass::CompilePhase& phase : result.phases)
+    {
+        phases.push_back({{"name", phase.name},
+                          {"wall_time_us", phase.wall_time_us},
+                          {"peak_rss_delta_kb", phase.peak_rss_delta_kb}});
+    }
+    nlohmann::json json = {{"model", result.model},
+                           {"deserialize_us", result.deserialize_us},
+                           {"compile_us", result.compile_us},
+                           {"passes_us", result.passes_us},
+                           {"passes", passes},
+                           {"phases", phases},
+                           {"rss_kb",
+                            {{"before", result.rss_before_kb},
+                             {"peak", result.peak_rss_kb},
+                             {"peak_delta", result.peak_rss_delta_kb},
+                             {"steady", result.steady_rss_kb}}},
+                           {"temporary_bytes", result.temporary_bytes},
+                           {"constant_bytes", result.constant_bytes}};
+    return json.dump(4);
+}
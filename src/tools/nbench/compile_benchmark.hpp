@@ -0,0 +1,58 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/pass/pass_profile.hpp"
+
+/// Compile time and memory footprint of one model, see run_compile_benchmark
+struct CompileResult
+{
+    std::string model;
+    int64_t deserialize_us = 0;
+    /// Wall time of Backend::compile
+    int64_t compile_us = 0;
+    /// Passes and later compile phases, empty if the backend does not support
+    /// pass::PassProfile::PROFILE_ATTRIBUTE
+    std::vector<ngraph::pass::PassProfileEntry> passes;
+    int64_t passes_us = 0;
+    std::vector<ngraph::pass::CompilePhase> phases;
+    /// Process resident set sizes in KiB. The peak is process wide, so over several models
+    /// only its growth during each compile is specific to the model.
+    int64_t rss_before_kb = 0;
+    int64_t peak_rss_kb = 0;
+    int64_t peak_rss_delta_kb = 0;
+    /// Resident set after the compiled function has been called `iterations` times
+    int64_t steady_rss_kb = 0;
+    size_t temporary_bytes = 0;
+    size_t constant_bytes = 0;
+};
+
+/// Deserialize and compile `model`, then call it `iterations` times to reach steady state
+CompileResult run_compile_benchmark(const std::string& model,
+                                    const std::string& backend_name,
+                                    size_t iterations);
+
+void print_compile_result(const CompileResult& result, std::ostream& out);
+
+std::string compile_result_to_json(const CompileResult& result);
@@ -0,0 +1,291 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <thread>
+#include <vector>
+#ifndef _WIN32
+#include <sys/resource.h>
+#endif
+
+#include "benchmark.hpp"
+#include "load_generator.hpp"
+#include "ngraph/graph_util.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+#include "nlohmann/json.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+using Clock = chrono::steady_clock;
+
+namespace
+{
+    // Tensors owned by one client, so concurrent calls never share buffers
+    struct ClientTensors
+    {
+        vector<shared_ptr<runtime::HostTensor>> arg_data;
+        vector<shared_ptr<runtime::Tensor>> args;
+        vector<shared_ptr<runtime::HostTensor>> result_data;
+        vector<shared_ptr<runtime::Tensor>> results;
+    };
+
+    ClientTensors make_client_tensors(const shared_ptr<Function>& f,
+                                      const shared_ptr<runtime::Backend>& backend)
+    {
+        ClientTensors tensors;
+        for (shared_ptr<op::Parameter> param : f->get_parameters())
+        {
+            auto tensor = backend->create_tensor(param->get_element_type(), param->get_shape());
+            auto data =
+                make_shared<runtime::HostTensor>(param->get_element_type(), param->get_shape());
+            random_init(data);
+            tensor->write(data->get_data_ptr(),
+                          0,
+                          data->get_element_count() * data->get_element_type().size());
+            if (param->get_cacheable())
+            {
+                tensor->set_stale(false);
+            }
+            tensors.args.push_back(tensor);
+            tensors.arg_data.push_back(data);
+        }
+        for (shared_ptr<Node> out : f->get_results())
+        {
+            tensors.results.push_back(
+                backend->create_tensor(out->get_element_type(), out->get_shape()));
+            tensors.result_data.push_back(
+                make_shared<runtime::HostTensor>(out->get_element_type(), out->get_shape()));
+        }
+        return tensors;
+    }
+
+    void run_request(runtime::Executable& exec, ClientTensors& tensors, bool copy_data)
+    {
+        if (copy_data)
+        {
+            for (size_t i = 0; i < tensors.args.size(); i++)
+            {
+                if (tensors.args[i]->get_stale())
+                {
+                    const shared_ptr<runtime::HostTensor>& data = tensors.arg_data[i];
+                    tensors.args[i]->write(
+                        data->get_data_ptr(),
+                        0,
+                        data->get_element_count() * data->get_element_type().size());
+                }
+            }
+        }
+        exec.call(tensors.results, tensors.args);
+        if (copy_data)
+        {
+            for (size_t i = 0; i < tensors.results.size(); i++)
+            {
+                const shared_ptr<runtime::HostTensor>& data = tensors.result_data[i];
+                tensors.results[i]->read(
+                    data->get_data_ptr(),
+                    0,
+                    data->get_element_count() * data->get_element_type().size());
+            }
+        }
+    }
+
+    double get_cpu_seconds()
+    {
+#ifndef _WIN32
+        rusage usage;
+        if (getrusage(RUSAGE_SELF, &usage) == 0)
+        {
+            return usage.ru_utime.tv_sec + usage.ru_stime.tv_sec +
+                   (usage.ru_utime.tv_usec + usage.ru_stime.tv_usec) / 1e6;
+        }
+#endif
+        return -1;
+    }
+
+    // Nearest rank percentile of sorted latencies
+    double get_percentile(const vector<double>& sorted, double q)
+    {
+        if (sorted.empty())
+        {
+            return 0;
+        }
+        size_t rank = static_cast<size_t>(ceil(q * sorted.size()));
+        return sorted[min(max(rank, size_t(1)), sorted.size()) - 1];
+    }
+}
+
+LoadResult run_load(shared_ptr<Function> f, const string& backend_name, const LoadOptions& options)
+{
+    size_t clients = max(options.clients, size_t(1));
+    size_t executable_count = min(max(options.executables, size_t(1)), clients);
+
+    auto backend = runtime::Backend::create(backend_name);
+    vector<shared_ptr<runtime::Executable>> executables;
+    for (size_t i = 0; i < executable_count; i++)
+    {
+        // Backends may cache executables per Function, so every extra copy gets its own clone
+        executables.push_back(backend->compile(i == 0 ? f : clone_function(*f)));
+    }
+    vector<ClientTensors> tensors;
+    for (size_t i = 0; i < clients; i++)
+    {
+        tensors.push_back(make_client_tensors(f, backend));
+    }
+
+    // Warm up every client before anything is measured
+    vector<thread> threads;
+    for (size_t i = 0; i < clients; i++)
+    {
+        threads.push_back(thread([&, i] {
+            set_denormals_flush_to_zero();
+            for (size_t r = 0; r < options.warmup_requests; r++)
+            {
+                run_request(*executables[i % executable_count], tensors[i], options.copy_data);
+            }
+        }));
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    threads.clear();
+
+    vector<vector<double>> latencies(clients);
+    auto interval = options.target_qps > 0
+                        ? chrono::duration_cast<Clock::duration>(
+                              chrono::duration<double>(clients / options.target_qps))
+                        : Clock::duration::zero();
+    double cpu_start = get_cpu_seconds();
+    Clock::time_point start = Clock::now();
+    for (size_t i = 0; i < clients; i++)
+    {
+        threads.push_back(thread([&, i] {
+            set_denormals_flush_to_zero();
+            latencies[i].reserve(options.requests);
+            // Stagger the clients so their requests interleave evenly
+            Clock::time_point next = start + interval * i / clients;
+            for (size_t r = 0; r < options.requests; r++)
+            {
+                if (options.target_qps > 0)
+                {
+                    this_thread::sleep_until(next);
+                }
+                else
+                {
+                    next = Clock::now();
+                }
+                run_request(*executables[i % executable_count], tensors[i], options.copy_data);
+                latencies[i].push_back(
+                    chrono::duration<double, milli>(Clock::now() - next).count());
+                next += interval;
+            }
+        }));
+    }
+    for (thread& t : threads)
+    {
+        t.join();
+    }
+    Clock::time_point stop = Clock::now();
+    double cpu_stop = get_cpu_seconds();
+
+    vector<double> all;
+    for (const vector<double>& client : latencies)
+    {
+        all.insert(all.end(), client.begin(), client.end());
+    }
+    sort(all.begin(), all.end());
+
+    LoadResult result;
+    result.clients = clients;
+    result.executables = executable_count;
+    result.target_qps = options.target_qps;
+    result.requests = all.size();
+    result.seconds = chrono::duration<double>(stop - start).count();
+    result.throughput = result.seconds > 0 ? all.size() / result.seconds : 0;
+    for (double latency : all)
+    {
+        result.mean += latency;
+    }
+    result.mean = all.empty() ? 0 : result.mean / all.size();
+    result.p50 = get_percentile(all, 0.5);
+    result.p90 = get_percentile(all, 0.9);
+    result.p99 = get_percentile(all, 0.99);
+    result.p999 = get_percentile(all, 0.999);
+    result.max = all.empty() ? 0 : all.back();
+    if (cpu_start >= 0 && cpu_stop >= 0 && result.seconds > 0)
+    {
+        result.cpu_seconds = cpu_stop - cpu_start;
+        result.cpu_utilization = result.cpu_seconds / result.seconds /
+                                 max(thread::hardware_concurrency(), 1u);
+    }
+    return result;
+}
+
+void print_load_result(const LoadResult& result, ostream& out)
+{
+    out << "clients: " << result.clients << ", executables: " << result.executables << ", ";
+    if (result.target_qps > 0)
+    {
+        out << "target " << result.target_qps << " qps\n";
+    }
+    else
+    {
+        out << "closed loop\n";
+    }
+    out << result.requests << " requests in " << result.seconds << "s, " << result.throughput
+        << " requests/s\n";
+    out << "latency ms: mean " << result.mean << ", p50 " << result.p50 << ", p90 " << result.p90
+        << ", p99 " << result.p99 << ", p99.9 " << result.p999 << ", max " << result.max << "\n";
+    if (result.cpu_utilization >= 0)
+    {
+        out << "cpu: " << result.cpu_seconds << "s, " << fixed << setprecision(1)
+            << result.cpu_utilization * 100 << "% of " << thread::hardware_concurrency()
+            << " hardware threads\n";
+        out.unsetf(ios_base::floatfield);
+        out << setprecision(6);
+    }
+}
+
+string load_result_to_json(const string& model, const LoadResult& result)
+{
+    nlohmann::json json = {{"model", model},
+                           {"clients", result.clients},
+                           {"executables", result.executables},
+                           {"target_qps", result.target_qps},
+                           {"requests", result.requests},
+                           {"seconds", result.seconds},
+                           {"throughput", result.throughput},
+                           {"latency_ms",
+                            {{"mean", result.mean},
+                             {"p50", result.p50},
+                             {"p90", result.p90},
+                             {"p99", result.p99},
+                             {"p999", result.p999},
+                             {"max", result.max}}}};
+    if (result.cpu_utilization >= 0)
+    {
+        json["cpu"] = {{"seconds", result.cpu_seconds},
+                       {"utilization", result.cpu_utilization},
+                       {"hardware_threads", thread::hardware_concurrency()}};
+    }
+    return json.dump(4);
+}
@@ -0,0 +1,70 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <iostream>
+#include <memory>
+#include <string>
+
+#include "ngraph/function.hpp"
+
+/// Load generation mode of nbench. `clients` threads issue requests against `executables`
+/// compiled copies of the function, client i using copy i % executables. With a target rate
+/// the requests are scheduled at fixed intervals and latency is measured from the scheduled
+/// start, so time spent queued behind a slow request counts; otherwise every client issues
+/// its next request as soon as the previous one returns.
+struct LoadOptions
+{
+    size_t clients = 1;
+    size_t executables = 1;
+    /// Requests per second over all clients, 0 for a closed loop
+    double target_qps = 0;
+    /// Measured requests per client, after `warmup_requests`
+    size_t requests = 10;
+    size_t warmup_requests = 1;
+    bool copy_data = true;
+};
+
+struct LoadResult
+{
+    size_t clients = 0;
+    size_t executables = 0;
+    double target_qps = 0;
+    size_t requests = 0;
+    double seconds = 0;
+    double throughput = 0;
+    /// Latencies in milliseconds
+    double mean = 0;
+    double p50 = 0;
+    double p90 = 0;
+    double p99 = 0;
+    double p999 = 0;
+    double max = 0;
+    /// Process CPU time over the measured interval, and that time as a fraction of all
+    /// hardware threads; negative when not available on this platform
+    double cpu_seconds = -1;
+    double cpu_utilization = -1;
+};
+
+LoadResult run_load(std::shared_ptr<ngraph::Function> f,
+                    const std::string& backend_name,
+                    const LoadOptions& options);
+
+void print_load_result(const LoadResult& result, std::ostream& out);
+
+std::string load_result_to_json(const std::string& model, const LoadResult& result);
@@ -24,6 +24,8 @@
 #include <iomanip>
 
 #include "benchmark.hpp"
+#include "compile_benchmark.hpp"
+#include "load_generator.hpp"
 #include "ngraph/distributed.hpp"
 #include "ngraph/except.hpp"
 #include "ngraph/file_util.hpp"
@@ -35,6 +37,7 @@
 #include "ngraph/runtime/backend.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
+#include "regression.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -110,6 +113,39 @@ multimap<size_t, string> aggregate_timing(const vector<PerfShape>& perf_data)
     return rc;
 }
 
+// Time per framework node, from the provenance tags the importer put on the nodes it made and
+// the passes carried over to the nodes that replaced them. An op made from several framework
+// nodes, such as a fused kernel, splits its time evenly between them. Empty when no op has tags.
+multimap<size_t, string> aggregate_provenance_timing(const vector<PerfShape>& perf_data)
+{
+    unordered_map<string, size_t> timing;
+    bool tagged = false;
+    for (const PerfShape& p : perf_data)
+    {
+        auto tags = p.get_provenance_tags();
+        if (tags.empty())
+        {
+            timing["(untagged)"] += p.microseconds();
+            continue;
+        }
+        tagged = true;
+        for (const string& tag : tags)
+        {
+            timing[tag] += p.microseconds() / tags.size();
+        }
+    }
+
+    multimap<size_t, string> rc;
+    if (tagged)
+    {
+        for (const pair<string, size_t>& t : timing)
+        {
+            rc.insert({t.second, t.first});
+        }
+    }
+    return rc;
+}
+
 void print_times(const multimap<size_t, string>& timing)
 {
     // set the column widths
@@ -127,7 +163,157 @@ void print_times(const multimap<size_t, string>& timing)
     }
 }
 
-void print_results(vector<PerfShape> perf_data, bool timing_detail)
+void print_hardware_counters(const vector<PerfShape>& perf_data)
+{
+    struct Counters
+    {
+        size_t microseconds = 0;
+        uint64_t cycles = 0;
+        uint64_t instructions = 0;
+        uint64_t llc_misses = 0;
+        uint64_t memory_bytes = 0;
+    };
+    map<string, Counters> counters;
+    for (const PerfShape& p : perf_data)
+    {
+        if (p.has_hardware_counters())
+        {
+            auto node = p.get_node();
+            Counters& c = counters[node->get_name().substr(0, node->get_name().find('_'))];
+            c.microseconds += p.total_microseconds();
+            c.cycles += p.total_cycles();
+            c.instructions += p.total_instructions();
+            c.llc_misses += p.total_llc_misses();
+            c.memory_bytes += p.estimated_memory_bytes();
+        }
+    }
+    if (counters.empty())
+    {
+        return;
+    }
+
+    cout << "\n---- Hardware counters per op type ----\n";
+    cout << setw(24) << left << "op" << setw(16) << right << "cycles" << setw(16)
+         << "instructions" << setw(8) << "IPC" << setw(14) << "LLC misses" << setw(12)
+         << "est. GB/s" << "\n";
+    for (const pair<const string, Counters>& p : counters)
+    {
+        const Counters& c = p.second;
+        double ipc = c.cycles == 0 ? 0 : static_cast<double>(c.instructions) / c.cycles;
+        // bytes per microsecond is 1e-3 GB/s
+        double bandwidth =
+            c.microseconds == 0 ? 0 : static_cast<double>(c.memory_bytes) / c.microseconds / 1e3;
+        cout << setw(24) << left << p.first << setw(16) << right << c.cycles << setw(16)
+             << c.instructions << setw(8) << fixed << setprecision(2) << ipc << setw(14)
+             << c.llc_misses << setw(12) << bandwidth << "\n";
+    }
+    cout.unsetf(ios_base::floatfield);
+}
+
+// Machine peaks the roofline report compares against, 0 when not configured
+struct MachinePeak
+{
+    double gflops = 0;
+    double gbytes_per_second = 0;
+};
+
+static void print_roofline_row(const string& name,
+                               size_t name_width,
+                               double microseconds,
+                               double flops,
+                               double bytes,
+                               const MachinePeak& peak)
+{
+    double gflops = microseconds == 0 ? 0 : flops / microseconds / 1e3;
+    double gbps = microseconds == 0 ? 0 : bytes / microseconds / 1e3;
+    double intensity = bytes == 0 ? 0 : flops / bytes;
+    cout << setw(name_width) << left << name << right << setw(12)
+         << static_cast<size_t>(microseconds) << "us" << setw(10) << fixed << setprecision(2)
+         << gflops << setw(10) << gbps << setw(8) << intensity;
+    if (peak.gflops > 0 && peak.gbytes_per_second > 0)
+    {
+        // The roofline: a kernel can go no faster than compute or memory allows at its
+        // arithmetic intensity
+        double attainable = min(peak.gflops, intensity * peak.gbytes_per_second);
+        bool memory_bound = intensity * peak.gbytes_per_second < peak.gflops;
+        double efficiency = attainable == 0 ? 0 : 100 * gflops / attainable;
+        cout << setw(9) << setprecision(1) << efficiency << "% "
+             << (memory_bound ? "memory" : "compute");
+    }
+    cout << "\n";
+    cout.unsetf(ios_base::floatfield);
+}
+
+void print_roofline(const vector<PerfShape>& perf_data, const MachinePeak& peak)
+{
+    struct Totals
+    {
+        double microseconds = 0;
+        double flops = 0;
+        double bytes = 0;
+    };
+    map<string, Totals> op_types;
+    vector<const PerfShape*> ops;
+    for (const PerfShape& p : perf_data)
+    {
+        if (p.call_count() == 0 || p.get_cost().bytes() == 0)
+        {
+            continue;
+        }
+        auto node = p.get_node();
+        Totals& t = op_types[node->get_name().substr(0, node->get_name().find('_'))];
+        t.microseconds += p.total_microseconds();
+        t.flops += static_cast<double>(p.get_cost().flops) * p.call_count();
+        t.bytes += static_cast<double>(p.get_cost().bytes()) * p.call_count();
+        ops.push_back(&p);
+    }
+    if (ops.empty())
+    {
+        return;
+    }
+
+    size_t name_width = 16;
+    for (const PerfShape* p : ops)
+    {
+        name_width = max(name_width, p->get_node()->get_name().size() + 2);
+    }
+    auto print_header = [&](const string& title) {
+        cout << "\n---- " << title << " ----\n";
+        cout << setw(name_width) << left << "op" << right << setw(14) << "time" << setw(10)
+             << "GFLOP/s" << setw(10) << "GB/s" << setw(8) << "FLOP/B";
+        if (peak.gflops > 0 && peak.gbytes_per_second > 0)
+        {
+            cout << setw(10) << "of peak" << " bound";
+        }
+        cout << "\n";
+    };
+
+    print_header("Roofline per op type");
+    for (const pair<const string, Totals>& t : op_types)
+    {
+        print_roofline_row(
+            t.first, name_width, t.second.microseconds, t.second.flops, t.second.bytes, peak);
+    }
+
+    // The ops that take the most time are the ones worth optimizing
+    const size_t top_ops = 20;
+    stable_sort(ops.begin(), ops.end(), [](const PerfShape* a, const PerfShape* b) {
+        return a->total_microseconds() > b->total_microseconds();
+    });
+    print_header("Roofline of the " + to_string(min(top_ops, ops.size())) + " slowest ops");
+    for (size_t i = 0; i < min(top_ops, ops.size()); i++)
+    {
+        const PerfShape& p = *ops[i];
+        print_roofline_row(p.get_node()->get_name(),
+                           name_width,
+                           p.total_microseconds(),
+                           static_cast<double>(p.get_cost().flops) * p.call_count(),
+                           static_cast<double>(p.get_cost().bytes()) * p.call_count(),
+                           peak);
+    }
+}
+
+void print_results(vector<PerfShape> perf_data, bool timing_detail, const MachinePeak& peak)
 {
     sort(perf_data.begin(), perf_data.end(), [](const PerfShape& p1, const PerfShape& p2) {
         return p1.total_microseconds() > p2.total_microseconds();
@@ -142,6 +328,16 @@ void print_results(vector<PerfShape> perf_data, bool timing_detail)
 
         cout << "\n---- Aggregate times per op type/shape/count ----\n";
         print_times(timing_details);
+
+        multimap<size_t, string> provenance_timing = aggregate_provenance_timing(perf_data);
+        if (!provenance_timing.empty())
+        {
+            cout << "\n---- Aggregate times per provenance tag ----\n";
+            print_times(provenance_timing);
+        }
+
+        print_hardware_counters(perf_data);
+        print_roofline(perf_data, peak);
     }
 }
 
@@ -181,6 +377,13 @@ int main(int argc, char** argv)
     int warmup_iterations = 1;
     bool copy_data = true;
     bool dot_file = false;
+    LoadOptions load_options;
+    bool compile_mode = false;
+    MachinePeak peak;
+    string json_file;
+    string regression_manifest;
+    double regression_threshold = 10;
+    bool update_baselines = false;
 
     for (size_t i = 1; i < argc; i++)
     {
@@ -241,6 +444,78 @@ int main(int argc, char** argv)
                 failed = true;
             }
         }
+        else if (arg == "--clients" || arg == "--executables" || arg == "--qps")
+        {
+            try
+            {
+                string value = argv[++i];
+                if (arg == "--clients")
+                {
+                    load_options.clients = stoul(value);
+                }
+                else if (arg == "--executables")
+                {
+                    load_options.executables = stoul(value);
+                }
+                else
+                {
+                    load_options.target_qps = stod(value);
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--peak_gflops" || arg == "--peak_gbps")
+        {
+            try
+            {
+                double value = stod(argv[++i]);
+                if (arg == "--peak_gflops")
+                {
+                    peak.gflops = value;
+                }
+                else
+                {
+                    peak.gbytes_per_second = value;
+                }
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--regression")
+        {
+            regression_manifest = argv[++i];
+        }
+        else if (arg == "--threshold")
+        {
+            try
+            {
+                regression_threshold = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--update_baselines")
+        {
+            update_baselines = true;
+        }
+        else if (arg == "--compile")
+        {
+            compile_mode = true;
+        }
+        else if (arg == "--json")
+        {
+            json_file = argv[++i];
+        }
         else
         {
             cout << "Unknown option: " << arg << endl;
@@ -257,7 +532,17 @@ int main(int argc, char** argv)
         cout << "Directory " << directory << " not found\n";
         failed = true;
     }
-    else if (directory.empty() && model_arg.empty())
+    else if (!regression_manifest.empty() && !file_util::exists(regression_manifest))
+    {
+        cout << "Manifest " << regression_manifest << " not found\n";
+        failed = true;
+    }
+    else if (!regression_manifest.empty() && backend.empty())
+    {
+        cout << "A backend must be specified with --regression\n";
+        failed = true;
+    }
+    else if (directory.empty() && model_arg.empty() && regression_manifest.empty())
     {
         cout << "Either file or directory must be specified\n";
         failed = true;
@@ -279,14 +564,59 @@ OPTIONS
         -i|--iterations           Iterations (default: 10)
         -s|--statistics           Display op statistics
         -v|--visualize            Visualize a model (WARNING: requires Graphviz installed)
-        --timing_detail           Gather detailed timing
+        --timing_detail           Gather detailed timing. On the CPU backend also set
+                                  NGRAPH_CPU_HW_COUNTERS=1 to gather hardware counters
+        --peak_gflops             Machine peak compute, and with --peak_gbps peak memory
+        --peak_gbps               bandwidth, to rate each op against the roofline in the
+                                  --timing_detail report
         -w|--warmup_iterations    Number of warm-up iterations
         --no_copy_data            Disable copy of input/result data every iteration
         --dot                     Generate Graphviz dot file
+
+    Load generation, enabled by any of these options:
+        --clients                 Client threads issuing requests (default: 1). On the CPU
+                                  backend NGRAPH_CPU_CONCURRENCY sets how many calls of one
+                                  executable run at once
+        --executables             Compiled copies of the model shared round-robin by the
+                                  clients (default: 1)
+        --qps                     Target requests per second over all clients (default: as
+                                  fast as possible, each client waits for its last request)
+        --json                    Write throughput, latency and CPU results to this file
+    Each client issues --iterations requests after --warmup_iterations.
+
+    Compile benchmarking:
+        --compile                 Time deserialization, compile passes and backend compile
+                                  phases and record RSS and memory pool sizes instead of
+                                  benchmarking execution; --json writes the results
+
+    Regression checking:
+        --regression              Manifest of models and baseline times to benchmark with
+                                  --iterations and --warmup_iterations; exits non-zero when
+                                  a latency or compile time exceeds its baseline
+        --threshold               Allowed slowdown over the baselines in percent (default: 10)
+        --update_baselines        Write the measured times to the manifest as new baselines
 )###";
         return 1;
     }
 
+    if (!regression_manifest.empty())
+    {
+        vector<RegressionResult> results =
+            run_regression(read_regression_manifest(regression_manifest),
+                           backend,
+                           iterations,
+                           warmup_iterations,
+                           regression_threshold);
+        cout << "\n---- Regression ----\n";
+        size_t failures = print_regression_table(results, cout);
+        if (update_baselines)
+        {
+            write_regression_manifest(regression_manifest, results);
+            return 0;
+        }
+        return failures == 0 ? 0 : 1;
+    }
+
     vector<string> models;
     if (!directory.empty())
     {
@@ -306,6 +636,13 @@ OPTIONS
         models.push_back(model_arg);
     }
 
+    load_options.requests = iterations;
+    load_options.warmup_requests = warmup_iterations;
+    load_options.copy_data = copy_data;
+    bool load_mode = load_options.clients > 1 || load_options.executables > 1 ||
+                     load_options.target_qps > 0 || (!json_file.empty() && !compile_mode);
+    vector<string> json_results;
+
     vector<PerfShape> aggregate_perf_data;
     int rc = 0;
     for (const string& model : models)
@@ -417,7 +754,22 @@ OPTIONS
                 }
             }
 
-            if (!backend.empty())
+            if (!backend.empty() && compile_mode)
+            {
+                cout << "\n---- Compile ----\n";
+                CompileResult result = run_compile_benchmark(model, backend, iterations);
+                print_compile_result(result, cout);
+                json_results.push_back(compile_result_to_json(result));
+            }
+            else if (!backend.empty() && load_mode)
+            {
+                cout << "\n---- Load ----\n";
+                shared_ptr<Function> f = deserialize(model);
+                LoadResult result = run_load(f, backend, load_options);
+                print_load_result(result, cout);
+                json_results.push_back(load_result_to_json(model, result));
+            }
+            else if (!backend.empty())
             {
                 cout << "\n---- Benchmark ----\n";
                 shared_ptr<Function> f = deserialize(model);
@@ -426,7 +778,7 @@ OPTIONS
                 auto perf_shape = to_perf_shape(f, perf_data);
                 aggregate_perf_data.insert(
                     aggregate_perf_data.end(), perf_shape.begin(), perf_shape.end());
-                print_results(perf_shape, timing_detail);
+                print_results(perf_shape, timing_detail, peak);
             }
         }
         catch (ngraph::unsupported_op& ue)
@@ -447,7 +799,13 @@ OPTIONS
         cout << "============================================================================\n";
         cout << "---- Aggregate over all models\n";
         cout << "============================================================================\n";
-        print_results(aggregate_perf_data, timing_detail);
+        print_results(aggregate_perf_data, timing_detail, peak);
+    }
+
+    if (!json_file.empty())
+    {
+        ofstream out(json_file);
+        out << "[\n" << join(json_results, ",\n") << "\n]\n";
     }
 
     return rc;
@@ -0,0 +1,197 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+
+#include "ngraph/file_util.hpp"
+#include "ngraph/serializer.hpp"
+#include "regression.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string manifest_directory(const string& manifest)
+{
+    auto pos = manifest.find_last_of('/');
+    return pos == string::npos ? "." : manifest.substr(0, pos);
+}
+
+vector<RegressionBaseline> read_regression_manifest(const string& manifest)
+{
+    ifstream in(manifest);
+    if (!in)
+    {
+        throw runtime_error("Unable to open regression manifest " + manifest);
+    }
+    vector<RegressionBaseline> baselines;
+    string line;
+    size_t line_number = 0;
+    while (getline(in, line))
+    {
+        line_number++;
+        line = line.substr(0, line.find('#'));
+        istringstream fields(line);
+        RegressionBaseline baseline;
+        if (!(fields >> baseline.model))
+        {
+            continue;
+        }
+        if (!(fields >> baseline.latency_us >> baseline.compile_us))
+        {
+            throw runtime_error(manifest + ":" + to_string(line_number) +
+                                ": expected '<model> <latency_us> <compile_us>'");
+        }
+        if (baseline.model[0] != '/')
+        {
+            baseline.model = file_util::path_join(manifest_directory(manifest), baseline.model);
+        }
+        baselines.push_back(baseline);
+    }
+    return baselines;
+}
+
+void write_regression_manifest(const string& manifest, const vector<RegressionResult>& results)
+{
+    string directory = manifest_directory(manifest) + "/";
+    // Keep the comment block at the top of the manifest
+    string header;
+    {
+        ifstream in(manifest);
+        string line;
+        while (getline(in, line) && (line.empty() || line[0] == '#'))
+        {
+            header += line + "\n";
+        }
+    }
+    ofstream out(manifest);
+    out << (header.empty() ? "# <model> <latency_us> <compile_us>\n" : header);
+    for (const RegressionResult& result : results)
+    {
+        string model = result.baseline.model;
+        if (model.compare(0, directory.size(), directory) == 0)
+        {
+            model = model.substr(directory.size());
+        }
+        // Keep the old baseline of models that could not be benchmarked
+        if (result.error.empty())
+        {
+            out << model << " " << result.measured.iteration_us << " "
+                << result.measured.compile_us << "\n";
+        }
+        else
+        {
+            out << model << " " << result.baseline.latency_us << " "
+                << result.baseline.compile_us << "\n";
+        }
+    }
+}
+
+static bool exceeds(int64_t measured, int64_t baseline, double threshold_percent)
+{
+    return baseline > 0 && measured > baseline * (1 + threshold_percent / 100);
+}
+
+vector<RegressionResult> run_regression(const vector<RegressionBaseline>& baselines,
+                                        const string& backend_name,
+                                        size_t iterations,
+                                        int warmup_iterations,
+                                        double threshold_percent)
+{
+    vector<RegressionResult> results;
+    for (const RegressionBaseline& baseline : baselines)
+    {
+        RegressionResult result;
+        result.baseline = baseline;
+        try
+        {
+            shared_ptr<Function> f = deserialize(baseline.model);
+            run_benchmark(
+                f, backend_name, iterations, false, warmup_iterations, true, &result.measured);
+            result.latency_regressed =
+                exceeds(result.measured.iteration_us, baseline.latency_us, threshold_percent);
+            result.compile_regressed =
+                exceeds(result.measured.compile_us, baseline.compile_us, threshold_percent);
+        }
+        catch (const exception& e)
+        {
+            result.error = e.what();
+        }
+        results.push_back(result);
+    }
+    return results;
+}
+
+static void print_row(ostream& out,
+                      const string& model,
+                      const string& metric,
+                      int64_t baseline,
+                      int64_t measured,
+                      bool regressed)
+{
+    out << setw(40) << left << model << setw(10) << metric << right << setw(14) << baseline
+        << setw(14) << measured;
+    if (baseline > 0)
+    {
+        out << setw(9) << fixed << setprecision(1) << 100.0 * (measured - baseline) / baseline
+            << "%";
+    }
+    else
+    {
+        out << setw(10) << "-";
+    }
+    out << "  " << (regressed ? "REGRESSED" : "ok") << "\n";
+}
+
+size_t print_regression_table(const vector<RegressionResult>& results, ostream& out)
+{
+    size_t failures = 0;
+    out << setw(40) << left << "model" << setw(10) << "metric" << right << setw(14)
+        << "baseline_us" << setw(14) << "measured_us" << setw(10) << "change"
+        << "  status\n";
+    for (const RegressionResult& result : results)
+    {
+        string model = file_util::get_file_name(result.baseline.model);
+        if (!result.error.empty())
+        {
+            out << setw(40) << left << model << "FAILED: " << result.error << "\n";
+        }
+        else
+        {
+            print_row(out,
+                      model,
+                      "latency",
+                      result.baseline.latency_us,
+                      result.measured.iteration_us,
+                      result.latency_regressed);
+            print_row(out,
+                      model,
+                      "compile",
+                      result.baseline.compile_us,
+                      result.measured.compile_us,
+                      result.compile_regressed);
+        }
+        if (result.failed())
+        {
+            failures++;
+        }
+    }
+    out << failures << " of " << results.size() << " models failed\n";
+    return failures;
+}
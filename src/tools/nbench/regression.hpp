@@ -0,0 +1,65 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "benchmark.hpp"
+
+/// Expected times of one model, read from a regression manifest. Each manifest line holds a
+/// model path, relative to the manifest, followed by its baseline latency per iteration and
+/// compile time in microseconds; '#' starts a comment. A baseline of 0 is not checked.
+struct RegressionBaseline
+{
+    std::string model;
+    int64_t latency_us = 0;
+    int64_t compile_us = 0;
+};
+
+struct RegressionResult
+{
+    RegressionBaseline baseline;
+    BenchmarkTimes measured;
+    bool latency_regressed = false;
+    bool compile_regressed = false;
+    /// Why the model could not be benchmarked, empty on success
+    std::string error;
+
+    bool failed() const { return latency_regressed || compile_regressed || !error.empty(); }
+};
+
+std::vector<RegressionBaseline> read_regression_manifest(const std::string& manifest);
+
+/// Write the measured times back as the new baselines of `manifest`
+void write_regression_manifest(const std::string& manifest,
+                               const std::vector<RegressionResult>& results);
+
+/// Benchmark each model and flag the times that exceed their baseline by more than
+/// `threshold_percent`
+std::vector<RegressionResult> run_regression(const std::vector<RegressionBaseline>& baselines,
+                                             const std::string& backend_name,
+                                             size_t iterations,
+                                             int warmup_iterations,
+                                             double threshold_percent);
+
+/// Print a table comparing baselines with measured times
+/// \returns The number of failed models
+size_t print_regression_table(const std::vector<RegressionResult>& results, std::ostream& out);
@@ -0,0 +1,311 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <sstream>
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/util.hpp"
+#include "op_benchmarks.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string shape_name(const vector<Shape>& shapes)
+{
+    ostringstream name;
+    const char* separator = "";
+    for (const Shape& shape : shapes)
+    {
+        name << separator << "{" << join(shape, ",") << "}";
+        separator = "x";
+    }
+    return name.str();
+}
+
+static string benchmark_name(const string& op, const element::Type& type, const string& shapes)
+{
+    return op + "/" + type.get_type_name() + "/" + shapes;
+}
+
+static void add_convolution(vector<OpBenchmark>& benchmarks)
+{
+    struct Case
+    {
+        Shape data;
+        Shape filters;
+        size_t stride;
+        size_t pad;
+    };
+    vector<Case> cases{{{1, 64, 56, 56}, {64, 64, 3, 3}, 1, 1},
+                       {{1, 256, 14, 14}, {256, 256, 3, 3}, 1, 1},
+                       {{8, 3, 224, 224}, {64, 3, 7, 7}, 2, 3},
+                       {{16, 128, 28, 28}, {128, 128, 1, 1}, 1, 0}};
+    for (const Case& c : cases)
+    {
+        Strides strides{c.stride, c.stride};
+        CoordinateDiff padding{static_cast<ptrdiff_t>(c.pad), static_cast<ptrdiff_t>(c.pad)};
+        size_t out_h = (c.data[2] + 2 * c.pad - c.filters[2]) / c.stride + 1;
+        size_t out_w = (c.data[3] + 2 * c.pad - c.filters[3]) / c.stride + 1;
+        double flops = 2.0 * c.data[0] * c.filters[0] * out_h * out_w * c.filters[1] *
+                       c.filters[2] * c.filters[3];
+        string name = shape_name({c.data, c.filters}) + "/s" + to_string(c.stride);
+        benchmarks.push_back({benchmark_name("Convolution", element::f32, name),
+                              [c, strides, padding] {
+                                  auto data = make_shared<op::Parameter>(element::f32, c.data);
+                                  auto filters =
+                                      make_shared<op::Parameter>(element::f32, c.filters);
+                                  auto conv = make_shared<op::Convolution>(
+                                      data, filters, strides, Strides{1, 1}, padding, padding);
+                                  return make_shared<Function>(conv,
+                                                               ParameterVector{data, filters});
+                              },
+                              flops});
+    }
+}
+
+static void add_dot(vector<OpBenchmark>& benchmarks)
+{
+    vector<pair<Shape, Shape>> cases{{{64, 64}, {64, 64}},
+                                     {{256, 256}, {256, 256}},
+                                     {{1024, 1024}, {1024, 1024}},
+                                     {{1, 1024}, {1024, 1024}},
+                                     {{4096, 64}, {64, 512}}};
+    for (const element::Type& type : {element::f32, element::f64})
+    {
+        for (auto& c : cases)
+        {
+            double flops = 2.0 * c.first[0] * c.first[1] * c.second[1];
+            benchmarks.push_back({benchmark_name("Dot", type, shape_name({c.first, c.second})),
+                                  [type, c] {
+                                      auto A = make_shared<op::Parameter>(type, c.first);
+                                      auto B = make_shared<op::Parameter>(type, c.second);
+                                      return make_shared<Function>(make_shared<op::Dot>(A, B),
+                                                                   ParameterVector{A, B});
+                                  },
+                                  flops});
+        }
+    }
+}
+
+static void add_batch_mat_mul(vector<OpBenchmark>& benchmarks)
+{
+    vector<pair<Shape, Shape>> cases{{{16, 64, 64}, {16, 64, 64}},
+                                     {{64, 128, 128}, {64, 128, 128}},
+                                     {{128, 32, 256}, {128, 256, 32}}};
+    for (auto& c : cases)
+    {
+        double flops = 2.0 * c.first[0] * c.first[1] * c.first[2] * c.second[2];
+        benchmarks.push_back(
+            {benchmark_name("BatchMatMul", element::f32, shape_name({c.first, c.second})),
+             [c] {
+                 auto A = make_shared<op::Parameter>(element::f32, c.first);
+                 auto B = make_shared<op::Parameter>(element::f32, c.second);
+                 return make_shared<Function>(make_shared<op::BatchMatMul>(A, B),
+                                              ParameterVector{A, B});
+             },
+             flops});
+    }
+}
+
+static void add_reductions(vector<OpBenchmark>& benchmarks)
+{
+    vector<pair<Shape, AxisSet>> cases{{{1024, 1024}, {1}},
+                                       {{1024, 1024}, {0}},
+                                       {{64, 256, 256}, {0, 1, 2}},
+                                       {{32, 64, 56, 56}, {2, 3}}};
+    for (const element::Type& type : {element::f32, element::f64, element::i32})
+    {
+        for (auto& c : cases)
+        {
+            string shapes = shape_name({c.first}) + "/axes{" + join(c.second, ",") + "}";
+            double flops = static_cast<double>(shape_size(c.first));
+            benchmarks.push_back({benchmark_name("Sum", type, shapes),
+                                  [type, c] {
+                                      auto A = make_shared<op::Parameter>(type, c.first);
+                                      return make_shared<Function>(
+                                          make_shared<op::Sum>(A, c.second), ParameterVector{A});
+                                  },
+                                  flops});
+            benchmarks.push_back({benchmark_name("Max", type, shapes),
+                                  [type, c] {
+                                      auto A = make_shared<op::Parameter>(type, c.first);
+                                      return make_shared<Function>(
+                                          make_shared<op::Max>(A, c.second), ParameterVector{A});
+                                  },
+                                  flops});
+        }
+    }
+}
+
+static void add_softmax(vector<OpBenchmark>& benchmarks)
+{
+    vector<pair<Shape, AxisSet>> cases{{{64, 1000}, {1}}, {{32, 128, 128}, {2}}, {{1, 32000}, {1}}};
+    for (const element::Type& type : {element::f32, element::f64})
+    {
+        for (auto& c : cases)
+        {
+            string shapes = shape_name({c.first}) + "/axes{" + join(c.second, ",") + "}";
+            benchmarks.push_back({benchmark_name("Softmax", type, shapes),
+                                  [type, c] {
+                                      auto A = make_shared<op::Parameter>(type, c.first);
+                                      return make_shared<Function>(
+                                          make_shared<op::Softmax>(A, c.second),
+                                          ParameterVector{A});
+                                  }});
+        }
+    }
+}
+
+static void add_gather(vector<OpBenchmark>& benchmarks)
+{
+    struct Case
+    {
+        Shape params;
+        Shape indices;
+        size_t axis;
+    };
+    vector<Case> cases{
+        {{10000, 128}, {256}, 0}, {{30000, 512}, {64, 32}, 0}, {{256, 1024}, {64}, 1}};
+    for (const element::Type& index_type : {element::i32, element::i64})
+    {
+        for (const Case& c : cases)
+        {
+            string shapes = shape_name({c.params, c.indices}) + "/axis" + to_string(c.axis) +
+                            "/" + index_type.get_type_name();
+            benchmarks.push_back(
+                {benchmark_name("Gather", element::f32, shapes), [index_type, c] {
+                     auto params = make_shared<op::Parameter>(element::f32, c.params);
+                     auto indices = make_shared<op::Parameter>(index_type, c.indices);
+                     return make_shared<Function>(
+                         make_shared<op::Gather>(params, indices, c.axis),
+                         ParameterVector{params, indices});
+                 }});
+        }
+    }
+}
+
+static void add_topk(vector<OpBenchmark>& benchmarks)
+{
+    struct Case
+    {
+        Shape shape;
+        size_t axis;
+        size_t k;
+    };
+    vector<Case> cases{{{64, 1000}, 1, 5}, {{1, 100000}, 1, 100}, {{128, 32, 64}, 2, 8}};
+    for (const Case& c : cases)
+    {
+        string shapes = shape_name({c.shape}) + "/axis" + to_string(c.axis) + "/k" +
+                        to_string(c.k);
+        benchmarks.push_back({benchmark_name("TopK", element::f32, shapes), [c] {
+                                  auto A = make_shared<op::Parameter>(element::f32, c.shape);
+                                  auto topk = make_shared<op::TopK>(A, c.axis, element::i32, c.k);
+                                  auto indices = make_shared<op::GetOutputElement>(topk, 0);
+                                  auto values = make_shared<op::GetOutputElement>(topk, 1);
+                                  return make_shared<Function>(NodeVector{indices, values},
+                                                               ParameterVector{A});
+                              }});
+    }
+}
+
+static void add_concat(vector<OpBenchmark>& benchmarks)
+{
+    struct Case
+    {
+        Shape shape;
+        size_t count;
+        size_t axis;
+    };
+    vector<Case> cases{{{64, 256}, 4, 1}, {{32, 64, 56, 56}, 2, 1}, {{1024, 1024}, 8, 0}};
+    for (const element::Type& type : {element::f32, element::i32})
+    {
+        for (const Case& c : cases)
+        {
+            string shapes = to_string(c.count) + "x" + shape_name({c.shape}) + "/axis" +
+                            to_string(c.axis);
+            benchmarks.push_back({benchmark_name("Concat", type, shapes), [type, c] {
+                                      ParameterVector params;
+                                      NodeVector args;
+                                      for (size_t i = 0; i < c.count; i++)
+                                      {
+                                          params.push_back(
+                                              make_shared<op::Parameter>(type, c.shape));
+                                          args.push_back(params.back());
+                                      }
+                                      return make_shared<Function>(
+                                          make_shared<op::Concat>(args, c.axis), params);
+                                  }});
+        }
+    }
+}
+
+// One LSTM cell step from core ops, in the gate order i, f, c, o. Backends with an LSTM
+// kernel, like CPU, fuse the pattern.
+static shared_ptr<Function> make_lstm_cell(size_t batch, size_t input, size_t hidden)
+{
+    auto X = make_shared<op::Parameter>(element::f32, Shape{batch, input});
+    auto H = make_shared<op::Parameter>(element::f32, Shape{batch, hidden});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{batch, hidden});
+    auto W = make_shared<op::Parameter>(element::f32, Shape{input, 4 * hidden});
+    auto R = make_shared<op::Parameter>(element::f32, Shape{hidden, 4 * hidden});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4 * hidden});
+
+    auto gates = make_shared<op::Dot>(X, W) + make_shared<op::Dot>(H, R) +
+                 make_shared<op::Broadcast>(B, Shape{batch, 4 * hidden}, AxisSet{0});
+    auto gate = [&](size_t i) {
+        return make_shared<op::Slice>(
+            gates, Coordinate{0, i * hidden}, Coordinate{batch, (i + 1) * hidden});
+    };
+    auto input_gate = make_shared<op::Sigmoid>(gate(0));
+    auto forget_gate = make_shared<op::Sigmoid>(gate(1));
+    auto cell_gate = make_shared<op::Tanh>(gate(2));
+    auto output_gate = make_shared<op::Sigmoid>(gate(3));
+
+    auto next_c = forget_gate * C + input_gate * cell_gate;
+    auto next_h = output_gate * make_shared<op::Tanh>(next_c);
+    return make_shared<Function>(NodeVector{next_h, next_c}, ParameterVector{X, H, C, W, R, B});
+}
+
+static void add_lstm(vector<OpBenchmark>& benchmarks)
+{
+    vector<Shape> cases{{32, 256, 256}, {64, 512, 512}, {1, 1024, 1024}};
+    for (const Shape& c : cases)
+    {
+        double flops = 2.0 * c[0] * (c[1] + c[2]) * 4 * c[2];
+        string name = "batch" + to_string(c[0]) + "/input" + to_string(c[1]) + "/hidden" +
+                      to_string(c[2]);
+        benchmarks.push_back({benchmark_name("LSTMCell", element::f32, name),
+                              [c] { return make_lstm_cell(c[0], c[1], c[2]); },
+                              flops});
+    }
+}
+
+vector<OpBenchmark> get_op_benchmarks()
+{
+    vector<OpBenchmark> benchmarks;
+    add_convolution(benchmarks);
+    add_dot(benchmarks);
+    add_batch_mat_mul(benchmarks);
+    add_reductions(benchmarks);
+    add_softmax(benchmarks);
+    add_gather(benchmarks);
+    add_topk(benchmarks);
+    add_concat(benchmarks);
+    add_lstm(benchmarks);
+    return benchmarks;
+}
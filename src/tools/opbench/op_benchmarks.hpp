@@ -0,0 +1,39 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "ngraph/function.hpp"
+
+/// One case of the op microbenchmark suite: a Function built around a single kernel, or a
+/// small pattern like an LSTM cell that backends fuse into one
+struct OpBenchmark
+{
+    /// Unique name, `<op>/<element type>/<shapes>`
+    std::string name;
+    std::function<std::shared_ptr<ngraph::Function>()> make_function;
+    /// Floating point operations per call, 0 if not meaningful for the op
+    double flops;
+};
+
+/// The sweep of shapes and element types for every op in the suite
+std::vector<OpBenchmark> get_op_benchmarks();
@@ -0,0 +1,302 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+// Op level microbenchmarks, run on any backend:
+//     opbench -b CPU --filter 'Dot/f32' --min_time 1 --json dot.json
+// Each benchmark runs batches of calls, doubling the batch until one takes --min_time, and
+// reports the mean time of a call in that batch.
+
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <regex>
+
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/tensor.hpp"
+#include "ngraph/util.hpp"
+#include "op_benchmarks.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+struct BenchmarkResult
+{
+    string name;
+    string status;
+    size_t iterations = 0;
+    double ns_per_iteration = 0;
+    double gflops = 0;
+};
+
+template <typename T>
+static void fill(runtime::Tensor& tensor, default_random_engine& engine)
+{
+    vector<T> data(tensor.get_element_count());
+    // Small non-negative values are valid indices for every benchmark
+    uniform_int_distribution<int> dist(0, 2);
+    for (T& value : data)
+    {
+        value = static_cast<T>(dist(engine));
+    }
+    tensor.write(data.data(), 0, data.size() * sizeof(T));
+}
+
+template <>
+void fill<float>(runtime::Tensor& tensor, default_random_engine& engine)
+{
+    vector<float> data(tensor.get_element_count());
+    uniform_real_distribution<float> dist(-1, 1);
+    for (float& value : data)
+    {
+        value = dist(engine);
+    }
+    tensor.write(data.data(), 0, data.size() * sizeof(float));
+}
+
+template <>
+void fill<double>(runtime::Tensor& tensor, default_random_engine& engine)
+{
+    vector<double> data(tensor.get_element_count());
+    uniform_real_distribution<double> dist(-1, 1);
+    for (double& value : data)
+    {
+        value = dist(engine);
+    }
+    tensor.write(data.data(), 0, data.size() * sizeof(double));
+}
+
+static void random_init(runtime::Tensor& tensor, default_random_engine& engine)
+{
+    switch (tensor.get_element_type().get_type_enum())
+    {
+    case element::Type_t::f32: fill<float>(tensor, engine); break;
+    case element::Type_t::f64: fill<double>(tensor, engine); break;
+    case element::Type_t::i32: fill<int32_t>(tensor, engine); break;
+    case element::Type_t::i64: fill<int64_t>(tensor, engine); break;
+    default: throw runtime_error("unsupported type " + tensor.get_element_type().get_type_name());
+    }
+}
+
+static BenchmarkResult run(runtime::Backend& backend, const OpBenchmark& benchmark, double min_time)
+{
+    BenchmarkResult result;
+    result.name = benchmark.name;
+    shared_ptr<Function> f = benchmark.make_function();
+    for (auto& node : f->get_ops())
+    {
+        if (!node->is_parameter() && !node->is_output() && !backend.is_supported(*node))
+        {
+            result.status = "unsupported " + node->description();
+            return result;
+        }
+    }
+
+    shared_ptr<runtime::Executable> exec;
+    try
+    {
+        exec = backend.compile(f);
+    }
+    catch (const exception& e)
+    {
+        result.status = string("compile failed: ") + e.what();
+        return result;
+    }
+
+    default_random_engine engine;
+    vector<shared_ptr<runtime::Tensor>> args;
+    for (auto& param : f->get_parameters())
+    {
+        args.push_back(backend.create_tensor(param->get_element_type(), param->get_shape()));
+        random_init(*args.back(), engine);
+    }
+    vector<shared_ptr<runtime::Tensor>> results;
+    for (auto& res : f->get_results())
+    {
+        results.push_back(backend.create_tensor(res->get_element_type(), res->get_shape()));
+    }
+
+    // Warm up, then grow the batch until it runs long enough to time reliably
+    exec->call(results, args);
+    size_t iterations = 1;
+    while (true)
+    {
+        auto start = chrono::steady_clock::now();
+        for (size_t i = 0; i < iterations; i++)
+        {
+            exec->call(results, args);
+        }
+        double seconds = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        if (seconds >= min_time || iterations >= (size_t(1) << 30))
+        {
+            result.status = "ok";
+            result.iterations = iterations;
+            result.ns_per_iteration = seconds * 1e9 / iterations;
+            result.gflops = benchmark.flops / result.ns_per_iteration;
+            return result;
+        }
+        // Aim a little past min_time so a batch rarely has to be repeated twice
+        double scale = seconds > 0 ? 1.4 * min_time / seconds : 10;
+        iterations = static_cast<size_t>(iterations * min(max(scale, 2.0), 10.0));
+    }
+}
+
+static void write_json(const string& path,
+                       const string& backend,
+                       const vector<BenchmarkResult>& results)
+{
+    ofstream out(path);
+    out << "{\n    \"backend\": \"" << backend << "\",\n    \"benchmarks\": [";
+    const char* separator = "\n";
+    for (const BenchmarkResult& result : results)
+    {
+        out << separator << "        {\"name\": \"" << result.name << "\", \"status\": \""
+            << result.status << "\", \"iterations\": " << result.iterations
+            << ", \"ns_per_iteration\": " << result.ns_per_iteration
+            << ", \"gflops\": " << result.gflops << "}";
+        separator = ",\n";
+    }
+    out << "\n    ]\n}\n";
+}
+
+int main(int argc, char** argv)
+{
+    string backend_name = "CPU";
+    string filter = ".*";
+    string json_file;
+    double min_time = 0.5;
+    bool list = false;
+    bool failed = false;
+
+    for (int i = 1; i < argc; i++)
+    {
+        string arg = argv[i];
+        if ((arg == "-b" || arg == "--backend") && i + 1 < argc)
+        {
+            backend_name = argv[++i];
+        }
+        else if (arg == "--filter" && i + 1 < argc)
+        {
+            filter = argv[++i];
+        }
+        else if (arg == "--min_time" && i + 1 < argc)
+        {
+            try
+            {
+                min_time = stod(argv[++i]);
+            }
+            catch (...)
+            {
+                cout << "Invalid Argument\n";
+                failed = true;
+            }
+        }
+        else if (arg == "--json" && i + 1 < argc)
+        {
+            json_file = argv[++i];
+        }
+        else if (arg == "-l" || arg == "--list")
+        {
+            list = true;
+        }
+        else
+        {
+            cout << "Unknown option: " << arg << endl;
+            failed = true;
+        }
+    }
+    if (failed)
+    {
+        cout << R"###(
+DESCRIPTION
+    Benchmark individual ops over a sweep of shapes and element types.
+
+SYNOPSIS
+        opbench [-b <backend>] [--filter <regex>] [--min_time <seconds>] [--json <file>]
+
+OPTIONS
+        -b|--backend              Backend to use (default: CPU)
+        --filter                  Only run benchmarks whose name matches this regex
+        --min_time                Run each benchmark at least this long (default: 0.5)
+        --json                    Write the results to this file
+        -l|--list                 List the benchmarks and exit
+)###";
+        return 1;
+    }
+
+    regex pattern(filter);
+    vector<OpBenchmark> benchmarks;
+    for (OpBenchmark& benchmark : get_op_benchmarks())
+    {
+        if (regex_search(benchmark.name, pattern))
+        {
+            benchmarks.push_back(benchmark);
+        }
+    }
+    if (list)
+    {
+        for (const OpBenchmark& benchmark : benchmarks)
+        {
+            cout << benchmark.name << "\n";
+        }
+        return 0;
+    }
+
+    auto backend = runtime::Backend::create(backend_name);
+    size_t name_width = 9;
+    for (const OpBenchmark& benchmark : benchmarks)
+    {
+        name_width = max(name_width, benchmark.name.size());
+    }
+    cout << setw(name_width) << left << "Benchmark" << right << setw(16) << "Time"
+         << setw(12) << "Iterations" << setw(10) << "GFLOP/s" << "\n";
+    cout << string(name_width + 38, '-') << "\n";
+
+    vector<BenchmarkResult> results;
+    int rc = 0;
+    for (const OpBenchmark& benchmark : benchmarks)
+    {
+        BenchmarkResult result = run(*backend, benchmark, min_time);
+        cout << setw(name_width) << left << result.name << right;
+        if (result.status == "ok")
+        {
+            cout << setw(13) << fixed << setprecision(0) << result.ns_per_iteration << " ns"
+                 << setw(12) << result.iterations;
+            if (benchmark.flops > 0)
+            {
+                cout << setw(10) << setprecision(2) << result.gflops;
+            }
+            cout << "\n";
+        }
+        else
+        {
+            cout << "  " << result.status << "\n";
+            if (result.status.find("compile failed") == 0)
+            {
+                rc = 1;
+            }
+        }
+        results.push_back(result);
+    }
+
+    if (!json_file.empty())
+    {
+        write_json(json_file, backend_name, results);
+    }
+    return rc;
+}
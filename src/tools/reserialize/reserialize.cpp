@@ -42,7 +42,8 @@ SYNOPSIS
 
 OPTIONS
         -i or --input  input serialized model
-        -o or --output output serialized model
+        -o or --output output serialized model, written as a CPIO archive if the name ends
+                       in .cpio, in the binary format if it ends in .ngb and as json otherwise
         -c or --constant_to_broacast Convert large constant constants to broadcast
 )###";
 }
@@ -88,7 +89,7 @@ int main(int argc, char** argv)
         return 1;
     }
 
-    ifstream f(input);
+    ifstream f(input, ios_base::binary | ios_base::in);
     if (f)
     {
         ngraph::stopwatch timer;
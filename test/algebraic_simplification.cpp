@@ -361,6 +361,38 @@ TEST(algebraic_simplification, multiply_sum_negative)
     ASSERT_EQ(f_sum, sum_fconst1);
 }
 
+TEST(algebraic_simplification, sum_broadcast_same_axes)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto broadcast = make_shared<op::Broadcast>(x, Shape{4, 3, 2}, AxisSet{0, 2});
+    auto sum = make_shared<op::Sum>(broadcast, AxisSet{0, 2});
+    auto f = make_shared<Function>(NodeVector{sum}, ParameterVector{x});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+
+    auto multiply = dynamic_pointer_cast<op::Multiply>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(multiply);
+    EXPECT_EQ(multiply->get_argument(0), x);
+    auto cnst = dynamic_pointer_cast<op::Constant>(multiply->get_argument(1)->get_argument(0));
+    ASSERT_TRUE(cnst);
+    EXPECT_EQ(cnst->get_vector<float>(), vector<float>{8});
+}
+
+TEST(algebraic_simplification, sum_broadcast_other_axes)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto broadcast = make_shared<op::Broadcast>(x, Shape{4, 3}, AxisSet{0});
+    auto sum = make_shared<op::Sum>(broadcast, AxisSet{0, 1});
+    auto f = make_shared<Function>(NodeVector{sum}, ParameterVector{x});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AlgebraicSimplification>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(f->get_results().at(0)->get_argument(0), sum);
+}
+
 TEST(algebraic_simplification, concat_reshape_slice)
 {
     auto a = make_shared<op::Parameter>(element::f32, Shape{96, 100});
@@ -0,0 +1,59 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+#include "ngraph/runtime/aligned_buffer.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(aligned_buffer, huge_pages)
+{
+    auto policy = runtime::AlignedBuffer::get_huge_pages();
+    const size_t size = 5 * 1024 * 1024;
+
+    // hugetlbfs pools are usually empty, in which case the buffers fall back to smaller pages
+    for (auto huge_pages : {runtime::AlignedBuffer::HugePages::NONE,
+                            runtime::AlignedBuffer::HugePages::TRANSPARENT,
+                            runtime::AlignedBuffer::HugePages::HUGETLB_2MB,
+                            runtime::AlignedBuffer::HugePages::HUGETLB_1GB})
+    {
+        runtime::AlignedBuffer::set_huge_pages(huge_pages);
+        runtime::AlignedBuffer buffer(size, 4096);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.get_ptr()) % 4096, 0);
+        memset(buffer.get_ptr(), 1, size);
+        EXPECT_EQ(static_cast<char*>(buffer.get_ptr())[size - 1], 1);
+        if (huge_pages == runtime::AlignedBuffer::HugePages::NONE)
+        {
+            EXPECT_FALSE(buffer.is_mapped());
+        }
+        else if (buffer.is_mapped())
+        {
+            EXPECT_EQ(reinterpret_cast<uintptr_t>(buffer.get_ptr()) % (2 * 1024 * 1024), 0);
+        }
+
+        // Small buffers keep using malloc
+        runtime::AlignedBuffer small(1024, 64);
+        EXPECT_FALSE(small.is_mapped());
+    }
+
+    runtime::AlignedBuffer::set_huge_pages(policy);
+}
@@ -17,6 +17,7 @@
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/backend_manager.hpp"
 #include "ngraph/util.hpp"
 
 using namespace std;
@@ -34,3 +35,16 @@ TEST(backend_api, invalid_name)
 {
     ASSERT_ANY_THROW(ngraph::runtime::Backend::create("COMPLETELY-BOGUS-NAME"));
 }
+
+TEST(backend_api, startup_profile)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto steps = runtime::BackendManager::get_startup_profile();
+    EXPECT_TRUE(find_if(steps.begin(), steps.end(), [](const pair<string, size_t>& step) {
+                    return step.first == "INTERPRETER backend creation";
+                }) != steps.end());
+
+    // Only the first creation of a backend type is a startup step
+    backend = runtime::Backend::create("INTERPRETER");
+    EXPECT_EQ(runtime::BackendManager::get_startup_profile().size(), steps.size());
+}
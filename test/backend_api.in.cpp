@@ -162,3 +162,135 @@ NGRAPH_TEST(${BACKEND_NAME}, get_parameters_and_results)
     //     EXPECT_NE(results[i], func_results[i]);
     // }
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, begin_call)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    // Launch several calls, each with its own tensors, before waiting on any of them.
+    const size_t num_calls = 4;
+    vector<shared_ptr<runtime::Tensor>> results;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < num_calls; i++)
+    {
+        shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+        shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(4, static_cast<float>(i)));
+        copy_data(b, vector<float>{1, 2, 3, 4});
+        results.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(handle->begin_call({results.back()}, {a, b}));
+    }
+
+    for (size_t i = 0; i < num_calls; i++)
+    {
+        ASSERT_TRUE(futures[i].get());
+        float x = static_cast<float>(i);
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(results[i]),
+                                      (vector<float>{x + 1, x + 2, x + 3, x + 4}),
+                                      MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, begin_call_with_intermediates)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 1, 1, 1});
+    auto sum = make_shared<op::Add>(A, B);
+    auto difference = make_shared<op::Subtract>(A, B);
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::Multiply>(sum, difference), make_shared<op::Add>(sum, C)},
+        ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    // Calls in flight together must not share their intermediate tensors
+    const size_t num_calls = 8;
+    vector<shared_ptr<runtime::Tensor>> products;
+    vector<shared_ptr<runtime::Tensor>> sums;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < num_calls; i++)
+    {
+        shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+        shared_ptr<runtime::Tensor> b = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(4, static_cast<float>(i + 2)));
+        copy_data(b, vector<float>{1, 2, 3, 4});
+        products.push_back(backend->create_tensor(element::f32, shape));
+        sums.push_back(backend->create_tensor(element::f32, shape));
+        futures.push_back(handle->begin_call({products.back(), sums.back()}, {a, b}));
+    }
+
+    for (size_t i = 0; i < num_calls; i++)
+    {
+        ASSERT_TRUE(futures[i].get());
+        float x = static_cast<float>(i + 2);
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(products[i]),
+                                      (vector<float>{x * x - 1, x * x - 4, x * x - 9, x * x - 16}),
+                                      MIN_FLOAT_TOLERANCE_BITS));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(sums[i]),
+                                      (vector<float>{x + 2, x + 3, x + 4, x + 5}),
+                                      MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, update_constants)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>(make_shared<op::Add>(A, C), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto handle = backend->compile(f);
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{10, 20, 30, 40});
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), (vector<float>{11, 22, 33, 44}), MIN_FLOAT_TOLERANCE_BITS));
+
+    vector<float> new_values{5, 6, 7, 8};
+    handle->update_constants({{C.get(), new_values.data()}});
+    handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), (vector<float>{15, 26, 37, 48}), MIN_FLOAT_TOLERANCE_BITS));
+
+    auto other = op::Constant::create(element::f32, shape, {0, 0, 0, 0});
+    EXPECT_ANY_THROW(handle->update_constants({{other.get(), new_values.data()}}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, update_constants_shared_with_copy)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>(make_shared<op::Add>(A, C), ParameterVector{A});
+    // The copy shares the constant's data until one of them is updated
+    auto g = clone_function(*f);
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto f_handle = backend->compile(f);
+    auto g_handle = backend->compile(g);
+
+    shared_ptr<runtime::Tensor> a = backend->create_tensor(element::f32, shape);
+    shared_ptr<runtime::Tensor> result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{10, 20, 30, 40});
+
+    vector<float> new_values{5, 6, 7, 8};
+    f_handle->update_constants({{C.get(), new_values.data()}});
+    f_handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), (vector<float>{15, 26, 37, 48}), MIN_FLOAT_TOLERANCE_BITS));
+    g_handle->call_with_validate({result}, {a});
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), (vector<float>{11, 22, 33, 44}), MIN_FLOAT_TOLERANCE_BITS));
+}
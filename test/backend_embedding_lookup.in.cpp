@@ -130,3 +130,106 @@ NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_10x1_arbitrary_index_type_int64)
     vector<float> expected{9.5, 2.5, 1.5, 0.5, 3.5, 5.5, 4.5, 6.5, 8.5, 7.5};
     EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result0), MIN_FLOAT_TOLERANCE_BITS));
 }
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_backprop_repeated_indices)
+{
+    Shape shape{3};
+    Shape dshape{3, 2};
+    Shape wshape{4, 2};
+    auto A = make_shared<op::Parameter>(element::i32, shape);
+    auto D = make_shared<op::Parameter>(element::f32, dshape);
+    auto backprop = make_shared<op::EmbeddingLookupBackprop>(A, D, wshape);
+    auto f0 = make_shared<Function>(NodeVector{backprop}, ParameterVector{A, D});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i32, shape);
+    copy_data(a, vector<int>{1, 3, 1});
+    auto d = backend->create_tensor(element::f32, dshape);
+    copy_data(d, vector<float>{1, 2, 3, 4, 5, 6});
+    auto result0 = backend->create_tensor(element::f32, wshape);
+    auto handle = backend->compile(f0);
+    handle->call_with_validate({result0}, {a, d});
+    vector<float> expected{0, 0, 6, 8, 0, 0, 3, 4};
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result0), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_adjoint)
+{
+    Shape shape{2, 2};
+    Shape wshape{3, 1};
+    auto A = make_shared<op::Parameter>(element::i64, shape);
+    auto B = make_shared<op::Parameter>(element::f32, wshape);
+    auto embed = make_shared<op::EmbeddingLookup>(A, B);
+    auto C = make_shared<op::Parameter>(element::f32, embed->get_shape());
+    autodiff::Adjoints adjoints(NodeVector{embed}, NodeVector{C});
+    auto f0 = make_shared<Function>(NodeVector{adjoints.backprop_node(B)}, ParameterVector{A, C});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i64, shape);
+    copy_data(a, vector<int64_t>{2, 0, 2, 2});
+    auto c = backend->create_tensor(element::f32, embed->get_shape());
+    copy_data(c, vector<float>{1, 2, 3, 4});
+    auto result0 = backend->create_tensor(element::f32, wshape);
+    auto handle = backend->compile(f0);
+    handle->call_with_validate({result0}, {a, c});
+    vector<float> expected{2, 0, 8};
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result0), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_quantized_i8)
+{
+    Shape shape{3};
+    Shape wshape{3, 4};
+    auto A = make_shared<op::Parameter>(element::i32, shape);
+    auto W = make_shared<op::Parameter>(element::i8, wshape);
+    auto S = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto embed = make_shared<op::EmbeddingLookup>(A, W, S, B);
+    auto f0 = make_shared<Function>(NodeVector{embed}, ParameterVector{A, W, S, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i32, shape);
+    copy_data(a, vector<int>{2, 0, 2});
+    auto w = backend->create_tensor(element::i8, wshape);
+    copy_data(w, vector<int8_t>{-128, 0, 127, 1, 1, 2, 3, 4, 10, -10, 20, -20});
+    auto s = backend->create_tensor(element::f32, Shape{3});
+    copy_data(s, vector<float>{0.5f, 1.0f, 0.25f});
+    auto b = backend->create_tensor(element::f32, Shape{3});
+    copy_data(b, vector<float>{1.0f, 0.0f, -1.0f});
+    auto result0 = backend->create_tensor(element::f32, Shape{3, 4});
+    auto handle = backend->compile(f0);
+    handle->call_with_validate({result0}, {a, w, s, b});
+    vector<float> expected{1.5f, -3.5f, 4, -6, -63, 1, 64.5f, 1.5f, 1.5f, -3.5f, 4, -6};
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result0), MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, embedding_lookup_quantized_f16)
+{
+    Shape shape{2};
+    Shape wshape{2, 3};
+    auto A = make_shared<op::Parameter>(element::i64, shape);
+    auto W = make_shared<op::Parameter>(element::f16, wshape);
+    auto S = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto embed = make_shared<op::EmbeddingLookup>(A, W, S, B);
+    auto f0 = make_shared<Function>(NodeVector{embed}, ParameterVector{A, W, S, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    auto a = backend->create_tensor(element::i64, shape);
+    copy_data(a, vector<int64_t>{1, 1});
+    auto w = backend->create_tensor(element::f16, wshape);
+    copy_data(w, vector<float16>{1.0f, 2.0f, 3.0f, 0.5f, -0.25f, 8.0f});
+    auto s = backend->create_tensor(element::f32, Shape{2});
+    copy_data(s, vector<float>{1.0f, 2.0f});
+    auto b = backend->create_tensor(element::f32, Shape{2});
+    copy_data(b, vector<float>{0.0f, 1.0f});
+    auto result0 = backend->create_tensor(element::f32, Shape{2, 3});
+    auto handle = backend->compile(f0);
+    handle->call_with_validate({result0}, {a, w, s, b});
+    vector<float> expected{2, 0.5f, 17, 2, 0.5f, 17};
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result0), MIN_FLOAT_TOLERANCE_BITS));
+}
@@ -381,6 +381,298 @@ NGRAPH_TEST(${BACKEND_NAME}, depth_to_space)
     test_case.run();
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, sgd_momentum_update)
+{
+    auto learning_rate = make_shared<op::Parameter>(element::f32, Shape{});
+    auto P1 = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto G1 = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto V1 = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto P2 = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto G2 = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto V2 = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto update = make_shared<op::SgdMomentumUpdate>(
+        learning_rate, NodeVector{P1, P2}, NodeVector{G1, G2}, NodeVector{V1, V2}, 0.9);
+    NodeVector outputs;
+    for (size_t i = 0; i < 4; i++)
+    {
+        outputs.push_back(make_shared<op::GetOutputElement>(update, i));
+    }
+    auto function =
+        make_shared<Function>(outputs, ParameterVector{learning_rate, P1, G1, V1, P2, G2, V2});
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({0.1f});
+    test_case.add_input<float>({1, 2});
+    test_case.add_input<float>({0.5f, -1});
+    test_case.add_input<float>({1, 0});
+    test_case.add_input<float>({0, 0, 0});
+    test_case.add_input<float>({1, 2, 3});
+    test_case.add_input<float>({0, 0, 0});
+    // parameters, then velocities
+    test_case.add_expected_output<float>(Shape{2}, {0.86f, 2.1f});
+    test_case.add_expected_output<float>(Shape{3}, {-0.1f, -0.2f, -0.3f});
+    test_case.add_expected_output<float>(Shape{2}, {1.4f, -1});
+    test_case.add_expected_output<float>(Shape{3}, {1, 2, 3});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, adam_update)
+{
+    auto learning_rate = make_shared<op::Parameter>(element::f32, Shape{});
+    auto P1 = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto G1 = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto M1 = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto V1 = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto P2 = make_shared<op::Parameter>(element::f32, Shape{1});
+    auto G2 = make_shared<op::Parameter>(element::f32, Shape{1});
+    auto M2 = make_shared<op::Parameter>(element::f32, Shape{1});
+    auto V2 = make_shared<op::Parameter>(element::f32, Shape{1});
+    auto update = make_shared<op::AdamUpdate>(learning_rate,
+                                              NodeVector{P1, P2},
+                                              NodeVector{G1, G2},
+                                              NodeVector{M1, M2},
+                                              NodeVector{V1, V2});
+    NodeVector outputs;
+    for (size_t i = 0; i < 6; i++)
+    {
+        outputs.push_back(make_shared<op::GetOutputElement>(update, i));
+    }
+    auto function = make_shared<Function>(
+        outputs, ParameterVector{learning_rate, P1, G1, M1, V1, P2, G2, M2, V2});
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({0.1f});
+    test_case.add_input<float>({1, 2});
+    test_case.add_input<float>({1, -2});
+    test_case.add_input<float>({0, 0});
+    test_case.add_input<float>({0, 0});
+    test_case.add_input<float>({0.5f});
+    test_case.add_input<float>({0.5f});
+    test_case.add_input<float>({1});
+    test_case.add_input<float>({1});
+    // parameters, first moments, then second moments
+    test_case.add_expected_output<float>(Shape{2}, {0.6837723f, 2.3162277f});
+    test_case.add_expected_output<float>(Shape{1}, {0.4049644f});
+    test_case.add_expected_output<float>(Shape{2}, {0.1f, -0.2f});
+    test_case.add_expected_output<float>(Shape{1}, {0.95f});
+    test_case.add_expected_output<float>(Shape{2}, {0.001f, 0.004f});
+    test_case.add_expected_output<float>(Shape{1}, {0.99925f});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, sgd_momentum_update_loss_scaled)
+{
+    auto learning_rate = make_shared<op::Parameter>(element::f32, Shape{});
+    auto loss_scale = make_shared<op::Parameter>(element::f32, Shape{});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto G = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto V = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto finite = make_shared<op::AllFinite>(NodeVector{G});
+    auto update = make_shared<op::SgdMomentumUpdate>(
+        learning_rate, loss_scale, finite, NodeVector{P}, NodeVector{G}, NodeVector{V}, 0.9);
+    auto function = make_shared<Function>(
+        NodeVector{make_shared<op::GetOutputElement>(update, 0),
+                   make_shared<op::GetOutputElement>(update, 1)},
+        ParameterVector{learning_rate, loss_scale, P, G, V});
+
+    // the gradients of sgd_momentum_update scaled by 4
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({0.1f});
+    test_case.add_input<float>({4});
+    test_case.add_input<float>({1, 2});
+    test_case.add_input<float>({2, -4});
+    test_case.add_input<float>({1, 0});
+    test_case.add_expected_output<float>(Shape{2}, {0.86f, 2.1f});
+    test_case.add_expected_output<float>(Shape{2}, {1.4f, -1});
+    test_case.run();
+
+    // an overflowed gradient skips the update
+    auto skipped_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    skipped_case.add_input<float>({0.1f});
+    skipped_case.add_input<float>({4});
+    skipped_case.add_input<float>({1, 2});
+    skipped_case.add_input<float>({2, numeric_limits<float>::infinity()});
+    skipped_case.add_input<float>({1, 0});
+    skipped_case.add_expected_output<float>(Shape{2}, {1, 2});
+    skipped_case.add_expected_output<float>(Shape{2}, {1, 0});
+    skipped_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, adam_update_loss_scaled)
+{
+    auto learning_rate = make_shared<op::Parameter>(element::f32, Shape{});
+    auto loss_scale = make_shared<op::Parameter>(element::f32, Shape{});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto G = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto M = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto V = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto finite = make_shared<op::AllFinite>(NodeVector{G});
+    auto update = make_shared<op::AdamUpdate>(learning_rate,
+                                              loss_scale,
+                                              finite,
+                                              NodeVector{P},
+                                              NodeVector{G},
+                                              NodeVector{M},
+                                              NodeVector{V});
+    NodeVector outputs;
+    for (size_t i = 0; i < 3; i++)
+    {
+        outputs.push_back(make_shared<op::GetOutputElement>(update, i));
+    }
+    auto function =
+        make_shared<Function>(outputs, ParameterVector{learning_rate, loss_scale, P, G, M, V});
+
+    // the first gradients of adam_update scaled by 2
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({0.1f});
+    test_case.add_input<float>({2});
+    test_case.add_input<float>({1, 2});
+    test_case.add_input<float>({2, -4});
+    test_case.add_input<float>({0, 0});
+    test_case.add_input<float>({0, 0});
+    test_case.add_expected_output<float>(Shape{2}, {0.6837723f, 2.3162277f});
+    test_case.add_expected_output<float>(Shape{2}, {0.1f, -0.2f});
+    test_case.add_expected_output<float>(Shape{2}, {0.001f, 0.004f});
+    test_case.run();
+
+    // an overflowed gradient skips the update
+    auto skipped_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    skipped_case.add_input<float>({0.1f});
+    skipped_case.add_input<float>({2});
+    skipped_case.add_input<float>({1, 2});
+    skipped_case.add_input<float>({numeric_limits<float>::quiet_NaN(), -4});
+    skipped_case.add_input<float>({0.5f, 0});
+    skipped_case.add_input<float>({1, 0});
+    skipped_case.add_expected_output<float>(Shape{2}, {1, 2});
+    skipped_case.add_expected_output<float>(Shape{2}, {0.5f, 0});
+    skipped_case.add_expected_output<float>(Shape{2}, {1, 0});
+    skipped_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, all_finite)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto B = make_shared<op::Parameter>(element::f64, Shape{3});
+    auto function =
+        make_shared<Function>(make_shared<op::AllFinite>(NodeVector{A, B}), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, Shape{2, 2});
+    auto b = backend->create_tensor(element::f64, Shape{3});
+    auto result = backend->create_tensor(element::boolean, Shape{});
+    auto handle = backend->compile(function);
+
+    copy_data(a, vector<float>{1, -2, 0, numeric_limits<float>::max()});
+    copy_data(b, vector<double>{-1e300, 0, 3});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<char>(result), vector<char>{1});
+
+    copy_data(a, vector<float>{1, -numeric_limits<float>::infinity(), 0, 4});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<char>(result), vector<char>{0});
+
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<double>{0, numeric_limits<double>::quiet_NaN(), 3});
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(read_vector<char>(result), vector<char>{0});
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, scaled_dot_product_attention)
+{
+    auto Q = make_shared<op::Parameter>(element::f32, Shape{1, 2, 2});
+    auto K = make_shared<op::Parameter>(element::f32, Shape{1, 3, 2});
+    auto V = make_shared<op::Parameter>(element::f32, Shape{1, 3, 2});
+    auto M = make_shared<op::Parameter>(element::f32, Shape{1, 2, 3});
+    auto attention = make_shared<op::ScaledDotProductAttention>(Q, K, V, M, 0.5);
+    auto function = make_shared<Function>(attention, ParameterVector{Q, K, V, M});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto q = backend->create_tensor(element::f32, Shape{1, 2, 2});
+    copy_data(q, vector<float>{1, 0, 0, 1});
+    auto k = backend->create_tensor(element::f32, Shape{1, 3, 2});
+    copy_data(k, vector<float>{1, 0, 0, 1, 1, 1});
+    auto v = backend->create_tensor(element::f32, Shape{1, 3, 2});
+    copy_data(v, vector<float>{1, 2, 3, 4, 5, 6});
+    // the first query does not attend to the last key
+    auto m = backend->create_tensor(element::f32, Shape{1, 2, 3});
+    copy_data(m, vector<float>{0, 0, -10000, 0, 0, 0});
+    auto result = backend->create_tensor(element::f32, Shape{1, 2, 2});
+
+    auto handle = backend->compile(function);
+    handle->call_with_validate({result}, {q, k, v, m});
+    EXPECT_TRUE(test::all_close_f(vector<float>{1.7550813f, 2.7550813f, 3.3019104f, 4.3019104f},
+                                  read_vector<float>(result)));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, layer_norm)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+    auto gamma = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto beta = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto layer_norm = make_shared<op::LayerNorm>(A, gamma, beta, 1e-5, 1);
+    auto function = make_shared<Function>(layer_norm, ParameterVector{A, gamma, beta});
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({1, 2, 3, 4, -1, 0, 2, 7});
+    test_case.add_input<float>({1, 1, 2, 0.5});
+    test_case.add_input<float>({0, 0.5, 0, -1});
+    test_case.set_tolerance(8);
+    test_case.add_expected_output<float>(Shape{2, 4},
+                                         {-1.3416355f,
+                                          0.052788168f,
+                                          0.89442366f,
+                                          -0.32918227f,
+                                          -0.97332805f,
+                                          -0.14888537f,
+                                          0.0f,
+                                          -0.18889332f});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, gelu)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{8});
+    auto gelu = make_shared<op::Gelu>(A);
+    auto function = make_shared<Function>(gelu, ParameterVector{A});
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({-2, -1, -0.5, 0, 0.5, 1, 2, 3});
+    // the kernels may use their own erf and tanh approximations
+    test_case.set_tolerance(8);
+    test_case.add_expected_output<float>(Shape{8},
+                                         {-0.045500278f,
+                                          -0.15865526f,
+                                          -0.15426877f,
+                                          0.0f,
+                                          0.34573123f,
+                                          0.84134471f,
+                                          1.9544997f,
+                                          2.9959502f});
+    test_case.run();
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, gelu_approximate)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{8});
+    auto gelu = make_shared<op::Gelu>(A, true);
+    auto function = make_shared<Function>(gelu, ParameterVector{A});
+
+    auto test_case = ngraph::test::NgraphTestCase(function, "${BACKEND_NAME}");
+    test_case.add_input<float>({-2, -1, -0.5, 0, 0.5, 1, 2, 3});
+    // the kernels may use their own erf and tanh approximations
+    test_case.set_tolerance(8);
+    test_case.add_expected_output<float>(Shape{8},
+                                         {-0.045402288f,
+                                          -0.15880799f,
+                                          -0.154286f,
+                                          0.0f,
+                                          0.345714f,
+                                          0.84119201f,
+                                          1.9545977f,
+                                          2.9963627f});
+    test_case.run();
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, gemm)
 {
     auto A = make_shared<op::Parameter>(element::f64, Shape{3, 6});
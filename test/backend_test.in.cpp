@@ -18,6 +18,7 @@
 #include <cinttypes>
 #include <cmath>
 #include <cstdlib>
+#include <numeric>
 #include <random>
 #include <string>
 #include "gtest/gtest.h"
@@ -26,7 +27,10 @@
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/op/experimental/dropout.hpp"
 #include "ngraph/op/experimental/generate_mask.hpp"
+#include "ngraph/op/experimental/if.hpp"
+#include "ngraph/op/experimental/loop.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/state/rng_state.hpp"
 #include "util/all_close.hpp"
@@ -5752,6 +5756,73 @@ NGRAPH_TEST(${BACKEND_NAME}, validate_call_output_shape)
     EXPECT_ANY_THROW(auto handle = backend->compile(f); handle->call_with_validate({a}, {c, b}));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, validate_call_cached)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    Shape shape{2, 2};
+
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+    auto g = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto c = backend->create_tensor(element::f32, shape);
+    auto wrong_shape = backend->create_tensor(element::f32, {2, 3});
+    auto wrong_type = backend->create_tensor(element::i32, shape);
+
+    // A validated call is only checked again once a tensor of another type is passed, so
+    // every invalid call still throws
+    auto handle = backend->compile(f);
+    handle->validate({c}, {a, b});
+    handle->validate({c}, {a, b});
+    EXPECT_ANY_THROW(handle->validate({c}, {a, wrong_shape}));
+    EXPECT_ANY_THROW(handle->validate({wrong_type}, {a, b}));
+    EXPECT_ANY_THROW(handle->validate({c}, {a}));
+    handle->validate({c}, {b, a});
+    handle->validate({c}, {a, b});
+
+    // The validations of one executable are not taken for another's
+    auto other = backend->compile(g);
+    other->validate({c}, {a, b});
+    EXPECT_ANY_THROW(other->validate({c}, {wrong_shape, b}));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, tensor_region_read_write)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    Shape shape{2, 3, 4};
+    auto a = backend->create_tensor(element::f32, shape);
+    vector<float> data(shape_size(shape));
+    iota(data.begin(), data.end(), 0);
+    copy_data(a, data);
+
+    vector<float> region(6);
+    a->read_region(region.data(), Coordinate{1, 0, 1}, Coordinate{2, 3, 3});
+    EXPECT_EQ((vector<float>{13, 14, 17, 18, 21, 22}), region);
+
+    // The column at index 2 of every row, transposed
+    a->read_region(region.data(), Coordinate{0, 0, 2}, Coordinate{2, 3, 3}, Strides{1, 2, 1});
+    EXPECT_EQ((vector<float>{2, 14, 6, 18, 10, 22}), region);
+
+    vector<float> row{100, 101, 102, 103};
+    a->write_region(row.data(), Coordinate{1, 2, 0}, Coordinate{2, 3, 4});
+    a->write_region(row.data(), Coordinate{0, 0, 3}, Coordinate{1, 2, 4}, Strides{1, 2, 1});
+    data[20] = 100;
+    data[21] = 101;
+    data[22] = 102;
+    data[23] = 103;
+    data[3] = 100;
+    data[7] = 102;
+    EXPECT_EQ(data, read_vector<float>(a));
+
+    EXPECT_ANY_THROW(a->read_region(region.data(), Coordinate{0, 0, 0}, Coordinate{1, 1, 5}));
+    EXPECT_ANY_THROW(a->read_region(region.data(), Coordinate{0, 0}, Coordinate{1, 1}));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, logical_and)
 {
     Shape shape{2, 2, 2};
@@ -6316,6 +6387,229 @@ NGRAPH_TEST(${BACKEND_NAME}, generate_mask)
     ASSERT_FALSE(std::any_of(result2_2.begin(), result2_2.end(), is_not_zero_or_one));
 }
 
+NGRAPH_TEST(${BACKEND_NAME}, dropout)
+{
+    Shape shape{1, 128};
+    const unsigned int seed = 777;
+    auto x = make_shared<op::Parameter>(element::f32, shape);
+    auto delta = make_shared<op::Parameter>(element::f32, shape);
+    auto training = make_shared<op::Parameter>(element::f32, Shape{});
+    auto dropout = make_shared<op::Dropout>(x, training, seed, 0.5);
+    auto y = make_shared<op::GetOutputElement>(dropout, 0);
+    auto offset = make_shared<op::GetOutputElement>(dropout, 1);
+    auto dx = make_shared<op::DropoutBackprop>(delta, training, offset, seed, 0.5);
+    auto f = make_shared<Function>(NodeVector{y, dx}, ParameterVector{x, delta, training});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+    vector<float> input(shape_size(shape));
+    iota(input.begin(), input.end(), 1.f);
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, input);
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, input);
+    auto mode = backend->create_tensor(element::f32, Shape{});
+    copy_data(mode, vector<float>{1});
+    auto result_y = backend->create_tensor(element::f32, shape);
+    auto result_dx = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result_y, result_dx}, {a, b, mode});
+    auto y1 = read_vector<float>(result_y);
+    // the backprop regenerates the mask of the forward op from its offset output
+    EXPECT_EQ(y1, read_vector<float>(result_dx));
+    size_t kept = 0;
+    for (size_t i = 0; i < input.size(); i++)
+    {
+        EXPECT_TRUE(y1[i] == 0.f || y1[i] == 2.f * input[i]);
+        kept += (y1[i] != 0.f);
+    }
+    EXPECT_GT(kept, 0);
+    EXPECT_LT(kept, input.size());
+
+    handle->call_with_validate({result_y, result_dx}, {a, b, mode});
+    auto y2 = read_vector<float>(result_y);
+    EXPECT_EQ(y2, read_vector<float>(result_dx));
+    EXPECT_NE(y1, y2);
+
+    // inference passes the values through
+    copy_data(mode, vector<float>{0});
+    handle->call_with_validate({result_y, result_dx}, {a, b, mode});
+    EXPECT_EQ(input, read_vector<float>(result_y));
+    EXPECT_EQ(input, read_vector<float>(result_dx));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, if_then_else)
+{
+    Shape shape{2, 2};
+    auto then_x = make_shared<op::Parameter>(element::f32, shape);
+    auto then_body =
+        make_shared<Function>(make_shared<op::Add>(then_x, then_x), ParameterVector{then_x});
+    auto else_x = make_shared<op::Parameter>(element::f32, shape);
+    auto else_body =
+        make_shared<Function>(make_shared<op::Negative>(else_x), ParameterVector{else_x});
+
+    auto condition = make_shared<op::Parameter>(element::boolean, Shape{});
+    auto x = make_shared<op::Parameter>(element::f32, shape);
+    auto if_op = make_shared<op::If>(condition, NodeVector{x}, then_body, else_body);
+    auto f = make_shared<Function>(make_shared<op::GetOutputElement>(if_op, 0),
+                                   ParameterVector{condition, x});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto c = backend->create_tensor(element::boolean, Shape{});
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    copy_data(c, vector<char>{1});
+    handle->call_with_validate({result}, {c, a});
+    EXPECT_EQ((vector<float>{2, 4, 6, 8}), read_vector<float>(result));
+    copy_data(c, vector<char>{0});
+    handle->call_with_validate({result}, {c, a});
+    EXPECT_EQ((vector<float>{-1, -2, -3, -4}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, compile_functions_sharing_constants)
+{
+    Shape shape{2, 2};
+    auto x = make_shared<op::Parameter>(element::f32, shape);
+    auto w = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    // an equal constant of its own, which may share w's data once compiled
+    auto v = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto encoder = make_shared<Function>(make_shared<op::Add>(x, w), ParameterVector{x});
+    auto decoder = make_shared<Function>(
+        make_shared<op::Subtract>(make_shared<op::Multiply>(x, w), v), ParameterVector{x});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto executables = backend->compile({encoder, decoder});
+    ASSERT_EQ(executables.size(), 2);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 1, 2, 2});
+    auto result = backend->create_tensor(element::f32, shape);
+    executables[0]->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<float>{2, 3, 5, 6}), read_vector<float>(result));
+    executables[1]->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<float>{0, 0, 3, 4}), read_vector<float>(result));
+    executables[0]->call_with_validate({result}, {a});
+    EXPECT_EQ((vector<float>{2, 3, 5, 6}), read_vector<float>(result));
+
+    // the functions themselves are not rewritten
+    EXPECT_EQ(encoder->get_results().at(0)->get_argument(0)->get_argument(1), w);
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), w->get_vector<float>());
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, if_adjoint)
+{
+    Shape shape{3};
+    auto then_x = make_shared<op::Parameter>(element::f32, shape);
+    auto then_body =
+        make_shared<Function>(make_shared<op::Multiply>(then_x, then_x), ParameterVector{then_x});
+    auto else_x = make_shared<op::Parameter>(element::f32, shape);
+    auto else_body = make_shared<Function>(NodeVector{else_x}, ParameterVector{else_x});
+
+    auto condition = make_shared<op::Parameter>(element::boolean, Shape{});
+    auto x = make_shared<op::Parameter>(element::f32, shape);
+    auto y = make_shared<op::GetOutputElement>(
+        make_shared<op::If>(condition, NodeVector{x}, then_body, else_body), 0);
+    auto delta = make_shared<op::Parameter>(element::f32, shape);
+    autodiff::Adjoints adjoints(NodeVector{y}, NodeVector{delta});
+    auto f = make_shared<Function>(NodeVector{adjoints.backprop_node(x)},
+                                   ParameterVector{condition, x, delta});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto c = backend->create_tensor(element::boolean, Shape{});
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3});
+    auto d = backend->create_tensor(element::f32, shape);
+    copy_data(d, vector<float>{1, 10, 100});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    copy_data(c, vector<char>{1});
+    handle->call_with_validate({result}, {c, a, d});
+    EXPECT_EQ((vector<float>{2, 40, 600}), read_vector<float>(result));
+    copy_data(c, vector<char>{0});
+    handle->call_with_validate({result}, {c, a, d});
+    EXPECT_EQ((vector<float>{1, 10, 100}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, loop_trip_count)
+{
+    // acc, step -> acc + step, three times
+    Shape shape{2};
+    auto i = make_shared<op::Parameter>(element::i64, Shape{});
+    auto body_acc = make_shared<op::Parameter>(element::f32, shape);
+    auto body_step = make_shared<op::Parameter>(element::f32, shape);
+    auto body = make_shared<Function>(
+        NodeVector{op::Constant::create(element::boolean, Shape{}, {1}),
+                   make_shared<op::Add>(body_acc, body_step)},
+        ParameterVector{i, body_acc, body_step});
+
+    auto trip_count = make_shared<op::Parameter>(element::i64, Shape{});
+    auto acc = make_shared<op::Parameter>(element::f32, shape);
+    auto step = make_shared<op::Parameter>(element::f32, shape);
+    auto loop = make_shared<op::Loop>(trip_count,
+                                      op::Constant::create(element::boolean, Shape{}, {1}),
+                                      NodeVector{acc},
+                                      NodeVector{step},
+                                      body);
+    auto f = make_shared<Function>(make_shared<op::GetOutputElement>(loop, 0),
+                                   ParameterVector{trip_count, acc, step});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto n = backend->create_tensor(element::i64, Shape{});
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{10, 100});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    copy_data(n, vector<int64_t>{3});
+    handle->call_with_validate({result}, {n, a, b});
+    EXPECT_EQ((vector<float>{31, 302}), read_vector<float>(result));
+    // the result of the last iteration is in the other buffer of the pair
+    copy_data(n, vector<int64_t>{2});
+    handle->call_with_validate({result}, {n, a, b});
+    EXPECT_EQ((vector<float>{21, 202}), read_vector<float>(result));
+    copy_data(n, vector<int64_t>{0});
+    handle->call_with_validate({result}, {n, a, b});
+    EXPECT_EQ((vector<float>{1, 2}), read_vector<float>(result));
+}
+
+NGRAPH_TEST(${BACKEND_NAME}, loop_condition)
+{
+    // x -> x * 2 while the iteration number is below 4, with no trip count limit
+    Shape shape{2};
+    auto i = make_shared<op::Parameter>(element::i64, Shape{});
+    auto body_x = make_shared<op::Parameter>(element::f32, shape);
+    auto body = make_shared<Function>(
+        NodeVector{make_shared<op::Less>(i, op::Constant::create(element::i64, Shape{}, {4})),
+                   make_shared<op::Add>(body_x, body_x)},
+        ParameterVector{i, body_x});
+
+    auto x = make_shared<op::Parameter>(element::f32, shape);
+    auto loop = make_shared<op::Loop>(op::Constant::create(element::i64, Shape{}, {-1}),
+                                      op::Constant::create(element::boolean, Shape{}, {1}),
+                                      NodeVector{x},
+                                      NodeVector{},
+                                      body);
+    auto f =
+        make_shared<Function>(make_shared<op::GetOutputElement>(loop, 0), ParameterVector{x});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 3});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    // iterations 0 to 4 run, the last one returns false
+    EXPECT_EQ((vector<float>{32, 96}), read_vector<float>(result));
+}
+
 NGRAPH_TEST(${BACKEND_NAME}, quantize)
 {
     Shape input_shape{4, 3};
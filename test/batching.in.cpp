@@ -0,0 +1,127 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <chrono>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/batching/batching_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+static shared_ptr<Function> make_batched_multiply()
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto b = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    return make_shared<Function>(make_shared<op::Multiply>(a, b), ParameterVector{a, b});
+}
+
+NGRAPH_TEST(batching_${BACKEND_NAME}, combines_requests)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    // The window is long enough that the batch is only dispatched once it is full.
+    runtime::batching::BatchingExecutable batching(
+        make_batched_multiply(), backend, 4, chrono::seconds(10));
+
+    vector<shared_ptr<runtime::Tensor>> outputs;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < 3; i++)
+    {
+        // Requests 0 and 2 carry one sample, request 1 carries two.
+        size_t batch_size = (i == 1 ? 2 : 1);
+        auto a = backend->create_tensor(element::f32, Shape{batch_size, 3});
+        auto b = backend->create_tensor(element::f32, Shape{batch_size, 3});
+        auto result = backend->create_tensor(element::f32, Shape{batch_size, 3});
+        vector<float> a_data(batch_size * 3);
+        for (size_t j = 0; j < a_data.size(); j++)
+        {
+            a_data[j] = 10 * i + j;
+        }
+        copy_data(a, a_data);
+        copy_data(b, vector<float>(batch_size * 3, i + 1));
+        outputs.push_back(result);
+        futures.push_back(batching.begin_call({result}, {a, b}));
+    }
+    for (auto& f : futures)
+    {
+        EXPECT_TRUE(f.get());
+    }
+
+    EXPECT_TRUE(test::all_close_f((vector<float>{0, 1, 2}), read_vector<float>(outputs[0])));
+    EXPECT_TRUE(test::all_close_f((vector<float>{20, 22, 24, 26, 28, 30}),
+                                  read_vector<float>(outputs[1])));
+    EXPECT_TRUE(test::all_close_f((vector<float>{60, 63, 66}), read_vector<float>(outputs[2])));
+
+    auto statistics = batching.get_statistics();
+    EXPECT_EQ(statistics.requests, 3);
+    EXPECT_EQ(statistics.batches, 1);
+    ASSERT_EQ(statistics.batch_fill_histogram.size(), 5);
+    EXPECT_EQ(statistics.batch_fill_histogram[4], 1);
+    size_t latency_count = 0;
+    for (auto count : statistics.latency_histogram)
+    {
+        latency_count += count;
+    }
+    EXPECT_EQ(latency_count, 3);
+}
+
+NGRAPH_TEST(batching_${BACKEND_NAME}, window_expires)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::batching::BatchingExecutable batching(
+        make_batched_multiply(), backend, 8, chrono::milliseconds(1));
+
+    auto a = backend->create_tensor(element::f32, Shape{1, 3});
+    auto b = backend->create_tensor(element::f32, Shape{1, 3});
+    auto result = backend->create_tensor(element::f32, Shape{1, 3});
+    copy_data(a, vector<float>{1, 2, 3});
+    copy_data(b, vector<float>{4, 5, 6});
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        ASSERT_TRUE(batching.call({result}, {a, b}));
+        EXPECT_TRUE(test::all_close_f((vector<float>{4, 10, 18}), read_vector<float>(result)));
+    }
+
+    auto statistics = batching.get_statistics();
+    EXPECT_EQ(statistics.requests, 2);
+    EXPECT_EQ(statistics.batches, 2);
+    EXPECT_EQ(statistics.batch_fill_histogram[1], 2);
+}
+
+NGRAPH_TEST(batching_${BACKEND_NAME}, incompatible_requests)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto b = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    runtime::batching::BatchingExecutable batching(
+        make_shared<Function>(make_shared<op::Add>(a, b), ParameterVector{a, b}),
+        backend,
+        2,
+        chrono::milliseconds(1));
+
+    auto t = backend->create_tensor(element::f32, Shape{1, 3});
+    auto result = backend->create_tensor(element::f32, Shape{1, 3});
+    EXPECT_ANY_THROW(batching.call({result}, {t}));
+    EXPECT_ANY_THROW(batching.call({result}, {t, backend->create_tensor(element::f32, Shape{})}));
+}
@@ -0,0 +1,84 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cstdint>
+#include <memory>
+#include <thread>
+
+#include <gtest/gtest.h>
+
+#include "ngraph/runtime/buffer_pool.hpp"
+#include "ngraph/runtime/host_tensor.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(buffer_pool, disabled)
+{
+    auto& pool = runtime::BufferPool::get();
+    size_t limit = pool.get_retained_limit();
+    pool.set_retained_limit(0);
+
+    auto before = pool.get_counters();
+    void* ptr = pool.allocate(1000);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(ptr) % 16, 0);
+    pool.deallocate(ptr);
+    auto after = pool.get_counters();
+    EXPECT_EQ(after.allocations, before.allocations + 1);
+    EXPECT_EQ(after.hits, before.hits);
+    EXPECT_EQ(after.recycled, before.recycled);
+    EXPECT_EQ(after.retained_bytes, 0);
+
+    pool.set_retained_limit(limit);
+}
+
+TEST(buffer_pool, recycle)
+{
+    auto& pool = runtime::BufferPool::get();
+    size_t limit = pool.get_retained_limit();
+    pool.set_retained_limit(1 << 20);
+    pool.trim();
+
+    auto before = pool.get_counters();
+    {
+        runtime::HostTensor a(element::f32, Shape{100, 10});
+    }
+    EXPECT_EQ(pool.get_counters().recycled, before.recycled + 1);
+    EXPECT_GE(pool.get_counters().retained_bytes, 4000);
+    {
+        // Lands in the same size class
+        runtime::HostTensor b(element::f32, Shape{1000});
+        EXPECT_EQ(pool.get_counters().hits, before.hits + 1);
+        EXPECT_EQ(pool.get_counters().retained_bytes, 0);
+    }
+
+    // Blocks over the limit are freed
+    void* large = pool.allocate(2 << 20);
+    pool.deallocate(large);
+    EXPECT_LT(pool.get_counters().retained_bytes, 1 << 20);
+
+    // A block freed on another thread is reused once that thread exits
+    thread([&pool]() { pool.deallocate(pool.allocate(3000)); }).join();
+    size_t hits = pool.get_counters().hits;
+    void* ptr = pool.allocate(3000);
+    EXPECT_EQ(pool.get_counters().hits, hits + 1);
+    pool.deallocate(ptr);
+
+    pool.set_retained_limit(0);
+    EXPECT_EQ(pool.get_counters().retained_bytes, 0);
+    pool.set_retained_limit(limit);
+}
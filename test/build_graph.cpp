@@ -131,3 +131,95 @@ TEST(build_graph, function_undeclared_parameters)
         FAIL() << "Function construction failed for unexpected reason";
     }
 }
+
+TEST(build_graph, defer_validation)
+{
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    shared_ptr<Node> add;
+    shared_ptr<Function> f;
+    {
+        DeferValidation defer;
+        EXPECT_TRUE(DeferValidation::is_active());
+        add = make_shared<op::Add>(arg0, arg1);
+        EXPECT_TRUE(add->get_output_partial_shape(0).rank().is_dynamic());
+        f = make_shared<Function>(make_shared<op::Abs>(add), ParameterVector{arg0, arg1});
+    }
+    EXPECT_FALSE(DeferValidation::is_active());
+    EXPECT_EQ(add->get_element_type(), element::f32);
+    EXPECT_EQ(add->get_shape(), (Shape{2, 3}));
+    EXPECT_EQ(f->get_output_shape(0), (Shape{2, 3}));
+
+    // Errors surface in the sweep
+    auto arg2 = make_shared<op::Parameter>(element::f32, Shape{4});
+    DeferValidation defer;
+    auto bad = make_shared<op::Add>(arg0, arg2);
+    EXPECT_THROW(make_shared<Function>(bad, ParameterVector{arg0, arg2}), NodeValidationFailure);
+}
+
+TEST(build_graph, revalidate_skips_unchanged_inputs)
+{
+    auto arg0 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto arg1 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto add = make_shared<op::Add>(arg0, arg1);
+
+    // Inputs unchanged since the constructor validated, so the stale type is kept
+    add->set_output_type(0, element::f32, PartialShape::dynamic());
+    add->revalidate_and_infer_types();
+    EXPECT_TRUE(add->get_output_partial_shape(0).rank().is_dynamic());
+
+    // A new source, even of the same type, is revalidated
+    auto arg2 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    add->input(1).replace_source_output(arg2);
+    add->revalidate_and_infer_types();
+    EXPECT_EQ(add->get_shape(), (Shape{2, 3}));
+
+    auto arg3 = make_shared<op::Parameter>(element::f32, Shape{5});
+    auto arg4 = make_shared<op::Parameter>(element::f32, Shape{5});
+    add->input(0).replace_source_output(arg3);
+    add->input(1).replace_source_output(arg4);
+    add->revalidate_and_infer_types();
+    EXPECT_EQ(add->get_shape(), (Shape{5}));
+}
+
+TEST(build_graph, adjoints_balanced_sum)
+{
+    // x receives four contributions: one from each of the outer Adds and two from the inner one
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto y = ((x + x) + x) + x;
+    auto c = make_shared<op::Parameter>(element::f32, Shape{2});
+    autodiff::Adjoints adjoints(NodeVector{y}, NodeVector{c});
+
+    auto dx = adjoints.backprop_node(x);
+    ASSERT_TRUE(dynamic_pointer_cast<op::Add>(dx));
+    for (auto& arg : dx->get_arguments())
+    {
+        ASSERT_TRUE(dynamic_pointer_cast<op::Add>(arg));
+        EXPECT_EQ(arg->get_argument(0), c);
+        EXPECT_EQ(arg->get_argument(1), c);
+    }
+}
+
+TEST(build_graph, adjoints_elide_zeros)
+{
+    auto input = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto gamma = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto beta = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto bn = make_shared<op::BatchNormTraining>(input, gamma, beta, 0.001);
+    auto d0 = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto d1 = make_shared<op::Parameter>(element::f32, Shape{3});
+
+    autodiff::Adjoints adjoints;
+    adjoints.add_delta(bn, d0, 0);
+    adjoints.add_delta(bn, d1, 1);
+    auto deltas = adjoints.get(bn);
+    ASSERT_EQ(deltas.size(), 3);
+    EXPECT_EQ(deltas.at(0), d0);
+    EXPECT_EQ(deltas.at(1), d1);
+    EXPECT_FALSE(dynamic_pointer_cast<op::Add>(deltas.at(2)));
+
+    // the zero adjoint of the unused output is not added to anything
+    adjoints.add_delta(beta, deltas.at(2));
+    adjoints.add_delta(beta, d1);
+    EXPECT_EQ(adjoints.backprop_node(beta), d1);
+}
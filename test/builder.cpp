@@ -157,3 +157,36 @@ TEST(builder, tensor_mask)
 
     EXPECT_EQ(expected, read_vector<char>(result));
 }
+
+TEST(builder, update_loss_scale)
+{
+    auto scale = make_shared<op::Parameter>(element::f32, Shape{});
+    auto steps = make_shared<op::Parameter>(element::f32, Shape{});
+    auto finite = make_shared<op::Parameter>(element::boolean, Shape{});
+    auto f = make_shared<Function>(builder::update_loss_scale(scale, steps, finite, 2.0, 0.5, 2),
+                                   ParameterVector{scale, steps, finite});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto scale_data = backend->create_tensor(element::f32, Shape{});
+    auto steps_data = backend->create_tensor(element::f32, Shape{});
+    auto finite_data = backend->create_tensor(element::boolean, Shape{});
+    auto new_scale = backend->create_tensor(element::f32, Shape{});
+    auto new_steps = backend->create_tensor(element::f32, Shape{});
+    auto handle = backend->compile(f);
+
+    // every step feeds the new scale and count back in
+    vector<char> finite_steps{1, 1, 0, 1};
+    vector<float> expected_scales{8, 16, 8, 8};
+    vector<float> expected_steps{1, 0, 0, 1};
+    copy_data(scale_data, vector<float>{8});
+    copy_data(steps_data, vector<float>{0});
+    for (size_t i = 0; i < finite_steps.size(); i++)
+    {
+        copy_data(finite_data, vector<char>{finite_steps[i]});
+        handle->call_with_validate({new_scale, new_steps}, {scale_data, steps_data, finite_data});
+        EXPECT_EQ(read_vector<float>(new_scale), vector<float>{expected_scales[i]});
+        EXPECT_EQ(read_vector<float>(new_steps), vector<float>{expected_steps[i]});
+        copy_data(scale_data, read_vector<float>(new_scale));
+        copy_data(steps_data, read_vector<float>(new_steps));
+    }
+}
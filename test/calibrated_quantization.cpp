@@ -0,0 +1,167 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+#include <sstream>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/experimental/quantized_conv_relu.hpp"
+#include "ngraph/pass/calibrated_quantization.hpp"
+#include "ngraph/runtime/calibrator.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static vector<vector<shared_ptr<runtime::Tensor>>>
+    make_batches(const shared_ptr<runtime::Backend>& backend,
+                 const Shape& shape,
+                 const vector<vector<float>>& values)
+{
+    vector<vector<shared_ptr<runtime::Tensor>>> batches;
+    for (auto& batch_values : values)
+    {
+        auto tensor = backend->create_tensor(element::f32, shape);
+        copy_data(tensor, batch_values);
+        batches.push_back({tensor});
+    }
+    return batches;
+}
+
+TEST(calibration, min_max)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = A * op::Constant::create(element::f32, shape, {2, 2, 2, 2});
+    auto f = make_shared<Function>(B, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::Calibrator calibrator(backend, f);
+    auto table =
+        calibrator.calibrate(make_batches(backend, shape, {{-1, 0, 1, 2}, {3, -4, 0, 0}}));
+
+    ASSERT_EQ(table.count(A->get_name()), 1);
+    ASSERT_EQ(table.count(B->get_name()), 1);
+    EXPECT_EQ(table[A->get_name()].min, vector<float>{-4});
+    EXPECT_EQ(table[A->get_name()].max, vector<float>{3});
+    EXPECT_EQ(table[B->get_name()].min, vector<float>{-8});
+    EXPECT_EQ(table[B->get_name()].max, vector<float>{6});
+    EXPECT_GT(table[B->get_name()].sqnr_db, 30);
+}
+
+TEST(calibration, per_channel_min_max)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::Calibrator calibrator(backend, f, runtime::CalibrationMode::PER_CHANNEL_MIN_MAX);
+    auto table = calibrator.calibrate(make_batches(backend, shape, {{1, 2, 3, 4, -5, 6}}));
+
+    EXPECT_EQ(table[A->get_name()].min, (vector<float>{1, -5, 3}));
+    EXPECT_EQ(table[A->get_name()].max, (vector<float>{4, 2, 6}));
+}
+
+TEST(calibration, kl_divergence_clips_outliers)
+{
+    Shape shape{1000};
+    vector<float> values(shape_size(shape));
+    for (size_t i = 0; i < values.size(); i++)
+    {
+        values[i] = static_cast<float>(i % 100) / 100;
+    }
+    values[0] = 100;
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Negative>(A), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::Calibrator min_max(backend, f);
+    runtime::Calibrator kl(backend, f, runtime::CalibrationMode::KL_DIVERGENCE);
+    auto min_max_table = min_max.calibrate(make_batches(backend, shape, {values}));
+    auto kl_table = kl.calibrate(make_batches(backend, shape, {values}));
+
+    auto& min_max_range = min_max_table[A->get_name()];
+    auto& kl_range = kl_table[A->get_name()];
+    EXPECT_EQ(min_max_range.max, vector<float>{100});
+    EXPECT_LT(kl_range.max[0], 10);
+    EXPECT_GE(kl_range.max[0], 0.99f);
+}
+
+static shared_ptr<Function> make_conv_relu(shared_ptr<op::Parameter>& data)
+{
+    Shape shape{1, 1, 3, 3};
+    data = make_shared<op::Parameter>(element::f32, shape);
+    auto filters = op::Constant::create(element::f32, Shape{1, 1, 2, 2}, {1.0f, -1.0f, 0.5f, 2.0f});
+    auto conv = make_shared<op::Convolution>(data, filters);
+    return make_shared<Function>(make_shared<op::Relu>(conv), ParameterVector{data});
+}
+
+TEST(calibrated_quantization, convolution_relu)
+{
+    shared_ptr<op::Parameter> data;
+    auto f = make_conv_relu(data);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::Calibrator calibrator(backend, f);
+    auto table = calibrator.calibrate(
+        make_batches(backend, data->get_shape(), {{1, 2, 3, 4, 5, 6, 7, 8, 9}}));
+
+    pass::CalibratedQuantization quantization(table);
+    EXPECT_TRUE(quantization.run_on_function(f));
+    EXPECT_EQ(count_ops_of_type<op::Convolution>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Relu>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedConvolutionRelu>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Dequantize>(f), 1);
+    EXPECT_EQ(f->get_output_element_type(0), element::f32);
+
+    ASSERT_EQ(quantization.get_report().size(), 1);
+    EXPECT_TRUE(quantization.get_report()[0].quantized);
+    stringstream report;
+    quantization.print_report(report);
+    EXPECT_NE(report.str().find("quantized"), string::npos);
+}
+
+TEST(calibrated_quantization, sensitive_layers_stay_f32)
+{
+    shared_ptr<op::Parameter> data;
+    auto f = make_conv_relu(data);
+
+    auto backend = runtime::Backend::create("INTERPRETER");
+    runtime::Calibrator calibrator(backend, f);
+    auto table = calibrator.calibrate(
+        make_batches(backend, data->get_shape(), {{1, 2, 3, 4, 5, 6, 7, 8, 9}}));
+
+    pass::CalibratedQuantization quantization(table, 1000.0f);
+    EXPECT_FALSE(quantization.run_on_function(f));
+    EXPECT_EQ(count_ops_of_type<op::Convolution>(f), 1);
+    ASSERT_EQ(quantization.get_report().size(), 1);
+    EXPECT_FALSE(quantization.get_report()[0].quantized);
+    EXPECT_EQ(quantization.get_report()[0].reason, "noise ratio below threshold");
+}
+
+TEST(calibrated_quantization, dot_needs_constant_weights)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto f = make_shared<Function>(make_shared<op::Dot>(A, B), ParameterVector{A, B});
+
+    pass::CalibratedQuantization quantization(runtime::CalibrationTable{});
+    EXPECT_FALSE(quantization.run_on_function(f));
+    ASSERT_EQ(quantization.get_report().size(), 1);
+    EXPECT_EQ(quantization.get_report()[0].reason, "weights are not constant");
+}
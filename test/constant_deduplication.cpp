@@ -0,0 +1,87 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_deduplication.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(constant_deduplication, merge_equal)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto C1 = op::Constant::create(element::f32, shape, {1, 2, 3, 4, 5, 6});
+    auto C2 = op::Constant::create(element::f32, shape, {1, 2, 3, 4, 5, 6});
+    auto C3 = op::Constant::create(element::f32, shape, {1, 2, 3, 4, 5, 6});
+    auto f = make_shared<Function>(NodeVector{A + C1, A * C2, C3}, ParameterVector{A});
+
+    size_t saved_bytes = 0;
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantDeduplication>(saved_bytes);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1);
+    EXPECT_EQ(saved_bytes, 2 * shape_size(shape) * sizeof(float));
+    auto constant = f->get_results().at(2)->get_argument(0);
+    EXPECT_EQ(f->get_results().at(0)->get_argument(0)->get_argument(1), constant);
+    EXPECT_EQ(f->get_results().at(1)->get_argument(0)->get_argument(1), constant);
+}
+
+TEST(constant_deduplication, keep_different)
+{
+    auto A = make_shared<op::Parameter>(element::i32, Shape{4});
+    auto C1 = op::Constant::create(element::i32, Shape{4}, {1, 2, 3, 4});
+    // Same values, other value, element type or shape
+    auto C2 = op::Constant::create(element::i32, Shape{4}, {1, 2, 3, 5});
+    auto C3 = op::Constant::create(element::u32, Shape{4}, {1, 2, 3, 4});
+    auto C4 = op::Constant::create(element::i32, Shape{2, 2}, {1, 2, 3, 4});
+    auto f = make_shared<Function>(NodeVector{A + C1, A - C2, C3, C4}, ParameterVector{A});
+
+    size_t saved_bytes = 1;
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantDeduplication>(saved_bytes);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Constant>(f), 4);
+    EXPECT_EQ(saved_bytes, 0);
+}
+
+TEST(constant_deduplication, large_constants)
+{
+    // Larger than one hashing chunk, differing only in the last element
+    Shape shape{1 << 19};
+    vector<float> values(shape_size(shape), 0.5f);
+    auto C1 = op::Constant::create(element::f32, shape, values);
+    auto C2 = op::Constant::create(element::f32, shape, values);
+    values.back() = 1.0f;
+    auto C3 = op::Constant::create(element::f32, shape, values);
+    auto f = make_shared<Function>(NodeVector{C1 + C2, C3}, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantDeduplication>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(count_ops_of_type<op::Constant>(f), 2);
+    auto sum = f->get_results().at(0)->get_argument(0);
+    EXPECT_EQ(sum->get_argument(0), sum->get_argument(1));
+}
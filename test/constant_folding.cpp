@@ -17,6 +17,8 @@
 #include "ngraph/pass/constant_folding.hpp"
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/op/experimental/layers/prior_box.hpp"
+#include "ngraph/op/experimental/layers/prior_box_clustered.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_tools.hpp"
@@ -260,3 +262,162 @@ TEST(constant_folding, const_quantize)
     vector<output_c_type> values_quantize{2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5};
     ASSERT_EQ(values_quantize, values_out);
 }
+
+TEST(constant_folding, shape_of)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 4, 1});
+    auto shape_of = make_shared<op::ShapeOf>(param);
+    auto dyn_reshape = make_shared<op::DynReshape>(param, shape_of);
+    auto f = make_shared<Function>(dyn_reshape, ParameterVector{param});
+
+    // The function is dynamic (DynReshape has a dynamic output shape), but ShapeOf folding
+    // should still be applied.
+    ASSERT_TRUE(f->is_dynamic());
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::ShapeOf>(f), 0);
+    auto new_const = dynamic_pointer_cast<op::Constant>(dyn_reshape->get_argument(1));
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_vector<int64_t>(), (vector<int64_t>{2, 4, 1}));
+}
+
+TEST(constant_folding, constant_values_view)
+{
+    auto constant = op::Constant::create(element::i32, Shape{2, 2}, {1, -2, 3, -4});
+    auto values = constant->get_values<int32_t>();
+    EXPECT_EQ(values.size(), 4u);
+    EXPECT_EQ(values.data(), constant->get_data_ptr<int32_t>());
+    EXPECT_EQ(values[1], -2);
+    EXPECT_EQ(vector<int32_t>(values.begin(), values.end()), (vector<int32_t>{1, -2, 3, -4}));
+    EXPECT_EQ(constant->convert_value_to_string(3), "-4");
+    EXPECT_EQ(constant->get_value_strings(), (vector<string>{"1", "-2", "3", "-4"}));
+    EXPECT_THROW(constant->get_values<int64_t>(), ngraph_error);
+
+    // Folded results are written into the new Constant's buffer directly
+    auto neg = make_shared<op::Negative>(constant);
+    auto f = make_shared<Function>(neg, ParameterVector{});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    auto new_const =
+        std::dynamic_pointer_cast<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    EXPECT_EQ(new_const->get_vector<int32_t>(), (vector<int32_t>{-1, 2, -3, 4}));
+}
+
+TEST(constant_folding, large_constant_binary_quantize)
+{
+    // Large enough to be folded in several chunks
+    size_t size = 300001;
+    vector<float> values_a(size);
+    vector<float> values_b(size);
+    for (size_t i = 0; i < size; i++)
+    {
+        values_a[i] = static_cast<float>(i % 100);
+        values_b[i] = 1.0f;
+    }
+    auto a = make_shared<op::Constant>(element::f32, Shape{size}, values_a);
+    auto b = make_shared<op::Constant>(element::f32, Shape{size}, values_b);
+    auto add = make_shared<op::Add>(a, b);
+    auto scale = op::Constant::create(element::f32, Shape{}, {2});
+    auto offset = op::Constant::create(element::u8, Shape{}, {1});
+    auto quantize = make_shared<op::Quantize>(
+        add, scale, offset, element::u8, AxisSet{}, op::Quantize::RoundMode::ROUND_NEAREST_UPWARD);
+    auto f = make_shared<Function>(quantize, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Add>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Quantize>(f), 0);
+    auto new_const =
+        std::dynamic_pointer_cast<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    auto values_out = new_const->get_vector<uint8_t>();
+    ASSERT_EQ(values_out.size(), size);
+    for (size_t i = 0; i < size; i++)
+    {
+        // round((i % 100 + 1) / 2) + 1, halves rounded up
+        ASSERT_EQ(values_out[i], (i % 100 + 2) / 2 + 1);
+    }
+}
+
+TEST(constant_folding, prior_box)
+{
+    auto layer_shape = op::Constant::create<int64_t>(element::i64, Shape{2}, {1, 1});
+    auto image_shape = op::Constant::create<int64_t>(element::i64, Shape{2}, {10, 10});
+    auto prior_box = make_shared<op::PriorBox>(layer_shape,
+                                               image_shape,
+                                               vector<float>{2.0f},
+                                               vector<float>{},
+                                               vector<float>{2.0f},
+                                               false,
+                                               false,
+                                               0.0f,
+                                               0.5f,
+                                               vector<float>{0.1f, 0.1f, 0.2f, 0.2f},
+                                               true);
+    auto f = make_shared<Function>(prior_box, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::PriorBox>(f), 0);
+    auto new_const = dynamic_pointer_cast<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    ASSERT_EQ(new_const->get_shape(), (Shape{2, 8}));
+    // a square of the min size, then a box of aspect ratio 2
+    float half_width = sqrt(2.0f) / 10;
+    float half_height = sqrt(2.0f) / 20;
+    vector<float> expected{0.4f,
+                           0.4f,
+                           0.6f,
+                           0.6f,
+                           0.5f - half_width,
+                           0.5f - half_height,
+                           0.5f + half_width,
+                           0.5f + half_height,
+                           0.1f,
+                           0.1f,
+                           0.2f,
+                           0.2f,
+                           0.1f,
+                           0.1f,
+                           0.2f,
+                           0.2f};
+    EXPECT_TRUE(test::all_close_f(new_const->get_vector<float>(), expected));
+}
+
+TEST(constant_folding, prior_box_clustered)
+{
+    auto layer_shape = op::Constant::create<int64_t>(element::i64, Shape{2}, {1, 2});
+    auto image_shape = op::Constant::create<int64_t>(element::i64, Shape{2}, {4, 8});
+    auto prior_box = make_shared<op::PriorBoxClustered>(layer_shape,
+                                                        image_shape,
+                                                        1,
+                                                        vector<float>{2.0f},
+                                                        vector<float>{4.0f},
+                                                        false,
+                                                        0.0f,
+                                                        0.0f,
+                                                        0.5f,
+                                                        vector<float>{0.1f});
+    auto f = make_shared<Function>(prior_box, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::PriorBoxClustered>(f), 0);
+    auto new_const = dynamic_pointer_cast<op::Constant>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(new_const);
+    vector<float> expected{0.125f, 0.0f, 0.375f, 1.0f, 0.625f, 0.0f, 0.875f, 1.0f};
+    expected.resize(16, 0.1f);
+    EXPECT_TRUE(test::all_close_f(new_const->get_vector<float>(), expected));
+}
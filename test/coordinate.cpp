@@ -335,3 +335,53 @@ TEST(benchmark, coordinate)
     timer.stop();
     cout << "time: " << timer.get_milliseconds() << endl;
 }
+
+TEST(coordinate, source_indices_match_index)
+{
+    vector<CoordinateTransform> transforms{
+        CoordinateTransform({3, 4, 5}),
+        CoordinateTransform({3, 4, 5}, {1, 0, 2}, {3, 4, 5}),
+        CoordinateTransform({3, 4, 5}, {0, 1, 0}, {3, 4, 5}, {2, 2, 3}),
+        CoordinateTransform({3, 4, 5}, {0, 0, 0}, {3, 4, 5}, {1, 1, 1}, {2, 0, 1}),
+        CoordinateTransform({3, 1, 5}, {0, 0, 1}, {2, 1, 5}, {1, 1, 2}, {1, 2, 0}),
+        CoordinateTransform({3, 0, 5})};
+    for (auto& ct : transforms)
+    {
+        vector<size_t> expected;
+        for (const Coordinate& c : ct)
+        {
+            expected.push_back(ct.index(c));
+        }
+        vector<size_t> indices;
+        for (size_t index : ct.source_indices())
+        {
+            indices.push_back(index);
+        }
+        EXPECT_EQ(expected, indices);
+    }
+}
+
+TEST(coordinate, source_indices_reject_padding)
+{
+    CoordinateTransform ct({2, 2}, {0, 0}, {2, 2}, {1, 1}, {0, 1}, {1, 0}, {0, 0});
+    EXPECT_THROW(ct.source_indices(), std::domain_error);
+}
+
+TEST(coordinate, strided_index_range_projection)
+{
+    Shape shape{2, 3, 4};
+    AxisSet axes{1};
+    CoordinateTransform reduced(reduce(shape, axes));
+    vector<size_t> expected;
+    for (const Coordinate& c : CoordinateTransform(shape))
+    {
+        expected.push_back(reduced.index(reduce(c, axes)));
+    }
+    vector<size_t> indices;
+    for (size_t index : StridedIndexRange::projection(shape, axes))
+    {
+        indices.push_back(index);
+    }
+    EXPECT_EQ(expected, indices);
+    EXPECT_EQ(StridedIndexRange::projection(shape, axes).size(), 24);
+}
@@ -15,6 +15,7 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <iostream>
 #include <list>
@@ -31,7 +32,9 @@
 #include "ngraph/op/reshape.hpp"
 #include "ngraph/op/softmax.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
+#include "ngraph/pass/batch_norm_folding.hpp"
 #include "ngraph/pass/core_fusion.hpp"
+#include "ngraph/pass/fused_op_decomposition.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pattern/matcher.hpp"
@@ -525,3 +528,191 @@ TEST(batch_fusion, group_convolution_fusion)
         std::dynamic_pointer_cast<op::GroupConvolution>(f->get_results().at(0)->get_argument(0));
     ASSERT_TRUE(gc);
 }
+
+TEST(core_fusion, batch_norm_folding_constants)
+{
+    auto gen_f = []() {
+        test::Uniform<float> rng(0.0f, 1.0f);
+        auto constant = [&rng](const Shape& shape) {
+            vector<float> values(shape_size(shape));
+            rng.initialize(values);
+            return op::Constant::create(element::f32, shape, values);
+        };
+        auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 5, 5});
+        auto conv = make_shared<op::Convolution>(data, constant(Shape{4, 3, 2, 2}));
+        auto bn = make_shared<op::BatchNormInference>(0.001,
+                                                      constant(Shape{4}),
+                                                      constant(Shape{4}),
+                                                      conv,
+                                                      constant(Shape{4}),
+                                                      constant(Shape{4}));
+        return make_shared<Function>(bn, ParameterVector{data});
+    };
+
+    auto baseline_f = gen_f();
+    auto folded_f = clone_function(*baseline_f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BatchNormFolding>();
+    pass_manager.run_passes(folded_f);
+    ASSERT_EQ(count_ops_of_type<op::BatchNormInference>(folded_f), 0);
+    // the new filters and bias are computed at compile time
+    ASSERT_EQ(count_ops_of_type<op::Multiply>(folded_f), 0);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args{vector<float>(shape_size(Shape{2, 3, 5, 5}))};
+    rng.initialize(args.at(0));
+    auto baseline_r = execute(baseline_f, args, "INTERPRETER");
+    auto folded_r = execute(folded_f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(baseline_r.at(0), folded_r.at(0), 1.0e-4f, 1.0e-5f));
+}
+
+TEST(core_fusion, batch_norm_folding_conv_bias_parameters)
+{
+    auto gen_f = []() {
+        ParameterVector params;
+        auto param = [&params](const Shape& shape) {
+            params.push_back(make_shared<op::Parameter>(element::f32, shape));
+            return params.back();
+        };
+        // a 1D convolution plus a per-channel bias
+        auto data = param(Shape{2, 3, 7});
+        auto conv = make_shared<op::Convolution>(data, param(Shape{4, 3, 3}));
+        auto bias = make_shared<op::Broadcast>(param(Shape{4}), conv->get_shape(), AxisSet{0, 2});
+        auto gamma = param(Shape{4});
+        auto beta = param(Shape{4});
+        auto mean = param(Shape{4});
+        auto variance = param(Shape{4});
+        auto bn = make_shared<op::BatchNormInference>(
+            0.001, gamma, beta, make_shared<op::Add>(conv, bias), mean, variance);
+        return make_shared<Function>(bn, params);
+    };
+
+    auto baseline_f = gen_f();
+    auto folded_f = gen_f();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BatchNormFolding>();
+    pass_manager.run_passes(folded_f);
+    ASSERT_EQ(count_ops_of_type<op::BatchNormInference>(folded_f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Convolution>(folded_f), 1);
+
+    test::Uniform<float> rng(0.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : baseline_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto baseline_r = execute(baseline_f, args, "INTERPRETER");
+    auto folded_r = execute(folded_f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(baseline_r.at(0), folded_r.at(0), 1.0e-4f, 1.0e-5f));
+}
+
+TEST(core_fusion, batch_norm_folding_skips_shared_convolution)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{1, 2, 4, 4});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{2, 2, 1, 1});
+    auto conv = make_shared<op::Convolution>(data, filters);
+    auto c = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto bn = make_shared<op::BatchNormInference>(0.001, c, c, conv, c, c);
+    auto f = make_shared<Function>(NodeVector{bn, conv}, ParameterVector{data, filters, c});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::BatchNormFolding>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::BatchNormInference>(f), 1);
+}
+
+TEST(core_fusion, layer_norm_fusion)
+{
+    auto gen_f = []() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{3, 2, 5});
+        auto gamma = make_shared<op::Parameter>(element::f32, Shape{2, 5});
+        auto beta = make_shared<op::Parameter>(element::f32, Shape{2, 5});
+        auto layer_norm = make_shared<op::LayerNorm>(data, gamma, beta, 1e-5, 1);
+        return make_shared<Function>(layer_norm, ParameterVector{data, gamma, beta});
+    };
+
+    // the decomposed graph stands in for the one a framework exporter writes
+    auto baseline_f = gen_f();
+    auto fused_f = gen_f();
+    pass::Manager decompose_manager;
+    decompose_manager.register_pass<pass::FusedOpDecomposition>();
+    decompose_manager.run_passes(baseline_f);
+    decompose_manager.run_passes(fused_f);
+    ASSERT_EQ(count_ops_of_type<op::LayerNorm>(fused_f), 0);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(fused_f);
+    ASSERT_EQ(count_ops_of_type<op::LayerNorm>(fused_f), 1);
+    auto layer_norm = get_ops_of_type<op::LayerNorm>(fused_f).front();
+    EXPECT_EQ(layer_norm->get_begin_norm_axis(), 1);
+    EXPECT_NEAR(layer_norm->get_epsilon(), 1e-5, 1e-10);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : baseline_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto baseline_r = execute(baseline_f, args, "INTERPRETER");
+    auto fused_r = execute(fused_f, args, "INTERPRETER");
+    EXPECT_TRUE(test::all_close(baseline_r.at(0), fused_r.at(0), 1.0e-4f, 1.0e-5f));
+}
+
+static shared_ptr<Function> make_gelu_graph(float half_value)
+{
+    // x * 0.5 * (1 + erf(x / sqrt(2))), as written out by BERT exporters
+    Shape shape{2, 3};
+    auto x = make_shared<op::Parameter>(element::f32, shape);
+    auto constant = [&shape](float value) {
+        return make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{}, {value}), shape, AxisSet{0, 1});
+    };
+    auto cdf = constant(1.0f) + make_shared<op::Erf>(x / constant(static_cast<float>(M_SQRT2)));
+    auto gelu = x * constant(half_value) * cdf;
+    return make_shared<Function>(gelu, ParameterVector{x});
+}
+
+TEST(core_fusion, gelu_fusion)
+{
+    auto f = make_gelu_graph(0.5f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Gelu>(f), 1);
+    EXPECT_FALSE(get_ops_of_type<op::Gelu>(f).front()->get_approximate());
+    EXPECT_EQ(count_ops_of_type<op::Erf>(f), 0);
+}
+
+TEST(core_fusion, gelu_fusion_wrong_constant)
+{
+    auto f = make_gelu_graph(0.4f);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::Gelu>(f), 0);
+}
+
+TEST(core_fusion, gelu_approximate_fusion)
+{
+    // 0.5 * x * (1 + tanh(sqrt(2 / pi) * (x + 0.044715 * x^3)))
+    Shape shape{2, 3};
+    auto x = make_shared<op::Parameter>(element::f32, shape);
+    auto constant = [&shape](float value) {
+        return make_shared<op::Broadcast>(
+            op::Constant::create(element::f32, Shape{}, {value}), shape, AxisSet{0, 1});
+    };
+    auto cube = make_shared<op::Power>(x, constant(3.0f));
+    auto inner = constant(0.7978845608f) * (x + constant(0.044715f) * cube);
+    auto gelu = x * (constant(0.5f) * (constant(1.0f) + make_shared<op::Tanh>(inner)));
+    auto f = make_shared<Function>(gelu, ParameterVector{x});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::CoreFusion>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Gelu>(f), 1);
+    EXPECT_TRUE(get_ops_of_type<op::Gelu>(f).front()->get_approximate());
+}
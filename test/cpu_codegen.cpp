@@ -15,6 +15,8 @@
 //*****************************************************************************
 
 #include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "util/all_close_f.hpp"
 #include "util/ndarray.hpp"
@@ -60,3 +62,81 @@ TEST(cpu_codegen, abc)
                                   (test::NDArray<float, 2>({{50, 72}, {98, 128}})).get_vector(),
                                   MIN_FLOAT_TOLERANCE_BITS));
 }
+
+TEST(cpu_codegen, compile_cache)
+{
+    string cache_dir = file_util::tmp_filename();
+    set_environment("NGRAPH_CODEGEN_CACHE_DIR", cache_dir.c_str(), 1);
+
+    auto count_entries = [&](const string& ext) {
+        size_t count = 0;
+        file_util::iterate_files(cache_dir, [&](const string& file, bool is_dir) {
+            if (!is_dir && file_util::get_file_ext(file) == ext)
+            {
+                count++;
+            }
+        });
+        return count;
+    };
+
+    Shape shape{2, 2};
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CODEGEN", true);
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    for (size_t i = 1; i <= 2; i++)
+    {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(A * B, ParameterVector{A, B});
+        auto handle = backend->compile(f, pass_config);
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_TRUE(test::all_close_f(
+            read_vector<float>(result), vector<float>{5, 12, 21, 32}, MIN_FLOAT_TOLERANCE_BITS));
+
+        // Each generated module stores its bitcode and the object MCJIT produced from it
+        EXPECT_EQ(count_entries(".bc"), i);
+        EXPECT_EQ(count_entries(".o"), i);
+    }
+
+    unset_environment("NGRAPH_CODEGEN_CACHE_DIR");
+    file_util::remove_directory(cache_dir);
+}
+
+TEST(cpu_codegen, parallel_units)
+{
+    // Enough ops to split the generated code into one translation unit per job
+    set_environment("NGRAPH_CODEGEN_JOBS", "3", 1);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    shared_ptr<Node> sum = A;
+    for (size_t i = 0; i < 100; i++)
+    {
+        sum = make_shared<op::Add>(make_shared<op::Multiply>(sum, B), A);
+    }
+    auto f = make_shared<Function>(sum, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{0, 0.5f, 0.25f, 1});
+
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CODEGEN", true);
+    auto handle = backend->compile(f, pass_config);
+    handle->call_with_validate({result}, {a, b});
+    // a * (1 + b + ... + b^100)
+    EXPECT_TRUE(test::all_close_f(
+        read_vector<float>(result), vector<float>{1, 4, 4, 404}, MIN_FLOAT_TOLERANCE_BITS));
+
+    unset_environment("NGRAPH_CODEGEN_JOBS");
+}
@@ -33,6 +33,7 @@
 #include "ngraph/op/experimental/quantized_concat.hpp"
 #include "ngraph/op/experimental/quantized_conv.hpp"
 #include "ngraph/op/experimental/quantized_conv_bias.hpp"
+#include "ngraph/op/experimental/quantized_dot.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
 #include "ngraph/op/fused/group_conv.hpp"
 #include "ngraph/op/get_output_element.hpp"
@@ -48,6 +49,7 @@
 #include "ngraph/pass/algebraic_simplification.hpp"
 #include "ngraph/pass/batch_fusion.hpp"
 #include "ngraph/pass/core_fusion.hpp"
+#include "ngraph/pass/fused_op_decomposition.hpp"
 #include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/reshape_elimination.hpp"
@@ -799,6 +801,58 @@ TEST(cpu_fusion, batchnorm_fprop_relu)
     test_batchnorm_fprop_relu(Shape{2, 2, 2, 4, 4});
 }
 
+static shared_ptr<Function> make_batchnorm_relu_bprop_function(const Shape& input_shape)
+{
+    auto channel_shape = Shape{input_shape[1]};
+    auto input = make_shared<op::Parameter>(element::f32, input_shape);
+    auto gamma = make_shared<op::Parameter>(element::f32, channel_shape);
+    auto beta = make_shared<op::Parameter>(element::f32, channel_shape);
+    auto delta = make_shared<op::Parameter>(element::f32, input_shape);
+    auto bn = make_shared<op::BatchNormTraining>(input, gamma, beta, 0.001);
+    auto relu = make_shared<op::Relu>(make_shared<op::GetOutputElement>(bn, 0));
+
+    autodiff::Adjoints adjoints(NodeVector{relu}, NodeVector{delta});
+    return make_shared<Function>(NodeVector{adjoints.backprop_node(input),
+                                            adjoints.backprop_node(gamma),
+                                            adjoints.backprop_node(beta)},
+                                 ParameterVector{input, gamma, beta, delta});
+}
+
+TEST(cpu_fusion, batchnorm_bprop_relu_fusion)
+{
+    auto f = make_batchnorm_relu_bprop_function(Shape{2, 3, 4, 4});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::BatchNormTrainingRelu>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::BatchNormTrainingReluBackprop>(f), 1);
+    EXPECT_EQ(count_ops_of_type<op::BatchNormTrainingBackprop>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::ReluBackprop>(f), 0);
+}
+
+TEST(cpu_fusion, batchnorm_bprop_relu)
+{
+    for (auto input_shape : {Shape{1, 2, 2, 2}, Shape{2, 3, 4, 4}, Shape{2, 2, 2, 4, 4}})
+    {
+        auto cpu_f = make_batchnorm_relu_bprop_function(input_shape);
+        auto int_f = make_batchnorm_relu_bprop_function(input_shape);
+        test::Uniform<float> rng(-10.0f, 10.0f);
+        vector<vector<float>> args;
+        for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+        {
+            vector<float> tensor_val(shape_size(param->get_shape()));
+            rng.initialize(tensor_val);
+            args.push_back(tensor_val);
+        }
+        auto int_results = execute(int_f, args, "INTERPRETER");
+        auto cpu_results = execute(cpu_f, args, "CPU");
+        for (size_t i = 0; i < cpu_results.size(); i++)
+        {
+            EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-3f, 1.0e-3f));
+        }
+    }
+}
+
 TEST(cpu_fusion, fuse_conv_relu)
 {
     auto A = std::make_shared<op::Parameter>(element::f32, Shape{2, 1, 2, 2});
@@ -958,6 +1012,69 @@ TEST(cpu_fusion, conv_horizontal_fusion)
     ASSERT_EQ(cpu_cb, 1);
 }
 
+static void run_horizontal_fusion_vs_interpreter(function<shared_ptr<Function>()> make_function)
+{
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-5f, 1.0e-5f));
+    }
+    EXPECT_EQ(count_ops_of_type<op::Dot>(cpu_f) + count_ops_of_type<op::MatmulBias>(cpu_f), 1);
+}
+
+TEST(cpu_fusion, matmul_bias_horizontal_fusion)
+{
+    // query, key and value projections of the same activation
+    run_horizontal_fusion_vs_interpreter([]() {
+        auto x = make_shared<op::Parameter>(element::f32, Shape{4, 16});
+        ParameterVector params{x};
+        NodeVector projections;
+        for (size_t i = 0; i < 3; i++)
+        {
+            auto weights = make_shared<op::Parameter>(element::f32, Shape{16, 8});
+            auto bias = make_shared<op::Parameter>(element::f32, Shape{8});
+            auto dot = make_shared<op::Dot>(x, weights);
+            projections.push_back(
+                dot + make_shared<op::Broadcast>(bias, dot->get_shape(), AxisSet{0}));
+            params.push_back(weights);
+            params.push_back(bias);
+        }
+        return make_shared<Function>(projections, params);
+    });
+}
+
+TEST(cpu_fusion, dot_horizontal_fusion)
+{
+    run_horizontal_fusion_vs_interpreter([]() {
+        auto x = make_shared<op::Parameter>(element::f32, Shape{2, 3, 16});
+        auto gate = make_shared<op::Parameter>(element::f32, Shape{16, 32});
+        auto up = make_shared<op::Parameter>(element::f32, Shape{16, 32});
+        auto gated =
+            make_shared<op::Sigmoid>(make_shared<op::Dot>(x, gate)) * make_shared<op::Dot>(x, up);
+        return make_shared<Function>(gated, ParameterVector{x, gate, up});
+    });
+    // W.x products split the rows of the output
+    run_horizontal_fusion_vs_interpreter([]() {
+        auto x = make_shared<op::Parameter>(element::f32, Shape{16, 5});
+        auto w1 = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+        auto w2 = make_shared<op::Parameter>(element::f32, Shape{4, 16});
+        return make_shared<Function>(
+            NodeVector{make_shared<op::Dot>(w1, x), make_shared<op::Dot>(w2, x)},
+            ParameterVector{x, w1, w2});
+    });
+}
+
 // ConvolutionBiasAdd relies on an in-place fused MKLDNN kernel.
 // Need to ensure that it is fused only when in-place buffer allocation is feasible
 shared_ptr<Function> gen_conv_bias_add(bool param_input, bool result_output)
@@ -1292,6 +1409,55 @@ TEST(cpu_fusion, fuse_groupconv_batchnorm4)
     groupconv_batchnorm_test_val_helper(true, shape_in, shape_weights, shape_r, 1);
 }
 
+TEST(cpu_fusion, fuse_groupconv_bias_bounded_relu)
+{
+    // MobileNet block: depthwise convolution, batchnorm and ReLU6 feeding a pointwise convolution
+    auto make_function = []() {
+        auto input = make_shared<op::Parameter>(element::f32, Shape{1, 16, 6, 6});
+        auto dw_weights = make_shared<op::Parameter>(element::f32, Shape{16, 1, 3, 3});
+        auto group_conv = make_shared<op::GroupConvolution>(input,
+                                                            dw_weights,
+                                                            Strides{1, 1},
+                                                            Strides{1, 1},
+                                                            CoordinateDiff{1, 1},
+                                                            CoordinateDiff{1, 1},
+                                                            Strides{1, 1},
+                                                            16);
+        Shape shape_bn{16};
+        auto gamma = make_shared<op::Parameter>(element::f32, shape_bn);
+        auto beta = make_shared<op::Parameter>(element::f32, shape_bn);
+        auto mean = make_shared<op::Parameter>(element::f32, shape_bn);
+        auto var = make_shared<op::Parameter>(element::f32, shape_bn);
+        auto bn = make_shared<op::BatchNormInference>(group_conv, gamma, beta, mean, var, 0.001);
+        auto relu = make_shared<op::Relu>(bn);
+        auto six = op::Constant::create<float>(element::f32, Shape{1, 16, 6, 6}, {6.0f});
+        auto relu6 = make_shared<op::Minimum>(relu, six);
+        auto pw_weights = make_shared<op::Parameter>(element::f32, Shape{8, 16, 1, 1});
+        auto pw_conv = make_shared<op::Convolution>(relu6, pw_weights);
+        return make_shared<Function>(
+            NodeVector{pw_conv},
+            ParameterVector{input, dw_weights, gamma, beta, mean, var, pw_weights});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    test::Uniform<float> rng(0.1f, 2.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+
+    EXPECT_EQ(count_ops_of_type<op::GroupConvolutionBias>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Minimum>(cpu_f), 0);
+    EXPECT_EQ(count_ops_of_type<op::BoundedRelu>(cpu_f), 0);
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
 std::vector<shared_ptr<runtime::Tensor>> rnn_matrix_fusion_eval(const size_t time_steps,
                                                                 const Shape& data_shape,
                                                                 const Shape& weights_shape,
@@ -2473,8 +2639,120 @@ TEST(cpu_fusion, loop_kernel_fusion_one_group)
     }
 }
 
+TEST(cpu_fusion, loop_kernel_fusion_trailing_reductions)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        Shape shape{4, 2, 8};
+        auto a = make_shared<op::Parameter>(element::f32, shape);
+        auto b = make_shared<op::Parameter>(element::f32, shape);
+        auto mul = (a + b) * b;
+        auto abs_mul = std::make_shared<op::Abs>(mul);
+        auto sum = std::make_shared<op::Sum>(abs_mul, AxisSet{1, 2});
+        auto max = std::make_shared<op::Max>(mul, AxisSet{1, 2});
+        // abs_mul is both reduced inside the kernel and a live-out of it
+        return std::make_shared<Function>(ngraph::NodeVector{sum, max, abs_mul},
+                                          ParameterVector{a, b});
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>(2);
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+    pass_manager.run_passes(cpu_f);
+    test::Uniform<float> rng(-100.0f, 100.0f);
+    vector<vector<float>> args;
+
+    ASSERT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(cpu_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(cpu_f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Max>(cpu_f), 0);
+
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
 #endif
 
+TEST(cpu_fusion, loop_kernel_fusion_outer_reduction_not_fused)
+{
+    Shape shape{4, 8};
+    auto a = make_shared<op::Parameter>(element::f32, shape);
+    auto b = make_shared<op::Parameter>(element::f32, shape);
+    auto mul = (a + b) * b;
+    auto sum = std::make_shared<op::Sum>(mul, AxisSet{0});
+    auto f = std::make_shared<Function>(ngraph::NodeVector{sum}, ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::CPULoopKernelFusion>(2);
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(f), 1);
+}
+
+TEST(cpu_fusion, loop_kernel_reduction_must_be_output)
+{
+    Shape shape{4, 8};
+    auto a = make_shared<op::Parameter>(element::f32, shape);
+    auto neg = std::make_shared<op::Negative>(a);
+    auto sum = std::make_shared<op::Sum>(neg, AxisSet{1});
+    EXPECT_TRUE(runtime::cpu::op::LoopKernel::is_trailing_reduction(*sum));
+    EXPECT_FALSE(runtime::cpu::op::LoopKernel::is_trailing_reduction(
+        *std::make_shared<op::Sum>(neg, AxisSet{0})));
+
+    EXPECT_NO_THROW(make_shared<runtime::cpu::op::LoopKernel>(
+        NodeVector{neg, sum}, NodeVector{sum}, NodeVector{a}));
+    EXPECT_THROW(make_shared<runtime::cpu::op::LoopKernel>(
+                     NodeVector{neg, sum}, NodeVector{neg}, NodeVector{a}),
+                 ngraph_error);
+}
+
+TEST(cpu_fusion, loop_kernel_program_dex)
+{
+    auto make_function = []() {
+        Shape shape{3, 300};
+        auto a = make_shared<op::Parameter>(element::f32, shape);
+        auto b = make_shared<op::Parameter>(element::f32, shape);
+        auto c = make_shared<op::Parameter>(element::f32, shape);
+        auto relu = std::make_shared<op::Relu>((a - b) * c);
+        auto neg = std::make_shared<op::Negative>(std::make_shared<op::Abs>(relu + a));
+        auto sum = std::make_shared<op::Sum>(neg, AxisSet{1});
+        auto max = std::make_shared<op::Max>(neg, AxisSet{1});
+        return make_shared<Function>(NodeVector{relu, sum, max}, ParameterVector{a, b, c});
+    };
+    auto cpu_f = make_function();
+    auto fused_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    set_environment("NGRAPH_PASS_ENABLES", "CPULoopKernelFusion:1", 1);
+    auto fused_results = execute(fused_f, args, "CPU");
+    set_environment("NGRAPH_PASS_ENABLES", "CPULoopKernelFusion:0", 1);
+
+    ASSERT_EQ(count_ops_of_type<runtime::cpu::op::LoopKernel>(fused_f), 1);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), fused_results.at(i)));
+    }
+}
+
 void sigmoid_multiply_fusion_forward_compute(runtime::Backend* backend,
                                              const ParameterVector& input_params,
                                              const vector<vector<float>>& input_data,
@@ -3955,6 +4233,111 @@ TEST(cpu_fusion, fuse_lstm_cells)
     EXPECT_EQ(lstm_ops.size(), 6);
 }
 
+TEST(cpu_fusion, fuse_quantized_lstm_cell)
+{
+    const size_t batch = 2, input_size = 4, hidden_size = 3, gates = 4 * hidden_size;
+    const float x_scale = 0.5f, dot_scale = 0.25f, output_scale = 2.0f;
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<int8_t> wx_q(gates * input_size), wh_q(gates * hidden_size);
+    for (size_t i = 0; i < wx_q.size(); i++)
+    {
+        wx_q[i] = static_cast<int8_t>(static_cast<int>(i * 7) % 21 - 10);
+    }
+    for (size_t i = 0; i < wh_q.size(); i++)
+    {
+        wh_q[i] = static_cast<int8_t>(static_cast<int>(i * 5) % 17 - 8);
+    }
+
+    // f32 [ic, oc] weights computing the same projection as the int8 [oc, ic] weights
+    auto dequantized = [&](const vector<int8_t>& w_q, size_t ic) {
+        vector<float> w(w_q.size());
+        for (size_t o = 0; o < gates; o++)
+        {
+            for (size_t i = 0; i < ic; i++)
+            {
+                w[i * gates + o] = w_q[o * ic + i] * dot_scale * output_scale / x_scale;
+            }
+        }
+        return w;
+    };
+
+    auto make_function = [&](bool quantized) {
+        auto x = make_shared<op::Parameter>(element::f32, Shape{batch, input_size});
+        auto bias_x = make_shared<op::Parameter>(element::f32, Shape{gates});
+        auto bias_h = make_shared<op::Parameter>(element::f32, Shape{gates});
+        auto zero = op::Constant::create(element::f32, Shape{}, {0.0f});
+        auto h = make_shared<op::Broadcast>(zero, Shape{batch, hidden_size}, AxisSet{0, 1});
+        auto c = make_shared<op::Broadcast>(zero, Shape{batch, hidden_size}, AxisSet{0, 1});
+
+        auto projection = [&](shared_ptr<Node> input,
+                              const vector<int8_t>& w_q) -> shared_ptr<Node> {
+            size_t ic = input->get_shape()[1];
+            if (!quantized)
+            {
+                auto w =
+                    op::Constant::create(element::f32, Shape{ic, gates}, dequantized(w_q, ic));
+                return make_shared<op::Dot>(input, w);
+            }
+            auto q = make_shared<op::Quantize>(
+                input,
+                op::Constant::create(element::f32, Shape{}, {x_scale}),
+                op::Constant::create(element::i8, Shape{}, {0}),
+                element::i8,
+                AxisSet{},
+                op::Quantize::RoundMode::ROUND_NEAREST_TOWARD_EVEN);
+            auto w = op::Constant::create(element::i8, Shape{gates, ic}, w_q);
+            auto qdot = make_shared<op::QuantizedDot>(
+                q, w, op::Constant::create(element::f32, Shape{}, {dot_scale}), false, false);
+            return make_shared<op::Dequantize>(
+                qdot,
+                op::Constant::create(element::f32, Shape{}, {output_scale}),
+                op::Constant::create(element::i32, Shape{}, {0}),
+                element::f32,
+                AxisSet{});
+        };
+        auto bias = [&](shared_ptr<Node> b) {
+            return make_shared<op::Broadcast>(b, Shape{batch, gates}, AxisSet{0});
+        };
+
+        auto X = make_shared<op::Add>(make_shared<op::Add>(projection(h, wh_q), bias(bias_h)),
+                                      make_shared<op::Add>(projection(x, wx_q), bias(bias_x)));
+        auto gate = [&](size_t index) {
+            return make_shared<op::Slice>(X,
+                                          Coordinate{0, index * hidden_size},
+                                          Coordinate{batch, (index + 1) * hidden_size});
+        };
+        auto it = make_shared<op::Sigmoid>(gate(0));
+        auto ft = make_shared<op::Sigmoid>(gate(1));
+        auto gt = make_shared<op::Tanh>(gate(2));
+        auto ot = make_shared<op::Sigmoid>(gate(3));
+        auto ct = make_shared<op::Add>(make_shared<op::Multiply>(ft, c),
+                                       make_shared<op::Multiply>(it, gt));
+        auto ht = make_shared<op::Multiply>(ot, make_shared<op::Tanh>(ct));
+        return make_shared<Function>(NodeVector{ht}, ParameterVector{x, bias_x, bias_h});
+    };
+
+    auto quantized_f = make_function(true);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::QuantizedRnnDotLowering>();
+    pass_manager.register_pass<runtime::cpu::pass::LSTMFusion>();
+    pass_manager.run_passes(quantized_f);
+    EXPECT_EQ(count_ops_of_type<op::QuantizedDot>(quantized_f), 0);
+    EXPECT_EQ(count_ops_of_type<op::Lstm>(quantized_f), 1);
+
+    auto reference_f = make_function(false);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : reference_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto quantized_results = execute(make_function(true), args, "CPU");
+    auto reference_results = execute(reference_f, args, "INTERPRETER");
+    EXPECT_TRUE(
+        test::all_close(quantized_results.at(0), reference_results.at(0), 1.0e-4f, 1.0e-4f));
+}
+
 TEST(cpu_fusion, fuse_2_layer_rnn)
 {
     pass::Manager pass_manager;
@@ -4087,3 +4470,215 @@ TEST(cpu_fusion, validate_fuse_gru_inputs)
     }
 }
 #endif
+
+// Builds a GRU from core ops following the MKL-DNN cell equations, with the gates fused in
+// the order update, reset and candidate. Returns the hidden states of the last layer.
+static std::shared_ptr<Function> make_gru_function(size_t num_timesteps, size_t num_layers)
+{
+    const size_t batch = 2;
+    const size_t feature = 8;
+    auto data =
+        std::make_shared<op::Parameter>(element::f32, Shape{num_timesteps * batch, feature});
+    ParameterVector params{data};
+
+    NodeVector inputs;
+    for (size_t t = 0; t < num_timesteps; t++)
+    {
+        inputs.push_back(std::make_shared<op::Slice>(
+            data, Coordinate{t * batch, 0}, Coordinate{(t + 1) * batch, feature}));
+    }
+
+    auto gate = [&](std::shared_ptr<Node> node, size_t index) {
+        return std::make_shared<op::Slice>(
+            node, Coordinate{0, index * feature}, Coordinate{batch, (index + 1) * feature});
+    };
+    auto one = std::make_shared<op::Broadcast>(
+        op::Constant::create(element::f32, Shape{}, {1}), Shape{batch, feature}, AxisSet{0, 1});
+
+    for (size_t layer = 0; layer < num_layers; layer++)
+    {
+        auto W = std::make_shared<op::Parameter>(element::f32, Shape{feature, 3 * feature});
+        auto bias = std::make_shared<op::Parameter>(element::f32, Shape{3 * feature});
+        auto U_ur = std::make_shared<op::Parameter>(element::f32, Shape{feature, 2 * feature});
+        auto U_o = std::make_shared<op::Parameter>(element::f32, Shape{feature, feature});
+        auto h0 = std::make_shared<op::Parameter>(element::f32, Shape{batch, feature});
+        params.insert(params.end(), {W, bias, U_ur, U_o, h0});
+
+        std::shared_ptr<Node> ht = h0;
+        NodeVector outputs;
+        for (auto xt : inputs)
+        {
+            auto x_proj = std::make_shared<op::Add>(
+                std::make_shared<op::Dot>(xt, W),
+                std::make_shared<op::Broadcast>(bias, Shape{batch, 3 * feature}, AxisSet{0}));
+            auto h_proj = std::make_shared<op::Dot>(ht, U_ur);
+            auto ut = std::make_shared<op::Sigmoid>(
+                std::make_shared<op::Add>(gate(x_proj, 0), gate(h_proj, 0)));
+            auto rt = std::make_shared<op::Sigmoid>(
+                std::make_shared<op::Add>(gate(x_proj, 1), gate(h_proj, 1)));
+            auto ot = std::make_shared<op::Tanh>(std::make_shared<op::Add>(
+                gate(x_proj, 2),
+                std::make_shared<op::Dot>(std::make_shared<op::Multiply>(rt, ht), U_o)));
+            ht = std::make_shared<op::Add>(
+                std::make_shared<op::Multiply>(ut, ht),
+                std::make_shared<op::Multiply>(std::make_shared<op::Subtract>(one, ut), ot));
+            outputs.push_back(ht);
+        }
+        inputs = outputs;
+    }
+    return make_shared<Function>(std::make_shared<op::Concat>(inputs, 0), params);
+}
+
+TEST(cpu_fusion, fuse_gru_cells)
+{
+    auto func = make_gru_function(3, 1);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::GRUFusion>();
+    pass_manager.run_passes(func);
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(func), 3);
+
+    pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
+    pass_manager.run_passes(func);
+    auto rnn_ops = get_ops_of_type<op::Rnn>(func);
+    ASSERT_EQ(rnn_ops.size(), 1);
+    EXPECT_EQ(rnn_ops[0]->get_rnn_type(), runtime::cpu::rnn_utils::rnntype::vanilla_gru);
+    EXPECT_EQ(rnn_ops[0]->get_gates_per_cell(), 3);
+    EXPECT_EQ(rnn_ops[0]->get_num_timesteps(), 3);
+    EXPECT_EQ(rnn_ops[0]->get_num_cell_states(), 1);
+}
+
+TEST(cpu_fusion, fuse_2_layer_gru)
+{
+    auto func = make_gru_function(3, 2);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::cpu::pass::GRUFusion>();
+    pass_manager.register_pass<runtime::cpu::pass::RNNFusion>();
+    pass_manager.register_pass<ngraph::pass::AlgebraicSimplification>();
+    pass_manager.register_pass<runtime::cpu::pass::MultiLayerRNNFusion>();
+    pass_manager.run_passes(func);
+    auto rnn_ops = get_ops_of_type<op::Rnn>(func);
+    ASSERT_EQ(rnn_ops.size(), 1);
+    EXPECT_EQ(rnn_ops[0]->get_num_fused_layers(), 2);
+    EXPECT_EQ(rnn_ops[0]->get_num_timesteps(), 3);
+    EXPECT_EQ(rnn_ops[0]->get_rnn_type(), runtime::cpu::rnn_utils::rnntype::vanilla_gru);
+}
+
+TEST(cpu_fusion, gru_interpreter_vs_cpu)
+{
+    auto int_f = make_gru_function(4, 2);
+    auto cpu_f = make_gru_function(4, 2);
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+
+    EXPECT_EQ(count_ops_of_type<op::Rnn>(cpu_f), 1);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+static std::shared_ptr<Function> make_attention_function(size_t kv_len, bool masked)
+{
+    const size_t batch = 6;
+    const size_t q_len = 5;
+    const size_t depth = 16;
+    auto Q = std::make_shared<op::Parameter>(element::f32, Shape{batch, q_len, depth});
+    auto K = std::make_shared<op::Parameter>(element::f32, Shape{batch, kv_len, depth});
+    auto V = std::make_shared<op::Parameter>(element::f32, Shape{batch, kv_len, 8});
+    ParameterVector params{Q, K, V};
+
+    std::shared_ptr<Node> scores = std::make_shared<op::BatchMatMul>(
+        Q, std::make_shared<op::Reshape>(K, AxisVector{0, 2, 1}, Shape{batch, depth, kv_len}));
+    auto scale = op::Constant::create(element::f32, Shape{}, {4});
+    scores = std::make_shared<op::Divide>(
+        scores, std::make_shared<op::Broadcast>(scale, scores->get_shape(), AxisSet{0, 1, 2}));
+    if (masked)
+    {
+        auto M = std::make_shared<op::Parameter>(element::f32, Shape{batch, q_len, kv_len});
+        params.push_back(M);
+        scores = std::make_shared<op::Add>(scores, M);
+    }
+    auto probabilities = std::make_shared<op::Softmax>(scores, AxisSet{2});
+    return make_shared<Function>(std::make_shared<op::BatchMatMul>(probabilities, V), params);
+}
+
+TEST(cpu_fusion, fuse_scaled_dot_product_attention)
+{
+    for (bool masked : {false, true})
+    {
+        auto func = make_attention_function(12, masked);
+        pass::Manager pass_manager;
+        pass_manager.register_pass<runtime::cpu::pass::CPUFusion>();
+        pass_manager.run_passes(func);
+        auto attention_ops = get_ops_of_type<op::ScaledDotProductAttention>(func);
+        ASSERT_EQ(attention_ops.size(), 1);
+        EXPECT_EQ(attention_ops[0]->has_mask(), masked);
+        EXPECT_FLOAT_EQ(attention_ops[0]->get_scale(), 0.25);
+        EXPECT_EQ(count_ops_of_type<op::Softmax>(func), 0);
+        EXPECT_EQ(count_ops_of_type<op::Reshape>(func), 0);
+    }
+}
+
+TEST(cpu_fusion, scaled_dot_product_attention_interpreter_vs_cpu)
+{
+    // more keys than one block of the online softmax
+    auto int_f = make_attention_function(150, true);
+    auto cpu_f = make_attention_function(150, true);
+    test::Uniform<float> rng(-2.0f, 2.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+
+    EXPECT_EQ(count_ops_of_type<op::ScaledDotProductAttention>(cpu_f), 1);
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(cpu_fusion, layer_norm_gelu_interpreter_vs_cpu)
+{
+    auto make_function = []() {
+        auto data = make_shared<op::Parameter>(element::f32, Shape{4, 3, 64});
+        auto gamma = make_shared<op::Parameter>(element::f32, Shape{64});
+        auto beta = make_shared<op::Parameter>(element::f32, Shape{64});
+        auto layer_norm = make_shared<op::LayerNorm>(data, gamma, beta, 1e-5, 2);
+        auto gelu = make_shared<op::Gelu>(layer_norm);
+        auto f = make_shared<Function>(gelu, ParameterVector{data, gamma, beta});
+        // CoreFusion has to find the ops again in the exported form
+        pass::Manager pass_manager;
+        pass_manager.register_pass<pass::FusedOpDecomposition>();
+        pass_manager.run_passes(f);
+        return f;
+    };
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    test::Uniform<float> rng(-2.0f, 2.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : int_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+
+    EXPECT_EQ(count_ops_of_type<op::LayerNorm>(cpu_f), 1);
+    EXPECT_EQ(count_ops_of_type<op::Gelu>(cpu_f), 1);
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-4f, 1.0e-4f));
+}
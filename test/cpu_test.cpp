@@ -15,10 +15,15 @@
 //*****************************************************************************
 
 #include <algorithm>
+#include <atomic>
 #include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <list>
+#include <map>
 #include <memory>
+#include <numeric>
+#include <sstream>
 #include <thread>
 
 #include "gtest/gtest.h"
@@ -27,17 +32,35 @@
 #include "ngraph/file_util.hpp"
 #include "ngraph/graph_util.hpp"
 #include "ngraph/log.hpp"
+#include "ngraph/metrics.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/batch_norm.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
 #include "ngraph/op/erf.hpp"
+#include "ngraph/op/experimental/layers/detection_output.hpp"
+#include "ngraph/op/experimental/layers/proposal.hpp"
 #include "ngraph/op/fused/conv_fused.hpp"
+#include "ngraph/op/gather.hpp"
+#include "ngraph/op/gather_nd.hpp"
 #include "ngraph/op/get_output_element.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/op/topk.hpp"
 #include "ngraph/pass/constant_folding.hpp"
 #include "ngraph/pass/manager.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/runtime/cpu/cpu_backend.hpp"
 #include "ngraph/runtime/cpu/cpu_builder.hpp"
+#include "ngraph/runtime/cpu/cpu_dex_scheduler.hpp"
+#include "ngraph/runtime/cpu/cpu_executor.hpp"
+#include "ngraph/runtime/cpu/cpu_hw_counters.hpp"
+#include "ngraph/runtime/cpu/cpu_latency_histogram.hpp"
+#include "ngraph/runtime/cpu/cpu_layout_descriptor.hpp"
+#include "ngraph/runtime/cpu/cpu_tensor_view.hpp"
+#include "ngraph/runtime/cpu/cpu_tracing.hpp"
+#include "ngraph/runtime/cpu/kernel/embedding_lookup.hpp"
+#include "ngraph/runtime/cpu/kernel/reduce_deterministic.hpp"
+#include "ngraph/runtime/cpu/mkldnn_conv_tuner.hpp"
+#include "ngraph/runtime/cpu/mkldnn_primitive_cache.hpp"
 #include "ngraph/runtime/cpu/mkldnn_utils.hpp"
 #include "ngraph/runtime/cpu/op/convert_layout.hpp"
 #include "ngraph/serializer.hpp"
@@ -512,6 +535,48 @@ TEST(cpu_test, reshape_layout_optimizations7)
     EXPECT_EQ(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f), 0);
 }
 
+TEST(cpu_test, convert_layout_conversion_fusion)
+{
+    // Convert and Dequantize feeding a convolution. Their layout conversions should be
+    // folded into them
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::u8, Shape{1, 16, 8, 8});
+        auto W = make_shared<op::Parameter>(element::i8, Shape{16, 16, 3, 3});
+        auto convert = make_shared<op::Convert>(A, element::f32);
+        auto scale = op::Constant::create(element::f32, Shape{}, {0.5f});
+        auto offset = op::Constant::create(element::i8, Shape{}, {0});
+        auto dequantize = make_shared<op::Dequantize>(W, scale, offset, element::f32, AxisSet{});
+        auto conv = make_shared<op::Convolution>(convert, dequantize, Strides{1, 1});
+        return make_shared<Function>(NodeVector{conv}, ParameterVector{A, W});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    vector<uint8_t> a(1 * 16 * 8 * 8);
+    for (size_t i = 0; i < a.size(); i++)
+    {
+        a[i] = static_cast<uint8_t>((i * 37) % 251);
+    }
+    vector<int8_t> w(16 * 16 * 3 * 3);
+    for (size_t i = 0; i < w.size(); i++)
+    {
+        w[i] = static_cast<int8_t>(static_cast<int>((i * 13) % 255) - 127);
+    }
+    auto int_results = execute<uint8_t, int8_t, float>(int_f, {a}, {w}, "INTERPRETER");
+    auto cpu_results = execute<uint8_t, int8_t, float>(cpu_f, {a}, {w}, "CPU");
+    EXPECT_TRUE(test::all_close_f(cpu_results.at(0), int_results.at(0)));
+
+    for (auto& node : cpu_f->get_ordered_ops())
+    {
+        if (dynamic_pointer_cast<runtime::cpu::op::ConvertLayout>(node))
+        {
+            EXPECT_FALSE(dynamic_pointer_cast<op::Convert>(node->get_argument(0)));
+            EXPECT_FALSE(dynamic_pointer_cast<op::Dequantize>(node->get_argument(0)));
+        }
+    }
+}
+
 TEST(cpu_test, DISABLED_collapse_dims1)
 {
     // Expand multiple dimensions. Ensure no extra conversions downstream
@@ -653,6 +718,66 @@ TEST(cpu_test, mkldnn_layouts_eltwise)
     compare_backends(int_f, cpu_f, "INTERPRETER", "CPU");
 }
 
+TEST(cpu_test, mkldnn_layouts_eltwise_selection)
+{
+    // The add feeds a convolution, so the bias is converted to the blocked layout of conv1
+    // instead of converting conv1 to the native layout and back again for conv2
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 4, 4});
+        auto B1 = make_shared<op::Parameter>(element::f32, Shape{32, 16, 1, 1});
+        auto bias = make_shared<op::Parameter>(element::f32, Shape{1, 32, 4, 4});
+        auto conv1 = make_shared<op::Convolution>(A, B1, Strides{1, 1}, Strides{1, 1});
+        auto add = make_shared<op::Add>(bias, conv1);
+        auto B2 = make_shared<op::Parameter>(element::f32, Shape{16, 32, 1, 1});
+        auto conv2 = make_shared<op::Convolution>(add, B2, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(NodeVector{conv2}, ParameterVector{A, B1, bias, B2});
+    };
+
+    auto int_f = make_function();
+    auto cpu_f = make_function();
+    compare_backends(int_f, cpu_f, "INTERPRETER", "CPU");
+    // Inputs and weights of both convolutions, the bias and the result
+    EXPECT_LE(count_ops_of_type<runtime::cpu::op::ConvertLayout>(cpu_f), 5);
+}
+
+TEST(cpu_test, mkldnn_conv_tuner_persists)
+{
+    string path =
+        file_util::path_join(file_util::get_temp_directory_path(), "ngraph_cpu_conv_algos.txt");
+    remove(path.c_str());
+
+    // a 3x3 stride 1 convolution, which has a Winograd implementation on AVX512 hosts
+    auto f32 = mkldnn::memory::data_type::f32;
+    auto any = mkldnn::memory::format::any;
+    mkldnn::memory::desc data_desc({1, 16, 14, 14}, f32, any);
+    mkldnn::memory::desc weights_desc({16, 16, 3, 3}, f32, any);
+    mkldnn::memory::desc bias_desc({16}, f32, any);
+    mkldnn::memory::desc result_desc({1, 16, 14, 14}, f32, any);
+    auto select = [&](runtime::cpu::MKLDNNConvolutionTuner& tuner) {
+        return tuner.select(
+            data_desc, weights_desc, &bias_desc, result_desc, {1, 1}, {0, 0}, {1, 1}, {1, 1});
+    };
+
+    mkldnn::algorithm algorithm;
+    {
+        runtime::cpu::MKLDNNConvolutionTuner tuner(true, path);
+        ASSERT_TRUE(tuner.is_enabled());
+        algorithm = select(tuner);
+        EXPECT_TRUE(algorithm == mkldnn::algorithm::convolution_direct ||
+                    algorithm == mkldnn::algorithm::convolution_winograd);
+    }
+
+    // a new tuner, as in a later process, reads the decision back from the file
+    ifstream in(path);
+    string key;
+    int stored;
+    ASSERT_TRUE(static_cast<bool>(in >> key >> stored));
+    EXPECT_EQ(stored, static_cast<int>(algorithm));
+    runtime::cpu::MKLDNNConvolutionTuner tuner(true, path);
+    EXPECT_EQ(select(tuner), algorithm);
+    remove(path.c_str());
+}
+
 TEST(cpu_test, convolution_large_padding)
 {
     Shape input_shape{1, 1, 100, 100};
@@ -785,6 +910,118 @@ TEST(cpu_test, memory_reuse_destructive_oi_relu)
     EXPECT_TRUE(test::all_close_f(read_vector<float>(result), expected));
 }
 
+TEST(cpu_test, memory_reuse_optimal_planning)
+{
+    // Intermediates of different sizes and lifetimes, including destructive in-place ops
+    Shape shape{2, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto wide = make_shared<op::Concat>(NodeVector{A + B, A * B}, 1);
+    auto relu = make_shared<op::Relu>(wide);
+    auto narrow = make_shared<op::Slice>(relu, Coordinate{0, 2}, Coordinate{2, 6});
+    auto f = make_shared<Function>((narrow - A) * (A + B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, -2, 3, -4, 5, -6, 7, -8});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{2, 3, -1, 5, 0, 1, -2, 2});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    ngraph::pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("CPUMemoryAssignment::ReuseMemory", true);
+    pass_config.set_pass_attribute("OptimalMemoryPlanning", true);
+    shared_ptr<runtime::Executable> handle = backend->compile(f, pass_config);
+    ASSERT_NE(handle, nullptr);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result),
+                                  vector<float>{3, 3, -2, 4, 0, -30, -35, -48}));
+}
+
+TEST(cpu_test, memory_statistics)
+{
+    Shape shape{2, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, Shape{2, 8}, vector<float>(16, 2));
+    // The concat and relu are computed in place
+    auto wide = make_shared<op::Relu>(make_shared<op::Concat>(NodeVector{A + B, A * B}, 1));
+    auto f = make_shared<Function>(wide * C, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+
+    auto stats = handle->get_memory_statistics(3);
+    EXPECT_GT(stats.temporary_bytes, 0);
+    EXPECT_EQ(stats.constant_bytes, 16 * sizeof(float));
+    EXPECT_GE(stats.in_place_bytes, 2 * shape_size(shape) * sizeof(float));
+    ASSERT_EQ(stats.largest_tensors.size(), 3);
+    for (size_t i = 0; i < stats.largest_tensors.size(); i++)
+    {
+        auto& info = stats.largest_tensors[i];
+        EXPECT_EQ(info.size, 16 * sizeof(float));
+        EXPECT_LE(info.first_use, info.last_use);
+        if (info.temporary)
+        {
+            EXPECT_LT(info.pool_offset, stats.temporary_bytes);
+        }
+    }
+    EXPECT_GT(handle->get_memory_statistics(100).largest_tensors.size(), 3);
+}
+
+TEST(cpu_test, shared_workspace)
+{
+    Shape shape{2, 4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>((A + B) * (A - B), ParameterVector{A, B});
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto g = make_shared<Function>(make_shared<op::Relu>(C * C - C), ParameterVector{C});
+
+    auto backend = runtime::Backend::create("CPU");
+    static_pointer_cast<runtime::cpu::CPU_Backend>(backend)->set_shared_workspace(true);
+    auto handle_f = backend->compile(f);
+    auto handle_g = backend->compile(g);
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 1, 1, 1, 2, 2, 2, 2});
+    for (float scale : {1.0f, 2.0f})
+    {
+        copy_data(a, vector<float>{scale, 2, 3, 4, 5, 6, 7, 8});
+        handle_f->call_with_validate({result}, {a, b});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result),
+                                      vector<float>{scale * scale - 1, 3, 8, 15, 21, 32, 45, 60}));
+        // Temporaries are not cached between calls, so the other executable may reuse them
+        handle_g->call_with_validate({result}, {b});
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result),
+                                      vector<float>{0, 0, 0, 0, 2, 2, 2, 2}));
+    }
+}
+
+TEST(cpu_test, result_copies)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, vector<float>{1, 2, 3, 4});
+    auto sum = A + B;
+    auto f = make_shared<Function>(NodeVector{sum, A, C, sum}, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    auto& copies = handle->get_result_copies();
+    ASSERT_EQ(copies.size(), 4);
+    EXPECT_EQ(copies[1], "value of a parameter");
+    EXPECT_EQ(copies[2], "value of a constant");
+    // Only one of the results sharing a value can be computed in place
+    auto& bound = copies[0].empty() ? copies[0] : copies[3];
+    auto& copied = copies[0].empty() ? copies[3] : copies[0];
+    EXPECT_EQ(bound, "");
+    EXPECT_EQ(copied, "buffer already bound to another output");
+}
+
 TEST(cpu_test, memory_reuse_cacheable_no_destructive_oi_relu)
 {
     auto shape_a = Shape{2, 5};
@@ -878,6 +1115,36 @@ TEST(cpu_test, memory_reuse_in_place_slice_after_in_place_concat)
     EXPECT_TRUE(test::all_close_f((vector<float>{3, 7}), read_vector<float>(result)));
 }
 
+TEST(cpu_test, memory_reuse_in_place_concat_after_in_place_relu)
+{
+    Shape shape{1, 2, 2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    // the MKLDNN Relus may overwrite their arguments, they write into the concat buffer instead
+    auto relu1 = make_shared<op::Relu>(make_shared<op::Add>(A, B));
+    auto relu2 = make_shared<op::Relu>(make_shared<op::Subtract>(A, C));
+    auto concat = make_shared<op::Concat>(NodeVector{relu1, relu2}, 1);
+    auto f = make_shared<Function>(concat, ParameterVector{A, B, C});
+
+    auto backend = runtime::Backend::create("CPU");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, -2, 3, -4, 5, -6, 7, -8});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{1, 1, 1, 1, -6, -6, -6, -6});
+    auto c = backend->create_tensor(element::f32, shape);
+    copy_data(c, vector<float>{2, 2, 2, 2, 2, 2, 2, 2});
+    auto result = backend->create_tensor(element::f32, Shape{1, 4, 2, 2});
+
+    shared_ptr<runtime::Executable> handle = backend->compile(f);
+    ASSERT_NE(handle, nullptr);
+    handle->call_with_validate({result}, {a, b, c});
+    EXPECT_TRUE(
+        test::all_close_f((vector<float>{2, 0, 4, 0, 0, 0, 1, 0, 0, 0, 1, 0, 3, 0, 5, 0}),
+                          read_vector<float>(result)));
+}
+
 TEST(cpu_test, memory_reuse_in_place_slice_after_in_place_reshape_from_constant)
 {
     Shape shape_a{2, 1, 2, 2};
@@ -923,6 +1190,29 @@ TEST(cpu_test, convert_inplace)
     EXPECT_EQ((vector<int8_t>{1, 2, 3, -2}), read_vector<int8_t>(result));
 }
 
+TEST(cpu_test, bf16_data_movement_and_convert)
+{
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto to_bf16 = make_shared<op::Convert>(A, element::bf16);
+    auto transpose = make_shared<op::Reshape>(to_bf16, AxisVector{1, 0}, Shape{3, 2});
+    auto slice = make_shared<op::Slice>(transpose, Coordinate{1, 0}, Coordinate{3, 2});
+    auto f = make_shared<Function>(make_shared<op::Convert>(slice, element::f32),
+                                   ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+
+    // Create some tensors for input/output
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1.0f, 2.5f, -3.0f, 4.0f, 0.5f, 1.00390625f});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a});
+    // 1.00390625 is halfway between two bf16 values and rounds to the even one
+    EXPECT_EQ((vector<float>{2.5f, 0.5f, -3.0f, 1.0f}), read_vector<float>(result));
+}
+
 TEST(cpu_test, rotated_pooling)
 {
     auto make_f = [&](bool is_4d, bool avgpool) {
@@ -1048,6 +1338,296 @@ TEST(cpu_test, thread_safe_calls_convolution_2d_2items)
     unset_environment("NGRAPH_CPU_CONCURRENCY");
 }
 
+TEST(cpu_test, thread_safe_calls_context_pool)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto function = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(function);
+    auto cpu_handle = static_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    cpu_handle->set_concurrency(3);
+    cpu_handle->set_context_affinity(true);
+    EXPECT_EQ(cpu_handle->get_call_frame()->get_concurrency(), 3);
+
+    auto make_calls = [&](float offset) {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        for (size_t i = 0; i < 10; i++)
+        {
+            copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+            copy_data(b, vector<float>(6, offset + i));
+            handle->call_with_validate({result}, {a, b});
+            vector<float> expected{1, 2, 3, 4, 5, 6};
+            for (auto& x : expected)
+            {
+                x += offset + i;
+            }
+            EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+        }
+    };
+
+    vector<std::thread> threads;
+    for (size_t i = 0; i < 5; i++)
+    {
+        threads.emplace_back(make_calls, 100.0f * i);
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+TEST(cpu_test, thread_safe_calls_cacheable_inputs)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape, true);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto function =
+        make_shared<Function>(make_shared<op::Multiply>(A, A) + B, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(function);
+    static_pointer_cast<runtime::cpu::CPU_Executable>(handle)->set_concurrency(2);
+
+    // Each thread owns a different cacheable input and changes it every few calls, so a
+    // context must never reuse intermediates computed from another thread's input.
+    auto make_calls = [&](float weight) {
+        auto a = backend->create_tensor(element::f32, shape);
+        auto b = backend->create_tensor(element::f32, shape);
+        auto result = backend->create_tensor(element::f32, shape);
+        copy_data(b, vector<float>{1, 2, 3, 4});
+        for (size_t i = 0; i < 12; i++)
+        {
+            float w = weight + i / 4;
+            if (i % 4 == 0)
+            {
+                copy_data(a, vector<float>(4, w));
+                a->set_stale(true);
+            }
+            handle->call_with_validate({result}, {a, b});
+            a->set_stale(false);
+            EXPECT_TRUE(test::all_close_f(
+                (vector<float>{w * w + 1, w * w + 2, w * w + 3, w * w + 4}),
+                read_vector<float>(result)));
+        }
+    };
+
+    std::thread call1(make_calls, 1.0f);
+    std::thread call2(make_calls, 10.0f);
+    std::thread call3(make_calls, 100.0f);
+    call1.join();
+    call2.join();
+    call3.join();
+}
+
+TEST(cpu_test, executor_numa_nodes)
+{
+    auto& executor = runtime::cpu::executor::GetCPUExecutor();
+    int num_nodes = executor.get_num_numa_nodes();
+    ASSERT_GE(num_nodes, 1);
+    // Every node has at least one thread pool
+    EXPECT_GE(executor.get_num_thread_pools(), num_nodes);
+    vector<int> pools_per_node(num_nodes, 0);
+    for (int i = 0; i < executor.get_num_thread_pools(); i++)
+    {
+        int node = executor.get_numa_node(i);
+        ASSERT_GE(node, 0);
+        ASSERT_LT(node, num_nodes);
+        pools_per_node[node]++;
+    }
+    for (auto count : pools_per_node)
+    {
+        EXPECT_GT(count, 0);
+    }
+
+    bool ran = false;
+    executor.run_on_node(0, [&ran]() { ran = true; });
+    EXPECT_TRUE(ran);
+    EXPECT_THROW(executor.run_on_node(0, []() { throw ngraph_error("node error"); }),
+                 ngraph_error);
+}
+
+TEST(cpu_test, executor_threading_config)
+{
+    auto& executor = runtime::cpu::executor::GetCPUExecutor();
+    auto config = runtime::cpu::executor::get_threading_config();
+    EXPECT_GE(config.intra_op_threads, 1);
+    EXPECT_GE(config.eigen_threads, 1);
+    EXPECT_LE(config.eigen_threads, config.intra_op_threads);
+    EXPECT_LE(config.inter_op_pools, executor.get_num_thread_pools());
+    EXPECT_LT(config.reserved_pools, config.inter_op_pools);
+    // OpenMP, and so MKL-DNN, runs on the same number of threads as each pool
+    ASSERT_NE(std::getenv("OMP_NUM_THREADS"), nullptr);
+    EXPECT_EQ(std::atoi(std::getenv("OMP_NUM_THREADS")), config.intra_op_threads);
+    // The pools exist, so the config can no longer change
+    EXPECT_THROW(runtime::cpu::executor::set_threading_config(config), ngraph_error);
+}
+
+TEST(cpu_test, executor_serial_kernels)
+{
+    auto& executor = runtime::cpu::executor::GetCPUExecutor();
+    int pool_threads = executor.get_device(0).numThreads();
+    int serial_threads = 0;
+    int parallel_threads = 0;
+    runtime::cpu::CPUKernelFunctor serial_kernel =
+        [&](runtime::cpu::CPURuntimeContext* ctx, runtime::cpu::CPUExecutionContext* ectx) {
+            serial_threads = executor.get_device(ectx->arena).numThreads();
+        };
+    runtime::cpu::CPUKernelFunctor parallel_kernel =
+        [&](runtime::cpu::CPURuntimeContext* ctx, runtime::cpu::CPUExecutionContext* ectx) {
+            parallel_threads = executor.get_device(ectx->arena).numThreads();
+        };
+    runtime::cpu::CPUExecutionContext serial_ectx{0, true};
+    runtime::cpu::CPUExecutionContext parallel_ectx{0, false};
+    executor.execute(serial_kernel, nullptr, &serial_ectx);
+    executor.execute(parallel_kernel, nullptr, &parallel_ectx);
+    EXPECT_EQ(serial_threads, 1);
+    EXPECT_EQ(parallel_threads, pool_threads);
+    // The serial device is only in effect while the serial kernel runs
+    EXPECT_EQ(executor.get_device(0).numThreads(), pool_threads);
+}
+
+TEST(cpu_test, executor_call_priorities)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    using runtime::cpu::CallPriority;
+    auto& executor = runtime::cpu::executor::GetCPUExecutor();
+    int num_shared_pools = executor.get_num_thread_pools() - executor.get_num_reserved_pools();
+    for (size_t ctx_id = 0; ctx_id < 4; ctx_id++)
+    {
+        EXPECT_LT(executor.get_thread_pool(CallPriority::Low, ctx_id), num_shared_pools);
+        if (executor.get_num_reserved_pools() > 0)
+        {
+            EXPECT_GE(executor.get_thread_pool(CallPriority::High, ctx_id), num_shared_pools);
+        }
+    }
+
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto function = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(function);
+    static_pointer_cast<runtime::cpu::CPU_Executable>(handle)->set_priority(CallPriority::Low);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(b, vector<float>(6, 10));
+
+    // A low priority call waits at its first op while a higher priority call runs
+    executor.begin_call(CallPriority::Normal);
+    auto done = handle->begin_call({result}, {a, b});
+    EXPECT_EQ(done.wait_for(std::chrono::milliseconds(100)), std::future_status::timeout);
+    executor.end_call(CallPriority::Normal);
+    ASSERT_TRUE(done.get());
+    EXPECT_TRUE(test::all_close_f((vector<float>{11, 12, 13, 14, 15, 16}),
+                                  read_vector<float>(result)));
+}
+
+TEST(cpu_test, dex_scheduler)
+{
+    // Two independent towers joined at the end
+    runtime::cpu::DEXScheduler scheduler;
+    size_t num_ops = 21;
+    scheduler.set_num_ops(num_ops);
+    for (size_t i = 1; i < 10; i++)
+    {
+        scheduler.add_dependency(i - 1, i);
+        scheduler.add_dependency(i + 9, i + 10);
+    }
+    scheduler.add_dependency(9, 20);
+    scheduler.add_dependency(19, 20);
+    scheduler.set_cost(0, 100);
+    scheduler.finalize();
+
+    vector<atomic<bool>> done(num_ops);
+    for (auto& d : done)
+    {
+        d = false;
+    }
+    atomic<bool> in_order{true};
+    atomic<size_t> count{0};
+    scheduler.run(3, [&](size_t i) {
+        bool ready = (i == 0 || i == 10) || (i == 20 ? done[9] && done[19] : done[i - 1].load());
+        if (!ready)
+        {
+            in_order = false;
+        }
+        done[i] = true;
+        count++;
+    });
+    EXPECT_TRUE(in_order);
+    EXPECT_EQ(count, num_ops);
+
+    EXPECT_THROW(scheduler.run(3,
+                               [](size_t i) {
+                                   if (i == 5)
+                                   {
+                                       throw ngraph_error("op failed");
+                                   }
+                               }),
+                 ngraph_error);
+}
+
+TEST(cpu_test, save_load_executable)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Relu>(A - B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    auto b = backend->create_tensor(element::f32, shape);
+    copy_data(b, vector<float>{2, 1, 5, 1});
+    auto result = backend->create_tensor(element::f32, shape);
+
+    // Without the attribute the source graph is not kept
+    auto unsaveable = backend->compile(clone_function(*f));
+    stringstream unused;
+    EXPECT_THROW(unsaveable->save(unused), ngraph_error);
+
+    pass::PassConfig pass_config;
+    pass_config.set_pass_attribute(runtime::cpu::CPU_Executable::SAVEABLE_ATTRIBUTE, true);
+    auto handle = backend->compile(f, pass_config);
+    stringstream saved;
+    handle->save(saved);
+
+    auto loaded = runtime::Backend::create("CPU")->load(saved);
+    ASSERT_NE(loaded, nullptr);
+    EXPECT_TRUE(loaded->call_with_validate({result}, {a, b}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{0, 1, 0, 3}), read_vector<float>(result)));
+
+    stringstream garbage("not an executable");
+    EXPECT_THROW(backend->load(garbage), ngraph_error);
+}
+
 TEST(cpu_test, constant_reshape)
 {
     Shape shape_in{2, 4};
@@ -1288,47 +1868,479 @@ TEST(cpu_test, conv_negative_padding)
     compare_backends(make_f(), make_f(), "CPU", "INTERPRETER");
 }
 
-TEST(cpu_test, gauss_error_function_erf_float32)
+TEST(cpu_test, mkldnn_primitive_cache_shares_conv_descriptors)
 {
-    auto make_function = []() -> std::shared_ptr<Function> {
-        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 4, 10, 6, 10});
-        auto erf = make_shared<op::Erf>(A);
-        return make_shared<Function>(erf, ParameterVector{A});
+    auto make_f = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 16, 8, 8});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{32, 16, 3, 3});
+        auto conv = make_shared<op::Convolution>(A, B, Strides{1, 1}, Strides{1, 1});
+        return make_shared<Function>(conv, ParameterVector{A, B});
     };
 
+    auto& cache = runtime::cpu::MKLDNNPrimitiveCache::get();
+    cache.clear();
+
     auto backend = runtime::Backend::create("CPU");
-    auto cpu_f = make_function();
-    auto int_f = make_function();
+    auto a = backend->create_tensor(element::f32, Shape{1, 16, 8, 8});
+    auto b = backend->create_tensor(element::f32, Shape{32, 16, 3, 3});
+    copy_data(a, vector<float>(shape_size(Shape{1, 16, 8, 8}), 1.0f));
+    copy_data(b, vector<float>(shape_size(Shape{32, 16, 3, 3}), 0.5f));
 
-    test::Uniform<float> rng(-100.0f, 100.0f);
-    vector<vector<float>> args;
-    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    vector<vector<float>> results;
+    for (size_t i = 0; i < 2; i++)
     {
-        vector<float> tensor_val(shape_size(param->get_shape()));
-        rng.initialize(tensor_val);
-        args.push_back(tensor_val);
+        auto result = backend->create_tensor(element::f32, Shape{1, 32, 6, 6});
+        auto handle = backend->compile(make_f());
+        handle->call_with_validate({result}, {a, b});
+        results.push_back(read_vector<float>(result));
     }
-    auto int_results = execute(int_f, args, "INTERPRETER");
-    auto cpu_results = execute(cpu_f, args, "CPU");
 
-    for (size_t i = 0; i < cpu_results.size(); i++)
-    {
-        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
-    }
+    auto stats = cache.get_stats();
+    EXPECT_GE(stats.misses, 1);
+    EXPECT_GE(stats.hits, 1);
+    EXPECT_EQ(results[0], results[1]);
+    EXPECT_EQ(results[0][0], 72.0f);
+
+    cache.set_capacity(0);
+    EXPECT_EQ(cache.get_stats().entries, 0);
+    cache.set_capacity(stats.capacity);
 }
 
-TEST(cpu_test, gauss_error_function_erf_int32)
+TEST(cpu_test, update_constants_recomputes_cached_weight_layouts)
 {
-    Shape shape{2, 2};
-    auto A = make_shared<op::Parameter>(element::i32, shape);
-    auto make_function = [&]() -> std::shared_ptr<Function> {
-        auto erf = make_shared<op::Erf>(A);
-        return make_shared<Function>(erf, ParameterVector{A});
-    };
+    Shape shape_a{1, 16, 4, 4};
+    Shape shape_w{16, 16, 3, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto W = op::Constant::create(element::f32, shape_w, vector<float>(shape_size(shape_w), 1));
+    auto conv = make_shared<op::Convolution>(
+        A, W, Strides{1, 1}, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1});
+    auto f = make_shared<Function>(conv, ParameterVector{A});
 
     auto backend = runtime::Backend::create("CPU");
-    auto cpu_f = make_function();
-
+    auto handle = backend->compile(f);
+    auto a = backend->create_tensor(element::f32, shape_a);
+    auto result = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>(shape_size(shape_a), 1));
+
+    // The first calls convert the weights to the convolution's layout and cache them
+    handle->call_with_validate({result}, {a});
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result)[5], 144);
+
+    vector<float> new_weights(shape_size(shape_w), 0.5f);
+    handle->update_constants({{W.get(), new_weights.data()}});
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result)[5], 72);
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result)[5], 72);
+}
+
+TEST(cpu_test, prepare_shares_constant_values)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    Shape shape_a{1, 16, 4, 4};
+    Shape shape_w{16, 16, 3, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto W = op::Constant::create(element::f32, shape_w, vector<float>(shape_size(shape_w), 1));
+    auto conv = make_shared<op::Convolution>(
+        A, W, Strides{1, 1}, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1});
+    auto f = make_shared<Function>(conv, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    static_pointer_cast<runtime::cpu::CPU_Executable>(handle)->set_concurrency(3);
+    // Builds the primitives of every context and converts the weights once for all of them
+    handle->prepare();
+    handle->prepare();
+
+    auto make_calls = [&](float expected) {
+        auto a = backend->create_tensor(element::f32, shape_a);
+        auto result = backend->create_tensor(element::f32, shape_a);
+        copy_data(a, vector<float>(shape_size(shape_a), 1));
+        for (size_t i = 0; i < 5; i++)
+        {
+            handle->call_with_validate({result}, {a});
+            EXPECT_EQ(read_vector<float>(result)[5], expected);
+        }
+    };
+    vector<std::thread> threads;
+    for (size_t i = 0; i < 3; i++)
+    {
+        threads.emplace_back(make_calls, 144.0f);
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+
+    // New weights are converted again for all the contexts
+    vector<float> new_weights(shape_size(shape_w), 0.5f);
+    handle->update_constants({{W.get(), new_weights.data()}});
+    threads.clear();
+    for (size_t i = 0; i < 3; i++)
+    {
+        threads.emplace_back(make_calls, 72.0f);
+    }
+    for (auto& t : threads)
+    {
+        t.join();
+    }
+}
+
+TEST(cpu_test, reclaim_idle_memory)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    Shape shape_a{1, 16, 4, 4};
+    Shape shape_w{16, 16, 3, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto W = op::Constant::create(element::f32, shape_w, vector<float>(shape_size(shape_w), 1));
+    auto conv = make_shared<op::Convolution>(
+        A, W, Strides{1, 1}, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1});
+    auto f = make_shared<Function>(make_shared<op::Relu>(conv) + A, ParameterVector{A});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f);
+    auto a = backend->create_tensor(element::f32, shape_a);
+    auto result = backend->create_tensor(element::f32, shape_a);
+    copy_data(a, vector<float>(shape_size(shape_a), 1));
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result)[5], 145);
+
+    auto resident = handle->get_memory_statistics().resident_bytes;
+    EXPECT_GT(resident, 0);
+    EXPECT_EQ(handle->reclaim_memory(), resident);
+    auto statistics = handle->get_memory_statistics();
+    EXPECT_EQ(statistics.resident_bytes, 0);
+    EXPECT_EQ(statistics.reclaimed_bytes, resident);
+
+    // The next call allocates the buffers again and recomputes the cached weights
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result)[5], 145);
+    EXPECT_EQ(handle->get_memory_statistics().resident_bytes, resident);
+
+    // Values prepare() computed from constants are only freed on request
+    handle->prepare();
+    auto prepared = handle->get_memory_statistics().resident_bytes;
+    EXPECT_GT(prepared, resident);
+    EXPECT_EQ(handle->reclaim_memory(true), resident);
+    EXPECT_EQ(handle->get_memory_statistics().resident_bytes, prepared - resident);
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result)[5], 145);
+    EXPECT_EQ(handle->reclaim_memory(false), prepared);
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result)[5], 145);
+
+    handle->set_idle_timeout(std::chrono::milliseconds(20));
+    for (size_t i = 0; i < 100 && handle->get_memory_statistics().resident_bytes != 0; i++)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(handle->get_memory_statistics().resident_bytes, 0);
+    handle->set_idle_timeout(std::chrono::milliseconds(0));
+    handle->call_with_validate({result}, {a});
+    EXPECT_EQ(read_vector<float>(result)[5], 145);
+}
+
+TEST(cpu_test, latency_histogram_percentiles)
+{
+    runtime::cpu::LatencyHistogram histogram;
+    EXPECT_EQ(histogram.get_percentile(0.5), 0);
+    for (uint64_t ns = 1; ns <= 1000; ns++)
+    {
+        histogram.record(ns);
+    }
+    EXPECT_EQ(histogram.get_count(), 1000);
+    EXPECT_EQ(histogram.get_max(), 1000);
+    // Buckets are at most 12.5% wide
+    EXPECT_GE(histogram.get_percentile(0.5), 500);
+    EXPECT_LE(histogram.get_percentile(0.5), 563);
+    EXPECT_GE(histogram.get_percentile(0.99), 990);
+    EXPECT_EQ(histogram.get_percentile(1.0), 1000);
+
+    for (uint64_t ns : {0ull, 7ull, 8ull, 1000ull, 123456789ull, 1ull << 50})
+    {
+        size_t bucket = runtime::cpu::LatencyHistogram::get_bucket(ns);
+        ASSERT_LT(bucket, runtime::cpu::LatencyHistogram::bucket_count);
+        EXPECT_LE(runtime::cpu::LatencyHistogram::get_bucket_lower_bound(bucket), ns);
+    }
+}
+
+TEST(cpu_test, latency_report)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(A + B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = static_pointer_cast<runtime::cpu::CPU_Executable>(backend->compile(f));
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    handle->set_latency_sample_period(2);
+    for (size_t i = 0; i < 10; i++)
+    {
+        a->set_stale(true);
+        handle->call_with_validate({result}, {a, b});
+    }
+    auto report = handle->get_latency_report(true);
+    EXPECT_EQ(report.call.get_count(), 5);
+    ASSERT_FALSE(report.ops.empty());
+    for (auto& op : report.ops)
+    {
+        EXPECT_FALSE(op.first.empty());
+        EXPECT_LE(op.second.get_count(), 5);
+    }
+    EXPECT_LE(report.ops.back().second.get_max(), report.call.get_max());
+
+    // The histograms were reset, and nothing is recorded once sampling stops
+    handle->set_latency_sample_period(0);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ(handle->get_latency_report().call.get_count(), 0);
+}
+
+TEST(cpu_test, hardware_counters)
+{
+    Shape shape{64, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(A + B), ParameterVector{A, B});
+
+    set_environment("NGRAPH_CPU_HW_COUNTERS", "1", 1);
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f, true);
+    unset_environment("NGRAPH_CPU_HW_COUNTERS");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>(shape_size(shape), 1));
+    copy_data(b, vector<float>(shape_size(shape), 2));
+    for (size_t i = 0; i < 4; i++)
+    {
+        a->set_stale(true);
+        handle->call_with_validate({result}, {a, b});
+    }
+
+    // perf_event is often unavailable in containers and VMs
+    bool supported = runtime::cpu::HardwareCounters::get_thread_counters() != nullptr;
+    for (auto& counter : handle->get_performance_data())
+    {
+        EXPECT_EQ(counter.has_hardware_counters(), supported);
+        if (supported && counter.call_count() > 0)
+        {
+            EXPECT_GT(counter.total_cycles(), 0);
+            EXPECT_GT(counter.total_instructions(), 0);
+        }
+    }
+}
+
+TEST(cpu_test, compile_profile_phases)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Abs>(A + B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    pass::PassConfig pass_config;
+    pass_config.set_pass_attribute(pass::PassProfile::PROFILE_ATTRIBUTE, true);
+    auto handle = backend->compile(f, pass_config);
+
+    auto profile = handle->get_compile_profile();
+    ASSERT_NE(profile, nullptr);
+    EXPECT_FALSE(profile->get_entries().empty());
+    vector<string> phases;
+    for (auto& phase : profile->get_phases())
+    {
+        phases.push_back(phase.name);
+        EXPECT_GE(phase.wall_time_us, 0);
+        EXPECT_GE(phase.peak_rss_delta_kb, 0);
+    }
+    EXPECT_EQ(phases, (vector<string>{"buffer assignment", "build kernels", "schedule"}));
+
+    // Without the attribute nothing is profiled
+    auto plain = backend->compile(clone_function(*f));
+    EXPECT_EQ(plain->get_compile_profile(), nullptr);
+}
+
+TEST(cpu_test, layout_conversions)
+{
+    Shape shape_a{1, 16, 2, 2};
+    Shape shape_b{32, 16, 1, 1};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto B = make_shared<op::Parameter>(element::f32, shape_b);
+    auto conv = make_shared<op::Convolution>(A, B);
+    auto squeeze = make_shared<op::Reshape>(conv, AxisVector{0, 1, 2, 3}, Shape{32, 2, 2});
+    auto f = make_shared<Function>(squeeze, ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto handle = backend->compile(f, true);
+    auto a = backend->create_tensor(element::f32, shape_a);
+    auto b = backend->create_tensor(element::f32, shape_b);
+    auto result = backend->create_tensor(element::f32, Shape{32, 2, 2});
+    copy_data(a, vector<float>(shape_size(shape_a), 1));
+    copy_data(b, vector<float>(shape_size(shape_b), 2));
+    handle->call_with_validate({result}, {a, b});
+
+    auto cpu_handle = static_pointer_cast<runtime::cpu::CPU_Executable>(handle);
+    auto conversions = cpu_handle->get_layout_conversions();
+    // Inputs and weights of the convolution are reordered
+    ASSERT_EQ(conversions.size(), 2);
+    map<string, runtime::cpu::LayoutConversion> by_source;
+    for (auto& conversion : conversions)
+    {
+        EXPECT_EQ(conversion.source_format, "native");
+        EXPECT_NE(conversion.destination_format, "native");
+        EXPECT_EQ(conversion.call_count, 1);
+        by_source[conversion.source] = conversion;
+    }
+    ASSERT_EQ(by_source.count(A->get_name() + ":0"), 1);
+    ASSERT_EQ(by_source.count(B->get_name() + ":0"), 1);
+    EXPECT_GE(by_source[A->get_name() + ":0"].bytes, 2 * shape_size(shape_a) * sizeof(float));
+    EXPECT_GE(by_source[B->get_name() + ":0"].bytes, 2 * shape_size(shape_b) * sizeof(float));
+
+    stringstream report;
+    runtime::cpu::print_layout_conversions(report, conversions);
+    EXPECT_NE(report.str().find("2 conversions"), string::npos);
+}
+
+TEST(cpu_test, tensor_region_blocked_layout)
+{
+    Shape shape{1, 16, 2, 2};
+    auto backend = runtime::Backend::create("CPU");
+    auto tensor = static_pointer_cast<runtime::cpu::CPUTensorView>(
+        backend->create_tensor(element::f32, shape));
+    vector<float> data(shape_size(shape));
+    iota(data.begin(), data.end(), 0);
+    copy_data(tensor, data);
+
+    descriptor::Tensor blocked(element::f32, shape, "blocked");
+    auto layout = make_shared<runtime::cpu::LayoutDescriptor>(blocked);
+    layout->set_mkldnn_md(mkldnn::memory::desc({1, 16, 2, 2},
+                                               mkldnn::memory::data_type::f32,
+                                               mkldnn::memory::format::nChw8c));
+    tensor->convert_layout(layout);
+
+    // The second block of channels, first row
+    vector<float> region(16);
+    vector<float> expected;
+    for (size_t c = 8; c < 16; c++)
+    {
+        expected.push_back(c * 4);
+        expected.push_back(c * 4 + 1);
+    }
+    tensor->read_region(region.data(), Coordinate{0, 8, 0, 0}, Coordinate{1, 16, 1, 2});
+    EXPECT_EQ(expected, region);
+
+    // Channels across a block boundary
+    region.resize(4);
+    tensor->read_region(region.data(), Coordinate{0, 7, 1, 0}, Coordinate{1, 9, 2, 2});
+    EXPECT_EQ((vector<float>{30, 31, 34, 35}), region);
+    EXPECT_EQ(tensor->get_tensor_layout(), layout);
+
+    vector<float> values{-1, -2};
+    tensor->write_region(values.data(), Coordinate{0, 15, 1, 0}, Coordinate{1, 16, 2, 2});
+    data[62] = -1;
+    data[63] = -2;
+    EXPECT_EQ(data, read_vector<float>(tensor));
+}
+
+TEST(cpu_test, timeline_recorder_rotates_files)
+{
+    auto& recorder = runtime::cpu::TimelineRecorder::get();
+    recorder.set_max_calls_per_file(2);
+    vector<runtime::cpu::OpAttributes> op_attrs{{"Add", {"t1"}, {"t0", "t0"}}};
+    size_t id = recorder.register_function("timeline_test", op_attrs, {"Add_0"});
+
+    for (size_t i = 0; i < 3; i++)
+    {
+        auto start = runtime::cpu::Clock::now();
+        // Ops recorded from another thread get their own track
+        thread worker([&]() {
+            recorder.record_op(id, 0, runtime::cpu::Clock::now(), runtime::cpu::Clock::now());
+        });
+        worker.join();
+        recorder.record_call(id, start, runtime::cpu::Clock::now());
+    }
+    recorder.flush();
+    recorder.set_max_calls_per_file(0);
+
+    auto count = [](const string& text, const string& pattern) {
+        size_t n = 0;
+        for (size_t pos = text.find(pattern); pos != string::npos;
+             pos = text.find(pattern, pos + 1))
+        {
+            n++;
+        }
+        return n;
+    };
+    string first = file_util::read_file_to_string("timeline_test.timeline.json");
+    string second = file_util::read_file_to_string("timeline_test.timeline.1.json");
+    EXPECT_EQ(count(first, "\"cat\":\"Call\""), 2);
+    EXPECT_EQ(count(first, "\"Node\":\"Add_0\""), 2);
+    EXPECT_EQ(count(second, "\"cat\":\"Call\""), 1);
+    EXPECT_EQ(recorder.get_dropped_count(), 0);
+    file_util::remove_file("timeline_test.timeline.json");
+    file_util::remove_file("timeline_test.timeline.1.json");
+}
+
+TEST(cpu_test, gauss_error_function_erf_float32)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{1, 4, 10, 6, 10});
+        auto erf = make_shared<op::Erf>(A);
+        return make_shared<Function>(erf, ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng(-100.0f, 100.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_test, gauss_error_function_erf_int32)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::i32, shape);
+    auto make_function = [&]() -> std::shared_ptr<Function> {
+        auto erf = make_shared<op::Erf>(A);
+        return make_shared<Function>(erf, ParameterVector{A});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    auto cpu_f = make_function();
+
     auto input_nd_array = test::NDArray<int, 2>({{45, 2}, {7, 9}});
     auto expected_result_nd_array =
         test::NDArray<int, 2>({{static_cast<int>(std::erf(45)), static_cast<int>(std::erf(2))},
@@ -1347,3 +2359,544 @@ TEST(cpu_test, gauss_error_function_erf_int32)
     auto expected_values = expected_result_nd_array.get_vector();
     ASSERT_EQ(result_values, expected_values);
 }
+
+TEST(cpu_test, embedding_lookup_i8_table)
+{
+    Shape indices_shape{5};
+    Shape weights_shape{4, 3};
+    auto A = make_shared<op::Parameter>(element::i64, indices_shape);
+    auto B = make_shared<op::Parameter>(element::i8, weights_shape);
+    auto f = make_shared<Function>(make_shared<op::EmbeddingLookup>(A, B), ParameterVector{A, B});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = backend->create_tensor(element::i64, indices_shape);
+    copy_data(a, vector<int64_t>{3, 0, 0, 2, 1});
+    auto b = backend->create_tensor(element::i8, weights_shape);
+    copy_data(b, vector<int8_t>{1, 2, 3, 4, 5, 6, 7, 8, 9, -1, -2, -3});
+    auto result = backend->create_tensor(element::i8, Shape{5, 3});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_EQ((vector<int8_t>{-1, -2, -3, 1, 2, 3, 1, 2, 3, 7, 8, 9, 4, 5, 6}),
+              read_vector<int8_t>(result));
+}
+
+TEST(cpu_test, embedding_bag_kernel)
+{
+    vector<float> weights{1, 2, 3, 4, 5, 6, 7, 8};
+    vector<int> indices{0, 3, 1, 1, 2, 0};
+    vector<float> sum(6);
+    vector<float> mean(6);
+
+    runtime::cpu::kernel::embedding_bag<float, int>(
+        indices.data(), weights.data(), sum.data(), 3, 2, 2, false, 0);
+    runtime::cpu::kernel::embedding_bag<float, int>(
+        indices.data(), weights.data(), mean.data(), 3, 2, 2, true, 0);
+
+    EXPECT_TRUE(test::all_close_f((vector<float>{8, 10, 6, 8, 6, 8}), sum));
+    EXPECT_TRUE(test::all_close_f((vector<float>{4, 5, 3, 4, 3, 4}), mean));
+}
+
+TEST(cpu_test, gather_int32_params_axis_1)
+{
+    Shape params_shape{2, 3, 2};
+    Shape indices_shape{2};
+    auto P = make_shared<op::Parameter>(element::i32, params_shape);
+    auto I = make_shared<op::Parameter>(element::i64, indices_shape);
+    auto f = make_shared<Function>(make_shared<op::Gather>(P, I, 1), ParameterVector{P, I});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto p = backend->create_tensor(element::i32, params_shape);
+    copy_data(p, vector<int32_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11});
+    auto i = backend->create_tensor(element::i64, indices_shape);
+    copy_data(i, vector<int64_t>{2, 0});
+    auto result = backend->create_tensor(element::i32, Shape{2, 2, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {p, i});
+    EXPECT_EQ((vector<int32_t>{4, 5, 0, 1, 10, 11, 6, 7}), read_vector<int32_t>(result));
+}
+
+TEST(cpu_test, gather_nd_int8_params)
+{
+    Shape params_shape{2, 2, 2};
+    Shape indices_shape{3, 2};
+    auto P = make_shared<op::Parameter>(element::i8, params_shape);
+    auto I = make_shared<op::Parameter>(element::i32, indices_shape);
+    auto f = make_shared<Function>(make_shared<op::GatherND>(P, I), ParameterVector{P, I});
+
+    auto backend = runtime::Backend::create("CPU");
+    auto p = backend->create_tensor(element::i8, params_shape);
+    copy_data(p, vector<int8_t>{0, 1, 2, 3, 4, 5, 6, 7});
+    auto i = backend->create_tensor(element::i32, indices_shape);
+    copy_data(i, vector<int32_t>{1, 1, 0, 0, 1, 0});
+    auto result = backend->create_tensor(element::i8, Shape{3, 2});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {p, i});
+    EXPECT_EQ((vector<int8_t>{6, 7, 0, 1, 4, 5}), read_vector<int8_t>(result));
+}
+
+TEST(cpu_test, topk_long_rows)
+{
+    // two rows holding different permutations of 0..999
+    Shape shape{2, 1000};
+    vector<float> values(shape_size(shape));
+    for (size_t i = 0; i < 1000; i++)
+    {
+        values[i] = (i * 337) % 1000;
+        values[1000 + i] = 999 - values[i];
+    }
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    for (bool compute_max : {true, false})
+    {
+        auto B = make_shared<op::TopK>(A, 1, element::i64, 4, compute_max);
+        auto f = make_shared<Function>(
+            NodeVector{make_shared<op::GetOutputElement>(B, 0),
+                       make_shared<op::GetOutputElement>(B, 1)},
+            ParameterVector{A});
+
+        auto backend = runtime::Backend::create("CPU");
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, values);
+        auto indices = backend->create_tensor(element::i64, Shape{2, 4});
+        auto result = backend->create_tensor(element::f32, Shape{2, 4});
+        auto handle = backend->compile(f);
+        handle->call_with_validate({indices, result}, {a});
+
+        vector<float> expected_values;
+        vector<int64_t> expected_indices;
+        for (size_t row = 0; row < 2; row++)
+        {
+            auto row_begin = values.begin() + row * 1000;
+            for (size_t j = 0; j < 4; j++)
+            {
+                float value = compute_max ? 999 - j : j;
+                expected_values.push_back(value);
+                auto position = find(row_begin, row_begin + 1000, value);
+                expected_indices.push_back(distance(row_begin, position));
+            }
+        }
+        EXPECT_TRUE(test::all_close_f(expected_values, read_vector<float>(result)));
+        EXPECT_EQ(expected_indices, read_vector<int64_t>(indices));
+    }
+}
+
+TEST(cpu_test, persistent_convolution_weights)
+{
+    // One step scales the weights down, the updated weights are fed back to the next step
+    auto make_function = [](bool persistent) {
+        auto X = make_shared<op::Parameter>(element::f32, Shape{2, 4, 6, 6});
+        auto W = make_shared<op::Parameter>(element::f32, Shape{8, 4, 3, 3});
+        W->set_persistent(persistent);
+        auto conv = make_shared<op::Convolution>(X, W);
+        auto scale = op::Constant::create(
+            element::f32, W->get_shape(), vector<float>(shape_size(W->get_shape()), 0.5f));
+        auto update = make_shared<op::Multiply>(W, scale);
+        return make_shared<Function>(NodeVector{conv, update}, ParameterVector{X, W});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    vector<vector<float>> results;
+    for (bool persistent : {false, true})
+    {
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        auto handle = backend->compile(make_function(persistent));
+        auto x = backend->create_tensor(element::f32, Shape{2, 4, 6, 6});
+        auto conv = backend->create_tensor(element::f32, Shape{2, 8, 4, 4});
+        auto weights = backend->create_tensor(element::f32, Shape{8, 4, 3, 3});
+        auto updated = backend->create_tensor(element::f32, Shape{8, 4, 3, 3});
+        rng.initialize(x);
+        rng.initialize(weights);
+
+        vector<float> outputs;
+        for (size_t step = 0; step < 3; step++)
+        {
+            handle->call_with_validate({conv, updated}, {x, weights});
+            auto step_conv = read_vector<float>(conv);
+            outputs.insert(outputs.end(), step_conv.begin(), step_conv.end());
+            swap(weights, updated);
+            if (step == 1)
+            {
+                // the host overwrites weights the backend may hold in a blocked layout
+                copy_data(weights, vector<float>(shape_size(weights->get_shape()), 0.25f));
+            }
+        }
+        auto final_weights = read_vector<float>(weights);
+        outputs.insert(outputs.end(), final_weights.begin(), final_weights.end());
+        results.push_back(outputs);
+    }
+    EXPECT_TRUE(test::all_close_f(results.at(0), results.at(1)));
+}
+
+TEST(cpu_test, rank_8_kernels)
+{
+    // Ranks above MAX_EIGEN_KERNEL_RANK run on the reference kernels
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 2, 2, 2});
+        // alternating broadcast axes can not be collapsed to a lower rank
+        auto broadcast = make_shared<op::Broadcast>(
+            A, Shape{2, 3, 2, 3, 2, 3, 2, 3}, AxisSet{1, 3, 5, 7});
+        auto slice = make_shared<op::Slice>(broadcast,
+                                            Coordinate{0, 1, 0, 0, 1, 0, 0, 1},
+                                            Coordinate{2, 3, 2, 2, 2, 3, 2, 3});
+        auto reshape = make_shared<op::Reshape>(
+            slice, AxisVector{7, 6, 5, 4, 3, 2, 1, 0}, Shape{2, 2, 3, 1, 2, 2, 2, 2});
+        auto sum = make_shared<op::Sum>(reshape, AxisSet{0, 3, 5});
+        return make_shared<Function>(NodeVector{reshape, sum}, ParameterVector{A});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close_f(cpu_results.at(i), int_results.at(i)));
+    }
+}
+
+TEST(cpu_test, softmax_middle_axes)
+{
+    // Softmax over axes that the Eigen kernels do not cover
+    auto make_function = []() -> std::shared_ptr<Function> {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3, 4, 5});
+        auto softmax = make_shared<op::Softmax>(A, AxisSet{1, 2});
+        return make_shared<Function>(NodeVector{softmax}, ParameterVector{A});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = make_function();
+
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    EXPECT_TRUE(test::all_close(cpu_results.at(0), int_results.at(0), 1.0e-5f, 1.0e-6f));
+}
+
+TEST(cpu_test, packed_gemm_constant_weights)
+{
+    // Constant operands of Dot and of the fused MatmulBias are packed at compile time
+    auto make_function = []() -> std::shared_ptr<Function> {
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<float> w_val(8 * 16);
+        rng.initialize(w_val);
+        vector<float> v_val(3 * 4);
+        rng.initialize(v_val);
+        vector<float> b_val(16);
+        rng.initialize(b_val);
+
+        auto x = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+        auto W = op::Constant::create(element::f32, Shape{8, 16}, w_val);
+        auto V = op::Constant::create(element::f32, Shape{3, 4}, v_val);
+        auto b = op::Constant::create(element::f32, Shape{16}, b_val);
+        auto xW = make_shared<op::Dot>(x, W);
+        auto bias = make_shared<op::Broadcast>(b, Shape{4, 16}, AxisSet{0});
+        auto Vy = make_shared<op::Dot>(V, make_shared<op::Add>(xW, bias));
+        return make_shared<Function>(NodeVector{xW, Vy}, ParameterVector{x});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = clone_function(*cpu_f);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-5f));
+    }
+}
+
+TEST(cpu_test, detection_output)
+{
+    // Two overlapping priors of class 1, the second suppressed by the first
+    auto loc = make_shared<op::Parameter>(element::f32, Shape{1, 8});
+    auto conf = make_shared<op::Parameter>(element::f32, Shape{1, 4});
+    auto priors = make_shared<op::Parameter>(element::f32, Shape{1, 2, 8});
+    auto aux_conf = make_shared<op::Parameter>(element::f32, Shape{1, 0});
+    auto aux_loc = make_shared<op::Parameter>(element::f32, Shape{1, 0});
+    op::DetectionOutputAttrs attrs;
+    attrs.num_classes = 2;
+    attrs.boxes_top_k = {2};
+    attrs.nms_threshold = 0.5f;
+    attrs.confidence_threshold = 0.1f;
+    attrs.normalized = true;
+    auto detection_output =
+        make_shared<op::DetectionOutput>(loc, conf, priors, aux_conf, aux_loc, attrs);
+    auto f = make_shared<Function>(detection_output,
+                                   ParameterVector{loc, conf, priors, aux_conf, aux_loc});
+
+    vector<vector<float>> args{
+        vector<float>(8, 0.0f),
+        {0.1f, 0.9f, 0.2f, 0.8f},
+        {0.0f, 0.0f, 0.5f, 0.5f, 0.05f, 0.05f, 0.55f, 0.55f, 0.1f, 0.1f, 0.2f, 0.2f, 0.1f, 0.1f,
+         0.2f, 0.2f},
+        {},
+        {}};
+    auto results = execute(f, args, "CPU");
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{0, 1, 0.9f, 0, 0, 0.5f, 0.5f, -1, 0, 0, 0, 0, 0, 0}), results.at(0)));
+}
+
+TEST(cpu_test, proposal)
+{
+    // One 4x4 anchor at each of two features, the more probable one first
+    auto class_probs = make_shared<op::Parameter>(element::f32, Shape{1, 2, 1, 2});
+    auto bbox_deltas = make_shared<op::Parameter>(element::f32, Shape{1, 4, 1, 2});
+    auto image_shape = op::Constant::create<int64_t>(element::i64, Shape{2}, {10, 10});
+    auto proposal = make_shared<op::Proposal>(class_probs,
+                                              bbox_deltas,
+                                              image_shape,
+                                              4,
+                                              10,
+                                              3,
+                                              0.7f,
+                                              4,
+                                              1,
+                                              vector<float>{1.0f},
+                                              vector<float>{1.0f},
+                                              false,
+                                              false,
+                                              false,
+                                              1.0f,
+                                              1.0f,
+                                              "");
+    ASSERT_EQ(proposal->get_shape(), (Shape{3, 5}));
+    auto f = make_shared<Function>(proposal, ParameterVector{class_probs, bbox_deltas});
+
+    vector<vector<float>> args{{0.3f, 0.1f, 0.7f, 0.9f}, vector<float>(8, 0.0f)};
+    auto results = execute(f, args, "CPU");
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{0, 4, 0, 7, 3, 0, 0, 0, 3, 3, -1, 0, 0, 0, 0}), results.at(0)));
+}
+
+TEST(cpu_test, sparse_gemm_constant_weights)
+{
+    // Constant operands of Dot and of the fused MatmulBias that are mostly zero only have their
+    // nonzeros multiplied
+    auto make_sparse = [](size_t count) {
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<float> values(count);
+        rng.initialize(values);
+        for (size_t i = 0; i < count; i++)
+        {
+            if (i % 10 != 3)
+            {
+                values[i] = 0.0f;
+            }
+        }
+        return values;
+    };
+    auto make_function = [&]() -> std::shared_ptr<Function> {
+        test::Uniform<float> rng(-1.0f, 1.0f);
+        vector<float> b_val(16);
+        rng.initialize(b_val);
+
+        auto x = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+        auto W = op::Constant::create(element::f32, Shape{8, 16}, make_sparse(8 * 16));
+        auto V = op::Constant::create(element::f32, Shape{3, 4}, make_sparse(3 * 4));
+        auto b = op::Constant::create(element::f32, Shape{16}, b_val);
+        auto xW = make_shared<op::Dot>(x, W);
+        auto bias = make_shared<op::Broadcast>(b, Shape{4, 16}, AxisSet{0});
+        auto Vy = make_shared<op::Dot>(V, make_shared<op::Add>(xW, bias));
+        return make_shared<Function>(NodeVector{xW, Vy}, ParameterVector{x});
+    };
+
+    auto cpu_f = make_function();
+    auto int_f = clone_function(*cpu_f);
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : cpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto cpu_results = execute(cpu_f, args, "CPU");
+    for (size_t i = 0; i < cpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(cpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-5f));
+    }
+}
+
+TEST(cpu_test, batch_polymorphic)
+{
+    // Compiled for a batch of 4 and called on batches of 4 and 2
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> w_val(8 * 16);
+    rng.initialize(w_val);
+    vector<float> b_val(16);
+    rng.initialize(b_val);
+    auto make_function = [&](size_t batch) -> std::shared_ptr<Function> {
+        auto x = make_shared<op::Parameter>(element::f32, Shape{batch, 8});
+        auto W = op::Constant::create(element::f32, Shape{8, 16}, w_val);
+        auto b = op::Constant::create(element::f32, Shape{16}, b_val);
+        auto bias = make_shared<op::Broadcast>(b, Shape{batch, 16}, AxisSet{0});
+        auto y = make_shared<op::Tanh>(make_shared<op::Dot>(x, W) + bias);
+        return make_shared<Function>(NodeVector{y, y * y}, ParameterVector{x});
+    };
+
+    auto backend = runtime::Backend::create("CPU");
+    pass::PassConfig pass_config;
+    pass_config.set_pass_attribute(runtime::cpu::CPU_Executable::BATCH_POLYMORPHIC_ATTRIBUTE,
+                                   true);
+    auto handle = backend->compile(make_function(4), pass_config);
+
+    for (size_t batch : {4, 2, 4})
+    {
+        vector<float> x_val(batch * 8);
+        rng.initialize(x_val);
+        auto expected =
+            execute(make_function(batch), vector<vector<float>>{x_val}, "INTERPRETER");
+
+        auto x = backend->create_tensor(element::f32, Shape{batch, 8});
+        copy_data(x, x_val);
+        auto y = backend->create_tensor(element::f32, Shape{batch, 16});
+        auto y2 = backend->create_tensor(element::f32, Shape{batch, 16});
+        ASSERT_TRUE(handle->call({y, y2}, {x}));
+        EXPECT_TRUE(test::all_close(read_vector<float>(y), expected.at(0), 1.0e-4f, 1.0e-5f));
+        EXPECT_TRUE(test::all_close(read_vector<float>(y2), expected.at(1), 1.0e-4f, 1.0e-5f));
+    }
+
+    // Batches larger than compiled, or different for the input and output, are rejected
+    auto x = backend->create_tensor(element::f32, Shape{2, 8});
+    auto y = backend->create_tensor(element::f32, Shape{2, 16});
+    auto y3 = backend->create_tensor(element::f32, Shape{3, 16});
+    EXPECT_THROW(handle->call({y, y3}, {x}), ngraph_error);
+    auto x5 = backend->create_tensor(element::f32, Shape{5, 8});
+    auto y5 = backend->create_tensor(element::f32, Shape{5, 16});
+    EXPECT_THROW(handle->call({y5, y5}, {x5}), ngraph_error);
+
+    // Ops whose kernels can not run on a smaller batch are rejected when compiling
+    auto p = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+    auto sum = make_shared<Function>(make_shared<op::Sum>(p, AxisSet{0}), ParameterVector{p});
+    EXPECT_THROW(backend->compile(sum, pass_config), ngraph_error);
+}
+
+TEST(cpu_test, deterministic_reductions)
+{
+    if (is_codegen_mode())
+    {
+        //TODO change to skip when there is a new release of gtest
+        NGRAPH_WARN << "This test is skipped for CODEGEN mode.";
+        return;
+    }
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    auto backend = runtime::Backend::create("CPU");
+    pass::PassConfig pass_config;
+    pass_config.set_pass_attribute(
+        runtime::cpu::CPU_Executable::DETERMINISTIC_REDUCTIONS_ATTRIBUTE, true);
+
+    // All axes, an axis with kept inner axes, and axes that are not contiguous
+    vector<pair<Shape, AxisSet>> cases{{Shape{300000}, AxisSet{0}},
+                                       {Shape{4, 20000, 3}, AxisSet{1}},
+                                       {Shape{2, 3, 4, 5}, AxisSet{1, 3}}};
+    for (auto& c : cases)
+    {
+        auto make_function = [&]() {
+            auto p = make_shared<op::Parameter>(element::f32, c.first);
+            return make_shared<Function>(make_shared<op::Sum>(p, c.second), ParameterVector{p});
+        };
+        vector<float> x_val(shape_size(c.first));
+        rng.initialize(x_val);
+        auto expected = execute(make_function(), vector<vector<float>>{x_val}, "INTERPRETER");
+
+        auto handle = backend->compile(make_function(), pass_config);
+        auto x = backend->create_tensor(element::f32, c.first);
+        copy_data(x, x_val);
+        auto y = backend->create_tensor(element::f32, reduce(c.first, c.second));
+        ASSERT_TRUE(handle->call({y}, {x}));
+        auto result = read_vector<float>(y);
+        EXPECT_TRUE(test::all_close(result, expected.at(0), 1.0e-4f, 1.0e-2f));
+        ASSERT_TRUE(handle->call({y}, {x}));
+        EXPECT_EQ(result, read_vector<float>(y));
+    }
+
+    auto p = make_shared<op::Parameter>(element::f64, Shape{3, 50, 4});
+    auto product =
+        make_shared<Function>(make_shared<op::Product>(p, AxisSet{1}), ParameterVector{p});
+    vector<double> p_val(shape_size(p->get_shape()));
+    test::Uniform<double>(0.5, 1.5).initialize(p_val);
+    auto expected = execute(product, vector<vector<double>>{p_val}, "INTERPRETER");
+    auto handle = backend->compile(product, pass_config);
+    auto x = backend->create_tensor(element::f64, p->get_shape());
+    copy_data(x, p_val);
+    auto y = backend->create_tensor(element::f64, Shape{3, 4});
+    ASSERT_TRUE(handle->call({y}, {x}));
+    EXPECT_TRUE(test::all_close(read_vector<double>(y), expected.at(0), 1.0e-10, 1.0e-12));
+
+    // A reduction gives the same bits on one thread as on the whole pool
+    vector<float> values(100000);
+    rng.initialize(values);
+    float serial_sum = 0;
+    float parallel_sum = 0;
+    auto& executor = runtime::cpu::executor::GetCPUExecutor();
+    runtime::cpu::CPUKernelFunctor serial_kernel =
+        [&](runtime::cpu::CPURuntimeContext* ctx, runtime::cpu::CPUExecutionContext* ectx) {
+            runtime::cpu::kernel::reduce_deterministic<float, runtime::cpu::kernel::SumReducer>(
+                values.data(), &serial_sum, 1, values.size(), 1, ectx->arena);
+        };
+    runtime::cpu::CPUKernelFunctor parallel_kernel =
+        [&](runtime::cpu::CPURuntimeContext* ctx, runtime::cpu::CPUExecutionContext* ectx) {
+            runtime::cpu::kernel::reduce_deterministic<float, runtime::cpu::kernel::SumReducer>(
+                values.data(), &parallel_sum, 1, values.size(), 1, ectx->arena);
+        };
+    runtime::cpu::CPUExecutionContext serial_ectx{0, true};
+    runtime::cpu::CPUExecutionContext parallel_ectx{0, false};
+    executor.execute(serial_kernel, nullptr, &serial_ectx);
+    executor.execute(parallel_kernel, nullptr, &parallel_ectx);
+    EXPECT_EQ(serial_sum, parallel_sum);
+}
+
+TEST(cpu_test, metrics_sink)
+{
+    auto sink = make_shared<PrometheusMetricsSink>();
+    Metrics::set_sink(sink);
+
+    auto backend = runtime::Backend::create("CPU");
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto f = make_shared<Function>(make_shared<op::Tanh>(a + a), ParameterVector{a});
+    auto handle = backend->compile(f);
+    auto x = backend->create_tensor(element::f32, Shape{2, 3});
+    auto y = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6});
+    ASSERT_TRUE(handle->call_with_validate({y}, {x}));
+    ASSERT_TRUE(handle->call_with_validate({y}, {x}));
+    Metrics::set_sink(nullptr);
+
+    string metrics = sink->str();
+    EXPECT_NE(metrics.find("ngraph_call_duration_seconds_count{backend=\"CPU\"} 2\n"),
+              string::npos);
+    EXPECT_NE(metrics.find("ngraph_compile_duration_seconds_count{backend=\"CPU\"} 1\n"),
+              string::npos);
+    EXPECT_NE(metrics.find("ngraph_context_wait_seconds_total{backend=\"CPU\"}"),
+              string::npos);
+    EXPECT_NE(metrics.find("# TYPE ngraph_arena_bytes gauge\n"), string::npos);
+}
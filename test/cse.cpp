@@ -307,6 +307,60 @@ TEST(CSE, constant)
     ASSERT_NE(abs111->get_argument(0), abs112->get_argument(0));
 }
 
+TEST(CSE, many_constants)
+{
+    // Constants of one shape must not all land in one bucket and be compared pairwise
+    NodeVector results;
+    for (int i = 0; i < 1000; i++)
+    {
+        auto c = op::Constant::create(element::i32, Shape{4}, {i, i, i, i});
+        auto c_1 = op::Constant::create(element::i32, Shape{4}, {i, i, i, i});
+        results.push_back(std::make_shared<op::Abs>(c));
+        results.push_back(std::make_shared<op::Abs>(c_1));
+    }
+    auto f = std::make_shared<Function>(results, ParameterVector{});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<ngraph::pass::CommonSubexpressionElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::Constant>(f), 1000);
+    ASSERT_EQ(count_ops_of_type<op::Abs>(f), 1000);
+    for (size_t i = 0; i < results.size(); i += 2)
+    {
+        ASSERT_EQ(f->get_results().at(i)->get_argument(0),
+                  f->get_results().at(i + 1)->get_argument(0));
+    }
+}
+
+TEST(CSE, structural_hash)
+{
+    Shape shape{2, 3};
+    auto A = std::make_shared<op::Parameter>(element::f32, shape);
+    auto B = std::make_shared<op::Parameter>(element::f32, shape);
+    auto c0 = op::Constant::create(element::f32, shape, {0, 0, 0, 0, 0, 0});
+    auto c0_1 = op::Constant::create(element::f32, shape, {0, 0, 0, 0, 0, 0});
+    auto c1 = op::Constant::create(element::f32, shape, {0, 0, 0, 0, 0, 1});
+
+    auto add = std::make_shared<op::Add>(A, c0);
+    auto add_commuted = std::make_shared<op::Add>(c0_1, A);
+    auto add_b = std::make_shared<op::Add>(B, c0);
+    auto add_c1 = std::make_shared<op::Add>(A, c1);
+    EXPECT_EQ(add->get_structural_hash(), add_commuted->get_structural_hash());
+    EXPECT_NE(add->get_structural_hash(), add_b->get_structural_hash());
+    EXPECT_NE(add->get_structural_hash(), add_c1->get_structural_hash());
+
+    // Replacing an argument by one that hashes differently invalidates the users downstream
+    auto abs = std::make_shared<op::Abs>(add);
+    auto f = std::make_shared<Function>(abs, ParameterVector{A});
+    size_t abs_hash = abs->get_structural_hash();
+    replace_node(c0, c1);
+    EXPECT_FALSE(add->has_cached_structural_hash());
+    EXPECT_FALSE(abs->has_cached_structural_hash());
+    EXPECT_NE(abs->get_structural_hash(), abs_hash);
+    EXPECT_EQ(add->get_structural_hash(), add_c1->get_structural_hash());
+}
+
 TEST(CSE, one_hot)
 {
     pass::Manager pass_manager;
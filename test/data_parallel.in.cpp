@@ -0,0 +1,97 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/data_parallel/data_parallel_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// y = x . w is gathered along the batch, loss = sum(y) is summed over the replicas
+static shared_ptr<Function> make_batched_dot()
+{
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 3});
+    auto w = make_shared<op::Parameter>(element::f32, PartialShape{3, 2});
+    auto y = make_shared<op::Dot>(x, w);
+    auto loss = make_shared<op::Sum>(y, AxisSet{0, 1});
+    return make_shared<Function>(NodeVector{y, loss}, ParameterVector{x, w});
+}
+
+static vector<shared_ptr<runtime::Backend>> make_replicas(size_t count)
+{
+    vector<shared_ptr<runtime::Backend>> replicas;
+    for (size_t i = 0; i < count; i++)
+    {
+        replicas.push_back(runtime::Backend::create("${BACKEND_NAME}"));
+    }
+    return replicas;
+}
+
+NGRAPH_TEST(data_parallel_${BACKEND_NAME}, splits_batch)
+{
+    auto replicas = make_replicas(2);
+    runtime::data_parallel::DataParallelExecutable executable(make_batched_dot(), replicas);
+    EXPECT_EQ(executable.get_replica_count(), 2);
+
+    auto& backend = replicas[0];
+    // 5 samples, split 3 and 2
+    auto x = backend->create_tensor(element::f32, Shape{5, 3});
+    auto w = backend->create_tensor(element::f32, Shape{3, 2});
+    auto y = backend->create_tensor(element::f32, Shape{5, 2});
+    auto loss = backend->create_tensor(element::f32, Shape{});
+    copy_data(x, vector<float>{1, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1, 2, 0, 0});
+    copy_data(w, vector<float>{1, 2, 3, 4, 5, 6});
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        ASSERT_TRUE(executable.call({y, loss}, {x, w}));
+        EXPECT_TRUE(test::all_close_f((vector<float>{1, 2, 3, 4, 5, 6, 9, 12, 2, 4}),
+                                      read_vector<float>(y)));
+        EXPECT_TRUE(test::all_close_f((vector<float>{48}), read_vector<float>(loss)));
+    }
+}
+
+NGRAPH_TEST(data_parallel_${BACKEND_NAME}, fewer_samples_than_replicas)
+{
+    auto replicas = make_replicas(3);
+    runtime::data_parallel::DataParallelExecutable executable(make_batched_dot(), replicas);
+
+    auto& backend = replicas[0];
+    auto x = backend->create_tensor(element::f32, Shape{2, 3});
+    auto w = backend->create_tensor(element::f32, Shape{3, 2});
+    auto y = backend->create_tensor(element::f32, Shape{2, 2});
+    auto loss = backend->create_tensor(element::f32, Shape{});
+    copy_data(x, vector<float>{1, 1, 1, 0, 0, 1});
+    copy_data(w, vector<float>{1, 2, 3, 4, 5, 6});
+
+    ASSERT_TRUE(executable.call({y, loss}, {x, w}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{9, 12, 5, 6}), read_vector<float>(y)));
+    EXPECT_TRUE(test::all_close_f((vector<float>{32}), read_vector<float>(loss)));
+}
+
+NGRAPH_TEST(data_parallel_${BACKEND_NAME}, needs_batched_parameter)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto f = make_shared<Function>(make_shared<op::Negative>(a), ParameterVector{a});
+    EXPECT_ANY_THROW(runtime::data_parallel::DataParallelExecutable(f, make_replicas(2)));
+}
@@ -15,13 +15,16 @@
 //*****************************************************************************
 
 #include <fstream>
+#include <numeric>
 #include <sstream>
 
 #include "gtest/gtest.h"
 
 #include "ngraph/distributed.hpp"
+#include "ngraph/distributed/hierarchical_open_mpi.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/pipeline/pipeline_executable.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/all_close_f.hpp"
 #include "util/random.hpp"
@@ -55,6 +58,347 @@ TEST(distributed_${BACKEND_NAME}, allreduce)
     }
 }
 
+TEST(distributed_${BACKEND_NAME}, allreduce_overlapped)
+{
+    auto comm_size = get_distributed_interface()->get_size();
+    if (comm_size > 1)
+    {
+        auto shape = Shape{2, 2};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        auto grad_a = make_shared<op::Negative>(A);
+        auto grad_b = make_shared<op::Multiply>(grad_a, B);
+        auto f = make_shared<Function>(
+            NodeVector{make_shared<op::AllReduce>(grad_a) + A, make_shared<op::AllReduce>(grad_b)},
+            ParameterVector{A, B});
+
+        auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>{1, 2, 3, 4});
+        auto b = backend->create_tensor(element::f32, shape);
+        copy_data(b, vector<float>{2, 2, 2, 2});
+        auto result_a = backend->create_tensor(element::f32, shape);
+        auto result_b = backend->create_tensor(element::f32, shape);
+
+        float n = static_cast<float>(comm_size);
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result_a, result_b}, {a, b});
+        EXPECT_TRUE(test::all_close_f(vector<float>{1 - n, 2 - 2 * n, 3 - 3 * n, 4 - 4 * n},
+                                      read_vector<float>(result_a)));
+        EXPECT_TRUE(test::all_close_f(vector<float>{-2 * n, -4 * n, -6 * n, -8 * n},
+                                      read_vector<float>(result_b)));
+    }
+}
+
+TEST(distributed_${BACKEND_NAME}, allreduce_compressed)
+{
+    auto comm_size = get_distributed_interface()->get_size();
+    if (comm_size > 1)
+    {
+        auto shape = Shape{2, 2};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::AllReduce>(A, element::bf16),
+                                       ParameterVector{A});
+
+        auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+        // exactly representable in bf16, so the compression is lossless
+        auto v = vector<float>{1, 2, 3, 4};
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, v);
+        auto result = backend->create_tensor(element::f32, shape);
+
+        std::transform(
+            v.begin(), v.end(), v.begin(), std::bind1st(std::multiplies<float>(), comm_size));
+
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(v, read_vector<float>(result)));
+    }
+}
+
+TEST(distributed_${BACKEND_NAME}, compressed_all_reduce_error_feedback)
+{
+    auto distributed_interface = get_distributed_interface();
+    auto comm_size = distributed_interface->get_size();
+    if (comm_size > 1)
+    {
+        // 1 + 2^-10 rounds to 1 in bf16, the lost 2^-10 is sent with the next call
+        float value = 1.0f + 1.0f / 1024;
+        vector<float> error_feedback(1, 0.0f);
+        float out = 0;
+        distributed_interface->compressed_all_reduce(
+            &value, &out, element::Type_t::bf16, 1, error_feedback.data());
+        EXPECT_EQ(out, static_cast<float>(comm_size));
+        EXPECT_EQ(error_feedback[0], 1.0f / 1024);
+
+        float zero = 0;
+        distributed_interface->compressed_all_reduce(
+            &zero, &out, element::Type_t::bf16, 1, error_feedback.data());
+        EXPECT_EQ(out, static_cast<float>(comm_size) / 1024);
+        EXPECT_EQ(error_feedback[0], 0.0f);
+    }
+}
+
+TEST(distributed_${BACKEND_NAME}, iall_reduce)
+{
+    auto distributed_interface = get_distributed_interface();
+    auto comm_size = distributed_interface->get_size();
+    if (comm_size > 1)
+    {
+        vector<float> in{1, 2, 3, 4};
+        vector<float> out(in.size());
+        auto request = distributed_interface->iall_reduce(
+            in.data(), out.data(), element::Type_t::f32, in.size());
+        request->wait();
+        std::transform(
+            in.begin(), in.end(), in.begin(), std::bind1st(std::multiplies<float>(), comm_size));
+        EXPECT_TRUE(test::all_close_f(in, out));
+    }
+}
+
+TEST(distributed_${BACKEND_NAME}, allgather)
+{
+    auto comm_size = get_distributed_interface()->get_size();
+    if (comm_size > 1)
+    {
+        auto rank = get_distributed_interface()->get_rank();
+        auto shape = Shape{2, 2};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::AllGather>(A, comm_size),
+                                       ParameterVector{A});
+
+        auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(4, static_cast<float>(rank)));
+        auto result =
+            backend->create_tensor(element::f32, Shape{2 * static_cast<size_t>(comm_size), 2});
+
+        vector<float> expected;
+        for (int i = 0; i < comm_size; i++)
+        {
+            expected.insert(expected.end(), 4, static_cast<float>(i));
+        }
+
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    }
+}
+
+TEST(distributed_${BACKEND_NAME}, sparse_embedding_gradient)
+{
+    auto comm_size = get_distributed_interface()->get_size();
+    if (comm_size > 1)
+    {
+        // large enough for the gradient all-reduce to be made sparse
+        auto rank = get_distributed_interface()->get_rank();
+        Shape weights_shape{100000, 4};
+        auto indices = make_shared<op::Parameter>(element::i32, Shape{2});
+        auto delta = make_shared<op::Parameter>(element::f32, Shape{2, 4});
+        auto grad = make_shared<op::AllReduce>(
+            make_shared<op::EmbeddingLookupBackprop>(indices, delta, weights_shape));
+        auto f = make_shared<Function>(grad, ParameterVector{indices, delta});
+
+        auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+        auto a = backend->create_tensor(element::i32, Shape{2});
+        copy_data(a, vector<int>{rank, 99999});
+        auto d = backend->create_tensor(element::f32, Shape{2, 4});
+        copy_data(d, vector<float>(8, 1.0f));
+        auto result = backend->create_tensor(element::f32, weights_shape);
+
+        vector<float> expected(shape_size(weights_shape), 0.0f);
+        for (size_t i = 0; i < 4; i++)
+        {
+            for (int r = 0; r < comm_size; r++)
+            {
+                expected[r * 4 + i] = 1.0f;
+            }
+            expected[99999 * 4 + i] = static_cast<float>(comm_size);
+        }
+
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a, d});
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    }
+}
+
+TEST(distributed_${BACKEND_NAME}, reducescatter)
+{
+    auto comm_size = get_distributed_interface()->get_size();
+    if (comm_size > 1)
+    {
+        auto rank = get_distributed_interface()->get_rank();
+        auto shape = Shape{2 * static_cast<size_t>(comm_size), 2};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto f = make_shared<Function>(make_shared<op::ReduceScatter>(A, comm_size),
+                                       ParameterVector{A});
+
+        auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+        vector<float> v(shape_size(shape));
+        std::iota(v.begin(), v.end(), 0.0f);
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, v);
+        auto result = backend->create_tensor(element::f32, Shape{2, 2});
+
+        vector<float> expected(v.begin() + 4 * rank, v.begin() + 4 * (rank + 1));
+        std::transform(expected.begin(),
+                       expected.end(),
+                       expected.begin(),
+                       std::bind1st(std::multiplies<float>(), comm_size));
+
+        auto handle = backend->compile(f);
+        handle->call_with_validate({result}, {a});
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+    }
+}
+
+#ifdef NGRAPH_DISTRIBUTED_OMPI_ENABLE
+TEST(distributed_${BACKEND_NAME}, hierarchical_all_reduce)
+{
+    distributed::HierarchicalOpenMPIDistributedInterface hierarchical;
+    auto comm_size = hierarchical.get_size();
+    auto rank = hierarchical.get_rank();
+
+    // odd sizes leave some ranks of the node without a share of the sum
+    for (size_t count : {1, 7, 1000})
+    {
+        vector<float> in(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            in[i] = static_cast<float>(rank + i);
+        }
+        vector<float> out(count);
+        hierarchical.all_reduce(in.data(), out.data(), element::Type_t::f32, count);
+
+        vector<float> expected(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            expected[i] = static_cast<float>(comm_size * (comm_size - 1) / 2 + comm_size * i);
+        }
+        EXPECT_TRUE(test::all_close_f(expected, out));
+    }
+}
+#endif
+
+TEST(distributed_${BACKEND_NAME}, send_recv_ring)
+{
+    auto comm_size = get_distributed_interface()->get_size();
+    if (comm_size > 1)
+    {
+        // every process passes its rank to the next one around a ring
+        auto rank = get_distributed_interface()->get_rank();
+        auto shape = Shape{2};
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto next = (rank + 1) % comm_size;
+        auto previous = (rank + comm_size - 1) % comm_size;
+        auto send = make_shared<op::Send>(A, next, 3);
+        auto recv = make_shared<op::Recv>(element::f32, shape, previous, 3);
+        // backends with a blocking Recv must not wait before their own Send
+        recv->add_control_dependency(send);
+        auto f = make_shared<Function>(NodeVector{send, recv}, ParameterVector{A});
+
+        auto backend = runtime::Backend::create("${BACKEND_NAME}");
+
+        auto a = backend->create_tensor(element::f32, shape);
+        copy_data(a, vector<float>(2, static_cast<float>(rank)));
+        auto sent = backend->create_tensor(element::f32, shape);
+        auto received = backend->create_tensor(element::f32, shape);
+
+        auto handle = backend->compile(f);
+        for (int i = 0; i < 2; i++)
+        {
+            handle->call_with_validate({sent, received}, {a});
+            EXPECT_TRUE(test::all_close_f(read_vector<float>(a), read_vector<float>(sent)));
+            EXPECT_TRUE(test::all_close_f(vector<float>(2, static_cast<float>(previous)),
+                                          read_vector<float>(received)));
+        }
+    }
+}
+
+TEST(distributed_${BACKEND_NAME}, pipeline)
+{
+    auto comm_size = get_distributed_interface()->get_size();
+    if (comm_size > 1)
+    {
+        // a chain of layers, each much more expensive than the final Sum
+        auto make_f = [](const PartialShape& x_shape) {
+            auto x = make_shared<op::Parameter>(element::f32, x_shape);
+            auto w = make_shared<op::Parameter>(element::f32, Shape{8, 8});
+            shared_ptr<Node> h = x;
+            for (int i = 0; i < 4; i++)
+            {
+                h = make_shared<op::Relu>(make_shared<op::Dot>(h, w));
+            }
+            auto loss = make_shared<op::Sum>(h, AxisSet{0, 1});
+            return make_shared<Function>(loss, ParameterVector{x, w});
+        };
+
+        auto backend = runtime::Backend::create("${BACKEND_NAME}");
+        runtime::pipeline::PipelineExecutable pipeline(
+            make_f(PartialShape{Dimension::dynamic(), 8}), backend, 4);
+        EXPECT_EQ(pipeline.get_stage_count(), static_cast<size_t>(comm_size));
+
+        auto x = backend->create_tensor(element::f32, Shape{16, 8});
+        auto w = backend->create_tensor(element::f32, Shape{8, 8});
+        vector<float> x_data(16 * 8);
+        iota(x_data.begin(), x_data.end(), -64.0f);
+        copy_data(x, x_data);
+        vector<float> w_data(8 * 8);
+        for (size_t i = 0; i < w_data.size(); i++)
+        {
+            w_data[i] = (i % 9 == 0 ? 0.5f : 0.0f) + (i % 5 == 0 ? 0.125f : 0.0f);
+        }
+        copy_data(w, w_data);
+
+        auto expected = backend->create_tensor(element::f32, Shape{});
+        backend->compile(make_f(PartialShape{16, 8}))->call_with_validate({expected}, {x, w});
+
+        auto loss = backend->create_tensor(element::f32, Shape{});
+        for (int i = 0; i < 2; i++)
+        {
+            ASSERT_TRUE(pipeline.call({loss}, {x, w}));
+            if (pipeline.get_stage() + 1 == pipeline.get_stage_count())
+            {
+                EXPECT_TRUE(test::all_close_f(read_vector<float>(expected),
+                                              read_vector<float>(loss)));
+            }
+        }
+    }
+}
+
+TEST(distributed_${BACKEND_NAME}, deserialize_distributed)
+{
+    auto distributed = get_distributed_interface();
+    const string tmp_file = "deserialize_distributed.cpio";
+    vector<float> weights{1, 2, 3, 4, 5, 6, 7, 8};
+    vector<int8_t> mask{1, -1, 0};
+    if (distributed->get_rank() == 0)
+    {
+        auto A = op::Constant::create(element::f32, Shape{2, 4}, weights);
+        auto B = op::Constant::create(element::i8, Shape{3}, mask);
+        serialize(tmp_file, make_shared<Function>(NodeVector{A, B}, ParameterVector{}));
+    }
+
+    // a chunk size that splits both constants and does not divide the f32 one evenly
+    auto f = deserialize_distributed(tmp_file, 12);
+    if (distributed->get_rank() == 0)
+    {
+        file_util::remove_file(tmp_file);
+    }
+    ASSERT_NE(f, nullptr);
+    auto A = dynamic_pointer_cast<op::Constant>(f->get_output_op(0)->get_argument(0));
+    auto B = dynamic_pointer_cast<op::Constant>(f->get_output_op(1)->get_argument(0));
+    ASSERT_NE(A, nullptr);
+    ASSERT_NE(B, nullptr);
+    EXPECT_EQ(A->get_vector<float>(), weights);
+    EXPECT_EQ(B->get_vector<int8_t>(), mask);
+}
+
 TEST(distributed_${BACKEND_NAME}, broadcastdistributed)
 {
     auto shape = Shape{2, 2};
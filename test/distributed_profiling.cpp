@@ -0,0 +1,121 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <cstring>
+
+#include "gtest/gtest.h"
+#include "ngraph/distributed/profiling.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+namespace
+{
+    // Four processes that are all the same one: collectives copy, barriers count
+    class LoopbackDistributedInterface : public DistributedInterface
+    {
+    public:
+        const string& get_name() const override { return m_name; }
+        int get_size() override { return 4; }
+        int get_rank() override { return 0; }
+        void all_reduce(void* in, void* out, element::Type_t element_type, size_t count) override
+        {
+            memmove(out, in, count * element::Type(element_type).size());
+        }
+        void broadcast(void* in, element::Type_t element_type, size_t count) override {}
+        void reduce_scatter(void* in,
+                            void* out,
+                            element::Type_t element_type,
+                            size_t count) override
+        {
+            memmove(out, in, count * element::Type(element_type).size());
+        }
+        void all_gather(void* in, void* out, element::Type_t element_type, size_t count) override
+        {
+            for (int i = 0; i < get_size(); i++)
+            {
+                size_t size = count * element::Type(element_type).size();
+                memmove(static_cast<char*>(out) + i * size, in, size);
+            }
+        }
+        void send(const void* in,
+                  element::Type_t element_type,
+                  size_t count,
+                  int dest_rank,
+                  int tag) override
+        {
+        }
+        void recv(
+            void* out, element::Type_t element_type, size_t count, int src_rank, int tag) override
+        {
+        }
+        void barrier() override { m_barriers++; }
+        size_t m_barriers = 0;
+
+    private:
+        string m_name{"Loopback"};
+    };
+}
+
+TEST(distributed_profiling, counters)
+{
+    auto loopback = new LoopbackDistributedInterface();
+    distributed::ProfilingDistributedInterface profiling{
+        unique_ptr<DistributedInterface>(loopback)};
+    EXPECT_EQ(profiling.get_name(), "Loopback");
+    EXPECT_EQ(profiling.get_size(), 4);
+
+    vector<float> in(16, 1.0f);
+    vector<float> out(64);
+    profiling.all_reduce(in.data(), out.data(), element::Type_t::f32, 16);
+    profiling.all_reduce(in.data(), out.data(), element::Type_t::f32, 8);
+    profiling.all_gather(in.data(), out.data(), element::Type_t::f32, 16);
+    profiling.send(in.data(), element::Type_t::f32, 4, 1, 0);
+    profiling.iall_reduce(in.data(), out.data(), element::Type_t::f32, 16)->wait();
+    // one barrier before each blocking collective, none before a send
+    EXPECT_EQ(loopback->m_barriers, 3);
+
+    auto counters = profiling.get_counters();
+    ASSERT_EQ(counters.size(), 3);
+    // ordered by name
+    EXPECT_EQ(counters[0].get_name(), "AllGather");
+    EXPECT_EQ(counters[0].call_count(), 1);
+    EXPECT_EQ(counters[0].total_bytes(), 4 * 16 * 4);
+    EXPECT_EQ(counters[0].m_bus_factor, 0.75);
+    EXPECT_EQ(counters[1].get_name(), "AllReduce");
+    EXPECT_EQ(counters[1].call_count(), 3);
+    EXPECT_EQ(counters[1].total_bytes(), (16 + 8 + 16) * 4);
+    EXPECT_EQ(counters[1].m_bus_factor, 1.5);
+    EXPECT_LE(counters[1].total_wait_microseconds(), counters[1].total_microseconds());
+    EXPECT_EQ(counters[2].get_name(), "Send");
+    EXPECT_EQ(counters[2].total_bytes(), 16);
+    EXPECT_EQ(counters[2].total_wait_microseconds(), 0);
+
+    profiling.reset_counters();
+    EXPECT_TRUE(profiling.get_counters().empty());
+}
+
+TEST(distributed_profiling, bus_bandwidth)
+{
+    distributed::CollectiveCounter counter("AllReduce", 1.5);
+    EXPECT_EQ(counter.bus_gbytes_per_second(), 0);
+    counter.m_call_count = 2;
+    counter.m_total_bytes = 4000000;
+    counter.m_total_microseconds = 3000;
+    counter.m_total_wait_microseconds = 1000;
+    // 4 MB in 2 ms is 2 GB/s of algorithm bandwidth
+    EXPECT_DOUBLE_EQ(counter.bus_gbytes_per_second(), 3.0);
+}
@@ -0,0 +1,160 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/constant_folding.hpp"
+#include "ngraph/pass/dyn_elimination.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(dyn_elimination, dyn_reshape)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 4, 6});
+    auto pattern = op::Constant::create(element::i64, Shape{2}, {8, 6});
+    auto dyn_reshape = make_shared<op::DynReshape>(param, pattern);
+    auto neg = make_shared<op::Negative>(dyn_reshape);
+    auto f = make_shared<Function>(neg, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::DynElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::DynReshape>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 1);
+    ASSERT_FALSE(f->is_dynamic());
+    ASSERT_EQ(f->get_results().at(0)->get_shape(), (Shape{8, 6}));
+}
+
+TEST(dyn_elimination, dyn_reshape_shape_of_chain)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 4, 6});
+    auto pattern0 = op::Constant::create(element::i64, Shape{2}, {8, 6});
+    auto dyn_reshape0 = make_shared<op::DynReshape>(param, pattern0);
+    auto pattern1 = op::Constant::create(element::i64, Shape{1}, {48});
+    auto dyn_reshape1 = make_shared<op::DynReshape>(dyn_reshape0, pattern1);
+    auto f = make_shared<Function>(dyn_reshape1, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::DynElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::DynReshape>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 2);
+    ASSERT_EQ(f->get_results().at(0)->get_shape(), (Shape{48}));
+}
+
+TEST(dyn_elimination, dyn_reshape_bad_pattern)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 4, 6});
+    auto pattern = op::Constant::create(element::i64, Shape{2}, {8, 5});
+    auto dyn_reshape = make_shared<op::DynReshape>(param, pattern);
+    auto f = make_shared<Function>(dyn_reshape, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::DynElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::DynReshape>(f), 1);
+}
+
+TEST(dyn_elimination, dyn_slice)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{4, 6});
+    auto lower = op::Constant::create(element::i64, Shape{2}, {1, 0});
+    auto upper = op::Constant::create(element::i64, Shape{2}, {3, 6});
+    auto strides = op::Constant::create(element::i64, Shape{2}, {1, 2});
+    auto dyn_slice = make_shared<op::DynSlice>(param, lower, upper, strides);
+    auto f = make_shared<Function>(dyn_slice, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::DynElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::DynSlice>(f), 0);
+    auto slice = dynamic_pointer_cast<op::Slice>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(slice);
+    ASSERT_EQ(slice->get_lower_bounds(), (Coordinate{1, 0}));
+    ASSERT_EQ(slice->get_upper_bounds(), (Coordinate{3, 6}));
+    ASSERT_EQ(slice->get_strides(), (Strides{1, 2}));
+    ASSERT_EQ(f->get_results().at(0)->get_shape(), (Shape{2, 3}));
+}
+
+TEST(dyn_elimination, dyn_broadcast)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto shape = op::Constant::create(element::i64, Shape{2}, {2, 3});
+    auto axes = op::Constant::create(element::i64, Shape{1}, {0});
+    auto dyn_broadcast = make_shared<op::DynBroadcast>(param, shape, axes);
+    auto f = make_shared<Function>(dyn_broadcast, ParameterVector{param});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::DynElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::DynBroadcast>(f), 0);
+    auto broadcast =
+        dynamic_pointer_cast<op::Broadcast>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(broadcast);
+    ASSERT_EQ(broadcast->get_broadcast_axes(), (AxisSet{0}));
+    ASSERT_EQ(f->get_results().at(0)->get_shape(), (Shape{2, 3}));
+}
+
+TEST(dyn_elimination, dyn_pad)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto below = op::Constant::create(element::i64, Shape{2}, {1, 0});
+    auto above = op::Constant::create(element::i64, Shape{2}, {0, 2});
+    auto value = make_shared<op::Parameter>(element::f32, Shape{});
+    auto dyn_pad = make_shared<op::DynPad>(param, below, above, value);
+    auto f = make_shared<Function>(dyn_pad, ParameterVector{param, value});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::DynElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::DynPad>(f), 0);
+    auto pad = dynamic_pointer_cast<op::Pad>(f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(pad);
+    ASSERT_EQ(pad->get_padding_below(), (CoordinateDiff{1, 0}));
+    ASSERT_EQ(pad->get_padding_above(), (CoordinateDiff{0, 2}));
+    ASSERT_EQ(f->get_results().at(0)->get_shape(), (Shape{3, 5}));
+}
+
+TEST(dyn_elimination, shape_of_then_dyn_broadcast)
+{
+    auto param = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto like = make_shared<op::Parameter>(element::f32, Shape{5, 3});
+    auto shape_of = make_shared<op::ShapeOf>(like);
+    auto axes = op::Constant::create(element::i64, Shape{1}, {0});
+    auto dyn_broadcast = make_shared<op::DynBroadcast>(param, shape_of, axes);
+    auto add = make_shared<op::Add>(dyn_broadcast, like);
+    auto f = make_shared<Function>(add, ParameterVector{param, like});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ConstantFolding>();
+    pass_manager.register_pass<pass::DynElimination>();
+    pass_manager.run_passes(f);
+
+    ASSERT_EQ(count_ops_of_type<op::ShapeOf>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::DynBroadcast>(f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Broadcast>(f), 1);
+    ASSERT_FALSE(f->is_dynamic());
+}
@@ -16,6 +16,7 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/dynamic/dynamic_backend.hpp"
 #include "util/all_close_f.hpp"
 #include "util/test_control.hpp"
 #include "util/test_tools.hpp"
@@ -112,3 +113,151 @@ NGRAPH_TEST(dynamic_${BACKEND_NAME}, abc)
         EXPECT_TRUE(test::all_close_f(results, expected_values));
     }
 }
+
+NGRAPH_TEST(dynamic_${BACKEND_NAME}, executable_cache)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto b = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto f = make_shared<Function>(NodeVector{a + b}, ParameterVector{a, b});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto ex = backend->compile(f);
+    auto dyn_ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex);
+    if (dyn_ex == nullptr)
+    {
+        // Backend supports dynamic tensors natively; no wrapper cache to test.
+        return;
+    }
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape{2, Dimension::dynamic()});
+
+    auto run = [&](size_t middle_dim) {
+        vector<float> inputs(2 * middle_dim, 1.0f);
+        auto t_a = backend->create_tensor(element::f32, Shape{2, middle_dim});
+        auto t_b = backend->create_tensor(element::f32, Shape{2, middle_dim});
+        copy_data(t_a, inputs);
+        copy_data(t_b, inputs);
+        ex->call_with_validate({t_r}, {t_a, t_b});
+        ASSERT_EQ(t_r->get_shape(), (Shape{2, middle_dim}));
+        EXPECT_TRUE(
+            test::all_close_f(read_vector<float>(t_r), vector<float>(2 * middle_dim, 2.0f)));
+    };
+
+    run(3);
+    run(3);
+    run(4);
+    run(3);
+
+    EXPECT_EQ(dyn_ex->get_cache_hits(), 2);
+    EXPECT_EQ(dyn_ex->get_cache_misses(), 2);
+    EXPECT_EQ(dyn_ex->get_cache_size(), 2);
+
+    dyn_ex->set_cache_capacity(1);
+    EXPECT_EQ(dyn_ex->get_cache_size(), 1);
+
+    // {2,3} was used most recently, so {2,4} has been evicted.
+    run(3);
+    EXPECT_EQ(dyn_ex->get_cache_hits(), 3);
+    run(4);
+    EXPECT_EQ(dyn_ex->get_cache_misses(), 3);
+    EXPECT_EQ(dyn_ex->get_cache_size(), 1);
+
+    dyn_ex->set_cache_capacity(0);
+    EXPECT_EQ(dyn_ex->get_cache_size(), 0);
+    run(4);
+    EXPECT_EQ(dyn_ex->get_cache_misses(), 4);
+    EXPECT_EQ(dyn_ex->get_cache_size(), 0);
+}
+
+NGRAPH_TEST(dynamic_${BACKEND_NAME}, output_storage_reuse)
+{
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic()});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Negative>(a)}, ParameterVector{a});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto dyn_backend = dynamic_pointer_cast<runtime::dynamic::DynamicBackend>(backend);
+    if (dyn_backend == nullptr)
+    {
+        // Backend supports dynamic tensors natively; no wrapper pool to test.
+        return;
+    }
+    auto pool = dyn_backend->get_tensor_pool();
+    auto ex = backend->compile(f);
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape{2, Dimension::dynamic()});
+
+    auto run = [&](size_t middle_dim) {
+        vector<float> inputs(2 * middle_dim, 1.0f);
+        auto t_a = backend->create_tensor(element::f32, Shape{2, middle_dim});
+        copy_data(t_a, inputs);
+        ex->call_with_validate({t_r}, {t_a});
+        ASSERT_EQ(t_r->get_shape(), (Shape{2, middle_dim}));
+        EXPECT_TRUE(
+            test::all_close_f(read_vector<float>(t_r), vector<float>(2 * middle_dim, -1.0f)));
+    };
+
+    run(3);
+    run(3);
+    EXPECT_EQ(pool->get_allocations(), 1);
+
+    // Growing needs new storage, going back to the smaller shape reuses storage either from
+    // the tensor itself or from the pool
+    run(4);
+    run(3);
+    EXPECT_EQ(pool->get_allocations(), 2);
+
+    if (pool->attaches_memory())
+    {
+        // Values much smaller than the storage only shrink it once they persist
+        run(100);
+        size_t allocations = pool->get_allocations();
+        for (size_t i = 1; i < runtime::dynamic::DynamicTensor::SHRINK_AFTER; i++)
+        {
+            run(1);
+        }
+        EXPECT_EQ(pool->get_allocations(), allocations);
+        run(1);
+        EXPECT_EQ(pool->get_allocations(), allocations + 1);
+    }
+
+    auto dyn_t_r = static_pointer_cast<runtime::dynamic::DynamicTensor>(t_r);
+    dyn_t_r->release_storage();
+    EXPECT_GT(pool->get_pooled_bytes(), 0);
+    pool->set_max_pooled_bytes(0);
+    EXPECT_EQ(pool->get_pooled_bytes(), 0);
+}
+
+NGRAPH_TEST(dynamic_${BACKEND_NAME}, dyn_reshape_shape_relevant_input)
+{
+    auto data = make_shared<op::Parameter>(element::f32, PartialShape::dynamic());
+    auto pattern = make_shared<op::Parameter>(element::i64, PartialShape{Dimension::dynamic()});
+    auto dyn_reshape = make_shared<op::DynReshape>(data, pattern);
+    auto f = make_shared<Function>(NodeVector{dyn_reshape}, ParameterVector{data, pattern});
+
+    auto backend = runtime::Backend::create("${BACKEND_NAME}", true);
+    auto ex = backend->compile(f);
+
+    auto t_r = backend->create_dynamic_tensor(element::f32, PartialShape::dynamic());
+
+    vector<float> data_values{0, 1, 2, 3, 4, 5};
+    auto t_data = backend->create_tensor(element::f32, Shape{2, 3});
+    copy_data(t_data, data_values);
+
+    vector<vector<int64_t>> patterns{{3, 2}, {6}, {1, 2, 3}, {3, 2}};
+    for (auto& p : patterns)
+    {
+        auto t_pattern = backend->create_tensor(element::i64, Shape{p.size()});
+        copy_data(t_pattern, p);
+
+        ex->call_with_validate({t_r}, {t_data, t_pattern});
+
+        ASSERT_EQ(t_r->get_shape(), Shape(p.begin(), p.end()));
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(t_r), data_values));
+    }
+
+    if (auto dyn_ex = dynamic_pointer_cast<runtime::dynamic::DynamicExecutable>(ex))
+    {
+        // The pattern values are part of the cache key.
+        EXPECT_EQ(dyn_ex->get_cache_misses(), 3);
+        EXPECT_EQ(dyn_ex->get_cache_hits(), 1);
+    }
+}
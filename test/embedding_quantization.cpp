@@ -0,0 +1,111 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cmath>
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/pass/embedding_quantization.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+static shared_ptr<Function> make_lookup(const vector<float>& table, const Shape& shape)
+{
+    auto A = make_shared<op::Parameter>(element::i32, Shape{4});
+    auto W = op::Constant::create(element::f32, shape, table);
+    return make_shared<Function>(make_shared<op::EmbeddingLookup>(A, W), ParameterVector{A});
+}
+
+TEST(embedding_quantization, i8_rows)
+{
+    Shape shape{3, 4};
+    vector<float> table{-1.0f, 0.0f, 0.5f, 1.0f, 3.0f, 3.0f, 3.0f, 3.0f, 10.0f, 12.5f, 15.0f, 20.f};
+    auto f = make_lookup(table, shape);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::EmbeddingQuantization>();
+    pass_manager.run_passes(f);
+
+    auto lookup = dynamic_pointer_cast<op::EmbeddingLookup>(
+        f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(lookup);
+    ASSERT_TRUE(lookup->is_quantized());
+    EXPECT_EQ(lookup->get_element_type(), element::f32);
+    EXPECT_EQ(lookup->get_shape(), (Shape{4, 4}));
+
+    auto weights = dynamic_pointer_cast<op::Constant>(lookup->get_argument(1));
+    auto scale = dynamic_pointer_cast<op::Constant>(lookup->get_argument(2));
+    auto bias = dynamic_pointer_cast<op::Constant>(lookup->get_argument(3));
+    ASSERT_TRUE(weights && scale && bias);
+    ASSERT_EQ(weights->get_element_type(), element::i8);
+    auto q = weights->get_vector<int8_t>();
+    auto s = scale->get_vector<float>();
+    auto b = bias->get_vector<float>();
+    for (size_t row = 0; row < 3; row++)
+    {
+        for (size_t column = 0; column < 4; column++)
+        {
+            size_t i = row * 4 + column;
+            // Within half a step of the row's range, exact for the minimum and maximum
+            EXPECT_LE(fabs(q[i] * s[row] + b[row] - table[i]), s[row] / 2 + 1e-5f);
+        }
+    }
+    EXPECT_NEAR(q[0] * s[0] + b[0], -1.0f, 1e-5f);
+    EXPECT_NEAR(q[11] * s[2] + b[2], 20.0f, 1e-5f);
+    // A constant row is exact
+    EXPECT_EQ(q[5] * s[1] + b[1], 3.0f);
+}
+
+TEST(embedding_quantization, f16_rows)
+{
+    Shape shape{2, 2};
+    auto f = make_lookup({0.5f, -2.0f, 1024.0f, 0.125f}, shape);
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::EmbeddingQuantization>(element::f16);
+    pass_manager.run_passes(f);
+
+    auto lookup = dynamic_pointer_cast<op::EmbeddingLookup>(
+        f->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(lookup && lookup->is_quantized());
+    auto weights = dynamic_pointer_cast<op::Constant>(lookup->get_argument(1));
+    ASSERT_EQ(weights->get_element_type(), element::f16);
+    auto values = weights->get_vector<float16>();
+    EXPECT_EQ(static_cast<float>(values[2]), 1024.0f);
+    EXPECT_EQ(static_cast<float>(values[3]), 0.125f);
+}
+
+TEST(embedding_quantization, shared_weights_kept)
+{
+    auto A = make_shared<op::Parameter>(element::i32, Shape{2});
+    auto W = op::Constant::create(element::f32, Shape{2, 2}, {1, 2, 3, 4});
+    auto lookup = make_shared<op::EmbeddingLookup>(A, W);
+    auto f = make_shared<Function>(NodeVector{lookup, W}, ParameterVector{A});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::EmbeddingQuantization>();
+    pass_manager.run_passes(f);
+
+    EXPECT_FALSE(dynamic_pointer_cast<op::EmbeddingLookup>(
+                     f->get_results().at(0)->get_argument(0))
+                     ->is_quantized());
+}
@@ -36,7 +36,7 @@ TEST(event_tracing, event_file)
     for (auto i = 0; i < 10; i++)
     {
         int id = i;
-        std::thread next_thread([&] {
+        std::thread next_thread([id] {
             std::ostringstream oss;
             oss << "Event: " << id;
             ngraph::Event event(oss.str(), "Dummy", "none");
@@ -55,6 +55,9 @@ TEST(event_tracing, event_file)
         next.join();
     }
 
+    // Make sure everything queued has reached the file
+    ngraph::Event::close();
+
     // Now read the file
     auto json_string = ngraph::file_util::read_file_to_string("ngraph_event_trace.json");
     nlohmann::json json_from_file(json_string);
@@ -63,3 +66,81 @@ TEST(event_tracing, event_file)
     // TODO
     ngraph::Event::disable_event_tracing();
 }
+
+TEST(event_tracing, memory_sink)
+{
+    ngraph::Event::enable_event_tracing();
+    auto sink = make_shared<ngraph::MemoryEventSink>();
+    ngraph::Event::set_sink(sink);
+
+    std::vector<std::thread> threads;
+    for (auto i = 0; i < 4; i++)
+    {
+        threads.push_back(std::thread([i] {
+            for (auto j = 0; j < 100; j++)
+            {
+                ngraph::Event event("Event " + to_string(i), "Dummy", to_string(j));
+                event.Stop();
+                ngraph::Event::write_trace(event);
+            }
+        }));
+    }
+    for (auto& next : threads)
+    {
+        next.join();
+    }
+    ngraph::Event::flush();
+
+    auto events = sink->get_events();
+    ASSERT_EQ(events.size(), 400u);
+
+    // Events from one thread keep the order they were written in
+    vector<int> next_arg(4, 0);
+    for (auto& event : events)
+    {
+        auto json = nlohmann::json::parse("[" + event + "]");
+        ASSERT_EQ(json.size(), 2u);
+        EXPECT_EQ(json[0]["ph"], "B");
+        EXPECT_EQ(json[1]["ph"], "E");
+        int thread = json[0]["name"].get<string>().back() - '0';
+        EXPECT_EQ(json[0]["args"], to_string(next_arg[thread]++));
+    }
+
+    ngraph::Event::close();
+    EXPECT_EQ(ngraph::Event::get_sink(), nullptr);
+    ngraph::Event::disable_event_tracing();
+}
+
+TEST(event_tracing, callback_and_file_sink)
+{
+    ngraph::Event::enable_event_tracing();
+    size_t count = 0;
+    ngraph::Event::set_sink(
+        make_shared<ngraph::CallbackEventSink>([&count](const string&) { count++; }));
+    for (auto i = 0; i < 5; i++)
+    {
+        ngraph::Event event("Event", "Dummy", "none");
+        event.Stop();
+        ngraph::Event::write_trace(event);
+    }
+    ngraph::Event::flush();
+    EXPECT_EQ(count, 5u);
+
+    // Switching sinks leaves the callback sink alone from then on
+    string path = ngraph::file_util::path_join(ngraph::file_util::get_temp_directory_path(),
+                                               "event_tracing_test.json");
+    ngraph::Event::set_sink(make_shared<ngraph::FileEventSink>(path));
+    for (auto i = 0; i < 3; i++)
+    {
+        ngraph::Event event("Event", "Dummy", "none");
+        event.Stop();
+        ngraph::Event::write_trace(event);
+    }
+    ngraph::Event::close();
+    EXPECT_EQ(count, 5u);
+
+    auto json = nlohmann::json::parse(ngraph::file_util::read_file_to_string(path));
+    EXPECT_EQ(json.size(), 6u);
+    ngraph::file_util::remove_file(path);
+    ngraph::Event::disable_event_tracing();
+}
@@ -46,7 +46,9 @@
 #include "ngraph/pattern/matcher.hpp"
 #include "ngraph/pattern/op/label.hpp"
 #include "ngraph/pattern/op/skip.hpp"
+#include "ngraph/runtime/gpu/op/loop_kernel.hpp"
 #include "ngraph/runtime/gpu/op/rnn.hpp"
+#include "ngraph/runtime/gpu/pass/gpu_loop_kernel_fusion.hpp"
 #include "ngraph/runtime/gpu/pass/gpu_rnn_fusion.hpp"
 #include "ngraph/serializer.hpp"
 #include "ngraph/util.hpp"
@@ -532,3 +534,90 @@ TEST(gpu_fusion, fuse_rnn_across_2layer_1timestep)
     }
 }
 #endif
+
+TEST(gpu_fusion, loop_kernel_fusion_elementwise)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        Shape shape{3, 300};
+        auto a = make_shared<op::Parameter>(element::f32, shape);
+        auto b = make_shared<op::Parameter>(element::f32, shape);
+        auto c = make_shared<op::Parameter>(element::f32, shape);
+        auto relu = make_shared<op::Relu>((a - b) * c);
+        auto neg = make_shared<op::Negative>(relu);
+        return make_shared<Function>(NodeVector{neg, relu}, ParameterVector{a, b, c});
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::gpu::pass::GPULoopKernelFusion>();
+    auto gpu_f = make_function();
+    auto int_f = make_function();
+    pass_manager.run_passes(gpu_f);
+    ASSERT_EQ(count_ops_of_type<op::gpu::LoopKernel>(gpu_f), 1);
+
+    test::Uniform<float> rng(-100.0f, 100.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : gpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto gpu_results = execute(gpu_f, args, "GPU");
+    for (size_t i = 0; i < gpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(gpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(gpu_fusion, loop_kernel_fusion_trailing_reductions)
+{
+    auto make_function = []() -> std::shared_ptr<Function> {
+        Shape shape{4, 2, 100};
+        auto a = make_shared<op::Parameter>(element::f32, shape);
+        auto b = make_shared<op::Parameter>(element::f32, shape);
+        auto mul = (a + b) * b;
+        auto abs_mul = make_shared<op::Abs>(mul);
+        auto sum = make_shared<op::Sum>(abs_mul, AxisSet{1, 2});
+        auto max = make_shared<op::Max>(mul, AxisSet{1, 2});
+        // abs_mul is both reduced inside the kernel and a live-out of it
+        return make_shared<Function>(NodeVector{sum, max, abs_mul}, ParameterVector{a, b});
+    };
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::gpu::pass::GPULoopKernelFusion>();
+    auto gpu_f = make_function();
+    auto int_f = make_function();
+    pass_manager.run_passes(gpu_f);
+    ASSERT_EQ(count_ops_of_type<op::gpu::LoopKernel>(gpu_f), 1);
+    ASSERT_EQ(count_ops_of_type<op::Sum>(gpu_f), 0);
+    ASSERT_EQ(count_ops_of_type<op::Max>(gpu_f), 0);
+
+    test::Uniform<float> rng(-10.0f, 10.0f);
+    vector<vector<float>> args;
+    for (shared_ptr<op::Parameter> param : gpu_f->get_parameters())
+    {
+        vector<float> tensor_val(shape_size(param->get_shape()));
+        rng.initialize(tensor_val);
+        args.push_back(tensor_val);
+    }
+    auto int_results = execute(int_f, args, "INTERPRETER");
+    auto gpu_results = execute(gpu_f, args, "GPU");
+    for (size_t i = 0; i < gpu_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(gpu_results.at(i), int_results.at(i), 1.0e-4f, 1.0e-4f));
+    }
+}
+
+TEST(gpu_fusion, loop_kernel_fusion_skips_non_f32)
+{
+    Shape shape{4, 8};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    auto b = make_shared<op::Parameter>(element::i32, shape);
+    auto f = make_shared<Function>((a + b) * b, ParameterVector{a, b});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::gpu::pass::GPULoopKernelFusion>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::gpu::LoopKernel>(f), 0);
+}
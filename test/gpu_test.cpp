@@ -15,11 +15,21 @@
 //*****************************************************************************
 
 #include <iostream>
+#include <numeric>
 #include <vector>
 
 #include "gtest/gtest.h"
+#include "misc.hpp"
+#include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/data_parallel/data_parallel_executable.hpp"
+#include "ngraph/runtime/gpu/cudnn_algorithm_cache.hpp"
+#include "ngraph/runtime/gpu/gpu_backend.hpp"
+#include "ngraph/runtime/gpu/gpu_caching_allocator.hpp"
+#include "ngraph/runtime/gpu/gpu_cuda_context_manager.hpp"
+#include "ngraph/runtime/gpu/gpu_kernel_cache.hpp"
 #include "ngraph/runtime/gpu/gpu_primitive_emitter.hpp"
+#include "ngraph/runtime/gpu/gpu_tensor.hpp"
 #include "ngraph/runtime/gpu/gpu_util.hpp"
 #include "ngraph/runtime/gpu/nvshape.hpp"
 #include "ngraph/util.hpp"
@@ -72,6 +82,38 @@ TEST(gpu_test, memory_manager_allocated)
     EXPECT_NO_THROW(mem_primitive());
 }
 
+TEST(gpu_test, memory_manager_shared_workspace)
+{
+    auto& device_allocator = runtime::gpu::GPUCachingAllocator::get();
+    runtime::gpu::GPUPrimitiveEmitter first, second;
+    size_t first_idx, second_idx;
+    {
+        auto allocator = first.get_memory_allocator();
+        first_idx = allocator.reserve_workspace(1000);
+    }
+    {
+        auto allocator = second.get_memory_allocator();
+        second_idx = allocator.reserve_workspace(1000);
+    }
+    first.allocate_primitive_memory();
+    second.allocate_primitive_memory();
+
+    // the workspace is only acquired on first use, and the reserved size is still reported
+    EXPECT_EQ(first.sizeof_device_allocation(), 1000);
+    void* workspace = first.get_memory_primitives()[first_idx]();
+    ASSERT_NE(workspace, nullptr);
+    first.release_primitive_memory();
+
+    size_t device_allocations = device_allocator.get_statistics().device_allocations;
+    EXPECT_EQ(second.get_memory_primitives()[second_idx](), workspace);
+    EXPECT_EQ(device_allocator.get_statistics().device_allocations, device_allocations);
+
+    auto stats = device_allocator.get_statistics();
+    EXPECT_GE(stats.in_use_bytes, stats.requested_bytes);
+    EXPECT_GE(stats.get_fragmentation(), 0.0);
+    EXPECT_LT(stats.get_fragmentation(), 1.0);
+}
+
 TEST(gpu_test, memory_manager_extract_arguments)
 {
     std::vector<float> fp32_args = {2112.0f, 2112.0f};
@@ -124,6 +166,53 @@ TEST(gpu_test, memory_manager_argspace_size)
     EXPECT_EQ(emitter.sizeof_device_allocation(), fp32_args.size() * sizeof(float));
 }
 
+TEST(gpu_test, memory_manager_usage)
+{
+    std::vector<float> fp32_args = {2112.0f, 2112.0f};
+    std::vector<float> constant = {1.0f, 2.0f, 3.0f};
+    auto process_usage = runtime::gpu::GPU_Backend::get_process_memory_usage();
+    {
+        runtime::gpu::GPUPrimitiveEmitter emitter;
+        {
+            auto allocator = emitter.get_memory_allocator();
+            allocator.reserve_argspace(fp32_args.data(), fp32_args.size() * sizeof(float));
+            allocator.reserve_constant(constant.data(), constant.size() * sizeof(float));
+            allocator.reserve_tensor_pool(64);
+            allocator.reserve_workspace(32);
+        }
+        // reservations are counted before they are allocated
+        auto usage = emitter.get_memory_usage();
+        EXPECT_EQ(usage.argspace, 8);
+        EXPECT_EQ(usage.constants, 16);
+        EXPECT_EQ(usage.tensors, 64);
+        EXPECT_EQ(usage.workspace, 32);
+
+        emitter.allocate_primitive_memory();
+        EXPECT_EQ(emitter.get_memory_usage().total(), usage.total());
+        EXPECT_EQ(runtime::gpu::GPU_Backend::get_process_memory_usage().total(),
+                  process_usage.total() + usage.total());
+    }
+    EXPECT_EQ(runtime::gpu::GPU_Backend::get_process_memory_usage().total(),
+              process_usage.total());
+}
+
+TEST(gpu_test, memory_budget)
+{
+    Shape shape{1024};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = op::Constant::create(element::f32, shape, vector<float>(shape_size(shape), 1.0f));
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A});
+
+    auto backend = runtime::Backend::create("GPU");
+    setenv("NGRAPH_GPU_MEMORY_BUDGET", "1024", 1);
+    EXPECT_THROW(backend->compile(f), ngraph_error);
+    setenv("NGRAPH_GPU_MEMORY_BUDGET", "1048576", 1);
+    auto handle = static_pointer_cast<runtime::gpu::GPU_Executable>(
+        backend->compile(clone_function(*f)));
+    unsetenv("NGRAPH_GPU_MEMORY_BUDGET");
+    EXPECT_EQ(handle->get_memory_usage().constants, shape_size(shape) * sizeof(float));
+}
+
 TEST(gpu_test, memory_manager_overlapping_workspace_allocsize)
 {
     runtime::gpu::GPUPrimitiveEmitter emitter;
@@ -301,3 +390,254 @@ TEST(gpu_test, maxpool_bprop_larger_than_cache)
     }
     EXPECT_EQ(expected_dx, read_vector<float>(dx_t));
 }
+
+TEST(gpu_test, staged_write_read)
+{
+    auto backend = runtime::Backend::create("GPU");
+
+    // Several staging chunks, with a partial last one
+    Shape shape{3 * 1024 * 1024 + 5};
+    vector<float> data(shape_size(shape));
+    for (size_t i = 0; i < data.size(); i++)
+    {
+        data[i] = static_cast<float>(i % 1000);
+    }
+    auto t = backend->create_tensor(element::f32, shape);
+    copy_data(t, data);
+    EXPECT_EQ(data, read_vector<float>(t));
+
+    // Partial writes land at their offset
+    vector<float> tail{-1, -2, -3};
+    t->write(tail.data(), (data.size() - 3) * sizeof(float), tail.size() * sizeof(float));
+    copy(tail.begin(), tail.end(), data.end() - 3);
+    EXPECT_EQ(data, read_vector<float>(t));
+}
+
+TEST(gpu_test, executables_run_on_own_streams)
+{
+    auto backend = runtime::Backend::create("GPU");
+    Shape shape{1024};
+    auto make_function = [&]() {
+        auto A = make_shared<op::Parameter>(element::f32, shape);
+        auto B = make_shared<op::Parameter>(element::f32, shape);
+        return make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+    };
+    auto exec_1 = static_pointer_cast<runtime::gpu::GPU_Executable>(
+        backend->compile(make_function()));
+    auto exec_2 = static_pointer_cast<runtime::gpu::GPU_Executable>(
+        backend->compile(make_function()));
+    EXPECT_NE(exec_1->get_stream(), exec_2->get_stream());
+
+    vector<float> a(shape_size(shape), 1);
+    vector<float> b(shape_size(shape), 2);
+    vector<float> result(shape_size(shape));
+    auto a_t =
+        static_pointer_cast<runtime::gpu::GPUTensor>(backend->create_tensor(element::f32, shape));
+    auto b_t =
+        static_pointer_cast<runtime::gpu::GPUTensor>(backend->create_tensor(element::f32, shape));
+    auto r_t =
+        static_pointer_cast<runtime::gpu::GPUTensor>(backend->create_tensor(element::f32, shape));
+
+    // Transfers queued on the stream of an executable are ordered with its calls
+    size_t n_bytes = shape_size(shape) * sizeof(float);
+    a_t->write_async(a.data(), 0, n_bytes, exec_1->get_stream());
+    b_t->write_async(b.data(), 0, n_bytes, exec_1->get_stream());
+    exec_1->call_with_validate({r_t}, {a_t, b_t});
+    r_t->read_async(result.data(), 0, n_bytes, exec_1->get_stream());
+    cudaStreamSynchronize(exec_1->get_stream());
+    EXPECT_EQ(vector<float>(shape_size(shape), 3), result);
+
+    auto r2_t = backend->create_tensor(element::f32, shape);
+    exec_2->call_with_validate({r2_t}, {r_t, b_t});
+    EXPECT_EQ(vector<float>(shape_size(shape), 5), read_vector<float>(r2_t));
+}
+
+TEST(gpu_test, cuda_graph_replay)
+{
+    set_environment("NGRAPH_GPU_CUDA_GRAPH", "1", 1);
+    auto backend = runtime::Backend::create("GPU");
+    Shape shape{2, 3};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto f = make_shared<Function>(make_shared<op::Multiply>(A + B, A), ParameterVector{A, B});
+    auto handle = backend->compile(f);
+    unset_environment("NGRAPH_GPU_CUDA_GRAPH");
+
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    // Direct first call, then a capture and replays of the graph
+    for (float i = 1; i <= 4; i++)
+    {
+        copy_data(a, vector<float>(shape_size(shape), i));
+        copy_data(b, vector<float>(shape_size(shape), 1));
+        handle->call_with_validate({result}, {a, b});
+        EXPECT_EQ(vector<float>(shape_size(shape), (i + 1) * i), read_vector<float>(result));
+    }
+
+    // Different tensors update the graph
+    auto other_result = backend->create_tensor(element::f32, shape);
+    handle->call_with_validate({other_result}, {b, a});
+    EXPECT_EQ(vector<float>(shape_size(shape), 5), read_vector<float>(other_result));
+}
+
+TEST(gpu_test, kernel_cache_round_trip)
+{
+    string directory = file_util::path_join(file_util::get_temp_directory_path(), "ngraph_kernels");
+    runtime::gpu::KernelCache cache(directory);
+    ASSERT_TRUE(cache.is_enabled());
+
+    // A context must be current to find the compute capability
+    runtime::gpu::CudaContextManager context;
+    context.SetContextCurrent();
+    const char* options[] = {"--gpu-architecture=compute_35"};
+    string kernel = "extern \"C\" __global__ void cuda_cache_test(float* x) { x[0] = 1; }";
+    string key = cache.get_key(kernel, 1, options);
+    EXPECT_EQ(key, cache.get_key(kernel, 1, options));
+    EXPECT_NE(key, cache.get_key(kernel + "\n", 1, options));
+
+    string ptx;
+    cache.store(key, "ptx contents");
+    ASSERT_TRUE(cache.load(key, ptx));
+    EXPECT_EQ(ptx, "ptx contents");
+    EXPECT_FALSE(cache.load(cache.get_key(kernel, 0, nullptr), ptx));
+}
+
+TEST(gpu_test, cudnn_algorithm_cache_persists)
+{
+    string path =
+        file_util::path_join(file_util::get_temp_directory_path(), "ngraph_cudnn_algos.txt");
+    remove(path.c_str());
+    string key;
+    {
+        runtime::gpu::CUDNNAlgorithmCache cache(path);
+        ASSERT_TRUE(cache.is_enabled());
+        string descriptor = "float_1x1x4x4_1x1x3x3_1x1x2x2_s1x1_d1x1_p0x0";
+        key = cache.get_key("forward", descriptor);
+        EXPECT_NE(key, cache.get_key("backward_data", descriptor));
+        runtime::gpu::CUDNNAlgorithmCache::Entry entry;
+        EXPECT_FALSE(cache.load(key, entry));
+        cache.store(key, {3, 1024});
+    }
+
+    // a new cache, as in a later process, reads the entry back from the file
+    runtime::gpu::CUDNNAlgorithmCache cache(path);
+    runtime::gpu::CUDNNAlgorithmCache::Entry entry;
+    ASSERT_TRUE(cache.load(key, entry));
+    EXPECT_EQ(entry.algo, 3);
+    EXPECT_EQ(entry.workspace_size, 1024u);
+    remove(path.c_str());
+}
+
+TEST(gpu_test, data_parallel_across_devices)
+{
+    int device_count = 0;
+    ASSERT_EQ(cudaGetDeviceCount(&device_count), cudaSuccess);
+    vector<shared_ptr<runtime::Backend>> replicas;
+    for (int i = 0; i < device_count; i++)
+    {
+        replicas.push_back(runtime::Backend::create("GPU:" + to_string(i)));
+    }
+
+    auto a = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto f = make_shared<Function>(make_shared<op::Multiply>(a, a), ParameterVector{a});
+    runtime::data_parallel::DataParallelExecutable executable(f, replicas);
+
+    Shape shape{7, 2};
+    vector<float> values(shape_size(shape));
+    iota(values.begin(), values.end(), 0);
+    auto& backend = replicas[0];
+    auto input = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(input, values);
+    ASSERT_TRUE(executable.call({result}, {input}));
+    vector<float> expected;
+    for (float v : values)
+    {
+        expected.push_back(v * v);
+    }
+    EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(result)));
+}
+
+TEST(gpu_test, chain_executables_on_device)
+{
+    auto backend = runtime::Backend::create("GPU");
+    Shape shape{2, 3};
+    auto a = make_shared<op::Parameter>(element::f32, shape);
+    auto b = make_shared<op::Parameter>(element::f32, shape);
+    auto first = backend->compile(
+        make_shared<Function>(make_shared<op::Add>(a, b), ParameterVector{a, b}));
+    auto c = make_shared<op::Parameter>(element::f32, shape);
+    auto second = backend->compile(
+        make_shared<Function>(make_shared<op::Multiply>(c, c), ParameterVector{c}));
+
+    auto x = backend->create_tensor(element::f32, shape);
+    auto y = backend->create_tensor(element::f32, shape);
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6});
+    copy_data(y, vector<float>{1, 1, 1, 1, 1, 1});
+
+    // The intermediate result lives in externally owned device memory and never leaves it
+    void* device_memory = nullptr;
+    ASSERT_EQ(cudaMalloc(&device_memory, shape_size(shape) * sizeof(float)), cudaSuccess);
+    auto intermediate = backend->create_tensor(element::f32, shape, device_memory);
+    auto result = backend->create_tensor(element::f32, shape);
+    ASSERT_TRUE(first->call_with_validate({intermediate}, {x, y}));
+    ASSERT_TRUE(second->call_with_validate({result}, {intermediate}));
+    EXPECT_EQ(static_cast<runtime::gpu::GPUTensor*>(intermediate.get())->m_allocated_buffer_pool,
+              device_memory);
+    EXPECT_EQ((vector<float>{4, 9, 16, 25, 36, 49}), read_vector<float>(result));
+
+    // Host memory is not accepted in place of device memory
+    vector<float> host_memory(shape_size(shape));
+    EXPECT_ANY_THROW(backend->create_tensor(element::f32, shape, host_memory.data()));
+    intermediate.reset();
+    cudaFree(device_memory);
+}
+
+TEST(gpu_test, tensor_op_math_matches_f32)
+{
+    Shape data_shape{2, 8, 10, 10};
+    Shape filter_shape{16, 8, 3, 3};
+    Shape weights_shape{16 * 8 * 8, 32};
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> filter_values(shape_size(filter_shape));
+    rng.initialize(filter_values);
+    auto make_function = [&]() {
+        auto data = make_shared<op::Parameter>(element::f32, data_shape);
+        // the constant filter is converted to f16 once, at compile time
+        auto filter = op::Constant::create(element::f32, filter_shape, filter_values);
+        auto conv = make_shared<op::Convolution>(data, filter);
+        auto flat = make_shared<op::Reshape>(conv, AxisVector{0, 1, 2, 3}, Shape{2, 16 * 8 * 8});
+        auto weights = make_shared<op::Parameter>(element::f32, weights_shape);
+        auto dot = make_shared<op::Dot>(flat, weights);
+        return make_shared<Function>(NodeVector{conv, dot}, ParameterVector{data, weights});
+    };
+
+    auto backend = runtime::Backend::create("GPU");
+    auto f32_handle = backend->compile(make_function());
+    set_environment("NGRAPH_GPU_TENSOR_OP_MATH", "1", 1);
+    auto f16_handle = backend->compile(make_function());
+    unset_environment("NGRAPH_GPU_TENSOR_OP_MATH");
+
+    auto data = backend->create_tensor(element::f32, data_shape);
+    auto weights = backend->create_tensor(element::f32, weights_shape);
+    vector<float> data_values(shape_size(data_shape));
+    vector<float> weights_values(shape_size(weights_shape));
+    rng.initialize(data_values);
+    rng.initialize(weights_values);
+    copy_data(data, data_values);
+    copy_data(weights, weights_values);
+
+    vector<vector<float>> results;
+    for (auto handle : {f32_handle, f16_handle})
+    {
+        auto conv = backend->create_tensor(element::f32, Shape{2, 16, 8, 8});
+        auto dot = backend->create_tensor(element::f32, Shape{2, 32});
+        handle->call_with_validate({conv, dot}, {data, weights});
+        results.push_back(read_vector<float>(conv));
+        results.push_back(read_vector<float>(dot));
+    }
+    // f16 inputs keep about three significant digits, accumulation is in f32
+    EXPECT_TRUE(test::all_close(results[0], results[2], 1.0e-2f, 1.0e-2f));
+    EXPECT_TRUE(test::all_close(results[1], results[3], 1.0e-2f, 5.0e-2f));
+}
@@ -0,0 +1,110 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/accumulation/gradient_accumulation_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// loss = sum(x * w), with the gradient of the loss with respect to w, x, as result 1
+static shared_ptr<Function> make_training_function()
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto w = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto loss = make_shared<op::Sum>(make_shared<op::Multiply>(x, w), AxisSet{0});
+    return make_shared<Function>(NodeVector{loss, x}, ParameterVector{x, w});
+}
+
+// w' = w - 0.5 * g
+static shared_ptr<Function> make_update_function()
+{
+    auto g = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto w = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto rate = op::Constant::create(element::f32, Shape{2}, {0.5, 0.5});
+    auto w_next = make_shared<op::Subtract>(w, make_shared<op::Multiply>(rate, g));
+    return make_shared<Function>(NodeVector{w_next}, ParameterVector{g, w});
+}
+
+NGRAPH_TEST(gradient_accumulation_${BACKEND_NAME}, updates_on_step_boundary)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::accumulation::GradientAccumulationExecutable executable(
+        backend, make_training_function(), {1}, make_update_function(), 2);
+    ASSERT_EQ(executable.get_parameters().size(), 3);
+    ASSERT_EQ(executable.get_results().size(), 2);
+
+    auto x = backend->create_tensor(element::f32, Shape{2});
+    auto w = backend->create_tensor(element::f32, Shape{2});
+    auto loss = backend->create_tensor(element::f32, Shape{});
+    copy_data(w, vector<float>{1, 2});
+
+    // the weights are updated in place
+    copy_data(x, vector<float>{1, 1});
+    ASSERT_TRUE(executable.call_with_validate({loss, w}, {x, w, w}));
+    EXPECT_EQ(executable.get_pending_calls(), 1);
+    EXPECT_TRUE(test::all_close_f((vector<float>{3}), read_vector<float>(loss)));
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 2}), read_vector<float>(w)));
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 1}),
+                                  read_vector<float>(executable.get_accumulator(0))));
+
+    copy_data(x, vector<float>{2, 4});
+    ASSERT_TRUE(executable.call_with_validate({loss, w}, {x, w, w}));
+    EXPECT_EQ(executable.get_pending_calls(), 0);
+    EXPECT_TRUE(test::all_close_f((vector<float>{10}), read_vector<float>(loss)));
+    EXPECT_TRUE(test::all_close_f((vector<float>{-0.5, -0.5}), read_vector<float>(w)));
+    EXPECT_TRUE(test::all_close_f((vector<float>{0, 0}),
+                                  read_vector<float>(executable.get_accumulator(0))));
+}
+
+NGRAPH_TEST(gradient_accumulation_${BACKEND_NAME}, reset)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::accumulation::GradientAccumulationExecutable executable(
+        backend, make_training_function(), {1}, make_update_function(), 2);
+
+    auto x = backend->create_tensor(element::f32, Shape{2});
+    auto w = backend->create_tensor(element::f32, Shape{2});
+    auto loss = backend->create_tensor(element::f32, Shape{});
+    copy_data(w, vector<float>{1, 2});
+    copy_data(x, vector<float>{8, 8});
+    ASSERT_TRUE(executable.call({loss, w}, {x, w, w}));
+
+    // the gradient of the first call is discarded, the step ends two calls later
+    executable.reset();
+    EXPECT_EQ(executable.get_pending_calls(), 0);
+    copy_data(x, vector<float>{1, 2});
+    ASSERT_TRUE(executable.call({loss, w}, {x, w, w}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 2}), read_vector<float>(w)));
+    ASSERT_TRUE(executable.call({loss, w}, {x, w, w}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{0, 0}), read_vector<float>(w)));
+}
+
+NGRAPH_TEST(gradient_accumulation_${BACKEND_NAME}, mismatched_update)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto g = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto update = make_shared<Function>(make_shared<op::Negative>(g), ParameterVector{g});
+    EXPECT_ANY_THROW(runtime::accumulation::GradientAccumulationExecutable(
+        backend, make_training_function(), {1}, update, 2));
+}
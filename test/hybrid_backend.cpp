@@ -29,6 +29,7 @@
 #include "ngraph/runtime/hybrid/hybrid_backend.hpp"
 #include "ngraph/runtime/hybrid/hybrid_util.hpp"
 #include "ngraph/runtime/hybrid/op/function_call.hpp"
+#include "ngraph/runtime/hybrid/pass/cost_placement.hpp"
 #include "ngraph/runtime/interpreter/int_backend.hpp"
 #include "util/all_close.hpp"
 #include "util/all_close_f.hpp"
@@ -102,12 +103,58 @@ TEST(HYBRID, function_call)
 
     auto exec = backend->compile(f);
     exec->call({r0, r1}, {a, b, c});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(r0), vector<float>{20}));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(r1), vector<float>{24}));
 
     ngraph::pass::Manager pass_manager;
     pass_manager.register_pass<ngraph::pass::VisualizeTree>("test.png");
     pass_manager.run_passes(f);
 }
 
+TEST(HYBRID, memory_attach)
+{
+    auto backend = make_shared<runtime::interpreter::INTBackend>();
+    EXPECT_TRUE(backend->is_supported_property(runtime::Backend::Property::memory_attach));
+}
+
+TEST(HYBRID, cost_placement)
+{
+    vector<string> unsupported_0 = {"Add"};
+    vector<shared_ptr<runtime::Backend>> backend_list = {
+        make_shared<runtime::interpreter::INTBackend>(unsupported_0),
+        make_shared<runtime::interpreter::INTBackend>()};
+
+    Shape shape{2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto t1 = A + B;
+    auto t2 = make_shared<op::Negative>(make_shared<op::Abs>(t1));
+    auto t3 = t2 + B;
+    auto f = make_shared<Function>(t3, ParameterVector{A, B});
+
+    ngraph::pass::Manager pass_manager;
+    pass_manager.register_pass<runtime::hybrid::pass::CostPlacement>(backend_list);
+    pass_manager.run_passes(f);
+
+    // The ops between the two Adds are too small to be worth two more crossings
+    for (auto node : f->get_ordered_ops())
+    {
+        size_t expected = node->is_parameter() || node->is_output() ? 0 : 1;
+        EXPECT_EQ(expected, node->get_placement_index()) << node->get_name();
+    }
+
+    auto backend = make_shared<runtime::hybrid::HybridBackend>(backend_list);
+    auto a = backend->create_tensor(element::f32, shape);
+    auto b = backend->create_tensor(element::f32, shape);
+    auto result = backend->create_tensor(element::f32, shape);
+    copy_data(a, vector<float>{1, -2});
+    copy_data(b, vector<float>{3, 4});
+
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {a, b});
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result), (vector<float>{-1, 2})));
+}
+
 TEST(HYBRID, abc)
 {
     const string backend_name = "H1";
@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <memory>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/lazy/lazy_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+static shared_ptr<Function> make_scaled_add(float scale)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto b = make_shared<op::Parameter>(element::f32, Shape{2, 2});
+    auto c = op::Constant::create(element::f32, Shape{2, 2}, vector<float>(4, scale));
+    return make_shared<Function>(make_shared<op::Multiply>(make_shared<op::Add>(a, b), c),
+                                 ParameterVector{a, b});
+}
+
+NGRAPH_TEST(lazy_${BACKEND_NAME}, call_waits_for_compile)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::lazy::LazyExecutable lazy(make_scaled_add(2), backend);
+    ASSERT_EQ(lazy.get_parameters().size(), 2);
+    ASSERT_EQ(lazy.get_results().size(), 1);
+
+    auto a = backend->create_tensor(element::f32, Shape{2, 2});
+    auto b = backend->create_tensor(element::f32, Shape{2, 2});
+    auto result = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{5, 6, 7, 8});
+
+    ASSERT_TRUE(lazy.call_with_validate({result}, {a, b}));
+    EXPECT_TRUE(lazy.is_ready());
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(result),
+                                  (vector<float>{12, 16, 20, 24}),
+                                  MIN_FLOAT_TOLERANCE_BITS));
+}
+
+NGRAPH_TEST(lazy_${BACKEND_NAME}, many_variants)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    vector<unique_ptr<runtime::lazy::LazyExecutable>> variants;
+    for (size_t i = 0; i < 8; i++)
+    {
+        // The last variant jumps the queue of the background ones
+        auto priority = (i == 7 ? runtime::lazy::CompilePriority::INTERACTIVE
+                                : runtime::lazy::CompilePriority::BACKGROUND);
+        variants.emplace_back(new runtime::lazy::LazyExecutable(
+            make_scaled_add(static_cast<float>(i)), backend, priority));
+    }
+
+    auto a = backend->create_tensor(element::f32, Shape{2, 2});
+    auto b = backend->create_tensor(element::f32, Shape{2, 2});
+    copy_data(a, vector<float>{1, 2, 3, 4});
+    copy_data(b, vector<float>{0, 0, 0, 0});
+    for (size_t i = variants.size(); i-- > 0;)
+    {
+        auto result = backend->create_tensor(element::f32, Shape{2, 2});
+        ASSERT_TRUE(variants[i]->call_with_validate({result}, {a, b}));
+        float x = static_cast<float>(i);
+        EXPECT_TRUE(test::all_close_f(read_vector<float>(result),
+                                      (vector<float>{x, 2 * x, 3 * x, 4 * x}),
+                                      MIN_FLOAT_TOLERANCE_BITS));
+    }
+}
+
+NGRAPH_TEST(lazy_${BACKEND_NAME}, destroyed_before_compile)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    for (size_t i = 0; i < 16; i++)
+    {
+        runtime::lazy::LazyExecutable lazy(make_scaled_add(1), backend);
+    }
+    runtime::lazy::LazyExecutable lazy(make_scaled_add(1), backend);
+    EXPECT_NE(lazy.get_executable(), nullptr);
+}
@@ -0,0 +1,83 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <string>
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/except.hpp"
+#include "ngraph/metrics.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(metrics, prometheus_format)
+{
+    PrometheusMetricsSink sink({0.5, 2});
+    sink.add_counter("requests_total", {{"backend", "CPU"}}, 2);
+    sink.add_counter("requests_total", {{"backend", "CPU"}}, 1);
+    sink.add_counter("requests_total", {{"backend", "a\"b\\c"}}, 1);
+    sink.set_gauge("bytes", {}, 10);
+    sink.set_gauge("bytes", {}, 4096);
+    for (double value : {0.25, 0.5, 1.0, 3.0})
+    {
+        sink.observe("latency_seconds", {{"backend", "CPU"}}, value);
+    }
+
+    EXPECT_EQ(sink.str(),
+              "# TYPE bytes gauge\n"
+              "bytes 4096\n"
+              "# TYPE latency_seconds histogram\n"
+              "latency_seconds_bucket{backend=\"CPU\",le=\"0.5\"} 2\n"
+              "latency_seconds_bucket{backend=\"CPU\",le=\"2\"} 3\n"
+              "latency_seconds_bucket{backend=\"CPU\",le=\"+Inf\"} 4\n"
+              "latency_seconds_sum{backend=\"CPU\"} 4.75\n"
+              "latency_seconds_count{backend=\"CPU\"} 4\n"
+              "# TYPE requests_total counter\n"
+              "requests_total{backend=\"CPU\"} 3\n"
+              "requests_total{backend=\"a\\\"b\\\\c\"} 1\n");
+
+    // A metric keeps the type it was first reported with
+    EXPECT_THROW(sink.set_gauge("requests_total", {}, 1), ngraph_error);
+    EXPECT_THROW(PrometheusMetricsSink({2, 1}), ngraph_error);
+
+    sink.clear();
+    EXPECT_EQ(sink.str(), "");
+}
+
+TEST(metrics, sink)
+{
+    EXPECT_FALSE(Metrics::is_enabled());
+    // Nothing is recorded without a sink
+    Metrics::count_cache_lookup("test", true);
+
+    auto sink = make_shared<PrometheusMetricsSink>();
+    Metrics::set_sink(sink);
+    EXPECT_TRUE(Metrics::is_enabled());
+    EXPECT_EQ(Metrics::get_sink(), sink);
+    Metrics::count_cache_lookup("test", true);
+    Metrics::count_cache_lookup("test", true);
+    Metrics::count_cache_lookup("test", false);
+    Metrics::set_sink(nullptr);
+    EXPECT_FALSE(Metrics::is_enabled());
+    Metrics::count_cache_lookup("test", false);
+
+    EXPECT_EQ(sink->str(),
+              "# TYPE ngraph_cache_lookups_total counter\n"
+              "ngraph_cache_lookups_total{cache=\"test\",result=\"hit\"} 2\n"
+              "ngraph_cache_lookups_total{cache=\"test\",result=\"miss\"} 1\n");
+}
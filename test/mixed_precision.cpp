@@ -0,0 +1,112 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/mixed_precision.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(mixed_precision, dot_runs_in_low_precision)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto dot = make_shared<op::Dot>(A, B);
+    auto f = make_shared<Function>(make_shared<op::Relu>(dot), ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MixedPrecision>(element::bf16);
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(dot->get_output_element_type(0), element::bf16);
+    // Relu follows its converted input, then one Convert restores f32 for the result
+    EXPECT_EQ(count_ops_of_type<op::Convert>(f), 3);
+    auto result = f->get_results().at(0);
+    EXPECT_EQ(result->get_element_type(), element::f32);
+    EXPECT_TRUE(dynamic_pointer_cast<op::Convert>(result->get_argument(0)));
+    EXPECT_EQ(result->get_argument(0)->get_argument(0)->get_element_type(), element::bf16);
+}
+
+TEST(mixed_precision, deny_list_stays_f32)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto dot = make_shared<op::Dot>(A, B);
+    auto softmax = make_shared<op::Softmax>(dot, AxisSet{1});
+    auto f = make_shared<Function>(softmax, ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MixedPrecision>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(dot->get_output_element_type(0), element::f16);
+    EXPECT_EQ(softmax->get_input_element_type(0), element::f32);
+    EXPECT_EQ(softmax->get_output_element_type(0), element::f32);
+}
+
+TEST(mixed_precision, unlisted_ops_without_converted_inputs_stay_f32)
+{
+    Shape shape{4};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto add = make_shared<op::Add>(A, B);
+    auto f = make_shared<Function>(add, ParameterVector{A, B});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::MixedPrecision>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(add->get_output_element_type(0), element::f32);
+    EXPECT_EQ(count_ops_of_type<op::Convert>(f), 0);
+}
+
+TEST(mixed_precision, pass_config_attributes)
+{
+    pass::PassConfig pass_config;
+    pass_config.set_pass_attribute("MixedPrecision::Deny::Dot", true);
+    pass_config.set_pass_attribute("MixedPrecision::Allow::Add", true);
+    pass_config.set_pass_attribute("MixedPrecision::Deny::Softmax", false);
+    pass::MixedPrecision mixed_precision(element::f16, pass_config);
+
+    EXPECT_EQ(mixed_precision.get_allow_list().count("Dot"), 0);
+    EXPECT_EQ(mixed_precision.get_deny_list().count("Dot"), 1);
+    EXPECT_EQ(mixed_precision.get_allow_list().count("Add"), 1);
+    EXPECT_EQ(mixed_precision.get_deny_list().count("Softmax"), 0);
+
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto dot = make_shared<op::Dot>(A, B);
+    auto add = make_shared<op::Add>(dot, B);
+    auto f = make_shared<Function>(add, ParameterVector{A, B});
+
+    mixed_precision.run_on_function(f);
+    EXPECT_EQ(dot->get_output_element_type(0), element::f32);
+    EXPECT_EQ(add->get_output_element_type(0), element::f16);
+}
+
+TEST(mixed_precision, reject_wide_types)
+{
+    EXPECT_THROW(pass::MixedPrecision(element::f32), ngraph_error);
+    EXPECT_THROW(pass::MixedPrecision(element::i8), ngraph_error);
+}
@@ -0,0 +1,93 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <memory>
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/backend.hpp"
+#include "ngraph/runtime/nop/nop_backend.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static shared_ptr<Function> make_dot_add()
+{
+    Shape shape{64, 64};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto dot = make_shared<op::Dot>(A, B);
+    auto add = make_shared<op::Add>(dot, A);
+    return make_shared<Function>(make_shared<op::Abs>(add), ParameterVector{A, B});
+}
+
+TEST(NOP, simulate_roofline)
+{
+    // Dot is 2 * 64^3 FLOPs over 3 * 64^2 * 4 bytes, the rest only move bytes
+    auto backend = runtime::Backend::create("NOP:simulate,peak_gflops=1,peak_gbps=1");
+    auto f = make_dot_add();
+    auto handle = backend->compile(f);
+
+    auto a = backend->create_tensor(element::f32, Shape{64, 64});
+    auto b = backend->create_tensor(element::f32, Shape{64, 64});
+    auto result = backend->create_tensor(element::f32, Shape{64, 64});
+    handle->call_with_validate({result}, {a, b});
+    handle->call_with_validate({result}, {a, b});
+
+    map<string, size_t> totals;
+    for (const runtime::PerformanceCounter& counter : handle->get_performance_data())
+    {
+        EXPECT_EQ(counter.call_count(), 2);
+        totals[counter.get_node()->description()] = counter.total_microseconds();
+    }
+    ASSERT_EQ(totals.size(), 3);
+    // totals are rounded after scaling by the call count
+    EXPECT_EQ(totals["Dot"], 1049);
+    EXPECT_EQ(totals["Add"], 98);
+    EXPECT_EQ(totals["Abs"], 66);
+
+    auto nop = static_pointer_cast<runtime::nop::NOPExecutable>(handle);
+    EXPECT_NEAR(nop->get_estimated_microseconds(), 524.288 + 49.152 + 32.768, 1e-6);
+}
+
+TEST(NOP, simulate_memory_plan)
+{
+    auto backend = runtime::Backend::create("NOP:simulate");
+    auto handle = backend->compile(make_dot_add());
+
+    // Dot and Add are temporaries that are live together, Abs is an output
+    runtime::MemoryStatistics stats = handle->get_memory_statistics();
+    EXPECT_EQ(stats.temporary_bytes, 2 * 64 * 64 * 4);
+    EXPECT_EQ(stats.constant_bytes, 0);
+    ASSERT_FALSE(stats.largest_tensors.empty());
+    EXPECT_EQ(stats.largest_tensors[0].size, 64 * 64 * 4);
+}
+
+TEST(NOP, no_simulation_by_default)
+{
+    auto backend = runtime::Backend::create("NOP");
+    auto handle = backend->compile(make_dot_add());
+    EXPECT_TRUE(handle->get_performance_data().empty());
+    EXPECT_EQ(handle->get_memory_statistics().temporary_bytes, 0);
+}
+
+TEST(NOP, unknown_attribute)
+{
+    EXPECT_ANY_THROW(runtime::Backend::create("NOP:simulate,peak_tflops=1"));
+}
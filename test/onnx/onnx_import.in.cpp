@@ -115,6 +115,19 @@ NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_initializers)
     EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
 }
 
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_add_abc_raw_initializers)
+{
+    // the Constant refers to the raw data of the protobuf, which must outlive the import
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc_raw_initializers.prototxt"));
+
+    Inputs inputs{{1, 2, 3, 4}};
+    Outputs expected_outputs{{2, 4, 6, 8}};
+
+    Outputs outputs{execute(function, inputs, "${BACKEND_NAME}")};
+    EXPECT_TRUE(test::all_close_f(expected_outputs.front(), outputs.front()));
+}
+
 NGRAPH_TEST(onnx_${BACKEND_NAME}, model_override_op)
 {
     onnx_import::register_operator(
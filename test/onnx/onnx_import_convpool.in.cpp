@@ -79,6 +79,27 @@ NGRAPH_TEST(onnx_${BACKEND_NAME}, model_conv2d_strides_padding)
     EXPECT_EQ(expected_output, result.front());
 }
 
+NGRAPH_TEST(onnx_${BACKEND_NAME}, model_conv2d_strides_padding_bias_relu)
+{
+    // Convolution with strides=2, padding=1 and bias=-100, followed by Relu
+    auto function = onnx_import::import_onnx_model(
+        file_util::path_join(SERIALIZED_ZOO, "onnx/conv_with_strides_padding_bias_relu.prototxt"));
+
+    // The importer fuses the whole pattern into one op
+    EXPECT_EQ(count_ops_of_type<op::ConvolutionBias>(function), 1);
+    EXPECT_EQ(count_ops_of_type<op::Relu>(function), 0);
+
+    // (1, 1, 4, 3)
+    auto expected_output = test::NDArray<float, 4>({{{{0.f, 0.f, 0.f},
+                                                      {0.f, 8.f, 0.f},
+                                                      {23.f, 98.f, 41.f},
+                                                      {12.f, 77.f, 24.f}}}})
+                               .get_vector();
+
+    auto result = conv2d_execute(function);
+    EXPECT_EQ(expected_output, result.front());
+}
+
 NGRAPH_TEST(onnx_${BACKEND_NAME}, model_conv2d_strides_no_padding)
 {
     // Convolution with strides=2 and padding=1
@@ -15,10 +15,14 @@
 //*****************************************************************************
 
 #include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
 
 #include <gtest/gtest.h>
 #include <onnxifi.h>
 
+#include "ngraph/file_util.hpp"
 #include "ngraph/runtime/backend_manager.hpp"
 
 // ===============================================[ onnxGetBackendIDs ] =======
@@ -68,3 +72,140 @@ TEST(onnxifi, get_backend_ids_consistency_check)
     EXPECT_TRUE(first_count == second_count);
     EXPECT_TRUE(std::memcmp(first_ids, second_ids, first_count) == 0);
 }
+
+// ===============================================[ onnxInitEvent ] ===========
+
+namespace
+{
+    ::onnxBackend init_backend()
+    {
+        ::onnxBackendID backendIDs[g_default_backend_ids_count];
+        std::size_t count{g_default_backend_ids_count};
+        ::onnxBackend backend{nullptr};
+        if ((::onnxGetBackendIDs(backendIDs, &count) != ONNXIFI_STATUS_SUCCESS) ||
+            (::onnxInitBackend(backendIDs[0], nullptr, &backend) != ONNXIFI_STATUS_SUCCESS))
+        {
+            return nullptr;
+        }
+        return backend;
+    }
+
+    ::onnxTensorDescriptorV1 make_descriptor(const char* name, float* buffer)
+    {
+        static const std::uint64_t shape[]{1};
+        ::onnxTensorDescriptorV1 descriptor;
+        descriptor.tag = ONNXIFI_TAG_TENSOR_DESCRIPTOR_V1;
+        descriptor.name = name;
+        descriptor.dataType = ONNXIFI_DATATYPE_FLOAT32;
+        descriptor.memoryType = ONNXIFI_MEMORY_TYPE_CPU;
+        descriptor.dimensions = 1;
+        descriptor.shape = shape;
+        descriptor.buffer = reinterpret_cast<::onnxPointer>(buffer);
+        return descriptor;
+    }
+
+    ::onnxGraph init_add_abc_graph(::onnxBackend backend)
+    {
+        std::ifstream file{
+            ngraph::file_util::path_join(SERIALIZED_ZOO, "onnx/add_abc.prototxt")};
+        std::string model{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+        ::onnxGraph graph{nullptr};
+        if (::onnxInitGraph(backend, nullptr, model.size(), model.data(), 0, nullptr, &graph) !=
+            ONNXIFI_STATUS_SUCCESS)
+        {
+            return nullptr;
+        }
+        return graph;
+    }
+}
+
+TEST(onnxifi, event_signal_twice)
+{
+    ::onnxBackend backend{init_backend()};
+    ASSERT_TRUE(backend != nullptr);
+    ::onnxEvent event{nullptr};
+    EXPECT_TRUE(::onnxInitEvent(backend, &event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxSignalEvent(event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxWaitEvent(event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxSignalEvent(event) == ONNXIFI_STATUS_INVALID_STATE);
+    EXPECT_TRUE(::onnxReleaseEvent(event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+}
+
+TEST(onnxifi, event_null)
+{
+    EXPECT_TRUE(::onnxSignalEvent(nullptr) == ONNXIFI_STATUS_INVALID_EVENT);
+    EXPECT_TRUE(::onnxWaitEvent(nullptr) == ONNXIFI_STATUS_INVALID_EVENT);
+    EXPECT_TRUE(::onnxReleaseEvent(nullptr) == ONNXIFI_STATUS_INVALID_EVENT);
+}
+
+// ===============================================[ onnxRunGraph ] ============
+
+TEST(onnxifi, run_graph)
+{
+    ::onnxBackend backend{init_backend()};
+    ASSERT_TRUE(backend != nullptr);
+    ::onnxGraph graph{init_add_abc_graph(backend)};
+    ASSERT_TRUE(graph != nullptr);
+
+    float a{1}, b{2}, c{3}, y{0};
+    // matched by name, not by position
+    ::onnxTensorDescriptorV1 inputs[]{
+        make_descriptor("C", &c), make_descriptor("A", &a), make_descriptor("B", &b)};
+    ::onnxTensorDescriptorV1 outputs[]{make_descriptor("Y", &y)};
+    EXPECT_TRUE(::onnxSetGraphIO(graph, 3, inputs, 1, outputs) == ONNXIFI_STATUS_SUCCESS);
+
+    ::onnxEvent input_event{nullptr};
+    EXPECT_TRUE(::onnxInitEvent(backend, &input_event) == ONNXIFI_STATUS_SUCCESS);
+    ::onnxMemoryFenceV1 input_fence;
+    input_fence.tag = ONNXIFI_TAG_MEMORY_FENCE_V1;
+    input_fence.type = ONNXIFI_SYNCHRONIZATION_EVENT;
+    input_fence.event = input_event;
+    ::onnxMemoryFenceV1 output_fence;
+    output_fence.tag = ONNXIFI_TAG_MEMORY_FENCE_V1;
+    output_fence.type = ONNXIFI_SYNCHRONIZATION_EVENT;
+    EXPECT_TRUE(::onnxRunGraph(graph, &input_fence, &output_fence) == ONNXIFI_STATUS_SUCCESS);
+    // the run waits for the input fence
+    EXPECT_TRUE(y == 0);
+    EXPECT_TRUE(::onnxSignalEvent(input_event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxWaitEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(y == 6);
+    EXPECT_TRUE(::onnxReleaseEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+
+    // the bound buffers are read in place by every run
+    a = 10;
+    input_fence.type = ONNXIFI_SYNCHRONIZATION_IMPLICIT;
+    EXPECT_TRUE(::onnxRunGraph(graph, &input_fence, &output_fence) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxWaitEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(y == 15);
+    EXPECT_TRUE(::onnxReleaseEvent(output_fence.event) == ONNXIFI_STATUS_SUCCESS);
+
+    EXPECT_TRUE(::onnxReleaseEvent(input_event) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseGraph(graph) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+}
+
+TEST(onnxifi, set_graph_io_unidentified_name)
+{
+    ::onnxBackend backend{init_backend()};
+    ASSERT_TRUE(backend != nullptr);
+    ::onnxGraph graph{init_add_abc_graph(backend)};
+    ASSERT_TRUE(graph != nullptr);
+
+    float a{1}, b{2}, c{3}, y{0};
+    ::onnxTensorDescriptorV1 inputs[]{
+        make_descriptor("A", &a), make_descriptor("B", &b), make_descriptor("D", &c)};
+    ::onnxTensorDescriptorV1 outputs[]{make_descriptor("Y", &y)};
+    EXPECT_TRUE(::onnxSetGraphIO(graph, 3, inputs, 1, outputs) ==
+                ONNXIFI_STATUS_UNIDENTIFIED_NAME);
+    // without bound inputs and outputs the graph can not run
+    ::onnxMemoryFenceV1 input_fence;
+    input_fence.tag = ONNXIFI_TAG_MEMORY_FENCE_V1;
+    input_fence.type = ONNXIFI_SYNCHRONIZATION_IMPLICIT;
+    ::onnxMemoryFenceV1 output_fence{input_fence};
+    EXPECT_TRUE(::onnxRunGraph(graph, &input_fence, &output_fence) ==
+                ONNXIFI_STATUS_INVALID_STATE);
+
+    EXPECT_TRUE(::onnxReleaseGraph(graph) == ONNXIFI_STATUS_SUCCESS);
+    EXPECT_TRUE(::onnxReleaseBackend(backend) == ONNXIFI_STATUS_SUCCESS);
+}
@@ -0,0 +1,99 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "gtest/gtest.h"
+
+#include "ngraph/ngraph.hpp"
+#include "ngraph/op/experimental/batch_mat_mul.hpp"
+#include "ngraph/runtime/op_cost.hpp"
+#include "ngraph/runtime/performance_counter.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+TEST(op_cost, dot)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{8, 16});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{16, 4});
+    auto dot = make_shared<op::Dot>(A, B);
+
+    auto cost = runtime::get_op_cost(*dot);
+    EXPECT_EQ(cost.flops, 2 * 8 * 16 * 4);
+    EXPECT_EQ(cost.input_bytes, (8 * 16 + 16 * 4) * 4);
+    EXPECT_EQ(cost.output_bytes, 8 * 4 * 4);
+    EXPECT_DOUBLE_EQ(cost.arithmetic_intensity(),
+                     static_cast<double>(cost.flops) / (cost.input_bytes + cost.output_bytes));
+}
+
+TEST(op_cost, batch_mat_mul)
+{
+    auto A = make_shared<op::Parameter>(element::f64, Shape{3, 8, 16});
+    auto B = make_shared<op::Parameter>(element::f64, Shape{3, 16, 4});
+    auto bmm = make_shared<op::BatchMatMul>(A, B);
+    EXPECT_EQ(runtime::get_op_cost(*bmm).flops, 2 * 3 * 8 * 16 * 4);
+}
+
+TEST(op_cost, convolution)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8, 8});
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{5, 3, 3, 3});
+    auto conv = make_shared<op::Convolution>(data, filters);
+    ASSERT_EQ(conv->get_shape(), (Shape{2, 5, 6, 6}));
+    EXPECT_EQ(runtime::get_op_cost(*conv).flops, 2 * (2 * 5 * 6 * 6) * (3 * 3 * 3));
+}
+
+TEST(op_cost, elementwise_and_reductions)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4, 5});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{4, 5});
+    EXPECT_EQ(runtime::get_op_cost(*make_shared<op::Add>(A, B)).flops, 20);
+    EXPECT_EQ(runtime::get_op_cost(*make_shared<op::Tanh>(A)).flops, 20);
+    EXPECT_EQ(runtime::get_op_cost(*make_shared<op::Sum>(A, AxisSet{1})).flops, 20);
+
+    // Data movement moves bytes but does no arithmetic
+    auto reshape = make_shared<op::Reshape>(A, AxisVector{1, 0}, Shape{5, 4});
+    auto cost = runtime::get_op_cost(*reshape);
+    EXPECT_EQ(cost.flops, 0);
+    EXPECT_EQ(cost.bytes(), 2 * 20 * 4);
+
+    EXPECT_EQ(runtime::get_op_cost(*A).bytes(), 0);
+}
+
+TEST(op_cost, dynamic_shapes_cost_nothing)
+{
+    auto A = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 4});
+    auto B = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 4});
+    auto cost = runtime::get_op_cost(*make_shared<op::Add>(A, B));
+    EXPECT_EQ(cost.flops, 0);
+    EXPECT_EQ(cost.bytes(), 0);
+}
+
+TEST(op_cost, performance_counter_rates)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{250, 1000});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{250, 1000});
+    auto add = make_shared<op::Add>(A, B);
+
+    // 10 calls of 250k flops and 3MB in 1ms
+    runtime::PerformanceCounter counter(add, 1000, 10);
+    EXPECT_EQ(counter.get_cost().flops, 250000);
+    EXPECT_DOUBLE_EQ(counter.gflops(), 2.5);
+    EXPECT_DOUBLE_EQ(counter.gbytes_per_second(), 30);
+
+    runtime::PerformanceCounter untimed(add, 0, 0);
+    EXPECT_EQ(untimed.gflops(), 0);
+}
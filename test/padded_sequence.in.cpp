@@ -0,0 +1,94 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/sequence/padded_sequence_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// y = x * x over a {2, ?, 2} sequence batch, and the mean of x over the sequence axis, which
+// divides by the length parameter so that the zero padding does not count
+static shared_ptr<Function> make_sequence_function(shared_ptr<op::Parameter>& length)
+{
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape{2, Dimension::dynamic(), 2});
+    length = make_shared<op::Parameter>(element::i64, Shape{});
+    auto y = make_shared<op::Multiply>(x, x);
+    auto count = make_shared<op::Broadcast>(
+        make_shared<op::Convert>(length, element::f32), Shape{2, 2}, AxisSet{0, 1});
+    auto mean = make_shared<op::Divide>(make_shared<op::Sum>(x, AxisSet{1}), count);
+    return make_shared<Function>(NodeVector{y, mean}, ParameterVector{x, length});
+}
+
+NGRAPH_TEST(padded_sequence_${BACKEND_NAME}, variable_lengths)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    shared_ptr<op::Parameter> length;
+    auto f = make_sequence_function(length);
+    runtime::sequence::PaddedSequenceExecutable executable(backend, f, 4, length);
+    ASSERT_EQ(executable.get_parameters().size(), 1);
+    ASSERT_EQ(executable.get_results().size(), 2);
+    EXPECT_EQ(executable.get_padded_executable()->get_parameters().at(0)->get_shape(),
+              (Shape{2, 4, 2}));
+
+    auto mean = backend->create_tensor(element::f32, Shape{2, 2});
+
+    // the long sequence leaves data in the padded tensors that the short one must not see
+    auto x = backend->create_tensor(element::f32, Shape{2, 4, 2});
+    auto y = backend->create_tensor(element::f32, Shape{2, 4, 2});
+    copy_data(x, vector<float>{1, 2, 3, 4, 5, 6, 7, 8, 1, 1, 2, 2, 3, 3, 4, 4});
+    ASSERT_TRUE(executable.call({y, mean}, {x}));
+    EXPECT_TRUE(test::all_close_f(
+        (vector<float>{1, 4, 9, 16, 25, 36, 49, 64, 1, 1, 4, 4, 9, 9, 16, 16}),
+        read_vector<float>(y)));
+    EXPECT_TRUE(test::all_close_f((vector<float>{4, 5, 2.5, 2.5}), read_vector<float>(mean)));
+
+    x = backend->create_tensor(element::f32, Shape{2, 2, 2});
+    y = backend->create_tensor(element::f32, Shape{2, 2, 2});
+    copy_data(x, vector<float>{1, 2, 3, 4, -1, -2, -3, -4});
+    ASSERT_TRUE(executable.call({y, mean}, {x}));
+    EXPECT_TRUE(
+        test::all_close_f((vector<float>{1, 4, 9, 16, 1, 4, 9, 16}), read_vector<float>(y)));
+    EXPECT_TRUE(test::all_close_f((vector<float>{2, 3, -2, -3}), read_vector<float>(mean)));
+}
+
+NGRAPH_TEST(padded_sequence_${BACKEND_NAME}, too_long)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    shared_ptr<op::Parameter> length;
+    auto f = make_sequence_function(length);
+    runtime::sequence::PaddedSequenceExecutable executable(backend, f, 2, length);
+
+    auto x = backend->create_tensor(element::f32, Shape{2, 3, 2});
+    auto y = backend->create_tensor(element::f32, Shape{2, 3, 2});
+    auto mean = backend->create_tensor(element::f32, Shape{2, 2});
+    EXPECT_ANY_THROW(executable.call({y, mean}, {x}));
+}
+
+NGRAPH_TEST(padded_sequence_${BACKEND_NAME}, two_dynamic_dimensions)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape::dynamic(2));
+    auto f = make_shared<Function>(make_shared<op::Negative>(x), ParameterVector{x});
+    EXPECT_ANY_THROW(runtime::sequence::PaddedSequenceExecutable(backend, f, 4));
+}
@@ -22,12 +22,28 @@
 
 #include "gtest/gtest.h"
 #include "ngraph/op/add.hpp"
+#include "ngraph/op/allreduce.hpp"
 #include "ngraph/op/broadcast.hpp"
+#include "ngraph/op/allgather.hpp"
 #include "ngraph/op/constant.hpp"
+#include "ngraph/op/dot.hpp"
+#include "ngraph/op/embedding_lookup.hpp"
+#include "ngraph/op/max.hpp"
 #include "ngraph/op/multiply.hpp"
+#include "ngraph/op/negative.hpp"
 #include "ngraph/op/parameter.hpp"
+#include "ngraph/op/recv.hpp"
+#include "ngraph/op/reshape.hpp"
+#include "ngraph/op/send.hpp"
+#include "ngraph/op/subtract.hpp"
+#include "ngraph/op/sum.hpp"
+#include "ngraph/pass/all_reduce_fusion.hpp"
+#include "ngraph/pass/all_reduce_scheduling.hpp"
 #include "ngraph/pass/constant_to_broadcast.hpp"
+#include "ngraph/pass/loop_kernel_collector.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pass/pipeline_placement.hpp"
+#include "ngraph/pass/sparse_all_reduce.hpp"
 #include "ngraph/pass/visualize_tree.hpp"
 #include "ngraph/serializer.hpp"
 #include "util/test_tools.hpp"
@@ -73,3 +89,216 @@ TEST(pass, constant_to_broadcast)
         pm.run_passes(f);
     }
 }
+
+TEST(pass, loop_kernel_collector)
+{
+    Shape shape{4, 8};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto mul = (A + B) * B;
+    auto neg = make_shared<op::Negative>(mul);
+    auto sum = make_shared<op::Sum>(neg, AxisSet{1});
+    auto max = make_shared<op::Max>(mul, AxisSet{1});
+    // consumes a reduction, so it can't join the group
+    auto outer = make_shared<op::Negative>(sum);
+    auto f = make_shared<Function>(NodeVector{outer, max}, ParameterVector{A, B});
+
+    pass::LoopKernelCollector lkc(f, 2);
+    auto groups = lkc.get_groups();
+    ASSERT_EQ(groups.size(), 1);
+    EXPECT_EQ(groups[0].m_nodes.size(), 5);
+    EXPECT_EQ(groups[0].m_reduction_size, 8);
+    EXPECT_EQ(count(groups[0].m_nodes.begin(), groups[0].m_nodes.end(), outer), 0);
+
+    // a predicate without Negative splits the chain
+    auto no_negative = [](const Node& node) {
+        return pass::LoopKernelCollector::is_default_fusible(node) &&
+               node.description() != "Negative";
+    };
+    pass::LoopKernelCollector restricted(f, 2, no_negative);
+    groups = restricted.get_groups();
+    ASSERT_EQ(groups.size(), 1);
+    EXPECT_EQ(groups[0].m_nodes.size(), 3);
+
+    EXPECT_FALSE(pass::LoopKernelCollector::is_trailing_reduction(
+        *make_shared<op::Sum>(neg, AxisSet{0})));
+}
+
+TEST(pass, all_reduce_scheduling)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto W1 = make_shared<op::Parameter>(element::f32, shape);
+    auto W2 = make_shared<op::Parameter>(element::f32, shape);
+    // gradients of two layers, and their optimizer updates
+    auto grad2 = make_shared<op::Multiply>(A, W2);
+    auto grad1 = make_shared<op::Multiply>(make_shared<op::Negative>(grad2), W1);
+    auto reduced2 = make_shared<op::AllReduce>(grad2);
+    auto reduced1 = make_shared<op::AllReduce>(grad1);
+    auto update2 = make_shared<op::Subtract>(W2, reduced2);
+    auto update1 = make_shared<op::Subtract>(W1, reduced1);
+    auto f = make_shared<Function>(NodeVector{update1, update2}, ParameterVector{A, W1, W2});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceScheduling>();
+    pass_manager.run_passes(f);
+
+    EXPECT_EQ(update2->get_control_dependencies().count(reduced1), 1);
+    EXPECT_EQ(update1->get_control_dependencies().count(reduced2), 1);
+    // both reductions are started before either update waits
+    auto ops = f->get_ordered_ops();
+    auto position = [&ops](const shared_ptr<Node>& node) {
+        return distance(ops.begin(), find(ops.begin(), ops.end(), node));
+    };
+    EXPECT_LT(position(reduced1), position(update2));
+    EXPECT_LT(position(reduced2), position(update1));
+}
+
+TEST(pass, all_reduce_fusion)
+{
+    auto gen_f = []() {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto B = make_shared<op::Parameter>(element::f32, Shape{4});
+        auto C = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+        NodeVector updates;
+        for (auto& grad : NodeVector{A * A, make_shared<op::Negative>(B), C * C})
+        {
+            updates.push_back(make_shared<op::AllReduce>(grad) - grad);
+        }
+        return make_shared<Function>(updates, ParameterVector{A, B, C});
+    };
+
+    auto f = gen_f();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceFusion>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 1);
+    for (auto& result : f->get_results())
+    {
+        auto update = result->get_argument(0);
+        EXPECT_TRUE(dynamic_pointer_cast<op::Reshape>(update->get_argument(0)));
+    }
+
+    // the first two gradients take 40 of 48 bytes, the third goes to a new bucket
+    f = gen_f();
+    pass::Manager small_bucket_manager;
+    small_bucket_manager.register_pass<pass::AllReduceFusion>(48);
+    small_bucket_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+}
+
+TEST(pass, all_reduce_fusion_compressed)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto C = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::AllReduce>(A, element::f16),
+                                              make_shared<op::AllReduce>(B),
+                                              make_shared<op::AllReduce>(C, element::f16)},
+                                   ParameterVector{A, B, C});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceFusion>();
+    pass_manager.run_passes(f);
+
+    // the compressed reductions are fused, the uncompressed one is left alone
+    size_t compressed = 0;
+    for (auto& node : f->get_ops())
+    {
+        if (auto all_reduce = dynamic_pointer_cast<op::AllReduce>(node))
+        {
+            if (all_reduce->is_compressed())
+            {
+                EXPECT_EQ(all_reduce->get_shape(), (Shape{6}));
+                compressed++;
+            }
+        }
+    }
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+    EXPECT_EQ(compressed, 1);
+}
+
+TEST(pass, sparse_all_reduce)
+{
+    // 4 lookups into a 1000x8 table: 2 shards gather 2 * 4 * (8 * 4 + 4) bytes instead of
+    // 32000 bytes
+    auto gen_f = [](const Shape& weights_shape) {
+        auto indices = make_shared<op::Parameter>(element::i32, Shape{2, 2});
+        auto weights = make_shared<op::Parameter>(element::f32, weights_shape);
+        auto embed = make_shared<op::EmbeddingLookup>(indices, weights);
+        auto delta = make_shared<op::Parameter>(element::f32, embed->get_shape());
+        autodiff::Adjoints adjoints(NodeVector{embed}, NodeVector{delta});
+        auto grad = make_shared<op::AllReduce>(adjoints.backprop_node(weights));
+        return make_shared<Function>(grad, ParameterVector{indices, weights, delta});
+    };
+
+    auto f = gen_f(Shape{1000, 8});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::SparseAllReduce>(1024, 2);
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 0);
+    EXPECT_EQ(count_ops_of_type<op::AllGather>(f), 2);
+    auto sparse = f->get_results().at(0)->get_argument(0);
+    ASSERT_TRUE(dynamic_pointer_cast<op::EmbeddingLookupBackprop>(sparse));
+    EXPECT_EQ(sparse->get_argument(0)->get_shape(), (Shape{8}));
+    EXPECT_EQ(sparse->get_argument(1)->get_shape(), (Shape{8, 8}));
+
+    // below the threshold
+    f = gen_f(Shape{10, 8});
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 1);
+
+    // 4 rows gathered from 2 shards are not fewer than the 6 rows of the table
+    f = gen_f(Shape{6, 256});
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 1);
+}
+
+TEST(pass, pipeline_placement)
+{
+    // two Dots of equal cost are cut between them
+    auto x = make_shared<op::Parameter>(element::f32, Shape{4, 8});
+    auto w1 = make_shared<op::Parameter>(element::f32, Shape{8, 8});
+    auto w2 = make_shared<op::Parameter>(element::f32, Shape{8, 8});
+    auto h = make_shared<op::Dot>(x, w1);
+    auto y = make_shared<op::Dot>(h, w2);
+    auto f = make_shared<Function>(y, ParameterVector{x, w1, w2});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::PipelinePlacement>(2);
+    pass_manager.run_passes(f);
+    EXPECT_EQ(h->get_placement_index(), 0);
+    EXPECT_EQ(y->get_placement_index(), 1);
+    EXPECT_EQ(f->get_results().at(0)->get_placement_index(), 1);
+
+    auto stage0 = pass::PipelinePlacement::split_stage(f, 0);
+    EXPECT_EQ(stage0->get_parameters().size(), 3);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(stage0), 1);
+    EXPECT_EQ(count_ops_of_type<op::Recv>(stage0), 0);
+    ASSERT_EQ(stage0->get_results().size(), 1);
+    auto send = dynamic_pointer_cast<op::Send>(stage0->get_results().at(0)->get_argument(0));
+    ASSERT_TRUE(send);
+
+    auto stage1 = pass::PipelinePlacement::split_stage(f, 1);
+    EXPECT_EQ(count_ops_of_type<op::Dot>(stage1), 1);
+    EXPECT_EQ(count_ops_of_type<op::Send>(stage1), 0);
+    ASSERT_EQ(stage1->get_results().size(), 1);
+    auto recv = dynamic_pointer_cast<op::Recv>(
+        stage1->get_results().at(0)->get_argument(0)->get_argument(0));
+    ASSERT_TRUE(recv);
+
+    EXPECT_EQ(send->get_dest_rank(), 1);
+    EXPECT_EQ(recv->get_src_rank(), 0);
+    EXPECT_EQ(send->get_tag(), recv->get_tag());
+    EXPECT_EQ(recv->get_shape(), (Shape{4, 8}));
+}
+
+TEST(pass, all_reduce_fusion_dependent_inputs)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto reduced = make_shared<op::AllReduce>(A);
+    auto f = make_shared<Function>(make_shared<op::AllReduce>(reduced * A), ParameterVector{A});
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::AllReduceFusion>();
+    pass_manager.run_passes(f);
+    EXPECT_EQ(count_ops_of_type<op::AllReduce>(f), 2);
+}
@@ -23,9 +23,16 @@
 
 #include "ngraph/graph_util.hpp"
 #include "ngraph/ngraph.hpp"
+#include "ngraph/pass/graph_rewrite.hpp"
 #include "ngraph/pass/manager.hpp"
+#include "ngraph/pattern/matcher.hpp"
+#include "ngraph/pattern/op/label.hpp"
 #include "util/test_tools.hpp"
 
+#ifdef NGRAPH_JSON_ENABLE
+#include "nlohmann/json.hpp"
+#endif
+
 using namespace ngraph;
 using namespace std;
 
@@ -41,3 +48,56 @@ TEST(pass_manager, add)
     EXPECT_EQ(node_count, sorted.size());
     EXPECT_TRUE(validate_list(sorted));
 }
+
+namespace
+{
+    class DoubleAbsElimination : public pass::GraphRewrite
+    {
+    public:
+        DoubleAbsElimination()
+        {
+            auto label = make_shared<pattern::op::Label>(element::f32, Shape{2});
+            auto pattern = make_shared<op::Abs>(make_shared<op::Abs>(label));
+            auto callback = [](pattern::Matcher& m) {
+                replace_node(m.get_match_root(), m.get_match_root()->get_argument(0));
+                return true;
+            };
+            add_matcher(make_shared<pattern::Matcher>(pattern, "DoubleAbsElimination"), callback);
+        }
+    };
+}
+
+TEST(pass_manager, pass_profile)
+{
+    auto a = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto abs = make_shared<op::Abs>(make_shared<op::Abs>(a));
+    auto f = make_shared<Function>(abs, ParameterVector{a});
+
+    pass::Manager pass_manager;
+    pass_manager.register_pass<DoubleAbsElimination>();
+    pass_manager.set_pass_profiling(true);
+    pass_manager.run_passes(f);
+
+    auto profile = pass_manager.get_profile();
+    ASSERT_NE(profile, nullptr);
+    ASSERT_EQ(profile->get_entries().size(), 1);
+    auto& entry = profile->get_entries().at(0);
+    EXPECT_NE(entry.name.find("DoubleAbsElimination"), string::npos);
+    EXPECT_EQ(entry.nodes_before, 4);
+    EXPECT_EQ(entry.nodes_after, 3);
+    EXPECT_EQ(entry.matcher_hits, (map<string, size_t>{{"DoubleAbsElimination", 1}}));
+    EXPECT_GE(entry.peak_rss_delta_kb, 0);
+    EXPECT_LE(entry.wall_time_us, profile->get_total_time_us());
+
+#ifdef NGRAPH_JSON_ENABLE
+    auto trace = nlohmann::json::parse(profile->to_chrome_trace());
+    ASSERT_EQ(trace.size(), 2);
+    EXPECT_EQ(trace[0]["ph"], "B");
+    EXPECT_EQ(trace[1]["ph"], "E");
+    EXPECT_EQ(trace[0]["name"], entry.name);
+#endif
+
+    stringstream report;
+    profile->print(report);
+    EXPECT_NE(report.str().find("1 x DoubleAbsElimination"), string::npos);
+}
@@ -204,6 +204,53 @@ TEST(memory_manager, memory_align)
     EXPECT_EQ(128, mm.allocate(4));
 }
 
+TEST(memory_manager, optimal)
+{
+    // The 10 byte hole left by a is too small for c, so first fit ends up above the lower bound
+    pass::MemoryManager first_fit{1};
+    size_t a = first_fit.allocate(10);
+    first_fit.allocate(20);
+    first_fit.free(a);
+    first_fit.allocate(20);
+    EXPECT_EQ(first_fit.max_allocated(), 50);
+    EXPECT_EQ(first_fit.min_allocated(), 40);
+
+    pass::MemoryManager mm{1, pass::MemoryManager::allocation_scheme::OPTIMAL};
+    a = mm.allocate(10);
+    size_t b = mm.allocate(20);
+    mm.free(a);
+    size_t c = mm.allocate(20);
+    EXPECT_THROW(mm.free(a), std::runtime_error);
+    mm.plan();
+    EXPECT_EQ(mm.max_allocated(), 40);
+    EXPECT_EQ(mm.min_allocated(), 40);
+
+    // b is live alongside both a and c
+    size_t offset_a = mm.get_offset(a);
+    size_t offset_b = mm.get_offset(b);
+    size_t offset_c = mm.get_offset(c);
+    EXPECT_TRUE(offset_a + 10 <= offset_b || offset_b + 20 <= offset_a);
+    EXPECT_TRUE(offset_c + 20 <= offset_b || offset_b + 20 <= offset_c);
+    EXPECT_EQ(mm.get_offset(b + 5), offset_b + 5);
+}
+
+TEST(memory_layout, optimal)
+{
+    auto first_fit_graph = make_test_graph();
+    pass::Manager first_fit;
+    first_fit.register_pass<pass::Liveness>();
+    first_fit.register_pass<pass::MemoryLayout>();
+    first_fit.run_passes(first_fit_graph);
+
+    auto graph = make_test_graph();
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::Liveness>();
+    pass_manager.register_pass<pass::MemoryLayout>(
+        1, false, pass::MemoryManager::allocation_scheme::OPTIMAL);
+    pass_manager.run_passes(graph);
+    EXPECT_LE(graph->get_temporary_pool_size(), first_fit_graph->get_temporary_pool_size());
+}
+
 TEST(memory_layout, basic)
 {
     string dump_file = "memory_layout.txt";
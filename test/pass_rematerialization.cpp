@@ -0,0 +1,92 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <memory>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/pass/rematerialization.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_tools.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+// A chain of Tanh ops whose outputs are all read again, in reverse, by a chain of Multiply ops,
+// the way autodiff reads forward activations during backprop
+static shared_ptr<Function> make_forward_backward(size_t depth)
+{
+    Shape shape{32};
+    auto X = make_shared<op::Parameter>(element::f32, shape);
+    NodeVector activations{X};
+    for (size_t i = 0; i < depth; i++)
+    {
+        activations.push_back(make_shared<op::Tanh>(activations.back()));
+    }
+    shared_ptr<Node> delta = activations.back();
+    for (size_t i = depth; i > 0; i--)
+    {
+        delta = make_shared<op::Multiply>(delta, activations[i - 1]);
+    }
+    return make_shared<Function>(delta, ParameterVector{X});
+}
+
+static vector<float> run(const shared_ptr<Function>& f)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto x = backend->create_tensor(element::f32, Shape{32});
+    vector<float> x_values(32);
+    for (size_t i = 0; i < x_values.size(); i++)
+    {
+        x_values[i] = 0.05f * i;
+    }
+    copy_data(x, x_values);
+    auto result = backend->create_tensor(element::f32, Shape{32});
+    auto handle = backend->compile(f);
+    handle->call_with_validate({result}, {x});
+    return read_vector<float>(result);
+}
+
+TEST(pass_rematerialization, reduces_peak_live_bytes)
+{
+    auto f = make_forward_backward(16);
+    auto expected = run(clone_function(*f));
+
+    pass::Rematerialization rematerialization;
+    EXPECT_TRUE(rematerialization.run_on_function(f));
+
+    EXPECT_EQ(rematerialization.get_peak_bytes_before(),
+              pass::Rematerialization::get_peak_live_bytes(make_forward_backward(16)
+                                                               ->get_ordered_ops()));
+    EXPECT_LT(rematerialization.get_peak_bytes_after(),
+              rematerialization.get_peak_bytes_before());
+    EXPECT_EQ(rematerialization.get_peak_bytes_after(),
+              pass::Rematerialization::get_peak_live_bytes(f->get_ordered_ops()));
+    EXPECT_GT(count_ops_of_type<op::Tanh>(f), 16);
+    EXPECT_TRUE(test::all_close_f(expected, run(f)));
+}
+
+TEST(pass_rematerialization, budget_already_met)
+{
+    auto f = make_forward_backward(16);
+    auto peak = pass::Rematerialization::get_peak_live_bytes(f->get_ordered_ops());
+
+    pass::Rematerialization rematerialization(peak);
+    EXPECT_FALSE(rematerialization.run_on_function(f));
+
+    EXPECT_EQ(rematerialization.get_peak_bytes_after(), peak);
+    EXPECT_EQ(count_ops_of_type<op::Tanh>(f), 16);
+}
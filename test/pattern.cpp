@@ -730,3 +730,95 @@ TEST(pattern, is_contained_match)
     ASSERT_TRUE(n.match(label_abs2, absn2));
     ASSERT_FALSE(n.is_contained_match());
 }
+
+// Records the graph nodes each match is rooted at
+class CountingMatcher : public ngraph::pattern::Matcher
+{
+public:
+    CountingMatcher(const std::shared_ptr<Node>& pattern_node, NodeVector& visited)
+        : Matcher(pattern_node, "CountingMatcher")
+        , m_visited(visited)
+    {
+    }
+
+protected:
+    bool match_node(const std::shared_ptr<Node>& pattern_node,
+                    const std::shared_ptr<Node>& graph_node,
+                    PatternMap& pattern_map) override
+    {
+        if (pattern_node == m_pattern_node)
+        {
+            m_visited.push_back(graph_node);
+        }
+        return Matcher::match_node(pattern_node, graph_node, pattern_map);
+    }
+
+private:
+    NodeVector& m_visited;
+};
+
+TEST(pattern, graph_rewrite_dispatches_by_root_type)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    shared_ptr<Node> node = a;
+    for (size_t i = 0; i < 5; i++)
+    {
+        node = make_shared<op::Negative>(node);
+    }
+    auto absn = make_shared<op::Abs>(node);
+    auto f = make_shared<Function>(absn, ParameterVector{a});
+
+    NodeVector abs_visited;
+    NodeVector label_visited;
+    auto label = make_shared<pattern::op::Label>(element::i32, shape);
+    pass::GraphRewrite rewrite;
+    rewrite.add_matcher(make_shared<CountingMatcher>(make_shared<op::Abs>(label), abs_visited),
+                        [](pattern::Matcher&) { return false; });
+    rewrite.add_matcher(make_shared<CountingMatcher>(label, label_visited),
+                        [](pattern::Matcher&) { return false; });
+    rewrite.run_on_function(f);
+
+    ASSERT_EQ(abs_visited.size(), 1);
+    EXPECT_EQ(abs_visited.at(0), absn);
+    EXPECT_EQ(label_visited.size(), f->get_ordered_ops().size());
+}
+
+TEST(pattern, graph_rewrite_revisits_rewritten_neighborhood)
+{
+    Shape shape{};
+    auto a = make_shared<op::Parameter>(element::i32, shape);
+    NodeVector negatives;
+    shared_ptr<Node> node = a;
+    for (size_t i = 0; i < 8; i++)
+    {
+        if (i == 4)
+        {
+            node = make_shared<op::Abs>(node);
+        }
+        node = make_shared<op::Negative>(node);
+        negatives.push_back(node);
+    }
+    auto f = make_shared<Function>(node, ParameterVector{a});
+
+    NodeVector visited;
+    shared_ptr<Node> replacement;
+    pass::GraphRewrite rewrite;
+    auto label = make_shared<pattern::op::Label>(element::i32, shape);
+    auto callback = [&](pattern::Matcher& m) {
+        replacement = make_shared<op::Negative>(m.get_pattern_map()[label]);
+        replace_node(m.get_match_root(), replacement);
+        // a follow-up matcher spanning three nodes, run in a second pass
+        auto double_negative = make_shared<op::Negative>(make_shared<op::Negative>(label));
+        rewrite.add_matcher(make_shared<CountingMatcher>(double_negative, visited),
+                            [](pattern::Matcher&) { return false; });
+        return true;
+    };
+    rewrite.add_matcher(make_shared<pattern::Matcher>(make_shared<op::Abs>(label)), callback);
+    rewrite.run_on_function(f);
+
+    // the replacement, its argument and user, and two more nodes downstream
+    NodeVector expected{
+        negatives.at(3), replacement, negatives.at(4), negatives.at(5), negatives.at(6)};
+    EXPECT_EQ(visited, expected);
+}
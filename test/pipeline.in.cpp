@@ -0,0 +1,149 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/pipeline/pipeline_executable.hpp"
+#include "ngraph/runtime/pipeline/staged_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+// y = relu(x . w1) . w2 is gathered along the batch, loss = sum(y) is summed over the
+// micro-batches. The last ops are cheap enough to be placed on the last stage.
+static shared_ptr<Function> make_two_layers()
+{
+    auto x = make_shared<op::Parameter>(element::f32, PartialShape{Dimension::dynamic(), 2});
+    auto w1 = make_shared<op::Parameter>(element::f32, PartialShape{2, 2});
+    auto w2 = make_shared<op::Parameter>(element::f32, PartialShape{2, 1});
+    auto y = make_shared<op::Dot>(make_shared<op::Relu>(make_shared<op::Dot>(x, w1)), w2);
+    auto loss = make_shared<op::Sum>(y, AxisSet{0, 1});
+    return make_shared<Function>(NodeVector{y, loss}, ParameterVector{x, w1, w2});
+}
+
+NGRAPH_TEST(pipeline_${BACKEND_NAME}, micro_batches)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::pipeline::PipelineExecutable executable(make_two_layers(), backend, 2);
+    EXPECT_EQ(executable.get_micro_batch_count(), 2);
+
+    auto x = backend->create_tensor(element::f32, Shape{4, 2});
+    auto w1 = backend->create_tensor(element::f32, Shape{2, 2});
+    auto w2 = backend->create_tensor(element::f32, Shape{2, 1});
+    auto y = backend->create_tensor(element::f32, Shape{4, 1});
+    auto loss = backend->create_tensor(element::f32, Shape{});
+    copy_data(x, vector<float>{1, 0, 0, 1, 1, 1, -1, 0});
+    copy_data(w1, vector<float>{1, -1, 2, 1});
+    copy_data(w2, vector<float>{1, 2});
+
+    for (size_t i = 0; i < 2; i++)
+    {
+        ASSERT_TRUE(executable.call({y, loss}, {x, w1, w2}));
+        if (executable.get_stage() + 1 == executable.get_stage_count())
+        {
+            EXPECT_TRUE(test::all_close_f((vector<float>{1, 4, 3, 2}), read_vector<float>(y)));
+            EXPECT_TRUE(test::all_close_f((vector<float>{10}), read_vector<float>(loss)));
+        }
+    }
+}
+
+NGRAPH_TEST(pipeline_${BACKEND_NAME}, indivisible_batch)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::pipeline::PipelineExecutable executable(make_two_layers(), backend, 2);
+
+    auto x = backend->create_tensor(element::f32, Shape{3, 2});
+    auto w1 = backend->create_tensor(element::f32, Shape{2, 2});
+    auto w2 = backend->create_tensor(element::f32, Shape{2, 1});
+    auto y = backend->create_tensor(element::f32, Shape{3, 1});
+    auto loss = backend->create_tensor(element::f32, Shape{});
+    EXPECT_ANY_THROW(executable.call({y, loss}, {x, w1, w2}));
+}
+
+// preprocess: x * 2, model: x + b, postprocess: relu
+static vector<shared_ptr<runtime::Executable>>
+    compile_stages(const shared_ptr<runtime::Backend>& backend)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto preprocess = make_shared<Function>(x + x, ParameterVector{x});
+    auto y = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto b = op::Constant::create(element::f32, Shape{4}, {-1, -2, -3, -4});
+    auto model = make_shared<Function>(y + b, ParameterVector{y});
+    auto z = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto postprocess = make_shared<Function>(make_shared<op::Relu>(z), ParameterVector{z});
+    return {backend->compile(preprocess), backend->compile(model), backend->compile(postprocess)};
+}
+
+NGRAPH_TEST(pipeline_${BACKEND_NAME}, staged_requests)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    runtime::pipeline::StagedExecutable executable(compile_stages(backend), backend);
+    EXPECT_EQ(executable.get_stage_count(), 3);
+    EXPECT_EQ(executable.get_buffer_count(), 2);
+    ASSERT_EQ(executable.get_parameters().size(), 1);
+    ASSERT_EQ(executable.get_results().size(), 1);
+
+    // More requests in flight than buffer sets
+    const size_t request_count = 8;
+    vector<shared_ptr<runtime::Tensor>> xs;
+    vector<shared_ptr<runtime::Tensor>> ys;
+    vector<future<bool>> futures;
+    for (size_t i = 0; i < request_count; i++)
+    {
+        float v = static_cast<float>(i);
+        xs.push_back(backend->create_tensor(element::f32, Shape{4}));
+        ys.push_back(backend->create_tensor(element::f32, Shape{4}));
+        copy_data(xs.back(), vector<float>{v, v, v, v});
+        futures.push_back(executable.begin_call({ys.back()}, {xs.back()}));
+    }
+    for (size_t i = 0; i < request_count; i++)
+    {
+        ASSERT_TRUE(futures[i].get());
+        vector<float> expected;
+        for (float b : {-1, -2, -3, -4})
+        {
+            expected.push_back(max(2 * static_cast<float>(i) + b, 0.0f));
+        }
+        EXPECT_TRUE(test::all_close_f(expected, read_vector<float>(ys[i])));
+    }
+
+    ASSERT_TRUE(executable.call({ys[0]}, {xs[1]}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{1, 0, 0, 0}), read_vector<float>(ys[0])));
+
+    auto timings = executable.get_stage_timings();
+    ASSERT_EQ(timings.size(), 3);
+    for (auto& timing : timings)
+    {
+        EXPECT_EQ(timing.calls, request_count + 1);
+        EXPECT_GT(timing.busy.count(), 0);
+    }
+}
+
+NGRAPH_TEST(pipeline_${BACKEND_NAME}, staged_mismatch)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto stages = compile_stages(backend);
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto wrong = backend->compile(make_shared<Function>(x + x, ParameterVector{x}));
+    EXPECT_ANY_THROW(runtime::pipeline::StagedExecutable({stages[0], wrong}, backend));
+    EXPECT_ANY_THROW(runtime::pipeline::StagedExecutable({}, backend));
+    EXPECT_ANY_THROW(runtime::pipeline::StagedExecutable(stages, backend, 0));
+}
@@ -24,6 +24,7 @@
 
 #include "ngraph/ngraph.hpp"
 #include "ngraph/provenance.hpp"
+#include "ngraph/serializer.hpp"
 
 using namespace std;
 using namespace ngraph;
@@ -31,20 +32,22 @@ using ::testing::Return;
 
 using ProvSet = std::unordered_set<std::string>;
 
-TEST(provenance, provenance)
+class ProvenanceEnabler
 {
-    class ProvenanceEnabler
+public:
+    ProvenanceEnabler()
     {
-    public:
-        ProvenanceEnabler()
-        {
-            saved_enable_state = get_provenance_enabled();
-            set_provenance_enabled(true);
-        }
-        ~ProvenanceEnabler() { set_provenance_enabled(saved_enable_state); }
-    private:
-        bool saved_enable_state;
-    } provenance_enabler;
+        saved_enable_state = get_provenance_enabled();
+        set_provenance_enabled(true);
+    }
+    ~ProvenanceEnabler() { set_provenance_enabled(saved_enable_state); }
+private:
+    bool saved_enable_state;
+};
+
+TEST(provenance, provenance)
+{
+    ProvenanceEnabler provenance_enabler;
 
     //
     // Before:
@@ -210,3 +213,72 @@ TEST(provenance, provenance)
         EXPECT_EQ(d->get_provenance_tags(), (ProvSet{"tag_a", "tag_b", "tag_c"}));
     }
 }
+
+TEST(provenance, fused_replacement)
+{
+    ProvenanceEnabler provenance_enabler;
+
+    //
+    // Before:
+    //
+    //   A{tag_a}  B{tag_b}
+    //         |   |
+    //        C{tag_c}
+    //
+    // Replacement, as a fusion pass makes it:
+    //
+    //       A{tag_a} B{tag_b}
+    //              | |
+    //              D{}
+    //               |
+    //         C := E{}
+    //
+    // After:
+    //
+    //       A{tag_a} B{tag_b}
+    //              | |
+    //              D{tag_c}
+    //               |
+    //              E{tag_c}
+    //
+    // Comment:
+    //   * D is made by the replacement as well as E, so both get the tags of C.
+    //
+    auto x = make_shared<op::Parameter>(element::i32, PartialShape{2, 3, 4});
+    auto y = make_shared<op::Parameter>(element::i32, PartialShape{2, 3, 4});
+
+    auto a = make_shared<op::Add>(x, y);
+    a->add_provenance_tag("tag_a");
+    auto b = make_shared<op::Multiply>(y, x);
+    b->add_provenance_tag("tag_b");
+    auto c = make_shared<op::Subtract>(a, b);
+    c->add_provenance_tag("tag_c");
+
+    auto f = make_shared<Function>(c, ParameterVector{x, y});
+
+    auto d = make_shared<op::Subtract>(a, b);
+    auto e = make_shared<op::Negative>(make_shared<op::Negative>(d));
+    replace_node(c, e);
+
+    EXPECT_EQ(a->get_provenance_tags(), (ProvSet{"tag_a"}));
+    EXPECT_EQ(b->get_provenance_tags(), (ProvSet{"tag_b"}));
+    EXPECT_EQ(d->get_provenance_tags(), (ProvSet{"tag_c"}));
+    EXPECT_EQ(e->get_provenance_tags(), (ProvSet{"tag_c"}));
+}
+
+TEST(provenance, clone_and_serialize)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto a = make_shared<op::Negative>(x);
+    a->add_provenance_tag("layer_1");
+    a->add_provenance_tag("layer_2");
+    auto f = make_shared<Function>(a, ParameterVector{x});
+
+    auto clone = clone_function(*f);
+    auto cloned_a = clone->get_results().at(0)->get_argument(0);
+    EXPECT_EQ(cloned_a->get_provenance_tags(), (ProvSet{"layer_1", "layer_2"}));
+
+    auto deserialized = deserialize(serialize(f));
+    auto deserialized_a = deserialized->get_results().at(0)->get_argument(0);
+    EXPECT_EQ(deserialized_a->get_provenance_tags(), (ProvSet{"layer_1", "layer_2"}));
+}
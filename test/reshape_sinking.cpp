@@ -275,3 +275,37 @@ TEST(reshape_sinking, concat)
     size_t before_after = count_ops_of_type<op::Reshape>(f);
     ASSERT_LE(before_after, before_count);
 }
+
+TEST(reshape_sinking, reduction)
+{
+    Shape shape_a{2, 3, 4, 5};
+    auto A = make_shared<op::Parameter>(element::f32, shape_a);
+    auto to_nhwc = make_shared<op::Reshape>(A, AxisVector{0, 2, 3, 1}, Shape{2, 4, 5, 3});
+    auto relu = make_shared<op::Relu>(to_nhwc);
+    // reducing H and W leaves N and C in their original order, the reshape goes away
+    auto sum = make_shared<op::Sum>(relu, AxisSet{1, 2});
+    // reducing N leaves H, W and C, which still need to be reordered
+    auto max = make_shared<op::Max>(relu, AxisSet{0});
+    auto f = make_shared<Function>(NodeVector{sum, max}, ParameterVector{A});
+    auto ref_f = clone_function(*f);
+
+    pass::ReshapeSinking reshape_sinking;
+    reshape_sinking.run_on_function(f);
+    EXPECT_EQ(reshape_sinking.get_transposes_before(), 1);
+    EXPECT_EQ(reshape_sinking.get_transposes_after(), 1);
+    pass::Manager pass_manager;
+    pass_manager.register_pass<pass::ReshapeElimination>();
+    pass_manager.run_passes(f);
+    ASSERT_EQ(count_ops_of_type<op::Reshape>(f), 1);
+    EXPECT_EQ(f->get_results().at(0)->get_argument(0)->description(), "Sum");
+
+    test::Uniform<float> rng(-1.0f, 1.0f);
+    vector<float> a(shape_size(shape_a));
+    rng.initialize(a);
+    auto ref_results = execute(ref_f, vector<vector<float>>{a}, "INTERPRETER");
+    auto results = execute(f, vector<vector<float>>{a}, "INTERPRETER");
+    for (size_t i = 0; i < ref_results.size(); i++)
+    {
+        EXPECT_TRUE(test::all_close(results.at(i), ref_results.at(i)));
+    }
+}
@@ -0,0 +1,73 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include <vector>
+
+#include "gtest/gtest.h"
+#include "ngraph/state/rng_state.hpp"
+
+using namespace ngraph;
+using namespace std;
+
+TEST(rng_state, philox_known_answer)
+{
+    // Philox4x32-10 test vector of the Random123 library
+    auto block = RNGState::philox(0, 0);
+    EXPECT_EQ(block[0], 0x6627e8d5u);
+    EXPECT_EQ(block[1], 0xe169c58du);
+    EXPECT_EQ(block[2], 0xbc57ac4cu);
+    EXPECT_EQ(block[3], 0x9b00dbd8u);
+}
+
+TEST(rng_state, mask_does_not_depend_on_split)
+{
+    size_t count = 1001;
+    RNGState state(777, 0.3);
+    uint64_t base = state.reserve(count);
+
+    vector<float> whole(count);
+    state.generate(whole.data(), base, 0, count);
+
+    vector<float> pieces(count);
+    for (size_t begin = 0; begin < count; begin += 7)
+    {
+        state.generate(pieces.data(), base, begin, min(begin + 7, count));
+    }
+    EXPECT_EQ(whole, pieces);
+
+    size_t ones = 0;
+    for (float value : whole)
+    {
+        ASSERT_TRUE(value == 0.f || value == 1.f);
+        ones += static_cast<size_t>(value);
+    }
+    EXPECT_NEAR(static_cast<double>(ones) / count, 0.3, 0.05);
+}
+
+TEST(rng_state, masks_use_fresh_counters)
+{
+    RNGState state(777, 0.5);
+    size_t count = 64;
+    uint64_t first = state.reserve(count);
+    uint64_t second = state.reserve(count);
+    EXPECT_EQ(second, first + count / 4);
+
+    vector<float> mask1(count);
+    vector<float> mask2(count);
+    state.generate(mask1.data(), first, 0, count);
+    state.generate(mask2.data(), second, 0, count);
+    EXPECT_NE(mask1, mask2);
+}
@@ -20,6 +20,7 @@
 #include "gmock/gmock.h"
 #include "gtest/gtest.h"
 
+#include "ngraph/cpio.hpp"
 #include "ngraph/file_util.hpp"
 #include "ngraph/ngraph.hpp"
 #include "ngraph/op/constant.hpp"
@@ -192,6 +193,199 @@ TEST(serialize, constant)
     EXPECT_TRUE(found);
 }
 
+TEST(serialize, mapped_constant)
+{
+    const string tmp_file = "serialize_mapped_constant.cpio";
+    Shape shape{2, 4};
+    vector<float> values{1, 2, 3, 4, 5, 6, 7, 8};
+    auto A = op::Constant::create(element::f32, shape, values);
+    auto f = make_shared<Function>(A, ParameterVector{});
+
+    // Lay the file out the way binary constant data is written: the model without constant
+    // values followed by one entry per constant, named after the constant node
+    json js = json::parse(serialize(f));
+    for (json& func : js)
+    {
+        for (json& op : func.at("ops"))
+        {
+            op.erase("value");
+        }
+    }
+    string model = js.dump();
+    {
+        cpio::Writer writer(tmp_file);
+        writer.write(f->get_name(), model.data(), static_cast<uint32_t>(model.size()));
+        writer.write(A->get_name(),
+                     values.data(),
+                     static_cast<uint32_t>(values.size() * sizeof(float)));
+    }
+
+    set_deserialize_mapped_constants(true);
+    auto g = deserialize(tmp_file);
+    set_deserialize_mapped_constants(false);
+    // The mapping outlives the directory entry
+    file_util::remove_file(tmp_file);
+    ASSERT_NE(g, nullptr);
+
+    bool found = false;
+    for (shared_ptr<Node> node : g->get_ops())
+    {
+        if (auto c = dynamic_pointer_cast<op::Constant>(node))
+        {
+            found = true;
+            EXPECT_EQ(values, c->get_vector<float>());
+        }
+    }
+    EXPECT_TRUE(found);
+}
+
+TEST(serialize, binary)
+{
+    const string tmp_file = "serialize_binary.ngb";
+    Shape shape{2, 2};
+    auto P = make_shared<op::Parameter>(element::f32, shape);
+    auto A = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto B = op::Constant::create(element::i8, Shape{3}, {-1, 0, 1});
+    auto f = make_shared<Function>(NodeVector{make_shared<op::Add>(P, A), B}, ParameterVector{P});
+    serialize(tmp_file, f);
+
+    for (bool mapped : {false, true})
+    {
+        set_deserialize_mapped_constants(mapped);
+        auto g = deserialize(tmp_file);
+        set_deserialize_mapped_constants(false);
+        ASSERT_NE(g, nullptr);
+        EXPECT_EQ(g->get_ops().size(), f->get_ops().size());
+        EXPECT_EQ(g->get_output_op(0)->get_argument(0)->description(), "Add");
+
+        size_t found = 0;
+        for (shared_ptr<Node> node : g->get_ops())
+        {
+            if (auto c = dynamic_pointer_cast<op::Constant>(node))
+            {
+                found++;
+                if (c->get_element_type() == element::f32)
+                {
+                    EXPECT_EQ((vector<float>{1, 2, 3, 4}), c->get_vector<float>());
+                }
+                else
+                {
+                    EXPECT_EQ((vector<int8_t>{-1, 0, 1}), c->get_vector<int8_t>());
+                }
+            }
+        }
+        EXPECT_EQ(found, 2u);
+    }
+    file_util::remove_file(tmp_file);
+}
+
+TEST(serialize, lazy)
+{
+    auto make_function = [](float value) {
+        auto P = make_shared<op::Parameter>(element::f32, Shape{2});
+        auto C = op::Constant::create(element::f32, Shape{2}, {value, value});
+        return make_shared<Function>(make_shared<op::Add>(P, C), ParameterVector{P});
+    };
+    auto f = make_function(1);
+    auto g = make_function(2);
+
+    // A model with two independent functions, g is the one deserialize returns
+    json js = json::parse(serialize(f));
+    js.push_back(json::parse(serialize(g))[0]);
+    for (const string& tmp_file : {"serialize_lazy.json", "serialize_lazy_g.ngb"})
+    {
+        if (file_util::get_file_ext(tmp_file) == ".json")
+        {
+            ofstream out(tmp_file);
+            out << js.dump();
+        }
+        else
+        {
+            serialize(tmp_file, g);
+        }
+
+        auto model = deserialize_lazy(tmp_file);
+        const vector<string>& names = model->get_function_names();
+        ASSERT_FALSE(names.empty());
+        EXPECT_EQ(names.back(), g->get_name());
+        auto lazy_g = model->get_function(g->get_name());
+        ASSERT_NE(lazy_g, nullptr);
+        EXPECT_EQ(lazy_g, model->get_function(g->get_name()));
+        EXPECT_EQ(lazy_g->get_ops().size(), g->get_ops().size());
+        for (shared_ptr<Node> node : lazy_g->get_ops())
+        {
+            if (auto c = dynamic_pointer_cast<op::Constant>(node))
+            {
+                EXPECT_EQ((vector<float>{2, 2}), c->get_vector<float>());
+            }
+        }
+        if (names.size() > 1)
+        {
+            EXPECT_EQ(names[0], f->get_name());
+            EXPECT_NE(model->get_function(f->get_name()), nullptr);
+        }
+        EXPECT_THROW(model->get_function("no_such_function"), ngraph_error);
+        file_util::remove_file(tmp_file);
+    }
+}
+
+TEST(serialize, compressed_constant)
+{
+    const string tmp_file = "serialize_compressed_constant.cpio";
+    vector<float> sparse(1024, 0);
+    sparse[7] = 1.5f;
+    sparse[1000] = -2;
+    auto A = op::Constant::create(element::f32, Shape{1024}, sparse);
+    auto B = op::Constant::create(element::f32, Shape{2}, {3, 3});
+    auto f = make_shared<Function>(NodeVector{A, B}, ParameterVector{});
+
+    set_serialize_compression_threshold(256);
+    serialize(tmp_file, f);
+    set_serialize_compression_threshold(0);
+
+    // Only the constant above the threshold is compressed
+    vector<string> names;
+    {
+        cpio::Reader reader(tmp_file);
+        for (const cpio::FileInfo& info : reader.get_file_info())
+        {
+            names.push_back(info.get_name());
+            if (info.get_name() == A->get_name() + ".z")
+            {
+                EXPECT_LT(info.get_size(), sparse.size() * sizeof(float));
+            }
+        }
+    }
+    EXPECT_NE(find(names.begin(), names.end(), A->get_name() + ".z"), names.end());
+    EXPECT_NE(find(names.begin(), names.end(), B->get_name()), names.end());
+
+    for (bool mapped : {false, true})
+    {
+        set_deserialize_mapped_constants(mapped);
+        auto g = deserialize(tmp_file);
+        set_deserialize_mapped_constants(false);
+        ASSERT_NE(g, nullptr);
+        size_t found = 0;
+        for (shared_ptr<Node> node : g->get_ops())
+        {
+            if (auto c = dynamic_pointer_cast<op::Constant>(node))
+            {
+                found++;
+                if (shape_size(c->get_shape()) == sparse.size())
+                {
+                    EXPECT_EQ(sparse, c->get_vector<float>());
+                }
+                else
+                {
+                    EXPECT_EQ((vector<float>{3, 3}), c->get_vector<float>());
+                }
+            }
+        }
+        EXPECT_EQ(found, 2u);
+    }
+    file_util::remove_file(tmp_file);
+}
+
 TEST(benchmark, serialize)
 {
     stopwatch timer;
@@ -310,3 +504,69 @@ TEST(serialize, constant_infinity_nan)
     EXPECT_TRUE(test::all_close_f(c->get_vector<float>(), c_data));
     EXPECT_EQ(d->get_vector<int64_t>(), d_data);
 }
+
+TEST(serialize, all_reduce_compressed_type)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto f = make_shared<Function>(
+        NodeVector{make_shared<op::AllReduce>(A, element::bf16), make_shared<op::AllReduce>(A)},
+        ParameterVector{A});
+
+    string s = serialize(f, 4);
+    shared_ptr<Function> g = deserialize(s);
+
+    auto compressed =
+        static_pointer_cast<op::AllReduce>(g->get_results().at(0)->get_argument(0));
+    auto uncompressed =
+        static_pointer_cast<op::AllReduce>(g->get_results().at(1)->get_argument(0));
+    EXPECT_EQ(compressed->get_compressed_type(), element::bf16);
+    EXPECT_FALSE(uncompressed->is_compressed());
+}
+
+TEST(serialize, send_recv)
+{
+    auto recv = make_shared<op::Recv>(element::f32, Shape{2, 3}, 0, 5);
+    auto f = make_shared<Function>(make_shared<op::Send>(-recv, 2, 6), ParameterVector{});
+
+    string s = serialize(f, 4);
+    shared_ptr<Function> g = deserialize(s);
+
+    auto send = static_pointer_cast<op::Send>(g->get_results().at(0)->get_argument(0));
+    EXPECT_EQ(send->get_dest_rank(), 2);
+    EXPECT_EQ(send->get_tag(), 6);
+    auto g_recv = static_pointer_cast<op::Recv>(send->get_argument(0)->get_argument(0));
+    EXPECT_EQ(g_recv->get_element_type(), element::f32);
+    EXPECT_EQ(g_recv->get_shape(), (Shape{2, 3}));
+    EXPECT_EQ(g_recv->get_src_rank(), 0);
+    EXPECT_EQ(g_recv->get_tag(), 5);
+}
+
+TEST(serialize, structure)
+{
+    auto make = [](float bias, AxisVector order, Shape out_shape) {
+        auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+        auto B =
+            op::Constant::create(element::f32, Shape{2, 3}, vector<float>{bias, 1, 2, 3, 4, 5});
+        auto sum = make_shared<op::Add>(A, B);
+        auto r = make_shared<op::Reshape>(sum, order, out_shape);
+        return make_shared<Function>(r, ParameterVector{A});
+    };
+
+    // Separately built functions differ in all their names but not in structure
+    string base = serialize_structure(make(0, AxisVector{0, 1}, Shape{3, 2}));
+    EXPECT_EQ(base, serialize_structure(make(0, AxisVector{0, 1}, Shape{3, 2})));
+    EXPECT_NE(base, serialize_structure(make(1, AxisVector{0, 1}, Shape{3, 2})));
+    EXPECT_NE(base, serialize_structure(make(0, AxisVector{1, 0}, Shape{3, 2})));
+}
+
+TEST(serialize, persistent_parameter)
+{
+    auto A = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto B = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    A->set_persistent(true);
+    auto f = make_shared<Function>(make_shared<op::Add>(A, B), ParameterVector{A, B});
+
+    auto g = deserialize(serialize(f));
+    EXPECT_TRUE(g->get_parameters().at(0)->get_persistent());
+    EXPECT_FALSE(g->get_parameters().at(1)->get_persistent());
+}
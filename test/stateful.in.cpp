@@ -0,0 +1,114 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/stateful/stateful_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+using StatefulExecutable = runtime::stateful::StatefulExecutable;
+
+// h' = h + x and y = 2 * h', where h is the state
+static shared_ptr<Function> make_accumulator()
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto h = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto next_h = make_shared<op::Add>(h, x);
+    auto y = make_shared<op::Add>(next_h, next_h);
+    return make_shared<Function>(NodeVector{y, next_h}, ParameterVector{x, h});
+}
+
+NGRAPH_TEST(stateful_${BACKEND_NAME}, accumulate)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    StatefulExecutable executable(backend, make_accumulator(), {{1, 1}});
+    ASSERT_EQ(executable.get_parameters().size(), 1);
+    ASSERT_EQ(executable.get_results().size(), 1);
+
+    auto x = backend->create_tensor(element::f32, Shape{2});
+    auto y = backend->create_tensor(element::f32, Shape{2});
+    copy_data(x, vector<float>{1, 2});
+    ASSERT_TRUE(executable.call({y}, {x}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{2, 4}), read_vector<float>(y)));
+    ASSERT_TRUE(executable.call({y}, {x}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{4, 8}), read_vector<float>(y)));
+    copy_data(x, vector<float>{-1, 1});
+    ASSERT_TRUE(executable.call({y}, {x}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{2, 10}), read_vector<float>(y)));
+
+    executable.get_default_stream().reset();
+    ASSERT_TRUE(executable.call({y}, {x}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{-2, 2}), read_vector<float>(y)));
+}
+
+NGRAPH_TEST(stateful_${BACKEND_NAME}, streams)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    StatefulExecutable executable(backend, make_accumulator(), {{1, 1}});
+    auto first = executable.create_stream();
+    auto second = executable.create_stream();
+
+    auto x = backend->create_tensor(element::f32, Shape{2});
+    auto y = backend->create_tensor(element::f32, Shape{2});
+    copy_data(x, vector<float>{1, 2});
+    ASSERT_TRUE(executable.call(*first, {y}, {x}));
+    ASSERT_TRUE(executable.call(*first, {y}, {x}));
+    copy_data(x, vector<float>{10, 20});
+    ASSERT_TRUE(executable.call(*second, {y}, {x}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{20, 40}), read_vector<float>(y)));
+
+    copy_data(x, vector<float>{1, 1});
+    ASSERT_TRUE(executable.call(*first, {y}, {x}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{6, 10}), read_vector<float>(y)));
+}
+
+NGRAPH_TEST(stateful_${BACKEND_NAME}, snapshot_restore)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    StatefulExecutable executable(backend, make_accumulator(), {{1, 1}});
+    auto stream = executable.create_stream();
+
+    auto x = backend->create_tensor(element::f32, Shape{2});
+    auto y = backend->create_tensor(element::f32, Shape{2});
+    copy_data(x, vector<float>{1, 2});
+    ASSERT_TRUE(executable.call(*stream, {y}, {x}));
+    auto snapshot = stream->snapshot();
+    ASSERT_TRUE(executable.call(*stream, {y}, {x}));
+    ASSERT_TRUE(executable.call(*stream, {y}, {x}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{6, 12}), read_vector<float>(y)));
+
+    stream->restore(snapshot);
+    ASSERT_TRUE(executable.call(*stream, {y}, {x}));
+    EXPECT_TRUE(test::all_close_f((vector<float>{4, 8}), read_vector<float>(y)));
+}
+
+NGRAPH_TEST(stateful_${BACKEND_NAME}, shape_mismatch)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto h = make_shared<op::Parameter>(element::f32, Shape{2});
+    auto sum = make_shared<op::Sum>(make_shared<op::Add>(h, x), AxisSet{0});
+    auto f = make_shared<Function>(NodeVector{sum}, ParameterVector{x, h});
+    EXPECT_ANY_THROW(StatefulExecutable(backend, f, {{1, 0}}));
+    EXPECT_ANY_THROW(StatefulExecutable(backend, f, {{2, 0}}));
+}
@@ -104,6 +104,29 @@ TEST(tensor, read_write)
     test_read_write<float>({1.0, 3.0, 5.0});
     test_read_write<int64_t>({-1, 2, 4});
 }
+
+TEST(tensor, stale_version)
+{
+    auto backend = runtime::Backend::create("INTERPRETER");
+    auto a = backend->create_tensor(element::f32, Shape{2});
+    auto b = backend->create_tensor(element::f32, Shape{2});
+
+    EXPECT_TRUE(a->get_stale());
+    EXPECT_NE(a->get_version(), 0);
+    EXPECT_NE(a->get_version(), b->get_version());
+
+    size_t version = a->get_version();
+    a->set_stale(false);
+    EXPECT_FALSE(a->get_stale());
+    EXPECT_EQ(a->get_version(), version);
+    a->set_stale(false);
+    EXPECT_EQ(a->get_version(), version);
+
+    a->set_stale(true);
+    EXPECT_TRUE(a->get_stale());
+    EXPECT_NE(a->get_version(), version);
+    EXPECT_NE(a->get_version(), b->get_version());
+}
 #endif
 
 TEST(tensor, output_flag)
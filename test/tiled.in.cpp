@@ -0,0 +1,109 @@
+//*****************************************************************************
+// Copyright 2017-2019 Intel Corporation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//*****************************************************************************
+
+
+#include <cmath>
+
+#include "gtest/gtest.h"
+#include "ngraph/ngraph.hpp"
+#include "ngraph/runtime/tiled/tiled_executable.hpp"
+#include "util/all_close_f.hpp"
+#include "util/test_control.hpp"
+#include "util/test_tools.hpp"
+
+using namespace std;
+using namespace ngraph;
+
+static string s_manifest = "${MANIFEST}";
+
+static vector<float> make_values(size_t count, float scale)
+{
+    vector<float> values(count);
+    for (size_t i = 0; i < count; i++)
+    {
+        values[i] = sin(scale * i);
+    }
+    return values;
+}
+
+// Padded convolution with a bias and Relu, a pooling, then a residual block whose padded
+// convolution and skip connection read its input at different offsets
+static shared_ptr<Function> make_segmentation_function(const Shape& image_shape)
+{
+    auto x = make_shared<op::Parameter>(element::f32, image_shape);
+    auto filters = make_shared<op::Parameter>(element::f32, Shape{3, 2, 3, 3});
+    auto bias = make_shared<op::Parameter>(element::f32, Shape{3});
+    auto block_filters = make_shared<op::Parameter>(element::f32, Shape{3, 3, 3, 3});
+
+    auto conv = make_shared<op::Convolution>(
+        x, filters, Strides{1, 1}, Strides{1, 1}, CoordinateDiff{1, 1}, CoordinateDiff{1, 1});
+    auto biased = make_shared<op::Add>(
+        conv, make_shared<op::Broadcast>(bias, conv->get_shape(), AxisSet{0, 2, 3}));
+    auto pool = make_shared<op::MaxPool>(make_shared<op::Relu>(biased), Shape{2, 2}, Strides{2, 2});
+    auto block = make_shared<op::Convolution>(pool,
+                                              block_filters,
+                                              Strides{1, 1},
+                                              Strides{1, 1},
+                                              CoordinateDiff{1, 1},
+                                              CoordinateDiff{1, 1});
+    auto y = make_shared<op::Add>(pool, make_shared<op::Relu>(block));
+    return make_shared<Function>(NodeVector{y}, ParameterVector{x, filters, bias, block_filters});
+}
+
+NGRAPH_TEST(tiled_${BACKEND_NAME}, matches_untiled)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    Shape image_shape{1, 2, 10, 13};
+    auto f = make_segmentation_function(image_shape);
+    auto untiled = backend->compile(f);
+    runtime::tiled::TiledExecutable tiled(backend, f, Shape{2, 4});
+    // The input region of a tile covers the two padded convolutions and the pooling between
+    EXPECT_EQ(tiled.get_input_tile_shape(), (Shape{10, 14}));
+    EXPECT_EQ(tiled.get_tile_counts(), (Shape{3, 2}));
+
+    vector<shared_ptr<runtime::Tensor>> inputs;
+    float scale = 0.37f;
+    for (const auto& parameter : f->get_parameters())
+    {
+        inputs.push_back(
+            backend->create_tensor(parameter->get_element_type(), parameter->get_shape()));
+        copy_data(inputs.back(), make_values(shape_size(parameter->get_shape()), scale));
+        scale += 0.21f;
+    }
+    Shape output_shape{1, 3, 5, 6};
+    ASSERT_EQ(f->get_output_shape(0), output_shape);
+    auto expected = backend->create_tensor(element::f32, output_shape);
+    auto result = backend->create_tensor(element::f32, output_shape);
+    ASSERT_TRUE(untiled->call_with_validate({expected}, inputs));
+    ASSERT_TRUE(tiled.call_with_validate({result}, inputs));
+    EXPECT_TRUE(test::all_close_f(read_vector<float>(expected), read_vector<float>(result)));
+}
+
+NGRAPH_TEST(tiled_${BACKEND_NAME}, unsupported)
+{
+    auto backend = runtime::Backend::create("${BACKEND_NAME}");
+    auto x = make_shared<op::Parameter>(element::f32, Shape{1, 2, 8, 8});
+
+    // A reduction over the spatial axes needs the whole image
+    auto sum = make_shared<op::Sum>(x, AxisSet{3});
+    auto f = make_shared<Function>(NodeVector{sum}, ParameterVector{x});
+    EXPECT_ANY_THROW(runtime::tiled::TiledExecutable(backend, f, Shape{4, 4}));
+
+    // Max pooling pads with values other than zero
+    auto pool = make_shared<op::MaxPool>(x, Shape{3, 3}, Strides{1, 1}, Shape{1, 1}, Shape{1, 1});
+    f = make_shared<Function>(NodeVector{pool}, ParameterVector{x});
+    EXPECT_ANY_THROW(runtime::tiled::TiledExecutable(backend, f, Shape{4, 4}));
+}
@@ -2542,6 +2542,56 @@ TEST(type_prop, embedding_lookup_shape_arg1_dynamic_embedding_length)
     ASSERT_TRUE(embed->get_output_partial_shape(0).same_scheme(expected));
 }
 
+TEST(type_prop, embedding_lookup_quantized)
+{
+    auto data = make_shared<op::Parameter>(element::i32, Shape{8, 12});
+    auto weights = make_shared<op::Parameter>(element::i8, Shape{5, 10});
+    auto scale = make_shared<op::Parameter>(element::f32, Shape{5});
+    auto bias = make_shared<op::Parameter>(element::f32, Shape{5});
+    auto embed = make_shared<op::EmbeddingLookup>(data, weights, scale, bias);
+    ASSERT_TRUE(embed->is_quantized());
+    ASSERT_EQ(embed->get_element_type(), element::f32);
+    ASSERT_EQ(embed->get_shape(), (Shape{8, 12, 10}));
+
+    auto f32_weights = make_shared<op::Parameter>(element::f32, Shape{5, 10});
+    EXPECT_THROW(make_shared<op::EmbeddingLookup>(data, f32_weights, scale, bias),
+                 NodeValidationFailure);
+    auto short_scale = make_shared<op::Parameter>(element::f32, Shape{4});
+    EXPECT_THROW(make_shared<op::EmbeddingLookup>(data, weights, short_scale, bias),
+                 NodeValidationFailure);
+    auto f64_bias = make_shared<op::Parameter>(element::f64, Shape{5});
+    EXPECT_THROW(make_shared<op::EmbeddingLookup>(data, weights, scale, f64_bias),
+                 NodeValidationFailure);
+}
+
+TEST(type_prop, embedding_lookup_backprop)
+{
+    auto data = make_shared<op::Parameter>(element::i32, Shape{8, 12});
+    auto delta = make_shared<op::Parameter>(element::f32, Shape{8, 12, 10});
+    auto backprop = make_shared<op::EmbeddingLookupBackprop>(data, delta, Shape{5, 10});
+    ASSERT_EQ(backprop->get_element_type(), element::f32);
+    ASSERT_EQ(backprop->get_shape(), (Shape{5, 10}));
+}
+
+TEST(type_prop, embedding_lookup_backprop_delta_mismatch)
+{
+    auto data = make_shared<op::Parameter>(element::i32, Shape{8, 12});
+    auto delta = make_shared<op::Parameter>(element::f32, Shape{8, 12, 9});
+    try
+    {
+        auto backprop = make_shared<op::EmbeddingLookupBackprop>(data, delta, Shape{5, 10});
+        FAIL() << "Mismatched delta shape not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), "does not match the output shape of the lookup");
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
 TEST(type_prop, comparison_good)
 {
     auto tv0_2_4_param_0 = make_shared<op::Parameter>(element::f32, Shape{2, 4});
@@ -13888,3 +13938,404 @@ TEST(type_prop, gemm_broadcast_input_C)
     EXPECT_EQ(gemm_func->get_element_type(), element::f32);
     EXPECT_EQ(gemm_func->get_shape(), (Shape{3, 4}));
 }
+
+TEST(type_prop, sgd_momentum_update)
+{
+    auto learning_rate = make_shared<op::Parameter>(element::f32, Shape{});
+    auto P1 = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto P2 = make_shared<op::Parameter>(element::f32, Shape{5});
+    auto update = make_shared<op::SgdMomentumUpdate>(
+        learning_rate, NodeVector{P1, P2}, NodeVector{P1, P2}, NodeVector{P1, P2});
+    EXPECT_EQ(update->get_group_size(), 2);
+    ASSERT_EQ(update->get_output_size(), 4);
+    EXPECT_EQ(update->get_output_shape(0), (Shape{3, 4}));
+    EXPECT_EQ(update->get_output_shape(1), (Shape{5}));
+    EXPECT_EQ(update->get_output_shape(2), (Shape{3, 4}));
+    EXPECT_EQ(update->get_output_shape(3), (Shape{5}));
+}
+
+TEST(type_prop, adam_update_state_shape_mismatch)
+{
+    auto learning_rate = make_shared<op::Parameter>(element::f32, Shape{});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto M = make_shared<op::Parameter>(element::f32, Shape{4, 3});
+    try
+    {
+        auto update = make_shared<op::AdamUpdate>(
+            learning_rate, NodeVector{P}, NodeVector{P}, NodeVector{M}, NodeVector{P});
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Mismatched optimizer state shape not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(),
+                             std::string("Shapes of parameter 0 and its state do not match"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, sgd_momentum_update_loss_scaled)
+{
+    auto learning_rate = make_shared<op::Parameter>(element::f32, Shape{});
+    auto loss_scale = make_shared<op::Parameter>(element::f32, Shape{});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto finite = make_shared<op::AllFinite>(NodeVector{P});
+    EXPECT_EQ(finite->get_element_type(), element::boolean);
+    EXPECT_EQ(finite->get_shape(), (Shape{}));
+    auto update = make_shared<op::SgdMomentumUpdate>(
+        learning_rate, loss_scale, finite, NodeVector{P}, NodeVector{P}, NodeVector{P});
+    EXPECT_TRUE(update->is_loss_scaled());
+    EXPECT_EQ(update->get_group_size(), 1);
+    ASSERT_EQ(update->get_output_size(), 2);
+    EXPECT_EQ(update->get_output_shape(0), (Shape{3, 4}));
+    EXPECT_EQ(update->get_output_shape(1), (Shape{3, 4}));
+}
+
+TEST(type_prop, adam_update_loss_scaled_finite_type)
+{
+    auto learning_rate = make_shared<op::Parameter>(element::f32, Shape{});
+    auto P = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    try
+    {
+        auto update = make_shared<op::AdamUpdate>(learning_rate,
+                                                  learning_rate,
+                                                  learning_rate,
+                                                  NodeVector{P},
+                                                  NodeVector{P},
+                                                  NodeVector{P},
+                                                  NodeVector{P});
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Non-boolean finite flag not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("Finite flag must be a boolean scalar"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, all_finite_integer_input)
+{
+    auto A = make_shared<op::Parameter>(element::i32, Shape{3});
+    try
+    {
+        auto finite = make_shared<op::AllFinite>(NodeVector{A});
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Integer input not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(),
+                             std::string("Input 0 must have a floating point element type"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, scaled_dot_product_attention)
+{
+    auto Q = make_shared<op::Parameter>(element::f32, Shape{8, 10, 16});
+    auto K = make_shared<op::Parameter>(element::f32, Shape{8, 12, 16});
+    auto V = make_shared<op::Parameter>(element::f32, Shape{8, 12, 32});
+    auto attention = make_shared<op::ScaledDotProductAttention>(Q, K, V, 0.25);
+    EXPECT_EQ(attention->get_element_type(), element::f32);
+    EXPECT_EQ(attention->get_shape(), (Shape{8, 10, 32}));
+}
+
+TEST(type_prop, scaled_dot_product_attention_mask_shape)
+{
+    auto Q = make_shared<op::Parameter>(element::f32, Shape{8, 10, 16});
+    auto K = make_shared<op::Parameter>(element::f32, Shape{8, 12, 16});
+    auto V = make_shared<op::Parameter>(element::f32, Shape{8, 12, 32});
+    auto M = make_shared<op::Parameter>(element::f32, Shape{8, 10, 10});
+    try
+    {
+        auto attention = make_shared<op::ScaledDotProductAttention>(Q, K, V, M, 0.25);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Incorrect mask shape not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("Mask must have shape"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, layer_norm)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8});
+    auto gamma = make_shared<op::Parameter>(element::f32, Shape{3, 8});
+    auto beta = make_shared<op::Parameter>(element::f32, Shape{3, 8});
+    auto layer_norm = make_shared<op::LayerNorm>(data, gamma, beta, 1e-5, 1);
+    EXPECT_EQ(layer_norm->get_element_type(), element::f32);
+    EXPECT_EQ(layer_norm->get_shape(), (Shape{2, 3, 8}));
+}
+
+TEST(type_prop, layer_norm_gamma_shape)
+{
+    auto data = make_shared<op::Parameter>(element::f32, Shape{2, 3, 8});
+    auto gamma = make_shared<op::Parameter>(element::f32, Shape{8});
+    auto beta = make_shared<op::Parameter>(element::f32, Shape{3, 8});
+    try
+    {
+        auto layer_norm = make_shared<op::LayerNorm>(data, gamma, beta, 1e-5, 1);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Incorrect gamma shape not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("Gamma and beta must have shape"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, gelu_integral_type)
+{
+    auto data = make_shared<op::Parameter>(element::i32, Shape{2, 3});
+    try
+    {
+        auto gelu = make_shared<op::Gelu>(data);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Integral element type not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("floating point element type"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, dropout)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto training = make_shared<op::Parameter>(element::f32, Shape{});
+    auto dropout = make_shared<op::Dropout>(x, training, 7, 0.9);
+    ASSERT_EQ(dropout->get_output_size(), 2);
+    EXPECT_EQ(dropout->get_output_element_type(0), element::f32);
+    EXPECT_EQ(dropout->get_output_shape(0), (Shape{3, 4}));
+    EXPECT_EQ(dropout->get_output_element_type(1), element::u64);
+    EXPECT_EQ(dropout->get_output_shape(1), (Shape{}));
+}
+
+TEST(type_prop, dropout_invalid_keep_probability)
+{
+    auto x = make_shared<op::Parameter>(element::f32, Shape{3, 4});
+    auto training = make_shared<op::Parameter>(element::f32, Shape{});
+    try
+    {
+        auto dropout = make_shared<op::Dropout>(x, training, 7, 0.0);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Invalid keep probability not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("Keep probability must be in (0, 1]"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, if_op)
+{
+    auto then_x = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto then_body = make_shared<Function>(NodeVector{then_x}, ParameterVector{then_x});
+    auto else_x = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto else_body = make_shared<Function>(
+        make_shared<op::Reshape>(else_x, AxisVector{1, 0}, Shape{3, 2}), ParameterVector{else_x});
+
+    auto condition = make_shared<op::Parameter>(element::boolean, Shape{});
+    auto x = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto if_op = make_shared<op::If>(condition, NodeVector{x}, then_body, then_body);
+    ASSERT_EQ(if_op->get_output_size(), 1);
+    EXPECT_EQ(if_op->get_output_element_type(0), element::f32);
+    EXPECT_EQ(if_op->get_output_shape(0), (Shape{2, 3}));
+
+    // the bodies disagree on the shape
+    if_op = make_shared<op::If>(condition, NodeVector{x}, then_body, else_body);
+    EXPECT_TRUE(if_op->get_output_partial_shape(0).same_scheme(PartialShape::dynamic()));
+}
+
+TEST(type_prop, if_op_argument_mismatch)
+{
+    auto body_x = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto body = make_shared<Function>(NodeVector{body_x}, ParameterVector{body_x});
+    auto condition = make_shared<op::Parameter>(element::boolean, Shape{});
+    auto x = make_shared<op::Parameter>(element::f32, Shape{3, 2});
+    try
+    {
+        auto if_op = make_shared<op::If>(condition, NodeVector{x}, body, body);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Argument mismatch not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("does not match argument 0"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, loop)
+{
+    auto i = make_shared<op::Parameter>(element::i64, Shape{});
+    auto body_acc = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto body_step = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto body = make_shared<Function>(
+        NodeVector{op::Constant::create(element::boolean, Shape{}, {1}),
+                   make_shared<op::Add>(body_acc, body_step)},
+        ParameterVector{i, body_acc, body_step});
+
+    auto trip_count = make_shared<op::Parameter>(element::i64, Shape{});
+    auto condition = make_shared<op::Parameter>(element::boolean, Shape{});
+    auto acc = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto step = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto loop =
+        make_shared<op::Loop>(trip_count, condition, NodeVector{acc}, NodeVector{step}, body);
+    ASSERT_EQ(loop->get_output_size(), 1);
+    EXPECT_EQ(loop->get_output_element_type(0), element::f32);
+    EXPECT_EQ(loop->get_output_shape(0), (Shape{4}));
+}
+
+TEST(type_prop, loop_carried_shape_changes)
+{
+    auto i = make_shared<op::Parameter>(element::i64, Shape{});
+    auto body_x = make_shared<op::Parameter>(element::f32, Shape{4});
+    auto body = make_shared<Function>(
+        NodeVector{op::Constant::create(element::boolean, Shape{}, {1}),
+                   make_shared<op::Concat>(NodeVector{body_x, body_x}, 0)},
+        ParameterVector{i, body_x});
+
+    auto trip_count = make_shared<op::Parameter>(element::i64, Shape{});
+    auto condition = make_shared<op::Parameter>(element::boolean, Shape{});
+    auto x = make_shared<op::Parameter>(element::f32, Shape{4});
+    try
+    {
+        auto loop = make_shared<op::Loop>(trip_count, condition, NodeVector{x}, NodeVector{}, body);
+        // Should have thrown, so fail if it didn't
+        FAIL() << "Loop-carried shape change not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), std::string("Loop-carried value 0 starts as"));
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, all_gather)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto all_gather = make_shared<op::AllGather>(arg, 4);
+    EXPECT_EQ(all_gather->get_element_type(), element::f32);
+    EXPECT_EQ(all_gather->get_shape(), (Shape{8, 3}));
+}
+
+TEST(type_prop, reduce_scatter)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{8, 3});
+    auto reduce_scatter = make_shared<op::ReduceScatter>(arg, 4);
+    EXPECT_EQ(reduce_scatter->get_element_type(), element::f32);
+    EXPECT_EQ(reduce_scatter->get_shape(), (Shape{2, 3}));
+}
+
+TEST(type_prop, reduce_scatter_not_divisible)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{6, 3});
+    try
+    {
+        auto reduce_scatter = make_shared<op::ReduceScatter>(arg, 4);
+        FAIL() << "Indivisible reduce-scatter axis not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(),
+                             "Axis 0 of the argument (6) is not divisible by the shard count (4)");
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, all_reduce_compressed)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto all_reduce = make_shared<op::AllReduce>(arg, element::f16);
+    EXPECT_EQ(all_reduce->get_element_type(), element::f32);
+    EXPECT_EQ(all_reduce->get_shape(), (Shape{2, 3}));
+}
+
+TEST(type_prop, all_reduce_compressed_f64)
+{
+    auto arg = make_shared<op::Parameter>(element::f64, Shape{2, 3});
+    try
+    {
+        auto all_reduce = make_shared<op::AllReduce>(arg, element::f16);
+        FAIL() << "Compression of an f64 all-reduce not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), "Compression is only supported for element type f32");
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, send)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    auto send = make_shared<op::Send>(arg, 1, 0);
+    EXPECT_EQ(send->get_element_type(), element::f32);
+    EXPECT_EQ(send->get_shape(), (Shape{2, 3}));
+}
+
+TEST(type_prop, send_negative_rank)
+{
+    auto arg = make_shared<op::Parameter>(element::f32, Shape{2, 3});
+    try
+    {
+        auto send = make_shared<op::Send>(arg, -1, 0);
+        FAIL() << "Negative destination rank not detected";
+    }
+    catch (const NodeValidationFailure& error)
+    {
+        EXPECT_HAS_SUBSTRING(error.what(), "Destination rank must not be negative");
+    }
+    catch (...)
+    {
+        FAIL() << "Deduced type check failed for unexpected reason";
+    }
+}
+
+TEST(type_prop, recv)
+{
+    auto recv = make_shared<op::Recv>(element::i32, Shape{4}, 0, 7);
+    EXPECT_EQ(recv->get_input_size(), 0);
+    EXPECT_EQ(recv->get_element_type(), element::i32);
+    EXPECT_EQ(recv->get_shape(), (Shape{4}));
+}
@@ -276,6 +276,27 @@ TEST(graph_util, clone_multiple_results)
     auto copy = clone_function(*f);
 }
 
+TEST(graph_util, clone_shares_constant_data)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto C = op::Constant::create(element::f32, shape, {1, 2, 3, 4});
+    auto f = make_shared<Function>(make_shared<op::Add>(A, C), ParameterVector{A});
+
+    NodeMap node_map;
+    auto copy = clone_function(*f, node_map);
+    auto C_copy = dynamic_pointer_cast<op::Constant>(node_map.at(C.get()));
+    ASSERT_NE(C_copy, nullptr);
+    EXPECT_EQ(C->get_data_ptr(), C_copy->get_data_ptr());
+    EXPECT_TRUE(C->is_data_shared());
+
+    EXPECT_TRUE(C_copy->make_data_unique());
+    EXPECT_NE(C->get_data_ptr(), C_copy->get_data_ptr());
+    EXPECT_FALSE(C->is_data_shared());
+    EXPECT_FALSE(C_copy->make_data_unique());
+    EXPECT_EQ((vector<float>{1, 2, 3, 4}), C_copy->get_vector<float>());
+}
+
 TEST(util, round_up)
 {
     EXPECT_EQ(0, round_up(0, 4));
@@ -394,6 +415,72 @@ TEST(graph_util, test_subgraph_topological_sort_control_dependencies)
     ASSERT_EQ(expected, sorted);
 }
 
+TEST(graph_util, cached_ordered_ops)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto B = make_shared<op::Parameter>(element::f32, shape);
+    auto C = make_shared<op::Parameter>(element::f32, shape);
+    auto D = make_shared<op::Abs>(A);
+    auto E = make_shared<op::Abs>(B);
+    auto add = A + B;
+    add->add_control_dependency(D);
+    add->add_control_dependency(E);
+    auto mul = C * add;
+    auto f = make_shared<Function>(NodeVector{mul, D}, ParameterVector{A, B, C});
+
+    for (bool include_control_deps : {false, true})
+    {
+        auto expected = topological_sort(f->get_ops(include_control_deps), include_control_deps);
+        EXPECT_EQ(f->get_ordered_ops(include_control_deps), expected);
+        // A second call is served from the cache
+        EXPECT_EQ(f->get_ordered_ops(include_control_deps), expected);
+    }
+
+    // Rewiring the graph invalidates the cached order
+    auto sub = make_shared<op::Subtract>(add, C);
+    replace_node(mul, sub);
+    auto ordered = f->get_ordered_ops();
+    EXPECT_EQ(ordered, topological_sort(f->get_ops(), true));
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), mul), 0);
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), sub), 1);
+
+    add->remove_control_dependency(E);
+    ordered = f->get_ordered_ops();
+    EXPECT_EQ(count(ordered.begin(), ordered.end(), E), 0);
+}
+
+TEST(graph_util, replace_node_observer)
+{
+    Shape shape{2, 2};
+    auto A = make_shared<op::Parameter>(element::f32, shape);
+    auto abs = make_shared<op::Abs>(A);
+    auto neg = make_shared<op::Negative>(abs);
+    auto result = make_shared<op::Result>(neg);
+
+    vector<pair<shared_ptr<Node>, shared_ptr<Node>>> outer_seen;
+    ReplaceNodeObserver outer(
+        [&](const shared_ptr<Node>& target, const shared_ptr<Node>& replacement) {
+            outer_seen.emplace_back(target, replacement);
+        });
+    auto sign = make_shared<op::Sign>(A);
+    {
+        size_t inner_count = 0;
+        ReplaceNodeObserver inner(
+            [&](const shared_ptr<Node>&, const shared_ptr<Node>&) { inner_count++; });
+        replace_node(abs, sign);
+        EXPECT_EQ(inner_count, 1);
+    }
+    auto relu = make_shared<op::Relu>(sign);
+    replace_node(neg, relu);
+
+    ASSERT_EQ(outer_seen.size(), 2);
+    EXPECT_EQ(outer_seen.at(0).first, abs);
+    EXPECT_EQ(outer_seen.at(0).second, sign);
+    EXPECT_EQ(outer_seen.at(1).first, neg);
+    EXPECT_EQ(outer_seen.at(1).second, relu);
+}
+
 TEST(util, enum_mask_construction)
 {
     enum class Type : uint32_t
@@ -537,3 +624,21 @@ TEST(util, enum_mask_operators)
     EXPECT_EQ(false, n[Type::d]);
     EXPECT_EQ(true, n[Type::b]);
 }
+
+TEST(util, resident_set_size)
+{
+    int64_t peak = get_peak_rss_kb();
+#ifndef _WIN32
+    EXPECT_GT(peak, 0);
+#endif
+#ifdef __linux__
+    int64_t current = get_current_rss_kb();
+    EXPECT_GT(current, 0);
+    EXPECT_LE(current, get_peak_rss_kb());
+
+    // Touching a buffer grows the resident set
+    vector<char> buffer(64 * 1024 * 1024, 1);
+    EXPECT_GE(get_current_rss_kb(), current + 32 * 1024);
+    EXPECT_GE(get_peak_rss_kb(), peak);
+#endif
+}